@@ -34,122 +34,139 @@
 #pragma warning(pop)
 
 
-// signedDataPackage may be binary, so we also need the length.
-bool verifySignedDataPackage(
-    const char* signaturePublicKey,
-    const char* signedDataPackage,
-    const size_t signedDataPackageLen,
+// Inflates a gzip or zlib stream into o_output, which is sized up front --
+// for gzip exactly, from the trailer -- so that it's (usually) allocated once.
+static bool InflatePackage(
+    const char* input,
+    size_t inputLen,
     bool gzipped,
-    string& authenticDataPackage)
+    size_t maxOutputLen,
+    string& o_output)
 {
-    const int SANITY_CHECK_SIZE = 10 * 1024 * 1024;
+    o_output.clear();
 
-    authenticDataPackage.clear();
+    size_t expectedLen = 0;
+    if (gzipped && inputLen >= 4)
+    {
+        // The gzip trailer ends with the uncompressed size (mod 2^32), little-endian
+        const unsigned char* isize = (const unsigned char*)input + inputLen - 4;
+        expectedLen = isize[0] | (isize[1] << 8) | (isize[2] << 16) | ((size_t)isize[3] << 24);
+    }
+    else
+    {
+        // Just a guess; JSON-wrapped base64 compresses about 3:1 or 4:1.
+        expectedLen = inputLen * 4;
+    }
+    expectedLen = max(min(expectedLen, maxOutputLen), (size_t)1);
 
-    string jsonString;
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.avail_in = (uInt)inputLen;
+    stream.next_in = (Bytef*)input;
 
-    // The package is compressed with either gzip or zip.
-    if (gzipped)
+    // windowBits 15+16 is gzip only; plain 15 is zlib only.
+    if (Z_OK != inflateInit2(&stream, gzipped ? 15 + 16 : 15))
     {
-        // See https://www.cryptopp.com/wiki/Gunzip#Decompress_to_String_using_Put.2FGet
-        CryptoPP::Gunzip unzipper;
-        try {
-            (void)unzipper.Put((const byte*)signedDataPackage, signedDataPackageLen);
-            (void)unzipper.MessageEnd();
-
-            auto jsonSize = unzipper.MaxRetrievable();
-            if (jsonSize == 0)
-            {
-                my_print(NOT_SENSITIVE, false, _T("%s: unzipper.MaxRetrievable returned 0 (%d)"), __TFUNCTION__, GetLastError());
-                return false;
-            }
-            else if (jsonSize > SANITY_CHECK_SIZE)
+        my_print(NOT_SENSITIVE, false, _T("%s: inflateInit failed"), __TFUNCTION__);
+        return false;
+    }
+
+    auto cleanup = finally([&]() { inflateEnd(&stream); });
+
+    o_output.resize(expectedLen);
+
+    int ret = Z_OK;
+    while (ret != Z_STREAM_END)
+    {
+        if (stream.total_out == o_output.size())
+        {
+            // The size was wrong (or a guess); grow.
+            if (o_output.size() >= maxOutputLen)
             {
-                my_print(NOT_SENSITIVE, false, _T("%s: Gunzip overflow (%d)"), __TFUNCTION__, GetLastError());
+                my_print(NOT_SENSITIVE, false, _T("%s: inflate overflow"), __TFUNCTION__);
                 return false;
             }
+            o_output.resize(min(o_output.size() * 2, maxOutputLen));
+        }
 
-            jsonString.resize((size_t)jsonSize);
+        stream.next_out = (Bytef*)&o_output[stream.total_out];
+        stream.avail_out = (uInt)(o_output.size() - stream.total_out);
 
-            unzipper.Get((byte*)&jsonString[0], jsonString.size());
-        }
-        catch (exception& e) {
-            my_print(NOT_SENSITIVE, false, _T("%s: Gunzip exception: %S"), __TFUNCTION__, e.what());
+        ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: inflate failed (%d)"), __TFUNCTION__, ret);
             return false;
         }
-    }
-    else // zip compressed
-    {
-        const int CHUNK_SIZE = 1024;
-        int ret;
-        z_stream stream;
-        char out[CHUNK_SIZE + 1];
-
-        stream.zalloc = Z_NULL;
-        stream.zfree = Z_NULL;
-        stream.opaque = Z_NULL;
-        stream.avail_in = signedDataPackageLen;
-        stream.next_in = (unsigned char*)signedDataPackage;
-
-        if (Z_OK != inflateInit(&stream))
+        if (ret == Z_OK && stream.avail_in == 0 && stream.avail_out > 0)
         {
-            my_print(NOT_SENSITIVE, false, _T("%s: inflateInit failed (%d)"), __TFUNCTION__, GetLastError());
+            my_print(NOT_SENSITIVE, false, _T("%s: truncated package"), __TFUNCTION__);
             return false;
         }
+    }
 
-        auto cleanup = finally([&]() { inflateEnd(&stream); });
+    o_output.resize(stream.total_out);
 
-        do
-        {
-            stream.avail_out = CHUNK_SIZE;
-            stream.next_out = (unsigned char*)out;
-            ret = inflate(&stream, Z_NO_FLUSH);
-            if (ret != Z_OK && ret != Z_STREAM_END)
-            {
-                my_print(NOT_SENSITIVE, false, _T("%s: inflate failed (%d)"), __TFUNCTION__, GetLastError());
-                return false;
-            }
+    if (o_output.empty())
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: empty package"), __TFUNCTION__);
+        return false;
+    }
 
-            out[CHUNK_SIZE - stream.avail_out] = '\0';
+    return true;
+}
 
-            jsonString += out;
+// signedDataPackage may be binary, so we also need the length.
+bool verifySignedDataPackage(
+    const char* signaturePublicKey,
+    const char* signedDataPackage,
+    const size_t signedDataPackageLen,
+    bool gzipped,
+    string& authenticDataPackage)
+{
+    const int SANITY_CHECK_SIZE = 10 * 1024 * 1024;
 
-            if (jsonString.length() > SANITY_CHECK_SIZE)
-            {
-                my_print(NOT_SENSITIVE, false, _T("%s: inflate overflow (%d)"), __TFUNCTION__, GetLastError());
-                return false;
-            }
+    authenticDataPackage.clear();
 
-        } while (ret != Z_STREAM_END);
+    // The package is compressed with either gzip or zip.
+    string jsonString;
+    if (!InflatePackage(signedDataPackage, signedDataPackageLen, gzipped, SANITY_CHECK_SIZE, jsonString))
+    {
+        return false;
     }
 
     // Read the values out of the JSON-formatted jsonData
     // See psi_ops_server_entry_auth.py for details
 
-    Json::Value json_entry;
-    Json::Reader reader;
-    bool parsingSuccessful = reader.parse(jsonString, json_entry);
-    if (!parsingSuccessful)
-    {
-        string fail = reader.getFormattedErrorMessages();
-        my_print(NOT_SENSITIVE, false, _T("%s: JSON parse failed: %S"), __TFUNCTION__, fail.c_str());
-        return false;
-    }
-
     string data;
     string base64Signature;
     string signingPublicKeyDigest;
 
-    try
-    {
-        data = json_entry.get("data", 0).asString();
-        base64Signature = json_entry.get("signature", 0).asString();
-        signingPublicKeyDigest = json_entry.get("signingPublicKeyDigest", 0).asString();
-    }
-    catch (exception& e)
     {
-        my_print(NOT_SENSITIVE, false, _T("%s: JSON parse exception: %S"), __TFUNCTION__, e.what());
-        return false;
+        Json::Value json_entry;
+        Json::Reader reader;
+        bool parsingSuccessful = reader.parse(jsonString.data(), jsonString.data() + jsonString.length(), json_entry, false);
+        if (!parsingSuccessful)
+        {
+            string fail = reader.getFormattedErrorMessages();
+            my_print(NOT_SENSITIVE, false, _T("%s: JSON parse failed: %S"), __TFUNCTION__, fail.c_str());
+            return false;
+        }
+
+        // The envelope's not needed any more; don't hold it alongside the data.
+        string().swap(jsonString);
+
+        try
+        {
+            data = json_entry.get("data", 0).asString();
+            base64Signature = json_entry.get("signature", 0).asString();
+            signingPublicKeyDigest = json_entry.get("signingPublicKeyDigest", 0).asString();
+        }
+        catch (exception& e)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: JSON parse exception: %S"), __TFUNCTION__, e.what());
+            return false;
+        }
     }
 
     // Match the presented public key digest against the embedded public key
@@ -187,18 +204,24 @@ bool verifySignedDataPackage(
         true,
         new CryptoPP::Base64Decoder(new CryptoPP::StringSink(signature)));
 
-    CryptoPP::StringSource(
-        string(data) + signature,
-        true,
-        new CryptoPP::SignatureVerificationFilter(
-            verifier,
-            new CryptoPP::ArraySink((byte*)&result, sizeof(result)),
-            CryptoPP::SignatureVerificationFilter::PUT_RESULT |
-            CryptoPP::SignatureVerificationFilter::SIGNATURE_AT_END));
+    // Hash the data in place, rather than copying it (with the signature
+    // appended) into a filter.
+    try
+    {
+        unique_ptr<CryptoPP::PK_MessageAccumulator> accumulator(verifier.NewVerificationAccumulator());
+        accumulator->Update((const byte*)data.data(), data.length());
+        verifier.InputSignature(*accumulator, (const byte*)signature.data(), signature.length());
+        result = verifier.VerifyAndRestart(*accumulator);
+    }
+    catch (exception& e)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: signature verification exception: %S"), __TFUNCTION__, e.what());
+        return false;
+    }
 
     if (result)
     {
-        authenticDataPackage = data;
+        authenticDataPackage.swap(data);
     }
 
     return result;
@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "background_transfer.h"
+#include "logging.h"
+#include "utilities.h"
+#include "tunnel_metrics.h"
+#include <mutex>
+#include <condition_variable>
+
+
+// How often a transfer waiting for its turn checks for a stop
+#define BACKGROUND_TRANSFER_STOP_CHECK_MS           250
+// The user's traffic counts as active above this rate
+#define BACKGROUND_TRANSFER_FOREGROUND_BYTES_PER_S  (16 * 1024)
+// While it's active, background downloads are held to this share of the
+// best rate seen, but never below the floor, so they still get done.
+#define BACKGROUND_TRANSFER_SHARE_PERCENT           25
+#define BACKGROUND_TRANSFER_FLOOR_BYTES_PER_S       (8 * 1024)
+// Rates are measured, and the cap set, over windows of this long
+#define BACKGROUND_TRANSFER_WINDOW_MS               1000
+// Pacing waits on a WinHTTP thread, so no one wait is long
+#define BACKGROUND_TRANSFER_MAX_WAIT_MS             500
+// Turns given up before the download goes on regardless
+#define BACKGROUND_DOWNLOAD_MAX_YIELDS              10
+
+// Next to a partial download: the ETag of the response it's part of
+#define BACKGROUND_DOWNLOAD_ETAG_SUFFIX             _T(".etag")
+
+#define HTTP_PARTIAL_CONTENT                        206
+#define HTTP_RANGE_NOT_SATISFIABLE                  416
+
+
+/***********************************************************************
+ BackgroundTransferTurn
+ */
+
+static std::mutex g_backgroundTransferLock;
+static std::condition_variable g_backgroundTransferTurnFree;
+static bool g_backgroundTransferActive = false;
+static unsigned int g_backgroundTransfersWaiting[BACKGROUND_TRANSFER_PRIORITY_COUNT] = { 0 };
+
+// Must be called with g_backgroundTransferLock held.
+static bool HigherPriorityTransferWaiting(BackgroundTransferPriority priority)
+{
+    for (int i = 0; i < priority; i++)
+    {
+        if (g_backgroundTransfersWaiting[i] > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+BackgroundTransferTurn::BackgroundTransferTurn(BackgroundTransferPriority priority, const StopInfo& stopInfo)
+    : m_priority(priority)
+{
+    std::unique_lock<std::mutex> lock(g_backgroundTransferLock);
+
+    g_backgroundTransfersWaiting[priority]++;
+    auto doneWaiting = finally([priority]() {
+        // Still locked: declared after the lock, so destroyed before it
+        g_backgroundTransfersWaiting[priority]--;
+        g_backgroundTransferTurnFree.notify_all();
+    });
+
+    while (g_backgroundTransferActive || HigherPriorityTransferWaiting(priority))
+    {
+        (void)g_backgroundTransferTurnFree.wait_for(
+                lock,
+                std::chrono::milliseconds(BACKGROUND_TRANSFER_STOP_CHECK_MS));
+
+        if (stopInfo.stopSignal)
+        {
+            (void)stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+        }
+    }
+
+    g_backgroundTransferActive = true;
+}
+
+BackgroundTransferTurn::~BackgroundTransferTurn()
+{
+    std::lock_guard<std::mutex> lock(g_backgroundTransferLock);
+    g_backgroundTransferActive = false;
+    g_backgroundTransferTurnFree.notify_all();
+}
+
+bool BackgroundTransferTurn::ShouldYield() const
+{
+    std::lock_guard<std::mutex> lock(g_backgroundTransferLock);
+    return HigherPriorityTransferWaiting(m_priority);
+}
+
+
+/***********************************************************************
+ BackgroundTransferPacer
+ */
+
+/*
+Holds a download to its share of the tunnel while the user's traffic is
+active. The user's rate is the tunnel's, as counted by TunnelMetrics, less the
+download's own when the download goes through the tunnel. Not threadsafe;
+the response sink calls are one at a time.
+*/
+class BackgroundTransferPacer
+{
+public:
+    BackgroundTransferPacer(bool tunneled);
+
+    // Waits as needed after bytes more have been received.
+    void Pace(size_t bytes);
+
+private:
+    void StartWindow(DWORD now);
+
+private:
+    bool m_tunneled;
+    DWORD m_windowStart;
+    unsigned long long m_windowTunnelBytes;
+    unsigned long long m_windowOwnBytes;
+    unsigned long long m_peakBytesPerSecond;
+    // 0 for no cap
+    unsigned long long m_capBytesPerSecond;
+};
+
+static unsigned long long TunnelBytesReceived()
+{
+    unsigned long long sent = 0, received = 0;
+    int tunnelCount = 0;
+    TunnelMetrics::GetTotals(sent, received, tunnelCount);
+    return received;
+}
+
+BackgroundTransferPacer::BackgroundTransferPacer(bool tunneled)
+    : m_tunneled(tunneled),
+      m_peakBytesPerSecond(0),
+      m_capBytesPerSecond(0)
+{
+    StartWindow(GetTickCount());
+}
+
+void BackgroundTransferPacer::StartWindow(DWORD now)
+{
+    m_windowStart = now;
+    m_windowTunnelBytes = TunnelBytesReceived();
+    m_windowOwnBytes = 0;
+}
+
+void BackgroundTransferPacer::Pace(size_t bytes)
+{
+    m_windowOwnBytes += bytes;
+
+    DWORD now = GetTickCount();
+    DWORD elapsed = now - m_windowStart;
+
+    if (elapsed >= BACKGROUND_TRANSFER_WINDOW_MS)
+    {
+        unsigned long long tunnelBytes = TunnelBytesReceived() - m_windowTunnelBytes;
+        unsigned long long tunnelRate = tunnelBytes * 1000 / elapsed;
+        unsigned long long ownRate = m_windowOwnBytes * 1000 / elapsed;
+
+        // An untunneled download still shares the link, but its bytes aren't
+        // the tunnel's.
+        unsigned long long foregroundRate = tunnelRate;
+        if (m_tunneled)
+        {
+            foregroundRate = (tunnelRate > ownRate) ? tunnelRate - ownRate : 0;
+        }
+
+        m_peakBytesPerSecond = max(m_peakBytesPerSecond, max(tunnelRate, ownRate));
+
+        if (foregroundRate >= BACKGROUND_TRANSFER_FOREGROUND_BYTES_PER_S)
+        {
+            m_capBytesPerSecond = max(
+                                    m_peakBytesPerSecond * BACKGROUND_TRANSFER_SHARE_PERCENT / 100,
+                                    (unsigned long long)BACKGROUND_TRANSFER_FLOOR_BYTES_PER_S);
+        }
+        else
+        {
+            m_capBytesPerSecond = 0;
+        }
+
+        StartWindow(now);
+        return;
+    }
+
+    if (m_capBytesPerSecond == 0)
+    {
+        return;
+    }
+
+    // How long this window's bytes should have taken at the cap
+    unsigned long long due = m_windowOwnBytes * 1000 / m_capBytesPerSecond;
+    if (due > elapsed)
+    {
+        Sleep((DWORD)min(due - elapsed, (unsigned long long)BACKGROUND_TRANSFER_MAX_WAIT_MS));
+    }
+}
+
+
+/***********************************************************************
+ BackgroundDownload
+ */
+
+/*
+Writes a response body to a file, appending to what's there for a partial
+content response to a range request, and keeping the response's ETag beside
+it so that an interrupted download can be resumed. Error responses aren't
+written. Gives up -- aborting the request -- if the turn should be yielded.
+*/
+class ResumableFileSink : public IHTTPSResponseSink
+{
+public:
+    ResumableFileSink(
+        const tstring& filePath,
+        unsigned long long resumeOffset,
+        const BackgroundTransferTurn& turn,
+        bool tunneled);
+    virtual ~ResumableFileSink();
+
+    virtual bool Begin(int statusCode, const string& etag, DWORD contentLength);
+    virtual bool Write(const char* data, size_t length);
+
+    // Call once the request is done, before using the file.
+    void Close();
+
+    bool Yielded() const { return m_yielded; }
+
+private:
+    tstring m_filePath;
+    unsigned long long m_resumeOffset;
+    const BackgroundTransferTurn& m_turn;
+    BackgroundTransferPacer m_pacer;
+    HANDLE m_file;
+    bool m_discard;
+    bool m_yielded;
+};
+
+ResumableFileSink::ResumableFileSink(
+                    const tstring& filePath,
+                    unsigned long long resumeOffset,
+                    const BackgroundTransferTurn& turn,
+                    bool tunneled)
+    : m_filePath(filePath),
+      m_resumeOffset(resumeOffset),
+      m_turn(turn),
+      m_pacer(tunneled),
+      m_file(INVALID_HANDLE_VALUE),
+      m_discard(false),
+      m_yielded(false)
+{
+}
+
+ResumableFileSink::~ResumableFileSink()
+{
+    Close();
+}
+
+bool ResumableFileSink::Begin(int statusCode, const string& etag, DWORD /*contentLength*/)
+{
+    // A retried request (e.g., through the URL proxy) starts over from the
+    // same offset.
+    Close();
+    m_discard = false;
+
+    tstring etagPath = m_filePath + BACKGROUND_DOWNLOAD_ETAG_SUFFIX;
+
+    if (statusCode == HTTP_PARTIAL_CONTENT && m_resumeOffset > 0)
+    {
+        m_file = CreateFile(m_filePath.c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        LARGE_INTEGER offset;
+        offset.QuadPart = (LONGLONG)m_resumeOffset;
+        if (m_file != INVALID_HANDLE_VALUE
+            && (!SetFilePointerEx(m_file, offset, NULL, FILE_BEGIN) || !SetEndOfFile(m_file)))
+        {
+            CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+    }
+    else if (statusCode == HTTPSRequest::OK)
+    {
+        // The old ETag goes first, so that it's never beside a different
+        // response's bytes.
+        (void)DeleteFile(etagPath.c_str());
+
+        m_file = CreateFile(m_filePath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        // Weak ETags can't be used to resume.
+        if (m_file != INVALID_HANDLE_VALUE && !etag.empty() && etag.compare(0, 2, "W/") != 0)
+        {
+            (void)WriteFile(etagPath, etag);
+        }
+    }
+    else
+    {
+        m_discard = true;
+        return true;
+    }
+
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: opening file failed (%d)"), __TFUNCTION__, GetLastError());
+        return false;
+    }
+
+    return true;
+}
+
+bool ResumableFileSink::Write(const char* data, size_t length)
+{
+    if (m_discard)
+    {
+        return true;
+    }
+
+    if (m_turn.ShouldYield())
+    {
+        m_yielded = true;
+        return false;
+    }
+
+    DWORD written = 0;
+    if (m_file == INVALID_HANDLE_VALUE
+        || !::WriteFile(m_file, data, (DWORD)length, &written, NULL)
+        || written != length)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: WriteFile failed (%d)"), __TFUNCTION__, GetLastError());
+        return false;
+    }
+
+    m_pacer.Pace(length);
+    return true;
+}
+
+void ResumableFileSink::Close()
+{
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+        m_file = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool BackgroundDownload(
+        BackgroundTransferPriority priority,
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const TCHAR* requestPath,
+        const tstring& filePath,
+        const StopInfo& stopInfo,
+        HTTPSRequest::PsiphonProxy usePsiphonLocalProxy,
+        bool failoverToURLProxy,
+        int& o_responseCode)
+{
+    o_responseCode = -1;
+    bool tunneled = (usePsiphonLocalProxy != HTTPSRequest::PsiphonProxy::DONT_USE);
+
+    for (int yields = 0; ; )
+    {
+        // A partial download can only be resumed if we know what it's part of.
+        string etag;
+        unsigned long long resumeOffset = 0;
+        if (ReadFileContents(filePath + BACKGROUND_DOWNLOAD_ETAG_SUFFIX, etag) && !etag.empty())
+        {
+            WIN32_FILE_ATTRIBUTE_DATA attributes;
+            if (GetFileAttributesEx(filePath.c_str(), GetFileExInfoStandard, &attributes))
+            {
+                resumeOffset = ((unsigned long long)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+            }
+        }
+
+        // If-Range: if the response has changed since, it's sent whole.
+        wstring rangeHeaders;
+        if (resumeOffset > 0)
+        {
+            wstringstream headers;
+            headers << L"Range: bytes=" << resumeOffset << L"-\r\n"
+                    << L"If-Range: " << UTF8ToWString(etag) << L"\r\n";
+            rangeHeaders = headers.str();
+            my_print(NOT_SENSITIVE, true, _T("%s: resuming at %llu bytes"), __TFUNCTION__, resumeOffset);
+        }
+
+        // Throws if stop was signaled
+        BackgroundTransferTurn turn(priority, stopInfo);
+
+        ResumableFileSink sink(filePath, resumeOffset, turn, tunneled);
+        HTTPSRequest httpsRequest;
+        HTTPSRequest::Response httpsResponse;
+        httpsRequest.SetResponseSink(&sink);
+
+        bool requested = httpsRequest.MakeRequest(
+                            serverAddress,
+                            serverWebPort,
+                            "",
+                            requestPath,
+                            stopInfo,
+                            usePsiphonLocalProxy,
+                            httpsResponse,
+                            failoverToURLProxy,
+                            rangeHeaders.empty() ? NULL : rangeHeaders.c_str());
+        sink.Close();
+        o_responseCode = httpsResponse.code;
+
+        if (sink.Yielded() && yields < BACKGROUND_DOWNLOAD_MAX_YIELDS)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: yielding to a higher priority transfer"), __TFUNCTION__);
+            yields++;
+            continue;
+        }
+
+        if (requested
+            && (o_responseCode == HTTPSRequest::OK
+                || (o_responseCode == HTTP_PARTIAL_CONTENT && resumeOffset > 0)))
+        {
+            o_responseCode = HTTPSRequest::OK;
+            return true;
+        }
+
+        if (requested && o_responseCode == HTTP_RANGE_NOT_SATISFIABLE && resumeOffset > 0)
+        {
+            // What we have doesn't fit the response after all; start over.
+            BackgroundDownloadDiscard(filePath);
+            continue;
+        }
+
+        return false;
+    }
+}
+
+void BackgroundDownloadDiscard(const tstring& filePath)
+{
+    (void)DeleteFile((filePath + BACKGROUND_DOWNLOAD_ETAG_SUFFIX).c_str());
+    (void)DeleteFile(filePath.c_str());
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "httpsrequest.h"
+#include "stopsignal.h"
+
+
+/*
+Coordinates the client's own background transfers, so that they don't
+compete with each other -- or, more than need be, with the user's traffic --
+on slow links.
+
+Transfers take turns, highest priority first; a transfer that can resume
+(see BackgroundDownload) gives up its turn when a higher priority one is
+waiting. Downloads are also paced: while the user's own traffic is active,
+they're held to a share of the best throughput the tunnel has shown.
+
+PsiCash requests aren't background transfers: they're small, and the user
+is waiting on them.
+Threadsafe.
+*/
+
+enum BackgroundTransferPriority
+{
+    // Highest first
+    BACKGROUND_TRANSFER_PRIORITY_FEEDBACK = 0,
+    BACKGROUND_TRANSFER_PRIORITY_REMOTE_SERVER_LIST,
+    BACKGROUND_TRANSFER_PRIORITY_UPGRADE,
+    BACKGROUND_TRANSFER_PRIORITY_COUNT
+};
+
+// Held for the length of a background transfer. The constructor waits for
+// the transfer's turn, and throws StopSignal::StopException if stop is
+// signaled first.
+class BackgroundTransferTurn
+{
+public:
+    BackgroundTransferTurn(BackgroundTransferPriority priority, const StopInfo& stopInfo);
+    virtual ~BackgroundTransferTurn();
+
+    // True if a higher priority transfer is waiting for this one to finish.
+    bool ShouldYield() const;
+
+private:
+    BackgroundTransferPriority m_priority;
+};
+
+// Downloads requestPath into filePath as a background transfer. If filePath
+// holds what an earlier, interrupted attempt got of the same response, only
+// the rest is asked for (when the server supports ranges). A turn given up
+// to a higher priority transfer is waited for again, and the download picks
+// up where it left off.
+// Returns true only once filePath holds the whole response body;
+// o_responseCode is then OK, and otherwise whatever the response was (-1 if
+// there was none). Error response bodies aren't kept, but what's been
+// downloaded is, for the next attempt; see BackgroundDownloadDiscard.
+// Throws StopSignal::StopException if stop was signaled.
+bool BackgroundDownload(
+        BackgroundTransferPriority priority,
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const TCHAR* requestPath,
+        const tstring& filePath,
+        const StopInfo& stopInfo,
+        HTTPSRequest::PsiphonProxy usePsiphonLocalProxy,
+        bool failoverToURLProxy,
+        int& o_responseCode);
+
+// Deletes a download, complete or not, so the next one starts afresh.
+void BackgroundDownloadDiscard(const tstring& filePath);
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include <emmintrin.h>
+#include "codec_kernels.h"
+
+
+static bool HasSSE2()
+{
+    static const bool hasSSE2 = !!IsProcessorFeaturePresent(PF_XMMI64_INSTRUCTIONS_AVAILABLE);
+    return hasSSE2;
+}
+
+
+/***********************************************************************
+ Hex
+ */
+
+static const char* const HEX_DIGITS = "0123456789ABCDEF";
+
+// Digit values by character; -1 for non-digits
+struct HexDigitValues
+{
+    signed char values[256];
+
+    HexDigitValues()
+    {
+        memset(values, -1, sizeof(values));
+        for (int i = 0; i < 10; i++)
+        {
+            values['0' + i] = (signed char)i;
+        }
+        for (int i = 0; i < 6; i++)
+        {
+            values['a' + i] = values['A' + i] = (signed char)(10 + i);
+        }
+    }
+};
+
+static const signed char* GetHexDigitValues()
+{
+    static const HexDigitValues table;
+    return table.values;
+}
+
+static void HexEncodeScalar(const unsigned char* input, size_t length, char* output)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        output[2*i] = HEX_DIGITS[input[i] >> 4];
+        output[2*i + 1] = HEX_DIGITS[input[i] & 15];
+    }
+}
+
+static bool HexDecodeScalar(const char* input, size_t length, unsigned char* output)
+{
+    const signed char* values = GetHexDigitValues();
+
+    for (size_t i = 0; i < length; i += 2)
+    {
+        signed char high = values[(unsigned char)input[i]];
+        signed char low = values[(unsigned char)input[i + 1]];
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        output[i / 2] = (unsigned char)((high << 4) | low);
+    }
+
+    return true;
+}
+
+// 16 nibbles to their hex digits
+static inline __m128i NibblesToHexSSE2(__m128i nibbles)
+{
+    // '0' is added to all, and then the distance to 'A' to those over 9
+    __m128i letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(
+            _mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+            _mm_and_si128(letters, _mm_set1_epi8('A' - '0' - 10)));
+}
+
+static void HexEncodeSSE2(const unsigned char* input, size_t length, char* output)
+{
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(input + i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask);
+        __m128i low = _mm_and_si128(bytes, lowMask);
+
+        // Interleaved so each byte's high nibble comes first
+        _mm_storeu_si128((__m128i*)(output + 2*i), NibblesToHexSSE2(_mm_unpacklo_epi8(high, low)));
+        _mm_storeu_si128((__m128i*)(output + 2*i + 16), NibblesToHexSSE2(_mm_unpackhi_epi8(high, low)));
+    }
+
+    HexEncodeScalar(input + i, length - i, output + 2*i);
+}
+
+// 16 hex digits to their values. Returns false if any isn't a hex digit.
+// (Bytes over 0x7F are negative in the signed compares, so fail both ranges.)
+static inline bool HexToNibblesSSE2(__m128i chars, __m128i& o_nibbles)
+{
+    __m128i isDigit = _mm_and_si128(
+                        _mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                        _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i isLetter = _mm_and_si128(
+                        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                        _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    o_nibbles = _mm_or_si128(
+                    _mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                    _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+
+    return _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) == 0xFFFF;
+}
+
+// Each 16-bit lane holds a high nibble in its low byte (the first digit)
+// and a low nibble in its high byte; combines them into the lane's low byte.
+static inline __m128i CombineNibblesSSE2(__m128i nibbles)
+{
+    return _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4),
+            _mm_srli_epi16(nibbles, 8));
+}
+
+static bool HexDecodeSSE2(const char* input, size_t length, unsigned char* output)
+{
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        __m128i first, second;
+        if (!HexToNibblesSSE2(_mm_loadu_si128((const __m128i*)(input + i)), first)
+            || !HexToNibblesSSE2(_mm_loadu_si128((const __m128i*)(input + i + 16)), second))
+        {
+            return false;
+        }
+
+        _mm_storeu_si128(
+            (__m128i*)(output + i / 2),
+            _mm_packus_epi16(CombineNibblesSSE2(first), CombineNibblesSSE2(second)));
+    }
+
+    return HexDecodeScalar(input + i, length - i, output + i / 2);
+}
+
+void HexEncode(const unsigned char* input, size_t length, char* output)
+{
+    if (HasSSE2())
+    {
+        HexEncodeSSE2(input, length, output);
+    }
+    else
+    {
+        HexEncodeScalar(input, length, output);
+    }
+}
+
+bool HexDecode(const char* input, size_t length, unsigned char* output)
+{
+    assert((length & 1) == 0);
+
+    if (HasSSE2())
+    {
+        return HexDecodeSSE2(input, length, output);
+    }
+    return HexDecodeScalar(input, length, output);
+}
+
+
+/***********************************************************************
+ ASCII
+ */
+
+static size_t WidenASCIIScalar(const char* input, size_t length, wchar_t* output)
+{
+    size_t i = 0;
+    for (; i < length && (unsigned char)input[i] < 0x80; i++)
+    {
+        output[i] = (wchar_t)input[i];
+    }
+    return i;
+}
+
+static size_t NarrowASCIIScalar(const wchar_t* input, size_t length, char* output)
+{
+    size_t i = 0;
+    for (; i < length && input[i] < 0x80; i++)
+    {
+        output[i] = (char)input[i];
+    }
+    return i;
+}
+
+static size_t WidenASCIISSE2(const char* input, size_t length, wchar_t* output)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i chars = _mm_loadu_si128((const __m128i*)(input + i));
+        if (_mm_movemask_epi8(chars) != 0)
+        {
+            // The scalar code finds where
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)(output + i), _mm_unpacklo_epi8(chars, zero));
+        _mm_storeu_si128((__m128i*)(output + i + 8), _mm_unpackhi_epi8(chars, zero));
+    }
+
+    return i + WidenASCIIScalar(input + i, length - i, output + i);
+}
+
+static size_t NarrowASCIISSE2(const wchar_t* input, size_t length, char* output)
+{
+    const __m128i nonASCIIMask = _mm_set1_epi16((short)0xFF80);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i first = _mm_loadu_si128((const __m128i*)(input + i));
+        __m128i second = _mm_loadu_si128((const __m128i*)(input + i + 8));
+        __m128i nonASCII = _mm_and_si128(_mm_or_si128(first, second), nonASCIIMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonASCII, _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)(output + i), _mm_packus_epi16(first, second));
+    }
+
+    return i + NarrowASCIIScalar(input + i, length - i, output + i);
+}
+
+size_t WidenASCII(const char* input, size_t length, wchar_t* output)
+{
+    if (HasSSE2())
+    {
+        return WidenASCIISSE2(input, length, output);
+    }
+    return WidenASCIIScalar(input, length, output);
+}
+
+size_t NarrowASCII(const wchar_t* input, size_t length, char* output)
+{
+    if (HasSSE2())
+    {
+        return NarrowASCIISSE2(input, length, output);
+    }
+    return NarrowASCIIScalar(input, length, output);
+}
+
+
+/***********************************************************************
+ Base64
+ */
+
+static const char* const BASE64_ALPHABET =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#define BASE64_INVALID      -1
+#define BASE64_WHITESPACE   -2
+#define BASE64_PADDING      -3
+
+// Sextet values by character, or one of the above
+struct Base64Values
+{
+    signed char values[256];
+
+    Base64Values()
+    {
+        memset(values, BASE64_INVALID, sizeof(values));
+        for (int i = 0; i < 64; i++)
+        {
+            values[(unsigned char)BASE64_ALPHABET[i]] = (signed char)i;
+        }
+        values[' '] = values['\t'] = values['\r'] = values['\n'] = BASE64_WHITESPACE;
+        values['='] = BASE64_PADDING;
+    }
+};
+
+static const signed char* GetBase64Values()
+{
+    static const Base64Values table;
+    return table.values;
+}
+
+size_t Base64EncodedLength(size_t length)
+{
+    return (length + 2) / 3 * 4;
+}
+
+void Base64EncodeBytes(const unsigned char* input, size_t length, char* output)
+{
+    size_t i = 0;
+    for (; i + 3 <= length; i += 3)
+    {
+        unsigned int quantum = (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+        *output++ = BASE64_ALPHABET[quantum >> 18];
+        *output++ = BASE64_ALPHABET[(quantum >> 12) & 63];
+        *output++ = BASE64_ALPHABET[(quantum >> 6) & 63];
+        *output++ = BASE64_ALPHABET[quantum & 63];
+    }
+
+    if (i < length)
+    {
+        unsigned int quantum = input[i] << 16;
+        if (i + 1 < length)
+        {
+            quantum |= input[i + 1] << 8;
+        }
+
+        *output++ = BASE64_ALPHABET[quantum >> 18];
+        *output++ = BASE64_ALPHABET[(quantum >> 12) & 63];
+        *output++ = (i + 1 < length) ? BASE64_ALPHABET[(quantum >> 6) & 63] : '=';
+        *output++ = '=';
+    }
+}
+
+size_t Base64MaxDecodedLength(size_t length)
+{
+    return (length / 4 + 1) * 3;
+}
+
+size_t Base64ChunkLength(const char* input, size_t length, size_t maxChunk)
+{
+    if (length <= maxChunk)
+    {
+        return length;
+    }
+
+    const signed char* values = GetBase64Values();
+
+    size_t chunkLength = 0;
+    int sextets = 0;
+
+    for (size_t i = 0; i < maxChunk; i++)
+    {
+        signed char value = values[(unsigned char)input[i]];
+        if (value == BASE64_WHITESPACE)
+        {
+            continue;
+        }
+        else if (value == BASE64_PADDING)
+        {
+            return length;
+        }
+
+        if (++sextets == 4)
+        {
+            sextets = 0;
+            chunkLength = i + 1;
+        }
+    }
+
+    return chunkLength;
+}
+
+bool Base64DecodeBytes(const char* input, size_t length, unsigned char* output, size_t& o_outputLength)
+{
+    const signed char* values = GetBase64Values();
+
+    size_t outputLength = 0;
+    unsigned int quantum = 0;
+    int sextets = 0;
+    int padding = 0;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        signed char value = values[(unsigned char)input[i]];
+        if (value == BASE64_WHITESPACE)
+        {
+            continue;
+        }
+        else if (value == BASE64_PADDING)
+        {
+            padding++;
+            continue;
+        }
+        else if (value < 0 || padding > 0)
+        {
+            // Not Base64, or data after the padding
+            return false;
+        }
+
+        quantum = (quantum << 6) | value;
+        if (++sextets == 4)
+        {
+            output[outputLength++] = (unsigned char)(quantum >> 16);
+            output[outputLength++] = (unsigned char)(quantum >> 8);
+            output[outputLength++] = (unsigned char)quantum;
+            quantum = 0;
+            sextets = 0;
+        }
+    }
+
+    // A final partial quantum needs at least two sextets, and any padding
+    // must fill it out exactly.
+    if (sextets == 1 || padding > 2 || (padding > 0 && sextets + padding != 4))
+    {
+        return false;
+    }
+
+    if (sextets == 2)
+    {
+        output[outputLength++] = (unsigned char)(quantum >> 4);
+    }
+    else if (sextets == 3)
+    {
+        output[outputLength++] = (unsigned char)(quantum >> 10);
+        output[outputLength++] = (unsigned char)(quantum >> 2);
+    }
+
+    o_outputLength = outputLength;
+    return true;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+/*
+Codec kernels behind Hexlify, Dehexlify, Base64Encode and Base64Decode (see
+utilities.h) and the UTF-8/UTF-16 conversions' ASCII fast path (see
+tstring.h). Callers should use those.
+
+The hex and ASCII kernels have SSE2 versions, used when the CPU has it --
+checked at runtime, as XP-era CPUs may not -- with scalar fallbacks. Output
+buffers must be sized by the caller.
+*/
+
+// Writes 2*length uppercase hex digits to output.
+void HexEncode(const unsigned char* input, size_t length, char* output);
+
+// Decodes length hex digits (either case; length must be even) into
+// length/2 bytes of output. Returns false if there's a non-hex-digit.
+bool HexDecode(const char* input, size_t length, unsigned char* output);
+
+// Standard alphabet, with padding, without line breaks.
+size_t Base64EncodedLength(size_t length);
+void Base64EncodeBytes(const unsigned char* input, size_t length, char* output);
+
+// Whitespace (e.g., line breaks) is skipped. output must have room for
+// Base64MaxDecodedLength(length) bytes. Returns false if the input isn't
+// valid Base64; otherwise o_outputLength is the decoded length.
+size_t Base64MaxDecodedLength(size_t length);
+bool Base64DecodeBytes(const char* input, size_t length, unsigned char* output, size_t& o_outputLength);
+
+// For decoding Base64 a chunk at a time: the length of the next chunk of
+// input that decodes on its own -- the longest one, of at most maxChunk
+// characters, that ends on a quantum boundary. All of input, if it fits or
+// if padding (which ends the data) is reached. Returns 0 if maxChunk is too
+// small to hold a quantum.
+size_t Base64ChunkLength(const char* input, size_t length, size_t maxChunk);
+
+// Convert the leading run of ASCII characters, up to length. Return how many
+// were converted: the index of the first non-ASCII character, if any.
+size_t WidenASCII(const char* input, size_t length, wchar_t* output);
+size_t NarrowASCII(const wchar_t* input, size_t length, char* output);
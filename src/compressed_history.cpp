@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "compressed_history.h"
+#pragma warning(push, 0)
+#pragma warning(disable: 4244)
+#include "filters.h"
+#include "zdeflate.h"
+#include "zinflate.h"
+#pragma warning(pop)
+
+
+// Uncompressed bytes gathered before a block is compressed: big enough for
+// deflate to find the repetition in log lines, small enough that a block is
+// quick to compress on the logging thread.
+#define COMPRESSED_HISTORY_BLOCK_BYTES  (64*1024)
+
+
+CompressedHistory::CompressedHistory(size_t maxCompressedBytes)
+    : m_maxCompressedBytes(maxCompressedBytes),
+      m_compressedBytes(0),
+      m_pendingCount(0),
+      m_recordCount(0),
+      m_droppedCount(0)
+{
+}
+
+void CompressedHistory::Append(const string& record)
+{
+    unsigned int length = (unsigned int)record.length();
+    m_pending.append((const char*)&length, sizeof(length));
+    m_pending.append(record);
+    m_pendingCount++;
+    m_recordCount++;
+
+    if (m_pending.length() >= COMPRESSED_HISTORY_BLOCK_BYTES)
+    {
+        CompressPending();
+    }
+}
+
+void CompressedHistory::CompressPending()
+{
+    Block block;
+    block.uncompressedLength = m_pending.length();
+    block.recordCount = m_pendingCount;
+
+    bool compressed = false;
+    try
+    {
+        CryptoPP::Deflator deflator(new CryptoPP::StringSink(block.data));
+        deflator.Put((const byte*)m_pending.data(), m_pending.length());
+        deflator.MessageEnd();
+        compressed = true;
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    if (!compressed)
+    {
+        // Out of memory; these are lost rather than kept uncompressed.
+        m_droppedCount += m_pendingCount;
+        m_recordCount -= m_pendingCount;
+    }
+    else
+    {
+        block.data.shrink_to_fit();
+        m_compressedBytes += block.data.length();
+        m_blocks.push_back(std::move(block));
+    }
+
+    // Not just cleared: the buffer would otherwise be held at its peak size.
+    string().swap(m_pending);
+    m_pendingCount = 0;
+
+    while (m_compressedBytes > m_maxCompressedBytes && !m_blocks.empty())
+    {
+        m_compressedBytes -= m_blocks.front().data.length();
+        m_droppedCount += m_blocks.front().recordCount;
+        m_recordCount -= m_blocks.front().recordCount;
+        m_blocks.pop_front();
+    }
+}
+
+// static
+void CompressedHistory::UnpackRecords(const string& packed, vector<string>& io_records)
+{
+    size_t offset = 0;
+    while (offset + sizeof(unsigned int) <= packed.length())
+    {
+        unsigned int length = 0;
+        memcpy(&length, packed.data() + offset, sizeof(length));
+        offset += sizeof(length);
+        if (length > packed.length() - offset)
+        {
+            break;
+        }
+        io_records.push_back(packed.substr(offset, length));
+        offset += length;
+    }
+}
+
+void CompressedHistory::GetRecords(vector<string>& io_records) const
+{
+    io_records.reserve(io_records.size() + m_recordCount);
+
+    for (auto block = m_blocks.cbegin(); block != m_blocks.cend(); ++block)
+    {
+        string packed;
+        packed.reserve(block->uncompressedLength);
+        try
+        {
+            CryptoPP::Inflator inflator(new CryptoPP::StringSink(packed));
+            inflator.Put((const byte*)block->data.data(), block->data.length());
+            inflator.MessageEnd();
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+        UnpackRecords(packed, io_records);
+    }
+
+    UnpackRecords(m_pending, io_records);
+}
+
+size_t CompressedHistory::MemoryUsage() const
+{
+    return m_compressedBytes
+           + m_blocks.size() * sizeof(Block)
+           + m_pending.capacity();
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+
+/*
+The cold tier of a history: records too old to be worth keeping as they are,
+but still wanted for feedback. They're packed together and deflated in blocks
+(with Crypto++, as the bundled zlib is inflate-only), and only inflated again
+when they're read. Once the blocks take up more than maxCompressedBytes, the
+oldest are dropped.
+Records are opaque bytes, read back oldest first.
+Not threadsafe; the owning history's lock covers it.
+*/
+class CompressedHistory
+{
+public:
+    CompressedHistory(size_t maxCompressedBytes);
+
+    void Append(const string& record);
+
+    // Appends the records held, oldest first, to io_records.
+    void GetRecords(vector<string>& io_records) const;
+
+    // Approximate bytes held, for memory accounting.
+    size_t MemoryUsage() const;
+
+    size_t RecordCount() const { return m_recordCount; }
+    // Records lost with dropped blocks, or that couldn't be compressed
+    unsigned long long DroppedCount() const { return m_droppedCount; }
+
+private:
+    void CompressPending();
+    static void UnpackRecords(const string& packed, vector<string>& io_records);
+
+    struct Block
+    {
+        string data;
+        size_t uncompressedLength;
+        size_t recordCount;
+    };
+
+    size_t m_maxCompressedBytes;
+    std::deque<Block> m_blocks;
+    size_t m_compressedBytes;
+    // Records not yet compressed, each a 4-byte length then the bytes
+    string m_pending;
+    size_t m_pendingCount;
+    size_t m_recordCount;
+    unsigned long long m_droppedCount;
+};
@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "concurrency_stress.h"
+#include "dispatch_queue.h"
+#include "worker_thread.h"
+#include "logging.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+// WaitForMultipleObjects takes at most 64 handles
+#define STRESS_MAX_THREADS                  32
+#define STRESS_DISPATCH_OPERATIONS          200000
+// Ops of different types may run at once
+#define STRESS_DISPATCH_OP_TYPES            64
+#define STRESS_WAKEUP_SAMPLES               500
+// Long enough for the pool's threads to go back to waiting
+#define STRESS_WAKEUP_IDLE_MS               2
+#define STRESS_SKIP_CHECKS                  100000
+#define STRESS_STOP_SAMPLES                 500
+#define STRESS_STOP_CHECKS                  1000000
+#define STRESS_WORKER_STOP_CYCLES           20
+#define STRESS_LOCK_ACQUISITIONS            2000000
+// Kernel mutexes cost a system call each, so fewer are timed
+#define STRESS_MUTEX_ACQUISITIONS           200000
+
+
+/***********************************************************************
+ Result
+ */
+
+Json::Value ConcurrencyStress::Result::ToJson() const
+{
+    Json::Value json;
+    json["name"] = name;
+    json["threads"] = (Json::UInt64)threads;
+    if (depth > 0)
+    {
+        json["depth"] = (Json::UInt64)depth;
+    }
+    json["operations"] = (Json::UInt64)operations;
+    json["totalMicroseconds"] = (Json::UInt64)totalMicroseconds;
+    if (operations > 0)
+    {
+        json["nanosecondsPerOperation"] = (double)totalMicroseconds * 1000 / operations;
+    }
+    if (totalMicroseconds > 0)
+    {
+        json["operationsPerSecond"] = (double)operations * 1000000 / totalMicroseconds;
+    }
+    if (maxMicroseconds > 0)
+    {
+        json["p50Microseconds"] = (Json::UInt64)p50Microseconds;
+        json["p99Microseconds"] = (Json::UInt64)p99Microseconds;
+        json["maxMicroseconds"] = (Json::UInt64)maxMicroseconds;
+    }
+    return json;
+}
+
+
+/***********************************************************************
+ Helpers
+ */
+
+static const vector<int> NO_SKIP;
+
+static ConcurrencyStress::Result MakeResult(const char* name, size_t threads, size_t depth = 0)
+{
+    ConcurrencyStress::Result result;
+    result.name = name;
+    result.threads = threads;
+    result.depth = depth;
+    return result;
+}
+
+static void SetLatencies(ConcurrencyStress::Result& result, vector<unsigned long long>& latencies)
+{
+    if (latencies.empty())
+    {
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    result.p50Microseconds = latencies[(latencies.size() - 1) * 50 / 100];
+    result.p99Microseconds = latencies[(latencies.size() - 1) * 99 / 100];
+    result.maxMicroseconds = latencies.back();
+}
+
+// 1, 2 and one per processor
+static vector<size_t> ThreadCounts()
+{
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    size_t processors = min((size_t)systemInfo.dwNumberOfProcessors, (size_t)STRESS_MAX_THREADS);
+
+    vector<size_t> counts = { 1, 2 };
+    if (processors > 2)
+    {
+        counts.push_back(processors);
+    }
+    return counts;
+}
+
+struct StressThreadContext
+{
+    const std::function<void(size_t)>* body;
+    size_t index;
+    HANDLE go;
+};
+
+static DWORD WINAPI StressThread(void* object)
+{
+    StressThreadContext* context = (StressThreadContext*)object;
+    WaitForSingleObject(context->go, INFINITE);
+    (*context->body)(context->index);
+    return 0;
+}
+
+// Runs body(index) on `count` new threads, released together, and waits for
+// them all to finish. Returns when they were released (MonotonicMicroseconds).
+static unsigned long long RunOnThreads(size_t count, const std::function<void(size_t)>& body)
+{
+    HANDLE go = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!go)
+    {
+        throw std::exception("RunOnThreads: CreateEvent failed");
+    }
+    auto closeGo = finally([go] { CloseHandle(go); });
+
+    vector<StressThreadContext> contexts(count);
+    vector<HANDLE> threads;
+    for (size_t i = 0; i < count; i++)
+    {
+        contexts[i].body = &body;
+        contexts[i].index = i;
+        contexts[i].go = go;
+
+        HANDLE thread = CreateThread(0, 0, StressThread, &contexts[i], 0, 0);
+        if (!thread)
+        {
+            break;
+        }
+        threads.push_back(thread);
+    }
+
+    unsigned long long start = MonotonicMicroseconds();
+    SetEvent(go);
+
+    if (!threads.empty())
+    {
+        WaitForMultipleObjects((DWORD)threads.size(), &threads[0], TRUE, INFINITE);
+    }
+    for (auto thread : threads)
+    {
+        CloseHandle(thread);
+    }
+
+    if (threads.size() < count)
+    {
+        throw std::exception("RunOnThreads: CreateThread failed");
+    }
+
+    return start;
+}
+
+// Does nothing but wait to be stopped
+class IdleWorker : public IWorkerThread
+{
+public:
+    virtual ~IdleWorker() { IWorkerThread::Stop(); }
+
+protected:
+    virtual bool DoStart() { return true; }
+    virtual bool DoPeriodicCheck() { return true; }
+    // Only a stop should wake it
+    virtual DWORD GetPeriodicCheckInterval() const { return INFINITE; }
+    virtual void StopImminent() {}
+    virtual void DoStop(bool) {}
+};
+
+
+/***********************************************************************
+ Runs
+ */
+
+// Producers on `threads` threads queue small ops of a few types, for a queue
+// that runs `threads` at a time; timed until the last op has run.
+static ConcurrencyStress::Result DispatchThroughput(size_t threads)
+{
+    ConcurrencyStress::Result result = MakeResult("dispatch_queue throughput", threads);
+
+    dispatch_queue queue("ConcurrencyStress", threads);
+    HANDLE allRun = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!allRun)
+    {
+        throw std::exception("DispatchThroughput: CreateEvent failed");
+    }
+    auto closeAllRun = finally([allRun] { CloseHandle(allRun); });
+
+    const LONG total = STRESS_DISPATCH_OPERATIONS;
+    volatile LONG run = 0;
+
+    unsigned long long start = RunOnThreads(threads, [&](size_t index)
+    {
+        for (LONG i = (LONG)index; i < total; i += (LONG)threads)
+        {
+            (void)queue.dispatch(i % STRESS_DISPATCH_OP_TYPES, NO_SKIP, [&]
+            {
+                if (InterlockedIncrement(&run) == total)
+                {
+                    SetEvent(allRun);
+                }
+            });
+        }
+    });
+    WaitForSingleObject(allRun, INFINITE);
+
+    result.operations = total;
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    return result;
+}
+
+// From dispatching an op to an idle queue to the op starting
+static ConcurrencyStress::Result DispatchWakeupLatency()
+{
+    ConcurrencyStress::Result result = MakeResult("dispatch_queue wakeup", 1);
+
+    dispatch_queue queue("ConcurrencyStress", 1);
+    HANDLE ran = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (!ran)
+    {
+        throw std::exception("DispatchWakeupLatency: CreateEvent failed");
+    }
+    auto closeRan = finally([ran] { CloseHandle(ran); });
+
+    vector<unsigned long long> latencies;
+    latencies.reserve(STRESS_WAKEUP_SAMPLES);
+    unsigned long long ranAt = 0;
+
+    for (int i = 0; i < STRESS_WAKEUP_SAMPLES; i++)
+    {
+        Sleep(STRESS_WAKEUP_IDLE_MS);
+
+        unsigned long long dispatchedAt = MonotonicMicroseconds();
+        (void)queue.dispatch(0, NO_SKIP, [&]
+        {
+            ranAt = MonotonicMicroseconds();
+            SetEvent(ran);
+        });
+        WaitForSingleObject(ran, INFINITE);
+
+        latencies.push_back(ranAt - dispatchedAt);
+        result.totalMicroseconds += ranAt - dispatchedAt;
+    }
+
+    result.operations = latencies.size();
+    SetLatencies(result, latencies);
+    return result;
+}
+
+// Dispatches that are skipped, as an op they name is queued, while `depth`
+// ops wait behind a blocked one.
+static ConcurrencyStress::Result DispatchSkipIfQueued(size_t depth)
+{
+    enum { OP_BLOCKER, OP_FILLER, OP_CHECKED };
+
+    ConcurrencyStress::Result result = MakeResult("dispatch_queue skip-if-queued", 1, depth);
+
+    HANDLE blocked = CreateEvent(NULL, TRUE, FALSE, NULL);
+    HANDLE release = CreateEvent(NULL, TRUE, FALSE, NULL);
+    HANDLE drained = CreateEvent(NULL, TRUE, FALSE, NULL);
+    auto closeEvents = finally([=]
+    {
+        CloseHandle(blocked);
+        CloseHandle(release);
+        CloseHandle(drained);
+    });
+    if (!blocked || !release || !drained)
+    {
+        throw std::exception("DispatchSkipIfQueued: CreateEvent failed");
+    }
+
+    // Destroyed first, once the ops it's running have finished
+    dispatch_queue queue("ConcurrencyStress", 1);
+
+    (void)queue.dispatch(OP_BLOCKER, NO_SKIP, [=]
+    {
+        SetEvent(blocked);
+        WaitForSingleObject(release, INFINITE);
+    });
+    WaitForSingleObject(blocked, INFINITE);
+
+    volatile LONG filled = 0;
+    for (size_t i = 0; i < depth; i++)
+    {
+        (void)queue.dispatch(OP_FILLER, NO_SKIP, [&]
+        {
+            if (InterlockedIncrement(&filled) == (LONG)depth)
+            {
+                SetEvent(drained);
+            }
+        });
+    }
+
+    const vector<int> skip = { OP_FILLER };
+    unsigned long long start = MonotonicMicroseconds();
+    for (int i = 0; i < STRESS_SKIP_CHECKS; i++)
+    {
+        (void)queue.dispatch(OP_CHECKED, skip, [] {});
+    }
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.operations = STRESS_SKIP_CHECKS;
+
+    SetEvent(release);
+    if (depth > 0)
+    {
+        WaitForSingleObject(drained, INFINITE);
+    }
+
+    return result;
+}
+
+// From signalling the root of `depth` nested stop signals to a thread
+// waiting on the innermost one's stop event waking.
+static ConcurrencyStress::Result StopPropagation(size_t depth)
+{
+    ConcurrencyStress::Result result = MakeResult("StopSignal propagation", 2, depth);
+
+    StopSignal root;
+    vector<unique_ptr<RaceStopSignal>> nested;
+    StopSignal* innermost = &root;
+    for (size_t i = 0; i < depth; i++)
+    {
+        nested.push_back(unique_ptr<RaceStopSignal>(new RaceStopSignal(innermost)));
+        innermost = nested.back().get();
+    }
+    // Innermost first
+    auto destroyNested = finally([&nested]
+    {
+        while (!nested.empty())
+        {
+            nested.pop_back();
+        }
+    });
+
+    HANDLE stopEvent = innermost->GetStopEvent(STOP_REASON_USER_DISCONNECT);
+    HANDLE armed = CreateEvent(NULL, FALSE, TRUE, NULL);
+    HANDLE woke = CreateEvent(NULL, FALSE, FALSE, NULL);
+    auto closeEvents = finally([=]
+    {
+        CloseHandle(armed);
+        CloseHandle(woke);
+    });
+    if (!stopEvent || !armed || !woke)
+    {
+        throw std::exception("StopPropagation: CreateEvent failed");
+    }
+
+    vector<unsigned long long> signalledAt(STRESS_STOP_SAMPLES);
+    vector<unsigned long long> wokeAt(STRESS_STOP_SAMPLES);
+
+    // Thread 0 signals; thread 1 waits.
+    (void)RunOnThreads(2, [&](size_t index)
+    {
+        for (int i = 0; i < STRESS_STOP_SAMPLES; i++)
+        {
+            if (index == 1)
+            {
+                WaitForSingleObject(armed, INFINITE);
+                WaitForSingleObject(stopEvent, INFINITE);
+                wokeAt[i] = MonotonicMicroseconds();
+                SetEvent(woke);
+                continue;
+            }
+
+            // Gives the waiter time to block
+            Sleep(1);
+            signalledAt[i] = MonotonicMicroseconds();
+            root.SignalStop(STOP_REASON_USER_DISCONNECT);
+            WaitForSingleObject(woke, INFINITE);
+            root.ClearStopSignal(STOP_REASON_USER_DISCONNECT);
+            SetEvent(armed);
+        }
+    });
+
+    vector<unsigned long long> latencies;
+    for (int i = 0; i < STRESS_STOP_SAMPLES; i++)
+    {
+        latencies.push_back(wokeAt[i] - signalledAt[i]);
+        result.totalMicroseconds += wokeAt[i] - signalledAt[i];
+    }
+    result.operations = latencies.size();
+    SetLatencies(result, latencies);
+    return result;
+}
+
+// Polling the innermost of `depth` nested stop signals, as loops do
+static ConcurrencyStress::Result StopCheck(size_t depth)
+{
+    ConcurrencyStress::Result result = MakeResult("StopSignal::CheckSignal", 1, depth);
+
+    StopSignal root;
+    vector<unique_ptr<RaceStopSignal>> nested;
+    StopSignal* innermost = &root;
+    for (size_t i = 0; i < depth; i++)
+    {
+        nested.push_back(unique_ptr<RaceStopSignal>(new RaceStopSignal(innermost)));
+        innermost = nested.back().get();
+    }
+    auto destroyNested = finally([&nested]
+    {
+        while (!nested.empty())
+        {
+            nested.pop_back();
+        }
+    });
+
+    DWORD matched = 0;
+    unsigned long long start = MonotonicMicroseconds();
+    for (int i = 0; i < STRESS_STOP_CHECKS; i++)
+    {
+        matched |= innermost->CheckSignal(STOP_REASON_ALL);
+    }
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.operations = STRESS_STOP_CHECKS;
+
+    // Never set; used so the loop isn't optimized away
+    if (matched)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: unexpected stop signal"), __TFUNCTION__);
+    }
+
+    return result;
+}
+
+// From signalling a stop to `threads` idle workers, synched with each other,
+// to all of them having stopped.
+static ConcurrencyStress::Result WorkerStop(size_t threads)
+{
+    ConcurrencyStress::Result result = MakeResult("IWorkerThread synched stop", threads);
+
+    StopSignal stopSignal;
+    WorkerThreadSynch synch;
+    vector<unique_ptr<IdleWorker>> workers;
+    vector<HANDLE> stoppedEvents;
+    for (size_t i = 0; i < threads; i++)
+    {
+        workers.push_back(unique_ptr<IdleWorker>(new IdleWorker()));
+        stoppedEvents.push_back(workers.back()->GetStoppedEvent());
+    }
+
+    vector<unsigned long long> latencies;
+    for (int cycle = 0; cycle < STRESS_WORKER_STOP_CYCLES; cycle++)
+    {
+        synch.Reset();
+        for (auto& worker : workers)
+        {
+            bool started = false;
+            try
+            {
+                started = worker->Start(StopInfo(&stopSignal, STOP_REASON_CANCEL), &synch);
+            }
+            catch (IWorkerThread::Error&)
+            {
+            }
+            if (!started)
+            {
+                // The workers that did start are stopped as they're destroyed.
+                throw std::exception("WorkerStop: IWorkerThread::Start failed");
+            }
+        }
+
+        unsigned long long start = MonotonicMicroseconds();
+        stopSignal.SignalStop(STOP_REASON_CANCEL);
+        WaitForMultipleObjects((DWORD)stoppedEvents.size(), &stoppedEvents[0], TRUE, INFINITE);
+        unsigned long long latency = MonotonicMicroseconds() - start;
+
+        for (auto& worker : workers)
+        {
+            worker->Stop();
+        }
+        stopSignal.ClearStopSignal(STOP_REASON_CANCEL);
+
+        latencies.push_back(latency);
+        result.totalMicroseconds += latency;
+    }
+
+    result.operations = latencies.size();
+    SetLatencies(result, latencies);
+    return result;
+}
+
+// Each of `threads` threads takes the lock in turn, for a trivial update
+static ConcurrencyStress::Result LockContention(size_t threads)
+{
+    ConcurrencyStress::Result result = MakeResult("Lock", threads);
+
+    // Unnamed, so no stats are kept
+    Lock lock;
+    unsigned long long counter = 0;
+    const size_t perThread = STRESS_LOCK_ACQUISITIONS / threads;
+
+    unsigned long long start = RunOnThreads(threads, [&](size_t)
+    {
+        for (size_t i = 0; i < perThread; i++)
+        {
+            AutoLock autoLock(lock);
+            counter++;
+        }
+    });
+
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.operations = counter;
+    return result;
+}
+
+// As LockContention, for readers of a SharedLock
+static ConcurrencyStress::Result SharedLockContention(size_t threads)
+{
+    ConcurrencyStress::Result result = MakeResult("SharedLock (shared)", threads);
+
+    SharedLock lock;
+    volatile LONG value = 0;
+    volatile LONG reads = 0;
+    const size_t perThread = STRESS_LOCK_ACQUISITIONS / threads;
+
+    unsigned long long start = RunOnThreads(threads, [&](size_t)
+    {
+        LONG read = 0;
+        for (size_t i = 0; i < perThread; i++)
+        {
+            AutoSharedLock autoLock(lock);
+            read += value + 1;
+        }
+        InterlockedExchangeAdd(&reads, read);
+    });
+
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.operations = (unsigned long long)perThread * threads;
+    return result;
+}
+
+// As LockContention, for a kernel mutex
+static ConcurrencyStress::Result MutexContention(size_t threads)
+{
+    ConcurrencyStress::Result result = MakeResult("AutoMUTEX", threads);
+
+    HANDLE mutex = CreateMutex(NULL, FALSE, NULL);
+    if (!mutex)
+    {
+        throw std::exception("MutexContention: CreateMutex failed");
+    }
+    auto closeMutex = finally([mutex] { CloseHandle(mutex); });
+
+    unsigned long long counter = 0;
+    const size_t perThread = STRESS_MUTEX_ACQUISITIONS / threads;
+
+    unsigned long long start = RunOnThreads(threads, [&](size_t)
+    {
+        for (size_t i = 0; i < perThread; i++)
+        {
+            AutoMUTEX autoMutex(mutex);
+            counter++;
+        }
+    });
+
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.operations = counter;
+    return result;
+}
+
+
+/***********************************************************************
+ ConcurrencyStress
+ */
+
+// static
+void ConcurrencyStress::Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult)
+{
+    const vector<size_t> threadCounts = ThreadCounts();
+    const size_t QUEUE_DEPTHS[] = { 100, 10000, 100000 };
+    const size_t NESTING_DEPTHS[] = { 1, 4, 16 };
+
+    auto report = [&](const Result& result)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: %S (%d threads): %llu in %llu us"), __TFUNCTION__, result.name.c_str(), (int)result.threads, result.operations, result.totalMicroseconds);
+        onResult(result);
+        stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+    };
+
+    for (size_t threads : threadCounts)
+    {
+        report(DispatchThroughput(threads));
+    }
+    report(DispatchWakeupLatency());
+    for (size_t depth : QUEUE_DEPTHS)
+    {
+        report(DispatchSkipIfQueued(depth));
+    }
+
+    for (size_t depth : NESTING_DEPTHS)
+    {
+        report(StopPropagation(depth));
+        report(StopCheck(depth));
+    }
+    for (size_t threads : threadCounts)
+    {
+        report(WorkerStop(threads));
+    }
+
+    for (size_t threads : threadCounts)
+    {
+        report(LockContention(threads));
+        report(SharedLockContention(threads));
+        report(MutexContention(threads));
+    }
+}
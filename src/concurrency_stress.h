@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Stress runs of the concurrency primitives, for `--headless --stress` (see
+headless.h), so that replacements for them can be compared against what's
+there: dispatch_queue throughput, wakeup latency and skip-if-queued checks
+behind deep queues; stop propagation through nested stop signals and to
+synched worker threads; and the cost of Lock, SharedLock and AutoMUTEX
+under contention.
+
+The contended runs are repeated with 1 thread, 2 threads and one per
+processor (at most 32), so results from 2-core and
+many-core machines line up. Nothing is connected; the primitives are
+exercised on their own.
+*/
+class ConcurrencyStress
+{
+public:
+    struct Result
+    {
+        string name;
+        size_t threads;
+        // The queue depth, or how deeply the signals are nested, for the
+        // runs that vary it; 0 otherwise
+        size_t depth;
+        // Operations timed, in total across the threads
+        unsigned long long operations;
+        unsigned long long totalMicroseconds;
+        // Per-operation latencies, for the runs that sample them; 0 otherwise
+        unsigned long long p50Microseconds;
+        unsigned long long p99Microseconds;
+        unsigned long long maxMicroseconds;
+
+        Result()
+            : threads(0), depth(0), operations(0), totalMicroseconds(0),
+              p50Microseconds(0), p99Microseconds(0), maxMicroseconds(0) {}
+
+        Json::Value ToJson() const;
+    };
+
+    // Runs each in turn, calling onResult with each result as it's done.
+    // Throws the stop signal, and std::exception if threads can't be made.
+    static void Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult);
+};
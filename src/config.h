@@ -26,12 +26,27 @@ static const TCHAR* LOCAL_SETTINGS_APPDATA_SUBDIRECTORY = _T("Psiphon3");
 static const TCHAR* LOCAL_SETTINGS_APPDATA_CONFIG_FILENAME = _T("psiphon.config");
 static const TCHAR* LOCAL_SETTINGS_APPDATA_URL_PROXY_CONFIG_FILENAME = _T("url_proxy.config");
 static const TCHAR* LOCAL_SETTINGS_APPDATA_SERVER_LIST_FILENAME = _T("server_list.dat");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_SERVER_LIST_STORE_FILENAME_PREFIX = _T("server_entries_");
 static const TCHAR* LOCAL_SETTINGS_APPDATA_REMOTE_SERVER_LIST_FILENAME = _T("remote_server_list");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_RING_LOG_FILENAME = _T("session.log");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_CRASHED_RING_LOG_FILENAME = _T("session.crashed.log");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_UPGRADE_DOWNLOAD_FILENAME = _T("upgrade.partial");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_UPGRADE_DELTA_DOWNLOAD_FILENAME = _T("upgrade_delta.partial");
+static const TCHAR* LOCAL_SETTINGS_APPDATA_PROXY_AUTO_CONFIG_FILENAME = _T("proxy.pac");
 static const TCHAR* LOCAL_SETTINGS_REGISTRY_KEY = _T("Software\\Psiphon3");
 static const char* LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS = "Servers";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_SERVER_STATS = "ServerStats";
 static const char* LOCAL_SETTINGS_REGISTRY_VALUE_LAST_CONNECTED = "LastConnected";
 static const char* LOCAL_SETTINGS_REGISTRY_VALUE_NATIVE_PROXY_INFO = "NativeProxyInfo";
 static const char* LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO = "PsiphonProxyInfo";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_ETAG = "RemoteServerListETag";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_LAST_MODIFIED = "RemoteServerListLastModified";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_HASH = "RemoteServerListHash";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_CHILD_PROCESSES = "ChildProcesses";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_LAST_GOOD_CONNECTION = "LastGoodConnection";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_VPN_ENTRY_VERSION = "VPNEntryVersion";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_PAVED_UPGRADE = "PavedUpgrade";
+static const char* LOCAL_SETTINGS_REGISTRY_VALUE_TRANSPORT_BENCHMARK = "TransportBenchmark";
 static const char* CLIENT_PLATFORM = "Windows";
 static const TCHAR* HTTP_HANDSHAKE_REQUEST_PATH = _T("/handshake");
 static const TCHAR* HTTP_CONNECTED_REQUEST_PATH = _T("/connected");
@@ -48,3 +63,11 @@ static const int HTTPS_REQUEST_RECEIVE_TIMEOUT_MS = 30000;
 static const int TERMINATE_PROCESS_WAIT_MS = 5000;
 static const char* UNTUNNELED_WEB_REQUEST_CAPABILITY = "handshake";
 static const int TEMPORARY_TUNNEL_TIMEOUT_SECONDS = 20;
+// Number of my_print messages retained for feedback. Must be a power of two.
+static const unsigned int MESSAGE_HISTORY_CAPACITY = 1024;
+// Number of diagnostic entries retained for feedback, per message category.
+static const size_t DIAGNOSTIC_HISTORY_MAX_ENTRIES_PER_CATEGORY = 1000;
+// Older messages and diagnostic entries are kept compressed, up to these many
+// compressed bytes (about ten times as much uncompressed).
+static const size_t MESSAGE_HISTORY_COLD_MAX_BYTES = 1024*1024;
+static const size_t DIAGNOSTIC_HISTORY_COLD_MAX_BYTES_PER_CATEGORY = 256*1024;
@@ -30,41 +30,306 @@
 #include "usersettings.h"
 #include "zlib.h"
 #include <algorithm>
+#include <exception>
 #include <sstream>
 #include <Shlwapi.h>
 #include "transport.h"
 #include "transport_registry.h"
 #include "transport_connection.h"
+#include "coretransport.h"
+#include "temp_tunnel_pool.h"
+#include "thread_pool.h"
 #include "authenticated_data_package.h"
 #include "stopsignal.h"
 #include "diagnostic_info.h"
 #include "psicashlib.h"
+#include "startup_tasks.h"
+#include "tunnel_metrics.h"
+#include "tunnel_quality.h"
+#include "codec_kernels.h"
+#include "upgrade_delta.h"
+#include "tracing.h"
+#include "background_transfer.h"
+#include "server_list_reordering.h"
+#include "vpntransport.h"
+#include "performance_budget.h"
+#pragma warning(push, 0)
+#pragma warning(disable: 4244)
+#include "gzip.h"
+#pragma warning(pop)
 
 
 // Upgrade process posts a Quit message
 extern HWND g_hWnd;
 
+// Switching servers for tunnel quality isn't done more often than this, so a
+// network that's bad everywhere doesn't have us hopping between servers.
+#define QUALITY_SWITCH_MIN_INTERVAL_MS  (10*60*1000)
+
+// A last good connection older than this isn't given priority
+#define LAST_GOOD_CONNECTION_MAX_AGE_SECONDS    (7*24*60*60)
+
+// After a sleep shorter than this, the tunnel is likely still good, so it's
+// only re-validated; after a longer one, it's restarted.
+#define RESUME_REVALIDATE_ONLY_MS       (60*1000)
+
+// Why the connection thread was told to restart the tunnel; see
+// ConnectionManager::m_restartTunnel
+#define RESTART_TUNNEL_RESUME           1
+#define RESTART_TUNNEL_CONFIG           2
+
+// Once connected, the remote server list is fetched right away -- through
+// the tunnel -- if fewer than this fraction, or this number, of the
+// transport's servers are still worth trying. Not more often than the
+// interval, though, as a fresh list may not help.
+#define PREEMPTIVE_FETCH_MIN_VIABLE_FRACTION    0.5
+#define PREEMPTIVE_FETCH_MIN_VIABLE_SERVERS     3
+#define PREEMPTIVE_FETCH_MIN_INTERVAL_SECONDS   (30*60)
+
+// Base64 characters decoded and written at a time when paving an upgrade
+#define UPGRADE_PAVE_CHUNK_SIZE         (256*1024)
+
+// Home page hosts that are preconnected to through the local proxy, as the
+// browser is launched; the home pages are rotated through, so not just the
+// first.
+#define HOME_PAGE_WARM_UP_MAX_HOSTS     2
+#define HOME_PAGE_WARM_UP_TIMEOUT_MS    15000
+
+
+/******************************************************************************
+ TransportConnectRace
+******************************************************************************/
+
+/*
+Connects with the first of two transports and, if it hasn't connected after
+a stagger, with the second one as well. The first to connect wins, and the
+other attempt is cancelled and torn down. If the first attempt fails before
+the stagger is up, the second is started right away.
+Both attempts are made without applying the system proxy settings; only the
+winner's are applied.
+*/
+class TransportConnectRace
+{
+public:
+    TransportConnectRace(
+        ConnectionManager* manager,
+        ITransport* firstTransport,
+        ITransport* secondTransport,
+        DWORD staggerMilliseconds);
+    virtual ~TransportConnectRace();
+
+    // Blocks until one of the transports connects, and returns its connection.
+    // If neither connects, rethrows whatever the first transport's attempt
+    // threw -- the same as if there had been no race. May also throw
+    // IWorkerThread::Error.
+    TransportConnection& Run();
+
+    // Only valid after Run returns.
+    ITransport* GetWinningTransport() const;
+
+private:
+    struct Attempt
+    {
+        Attempt(ConnectionManager* manager, ITransport* transport);
+        ~Attempt();
+
+        ConnectionManager* manager;
+        ITransport* transport;
+        RaceStopSignal stopSignal;
+        // Uses stopSignal, so is declared after it to be destroyed before it
+        TransportConnection connection;
+        HANDLE thread;
+        bool connected;
+        exception_ptr error;
+    };
+
+    static DWORD WINAPI AttemptThread(void* object);
+    static void StartAttempt(Attempt& attempt);
+
+private:
+    unique_ptr<Attempt> m_attempts[2];
+    DWORD m_staggerMilliseconds;
+    int m_winner;
+};
+
+TransportConnectRace::Attempt::Attempt(ConnectionManager* manager, ITransport* transport)
+    : manager(manager),
+      transport(transport),
+      stopSignal(&GlobalStopSignal::Instance()),
+      thread(0),
+      connected(false)
+{
+}
+
+TransportConnectRace::Attempt::~Attempt()
+{
+    if (thread)
+    {
+        stopSignal.SignalStop(STOP_REASON_CANCEL);
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+        thread = 0;
+    }
+}
+
+TransportConnectRace::TransportConnectRace(
+                        ConnectionManager* manager,
+                        ITransport* firstTransport,
+                        ITransport* secondTransport,
+                        DWORD staggerMilliseconds)
+    : m_staggerMilliseconds(staggerMilliseconds),
+      m_winner(-1)
+{
+    m_attempts[0].reset(new Attempt(manager, firstTransport));
+    m_attempts[1].reset(new Attempt(manager, secondTransport));
+}
+
+TransportConnectRace::~TransportConnectRace()
+{
+}
+
+// static
+DWORD WINAPI TransportConnectRace::AttemptThread(void* object)
+{
+    Attempt* attempt = (Attempt*)object;
+
+    try
+    {
+        attempt->connection.Connect(
+            StopInfo(&attempt->stopSignal, STOP_REASON_ALL),
+            attempt->transport,
+            attempt->manager,   // ILocalProxyStatsCollector
+            attempt->manager,   // IUpgradePaver
+            attempt->manager,   // IReconnectStateReceiver
+            attempt->manager,   // IAuthorizationsProvider
+            NULL,
+            true);              // skipApplySystemProxySettings; see Run
+        attempt->connected = true;
+    }
+    catch (...)
+    {
+        attempt->error = current_exception();
+    }
+
+    return 0;
+}
+
+// static
+void TransportConnectRace::StartAttempt(Attempt& attempt)
+{
+    my_print(NOT_SENSITIVE, true, _T("%s: starting %s"), __TFUNCTION__, attempt.transport->GetTransportDisplayName().c_str());
+
+    attempt.thread = ThreadPool::Instance().Run(AttemptThread, &attempt);
+    if (!attempt.thread)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: ThreadPool::Run failed (%d)"), __TFUNCTION__, GetLastError());
+        throw IWorkerThread::Error("TransportConnectRace: ThreadPool::Run failed");
+    }
+}
+
+TransportConnection& TransportConnectRace::Run()
+{
+    assert(m_winner < 0);
+
+    StartAttempt(*m_attempts[0]);
+
+    // Give the first transport a head start. We won't wait out the rest of
+    // the stagger if it fails sooner.
+    (void)WaitForSingleObject(m_attempts[0]->thread, m_staggerMilliseconds);
+
+    if (!m_attempts[0]->connected
+        && !GlobalStopSignal::Instance().CheckSignal(STOP_REASON_ALL)
+        && m_attempts[1]->transport->ServerWithCapabilitiesExists())
+    {
+        StartAttempt(*m_attempts[1]);
+    }
+
+    // Wait until an attempt connects or they've all finished.
+    while (m_winner < 0)
+    {
+        vector<HANDLE> pending;
+        for (int i = 0; i < 2 && m_winner < 0; i++)
+        {
+            Attempt& attempt = *m_attempts[i];
+            if (!attempt.thread)
+            {
+                continue;
+            }
+            else if (WAIT_OBJECT_0 != WaitForSingleObject(attempt.thread, 0))
+            {
+                pending.push_back(attempt.thread);
+            }
+            else if (attempt.connected)
+            {
+                m_winner = i;
+            }
+        }
+
+        if (m_winner >= 0 || pending.empty())
+        {
+            break;
+        }
+
+        if (WAIT_FAILED == WaitForMultipleObjects(pending.size(), &pending[0], FALSE, INFINITE))
+        {
+            throw IWorkerThread::Error("TransportConnectRace: WaitForMultipleObjects failed");
+        }
+    }
+
+    if (m_winner < 0)
+    {
+        rethrow_exception(m_attempts[0]->error);
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %s won"), __TFUNCTION__, m_attempts[m_winner]->transport->GetTransportDisplayName().c_str());
+
+    // Cancel and tear down the loser -- whether or not it also managed to
+    // connect -- before touching the system proxy settings.
+    m_attempts[1 - m_winner].reset();
+
+    m_attempts[m_winner]->connection.HoldSystemProxySettingsOnCleanup();
+    m_attempts[m_winner]->connection.ApplySystemProxySettings();
+
+    return m_attempts[m_winner]->connection;
+}
+
+ITransport* TransportConnectRace::GetWinningTransport() const
+{
+    assert(m_winner >= 0);
+    return m_attempts[m_winner]->transport;
+}
+
 
 ConnectionManager::ConnectionManager(void) :
+    m_lock("ConnectionManager"),
     m_state(CONNECTION_MANAGER_STATE_STOPPED),
+    m_deliveredState(CONNECTION_MANAGER_STATE_STOPPED),
+    m_stateChangePosted(0),
+    m_currentSessionInfo(make_shared<SessionInfo>()),
     m_thread(0),
     m_upgradeThread(0),
     m_feedbackThread(0),
     m_transport(0),
+    m_raceTransport(0),
     m_upgradePending(false),
     m_startSplitTunnel(false),
     m_nextFetchRemoteServerListAttempt(0),
-    m_suppressHomePages(false)
+    m_lastFetchRemoteServerListAttempt(0),
+    m_fetchingRemoteServerList(false),
+    m_suppressHomePages(false),
+    m_homePagesDisabled(false),
+    m_keepCoreResident(false),
+    m_suspended(0),
+    m_suspendTime(0),
+    m_restartTunnel(0),
+    m_reconnectStartTime(0)
 {
-    m_mutex = CreateMutex(NULL, FALSE, 0);
-
     Settings::Initialize();
 }
 
 ConnectionManager::~ConnectionManager(void)
 {
     Stop(STOP_REASON_NONE);
-    CloseHandle(m_mutex);
 }
 
 void ConnectionManager::SetState(ConnectionManagerState newState)
@@ -72,18 +337,33 @@ void ConnectionManager::SetState(ConnectionManagerState newState)
     // NOTE: no lock, to prevent blocking connection thread with UI polling
     // Starting Time is informational only, consistency with state isn't critical
 
+    static const TCHAR* const STATE_NAMES[] = {
+        _T("Stopped"), _T("Starting"), _T("Connected"), _T("Stopping")
+    };
+    TRACE_EVENT(TRACE_KEYWORD_CONNECTION, _T("ConnectionManager/State: %s -> %s"),
+        STATE_NAMES[m_state], STATE_NAMES[newState]);
+
     m_state = newState;
 
+    // One message covers any number of changes made before it's delivered
+    if (InterlockedExchange(&m_stateChangePosted, 1) == 0
+        && !PostMessage(g_hWnd, WM_PSIPHON_CONNECTION_STATE_CHANGED, 0, 0))
+    {
+        // No window yet; the initial state is shown when it's created
+        InterlockedExchange(&m_stateChangePosted, 0);
+    }
+
     if (newState == CONNECTION_MANAGER_STATE_STARTING)
     {
         UI_SetStateStarting(m_transport->GetTransportProtocolName());
     }
     else if (newState == CONNECTION_MANAGER_STATE_CONNECTED)
     {
+        shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
         UI_SetStateConnected(
             m_transport->GetTransportProtocolName(),
-            m_currentSessionInfo.GetLocalSocksProxyPort(),
-            m_currentSessionInfo.GetLocalHttpProxyPort());
+            sessionInfo->GetLocalSocksProxyPort(),
+            sessionInfo->GetLocalHttpProxyPort());
     }
     else if (newState == CONNECTION_MANAGER_STATE_STOPPING)
     {
@@ -91,6 +371,9 @@ void ConnectionManager::SetState(ConnectionManagerState newState)
     }
     else //if (newState == CONNECTION_MANAGER_STATE_STOPPED)
     {
+        // Done here rather than by an observer: a quick stop and restart
+        // would be coalesced into no change at all.
+        TunnelMetrics::Reset();
         UI_SetStateStopped();
     }
 }
@@ -100,6 +383,29 @@ ConnectionManagerState ConnectionManager::GetState()
     return m_state;
 }
 
+void ConnectionManager::AddStateObserver(const ConnectionStateObserver& observer)
+{
+    m_stateObservers.push_back(observer);
+}
+
+void ConnectionManager::DeliverStateChange()
+{
+    // Cleared first, so a change made while the observers run posts again
+    InterlockedExchange(&m_stateChangePosted, 0);
+
+    ConnectionManagerState state = m_state;
+    if (state == m_deliveredState)
+    {
+        return;
+    }
+    m_deliveredState = state;
+
+    for (auto& observer : m_stateObservers)
+    {
+        observer(state);
+    }
+}
+
 // Note: these IReconnectStateReceiver functions allow e.g., a Transport, to
 // indirectly update the connection state. In the core case, this is used
 // when the core process automatically reconnects when all tunnels are
@@ -110,11 +416,21 @@ ConnectionManagerState ConnectionManager::GetState()
 
 void ConnectionManager::SetReconnecting()
 {
+    // The transport may say so more than once before it's reconnected.
+    if (m_reconnectStartTime == 0)
+    {
+        m_reconnectStartTime = MonotonicMilliseconds();
+    }
     SetState(CONNECTION_MANAGER_STATE_STARTING);
 }
 
 void ConnectionManager::SetReconnected()
 {
+    if (m_reconnectStartTime != 0)
+    {
+        PerformanceBudget::Record(PERF_METRIC_RECONNECT_TIME, (double)(MonotonicMilliseconds() - m_reconnectStartTime));
+        m_reconnectStartTime = 0;
+    }
     SetState(CONNECTION_MANAGER_STATE_CONNECTED);
 }
 
@@ -176,6 +492,16 @@ void ConnectionManager::Stop(DWORD reason)
 
     delete m_transport;
     m_transport = 0;
+    delete m_raceTransport;
+    m_raceTransport = 0;
+
+    if (!m_keepCoreResident)
+    {
+        CoreTransport::DiscardResidentCoreProcess();
+    }
+
+    // E.g., the URL proxy a request was made through
+    TempTunnelPool::Flush();
 
     SetState(CONNECTION_MANAGER_STATE_STOPPED);
 
@@ -189,7 +515,15 @@ void ConnectionManager::Start(bool isReconnect/*=false*/)
     // Call Stop to cleanup in case thread failed on last Start attempt
     Stop(STOP_REASON_USER_DISCONNECT);
 
-    AutoMUTEX lock(m_mutex);
+    // Must be done before we make any system network changes. They're
+    // normally long done by the time we get here.
+    StartupTasks::Wait(STARTUP_TASK_SYSTEM_PROXY);
+    StartupTasks::Wait(STARTUP_TASK_DIAGNOSTIC_COLLECTION);
+
+    AutoLock lock(m_lock);
+
+    // A reconnect the last transport never finished doesn't count.
+    m_reconnectStartTime = 0;
 
     if (!isReconnect)
     {
@@ -200,6 +534,12 @@ void ConnectionManager::Start(bool isReconnect/*=false*/)
 
     m_transport = TransportRegistry::New(Settings::Transport());
 
+    // Racing is done only with a different transport
+    if (Settings::TransportRaceStaggerMilliseconds() > 0)
+    {
+        m_raceTransport = TransportRegistry::NewAlternate(Settings::Transport());
+    }
+
     m_startSplitTunnel = Settings::SplitTunnel();
 
     GlobalStopSignal::Instance().ClearStopSignal(STOP_REASON_ALL &~ STOP_REASON_EXIT);
@@ -234,8 +574,49 @@ void ConnectionManager::Reconnect(bool suppressHomePages)
 
     m_suppressHomePages = suppressHomePages;
 
+    // In persistent-core mode, the core process stays up through the
+    // reconnect, and is reused if its configuration hasn't changed.
+    m_keepCoreResident = Settings::PersistentCore()
+                         && Settings::Transport() == CORE_TRANSPORT_PROTOCOL_NAME;
+
+    CoreTransport::SetKeepResidentOnStop(m_keepCoreResident);
     g_connectionManager.Stop(STOP_REASON_USER_DISCONNECT);
+    CoreTransport::SetKeepResidentOnStop(false);
+
     g_connectionManager.Start(true);
+    m_keepCoreResident = false;
+}
+
+void ConnectionManager::RestartTunnel(bool suppressHomePages)
+{
+    if (GetState() != CONNECTION_MANAGER_STATE_CONNECTED
+        && GetState() != CONNECTION_MANAGER_STATE_STARTING)
+    {
+        // Applied on the next Start
+        return;
+    }
+
+    m_suppressHomePages = suppressHomePages;
+
+    // The in-progress connection (or attempt) ends as if the tunnel had
+    // dropped, and the next one is made with the new configuration.
+    InterlockedExchange(&m_restartTunnel, RESTART_TUNNEL_CONFIG);
+    GlobalStopSignal::Instance().SignalStop(STOP_REASON_UNEXPECTED_DISCONNECT);
+}
+
+static void RecordLastGoodConnection(const tstring& transportProtocolName, const string& serverAddress)
+{
+    Json::Value record;
+    record["transport"] = WStringToUTF8(transportProtocolName);
+    record["server"] = serverAddress;
+    record["time"] = (Json::Int64)time(NULL);
+
+    Json::FastWriter jsonWriter;
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+    (void)WriteRegistryStringValue(
+            LOCAL_SETTINGS_REGISTRY_VALUE_LAST_GOOD_CONNECTION,
+            jsonWriter.write(record),
+            reason);
 }
 
 DWORD WINAPI ConnectionManager::ConnectionManagerStartThread(void* object)
@@ -255,6 +636,10 @@ DWORD WINAPI ConnectionManager::ConnectionManagerStartThread(void* object)
     // Keep track of whether we've already hit a NoServers exception.
     bool noServers = false;
 
+    manager->m_reconnectScheduler.Reset();
+
+    manager->ApplyLastGoodConnection();
+
     //
     // Repeatedly attempt to connect.
     //
@@ -282,192 +667,685 @@ DWORD WINAPI ConnectionManager::ConnectionManagerStartThread(void* object)
 
         my_print(NOT_SENSITIVE, true, _T("%s: enter server loop"), __TFUNCTION__);
 
-        // Timer measures tunnel lifetime
-        DWORD tunnelStartTime = 0;
+        ConnectAttemptResult result = manager->DoConnectAttempt(homePageOpened);
 
-        try
+        if (result == CONNECT_ATTEMPT_STOP)
         {
-            GlobalStopSignal::Instance().CheckSignal(STOP_REASON_ALL, true);
-
-            manager->SetState(CONNECTION_MANAGER_STATE_STARTING);
-
-            // Do we have any usable servers?
-            if (!manager->m_transport->ServerWithCapabilitiesExists())
+            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
+            break;
+        }
+        else if (result == CONNECT_ATTEMPT_NO_SERVERS)
+        {
+            // On the first NoServers we go on so that we can FetchRemoteServerList.
+            // On the second NoServers we bail out.
+            if (noServers)
             {
-                my_print(NOT_SENSITIVE, false, _T("No known servers support this transport"), __TFUNCTION__);
-                throw TransportConnection::NoServers();
+                manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
+                break;
             }
+            noServers = true;
+        }
 
-            //
-            // Set up the transport connection
-            //
+        // Failed to connect to the server. Try the next one.
 
-            my_print(NOT_SENSITIVE, true, _T("%s: doing transportConnection for %s"), __TFUNCTION__, manager->m_transport->GetTransportDisplayName().c_str());
+        // Does nothing if the attempt connected (and was already reported)
+        ConnectTimingReport(false, manager->m_transport->GetTransportDisplayName());
 
-            // Note that the TransportConnection will do any necessary cleanup.
-            TransportConnection transportConnection;
+        manager->SetState(CONNECTION_MANAGER_STATE_STARTING);
 
-            // May throw TryNextServer
-            try
+        // Give users some feedback. Before, when the handshake failed
+        // all we displayed was "WinHttpCallbackFailed (200000)" and kept
+        // the arrow animation spinning. A user-authored FAQ mentioned
+        // this error in particular and recommended waiting. So here's
+        // a lightly more encouraging message.
+        my_print(NOT_SENSITIVE, false, _T("Still trying..."));
+
+        // Continue while-loop to try next server
+
+        // Restarted on resume -- the server was working, and the remote
+        // server list is as fresh as it was before the sleep -- or to apply
+        // settings.
+        LONG restart = InterlockedExchange(&manager->m_restartTunnel, 0);
+        if (restart)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: restarting tunnel (%d)"), __TFUNCTION__, restart);
+            if (restart == RESTART_TUNNEL_CONFIG)
             {
-                transportConnection.Connect(
-                    StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
-                    manager->m_transport,
-                    manager,    // ILocalProxyStatsCollector
-                    manager,    // IUpgradePaver
-                    manager,    // IReconnectStateReceiver
-                    manager);   // IAuthorizationsProvider
+                // As after a full reconnect; m_suppressHomePages decides.
+                homePageOpened = false;
             }
-            catch (TransportConnection::TryNextServer&)
+            continue;
+        }
+
+        // Wait before retrying: between 1 and 2 seconds at first, backing off
+        // on repeated failures, and for as long as we're offline. A network
+        // change cuts the wait short. This comes before the remote server
+        // list fetch, which would fail while offline anyway.
+        // The wait was originally added as a quick
+        // fix to deal with the following problem: when a client can
+        // make an HTTPS connection but not a VPN connection, it ends
+        // up spamming "handshake" requests, resulting in PSK race conditions
+        // with other clients that are trying to connect. This is starving
+        // clients that are able to establish the VPN connection.
+        // TODO: a more optimal solution would only wait when re-trying
+        // a server where this condition (HTTPS ok, VPN failed) previously
+        // occurred.
+        // UPDATE: even with SSH as a fail over, we're leaving this delay
+        // in for now as clients blocked on both protocols would otherwise
+        // still spam handshakes. The delay is *after* SSH fail over so as
+        // not to delay that attempt (on the same server).
+        manager->m_reconnectScheduler.WaitForNextAttempt(
+                    StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL));
+
+        // If a stop was signalled, the next iteration will handle it.
+        manager->FetchRemoteServerList();
+    }
+
+    // Left applied across reconnects, but there are no more.
+    SystemProxySettings::RevertHeld();
+
+    my_print(NOT_SENSITIVE, true, _T("%s: exiting thread"), __TFUNCTION__);
+    return 0;
+}
+
+// static
+bool ConnectionManager::CheckStopped(ConnectAttemptResult& o_result)
+{
+    DWORD reasons = GlobalStopSignal::Instance().CheckSignal(STOP_REASON_ALL);
+    if (!reasons)
+    {
+        return false;
+    }
+
+    // An unexpected disconnect -- the tunnel dropping, or a switch or
+    // restart being asked for -- is retried, unless there's a real stop too.
+    if ((reasons & STOP_REASON_UNEXPECTED_DISCONNECT)
+        && !(reasons & (STOP_REASON_USER_DISCONNECT | STOP_REASON_EXIT)))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: unexpected disconnect"), __TFUNCTION__);
+        GlobalStopSignal::Instance().ClearStopSignal(STOP_REASON_UNEXPECTED_DISCONNECT);
+        o_result = CONNECT_ATTEMPT_RETRY;
+    }
+    else
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: stop signalled (0x%x)"), __TFUNCTION__, reasons);
+        o_result = CONNECT_ATTEMPT_STOP;
+    }
+    return true;
+}
+
+ConnectionManager::ConnectAttemptResult ConnectionManager::DoConnectAttempt(bool& io_homePageOpened)
+{
+    ConnectAttemptResult result = CONNECT_ATTEMPT_RETRY;
+
+    // Timer measures tunnel lifetime
+    DWORD tunnelStartTime = 0;
+
+    // Only the transports' failures are exceptions; this function's own
+    // outcomes are returned.
+    try
+    {
+        if (CheckStopped(result))
+        {
+            return result;
+        }
+
+        SetState(CONNECTION_MANAGER_STATE_STARTING);
+
+        ConnectTimingStart();
+
+        // Do we have any usable servers?
+        if (!m_transport->ServerWithCapabilitiesExists())
+        {
+            my_print(NOT_SENSITIVE, false, _T("No known servers support this transport"), __TFUNCTION__);
+            return CONNECT_ATTEMPT_NO_SERVERS;
+        }
+
+        ConnectTimingMark("ServerListLoaded");
+
+        //
+        // Set up the transport connection
+        //
+
+        my_print(NOT_SENSITIVE, true, _T("%s: doing transportConnection for %s"), __TFUNCTION__, m_transport->GetTransportDisplayName().c_str());
+
+        // Note that the TransportConnection will do any necessary cleanup.
+        TransportConnection transportConnection;
+        TransportConnection* connection = &transportConnection;
+
+        // When racing, the race owns the connection.
+        unique_ptr<TransportConnectRace> race;
+
+        // May throw TryNextServer
+        if (m_raceTransport)
+        {
+            race.reset(new TransportConnectRace(
+                            this,
+                            m_transport,
+                            m_raceTransport,
+                            Settings::TransportRaceStaggerMilliseconds()));
+            connection = &race->Run();
+
+            // The rest of the ConnectionManager works with m_transport.
+            // This also gives the winner the head start next time.
+            if (race->GetWinningTransport() != m_transport)
             {
-                throw;
+                AutoLock lock(m_lock);
+                swap(m_transport, m_raceTransport);
             }
+        }
+        else
+        {
+            transportConnection.HoldSystemProxySettingsOnCleanup();
+            transportConnection.Connect(
+                StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
+                m_transport,
+                this,   // ILocalProxyStatsCollector
+                this,   // IUpgradePaver
+                this,   // IReconnectStateReceiver
+                this);  // IAuthorizationsProvider
+        }
+
+        tunnelStartTime = GetTickCount();
 
-            tunnelStartTime = GetTickCount();
+        //
+        // The transport connection did a handshake, so its sessionInfo is
+        // fuller than ours. Update ours and then update the server entries.
+        //
 
-            //
-            // The transport connection did a handshake, so its sessionInfo is
-            // fuller than ours. Update ours and then update the server entries.
-            //
+        shared_ptr<const SessionInfo> sessionInfo = connection->GetUpdatedSessionInfo();
+        UpdateCurrentSessionInfo(sessionInfo);
 
-            SessionInfo sessionInfo = transportConnection.GetUpdatedSessionInfo();
-            manager->UpdateCurrentSessionInfo(sessionInfo);
+        RecordLastGoodConnection(m_transport->GetTransportProtocolName(), sessionInfo->GetServerAddress());
 
-            //
-            // If handshake notified of new version, start the upgrade in a (background) thread
-            //
+        //
+        // If handshake notified of new version, start the upgrade in a (background) thread
+        //
 
-            if (manager->RequireUpgrade())
+        if (RequireUpgrade())
+        {
+            if (!m_upgradeThread ||
+                WAIT_OBJECT_0 == WaitForSingleObject(m_upgradeThread, 0))
             {
-                if (!manager->m_upgradeThread ||
-                    WAIT_OBJECT_0 == WaitForSingleObject(manager->m_upgradeThread, 0))
+                m_upgradeThread = ThreadPool::Instance().Run(ConnectionManagerUpgradeThread, this);
+                if (!m_upgradeThread)
                 {
-                    manager->m_upgradeThread = CreateThread(0, 0, ConnectionManagerUpgradeThread, manager, 0, 0);
-                    if (!manager->m_upgradeThread)
-                    {
-                        my_print(NOT_SENSITIVE, false, _T("Upgrade: CreateThread failed (%d)"), GetLastError());
-                    }
+                    my_print(NOT_SENSITIVE, false, _T("Upgrade: ThreadPool::Run failed (%d)"), GetLastError());
                 }
             }
+        }
 
-            // Before doing post-connect work, make sure there's no stop signal.
-            // Throws if there's a signal set.
-            GlobalStopSignal::Instance().CheckSignal(STOP_REASON_ALL, true);
-
-            //
-            // Do post-connect work, like opening home pages.
-            //
-
-            my_print(NOT_SENSITIVE, true, _T("%s: transport succeeded; DoPostConnect"), __TFUNCTION__);
-            manager->DoPostConnect(sessionInfo, !homePageOpened);
-            homePageOpened = true;
+        // Before doing post-connect work, make sure there's no stop signal.
+        if (CheckStopped(result))
+        {
+            return result;
+        }
 
-            //
-            // Wait for transportConnection to stop (or fail)
-            //
+        //
+        // Do post-connect work, like opening home pages.
+        //
 
-            my_print(NOT_SENSITIVE, true, _T("%s: entering transportConnection wait"), __TFUNCTION__);
-            transportConnection.WaitForDisconnect();
+        my_print(NOT_SENSITIVE, true, _T("%s: transport succeeded; DoPostConnect"), __TFUNCTION__);
+        DoPostConnect(*sessionInfo, !io_homePageOpened);
+        io_homePageOpened = true;
 
-            GlobalStopSignal::Instance().CheckSignal(STOP_REASON_ALL, true);
+        ConnectTimingReport(true, m_transport->GetTransportDisplayName());
 
-            // The stop signal has not been set, so this was an unexpected disconnect. Retry.
+        // If this connection drops, retry without backing off
+        m_reconnectScheduler.Reset();
 
-            throw TransportConnection::TryNextServer();
+        ConnectionManager* manager = this;
+        tstring transportProtocolName = m_transport->GetTransportProtocolName();
+        unsigned int requiredServerCapabilities = m_transport->RequiredServerCapabilities();
+        TunnelQuality::Start(
+            sessionInfo,
+            WStringToUTF8(transportProtocolName),
+            [manager, sessionInfo, transportProtocolName, requiredServerCapabilities]()
+            {
+                // On the tunnel check thread, which Stop waits for, so
+                // the switch -- which stops the connection -- is posted.
+                (void)ThreadPool::Instance().Post([=]()
+                {
+                    manager->SwitchServerForQuality(sessionInfo, transportProtocolName, requiredServerCapabilities);
+                });
+            });
+        auto stopTunnelQuality = finally([] { TunnelQuality::Stop(); });
+
+        // Stopped when this goes out of scope. See ServerListRefresh for why
+        // the VPN is left out.
+        ServerListRefresh serverListRefresh(WStringToUTF8(transportProtocolName));
+        if (transportProtocolName != VPN_TRANSPORT_PROTOCOL_NAME)
+        {
+            serverListRefresh.Start();
         }
-        catch (TransportConnection::TryNextServer&)
+
+        // Otherwise users in heavily blocked regions only find out that the
+        // list is stale after losing the tunnel. The core fetches its own.
+        if (transportProtocolName != CORE_TRANSPORT_PROTOCOL_NAME
+            && ServerListNeedsRefresh(transportProtocolName, requiredServerCapabilities))
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: caught TryNextServer"), __TFUNCTION__);
-            // Fall through
+            (void)ThreadPool::Instance().Post([manager]()
+            {
+                manager->FetchRemoteServerList(true);
+            });
         }
-        catch (TransportConnection::PermanentFailure&)
+
+        //
+        // Wait for transportConnection to stop (or fail)
+        //
+
+        my_print(NOT_SENSITIVE, true, _T("%s: entering transportConnection wait"), __TFUNCTION__);
+        connection->WaitForDisconnect();
+
+        // If the stop signal has not been set, this was an unexpected disconnect. Retry.
+        (void)CheckStopped(result);
+        return result;
+    }
+    catch (TransportConnection::TryNextServer&)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: caught TryNextServer"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_RETRY;
+    }
+    catch (TransportConnection::PermanentFailure&)
+    {
+        // Unrecoverable error. Cleanup and exit.
+        my_print(NOT_SENSITIVE, true, _T("%s: caught TransportConnection::PermanentFailure"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_STOP;
+    }
+    catch (TransportConnection::NoServers&)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: caught NoServers"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_NO_SERVERS;
+    }
+    catch (StopSignal::UnexpectedDisconnectStopException& ex)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: caught StopSignal::UnexpectedDisconnectStopException"), __TFUNCTION__);
+        GlobalStopSignal::Instance().ClearStopSignal(ex.GetType());
+        return CONNECT_ATTEMPT_RETRY;
+    }
+    catch (IWorkerThread::Error& error)
+    {
+        // Unrecoverable error. Cleanup and exit.
+        my_print(NOT_SENSITIVE, true, _T("%s: caught ITransport::Error: %s"), __TFUNCTION__, error.GetMessage().c_str());
+        return CONNECT_ATTEMPT_STOP;
+    }
+    catch (IWorkerThread::Abort&)
+    {
+        // User requested cancel. Cleanup and exit.
+        my_print(NOT_SENSITIVE, true, _T("%s: caught IWorkerThread::Abort"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_STOP;
+    }
+    // Catch the StopException base class
+    catch (StopSignal::StopException&)
+    {
+        // User requested cancel or transport died, etc. Cleanup and exit.
+        my_print(NOT_SENSITIVE, true, _T("%s: caught StopSignal::StopException"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_STOP;
+    }
+    catch (ConnectionManager::Abort&)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: caught ConnectionManager::Abort"), __TFUNCTION__);
+        return CONNECT_ATTEMPT_STOP;
+    }
+}
+
+// Puts serverAddress at the head of the transport's server list, if it's
+// there. Returns false if it's not.
+static bool MoveServerToFront(const tstring& transportProtocolName, const string& serverAddress)
+{
+    ServerList serverList(WStringToUTF8(transportProtocolName).c_str());
+    ServerListSnapshotPtr snapshot = serverList.GetSnapshot();
+    for (const auto& entry : snapshot->entries)
+    {
+        if (entry.serverAddress == serverAddress)
         {
-            // Unrecoverable error. Cleanup and exit.
-            my_print(NOT_SENSITIVE, true, _T("%s: caught TransportConnection::PermanentFailure"), __TFUNCTION__);
-            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
-            break;
+            // The head of the list is the one reordering leaves alone
+            serverList.MoveEntryToFront(entry, true);
+            return true;
         }
-        catch (TransportConnection::NoServers&)
+    }
+    return false;
+}
+
+void ConnectionManager::ApplyLastGoodConnection()
+{
+    // Called from the connection thread, before the first attempt
+
+    string recordJSON;
+    Json::Value record;
+    Json::Reader reader;
+    if (!ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_LAST_GOOD_CONNECTION, recordJSON)
+        || !reader.parse(recordJSON, record)
+        || !record.isObject())
+    {
+        return;
+    }
+
+    tstring transportProtocolName = UTF8ToWString(record.get("transport", "").asString());
+    string serverAddress = record.get("server", "").asString();
+    time_t recordTime = (time_t)record.get("time", 0).asInt64();
+    if (transportProtocolName.empty()
+        || time(NULL) - recordTime > LAST_GOOD_CONNECTION_MAX_AGE_SECONDS)
+    {
+        return;
+    }
+
+    {
+        AutoLock lock(m_lock);
+
+        if (m_raceTransport && m_raceTransport->GetTransportProtocolName() == transportProtocolName)
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: caught NoServers"), __TFUNCTION__);
-            // On the first NoServers we fall through so that we can FetchRemoteServerList.
-            // On the second NoServers we bail out.
-            if (noServers)
-            {
-                manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
-                break;
-            }
-            // else fall through
-            noServers = true;
+            swap(m_transport, m_raceTransport);
         }
-        catch (StopSignal::UnexpectedDisconnectStopException& ex)
+        else if (m_transport->GetTransportProtocolName() != transportProtocolName)
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: caught StopSignal::UnexpectedDisconnectStopException"), __TFUNCTION__);
-            GlobalStopSignal::Instance().ClearStopSignal(ex.GetType());
-            // Fall through
+            // The user has since chosen a different transport
+            return;
         }
-        catch (IWorkerThread::Error& error)
+    }
+
+    // The tunnel core picks its own server, and keeps its own affinity for
+    // the last one that worked, so it doesn't report one.
+    if (serverAddress.empty())
+    {
+        return;
+    }
+
+    ServerList serverList(WStringToUTF8(transportProtocolName).c_str());
+
+    // Failed since it last worked: let the usual order decide
+    ServerStatsMap stats = serverList.GetServerStats();
+    auto serverStats = stats.find(serverAddress);
+    if (serverStats != stats.end() && serverStats->second.failureCount > 0)
+    {
+        return;
+    }
+
+    if (MoveServerToFront(transportProtocolName, serverAddress))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: resuming with the last good server"), __TFUNCTION__);
+    }
+}
+
+void ConnectionManager::Suspend()
+{
+    m_suspendTime = GetTickCount();
+    InterlockedExchange(&m_suspended, 1);
+    my_print(NOT_SENSITIVE, true, _T("%s: suspending"), __TFUNCTION__);
+}
+
+void ConnectionManager::Resume()
+{
+    if (!InterlockedExchange(&m_suspended, 0))
+    {
+        // Resumed without our seeing the suspend
+        return;
+    }
+
+    // GetTickCount keeps counting while asleep.
+    DWORD suspendedMS = GetTickCount() - m_suspendTime;
+
+    ConnectionManagerState state = GetState();
+    my_print(NOT_SENSITIVE, true, _T("%s: resumed after %d seconds"), __TFUNCTION__, suspendedMS / 1000);
+    TRACE_EVENT(TRACE_KEYWORD_CONNECTION, _T("ConnectionManager/Resume: %d ms"), suspendedMS);
+
+    if (state == CONNECTION_MANAGER_STATE_STARTING)
+    {
+        // Don't sit out a backoff that was mostly slept through.
+        m_reconnectScheduler.Wake();
+        return;
+    }
+
+    if (state != CONNECTION_MANAGER_STATE_CONNECTED)
+    {
+        return;
+    }
+
+    if (suspendedMS < RESUME_REVALIDATE_ONLY_MS)
+    {
+        // The tunnel may well have survived. If it hasn't, the measurement
+        // failing will bring about a switch.
+        (void)TunnelQuality::MeasureNow();
+        return;
+    }
+
+    // The server's sessions will have timed out, if the network hasn't
+    // changed as well. Rather than waiting for the tunnel to notice, start
+    // over -- at the same server, which was working.
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
+    string serverAddress = sessionInfo->GetServerAddress();
+    if (!serverAddress.empty())
+    {
+        tstring transportProtocolName;
         {
-            // Unrecoverable error. Cleanup and exit.
-            my_print(NOT_SENSITIVE, true, _T("%s: caught ITransport::Error: %s"), __TFUNCTION__, error.GetMessage().c_str());
-            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
-            break;
+            AutoLock lock(m_lock);
+            transportProtocolName = m_transport->GetTransportProtocolName();
         }
-        catch (IWorkerThread::Abort&)
+        (void)MoveServerToFront(transportProtocolName, serverAddress);
+    }
+
+    InterlockedExchange(&m_restartTunnel, RESTART_TUNNEL_RESUME);
+    GlobalStopSignal::Instance().SignalStop(STOP_REASON_UNEXPECTED_DISCONNECT);
+}
+
+bool ConnectionManager::IsStatusMessageDeferred() const
+{
+    // Hold off on sends that would only be cut short by the sleep.
+    return m_suspended != 0;
+}
+
+void ConnectionManager::SwitchServerForQuality(
+                            shared_ptr<const SessionInfo> degradedSession,
+                            const tstring& transportProtocolName,
+                            unsigned int requiredServerCapabilities)
+{
+    // Called from a pool thread
+
+    static Lock switchLock("QualitySwitch");
+    static DWORD lastSwitchTime = 0;
+    static bool switched = false;
+
+    AutoLock lock(switchLock);
+
+    if (switched && GetTickCount() - lastSwitchTime < QUALITY_SWITCH_MIN_INTERVAL_MS)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: switched too recently"), __TFUNCTION__);
+        return;
+    }
+
+    string degradedAddress = degradedSession->GetServerAddress();
+
+    // The connection may have moved on while this was queued.
+    if (GetState() != CONNECTION_MANAGER_STATE_CONNECTED
+        || GetCurrentSessionInfo()->GetServerAddress() != degradedAddress)
+    {
+        return;
+    }
+
+    ServerList serverList(WStringToUTF8(transportProtocolName).c_str());
+    serverList.OrderEntriesByScore(serverList.GetEgressRegion());
+    ServerEntries serverEntries = serverList.GetList(requiredServerCapabilities);
+
+    ServerEntries degradedEntries;
+    for (const auto& entry : serverEntries)
+    {
+        if (entry.serverAddress == degradedAddress)
         {
-            // User requested cancel. Cleanup and exit.
-            my_print(NOT_SENSITIVE, true, _T("%s: caught IWorkerThread::Abort"), __TFUNCTION__);
-            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
+            degradedEntries.push_back(entry);
             break;
         }
-        // Catch the StopException base class
-        catch (StopSignal::StopException&)
+    }
+
+    vector<shared_ptr<ITransport>> tempTransports;
+    TransportRegistry::NewAllWithoutHandshake(tempTransports);
+
+    // Make before break: only give up the degraded tunnel once a tunnel to
+    // the next-best server has been brought up.
+    const ServerEntry* candidate = NULL;
+    for (const auto& entry : serverEntries)
+    {
+        if (entry.serverAddress == degradedAddress)
         {
-            // User requested cancel or transport died, etc. Cleanup and exit.
-            my_print(NOT_SENSITIVE, true, _T("%s: caught StopSignal::StopException"), __TFUNCTION__);
-            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
-            break;
+            continue;
         }
-        catch (ConnectionManager::Abort&)
+
+        for (const auto& tempTransport : tempTransports)
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: caught ConnectionManager::Abort"), __TFUNCTION__);
-            manager->SetState(CONNECTION_MANAGER_STATE_STOPPED);
+            // The same as ServerRequest's temp tunnels
+            if (!tempTransport->ServerHasCapabilities(entry))
+            {
+                continue;
+            }
+
+            try
+            {
+                // Throws on failure
+                unique_ptr<TempTunnel> tunnel = TempTunnelPool::Acquire(
+                    tempTransport->GetTransportProtocolName() + _T(":") + UTF8ToWString(entry.serverAddress),
+                    tempTransport,
+                    entry,
+                    true, // don't apply system proxy settings; the current tunnel has them
+                    StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL));
+                TempTunnelPool::Release(std::move(tunnel));
+                candidate = &entry;
+            }
+            catch (StopSignal::StopException&)
+            {
+                return;
+            }
+            catch (...)
+            {
+                my_print(NOT_SENSITIVE, true, _T("%s: temp tunnel failed"), __TFUNCTION__);
+            }
             break;
         }
 
-        // Failed to connect to the server. Try the next one.
+        // Only the next-best is tried: a server further down the list isn't
+        // clearly better than the degraded one.
+        break;
+    }
+
+    if (!candidate)
+    {
+        my_print(NOT_SENSITIVE, false, _T("Tunnel quality is degraded, but no better server is available."));
+        return;
+    }
+
+    // Check again: connecting the temp tunnel took a while.
+    if (GetState() != CONNECTION_MANAGER_STATE_CONNECTED
+        || GetCurrentSessionInfo()->GetServerAddress() != degradedAddress)
+    {
+        return;
+    }
+
+    my_print(NOT_SENSITIVE, false, _T("Tunnel quality is degraded. Switching servers."));
+    TRACE_EVENT(TRACE_KEYWORD_CONNECTION, _T("ConnectionManager/QualitySwitch"));
+
+    Json::Value json;
+    json["transport"] = WStringToUTF8(transportProtocolName);
+    AddDiagnosticInfoJson("QualitySwitch", json);
+
+    ServerList::Batch batch(serverList);
+    for (auto entry = degradedEntries.begin(); entry != degradedEntries.end(); ++entry)
+    {
+        batch.MarkServerFailed(*entry);
+    }
+    batch.MoveEntryToFront(*candidate, true);
+    batch.Commit();
 
-        manager->SetState(CONNECTION_MANAGER_STATE_STARTING);
+    lastSwitchTime = GetTickCount();
+    switched = true;
 
-        // Give users some feedback. Before, when the handshake failed
-        // all we displayed was "WinHttpCallbackFailed (200000)" and kept
-        // the arrow animation spinning. A user-authored FAQ mentioned
-        // this error in particular and recommended waiting. So here's
-        // a lightly more encouraging message.
-        my_print(NOT_SENSITIVE, false, _T("Still trying..."));
+    // The connection thread treats this as a dropped connection and
+    // reconnects, without backing off.
+    GlobalStopSignal::Instance().SignalStop(STOP_REASON_UNEXPECTED_DISCONNECT);
+}
 
-        // Continue while-loop to try next server
+// Asks the local HTTP proxy to CONNECT to hostPort and then hangs up once it
+// has. That's a tunneled DNS lookup and TCP connection the browser's first
+// request doesn't have to wait for: the server resolves the host and the core
+// and server have a port forward's path warmed up. Failure is only logged.
+static void WarmUpThroughLocalProxy(int localHttpProxyPort, const string& hostPort)
+{
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
 
-        manager->FetchRemoteServerList();
+    SOCKET sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock == INVALID_SOCKET)
+    {
+        return;
+    }
+    auto closeSocket = finally([sock]() { closesocket(sock); });
 
-        // Wait between 1 and 2 seconds before retrying. This is a quick
-        // fix to deal with the following problem: when a client can
-        // make an HTTPS connection but not a VPN connection, it ends
-        // up spamming "handshake" requests, resulting in PSK race conditions
-        // with other clients that are trying to connect. This is starving
-        // clients that are able to establish the VPN connection.
-        // TODO: a more optimal solution would only wait when re-trying
-        // a server where this condition (HTTPS ok, VPN failed) previously
-        // occurred.
-        // UPDATE: even with SSH as a fail over, we're leaving this delay
-        // in for now as clients blocked on both protocols would otherwise
-        // still spam handshakes. The delay is *after* SSH fail over so as
-        // not to delay that attempt (on the same server).
-        Sleep(1000 + rand()%1000);
+    DWORD timeout = HOME_PAGE_WARM_UP_TIMEOUT_MS;
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+    setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (const char*)&timeout, sizeof(timeout));
+
+    sockaddr_in proxyAddr;
+    proxyAddr.sin_family = AF_INET;
+    proxyAddr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    proxyAddr.sin_port = htons(localHttpProxyPort);
+
+    string request = "CONNECT " + hostPort + " HTTP/1.1\r\nHost: " + hostPort + "\r\n\r\n";
+
+    DWORD start = GetTickCount();
+
+    // Only the status line matters; the rest is thrown away with the socket.
+    char response[64] = { 0 };
+    if (SOCKET_ERROR == connect(sock, (SOCKADDR*)&proxyAddr, sizeof(proxyAddr))
+        || SOCKET_ERROR == send(sock, request.data(), (int)request.length(), 0)
+        || 0 >= recv(sock, response, sizeof(response) - 1, 0))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: failed (%d)"), __TFUNCTION__, WSAGetLastError());
+        return;
     }
 
-    my_print(NOT_SENSITIVE, true, _T("%s: exiting thread"), __TFUNCTION__);
-    return 0;
+    bool succeeded = (0 == strncmp(response, "HTTP/1.", 7) && 0 == strncmp(response + 8, " 200", 4));
+    my_print(NOT_SENSITIVE, true, _T("%s: %s in %d ms"), __TFUNCTION__, succeeded ? _T("connected") : _T("refused"), GetTickCount() - start);
+}
+
+// Starts preconnecting to the home page hosts, without waiting.
+static void WarmUpHomePages(const SessionInfo& sessionInfo)
+{
+    int localHttpProxyPort = sessionInfo.GetLocalHttpProxyPort();
+    if (localHttpProxyPort <= 0 || localHttpProxyPort > 0xFFFF)
+    {
+        return;
+    }
+
+    vector<string> hostPorts;
+    vector<tstring> urls = sessionInfo.GetHomepages();
+    for (auto url = urls.cbegin(); url != urls.cend() && hostPorts.size() < HOME_PAGE_WARM_UP_MAX_HOSTS; ++url)
+    {
+        TCHAR host[256], port[16], scheme[16];
+        DWORD hostLength = sizeof(host) / sizeof(host[0]);
+        DWORD portLength = sizeof(port) / sizeof(port[0]);
+        DWORD schemeLength = sizeof(scheme) / sizeof(scheme[0]);
+        if (S_OK != UrlGetPart(url->c_str(), host, &hostLength, URL_PART_HOSTNAME, 0)
+            || host[0] == _T('\0')
+            || S_OK != UrlGetPart(url->c_str(), scheme, &schemeLength, URL_PART_SCHEME, 0))
+        {
+            continue;
+        }
+        if (S_OK != UrlGetPart(url->c_str(), port, &portLength, URL_PART_PORT, 0) || port[0] == _T('\0'))
+        {
+            _tcscpy_s(port, (0 == _tcsicmp(scheme, _T("https"))) ? _T("443") : _T("80"));
+        }
+
+        string hostPort = WStringToUTF8(host) + ":" + WStringToUTF8(port);
+        if (std::find(hostPorts.begin(), hostPorts.end(), hostPort) == hostPorts.end())
+        {
+            hostPorts.push_back(hostPort);
+        }
+    }
+
+    for (auto hostPort = hostPorts.cbegin(); hostPort != hostPorts.cend(); ++hostPort)
+    {
+        string target = *hostPort;
+        (void)ThreadPool::Instance().Post([localHttpProxyPort, target]() {
+            WarmUpThroughLocalProxy(localHttpProxyPort, target);
+        });
+    }
 }
 
 void ConnectionManager::DoPostConnect(const SessionInfo& sessionInfo, bool openHomePages)
@@ -475,8 +1353,17 @@ void ConnectionManager::DoPostConnect(const SessionInfo& sessionInfo, bool openH
     // Called from connection thread
     // NOTE: no lock while waiting for network events
 
+    openHomePages = openHomePages && !m_homePagesDisabled;
+
     SetState(CONNECTION_MANAGER_STATE_CONNECTED);
 
+    // Started ahead of the "connected" request, so it's done by the time the
+    // browser is -- or at least well on its way.
+    if (openHomePages && !m_suppressHomePages)
+    {
+        WarmUpHomePages(sessionInfo);
+    }
+
     if (m_transport->RequiresStatsSupport())
     {
         //
@@ -533,14 +1420,22 @@ void ConnectionManager::DoPostConnect(const SessionInfo& sessionInfo, bool openH
     if (openHomePages && !m_suppressHomePages)
     {
         OpenHomePages("connect");
+        ConnectTimingMark("HomePagesOpened");
     }
 }
 
+void ConnectionManager::SetHomePagesDisabled(bool disabled)
+{
+    m_homePagesDisabled = disabled;
+}
+
 void ConnectionManager::OpenHomePages(const string& reason, const TCHAR* defaultHomePage/*=0*/)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
-    vector<tstring> urls = m_currentSessionInfo.GetHomepages();
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
+
+    vector<tstring> urls = sessionInfo->GetHomepages();
     if (urls.size() == 0 && defaultHomePage)
     {
         urls.push_back(defaultHomePage);
@@ -568,7 +1463,10 @@ void ConnectionManager::OpenHomePages(const string& reason, const TCHAR* default
         OpenBrowser(UTF8ToWString(url));
     }
 
-    m_currentSessionInfo.RotateHomepages();
+    // Rare enough that copying the snapshot to change it doesn't matter
+    shared_ptr<SessionInfo> rotated = make_shared<SessionInfo>(*sessionInfo);
+    rotated->RotateHomepages();
+    atomic_store(&m_currentSessionInfo, shared_ptr<const SessionInfo>(rotated));
 }
 
 bool ConnectionManager::IsWholeSystemTunneled() const
@@ -578,20 +1476,39 @@ bool ConnectionManager::IsWholeSystemTunneled() const
         && m_transport->IsConnected(true);
 }
 
+// Compresses `input` into a gzip stream. Crypto++'s Gzip is used, as the
+// bundled zlib is built without deflate.
+static bool GzipCompress(const string& input, string& o_output)
+{
+    o_output.clear();
+
+    try
+    {
+        CryptoPP::Gzip gzip(new CryptoPP::StringSink(o_output), CryptoPP::Gzip::MAX_DEFLATE_LEVEL);
+        gzip.Put((const byte*)input.data(), input.length());
+        gzip.MessageEnd();
+    }
+    catch (const CryptoPP::Exception& e)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Gzip exception: %S"), __TFUNCTION__, e.what());
+        o_output.clear();
+        return false;
+    }
+
+    return true;
+}
+
 bool ConnectionManager::SendStatusMessage(
                             bool final,
-                            const map<string, int>& pageViewEntries,
-                            const map<string, int>& httpsRequestEntries,
+                            const StatsEntryCounts& pageViewEntries,
+                            const StatsEntryCounts& httpsRequestEntries,
+                            const StatsEntryBytes& pageViewBytes,
+                            const StatsEntryBytes& httpsRequestBytes,
                             unsigned long long bytesTransferred)
 {
     // NOTE: no lock while waiting for network events
 
-    // Make a copy of SessionInfo for threadsafety.
-    SessionInfo sessionInfo;
-    {
-        AutoMUTEX lock(m_mutex);
-        sessionInfo = m_currentSessionInfo;
-    }
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
 
     // Format stats data for consumption by the server.
 
@@ -612,7 +1529,7 @@ bool ConnectionManager::SendStatusMessage(
     stats["bytes_transferred"] = bytesTransferred;
     my_print(SENSITIVE_LOG, true, _T("BYTES: %llu"), bytesTransferred);
 
-    map<string, int>::const_iterator pos = pageViewEntries.begin();
+    StatsEntryCounts::const_iterator pos = pageViewEntries.begin();
     Json::Value page_views(Json::arrayValue);
     for (; pos != pageViewEntries.end(); pos++)
     {
@@ -636,11 +1553,49 @@ bool ConnectionManager::SendStatusMessage(
     }
     stats["https_requests"] = https_requests;
 
+    // Traffic volume per destination is more revealing than the counts, so
+    // it's only reported when the user has opted in.
+    if (Settings::ReportTrafficByDestination())
+    {
+        Json::Value page_view_bytes(Json::arrayValue);
+        for (StatsEntryBytes::const_iterator it = pageViewBytes.begin(); it != pageViewBytes.end(); it++)
+        {
+            Json::Value entry;
+            entry["page"] = it->first;
+            entry["bytes"] = it->second;
+            page_view_bytes.append(entry);
+        }
+        stats["page_view_bytes"] = page_view_bytes;
+
+        Json::Value https_request_bytes(Json::arrayValue);
+        for (StatsEntryBytes::const_iterator it = httpsRequestBytes.begin(); it != httpsRequestBytes.end(); it++)
+        {
+            Json::Value entry;
+            entry["domain"] = it->first;
+            entry["bytes"] = it->second;
+            https_request_bytes.append(entry);
+        }
+        stats["https_request_bytes"] = https_request_bytes;
+    }
+
     ostringstream additionalData;
     Json::FastWriter jsonWriter;
     additionalData << jsonWriter.write(stats);
     string additionalDataString = additionalData.str();
 
+    // Stats often go over slow links and the JSON is highly repetitive, so
+    // compress it if the server can take it.
+    LPCWSTR additionalHeaders = L"Content-Type: application/json";
+    string compressedData;
+    if (sessionInfo->GetStatusRequestCompression()
+        && GzipCompress(additionalDataString, compressedData)
+        && compressedData.length() < additionalDataString.length())
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: compressed stats from %d to %d bytes"), __TFUNCTION__, (int)additionalDataString.length(), (int)compressedData.length());
+        additionalDataString.swap(compressedData);
+        additionalHeaders = L"Content-Type: application/json\r\nContent-Encoding: gzip";
+    }
+
     tstring requestPath = GetStatusRequestPath(m_transport, !final);
     if (requestPath.length() <= 0)
     {
@@ -662,11 +1617,11 @@ bool ConnectionManager::SendStatusMessage(
     bool success = ServerRequest::MakeRequest(
                                     reqLevel,
                                     m_transport,
-                                    sessionInfo,
+                                    *sessionInfo,
                                     requestPath.c_str(),
                                     response,
                                     StopInfo(&GlobalStopSignal::Instance(), stopReason),
-                                    L"Content-Type: application/json",
+                                    additionalHeaders,
                                     (LPVOID)additionalDataString.c_str(),
                                     additionalDataString.length());
 
@@ -675,21 +1630,17 @@ bool ConnectionManager::SendStatusMessage(
 
 tstring ConnectionManager::GetFailedRequestPath(ITransport* transport)
 {
-    AutoMUTEX lock(m_mutex);
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
 
     return tstring(HTTP_FAILED_REQUEST_PATH) +
-           _T("?client_session_id=") + UTF8ToWString(m_currentSessionInfo.GetClientSessionID()) +
-           _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
-           _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
-           _T("&client_version=") + UTF8ToWString(CLIENT_VERSION) +
-           _T("&server_secret=") + UTF8ToWString(m_currentSessionInfo.GetWebServerSecret()) +
+           _T("?") + sessionInfo->GetRequestParams() +
            _T("&relay_protocol=") +  transport->GetTransportRequestName() +
            _T("&error_code=") + transport->GetLastTransportError();
 }
 
 tstring ConnectionManager::GetConnectRequestPath(ITransport* transport)
 {
-    AutoMUTEX lock(m_mutex);
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
 
     // Get info about the previous connected event
     string lastConnected;
@@ -698,21 +1649,17 @@ tstring ConnectionManager::GetConnectRequestPath(ITransport* transport)
     if (lastConnected.length() == 0) lastConnected = "None";
 
     return tstring(HTTP_CONNECTED_REQUEST_PATH) +
-           _T("?client_session_id=") + UTF8ToWString(m_currentSessionInfo.GetClientSessionID()) +
-           _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
-           _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
-           _T("&client_version=") + UTF8ToWString(CLIENT_VERSION) +
-           _T("&server_secret=") + UTF8ToWString(m_currentSessionInfo.GetWebServerSecret()) +
+           _T("?") + sessionInfo->GetRequestParams() +
            _T("&relay_protocol=") + transport->GetTransportRequestName() +
-           _T("&session_id=") + transport->GetSessionID(m_currentSessionInfo) +
+           _T("&session_id=") + transport->GetSessionID(*sessionInfo) +
            _T("&last_connected=") + UTF8ToWString(lastConnected);
 }
 
 tstring ConnectionManager::GetStatusRequestPath(ITransport* transport, bool connected)
 {
-    AutoMUTEX lock(m_mutex);
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
 
-    tstring sessionID = transport->GetSessionID(m_currentSessionInfo);
+    tstring sessionID = transport->GetSessionID(*sessionInfo);
 
     // If there's no session ID, we can't send the status.
     if (sessionID.length() <= 0)
@@ -724,58 +1671,140 @@ tstring ConnectionManager::GetStatusRequestPath(ITransport* transport, bool conn
     // TODO: get error code from SSH client?
 
     return tstring(HTTP_STATUS_REQUEST_PATH) +
-           _T("?client_session_id=") + UTF8ToWString(m_currentSessionInfo.GetClientSessionID()) +
-           _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
-           _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
-           _T("&client_version=") + UTF8ToWString(CLIENT_VERSION) +
-           _T("&server_secret=") + UTF8ToWString(m_currentSessionInfo.GetWebServerSecret()) +
+           _T("?") + sessionInfo->GetRequestParams() +
            _T("&relay_protocol=") +  transport->GetTransportRequestName() +
            _T("&session_id=") + sessionID +
            _T("&connected=") + (connected ? _T("1") : _T("0"));
 }
 
-void ConnectionManager::GetUpgradeRequestInfo(SessionInfo& sessionInfo, tstring& requestPath)
+void ConnectionManager::GetUpgradeRequestInfo(shared_ptr<const SessionInfo>& o_sessionInfo, tstring& requestPath)
 {
-    AutoMUTEX lock(m_mutex);
-
-    sessionInfo = m_currentSessionInfo;
+    o_sessionInfo = GetCurrentSessionInfo();
     requestPath = tstring(HTTP_DOWNLOAD_REQUEST_PATH) +
-                    _T("?client_session_id=") + UTF8ToWString(m_currentSessionInfo.GetClientSessionID()) +
+                    _T("?client_session_id=") + UTF8ToWString(o_sessionInfo->GetClientSessionID()) +
                     _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
                     _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
-                    _T("&client_version=") + UTF8ToWString(m_currentSessionInfo.GetUpgradeVersion()) +
-                    _T("&server_secret=") + UTF8ToWString(m_currentSessionInfo.GetWebServerSecret());
+                    _T("&client_version=") + UTF8ToWString(o_sessionInfo->GetUpgradeVersion()) +
+                    _T("&server_secret=") + UTF8ToWString(o_sessionInfo->GetWebServerSecret());
 }
 
 
 // ==== General Session Functions =============================================
 
-void ConnectionManager::FetchRemoteServerList()
+// static
+bool ConnectionManager::ServerListNeedsRefresh(
+                            const tstring& transportProtocolName,
+                            unsigned int requiredServerCapabilities)
 {
-    // Note: not used by CoreTransport
+    ServerList serverList(WStringToUTF8(transportProtocolName).c_str());
+    size_t total = 0;
+    size_t viable = serverList.CountViableEntries(requiredServerCapabilities, total);
+
+    if (viable >= PREEMPTIVE_FETCH_MIN_VIABLE_SERVERS
+        && viable >= total * PREEMPTIVE_FETCH_MIN_VIABLE_FRACTION)
+    {
+        return false;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %d of %d servers viable"), __TFUNCTION__, viable, total);
+    return true;
+}
 
-    AutoMUTEX lock(m_mutex);
+void ConnectionManager::FetchRemoteServerList(bool preemptive/*=false*/)
+{
+    // Note: not used by CoreTransport
 
     if (strlen(REMOTE_SERVER_LIST_ADDRESS) == 0)
     {
         return;
     }
 
-    // After at least one failed connection attempt, and no more than once
-    // per few hours (if successful), or not more than once per few minutes
-    // (if unsuccessful), check for a new remote server list.
-    if (m_nextFetchRemoteServerListAttempt != 0 &&
-        m_nextFetchRemoteServerListAttempt > time(0))
+    // Only the scheduling is done under the lock: a pre-emptive fetch runs
+    // while connected, and mustn't hold up the connection manager.
+    auto scheduleNextFetch = [this](int seconds)
     {
-        return;
+        AutoLock lock(m_lock);
+        m_nextFetchRemoteServerListAttempt = time(0) + seconds;
+    };
+
+    {
+        AutoLock lock(m_lock);
+
+        if (m_fetchingRemoteServerList)
+        {
+            return;
+        }
+
+        // After at least one failed connection attempt, and no more than once
+        // per few hours (if successful), or not more than once per few minutes
+        // (if unsuccessful), check for a new remote server list. A pre-emptive
+        // fetch, made because the list is running out of servers, has only
+        // the shorter interval to wait.
+        time_t now = time(0);
+        if (preemptive)
+        {
+            if (m_lastFetchRemoteServerListAttempt != 0
+                && now - m_lastFetchRemoteServerListAttempt < PREEMPTIVE_FETCH_MIN_INTERVAL_SECONDS)
+            {
+                return;
+            }
+        }
+        else if (m_nextFetchRemoteServerListAttempt != 0 &&
+                 m_nextFetchRemoteServerListAttempt > now)
+        {
+            return;
+        }
+
+        m_fetchingRemoteServerList = true;
+        m_lastFetchRemoteServerListAttempt = now;
+        m_nextFetchRemoteServerListAttempt = now + SECONDS_BETWEEN_UNSUCCESSFUL_REMOTE_SERVER_LIST_FETCH;
     }
 
-    m_nextFetchRemoteServerListAttempt = time(0) + SECONDS_BETWEEN_UNSUCCESSFUL_REMOTE_SERVER_LIST_FETCH;
+    auto fetchDone = finally([this]
+    {
+        AutoLock lock(m_lock);
+        m_fetchingRemoteServerList = false;
+    });
+
+    if (preemptive)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: fetching ahead of need"), __TFUNCTION__);
+    }
 
-    string response;
+    // Nothing waits on a pre-emptive fetch, including the parsing of a
+    // large list. One made between connect attempts is waited on.
+    ThreadQoSScope qos(preemptive ? THREAD_QOS_BACKGROUND : THREAD_QOS_DEFAULT);
+
+    // The list changes far less often than we check it, so we make a
+    // conditional request with the validators from the last list we stored.
+    // A 304 means there's nothing to download or verify.
+    string storedETag, storedLastModified, storedHash;
+    (void)ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_HASH, storedHash);
+    if (!storedHash.empty())
+    {
+        (void)ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_ETAG, storedETag);
+        (void)ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_LAST_MODIFIED, storedLastModified);
+    }
+
+    wstring conditionalHeaders;
+    if (!storedETag.empty())
+    {
+        conditionalHeaders += L"If-None-Match: " + UTF8ToWString(storedETag) + L"\r\n";
+    }
+    if (!storedLastModified.empty())
+    {
+        conditionalHeaders += L"If-Modified-Since: " + UTF8ToWString(storedLastModified) + L"\r\n";
+    }
+
+    string response, etag, lastModified;
 
     try
     {
+        // Throws if the app exits while waiting
+        BackgroundTransferTurn turn(
+            BACKGROUND_TRANSFER_PRIORITY_REMOTE_SERVER_LIST,
+            StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_EXIT));
+
         HTTPSRequest httpsRequest;
         HTTPSRequest::Response httpsResponse;
         // NOTE: Not using local proxy
@@ -787,14 +1816,30 @@ void ConnectionManager::FetchRemoteServerList()
                 StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_EXIT),
                 HTTPSRequest::PsiphonProxy::DONT_USE,
                 httpsResponse,
-                true)  // fail over to URL proxy
-            || httpsResponse.code != HTTPSRequest::OK
+                true,  // fail over to URL proxy
+                conditionalHeaders.empty() ? NULL : conditionalHeaders.c_str()))
+        {
+            my_print(NOT_SENSITIVE, false, _T("Fetch remote server list failed"));
+            return;
+        }
+
+        if (httpsResponse.code == HTTPSRequest::NOT_MODIFIED && !conditionalHeaders.empty())
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: remote server list not modified"), __TFUNCTION__);
+            scheduleNextFetch(SECONDS_BETWEEN_SUCCESSFUL_REMOTE_SERVER_LIST_FETCH);
+            return;
+        }
+
+        if (httpsResponse.code != HTTPSRequest::OK
             || httpsResponse.body.length() <= 0)
         {
             my_print(NOT_SENSITIVE, false, _T("Fetch remote server list failed"));
             return;
         }
-        response = httpsResponse.body;
+
+        response.swap(httpsResponse.body);
+        etag = httpsResponse.etag;
+        lastModified = httpsResponse.lastModified;
     }
     catch (StopSignal::StopException&)
     {
@@ -802,7 +1847,18 @@ void ConnectionManager::FetchRemoteServerList()
         return;
     }
 
-    m_nextFetchRemoteServerListAttempt = time(0) + SECONDS_BETWEEN_SUCCESSFUL_REMOTE_SERVER_LIST_FETCH;
+    scheduleNextFetch(SECONDS_BETWEEN_SUCCESSFUL_REMOTE_SERVER_LIST_FETCH);
+
+    // Servers that don't support conditional requests still send the same
+    // bytes when nothing has changed, and those we've already verified and
+    // stored.
+    string responseHash = Sha256Hex(response);
+    if (responseHash == storedHash)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: remote server list unchanged"), __TFUNCTION__);
+        StoreRemoteServerListValidators(etag, lastModified, responseHash);
+        return;
+    }
 
     string serverEntryList;
     if (!verifySignedDataPackage(
@@ -833,6 +1889,10 @@ void ConnectionManager::FetchRemoteServerList()
         TransportRegistry::AddServerEntries(newServerEntryVector, 0);
 
         my_print(NOT_SENSITIVE, true, _T("%s: %d server entries"), __TFUNCTION__, newServerEntryVector.size());
+
+        // Only now is the list ours, so only now may later fetches be
+        // skipped on its account.
+        StoreRemoteServerListValidators(etag, lastModified, responseHash);
     }
     catch (std::exception &ex)
     {
@@ -841,11 +1901,40 @@ void ConnectionManager::FetchRemoteServerList()
     }
 }
 
+// static
+void ConnectionManager::StoreRemoteServerListValidators(
+                            const string& etag,
+                            const string& lastModified,
+                            const string& hash)
+{
+    // The hash is written last: the validators are only used with a hash.
+    // A failure just means the next fetch isn't conditional.
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+    RegistryWriteBatch batch;
+    (void)WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_ETAG, etag, reason);
+    (void)WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_LAST_MODIFIED, lastModified, reason);
+    (void)WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_REMOTE_SERVER_LIST_HASH, hash, reason);
+}
+
 bool ConnectionManager::RequireUpgrade(void)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
+
+    return !m_upgradePending && GetCurrentSessionInfo()->GetUpgradeVersion().size() > 0;
+}
+
+// Where an upgrade download is kept while it's in progress, so that an
+// interrupted one can be resumed.
+static bool GetUpgradeDownloadPath(const TCHAR* filename, tstring& o_path)
+{
+    tstring dataDirectory;
+    if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, true, dataDirectory))
+    {
+        return false;
+    }
 
-    return !m_upgradePending && m_currentSessionInfo.GetUpgradeVersion().size() > 0;
+    o_path = (filesystem::path(dataDirectory) / filename).wstring();
+    return true;
 }
 
 DWORD WINAPI ConnectionManager::ConnectionManagerUpgradeThread(void* object)
@@ -858,7 +1947,7 @@ DWORD WINAPI ConnectionManager::ConnectionManagerUpgradeThread(void* object)
 
     try
     {
-        SessionInfo sessionInfo;
+        shared_ptr<const SessionInfo> sessionInfo;
         tstring downloadRequestPath;
         // Note that this is getting the current session info, which is set
         // by LoadNextServer.  So it's unlikely but possible that we may be
@@ -867,20 +1956,33 @@ DWORD WINAPI ConnectionManager::ConnectionManagerUpgradeThread(void* object)
         // all servers should have the same upgrades available.
         manager->GetUpgradeRequestInfo(sessionInfo, downloadRequestPath);
 
-        // Download new binary
-        HTTPSRequest httpsRequest;
-        HTTPSRequest::Response httpsResponse;
-        if (!httpsRequest.MakeRequest(
-                UTF8ToWString(UPGRADE_ADDRESS).c_str(),
-                443,
-                "",
-                UTF8ToWString(UPGRADE_REQUEST_PATH).c_str(),
-                StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
-                HTTPSRequest::PsiphonProxy::USE,
-                httpsResponse,
-                true) // fail over to URL proxy
-            || httpsResponse.code != HTTPSRequest::OK
-            || httpsResponse.body.length() <= 0)
+        // A delta against this binary is much smaller than the full package,
+        // if one has been published; otherwise, or if it doesn't apply, the
+        // full package is downloaded.
+        if (manager->DownloadAndPaveUpgradeDelta())
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: exiting thread"), __TFUNCTION__);
+            return 0;
+        }
+
+        // Download new binary, picking up where an interrupted download
+        // left off
+        tstring downloadPath;
+        int responseCode = -1;
+        string download;
+        if (!GetUpgradeDownloadPath(LOCAL_SETTINGS_APPDATA_UPGRADE_DOWNLOAD_FILENAME, downloadPath)
+            || !BackgroundDownload(
+                    BACKGROUND_TRANSFER_PRIORITY_UPGRADE,
+                    UTF8ToWString(UPGRADE_ADDRESS).c_str(),
+                    443,
+                    UTF8ToWString(UPGRADE_REQUEST_PATH).c_str(),
+                    downloadPath,
+                    StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
+                    HTTPSRequest::PsiphonProxy::USE,
+                    true, // fail over to URL proxy
+                    responseCode)
+            || !ReadFileContents(downloadPath, download)
+            || download.length() <= 0)
         {
             // If the download failed, we simply do nothing.
             // Rationale:
@@ -895,23 +1997,25 @@ DWORD WINAPI ConnectionManager::ConnectionManagerUpgradeThread(void* object)
         {
             my_print(NOT_SENSITIVE, false, _T("Download complete"));
 
+            // Whether or not it checks out, this download is done with.
+            BackgroundDownloadDiscard(downloadPath);
+
             // Perform upgrade.
 
             string upgradeData;
 
             if (verifySignedDataPackage(
                     UPGRADE_SIGNATURE_PUBLIC_KEY,
-                    httpsResponse.body.c_str(),
-                    httpsResponse.body.length(),
+                    download.c_str(),
+                    download.length(),
                     true, // gzip compressed
                     upgradeData))
             {
-                // Data in the package is Base64 encoded
-                upgradeData = Base64Decode(upgradeData);
-
+                // Data in the package is Base64 encoded; it's decoded as
+                // it's paved.
                 if (upgradeData.length() > 0)
                 {
-                    manager->PaveUpgrade(upgradeData);
+                    (void)manager->PaveUpgrade(upgradeData);
                 }
             }
             else
@@ -930,9 +2034,140 @@ DWORD WINAPI ConnectionManager::ConnectionManagerUpgradeThread(void* object)
     return 0;
 }
 
-void ConnectionManager::PaveUpgrade(const string& download)
+bool ConnectionManager::PaveUpgrade(const string& base64Download)
+{
+    return PaveUpgradeWith([&base64Download](const tstring&, const tstring& newFilename)
+    {
+        // Decode and write the new version next to the current one, a chunk
+        // at a time, so the decoded binary is never in memory all at once.
+        AutoHANDLE file = CreateFile(newFilename.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::exception("Upgrade - CreateFile failed");
+        }
+
+        vector<unsigned char> buffer(Base64MaxDecodedLength(UPGRADE_PAVE_CHUNK_SIZE));
+        size_t offset = 0;
+        size_t totalWritten = 0;
+
+        while (offset < base64Download.length())
+        {
+            size_t chunkLength = Base64ChunkLength(
+                                    base64Download.data() + offset,
+                                    base64Download.length() - offset,
+                                    UPGRADE_PAVE_CHUNK_SIZE);
+            size_t decodedLength = 0;
+
+            if (chunkLength == 0
+                || !Base64DecodeBytes(base64Download.data() + offset, chunkLength, &buffer[0], decodedLength))
+            {
+                throw std::exception("Upgrade - Base64 decode failed");
+            }
+
+            DWORD written;
+
+            if (!WriteFile(file, &buffer[0], (DWORD)decodedLength, &written, NULL) || written != decodedLength)
+            {
+                throw std::exception("Upgrade - WriteFile failed");
+            }
+
+            offset += chunkLength;
+            totalWritten += decodedLength;
+        }
+
+        if (totalWritten == 0)
+        {
+            throw std::exception("Upgrade - empty binary");
+        }
+
+        if (!FlushFileBuffers(file))
+        {
+            throw std::exception("Upgrade - FlushFileBuffers failed");
+        }
+    });
+}
+
+bool ConnectionManager::DownloadAndPaveUpgradeDelta()
+{
+    // Called from the upgrade thread
+    // May throw StopSignal::StopException
+
+    TCHAR filename[1000];
+    string deltaRequestPath;
+    if (!GetModuleFileName(NULL, filename, 1000)
+        || !GetUpgradeDeltaRequestPath(filename, UPGRADE_REQUEST_PATH, deltaRequestPath))
+    {
+        return false;
+    }
+
+    tstring downloadPath;
+    int responseCode = -1;
+    string download;
+    if (!GetUpgradeDownloadPath(LOCAL_SETTINGS_APPDATA_UPGRADE_DELTA_DOWNLOAD_FILENAME, downloadPath)
+        || !BackgroundDownload(
+                BACKGROUND_TRANSFER_PRIORITY_UPGRADE,
+                UTF8ToWString(UPGRADE_ADDRESS).c_str(),
+                443,
+                UTF8ToWString(deltaRequestPath).c_str(),
+                downloadPath,
+                StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
+                HTTPSRequest::PsiphonProxy::USE,
+                true, // fail over to URL proxy
+                responseCode)
+        || !ReadFileContents(downloadPath, download)
+        || download.length() <= 0)
+    {
+        // Not published for this binary, most likely.
+        my_print(NOT_SENSITIVE, true, _T("%s: no delta (%d)"), __TFUNCTION__, responseCode);
+        return false;
+    }
+
+    BackgroundDownloadDiscard(downloadPath);
+
+    string deltaData;
+    if (!verifySignedDataPackage(
+            UPGRADE_SIGNATURE_PUBLIC_KEY,
+            download.c_str(),
+            download.length(),
+            true, // gzip compressed
+            deltaData))
+    {
+        my_print(NOT_SENSITIVE, false, _T("Upgrade delta verification failed! Please report this error."));
+        return false;
+    }
+
+    // Data in the package is Base64 encoded
+    string delta = Base64Decode(deltaData);
+    string().swap(deltaData);
+
+    if (delta.empty() || !PaveUpgradeDelta(delta))
+    {
+        return false;
+    }
+
+    my_print(NOT_SENSITIVE, false, _T("Upgrade applied from a delta of %d bytes"), (int)delta.length());
+    return true;
+}
+
+bool ConnectionManager::PaveUpgradeDelta(const string& delta)
+{
+    return PaveUpgradeWith([&delta](const tstring& currentFilename, const tstring& newFilename)
+    {
+        if (!ApplyUpgradeDelta(delta, currentFilename, newFilename))
+        {
+            throw std::exception("Upgrade - ApplyUpgradeDelta failed");
+        }
+    });
+}
+
+bool ConnectionManager::PaveUpgradeWith(
+        std::function<void(const tstring& currentFilename, const tstring& newFilename)> writeNewVersion)
 {
-    AutoMUTEX lock(m_mutex);
+    // Only one upgrade is paved at a time, but paving doesn't hold m_lock: it's
+    // slow, and connection state changes shouldn't wait on it.
+    static Lock paveLock("UpgradePave");
+    AutoLock paveAutoLock(paveLock);
 
     // Find current process binary path
 
@@ -940,21 +2175,28 @@ void ConnectionManager::PaveUpgrade(const string& download)
     if (!GetModuleFileName(NULL, filename, 1000))
     {
         // Abort upgrade
-        return;
+        return false;
     }
 
-    // Rename current binary to archive name
+    tstring tempFilename(filename);
+    tempFilename += _T(".new");
 
     tstring archive_filename(filename);
     archive_filename += _T(".orig");
 
+    // Paving shouldn't compete with the tunnel for the disk.
+    ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
     bool bArchiveCreated = false;
 
     try
     {
+        writeNewVersion(filename, tempFilename);
+
         // We can't delete/modify the binary for a running Windows process,
         // so instead we move the running binary to an archive filename and
-        // write the new version to the original filename.
+        // move the new version to the original filename. The new version is
+        // complete before the running one is touched.
 
         if (!DeleteFile(archive_filename.c_str()) && GetLastError() != ERROR_FILE_NOT_FOUND)
         {
@@ -968,25 +2210,9 @@ void ConnectionManager::PaveUpgrade(const string& download)
 
         bArchiveCreated = true;
 
-        // Write new version to current binary file name
-
-        AutoHANDLE file = CreateFile(filename, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
-
-        if (file == INVALID_HANDLE_VALUE)
-        {
-            throw std::exception("Upgrade - CreateFile failed");
-        }
-
-        DWORD written;
-
-        if (!WriteFile(file, download.c_str(), download.length(), &written, NULL) || written != download.length())
-        {
-            throw std::exception("Upgrade - WriteFile failed");
-        }
-
-        if (!FlushFileBuffers(file))
+        if (!MoveFileEx(tempFilename.c_str(), filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
         {
-            throw std::exception("Upgrade - FlushFileBuffers failed");
+            throw std::exception("Upgrade - MoveFileEx failed");
         }
     }
     catch (std::exception& ex)
@@ -998,14 +2224,18 @@ void ConnectionManager::PaveUpgrade(const string& download)
         // Try to restore the original version
         if (bArchiveCreated)
         {
-            CopyFile(archive_filename.c_str(), filename, FALSE);
+            MoveFileEx(archive_filename.c_str(), filename, MOVEFILE_REPLACE_EXISTING);
         }
 
+        DeleteFile(tempFilename.c_str());
+
         // Abort upgrade
-        return;
+        return false;
     }
 
+    AutoLock lock(m_lock);
     m_upgradePending = true;
+    return true;
 }
 
 psicash::Authorizations ConnectionManager::GetAuthorizations() const
@@ -1049,33 +2279,31 @@ void ConnectionManager::ActiveAuthorizationIDs(
     UI_RefreshPsiCash("");
 }
 
-// Makes a thread-safe copy of m_currentSessionInfo
-void ConnectionManager::CopyCurrentSessionInfo(SessionInfo& sessionInfo)
+shared_ptr<const SessionInfo> ConnectionManager::GetCurrentSessionInfo() const
 {
-    AutoMUTEX lock(m_mutex);
-    sessionInfo = m_currentSessionInfo;
+    // No lock: a reader just takes a reference to the current snapshot
+    return atomic_load(&m_currentSessionInfo);
 }
 
-// Makes a thread-safe copy of m_currentSessionInfo
-void ConnectionManager::UpdateCurrentSessionInfo(const SessionInfo& sessionInfo)
+void ConnectionManager::UpdateCurrentSessionInfo(const shared_ptr<const SessionInfo>& sessionInfo)
 {
-    AutoMUTEX lock(m_mutex);
-    m_currentSessionInfo = sessionInfo;
+    AutoLock lock(m_lock);
+    atomic_store(&m_currentSessionInfo, sessionInfo);
 
     try
     {
         // CoreTransport does not provide a ServerEntry, but VPNTransport does.
-        if (m_currentSessionInfo.HasServerEntry())
+        if (sessionInfo->HasServerEntry())
         {
-            const auto& currentServerEntry = m_currentSessionInfo.GetServerEntry();
+            const auto& currentServerEntry = sessionInfo->GetServerEntry();
             TransportRegistry::AddServerEntries(
-                m_currentSessionInfo.GetDiscoveredServerEntries(),
+                sessionInfo->GetDiscoveredServerEntries(),
                 &currentServerEntry);
         }
         else
         {
             TransportRegistry::AddServerEntries(
-                m_currentSessionInfo.GetDiscoveredServerEntries(),
+                sessionInfo->GetDiscoveredServerEntries(),
                 nullptr);
         }
     }
@@ -1100,14 +2328,12 @@ void ConnectionManager::SendFeedback(LPCWSTR unicodeFeedbackJSON)
     if (!m_feedbackThread ||
         WAIT_OBJECT_0 == WaitForSingleObject(m_feedbackThread, 0))
     {
-        m_feedbackThread = CreateThread(
-            0,
-            0,
+        m_feedbackThread = ThreadPool::Instance().Run(
             ConnectionManager::ConnectionManagerFeedbackThread,
-            (void*)&g_feedbackThreadData, 0, 0);
+            (void*)&g_feedbackThreadData);
         if (!m_feedbackThread)
         {
-            my_print(NOT_SENSITIVE, false, _T("%s: CreateThread failed (%d)"), __TFUNCTION__, GetLastError());
+            my_print(NOT_SENSITIVE, false, _T("%s: ThreadPool::Run failed (%d)"), __TFUNCTION__, GetLastError());
             PostMessage(g_hWnd, WM_PSIPHON_FEEDBACK_FAILED, 0, 0);
             return;
         }
@@ -1120,6 +2346,9 @@ DWORD WINAPI ConnectionManager::ConnectionManagerFeedbackThread(void* object)
 
     FeedbackThreadData* data = (FeedbackThreadData*)object;
 
+    // Assembling the diagnostics is heavy, and the user doesn't wait on it.
+    ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
     try
     {
         if (data->connectionManager->DoSendFeedback(data->feedbackJSON.c_str()))
@@ -1144,12 +2373,7 @@ bool ConnectionManager::DoSendFeedback(LPCWSTR feedbackJSON)
 {
     // NOTE: no lock while waiting for network events
 
-    // Make a copy of SessionInfo for threadsafety.
-    SessionInfo sessionInfo;
-    {
-        AutoMUTEX lock(m_mutex);
-        sessionInfo = m_currentSessionInfo;
-    }
+    shared_ptr<const SessionInfo> sessionInfo = GetCurrentSessionInfo();
 
     string narrowFeedbackJSON = WStringToUTF8(feedbackJSON);
     Json::Value json_entry;
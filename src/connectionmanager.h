@@ -20,10 +20,12 @@
 #pragma once
 
 #include <time.h>
+#include <functional>
 #include "sessioninfo.h"
 #include "psiclient.h"
 #include "local_proxy.h"
 #include "transport.h"
+#include "reconnect_scheduler.h"
 
 
 class ITransport;
@@ -38,6 +40,12 @@ enum ConnectionManagerState
 };
 
 
+// Called on the main window thread after the connection state changes.
+// Changes are coalesced: a burst of them is delivered once, as the state at
+// the time of delivery, so an observer may not see every state passed through.
+typedef std::function<void(ConnectionManagerState)> ConnectionStateObserver;
+
+
 class ConnectionManager :
     public ILocalProxyStatsCollector, public IReconnectStateReceiver,
     public IUpgradePaver, public IAuthorizationsProvider
@@ -50,11 +58,27 @@ public:
     void Stop(DWORD reason);
     void Start(bool isReconnect=false);
     void Reconnect(bool suppressHomePages);
+    // Applies changes to the tunnel's configuration -- settings (see
+    // SETTINGS_CHANGE_TUNNEL) or new PsiCash authorizations -- by restarting
+    // the tunnel in place: unlike Reconnect, the connection thread and
+    // transport are kept, the retry doesn't wait, and the system proxy
+    // settings are held if the local ports are unchanged.
+    void RestartTunnel(bool suppressHomePages);
     void SetState(ConnectionManagerState newState);
     ConnectionManagerState GetState();
 
+    // Observers must be added on the main window thread, before connecting.
+    void AddStateObserver(const ConnectionStateObserver& observer);
+    // Called on the main window thread, for
+    // WM_PSIPHON_CONNECTION_STATE_CHANGED; calls the observers if the state
+    // has changed since they were last called.
+    void DeliverStateChange();
+
     /// reason will be included in the URL with no escaping, so it must be simple ASCII.
     void OpenHomePages(const string& reason, const TCHAR* defaultHomePage=0);
+    // When disabled (e.g., in headless mode), home pages are never opened on
+    // connect. Set before connecting.
+    void SetHomePagesDisabled(bool disabled);
 
     // IReconnectStateReceiver implementation
     virtual void SetReconnecting();
@@ -62,16 +86,26 @@ public:
 
     bool IsWholeSystemTunneled() const;
 
+    // Called on the main window thread as the machine suspends and resumes.
+    // A short sleep just has the tunnel re-validated; after a longer one, the
+    // connection is restarted with the same server first in line, rather
+    // than waiting for the tunnel to time out.
+    void Suspend();
+    void Resume();
+
     // ILocalProxyStatsCollector implementation
     // May throw StopSignal::StopException subclass if not `final`
     virtual bool SendStatusMessage(
             bool final,
-            const map<string, int>& pageViewEntries,
-            const map<string, int>& httpsRequestEntries,
+            const StatsEntryCounts& pageViewEntries,
+            const StatsEntryCounts& httpsRequestEntries,
+            const StatsEntryBytes& pageViewBytes,
+            const StatsEntryBytes& httpsRequestBytes,
             unsigned long long bytesTransferred);
+    virtual bool IsStatusMessageDeferred() const;
 
     // IUpgradePaver implementation
-    void PaveUpgrade(const string& download);
+    bool PaveUpgrade(const string& base64Download);
 
     // IAuthorizationsProvider implementation
     psicash::Authorizations GetAuthorizations() const override;
@@ -91,36 +125,126 @@ private:
     // Exception classes to help with the ConnectionManagerStartThread control flow
     class Abort { };
 
+    // What the connection loop does after a DoConnectAttempt
+    enum ConnectAttemptResult
+    {
+        // The attempt failed, or the tunnel dropped: try again
+        CONNECT_ATTEMPT_RETRY,
+        // There are no servers to try (yet)
+        CONNECT_ATTEMPT_NO_SERVERS,
+        // Stopped, or failed for good: the loop exits
+        CONNECT_ATTEMPT_STOP
+    };
+
+    // One pass of the connection loop: connects, and if that works, waits
+    // for the connection to end. The transports' exceptions are caught and
+    // classified here, so the loop itself is driven by the returned result.
+    ConnectAttemptResult DoConnectAttempt(bool& io_homePageOpened);
+
+    // Returns true, having set o_result, if the global stop signal is set.
+    // An unexpected disconnect alone is cleared and retried.
+    static bool CheckStopped(ConnectAttemptResult& o_result);
+
+    // Puts the transport and server of the last connection that worked --
+    // most users connect to the same server day after day -- first in line,
+    // so it's tried before the rest of the search.
+    void ApplyLastGoodConnection();
+
     // Throws StopSignal::StopException if stop was signaled.
     void DoPostConnect(const SessionInfo& sessionInfo, bool openHomePages);
 
+    // Called when TunnelQuality finds the tunnel to degradedSession's server
+    // degraded. Brings up a temp tunnel to the next-best scored server and,
+    // if that works, reconnects with that server preferred.
+    void SwitchServerForQuality(
+            shared_ptr<const SessionInfo> degradedSession,
+            const tstring& transportProtocolName,
+            unsigned int requiredServerCapabilities);
+
     tstring GetFailedRequestPath(ITransport* transport);
     tstring GetConnectRequestPath(ITransport* transport);
     // May return empty string, which indicates that status can't be sent.
     tstring GetStatusRequestPath(ITransport* transport, bool connected);
-    void GetUpgradeRequestInfo(SessionInfo& sessionInfo, tstring& requestPath);
-
-    void FetchRemoteServerList();
+    void GetUpgradeRequestInfo(shared_ptr<const SessionInfo>& o_sessionInfo, tstring& requestPath);
+
+    // A pre-emptive fetch is made while connected, through the tunnel,
+    // because the list is running out of servers worth trying.
+    void FetchRemoteServerList(bool preemptive=false);
+    // True if too few of the transport's servers are worth trying.
+    static bool ServerListNeedsRefresh(
+                    const tstring& transportProtocolName,
+                    unsigned int requiredServerCapabilities);
+    // Remembers the last stored remote server list, for conditional fetches.
+    static void StoreRemoteServerListValidators(
+                    const string& etag,
+                    const string& lastModified,
+                    const string& hash);
 
     bool RequireUpgrade();
 
-    void CopyCurrentSessionInfo(SessionInfo& sessionInfo);
-    void UpdateCurrentSessionInfo(const SessionInfo& sessionInfo);
+    // Downloads and paves a delta for this binary, if one's published.
+    // Returns false if the full package is needed.
+    // May throw StopSignal::StopException
+    bool DownloadAndPaveUpgradeDelta();
+    // Upgrades with a binary delta (see upgrade_delta.h) rather than the full
+    // binary. Returns false, having changed nothing, if it doesn't apply.
+    bool PaveUpgradeDelta(const string& delta);
+    // Has writeNewVersion write the new binary to newFilename, and swaps it
+    // in for currentFilename. writeNewVersion throws std::exception on
+    // failure. Returns false if the upgrade wasn't paved.
+    bool PaveUpgradeWith(
+            std::function<void(const tstring& currentFilename, const tstring& newFilename)> writeNewVersion);
+
+    // The current session info snapshot. Never null.
+    shared_ptr<const SessionInfo> GetCurrentSessionInfo() const;
+    void UpdateCurrentSessionInfo(const shared_ptr<const SessionInfo>& sessionInfo);
 
     // May throw StopSignal::StopException
     bool DoSendFeedback(LPCWSTR feedbackJSON);
     static DWORD WINAPI ConnectionManagerFeedbackThread(void* object);
 
 private:
-    HANDLE m_mutex;
+    Lock m_lock;
     ConnectionManagerState m_state;
-    SessionInfo m_currentSessionInfo;
+    // Only touched by the main window thread
+    vector<ConnectionStateObserver> m_stateObservers;
+    ConnectionManagerState m_deliveredState;
+    // Set while a WM_PSIPHON_CONNECTION_STATE_CHANGED is posted and not yet
+    // delivered
+    volatile LONG m_stateChangePosted;
+    // Replaced wholesale, with atomic_store under m_lock; read with
+    // atomic_load, without locking
+    shared_ptr<const SessionInfo> m_currentSessionInfo;
     HANDLE m_thread;
     HANDLE m_upgradeThread;
     HANDLE m_feedbackThread;
     ITransport* m_transport;
+    // Raced against m_transport, if transport racing is enabled. May be NULL.
+    ITransport* m_raceTransport;
     bool m_upgradePending;
     bool m_startSplitTunnel;
     time_t m_nextFetchRemoteServerListAttempt;
+    time_t m_lastFetchRemoteServerListAttempt;
+    // Set while a fetch is in progress, so that one made pre-emptively and
+    // one made after a failure don't overlap
+    bool m_fetchingRemoteServerList;
     bool m_suppressHomePages;
+    bool m_homePagesDisabled;
+    // Set while Reconnect is stopping and restarting, so that Stop doesn't
+    // discard the resident core process.
+    bool m_keepCoreResident;
+    // Set between Suspend and Resume
+    volatile LONG m_suspended;
+    DWORD m_suspendTime;
+    // Set to a RESTART_TUNNEL_* value by Resume and RestartTunnel when they
+    // restart the connection, so the connection thread retries at once
+    volatile LONG m_restartTunnel;
+    // When the transport last said it was reconnecting, or 0 if it's not.
+    // Only touched by the transport's reconnect state calls, which it makes
+    // one at a time, and by Start once the last transport has stopped.
+    unsigned long long m_reconnectStartTime;
+    // Only used by the connection thread. It's a member, rather than local
+    // to the thread, because it must outlive any pending address change
+    // notification; see ~ReconnectScheduler.
+    ReconnectScheduler m_reconnectScheduler;
 };
@@ -20,6 +20,7 @@
 #include "stdafx.h"
 #include <shlwapi.h>
 #pragma comment(lib,"shlwapi.lib")
+#include <unordered_set>
 
 #include "logging.h"
 #include "coretransport.h"
@@ -32,6 +33,9 @@
 #include "embeddedvalues.h"
 #include "utilities.h"
 #include "authenticated_data_package.h"
+#include "tunnel_metrics.h"
+#include "transport_benchmark.h"
+#include "scripted_core.h"
 
 using namespace std::experimental;
 
@@ -42,23 +46,106 @@ using namespace std::experimental;
 #define URL_PROXY_EXE_NAME                   _T("psiphon-url-proxy.exe")
 #define MAX_LEGACY_SERVER_ENTRIES            30
 #define LEGACY_SERVER_ENTRY_LIST_NAME        (string(LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS) + "OSSH").c_str()
+#define PIPE_READ_BUFFER_SIZE                16384
+#define REPORTED_UNTUNNELED_ADDRESSES_CAPACITY 1024
+// All core activity is signalled through the pipe and process handles, so
+// this is only a backstop
+#define PERIODIC_CHECK_INTERVAL_MS           1000
+// Once the core has gone quiet (no traffic, so no BytesTransferred notices)
+#define IDLE_PERIODIC_CHECK_INTERVAL_MS      10000
+// How long the core process gets to exit on its own when stopped
+#define GRACEFUL_STOP_TIMEOUT_MS             2000
+// More concurrent URL proxies than this get a throwaway temp datastore
+#define URL_PROXY_DATASTORE_SLOTS            4
+// The first candidates the core tries are limited to the protocols that
+// benchmarked best, if there are fresh results; then it tries them all.
+#define BENCHMARK_PREFERRED_CANDIDATE_COUNT  10
+// A dial pending for longer than this has failed: it's past the core's
+// tunnel connect timeout, with room for the handshake
+#define PENDING_DIAL_FAILED_MS               30000
 
 
 /******************************************************************************
  CoreTransport
 ******************************************************************************/
 
+// Persistent-core mode state; see CoreTransport::SetKeepResidentOnStop.
+// Only touched while ConnectionManager is stopping or starting a connection,
+// which never overlap, so there's no lock.
+struct ResidentCoreProcess
+{
+    ResidentCoreProcess()
+        : pipe(NULL), localSocksProxyPort(0), localHttpProxyPort(0)
+    {
+        ZeroMemory(&processInfo, sizeof(processInfo));
+    }
+
+    PROCESS_INFORMATION processInfo;
+    HANDLE pipe;
+    // Core output that was read but not yet handled
+    string pipeBuffer;
+    string configFileContents;
+    int localSocksProxyPort;
+    int localHttpProxyPort;
+    vector<tstring> homepages;
+};
+
+static bool s_keepResidentOnStop = false;
+// Heap-allocated so that it's unaffected by static destruction order
+// (ConnectionManager is a global too).
+static ResidentCoreProcess* s_residentCore = NULL;
+
+// URL proxy cores may run concurrently with the main core and with each
+// other, so each needs its own datastore. Each leases one of a few slots,
+// whose datastore directory and config file are kept and reused by the next
+// URL proxy, so that tunnel-core doesn't have to create a fresh datastore
+// every time.
+static Lock s_urlProxySlotsLock("UrlProxySlots");
+static bool s_urlProxySlotsLeased[URL_PROXY_DATASTORE_SLOTS] = { false };
+
+// Returns -1 if all the slots are in use.
+static int LeaseUrlProxySlot()
+{
+    AutoLock lock(s_urlProxySlotsLock);
+    for (int slot = 0; slot < URL_PROXY_DATASTORE_SLOTS; slot++)
+    {
+        if (!s_urlProxySlotsLeased[slot])
+        {
+            s_urlProxySlotsLeased[slot] = true;
+            return slot;
+        }
+    }
+    return -1;
+}
+
+static void ReleaseUrlProxySlot(int slot)
+{
+    AutoLock lock(s_urlProxySlotsLock);
+    s_urlProxySlotsLeased[slot] = false;
+}
+
+
 CoreTransport::CoreTransport()
     : ITransport(CORE_TRANSPORT_PROTOCOL_NAME),
       m_pipe(NULL),
+      m_pipeReadPending(false),
+      m_pipeReadBuffer(PIPE_READ_BUFFER_SIZE),
+      m_lastOutputTime(GetTickCount()),
       m_localSocksProxyPort(AUTOMATICALLY_ASSIGNED_PORT_NUMBER),
       m_localHttpProxyPort(AUTOMATICALLY_ASSIGNED_PORT_NUMBER),
       m_hasEverConnected(false),
       m_isConnected(false),
       m_clientUpgradeDownloadHandled(false),
-      m_panicked(false)
+      m_panicked(false),
+      m_reportedUntunneledAddresses(REPORTED_UNTUNNELED_ADDRESSES_CAPACITY),
+      m_allowPark(true),
+      m_tunnelPoolSize(1),
+      m_tunnelCount(0),
+      m_urlProxySlot(-1)
 {
     ZeroMemory(&m_processInfo, sizeof(m_processInfo));
+    ZeroMemory(&m_pipeOverlapped, sizeof(m_pipeOverlapped));
+    m_pipeOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
 }
 
 
@@ -66,11 +153,15 @@ CoreTransport::~CoreTransport()
 {
     (void)Cleanup();
     IWorkerThread::Stop();
+    CloseHandle(m_pipeOverlapped.hEvent);
 }
 
 
 bool CoreTransport::Cleanup()
 {
+    // In persistent-core mode, this leaves m_processInfo and m_pipe empty
+    (void)ParkCoreProcess();
+
      // Give the process an opportunity for graceful shutdown, then terminate
     if (m_processInfo.hProcess != 0
         && m_processInfo.hProcess != INVALID_HANDLE_VALUE)
@@ -80,21 +171,48 @@ bool CoreTransport::Cleanup()
         // Allows up to 2 seconds for core process to gracefully shutdown.
         // This gives it an opportunity to send final status requests, and
         // to persist tunnel stats that cannot yet be reported.
-        // While waiting, continue to consume core process output.
+        // While waiting, continue to consume core process output -- waking
+        // for it, or for the exit, rather than polling.
         // TODO: AttachConsole/FreeConsole sequence not threadsafe?
         if (AttachConsole(m_processInfo.dwProcessId))
         {
             GenerateConsoleCtrlEvent(CTRL_BREAK_EVENT, m_processInfo.dwProcessId);
             FreeConsole();
 
-            for (int i = 0; i < 2000; i += 10)
+            DWORD start = GetTickCount();
+            while (true)
             {
                 ConsumeCoreProcessOutput();
-                if (WAIT_OBJECT_0 == WaitForSingleObject(m_processInfo.hProcess, 10))
+
+                DWORD elapsed = GetTickCount() - start;
+                if (elapsed >= GRACEFUL_STOP_TIMEOUT_MS)
+                {
+                    break;
+                }
+
+                HANDLE waitHandles[2];
+                DWORD waitHandlesCount = 0;
+                waitHandles[waitHandlesCount++] = m_processInfo.hProcess;
+                if (m_pipeReadPending)
+                {
+                    waitHandles[waitHandlesCount++] = m_pipeOverlapped.hEvent;
+                }
+
+                DWORD result = WaitForMultipleObjects(
+                                waitHandlesCount,
+                                waitHandles,
+                                FALSE, // wait for any
+                                GRACEFUL_STOP_TIMEOUT_MS - elapsed);
+                if (result == WAIT_OBJECT_0)
                 {
                     stoppedGracefully = true;
                     break;
                 }
+                else if (result != WAIT_OBJECT_0 + 1)
+                {
+                    // Timed out (or failed)
+                    break;
+                }
             }
         }
         if (!stoppedGracefully)
@@ -117,6 +235,14 @@ bool CoreTransport::Cleanup()
     if (m_pipe!= 0
         && m_pipe != INVALID_HANDLE_VALUE)
     {
+        if (m_pipeReadPending)
+        {
+            // The read buffer must outlive the read. The core process is gone
+            // by now, so the read completes (with ERROR_BROKEN_PIPE) promptly.
+            CancelIo(m_pipe);
+            WaitForSingleObject(m_pipeOverlapped.hEvent, TERMINATE_PROCESS_WAIT_MS);
+            m_pipeReadPending = false;
+        }
         CloseHandle(m_pipe);
     }
     m_pipe = NULL;
@@ -124,6 +250,19 @@ bool CoreTransport::Cleanup()
 
     m_hasEverConnected = false;
     m_isConnected = false;
+    m_tunnelCount = 0;
+    m_reportedUntunneledAddresses.Clear();
+
+    // Dials still pending now were either cancelled or had already failed.
+    RecordServerEstablishments();
+    m_pendingDials.clear();
+
+    // The core process is gone, so its datastore can be used by another.
+    if (m_urlProxySlot >= 0)
+    {
+        ReleaseUrlProxySlot(m_urlProxySlot);
+        m_urlProxySlot = -1;
+    }
 
     return true;
 }
@@ -141,7 +280,8 @@ void CoreTransport::GetFactory(
                     tstring& o_transportDisplayName,
                     tstring& o_transportProtocolName,
                     TransportFactoryFn& o_transportFactoryFn,
-                    AddServerEntriesFn& o_addServerEntriesFn)
+                    AddServerEntriesFn& o_addServerEntriesFn,
+                    bool& o_handshakeRequired)
 {
     o_transportFactoryFn = NewCoreTransport;
     o_transportDisplayName = CORE_TRANSPORT_DISPLAY_NAME;
@@ -150,6 +290,7 @@ void CoreTransport::GetFactory(
     // database of entries.
     // TODO: add code to harvest these entries?
     o_addServerEntriesFn = ITransport::AddServerEntries;
+    o_handshakeRequired = false;
 }
 
 
@@ -208,6 +349,35 @@ bool CoreTransport::ServerHasCapabilities(const ServerEntry& entry) const
 }
 
 
+vector<string> CoreTransport::GetTunnelProtocols(const ServerEntry& serverEntry) const
+{
+    // The core's names for them, for LimitTunnelProtocols
+    static const pair<const char*, unsigned int> protocols[] = {
+        { "OSSH", SERVER_CAPABILITY_OSSH },
+        { "SSH", SERVER_CAPABILITY_SSH },
+        { "UNFRONTED-MEEK-OSSH", SERVER_CAPABILITY_UNFRONTED_MEEK },
+        { "UNFRONTED-MEEK-HTTPS-OSSH", SERVER_CAPABILITY_UNFRONTED_MEEK_HTTPS },
+        { "FRONTED-MEEK-OSSH", SERVER_CAPABILITY_FRONTED_MEEK }
+    };
+
+    vector<string> supported;
+    for (const auto& protocol : protocols)
+    {
+        if (serverEntry.HasCapabilities(protocol.second))
+        {
+            supported.push_back(protocol.first);
+        }
+    }
+    return supported;
+}
+
+
+void CoreTransport::SetTempTunnelProtocol(const string& protocol)
+{
+    m_tempTunnelProtocol = protocol;
+}
+
+
 bool CoreTransport::RequiresStatsSupport() const
 {
     return false;
@@ -279,6 +449,8 @@ void CoreTransport::TransportConnectHelper()
         throw TransportFailed();
     }
 
+    ConnectTimingMark("ParameterFilesWritten");
+
     // Once a new upgrade has been paved, CoreTransport should never restart without the actual application restarting.
     // If there is a pending upgrade, when disconnect/connect is pressed (or a new region is chosen, upstream proxy settings change, etc.)
     // the application is killed and relaunched with the new image. The upgrade package is not immediately deleted on a successful pave
@@ -297,13 +469,17 @@ void CoreTransport::TransportConnectHelper()
         }
     }
 
-    // Run core process; it will begin establishing a tunnel
+    // Run core process; it will begin establishing a tunnel.
+    // In persistent-core mode, there may already be one we can use.
 
-    if (!SpawnCoreProcess(configFilename, serverListFilename))
+    if (!AdoptResidentCoreProcess()
+        && !SpawnCoreProcess(configFilename, serverListFilename))
     {
         throw TransportFailed();
     }
 
+    ConnectTimingMark("CoreProcessStarted");
+
     // Wait and poll for first active tunnel (or stop signal)
 
     while (true)
@@ -324,7 +500,11 @@ void CoreTransport::TransportConnectHelper()
             break;
         }
 
-        Sleep(100);
+        // Wakes as soon as there's output to handle (or the process dies)
+        // Wakes for core output, core process exit, or a stop signal
+        vector<HANDLE> waitHandles;
+        GetWaitHandles(waitHandles);
+        WaitForEvents(waitHandles, GetPeriodicCheckInterval());
     }
 
     m_systemProxySettings->SetSocksProxyPort(m_localSocksProxyPort);
@@ -367,6 +547,27 @@ Json::Value loadJSONArray(const char* jsonArrayString)
 }
 
 
+// The configured local proxy port, or 0 -- for the core to choose one -- if
+// something else is already listening on it. Otherwise the core only finds
+// out once it's started (see HandleSocksProxyPortInUseNotice), and the whole
+// connect attempt is lost. The resident core's port is its own, so it's kept.
+static unsigned int AvailableLocalProxyPort(unsigned int configuredPort, int residentCorePort, LPCTSTR proxyName)
+{
+    if (configuredPort == 0 || (int)configuredPort == residentCorePort)
+    {
+        return configuredPort;
+    }
+
+    int port = (int)configuredPort;
+    if (TestForOpenPort(port, 0, StopInfo()))
+    {
+        return configuredPort;
+    }
+
+    my_print(NOT_SENSITIVE, false, _T("%s proxy port %d is in use; using another."), proxyName, configuredPort);
+    return 0;
+}
+
 bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& serverListFilename, tstring& oldClientUpgradeFilename, tstring& newClientUpgradeFilename)
 {
     tstring dataStoreDirectory;
@@ -401,6 +602,10 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
     config["EmitDiagnosticNotices"] = true;
     config["EmitDiagnosticNetworkParameters"] = true;
     config["EmitServerAlerts"] = true;
+    // For the live metrics; temp tunnels aren't counted.
+    config["EmitBytesTransferred"] = (m_tempConnectServerEntry == 0);
+    // Set below for a full connection
+    m_tunnelPoolSize = 1;
 
     // Don't use an upstream proxy when in VPN mode. If the proxy is on a private network,
     // we may not be able to route to it. If the proxy is on a public network we prefer not
@@ -446,13 +651,14 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
     // although in this case we don't set a deadline to connect since we don't
     // expect to ever connect to a tunnel and we we want to allow the caller to
     // complete the (direct) url proxied request
+    // Holds the URL proxy's datastore and config file
+    tstring urlProxyDirectory;
+
     if (m_tempConnectServerEntry != 0 || RequestingUrlProxyWithoutTunnel())
     {
         config["DisableApi"] = true;
         config["DisableRemoteServerListFetcher"] = true;
-        string serverEntry = m_tempConnectServerEntry->ToString();
-        config["TargetServerEntry"] =
-            Hexlify((const unsigned char*)(serverEntry.c_str()), serverEntry.length());
+        config["TargetServerEntry"] = m_tempConnectServerEntry->ToHexString();
         // Use whichever region the server entry is located in
         config["EgressRegion"] = "";
 
@@ -462,10 +668,26 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
             // and multiple URL proxies might be used concurrently. Each one may/will
             // try to open/create the tunnel-core datastore, so conflicts will occur
             // if they try to use the same datastore directory as the main tunnel or
-            // as each other. So we'll give each one a unique, temporary directory.
+            // as each other. So we'll give each one its own directory: a leased
+            // slot (see LeaseUrlProxySlot), or if they're all in use, a unique,
+            // temporary directory.
 
-            tstring tempDir;
-            if (!GetUniqueTempDir(tempDir, true))
+            if (m_urlProxySlot < 0)
+            {
+                m_urlProxySlot = LeaseUrlProxySlot();
+            }
+
+            if (m_urlProxySlot >= 0)
+            {
+                tstringstream slotName;
+                slotName << m_urlProxySlot;
+                if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY, _T("UrlProxy"), slotName.str() }, true, urlProxyDirectory))
+                {
+                    my_print(NOT_SENSITIVE, false, _T("%s - GetDataPath failed for URL proxy slot (%d)"), __TFUNCTION__, GetLastError());
+                    return false;
+                }
+            }
+            else if (!GetUniqueTempDir(urlProxyDirectory, true))
             {
                 my_print(NOT_SENSITIVE, false, _T("%s - GetUniqueTempDir failed (%d)"), __TFUNCTION__, GetLastError());
                 return false;
@@ -474,19 +696,26 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
             // Passing short path names for data store directories due to sqlite3 incompatibility
             // with extended Unicode characters in paths (e.g., unicode user name in AppData or
             // Temp path).
-            tstring shortTempDir;
-            if (!GetShortPathName(tempDir, shortTempDir))
+            tstring shortUrlProxyDirectory;
+            if (!GetShortPathName(urlProxyDirectory, shortUrlProxyDirectory))
             {
                 my_print(NOT_SENSITIVE, false, _T("%s - GetShortPathName failed (%d)"), __TFUNCTION__, GetLastError());
                 return false;
             }
 
-            config["DataRootDirectory"] = WStringToUTF8(shortTempDir);
-            config["MigrateDataStoreDirectory"] = WStringToUTF8(shortTempDir);
+            config["DataRootDirectory"] = WStringToUTF8(shortUrlProxyDirectory);
+            config["MigrateDataStoreDirectory"] = WStringToUTF8(shortUrlProxyDirectory);
         }
         else
         {
             config["EstablishTunnelTimeoutSeconds"] = TEMPORARY_TUNNEL_TIMEOUT_SECONDS;
+
+            if (!m_tempTunnelProtocol.empty())
+            {
+                Json::Value limitTunnelProtocols(Json::arrayValue);
+                limitTunnelProtocols.append(m_tempTunnelProtocol);
+                config["LimitTunnelProtocols"] = limitTunnelProtocols;
+            }
         }
 
         oldClientUpgradeFilename.clear();
@@ -494,9 +723,32 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
     }
     else
     {
-        config["EgressRegion"] = Settings::EgressRegion();
-        config["LocalHttpProxyPort"] = Settings::LocalHttpProxyPort();
-        config["LocalSocksProxyPort"] = Settings::LocalSocksProxyPort();
+        config["EgressRegion"] = m_serverList.GetEgressRegion();
+        // Only written when it's not the core's default of one tunnel
+        m_tunnelPoolSize = Settings::TunnelPoolSize();
+        if (m_tunnelPoolSize > 1)
+        {
+            config["TunnelPoolSize"] = m_tunnelPoolSize;
+        }
+        vector<string> preferredProtocols = TransportBenchmark::GetPreferredProtocols(CORE_TRANSPORT_PROTOCOL_NAME);
+        if (!preferredProtocols.empty())
+        {
+            Json::Value initialLimitTunnelProtocols(Json::arrayValue);
+            for (const auto& protocol : preferredProtocols)
+            {
+                initialLimitTunnelProtocols.append(protocol);
+            }
+            config["InitialLimitTunnelProtocols"] = initialLimitTunnelProtocols;
+            config["InitialLimitTunnelProtocolsCandidateCount"] = BENCHMARK_PREFERRED_CANDIDATE_COUNT;
+        }
+        config["LocalHttpProxyPort"] = AvailableLocalProxyPort(
+                                            Settings::LocalHttpProxyPort(),
+                                            s_residentCore ? s_residentCore->localHttpProxyPort : 0,
+                                            _T("HTTP"));
+        config["LocalSocksProxyPort"] = AvailableLocalProxyPort(
+                                            Settings::LocalSocksProxyPort(),
+                                            s_residentCore ? s_residentCore->localSocksProxyPort : 0,
+                                            _T("SOCKS"));
 
         auto remoteServerListFilename = filesystem::path(dataStoreDirectory)
                                                     .append(LOCAL_SETTINGS_APPDATA_REMOTE_SERVER_LIST_FILENAME);
@@ -520,21 +772,19 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
         newClientUpgradeFilename = filesystem::path(shortDataStoreDirectory).append(_T("ca.psiphon.PsiphonTunnel.tunnel-core")).append(_T("upgrade"));
     }
 
-    ostringstream configDataStream;
     Json::FastWriter jsonWriter;
-    configDataStream << jsonWriter.write(config);
+    m_configFileContents = jsonWriter.write(config);
 
-    // RequireUrlProxyWithoutTunnel mode has a distinct config file so that
-    // it won't conflict with a standard CoreTransport which may already be
-    // running. Also, this mode omits the server list file, since it's not
-    // trying to establish a tunnel.
-    // TODO: there's still a remote chance that concurrently spawned url
-    // proxy instances could clobber each other's config file?
+    // RequireUrlProxyWithoutTunnel mode has a distinct config file, beside
+    // its own datastore, so that it won't conflict with a standard
+    // CoreTransport which may already be running, or with other URL proxies.
+    // Also, this mode omits the server list file, since it's not trying to
+    // establish a tunnel.
 
     auto configPath = filesystem::path(dataStoreDirectory);
     if (RequestingUrlProxyWithoutTunnel())
     {
-        configPath.append(LOCAL_SETTINGS_APPDATA_URL_PROXY_CONFIG_FILENAME);
+        configPath = filesystem::path(urlProxyDirectory).append(LOCAL_SETTINGS_APPDATA_URL_PROXY_CONFIG_FILENAME);
     }
     else
     {
@@ -542,7 +792,9 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
     }
     configFilename = configPath;
 
-    if (!WriteFile(configFilename, configDataStream.str()))
+    // Both files are usually unchanged from the last connect, and rewriting
+    // them gets them rescanned by antivirus software.
+    if (!WriteFileIfChanged(configFilename, m_configFileContents))
     {
         my_print(NOT_SENSITIVE, false, _T("%s - write config file failed (%d)"), __TFUNCTION__, GetLastError());
         return false;
@@ -554,7 +806,21 @@ bool CoreTransport::WriteParameterFiles(tstring& configFilename, tstring& server
                                           .append(LOCAL_SETTINGS_APPDATA_SERVER_LIST_FILENAME);
         serverListFilename = serverListPath;
 
-        if (!WriteFile(serverListFilename, EMBEDDED_SERVER_LIST))
+        // The core tries its imported servers in the order they're listed
+        // when it has nothing better to go on, so they're listed in our
+        // ranking. The file only changes when the ranking does.
+        string serverList;
+        try
+        {
+            serverList = m_serverList.GetRankedEmbeddedServerList(m_serverList.GetEgressRegion());
+        }
+        catch (std::exception& ex)
+        {
+            my_print(NOT_SENSITIVE, false, string("Ranking server list failed: ") + ex.what());
+            serverList = EMBEDDED_SERVER_LIST;
+        }
+
+        if (!WriteFileIfChanged(serverListFilename, serverList))
         {
             my_print(NOT_SENSITIVE, false, _T("%s - write server list file failed (%d)"), __TFUNCTION__, GetLastError());
             return false;
@@ -597,7 +863,15 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
 
     if (m_exePath.size() == 0)
     {
-        if (RequestingUrlProxyWithoutTunnel())
+        if (ScriptedCore::IsEnabled())
+        {
+            m_exePath = ScriptedCore::GetStandInPath();
+            if (m_exePath.size() == 0)
+            {
+                return false;
+            }
+        }
+        else if (RequestingUrlProxyWithoutTunnel())
         {
             // In RequestingUrlProxyWithoutTunnel mode, we allow for multiple instances
             // so we don't fail extract if the file already exists -- and don't try to
@@ -626,6 +900,11 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
         commandLine << _T(" --serverList \"") << serverListFilename << _T("\"");
     }
 
+    if (ScriptedCore::IsEnabled())
+    {
+        commandLine << ScriptedCore::GetStandInArguments();
+    }
+
     STARTUPINFO startupInfo;
     ZeroMemory(&startupInfo, sizeof(startupInfo));
     startupInfo.cb = sizeof(startupInfo);
@@ -643,7 +922,8 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
             parentInputPipe,
             childStdinPipe,
             startupInfo.hStdOutput,
-            startupInfo.hStdError))
+            startupInfo.hStdError,
+            true)) // overlapped reads
     {
         my_print(NOT_SENSITIVE, false, _T("%s - CreateSubprocessPipes failed (%d)"), __TFUNCTION__, GetLastError());
         return false;
@@ -658,9 +938,9 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
             NULL,
             TRUE, // bInheritHandles
 #ifdef _DEBUG
-            CREATE_NEW_PROCESS_GROUP,
+            CREATE_NEW_PROCESS_GROUP|CREATE_SUSPENDED,
 #else
-            CREATE_NEW_PROCESS_GROUP|CREATE_NO_WINDOW,
+            CREATE_NEW_PROCESS_GROUP|CREATE_NO_WINDOW|CREATE_SUSPENDED,
 #endif
             NULL,
             NULL,
@@ -674,6 +954,17 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
         return false;
     }
 
+    if (!ResumeChildProcessInJob(m_processInfo, m_exePath))
+    {
+        CloseHandle(m_processInfo.hThread);
+        CloseHandle(m_processInfo.hProcess);
+        ZeroMemory(&m_processInfo, sizeof(m_processInfo));
+        CloseHandle(m_pipe);
+        CloseHandle(startupInfo.hStdOutput);
+        CloseHandle(startupInfo.hStdError);
+        return false;
+    }
+
     // Close the unneccesary handles
     CloseHandle(m_processInfo.hThread);
     m_processInfo.hThread = NULL;
@@ -703,54 +994,295 @@ bool CoreTransport::SpawnCoreProcess(const tstring& configFilename, const tstrin
 }
 
 
-void CoreTransport::ConsumeCoreProcessOutput()
+// static
+void CoreTransport::SetKeepResidentOnStop(bool keep)
 {
-    DWORD bytes_avail = 0;
+    s_keepResidentOnStop = keep;
+}
+
 
-    // ReadFile will block forever if there's no data to read, so we need
-    // to check if there's data available to read first.
-    if (!PeekNamedPipe(m_pipe, NULL, 0, NULL, &bytes_avail, NULL))
+// static
+void CoreTransport::DiscardResidentCoreProcess()
+{
+    if (!s_residentCore)
     {
-        my_print(NOT_SENSITIVE, false, _T("%s:%d - PeekNamedPipe failed (%d)"), __TFUNCTION__, __LINE__, GetLastError());
+        return;
     }
 
-    if (bytes_avail <= 0)
+    my_print(NOT_SENSITIVE, true, _T("%s: stopping resident core process (PID %d)"), __TFUNCTION__, s_residentCore->processInfo.dwProcessId);
+
+    // Shut it down the same way as any other, so that it gets a chance to
+    // send its final status requests.
+    CoreTransport transport;
+    transport.m_allowPark = false;
+    transport.TakeResidentCoreProcess();
+    (void)transport.Cleanup();
+}
+
+
+// Moves a healthy, connected core process into s_residentCore instead of
+// letting Cleanup stop it. Returns true if it did.
+bool CoreTransport::ParkCoreProcess()
+{
+    if (!s_keepResidentOnStop
+        || !m_allowPark
+        || !m_isConnected
+        || m_panicked
+        || RequestingUrlProxyWithoutTunnel()
+        || m_configFileContents.empty()
+        || m_processInfo.hProcess == 0
+        || m_processInfo.hProcess == INVALID_HANDLE_VALUE
+        || WAIT_TIMEOUT != WaitForSingleObject(m_processInfo.hProcess, 0))
+    {
+        return false;
+    }
+
+    // There's only room for one
+    DiscardResidentCoreProcess();
+
+    // The outstanding read targets this object's buffer, so finish it here.
+    if (m_pipeReadPending)
+    {
+        CancelIo(m_pipe);
+        DWORD numRead = 0;
+        if (GetOverlappedResult(m_pipe, &m_pipeOverlapped, &numRead, TRUE) && numRead > 0)
+        {
+            m_pipeBuffer.append(&m_pipeReadBuffer[0], numRead);
+        }
+        m_pipeReadPending = false;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: leaving core process running (PID %d)"), __TFUNCTION__, m_processInfo.dwProcessId);
+
+    s_residentCore = new ResidentCoreProcess();
+    s_residentCore->processInfo = m_processInfo;
+    s_residentCore->pipe = m_pipe;
+    s_residentCore->pipeBuffer.swap(m_pipeBuffer);
+    s_residentCore->configFileContents = m_configFileContents;
+    s_residentCore->localSocksProxyPort = m_localSocksProxyPort;
+    s_residentCore->localHttpProxyPort = m_localHttpProxyPort;
+    s_residentCore->homepages = m_sessionInfo.GetHomepages();
+
+    ZeroMemory(&m_processInfo, sizeof(m_processInfo));
+    m_pipe = NULL;
+
+    return true;
+}
+
+
+// Takes over the resident core process if it was started with the config
+// that WriteParameterFiles just wrote, and is still running. Otherwise
+// discards it. Returns true if it was taken over.
+bool CoreTransport::AdoptResidentCoreProcess()
+{
+    if (!s_residentCore)
+    {
+        return false;
+    }
+
+    if (s_residentCore->configFileContents != m_configFileContents
+        || WAIT_TIMEOUT != WaitForSingleObject(s_residentCore->processInfo.hProcess, 0))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: resident core process can't be reused"), __TFUNCTION__);
+        DiscardResidentCoreProcess();
+        return false;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: reusing core process (PID %d)"), __TFUNCTION__, s_residentCore->processInfo.dwProcessId);
+
+    TakeResidentCoreProcess();
+
+    // It's been connected all along
+    m_isConnected = true;
+    m_hasEverConnected = true;
+
+    // Handle whatever it said while it was parked
+    string pendingOutput;
+    pendingOutput.swap(m_pipeBuffer);
+    HandleCoreProcessOutput(pendingOutput.data(), pendingOutput.length());
+
+    return true;
+}
+
+
+void CoreTransport::TakeResidentCoreProcess()
+{
+    assert(s_residentCore);
+    assert(m_processInfo.hProcess == 0);
+    assert(m_pipe == NULL);
+
+    m_processInfo = s_residentCore->processInfo;
+    m_pipe = s_residentCore->pipe;
+    m_pipeBuffer.swap(s_residentCore->pipeBuffer);
+    m_localSocksProxyPort = s_residentCore->localSocksProxyPort;
+    m_localHttpProxyPort = s_residentCore->localHttpProxyPort;
+    for (const auto& homepage : s_residentCore->homepages)
+    {
+        m_sessionInfo.SetHomepage(WStringToUTF8(homepage).c_str());
+    }
+
+    delete s_residentCore;
+    s_residentCore = NULL;
+}
+
+
+void CoreTransport::ConsumeCoreProcessOutput()
+{
+    // Bound the work done per call so a chatty core can't starve the caller.
+    const int MAX_READS_PER_CALL = 16;
+
+    if (m_pipe == NULL || m_pipe == INVALID_HANDLE_VALUE)
     {
         return;
     }
 
-    // If there's data available from the pipe, process it.
-    char* buffer = new char[bytes_avail+1];
-    DWORD num_read = 0;
-    if (!ReadFile(m_pipe, buffer, bytes_avail, &num_read, NULL))
+    for (int reads = 0; reads < MAX_READS_PER_CALL; reads++)
     {
-        my_print(NOT_SENSITIVE, false, _T("%s:%d - ReadFile failed (%d)"), __TFUNCTION__, __LINE__, GetLastError());
+        if (m_pipeReadPending)
+        {
+            DWORD numRead = 0;
+            if (!GetOverlappedResult(m_pipe, &m_pipeOverlapped, &numRead, FALSE))
+            {
+                DWORD lastError = GetLastError();
+                if (lastError == ERROR_IO_INCOMPLETE)
+                {
+                    // Nothing more to read yet
+                    return;
+                }
+
+                m_pipeReadPending = false;
+
+                // ERROR_BROKEN_PIPE is expected when the core process exits
+                if (lastError != ERROR_BROKEN_PIPE)
+                {
+                    my_print(NOT_SENSITIVE, false, _T("%s:%d - GetOverlappedResult failed (%d)"), __TFUNCTION__, __LINE__, lastError);
+                }
+                return;
+            }
+
+            m_pipeReadPending = false;
+
+            HandleCoreProcessOutput(&m_pipeReadBuffer[0], numRead);
+        }
+
+        // Start the next read. Whether it completes immediately or not, the
+        // result is collected via GetOverlappedResult above.
+        ResetEvent(m_pipeOverlapped.hEvent);
+        if (!ReadFile(m_pipe, &m_pipeReadBuffer[0], m_pipeReadBuffer.size(), NULL, &m_pipeOverlapped)
+            && GetLastError() != ERROR_IO_PENDING)
+        {
+            DWORD lastError = GetLastError();
+            if (lastError != ERROR_BROKEN_PIPE)
+            {
+                my_print(NOT_SENSITIVE, false, _T("%s:%d - ReadFile failed (%d)"), __TFUNCTION__, __LINE__, lastError);
+            }
+            return;
+        }
+
+        m_pipeReadPending = true;
     }
-    buffer[bytes_avail] = '\0';
+}
 
+void CoreTransport::HandleCoreProcessOutput(const char* data, size_t length)
+{
     // Don't assume we receive complete lines in a read: "Data is written to an anonymous pipe
     // as a stream of bytes. This means that the parent process reading from a pipe cannot
     // distinguish between the bytes written in separate write operations, unless both the
     // parent and child processes use a protocol to indicate where the write operation ends."
     // http://msdn.microsoft.com/en-us/library/windows/desktop/aa365782%28v=vs.85%29.aspx
 
-    m_pipeBuffer.append(buffer);
+    m_pipeBuffer.append(data, length);
+    m_lastOutputTime = GetTickCount();
 
-    int start = 0;
+    // Lines are terminated in place and handled directly out of the buffer;
+    // only the trailing partial line (if any) is kept.
+    size_t start = 0;
     while (true)
     {
-        int end = m_pipeBuffer.find("\n", start);
+        size_t end = m_pipeBuffer.find('\n', start);
         if (end == string::npos)
         {
-            m_pipeBuffer = m_pipeBuffer.substr(start);
             break;
         }
-        string line = m_pipeBuffer.substr(start, end - start);
-        HandleCoreProcessOutputLine(line.c_str());
+        m_pipeBuffer[end] = '\0';
+        HandleCoreProcessOutputLine(m_pipeBuffer.c_str() + start);
         start = end + 1;
     }
 
-    delete buffer;
+    m_pipeBuffer.erase(0, start);
+}
+
+void CoreTransport::GetWaitHandles(vector<HANDLE>& o_handles)
+{
+    // A completed read leaves the event set until ConsumeCoreProcessOutput
+    // starts the next one; a dead process makes DoPeriodicCheck return false.
+    if (m_pipeReadPending)
+    {
+        o_handles.push_back(m_pipeOverlapped.hEvent);
+    }
+    if (m_processInfo.hProcess != 0 && m_processInfo.hProcess != INVALID_HANDLE_VALUE)
+    {
+        o_handles.push_back(m_processInfo.hProcess);
+    }
+}
+
+DWORD CoreTransport::GetPeriodicCheckInterval() const
+{
+    return IdleAwareInterval(
+            m_lastOutputTime,
+            PERIODIC_CHECK_INTERVAL_MS,
+            IDLE_PERIODIC_CHECK_INTERVAL_MS);
+}
+
+/*
+The core announces a downloaded upgrade every time it starts, until we delete
+the package, and verifying it means inflating and hashing megabytes. So once a
+package has been verified and paved, a record of it is kept: its digest and
+what the new binary looked like once in place. If the same package comes up
+while that binary is still there, it's already been dealt with.
+Nothing is taken on trust from the record: a hit only skips work whose result
+is already on disk.
+*/
+
+// Format: "<package SHA-256 hex> <binary size> <binary last write time>"
+static bool IsUpgradeAlreadyPaved(const string& packageDigest)
+{
+    string record;
+    if (!ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_PAVED_UPGRADE, record)) {
+        return false;
+    }
+
+    stringstream stream(record);
+    string digest;
+    ULONGLONG size = 0, lastWriteTime = 0;
+    stream >> digest >> size >> lastWriteTime;
+    if (stream.fail() || digest != packageDigest) {
+        return false;
+    }
+
+    TCHAR filename[1000];
+    ULONGLONG currentSize = 0, currentLastWriteTime = 0;
+    return GetModuleFileName(NULL, filename, 1000)
+           && GetFileSizeAndTime(filename, currentSize, currentLastWriteTime)
+           && currentSize == size
+           && currentLastWriteTime == lastWriteTime;
+}
+
+static void RecordUpgradePaved(const string& packageDigest)
+{
+    TCHAR filename[1000];
+    ULONGLONG size = 0, lastWriteTime = 0;
+    if (!GetModuleFileName(NULL, filename, 1000)
+        || !GetFileSizeAndTime(filename, size, lastWriteTime)) {
+        return;
+    }
+
+    stringstream stream;
+    stream << packageDigest << " " << size << " " << lastWriteTime;
+
+    // Failing just means verifying again next time
+    RegistryFailureReason reason;
+    (void)WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_PAVED_UPGRADE, stream.str(), reason);
 }
 
 bool CoreTransport::ValidateAndPaveUpgrade(const tstring clientUpgradeFilename) {
@@ -769,36 +1301,50 @@ bool CoreTransport::ValidateAndPaveUpgrade(const tstring clientUpgradeFilename)
         my_print(NOT_SENSITIVE, false, _T("%s: Could not get a valid file handle: %d."), __TFUNCTION__, GetLastError());
     }
     else {
+        // The package is mapped rather than read into a buffer, so it doesn't
+        // take up heap alongside the decompressed data.
         DWORD dwFileSize = GetFileSize(hFile, NULL);
-        unique_ptr<BYTE> inBuffer(new BYTE[dwFileSize]);
-        if (!inBuffer) {
+        HANDLE hMapping = (dwFileSize == 0 || dwFileSize == INVALID_FILE_SIZE)
+                            ? NULL
+                            : CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        const char* view = hMapping
+                            ? (const char*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0)
+                            : NULL;
+
+        if (!view) {
             processingSuccessful = false;
-            my_print(NOT_SENSITIVE, false, _T("%s: Could not allocate an input buffer."), __TFUNCTION__);
+            my_print(NOT_SENSITIVE, false, _T("%s: Could not map the file: %d."), __TFUNCTION__, GetLastError());
         }
         else {
-            DWORD dwBytesToRead = dwFileSize;
-            DWORD dwBytesRead = 0;
-            OVERLAPPED stOverlapped = { 0 };
+            string packageDigest = Sha256Hex((const unsigned char*)view, dwFileSize);
             string downloadFileString;
 
-            if (TRUE == ReadFile(hFile, inBuffer.get(), dwBytesToRead, &dwBytesRead, NULL)) {
-                if (verifySignedDataPackage(
-                    UPGRADE_SIGNATURE_PUBLIC_KEY,
-                    (const char *)inBuffer.get(),
-                    dwFileSize,
-                    true, // gzip compressed
-                    downloadFileString))
-                {
-                    // Data in the package is Base64 encoded
-                    downloadFileString = Base64Decode(downloadFileString);
-
-                    if (downloadFileString.length() > 0) {
-                        m_upgradePaver->PaveUpgrade(downloadFileString);
-                    }
-
-                    processingSuccessful = true;
+            if (IsUpgradeAlreadyPaved(packageDigest)) {
+                my_print(NOT_SENSITIVE, true, _T("%s: upgrade package already verified and paved"), __TFUNCTION__);
+                processingSuccessful = true;
+            }
+            else if (verifySignedDataPackage(
+                UPGRADE_SIGNATURE_PUBLIC_KEY,
+                view,
+                dwFileSize,
+                true, // gzip compressed
+                downloadFileString))
+            {
+                // Data in the package is Base64 encoded; it's decoded as
+                // it's paved.
+                if (downloadFileString.length() > 0
+                    && m_upgradePaver->PaveUpgrade(downloadFileString)) {
+                    RecordUpgradePaved(packageDigest);
                 }
+
+                processingSuccessful = true;
             }
+
+            UnmapViewOfFile(view);
+        }
+
+        if (hMapping) {
+            CloseHandle(hMapping);
         }
 
         CloseHandle(hFile);
@@ -822,19 +1368,150 @@ bool CoreTransport::ValidateAndPaveUpgrade(const tstring clientUpgradeFilename)
     return processingSuccessful;
 }
 
+/******************************************************************************
+ Core notice handlers
+******************************************************************************/
+
+// Notices without an entry here are passed to the UI and diagnostics as-is,
+// without being parsed.
+const CoreTransport::NoticeHandlers CoreTransport::s_noticeHandlers = {
+    { "Tunnels", &CoreTransport::HandleTunnelsNotice },
+    { "BytesTransferred", &CoreTransport::HandleBytesTransferredNotice },
+    { "ClientUpgradeDownloaded", &CoreTransport::HandleClientUpgradeDownloadedNotice },
+    { "Homepage", &CoreTransport::HandleHomepageNotice },
+    { "ListeningSocksProxyPort", &CoreTransport::HandleListeningSocksProxyPortNotice },
+    { "ListeningHttpProxyPort", &CoreTransport::HandleListeningHttpProxyPortNotice },
+    { "SocksProxyPortInUse", &CoreTransport::HandleSocksProxyPortInUseNotice },
+    { "HttpProxyPortInUse", &CoreTransport::HandleHttpProxyPortInUseNotice },
+    { "Untunneled", &CoreTransport::HandleUntunneledNotice },
+    { "SplitTunnelRegion", &CoreTransport::HandleSplitTunnelRegionNotice },
+    { "UpstreamProxyError", &CoreTransport::HandleUpstreamProxyErrorNotice },
+    { "AvailableEgressRegions", &CoreTransport::HandleAvailableEgressRegionsNotice },
+    { "ActiveAuthorizationIDs", &CoreTransport::HandleActiveAuthorizationIDsNotice },
+    { "ClientRegion", &CoreTransport::HandleClientRegionNotice },
+    { "TrafficRateLimits", &CoreTransport::HandleTrafficRateLimitsNotice },
+    { "ConnectingServer", &CoreTransport::HandleConnectingServerNotice },
+    { "ActiveTunnel", &CoreTransport::HandleActiveTunnelNotice },
+};
+
+// Extracts the notice type without parsing the whole line. The core emits
+// compact JSON, so the field appears exactly as matched here. Returns false
+// if the line doesn't look like a notice, in which case it must be parsed.
+static bool PeekNoticeType(const char* line, string& o_noticeType)
+{
+    static const char NOTICE_TYPE_FIELD[] = "\"noticeType\":\"";
+
+    if (line[0] != '{')
+    {
+        return false;
+    }
+
+    const char* start = strstr(line, NOTICE_TYPE_FIELD);
+    if (!start)
+    {
+        return false;
+    }
+    start += sizeof(NOTICE_TYPE_FIELD) - 1;
+
+    const char* end = strchr(start, '"');
+    if (!end)
+    {
+        return false;
+    }
+
+    o_noticeType.assign(start, end);
+    return true;
+}
+
+// Reads an unsigned integer field without parsing the whole line. As with
+// PeekNoticeType, this relies on the core's compact output, and the field
+// name must only appear once in the notice. Returns false if it's not found
+// or isn't a plain unsigned integer.
+static bool PeekNoticeUInt64(const char* line, const char* field, unsigned long long& o_value)
+{
+    string pattern = string("\"") + field + "\":";
+
+    const char* start = strstr(line, pattern.c_str());
+    if (!start)
+    {
+        return false;
+    }
+    start += pattern.length();
+
+    if (!isdigit((unsigned char)*start))
+    {
+        return false;
+    }
+
+    char* end = NULL;
+    o_value = _strtoui64(start, &end, 10);
+    return *end == ',' || *end == '}';
+}
+
+// Returns true if a line, trimmed of trailing whitespace, ends like a JSON object.
+static bool LooksLikeCompleteJsonObject(const char* line)
+{
+    size_t length = strlen(line);
+    while (length > 0 && isspace((unsigned char)line[length - 1]))
+    {
+        length--;
+    }
+    return length > 1 && line[0] == '{' && line[length - 1] == '}';
+}
+
 void CoreTransport::HandleCoreProcessOutputLine(const char* line)
 {
     // Notices are logged to diagnostics. Some notices are excluded from
     // diagnostics if they may contain private user data.
     bool logOutputToDiagnostics = true;
 
+    string noticeType;
+    bool peeked = !m_panicked && PeekNoticeType(line, noticeType);
+
+    // Fast path: BytesTransferred comes every second while connected, and
+    // all its handler needs is two counters, so they're read directly.
+    // It's not kept in diagnostics either way (see HandleBytesTransferredNotice).
+    unsigned long long sent = 0, received = 0;
+    if (peeked
+        && noticeType == "BytesTransferred"
+        && LooksLikeCompleteJsonObject(line)
+        && PeekNoticeUInt64(line, "sent", sent)
+        && PeekNoticeUInt64(line, "received", received))
+    {
+        TunnelMetrics::AddTunnelBytes(sent, received);
+        my_print(SENSITIVE_LOG, true, _T("core notice: %S"), line);
+        return;
+    }
+
+    // Fast path: notices that have no handler (most notably the high-volume
+    // Info notices) don't need their body, so they skip the full parse.
+    if (peeked
+        && s_noticeHandlers.find(noticeType) == s_noticeHandlers.end()
+        && LooksLikeCompleteJsonObject(line))
+    {
+        if (noticeType != "Info")
+        {
+            UI_Notice(line);
+        }
+
+        // Debug output, flag sensitive to exclude from feedback
+        my_print(SENSITIVE_LOG, true, _T("core notice: %S"), line);
+
+        AddDiagnosticInfoRawJson("CoreNotice", line);
+        return;
+    }
+
+    Json::Value notice;
+    bool parsed = false;
+
     // Parse output to extract data
 
     try
     {
-        Json::Value notice;
-        Json::Reader reader;
-        if (!reader.parse(line, notice))
+        // Parsed in place: passing the line as a string would copy it twice
+        // (once to convert and again into the reader). Notices never have
+        // comments, so they aren't collected.
+        if (!m_noticeReader.parse(line, line + strlen(line), notice, false))
         {
             // If the line contains "panic" or "fatal error", assume the core is crashing and add all further output to diagnostics
             static const char* const PANIC_HEADERS[] = {
@@ -855,11 +1532,12 @@ void CoreTransport::HandleCoreProcessOutputLine(const char* line)
             {
                 // We do not think that a panic will contain private data
                 my_print(NOT_SENSITIVE, false, _T("core panic: %S"), line);
-                AddDiagnosticInfoJson("CorePanic", line);
+                // Not JSON, so record the raw line as a string value
+                AddDiagnosticInfo("CorePanic", string(line));
             }
             else
             {
-                my_print(NOT_SENSITIVE, false, _T("%s: core notice JSON parse failed: %S"), __TFUNCTION__, reader.getFormattedErrorMessages().c_str());
+                my_print(NOT_SENSITIVE, false, _T("%s: core notice JSON parse failed: %S"), __TFUNCTION__, m_noticeReader.getFormattedErrorMessages().c_str());
                 // This line was not JSON. It's not included in diagnostics
                 // as we can't be sure it doesn't include user private data.
             }
@@ -874,189 +1552,358 @@ void CoreTransport::HandleCoreProcessOutputLine(const char* line)
             // those lines.
             return;
         }
+        parsed = true;
 
-        string noticeType = notice["noticeType"].asString();
-        string timestamp = notice["timestamp"].asString();
-        Json::Value data = notice["data"];
+        noticeType = notice["noticeType"].asString();
+        const Json::Value& data = notice["data"];
 
         // Let the UI know about it and decide if something needs to be shown to the user.
-        if (noticeType != "Info")
+        // BytesTransferred comes every second, and reaches the UI as metrics.
+        if (noticeType != "Info" && noticeType != "BytesTransferred")
         {
             UI_Notice(line);
         }
 
-        if (noticeType == "Tunnels")
+        NoticeHandlers::const_iterator handler = s_noticeHandlers.find(noticeType);
+        if (handler != s_noticeHandlers.end())
         {
-            // This notice is received when tunnels are connected and disconnected.
-            int count = data["count"].asInt();
-            if (count == 0)
-            {
-                if (m_hasEverConnected && m_reconnectStateReceiver)
-                {
-                    m_reconnectStateReceiver->SetReconnecting();
-                }
-                m_isConnected = false;
-            }
-            else if (count == 1)
-            {
-                if (m_hasEverConnected && m_reconnectStateReceiver)
-                {
-                    m_reconnectStateReceiver->SetReconnected();
-                }
-                m_isConnected = true;
-                m_hasEverConnected = true;
-            }
+            logOutputToDiagnostics = (this->*(handler->second))(data);
         }
-        else if (noticeType == "ClientUpgradeDownloaded" && m_upgradePaver != NULL && m_clientUpgradeDownloadHandled == false) {
-            m_clientUpgradeDownloadHandled = true;
+    }
+    catch (exception& e)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: core notice JSON parse exception: %S"), __TFUNCTION__, e.what());
+    }
 
-            my_print(NOT_SENSITIVE, false, _T("A client upgrade has been downloaded..."));
-            if (!ValidateAndPaveUpgrade(UTF8ToWString(data["filename"].asString()))) {
-                m_clientUpgradeDownloadHandled = false;
-            }
-            my_print(NOT_SENSITIVE, false, _T("Psiphon has been updated. The new version will launch the next time Psiphon starts."));
+    // Debug output, flag sensitive to exclude from feedback
+    my_print(SENSITIVE_LOG, true, _T("core notice: %S"), line);
 
-            // Don't include in diagnostics as "filename" is private user data
-            logOutputToDiagnostics = false;
-        }
-        else if (noticeType == "Homepage")
-        {
-            string url = data["url"].asString();
-            m_sessionInfo.SetHomepage(url.c_str());
-        }
-        else if (noticeType == "ListeningSocksProxyPort")
+    // Add to diagnostics. The line parsed, so it's recorded as it is rather
+    // than re-serialized from the tree.
+    if (logOutputToDiagnostics && parsed && LooksLikeCompleteJsonObject(line))
+    {
+        AddDiagnosticInfoRawJson("CoreNotice", line);
+    }
+    else if (logOutputToDiagnostics)
+    {
+        AddDiagnosticInfoJson("CoreNotice", notice);
+    }
+}
+
+bool CoreTransport::HandleTunnelsNotice(const Json::Value& data)
+{
+    // This notice is received when tunnels are connected and disconnected.
+    // With a tunnel pool there may be several; we're connected while there's
+    // at least one.
+    int count = data["count"].asInt();
+    int previousCount = m_tunnelCount;
+    m_tunnelCount = count;
+
+    if (m_tempConnectServerEntry == 0)
+    {
+        if (count == 0 && m_isConnected)
         {
-            int port = data["port"].asInt();
-            m_localSocksProxyPort = port;
+            TunnelMetrics::AddError("TunnelLost");
         }
-        else if (noticeType == "ListeningHttpProxyPort")
+        else if (count > 0 && count < previousCount)
         {
-            int port = data["port"].asInt();
-            m_localHttpProxyPort = port;
-
-            // In this special case, we're running the core solely to
-            // use its url proxy and we do not expect to connect to a
-            // tunnel. So ensure that TransportConnectHelper() returns
-            // once the url proxy is running.
-            if (RequestingUrlProxyWithoutTunnel())
-            {
-                m_isConnected = true;
-            }
+            // The other tunnels carry on while the core replaces this one
+            TunnelMetrics::AddError("PoolTunnelLost");
+            my_print(NOT_SENSITIVE, true, _T("%s: pool tunnel lost; %d of %d remain"), __TFUNCTION__, count, m_tunnelPoolSize);
         }
-        else if (noticeType == "SocksProxyPortInUse")
+        TunnelMetrics::SetTunnelCount(count, m_tunnelPoolSize);
+    }
+
+    if (count == 0)
+    {
+        if (m_hasEverConnected && m_reconnectStateReceiver)
         {
-            int port = data["port"].asInt();
-            my_print(NOT_SENSITIVE, false, _T("SOCKS proxy port not available: %d"), port);
-            // Don't try to reconnect with the same configuration
-            throw TransportFailed(false);
+            m_reconnectStateReceiver->SetReconnecting();
         }
-        else if (noticeType == "HttpProxyPortInUse")
+        m_isConnected = false;
+    }
+    else if (!m_isConnected)
+    {
+        if (m_hasEverConnected && m_reconnectStateReceiver)
         {
-            int port = data["port"].asInt();
-            my_print(NOT_SENSITIVE, false, _T("HTTP proxy port not available: %d"), port);
-            // Don't try to reconnect with the same configuration
-            throw TransportFailed(false);
+            m_reconnectStateReceiver->SetReconnected();
         }
-        else if (noticeType == "Untunneled")
-        {
-            string address = data["address"].asString();
-            // SENSITIVE_LOG: "address" is site user is browsing
-            my_print(SENSITIVE_LOG, false, _T("Untunneled: %S"), address.c_str());
+        m_isConnected = true;
+        m_hasEverConnected = true;
+        ConnectTimingMark("FirstTunnel");
+    }
+    return true;
+}
 
-            // Don't include in diagnostics as "address" is private user data
-            logOutputToDiagnostics = false;
-        }
-        else if (noticeType == "SplitTunnelRegion")
-        {
-            string region = data["region"].asString();
-            my_print(NOT_SENSITIVE, false, _T("Split Tunnel Region: %S"), region.c_str());
-        }
-        else if (noticeType == "UpstreamProxyError")
-        {
-            string message = data["message"].asString();
+bool CoreTransport::HandleBytesTransferredNotice(const Json::Value& data)
+{
+    TunnelMetrics::AddTunnelBytes(
+        (unsigned long long)data["sent"].asUInt64(),
+        (unsigned long long)data["received"].asUInt64());
 
-            if (message != m_lastUpstreamProxyErrorMessage)
-            {
-                // SENSITIVE_FORMAT_ARGS: "message" may contain address info that identifies user
-                my_print(SENSITIVE_FORMAT_ARGS, false, _T("Upstream Proxy Error: %S"), message.c_str());
+    // Too frequent to be worth keeping in diagnostics; the metrics summarize it.
+    return false;
+}
 
-                // Don't repeatedly display the same error message, which may be emitted
-                // many times as the core is making multiple attempts to establish tunnels.
-                m_lastUpstreamProxyErrorMessage = message;
-            }
+bool CoreTransport::HandleClientUpgradeDownloadedNotice(const Json::Value& data)
+{
+    if (m_upgradePaver == NULL || m_clientUpgradeDownloadHandled)
+    {
+        return true;
+    }
 
-            // Don't include in diagnostics as "message" may contain private user data
-            logOutputToDiagnostics = false;
-
-            // In this case, the user most likely input an incorrect upstream proxy
-            // address or credential. So stop attempting to connect and let the user
-            // handle the error message.
-            // UPDATE:
-            // Actually, there are many other conditions that might cause this case,
-            // such as attempting to connect to disallowed ports through the proxy,
-            // the proxy being temporarily overloaded, other temporary network conditions, etc.
-            // So don't throw here.
-            //throw TransportFailed(false);
-            // TODO: The client should keep track of these notices and if it has not connected
-            // within a certain amount of time and received many of these notices it should
-            // suggest to the user that there might be a problem with the Upstream Proxy Settings.
-        }
-        else if (noticeType == "AvailableEgressRegions")
+    m_clientUpgradeDownloadHandled = true;
+
+    my_print(NOT_SENSITIVE, false, _T("A client upgrade has been downloaded..."));
+    if (!ValidateAndPaveUpgrade(UTF8ToWString(data["filename"].asString()))) {
+        m_clientUpgradeDownloadHandled = false;
+    }
+    my_print(NOT_SENSITIVE, false, _T("Psiphon has been updated. The new version will launch the next time Psiphon starts."));
+
+    // Don't include in diagnostics as "filename" is private user data
+    return false;
+}
+
+bool CoreTransport::HandleHomepageNotice(const Json::Value& data)
+{
+    string url = data["url"].asString();
+    m_sessionInfo.SetHomepage(url.c_str());
+
+    // The core gets the homepages from its handshake
+    ConnectTimingMark("Handshake");
+    return true;
+}
+
+bool CoreTransport::HandleListeningSocksProxyPortNotice(const Json::Value& data)
+{
+    int port = data["port"].asInt();
+    m_localSocksProxyPort = port;
+    return true;
+}
+
+bool CoreTransport::HandleListeningHttpProxyPortNotice(const Json::Value& data)
+{
+    int port = data["port"].asInt();
+    m_localHttpProxyPort = port;
+
+    // In this special case, we're running the core solely to
+    // use its url proxy and we do not expect to connect to a
+    // tunnel. So ensure that TransportConnectHelper() returns
+    // once the url proxy is running.
+    if (RequestingUrlProxyWithoutTunnel())
+    {
+        m_isConnected = true;
+    }
+    return true;
+}
+
+bool CoreTransport::HandleSocksProxyPortInUseNotice(const Json::Value& data)
+{
+    int port = data["port"].asInt();
+    my_print(NOT_SENSITIVE, false, _T("SOCKS proxy port not available: %d"), port);
+    // Don't try to reconnect with the same configuration
+    throw TransportFailed(false);
+}
+
+bool CoreTransport::HandleHttpProxyPortInUseNotice(const Json::Value& data)
+{
+    int port = data["port"].asInt();
+    my_print(NOT_SENSITIVE, false, _T("HTTP proxy port not available: %d"), port);
+    // Don't try to reconnect with the same configuration
+    throw TransportFailed(false);
+}
+
+bool CoreTransport::HandleUntunneledNotice(const Json::Value& data)
+{
+    string address = data["address"].asString();
+    // The core reports every untunneled connection; once per address is
+    // enough for the log.
+    if (!m_reportedUntunneledAddresses.CheckAndInsert(address))
+    {
+        // SENSITIVE_LOG: "address" is site user is browsing
+        my_print(SENSITIVE_LOG, false, _T("Untunneled: %S"), address.c_str());
+    }
+
+    // Don't include in diagnostics as "address" is private user data
+    return false;
+}
+
+bool CoreTransport::HandleSplitTunnelRegionNotice(const Json::Value& data)
+{
+    string region = data["region"].asString();
+    my_print(NOT_SENSITIVE, false, _T("Split Tunnel Region: %S"), region.c_str());
+    return true;
+}
+
+bool CoreTransport::HandleUpstreamProxyErrorNotice(const Json::Value& data)
+{
+    string message = data["message"].asString();
+
+    if (message != m_lastUpstreamProxyErrorMessage)
+    {
+        // Sensitive: "message" may contain address info that identifies user
+        my_log(false, _T("Upstream Proxy Error"), LogArg("message", message, LOG_ARG_SENSITIVE));
+
+        // Don't repeatedly display the same error message, which may be emitted
+        // many times as the core is making multiple attempts to establish tunnels.
+        m_lastUpstreamProxyErrorMessage = message;
+    }
+
+    if (m_tempConnectServerEntry == 0)
+    {
+        TunnelMetrics::AddError("UpstreamProxyError");
+    }
+
+    // In this case, the user most likely input an incorrect upstream proxy
+    // address or credential. So stop attempting to connect and let the user
+    // handle the error message.
+    // UPDATE:
+    // Actually, there are many other conditions that might cause this case,
+    // such as attempting to connect to disallowed ports through the proxy,
+    // the proxy being temporarily overloaded, other temporary network conditions, etc.
+    // So don't throw here.
+    //throw TransportFailed(false);
+    // TODO: The client should keep track of these notices and if it has not connected
+    // within a certain amount of time and received many of these notices it should
+    // suggest to the user that there might be a problem with the Upstream Proxy Settings.
+
+    // Don't include in diagnostics as "message" may contain private user data
+    return false;
+}
+
+bool CoreTransport::HandleAvailableEgressRegionsNotice(const Json::Value& data)
+{
+    string regions = Json::FastWriter().write(data["regions"]);
+    my_print(NOT_SENSITIVE, false, _T("Available egress regions: %S"), regions.c_str());
+
+    vector<string> availableRegions;
+    for (const auto& region : data["regions"])
+    {
+        availableRegions.push_back(region.asString());
+    }
+    ServerList::SetAvailableEgressRegions(availableRegions);
+
+    // The region list itself is left to main.js; this adds how each region
+    // has performed.
+    UI_Notice(m_serverList.GetEgressRegionStatsNotice());
+    return true;
+}
+
+bool CoreTransport::HandleActiveAuthorizationIDsNotice(const Json::Value& data)
+{
+    string authIDs = Json::FastWriter().write(data["IDs"]);
+    my_print(NOT_SENSITIVE, true, _T("Active Authorization IDs: %S"), authIDs.c_str());
+
+    vector<string> activeAuthorizationIDs, inactiveAuthorizationIDs;
+    unordered_set<string> activeAuthorizationIDSet;
+    for (const auto& activeAuthID : data["IDs"])
+    {
+        activeAuthorizationIDs.push_back(activeAuthID.asString());
+        activeAuthorizationIDSet.insert(activeAuthorizationIDs.back());
+    }
+
+    // Figure out which of the authorizations we provided to the server were and were not active.
+    for (const auto& authID : m_authorizationIDs)
+    {
+        if (activeAuthorizationIDSet.count(authID) == 0)
         {
-            string regions = data["regions"].toStyledString();
-            my_print(NOT_SENSITIVE, false, _T("Available egress regions: %S"), regions.c_str());
-            // Processing this is left to main.js
+            inactiveAuthorizationIDs.push_back(authID);
         }
-        else if (noticeType == "ActiveAuthorizationIDs")
-        {
-            string authIDs = data["IDs"].toStyledString();
-            my_print(NOT_SENSITIVE, true, _T("Active Authorization IDs: %S"), authIDs.c_str());
+    }
 
-            vector<string> activeAuthorizationIDs, inactiveAuthorizationIDs;
-            for (const auto& activeAuthID : data["IDs"])
-            {
-                activeAuthorizationIDs.push_back(activeAuthID.asString());
-            }
+    if (m_authorizationsProvider) {
+        m_authorizationsProvider->ActiveAuthorizationIDs(activeAuthorizationIDs, inactiveAuthorizationIDs);
+    }
+    return true;
+}
 
-            // Figure out which of the authorizations we provided to the server were and were not active.
-            for (const auto& authID : m_authorizationIDs)
-            {
-                if (std::find(activeAuthorizationIDs.cbegin(), activeAuthorizationIDs.cend(), authID) == activeAuthorizationIDs.cend())
-                {
-                    inactiveAuthorizationIDs.push_back(authID);
-                }
-            }
+bool CoreTransport::HandleClientRegionNotice(const Json::Value& data)
+{
+    string region = data["region"].asString();
+    my_print(NOT_SENSITIVE, true, _T("Client region: %S"), region.c_str());
+    psicash::Lib::_().UpdateClientRegion(region);
+    return true;
+}
 
-            if (m_authorizationsProvider) {
-                m_authorizationsProvider->ActiveAuthorizationIDs(activeAuthorizationIDs, inactiveAuthorizationIDs);
-            }
-        }
-        else if (noticeType == "ClientRegion")
+bool CoreTransport::HandleTrafficRateLimitsNotice(const Json::Value& data)
+{
+    string speed = Json::FastWriter().write(data["downstreamBytesPerSecond"]);
+    my_print(NOT_SENSITIVE, true, _T("Traffic rate downstream limit: %S"), speed.c_str());
+    // Processing this is left to main.js
+    return true;
+}
+
+// With EmitDiagnosticNetworkParameters, the core names the server of each
+// dial and tunnel. Cores that only give a diagnostic ID can't be matched to
+// server entries, so their notices are just logged.
+bool CoreTransport::HandleConnectingServerNotice(const Json::Value& data)
+{
+    string serverAddress = data.get("ipAddress", "").asString();
+    string protocol = data.get("protocol", "").asString();
+    if (serverAddress.empty() || protocol.empty())
+    {
+        return true;
+    }
+
+    auto key = make_pair(serverAddress, protocol);
+    if (m_pendingDials.find(key) != m_pendingDials.end())
+    {
+        // The core only dials a server again once the last dial has failed.
+        m_serverEstablishments.push_back(ServerEstablishment(serverAddress, protocol, false, 0));
+    }
+    m_pendingDials[key] = GetTickCount();
+
+    return true;
+}
+
+bool CoreTransport::HandleActiveTunnelNotice(const Json::Value& data)
+{
+    string serverAddress = data.get("ipAddress", "").asString();
+    string protocol = data.get("protocol", "").asString();
+
+    auto dial = m_pendingDials.find(make_pair(serverAddress, protocol));
+    if (dial != m_pendingDials.end())
+    {
+        m_serverEstablishments.push_back(
+            ServerEstablishment(serverAddress, protocol, true, GetTickCount() - dial->second));
+        m_pendingDials.erase(dial);
+    }
+
+    RecordServerEstablishments();
+
+    return true;
+}
+
+void CoreTransport::RecordServerEstablishments()
+{
+    DWORD now = GetTickCount();
+    for (auto dial = m_pendingDials.begin(); dial != m_pendingDials.end();)
+    {
+        if (now - dial->second >= PENDING_DIAL_FAILED_MS)
         {
-            string region = data["region"].asString();
-            my_print(NOT_SENSITIVE, true, _T("Client region: %S"), region.c_str());
-            psicash::Lib::_().UpdateClientRegion(region);
+            m_serverEstablishments.push_back(
+                ServerEstablishment(dial->first.first, dial->first.second, false, 0));
+            dial = m_pendingDials.erase(dial);
         }
-        else if (noticeType == "TrafficRateLimits")
+        else
         {
-            string speed = data["downstreamBytesPerSecond"].toStyledString();
-            my_print(NOT_SENSITIVE, true, _T("Traffic rate downstream limit: %S"), speed.c_str());
-            // Processing this is left to main.js
+            ++dial;
         }
     }
-    catch (exception& e)
+
+    if (m_serverEstablishments.empty())
     {
-        my_print(NOT_SENSITIVE, false, _T("%s: core notice JSON parse exception: %S"), __TFUNCTION__, e.what());
+        return;
     }
 
-    // Debug output, flag sensitive to exclude from feedback
-    my_print(SENSITIVE_LOG, true, _T("core notice: %S"), line);
+    my_print(NOT_SENSITIVE, true, _T("%s: recording %d establishment result(s)"), __TFUNCTION__, m_serverEstablishments.size());
 
-    // Add to diagnostics
-    if (logOutputToDiagnostics)
-    {
-        AddDiagnosticInfoJson("CoreNotice", line);
-    }
+    vector<ServerEstablishment> establishments;
+    establishments.swap(m_serverEstablishments);
+    m_serverList.RecordServerEstablishments(establishments);
+
+    // The egress region stats are derived from the server history.
+    UI_Notice(m_serverList.GetEgressRegionStatsNotice());
 }
 
 
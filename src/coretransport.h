@@ -23,6 +23,7 @@
 #include "transport.h"
 #include "transport_registry.h"
 #include "usersettings.h"
+#include <unordered_map>
 
 class SessionInfo;
 
@@ -39,7 +40,8 @@ public:
                     tstring& o_transportDisplayName,
                     tstring& o_transportProtocolName,
                     TransportFactoryFn& o_transportFactory,
-                    AddServerEntriesFn& o_addServerEntriesFn);
+                    AddServerEntriesFn& o_addServerEntriesFn,
+                    bool& o_handshakeRequired);
 
     virtual tstring GetTransportProtocolName() const;
     virtual tstring GetTransportDisplayName() const;
@@ -51,35 +53,114 @@ public:
     virtual bool SupportsAuthorizations() const override;
     virtual bool ServerWithCapabilitiesExists();
     virtual bool ServerHasCapabilities(const ServerEntry& entry) const;
+    virtual vector<string> GetTunnelProtocols(const ServerEntry& serverEntry) const;
+    virtual void SetTempTunnelProtocol(const string& protocol);
     virtual bool RequiresStatsSupport() const;
     virtual tstring GetSessionID(const SessionInfo& sessionInfo);
     virtual int GetLocalProxyParentPort() const;
     virtual tstring GetLastTransportError() const;
 
+    // Persistent-core mode: while set, a stopping CoreTransport leaves its
+    // core process running if it's healthy, and the next CoreTransport reuses
+    // it instead of spawning a new one -- provided the core configuration
+    // hasn't changed. Otherwise the resident process is discarded.
+    // Not threadsafe: only call these while no CoreTransport is connecting.
+    static void SetKeepResidentOnStop(bool keep);
+    // Shuts down the resident core process, if there is one.
+    static void DiscardResidentCoreProcess();
+
 protected:
+    // Times the notice handling
+    friend class Microbenchmarks;
+
     virtual void TransportConnect();
     virtual bool DoPeriodicCheck();
+    virtual void GetWaitHandles(vector<HANDLE>& o_handles);
+    virtual DWORD GetPeriodicCheckInterval() const;
+    // The notices are how the tunnel's state gets to us.
+    virtual ThreadQoS GetThreadQoS() const { return THREAD_QOS_LATENCY_CRITICAL; }
 
     bool RequestingUrlProxyWithoutTunnel();
     void TransportConnectHelper();
     bool WriteParameterFiles(tstring& configFilename, tstring& serverListFilename, tstring& oldClientUpgradeFilename, tstring& newClientUpgradeFilename);
     string GetUpstreamProxyAddress();
     bool SpawnCoreProcess(const tstring& configFilename, const tstring& serverListFilename);
+    bool ParkCoreProcess();
+    bool AdoptResidentCoreProcess();
+    void TakeResidentCoreProcess();
     void ConsumeCoreProcessOutput();
+    void HandleCoreProcessOutput(const char* data, size_t length);
     bool ValidateAndPaveUpgrade(const tstring clientUpgradeFilename);
     void HandleCoreProcessOutputLine(const char* line);
 
+    // Core notice handlers, dispatched by noticeType. Each returns false if
+    // the notice must be excluded from diagnostics (e.g., it contains private
+    // user data). May throw TransportFailed.
+    typedef bool (CoreTransport::*NoticeHandler)(const Json::Value& data);
+    typedef unordered_map<string, NoticeHandler> NoticeHandlers;
+    static const NoticeHandlers s_noticeHandlers;
+
+    bool HandleTunnelsNotice(const Json::Value& data);
+    bool HandleBytesTransferredNotice(const Json::Value& data);
+    bool HandleClientUpgradeDownloadedNotice(const Json::Value& data);
+    bool HandleHomepageNotice(const Json::Value& data);
+    bool HandleListeningSocksProxyPortNotice(const Json::Value& data);
+    bool HandleListeningHttpProxyPortNotice(const Json::Value& data);
+    bool HandleSocksProxyPortInUseNotice(const Json::Value& data);
+    bool HandleHttpProxyPortInUseNotice(const Json::Value& data);
+    bool HandleUntunneledNotice(const Json::Value& data);
+    bool HandleSplitTunnelRegionNotice(const Json::Value& data);
+    bool HandleUpstreamProxyErrorNotice(const Json::Value& data);
+    bool HandleAvailableEgressRegionsNotice(const Json::Value& data);
+    bool HandleActiveAuthorizationIDsNotice(const Json::Value& data);
+    bool HandleClientRegionNotice(const Json::Value& data);
+    bool HandleTrafficRateLimitsNotice(const Json::Value& data);
+    bool HandleConnectingServerNotice(const Json::Value& data);
+    bool HandleActiveTunnelNotice(const Json::Value& data);
+
+    // Counts dials that have been pending for too long to still succeed as
+    // failed, and hands the collected results to the server list.
+    void RecordServerEstablishments();
+
 protected:
     tstring m_exePath;
+    // What WriteParameterFiles last wrote to the config file
+    string m_configFileContents;
+    bool m_allowPark;
+    // As written into the config; 1 for temp tunnels
+    unsigned int m_tunnelPoolSize;
+    // The last Tunnels count
+    int m_tunnelCount;
     int m_localSocksProxyPort;
     int m_localHttpProxyPort;
     PROCESS_INFORMATION m_processInfo;
     HANDLE m_pipe;
+    // m_pipe is read with overlapped I/O into m_pipeReadBuffer; at most one
+    // read is outstanding, and m_pipeOverlapped.hEvent is signalled when it completes.
+    OVERLAPPED m_pipeOverlapped;
+    bool m_pipeReadPending;
+    vector<char> m_pipeReadBuffer;
+    // Holds any partial line left over from the last read
     string m_pipeBuffer;
+    // When the core last wrote anything, for IdleAwareInterval
+    DWORD m_lastOutputTime;
     bool m_hasEverConnected;
     bool m_isConnected;
     bool m_clientUpgradeDownloadHandled;
     string m_lastUpstreamProxyErrorMessage;
     bool m_panicked;
+    // Reused for every notice line, so its internal stacks keep their storage
+    Json::Reader m_noticeReader;
+    // Only touched by the notice handlers
+    RecentlySeenSet m_reportedUntunneledAddresses;
     std::vector<std::string> m_authorizationIDs;
+    // Dials the core has started and not yet established, keyed by server
+    // address and protocol, with when they started
+    map<pair<string, string>, DWORD> m_pendingDials;
+    // Results not yet recorded in the server list
+    vector<ServerEstablishment> m_serverEstablishments;
+    // The leased URL proxy datastore slot, or -1
+    int m_urlProxySlot;
+    // See SetTempTunnelProtocol
+    string m_tempTunnelProtocol;
 };
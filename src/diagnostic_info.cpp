@@ -29,6 +29,21 @@
 #include "usersettings.h"
 #include "config.h"
 #include "psicashlib.h"
+#include "startup_tasks.h"
+#include "thread_pool.h"
+#include "tracing.h"
+#include "ring_log.h"
+#include "compressed_history.h"
+#include "background_transfer.h"
+#include "serverlist.h"
+#include "local_proxy.h"
+#include "timer_service.h"
+#include "performance_budget.h"
+#include <deque>
+#include <Psapi.h>
+#include <TlHelp32.h>
+
+#pragma comment(lib, "psapi.lib")
 
 #pragma warning(push, 0)
 #pragma warning(disable: 4244)
@@ -36,9 +51,166 @@
 #pragma warning(pop)
 
 
-HANDLE g_diagnosticHistoryMutex = CreateMutex(NULL, FALSE, 0);
-Json::Value g_diagnosticHistory(Json::arrayValue);
+// Diagnostic history is kept as pre-serialized JSON records, in a capped ring
+// per message category, so that chatty categories (e.g., CoreNotice) can't
+// grow without bound or push out rare ones. The sequence number restores the
+// overall order when the history is exported.
+struct DiagnosticRecord
+{
+    unsigned long long sequence;
+    string json;
+};
+
+static Lock g_diagnosticHistoryLock("DiagnosticHistory");
+static map<string, deque<DiagnosticRecord>> g_diagnosticHistory;
+static unsigned long long g_diagnosticHistorySequence = 0;
+// Records pushed out of g_diagnosticHistory, by category, compressed. Each is
+// the record's sequence (8 bytes) then its JSON. Guarded by
+// g_diagnosticHistoryLock.
+static map<string, CompressedHistory> g_coldDiagnosticHistory;
+
+// Limits for the categories that can produce records far faster than they're
+// worth keeping. Each gets a token bucket -- a burst of up to `burst` records
+// (e.g., the notices while connecting), then `perMinute` -- and, if
+// sampleEvery is more than 1, only one in that many records is offered to the
+// bucket at all. The limits are applied before a record is serialized.
+struct DiagnosticPolicy
+{
+    const char* message;
+    unsigned int burst;
+    unsigned int perMinute;
+    unsigned int sampleEvery;
+};
+
+static const DiagnosticPolicy g_diagnosticPolicies[] =
+{
+    // Nearly every core notice is recorded; the ones around a connection
+    // matter most, the steady stream afterwards much less.
+    { "CoreNotice",             300,    60,     1 },
+    // One per server and protocol on every reordering run
+    { "ServerResponseCheck",    200,    30,     4 },
+};
+
+// So that feedback shows how much there was, not just what was kept.
+// Guarded by g_diagnosticHistoryLock.
+struct DiagnosticCategoryCounts
+{
+    unsigned long long offered;
+    unsigned long long dropped; // by policy
+    double tokens;
+    DWORD lastRefillTime;
+    bool bucketStarted;
+
+    DiagnosticCategoryCounts()
+        : offered(0), dropped(0), tokens(0), lastRefillTime(0), bucketStarted(false) {}
+};
+static map<string, DiagnosticCategoryCounts> g_diagnosticCounts;
+
+
+bool _AdmitDiagnosticInfo(const char* message)
+{
+    const DiagnosticPolicy* policy = NULL;
+    for (size_t i = 0; i < sizeof(g_diagnosticPolicies) / sizeof(g_diagnosticPolicies[0]); i++)
+    {
+        if (0 == strcmp(g_diagnosticPolicies[i].message, message))
+        {
+            policy = &g_diagnosticPolicies[i];
+            break;
+        }
+    }
+
+    AutoLock lock(g_diagnosticHistoryLock);
+
+    DiagnosticCategoryCounts& counts = g_diagnosticCounts[message];
+    counts.offered++;
+
+    if (!policy)
+    {
+        return true;
+    }
+
+    if (policy->sampleEvery > 1 && (counts.offered - 1) % policy->sampleEvery != 0)
+    {
+        counts.dropped++;
+        return false;
+    }
+
+    DWORD now = GetTickCount();
+    if (!counts.bucketStarted)
+    {
+        counts.tokens = policy->burst;
+        counts.bucketStarted = true;
+    }
+    else
+    {
+        counts.tokens = min(
+            (double)policy->burst,
+            counts.tokens + (now - counts.lastRefillTime) * policy->perMinute / 60000.0);
+    }
+    counts.lastRefillTime = now;
+
+    if (counts.tokens < 1)
+    {
+        counts.dropped++;
+        return false;
+    }
+
+    counts.tokens -= 1;
+    return true;
+}
+
+void _AddDiagnosticInfoHelper(const char* message, string&& jsonRecord)
+{
+    RingLogWrite(RING_LOG_RECORD_DIAGNOSTIC, false, jsonRecord.data(), jsonRecord.length());
+
+    AutoLock lock(g_diagnosticHistoryLock);
+
+    deque<DiagnosticRecord>& records = g_diagnosticHistory[message];
+
+    DiagnosticRecord record;
+    record.sequence = g_diagnosticHistorySequence++;
+    record.json = std::move(jsonRecord);
+    records.push_back(std::move(record));
+
+    if (records.size() > DIAGNOSTIC_HISTORY_MAX_ENTRIES_PER_CATEGORY)
+    {
+        auto cold = g_coldDiagnosticHistory.find(message);
+        if (cold == g_coldDiagnosticHistory.end())
+        {
+            cold = g_coldDiagnosticHistory.insert(make_pair(
+                        string(message),
+                        CompressedHistory(DIAGNOSTIC_HISTORY_COLD_MAX_BYTES_PER_CATEGORY))).first;
+        }
+
+        const DiagnosticRecord& oldest = records.front();
+        string coldRecord((const char*)&oldest.sequence, sizeof(oldest.sequence));
+        coldRecord += oldest.json;
+        cold->second.Append(coldRecord);
+
+        records.pop_front();
+    }
+}
 
+// Per category: how many records there were, and how many of them aren't in
+// the history.
+static Json::Value GetDiagnosticHistoryCounts()
+{
+    AutoLock lock(g_diagnosticHistoryLock);
+
+    Json::Value json(Json::objectValue);
+    for (auto it = g_diagnosticCounts.cbegin(); it != g_diagnosticCounts.cend(); ++it)
+    {
+        Json::Value& category = json[it->first];
+        category["offered"] = (Json::UInt64)it->second.offered;
+        category["dropped"] = (Json::UInt64)it->second.dropped;
+
+        // Evicted: pushed out of the compressed history too
+        auto cold = g_coldDiagnosticHistory.find(it->first);
+        category["evicted"] = (Json::UInt64)(cold != g_coldDiagnosticHistory.end() ? cold->second.DroppedCount() : 0);
+        category["compressed"] = (Json::UInt64)(cold != g_coldDiagnosticHistory.end() ? cold->second.RecordCount() : 0);
+    }
+    return json;
+}
 
 // This is really just a non-template wrapper around AddDiagnosticInfo, to help
 // users of it recognize that they can pass a Json::Value.
@@ -47,29 +219,535 @@ void AddDiagnosticInfoJson(const char* message, const Json::Value& jsonValue)
     AddDiagnosticInfo(message, jsonValue);
 }
 
+// A one-pass syntax check of strict JSON, which doesn't build a tree: the
+// string is recorded as-is if it passes.
+// Nesting is limited, so that the recursion can't overflow the stack.
+#define JSON_CHECK_MAX_DEPTH 256
+
+static void SkipJsonSpace(const char*& p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+    {
+        p++;
+    }
+}
+
+static bool CheckJsonString(const char*& p)
+{
+    // *p is the opening quote
+    for (p++; *p != '"'; p++)
+    {
+        if ((unsigned char)*p < 0x20)
+        {
+            // Includes the terminating NUL
+            return false;
+        }
+        if (*p == '\\')
+        {
+            p++;
+            if (*p == 'u')
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    if (!isxdigit((unsigned char)*++p))
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (!strchr("\"\\/bfnrt", *p) || *p == '\0')
+            {
+                return false;
+            }
+        }
+    }
+    p++;
+    return true;
+}
+
+static bool CheckJsonNumber(const char*& p)
+{
+    if (*p == '-')
+    {
+        p++;
+    }
+    if (*p == '0')
+    {
+        p++;
+    }
+    else if (isdigit((unsigned char)*p))
+    {
+        while (isdigit((unsigned char)*p)) p++;
+    }
+    else
+    {
+        return false;
+    }
+    if (*p == '.')
+    {
+        p++;
+        if (!isdigit((unsigned char)*p)) return false;
+        while (isdigit((unsigned char)*p)) p++;
+    }
+    if (*p == 'e' || *p == 'E')
+    {
+        p++;
+        if (*p == '+' || *p == '-') p++;
+        if (!isdigit((unsigned char)*p)) return false;
+        while (isdigit((unsigned char)*p)) p++;
+    }
+    return true;
+}
+
+static bool CheckJsonLiteral(const char*& p, const char* literal)
+{
+    size_t length = strlen(literal);
+    if (strncmp(p, literal, length) != 0)
+    {
+        return false;
+    }
+    p += length;
+    return true;
+}
+
+static bool CheckJsonValue(const char*& p, int depth)
+{
+    SkipJsonSpace(p);
+
+    switch (*p)
+    {
+    case '"':
+        return CheckJsonString(p);
+    case 't':
+        return CheckJsonLiteral(p, "true");
+    case 'f':
+        return CheckJsonLiteral(p, "false");
+    case 'n':
+        return CheckJsonLiteral(p, "null");
+    case '{':
+    case '[':
+    {
+        if (depth >= JSON_CHECK_MAX_DEPTH)
+        {
+            return false;
+        }
+        char close = (*p == '{') ? '}' : ']';
+        bool isObject = (*p == '{');
+        p++;
+        SkipJsonSpace(p);
+        if (*p == close)
+        {
+            p++;
+            return true;
+        }
+        while (true)
+        {
+            if (isObject)
+            {
+                SkipJsonSpace(p);
+                if (*p != '"' || !CheckJsonString(p))
+                {
+                    return false;
+                }
+                SkipJsonSpace(p);
+                if (*p++ != ':')
+                {
+                    return false;
+                }
+            }
+            if (!CheckJsonValue(p, depth + 1))
+            {
+                return false;
+            }
+            SkipJsonSpace(p);
+            if (*p == close)
+            {
+                p++;
+                return true;
+            }
+            if (*p++ != ',')
+            {
+                return false;
+            }
+        }
+    }
+    default:
+        return CheckJsonNumber(p);
+    }
+}
+
+static bool IsValidJson(const char* json)
+{
+    const char* p = json;
+    if (!CheckJsonValue(p, 0))
+    {
+        return false;
+    }
+    SkipJsonSpace(p);
+    return *p == '\0';
+}
+
 void AddDiagnosticInfoJson(const char* message, const char* jsonString)
 {
     if (!jsonString) {
         AddDiagnosticInfo(message, Json::nullValue);
+        return;
+    }
 
+    if (!IsValidJson(jsonString))
+    {
+        return;
     }
 
+    AddDiagnosticInfoRawJson(message, jsonString);
+}
+
+void AddDiagnosticInfoRawJson(const char* message, const char* jsonString)
+{
+    if (!_AdmitDiagnosticInfo(message))
+    {
+        return;
+    }
+
+    // Matches the layout (and key order) FastWriter produces in AddDiagnosticInfo
+    string record = "{\"data\":";
+    record += jsonString;
+    while (!record.empty() && isspace((unsigned char)record.back()))
+    {
+        record.pop_back();
+    }
+    record += ",\"msg\":";
+    record += Json::valueToQuotedString(message);
+    record += ",\"timestamp!!timestamp\":";
+    record += Json::valueToQuotedString(WStringToUTF8(GetISO8601DatetimeString()).c_str());
+    record += "}";
+
+    OutputDebugStringA(record.c_str());
+    OutputDebugStringA("\n");
+
+    _AddDiagnosticInfoHelper(message, std::move(record));
+}
+
+
+static Lock g_connectTimingLock("ConnectTiming");
+static bool g_connectTimingActive = false;
+static DWORD g_connectTimingStartTime = 0;
+static vector<pair<string, DWORD>> g_connectTimingMarks;
+// Reports not yet taken by TakeConnectTimings; only the last
+// CONNECT_TIMING_MAX_PENDING_REPORTS are kept.
+#define CONNECT_TIMING_MAX_PENDING_REPORTS  16
+static deque<Json::Value> g_connectTimingPendingReports;
+// The I/O totals as of the last mark, and the I/O done in each phase since
+static IoStatsTotals g_connectTimingIoAtMark[IO_STATS_KIND_COUNT];
+static Json::Value g_connectTimingIoPhases(Json::arrayValue);
+
+// The I/O done since io_previous, which is brought up to date; an object with
+// a member for each kind of I/O there's been.
+static Json::Value TakeIoStatsDelta(IoStatsTotals io_previous[IO_STATS_KIND_COUNT])
+{
+    IoStatsTotals current[IO_STATS_KIND_COUNT];
+    GetIoStats(current);
+
+    Json::Value json(Json::objectValue);
+    for (int i = 0; i < IO_STATS_KIND_COUNT; i++)
+    {
+        unsigned long long operations = current[i].operations - io_previous[i].operations;
+        if (operations > 0)
+        {
+            Json::Value& entry = json[IoStatsKindName((IoStatsKind)i)];
+            entry["operations"] = (Json::UInt64)operations;
+            entry["bytes"] = (Json::UInt64)(current[i].bytes - io_previous[i].bytes);
+            entry["microseconds"] = (Json::UInt64)(current[i].microseconds - io_previous[i].microseconds);
+        }
+        io_previous[i] = current[i];
+    }
+    return json;
+}
+
+// Must be called with g_connectTimingLock held
+static void AddConnectTimingIoPhase(const string& phase)
+{
+    Json::Value io = TakeIoStatsDelta(g_connectTimingIoAtMark);
+    if (io.empty())
+    {
+        return;
+    }
+
+    Json::Value entry;
+    entry["phase"] = phase;
+    entry["io"] = io;
+    g_connectTimingIoPhases.append(entry);
+}
+
+void ConnectTimingStart()
+{
+    TRACE_EVENT(TRACE_KEYWORD_TRANSPORT, _T("Transport/ConnectStart"));
+
+    AutoLock lock(g_connectTimingLock);
+
+    g_connectTimingActive = true;
+    g_connectTimingStartTime = GetTickCount();
+    g_connectTimingMarks.clear();
+
+    GetIoStats(g_connectTimingIoAtMark);
+    g_connectTimingIoPhases = Json::Value(Json::arrayValue);
+}
+
+void ConnectTimingMark(const char* phase)
+{
+    DWORD now = GetTickCount();
+
+    TRACE_EVENT(TRACE_KEYWORD_TRANSPORT, _T("Transport/Phase: %S"), phase);
+
+    AutoLock lock(g_connectTimingLock);
+
+    if (!g_connectTimingActive)
+    {
+        return;
+    }
+
+    for (const auto& mark : g_connectTimingMarks)
+    {
+        if (mark.first == phase)
+        {
+            return;
+        }
+    }
+
+    g_connectTimingMarks.push_back(make_pair(string(phase), now - g_connectTimingStartTime));
+
+    // The I/O is charged to the phase it led up to.
+    AddConnectTimingIoPhase(phase);
+}
+
+void ConnectTimingReport(bool connected, const tstring& transportName)
+{
+    DWORD now = GetTickCount();
+
+    Json::Value json(Json::objectValue);
+    Json::Value ioJson;
+    tstringstream summary;
+    {
+        AutoLock lock(g_connectTimingLock);
+
+        if (!g_connectTimingActive)
+        {
+            return;
+        }
+        g_connectTimingActive = false;
+
+        DWORD total = now - g_connectTimingStartTime;
+
+        json["transport"] = WStringToUTF8(transportName);
+        json["connected"] = connected;
+        json["totalMilliseconds"] = (Json::UInt)total;
+
+        // An array, rather than an object, to keep the phases in order
+        Json::Value phases(Json::arrayValue);
+        for (const auto& mark : g_connectTimingMarks)
+        {
+            Json::Value phase;
+            phase["phase"] = mark.first;
+            phase["milliseconds"] = (Json::UInt)mark.second;
+            phases.append(phase);
+
+            summary << UTF8ToWString(mark.first) << _T("=") << mark.second << _T("ms, ");
+        }
+        json["phases"] = phases;
+
+        summary << (connected ? _T("connected") : _T("failed")) << _T("=") << total << _T("ms");
+
+        if (g_connectTimingPendingReports.size() >= CONNECT_TIMING_MAX_PENDING_REPORTS)
+        {
+            g_connectTimingPendingReports.pop_front();
+        }
+        g_connectTimingPendingReports.push_back(json);
+
+        AddConnectTimingIoPhase(connected ? "Connected" : "Failed");
+        if (!g_connectTimingIoPhases.empty())
+        {
+            ioJson["scope"] = "connect";
+            ioJson["transport"] = json["transport"];
+            ioJson["connected"] = connected;
+            ioJson["phases"] = g_connectTimingIoPhases;
+            g_connectTimingIoPhases = Json::Value(Json::arrayValue);
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("Connect timing (%s): %s"), transportName.c_str(), summary.str().c_str());
+
+    if (connected)
+    {
+        PerformanceBudget::Record(PERF_METRIC_TIME_TO_CONNECTED, json["totalMilliseconds"].asDouble());
+    }
+
+    AddDiagnosticInfoJson("ConnectTiming", json);
+
+    if (!ioJson.isNull())
+    {
+        AddDiagnosticInfoJson("IoStats", ioJson);
+    }
+
+    // Lock stalls are most noticeable while connecting
+    LockStatsReport();
+}
+
+bool TakeConnectTimings(Json::Value& o_reports)
+{
+    AutoLock lock(g_connectTimingLock);
+
+    if (g_connectTimingPendingReports.empty())
+    {
+        return false;
+    }
+
+    o_reports = Json::Value(Json::arrayValue);
+    for (auto& report : g_connectTimingPendingReports)
+    {
+        o_reports.append(report);
+    }
+    g_connectTimingPendingReports.clear();
+    return true;
+}
+
+void IoStatsReport(const char* scope)
+{
+#if IO_STATS
+    IoStatsTotals none[IO_STATS_KIND_COUNT] = {};
+    Json::Value io = TakeIoStatsDelta(none);
+
+    tstringstream summary;
+    for (auto it = io.begin(); it != io.end(); ++it)
+    {
+        summary << UTF8ToWString(it.name()) << _T("=") << (*it)["operations"].asUInt64()
+                << _T("/") << (*it)["bytes"].asUInt64() << _T("B/") << (*it)["microseconds"].asUInt64() << _T("us ");
+    }
+    my_print(NOT_SENSITIVE, true, _T("I/O stats (%S): %s"), scope, summary.str().c_str());
+
     Json::Value json;
-    Json::Reader reader;
-    bool parsingSuccessful = reader.parse(jsonString, json);
-    if (!parsingSuccessful)
+    json["scope"] = scope;
+    json["io"] = io;
+    AddDiagnosticInfoJson("IoStats", json);
+#else
+    (void)scope;
+#endif
+}
+
+void LockStatsReport()
+{
+    vector<LockStatsSnapshot> stats = GetLockStats();
+    if (stats.empty())
     {
         return;
     }
 
-    AddDiagnosticInfo(message, json);
+    Json::Value json(Json::arrayValue);
+    for (const auto& lock : stats)
+    {
+        my_print(NOT_SENSITIVE, true,
+            _T("Lock stats (%S): %llu acquired, %llu contended, wait %llu/%llu us, hold %llu/%llu us (total/max)"),
+            lock.name.c_str(), lock.acquisitions, lock.contended,
+            lock.totalWaitMicroseconds, lock.maxWaitMicroseconds,
+            lock.totalHoldMicroseconds, lock.maxHoldMicroseconds);
+
+        Json::Value entry;
+        entry["name"] = lock.name;
+        entry["acquisitions"] = (Json::UInt64)lock.acquisitions;
+        entry["contended"] = (Json::UInt64)lock.contended;
+        entry["totalWaitMicroseconds"] = (Json::UInt64)lock.totalWaitMicroseconds;
+        entry["maxWaitMicroseconds"] = (Json::UInt64)lock.maxWaitMicroseconds;
+        entry["totalHoldMicroseconds"] = (Json::UInt64)lock.totalHoldMicroseconds;
+        entry["maxHoldMicroseconds"] = (Json::UInt64)lock.maxHoldMicroseconds;
+        json.append(entry);
+    }
+
+    AddDiagnosticInfoJson("LockStats", json);
 }
 
-void GetDiagnosticHistory(Json::Value& o_json)
+// Appends the diagnostic history, oldest first, to o_out as a JSON array.
+// The records are already serialized, so they're copied straight into the
+// output rather than being rebuilt into a Json::Value tree.
+// Records before sinceSequence are left out; o_nextSequence is set to the
+// sequence the next record will have, for a later call.
+static void WriteDiagnosticHistory(string& o_out, unsigned long long sinceSequence, unsigned long long& o_nextSequence)
 {
-    o_json.clear();
-    AutoMUTEX mutex(g_diagnosticHistoryMutex);
-    o_json = Json::Value(g_diagnosticHistory);
+    AutoLock lock(g_diagnosticHistoryLock);
+
+    o_nextSequence = g_diagnosticHistorySequence;
+
+    // The compressed records are expanded first, so that pointers to them
+    // stay valid.
+    vector<DiagnosticRecord> coldRecords;
+    for (auto category = g_coldDiagnosticHistory.cbegin(); category != g_coldDiagnosticHistory.cend(); ++category)
+    {
+        vector<string> packed;
+        category->second.GetRecords(packed);
+        for (auto it = packed.begin(); it != packed.end(); ++it)
+        {
+            if (it->length() < sizeof(unsigned long long))
+            {
+                continue;
+            }
+
+            DiagnosticRecord record;
+            memcpy(&record.sequence, it->data(), sizeof(record.sequence));
+            if (record.sequence < sinceSequence)
+            {
+                continue;
+            }
+            record.json = it->substr(sizeof(record.sequence));
+            coldRecords.push_back(std::move(record));
+        }
+    }
+
+    vector<const DiagnosticRecord*> records;
+    size_t totalLength = 0;
+    for (auto record = coldRecords.cbegin(); record != coldRecords.cend(); ++record)
+    {
+        records.push_back(&(*record));
+        totalLength += record->json.length() + 1;
+    }
+    for (auto category = g_diagnosticHistory.cbegin(); category != g_diagnosticHistory.cend(); ++category)
+    {
+        for (auto record = category->second.cbegin(); record != category->second.cend(); ++record)
+        {
+            if (record->sequence < sinceSequence)
+            {
+                continue;
+            }
+            records.push_back(&(*record));
+            totalLength += record->json.length() + 1;
+        }
+    }
+
+    sort(records.begin(), records.end(),
+        [](const DiagnosticRecord* a, const DiagnosticRecord* b) { return a->sequence < b->sequence; });
+
+    o_out.reserve(o_out.length() + totalLength + 2);
+    o_out += '[';
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        if (i > 0)
+        {
+            o_out += ',';
+        }
+        o_out += records[i]->json;
+    }
+    o_out += ']';
+}
+
+struct WriteDiagnosticHistoryParams
+{
+    string out;
+    unsigned long long sinceSequence;
+    unsigned long long nextSequence;
+};
+
+static DWORD WINAPI WriteDiagnosticHistoryThread(void* object)
+{
+    WriteDiagnosticHistoryParams* params = (WriteDiagnosticHistoryParams*)object;
+    WriteDiagnosticHistory(params->out, params->sinceSequence, params->nextSequence);
+    return 0;
 }
 
 
@@ -411,7 +1089,8 @@ struct SystemInfo
     UserGroupInfo groupInfo;
 };
 
-bool GetSystemInfo(SystemInfo& o_sysInfo)
+// Just the parts that come from WMI, which can be slow. See GetWmiInfo.
+static bool QueryWmiSystemInfo(SystemInfo& o_sysInfo)
 {
     // This code adapted from: http://msdn.microsoft.com/en-us/library/aa390423.aspx
 
@@ -629,43 +1308,20 @@ bool GetSystemInfo(SystemInfo& o_sysInfo)
         break;
     }
 
-    pEnumerator->Release();
-
-    // Cleanup
-
-    pSvc->Release();
-    pLoc->Release();
-
-    CoUninitialize();
-
-    // Miscellaneous
-
-    o_sysInfo.starter = (GetSystemMetrics(SM_STARTER) != 0);
-
-    o_sysInfo.mideastEnabled = (GetSystemMetrics(SM_MIDEASTENABLED) != 0);
-    o_sysInfo.slowMachine = (GetSystemMetrics(SM_SLOWMACHINE) != 0);
-
-    // Network info
-
-    WininetNetworkInfo netInfo;
-    o_sysInfo.wininet_success = false;
-    if (WininetGetNetworkInfo(netInfo))
-    {
-        o_sysInfo.wininet_success = true;
-        o_sysInfo.wininet_info = netInfo;
-    }
-
-    o_sysInfo.groupInfo_success = false;
-    if (GetUserGroupInfo(o_sysInfo.groupInfo))
-    {
-        o_sysInfo.groupInfo_success = true;
-    }
+    pEnumerator->Release();
+
+    // Cleanup
+
+    pSvc->Release();
+    pLoc->Release();
+
+    CoUninitialize();
 
-    o_sysInfo.mshtmlDLLVersion = GetDLLVersion("MSHTML.DLL");
-    
     return true;
 }
 
+static bool GetSystemInfo(SystemInfo& o_sysInfo);
+
 string GetClientPlatform()
 {
     static string cachedResult;
@@ -698,20 +1354,6 @@ string GetClientPlatform()
     return cachedResult;
 }
 
-bool GetCountryDialingCode(wstring& o_countryDialingCode)
-{
-    o_countryDialingCode.clear();
-
-    SystemInfo sysInfo;
-    if (!GetSystemInfo(sysInfo))
-    {
-        return false;
-    }
-
-    o_countryDialingCode = sysInfo.countryCode;
-    return true;
-}
-
 // Not all of these fields will be used, depending on the OS version
 struct SecurityInfo
 {
@@ -732,7 +1374,8 @@ struct SecurityInfo
     } v2;
 };
 
-void GetOSSecurityInfo(
+// Queries WMI, which can be slow. See GetWmiInfo.
+static void QueryOSSecurityInfo(
         vector<SecurityInfo>& antiVirusInfo, 
         vector<SecurityInfo>& antiSpywareInfo, 
         vector<SecurityInfo>& firewallInfo)
@@ -1067,12 +1710,392 @@ void GetOSSecurityInfo(
 }
 
 
+/*
+WMI queries regularly take several seconds, and sometimes hang, so what they
+return is collected in the background, at low priority, and cached. Once the
+cache is stale it's refreshed in the background, and the stale info is used
+in the meantime; info that's likely to change (free memory) may be that old.
+*/
+
+#define WMI_INFO_MAX_AGE_MS     (30*60*1000)
+// How long a caller will wait for the first collection to finish
+#define WMI_INFO_WAIT_MS        10000
+
+struct WmiInfo
+{
+    bool systemInfoSuccess;
+    SystemInfo systemInfo; // Only the fields that come from WMI
+    vector<SecurityInfo> antiVirusInfo, antiSpywareInfo, firewallInfo;
+
+    WmiInfo() : systemInfoSuccess(false) {}
+};
+
+static Lock g_wmiInfoLock("WmiInfo");
+static shared_ptr<const WmiInfo> g_wmiInfo;
+static DWORD g_wmiInfoTime = 0;
+static bool g_wmiInfoCollecting = false;
+// Manual reset; set whenever a collection finishes. Never closed.
+static HANDLE g_wmiInfoCollectedEvent = NULL;
+
+static void CollectWmiInfo()
+{
+    auto info = make_shared<WmiInfo>();
+
+    {
+        ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
+        DWORD startTime = GetTickCount();
+
+        info->systemInfoSuccess = QueryWmiSystemInfo(info->systemInfo);
+        QueryOSSecurityInfo(info->antiVirusInfo, info->antiSpywareInfo, info->firewallInfo);
+
+        my_print(NOT_SENSITIVE, true, _T("%s: took %d ms"), __TFUNCTION__, GetTickCount() - startTime);
+    }
+
+    {
+        AutoLock lock(g_wmiInfoLock);
+        g_wmiInfo = info;
+        g_wmiInfoTime = GetTickCount();
+        g_wmiInfoCollecting = false;
+    }
+
+    SetEvent(g_wmiInfoCollectedEvent);
+}
+
+// Must be called with g_wmiInfoLock held. Returns false if the collection
+// couldn't be started.
+static bool StartWmiInfoCollectionLocked()
+{
+    if (g_wmiInfoCollecting)
+    {
+        return true;
+    }
+
+    if (!g_wmiInfoCollectedEvent)
+    {
+        g_wmiInfoCollectedEvent = CreateEvent(
+                                    NULL,
+                                    TRUE,  // manual reset
+                                    FALSE, // initial state
+                                    0);
+        if (!g_wmiInfoCollectedEvent)
+        {
+            return false;
+        }
+    }
+
+    ResetEvent(g_wmiInfoCollectedEvent);
+    g_wmiInfoCollecting = ThreadPool::Instance().Post(CollectWmiInfo);
+    return g_wmiInfoCollecting;
+}
+
+void StartSystemInfoCollection()
+{
+    AutoLock lock(g_wmiInfoLock);
+    (void)StartWmiInfoCollectionLocked();
+}
+
+
+/*
+Resource usage monitoring: the client is often left running for weeks, so
+slow leaks matter. The process's private bytes, handles and threads -- and
+roughly how much heap each of the larger in-memory structures holds -- are
+sampled periodically and recorded, and growth past a threshold is logged.
+*/
+
+// The baseline is taken once startup has settled down.
+#define RESOURCE_USAGE_FIRST_SAMPLE_MS      (5*60*1000)
+#define RESOURCE_USAGE_SAMPLE_INTERVAL_MS   (60*60*1000)
+// Growth since the baseline that's worth a warning
+#define RESOURCE_USAGE_MAX_PRIVATE_BYTES_GROWTH (100*1024*1024)
+#define RESOURCE_USAGE_MAX_HANDLE_GROWTH        2000
+#define RESOURCE_USAGE_MAX_THREAD_GROWTH        100
+
+struct ResourceUsage
+{
+    unsigned long long privateBytes;
+    DWORD handleCount;
+    DWORD threadCount;
+    size_t diagnosticHistoryEntries;
+    // Approximate heap used by each of the larger in-memory structures
+    size_t diagnosticHistoryBytes;
+    size_t messageHistoryBytes;
+    size_t serverListBytes;
+    size_t localProxyStatsBytes;
+
+    ResourceUsage()
+        : privateBytes(0), handleCount(0), threadCount(0),
+          diagnosticHistoryEntries(0), diagnosticHistoryBytes(0),
+          messageHistoryBytes(0), serverListBytes(0), localProxyStatsBytes(0) {}
+};
+
+// Only touched by the timer callback, which never overlaps itself.
+static TimerService::TimerID g_resourceUsageTimer = 0;
+static ResourceUsage g_resourceUsageBaseline;
+static bool g_resourceUsageHasBaseline = false;
+static bool g_resourceUsageWarned = false;
+
+static DWORD GetProcessThreadCount()
+{
+    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    if (snapshot == INVALID_HANDLE_VALUE)
+    {
+        return 0;
+    }
+
+    DWORD processID = GetCurrentProcessId();
+    DWORD count = 0;
+
+    THREADENTRY32 entry;
+    entry.dwSize = sizeof(entry);
+    if (Thread32First(snapshot, &entry))
+    {
+        do
+        {
+            if (entry.th32OwnerProcessID == processID)
+            {
+                count++;
+            }
+        } while (Thread32Next(snapshot, &entry));
+    }
+
+    CloseHandle(snapshot);
+    return count;
+}
+
+static ResourceUsage GetResourceUsage()
+{
+    ResourceUsage usage;
+
+    PROCESS_MEMORY_COUNTERS_EX memoryCounters = { 0 };
+    memoryCounters.cb = sizeof(memoryCounters);
+    if (GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&memoryCounters, sizeof(memoryCounters)))
+    {
+        usage.privateBytes = memoryCounters.PrivateUsage;
+    }
+
+    (void)GetProcessHandleCount(GetCurrentProcess(), &usage.handleCount);
+    usage.threadCount = GetProcessThreadCount();
+
+    {
+        AutoLock lock(g_diagnosticHistoryLock);
+        for (auto category = g_diagnosticHistory.cbegin(); category != g_diagnosticHistory.cend(); ++category)
+        {
+            // A map node per category
+            usage.diagnosticHistoryBytes += 3 * sizeof(void*) + sizeof(*category) + StringHeapBytes(category->first);
+            usage.diagnosticHistoryEntries += category->second.size();
+            for (auto record = category->second.cbegin(); record != category->second.cend(); ++record)
+            {
+                usage.diagnosticHistoryBytes += sizeof(DiagnosticRecord) + StringHeapBytes(record->json);
+            }
+        }
+        for (auto category = g_coldDiagnosticHistory.cbegin(); category != g_coldDiagnosticHistory.cend(); ++category)
+        {
+            usage.diagnosticHistoryBytes += 3 * sizeof(void*) + sizeof(*category) + category->second.MemoryUsage();
+        }
+    }
+
+    usage.messageHistoryBytes = GetMessageHistoryMemoryUsage();
+    usage.serverListBytes = ServerList::GetCacheMemoryUsage();
+    usage.localProxyStatsBytes = LocalProxy::GetStatsMemoryUsage();
+
+    return usage;
+}
+
+static Json::Value ResourceUsageJson(const ResourceUsage& usage)
+{
+    Json::Value json;
+    json["privateBytes"] = (Json::UInt64)usage.privateBytes;
+    json["handles"] = (Json::UInt)usage.handleCount;
+    json["threads"] = (Json::UInt)usage.threadCount;
+    json["diagnosticHistoryEntries"] = (Json::UInt64)usage.diagnosticHistoryEntries;
+    json["heapBytes"]["diagnosticHistory"] = (Json::UInt64)usage.diagnosticHistoryBytes;
+    json["heapBytes"]["messageHistory"] = (Json::UInt64)usage.messageHistoryBytes;
+    json["heapBytes"]["serverList"] = (Json::UInt64)usage.serverListBytes;
+    json["heapBytes"]["localProxyStats"] = (Json::UInt64)usage.localProxyStatsBytes;
+    return json;
+}
+
+static void ResourceUsageTimerCallback()
+{
+    ResourceUsage usage = GetResourceUsage();
+
+    Json::Value json = ResourceUsageJson(usage);
+    AddDiagnosticInfoJson("ResourceUsage", json);
+
+    my_print(NOT_SENSITIVE, true, _T("%s: private bytes %llu, handles %d, threads %d; heap: diagnostic history %d, messages %d, server list %d, proxy stats %d"),
+        __TFUNCTION__, usage.privateBytes, usage.handleCount, usage.threadCount,
+        (int)usage.diagnosticHistoryBytes, (int)usage.messageHistoryBytes,
+        (int)usage.serverListBytes, (int)usage.localProxyStatsBytes);
+
+    PerformanceBudget::Record(PERF_METRIC_LOG_DIAGNOSTIC_MEMORY, (double)(usage.diagnosticHistoryBytes + usage.messageHistoryBytes));
+
+    if (!g_resourceUsageHasBaseline)
+    {
+        g_resourceUsageBaseline = usage;
+        g_resourceUsageHasBaseline = true;
+        return;
+    }
+
+    // Samples after the baseline are an hour or more apart, and more than an
+    // hour after startup.
+    PerformanceBudget::Record(PERF_METRIC_PRIVATE_BYTES_AFTER_1H, (double)usage.privateBytes);
+    (void)PerformanceBudget::Report();
+
+    const ResourceUsage& baseline = g_resourceUsageBaseline;
+    if (!g_resourceUsageWarned
+        && (usage.privateBytes > baseline.privateBytes + RESOURCE_USAGE_MAX_PRIVATE_BYTES_GROWTH
+            || usage.handleCount > baseline.handleCount + RESOURCE_USAGE_MAX_HANDLE_GROWTH
+            || usage.threadCount > baseline.threadCount + RESOURCE_USAGE_MAX_THREAD_GROWTH))
+    {
+        // Once is enough to show up in feedback; the samples show the trend.
+        g_resourceUsageWarned = true;
+
+        my_print(NOT_SENSITIVE, true, _T("%s: resource usage has grown since startup: private bytes %llu -> %llu, handles %d -> %d, threads %d -> %d"),
+            __TFUNCTION__, baseline.privateBytes, usage.privateBytes,
+            baseline.handleCount, usage.handleCount, baseline.threadCount, usage.threadCount);
+
+        Json::Value growth;
+        growth["baseline"]["privateBytes"] = (Json::UInt64)baseline.privateBytes;
+        growth["baseline"]["handles"] = (Json::UInt)baseline.handleCount;
+        growth["baseline"]["threads"] = (Json::UInt)baseline.threadCount;
+        growth["current"] = json;
+        AddDiagnosticInfoJson("ResourceUsageGrowth", growth);
+    }
+}
+
+void StartResourceUsageMonitor()
+{
+    if (g_resourceUsageTimer)
+    {
+        return;
+    }
+
+    // Left running for the life of the process.
+    g_resourceUsageTimer = TimerService::Instance().Schedule(
+                                RESOURCE_USAGE_FIRST_SAMPLE_MS,
+                                RESOURCE_USAGE_SAMPLE_INTERVAL_MS,
+                                ResourceUsageTimerCallback);
+    if (!g_resourceUsageTimer)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: TimerService::Schedule failed"), __TFUNCTION__);
+    }
+}
+
+Json::Value GetResourceUsageSample()
+{
+    return ResourceUsageJson(GetResourceUsage());
+}
+
+// Returns null if there's no info yet, even after waiting for a while.
+static shared_ptr<const WmiInfo> GetWmiInfo()
+{
+    {
+        AutoLock lock(g_wmiInfoLock);
+
+        if (g_wmiInfo)
+        {
+            if (GetTickCount() - g_wmiInfoTime >= WMI_INFO_MAX_AGE_MS)
+            {
+                (void)StartWmiInfoCollectionLocked();
+            }
+            return g_wmiInfo;
+        }
+
+        if (!StartWmiInfoCollectionLocked())
+        {
+            return shared_ptr<const WmiInfo>();
+        }
+    }
+
+    // Not waiting forever, as it may hang.
+    (void)WaitForSingleObject(g_wmiInfoCollectedEvent, WMI_INFO_WAIT_MS);
+
+    AutoLock lock(g_wmiInfoLock);
+    return g_wmiInfo;
+}
+
+bool GetCountryDialingCode(wstring& o_countryDialingCode)
+{
+    o_countryDialingCode.clear();
+
+    // Only the WMI part of the system info is needed, and that's cached.
+    auto wmiInfo = GetWmiInfo();
+    if (!wmiInfo || !wmiInfo->systemInfoSuccess)
+    {
+        return false;
+    }
+
+    o_countryDialingCode = wmiInfo->systemInfo.countryCode;
+    return true;
+}
+
+static bool GetSystemInfo(SystemInfo& o_sysInfo)
+{
+    auto wmiInfo = GetWmiInfo();
+    if (!wmiInfo || !wmiInfo->systemInfoSuccess)
+    {
+        return false;
+    }
+
+    o_sysInfo = wmiInfo->systemInfo;
+
+    // The rest is quick to get, so it's always current.
+
+    // Miscellaneous
+
+    o_sysInfo.starter = (GetSystemMetrics(SM_STARTER) != 0);
+
+    o_sysInfo.mideastEnabled = (GetSystemMetrics(SM_MIDEASTENABLED) != 0);
+    o_sysInfo.slowMachine = (GetSystemMetrics(SM_SLOWMACHINE) != 0);
+
+    // Network info
+
+    WininetNetworkInfo netInfo;
+    o_sysInfo.wininet_success = false;
+    if (WininetGetNetworkInfo(netInfo))
+    {
+        o_sysInfo.wininet_success = true;
+        o_sysInfo.wininet_info = netInfo;
+    }
+
+    o_sysInfo.groupInfo_success = false;
+    if (GetUserGroupInfo(o_sysInfo.groupInfo))
+    {
+        o_sysInfo.groupInfo_success = true;
+    }
+
+    o_sysInfo.mshtmlDLLVersion = GetDLLVersion("MSHTML.DLL");
+    
+    return true;
+}
+
+static void GetOSSecurityInfo(
+        vector<SecurityInfo>& antiVirusInfo,
+        vector<SecurityInfo>& antiSpywareInfo,
+        vector<SecurityInfo>& firewallInfo)
+{
+    auto wmiInfo = GetWmiInfo();
+    if (!wmiInfo)
+    {
+        antiVirusInfo.clear();
+        antiSpywareInfo.clear();
+        firewallInfo.clear();
+        return;
+    }
+
+    antiVirusInfo = wmiInfo->antiVirusInfo;
+    antiSpywareInfo = wmiInfo->antiSpywareInfo;
+    firewallInfo = wmiInfo->firewallInfo;
+}
+
+
 struct StartupDiagnosticInfo {
     bool wininet_success;
     WininetNetworkInfo wininet_info;
 } g_startupDiagnosticInfo;
 
-// NOTE: Not threadsafe
+// NOTE: Not threadsafe. Readers must wait for the startup task that runs it.
 void DoStartupDiagnosticCollection()
 {
     // Reset
@@ -1091,7 +2114,9 @@ void DoStartupDiagnosticCollection()
 /**
 Adds diagnostic info to `o_json`.
 */
-void GetDiagnosticInfo(Json::Value& o_json)
+// The status history starts from messageHistorySince; o_messageHistoryNext
+// is where the next call should start to carry on from this one.
+void GetDiagnosticInfo(Json::Value& o_json, ULONG messageHistorySince, ULONG& o_messageHistoryNext)
 {
     o_json = Json::Value(Json::objectValue);
 
@@ -1163,6 +2188,10 @@ void GetDiagnosticInfo(Json::Value& o_json)
         networkInfo["Current"]["Internet"]["internetRASInstalled"] = Json::nullValue;
     }
 
+    // Both the original proxy info and g_startupDiagnosticInfo are gathered
+    // by startup tasks.
+    StartupTasks::Wait(STARTUP_TASK_DIAGNOSTIC_COLLECTION);
+
     networkInfo["Original"] = Json::Value(Json::objectValue);
 
     networkInfo["Original"]["Proxy"] = Json::Value(Json::arrayValue);
@@ -1300,7 +2329,7 @@ void GetDiagnosticInfo(Json::Value& o_json)
     Json::Value statusHistory = Json::Value(Json::arrayValue);
 
     vector<MessageHistoryEntry> messageHistory;
-    GetMessageHistory(messageHistory);
+    GetMessageHistory(messageHistory, messageHistorySince, &o_messageHistoryNext);
     for (vector<MessageHistoryEntry>::const_iterator entry = messageHistory.begin();
          entry != messageHistory.end();
          entry++)
@@ -1343,6 +2372,27 @@ Json::Value GetPsiCashDiagnosticData() {
     return jsonValue;
 }
 
+#define FEEDBACK_UPLOAD_ATTEMPTS            3
+#define FEEDBACK_UPLOAD_RETRY_DELAY_MS      5000
+
+// What the last diagnostic info upload of the session covered. With
+// incremental feedback, the next upload has only the history since, and a
+// reference to this one for the server to join them up.
+struct FeedbackUploadMark
+{
+    FeedbackUploadMark() : messageHistoryNext(0), diagnosticHistoryNext(0) {}
+
+    // Empty if there's been no upload
+    string feedbackID;
+    ULONG messageHistoryNext;
+    unsigned long long diagnosticHistoryNext;
+    // Serialized, to tell whether it needs sending again
+    string systemInformation;
+};
+
+static Lock g_lastFeedbackUploadLock("LastFeedbackUpload");
+static FeedbackUploadMark g_lastFeedbackUpload;
+
 bool SendFeedbackAndDiagnosticInfo(
         const string& feedback, 
         const string& emailAddress,
@@ -1364,20 +2414,83 @@ bool SendFeedbackAndDiagnosticInfo(
 
     Json::Value outJson(Json::objectValue);
 
+    // The random feedback ID makes it impossible for user-supplied text to
+    // collide with the placeholder.
+    const string diagnosticHistoryPlaceholder = "DIAGNOSTIC_HISTORY_" + feedbackID;
+
     // Metadata
     outJson["Metadata"] = Json::Value(Json::objectValue);
     outJson["Metadata"]["platform"] = "windows";
     outJson["Metadata"]["version"] = 2;
     outJson["Metadata"]["id"] = feedbackID;
 
+    // Only set if this upload follows on from an earlier one
+    FeedbackUploadMark since;
+    if (sendDiagnosticInfo && Settings::IncrementalFeedback())
+    {
+        AutoLock lock(g_lastFeedbackUploadLock);
+        since = g_lastFeedbackUpload;
+    }
+    FeedbackUploadMark uploadMark;
+    uploadMark.feedbackID = feedbackID;
+
+    if (!since.feedbackID.empty())
+    {
+        outJson["Metadata"]["previous_id"] = since.feedbackID;
+    }
+
+    // The diagnostic history can be much the largest part, so it's serialized
+    // on a pool thread while the rest of the diagnostic info is gathered.
+    WriteDiagnosticHistoryParams diagnosticHistoryParams;
+    diagnosticHistoryParams.sinceSequence = since.diagnosticHistoryNext;
+    diagnosticHistoryParams.nextSequence = 0;
+    string& diagnosticHistory = diagnosticHistoryParams.out;
+    HANDLE diagnosticHistoryDone = NULL;
+    auto waitForDiagnosticHistory = [&diagnosticHistoryDone] {
+        if (diagnosticHistoryDone)
+        {
+            WaitForSingleObject(diagnosticHistoryDone, INFINITE);
+            CloseHandle(diagnosticHistoryDone);
+            diagnosticHistoryDone = NULL;
+        }
+    };
+    // Even if gathering the rest throws
+    auto waitOnReturn = finally(waitForDiagnosticHistory);
+
     // Diagnostic info
     if (sendDiagnosticInfo)
     {
+        // A current snapshot, to go with the periodic ones in the history
+        AddDiagnosticInfoJson("ResourceUsage", ResourceUsageJson(GetResourceUsage()));
+
+        diagnosticHistoryDone = ThreadPool::Instance().Run(WriteDiagnosticHistoryThread, &diagnosticHistoryParams);
+        if (!diagnosticHistoryDone)
+        {
+            WriteDiagnosticHistory(diagnosticHistory, diagnosticHistoryParams.sinceSequence, diagnosticHistoryParams.nextSequence);
+        }
+
         outJson["DiagnosticInfo"] = Json::Value(Json::objectValue);
-        GetDiagnosticInfo(outJson["DiagnosticInfo"]);
+        GetDiagnosticInfo(outJson["DiagnosticInfo"], since.messageHistoryNext, uploadMark.messageHistoryNext);
+
+        // It rarely changes within a session, so after the first upload it's
+        // only sent again if it has.
+        uploadMark.systemInformation = Json::FastWriter().write(outJson["DiagnosticInfo"]["SystemInformation"]);
+        if (!since.feedbackID.empty() && uploadMark.systemInformation == since.systemInformation)
+        {
+            outJson["DiagnosticInfo"].removeMember("SystemInformation");
+            outJson["Metadata"]["system_information_unchanged"] = true;
+        }
         
-        outJson["DiagnosticInfo"]["DiagnosticHistory"] = Json::Value(Json::arrayValue);
-        GetDiagnosticHistory(outJson["DiagnosticInfo"]["DiagnosticHistory"]);
+        // Placeholder; the history records are spliced in after serialization.
+        outJson["DiagnosticInfo"]["DiagnosticHistory"] = diagnosticHistoryPlaceholder;
+        outJson["DiagnosticInfo"]["DiagnosticHistoryCounts"] = GetDiagnosticHistoryCounts();
+        outJson["DiagnosticInfo"]["PerformanceBudget"] = PerformanceBudget::Report();
+
+        Json::Value crashedSessionLog;
+        if (GetCrashedSessionRingLog(crashedSessionLog))
+        {
+            outJson["DiagnosticInfo"]["CrashedSessionLog"] = crashedSessionLog;
+        }
 
         outJson["DiagnosticInfo"]["PsiCash"] = GetPsiCashDiagnosticData();
     }
@@ -1405,6 +2518,27 @@ bool SendFeedbackAndDiagnosticInfo(
     Json::FastWriter jsonWriter;
     string outJsonString = jsonWriter.write(outJson);
 
+    if (sendDiagnosticInfo)
+    {
+        string quotedPlaceholder = "\"" + diagnosticHistoryPlaceholder + "\"";
+        size_t placeholderPos = outJsonString.find(quotedPlaceholder);
+        if (placeholderPos != string::npos)
+        {
+            waitForDiagnosticHistory();
+            uploadMark.diagnosticHistoryNext = diagnosticHistoryParams.nextSequence;
+
+            // Assembled in one allocation, and the history is freed as soon
+            // as it's copied: this may be tens of MB.
+            string payload;
+            payload.reserve(outJsonString.length() - quotedPlaceholder.length() + diagnosticHistory.length());
+            payload.append(outJsonString, 0, placeholderPos);
+            payload.append(diagnosticHistory);
+            string().swap(diagnosticHistory);
+            payload.append(outJsonString, placeholderPos + quotedPlaceholder.length(), string::npos);
+            outJsonString.swap(payload);
+        }
+    }
+
     string encryptedPayload;
     if (!PublicKeyEncryptData(
             FEEDBACK_ENCRYPTION_PUBLIC_KEY, 
@@ -1413,29 +2547,61 @@ bool SendFeedbackAndDiagnosticInfo(
     {
         return false;
     }
+    string().swap(outJsonString);
 
     tstring uploadLocation = UTF8ToWString(FEEDBACK_DIAGNOSTIC_INFO_UPLOAD_PATH)
                                 + UTF8ToWString(feedbackID);
-        
-    HTTPSRequest httpsRequest;
-    HTTPSRequest::Response httpsResponse;
-    if (!httpsRequest.MakeRequest(
-            UTF8ToWString(FEEDBACK_DIAGNOSTIC_INFO_UPLOAD_SERVER).c_str(),
-            443,
-            string(), // Do standard cert validation
-            uploadLocation.c_str(),
-            stopInfo,
-            HTTPSRequest::PsiphonProxy::DONT_USE,
-            httpsResponse,
-            true,  // fail over to URL proxy
-            UTF8ToWString(FEEDBACK_DIAGNOSTIC_INFO_UPLOAD_SERVER_HEADERS).c_str(),
-            (LPVOID)encryptedPayload.c_str(),
-            encryptedPayload.length(),
-            _T("PUT")) 
-        || httpsResponse.code != HTTPSRequest::OK)
+
+    // The upload is a single PUT, so a failed one can't be resumed. But it's
+    // retried with the same payload, rather than having it all rebuilt.
+    for (int attempt = 1; ; attempt++)
     {
-        return false;
-    }
+        bool uploaded = false;
+        {
+            // Throws if stop was signaled while waiting. Not held over the
+            // retry delay, so other transfers can go in the meantime.
+            BackgroundTransferTurn turn(BACKGROUND_TRANSFER_PRIORITY_FEEDBACK, stopInfo);
+
+            HTTPSRequest httpsRequest;
+            httpsRequest.SetMetricsName("feedback");
+            HTTPSRequest::Response httpsResponse;
+            uploaded = httpsRequest.MakeRequest(
+                            UTF8ToWString(FEEDBACK_DIAGNOSTIC_INFO_UPLOAD_SERVER).c_str(),
+                            443,
+                            string(), // Do standard cert validation
+                            uploadLocation.c_str(),
+                            stopInfo,
+                            HTTPSRequest::PsiphonProxy::DONT_USE,
+                            httpsResponse,
+                            true,  // fail over to URL proxy
+                            UTF8ToWString(FEEDBACK_DIAGNOSTIC_INFO_UPLOAD_SERVER_HEADERS).c_str(),
+                            (LPVOID)encryptedPayload.c_str(),
+                            encryptedPayload.length(),
+                            _T("PUT"))
+                       && httpsResponse.code == HTTPSRequest::OK;
+        }
 
-    return true;
+        if (uploaded)
+        {
+            if (sendDiagnosticInfo)
+            {
+                AutoLock lock(g_lastFeedbackUploadLock);
+                g_lastFeedbackUpload = uploadMark;
+            }
+            return true;
+        }
+
+        if (attempt >= FEEDBACK_UPLOAD_ATTEMPTS)
+        {
+            return false;
+        }
+
+        my_print(NOT_SENSITIVE, true, _T("%s: upload attempt %d failed; retrying"), __TFUNCTION__, attempt);
+
+        (void)WaitForSingleObject(
+                stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons),
+                FEEDBACK_UPLOAD_RETRY_DELAY_MS * attempt);
+        // Throws if stop was signaled
+        (void)stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+    }
 }
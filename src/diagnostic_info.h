@@ -39,8 +39,8 @@ bool SendFeedbackAndDiagnosticInfo(
 
 // Forward declarations. Do not access directly. (They're only here because the
 // template function needs them.)
-extern vector<string> g_diagnosticInfo;
-void _AddDiagnosticInfoHelper(const char* entry);
+bool _AdmitDiagnosticInfo(const char* message);
+void _AddDiagnosticInfoHelper(const char* message, string&& jsonRecord);
 
 
 /**
@@ -51,15 +51,30 @@ void _AddDiagnosticInfoHelper(const char* entry);
 void AddDiagnosticInfoJson(const char* message, const Json::Value& jsonValue);
 void AddDiagnosticInfoJson(const char* message, const char* jsonString);
 
+/**
+Like AddDiagnosticInfoJson, but `jsonString` is stored as-is, without being
+parsed. It must be a complete, valid JSON value.
+*/
+void AddDiagnosticInfoRawJson(const char* message, const char* jsonString);
+
 
 /**
 `message` is the identifier for this entry.
 `entry` can be of any type that can a Json::Value can handle -- see docs:
 https://open-source-parsers.github.io/jsoncpp-docs/doxygen/class_json_1_1_value.html
+Only the most recent DIAGNOSTIC_HISTORY_MAX_ENTRIES_PER_CATEGORY entries for
+each `message` are retained as they are; older ones are kept compressed, up
+to DIAGNOSTIC_HISTORY_COLD_MAX_BYTES_PER_CATEGORY. High-volume categories are rate limited and
+sampled (see g_diagnosticPolicies); dropped entries are still counted.
 */
 template<typename T>
 void AddDiagnosticInfo(const char* message, const T& entry)
 {
+    if (!_AdmitDiagnosticInfo(message))
+    {
+        return;
+    }
+
     Json::Value json(Json::objectValue);
     json["timestamp!!timestamp"] = WStringToUTF8(GetISO8601DatetimeString());
     json["msg"] = message;
@@ -71,11 +86,64 @@ void AddDiagnosticInfo(const char* message, const T& entry)
     OutputDebugStringA(jsonString.c_str());
     OutputDebugStringA("\n");
 
-    AutoMUTEX mutex(g_diagnosticHistoryMutex);
-    g_diagnosticHistory.append(json);
+    // FastWriter terminates its output with a newline
+    if (!jsonString.empty() && jsonString.back() == '\n')
+    {
+        jsonString.pop_back();
+    }
+
+    _AddDiagnosticInfoHelper(message, std::move(jsonString));
 }
 
 
+//
+// Connect timing
+// Breaks down where the time goes while a connection is being established.
+//
+
+/**
+Starts timing a new connection attempt, discarding any earlier marks.
+*/
+void ConnectTimingStart();
+
+/**
+Records that `phase` has been reached in the current attempt. Only the first
+mark of each phase counts (so, e.g., a reconnecting tunnel doesn't overwrite
+it), and marks made while no attempt is being timed are ignored.
+*/
+void ConnectTimingMark(const char* phase);
+
+/**
+Ends the current attempt. The phases reached, in milliseconds since
+ConnectTimingStart, are written to the debug log and added to the diagnostic
+info as a single "ConnectTiming" entry, followed by the lock stats. The I/O
+done in each phase (see IO_STATS, in utilities.h) goes in an "IoStats" entry.
+*/
+void ConnectTimingReport(bool connected, const tstring& transportName);
+
+/**
+Moves the entries made by ConnectTimingReport since the last call -- the
+last few of them, oldest first -- into o_reports, an array. Returns false if
+there have been none.
+*/
+bool TakeConnectTimings(Json::Value& o_reports);
+
+/**
+Adds the I/O totals since startup (see IO_STATS, in utilities.h) to the
+diagnostic info as an "IoStats" entry for scope (e.g., "startup"), and writes
+them to the debug log. Does nothing in builds without IO_STATS.
+*/
+void IoStatsReport(const char* scope);
+
+
+/**
+Writes the stats of the named locks (see LOCK_STATS, in utilities.h) to the
+debug log and adds them to the diagnostic info as a "LockStats" entry. The
+stats are totals since startup. Does nothing in builds without them.
+*/
+void LockStatsReport();
+
+
 //
 // Utilities
 // Some diagnostic info is useful outside of feedback
@@ -85,3 +153,22 @@ void AddDiagnosticInfo(const char* message, const T& entry)
 std::string GetClientPlatform();
 
 bool GetCountryDialingCode(wstring& o_countryDialingCode);
+
+/**
+Starts collecting the system info that comes from WMI, which is slow, in the
+background. It's cached, so this just gets it ready for whoever needs it
+first; it's collected on demand otherwise.
+*/
+void StartSystemInfoCollection();
+
+/**
+Starts periodically recording the process's memory, handle and thread usage
+in the diagnostic info, and logging when it has grown a lot since startup.
+*/
+void StartResourceUsageMonitor();
+
+/**
+The process's memory, handle and thread usage now, as in the ResourceUsage
+records. For headless soak runs.
+*/
+Json::Value GetResourceUsageSample();
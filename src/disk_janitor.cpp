@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "disk_janitor.h"
+#include "logging.h"
+#include "utilities.h"
+#include "config.h"
+#include "diagnostic_info.h"
+#include "thread_pool.h"
+#include "timer_service.h"
+#include <algorithm>
+
+
+// Well clear of startup and connecting, then a few times a day
+#define DISK_JANITOR_FIRST_RUN_MS                   (10*60*1000)
+#define DISK_JANITOR_INTERVAL_MS                    (6*60*60*1000)
+// In FILETIME units (100 ns)
+#define DISK_JANITOR_HOUR                           (60ULL*60*10000000)
+// A temporary datastore is only needed while its URL proxy runs, which is
+// minutes; then it's just in the way.
+#define DISK_JANITOR_STALE_TEMP_DATASTORE_AGE       (24*DISK_JANITOR_HOUR)
+// Over the budget, any that haven't been touched in this long go, oldest first.
+#define DISK_JANITOR_TEMP_DATASTORE_BUDGET_BYTES    (64*1024*1024)
+#define DISK_JANITOR_MIN_TEMP_DATASTORE_AGE         (1*DISK_JANITOR_HOUR)
+// The replaced binary is only used to roll back a failed pave.
+#define DISK_JANITOR_STALE_ARCHIVE_AGE              (24*DISK_JANITOR_HOUR)
+
+// As extracted by ExtractExecutable, into the temp directory
+static const TCHAR* DISK_JANITOR_EXTRACTED_EXE_NAMES[] = {
+    _T("psiphon-tunnel-core.exe"),
+    _T("psiphon-url-proxy.exe"),
+    _T("psiphon3-polipo.exe")
+};
+
+static TimerService::TimerID g_diskJanitorTimer = 0;
+
+
+struct DiskUsage
+{
+    unsigned long long bytes;
+    unsigned long long files;
+    // The latest write to anything in it, as a FILETIME
+    ULONGLONG lastWriteTime;
+
+    DiskUsage() : bytes(0), files(0), lastWriteTime(0) {}
+};
+
+static ULONGLONG FileTimeValue(const FILETIME& fileTime)
+{
+    return ((ULONGLONG)fileTime.dwHighDateTime << 32) | fileTime.dwLowDateTime;
+}
+
+static ULONGLONG GetCurrentFileTime()
+{
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    return FileTimeValue(now);
+}
+
+// Links aren't followed: what they point to isn't ours.
+static void MeasureDirectory(const tstring& path, DiskUsage& io_usage)
+{
+    WIN32_FIND_DATA findData;
+    HANDLE find = FindFirstFile((path + _T("\\*")).c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    do
+    {
+        if (_tcscmp(findData.cFileName, _T(".")) == 0 || _tcscmp(findData.cFileName, _T("..")) == 0)
+        {
+            continue;
+        }
+
+        io_usage.lastWriteTime = max(io_usage.lastWriteTime, FileTimeValue(findData.ftLastWriteTime));
+
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        {
+            continue;
+        }
+        else if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        {
+            MeasureDirectory(path + _T("\\") + findData.cFileName, io_usage);
+        }
+        else
+        {
+            io_usage.bytes += ((unsigned long long)findData.nFileSizeHigh << 32) | findData.nFileSizeLow;
+            io_usage.files++;
+        }
+    } while (FindNextFile(find, &findData));
+
+    FindClose(find);
+}
+
+// Returns false if anything couldn't be deleted (e.g., it's in use); the
+// rest is still gone.
+static bool DeleteDirectoryTree(const tstring& path)
+{
+    bool deleted = true;
+
+    WIN32_FIND_DATA findData;
+    HANDLE find = FindFirstFile((path + _T("\\*")).c_str(), &findData);
+    if (find != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            if (_tcscmp(findData.cFileName, _T(".")) == 0 || _tcscmp(findData.cFileName, _T("..")) == 0)
+            {
+                continue;
+            }
+
+            tstring childPath = path + _T("\\") + findData.cFileName;
+            if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            {
+                // A link is removed itself, not what it points to.
+                if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+                {
+                    deleted = DeleteDirectoryTree(childPath) && deleted;
+                }
+                else if (!RemoveDirectory(childPath.c_str()))
+                {
+                    deleted = false;
+                }
+            }
+            else
+            {
+                if (findData.dwFileAttributes & FILE_ATTRIBUTE_READONLY)
+                {
+                    (void)SetFileAttributes(childPath.c_str(), FILE_ATTRIBUTE_NORMAL);
+                }
+                if (!DeleteFile(childPath.c_str()))
+                {
+                    deleted = false;
+                }
+            }
+        } while (FindNextFile(find, &findData));
+
+        FindClose(find);
+    }
+
+    return RemoveDirectory(path.c_str()) && deleted;
+}
+
+// Where the core keeps its database under a data root, and where it kept it
+// before DataRootDirectory (it's migrated from there)
+static const TCHAR* DISK_JANITOR_DATASTORE_DB_PATHS[] = {
+    _T("ca.psiphon.PsiphonTunnel.tunnel-core\\datastore\\psiphon.boltdb"),
+    _T("psiphon.boltdb")
+};
+
+// Returns true if a core may still be using the datastore at path: its
+// database can't be opened exclusively. A directory's timestamps don't change
+// when an open file in it is written, so io_lastWriteTime is brought up to
+// date from the database itself.
+static bool IsDatastoreInUse(const tstring& path, ULONGLONG& io_lastWriteTime)
+{
+    for (size_t i = 0; i < _countof(DISK_JANITOR_DATASTORE_DB_PATHS); i++)
+    {
+        tstring dbPath = path + _T("\\") + DISK_JANITOR_DATASTORE_DB_PATHS[i];
+        HANDLE file = CreateFile(
+                        dbPath.c_str(),
+                        GENERIC_READ,
+                        0, // no sharing: fails if the core has it open
+                        NULL,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            DWORD error = GetLastError();
+            if (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND)
+            {
+                continue;
+            }
+            return true;
+        }
+
+        FILETIME lastWriteTime;
+        if (GetFileTime(file, NULL, NULL, &lastWriteTime))
+        {
+            io_lastWriteTime = max(io_lastWriteTime, FileTimeValue(lastWriteTime));
+        }
+        CloseHandle(file);
+    }
+
+    return false;
+}
+
+struct TempDatastore
+{
+    tstring path;
+    DiskUsage usage;
+};
+
+// The unique temp directories that hold a URL proxy config are our datastores.
+static void FindTempDatastores(const tstring& tempPath, vector<TempDatastore>& o_datastores)
+{
+    o_datastores.clear();
+
+    WIN32_FIND_DATA findData;
+    HANDLE find = FindFirstFile((tempPath + _T("\\{*}")).c_str(), &findData);
+    if (find == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    do
+    {
+        if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            || (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+        {
+            continue;
+        }
+
+        TempDatastore datastore;
+        datastore.path = tempPath + _T("\\") + findData.cFileName;
+        tstring configPath = datastore.path + _T("\\") + LOCAL_SETTINGS_APPDATA_URL_PROXY_CONFIG_FILENAME;
+        if (GetFileAttributes(configPath.c_str()) == INVALID_FILE_ATTRIBUTES)
+        {
+            continue;
+        }
+
+        datastore.usage.lastWriteTime = FileTimeValue(findData.ftLastWriteTime);
+        MeasureDirectory(datastore.path, datastore.usage);
+        o_datastores.push_back(datastore);
+    } while (FindNextFile(find, &findData));
+
+    FindClose(find);
+}
+
+static void RunDiskJanitor()
+{
+    ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
+    ULONGLONG now = GetCurrentFileTime();
+    unsigned long long removedCount = 0, removedBytes = 0;
+    Json::Value report;
+
+    tstring tempPath;
+    if (GetTempPath(tempPath))
+    {
+        // GetTempPath leaves a trailing separator
+        while (!tempPath.empty() && (tempPath.back() == _T('\\') || tempPath.back() == _T('/')))
+        {
+            tempPath.pop_back();
+        }
+
+        vector<TempDatastore> datastores;
+        FindTempDatastores(tempPath, datastores);
+
+        std::sort(datastores.begin(), datastores.end(),
+            [](const TempDatastore& a, const TempDatastore& b) { return a.usage.lastWriteTime < b.usage.lastWriteTime; });
+
+        unsigned long long totalBytes = 0;
+        for (const auto& datastore : datastores)
+        {
+            totalBytes += datastore.usage.bytes;
+        }
+
+        size_t remaining = datastores.size();
+        for (auto& datastore : datastores)
+        {
+            // A datastore a core still holds is left whole. Deleting it would
+            // only stop at the locked database, after the config and the rest
+            // were gone.
+            bool inUse = IsDatastoreInUse(datastore.path, datastore.usage.lastWriteTime);
+
+            ULONGLONG age = now > datastore.usage.lastWriteTime ? now - datastore.usage.lastWriteTime : 0;
+            bool stale = age >= DISK_JANITOR_STALE_TEMP_DATASTORE_AGE;
+            bool overBudget = totalBytes > DISK_JANITOR_TEMP_DATASTORE_BUDGET_BYTES
+                              && age >= DISK_JANITOR_MIN_TEMP_DATASTORE_AGE;
+            if (inUse || (!stale && !overBudget))
+            {
+                continue;
+            }
+
+            if (DeleteDirectoryTree(datastore.path))
+            {
+                totalBytes -= datastore.usage.bytes;
+                removedBytes += datastore.usage.bytes;
+                removedCount++;
+                remaining--;
+            }
+        }
+
+        report["tempDatastores"] = (Json::UInt64)remaining;
+        report["tempDatastoreBytes"] = (Json::UInt64)totalBytes;
+
+        unsigned long long extractedBytes = 0;
+        for (size_t i = 0; i < _countof(DISK_JANITOR_EXTRACTED_EXE_NAMES); i++)
+        {
+            WIN32_FILE_ATTRIBUTE_DATA attributes;
+            tstring exePath = tempPath + _T("\\") + DISK_JANITOR_EXTRACTED_EXE_NAMES[i];
+            if (GetFileAttributesEx(exePath.c_str(), GetFileExInfoStandard, &attributes))
+            {
+                extractedBytes += ((unsigned long long)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+            }
+        }
+        report["extractedExecutableBytes"] = (Json::UInt64)extractedBytes;
+    }
+
+    // Left beside the new binary by PaveUpgrade
+    TCHAR filename[1000];
+    if (GetModuleFileName(NULL, filename, 1000))
+    {
+        tstring archiveFilename = tstring(filename) + _T(".orig");
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (GetFileAttributesEx(archiveFilename.c_str(), GetFileExInfoStandard, &attributes)
+            && now > FileTimeValue(attributes.ftLastWriteTime)
+            && now - FileTimeValue(attributes.ftLastWriteTime) >= DISK_JANITOR_STALE_ARCHIVE_AGE
+            && DeleteFile(archiveFilename.c_str()))
+        {
+            removedBytes += ((unsigned long long)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+            removedCount++;
+        }
+    }
+
+    tstring dataDirectory;
+    DiskUsage dataUsage;
+    if (GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, false, dataDirectory))
+    {
+        MeasureDirectory(dataDirectory, dataUsage);
+    }
+    report["dataDirectoryBytes"] = (Json::UInt64)dataUsage.bytes;
+    report["dataDirectoryFiles"] = (Json::UInt64)dataUsage.files;
+    report["removed"] = (Json::UInt64)removedCount;
+    report["removedBytes"] = (Json::UInt64)removedBytes;
+
+    AddDiagnosticInfoJson("DiskUsage", report);
+
+    my_print(NOT_SENSITIVE, true, _T("%s: data directory %llu bytes in %llu files; removed %llu items, %llu bytes"),
+        __TFUNCTION__, dataUsage.bytes, dataUsage.files, removedCount, removedBytes);
+}
+
+static void DiskJanitorTimerCallback()
+{
+    try
+    {
+        RunDiskJanitor();
+    }
+    catch (std::exception& ex)
+    {
+        my_print(NOT_SENSITIVE, true, string("Disk janitor failed: ") + ex.what());
+    }
+}
+
+void StartDiskJanitor()
+{
+    if (g_diskJanitorTimer)
+    {
+        return;
+    }
+
+    // Left running for the life of the process.
+    g_diskJanitorTimer = TimerService::Instance().Schedule(
+                            DISK_JANITOR_FIRST_RUN_MS,
+                            DISK_JANITOR_INTERVAL_MS,
+                            DiskJanitorTimerCallback);
+    if (!g_diskJanitorTimer)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: TimerService::Schedule failed"), __TFUNCTION__);
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+/*
+Keeps what we leave on disk from piling up. Every so often, at background
+priority, it:
+- removes the temporary datastores of URL proxy cores that couldn't get a
+  slot (see GetUniqueTempDir), once they're stale -- or sooner, oldest first,
+  while they're over a budget; one that's still in use is locked by its core
+  and is skipped;
+- removes the archive of the binary an upgrade replaced, once it's stale;
+- records how much space the data directory, the temporary datastores and
+  the extracted executables take, in the diagnostic info.
+Bloated directories are slow for the core to open and for antivirus scans to
+get through at every start.
+*/
+void StartDiskJanitor();
@@ -1,106 +1,288 @@
 #include "stdafx.h"
 #include "dispatch_queue.h"
+#include "thread_pool.h"
+#include "logging.h"
 
 using namespace std;
 
 
 dispatch_queue::dispatch_queue(std::string name, size_t thread_cnt) :
-    name_(name), threads_(thread_cnt)
+    name_(name), thread_cnt_(thread_cnt)
 {
-    printf("Creating dispatch queue: %s\n", name.c_str());
-    printf("Dispatch threads: %zu\n", thread_cnt);
+    // Logged rather than printed: stdout may be the headless report.
+    my_print(NOT_SENSITIVE, true, _T("%s: %S, concurrency %d"), __TFUNCTION__, name.c_str(), (int)thread_cnt);
 
-    for (size_t i = 0; i < threads_.size(); i++)
-    {
-        threads_[i] = std::thread(&dispatch_queue::dispatch_thread_handler, this);
+    timer_queue_ = CreateTimerQueue();
+    if (!timer_queue_) {
+        // Immediate dispatches still work; timers won't fire.
+        my_print(NOT_SENSITIVE, false, _T("%s: CreateTimerQueue failed (%d)"), __TFUNCTION__, GetLastError());
     }
 }
 
 dispatch_queue::~dispatch_queue()
 {
-    printf("Destructor: Destroying dispatch threads...\n");
-
-    // Signal to dispatch threads that it's time to wrap up
-    std::unique_lock<std::mutex> lock(lock_);
-    quit_ = true;
-    lock.unlock();
-    cv_.notify_all();
+    my_print(NOT_SENSITIVE, true, _T("%s: %S: waiting for running ops"), __TFUNCTION__, name_.c_str());
 
-    // Wait for threads to finish before we exit
-    for (size_t i = 0; i < threads_.size(); i++)
+    // Queued ops are dropped; running ones are waited for.
+    HANDLE timer_queue = NULL;
     {
-        if (threads_[i].joinable())
-        {
-            printf("Destructor: Joining thread %zu until completion\n", i);
-            threads_[i].join();
-        }
+        std::unique_lock<std::mutex> lock(lock_);
+        quit_ = true;
+        cv_.wait(lock, [this] {
+            return draining_ == 0;
+        });
+        timer_queue = timer_queue_;
+        timer_queue_ = NULL;
+        armed_timer_ = NULL;
+    }
+
+    // Also waits for any timer callback in progress, which needs lock_.
+    if (timer_queue) {
+        (void)DeleteTimerQueueEx(timer_queue, INVALID_HANDLE_VALUE);
     }
 }
 
-bool dispatch_queue::dispatch(int op_type, const vector<int>& skip_if_op_type_queued, const fp_t& op)
+bool dispatch_queue::is_op_queued(int op_type) const
 {
-    std::unique_lock<std::mutex> lock(lock_);
+    auto it = pending_.find(op_type);
+    return it != pending_.end() && it->second > 0;
+}
 
-    for (const auto& qop : q_) {
-        for (const auto& skip : skip_if_op_type_queued) {
-            if (skip == qop.first) {
-                return false;
+void dispatch_queue::enqueue(int op_type, fp_t&& op, priority pri, int key)
+{
+    q_[(size_t)pri].push_back(queued_op{ op_type, key == key_op_type ? op_type : key, std::move(op) });
+    pending_[op_type]++;
+}
+
+bool dispatch_queue::take_next(fp_t& o_op, int& o_key)
+{
+    // Skipping an op whose key is running also skips the rest with that
+    // key, as they're behind it; so each key's ops stay in order.
+    for (auto& lane : q_) {
+        for (auto it = lane.begin(); it != lane.end(); ++it) {
+            if (running_keys_.count(it->key) > 0) {
+                continue;
             }
+            o_op = std::move(it->op);
+            o_key = it->key;
+            pending_[it->op_type]--;
+            lane.erase(it);
+            running_keys_.insert(o_key);
+            return true;
         }
     }
-    q_.emplace_back(op_type, op);
+    return false;
+}
 
-    // Manual unlocking is done before notifying, to avoid waking up
-    // the waiting thread only to block again (see notify_one for details)
-    lock.unlock();
-    cv_.notify_all();
+bool dispatch_queue::dispatch(int op_type, const vector<int>& skip_if_op_type_queued, const fp_t& op, priority pri, int key)
+{
+    return dispatch(op_type, skip_if_op_type_queued, fp_t(op), pri, key);
+}
+
+bool dispatch_queue::dispatch(int op_type, const vector<int>& skip_if_op_type_queued, fp_t&& op, priority pri, int key)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    for (const auto& skip : skip_if_op_type_queued) {
+        if (is_op_queued(skip)) {
+            return false;
+        }
+    }
+    enqueue(op_type, std::move(op), pri, key);
+    start_drains();
 
     return true;
 }
 
-bool dispatch_queue::dispatch(int op_type, const vector<int>& skip_if_op_type_queued, fp_t&& op)
+bool dispatch_queue::dispatch_replace(int op_type, fp_t&& op, priority pri, int key)
 {
     std::unique_lock<std::mutex> lock(lock_);
 
-    for (const auto& qop : q_) {
-        for (const auto& skip : skip_if_op_type_queued) {
-            if (skip == qop.first) {
-                return false;
+    if (is_op_queued(op_type)) {
+        // Replace the newest queued op of this type; with this method there
+        // will only ever be one. It stays in its lane.
+        for (auto& lane : q_) {
+            for (auto it = lane.rbegin(); it != lane.rend(); ++it) {
+                if (it->op_type == op_type) {
+                    it->op = std::move(op);
+                    return true;
+                }
             }
         }
     }
-    q_.emplace_back(op_type, std::move(op));
+    enqueue(op_type, std::move(op), pri, key);
+    start_drains();
 
-    // Manual unlocking is done before notifying, to avoid waking up
-    // the waiting thread only to block again (see notify_one for details)
-    lock.unlock();
-    cv_.notify_all();
+    return false;
+}
 
-    return true;
+dispatch_queue::timer_id dispatch_queue::add_timer(int op_type, clock_type::duration delay, clock_type::duration interval, fp_t&& op, priority pri, int key)
+{
+    timer_id id = next_timer_id_++;
+    timers_[id] = timer_entry{ op_type, key, pri, interval, std::move(op) };
+    timer_due_.emplace(clock_type::now() + delay, id);
+    return id;
 }
 
-void dispatch_queue::dispatch_thread_handler(void)
+dispatch_queue::timer_id dispatch_queue::dispatch_after(int op_type, std::chrono::milliseconds delay, fp_t&& op, priority pri, int key)
 {
     std::unique_lock<std::mutex> lock(lock_);
+    timer_id id = add_timer(op_type, delay, clock_type::duration::zero(), std::move(op), pri, key);
+    arm_timer();
 
-    do {
-        //Wait until we have data or a quit signal
-        cv_.wait(lock, [this] {
-            return (q_.size() || quit_);
-        });
+    return id;
+}
+
+dispatch_queue::timer_id dispatch_queue::dispatch_every(int op_type, std::chrono::milliseconds interval, fp_t&& op, priority pri, int key)
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    timer_id id = add_timer(op_type, interval, interval, std::move(op), pri, key);
+    arm_timer();
 
-        //after wait, we own the lock
-        if (!quit_ && q_.size())
-        {
-            auto op = std::move(q_.front().second);
-            q_.pop_front();
+    return id;
+}
 
-            //unlock now that we're done messing with the queue
-            lock.unlock();
+bool dispatch_queue::cancel(timer_id id)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return timers_.erase(id) > 0;
+}
 
-            op();
+void dispatch_queue::promote_due_timers()
+{
+    auto now = clock_type::now();
+
+    while (!timer_due_.empty() && timer_due_.top().first <= now) {
+        timer_id id = timer_due_.top().second;
+        timer_due_.pop();
+
+        auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            // Cancelled
+            continue;
+        }
+
+        timer_entry& timer = it->second;
+        if (timer.interval == clock_type::duration::zero()) {
+            enqueue(timer.op_type, std::move(timer.op), timer.pri, timer.key);
+            timers_.erase(it);
+            continue;
+        }
 
-            lock.lock();
+        if (!is_op_queued(timer.op_type)) {
+            enqueue(timer.op_type, fp_t(timer.op), timer.pri, timer.key);
         }
-    } while (!quit_);
+
+        // Scheduled from now rather than from when it was due, so a long
+        // stall doesn't produce a burst of catch-up runs.
+        timer_due_.emplace(now + timer.interval, id);
+    }
+}
+
+void dispatch_queue::start_drains()
+{
+    size_t queued = 0;
+    for (const auto& lane : q_) {
+        queued += lane.size();
+    }
+
+    // A drain that finds nothing left just finishes, so erring high is fine.
+    for (size_t started = 0; !quit_ && draining_ < thread_cnt_ && started < queued; started++) {
+        if (!ThreadPool::Instance().Post([this] { drain(); })) {
+            // The ops stay queued for the next dispatch to try again.
+            my_print(NOT_SENSITIVE, false, _T("%s: %S: failed to post drain"), __TFUNCTION__, name_.c_str());
+            break;
+        }
+        draining_++;
+    }
+}
+
+void dispatch_queue::arm_timer()
+{
+    if (quit_ || !timer_queue_ || timer_due_.empty()) {
+        return;
+    }
+
+    auto due = timer_due_.top().first;
+    if (armed_timer_ && armed_due_ <= due) {
+        return;
+    }
+
+    if (armed_timer_) {
+        // Doesn't wait for a callback that's already running; that's harmless.
+        (void)DeleteTimerQueueTimer(timer_queue_, armed_timer_, NULL);
+        armed_timer_ = NULL;
+    }
+
+    // Rounded up, so it doesn't fire just before the timer is due.
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(due - clock_type::now()).count() + 1;
+    if (delay < 0) {
+        delay = 0;
+    }
+
+    if (!CreateTimerQueueTimer(
+            &armed_timer_,
+            timer_queue_,
+            timer_callback,
+            this,
+            (DWORD)delay,
+            0, // one-shot
+            WT_EXECUTEINTIMERTHREAD | WT_EXECUTEONLYONCE)) {
+        my_print(NOT_SENSITIVE, false, _T("%s: CreateTimerQueueTimer failed (%d)"), __TFUNCTION__, GetLastError());
+        armed_timer_ = NULL;
+        return;
+    }
+    armed_due_ = due;
+}
+
+// static
+void CALLBACK dispatch_queue::timer_callback(PVOID context, BOOLEAN /*timer_or_wait_fired*/)
+{
+    dispatch_queue* self = (dispatch_queue*)context;
+
+    std::lock_guard<std::mutex> lock(self->lock_);
+
+    if (self->quit_) {
+        return;
+    }
+
+    // This is (almost always) the armed timer firing. If it's an older one
+    // that was replaced just as it fired, the armed one is re-created below.
+    if (self->armed_timer_) {
+        (void)DeleteTimerQueueTimer(self->timer_queue_, self->armed_timer_, NULL);
+        self->armed_timer_ = NULL;
+    }
+
+    self->promote_due_timers();
+    self->start_drains();
+    self->arm_timer();
+}
+
+void dispatch_queue::drain()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (!quit_) {
+        promote_due_timers();
+        arm_timer();
+
+        // Ops whose keys are running are left for the drains running them,
+        // which carry on with them once they're done.
+        fp_t op;
+        int key;
+        if (!take_next(op, key)) {
+            break;
+        }
+
+        //unlock now that we're done messing with the queue
+        lock.unlock();
+
+        op();
+
+        lock.lock();
+        running_keys_.erase(key);
+    }
+
+    draining_--;
+    cv_.notify_all();
 }
@@ -8,18 +8,58 @@
 #include <mutex>
 #include <vector>
 #include <deque>
+#include <unordered_map>
+#include <queue>
+#include <chrono>
+#include <unordered_set>
+#include <climits>
 
+// Ops run on the process-wide ThreadPool; thread_cnt is how many of them may
+// run at once, not a count of dedicated threads.
+// Each op has an ordering key: ops with the same key run one at a time, in
+// the order they were queued (but see priority); ops with different keys may
+// run at the same time. The key is the op's type unless it's given.
 class dispatch_queue {
     typedef std::function<void(void)> fp_t;
+    typedef std::chrono::steady_clock clock_type;
 
 public:
+    // Queued interactive ops all run before any queued background op.
+    // Ops within a lane run in the order they were queued.
+    enum class priority : size_t {
+        interactive,
+        background,
+        count
+    };
+
+    typedef uint64_t timer_id;
+
+    // As an ordering key: use the op's type
+    static constexpr int key_op_type = INT_MIN;
+
     dispatch_queue(std::string name, size_t thread_cnt = 1);
     ~dispatch_queue();
 
     // dispatch and copy
-    bool dispatch(int op_type, const vector<int>& skip_if_op_queued, const fp_t& op);
+    bool dispatch(int op_type, const vector<int>& skip_if_op_queued, const fp_t& op, priority pri = priority::background, int key = key_op_type);
     // dispatch and move
-    bool dispatch(int op_type, const vector<int>& skip_if_op_queued, fp_t&& op);
+    bool dispatch(int op_type, const vector<int>& skip_if_op_queued, fp_t&& op, priority pri = priority::background, int key = key_op_type);
+
+    // "Latest wins": if an op of op_type is already queued (not yet running),
+    // its closure is replaced with this one, keeping its place in the queue
+    // and its key. Otherwise op is queued as usual. Returns true if an op was
+    // replaced.
+    bool dispatch_replace(int op_type, fp_t&& op, priority pri = priority::background, int key = key_op_type);
+
+    // Queues op once delay has passed.
+    timer_id dispatch_after(int op_type, std::chrono::milliseconds delay, fp_t&& op, priority pri = priority::background, int key = key_op_type);
+    // Queues op every interval, starting one interval from now. If the
+    // previous run of op_type is still queued when it's due, that one is
+    // left to run instead; runs don't pile up behind slow work.
+    timer_id dispatch_every(int op_type, std::chrono::milliseconds interval, fp_t&& op, priority pri = priority::background, int key = key_op_type);
+    // Stops a timer. An op the timer has already queued still runs.
+    // Returns false if there's no such timer (e.g., a one-shot that's fired).
+    bool cancel(timer_id id);
 
     // Deleted operations
     dispatch_queue(const dispatch_queue& rhs) = delete;
@@ -28,12 +68,62 @@ public:
     dispatch_queue& operator=(dispatch_queue&& rhs) = delete;
 
 private:
+    struct queued_op {
+        int op_type;
+        int key;
+        fp_t op;
+    };
+    struct timer_entry {
+        int op_type;
+        int key;
+        priority pri;
+        clock_type::duration interval; // zero for a one-shot
+        fp_t op;
+    };
+    // Next due time, ordered soonest first. Cancelled timers are left in
+    // here until they come due, rather than searched for.
+    typedef std::pair<clock_type::time_point, timer_id> timer_due_t;
+
     std::string name_;
     std::mutex lock_;
-    std::vector<std::thread> threads_;
-    std::deque<std::pair<int, fp_t>> q_;
+    size_t thread_cnt_;
+    // Drain tasks posted to the pool and not yet finished
+    size_t draining_ = 0;
+    std::deque<queued_op> q_[(size_t)priority::count];
+    // Number of queued ops of each type, so skip checks don't scan q_
+    std::unordered_map<int, size_t> pending_;
+    // Keys of the ops that are running
+    std::unordered_set<int> running_keys_;
+    std::unordered_map<timer_id, timer_entry> timers_;
+    std::priority_queue<timer_due_t, std::vector<timer_due_t>, std::greater<timer_due_t>> timer_due_;
+    timer_id next_timer_id_ = 1;
+    // A one-shot Win32 timer, armed for the soonest due time
+    HANDLE timer_queue_ = NULL;
+    HANDLE armed_timer_ = NULL;
+    clock_type::time_point armed_due_;
+    // Signalled as drains finish, for the destructor
     std::condition_variable cv_;
     bool quit_ = false;
 
-    void dispatch_thread_handler(void);
+    // Must be called with lock_ held
+    bool is_op_queued(int op_type) const;
+    // Must be called with lock_ held; the caller calls start_drains
+    void enqueue(int op_type, fp_t&& op, priority pri, int key);
+    // Must be called with lock_ held; the caller calls arm_timer
+    timer_id add_timer(int op_type, clock_type::duration delay, clock_type::duration interval, fp_t&& op, priority pri, int key);
+    // Must be called with lock_ held. Queues the ops of timers that are due.
+    void promote_due_timers();
+    // Must be called with lock_ held. Takes the first queued op, in priority
+    // order, whose key isn't running, and marks its key as running. Returns
+    // false if there's no such op.
+    bool take_next(fp_t& o_op, int& o_key);
+    // Must be called with lock_ held. Posts drains to the pool for queued
+    // ops, up to thread_cnt_ at a time.
+    void start_drains();
+    // Must be called with lock_ held
+    void arm_timer();
+
+    // Runs queued ops on a pool thread until there are none
+    void drain();
+    static void CALLBACK timer_callback(PVOID context, BOOLEAN timer_or_wait_fired);
 };
@@ -0,0 +1,1018 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "headless.h"
+#include "coretransport.h"
+#include "vpntransport.h"
+#include "diagnostic_info.h"
+#include "transport_benchmark.h"
+#include "microbenchmarks.h"
+#include "concurrency_stress.h"
+#include "proxy_load.h"
+#include "system_proxy_benchmark.h"
+#include "scripted_core.h"
+#include "psiclient.h"
+#include "thread_pool.h"
+#include "logging.h"
+#include "usersettings.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+// How often the connect timings are collected and the timeout is checked
+#define HEADLESS_POLL_INTERVAL_MS           250
+// The connect timing is reported just after the state changes to connected;
+// the run waits this long for it before exiting anyway.
+#define HEADLESS_CONNECT_TIMING_WAIT_MS     5000
+// --soak: how often the resource usage is written, and the growth, from the
+// first connect to the last, that fails the run
+#define HEADLESS_SOAK_SAMPLE_INTERVAL_MS            (60*1000)
+#define HEADLESS_SOAK_MAX_PRIVATE_BYTES_GROWTH      (20*1024*1024)
+#define HEADLESS_SOAK_MAX_HANDLE_GROWTH             200
+#define HEADLESS_SOAK_MAX_THREAD_GROWTH             10
+
+enum HeadlessExitOn
+{
+    HEADLESS_EXIT_ON_CONNECTED,
+    HEADLESS_EXIT_ON_STOPPED,
+    HEADLESS_EXIT_ON_NEVER
+};
+
+// Set by ParseCommandLine; everything else is only touched by the main
+// window thread.
+static bool g_headlessEnabled = false;
+static bool g_headlessConnect = false;
+static bool g_headlessBenchmark = false;
+static bool g_headlessMicrobenchmark = false;
+static bool g_headlessStress = false;
+static bool g_headlessProxyLoad = false;
+static bool g_headlessSystemProxyBenchmark = false;
+static ProxyLoad::Target g_headlessProxyLoadTarget;
+static bool g_headlessReport = true;
+static HeadlessExitOn g_headlessExitOn = HEADLESS_EXIT_ON_CONNECTED;
+static DWORD g_headlessTimeoutMs = 0;
+static DWORD g_headlessCycles = 0;
+static DWORD g_headlessSoakMs = 0;
+static string g_headlessCommandLineError;
+
+static HWND g_headlessWnd = NULL;
+static HANDLE g_headlessOutput = NULL;
+static DWORD g_headlessStartTime = 0;
+static int g_headlessExitCode = HEADLESS_EXIT_DONE;
+static bool g_headlessExiting = false;
+// When the state last became connected; 0 while it isn't
+static DWORD g_headlessConnectedTime = 0;
+// Whether a successful attempt's timing has been written since then
+static bool g_headlessConnectTimingSeen = false;
+
+// --cycles: the connects done so far, and their timings
+static DWORD g_headlessCyclesDone = 0;
+static vector<Json::Value> g_headlessCycleTimings;
+static vector<DWORD> g_headlessCycleStopMilliseconds;
+// When the connection was toggled off; 0 while it isn't being stopped
+static DWORD g_headlessCycleStopTime = 0;
+// Set once it's stopped, for the poll timer to connect again
+static bool g_headlessCycleRestart = false;
+
+// --soak: the resource usage at the first connect, and when it was last
+// written
+static Json::Value g_headlessSoakBaseline;
+static bool g_headlessSoakHasBaseline = false;
+static DWORD g_headlessSoakLastSampleTime = 0;
+
+// --proxy-load: set once it's connected and the load is started
+static bool g_headlessProxyLoadStarted = false;
+
+// Handed from a background run's thread (see RunInBackground) to the poll
+// timer, which writes the events, and exits once the run is done.
+static Lock g_headlessBackgroundLock("HeadlessBackground");
+static vector<pair<string, Json::Value>> g_headlessBackgroundEvents;
+static bool g_headlessBackgroundDone = false;
+static int g_headlessBackgroundExitCode = HEADLESS_EXIT_DONE;
+static string g_headlessBackgroundExitReason;
+
+
+static const char* ExitOnName(HeadlessExitOn exitOn)
+{
+    switch (exitOn)
+    {
+    case HEADLESS_EXIT_ON_CONNECTED:    return "connected";
+    case HEADLESS_EXIT_ON_STOPPED:      return "stopped";
+    }
+    return "never";
+}
+
+static const char* StateName(ConnectionManagerState state)
+{
+    switch (state)
+    {
+    case CONNECTION_MANAGER_STATE_STOPPED:      return "stopped";
+    case CONNECTION_MANAGER_STATE_STARTING:     return "starting";
+    case CONNECTION_MANAGER_STATE_CONNECTED:    return "connected";
+    case CONNECTION_MANAGER_STATE_STOPPING:     return "stopping";
+    }
+    return "unknown";
+}
+
+// Writes json, as one line, with the event name and the time since the run
+// started.
+static void Emit(const char* event, Json::Value&& json)
+{
+    if (!g_headlessReport || !g_headlessOutput)
+    {
+        return;
+    }
+
+    json["event"] = event;
+    json["ms"] = (Json::UInt)(GetTickCount() - g_headlessStartTime);
+
+    // FastWriter ends the line
+    Json::FastWriter jsonWriter;
+    string line = jsonWriter.write(json);
+
+    // If the reader has gone, the run still goes on to its exit condition.
+    DWORD written = 0;
+    (void)WriteFile(g_headlessOutput, line.data(), (DWORD)line.length(), &written, NULL);
+}
+
+static void Exit(int exitCode, const char* reason)
+{
+    if (g_headlessExiting)
+    {
+        return;
+    }
+    g_headlessExiting = true;
+    g_headlessExitCode = exitCode;
+
+    Json::Value json;
+    json["reason"] = reason;
+    json["code"] = exitCode;
+    Emit("exit", std::move(json));
+
+    // Closing the window stops the connection, reverting the system proxy
+    // settings, as for any other exit.
+    PostMessage(g_headlessWnd, WM_CLOSE, 0, 0);
+}
+
+// For a background run's thread: the event is written by the poll timer.
+static void PostEvent(const char* event, Json::Value&& json)
+{
+    AutoLock lock(g_headlessBackgroundLock);
+    g_headlessBackgroundEvents.push_back(make_pair(string(event), std::move(json)));
+}
+
+// For a background run's thread: the run exits once the events it's posted
+// are written.
+static void PostExit(int exitCode, const char* reason)
+{
+    AutoLock lock(g_headlessBackgroundLock);
+    g_headlessBackgroundExitCode = exitCode;
+    g_headlessBackgroundExitReason = reason;
+    g_headlessBackgroundDone = true;
+}
+
+// Writes what the background run has posted, and exits once it's done.
+static void CheckBackgroundRun()
+{
+    vector<pair<string, Json::Value>> events;
+    bool done = false;
+    int exitCode = HEADLESS_EXIT_DONE;
+    string reason;
+
+    {
+        AutoLock lock(g_headlessBackgroundLock);
+        events.swap(g_headlessBackgroundEvents);
+        done = g_headlessBackgroundDone;
+        exitCode = g_headlessBackgroundExitCode;
+        reason = g_headlessBackgroundExitReason;
+    }
+
+    for (auto& event : events)
+    {
+        Emit(event.first.c_str(), std::move(event.second));
+    }
+
+    if (done)
+    {
+        Exit(exitCode, reason.c_str());
+    }
+}
+
+// Runs run on a pool thread. It reports through PostEvent, and must end with
+// PostExit; if the app exits first, nothing more is reported.
+static void RunInBackground(std::function<void(const StopInfo&)> run)
+{
+    auto task = [run]
+    {
+        try
+        {
+            run(StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL));
+        }
+        catch (StopSignal::StopException&)
+        {
+            // Exiting; nothing is reported.
+        }
+    };
+
+    if (!ThreadPool::Instance().Post(task))
+    {
+        Headless::Fail("ThreadPoolPostFailed");
+        Exit(HEADLESS_EXIT_ERROR, "error");
+    }
+}
+
+// --benchmark
+static void RunBenchmark(const StopInfo& stopInfo)
+{
+    vector<TransportBenchmark::Result> results;
+    bool connected = TransportBenchmark::Run(stopInfo, results);
+
+    for (const auto& result : results)
+    {
+        PostEvent("benchmark", result.ToJson());
+    }
+
+    Json::Value json;
+    json["transport"] = WStringToUTF8(TransportBenchmark::GetRecommendedTransport());
+    json["current"] = WStringToUTF8(Settings::Transport());
+    PostEvent("recommendation", std::move(json));
+
+    if (connected)
+    {
+        PostExit(HEADLESS_EXIT_DONE, "benchmarked");
+    }
+    else
+    {
+        PostExit(HEADLESS_EXIT_STOPPED, "stopped");
+    }
+}
+
+// --microbenchmark
+static void RunMicrobenchmarks(const StopInfo& stopInfo)
+{
+    Microbenchmarks::Run(stopInfo, [](const Microbenchmarks::Result& result)
+    {
+        PostEvent("microbenchmark", result.ToJson());
+    });
+
+    PostExit(HEADLESS_EXIT_DONE, "microbenchmarked");
+}
+
+// --stress
+static void RunStress(const StopInfo& stopInfo)
+{
+    try
+    {
+        ConcurrencyStress::Run(stopInfo, [](const ConcurrencyStress::Result& result)
+        {
+            PostEvent("stress", result.ToJson());
+        });
+    }
+    catch (StopSignal::StopException&)
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        Json::Value json;
+        json["error"] = string("StressFailed: ") + e.what();
+        PostEvent("error", std::move(json));
+        PostExit(HEADLESS_EXIT_ERROR, "error");
+        return;
+    }
+
+    PostExit(HEADLESS_EXIT_DONE, "stressed");
+}
+
+// --system-proxy-benchmark
+static void RunSystemProxyBenchmark(const StopInfo& stopInfo)
+{
+    try
+    {
+        SystemProxyBenchmark::Run(stopInfo, [](const SystemProxyBenchmark::Result& result)
+        {
+            PostEvent("systemProxyBenchmark", result.ToJson());
+        });
+    }
+    catch (StopSignal::StopException&)
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        Json::Value json;
+        json["error"] = string("SystemProxyBenchmarkFailed: ") + e.what();
+        PostEvent("error", std::move(json));
+        PostExit(HEADLESS_EXIT_ERROR, "error");
+        return;
+    }
+
+    PostExit(HEADLESS_EXIT_DONE, "systemProxyBenchmarked");
+}
+
+// --proxy-load, once connected
+static void RunProxyLoad(const StopInfo& stopInfo, const ProxyLoad::Target& target)
+{
+    try
+    {
+        ProxyLoad::Run(stopInfo, target, [](const ProxyLoad::Result& result)
+        {
+            PostEvent("proxyLoad", result.ToJson());
+        });
+    }
+    catch (StopSignal::StopException&)
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        Json::Value json;
+        json["error"] = string("ProxyLoadFailed: ") + e.what();
+        PostEvent("error", std::move(json));
+        PostExit(HEADLESS_EXIT_ERROR, "error");
+        return;
+    }
+
+    PostExit(HEADLESS_EXIT_DONE, "proxyLoaded");
+}
+
+// --proxy-load: drives the connected session's local proxy ports.
+static void StartProxyLoad()
+{
+    g_headlessProxyLoadStarted = true;
+
+    shared_ptr<const SessionInfo> sessionInfo = g_connectionManager.GetCurrentSessionInfo();
+
+    ProxyLoad::Target target = g_headlessProxyLoadTarget;
+    target.httpProxyPort = sessionInfo->GetLocalHttpProxyPort();
+    target.socksProxyPort = sessionInfo->GetLocalSocksProxyPort();
+
+    Json::Value json;
+    json["httpProxyPort"] = target.httpProxyPort;
+    json["socksProxyPort"] = target.socksProxyPort;
+    json["upstream"] = target.upstreamHost.empty() ? "loopback" : target.upstreamHost + ":" + std::to_string(target.upstreamPort);
+    Emit("proxyLoadStart", std::move(json));
+
+    RunInBackground([target](const StopInfo& stopInfo) { RunProxyLoad(stopInfo, target); });
+}
+
+// p50, p99 and max of milliseconds, as fields of o_json
+static void SummarizeMilliseconds(vector<DWORD> milliseconds, Json::Value& o_json)
+{
+    if (milliseconds.empty())
+    {
+        return;
+    }
+
+    std::sort(milliseconds.begin(), milliseconds.end());
+    o_json["p50Milliseconds"] = (Json::UInt)milliseconds[(milliseconds.size() - 1) * 50 / 100];
+    o_json["p99Milliseconds"] = (Json::UInt)milliseconds[(milliseconds.size() - 1) * 99 / 100];
+    o_json["maxMilliseconds"] = (Json::UInt)milliseconds.back();
+}
+
+// --cycles: writes the "connectCycles" event, summarizing the connects'
+// timings, by phase.
+static void EmitConnectCycles()
+{
+    vector<DWORD> totals;
+    // In the order the phases were first reported
+    vector<pair<string, vector<DWORD>>> phases;
+
+    for (const auto& timing : g_headlessCycleTimings)
+    {
+        totals.push_back(timing["totalMilliseconds"].asUInt());
+
+        const Json::Value& timingPhases = timing["phases"];
+        for (Json::Value::ArrayIndex i = 0; i < timingPhases.size(); i++)
+        {
+            string name = timingPhases[i]["phase"].asString();
+            auto entry = std::find_if(phases.begin(), phases.end(),
+                [&name](const pair<string, vector<DWORD>>& phase) { return phase.first == name; });
+            if (entry == phases.end())
+            {
+                phases.push_back(make_pair(name, vector<DWORD>()));
+                entry = phases.end() - 1;
+            }
+            entry->second.push_back(timingPhases[i]["milliseconds"].asUInt());
+        }
+    }
+
+    Json::Value json;
+    json["cycles"] = (Json::UInt)g_headlessCyclesDone;
+    json["timings"] = (Json::UInt)g_headlessCycleTimings.size();
+
+    Json::Value total;
+    SummarizeMilliseconds(totals, total);
+    json["totalMilliseconds"] = total;
+
+    Json::Value phasesJson(Json::arrayValue);
+    for (const auto& phase : phases)
+    {
+        Json::Value phaseJson;
+        phaseJson["phase"] = phase.first;
+        phaseJson["count"] = (Json::UInt)phase.second.size();
+        SummarizeMilliseconds(phase.second, phaseJson);
+        phasesJson.append(phaseJson);
+    }
+    json["phases"] = phasesJson;
+
+    Json::Value stop;
+    SummarizeMilliseconds(g_headlessCycleStopMilliseconds, stop);
+    json["stopMilliseconds"] = stop;
+
+    Emit("connectCycles", std::move(json));
+}
+
+// --cycles: once connected, either stops, to connect again, or -- after the
+// last cycle -- exits.
+// --soak: writes the resource usage now, as a "resourceUsage" event, and
+// returns it.
+static Json::Value EmitResourceUsage()
+{
+    Json::Value sample = GetResourceUsageSample();
+    g_headlessSoakLastSampleTime = GetTickCount();
+
+    Json::Value json(sample);
+    json["cycles"] = (Json::UInt)g_headlessCyclesDone;
+    Emit("resourceUsage", std::move(json));
+
+    return sample;
+}
+
+// --soak: writes the "soak" event, comparing the resource usage now to the
+// baseline, and exits -- failing if it's grown past the thresholds.
+static void FinishSoak()
+{
+    Json::Value sample = EmitResourceUsage();
+
+    Json::Int64 privateBytesGrowth = (Json::Int64)sample["privateBytes"].asUInt64() - (Json::Int64)g_headlessSoakBaseline["privateBytes"].asUInt64();
+    Json::Int64 handleGrowth = (Json::Int64)sample["handles"].asUInt() - (Json::Int64)g_headlessSoakBaseline["handles"].asUInt();
+    Json::Int64 threadGrowth = (Json::Int64)sample["threads"].asUInt() - (Json::Int64)g_headlessSoakBaseline["threads"].asUInt();
+
+    bool grown = privateBytesGrowth > HEADLESS_SOAK_MAX_PRIVATE_BYTES_GROWTH
+                 || handleGrowth > HEADLESS_SOAK_MAX_HANDLE_GROWTH
+                 || threadGrowth > HEADLESS_SOAK_MAX_THREAD_GROWTH;
+
+    Json::Value json;
+    json["cycles"] = (Json::UInt)g_headlessCyclesDone;
+    json["baseline"] = g_headlessSoakBaseline;
+    json["final"] = sample;
+    json["growth"]["privateBytes"] = privateBytesGrowth;
+    json["growth"]["handles"] = handleGrowth;
+    json["growth"]["threads"] = threadGrowth;
+    json["maxGrowth"]["privateBytes"] = HEADLESS_SOAK_MAX_PRIVATE_BYTES_GROWTH;
+    json["maxGrowth"]["handles"] = HEADLESS_SOAK_MAX_HANDLE_GROWTH;
+    json["maxGrowth"]["threads"] = HEADLESS_SOAK_MAX_THREAD_GROWTH;
+    json["grown"] = grown;
+    Emit("soak", std::move(json));
+
+    if (grown)
+    {
+        Exit(HEADLESS_EXIT_GROWN, "grown");
+    }
+    else
+    {
+        Exit(HEADLESS_EXIT_DONE, "soaked");
+    }
+}
+
+// --soak: once connected. Returns true once the run is done.
+static bool OnSoakConnected()
+{
+    // Taken once the first connect has warmed the caches up
+    if (!g_headlessSoakHasBaseline)
+    {
+        g_headlessSoakBaseline = EmitResourceUsage();
+        g_headlessSoakHasBaseline = true;
+    }
+
+    if (GetTickCount() - g_headlessStartTime < g_headlessSoakMs)
+    {
+        return false;
+    }
+
+    FinishSoak();
+    return true;
+}
+
+static void OnCycleConnected()
+{
+    g_headlessConnectedTime = 0;
+    g_headlessCyclesDone++;
+
+    if (g_headlessSoakMs != 0)
+    {
+        if (OnSoakConnected())
+        {
+            return;
+        }
+    }
+    else if (g_headlessCyclesDone >= g_headlessCycles)
+    {
+        EmitConnectCycles();
+        Exit(HEADLESS_EXIT_DONE, "connected");
+        return;
+    }
+
+    g_headlessCycleStopTime = GetTickCount();
+    g_connectionManager.Toggle();
+}
+
+static VOID CALLBACK HeadlessPollTimer(HWND, UINT, UINT_PTR, DWORD)
+{
+    CheckBackgroundRun();
+
+    Json::Value reports;
+    if (TakeConnectTimings(reports))
+    {
+        for (Json::Value::ArrayIndex i = 0; i < reports.size(); i++)
+        {
+            bool connected = reports[i]["connected"].asBool();
+            g_headlessConnectTimingSeen = g_headlessConnectTimingSeen || connected;
+            if (g_headlessCycles != 0 && connected)
+            {
+                g_headlessCycleTimings.push_back(reports[i]);
+            }
+            Emit("connectTiming", std::move(reports[i]));
+        }
+    }
+
+    DWORD now = GetTickCount();
+
+    if (g_headlessCycleRestart)
+    {
+        g_headlessCycleRestart = false;
+        g_connectionManager.Toggle();
+    }
+
+    if (g_headlessSoakHasBaseline && !g_headlessExiting
+        && now - g_headlessSoakLastSampleTime >= HEADLESS_SOAK_SAMPLE_INTERVAL_MS)
+    {
+        (void)EmitResourceUsage();
+    }
+
+    if (g_headlessExitOn == HEADLESS_EXIT_ON_CONNECTED
+        && g_headlessConnectedTime != 0
+        && (g_headlessConnectTimingSeen || now - g_headlessConnectedTime >= HEADLESS_CONNECT_TIMING_WAIT_MS))
+    {
+        if (g_headlessCycles != 0 || g_headlessSoakMs != 0)
+        {
+            OnCycleConnected();
+        }
+        else if (g_headlessProxyLoad)
+        {
+            if (!g_headlessProxyLoadStarted)
+            {
+                StartProxyLoad();
+            }
+            g_headlessConnectedTime = 0;
+        }
+        else
+        {
+            Exit(HEADLESS_EXIT_DONE, "connected");
+        }
+    }
+    else if (g_headlessTimeoutMs != 0 && now - g_headlessStartTime >= g_headlessTimeoutMs)
+    {
+        Exit(HEADLESS_EXIT_TIMED_OUT, "timeout");
+    }
+}
+
+// Returns false if value isn't a whole number.
+static bool ParseSeconds(const wchar_t* value, DWORD& o_milliseconds)
+{
+    wchar_t* end = NULL;
+    unsigned long seconds = wcstoul(value, &end, 10);
+    if (!*value || *end || seconds > MAXDWORD / 1000)
+    {
+        return false;
+    }
+    o_milliseconds = seconds * 1000;
+    return true;
+}
+
+// Returns false if value isn't a positive whole number.
+static bool ParseMinutes(const wchar_t* value, DWORD& o_milliseconds)
+{
+    wchar_t* end = NULL;
+    unsigned long minutes = wcstoul(value, &end, 10);
+    if (!*value || *end || minutes == 0 || minutes > MAXDWORD / (60*1000))
+    {
+        return false;
+    }
+    o_milliseconds = minutes * 60 * 1000;
+    return true;
+}
+
+// Returns false if value isn't a positive whole number.
+static bool ParseCount(const wchar_t* value, DWORD& o_count)
+{
+    wchar_t* end = NULL;
+    unsigned long count = wcstoul(value, &end, 10);
+    if (!*value || *end || count == 0 || count > MAXDWORD)
+    {
+        return false;
+    }
+    o_count = count;
+    return true;
+}
+
+// Returns false if value isn't <host>:<port>.
+static bool ParseHostPort(const wstring& value, string& o_host, int& o_port)
+{
+    wstring::size_type colon = value.rfind(L':');
+    if (colon == value.npos || colon == 0)
+    {
+        return false;
+    }
+
+    wchar_t* end = NULL;
+    unsigned long port = wcstoul(value.c_str() + colon + 1, &end, 10);
+    if (colon + 1 == value.length() || *end || port == 0 || port > 0xFFFF)
+    {
+        return false;
+    }
+
+    o_host = WStringToUTF8(value.substr(0, colon));
+    o_port = (int)port;
+    return true;
+}
+
+// Returns false if value isn't a number, 0 or more.
+static bool ParseSpeed(const wchar_t* value, double& o_speed)
+{
+    wchar_t* end = NULL;
+    double speed = wcstod(value, &end);
+    if (!*value || *end || !(speed >= 0) || !_finite(speed))
+    {
+        return false;
+    }
+    o_speed = speed;
+    return true;
+}
+
+// static
+void Headless::ParseCommandLine()
+{
+    g_headlessStartTime = GetTickCount();
+
+    int argc = 0;
+    LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+    if (!argv)
+    {
+        return;
+    }
+    auto freeArgv = finally([argv] { (void)LocalFree(argv); });
+
+    tstring transport;
+    DWORD timeoutMs = 0;
+    DWORD cycles = 0;
+    DWORD soakMs = 0;
+    tstring scriptedCore;
+    double speed = 1.0;
+    string upstreamHost;
+    int upstreamPort = 0;
+    bool speedSet = false;
+    string error;
+
+    for (int i = 1; i < argc; i++)
+    {
+        wstring arg = argv[i];
+        wstring::size_type equals = arg.find(L'=');
+        wstring name = arg.substr(0, equals);
+        wstring value = equals == arg.npos ? L"" : arg.substr(equals + 1);
+
+        if (arg == L"--headless")
+        {
+            g_headlessEnabled = true;
+        }
+        else if (arg == L"--connect")
+        {
+            g_headlessConnect = true;
+        }
+        else if (arg == L"--benchmark")
+        {
+            g_headlessBenchmark = true;
+        }
+        else if (arg == L"--microbenchmark")
+        {
+            g_headlessMicrobenchmark = true;
+        }
+        else if (arg == L"--stress")
+        {
+            g_headlessStress = true;
+        }
+        else if (arg == L"--proxy-load")
+        {
+            g_headlessProxyLoad = true;
+        }
+        else if (arg == L"--system-proxy-benchmark")
+        {
+            g_headlessSystemProxyBenchmark = true;
+        }
+        else if (name == L"--proxy-upstream" && ParseHostPort(value, upstreamHost, upstreamPort))
+        {
+            g_headlessProxyLoadTarget.upstreamHost = upstreamHost;
+            g_headlessProxyLoadTarget.upstreamPort = upstreamPort;
+        }
+        else if (name == L"--transport" && _wcsicmp(value.c_str(), L"CORE") == 0)
+        {
+            transport = CORE_TRANSPORT_PROTOCOL_NAME;
+        }
+        else if (name == L"--transport" && _wcsicmp(value.c_str(), L"VPN") == 0)
+        {
+            transport = VPN_TRANSPORT_PROTOCOL_NAME;
+        }
+        else if (name == L"--exit-on" && value == L"connected")
+        {
+            g_headlessExitOn = HEADLESS_EXIT_ON_CONNECTED;
+        }
+        else if (name == L"--exit-on" && value == L"stopped")
+        {
+            g_headlessExitOn = HEADLESS_EXIT_ON_STOPPED;
+        }
+        else if (name == L"--exit-on" && value == L"never")
+        {
+            g_headlessExitOn = HEADLESS_EXIT_ON_NEVER;
+        }
+        else if (name == L"--timeout" && ParseSeconds(value.c_str(), timeoutMs))
+        {
+            g_headlessTimeoutMs = timeoutMs;
+        }
+        else if (name == L"--cycles" && ParseCount(value.c_str(), cycles))
+        {
+            g_headlessCycles = cycles;
+        }
+        else if (name == L"--soak" && ParseMinutes(value.c_str(), soakMs))
+        {
+            g_headlessSoakMs = soakMs;
+        }
+        else if (name == L"--scripted-core" && !value.empty())
+        {
+            scriptedCore = value;
+        }
+        else if (name == L"--speed" && ParseSpeed(value.c_str(), speed))
+        {
+            speedSet = true;
+        }
+        else if (name == L"--report" && value == L"json")
+        {
+            g_headlessReport = true;
+        }
+        else if (name == L"--report" && value == L"none")
+        {
+            g_headlessReport = false;
+        }
+        else if (error.empty())
+        {
+            error = "BadOption: " + WStringToUTF8(arg);
+        }
+    }
+
+    // Other arguments are only ours to judge in headless mode.
+    if (!g_headlessEnabled)
+    {
+        // Except for the scripted core, which the UI can be run against too
+        if (!scriptedCore.empty())
+        {
+            Settings::SetTransportOverride(CORE_TRANSPORT_PROTOCOL_NAME);
+            ScriptedCore::Enable(scriptedCore, speed);
+        }
+        return;
+    }
+
+    if (error.empty()
+        && (int)g_headlessConnect + (int)g_headlessBenchmark + (int)g_headlessMicrobenchmark
+           + (int)g_headlessStress + (int)g_headlessProxyLoad + (int)(g_headlessSoakMs != 0)
+           + (int)g_headlessSystemProxyBenchmark > 1)
+    {
+        error = "BadOption: more than one of --connect, --benchmark, --microbenchmark, --stress, --proxy-load, --soak and --system-proxy-benchmark";
+    }
+
+    if (error.empty() && g_headlessSoakMs != 0 && g_headlessExitOn != HEADLESS_EXIT_ON_CONNECTED)
+    {
+        error = "BadOption: --soak needs --exit-on=connected";
+    }
+
+    if (error.empty() && g_headlessProxyLoad && g_headlessExitOn != HEADLESS_EXIT_ON_CONNECTED)
+    {
+        error = "BadOption: --proxy-load needs --exit-on=connected";
+    }
+
+    if (error.empty() && !g_headlessProxyLoadTarget.upstreamHost.empty() && !g_headlessProxyLoad)
+    {
+        error = "BadOption: --proxy-upstream needs --proxy-load";
+    }
+
+    if (error.empty() && g_headlessCycles != 0
+        && (!g_headlessConnect || g_headlessExitOn != HEADLESS_EXIT_ON_CONNECTED))
+    {
+        error = "BadOption: --cycles needs --connect, and --exit-on=connected";
+    }
+
+    if (error.empty() && speedSet && scriptedCore.empty())
+    {
+        error = "BadOption: --speed needs --scripted-core";
+    }
+
+    // The stand-in only stands in for the core.
+    if (error.empty() && !scriptedCore.empty())
+    {
+        if (transport == VPN_TRANSPORT_PROTOCOL_NAME)
+        {
+            error = "BadOption: --scripted-core needs --transport=CORE";
+        }
+        transport = CORE_TRANSPORT_PROTOCOL_NAME;
+    }
+
+    g_headlessCommandLineError = error;
+
+    if (error.empty() && !transport.empty())
+    {
+        Settings::SetTransportOverride(transport);
+    }
+
+    if (error.empty() && !scriptedCore.empty())
+    {
+        ScriptedCore::Enable(scriptedCore, speed);
+    }
+
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    g_headlessOutput = output != INVALID_HANDLE_VALUE ? output : NULL;
+}
+
+// static
+bool Headless::IsEnabled()
+{
+    return g_headlessEnabled;
+}
+
+// static
+bool Headless::ShouldConnect()
+{
+    return g_headlessConnect || g_headlessProxyLoad || g_headlessSoakMs != 0;
+}
+
+// static
+bool Headless::HasBackgroundRun()
+{
+    return g_headlessBenchmark || g_headlessMicrobenchmark || g_headlessStress || g_headlessSystemProxyBenchmark;
+}
+
+// static
+void Headless::StartBackgroundRun()
+{
+    if (g_headlessBenchmark)
+    {
+        RunInBackground(RunBenchmark);
+    }
+    else if (g_headlessMicrobenchmark)
+    {
+        RunInBackground(RunMicrobenchmarks);
+    }
+    else if (g_headlessStress)
+    {
+        RunInBackground(RunStress);
+    }
+    else if (g_headlessSystemProxyBenchmark)
+    {
+        RunInBackground(RunSystemProxyBenchmark);
+    }
+}
+
+// static
+bool Headless::Start(HWND hWnd)
+{
+    g_headlessWnd = hWnd;
+
+    if (!g_headlessCommandLineError.empty())
+    {
+        Fail(g_headlessCommandLineError.c_str());
+        return false;
+    }
+
+    if (g_headlessReport && !g_headlessOutput)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: stdout isn't redirected; there'll be no report"), __TFUNCTION__);
+    }
+
+    Json::Value json;
+    json["transport"] = WStringToUTF8(Settings::Transport());
+    json["connect"] = g_headlessConnect;
+    json["benchmark"] = g_headlessBenchmark;
+    json["microbenchmark"] = g_headlessMicrobenchmark;
+    json["stress"] = g_headlessStress;
+    json["proxyLoad"] = g_headlessProxyLoad;
+    json["systemProxyBenchmark"] = g_headlessSystemProxyBenchmark;
+    json["soakMinutes"] = (Json::UInt)(g_headlessSoakMs / (60*1000));
+    json["exitOn"] = ExitOnName(g_headlessExitOn);
+    json["timeoutSeconds"] = (Json::UInt)(g_headlessTimeoutMs / 1000);
+    json["cycles"] = (Json::UInt)g_headlessCycles;
+    json["scriptedCore"] = ScriptedCore::IsEnabled();
+    Emit("start", std::move(json));
+
+    // Runs for the life of the process, on this thread's message loop
+    if (!SetTimer(NULL, 0, HEADLESS_POLL_INTERVAL_MS, HeadlessPollTimer))
+    {
+        Fail("SetTimerFailed");
+        return false;
+    }
+
+    return true;
+}
+
+// static
+void Headless::Fail(const char* error)
+{
+    g_headlessExitCode = HEADLESS_EXIT_ERROR;
+
+    Json::Value json;
+    json["error"] = error;
+    Emit("error", std::move(json));
+}
+
+// static
+void Headless::OnStateChanged(ConnectionManagerState state)
+{
+    if (!g_headlessEnabled)
+    {
+        return;
+    }
+
+    Json::Value json;
+    json["state"] = StateName(state);
+    Emit("state", std::move(json));
+
+    if (state == CONNECTION_MANAGER_STATE_CONNECTED)
+    {
+        g_headlessConnectedTime = GetTickCount();
+        g_headlessConnectTimingSeen = false;
+        return;
+    }
+    g_headlessConnectedTime = 0;
+
+    // The initial state isn't delivered, so being stopped means a
+    // connection was started and has ended.
+    if (state != CONNECTION_MANAGER_STATE_STOPPED)
+    {
+        return;
+    }
+
+    // --cycles and --soak: stopped to connect again. A soak run keeps no
+    // timings, as they'd grow with it.
+    if (g_headlessCycleStopTime != 0)
+    {
+        if (g_headlessCycles != 0)
+        {
+            g_headlessCycleStopMilliseconds.push_back(GetTickCount() - g_headlessCycleStopTime);
+        }
+        g_headlessCycleStopTime = 0;
+        g_headlessCycleRestart = true;
+        return;
+    }
+
+    if (g_headlessExitOn == HEADLESS_EXIT_ON_STOPPED)
+    {
+        Exit(HEADLESS_EXIT_DONE, "stopped");
+    }
+    else if (g_headlessExitOn == HEADLESS_EXIT_ON_CONNECTED)
+    {
+        Exit(HEADLESS_EXIT_STOPPED, "stopped");
+    }
+}
+
+// static
+void Headless::OnMetrics(const Json::Value& sample)
+{
+    if (!g_headlessEnabled)
+    {
+        return;
+    }
+
+    Json::Value json(sample);
+    Emit("metrics", std::move(json));
+}
+
+// static
+int Headless::ExitCode()
+{
+    return g_headlessExitCode;
+}
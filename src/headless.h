@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "connectionmanager.h"
+
+
+/*
+Headless mode, for automated runs (connect benchmarks, soak tests):
+
+    psiphon.exe --headless [--connect | --benchmark | --microbenchmark |
+                            --stress | --proxy-load [--proxy-upstream=<host>:<port>] |
+                            --soak=<minutes> | --system-proxy-benchmark]
+                [--transport=CORE|VPN] [--exit-on=connected|stopped|never]
+                [--timeout=<seconds>] [--report=json|none] [--cycles=<n>]
+                [--scripted-core=<script> [--speed=<x>]]
+
+The main window is created, for its message loop, but never shown, and the
+HTML UI and the tray icon are never created. No home pages are opened, and
+neither the settings nor the window placement are written. --transport
+applies to this run only.
+
+The state transitions, each connect attempt's phase timings (see
+ConnectTimingReport) and the tunnel metrics samples are written to stdout as
+JSON, one object per line. This is a GUI app, so stdout must be redirected
+(to a file or pipe) for the report to go anywhere; it doesn't attach to the
+parent's console, as the tunnel core is stopped through its console.
+
+The exit code is one of HeadlessExitCode. By default the run exits once
+connected, or fails once it stops without having connected.
+
+--cycles, with --connect and --exit-on=connected, connects n times: each
+time it's connected (and its timing written) it's stopped, and once that's
+done, started again. After the last, the p50, p99 and max of the total, of
+each phase and of the stops are written as a "connectCycles" event, and the
+run exits as connected.
+
+--scripted-core connects to a ScriptedCore stand-in, over the CORE
+transport, instead of the tunnel core; see scripted_core.h. It can be given
+without --headless too.
+
+--benchmark runs TransportBenchmark instead of connecting: each result is
+written as a "benchmark" event, then the recommended transport, and the run
+exits -- failing as stopped if nothing connected. --exit-on doesn't apply.
+
+--microbenchmark runs Microbenchmarks, and --stress runs ConcurrencyStress,
+without connecting: each result is written as a "microbenchmark" or "stress"
+event, and the run exits. --exit-on doesn't apply.
+
+--system-proxy-benchmark runs SystemProxyBenchmark without connecting: each
+result is written as a "systemProxyBenchmark" event, and the run exits.
+--exit-on doesn't apply.
+
+--proxy-load connects, as --connect does, and once connected runs ProxyLoad
+against the session's local HTTP and SOCKS proxy ports: the ports are
+written as a "proxyLoadStart" event, each result as a "proxyLoad" event,
+and the run exits. --proxy-upstream sends the requests to that HTTP server
+instead of the loopback upstream; see proxy_load.h.
+
+--soak connects and stops, over and over, as --cycles does, for at least
+that many minutes: usually with --scripted-core, so that it's only the
+client being soaked. The private bytes, handle count and thread count are
+written as a "resourceUsage" event at the first connect, every minute, and
+at the last connect. Then a "soak" event compares the first and the last,
+and the run exits -- failing as grown if the private bytes grew by more than
+20 MB, the handles by more than 200 or the threads by more than 10.
+
+Everything but ParseCommandLine must be called on the main window thread.
+*/
+enum HeadlessExitCode
+{
+    // The --exit-on condition was met (or the window was closed)
+    HEADLESS_EXIT_DONE = 0,
+    // Stopped without connecting, while waiting to be connected
+    HEADLESS_EXIT_STOPPED = 1,
+    HEADLESS_EXIT_TIMED_OUT = 2,
+    // Bad command line, or another instance is running
+    HEADLESS_EXIT_ERROR = 3,
+    // --soak: resource usage grew past the thresholds
+    HEADLESS_EXIT_GROWN = 4
+};
+
+class Headless
+{
+public:
+    // Reads the command line; done first thing in WinMain. If it asks for
+    // headless mode but is unusable, the run fails as soon as Start is
+    // called.
+    static void ParseCommandLine();
+
+    static bool IsEnabled();
+
+    // Whether to connect once the window is created (--connect, --proxy-load,
+    // --soak)
+    static bool ShouldConnect();
+
+    // Whether to run something in the background instead, once the window
+    // is created (--benchmark, --microbenchmark, --stress,
+    // --system-proxy-benchmark)
+    static bool HasBackgroundRun();
+
+    // Starts it; the run exits when it's done.
+    static void StartBackgroundRun();
+
+    // Begins the run: writes the "start" event and starts the timeout.
+    // Returns false, having written the error, if the run can't go ahead.
+    static bool Start(HWND hWnd);
+
+    // Writes an "error" event, and sets the exit code to HEADLESS_EXIT_ERROR.
+    static void Fail(const char* error);
+
+    static void OnStateChanged(ConnectionManagerState state);
+
+    // Called with each tunnel metrics sample
+    static void OnMetrics(const Json::Value& sample);
+
+    static int ExitCode();
+};
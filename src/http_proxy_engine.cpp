@@ -0,0 +1,1307 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "http_proxy_engine.h"
+#include <MSWSock.h>
+#include <WS2tcpip.h>
+#include "logging.h"
+#include "psiclient.h"
+#include "utilities.h"
+
+
+#define PROXY_BUFFER_SIZE                   16384
+// Blocks are pushed onto an SList, so the buffer proper is offset past an
+// aligned header holding the SLIST_ENTRY
+#define PROXY_BUFFER_HEADER_SIZE            MEMORY_ALLOCATION_ALIGNMENT
+#define PROXY_MAX_POOLED_BUFFERS            256
+#define PROXY_IO_THREAD_COUNT               2
+#define PROXY_OUTSTANDING_ACCEPTS           8
+#define PROXY_STOP_TIMEOUT_MS               5000
+// Per-connection byte counts are handed to the engine in chunks of this size
+#define PROXY_BYTES_FLUSH_THRESHOLD         65536
+// Bounds the stats held between calls to TakeStats
+#define PROXY_MAX_PENDING_STATS_ENTRIES     10000
+#define ACCEPT_ADDRESS_LENGTH               (sizeof(sockaddr_in) + 16)
+
+#define COMPLETION_KEY_QUIT                 0
+#define COMPLETION_KEY_IO                   1
+
+static const char BAD_REQUEST_RESPONSE[] =
+    "HTTP/1.1 400 Bad Request\r\nConnection: close\r\nContent-Length: 0\r\n\r\n";
+static const char BAD_GATEWAY_RESPONSE[] =
+    "HTTP/1.1 502 Bad Gateway\r\nConnection: close\r\nContent-Length: 0\r\n\r\n";
+static const char CONNECT_ESTABLISHED_RESPONSE[] =
+    "HTTP/1.1 200 Connection established\r\n\r\n";
+
+
+/******************************************************************************
+ HttpProxyIoContext
+******************************************************************************/
+
+enum HttpProxyIoOperation
+{
+    IO_OPERATION_ACCEPT,
+    IO_OPERATION_CONNECT,
+    IO_OPERATION_RECV,
+    IO_OPERATION_SEND
+};
+
+struct HttpProxyIoContext
+{
+    // Must be first: completions hand back the OVERLAPPED*
+    OVERLAPPED overlapped;
+    HttpProxyIoOperation operation;
+    // NULL for accepts
+    HttpProxyConnection* connection;
+    // The accepted socket, for accepts; the socket being used otherwise
+    SOCKET socket;
+    char* buffer;
+    // Valid bytes in `buffer`
+    DWORD length;
+    // Bytes of `buffer` already sent
+    DWORD offset;
+
+    HttpProxyIoContext()
+        : operation(IO_OPERATION_RECV), connection(NULL), socket(INVALID_SOCKET),
+          buffer(NULL), length(0), offset(0)
+    {
+        ZeroMemory(&overlapped, sizeof(overlapped));
+    }
+};
+
+
+/******************************************************************************
+ HttpProxyConnection
+******************************************************************************/
+
+/*
+A connection has two I/O contexts, one per direction, and never more than one
+operation outstanding on each:
+- m_clientContext reads the request head from the client, then relays client
+  data to the upstream.
+- m_upstreamContext does the SOCKS5 exchange on the upstream socket (if
+  there's a SOCKS parent), then relays upstream data to the client. It's
+  also used to send error and CONNECT responses to the client.
+All state changes happen under m_lock. The connection deletes itself once it
+is closed and has no operations outstanding.
+*/
+
+enum HttpProxyConnectionState
+{
+    CONNECTION_STATE_READING_REQUEST,
+    CONNECTION_STATE_RESOLVING,
+    CONNECTION_STATE_CONNECTING,
+    CONNECTION_STATE_SOCKS_METHOD,
+    CONNECTION_STATE_SOCKS_CONNECT,
+    CONNECTION_STATE_RELAYING,
+    // Sending an error response; close when it's done
+    CONNECTION_STATE_RESPONDING
+};
+
+struct HttpProxyConnection
+{
+    HttpProxyConnection(HttpProxyEngine* engine, SOCKET clientSocket);
+    ~HttpProxyConnection();
+
+    void Start();
+    void OnCompletion(HttpProxyIoContext* context, bool success, DWORD bytes);
+    void Close();
+
+    // Runs on the system thread pool; see ConnectUpstream
+    static DWORD WINAPI ResolveWorkItem(void* object);
+
+private:
+    void OnRecv(HttpProxyIoContext* context, DWORD bytes);
+    void OnSent(HttpProxyIoContext* context);
+    void OnConnected();
+
+    void HandleRequestHead();
+    bool ConnectUpstream();
+    void OnResolved(bool success, const sockaddr_in& address);
+    bool ConnectTo(const sockaddr_in& address);
+    void SendSocksConnectRequest();
+    void HandleSocksConnectReply();
+    void EnterRelay();
+    void Respond(const char* response, size_t length);
+    void CountRelayedBytes(DWORD bytes);
+
+    bool PostRecv(HttpProxyIoContext* context, SOCKET socket);
+    bool PostSend(HttpProxyIoContext* context, SOCKET socket);
+
+    // Releases the connection if it's closed and idle; call without m_lock held
+    void ReleaseIfDone();
+
+    HttpProxyEngine* m_engine;
+    Lock m_lock;
+    HttpProxyConnectionState m_state;
+    bool m_closed;
+    int m_pendingOperations;
+    SOCKET m_clientSocket;
+    SOCKET m_upstreamSocket;
+    HttpProxyIoContext m_clientContext;
+    HttpProxyIoContext m_upstreamContext;
+    bool m_clientFinished;
+    bool m_upstreamFinished;
+    bool m_isConnectRequest;
+    string m_targetHost;
+    USHORT m_targetPort;
+    // What the connection was recorded as in the stats, for its bytes
+    string m_statsTarget;
+    unsigned long long m_unreportedBytes;
+};
+
+HttpProxyConnection::HttpProxyConnection(HttpProxyEngine* engine, SOCKET clientSocket)
+    : m_engine(engine),
+      m_state(CONNECTION_STATE_READING_REQUEST),
+      m_closed(false),
+      m_pendingOperations(0),
+      m_clientSocket(clientSocket),
+      m_upstreamSocket(INVALID_SOCKET),
+      m_clientFinished(false),
+      m_upstreamFinished(false),
+      m_isConnectRequest(false),
+      m_targetPort(0),
+      m_unreportedBytes(0)
+{
+    m_clientContext.connection = this;
+    m_clientContext.buffer = m_engine->AllocateBuffer();
+    m_upstreamContext.connection = this;
+    m_upstreamContext.buffer = m_engine->AllocateBuffer();
+}
+
+HttpProxyConnection::~HttpProxyConnection()
+{
+    assert(m_closed && m_pendingOperations == 0);
+
+    if (m_unreportedBytes > 0)
+    {
+        m_engine->RecordBytesTransferred(m_unreportedBytes, m_isConnectRequest, m_statsTarget);
+    }
+
+    m_engine->FreeBuffer(m_clientContext.buffer);
+    m_engine->FreeBuffer(m_upstreamContext.buffer);
+}
+
+void HttpProxyConnection::Start()
+{
+    {
+        AutoLock lock(m_lock);
+        if (!PostRecv(&m_clientContext, m_clientSocket))
+        {
+            Close();
+        }
+    }
+
+    ReleaseIfDone();
+}
+
+void HttpProxyConnection::OnCompletion(HttpProxyIoContext* context, bool success, DWORD bytes)
+{
+    {
+        AutoLock lock(m_lock);
+
+        m_pendingOperations--;
+
+        if (m_closed)
+        {
+            // The operation was cancelled by Close, or raced with it
+        }
+        else if (!success)
+        {
+            Close();
+        }
+        else if (context->operation == IO_OPERATION_SEND)
+        {
+            context->offset += bytes;
+            if (context->offset < context->length)
+            {
+                // Partial send; send the rest
+                if (!PostSend(context, context->socket))
+                {
+                    Close();
+                }
+            }
+            else
+            {
+                OnSent(context);
+            }
+        }
+        else if (context->operation == IO_OPERATION_RECV)
+        {
+            OnRecv(context, bytes);
+        }
+        else if (context->operation == IO_OPERATION_CONNECT)
+        {
+            OnConnected();
+        }
+    }
+
+    ReleaseIfDone();
+}
+
+void HttpProxyConnection::Close()
+{
+    // Caller holds m_lock
+
+    if (m_closed)
+    {
+        return;
+    }
+
+    m_closed = true;
+
+    // Cancels any outstanding operations; they complete with errors
+    if (m_clientSocket != INVALID_SOCKET)
+    {
+        closesocket(m_clientSocket);
+        m_clientSocket = INVALID_SOCKET;
+    }
+    if (m_upstreamSocket != INVALID_SOCKET)
+    {
+        closesocket(m_upstreamSocket);
+        m_upstreamSocket = INVALID_SOCKET;
+    }
+}
+
+void HttpProxyConnection::ReleaseIfDone()
+{
+    bool done = false;
+    {
+        AutoLock lock(m_lock);
+        done = m_closed && m_pendingOperations == 0;
+    }
+
+    if (done)
+    {
+        // Nothing else can reach this connection: no I/O is outstanding, and
+        // RemoveConnection takes it out of the engine's set.
+        m_engine->RemoveConnection(this);
+        delete this;
+    }
+}
+
+void HttpProxyConnection::OnRecv(HttpProxyIoContext* context, DWORD bytes)
+{
+    bool fromClient = (context == &m_clientContext);
+
+    if (bytes == 0)
+    {
+        // EOF. While relaying, pass on the half-close and wait for the other
+        // direction to finish; otherwise there's nothing more to do.
+        if (m_state != CONNECTION_STATE_RELAYING)
+        {
+            Close();
+            return;
+        }
+
+        if (fromClient)
+        {
+            m_clientFinished = true;
+            shutdown(m_upstreamSocket, SD_SEND);
+        }
+        else
+        {
+            m_upstreamFinished = true;
+            shutdown(m_clientSocket, SD_SEND);
+        }
+
+        if (m_clientFinished && m_upstreamFinished)
+        {
+            Close();
+        }
+        return;
+    }
+
+    if (m_state == CONNECTION_STATE_RELAYING)
+    {
+        CountRelayedBytes(bytes);
+
+        context->length = bytes;
+        context->offset = 0;
+        if (!PostSend(context, fromClient ? m_upstreamSocket : m_clientSocket))
+        {
+            Close();
+        }
+        return;
+    }
+
+    context->length += bytes;
+
+    if (fromClient && m_state == CONNECTION_STATE_READING_REQUEST)
+    {
+        HandleRequestHead();
+    }
+    else if (!fromClient && m_state == CONNECTION_STATE_SOCKS_METHOD)
+    {
+        if (context->length < 2)
+        {
+            if (!PostRecv(context, m_upstreamSocket)) Close();
+            return;
+        }
+
+        // Version 5, "no authentication required"
+        if (context->buffer[0] != 0x05 || context->buffer[1] != 0x00)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: unexpected SOCKS method reply"), __TFUNCTION__);
+            Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+            return;
+        }
+
+        SendSocksConnectRequest();
+    }
+    else if (!fromClient && m_state == CONNECTION_STATE_SOCKS_CONNECT)
+    {
+        HandleSocksConnectReply();
+    }
+    else
+    {
+        // Data where none was expected (e.g., the client sending while we're
+        // still connecting can't happen, as no read is outstanding then)
+        Close();
+    }
+}
+
+void HttpProxyConnection::OnSent(HttpProxyIoContext* context)
+{
+    context->length = 0;
+    context->offset = 0;
+
+    if (m_state == CONNECTION_STATE_RESPONDING)
+    {
+        shutdown(m_clientSocket, SD_SEND);
+        Close();
+        return;
+    }
+
+    // After the SOCKS requests, read the replies; while relaying, read more
+    // from the side that was just forwarded.
+    bool posted = false;
+    if (context == &m_clientContext)
+    {
+        posted = PostRecv(context, m_clientSocket);
+    }
+    else
+    {
+        posted = PostRecv(context, m_upstreamSocket);
+    }
+
+    if (!posted)
+    {
+        Close();
+    }
+}
+
+void HttpProxyConnection::OnConnected()
+{
+    if (0 != setsockopt(m_upstreamSocket, SOL_SOCKET, SO_UPDATE_CONNECT_CONTEXT, NULL, 0))
+    {
+        Close();
+        return;
+    }
+
+    if (m_engine->m_socksParentPort <= 0)
+    {
+        // Connected directly to the target
+        EnterRelay();
+        return;
+    }
+
+    // SOCKS5 greeting: version 5, one method, "no authentication required"
+    m_state = CONNECTION_STATE_SOCKS_METHOD;
+    m_upstreamContext.buffer[0] = 0x05;
+    m_upstreamContext.buffer[1] = 0x01;
+    m_upstreamContext.buffer[2] = 0x00;
+    m_upstreamContext.length = 3;
+    m_upstreamContext.offset = 0;
+
+    if (!PostSend(&m_upstreamContext, m_upstreamSocket))
+    {
+        Close();
+    }
+}
+
+void HttpProxyConnection::HandleRequestHead()
+{
+    static const char HEAD_END[] = "\r\n\r\n";
+
+    const char* data = m_clientContext.buffer;
+    const char* dataEnd = data + m_clientContext.length;
+    const char* headEnd = std::search(data, dataEnd, HEAD_END, HEAD_END + sizeof(HEAD_END) - 1);
+
+    if (headEnd == dataEnd)
+    {
+        if (m_clientContext.length >= PROXY_BUFFER_SIZE)
+        {
+            // The head doesn't fit in a buffer
+            Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+        }
+        else if (!PostRecv(&m_clientContext, m_clientSocket))
+        {
+            Close();
+        }
+        return;
+    }
+
+    headEnd += sizeof(HEAD_END) - 1;
+    string head(data, headEnd);
+    string leftover(headEnd, dataEnd);
+
+    // Request line: METHOD SP TARGET SP VERSION
+
+    size_t lineEnd = head.find("\r\n");
+    size_t methodEnd = head.find(' ');
+    size_t targetEnd = (methodEnd == string::npos) ? string::npos : head.find(' ', methodEnd + 1);
+    if (methodEnd == string::npos || targetEnd == string::npos || targetEnd > lineEnd)
+    {
+        Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+        return;
+    }
+
+    string method = head.substr(0, methodEnd);
+    string target = head.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    string version = head.substr(targetEnd + 1, lineEnd - targetEnd - 1);
+
+    string authority, path;
+    USHORT defaultPort = 80;
+
+    m_isConnectRequest = (0 == _stricmp(method.c_str(), "CONNECT"));
+    if (m_isConnectRequest)
+    {
+        authority = target;
+        defaultPort = 443;
+    }
+    else
+    {
+        static const char HTTP_SCHEME[] = "http://";
+        if (0 != _strnicmp(target.c_str(), HTTP_SCHEME, sizeof(HTTP_SCHEME) - 1))
+        {
+            // Only absolute http URIs can be proxied
+            Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+            return;
+        }
+
+        size_t authorityStart = sizeof(HTTP_SCHEME) - 1;
+        size_t pathStart = target.find('/', authorityStart);
+        authority = target.substr(authorityStart, pathStart - authorityStart);
+        path = (pathStart == string::npos) ? "/" : target.substr(pathStart);
+    }
+
+    // No IPv6 literals; the core resolves names for us
+    size_t portStart = authority.find(':');
+    m_targetHost = authority.substr(0, portStart);
+    m_targetPort = defaultPort;
+    if (portStart != string::npos)
+    {
+        int port = atoi(authority.c_str() + portStart + 1);
+        if (port <= 0 || port > 0xFFFF)
+        {
+            Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+            return;
+        }
+        m_targetPort = (USHORT)port;
+    }
+
+    if (m_targetHost.empty() || m_targetHost.length() > 255)
+    {
+        Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+        return;
+    }
+
+    string forward;
+
+    if (m_isConnectRequest)
+    {
+        m_engine->RecordHttpsRequest(target);
+        m_statsTarget = target;
+        forward = leftover;
+    }
+    else
+    {
+        m_engine->RecordPageView(target);
+        m_statsTarget = target;
+
+        // Forward in origin form, without hop-by-hop headers, and ask for the
+        // connection to be closed after the response
+        forward = method + " " + path + " " + version + "\r\n";
+
+        size_t lineStart = lineEnd + 2;
+        while (lineStart < head.size())
+        {
+            size_t nextLineEnd = head.find("\r\n", lineStart);
+            if (nextLineEnd == lineStart)
+            {
+                // The blank line ending the head
+                break;
+            }
+
+            string line = head.substr(lineStart, nextLineEnd - lineStart);
+            string name = line.substr(0, line.find(':'));
+            if (0 != _stricmp(name.c_str(), "Connection")
+                && 0 != _stricmp(name.c_str(), "Proxy-Connection")
+                && 0 != _stricmp(name.c_str(), "Keep-Alive")
+                && 0 != _stricmp(name.c_str(), "Proxy-Authorization"))
+            {
+                forward += line + "\r\n";
+            }
+
+            lineStart = nextLineEnd + 2;
+        }
+
+        forward += "Connection: close\r\n\r\n";
+        forward += leftover;
+    }
+
+    if (forward.size() > PROXY_BUFFER_SIZE)
+    {
+        Respond(BAD_REQUEST_RESPONSE, sizeof(BAD_REQUEST_RESPONSE) - 1);
+        return;
+    }
+
+    // Held in the client context until the upstream is ready for it
+    memcpy(m_clientContext.buffer, forward.data(), forward.size());
+    m_clientContext.length = forward.size();
+    m_clientContext.offset = 0;
+
+    if (!ConnectUpstream())
+    {
+        Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+    }
+}
+
+bool HttpProxyConnection::ConnectUpstream()
+{
+    if (m_engine->m_socksParentPort > 0)
+    {
+        sockaddr_in parentAddress;
+        ZeroMemory(&parentAddress, sizeof(parentAddress));
+        parentAddress.sin_family = AF_INET;
+        parentAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        parentAddress.sin_port = htons((USHORT)m_engine->m_socksParentPort);
+
+        return ConnectTo(parentAddress);
+    }
+
+    // Connecting directly. Name resolution blocks, so it's done on the system
+    // thread pool rather than tying up an I/O thread; it counts as an
+    // outstanding operation.
+    m_state = CONNECTION_STATE_RESOLVING;
+    m_pendingOperations++;
+    if (!QueueUserWorkItem(HttpProxyConnection::ResolveWorkItem, (void*)this, WT_EXECUTEDEFAULT))
+    {
+        m_pendingOperations--;
+        return false;
+    }
+
+    return true;
+}
+
+// static
+DWORD WINAPI HttpProxyConnection::ResolveWorkItem(void* object)
+{
+    HttpProxyConnection* _this = (HttpProxyConnection*)object;
+
+    // Not modified once the request head is parsed
+    const string& host = _this->m_targetHost;
+
+    addrinfo hints;
+    ZeroMemory(&hints, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+
+    addrinfo* result = NULL;
+    sockaddr_in address;
+    ZeroMemory(&address, sizeof(address));
+
+    bool success = (0 == getaddrinfo(host.c_str(), NULL, &hints, &result) && result != NULL);
+    if (success)
+    {
+        address = *(sockaddr_in*)result->ai_addr;
+        address.sin_port = htons(_this->m_targetPort);
+    }
+
+    if (result)
+    {
+        freeaddrinfo(result);
+    }
+
+    _this->OnResolved(success, address);
+    return 0;
+}
+
+void HttpProxyConnection::OnResolved(bool success, const sockaddr_in& address)
+{
+    {
+        AutoLock lock(m_lock);
+
+        m_pendingOperations--;
+
+        if (m_closed)
+        {
+            // Stopped while resolving
+        }
+        else if (!success)
+        {
+            my_log(true, _T("HttpProxyConnection::OnResolved: failed to resolve"), LogArg("host", m_targetHost, LOG_ARG_SENSITIVE));
+            Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+        }
+        else if (!ConnectTo(address))
+        {
+            Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+        }
+    }
+
+    ReleaseIfDone();
+}
+
+bool HttpProxyConnection::ConnectTo(const sockaddr_in& address)
+{
+    m_upstreamSocket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED);
+    if (m_upstreamSocket == INVALID_SOCKET)
+    {
+        return false;
+    }
+
+    // ConnectEx requires a bound socket
+    sockaddr_in localAddress;
+    ZeroMemory(&localAddress, sizeof(localAddress));
+    localAddress.sin_family = AF_INET;
+    localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+    localAddress.sin_port = 0;
+    if (0 != bind(m_upstreamSocket, (sockaddr*)&localAddress, sizeof(localAddress)))
+    {
+        return false;
+    }
+
+    if (NULL == CreateIoCompletionPort((HANDLE)m_upstreamSocket, m_engine->m_completionPort, COMPLETION_KEY_IO, 0))
+    {
+        return false;
+    }
+
+    m_state = CONNECTION_STATE_CONNECTING;
+
+    HttpProxyIoContext* context = &m_upstreamContext;
+    ZeroMemory(&context->overlapped, sizeof(context->overlapped));
+    context->operation = IO_OPERATION_CONNECT;
+    context->socket = m_upstreamSocket;
+
+    LPFN_CONNECTEX connectEx = (LPFN_CONNECTEX)m_engine->m_connectEx;
+    if (!connectEx(m_upstreamSocket, (const sockaddr*)&address, sizeof(address), NULL, 0, NULL, &context->overlapped)
+        && WSAGetLastError() != ERROR_IO_PENDING)
+    {
+        return false;
+    }
+
+    m_pendingOperations++;
+    return true;
+}
+
+void HttpProxyConnection::SendSocksConnectRequest()
+{
+    // Version 5, CONNECT, reserved, domain name address, then the port
+    char* request = m_upstreamContext.buffer;
+    size_t length = 0;
+    request[length++] = 0x05;
+    request[length++] = 0x01;
+    request[length++] = 0x00;
+    request[length++] = 0x03;
+    request[length++] = (char)m_targetHost.length();
+    memcpy(request + length, m_targetHost.data(), m_targetHost.length());
+    length += m_targetHost.length();
+    request[length++] = (char)(m_targetPort >> 8);
+    request[length++] = (char)(m_targetPort & 0xFF);
+
+    m_state = CONNECTION_STATE_SOCKS_CONNECT;
+    m_upstreamContext.length = length;
+    m_upstreamContext.offset = 0;
+
+    if (!PostSend(&m_upstreamContext, m_upstreamSocket))
+    {
+        Close();
+    }
+}
+
+void HttpProxyConnection::HandleSocksConnectReply()
+{
+    const unsigned char* reply = (const unsigned char*)m_upstreamContext.buffer;
+    DWORD length = m_upstreamContext.length;
+
+    // The reply ends with the bound address, whose length depends on its type
+    DWORD expected = 0;
+    if (length >= 5)
+    {
+        switch (reply[3])
+        {
+        case 0x01: expected = 4 + 4 + 2; break;
+        case 0x03: expected = 4 + 1 + reply[4] + 2; break;
+        case 0x04: expected = 4 + 16 + 2; break;
+        default:
+            Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+            return;
+        }
+    }
+
+    if (length < 5 || length < expected)
+    {
+        if (!PostRecv(&m_upstreamContext, m_upstreamSocket)) Close();
+        return;
+    }
+
+    if (reply[0] != 0x05 || reply[1] != 0x00)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: SOCKS connect failed (%d)"), __TFUNCTION__, (int)reply[1]);
+        Respond(BAD_GATEWAY_RESPONSE, sizeof(BAD_GATEWAY_RESPONSE) - 1);
+        return;
+    }
+
+    EnterRelay();
+}
+
+void HttpProxyConnection::EnterRelay()
+{
+    m_state = CONNECTION_STATE_RELAYING;
+
+    // Upstream -> client, starting with the CONNECT response if there is one
+
+    bool posted = false;
+    if (m_isConnectRequest)
+    {
+        memcpy(m_upstreamContext.buffer, CONNECT_ESTABLISHED_RESPONSE, sizeof(CONNECT_ESTABLISHED_RESPONSE) - 1);
+        m_upstreamContext.length = sizeof(CONNECT_ESTABLISHED_RESPONSE) - 1;
+        m_upstreamContext.offset = 0;
+        posted = PostSend(&m_upstreamContext, m_clientSocket);
+    }
+    else
+    {
+        m_upstreamContext.length = 0;
+        posted = PostRecv(&m_upstreamContext, m_upstreamSocket);
+    }
+
+    // Client -> upstream, starting with whatever HandleRequestHead left
+
+    if (posted)
+    {
+        if (m_clientContext.length > 0)
+        {
+            posted = PostSend(&m_clientContext, m_upstreamSocket);
+        }
+        else
+        {
+            posted = PostRecv(&m_clientContext, m_clientSocket);
+        }
+    }
+
+    if (!posted)
+    {
+        Close();
+    }
+}
+
+void HttpProxyConnection::Respond(const char* response, size_t length)
+{
+    m_state = CONNECTION_STATE_RESPONDING;
+
+    memcpy(m_upstreamContext.buffer, response, length);
+    m_upstreamContext.length = length;
+    m_upstreamContext.offset = 0;
+
+    if (!PostSend(&m_upstreamContext, m_clientSocket))
+    {
+        Close();
+    }
+}
+
+void HttpProxyConnection::CountRelayedBytes(DWORD bytes)
+{
+    m_unreportedBytes += bytes;
+    if (m_unreportedBytes >= PROXY_BYTES_FLUSH_THRESHOLD)
+    {
+        m_engine->RecordBytesTransferred(m_unreportedBytes, m_isConnectRequest, m_statsTarget);
+        m_unreportedBytes = 0;
+    }
+}
+
+bool HttpProxyConnection::PostRecv(HttpProxyIoContext* context, SOCKET socket)
+{
+    // Receives are appended to any data already in the buffer
+    if (context->length >= PROXY_BUFFER_SIZE)
+    {
+        return false;
+    }
+
+    ZeroMemory(&context->overlapped, sizeof(context->overlapped));
+    context->operation = IO_OPERATION_RECV;
+    context->socket = socket;
+
+    WSABUF wsaBuf;
+    wsaBuf.buf = context->buffer + context->length;
+    wsaBuf.len = PROXY_BUFFER_SIZE - context->length;
+    DWORD flags = 0;
+
+    if (0 != WSARecv(socket, &wsaBuf, 1, NULL, &flags, &context->overlapped, NULL)
+        && WSAGetLastError() != WSA_IO_PENDING)
+    {
+        return false;
+    }
+
+    // Even on immediate success the completion is queued to the port
+    m_pendingOperations++;
+    return true;
+}
+
+bool HttpProxyConnection::PostSend(HttpProxyIoContext* context, SOCKET socket)
+{
+    ZeroMemory(&context->overlapped, sizeof(context->overlapped));
+    context->operation = IO_OPERATION_SEND;
+    context->socket = socket;
+
+    WSABUF wsaBuf;
+    wsaBuf.buf = context->buffer + context->offset;
+    wsaBuf.len = context->length - context->offset;
+
+    if (0 != WSASend(socket, &wsaBuf, 1, NULL, 0, &context->overlapped, NULL)
+        && WSAGetLastError() != WSA_IO_PENDING)
+    {
+        return false;
+    }
+
+    m_pendingOperations++;
+    return true;
+}
+
+
+/******************************************************************************
+ HttpProxyEngine
+******************************************************************************/
+
+HttpProxyEngine::HttpProxyEngine()
+    : m_completionPort(NULL),
+      m_listenSocket(INVALID_SOCKET),
+      m_socksParentPort(0),
+      m_wsaStarted(false),
+      m_stopping(0),
+      m_acceptEx(NULL),
+      m_connectEx(NULL),
+      m_pendingAccepts(0),
+      m_bytesTransferred(0)
+{
+    m_bufferPool = (PSLIST_HEADER)_aligned_malloc(sizeof(SLIST_HEADER), MEMORY_ALLOCATION_ALIGNMENT);
+
+    if (m_bufferPool == NULL)
+    {
+        throw std::exception(__FUNCTION__ ":" STRINGIZE(__LINE__) " initialization failed");
+    }
+
+    InitializeSListHead(m_bufferPool);
+}
+
+HttpProxyEngine::~HttpProxyEngine()
+{
+    Stop();
+
+    PSLIST_ENTRY entry;
+    while ((entry = InterlockedPopEntrySList(m_bufferPool)) != NULL)
+    {
+        _aligned_free(entry);
+    }
+    _aligned_free(m_bufferPool);
+}
+
+bool HttpProxyEngine::Start(int localPort, int socksParentPort)
+{
+    assert(m_completionPort == NULL);
+
+    m_socksParentPort = socksParentPort;
+    m_stopping = 0;
+
+    WSADATA wsaData;
+    if (0 != WSAStartup(MAKEWORD(2, 2), &wsaData))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: WSAStartup failed (%d)"), __TFUNCTION__, WSAGetLastError());
+        return false;
+    }
+    m_wsaStarted = true;
+
+    m_completionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, PROXY_IO_THREAD_COUNT);
+    if (m_completionPort == NULL)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: CreateIoCompletionPort failed (%d)"), __TFUNCTION__, GetLastError());
+        Stop();
+        return false;
+    }
+
+    m_listenSocket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED);
+    if (m_listenSocket == INVALID_SOCKET)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: WSASocket failed (%d)"), __TFUNCTION__, WSAGetLastError());
+        Stop();
+        return false;
+    }
+
+    // Look up the extension functions (available on XP, but not exported)
+    GUID acceptExGuid = WSAID_ACCEPTEX;
+    GUID connectExGuid = WSAID_CONNECTEX;
+    DWORD bytes = 0;
+    if (0 != WSAIoctl(m_listenSocket, SIO_GET_EXTENSION_FUNCTION_POINTER, &acceptExGuid, sizeof(acceptExGuid),
+                      &m_acceptEx, sizeof(m_acceptEx), &bytes, NULL, NULL)
+        || 0 != WSAIoctl(m_listenSocket, SIO_GET_EXTENSION_FUNCTION_POINTER, &connectExGuid, sizeof(connectExGuid),
+                         &m_connectEx, sizeof(m_connectEx), &bytes, NULL, NULL))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: WSAIoctl failed (%d)"), __TFUNCTION__, WSAGetLastError());
+        Stop();
+        return false;
+    }
+
+    sockaddr_in listenAddress;
+    ZeroMemory(&listenAddress, sizeof(listenAddress));
+    listenAddress.sin_family = AF_INET;
+    listenAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    listenAddress.sin_port = htons((USHORT)localPort);
+
+    if (0 != bind(m_listenSocket, (sockaddr*)&listenAddress, sizeof(listenAddress))
+        || 0 != listen(m_listenSocket, SOMAXCONN)
+        || NULL == CreateIoCompletionPort((HANDLE)m_listenSocket, m_completionPort, COMPLETION_KEY_IO, 0))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: failed to listen on port %d (%d)"), __TFUNCTION__, localPort, WSAGetLastError());
+        Stop();
+        return false;
+    }
+
+    for (int i = 0; i < PROXY_IO_THREAD_COUNT; i++)
+    {
+        HANDLE thread = CreateThread(0, 0, HttpProxyEngine::IoThread, (void*)this, 0, 0);
+        if (thread == NULL)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: CreateThread failed (%d)"), __TFUNCTION__, GetLastError());
+            Stop();
+            return false;
+        }
+        m_threads.push_back(thread);
+    }
+
+    for (int i = 0; i < PROXY_OUTSTANDING_ACCEPTS; i++)
+    {
+        HttpProxyIoContext* context = new HttpProxyIoContext();
+        context->operation = IO_OPERATION_ACCEPT;
+        context->buffer = AllocateBuffer();
+        m_acceptContexts.push_back(context);
+
+        if (!PostAccept(context))
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: AcceptEx failed (%d)"), __TFUNCTION__, WSAGetLastError());
+            Stop();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void HttpProxyEngine::Stop()
+{
+    InterlockedExchange(&m_stopping, 1);
+
+    // Cancels the outstanding accepts
+    if (m_listenSocket != INVALID_SOCKET)
+    {
+        closesocket(m_listenSocket);
+        m_listenSocket = INVALID_SOCKET;
+    }
+
+    {
+        AutoLock lock(m_lock);
+        for (set<HttpProxyConnection*>::iterator it = m_connections.begin(); it != m_connections.end(); ++it)
+        {
+            // Close needs the connection's lock, as its I/O threads use and
+            // close the sockets too. Our lock keeps it from being deleted.
+            AutoLock connectionLock((*it)->m_lock);
+            // Connections delete themselves once their cancelled I/O completes
+            (*it)->Close();
+        }
+    }
+
+    // Let the I/O threads drain the cancellations. The OVERLAPPEDs must stay
+    // valid until then.
+    bool drained = m_threads.empty();
+    DWORD start = GetTickCount();
+    while (!drained && GetTickCount() - start < PROXY_STOP_TIMEOUT_MS)
+    {
+        {
+            AutoLock lock(m_lock);
+            drained = m_connections.empty() && m_pendingAccepts == 0;
+        }
+        if (!drained) Sleep(10);
+    }
+
+    if (!drained)
+    {
+        // Leak the remaining connections rather than free memory the system
+        // may still write to
+        my_print(NOT_SENSITIVE, false, _T("%s: timed out waiting for connections to close"), __TFUNCTION__);
+    }
+
+    for (size_t i = 0; i < m_threads.size(); i++)
+    {
+        PostQueuedCompletionStatus(m_completionPort, 0, COMPLETION_KEY_QUIT, NULL);
+    }
+    if (!m_threads.empty())
+    {
+        WaitForMultipleObjects(m_threads.size(), &m_threads[0], TRUE, INFINITE);
+    }
+    for (size_t i = 0; i < m_threads.size(); i++)
+    {
+        CloseHandle(m_threads[i]);
+    }
+    m_threads.clear();
+
+    if (drained)
+    {
+        for (size_t i = 0; i < m_acceptContexts.size(); i++)
+        {
+            FreeBuffer(m_acceptContexts[i]->buffer);
+            delete m_acceptContexts[i];
+        }
+    }
+    m_acceptContexts.clear();
+    m_pendingAccepts = 0;
+
+    {
+        AutoLock lock(m_lock);
+        m_connections.clear();
+    }
+
+    if (m_completionPort != NULL)
+    {
+        CloseHandle(m_completionPort);
+        m_completionPort = NULL;
+    }
+
+    if (m_wsaStarted)
+    {
+        WSACleanup();
+        m_wsaStarted = false;
+    }
+}
+
+void HttpProxyEngine::TakeStats(
+                        vector<string>& o_pageViews,
+                        vector<string>& o_httpsRequests,
+                        unsigned long long& o_bytesTransferred,
+                        unordered_map<string, unsigned long long>& o_pageViewBytes,
+                        unordered_map<string, unsigned long long>& o_httpsRequestBytes)
+{
+    AutoLock lock(m_statsLock);
+
+    o_pageViews.clear();
+    o_pageViews.swap(m_pageViews);
+    o_httpsRequests.clear();
+    o_httpsRequests.swap(m_httpsRequests);
+    o_bytesTransferred = m_bytesTransferred;
+    m_bytesTransferred = 0;
+    o_pageViewBytes.clear();
+    o_pageViewBytes.swap(m_pageViewBytes);
+    o_httpsRequestBytes.clear();
+    o_httpsRequestBytes.swap(m_httpsRequestBytes);
+}
+
+// static
+DWORD WINAPI HttpProxyEngine::IoThread(void* object)
+{
+    HttpProxyEngine* _this = (HttpProxyEngine*)object;
+
+    while (true)
+    {
+        DWORD bytes = 0;
+        ULONG_PTR key = 0;
+        OVERLAPPED* overlapped = NULL;
+
+        BOOL success = GetQueuedCompletionStatus(_this->m_completionPort, &bytes, &key, &overlapped, INFINITE);
+
+        if (overlapped == NULL)
+        {
+            // Either a quit request or the port itself failed
+            break;
+        }
+
+        HttpProxyIoContext* context = CONTAINING_RECORD(overlapped, HttpProxyIoContext, overlapped);
+        _this->HandleCompletion(context, !!success, bytes);
+    }
+
+    return 0;
+}
+
+void HttpProxyEngine::HandleCompletion(HttpProxyIoContext* context, bool success, DWORD bytes)
+{
+    if (context->operation == IO_OPERATION_ACCEPT)
+    {
+        HandleAcceptCompletion(context, success);
+    }
+    else
+    {
+        context->connection->OnCompletion(context, success, bytes);
+    }
+}
+
+bool HttpProxyEngine::PostAccept(HttpProxyIoContext* context)
+{
+    context->socket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED);
+    if (context->socket == INVALID_SOCKET)
+    {
+        return false;
+    }
+
+    ZeroMemory(&context->overlapped, sizeof(context->overlapped));
+
+    InterlockedIncrement(&m_pendingAccepts);
+
+    DWORD bytes = 0;
+    LPFN_ACCEPTEX acceptEx = (LPFN_ACCEPTEX)m_acceptEx;
+    if (!acceptEx(m_listenSocket, context->socket, context->buffer,
+                  0, // don't wait for data
+                  ACCEPT_ADDRESS_LENGTH, ACCEPT_ADDRESS_LENGTH,
+                  &bytes, &context->overlapped)
+        && WSAGetLastError() != ERROR_IO_PENDING)
+    {
+        InterlockedDecrement(&m_pendingAccepts);
+        closesocket(context->socket);
+        context->socket = INVALID_SOCKET;
+        return false;
+    }
+
+    return true;
+}
+
+void HttpProxyEngine::HandleAcceptCompletion(HttpProxyIoContext* context, bool success)
+{
+    SOCKET clientSocket = context->socket;
+    context->socket = INVALID_SOCKET;
+
+    HttpProxyConnection* connection = NULL;
+
+    if (success
+        && !m_stopping
+        && 0 == setsockopt(clientSocket, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, (char*)&m_listenSocket, sizeof(m_listenSocket))
+        && NULL != CreateIoCompletionPort((HANDLE)clientSocket, m_completionPort, COMPLETION_KEY_IO, 0))
+    {
+        AutoLock lock(m_lock);
+        // Checked again under the lock, which Stop holds while closing connections
+        if (!m_stopping)
+        {
+            connection = new HttpProxyConnection(this, clientSocket);
+            m_connections.insert(connection);
+        }
+    }
+
+    if (connection)
+    {
+        connection->Start();
+    }
+    else
+    {
+        closesocket(clientSocket);
+    }
+
+    if (!m_stopping && !PostAccept(context))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: AcceptEx failed (%d)"), __TFUNCTION__, WSAGetLastError());
+    }
+
+    InterlockedDecrement(&m_pendingAccepts);
+}
+
+void HttpProxyEngine::RecordPageView(const string& url)
+{
+    AutoLock lock(m_statsLock);
+    if (m_pageViews.size() < PROXY_MAX_PENDING_STATS_ENTRIES)
+    {
+        m_pageViews.push_back(url);
+    }
+}
+
+void HttpProxyEngine::RecordHttpsRequest(const string& hostPort)
+{
+    AutoLock lock(m_statsLock);
+    if (m_httpsRequests.size() < PROXY_MAX_PENDING_STATS_ENTRIES)
+    {
+        m_httpsRequests.push_back(hostPort);
+    }
+}
+
+void HttpProxyEngine::RecordBytesTransferred(unsigned long long bytes, bool isConnectRequest, const string& target)
+{
+    AutoLock lock(m_statsLock);
+    m_bytesTransferred += bytes;
+
+    if (target.empty())
+    {
+        return;
+    }
+
+    // Past the bound, new targets are only in the total.
+    unordered_map<string, unsigned long long>& targetBytes =
+        isConnectRequest ? m_httpsRequestBytes : m_pageViewBytes;
+    auto it = targetBytes.find(target);
+    if (it != targetBytes.end())
+    {
+        it->second += bytes;
+    }
+    else if (targetBytes.size() < PROXY_MAX_PENDING_STATS_ENTRIES)
+    {
+        targetBytes[target] = bytes;
+    }
+}
+
+void HttpProxyEngine::RemoveConnection(HttpProxyConnection* connection)
+{
+    AutoLock lock(m_lock);
+    m_connections.erase(connection);
+}
+
+char* HttpProxyEngine::AllocateBuffer()
+{
+    char* block = (char*)InterlockedPopEntrySList(m_bufferPool);
+    if (block == NULL)
+    {
+        block = (char*)_aligned_malloc(PROXY_BUFFER_HEADER_SIZE + PROXY_BUFFER_SIZE, MEMORY_ALLOCATION_ALIGNMENT);
+        if (block == NULL)
+        {
+            throw std::bad_alloc();
+        }
+    }
+    return block + PROXY_BUFFER_HEADER_SIZE;
+}
+
+void HttpProxyEngine::FreeBuffer(char* buffer)
+{
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    char* block = buffer - PROXY_BUFFER_HEADER_SIZE;
+    if (QueryDepthSList(m_bufferPool) >= PROXY_MAX_POOLED_BUFFERS)
+    {
+        _aligned_free(block);
+    }
+    else
+    {
+        InterlockedPushEntrySList(m_bufferPool, (PSLIST_ENTRY)block);
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <WinSock2.h>
+#include <set>
+#include <unordered_map>
+#include "utilities.h"
+
+
+struct HttpProxyConnection;
+struct HttpProxyIoContext;
+
+
+/*
+An in-process alternative to Polipo. Listens on a localhost port and serves
+HTTP proxy requests -- CONNECT tunnels and plain (absolute-URI) HTTP
+requests -- either directly or by forwarding them through a SOCKS5 proxy on
+another localhost port. All socket I/O is overlapped and completed on a
+small pool of threads via an I/O completion port.
+
+Unlike Polipo it does no split tunneling, caching, or keep-alive: each
+client connection carries one plain HTTP request (it's forwarded with
+"Connection: close").
+
+Stats are accumulated internally and collected with TakeStats.
+*/
+class HttpProxyEngine
+{
+public:
+    HttpProxyEngine();
+    virtual ~HttpProxyEngine();
+
+    // Returns false if the engine couldn't start listening on localPort.
+    // If socksParentPort is 0, connections are made directly.
+    bool Start(int localPort, int socksParentPort);
+
+    // Blocking call. Closes all connections and waits for the I/O threads.
+    void Stop();
+
+    // Moves out the page views (absolute URLs), HTTPS requests (host:port)
+    // and the number of bytes relayed since the last call. The bytes are
+    // also broken down by the page view or HTTPS request each connection
+    // carried, as far as the bounds on pending stats allow.
+    void TakeStats(
+            vector<string>& o_pageViews,
+            vector<string>& o_httpsRequests,
+            unsigned long long& o_bytesTransferred,
+            unordered_map<string, unsigned long long>& o_pageViewBytes,
+            unordered_map<string, unsigned long long>& o_httpsRequestBytes);
+
+private:
+    friend struct HttpProxyConnection;
+
+    static DWORD WINAPI IoThread(void* object);
+
+    bool PostAccept(HttpProxyIoContext* context);
+    void HandleAcceptCompletion(HttpProxyIoContext* context, bool success);
+    void HandleCompletion(HttpProxyIoContext* context, bool success, DWORD bytes);
+
+    void RecordPageView(const string& url);
+    void RecordHttpsRequest(const string& hostPort);
+    // target is what RecordPageView or RecordHttpsRequest was given for the
+    // connection, if anything.
+    void RecordBytesTransferred(unsigned long long bytes, bool isConnectRequest, const string& target);
+
+    void RemoveConnection(HttpProxyConnection* connection);
+
+    char* AllocateBuffer();
+    void FreeBuffer(char* buffer);
+
+private:
+    // Guards m_connections. Taken before any connection's own lock.
+    Lock m_lock;
+    HANDLE m_completionPort;
+    vector<HANDLE> m_threads;
+    SOCKET m_listenSocket;
+    int m_socksParentPort;
+    bool m_wsaStarted;
+    volatile LONG m_stopping;
+
+    // Extension functions, looked up at Start
+    void* m_acceptEx;
+    void* m_connectEx;
+
+    vector<HttpProxyIoContext*> m_acceptContexts;
+    volatile LONG m_pendingAccepts;
+    set<HttpProxyConnection*> m_connections;
+
+    // Guarded by m_statsLock, which may be taken while holding a
+    // connection's lock
+    Lock m_statsLock;
+    vector<string> m_pageViews;
+    vector<string> m_httpsRequests;
+    unsigned long long m_bytesTransferred;
+    unordered_map<string, unsigned long long> m_pageViewBytes;
+    unordered_map<string, unsigned long long> m_httpsRequestBytes;
+
+    // Recycled I/O buffers; see AllocateBuffer
+    PSLIST_HEADER m_bufferPool;
+};
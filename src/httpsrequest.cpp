@@ -27,9 +27,12 @@
 #include "stopsignal.h"
 #include "systemproxysettings.h"
 #include "transport_connection.h"
+#include "temp_tunnel_pool.h"
 #include "transport_registry.h"
 #include "coretransport.h"
 #include "utilities.h"
+#include "tracing.h"
+#include "tunnel_metrics.h"
 
 
 // NOTE: this code depends on built-in Windows crypto services
@@ -47,15 +50,133 @@ public:
     ~AutoHINTERNET() { this->WinHttpCloseHandle(); }
     operator HINTERNET() {return m_handle;}
     void WinHttpCloseHandle() { if (m_handle != NULL) ::WinHttpCloseHandle(m_handle); m_handle = NULL; }
+    HINTERNET Detach() { HINTERNET handle = m_handle; m_handle = NULL; return handle; }
 private:
     HINTERNET m_handle;
 };
 
 
+// WinHTTP keeps connections alive per session handle, so sessions (and their
+// connection handles) are kept for reuse by later requests to the same server
+// through the same proxy. This saves a TCP and TLS setup per request, which is
+// a lot with a high-latency transport.
+// Must be less than tunnel-core's idle connection timeout (30 seconds); see
+// the comment where the request headers are set.
+#define HTTPS_SESSION_POOL_IDLE_TIMEOUT_MS  20000
+#define HTTPS_SESSION_POOL_MAX_ENTRIES      8
+
+struct PooledSession
+{
+    string key;
+    HINTERNET hSession;
+    HINTERNET hConnect;
+    DWORD lastUsedTime;
+
+    PooledSession() : hSession(NULL), hConnect(NULL), lastUsedTime(0) {}
+    ~PooledSession()
+    {
+        if (hConnect != NULL) WinHttpCloseHandle(hConnect);
+        if (hSession != NULL) WinHttpCloseHandle(hSession);
+    }
+};
+
+// Only idle sessions are in the pool. A request takes its session out while
+// it's in use, so no session is ever used by two requests at once.
+static Lock g_sessionPoolLock("HTTPSRequestSessionPool");
+static vector<PooledSession*> g_sessionPool;
+
+// Must be called with g_sessionPoolLock held.
+static void EvictIdlePooledSessions()
+{
+    DWORD now = GetTickCount();
+    for (vector<PooledSession*>::iterator it = g_sessionPool.begin(); it != g_sessionPool.end();)
+    {
+        if (now - (*it)->lastUsedTime >= HTTPS_SESSION_POOL_IDLE_TIMEOUT_MS)
+        {
+            delete *it;
+            it = g_sessionPool.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+// Returns NULL if there's no idle session for the key.
+static PooledSession* TakePooledSession(const string& key)
+{
+    AutoLock lock(g_sessionPoolLock);
+
+    EvictIdlePooledSessions();
+
+    for (vector<PooledSession*>::iterator it = g_sessionPool.begin(); it != g_sessionPool.end(); ++it)
+    {
+        if ((*it)->key == key)
+        {
+            PooledSession* session = *it;
+            g_sessionPool.erase(it);
+            return session;
+        }
+    }
+
+    return NULL;
+}
+
+// Takes ownership of session. It's only kept if reusable -- i.e., the request
+// made with it succeeded.
+static void ReturnPooledSession(PooledSession* session, bool reusable)
+{
+    AutoLock lock(g_sessionPoolLock);
+
+    EvictIdlePooledSessions();
+
+    if (!reusable || g_sessionPool.size() >= HTTPS_SESSION_POOL_MAX_ENTRIES)
+    {
+        delete session;
+        return;
+    }
+
+    session->lastUsedTime = GetTickCount();
+    g_sessionPool.push_back(session);
+}
+
+// Discards the session (the request failed before it was sent) when it goes
+// out of scope, unless detached.
+class PooledSessionLease
+{
+public:
+    PooledSessionLease(PooledSession* session) : m_session(session) {}
+    ~PooledSessionLease() { if (m_session) ReturnPooledSession(m_session, false); }
+    PooledSession* operator->() {return m_session;}
+    PooledSession* Get() {return m_session;}
+    PooledSession* Detach() { PooledSession* session = m_session; m_session = NULL; return session; }
+private:
+    PooledSession* m_session;
+};
+
+// static
+void HTTPSRequest::ReleasePooledSessions()
+{
+    AutoLock lock(g_sessionPoolLock);
+
+    for (vector<PooledSession*>::iterator it = g_sessionPool.begin(); it != g_sessionPool.end(); ++it)
+    {
+        delete *it;
+    }
+    g_sessionPool.clear();
+}
+
+
 HTTPSRequest::HTTPSRequest(bool silentMode/*=false*/)
-    : m_silentMode(silentMode), m_closedEvent(NULL)
+    : m_silentMode(silentMode), m_closedEvent(NULL),
+      m_requestSuccess(false),
+      m_requestHandle(NULL), m_requestClosing(false), m_requestClosed(false),
+      m_pooledSession(NULL),
+      m_stopWait(NULL), m_stopWaitThreadId(0),
+      m_responseSink(NULL)
 {
-    m_mutex = CreateMutex(NULL, FALSE, 0);
+    ZeroMemory(m_phaseTimes, sizeof(m_phaseTimes));
 }
 
 HTTPSRequest::~HTTPSRequest()
@@ -67,8 +188,45 @@ HTTPSRequest::~HTTPSRequest()
         CloseHandle(m_closedEvent);
         m_closedEvent = NULL;
     }
+}
 
-    CloseHandle(m_mutex);
+// Gets a response header as UTF-8. Returns false if it's not present.
+static bool QueryHeaderString(HINTERNET hRequest, DWORD infoLevel, string& o_value)
+{
+    o_value.clear();
+
+    // A false return is expected, because we're obtaining the required size.
+    DWORD dwLen = 0;
+    if (WinHttpQueryHeaders(
+            hRequest,
+            infoLevel,
+            WINHTTP_HEADER_NAME_BY_INDEX,
+            NULL,
+            &dwLen,
+            WINHTTP_NO_HEADER_INDEX)
+        || GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+    {
+        return false;
+    }
+
+    wstring buf;
+    buf.resize(dwLen / sizeof(WCHAR) + 1, '\0');
+
+    if (!WinHttpQueryHeaders(
+            hRequest,
+            infoLevel,
+            WINHTTP_HEADER_NAME_BY_INDEX,
+            (LPVOID)buf.data(),
+            &dwLen,
+            WINHTTP_NO_HEADER_INDEX))
+    {
+        return false;
+    }
+
+    // On success, dwLen is the length without the terminating null.
+    buf.resize(dwLen / sizeof(WCHAR));
+    o_value = WStringToUTF8(buf);
+    return true;
 }
 
 void CALLBACK WinHttpStatusCallback(
@@ -99,12 +257,27 @@ void CALLBACK WinHttpStatusCallback(
     DWORD errorCode = 0;
     switch (dwInternetStatus)
     {
+    case WINHTTP_CALLBACK_STATUS_RESOLVING_NAME:
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_RESOLVING);
+        break;
+    case WINHTTP_CALLBACK_STATUS_NAME_RESOLVED:
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_RESOLVED);
+        break;
+    case WINHTTP_CALLBACK_STATUS_CONNECTING_TO_SERVER:
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_CONNECTING);
+        break;
+    case WINHTTP_CALLBACK_STATUS_CONNECTED_TO_SERVER:
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_CONNECTED);
+        break;
     case WINHTTP_CALLBACK_STATUS_HANDLE_CLOSING:
         // This is ALWAYS the last notification; once it sets closed signal
         // it's safe to deallocate the parent httpRequest
-        httpRequest->SetClosedEvent();
+        httpRequest->OnRequestClosed();
         break;
     case WINHTTP_CALLBACK_STATUS_SENDING_REQUEST:
+        // The TLS handshake, if any, is done by now.
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_SENDING);
+
         // NOTE: from experimentation, this is really the earliest we can inject our custom server cert validation.
         // As far as we know, this is before any data is sent over the SSL connection, so it's soon enough.
         // E.g., we tried to verify the cert earlier but:
@@ -124,7 +297,7 @@ void CALLBACK WinHttpStatusCallback(
                 || NULL == pCert)
             {
                 my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpQueryOption failed (%d)"), GetLastError());
-                WinHttpCloseHandle(hRequest);
+                httpRequest->CloseRequest();
                 return;
             }
 
@@ -135,7 +308,7 @@ void CALLBACK WinHttpStatusCallback(
             {
                 my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("ValidateServerCert failed"));
                 // Close request handle immediately to prevent sending of data
-                WinHttpCloseHandle(hRequest);
+                httpRequest->CloseRequest();
                 return;
             }
         }
@@ -147,42 +320,33 @@ void CALLBACK WinHttpStatusCallback(
         if (!WinHttpReceiveResponse(hRequest, NULL))
         {
             my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpReceiveResponse failed (%d)"), GetLastError());
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
         break;
     case WINHTTP_CALLBACK_STATUS_HEADERS_AVAILABLE:
 
+        httpRequest->MarkPhase(HTTPSRequest::PHASE_HEADERS);
+
         // Get Date header. We're not going to error if we can't get it.
         // This comes before the status code check, because the Date header
         // should be valid for all responses.
-        dwLen = sizeof(dwStatusCode);
-        if (!WinHttpQueryHeaders(
-            hRequest,
-            WINHTTP_QUERY_DATE,
-            WINHTTP_HEADER_NAME_BY_INDEX,
-            NULL,
-            &dwLen,
-            WINHTTP_NO_HEADER_INDEX))
         {
-            // False return is expected, because we're obtaining the required size.
-            if (GetLastError() == ERROR_INSUFFICIENT_BUFFER) {
-                wstring buf;
-                buf.resize(dwLen / sizeof(WCHAR) + 1, '\0');
-
-                if (WinHttpQueryHeaders(
-                    hRequest,
-                    WINHTTP_QUERY_DATE,
-                    WINHTTP_HEADER_NAME_BY_INDEX,
-                    (LPVOID)buf.data(),
-                    &dwLen,
-                    WINHTTP_NO_HEADER_INDEX))
-                {
-                    httpRequest->ResponseSetDateHeader(WStringToUTF8(buf));
-                }
+            string dateHeader;
+            if (QueryHeaderString(hRequest, WINHTTP_QUERY_DATE, dateHeader))
+            {
+                httpRequest->ResponseSetDateHeader(dateHeader);
             }
         }
 
+        // Cache validators, for callers making conditional requests. Also optional.
+        {
+            string etag, lastModified;
+            QueryHeaderString(hRequest, WINHTTP_QUERY_ETAG, etag);
+            QueryHeaderString(hRequest, WINHTTP_QUERY_LAST_MODIFIED, lastModified);
+            httpRequest->ResponseSetValidators(etag, lastModified);
+        }
+
         // Check for HTTP status 200 OK
         dwLen = sizeof(dwStatusCode);
         if (!WinHttpQueryHeaders(
@@ -194,17 +358,40 @@ void CALLBACK WinHttpStatusCallback(
                         NULL))
         {
             my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpQueryHeaders failed (%d)"), GetLastError());
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
 
         httpRequest->ResponseSetCode(dwStatusCode);
         my_print(NOT_SENSITIVE, true, _T("HTTP request status code: %d"), dwStatusCode);
 
+        // Content-Length is optional (e.g., chunked responses), so 0 if missing.
+        {
+            DWORD contentLength = 0;
+            dwLen = sizeof(contentLength);
+            if (!WinHttpQueryHeaders(
+                        hRequest,
+                        WINHTTP_QUERY_CONTENT_LENGTH | WINHTTP_QUERY_FLAG_NUMBER,
+                        NULL,
+                        &contentLength,
+                        &dwLen,
+                        NULL))
+            {
+                contentLength = 0;
+            }
+
+            if (!httpRequest->ResponseBeginBody(contentLength))
+            {
+                my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("Response sink failed to begin"));
+                httpRequest->CloseRequest();
+                return;
+            }
+        }
+
         if (!WinHttpQueryDataAvailable(hRequest, 0))
         {
             my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpQueryDataAvailable failed (%d)"), GetLastError());
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
         break;
@@ -218,8 +405,9 @@ void CALLBACK WinHttpStatusCallback(
         {
             // Read response is complete
 
+            httpRequest->MarkPhase(HTTPSRequest::PHASE_DONE);
             httpRequest->SetRequestSuccess();
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
 
@@ -227,7 +415,7 @@ void CALLBACK WinHttpStatusCallback(
 
         if (!pBuffer)
         {
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
 
@@ -235,14 +423,20 @@ void CALLBACK WinHttpStatusCallback(
         {
             my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpReadData failed (%d)"), GetLastError());
             HeapFree(GetProcessHeap(), 0, pBuffer);
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
 
         // NOTE: response data may be binary; some relevant comments here...
         // http://stackoverflow.com/questions/441203/proper-way-to-store-binary-data-with-c-stl
 
-        httpRequest->ResponseAppendBody(string(string::const_pointer(pBuffer), string::const_pointer((char*)pBuffer + dwLen)));
+        if (!httpRequest->ResponseAppendBody((const char*)pBuffer, dwLen))
+        {
+            my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("Response sink write failed"));
+            HeapFree(GetProcessHeap(), 0, pBuffer);
+            httpRequest->CloseRequest();
+            return;
+        }
 
         HeapFree(GetProcessHeap(), 0, pBuffer);
 
@@ -251,7 +445,7 @@ void CALLBACK WinHttpStatusCallback(
         if (!WinHttpQueryDataAvailable(hRequest, 0))
         {
             my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("WinHttpQueryDataAvailable failed (%d)"), GetLastError());
-            WinHttpCloseHandle(hRequest);
+            httpRequest->CloseRequest();
             return;
         }
         break;
@@ -264,7 +458,7 @@ void CALLBACK WinHttpStatusCallback(
                      ((WINHTTP_ASYNC_RESULT*)lpvStatusInformation)->dwResult,
                      ((WINHTTP_ASYNC_RESULT*)lpvStatusInformation)->dwError);
         }
-        WinHttpCloseHandle(hRequest);
+        httpRequest->CloseRequest();
         break;
     case WINHTTP_CALLBACK_STATUS_SECURE_FAILURE:
         if (lpvStatusInformation)
@@ -272,7 +466,7 @@ void CALLBACK WinHttpStatusCallback(
             errorCode = *(DWORD *)lpvStatusInformation;
         }
         my_print(NOT_SENSITIVE, httpRequest->m_silentMode, _T("HTTP secure failure (%d)"), errorCode);
-        WinHttpCloseHandle(hRequest);
+        httpRequest->CloseRequest();
         break;
     default:
         // No action on other events
@@ -298,7 +492,16 @@ bool HTTPSRequest::MakeRequest(
     // http://stackoverflow.com/questions/29801450/winhttp-doesnt-download-from-amazon-s3-on-winxp
     // In this case, we can use the tunnel core URL proxy to make the request using a different http client stack.
 
-    bool success = MakeRequestWithURLProxyOption(
+    // The path isn't traced, as it may have identifying parameters.
+    DWORD traceStartTime = GetTickCount();
+    bool success = false;
+    TRACE_EVENT(TRACE_KEYWORD_HTTPS, _T("HTTPSRequest/Start: %s:%d"), serverAddress, serverWebPort);
+    auto traceEnd = finally([&]() {
+        TRACE_EVENT(TRACE_KEYWORD_HTTPS, _T("HTTPSRequest/End: %s:%d %s, %d ms"),
+            serverAddress, serverWebPort, success ? _T("succeeded") : _T("failed"), GetTickCount() - traceStartTime);
+    });
+
+    success = MakeRequestWithURLProxyOption(
         serverAddress, serverWebPort, webServerCertificate, requestPath,
         stopInfo, usePsiphonLocalProxy, response,
         false, // useURLProxy
@@ -356,19 +559,14 @@ bool HTTPSRequest::MakeRequest(
 
             try
             {
-                TransportConnection connection;
-
                 // Throws on failure
-                connection.Connect(
-                    stopInfo,
-                    TransportRegistry::New(CORE_TRANSPORT_PROTOCOL_NAME),
-                    NULL, // not receiving reconnection notifications
-                    NULL, // not receiving upgrade paver calls
-                    NULL, // not collecting stats
-                    NULL, // not supplying authorizations
-                    new ServerEntry(), // this empty ServerEntry is the flag for URL proxy mode; we don't need to connect to a specific server
-                    true);// don't apply system proxy settings (or write to the Psiphon proxy settings registry key)
-                          // as another transport might currently be running
+                unique_ptr<TempTunnel> urlProxy = TempTunnelPool::Acquire(
+                    _T("URL proxy"),
+                    shared_ptr<ITransport>(TransportRegistry::New(CORE_TRANSPORT_PROTOCOL_NAME)),
+                    ServerEntry(), // this empty ServerEntry is the flag for URL proxy mode; we don't need to connect to a specific server
+                    true,          // don't apply system proxy settings (or write to the Psiphon proxy settings registry key)
+                                   // as another transport might currently be running
+                    stopInfo);
 
                 // NOTE that we will always make "direct" requests since this URL proxy will not establish a tunnel
                 tstringstream urlProxyRequestPath;
@@ -377,14 +575,14 @@ bool HTTPSRequest::MakeRequest(
                 my_print(NOT_SENSITIVE, true, _T("%s:%d - Making direct URL proxy request with temp tunnel-core"), __TFUNCTION__, __LINE__);
 
                 success = MakeRequestWithURLProxyOption(
-                    _T("127.0.0.1"), connection.GetTransportLocalHttpProxy(), 
+                    _T("127.0.0.1"), urlProxy->connection.GetTransportLocalHttpProxy(), 
                     webServerCertificate, urlProxyRequestPath.str().c_str(),
                     stopInfo, usePsiphonLocalProxy, response,
                     true, // useURLProxy
                     additionalHeaders, additionalData, additionalDataLength, httpVerb);
 
-                // Note that when we leave this scope, the TransportConnection will
-                // clean up the transport connection.
+                // Kept for a following request, if it's still up
+                TempTunnelPool::Release(std::move(urlProxy));
             }
             catch (StopSignal::StopException&)
             {
@@ -419,6 +617,290 @@ bool HTTPSRequest::MakeRequestWithURLProxyOption(
     // Throws if signaled
     stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
 
+    if (!StartRequest(
+            serverAddress, serverWebPort, webServerCertificate, requestPath,
+            usePsiphonLocalProxy, useURLProxy,
+            additionalHeaders, additionalData, additionalDataLength, httpVerb))
+    {
+        return false;
+    }
+
+    // Wait for asynch callback to close, or for a stop. The timeout is for
+    // stop signals whose event doesn't cover every reason (see
+    // TempTunnelStopSignal).
+
+    HANDLE waitHandles[2] = { m_closedEvent, stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons) };
+    DWORD waitHandlesCount = waitHandles[1] ? 2 : 1;
+
+    while (true)
+    {
+        DWORD result = WaitForMultipleObjects(waitHandlesCount, waitHandles, FALSE, 100);
+
+        if (result == WAIT_TIMEOUT || result == WAIT_OBJECT_0 + 1)
+        {
+            if (stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, false))
+            {
+                CloseRequest();
+                WaitForSingleObject(m_closedEvent, INFINITE);
+                CloseHandle(m_closedEvent);
+                m_closedEvent = NULL;
+
+                return false;
+            }
+        }
+        else if (result != WAIT_OBJECT_0)
+        {
+            // internal error
+            CloseRequest();
+            WaitForSingleObject(m_closedEvent, INFINITE);
+            CloseHandle(m_closedEvent);
+            m_closedEvent = NULL;
+            return false;
+        }
+        else
+        {
+            // callback has closed
+            break;
+        }
+    }
+
+    CloseHandle(m_closedEvent);
+    m_closedEvent = NULL;
+
+    if (m_requestSuccess)
+    {
+        response = std::move(m_response);
+        m_response = Response();
+        return true;
+    }
+
+    return false;
+}
+
+bool HTTPSRequest::MakeRequestAsync(
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const string& webServerCertificate,
+        const TCHAR* requestPath,
+        const StopInfo& stopInfo,
+        PsiphonProxy usePsiphonLocalProxy,
+        CompletionCallback onComplete,
+        LPCWSTR additionalHeaders/*=NULL*/,
+        LPVOID additionalData/*=NULL*/,
+        DWORD additionalDataLength/*=0*/,
+        LPCWSTR httpVerb/*=NULL*/)
+{
+    assert(onComplete);
+
+    // Throws if signaled
+    stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+    // Set before the request is sent, as it may complete right away.
+    m_completionCallback = onComplete;
+    m_asyncStopInfo = stopInfo;
+
+    if (!StartRequest(
+            serverAddress, serverWebPort, webServerCertificate, requestPath,
+            usePsiphonLocalProxy,
+            false, // useURLProxy
+            additionalHeaders, additionalData, additionalDataLength, httpVerb))
+    {
+        m_completionCallback = nullptr;
+        return false;
+    }
+
+    // Wake for a stop, as the blocking MakeRequest does. As there, the
+    // periodic timeout is for stop signals whose event doesn't cover every
+    // reason.
+    AutoLock lock(m_lock);
+
+    HANDLE stopEvent = stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons);
+
+    if (!m_requestClosed
+        && (!stopEvent
+            || !RegisterWaitForSingleObject(
+                    &m_stopWait,
+                    stopEvent,
+                    StopWaitCallback,
+                    (PVOID)this,
+                    100,
+                    WT_EXECUTEINWAITTHREAD)))
+    {
+        // The request will still finish (or time out); it just can't be
+        // stopped early.
+        my_print(NOT_SENSITIVE, true, _T("%s: RegisterWaitForSingleObject failed (%d)"), __TFUNCTION__, GetLastError());
+        m_stopWait = NULL;
+    }
+
+    return true;
+}
+
+// static
+void CALLBACK HTTPSRequest::StopWaitCallback(PVOID context, BOOLEAN /*timerOrWaitFired*/)
+{
+    HTTPSRequest* _this = (HTTPSRequest*)context;
+
+    {
+        AutoLock lock(_this->m_lock);
+
+        // See OnRequestClosed
+        _this->m_stopWaitThreadId = GetCurrentThreadId();
+
+        if (_this->m_requestClosing
+            || !_this->m_asyncStopInfo.stopSignal->CheckSignal(_this->m_asyncStopInfo.stopReasons, false))
+        {
+            return;
+        }
+    }
+
+    // The request may complete -- and the object be destroyed -- before this
+    // returns, so it must be the last use of _this.
+    _this->CloseRequest();
+}
+
+void HTTPSRequest::CloseRequest()
+{
+    HINTERNET requestHandle = NULL;
+
+    {
+        AutoLock lock(m_lock);
+
+        // Only close once; the handle is invalid after that.
+        if (m_requestHandle != NULL && !m_requestClosing)
+        {
+            m_requestClosing = true;
+            requestHandle = m_requestHandle;
+        }
+    }
+
+    // Not holding the lock, as WINHTTP_CALLBACK_STATUS_HANDLE_CLOSING may be
+    // delivered on this thread before this returns. See OnRequestClosed.
+    if (requestHandle != NULL)
+    {
+        WinHttpCloseHandle(requestHandle);
+    }
+}
+
+void HTTPSRequest::OnRequestClosed()
+{
+    HANDLE stopWait = NULL;
+    bool onStopWaitThread = false;
+    CompletionCallback completionCallback;
+    bool success = false;
+    Response response;
+    HTTPSRequestTiming timing;
+
+    {
+        AutoLock lock(m_lock);
+
+        if (m_phaseTimes[PHASE_DONE] == 0)
+        {
+            MarkPhase(PHASE_DONE);
+        }
+        timing = GetTiming();
+        m_response.timing = timing;
+
+        m_requestHandle = NULL;
+        m_requestClosing = true;
+        m_requestClosed = true;
+
+        if (m_pooledSession)
+        {
+            ReturnPooledSession(m_pooledSession, m_requestSuccess);
+            m_pooledSession = NULL;
+        }
+
+        stopWait = m_stopWait;
+        m_stopWait = NULL;
+        onStopWaitThread = (m_stopWaitThreadId == GetCurrentThreadId());
+
+        completionCallback.swap(m_completionCallback);
+        if (completionCallback)
+        {
+            success = m_requestSuccess;
+            response = std::move(m_response);
+            m_response = Response();
+        }
+    }
+
+    if (stopWait)
+    {
+        // Wait for any running wait callback to finish, as it uses this
+        // object -- unless this *is* the wait callback, which would deadlock.
+        UnregisterWaitEx(stopWait, onStopWaitThread ? NULL : INVALID_HANDLE_VALUE);
+    }
+
+    if (m_requestSuccess && !m_metricsName.empty())
+    {
+        TunnelMetrics::AddRequestTiming(m_metricsName, timing);
+    }
+
+    if (completionCallback)
+    {
+        completionCallback(success, response);
+    }
+
+    SetClosedEvent();
+}
+
+void HTTPSRequest::MarkPhase(Phase phase)
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    m_phaseTimes[phase] = now.QuadPart;
+}
+
+HTTPSRequestTiming HTTPSRequest::GetTiming() const
+{
+    static LONGLONG frequency = 0;
+    if (frequency == 0)
+    {
+        LARGE_INTEGER value;
+        QueryPerformanceFrequency(&value);
+        frequency = value.QuadPart;
+    }
+
+    // Milliseconds from one phase to another; 0 unless both happened
+    auto elapsed = [this](Phase from, Phase to) -> DWORD
+    {
+        if (m_phaseTimes[from] == 0 || m_phaseTimes[to] == 0 || m_phaseTimes[to] < m_phaseTimes[from])
+        {
+            return 0;
+        }
+        return (DWORD)((m_phaseTimes[to] - m_phaseTimes[from]) * 1000 / frequency);
+    };
+
+    HTTPSRequestTiming timing;
+    timing.reusedConnection = (m_phaseTimes[PHASE_CONNECTED] == 0);
+    timing.dns = elapsed(PHASE_RESOLVING, PHASE_RESOLVED);
+    timing.connect = elapsed(PHASE_CONNECTING, PHASE_CONNECTED);
+    timing.tls = elapsed(PHASE_CONNECTED, PHASE_SENDING);
+    timing.ttfb = elapsed(PHASE_SENDING, PHASE_HEADERS);
+    timing.transfer = elapsed(PHASE_HEADERS, PHASE_DONE);
+    timing.total = elapsed(PHASE_START, PHASE_DONE);
+    return timing;
+}
+
+bool HTTPSRequest::StartRequest(
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const string& webServerCertificate,
+        const TCHAR* requestPath,
+        PsiphonProxy usePsiphonLocalProxy,
+        bool useURLProxy,
+        LPCWSTR additionalHeaders,
+        LPVOID additionalData,
+        DWORD additionalDataLength,
+        LPCWSTR httpVerb)
+{
+    // A previous asynchronous request must be done.
+    if (m_closedEvent != NULL)
+    {
+        WaitForSingleObject(m_closedEvent, INFINITE);
+        CloseHandle(m_closedEvent);
+        m_closedEvent = NULL;
+    }
+
     DWORD dwFlags = 0;
 
     if (webServerCertificate.length() > 0)
@@ -459,64 +941,91 @@ bool HTTPSRequest::MakeRequestWithURLProxyOption(
     }
     my_print(NOT_SENSITIVE, true, _T("%s: %s; proxy: {use: %d, set: %d}"), __TFUNCTION__, reqType.c_str(), usePsiphonLocalProxy, !!proxyHost.length());
 
-    AutoHINTERNET hSession =
-                WinHttpOpen(
-                    _T("Mozilla/4.0 (compatible; MSIE 5.22)"),
-                    proxyHost.length() ? WINHTTP_ACCESS_TYPE_NAMED_PROXY : WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
-                    proxyHost.length() ? proxyHost.c_str() : WINHTTP_NO_PROXY_NAME,
-                    WINHTTP_NO_PROXY_BYPASS,
-                    WINHTTP_FLAG_ASYNC);
+    stringstream sessionKey;
+    sessionKey << WStringToUTF8(serverAddress) << ":" << serverWebPort
+               << "|" << WStringToUTF8(proxyHost)
+               << "|" << (int)usePsiphonLocalProxy << "|" << useURLProxy
+               << "|" << webServerCertificate;
 
-    if (NULL == hSession)
+    PooledSession* pooledSession = TakePooledSession(sessionKey.str());
+    if (pooledSession == NULL)
     {
-        my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpOpen failed (%d)"), GetLastError());
-        return false;
+        pooledSession = new PooledSession();
+        pooledSession->key = sessionKey.str();
+
+        pooledSession->hSession =
+                    WinHttpOpen(
+                        _T("Mozilla/4.0 (compatible; MSIE 5.22)"),
+                        proxyHost.length() ? WINHTTP_ACCESS_TYPE_NAMED_PROXY : WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
+                        proxyHost.length() ? proxyHost.c_str() : WINHTTP_NO_PROXY_NAME,
+                        WINHTTP_NO_PROXY_BYPASS,
+                        WINHTTP_FLAG_ASYNC);
+    }
+    else
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: reusing pooled session"), __TFUNCTION__);
     }
 
-    if (FALSE == WinHttpSetTimeouts(hSession, 0, HTTPS_REQUEST_CONNECT_TIMEOUT_MS,
-                            HTTPS_REQUEST_SEND_TIMEOUT_MS, HTTPS_REQUEST_RECEIVE_TIMEOUT_MS))
+    // Returned to the pool in OnRequestClosed, once the request is done
+    PooledSessionLease session(pooledSession);
+
+    HINTERNET hSession = session->hSession;
+
+    if (NULL == hSession)
     {
-        my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpSetTimeouts failed (%d)"), GetLastError());
+        my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpOpen failed (%d)"), GetLastError());
         return false;
     }
 
-    // SSLv3, TLSv1.0, TLSv1.1 all have security flaws that mean that should be avoided. 
-    // Some of those flaws (like SSLv3's POODLE http://cve.mitre.org/cgi-bin/cvename.cgi?name=CVE-2014-3566)
-    // require the client side to not try to use them. So we're going to force use of 
-    // TLS v1.2. We'll try to remember to update these flags when new TLS versions come
-    // out; we think it's too risky to set all bits except the bad ones (like ~(SSL|TLS1.0|TLS1.1)), 
-    // as we might get something we don't want.
-    // When WinHttpSetOption gets flags it doesn't understand -- like WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_2
-    // on XP and Vista -- it returns FALSE and sets errno to ERROR_INVALID_PARAMETER (87). When 
-    // that happens we'll fall back to the URL proxy. That's why we're _not_ going
-    // to set the HTTPS protocol for URL proxy requests (and it's HTTP, not HTTPS).
-    DWORD dwProtocols = WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_2;
-    if (!useURLProxy)
-    {
-        if (FALSE == WinHttpSetOption(
-            hSession,
-            WINHTTP_OPTION_SECURE_PROTOCOLS,
-            &dwProtocols,
-            sizeof(DWORD)))
-        {
-            my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpSetOption WINHTTP_OPTION_SECURE_PROTOCOLS failed (%d)"), GetLastError());
+    if (session->hConnect == NULL)
+    {
+        if (FALSE == WinHttpSetTimeouts(hSession, 0, HTTPS_REQUEST_CONNECT_TIMEOUT_MS,
+                                HTTPS_REQUEST_SEND_TIMEOUT_MS, HTTPS_REQUEST_RECEIVE_TIMEOUT_MS))
+        {
+            my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpSetTimeouts failed (%d)"), GetLastError());
             return false;
         }
-    }
 
-    AutoHINTERNET hConnect =
-            WinHttpConnect(
+        // SSLv3, TLSv1.0, TLSv1.1 all have security flaws that mean that should be avoided. 
+        // Some of those flaws (like SSLv3's POODLE http://cve.mitre.org/cgi-bin/cvename.cgi?name=CVE-2014-3566)
+        // require the client side to not try to use them. So we're going to force use of 
+        // TLS v1.2. We'll try to remember to update these flags when new TLS versions come
+        // out; we think it's too risky to set all bits except the bad ones (like ~(SSL|TLS1.0|TLS1.1)), 
+        // as we might get something we don't want.
+        // When WinHttpSetOption gets flags it doesn't understand -- like WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_2
+        // on XP and Vista -- it returns FALSE and sets errno to ERROR_INVALID_PARAMETER (87). When 
+        // that happens we'll fall back to the URL proxy. That's why we're _not_ going
+        // to set the HTTPS protocol for URL proxy requests (and it's HTTP, not HTTPS).
+        DWORD dwProtocols = WINHTTP_FLAG_SECURE_PROTOCOL_TLS1_2;
+        if (!useURLProxy)
+        {
+            if (FALSE == WinHttpSetOption(
                 hSession,
-                serverAddress,
-                (INTERNET_PORT)serverWebPort,
-                0);
+                WINHTTP_OPTION_SECURE_PROTOCOLS,
+                &dwProtocols,
+                sizeof(DWORD)))
+            {
+                my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpSetOption WINHTTP_OPTION_SECURE_PROTOCOLS failed (%d)"), GetLastError());
+                return false;
+            }
+        }
 
-    if (NULL == hConnect)
-    {
-        my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpConnect failed (%d)"), GetLastError());
-        return false;
+        session->hConnect =
+                WinHttpConnect(
+                    hSession,
+                    serverAddress,
+                    (INTERNET_PORT)serverWebPort,
+                    0);
+
+        if (NULL == session->hConnect)
+        {
+            my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpConnect failed (%d)"), GetLastError());
+            return false;
+        }
     }
 
+    HINTERNET hConnect = session->hConnect;
+
     if (!httpVerb)
     {
         httpVerb = additionalData ? _T("POST") : _T("GET");
@@ -577,9 +1086,11 @@ bool HTTPSRequest::MakeRequestWithURLProxyOption(
     // For example, PsiCash's ELB idle connection timeout was 60 seconds. So
     // any repeat PsiCash request made between 30 and 60 seconds of the
     // previous one would result in a hard error (not retried anywhere).
-    // We're going to specify Connection:close in all our requests to avoid
-    // this problem.
-    wstring headers = L"Connection: close\r\n";
+    // We used to specify Connection:close in all our requests to avoid this
+    // problem. Now connections are kept alive, but pooled sessions -- and
+    // with them their connections -- are closed after
+    // HTTPS_SESSION_POOL_IDLE_TIMEOUT_MS, before tunnel-core would drop them.
+    wstring headers;
     if (additionalHeaders)
     {
         headers += additionalHeaders;
@@ -589,90 +1100,104 @@ bool HTTPSRequest::MakeRequestWithURLProxyOption(
     m_expectedServerCertificate = webServerCertificate;
     m_requestSuccess = false;
     m_response = Response();
+    ZeroMemory(m_phaseTimes, sizeof(m_phaseTimes));
+    MarkPhase(PHASE_START);
+
+    // Set before sending, as the callback may need them right away.
+    m_requestHandle = hRequest;
+    m_requestClosing = false;
+    m_requestClosed = false;
+    m_stopWaitThreadId = 0;
+    m_pooledSession = session.Get();
 
     if (FALSE == WinHttpSendRequest(
                     hRequest,
-                    headers.c_str(),
+                    headers.length() ? headers.c_str() : WINHTTP_NO_ADDITIONAL_HEADERS,
                     headers.length(),
                     additionalData ? additionalData : WINHTTP_NO_REQUEST_DATA,
                     additionalDataLength,
                     additionalDataLength,
                     (DWORD_PTR)this))
     {
+        m_requestHandle = NULL;
+        m_pooledSession = NULL;
         CloseHandle(m_closedEvent);
         m_closedEvent = NULL;
         my_print(NOT_SENSITIVE, m_silentMode, _T("WinHttpSendRequest failed (%d)"), GetLastError());
         return false;
     }
 
-    // Wait for asynch callback to close, or timeout (to check cancel/termination)
+    // From here on, the request handle and session belong to the callback,
+    // and are let go of in OnRequestClosed.
+    hRequest.Detach();
+    session.Detach();
 
-    while (true)
-    {
-        DWORD result = WaitForSingleObject(m_closedEvent, 100);
+    return true;
+}
 
-        if (result == WAIT_TIMEOUT)
-        {
-            if (stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, false))
-            {
-                hRequest.WinHttpCloseHandle();
-                WaitForSingleObject(m_closedEvent, INFINITE);
-                CloseHandle(m_closedEvent);
-                m_closedEvent = NULL;
+// Large enough for any single response we expect to hold in memory; a
+// Content-Length bigger than this is just not reserved for up front.
+#define HTTPS_RESPONSE_MAX_RESERVE_BYTES    (64 * 1024 * 1024)
 
-                return false;
-            }
-        }
-        else if (result != WAIT_OBJECT_0)
-        {
-            // internal error
-            hRequest.WinHttpCloseHandle();
-            WaitForSingleObject(m_closedEvent, INFINITE);
-            CloseHandle(m_closedEvent);
-            m_closedEvent = NULL;
-            return false;
-        }
-        else
-        {
-            // callback has closed
-            break;
-        }
+bool HTTPSRequest::ResponseBeginBody(DWORD contentLength)
+{
+    AutoLock lock(m_lock);
+
+    if (m_responseSink)
+    {
+        return m_responseSink->Begin(m_response.code, m_response.etag, contentLength);
     }
 
-    CloseHandle(m_closedEvent);
-    m_closedEvent = NULL;
+    m_response.body.clear();
+    if (contentLength > 0 && contentLength <= HTTPS_RESPONSE_MAX_RESERVE_BYTES)
+    {
+        m_response.body.reserve(contentLength);
+    }
 
-    if (m_requestSuccess)
+    return true;
+}
+
+bool HTTPSRequest::ResponseAppendBody(const char* data, size_t length)
+{
+    AutoLock lock(m_lock);
+
+    if (m_responseSink)
     {
-        response = std::move(m_response);
-        m_response = Response();
-        return true;
+        return m_responseSink->Write(data, length);
     }
 
-    return false;
+    m_response.body.append(data, length);
+    return true;
 }
 
-void HTTPSRequest::ResponseAppendBody(const string& responseData)
+void HTTPSRequest::SetResponseSink(IHTTPSResponseSink* sink)
 {
-    AutoMUTEX lock(m_mutex);
-    m_response.body.append(responseData);
+    AutoLock lock(m_lock);
+    m_responseSink = sink;
 }
 
 void HTTPSRequest::ResponseSetCode(int code)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
     m_response.code = code;
 }
 
 void HTTPSRequest::ResponseSetDateHeader(const string& dateHeader)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
     m_response.dateHeader = dateHeader;
 }
 
+void HTTPSRequest::ResponseSetValidators(const string& etag, const string& lastModified)
+{
+    AutoLock lock(m_lock);
+    m_response.etag = etag;
+    m_response.lastModified = lastModified;
+}
+
 bool HTTPSRequest::ValidateServerCert(PCCERT_CONTEXT pCert)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
     // Set an empty certificate when validation isn't required
 
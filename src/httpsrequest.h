@@ -20,13 +20,57 @@
 #pragma once
 
 #include <string>
+#include <functional>
 #include <WinCrypt.h>
 #include <Winhttp.h>
+#include "tstring.h"
 #include "stopsignal.h"
 
 
 using namespace std;
 
+struct PooledSession;
+
+
+// Receives a response body as it's read, so that a large one doesn't need to
+// be held in memory. Called on WinHTTP threads, one call at a time.
+class IHTTPSResponseSink
+{
+public:
+    virtual ~IHTTPSResponseSink() {}
+
+    // Called once the response headers are in, before any Write. Also called
+    // again if the request is retried, so it must start over.
+    // etag is empty and contentLength is 0 if the server didn't send them.
+    // Returning false aborts the request.
+    virtual bool Begin(int statusCode, const string& etag, DWORD contentLength) = 0;
+
+    // Returning false aborts the request.
+    virtual bool Write(const char* data, size_t length) = 0;
+};
+
+
+// Where the time of a request went, in milliseconds. A phase that didn't
+// happen -- e.g., DNS, connect and TLS on a reused connection -- is 0. When
+// going through a proxy, DNS and connect are to the proxy, and TLS includes
+// the proxy's CONNECT -- so, for Psiphon's local proxy, the tunnel's latency.
+struct HTTPSRequestTiming
+{
+    DWORD dns;
+    DWORD connect;
+    DWORD tls;
+    // From the request being sent to the response headers being in
+    DWORD ttfb;
+    // Reading the body
+    DWORD transfer;
+    DWORD total;
+    bool reusedConnection;
+
+    HTTPSRequestTiming()
+        : dns(0), connect(0), tls(0), ttfb(0), transfer(0), total(0), reusedConnection(false) {}
+};
+
+
 class HTTPSRequest
 {
 public:
@@ -34,13 +78,19 @@ public:
         int code;
         string body;
         string dateHeader;
+        // Cache validators; empty if the server didn't send them.
+        string etag;
+        string lastModified;
+        HTTPSRequestTiming timing;
 
         Response() : code(-1) {}
     };
 
     // HTTP status code for "OK". This will save us using the magic number everywhere,
-    // but we're not going to provide aliases for any other codes.
+    // but we're only going to provide aliases for codes we actually act on.
     static constexpr int OK = 200;
+    // Reply to a conditional request when the resource hasn't changed.
+    static constexpr int NOT_MODIFIED = 304;
 
 public:
     HTTPSRequest(bool silentMode=false);
@@ -71,13 +121,69 @@ public:
         DWORD additionalDataLength=0,
         LPCWSTR httpVerb=NULL);
 
+    // Called when an asynchronous request is done. `success` means the same
+    // as MakeRequest's return value. Called on a WinHTTP or timer thread; the
+    // HTTPSRequest must not be destroyed from within the callback.
+    typedef std::function<void(bool success, const Response& response)> CompletionCallback;
+
+    // Like MakeRequest, but returns once the request has been sent, and
+    // onComplete is called when it's done. Returns false -- without calling
+    // onComplete -- if the request couldn't be started. If stop is signaled
+    // the request is cancelled and completes with success=false. There's no
+    // failover to the URL proxy. One request at a time per object; the
+    // destructor waits for an outstanding one.
+    // Throws StopSignal::StopException if stop was signaled before starting.
+    bool MakeRequestAsync(
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const string& webServerCertificate,
+        const TCHAR* requestPath,
+        const StopInfo& stopInfo,
+        PsiphonProxy usePsiphonLocalProxy,
+        CompletionCallback onComplete,
+        LPCWSTR additionalHeaders=NULL,
+        LPVOID additionalData=NULL,
+        DWORD additionalDataLength=0,
+        LPCWSTR httpVerb=NULL);
+
+    // If set, response bodies are passed to sink instead of being collected
+    // in Response::body (which is then empty). The sink must outlive any
+    // request made with it. NULL restores the default.
+    void SetResponseSink(IHTTPSResponseSink* sink);
+
+    // If set, the timing of each successful request is aggregated under name
+    // (e.g., "handshake") in TunnelMetrics.
+    void SetMetricsName(const string& name) { m_metricsName = name; }
+
+    // Closes the WinHTTP sessions kept for reuse by MakeRequest. Should be
+    // called when a tunnel goes away, as the kept connections go through it.
+    static void ReleasePooledSessions();
+
 private:
     void SetClosedEvent() {SetEvent(m_closedEvent);}
     void SetRequestSuccess() {m_requestSuccess = true;}
     bool ValidateServerCert(PCCERT_CONTEXT pCert);
-    void ResponseAppendBody(const string& responseData);
+    bool ResponseBeginBody(DWORD contentLength);
+    bool ResponseAppendBody(const char* data, size_t length);
     void ResponseSetCode(int code);
     void ResponseSetDateHeader(const string& dateHeader);
+    void ResponseSetValidators(const string& etag, const string& lastModified);
+
+    // Phases timestamped by the status callback, in order
+    enum Phase
+    {
+        PHASE_START = 0,
+        PHASE_RESOLVING,
+        PHASE_RESOLVED,
+        PHASE_CONNECTING,
+        PHASE_CONNECTED,
+        PHASE_SENDING,
+        PHASE_HEADERS,
+        PHASE_DONE,
+        PHASE_COUNT
+    };
+    void MarkPhase(Phase phase);
+    HTTPSRequestTiming GetTiming() const;
 
     bool MakeRequestWithURLProxyOption(
         const TCHAR* serverAddress,
@@ -93,6 +199,25 @@ private:
         DWORD additionalDataLength,
         LPCWSTR httpVerb);
 
+    // Sets up and sends the request. If it returns true, the request is in
+    // flight and OnRequestClosed will be called when it's done.
+    bool StartRequest(
+        const TCHAR* serverAddress,
+        int serverWebPort,
+        const string& webServerCertificate,
+        const TCHAR* requestPath,
+        PsiphonProxy usePsiphonLocalProxy,
+        bool useURLProxy,
+        LPCWSTR additionalHeaders,
+        LPVOID additionalData,
+        DWORD additionalDataLength,
+        LPCWSTR httpVerb);
+
+    // Closes the request handle, unless that's already been done. Threadsafe.
+    void CloseRequest();
+    void OnRequestClosed();
+    static void CALLBACK StopWaitCallback(PVOID context, BOOLEAN timerOrWaitFired);
+
     friend void CALLBACK WinHttpStatusCallback(
                             HINTERNET hRequest,
                             DWORD_PTR dwContext,
@@ -102,9 +227,25 @@ private:
 
 private:
     bool m_silentMode;
-    HANDLE m_mutex;
+    Lock m_lock;
     HANDLE m_closedEvent;
     bool m_requestSuccess;
     string m_expectedServerCertificate;
     Response m_response;
+
+    // Guarded by m_lock once the request has been sent
+    HINTERNET m_requestHandle;
+    bool m_requestClosing;
+    bool m_requestClosed;
+    PooledSession* m_pooledSession;
+    CompletionCallback m_completionCallback;
+    StopInfo m_asyncStopInfo;
+    HANDLE m_stopWait;
+    DWORD m_stopWaitThreadId;
+
+    IHTTPSResponseSink* m_responseSink;
+
+    // Performance counter values; 0 if the phase hasn't happened
+    LONGLONG m_phaseTimes[PHASE_COUNT];
+    string m_metricsName;
 };
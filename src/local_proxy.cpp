@@ -26,13 +26,286 @@
 #include "systemproxysettings.h"
 #include "usersettings.h"
 #include "config.h"
+#include "http_proxy_engine.h"
+#include "transport.h"
+#include "tunnel_metrics.h"
+#include "tracing.h"
 #include <Shlwapi.h>
+#include <algorithm>
 
 
 #define POLIPO_CONNECTION_TIMEOUT_SECONDS   20
+// Polipo logs this line once it's listening. If it isn't seen this soon, we
+// fall back to probing the port.
+#define POLIPO_LISTENING_LINE               "Established listening socket on port"
+#define POLIPO_LISTENING_LINE_WAIT_MS       1000
 #define POLIPO_EXE_NAME                     _T("psiphon3-polipo.exe")
+// Times an automatically chosen port is given up for another, if something
+// else takes it between being tested and being listened on
+#define LOCAL_PROXY_AUTO_PORT_ATTEMPTS      3
+// Polipo's in-memory cache size, and how many objects it keeps, per
+// Settings::LocalProxyPerformanceProfile. (Its defaults are 24MB and 2048.)
+// The low and critical marks follow the high mark.
+#define POLIPO_LOW_MEMORY_CHUNK_HIGH_MARK           (4*1024*1024)
+#define POLIPO_LOW_MEMORY_OBJECT_HIGH_MARK          256
+#define POLIPO_BANDWIDTH_SAVER_CHUNK_HIGH_MARK      (96*1024*1024)
+#define POLIPO_BANDWIDTH_SAVER_OBJECT_HIGH_MARK     8192
+// Distinct entries remembered per stats category
+#define STATS_CLASSIFICATION_CACHE_CAPACITY 1024
+// Beyond this many, the least recently seen may be logged again
+#define REPORTED_UNPROXIED_DOMAINS_CAPACITY 1024
+// Distinct entries held per stats category while sends are failing; past
+// this, new entries are counted as "(OTHER)"
+#define STATS_MAX_PENDING_ENTRIES           5000
+// How often the stats memory usage is re-estimated
+#define STATS_MEMORY_USAGE_INTERVAL_MS      60000
+// A due non-final stats send waits for the tunnel to be quiet -- below
+// STATS_SEND_BUSY_BYTES_PER_SECOND for STATS_SEND_QUIET_MS -- so that the
+// request doesn't compete with a download or stream. It's not held back more
+// than STATS_SEND_MAX_DEFERRAL_MS.
+#define STATS_SEND_BUSY_BYTES_PER_SECOND    (64*1024)
+#define STATS_SEND_QUIET_MS                 5000
+#define STATS_SEND_MAX_DEFERRAL_MS          (10*60*1000)
+// Throughput is measured over at least this long
+#define THROUGHPUT_SAMPLE_MIN_MS            1000
+#define POLIPO_PIPE_READ_BUFFER_SIZE        16384
+// Stats output wakes the event loop, so the periodic check only has the time
+// thresholds (and the in-process engine's counters) to look at.
+#define PERIODIC_CHECK_INTERVAL_MS          1000
+#define IDLE_PERIODIC_CHECK_INTERVAL_MS     10000
+
+
+/******************************************************************************
+ RegexReplaceMatcher
+******************************************************************************/
+
+RegexReplaceMatcher::RegexReplaceMatcher(const vector<RegexReplace>& regexes)
+    : m_regexes(regexes)
+{
+    m_requiredLiterals.reserve(m_regexes.size());
+    for (size_t i = 0; i < m_regexes.size(); i++)
+    {
+        m_requiredLiterals.push_back(GetRequiredLiteral(m_regexes[i].pattern));
+    }
+}
+
+bool RegexReplaceMatcher::IsFor(const vector<RegexReplace>& regexes) const
+{
+    if (regexes.size() != m_regexes.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < m_regexes.size(); i++)
+    {
+        if (regexes[i].pattern != m_regexes[i].pattern
+            || regexes[i].replace != m_regexes[i].replace)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RegexReplaceMatcher::Apply(const string& entry, string& o_result) const
+{
+    // The regexes are case-insensitive, so the prefilter is too
+    string lowered;
+
+    for (size_t i = 0; i < m_regexes.size(); i++)
+    {
+        const string& literal = m_requiredLiterals[i];
+        if (!literal.empty())
+        {
+            if (lowered.empty())
+            {
+                lowered = entry;
+                std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                               [](char ch) { return (char)tolower((unsigned char)ch); });
+            }
+
+            if (lowered.find(literal) == string::npos)
+            {
+                // Can't match
+                continue;
+            }
+        }
+
+        if (regex_match(entry, *m_regexes[i].regex))
+        {
+            o_result = regex_replace(entry, *m_regexes[i].regex, m_regexes[i].replace);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Returns the longest run of literal characters that every match of the
+// ECMAScript `pattern` must contain, lowercased; or an empty string if none
+// can be determined. This is deliberately conservative: anything inside a
+// group, class, or optional quantifier is ignored, as is any pattern with a
+// top-level alternation, escape spanning several characters (e.g., \x41), or
+// backreference.
+// static
+string RegexReplaceMatcher::GetRequiredLiteral(const string& pattern)
+{
+    string best, run;
+    int depth = 0;
+
+    for (size_t i = 0; i < pattern.size(); i++)
+    {
+        char c = pattern[i];
+
+        if (c == '[')
+        {
+            // Skip the character class, which may contain ( ) |
+            i++;
+            if (i < pattern.size() && pattern[i] == '^') i++;
+            if (i < pattern.size() && pattern[i] == ']') i++;
+            for (; i < pattern.size() && pattern[i] != ']'; i++)
+            {
+                if (pattern[i] == '\\') i++;
+            }
+            c = '.'; // stands for any character below
+        }
+        else if (c == '\\' && depth > 0)
+        {
+            i++;
+            continue;
+        }
+
+        if (depth > 0)
+        {
+            if (c == '(') depth++;
+            else if (c == ')') depth--;
+            continue;
+        }
+
+        if (c == '|' || c == ')')
+        {
+            return "";
+        }
+        else if (c == '*' || c == '?' || c == '{')
+        {
+            // The preceding character is optional
+            if (!run.empty()) run.pop_back();
+            if (run.size() > best.size()) best = run;
+            run.clear();
+
+            if (c == '{')
+            {
+                i = pattern.find('}', i);
+                if (i == string::npos) return "";
+            }
+        }
+        else if (c == '\\' && i + 1 < pattern.size() && !isalnum((unsigned char)pattern[i + 1]))
+        {
+            // An escaped literal, like "\."
+            run += (char)tolower((unsigned char)pattern[++i]);
+        }
+        else if (c == '\\' && i + 1 < pattern.size()
+                 && (strchr("xuc", pattern[i + 1]) || isdigit((unsigned char)pattern[i + 1])))
+        {
+            // Hex, Unicode and control escapes, and backreferences, run on
+            // past the next character; rather than parse them, don't prefilter.
+            return "";
+        }
+        else if (c == '(' || c == '\\' || c == '.' || c == '^' || c == '$' || c == '+')
+        {
+            // '+' leaves the preceding character required (so it's kept), but
+            // what follows isn't contiguous with it
+            if (run.size() > best.size()) best = run;
+            run.clear();
+
+            if (c == '(') depth++;
+            else if (c == '\\') i++; // a class escape like \d
+        }
+        else
+        {
+            run += (char)tolower((unsigned char)c);
+        }
+    }
+
+    if (run.size() > best.size()) best = run;
+    return best;
+}
+
+
+/******************************************************************************
+ StatsClassificationCache
+******************************************************************************/
+
+StatsClassificationCache::StatsClassificationCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+void StatsClassificationCache::SetMatcher(const shared_ptr<const RegexReplaceMatcher>& matcher)
+{
+    if (matcher == m_matcher)
+    {
+        return;
+    }
+
+    // The cached results came from the old regexes
+    m_matcher = matcher;
+    m_index.clear();
+    m_lru.clear();
+}
+
+bool StatsClassificationCache::Find(const string& entry, string& o_storeEntry)
+{
+    Index::iterator found = m_index.find(entry);
+    if (found == m_index.end())
+    {
+        return false;
+    }
+
+    // Move to the most recently used position
+    m_lru.splice(m_lru.begin(), m_lru, found->second);
+    o_storeEntry = found->second->second;
+    return true;
+}
+
+void StatsClassificationCache::Insert(
+                                const shared_ptr<const RegexReplaceMatcher>& matcher,
+                                const string& entry,
+                                const string& storeEntry)
+{
+    if (matcher != m_matcher || m_capacity == 0 || m_index.count(entry) > 0)
+    {
+        return;
+    }
+
+    if (m_lru.size() >= m_capacity)
+    {
+        m_index.erase(m_lru.back().first);
+        m_lru.pop_back();
+    }
+
+    m_lru.push_front(make_pair(entry, storeEntry));
+    m_index[entry] = m_lru.begin();
+}
+
+size_t StatsClassificationCache::HeapBytes() const
+{
+    // An LRU node (two links and the pair) and an index node (a link, a copy
+    // of the key and the iterator) per entry, plus the index buckets
+    size_t total = m_index.bucket_count() * 2 * sizeof(void*);
+    for (auto it = m_lru.begin(); it != m_lru.end(); ++it)
+    {
+        total += 3 * sizeof(void*) + sizeof(LRU::value_type) + sizeof(string) + sizeof(LRU::iterator);
+        total += 2 * StringHeapBytes(it->first) + StringHeapBytes(it->second);
+    }
+    return total;
+}
 
 
+/******************************************************************************
+ LocalProxy
+******************************************************************************/
+
 LocalProxy::LocalProxy(
                 ILocalProxyStatsCollector* statsCollector,
                 LPCSTR serverAddress,
@@ -43,19 +316,30 @@ LocalProxy::LocalProxy(
       m_systemProxySettings(systemProxySettings),
       m_parentPort(parentPort),
       m_polipoPipe(NULL),
+      m_polipoPipeReadPending(false),
+      m_polipoListening(false),
+      m_proxyEngine(NULL),
+      m_interfaceStatsTransport(NULL),
+      m_lastInterfaceBytes(0),
+      m_polipoReadBuffer(POLIPO_PIPE_READ_BUFFER_SIZE),
       m_bytesTransferred(0),
+      m_throughputSampleBytes(0),
+      m_throughputSampleTimeMS(0),
+      m_lastBusyTimeMS(0),
+      m_statsSendDeferredSinceMS(0),
       m_lastStatusSendTimeMS(0),
+      m_lastStatsMemoryUsageTimeMS(0),
+      m_lastActivityTimeMS(GetTickCount()),
       m_splitTunnelingFilePath(splitTunnelingFilePath),
       m_finalStatsSent(false),
-      m_serverAddress(serverAddress)
+      m_pageViewClassifications(STATS_CLASSIFICATION_CACHE_CAPACITY),
+      m_httpsRequestClassifications(STATS_CLASSIFICATION_CACHE_CAPACITY),
+      m_serverAddress(serverAddress),
+      m_reportedUnproxiedDomains(REPORTED_UNPROXIED_DOMAINS_CAPACITY)
 {
     ZeroMemory(&m_polipoProcessInfo, sizeof(m_polipoProcessInfo));
-
-    m_mutex = CreateMutex(NULL, FALSE, 0);
-    if (m_mutex == NULL)
-    {
-        throw std::exception(__FUNCTION__ ":" STRINGIZE(__LINE__) " CreateMutex failed");
-    }
+    ZeroMemory(&m_polipoPipeOverlapped, sizeof(m_polipoPipeOverlapped));
+    m_polipoPipeOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
 
     assert(systemProxySettings);
 }
@@ -73,23 +357,101 @@ LocalProxy::~LocalProxy()
         // Cleanup might throw, but we're in the destructor, so just swallow it.
     }
 
-    if (m_mutex != NULL)
+    CloseHandle(m_polipoPipeOverlapped.hEvent);
+}
+
+// Only the stats-collecting instance -- there's at most one -- sets this.
+static volatile LONG g_localProxyStatsMemoryUsage = 0;
+
+// static
+size_t LocalProxy::GetStatsMemoryUsage()
+{
+    return (size_t)InterlockedCompareExchange(&g_localProxyStatsMemoryUsage, 0, 0);
+}
+
+template<typename StatsEntryMap>
+static size_t StatsEntryCountsHeapBytes(const StatsEntryMap& entries)
+{
+    // A node (a link and the pair) per entry, plus the buckets
+    size_t total = entries.bucket_count() * 2 * sizeof(void*);
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        total += sizeof(void*) + sizeof(typename StatsEntryMap::value_type) + StringHeapBytes(it->first);
+    }
+    return total;
+}
+
+void LocalProxy::UpdateStatsMemoryUsage()
+{
+    size_t total = StatsEntryCountsHeapBytes(m_pageViewEntries)
+                   + StatsEntryCountsHeapBytes(m_httpsRequestEntries)
+                   + StatsEntryCountsHeapBytes(m_pageViewBytes)
+                   + StatsEntryCountsHeapBytes(m_httpsRequestBytes);
     {
-        CloseHandle(m_mutex);
+        AutoLock lock(m_lock);
+        total += m_pageViewClassifications.HeapBytes() + m_httpsRequestClassifications.HeapBytes();
     }
+
+    InterlockedExchange(&g_localProxyStatsMemoryUsage, (LONG)min(total, (size_t)LONG_MAX));
+    m_lastStatsMemoryUsageTimeMS = GetTickCount();
 }
 
 void LocalProxy::UpdateSessionInfo(const SessionInfo& sessionInfo)
 {
-    AutoMUTEX lock(m_mutex);
+    shared_ptr<const RegexReplaceMatcher> pageViewMatcher;
+    shared_ptr<const RegexReplaceMatcher> httpsRequestMatcher;
+    {
+        AutoLock lock(m_lock);
+        pageViewMatcher = m_pageViewMatcher;
+        httpsRequestMatcher = m_httpsRequestMatcher;
+    }
+
+    // The usual handshake brings the same regexes again. Keeping the matcher
+    // then also keeps the classifications made with it.
+    // Built outside the lock; entries are classified with the old
+    // matchers in the meantime
+    if (!pageViewMatcher || !pageViewMatcher->IsFor(sessionInfo.GetPageViewRegexes()))
+    {
+        pageViewMatcher.reset(new RegexReplaceMatcher(sessionInfo.GetPageViewRegexes()));
+    }
+    if (!httpsRequestMatcher || !httpsRequestMatcher->IsFor(sessionInfo.GetHttpsRequestRegexes()))
+    {
+        httpsRequestMatcher.reset(new RegexReplaceMatcher(sessionInfo.GetHttpsRequestRegexes()));
+    }
+
+    AutoLock lock(m_lock);
+
+    m_pageViewMatcher = pageViewMatcher;
+    m_httpsRequestMatcher = httpsRequestMatcher;
+}
 
-    m_pageViewRegexes = sessionInfo.GetPageViewRegexes();
-    m_httpsRequestRegexes = sessionInfo.GetHttpsRequestRegexes();
+void LocalProxy::UseInterfaceStats(ITransport* transport)
+{
+    m_interfaceStatsTransport = transport;
 }
 
 bool LocalProxy::DoStart()
 {
-    if (m_polipoPath.size() == 0)
+    if (m_interfaceStatsTransport)
+    {
+        Cleanup(false);
+
+        // Only what's carried from here on is ours to report
+        if (!m_interfaceStatsTransport->GetInterfaceBytesTransferred(m_lastInterfaceBytes))
+        {
+            m_lastInterfaceBytes = 0;
+        }
+
+        // No ports for the system proxy settings: browsers go direct, over
+        // the whole-system tunnel.
+        my_print(NOT_SENSITIVE, true, _T("%s: counting interface bytes; no HTTP proxy"), __TFUNCTION__);
+        return true;
+    }
+
+    // The engine doesn't do split tunneling, so Polipo is still needed for that
+    bool useProxyEngine = Settings::InProcessHttpProxy() && m_splitTunnelingFilePath.empty();
+
+    if (!useProxyEngine && m_polipoPath.size() == 0)
     {
         if (!ExtractExecutable(IDR_POLIPO_EXE, POLIPO_EXE_NAME, m_polipoPath))
         {
@@ -101,7 +463,8 @@ bool LocalProxy::DoStart()
     Cleanup(false);
 
     int localHttpProxyPort = Settings::LocalHttpProxyPort();
-    if (localHttpProxyPort == 0)
+    bool autoPort = (localHttpProxyPort == 0);
+    if (autoPort)
     {
         // Choose the port automatically
         localHttpProxyPort = 1024;
@@ -121,10 +484,29 @@ bool LocalProxy::DoStart()
         }
     }
 
-    if (!StartPolipo(localHttpProxyPort))
+    for (int attempt = 1;
+         !(useProxyEngine ? StartProxyEngine(localHttpProxyPort) : StartPolipo(localHttpProxyPort));
+         attempt++)
     {
         Cleanup(false);
-        return false;
+
+        // Only a port that's since been taken is worth moving on from;
+        // another failure would just happen again.
+        int testPort = localHttpProxyPort;
+        if (!autoPort
+            || attempt >= LOCAL_PROXY_AUTO_PORT_ATTEMPTS
+            || TestForOpenPort(testPort, 0, m_stopInfo))
+        {
+            return false;
+        }
+
+        my_print(NOT_SENSITIVE, true, _T("%s: port %d taken; trying another"), __TFUNCTION__, localHttpProxyPort);
+        localHttpProxyPort++;
+        if (!TestForOpenPort(localHttpProxyPort, 60000, m_stopInfo))
+        {
+            my_print(NOT_SENSITIVE, false, _T("HTTP proxy could not find an available port."));
+            return false;
+        }
     }
 
     // Now that we are connected, change the Windows Internet Settings
@@ -141,6 +523,13 @@ bool LocalProxy::DoStart()
 
 bool LocalProxy::DoPeriodicCheck()
 {
+    if (m_proxyEngine || m_interfaceStatsTransport)
+    {
+        // There's no process to lose
+        (void)ProcessStatsAndStatus(false);
+        return true;
+    }
+
     // Check if we've lost the Polipo process
 
     if (m_polipoProcessInfo.hProcess != 0)
@@ -174,9 +563,32 @@ bool LocalProxy::DoPeriodicCheck()
     return false;
 }
 
+void LocalProxy::GetWaitHandles(vector<HANDLE>& o_handles)
+{
+    // Wake immediately if Polipo dies or writes stats. A completed read leaves
+    // the event set until ReadPolipoPipe starts the next one.
+    if (m_polipoPipeReadPending)
+    {
+        o_handles.push_back(m_polipoPipeOverlapped.hEvent);
+    }
+    if (m_polipoProcessInfo.hProcess != 0
+        && m_polipoProcessInfo.hProcess != INVALID_HANDLE_VALUE)
+    {
+        o_handles.push_back(m_polipoProcessInfo.hProcess);
+    }
+}
+
+DWORD LocalProxy::GetPeriodicCheckInterval() const
+{
+    return IdleAwareInterval(
+            m_lastActivityTimeMS,
+            PERIODIC_CHECK_INTERVAL_MS,
+            IDLE_PERIODIC_CHECK_INTERVAL_MS);
+}
+
 void LocalProxy::StopImminent()
 {
-    if (m_polipoProcessInfo.hProcess != 0)
+    if (m_polipoProcessInfo.hProcess != 0 || m_proxyEngine || m_interfaceStatsTransport)
     {
         // We are (probably) connected, so send a final stats message
         my_print(NOT_SENSITIVE, true, _T("%s: Stopping cleanly. Sending final stats."), __TFUNCTION__);
@@ -196,6 +608,21 @@ void LocalProxy::DoStop(bool cleanly)
 
 void LocalProxy::Cleanup(bool doStats)
 {
+    if (m_proxyEngine)
+    {
+        m_proxyEngine->Stop();
+        // Keep whatever the engine saw since the last check, for the final stats
+        CollectProxyEngineStats();
+        delete m_proxyEngine;
+        m_proxyEngine = NULL;
+    }
+
+    if (m_interfaceStatsTransport && doStats)
+    {
+        // For the final stats, if the interface is still there
+        CollectInterfaceStats();
+    }
+
     // Give the process an opportunity for graceful shutdown, then terminate
     if (m_polipoProcessInfo.hProcess != 0
         && m_polipoProcessInfo.hProcess != INVALID_HANDLE_VALUE)
@@ -213,14 +640,30 @@ void LocalProxy::Cleanup(bool doStats)
     if (m_polipoPipe!= 0
         && m_polipoPipe != INVALID_HANDLE_VALUE)
     {
+        if (m_polipoPipeReadPending)
+        {
+            // The read buffer must outlive the read. Polipo is gone by now,
+            // so the read completes (with ERROR_BROKEN_PIPE) promptly.
+            CancelIo(m_polipoPipe);
+            WaitForSingleObject(m_polipoPipeOverlapped.hEvent, TERMINATE_PROCESS_WAIT_MS);
+            m_polipoPipeReadPending = false;
+        }
         CloseHandle(m_polipoPipe);
     }
     m_polipoPipe = NULL;
 
+    // Any partial record belonged to the old process
+    m_polipoStatsBuffer.clear();
+
     m_lastStatusSendTimeMS = 0;
 
     // Reset reporting of split tunnel status
-    m_reportedUnproxiedDomains.clear();
+    m_reportedUnproxiedDomains.Clear();
+
+    if (m_statsCollector)
+    {
+        InterlockedExchange(&g_localProxyStatsMemoryUsage, 0);
+    }
 
     // If we have stats, and we didn't get a chance to send our final stats,
     // we'll try one last time.
@@ -231,6 +674,8 @@ void LocalProxy::Cleanup(bool doStats)
                                 true, // Note: there's a timeout side-effect when final=false
                                 m_pageViewEntries,
                                 m_httpsRequestEntries,
+                                m_pageViewBytes,
+                                m_httpsRequestBytes,
                                 m_bytesTransferred))
         {
             m_finalStatsSent = true;
@@ -262,6 +707,19 @@ bool LocalProxy::StartPolipo(int localHttpProxyPort)
                       << _T(" disableLocalInterface=true")
                       << _T(" logLevel=1");
 
+    // Without a disk cache, the memory cache is all there is to tune
+    LocalProxyProfile profile = Settings::LocalProxyPerformanceProfile();
+    if (profile == LOCAL_PROXY_PROFILE_LOW_MEMORY)
+    {
+        polipoCommandLine << _T(" chunkHighMark=") << POLIPO_LOW_MEMORY_CHUNK_HIGH_MARK
+                          << _T(" objectHighMark=") << POLIPO_LOW_MEMORY_OBJECT_HIGH_MARK;
+    }
+    else if (profile == LOCAL_PROXY_PROFILE_BANDWIDTH_SAVER)
+    {
+        polipoCommandLine << _T(" chunkHighMark=") << POLIPO_BANDWIDTH_SAVER_CHUNK_HIGH_MARK
+                          << _T(" objectHighMark=") << POLIPO_BANDWIDTH_SAVER_OBJECT_HIGH_MARK;
+    }
+
     // Use the parent proxy, if one is available for the current transport
     // also do split tunneling if there is a parent proxy
     if (m_parentPort > 0)
@@ -300,9 +758,9 @@ bool LocalProxy::StartPolipo(int localHttpProxyPort)
             NULL,
             TRUE, // bInheritHandles
 #ifdef _DEBUG
-            CREATE_NEW_PROCESS_GROUP,
+            CREATE_NEW_PROCESS_GROUP|CREATE_SUSPENDED,
 #else
-            CREATE_NEW_PROCESS_GROUP|CREATE_NO_WINDOW,
+            CREATE_NEW_PROCESS_GROUP|CREATE_NO_WINDOW|CREATE_SUSPENDED,
 #endif
             NULL,
             NULL,
@@ -313,6 +771,14 @@ bool LocalProxy::StartPolipo(int localHttpProxyPort)
         return false;
     }
 
+    if (!ResumeChildProcessInJob(m_polipoProcessInfo, m_polipoPath))
+    {
+        CloseHandle(m_polipoProcessInfo.hThread);
+        CloseHandle(m_polipoProcessInfo.hProcess);
+        ZeroMemory(&m_polipoProcessInfo, sizeof(m_polipoProcessInfo));
+        return false;
+    }
+
     // Close the unneccesary handles
     CloseHandle(m_polipoProcessInfo.hThread);
     m_polipoProcessInfo.hThread = NULL;
@@ -334,11 +800,9 @@ bool LocalProxy::StartPolipo(int localHttpProxyPort)
 
     WaitForInputIdle(m_polipoProcessInfo.hProcess, 5000);
 
-    DWORD connected = WaitForConnectability(
-                        (USHORT)localHttpProxyPort,
-                        POLIPO_CONNECTION_TIMEOUT_SECONDS*1000,
-                        m_polipoProcessInfo.hProcess,
-                        m_stopInfo);
+    DWORD connected = WaitForPolipoListening(
+                        localHttpProxyPort,
+                        POLIPO_CONNECTION_TIMEOUT_SECONDS*1000);
 
     if (ERROR_OPERATION_ABORTED == connected)
     {
@@ -354,6 +818,147 @@ bool LocalProxy::StartPolipo(int localHttpProxyPort)
 }
 
 
+// Waits for Polipo to say it's listening, rather than probing its port --
+// unless it doesn't say so promptly. Returns what WaitForConnectability does.
+DWORD LocalProxy::WaitForPolipoListening(int localHttpProxyPort, DWORD timeout)
+{
+    m_polipoListening = false;
+
+    HANDLE stopEvent = m_stopInfo.stopSignal ? m_stopInfo.stopSignal->GetStopEvent(m_stopInfo.stopReasons) : NULL;
+    DWORD start = GetTickCount();
+
+    while (true)
+    {
+        ReadPolipoPipe();
+
+        if (m_polipoListening)
+        {
+            return ERROR_SUCCESS;
+        }
+
+        DWORD elapsed = GetTickCount() - start;
+        if (!m_polipoPipeReadPending || elapsed >= POLIPO_LISTENING_LINE_WAIT_MS)
+        {
+            // Nothing more is coming from the pipe, or not soon enough
+            break;
+        }
+
+        HANDLE waitHandles[3];
+        DWORD waitHandlesCount = 0;
+        waitHandles[waitHandlesCount++] = m_polipoPipeOverlapped.hEvent;
+        waitHandles[waitHandlesCount++] = m_polipoProcessInfo.hProcess;
+        if (stopEvent)
+        {
+            waitHandles[waitHandlesCount++] = stopEvent;
+        }
+
+        DWORD result = WaitForMultipleObjects(
+                        waitHandlesCount,
+                        waitHandles,
+                        FALSE, // wait for any
+                        POLIPO_LISTENING_LINE_WAIT_MS - elapsed);
+        if (result == WAIT_OBJECT_0 + 1)
+        {
+            return ERROR_SYSTEM_PROCESS_TERMINATED;
+        }
+        else if (result == WAIT_OBJECT_0 + 2)
+        {
+            return ERROR_OPERATION_ABORTED;
+        }
+        else if (result == WAIT_FAILED)
+        {
+            break;
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: no listening line from Polipo; probing its port"), __TFUNCTION__);
+
+    DWORD elapsed = GetTickCount() - start;
+    return WaitForConnectability(
+                (USHORT)localHttpProxyPort,
+                elapsed < timeout ? timeout - elapsed : 0,
+                m_polipoProcessInfo.hProcess,
+                m_stopInfo);
+}
+
+bool LocalProxy::StartProxyEngine(int localHttpProxyPort)
+{
+    m_proxyEngine = new HttpProxyEngine();
+
+    if (!m_proxyEngine->Start(localHttpProxyPort, m_parentPort))
+    {
+        my_print(NOT_SENSITIVE, false, _T("Failed to start the HTTP proxy"));
+        delete m_proxyEngine;
+        m_proxyEngine = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+// Moves the stats gathered by the in-process proxy engine into ours, just as
+// ParsePolipoStatsBuffer does for Polipo's output.
+void LocalProxy::CollectProxyEngineStats()
+{
+    vector<string> pageViews, httpsRequests;
+    unsigned long long bytesTransferred = 0;
+    unordered_map<string, unsigned long long> pageViewBytes, httpsRequestBytes;
+
+    m_proxyEngine->TakeStats(pageViews, httpsRequests, bytesTransferred, pageViewBytes, httpsRequestBytes);
+
+    for (vector<string>::const_iterator it = pageViews.begin(); it != pageViews.end(); ++it)
+    {
+        UpsertPageView(*it);
+    }
+    for (vector<string>::const_iterator it = httpsRequests.begin(); it != httpsRequests.end(); ++it)
+    {
+        UpsertHttpsRequest(*it);
+    }
+    for (auto it = pageViewBytes.begin(); it != pageViewBytes.end(); ++it)
+    {
+        AddPageViewBytes(it->first, it->second);
+    }
+    for (auto it = httpsRequestBytes.begin(); it != httpsRequestBytes.end(); ++it)
+    {
+        AddHttpsRequestBytes(it->first, it->second);
+    }
+    m_bytesTransferred += bytesTransferred;
+    if (bytesTransferred > 0)
+    {
+        m_lastActivityTimeMS = GetTickCount();
+    }
+    // Temp connections don't collect stats, and aren't counted.
+    if (m_statsCollector)
+    {
+        TunnelMetrics::AddProxiedBytes(bytesTransferred);
+    }
+}
+
+// Adds what the transport's interface has carried since the last call.
+void LocalProxy::CollectInterfaceStats()
+{
+    unsigned long long total = 0;
+    if (!m_interfaceStatsTransport->GetInterfaceBytesTransferred(total))
+    {
+        return;
+    }
+
+    // A lower count is a new connection's
+    unsigned long long bytesTransferred =
+        total >= m_lastInterfaceBytes ? total - m_lastInterfaceBytes : total;
+    m_lastInterfaceBytes = total;
+
+    m_bytesTransferred += bytesTransferred;
+    if (bytesTransferred > 0)
+    {
+        m_lastActivityTimeMS = GetTickCount();
+    }
+    if (m_statsCollector)
+    {
+        TunnelMetrics::AddProxiedBytes(bytesTransferred);
+    }
+}
+
 // Create the pipe that will be used to communicate between the Polipo child
 // process and this process. o_outputPipe write handle should be used as the stdout
 // of the Polipo process, and o_errorPipe as stderr.
@@ -372,7 +977,8 @@ bool LocalProxy::CreatePolipoPipe(HANDLE& o_outputPipe, HANDLE& o_errorPipe)
             parentInputPipe,
             childStdinPipe,
             o_outputPipe,
-            o_errorPipe))
+            o_errorPipe,
+            true)) // overlapped reads
     {
         return false;
     }
@@ -383,6 +989,80 @@ bool LocalProxy::CreatePolipoPipe(HANDLE& o_outputPipe, HANDLE& o_errorPipe)
     return true;
 }
 
+void LocalProxy::ReadPolipoPipe()
+{
+    // Bound the work done per call so a busy Polipo can't starve the caller.
+    const int MAX_READS_PER_CALL = 16;
+
+    if (m_polipoPipe == NULL || m_polipoPipe == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    for (int reads = 0; reads < MAX_READS_PER_CALL; reads++)
+    {
+        if (m_polipoPipeReadPending)
+        {
+            DWORD numRead = 0;
+            if (!GetOverlappedResult(m_polipoPipe, &m_polipoPipeOverlapped, &numRead, FALSE))
+            {
+                DWORD lastError = GetLastError();
+                if (lastError == ERROR_IO_INCOMPLETE)
+                {
+                    // Nothing more to read yet
+                    return;
+                }
+
+                m_polipoPipeReadPending = false;
+
+                // ERROR_BROKEN_PIPE is expected when Polipo exits
+                if (lastError != ERROR_BROKEN_PIPE)
+                {
+                    my_print(NOT_SENSITIVE, false, _T("%s:%d - GetOverlappedResult failed (%d)"), __TFUNCTION__, __LINE__, lastError);
+                }
+                return;
+            }
+
+            m_polipoPipeReadPending = false;
+
+            if (numRead > 0)
+            {
+                m_lastActivityTimeMS = GetTickCount();
+
+                // Logged once, at startup, so it's only looked for then. (If
+                // it happens to be split across reads, WaitForPolipoListening
+                // falls back to probing.)
+                if (!m_polipoListening
+                    && std::search(
+                            m_polipoReadBuffer.begin(), m_polipoReadBuffer.begin() + numRead,
+                            POLIPO_LISTENING_LINE, POLIPO_LISTENING_LINE + sizeof(POLIPO_LISTENING_LINE) - 1)
+                        != m_polipoReadBuffer.begin() + numRead)
+                {
+                    m_polipoListening = true;
+                }
+
+                ParsePolipoStatsBuffer(&m_polipoReadBuffer[0], numRead);
+            }
+        }
+
+        // Start the next read. Whether it completes immediately or not, the
+        // result is collected via GetOverlappedResult above.
+        ResetEvent(m_polipoPipeOverlapped.hEvent);
+        if (!ReadFile(m_polipoPipe, &m_polipoReadBuffer[0], m_polipoReadBuffer.size(), NULL, &m_polipoPipeOverlapped)
+            && GetLastError() != ERROR_IO_PENDING)
+        {
+            DWORD lastError = GetLastError();
+            if (lastError != ERROR_BROKEN_PIPE)
+            {
+                my_print(NOT_SENSITIVE, false, _T("%s:%d - ReadFile failed (%d)"), __TFUNCTION__, __LINE__, lastError);
+            }
+            return;
+        }
+
+        m_polipoPipeReadPending = true;
+    }
+}
+
 // Check Polipo pipe for page view, bytes transferred, etc., info waiting to
 // be processed; gather info; process; send to server.
 // If connected is true, the stats will only be sent to the server if certain
@@ -403,61 +1083,80 @@ bool LocalProxy::ProcessStatsAndStatus(bool final)
     // Stats get sent to the server when a time or size limit has been reached.
 
     const DWORD DEFAULT_SEND_INTERVAL_MS = (5*60*1000); // 5 mins
-    const unsigned int DEFAULT_SEND_MAX_ENTRIES = 1000;  // This is mostly to bound memory usage
+    const unsigned int DEFAULT_SEND_MAX_ENTRIES = 1000;  // Memory is bounded by STATS_MAX_PENDING_ENTRIES
     static DWORD s_send_interval_ms = DEFAULT_SEND_INTERVAL_MS;
     static unsigned int s_send_max_entries = DEFAULT_SEND_MAX_ENTRIES;
 
-    DWORD bytes_avail = 0;
-
     // On the very first call, m_lastStatusSendTimeMS will be 0, but we don't
     // want to send immediately. So...
-    if (m_lastStatusSendTimeMS == 0) m_lastStatusSendTimeMS = GetTickCount();
+    if (m_lastStatusSendTimeMS == 0) m_lastStatusSendTimeMS = MonotonicMilliseconds();
 
-    // ReadFile will block forever if there's no data to read, so we need
-    // to check if there's data available to read first.
-    if (!PeekNamedPipe(m_polipoPipe, NULL, 0, NULL, &bytes_avail, NULL))
+    if (m_proxyEngine)
     {
-        my_print(NOT_SENSITIVE, false, _T("%s:%d - PeekNamedPipe failed (%d)"), __TFUNCTION__, __LINE__, GetLastError());
-        return false;
+        CollectProxyEngineStats();
     }
-
-    // If there's data available from the Polipo pipe, process it.
-    if (bytes_avail > 0)
+    else if (m_interfaceStatsTransport)
+    {
+        CollectInterfaceStats();
+    }
+    else
     {
-        char* page_view_buffer = new char[bytes_avail+1];
-        DWORD num_read = 0;
-        if (!ReadFile(m_polipoPipe, page_view_buffer, bytes_avail, &num_read, NULL))
-        {
-            my_print(NOT_SENSITIVE, false, _T("%s:%d - ReadFile failed (%d)"), __TFUNCTION__, __LINE__, GetLastError());
-            false;
-        }
-        page_view_buffer[bytes_avail] = '\0';
-
         // Update page view and traffic stats with the new info.
-        ParsePolipoStatsBuffer(page_view_buffer);
-
-        delete[] page_view_buffer;
+        ReadPolipoPipe();
     }
 
-    // Note: GetTickCount wraps after 49 days; small chance of a shorter timeout
+    // Only ever compared by difference, which survives the tick count wrapping
     DWORD now = GetTickCount();
-    if (now < m_lastStatusSendTimeMS) m_lastStatusSendTimeMS = 0;
+
+    if (m_lastStatsMemoryUsageTimeMS == 0
+        || now - m_lastStatsMemoryUsageTimeMS >= STATS_MEMORY_USAGE_INTERVAL_MS)
+    {
+        UpdateStatsMemoryUsage();
+    }
+
+    bool busy = SampleTunnelBusy(now);
 
     // If the time or size thresholds have been exceeded, or if we're being
     // forced to, send the stats.
-    if (final
-        || (m_lastStatusSendTimeMS + s_send_interval_ms) < now
+    bool due = final
+        || MonotonicMilliseconds() - m_lastStatusSendTimeMS > s_send_interval_ms
         || m_pageViewEntries.size() >= s_send_max_entries
-        || m_httpsRequestEntries.size() >= s_send_max_entries)
+        || m_httpsRequestEntries.size() >= s_send_max_entries;
+
+    // Hold a due send while the tunnel is busy. Everything that's pending
+    // goes in the one request when it's made. The interval still gets its
+    // jitter, so a send's timing still isn't predictable from traffic alone.
+    if (due && !final && (busy || m_statsCollector->IsStatusMessageDeferred()))
+    {
+        if (m_statsSendDeferredSinceMS == 0)
+        {
+            m_statsSendDeferredSinceMS = now;
+            TRACE_EVENT(TRACE_KEYWORD_LOCAL_PROXY, _T("LocalProxy/StatsSendDeferred"));
+        }
+        due = (now - m_statsSendDeferredSinceMS >= STATS_SEND_MAX_DEFERRAL_MS);
+    }
+
+    if (due)
     {
+        m_statsSendDeferredSinceMS = 0;
+
         my_print(NOT_SENSITIVE, true, _T("%s: Sending %s stats."), __TFUNCTION__, final ? _T("final") : _T("non-final"));
 
+        unsigned long long sendStartTime = MonotonicMilliseconds();
         if (m_statsCollector->SendStatusMessage(
                                 final, // Note: there's a timeout side-effect when final=false
                                 m_pageViewEntries,
                                 m_httpsRequestEntries,
+                                m_pageViewBytes,
+                                m_httpsRequestBytes,
                                 m_bytesTransferred))
         {
+            DWORD sendTime = (DWORD)(MonotonicMilliseconds() - sendStartTime);
+            TunnelMetrics::AddRequestLatency(sendTime);
+            TRACE_EVENT(TRACE_KEYWORD_LOCAL_PROXY, _T("LocalProxy/StatsSent: %s, %d page views, %d https requests, %d ms"),
+                final ? _T("final") : _T("non-final"), (int)m_pageViewEntries.size(), (int)m_httpsRequestEntries.size(),
+                sendTime);
+
             my_print(NOT_SENSITIVE, true, _T("%s: Stats send success"), __TFUNCTION__);
 
             // Reset thresholds
@@ -472,64 +1171,71 @@ bool LocalProxy::ProcessStatsAndStatus(bool final)
             // Reset stats
             m_pageViewEntries.clear();
             m_httpsRequestEntries.clear();
+            m_pageViewBytes.clear();
+            m_httpsRequestBytes.clear();
             m_bytesTransferred = 0;
-            m_lastStatusSendTimeMS = now;
+            m_throughputSampleBytes = 0;
+            m_lastStatusSendTimeMS = MonotonicMilliseconds();
         }
         else
         {
             my_print(NOT_SENSITIVE, true, _T("%s: Stats send failure"), __TFUNCTION__);
+            TunnelMetrics::AddError("StatusRequest");
+            TRACE_EVENT(TRACE_KEYWORD_LOCAL_PROXY, _T("LocalProxy/StatsSendFailed: %s, %d ms"),
+                final ? _T("final") : _T("non-final"), (DWORD)(MonotonicMilliseconds() - sendStartTime));
 
             // Status sending failures are fairly common.
             // We'll back off the thresholds and try again later.
+            // Once the size threshold passes STATS_MAX_PENDING_ENTRIES it
+            // can't be reached, so only the interval triggers retries.
             s_send_interval_ms += DEFAULT_SEND_INTERVAL_MS;
-            s_send_max_entries += DEFAULT_SEND_MAX_ENTRIES;
+            if (s_send_max_entries <= STATS_MAX_PENDING_ENTRIES)
+            {
+                s_send_max_entries += DEFAULT_SEND_MAX_ENTRIES;
+            }
         }
     }
 
     return true;
 }
 
-/* Store page view info. Some transformation may be done depending on the
-   contents of m_pageViewRegexes.
-*/
-void LocalProxy::UpsertPageView(const string& entry)
+bool LocalProxy::SampleTunnelBusy(DWORD now)
 {
-    if (entry.length() <= 0) return;
-
-    AutoMUTEX lock(m_mutex);
-
-    my_print(SENSITIVE_LOG, true, _T("%s:%d: %S"), __TFUNCTION__, __LINE__, entry.c_str());
-
-    string store_entry = "(OTHER)";
+    if (m_throughputSampleTimeMS == 0)
+    {
+        m_throughputSampleBytes = m_bytesTransferred;
+        m_throughputSampleTimeMS = now;
+    }
 
-    for (unsigned int i = 0; i < m_pageViewRegexes.size(); i++)
+    DWORD elapsedMS = now - m_throughputSampleTimeMS;
+    if (elapsedMS >= THROUGHPUT_SAMPLE_MIN_MS)
     {
-        if (regex_match(entry, m_pageViewRegexes[i].regex))
+        unsigned long long bytes = m_bytesTransferred - m_throughputSampleBytes;
+        if (bytes * 1000 >= (unsigned long long)STATS_SEND_BUSY_BYTES_PER_SECOND * elapsedMS)
         {
-            store_entry = regex_replace(
-                            entry,
-                            m_pageViewRegexes[i].regex,
-                            m_pageViewRegexes[i].replace);
-            break;
+            m_lastBusyTimeMS = now;
         }
+        m_throughputSampleBytes = m_bytesTransferred;
+        m_throughputSampleTimeMS = now;
     }
 
-    if (store_entry.length() == 0) return;
+    return m_lastBusyTimeMS != 0 && now - m_lastBusyTimeMS < STATS_SEND_QUIET_MS;
+}
 
-    // Add/increment the entry.
-    map<string, int>::iterator map_entry = m_pageViewEntries.find(store_entry);
-    if (map_entry == m_pageViewEntries.end())
-    {
-        m_pageViewEntries[store_entry] = 1;
-    }
-    else
-    {
-        map_entry->second += 1;
-    }
+/* Store page view info. Some transformation may be done depending on the
+   contents of m_pageViewMatcher.
+*/
+void LocalProxy::UpsertPageView(const string& entry)
+{
+    if (entry.length() <= 0) return;
+
+    my_print(SENSITIVE_LOG, true, _T("%s:%d: %S"), __TFUNCTION__, __LINE__, entry.c_str());
+
+    UpsertStatsEntry(entry, m_pageViewMatcher, m_pageViewClassifications, m_pageViewEntries);
 }
 
 /* Store HTTPS request info. Some transformation may be done depending on the
-   contents of m_httpsRequestRegexes.
+   contents of m_httpsRequestMatcher.
 */
 void LocalProxy::UpsertHttpsRequest(string entry)
 {
@@ -542,159 +1248,235 @@ void LocalProxy::UpsertHttpsRequest(string entry)
 
     if (entry.length() <= 0) return;
 
-    AutoMUTEX lock(m_mutex);
-
     my_print(SENSITIVE_LOG, true, _T("%s:%d: %S"), __TFUNCTION__, __LINE__, entry.c_str());
 
-    string store_entry = "(OTHER)";
+    UpsertStatsEntry(entry, m_httpsRequestMatcher, m_httpsRequestClassifications, m_httpsRequestEntries);
+}
+
+/* Bytes are bucketed exactly as the page views and HTTPS requests they were
+   carried for, so they reveal no more about where the user went than the
+   counts do.
+*/
+void LocalProxy::AddPageViewBytes(const string& entry, unsigned long long bytes)
+{
+    if (entry.length() <= 0 || bytes == 0) return;
+
+    AddStatsEntryBytes(entry, bytes, m_pageViewMatcher, m_pageViewClassifications, m_pageViewBytes);
+}
 
-    for (unsigned int i = 0; i < m_httpsRequestRegexes.size(); i++)
+void LocalProxy::AddHttpsRequestBytes(string entry, unsigned long long bytes)
+{
+    // As in UpsertHttpsRequest
+    string::size_type port = entry.find_last_of(':');
+    if (port != entry.npos)
     {
-        if (regex_match(entry, m_httpsRequestRegexes[i].regex))
-        {
-            store_entry = regex_replace(
-                            entry,
-                            m_httpsRequestRegexes[i].regex,
-                            m_httpsRequestRegexes[i].replace);
-            break;
-        }
+        entry.erase(entry.begin()+port, entry.end());
     }
 
+    if (entry.length() <= 0 || bytes == 0) return;
+
+    AddStatsEntryBytes(entry, bytes, m_httpsRequestMatcher, m_httpsRequestClassifications, m_httpsRequestBytes);
+}
+
+void LocalProxy::AddStatsEntryBytes(
+                    const string& entry,
+                    unsigned long long bytes,
+                    const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+                    StatsClassificationCache& classifications,
+                    StatsEntryBytes& entries)
+{
+    string store_entry = ClassifyStatsEntry(entry, currentMatcher, classifications);
+
     if (store_entry.length() == 0) return;
 
-    // Add/increment the entry.
-    map<string, int>::iterator map_entry = m_httpsRequestEntries.find(store_entry);
-    if (map_entry == m_httpsRequestEntries.end())
+    if (entries.size() >= STATS_MAX_PENDING_ENTRIES
+        && entries.find(store_entry) == entries.end())
     {
-        m_httpsRequestEntries[store_entry] = 1;
+        store_entry = "(OTHER)";
     }
-    else
+
+    entries[store_entry] += bytes;
+
+    // Temp connections don't collect stats, and aren't counted.
+    if (m_statsCollector)
     {
-        map_entry->second += 1;
+        TunnelMetrics::AddDestinationBytes(store_entry, bytes);
     }
 }
 
-void LocalProxy::ParsePolipoStatsBuffer(const char* page_view_buffer)
+void LocalProxy::UpsertStatsEntry(
+                    const string& entry,
+                    const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+                    StatsClassificationCache& classifications,
+                    StatsEntryCounts& entries)
 {
-    const char* HTTP_PREFIX = "PSIPHON-PAGE-VIEW-HTTP:>>";
-    const char* HTTPS_PREFIX = "PSIPHON-PAGE-VIEW-HTTPS:>>";
-    const char* BYTES_TRANSFERRED_PREFIX = "PSIPHON-BYTES-TRANSFERRED:>>";
-    const char* UNPROXIED_PREFIX = "PSIPHON-UNPROXIED:>>";
-    const char* DEBUG_PREFIX = "PSIPHON-DEBUG:>>";
-    const char* ENTRY_END = "<<";
+    string store_entry = ClassifyStatsEntry(entry, currentMatcher, classifications);
 
-    const char* curr_pos = page_view_buffer;
-    const char* end_pos = page_view_buffer + strlen(page_view_buffer);
+    if (store_entry.length() == 0) return;
 
-    while (curr_pos < end_pos)
+    // If unsent stats have piled up, fold new entries into "(OTHER)" so
+    // totals are kept but memory and payload size are bounded.
+    if (entries.size() >= STATS_MAX_PENDING_ENTRIES
+        && entries.find(store_entry) == entries.end())
     {
-        const char* http_entry_start = strstr(curr_pos, HTTP_PREFIX);
-        const char* https_entry_start = strstr(curr_pos, HTTPS_PREFIX);
-        const char* bytes_transferred_start = strstr(curr_pos, BYTES_TRANSFERRED_PREFIX);
-        const char* unproxied_start = strstr(curr_pos, UNPROXIED_PREFIX);
-        const char* debug_start = strstr(curr_pos, DEBUG_PREFIX);
-        const char* entry_end = NULL;
+        store_entry = "(OTHER)";
+    }
 
-        if (http_entry_start == NULL) http_entry_start = end_pos;
-        if (https_entry_start == NULL) https_entry_start = end_pos;
-        if (bytes_transferred_start == NULL) bytes_transferred_start = end_pos;
-        if (unproxied_start == NULL) unproxied_start = end_pos;
-        if (debug_start == NULL) debug_start = end_pos;
+    // Add/increment the entry.
+    entries[store_entry] += 1;
+}
 
-        const char* next = min(http_entry_start, https_entry_start);
-        next = min(next, bytes_transferred_start);
-        next = min(next, unproxied_start);
-        next = min(next, debug_start);
+string LocalProxy::ClassifyStatsEntry(
+                    const string& entry,
+                    const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+                    StatsClassificationCache& classifications)
+{
+    shared_ptr<const RegexReplaceMatcher> matcher;
+    string store_entry;
+    bool cached = false;
+    {
+        AutoLock lock(m_lock);
+        matcher = currentMatcher;
+        classifications.SetMatcher(matcher);
+        cached = classifications.Find(entry, store_entry);
+    }
 
-        if (next >= end_pos)
+    // Classify without holding the lock
+    if (!cached)
+    {
+        if (!matcher || !matcher->Apply(entry, store_entry))
         {
-            // No next entry found
-            break;
+            store_entry = "(OTHER)";
         }
+    }
 
-        // Find the next entry
+    AutoLock lock(m_lock);
 
-        if (next == http_entry_start)
-        {
-            const char* entry_start = next + strlen(HTTP_PREFIX);
-            entry_end = strstr(entry_start, ENTRY_END);
+    if (!cached)
+    {
+        // Ignored if UpdateSessionInfo replaced the matcher in the meantime
+        classifications.Insert(matcher, entry, store_entry);
+    }
 
-            if (!entry_end)
-            {
-                // Something is rather wrong. Maybe an incomplete entry.
-                // Stop processing;
-                break;
-            }
+    return store_entry;
+}
 
-            UpsertPageView(string(entry_start, entry_end-entry_start));
-        }
-        else if (next == https_entry_start)
+// Polipo stats records look like "PSIPHON-<TYPE>:>><VALUE><<". The pipe is a
+// byte stream, so a record may be split across reads; whatever follows the
+// last complete record is kept in m_polipoStatsBuffer for the next call.
+void LocalProxy::ParsePolipoStatsBuffer(const char* data, size_t length)
+{
+    static const char RECORD_START[] = "PSIPHON-";
+    static const char VALUE_START[] = ":>>";
+    static const char RECORD_END[] = "<<";
+    const size_t RECORD_START_LENGTH = sizeof(RECORD_START) - 1;
+    const size_t VALUE_START_LENGTH = sizeof(VALUE_START) - 1;
+    const size_t RECORD_END_LENGTH = sizeof(RECORD_END) - 1;
+    // Longer than any record type we know of
+    const size_t MAX_TYPE_LENGTH = 32;
+    // A partial record longer than this is assumed to be garbage
+    const size_t MAX_PENDING_LENGTH = 64 * 1024;
+
+    m_polipoStatsBuffer.append(data, length);
+    const string& buffer = m_polipoStatsBuffer;
+
+    // Everything before `consumed` has been handled. Each search starts where
+    // the previous one ended, so the buffer is scanned only once.
+    size_t consumed = 0;
+
+    while (true)
+    {
+        size_t recordStart = buffer.find(RECORD_START, consumed);
+        if (recordStart == string::npos)
         {
-            const char* entry_start = next + strlen(HTTPS_PREFIX);
-            entry_end = strstr(entry_start, ENTRY_END);
-
-            if (!entry_end)
+            // Keep a tail that may be the start of a split RECORD_START
+            if (buffer.size() > consumed + RECORD_START_LENGTH - 1)
             {
-                // Something is rather wrong. Maybe an incomplete entry.
-                // Stop processing;
-                break;
+                consumed = buffer.size() - (RECORD_START_LENGTH - 1);
             }
-
-            UpsertHttpsRequest(string(entry_start, entry_end-entry_start));
+            break;
         }
-        else if (next == bytes_transferred_start)
-        {
-            const char* entry_start = next + strlen(BYTES_TRANSFERRED_PREFIX);
-            entry_end = strstr(entry_start, ENTRY_END);
 
-            if (!entry_end)
+        size_t typeStart = recordStart + RECORD_START_LENGTH;
+        size_t typeEnd = buffer.find(VALUE_START, typeStart);
+        if (typeEnd == string::npos || typeEnd - typeStart > MAX_TYPE_LENGTH)
+        {
+            if (typeEnd == string::npos && buffer.size() - typeStart <= MAX_TYPE_LENGTH + VALUE_START_LENGTH)
             {
-                // Something is rather wrong. Maybe an incomplete entry.
-                // Stop processing;
+                // The record type may still be arriving
+                consumed = recordStart;
                 break;
             }
 
-            long bytes = strtol(string(entry_start, entry_end-entry_start).c_str(), NULL, 10);
-            if (bytes > 0)
-            {
-                m_bytesTransferred += bytes;
-            }
+            // Not a record
+            consumed = typeStart;
+            continue;
         }
-        else if (next == unproxied_start)
+
+        size_t valueStart = typeEnd + VALUE_START_LENGTH;
+        size_t valueEnd = buffer.find(RECORD_END, valueStart);
+        if (valueEnd == string::npos)
         {
-            const char* entry_start = next + strlen(UNPROXIED_PREFIX);
-            entry_end = strstr(entry_start, ENTRY_END);
+            // Incomplete record; finish it on the next read
+            consumed = recordStart;
+            break;
+        }
 
-            if (!entry_end)
-            {
-                // Something is rather wrong. Maybe an incomplete entry.
-                // Stop processing;
-                break;
-            }
+        HandlePolipoStatsRecord(
+            buffer.c_str() + typeStart, typeEnd - typeStart,
+            buffer.substr(valueStart, valueEnd - valueStart));
+
+        consumed = valueEnd + RECORD_END_LENGTH;
+    }
 
-            string unproxiedDomain(entry_start, entry_end-entry_start);
-            if (m_reportedUnproxiedDomains.count(unproxiedDomain) == 0)
+    m_polipoStatsBuffer.erase(0, consumed);
+
+    if (m_polipoStatsBuffer.size() > MAX_PENDING_LENGTH)
+    {
+        // Something is rather wrong. Drop the partial record rather than
+        // grow without bound.
+        my_print(NOT_SENSITIVE, true, _T("%s: discarding %d bytes of unterminated stats output"), __TFUNCTION__, (int)m_polipoStatsBuffer.size());
+        m_polipoStatsBuffer.clear();
+    }
+}
+
+void LocalProxy::HandlePolipoStatsRecord(const char* type, size_t typeLength, const string& value)
+{
+    #define IS_RECORD_TYPE(name) \
+        (typeLength == sizeof(name) - 1 && 0 == memcmp(type, name, typeLength))
+
+    if (IS_RECORD_TYPE("PAGE-VIEW-HTTP"))
+    {
+        UpsertPageView(value);
+    }
+    else if (IS_RECORD_TYPE("PAGE-VIEW-HTTPS"))
+    {
+        UpsertHttpsRequest(value);
+    }
+    else if (IS_RECORD_TYPE("BYTES-TRANSFERRED"))
+    {
+        long bytes = strtol(value.c_str(), NULL, 10);
+        if (bytes > 0)
+        {
+            m_bytesTransferred += bytes;
+            if (m_statsCollector)
             {
-                m_reportedUnproxiedDomains[unproxiedDomain] = true;
-                my_print(SENSITIVE_FORMAT_ARGS, false, _T("Unproxied: %S"), unproxiedDomain.c_str());
+                TunnelMetrics::AddProxiedBytes(bytes);
             }
         }
-        else // if (next == debug_start)
+    }
+    else if (IS_RECORD_TYPE("UNPROXIED"))
+    {
+        if (!m_reportedUnproxiedDomains.CheckAndInsert(value))
         {
-            const char* entry_start = next + strlen(DEBUG_PREFIX);
-            entry_end = strstr(entry_start, ENTRY_END);
-
-            if (!entry_end)
-            {
-                // Something is rather wrong. Maybe an incomplete entry.
-                // Stop processing;
-                break;
-            }
-
-            my_print(SENSITIVE_FORMAT_ARGS, true, _T("POLIPO-DEBUG: %S"), string(entry_start, entry_end-entry_start).c_str());
+            my_log(false, _T("Unproxied"), LogArg("domain", value, LOG_ARG_SENSITIVE));
         }
-
-        curr_pos = entry_end + strlen(ENTRY_END);
     }
-}
+    else if (IS_RECORD_TYPE("DEBUG"))
+    {
+        my_log(true, _T("POLIPO-DEBUG"), LogArg("message", value, LOG_ARG_SENSITIVE));
+    }
+    // Unknown record types are ignored
 
+    #undef IS_RECORD_TYPE
+}
@@ -20,10 +20,21 @@
 #pragma once
 
 #include "worker_thread.h"
+#include <list>
+#include <unordered_map>
 
 class SessionInfo;
 struct RegexReplace;
 class SystemProxySettings;
+class HttpProxyEngine;
+class ITransport;
+
+
+// Stats bucket -> number of hits
+typedef unordered_map<string, int> StatsEntryCounts;
+// Stats bucket -> bytes carried for it. Only known for the in-process proxy,
+// which sees each request's traffic; Polipo only reports a total.
+typedef unordered_map<string, unsigned long long> StatsEntryBytes;
 
 
 class ILocalProxyStatsCollector
@@ -32,9 +43,72 @@ public:
     // May throw StopSignal::StopException subclass if not `final`
     virtual bool SendStatusMessage(
                     bool final,
-                    const map<string, int>& pageViewEntries,
-                    const map<string, int>& httpsRequestEntries,
+                    const StatsEntryCounts& pageViewEntries,
+                    const StatsEntryCounts& httpsRequestEntries,
+                    const StatsEntryBytes& pageViewBytes,
+                    const StatsEntryBytes& httpsRequestBytes,
                     unsigned long long bytesTransferred) = 0;
+
+    // While true, due non-final sends are held -- e.g., while the machine is
+    // suspending.
+    virtual bool IsStatusMessageDeferred() const { return false; }
+};
+
+
+// Applies the first of a set of RegexReplaces that fully matches an entry.
+// Each regex is paired with a literal that any match must contain, so most
+// regexes are rejected with a substring search rather than a regex_match.
+// Immutable once constructed, so it can be shared between threads.
+class RegexReplaceMatcher
+{
+public:
+    RegexReplaceMatcher(const vector<RegexReplace>& regexes);
+
+    // True if the matcher was made from the same patterns and replacements.
+    bool IsFor(const vector<RegexReplace>& regexes) const;
+
+    // Returns false if no regex matches `entry`.
+    bool Apply(const string& entry, string& o_result) const;
+
+private:
+    static string GetRequiredLiteral(const string& pattern);
+
+    vector<RegexReplace> m_regexes;
+    vector<string> m_requiredLiterals;
+};
+
+
+// A bounded LRU of stats entry -> bucket (the matcher's result, or
+// "(OTHER)"), so repeat hosts skip the regexes. The results are only valid
+// for the matcher that produced them. Not threadsafe.
+class StatsClassificationCache
+{
+public:
+    StatsClassificationCache(size_t capacity);
+
+    // Clears the cache if `matcher` isn't the one the results came from.
+    void SetMatcher(const shared_ptr<const RegexReplaceMatcher>& matcher);
+
+    bool Find(const string& entry, string& o_storeEntry);
+
+    // Approximate bytes held, for memory accounting.
+    size_t HeapBytes() const;
+
+    // Ignored if `matcher` isn't the current one.
+    void Insert(
+        const shared_ptr<const RegexReplaceMatcher>& matcher,
+        const string& entry,
+        const string& storeEntry);
+
+private:
+    typedef list<pair<string, string>> LRU;
+    typedef unordered_map<string, LRU::iterator> Index;
+
+    size_t m_capacity;
+    // Held so the matcher can't be freed and another allocated at its address
+    shared_ptr<const RegexReplaceMatcher> m_matcher;
+    LRU m_lru;
+    Index m_index;
 };
 
 
@@ -51,29 +125,74 @@ public:
         const tstring& splitTunnelingFilePath);
     virtual ~LocalProxy();
 
+    // Approximate bytes held by the pending stats of the stats-collecting
+    // instance, as of its last periodic check, for memory accounting.
+    static size_t GetStatsMemoryUsage();
+
     // Sometimes SessionInfo gets updated after the LocalProxy starts (i.e.,
     // a handshake happens afterwards, with new page view regexes); in that
     // case we need to update the SessionInfo here.
     void UpdateSessionInfo(const SessionInfo& sessionInfo);
 
+    // Instead of running an HTTP proxy, only reports the bytes transport's
+    // interface carries (see ITransport::SupportsInterfaceStats), with no
+    // page view or HTTPS request stats. transport must outlive this. Call
+    // before Start.
+    void UseInterfaceStats(ITransport* transport);
+
 protected:
+    // Times the stats parsing
+    friend class Microbenchmarks;
+
     // IWorkerThread implementation
     bool DoStart();
     bool DoPeriodicCheck();
+    void GetWaitHandles(vector<HANDLE>& o_handles);
+    DWORD GetPeriodicCheckInterval() const;
     void StopImminent();
     void DoStop(bool cleanly);
 
     void Cleanup(bool doStats);
 
     bool StartPolipo(int localHttpProxyPort);
+    DWORD WaitForPolipoListening(int localHttpProxyPort, DWORD timeout);
+    bool StartProxyEngine(int localHttpProxyPort);
+    void CollectProxyEngineStats();
+    void CollectInterfaceStats();
     bool CreatePolipoPipe(HANDLE& o_outputPipe, HANDLE& o_errorPipe);
+    // Parses whatever Polipo has written, and starts the next read
+    void ReadPolipoPipe();
     bool ProcessStatsAndStatus(bool final);
     void UpsertPageView(const string& entry);
     void UpsertHttpsRequest(string entry);
-    void ParsePolipoStatsBuffer(const char* page_view_buffer);
+    void UpsertStatsEntry(
+            const string& entry,
+            const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+            StatsClassificationCache& classifications,
+            StatsEntryCounts& entries);
+    void AddPageViewBytes(const string& entry, unsigned long long bytes);
+    void AddHttpsRequestBytes(string entry, unsigned long long bytes);
+    void AddStatsEntryBytes(
+            const string& entry,
+            unsigned long long bytes,
+            const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+            StatsClassificationCache& classifications,
+            StatsEntryBytes& entries);
+    // The bucket entry falls in with the matcher, "(OTHER)" if none.
+    string ClassifyStatsEntry(
+            const string& entry,
+            const shared_ptr<const RegexReplaceMatcher>& currentMatcher,
+            StatsClassificationCache& classifications);
+    // Consumes the next chunk of Polipo stats output
+    void ParsePolipoStatsBuffer(const char* data, size_t length);
+    void HandlePolipoStatsRecord(const char* type, size_t typeLength, const string& value);
+    void UpdateStatsMemoryUsage();
+    // Updates the throughput estimate from m_bytesTransferred. Returns true if
+    // the tunnel has carried heavy traffic within the last few seconds.
+    bool SampleTunnelBusy(DWORD now);
 
 private:
-    HANDLE m_mutex;
+    Lock m_lock;
     ILocalProxyStatsCollector* m_statsCollector;
     int m_parentPort;
     tstring m_polipoPath;
@@ -81,14 +200,45 @@ private:
     SystemProxySettings* m_systemProxySettings;
     PROCESS_INFORMATION m_polipoProcessInfo;
     HANDLE m_polipoPipe;
-    DWORD m_lastStatusSendTimeMS;
-    map<string, int> m_pageViewEntries;
-    map<string, int> m_httpsRequestEntries;
+    // m_polipoPipe is read with overlapped I/O into m_polipoReadBuffer, so the
+    // event loop can wait on it; at most one read is outstanding.
+    OVERLAPPED m_polipoPipeOverlapped;
+    bool m_polipoPipeReadPending;
+    // Set once Polipo has logged that it's listening
+    bool m_polipoListening;
+    // Used instead of Polipo if Settings::InProcessHttpProxy() is set
+    HttpProxyEngine* m_proxyEngine;
+    // Set by UseInterfaceStats, in which case there's neither
+    ITransport* m_interfaceStatsTransport;
+    // Its count as of the last CollectInterfaceStats
+    unsigned long long m_lastInterfaceBytes;
+    vector<char> m_polipoReadBuffer;
+    // Stats output not yet parsed: the start of a record split across reads
+    string m_polipoStatsBuffer;
+    // MonotonicMilliseconds
+    unsigned long long m_lastStatusSendTimeMS;
+    DWORD m_lastStatsMemoryUsageTimeMS;
+    // When traffic was last seen, for IdleAwareInterval
+    DWORD m_lastActivityTimeMS;
+    StatsEntryCounts m_pageViewEntries;
+    StatsEntryCounts m_httpsRequestEntries;
+    StatsEntryBytes m_pageViewBytes;
+    StatsEntryBytes m_httpsRequestBytes;
     unsigned long long m_bytesTransferred;
-    vector<RegexReplace> m_pageViewRegexes;
-    vector<RegexReplace> m_httpsRequestRegexes;
+    // For SampleTunnelBusy
+    unsigned long long m_throughputSampleBytes;
+    DWORD m_throughputSampleTimeMS;
+    DWORD m_lastBusyTimeMS;
+    // When a non-final send was first held back for traffic; 0 if none is
+    DWORD m_statsSendDeferredSinceMS;
+    // Replaced wholesale by UpdateSessionInfo; take a reference under m_lock
+    shared_ptr<const RegexReplaceMatcher> m_pageViewMatcher;
+    shared_ptr<const RegexReplaceMatcher> m_httpsRequestMatcher;
+    // Guarded by m_lock
+    StatsClassificationCache m_pageViewClassifications;
+    StatsClassificationCache m_httpsRequestClassifications;
     bool m_finalStatsSent;
     string m_serverAddress;
-    map<string, bool> m_reportedUnproxiedDomains;
+    RecentlySeenSet m_reportedUnproxiedDomains;
 };
 
@@ -18,9 +18,12 @@
 */
 
 #include "stdafx.h"
+#include "config.h"
 #include "utilities.h"
 #include "psiclient.h"
 #include "logging.h"
+#include "ring_log.h"
+#include "compressed_history.h"
 
 
 /*
@@ -51,13 +54,194 @@ extern HWND g_hWnd;
 
 //==== my_print (logging) =====================================================
 
-vector<MessageHistoryEntry> g_messageHistory;
-HANDLE g_messageHistoryMutex = CreateMutex(NULL, FALSE, 0);
+// The message history is a fixed-capacity ring of preallocated slots, so it
+// can't grow over the life of the process. Producers claim a slot with an
+// interlocked increment and then hold only that slot's spinlock while filling
+// it; GetMessageHistory locks each slot just long enough to copy it. Writers
+// only ever contend with each other or with a snapshot when they land on the
+// very same slot. A writer that's been lapped -- descheduled while one a whole
+// ring later claimed and filled the same slot -- drops its message, so a
+// slot's sequence never goes backwards.
 
-void GetMessageHistory(vector<MessageHistoryEntry>& history)
+static_assert((MESSAGE_HISTORY_CAPACITY & (MESSAGE_HISTORY_CAPACITY - 1)) == 0,
+              "MESSAGE_HISTORY_CAPACITY must be a power of two");
+
+struct MessageHistorySlot
+{
+    MessageHistorySlot() : lock(0), sequence(0), structuredMessage(NULL) {}
+
+    void Lock()
+    {
+        while (InterlockedCompareExchange(&lock, 1, 0) != 0)
+        {
+            YieldProcessor();
+        }
+    }
+
+    void Unlock()
+    {
+        InterlockedExchange(&lock, 0);
+    }
+
+    // Whether the slot already holds a message newer than the one at index.
+    // Must be locked.
+    bool HoldsNewerThan(ULONG index) const
+    {
+        return sequence != 0 && (LONG)((ULONG)sequence - (index + 1)) > 0;
+    }
+
+    volatile LONG lock;
+    // One more than the index of the message held; 0 if empty.
+    LONG sequence;
+    // For a structured message, entry.message is empty until it's read, and
+    // these are what it's formatted from.
+    const TCHAR* structuredMessage;
+    string structuredArgs;
+    MessageHistoryEntry entry;
+};
+
+static MessageHistorySlot g_messageHistory[MESSAGE_HISTORY_CAPACITY];
+static volatile LONG g_messageHistoryNext = 0;
+
+// Messages pushed out of the ring by newer ones, compressed. Each record is
+// the debug flag ('0' or '1'), the timestamp, a NUL, and the message, in
+// UTF-8.
+static Lock g_coldMessageHistoryLock("ColdMessageHistory");
+static CompressedHistory g_coldMessageHistory(MESSAGE_HISTORY_COLD_MAX_BYTES);
+
+// Called, without the slot locked, with what a slot held before it was
+// reused. For a structured message, message is empty, and it's formatted
+// from the rest as in GetMessageHistory.
+static void RetireMessageHistoryEntry(
+                bool debug,
+                const tstring& timestamp,
+                const tstring& message,
+                const TCHAR* structuredMessage,
+                const string& structuredArgs)
+{
+    string record;
+    record += debug ? '1' : '0';
+    record += WStringToUTF8(timestamp);
+    record += '\0';
+    if (structuredMessage)
+    {
+        record += WStringToUTF8(tstring(debug ? _T("DEBUG: ") : _T("")) + structuredMessage);
+        (void)_LogFormatArgs(structuredArgs.data(), structuredArgs.length(), record);
+    }
+    else
+    {
+        record += WStringToUTF8(message);
+    }
+
+    AutoLock lock(g_coldMessageHistoryLock);
+    g_coldMessageHistory.Append(record);
+}
+
+void GetMessageHistory(vector<MessageHistoryEntry>& history, ULONG sinceIndex/*=0*/, ULONG* o_nextIndex/*=NULL*/)
+{
+    history.clear();
+
+    vector<string> coldRecords;
+    {
+        AutoLock lock(g_coldMessageHistoryLock);
+        g_coldMessageHistory.GetRecords(coldRecords);
+    }
+
+    ULONG next = (ULONG)InterlockedCompareExchange(&g_messageHistoryNext, 0, 0);
+    ULONG count = min(next, (ULONG)MESSAGE_HISTORY_CAPACITY);
+
+    if (o_nextIndex)
+    {
+        *o_nextIndex = next;
+    }
+
+    // The compressed records are the ones just before the ring's, so their
+    // indexes follow from how many there are. Messages retired since the
+    // records were copied can shift that by a few, at worst repeating them.
+    ULONG ringStart = next - count;
+    ULONG coldStart = (ULONG)min((size_t)ringStart, coldRecords.size());
+    coldStart = ringStart - coldStart;
+    size_t coldSkip = (sinceIndex > coldStart) ? min((size_t)(sinceIndex - coldStart), coldRecords.size()) : 0;
+    if (sinceIndex > ringStart)
+    {
+        ringStart = min(sinceIndex, next);
+        count = next - ringStart;
+    }
+
+    history.reserve(coldRecords.size() - coldSkip + count);
+
+    for (auto record = coldRecords.cbegin() + coldSkip; record != coldRecords.cend(); ++record)
+    {
+        size_t timestampEnd = record->find('\0');
+        if (record->empty() || timestampEnd == string::npos)
+        {
+            continue;
+        }
+
+        MessageHistoryEntry entry;
+        entry.debug = ((*record)[0] == '1');
+        entry.timestamp = UTF8ToWString(record->substr(1, timestampEnd - 1));
+        entry.message = UTF8ToWString(record->substr(timestampEnd + 1));
+        history.push_back(std::move(entry));
+    }
+    coldRecords.clear();
+
+    for (ULONG index = ringStart; index != next; index++)
+    {
+        MessageHistorySlot& slot = g_messageHistory[index & (MESSAGE_HISTORY_CAPACITY - 1)];
+
+        const TCHAR* structuredMessage = NULL;
+        string structuredArgs;
+        bool copied = false;
+
+        slot.Lock();
+        // Skip slots that a writer has already claimed for a newer message, or
+        // hasn't finished filling yet.
+        if ((ULONG)slot.sequence == index + 1)
+        {
+            history.push_back(slot.entry);
+            structuredMessage = slot.structuredMessage;
+            if (structuredMessage)
+            {
+                structuredArgs = slot.structuredArgs;
+            }
+            copied = true;
+        }
+        slot.Unlock();
+
+        // Formatted without holding up writers
+        if (copied && structuredMessage)
+        {
+            string text;
+            (void)_LogFormatArgs(structuredArgs.data(), structuredArgs.length(), text);
+            history.back().message = tstring(history.back().debug ? _T("DEBUG: ") : _T(""))
+                                        + structuredMessage
+                                        + UTF8ToWString(text);
+        }
+    }
+}
+
+size_t GetMessageHistoryMemoryUsage()
 {
-    AutoMUTEX mutex(g_messageHistoryMutex);
-    history = g_messageHistory;
+    size_t total = sizeof(g_messageHistory);
+
+    {
+        AutoLock lock(g_coldMessageHistoryLock);
+        total += g_coldMessageHistory.MemoryUsage();
+    }
+
+    for (ULONG index = 0; index < MESSAGE_HISTORY_CAPACITY; index++)
+    {
+        MessageHistorySlot& slot = g_messageHistory[index];
+
+        slot.Lock();
+        total += StringHeapBytes(slot.entry.message)
+                 + StringHeapBytes(slot.entry.timestamp)
+                 + StringHeapBytes(slot.structuredArgs);
+        slot.Unlock();
+    }
+
+    return total;
 }
 
 void AddMessageEntryToHistory(
@@ -66,8 +250,6 @@ void AddMessageEntryToHistory(
     const TCHAR* formatString,
     const TCHAR* finalString)
 {
-    AutoMUTEX mutex(g_messageHistoryMutex);
-
     const TCHAR* historicalMessage = NULL;
     if (sensitivity == NOT_SENSITIVE)
     {
@@ -84,11 +266,50 @@ void AddMessageEntryToHistory(
 
     if (historicalMessage != NULL)
     {
-        MessageHistoryEntry entry;
-        entry.message = historicalMessage;
-        entry.timestamp = GetISO8601DatetimeString();
-        entry.debug = bDebugMessage;
-        g_messageHistory.push_back(entry);
+        tstring timestamp = GetISO8601DatetimeString();
+
+        ULONG index = (ULONG)InterlockedIncrement(&g_messageHistoryNext) - 1;
+        MessageHistorySlot& slot = g_messageHistory[index & (MESSAGE_HISTORY_CAPACITY - 1)];
+
+        // What the slot held, if anything, goes to the cold history. The old
+        // timestamp ends up in `timestamp`.
+        bool retired = false;
+        bool retiredDebug = false;
+        tstring retiredMessage;
+        const TCHAR* retiredStructuredMessage = NULL;
+        string retiredStructuredArgs;
+
+        slot.Lock();
+        // Lapped; the message would have been retired by now anyway.
+        if (slot.HoldsNewerThan(index))
+        {
+            slot.Unlock();
+        }
+        else
+        {
+            if (slot.sequence != 0)
+            {
+                retired = true;
+                retiredDebug = slot.entry.debug;
+                retiredMessage.swap(slot.entry.message);
+                retiredStructuredMessage = slot.structuredMessage;
+                retiredStructuredArgs.swap(slot.structuredArgs);
+            }
+            slot.entry.message.assign(historicalMessage);
+            slot.entry.timestamp.swap(timestamp);
+            slot.entry.debug = bDebugMessage;
+            slot.structuredMessage = NULL;
+            slot.sequence = (LONG)(index + 1);
+            slot.Unlock();
+        }
+
+        if (retired)
+        {
+            RetireMessageHistoryEntry(retiredDebug, timestamp, retiredMessage, retiredStructuredMessage, retiredStructuredArgs);
+        }
+
+        const string& utf8Message = WStringToUTF8Temp(historicalMessage, _tcslen(historicalMessage));
+        RingLogWrite(RING_LOG_RECORD_MESSAGE, bDebugMessage, utf8Message.data(), utf8Message.length());
     }
 }
 
@@ -98,8 +319,37 @@ bool g_bShowDebugMessages = true;
 bool g_bShowDebugMessages = false;
 #endif
 
-void my_print(LogSensitivity sensitivity, bool bDebugMessage, const TCHAR* format, ...)
+// Where a message goes. It's only formatted if one of them needs it.
+static bool ShowsInUI(bool bDebugMessage)
 {
+    return !bDebugMessage || g_bShowDebugMessages;
+}
+
+static bool GoesToHistory(LogSensitivity sensitivity)
+{
+    return sensitivity != SENSITIVE_LOG;
+}
+
+void (my_print)(LogSensitivity sensitivity, bool bDebugMessage, const TCHAR* format, ...)
+{
+    bool showInUI = ShowsInUI(bDebugMessage);
+
+    if (!showInUI)
+    {
+        if (!GoesToHistory(sensitivity))
+        {
+            return;
+        }
+
+        // History keeps only the format string of a SENSITIVE_FORMAT_ARGS
+        // message, so there's nothing to format.
+        if (sensitivity == SENSITIVE_FORMAT_ARGS)
+        {
+            AddMessageEntryToHistory(sensitivity, bDebugMessage, format, NULL);
+            return;
+        }
+    }
+
     TCHAR* debugPrefix = _T("DEBUG: ");
     size_t debugPrefixLength = _tcsclen(debugPrefix);
     TCHAR* buffer = NULL;
@@ -128,18 +378,246 @@ void my_print(LogSensitivity sensitivity, bool bDebugMessage, const TCHAR* forma
 
     AddMessageEntryToHistory(sensitivity, bDebugMessage, format, buffer);
 
-    if (!bDebugMessage || g_bShowDebugMessages)
+    // NOTE:
+    // Main window handles displaying the message. This avoids
+    // deadlocks with SendMessage. Main window will deallocate
+    // buffer.
+    if (!showInUI
+        || !PostMessage(g_hWnd, WM_PSIPHON_MY_PRINT, bDebugMessage ? 0 : 1, (LPARAM)buffer))
+    {
+        free(buffer);
+    }
+}
+
+void (my_print)(LogSensitivity sensitivity, bool bDebugMessage, const string& message)
+{
+    // Not even converted if it's going nowhere
+    if (!ShowsInUI(bDebugMessage) && !GoesToHistory(sensitivity))
+    {
+        return;
+    }
+
+    (my_print)(sensitivity, bDebugMessage, UTF8ToWStringTemp(message).c_str());
+}
+
+
+//==== my_log (structured logging) ============================================
+
+// Encoded, each argument is: type, BYTE; whether the value is present, BYTE;
+// name length, BYTE; the name; then the value -- 8 bytes for a number, or a
+// DWORD byte count and the bytes for a string (UTF-16 for LOG_ARG_TYPE_WSTRING).
+#define LOG_ARG_MAX_NAME_LENGTH     255
+#define LOG_ARG_MAX_STRING_BYTES    4096
+#define LOG_REDACTED_VALUE          "[redacted]"
+
+void _LogEncodeArgs(std::initializer_list<LogArg> args, bool withSensitive, string& o_encodedArgs)
+{
+    o_encodedArgs.clear();
+
+    for (auto arg = args.begin(); arg != args.end(); ++arg)
     {
-        // NOTE:
-        // Main window handles displaying the message. This avoids
-        // deadlocks with SendMessage. Main window will deallocate
-        // buffer.
+        bool hasValue = withSensitive || arg->sensitivity == LOG_ARG_NOT_SENSITIVE;
+        size_t nameLength = min(strlen(arg->name), (size_t)LOG_ARG_MAX_NAME_LENGTH);
+
+        o_encodedArgs.push_back((char)arg->type);
+        o_encodedArgs.push_back(hasValue ? 1 : 0);
+        o_encodedArgs.push_back((char)nameLength);
+        o_encodedArgs.append(arg->name, nameLength);
 
-        PostMessage(g_hWnd, WM_PSIPHON_MY_PRINT, bDebugMessage ? 0 : 1, (LPARAM)buffer);
+        if (!hasValue)
+        {
+            continue;
+        }
+
+        if (arg->type == LOG_ARG_TYPE_STRING || arg->type == LOG_ARG_TYPE_WSTRING)
+        {
+            size_t charBytes = (arg->type == LOG_ARG_TYPE_STRING) ? sizeof(char) : sizeof(wchar_t);
+            DWORD bytes = (DWORD)min(arg->length * charBytes, (size_t)LOG_ARG_MAX_STRING_BYTES);
+            bytes -= bytes % charBytes;
+            o_encodedArgs.append((const char*)&bytes, sizeof(bytes));
+            o_encodedArgs.append((const char*)arg->data, bytes);
+        }
+        else
+        {
+            o_encodedArgs.append((const char*)&arg->number, sizeof(arg->number));
+        }
     }
 }
 
-void my_print(LogSensitivity sensitivity, bool bDebugMessage, const string& message)
+bool _LogFormatArgs(const char* encodedArgs, size_t length, string& io_text)
 {
-    my_print(sensitivity, bDebugMessage, UTF8ToWString(message).c_str());
+    const char* p = encodedArgs;
+    const char* end = encodedArgs + length;
+    bool first = true;
+
+    while (p < end)
+    {
+        if (end - p < 3 || end - p - 3 < (BYTE)p[2])
+        {
+            return false;
+        }
+        LogArgType type = (LogArgType)(BYTE)p[0];
+        bool hasValue = p[1] != 0;
+        size_t nameLength = (BYTE)p[2];
+        p += 3;
+
+        io_text += first ? " (" : ", ";
+        first = false;
+        io_text.append(p, nameLength);
+        io_text += ": ";
+        p += nameLength;
+
+        if (!hasValue)
+        {
+            io_text += LOG_REDACTED_VALUE;
+            continue;
+        }
+
+        if (type == LOG_ARG_TYPE_STRING || type == LOG_ARG_TYPE_WSTRING)
+        {
+            DWORD bytes = 0;
+            if ((size_t)(end - p) < sizeof(bytes))
+            {
+                return false;
+            }
+            memcpy(&bytes, p, sizeof(bytes));
+            p += sizeof(bytes);
+            if ((size_t)(end - p) < bytes)
+            {
+                return false;
+            }
+
+            if (type == LOG_ARG_TYPE_STRING)
+            {
+                io_text.append(p, bytes);
+            }
+            else
+            {
+                // The bytes may not be aligned for wchar_t
+                wstring wide(bytes / sizeof(wchar_t), L'\0');
+                memcpy(&wide[0], p, wide.length() * sizeof(wchar_t));
+                io_text += WStringToUTF8(wide);
+            }
+            p += bytes;
+            continue;
+        }
+
+        union { long long i; unsigned long long u; double d; } number;
+        if ((size_t)(end - p) < sizeof(number))
+        {
+            return false;
+        }
+        memcpy(&number, p, sizeof(number));
+        p += sizeof(number);
+
+        char value[32];
+        switch (type)
+        {
+        case LOG_ARG_TYPE_INT:
+            _snprintf_s(value, _TRUNCATE, "%lld", number.i);
+            break;
+        case LOG_ARG_TYPE_UINT:
+            _snprintf_s(value, _TRUNCATE, "%llu", number.u);
+            break;
+        case LOG_ARG_TYPE_DOUBLE:
+            _snprintf_s(value, _TRUNCATE, "%g", number.d);
+            break;
+        case LOG_ARG_TYPE_BOOL:
+            strcpy_s(value, number.u ? "true" : "false");
+            break;
+        default:
+            return false;
+        }
+        io_text += value;
+    }
+
+    if (!first)
+    {
+        io_text += ")";
+    }
+    return true;
+}
+
+void _LogStructured(bool bDebugMessage, const TCHAR* message, std::initializer_list<LogArg> args)
+{
+    bool showInUI = ShowsInUI(bDebugMessage);
+
+    // What's kept leaves out the sensitive values.
+    string encodedArgs;
+    _LogEncodeArgs(args, false, encodedArgs);
+
+    const string& utf8Message = WStringToUTF8Temp(message, _tcslen(message));
+    string record;
+    record.reserve(utf8Message.length() + 1 + encodedArgs.length());
+    record.append(utf8Message);
+    record.push_back('\0');
+    record.append(encodedArgs);
+    RingLogWrite(RING_LOG_RECORD_STRUCTURED, bDebugMessage, record.data(), record.length());
+
+    ULONG index = (ULONG)InterlockedIncrement(&g_messageHistoryNext) - 1;
+    MessageHistorySlot& slot = g_messageHistory[index & (MESSAGE_HISTORY_CAPACITY - 1)];
+
+    tstring timestamp = GetISO8601DatetimeString();
+
+    // As in AddMessageEntryToHistory. The old timestamp and args end up in
+    // `timestamp` and `encodedArgs`.
+    bool retired = false;
+    bool retiredDebug = false;
+    tstring retiredMessage;
+    const TCHAR* retiredStructuredMessage = NULL;
+
+    slot.Lock();
+    // Lapped, as in AddMessageEntryToHistory
+    if (slot.HoldsNewerThan(index))
+    {
+        slot.Unlock();
+    }
+    else
+    {
+        if (slot.sequence != 0)
+        {
+            retired = true;
+            retiredDebug = slot.entry.debug;
+            retiredMessage.swap(slot.entry.message);
+            retiredStructuredMessage = slot.structuredMessage;
+        }
+        slot.entry.message.clear();
+        slot.entry.timestamp.swap(timestamp);
+        slot.entry.debug = bDebugMessage;
+        slot.structuredMessage = message;
+        slot.structuredArgs.swap(encodedArgs);
+        slot.sequence = (LONG)(index + 1);
+        slot.Unlock();
+    }
+
+    if (retired)
+    {
+        RetireMessageHistoryEntry(retiredDebug, timestamp, retiredMessage, retiredStructuredMessage, encodedArgs);
+    }
+
+    if (!showInUI)
+    {
+        return;
+    }
+
+    // The UI is shown everything.
+    string fullArgs, text;
+    _LogEncodeArgs(args, true, fullArgs);
+    (void)_LogFormatArgs(fullArgs.data(), fullArgs.length(), text);
+
+    tstring uiMessage = tstring(bDebugMessage ? _T("DEBUG: ") : _T("")) + message + UTF8ToWString(text);
+
+    // As for my_print, the main window frees the buffer.
+    size_t bufferLength = uiMessage.length() + 1;
+    TCHAR* buffer = (TCHAR*)malloc(bufferLength * sizeof(TCHAR));
+    if (!buffer)
+    {
+        return;
+    }
+    _tcscpy_s(buffer, bufferLength, uiMessage.c_str());
+
+    if (!PostMessage(g_hWnd, WM_PSIPHON_MY_PRINT, bDebugMessage ? 0 : 1, (LPARAM)buffer))
+    {
+        free(buffer);
+    }
 }
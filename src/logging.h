@@ -33,13 +33,129 @@ enum LogSensitivity
 
     /**
     The format arguments to the log messages are sensitive, but the
-    log message itself is not.
+    log message itself is not. (my_log, below, can mark just the sensitive
+    arguments.)
     */
     SENSITIVE_FORMAT_ARGS
 };
 
-void my_print(LogSensitivity sensitivity, bool bDebugMessage, const TCHAR* format, ...);
-void my_print(LogSensitivity sensitivity, bool bDebugMessage, const string& message);
+// Messages are only formatted if they'll be shown or go into the history.
+void (my_print)(LogSensitivity sensitivity, bool bDebugMessage, const TCHAR* format, ...);
+void (my_print)(LogSensitivity sensitivity, bool bDebugMessage, const string& message);
+
+// Debug messages are kept in release builds, as they go into the history
+// that's sent with feedback. Define LOG_DEBUG_MESSAGES as 0 to compile them
+// out: a call with a constant true bDebugMessage then evaluates nothing.
+#ifndef LOG_DEBUG_MESSAGES
+#define LOG_DEBUG_MESSAGES 1
+#endif
+
+#if !LOG_DEBUG_MESSAGES
+#define my_print(sensitivity, bDebugMessage, ...) \
+    ((bDebugMessage) ? (void)0 : (my_print)(sensitivity, bDebugMessage, __VA_ARGS__))
+#endif
+
+
+/*
+Structured logging: a fixed message and named, typed arguments. E.g.,
+    my_log(true, _T("Resolve failed"), LogArg("host", host, LOG_ARG_SENSITIVE), LogArg("error", error));
+reads "Resolve failed (host: example.com, error: 11001)".
+
+Arguments are typed by overload rather than by a format string, so they
+can't mismatch it; a type without an overload doesn't compile. A sensitive
+argument is shown in the UI, but the history and the ring log keep only its
+name -- so, unlike with SENSITIVE_FORMAT_ARGS, the rest of the message is
+still there.
+
+message is kept by pointer, so it must be a string literal. Arguments are
+captured in binary form, and only formatted when there's a reader for the
+text: right away if the message is shown in the UI, otherwise when the
+history (or a crashed session's ring log) is read.
+*/
+
+enum LogArgSensitivity
+{
+    LOG_ARG_NOT_SENSITIVE,
+    LOG_ARG_SENSITIVE
+};
+
+enum LogArgType
+{
+    LOG_ARG_TYPE_INT = 0,
+    LOG_ARG_TYPE_UINT,
+    LOG_ARG_TYPE_DOUBLE,
+    LOG_ARG_TYPE_BOOL,
+    LOG_ARG_TYPE_STRING,    // UTF-8
+    LOG_ARG_TYPE_WSTRING
+};
+
+class LogArg
+{
+public:
+    LogArg(const char* name, bool value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_BOOL), sensitivity(sensitivity), data(NULL), length(0) { number.u = value ? 1 : 0; }
+    LogArg(const char* name, int value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_INT), sensitivity(sensitivity), data(NULL), length(0) { number.i = value; }
+    LogArg(const char* name, long value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_INT), sensitivity(sensitivity), data(NULL), length(0) { number.i = value; }
+    LogArg(const char* name, long long value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_INT), sensitivity(sensitivity), data(NULL), length(0) { number.i = value; }
+    LogArg(const char* name, unsigned int value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_UINT), sensitivity(sensitivity), data(NULL), length(0) { number.u = value; }
+    LogArg(const char* name, unsigned long value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_UINT), sensitivity(sensitivity), data(NULL), length(0) { number.u = value; }
+    LogArg(const char* name, unsigned long long value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_UINT), sensitivity(sensitivity), data(NULL), length(0) { number.u = value; }
+    LogArg(const char* name, double value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_DOUBLE), sensitivity(sensitivity), data(NULL), length(0) { number.d = value; }
+    LogArg(const char* name, const char* value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_STRING), sensitivity(sensitivity), data(value), length(value ? strlen(value) : 0) { number.u = 0; }
+    LogArg(const char* name, const string& value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_STRING), sensitivity(sensitivity), data(value.data()), length(value.length()) { number.u = 0; }
+    LogArg(const char* name, const wchar_t* value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_WSTRING), sensitivity(sensitivity), data(value), length(value ? wcslen(value) : 0) { number.u = 0; }
+    LogArg(const char* name, const wstring& value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE)
+        : name(name), type(LOG_ARG_TYPE_WSTRING), sensitivity(sensitivity), data(value.data()), length(value.length()) { number.u = 0; }
+
+    // Anything else -- a pointer, an enum, a struct -- is an error.
+    template<typename T>
+    LogArg(const char* name, const T& value, LogArgSensitivity sensitivity=LOG_ARG_NOT_SENSITIVE) = delete;
+
+    const char* name;
+    LogArgType type;
+    LogArgSensitivity sensitivity;
+    union
+    {
+        long long i;
+        unsigned long long u;
+        double d;
+    } number;
+    // Strings only; they're only referenced until my_log returns. length is
+    // in characters.
+    const void* data;
+    size_t length;
+};
+
+// Use my_log instead.
+void _LogStructured(bool bDebugMessage, const TCHAR* message, std::initializer_list<LogArg> args);
+
+template<typename... Args>
+void (my_log)(bool bDebugMessage, const TCHAR* message, const Args&... args)
+{
+    _LogStructured(bDebugMessage, message, { args... });
+}
+
+#if !LOG_DEBUG_MESSAGES
+#define my_log(bDebugMessage, ...) \
+    ((bDebugMessage) ? (void)0 : (my_log)(bDebugMessage, __VA_ARGS__))
+#endif
+
+// The binary form of a structured message's arguments, as kept in the
+// history and the ring log; sensitive values are left out unless
+// withSensitive. _LogFormatArgs appends them as text (UTF-8) to io_text.
+// False if encodedArgs is malformed, e.g., from a torn ring log record.
+void _LogEncodeArgs(std::initializer_list<LogArg> args, bool withSensitive, string& o_encodedArgs);
+bool _LogFormatArgs(const char* encodedArgs, size_t length, string& io_text);
 
 
 struct MessageHistoryEntry
@@ -49,4 +165,13 @@ struct MessageHistoryEntry
     bool debug;
 };
 
-void GetMessageHistory(vector<MessageHistoryEntry>& history);
+// Returns the messages kept, oldest first: the last MESSAGE_HISTORY_CAPACITY
+// as they were logged, and before those, as many as fit in the compressed
+// history (MESSAGE_HISTORY_COLD_MAX_BYTES). Only messages that are being
+// moved to the compressed history wait while it's read.
+// Messages before sinceIndex aren't returned; o_nextIndex, if given, is set
+// to the index the next message logged will have, for a later call.
+void GetMessageHistory(vector<MessageHistoryEntry>& history, ULONG sinceIndex=0, ULONG* o_nextIndex=NULL);
+
+// Approximate bytes held by the message history, for memory accounting.
+size_t GetMessageHistoryMemoryUsage();
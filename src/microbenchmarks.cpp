@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "microbenchmarks.h"
+#include "serverlist.h"
+#include "coretransport.h"
+#include "local_proxy.h"
+#include "systemproxysettings.h"
+#include "authenticated_data_package.h"
+#include "logging.h"
+#include "utilities.h"
+#include <random>
+
+#pragma warning(push, 0)
+#pragma warning(disable: 4244)
+#include "cryptlib.h"
+#include "osrng.h"
+#include "rsa.h"
+#include "base64.h"
+#include "gzip.h"
+#pragma warning(pop)
+
+
+#define MICROBENCHMARK_MIN_DURATION_MS          500
+#define MICROBENCHMARK_MIN_ITERATIONS           3
+#define MICROBENCHMARK_SERVER_ENTRY_COUNT       5000
+#define MICROBENCHMARK_CODEC_INPUT_BYTES        (1024*1024)
+#define MICROBENCHMARK_NOTICE_COUNT             2000
+#define MICROBENCHMARK_POLIPO_RECORD_COUNT      5000
+// Polipo's output is consumed as it arrives, in reads of about this size
+#define MICROBENCHMARK_POLIPO_READ_BYTES        4096
+// About the size of a remote server list
+#define MICROBENCHMARK_PACKAGE_ENTRY_COUNT      1000
+#define MICROBENCHMARK_SIGNING_KEY_BITS         2048
+// The corpora are the same on every run, so runs can be compared.
+#define MICROBENCHMARK_RANDOM_SEED              0x50534950
+
+
+/***********************************************************************
+ Result
+ */
+
+Json::Value Microbenchmarks::Result::ToJson() const
+{
+    double microsecondsPerIteration = iterations > 0 ? (double)totalMicroseconds / iterations : 0;
+
+    Json::Value json;
+    json["name"] = name;
+    json["items"] = (Json::UInt64)items;
+    json["bytes"] = (Json::UInt64)bytes;
+    json["iterations"] = iterations;
+    json["totalMicroseconds"] = (Json::UInt64)totalMicroseconds;
+    json["microsecondsPerIteration"] = microsecondsPerIteration;
+    if (items > 0)
+    {
+        json["nanosecondsPerItem"] = microsecondsPerIteration * 1000 / items;
+    }
+    if (bytes > 0 && microsecondsPerIteration > 0)
+    {
+        // Bytes per microsecond is (decimal) megabytes per second
+        json["megabytesPerSecond"] = bytes / microsecondsPerIteration;
+    }
+    return json;
+}
+
+
+/***********************************************************************
+ Corpora
+ */
+
+static string RandomBytes(std::mt19937& random, size_t length)
+{
+    string bytes(length, '\0');
+    for (size_t i = 0; i < length; i++)
+    {
+        bytes[i] = (char)(random() & 0xFF);
+    }
+    return bytes;
+}
+
+static string RandomHex(std::mt19937& random, size_t length)
+{
+    string bytes = RandomBytes(random, length);
+    return Hexlify((const unsigned char*)bytes.data(), bytes.length());
+}
+
+static string RandomBase64(std::mt19937& random, size_t length)
+{
+    string bytes = RandomBytes(random, length);
+    return Base64Encode((const unsigned char*)bytes.data(), bytes.length());
+}
+
+// Entries with the fields, and field sizes, of a typical list
+static ServerEntries MakeServerEntries(std::mt19937& random, size_t count)
+{
+    static const char* const REGIONS[] = { "CA", "DE", "FR", "GB", "JP", "NL", "SG", "US" };
+    const vector<string> capabilities = { "handshake", "SSH", "OSSH", "FRONTED-MEEK", "UNFRONTED-MEEK" };
+
+    ServerEntries entries;
+    entries.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        char address[16];
+        sprintf_s(address, "10.%d.%d.%d", (int)((i >> 16) & 0xFF), (int)((i >> 8) & 0xFF), (int)(i & 0xFF));
+
+        entries.push_back(ServerEntry(
+            address, REGIONS[i % _countof(REGIONS)], 8000 + (int)(i % 1000),
+            RandomHex(random, 32), RandomHex(random, 700),
+            22, RandomHex(random, 32), RandomHex(random, 32),
+            RandomBase64(random, 279), 443,
+            RandomHex(random, 32),
+            RandomHex(random, 32), 443,
+            RandomBase64(random, 32),
+            "fronting.example.com", "host.example.com",
+            "",
+            vector<string>(),
+            capabilities));
+    }
+    return entries;
+}
+
+// Info notices, with a BytesTransferred every few lines, as the core writes
+// them while connected.
+static vector<string> MakeNotices(std::mt19937& random, size_t count)
+{
+    vector<string> notices;
+    notices.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        char notice[512];
+        if (i % 5 == 0)
+        {
+            sprintf_s(
+                notice,
+                "{\"data\":{\"diagnosticID\":\"%s\",\"received\":%u,\"sent\":%u},\"noticeType\":\"BytesTransferred\",\"showUser\":false,\"timestamp\":\"2026-01-01T00:00:%02u.000Z\"}",
+                RandomHex(random, 4).c_str(), (unsigned int)(random() % 100000), (unsigned int)(random() % 10000), (unsigned int)(i % 60));
+        }
+        else
+        {
+            sprintf_s(
+                notice,
+                "{\"data\":{\"message\":\"establishTunnelWorker: dial %s failed: %s\"},\"noticeType\":\"Info\",\"showUser\":false,\"timestamp\":\"2026-01-01T00:00:%02u.000Z\"}",
+                RandomHex(random, 8).c_str(), RandomHex(random, 24).c_str(), (unsigned int)(i % 60));
+        }
+        notices.push_back(notice);
+    }
+    return notices;
+}
+
+// Page views and byte counts, as Polipo writes them
+static string MakePolipoStats(std::mt19937& random, size_t count)
+{
+    string stats;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i % 4 == 0)
+        {
+            stats += "PSIPHON-BYTES-TRANSFERRED:>>" + std::to_string(random() % 100000) + "<<\n";
+        }
+        else if (i % 4 == 1)
+        {
+            stats += "PSIPHON-PAGE-VIEW-HTTPS:>>www" + std::to_string(random() % 200) + ".example.com<<\n";
+        }
+        else
+        {
+            stats += "PSIPHON-PAGE-VIEW-HTTP:>>http://www" + std::to_string(random() % 200)
+                + ".example.com/" + RandomHex(random, 16) + "/index.html<<\n";
+        }
+    }
+    return stats;
+}
+
+// A package as psi_ops_server_entry_auth.py makes them, signed with a new
+// key. The key's public half, in the form embedded in the client, is
+// returned in o_publicKey.
+static bool MakeSignedDataPackage(const string& data, string& o_publicKey, string& o_package)
+{
+    try
+    {
+        CryptoPP::AutoSeededRandomPool rng;
+
+        CryptoPP::RSASS<CryptoPP::PKCS1v15, CryptoPP::SHA256>::Signer signer;
+        signer.AccessKey().GenerateRandomWithKeySize(rng, MICROBENCHMARK_SIGNING_KEY_BITS);
+
+        o_publicKey.clear();
+        CryptoPP::RSA::PublicKey publicKey(signer.GetKey());
+        CryptoPP::Base64Encoder publicKeyEncoder(new CryptoPP::StringSink(o_publicKey), false);
+        publicKey.DEREncode(publicKeyEncoder);
+        publicKeyEncoder.MessageEnd();
+
+        string publicKeyDigest;
+        CryptoPP::SHA256 hash;
+        CryptoPP::StringSource(
+            o_publicKey,
+            true,
+            new CryptoPP::HashFilter(hash,
+                new CryptoPP::Base64Encoder(new CryptoPP::StringSink(publicKeyDigest), false)));
+
+        string signature;
+        CryptoPP::StringSource(
+            data,
+            true,
+            new CryptoPP::SignerFilter(rng, signer,
+                new CryptoPP::Base64Encoder(new CryptoPP::StringSink(signature), false)));
+
+        Json::Value json;
+        json["data"] = data;
+        json["signature"] = signature;
+        json["signingPublicKeyDigest"] = publicKeyDigest;
+        Json::FastWriter jsonWriter;
+        string jsonString = jsonWriter.write(json);
+
+        o_package.clear();
+        CryptoPP::Gzip gzip(new CryptoPP::StringSink(o_package));
+        gzip.Put((const byte*)jsonString.data(), jsonString.length());
+        gzip.MessageEnd();
+    }
+    catch (const CryptoPP::Exception& e)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: Crypto++ exception: %S"), __TFUNCTION__, e.what());
+        return false;
+    }
+
+    return true;
+}
+
+// Text in a few scripts, as in the UI strings and server messages
+static string MakeUTF8Text(size_t length)
+{
+    // ASCII, Cyrillic (2-byte) and CJK (3-byte)
+    static const char SAMPLE[] = "Psiphon \xd0\x9f\xd1\x81\xd0\xb8\xd1\x84\xd0\xbe\xd0\xbd \xe8\xb5\x9b\xe9\xa3\x8e ";
+
+    string text;
+    text.reserve(length + sizeof(SAMPLE));
+    while (text.length() < length)
+    {
+        text += SAMPLE;
+    }
+    return text;
+}
+
+
+/***********************************************************************
+ Microbenchmarks
+ */
+
+// Runs operation once to warm up, then repeatedly until it's run for long
+// enough. prepare, if given, is run before each run of operation, untimed;
+// it's for undoing what the operation caches.
+static Microbenchmarks::Result Measure(
+    const StopInfo& stopInfo,
+    const char* name,
+    size_t items,
+    size_t bytes,
+    std::function<void()> prepare,
+    std::function<void()> operation)
+{
+    Microbenchmarks::Result result;
+    result.name = name;
+    result.items = items;
+    result.bytes = bytes;
+
+    if (prepare)
+    {
+        prepare();
+    }
+    operation();
+
+    while (result.iterations < MICROBENCHMARK_MIN_ITERATIONS
+           || result.totalMicroseconds < MICROBENCHMARK_MIN_DURATION_MS * 1000ULL)
+    {
+        stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+        if (prepare)
+        {
+            prepare();
+        }
+
+        unsigned long long start = MonotonicMicroseconds();
+        operation();
+        result.totalMicroseconds += MonotonicMicroseconds() - start;
+        result.iterations++;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %S: %u iterations in %llu us"), __TFUNCTION__, name, result.iterations, result.totalMicroseconds);
+
+    return result;
+}
+
+// static
+void Microbenchmarks::Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult)
+{
+    std::mt19937 random(MICROBENCHMARK_RANDOM_SEED);
+
+    //
+    // Server entries
+    //
+
+    ServerEntries entries = MakeServerEntries(random, MICROBENCHMARK_SERVER_ENTRY_COUNT);
+
+    // ToString keeps what it makes with the entry (and its copies), so the
+    // entries are reset before each run; SetCapabilities drops it.
+    auto resetEntries = [&entries]
+    {
+        for (auto& entry : entries)
+        {
+            vector<string> capabilities = entry.capabilities;
+            entry.SetCapabilities(capabilities);
+        }
+    };
+
+    size_t serializedBytes = 0;
+    Result toString = Measure(stopInfo, "ServerEntry::ToString", entries.size(), 0, resetEntries, [&]
+    {
+        serializedBytes = 0;
+        for (const auto& entry : entries)
+        {
+            serializedBytes += entry.ToString().length();
+        }
+    });
+    toString.bytes = serializedBytes;
+    onResult(toString);
+
+    vector<string> serialized;
+    serialized.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        serialized.push_back(entry.ToString());
+    }
+
+    ServerEntries parsed(entries.size());
+    onResult(Measure(stopInfo, "ServerEntry::FromString", serialized.size(), serializedBytes, nullptr, [&]
+    {
+        for (size_t i = 0; i < serialized.size(); i++)
+        {
+            parsed[i].FromString(serialized[i].data(), serialized[i].length());
+        }
+    }));
+
+    string encoded;
+    Result encode = Measure(stopInfo, "ServerList::EncodeServerEntries", entries.size(), 0, resetEntries, [&]
+    {
+        encoded = ServerList::EncodeServerEntries(entries);
+    });
+    encode.bytes = encoded.length();
+    onResult(encode);
+
+    onResult(Measure(stopInfo, "ServerList::ParseServerEntries", entries.size(), encoded.length(), nullptr, [&]
+    {
+        parsed = ServerList::ParseServerEntries(encoded.c_str());
+    }));
+
+    vector<string> hexEntries;
+    hexEntries.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        hexEntries.push_back(entry.ToHexString());
+    }
+
+    onResult(Measure(stopInfo, "ServerList::ParseServerEntries (parallel)", hexEntries.size(), encoded.length(), nullptr, [&]
+    {
+        parsed = ServerList::ParseServerEntries(hexEntries);
+    }));
+
+    //
+    // Core notices
+    //
+
+    {
+        vector<string> notices = MakeNotices(random, MICROBENCHMARK_NOTICE_COUNT);
+        size_t noticeBytes = 0;
+        for (const auto& notice : notices)
+        {
+            noticeBytes += notice.length() + 1;
+        }
+
+        // Never started; only its notice handling is used.
+        CoreTransport coreTransport;
+        onResult(Measure(stopInfo, "CoreTransport::HandleCoreProcessOutputLine", notices.size(), noticeBytes, nullptr, [&]
+        {
+            for (const auto& notice : notices)
+            {
+                coreTransport.HandleCoreProcessOutputLine(notice.c_str());
+            }
+        }));
+    }
+
+    //
+    // Polipo stats
+    //
+
+    {
+        string stats = MakePolipoStats(random, MICROBENCHMARK_POLIPO_RECORD_COUNT);
+
+        // Never started, and without a stats collector, so nothing is sent.
+        SystemProxySettings systemProxySettings;
+        LocalProxy localProxy(NULL, "", &systemProxySettings, 0, _T(""));
+        onResult(Measure(stopInfo, "LocalProxy::ParsePolipoStatsBuffer", MICROBENCHMARK_POLIPO_RECORD_COUNT, stats.length(), nullptr, [&]
+        {
+            for (size_t offset = 0; offset < stats.length(); offset += MICROBENCHMARK_POLIPO_READ_BYTES)
+            {
+                localProxy.ParsePolipoStatsBuffer(
+                    stats.data() + offset,
+                    min((size_t)MICROBENCHMARK_POLIPO_READ_BYTES, stats.length() - offset));
+            }
+        }));
+    }
+
+    //
+    // Signed data packages
+    //
+
+    {
+        ServerEntries packageEntries(entries.begin(), entries.begin() + min(entries.size(), (size_t)MICROBENCHMARK_PACKAGE_ENTRY_COUNT));
+        string data = ServerList::EncodeServerEntries(packageEntries);
+
+        string publicKey;
+        string package;
+        if (MakeSignedDataPackage(data, publicKey, package))
+        {
+            string authenticData;
+            onResult(Measure(stopInfo, "verifySignedDataPackage", 1, package.length(), nullptr, [&]
+            {
+                if (!verifySignedDataPackage(publicKey.c_str(), package.data(), package.length(), true, authenticData))
+                {
+                    my_print(NOT_SENSITIVE, false, _T("%s: verifySignedDataPackage failed"), __TFUNCTION__);
+                }
+            }));
+        }
+    }
+
+    //
+    // Codecs
+    //
+
+    string bytes = RandomBytes(random, MICROBENCHMARK_CODEC_INPUT_BYTES);
+
+    string hex;
+    onResult(Measure(stopInfo, "Hexlify", 1, bytes.length(), nullptr, [&]
+    {
+        hex = Hexlify((const unsigned char*)bytes.data(), bytes.length());
+    }));
+
+    string dehexed;
+    onResult(Measure(stopInfo, "Dehexlify", 1, hex.length(), nullptr, [&]
+    {
+        Dehexlify(hex.data(), hex.length(), dehexed);
+    }));
+
+    string base64;
+    onResult(Measure(stopInfo, "Base64Encode", 1, bytes.length(), nullptr, [&]
+    {
+        base64 = Base64Encode((const unsigned char*)bytes.data(), bytes.length());
+    }));
+
+    string decoded;
+    onResult(Measure(stopInfo, "Base64Decode", 1, base64.length(), nullptr, [&]
+    {
+        decoded = Base64Decode(base64);
+    }));
+
+    string text = MakeUTF8Text(MICROBENCHMARK_CODEC_INPUT_BYTES);
+    wstring wideText;
+    onResult(Measure(stopInfo, "UTF8ToWString", 1, text.length(), nullptr, [&]
+    {
+        UTF8ToWString(text.data(), text.length(), wideText);
+    }));
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Microbenchmarks of the client's parsing and encoding hot paths, for
+`--headless --microbenchmark` (see headless.h), so that regressions in them
+can be caught before a release.
+
+Each benchmark runs its operation over a synthetic corpus shaped like what
+the client sees in the field -- a 5,000-entry server list, a recorded core
+notice stream, a burst of Polipo stats output, a signed remote server list --
+first once to warm up, then repeatedly until it has run for
+MICROBENCHMARK_MIN_DURATION_MS. Nothing is connected; the corpora are built
+in memory, and nothing is stored.
+*/
+class Microbenchmarks
+{
+public:
+    struct Result
+    {
+        string name;
+        // What one iteration processes
+        size_t items;
+        size_t bytes;
+        unsigned int iterations;
+        unsigned long long totalMicroseconds;
+
+        Result() : items(0), bytes(0), iterations(0), totalMicroseconds(0) {}
+
+        Json::Value ToJson() const;
+    };
+
+    // Runs each benchmark in turn, calling onResult with each result as
+    // it's done. Throws the stop signal.
+    static void Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult);
+};
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "performance_budget.h"
+#include "logging.h"
+#include "utilities.h"
+#include <iomanip>
+
+
+/*
+The budgets. They're what a release build on a modest machine should manage;
+a session over any of them is worth a closer look.
+*/
+struct PerformanceBudgetEntry
+{
+    const char* metric;
+    double budget;
+    const TCHAR* unit;
+};
+
+static const PerformanceBudgetEntry PERFORMANCE_BUDGETS[] =
+{
+    // Process creation to the window being shown, the first start since boot
+    { PERF_METRIC_COLD_START_TO_WINDOW,     3000,                   _T("ms") },
+    // Starting a connection to the tunnel being up
+    { PERF_METRIC_TIME_TO_CONNECTED,        15000,                  _T("ms") },
+    // All tunnels lost to one being back up, without the user doing anything
+    { PERF_METRIC_RECONNECT_TIME,           10000,                  _T("ms") },
+    // Of the UI watchdog's pings, per summary interval
+    { PERF_METRIC_UI_DISPATCH_P99,          100,                    _T("ms") },
+    { PERF_METRIC_PRIVATE_BYTES_AFTER_1H,   150.0 * 1024 * 1024,    _T("B") },
+    // The diagnostic history and the message history, in memory
+    { PERF_METRIC_LOG_DIAGNOSTIC_MEMORY,    8.0 * 1024 * 1024,      _T("B") },
+};
+
+#define PERFORMANCE_BUDGET_COUNT    (sizeof(PERFORMANCE_BUDGETS) / sizeof(PERFORMANCE_BUDGETS[0]))
+
+struct PerformanceBudgetState
+{
+    unsigned int samples;
+    double worst;
+    bool overBudgetLogged;
+};
+
+static Lock g_performanceBudgetLock("PerformanceBudget");
+// Parallel to PERFORMANCE_BUDGETS
+static PerformanceBudgetState g_performanceBudgetStates[PERFORMANCE_BUDGET_COUNT];
+
+
+// static
+void PerformanceBudget::Record(const char* metric, double value)
+{
+    size_t i = 0;
+    while (i < PERFORMANCE_BUDGET_COUNT && strcmp(PERFORMANCE_BUDGETS[i].metric, metric) != 0)
+    {
+        i++;
+    }
+    if (i == PERFORMANCE_BUDGET_COUNT)
+    {
+        return;
+    }
+
+    const PerformanceBudgetEntry& entry = PERFORMANCE_BUDGETS[i];
+    bool logOverBudget = false;
+
+    {
+        AutoLock lock(g_performanceBudgetLock);
+
+        PerformanceBudgetState& state = g_performanceBudgetStates[i];
+        if (state.samples == 0 || value > state.worst)
+        {
+            state.worst = value;
+        }
+        state.samples++;
+
+        if (value > entry.budget && !state.overBudgetLogged)
+        {
+            state.overBudgetLogged = true;
+            logOverBudget = true;
+        }
+    }
+
+    if (logOverBudget)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: %S over budget: %.0f %s (budget %.0f %s)"),
+            __TFUNCTION__, metric, value, entry.unit, entry.budget, entry.unit);
+    }
+}
+
+// static
+Json::Value PerformanceBudget::Evaluate()
+{
+    Json::Value summary(Json::objectValue);
+    Json::Value failed(Json::arrayValue);
+    Json::Value metrics(Json::objectValue);
+
+    {
+        AutoLock lock(g_performanceBudgetLock);
+
+        for (size_t i = 0; i < PERFORMANCE_BUDGET_COUNT; i++)
+        {
+            const PerformanceBudgetEntry& entry = PERFORMANCE_BUDGETS[i];
+            const PerformanceBudgetState& state = g_performanceBudgetStates[i];
+
+            Json::Value metric;
+            metric["budget"] = entry.budget;
+            metric["samples"] = state.samples;
+            if (state.samples > 0)
+            {
+                metric["worst"] = state.worst;
+                if (state.worst > entry.budget)
+                {
+                    failed.append(entry.metric);
+                }
+            }
+            metrics[entry.metric] = metric;
+        }
+    }
+
+#ifdef _DEBUG
+    summary["build"] = "debug";
+#else
+    summary["build"] = "release";
+#endif
+    summary["pass"] = failed.empty();
+    summary["failed"] = failed;
+    summary["metrics"] = metrics;
+    return summary;
+}
+
+// static
+Json::Value PerformanceBudget::Report()
+{
+    Json::Value summary = Evaluate();
+
+    // e.g., "FAIL: UIDispatchP99=250/100ms FAIL, TimeToConnected=4210/15000ms, ReconnectTime=-"
+    tstringstream line;
+    line << (summary["pass"].asBool() ? _T("PASS") : _T("FAIL"));
+    for (size_t i = 0; i < PERFORMANCE_BUDGET_COUNT; i++)
+    {
+        const PerformanceBudgetEntry& entry = PERFORMANCE_BUDGETS[i];
+        const Json::Value& metric = summary["metrics"][entry.metric];
+
+        line << (i == 0 ? _T(": ") : _T(", ")) << UTF8ToWString(entry.metric) << _T("=");
+        if (metric["samples"].asUInt() == 0)
+        {
+            line << _T("-");
+            continue;
+        }
+
+        double worst = metric["worst"].asDouble();
+        line << std::fixed << std::setprecision(0) << worst << _T("/") << entry.budget << entry.unit;
+        if (worst > entry.budget)
+        {
+            line << _T(" FAIL");
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %s (%S build)"),
+        __TFUNCTION__, line.str().c_str(), summary["build"].asString().c_str());
+
+    return summary;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+// The metrics with budgets. Times are in milliseconds, sizes in bytes.
+#define PERF_METRIC_COLD_START_TO_WINDOW    "ColdStartToWindow"
+#define PERF_METRIC_TIME_TO_CONNECTED       "TimeToConnected"
+#define PERF_METRIC_RECONNECT_TIME          "ReconnectTime"
+#define PERF_METRIC_UI_DISPATCH_P99         "UIDispatchP99"
+#define PERF_METRIC_PRIVATE_BYTES_AFTER_1H  "PrivateBytesAfter1h"
+#define PERF_METRIC_LOG_DIAGNOSTIC_MEMORY   "LogAndDiagnosticMemory"
+
+
+/*
+Checks what we already measure against the budgets we've set for release
+builds, so that regressions show up in feedback from real users rather than
+only when someone thinks to look.
+
+The modules that take the measurements record them here as they're made;
+the worst of a session's measurements of a metric is what's checked against
+its budget. The first measurement over budget is logged as it happens. Debug
+builds are slower, so their summaries say so and shouldn't be counted.
+
+Threadsafe. Recording is cheap, but it's not meant for hot paths.
+*/
+class PerformanceBudget
+{
+public:
+    // metric must be one of the PERF_METRIC_* names; others are ignored.
+    static void Record(const char* metric, double value);
+
+    // The pass/fail summary: whether every measured metric is within its
+    // budget, which ones aren't, and per metric the budget, the worst
+    // measurement and the number of measurements. Metrics with none yet
+    // count as passing.
+    static Json::Value Evaluate();
+
+    // Writes the summary to the debug log, on one line, and returns it.
+    static Json::Value Report();
+};
@@ -0,0 +1,670 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "proxy_load.h"
+#include <WS2tcpip.h>
+#include "logging.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+// How long each client runs at each concurrency
+#define PROXY_LOAD_DURATION_MS              3000
+#define PROXY_LOAD_SOCKET_TIMEOUT_MS        10000
+// The loopback upstream's response body
+#define PROXY_LOAD_RESPONSE_BYTES           (256*1024)
+#define PROXY_LOAD_BUFFER_SIZE              16384
+// Bounds a response head, or a proxy's reply to CONNECT
+#define PROXY_LOAD_MAX_HEAD_BYTES           8192
+// A proxy that refuses connections fails fast; this keeps the failures
+// from crowding out a busy one.
+#define PROXY_LOAD_FAILURE_BACKOFF_MS       10
+
+static const size_t PROXY_LOAD_CONCURRENCY[] = { 1, 8, 32 };
+
+enum ProxyLoadClient
+{
+    PROXY_LOAD_CLIENT_HTTP,
+    PROXY_LOAD_CLIENT_CONNECT,
+    PROXY_LOAD_CLIENT_SOCKS
+};
+
+static const char* ClientName(ProxyLoadClient client)
+{
+    switch (client)
+    {
+    case PROXY_LOAD_CLIENT_HTTP:        return "http";
+    case PROXY_LOAD_CLIENT_CONNECT:     return "connect";
+    }
+    return "socks";
+}
+
+
+/***********************************************************************
+ Result
+ */
+
+Json::Value ProxyLoad::Result::ToJson() const
+{
+    double seconds = totalMicroseconds / 1000000.0;
+    double megabytes = bytes / (1024.0 * 1024.0);
+
+    Json::Value json;
+    json["client"] = client;
+    json["concurrency"] = (Json::UInt)concurrency;
+    json["requests"] = (Json::UInt64)requests;
+    json["failures"] = (Json::UInt64)failures;
+    json["bytes"] = (Json::UInt64)bytes;
+    json["totalMicroseconds"] = (Json::UInt64)totalMicroseconds;
+    json["requestsPerSecond"] = seconds > 0 ? requests / seconds : 0.0;
+    json["megabytesPerSecond"] = seconds > 0 ? megabytes / seconds : 0.0;
+    json["setupP50Microseconds"] = (Json::UInt64)setupP50Microseconds;
+    json["setupP99Microseconds"] = (Json::UInt64)setupP99Microseconds;
+    json["cpuMillisecondsPerMegabyte"] = megabytes > 0 ? cpuMicroseconds / 1000.0 / megabytes : 0.0;
+    return json;
+}
+
+
+/***********************************************************************
+ Sockets
+ */
+
+static bool SendAll(SOCKET s, const char* data, size_t length)
+{
+    while (length > 0)
+    {
+        int sent = send(s, data, (int)min(length, (size_t)PROXY_LOAD_BUFFER_SIZE), 0);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+static bool ReceiveExactly(SOCKET s, char* data, int length)
+{
+    while (length > 0)
+    {
+        int received = recv(s, data, length, 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+        data += received;
+        length -= received;
+    }
+    return true;
+}
+
+// Reads until o_head ends with a blank line. Only for heads that aren't
+// followed by anything until the peer is sent more.
+static bool ReceiveHead(SOCKET s, string& o_head)
+{
+    o_head.clear();
+
+    char buffer[512];
+    while (o_head.length() < PROXY_LOAD_MAX_HEAD_BYTES)
+    {
+        int received = recv(s, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+        o_head.append(buffer, received);
+
+        if (o_head.find("\r\n\r\n") != string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void SetSocketTimeouts(SOCKET s)
+{
+    DWORD timeout = PROXY_LOAD_SOCKET_TIMEOUT_MS;
+    (void)setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+    (void)setsockopt(s, SOL_SOCKET, SO_SNDTIMEO, (const char*)&timeout, sizeof(timeout));
+}
+
+// INVALID_SOCKET on failure
+static SOCKET ConnectLoopback(int port)
+{
+    SOCKET s = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s == INVALID_SOCKET)
+    {
+        return INVALID_SOCKET;
+    }
+
+    SetSocketTimeouts(s);
+
+    sockaddr_in address;
+    ZeroMemory(&address, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons((USHORT)port);
+
+    if (0 != connect(s, (sockaddr*)&address, sizeof(address)))
+    {
+        closesocket(s);
+        return INVALID_SOCKET;
+    }
+    return s;
+}
+
+// A SOCKS5 connect, without authentication, by name
+static bool SocksConnect(SOCKET s, const string& host, int port)
+{
+    static const char GREETING[] = { 5, 1, 0 };
+    char choice[2];
+    if (!SendAll(s, GREETING, sizeof(GREETING))
+        || !ReceiveExactly(s, choice, sizeof(choice))
+        || choice[0] != 5 || choice[1] != 0)
+    {
+        return false;
+    }
+
+    string request("\x05\x01\x00\x03", 4);
+    request += (char)host.length();
+    request += host;
+    request += (char)((port >> 8) & 0xFF);
+    request += (char)(port & 0xFF);
+
+    char reply[4];
+    if (!SendAll(s, request.data(), request.length())
+        || !ReceiveExactly(s, reply, sizeof(reply))
+        || reply[0] != 5 || reply[1] != 0)
+    {
+        return false;
+    }
+
+    // The bound address and port, which aren't needed
+    int boundLength = 0;
+    if (reply[3] == 1)
+    {
+        boundLength = 4;
+    }
+    else if (reply[3] == 4)
+    {
+        boundLength = 16;
+    }
+    else if (reply[3] == 3)
+    {
+        unsigned char nameLength = 0;
+        if (!ReceiveExactly(s, (char*)&nameLength, 1))
+        {
+            return false;
+        }
+        boundLength = nameLength;
+    }
+    else
+    {
+        return false;
+    }
+
+    char bound[255 + 2];
+    return ReceiveExactly(s, bound, boundLength + 2);
+}
+
+static unsigned long long ProcessCpuMicroseconds()
+{
+    FILETIME creation, exitTime, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel, &user))
+    {
+        return 0;
+    }
+
+    ULARGE_INTEGER kernelTime, userTime;
+    kernelTime.LowPart = kernel.dwLowDateTime;
+    kernelTime.HighPart = kernel.dwHighDateTime;
+    userTime.LowPart = user.dwLowDateTime;
+    userTime.HighPart = user.dwHighDateTime;
+    return (kernelTime.QuadPart + userTime.QuadPart) / 10;
+}
+
+
+/***********************************************************************
+ LoopbackUpstream
+ */
+
+// Answers every request, one per connection, with the same response, and
+// closes the connection. A thread per connection is plenty for the
+// concurrencies run.
+class LoopbackUpstream
+{
+public:
+    LoopbackUpstream() : m_listenSocket(INVALID_SOCKET), m_acceptThread(NULL), m_port(0), m_responseThreads(0) {}
+    ~LoopbackUpstream() { Stop(); }
+
+    // Listens on an ephemeral loopback port
+    bool Start();
+    void Stop();
+
+    int GetPort() const { return m_port; }
+
+private:
+    struct Connection
+    {
+        LoopbackUpstream* upstream;
+        SOCKET socket;
+    };
+
+    static DWORD WINAPI AcceptThread(void* object);
+    static DWORD WINAPI ResponseThread(void* object);
+
+    SOCKET m_listenSocket;
+    HANDLE m_acceptThread;
+    int m_port;
+    string m_response;
+    volatile LONG m_responseThreads;
+};
+
+bool LoopbackUpstream::Start()
+{
+    m_response = "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nConnection: close\r\nContent-Length: ";
+    m_response += std::to_string(PROXY_LOAD_RESPONSE_BYTES);
+    m_response += "\r\n\r\n";
+    m_response.append(PROXY_LOAD_RESPONSE_BYTES, 'x');
+
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (m_listenSocket == INVALID_SOCKET)
+    {
+        return false;
+    }
+
+    sockaddr_in address;
+    ZeroMemory(&address, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    int addressLength = sizeof(address);
+
+    if (0 != bind(m_listenSocket, (sockaddr*)&address, sizeof(address))
+        || 0 != listen(m_listenSocket, SOMAXCONN)
+        || 0 != getsockname(m_listenSocket, (sockaddr*)&address, &addressLength))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: failed to listen (%d)"), __TFUNCTION__, WSAGetLastError());
+        Stop();
+        return false;
+    }
+    m_port = ntohs(address.sin_port);
+
+    m_acceptThread = CreateThread(0, 0, AcceptThread, this, 0, 0);
+    if (!m_acceptThread)
+    {
+        Stop();
+        return false;
+    }
+
+    return true;
+}
+
+void LoopbackUpstream::Stop()
+{
+    // Fails the pending accept, which ends the thread
+    if (m_listenSocket != INVALID_SOCKET)
+    {
+        closesocket(m_listenSocket);
+        m_listenSocket = INVALID_SOCKET;
+    }
+
+    if (m_acceptThread)
+    {
+        WaitForSingleObject(m_acceptThread, INFINITE);
+        CloseHandle(m_acceptThread);
+        m_acceptThread = NULL;
+    }
+
+    // The sockets time out, so these end too.
+    while (InterlockedCompareExchange(&m_responseThreads, 0, 0) != 0)
+    {
+        Sleep(10);
+    }
+}
+
+// static
+DWORD WINAPI LoopbackUpstream::AcceptThread(void* object)
+{
+    LoopbackUpstream* upstream = (LoopbackUpstream*)object;
+
+    for (;;)
+    {
+        SOCKET s = accept(upstream->m_listenSocket, NULL, NULL);
+        if (s == INVALID_SOCKET)
+        {
+            break;
+        }
+        SetSocketTimeouts(s);
+
+        Connection* connection = new Connection();
+        connection->upstream = upstream;
+        connection->socket = s;
+
+        InterlockedIncrement(&upstream->m_responseThreads);
+        HANDLE thread = CreateThread(0, 0, ResponseThread, connection, 0, 0);
+        if (!thread)
+        {
+            InterlockedDecrement(&upstream->m_responseThreads);
+            closesocket(s);
+            delete connection;
+            continue;
+        }
+        CloseHandle(thread);
+    }
+
+    return 0;
+}
+
+// static
+DWORD WINAPI LoopbackUpstream::ResponseThread(void* object)
+{
+    Connection* connection = (Connection*)object;
+    LoopbackUpstream* upstream = connection->upstream;
+    SOCKET s = connection->socket;
+    delete connection;
+
+    string head;
+    if (ReceiveHead(s, head))
+    {
+        if (SendAll(s, upstream->m_response.data(), upstream->m_response.length()))
+        {
+            (void)shutdown(s, SD_SEND);
+        }
+    }
+    closesocket(s);
+
+    InterlockedDecrement(&upstream->m_responseThreads);
+    return 0;
+}
+
+
+/***********************************************************************
+ Clients
+ */
+
+struct ProxyLoadClientContext
+{
+    ProxyLoadClient client;
+    int proxyPort;
+    string upstreamHostPort;
+    unsigned long long deadline;
+    const StopInfo* stopInfo;
+    HANDLE go;
+
+    unsigned long long requests;
+    unsigned long long failures;
+    unsigned long long bytes;
+    vector<unsigned long long> setupMicroseconds;
+
+    ProxyLoadClientContext()
+        : client(PROXY_LOAD_CLIENT_HTTP), proxyPort(0), deadline(0), stopInfo(NULL), go(NULL),
+          requests(0), failures(0), bytes(0) {}
+};
+
+// One request, on its own connection to the proxy. Returns false if it
+// failed at any point.
+static bool MakeRequest(
+                const ProxyLoadClientContext& context,
+                unsigned long long& o_setupMicroseconds,
+                unsigned long long& o_bytes)
+{
+    unsigned long long start = MonotonicMicroseconds();
+
+    SOCKET s = ConnectLoopback(context.proxyPort);
+    if (s == INVALID_SOCKET)
+    {
+        return false;
+    }
+    auto closeSocket = finally([s] { closesocket(s); });
+
+    const string& hostPort = context.upstreamHostPort;
+    string request;
+
+    if (context.client == PROXY_LOAD_CLIENT_HTTP)
+    {
+        request = "GET http://" + hostPort + "/ HTTP/1.1\r\nHost: " + hostPort + "\r\nConnection: close\r\n\r\n";
+    }
+    else
+    {
+        if (context.client == PROXY_LOAD_CLIENT_CONNECT)
+        {
+            string connect = "CONNECT " + hostPort + " HTTP/1.1\r\nHost: " + hostPort + "\r\n\r\n";
+            string reply;
+            // e.g., "HTTP/1.1 200 Connection established"
+            if (!SendAll(s, connect.data(), connect.length())
+                || !ReceiveHead(s, reply)
+                || reply.length() < 12
+                || reply.compare(9, 3, "200") != 0)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            size_t colon = hostPort.rfind(':');
+            if (!SocksConnect(s, hostPort.substr(0, colon), atoi(hostPort.c_str() + colon + 1)))
+            {
+                return false;
+            }
+        }
+        o_setupMicroseconds = MonotonicMicroseconds() - start;
+
+        request = "GET / HTTP/1.1\r\nHost: " + hostPort + "\r\nConnection: close\r\n\r\n";
+    }
+
+    if (!SendAll(s, request.data(), request.length()))
+    {
+        return false;
+    }
+
+    // The whole response, to the close
+    char buffer[PROXY_LOAD_BUFFER_SIZE];
+    o_bytes = 0;
+    for (;;)
+    {
+        int received = recv(s, buffer, sizeof(buffer), 0);
+        if (received < 0)
+        {
+            return false;
+        }
+        if (received == 0)
+        {
+            break;
+        }
+        if (o_bytes == 0 && context.client == PROXY_LOAD_CLIENT_HTTP)
+        {
+            o_setupMicroseconds = MonotonicMicroseconds() - start;
+        }
+        o_bytes += received;
+    }
+
+    return o_bytes > 0;
+}
+
+static DWORD WINAPI ClientThread(void* object)
+{
+    ProxyLoadClientContext* context = (ProxyLoadClientContext*)object;
+
+    WaitForSingleObject(context->go, INFINITE);
+
+    while (MonotonicMilliseconds() < context->deadline
+           && !context->stopInfo->stopSignal->CheckSignal(context->stopInfo->stopReasons))
+    {
+        unsigned long long setupMicroseconds = 0, bytes = 0;
+        if (MakeRequest(*context, setupMicroseconds, bytes))
+        {
+            context->requests++;
+            context->bytes += bytes;
+            context->setupMicroseconds.push_back(setupMicroseconds);
+        }
+        else
+        {
+            context->failures++;
+            Sleep(PROXY_LOAD_FAILURE_BACKOFF_MS);
+        }
+    }
+
+    return 0;
+}
+
+// concurrency clients, each making request after request, for
+// PROXY_LOAD_DURATION_MS. Throws std::exception if the threads can't be made.
+static ProxyLoad::Result RunClients(
+                            const StopInfo& stopInfo,
+                            ProxyLoadClient client,
+                            int proxyPort,
+                            const string& upstreamHostPort,
+                            size_t concurrency)
+{
+    HANDLE go = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!go)
+    {
+        throw std::exception("ProxyLoad: CreateEvent failed");
+    }
+    auto closeGo = finally([go] { CloseHandle(go); });
+
+    vector<ProxyLoadClientContext> contexts(concurrency);
+    vector<HANDLE> threads;
+    for (auto& context : contexts)
+    {
+        context.client = client;
+        context.proxyPort = proxyPort;
+        context.upstreamHostPort = upstreamHostPort;
+        context.stopInfo = &stopInfo;
+        context.go = go;
+
+        HANDLE thread = CreateThread(0, 0, ClientThread, &context, 0, 0);
+        if (!thread)
+        {
+            break;
+        }
+        threads.push_back(thread);
+    }
+
+    unsigned long long cpuStart = ProcessCpuMicroseconds();
+    unsigned long long start = MonotonicMicroseconds();
+    unsigned long long deadline = MonotonicMilliseconds() + PROXY_LOAD_DURATION_MS;
+
+    // The threads wait for go, so they all start together, with the deadline.
+    for (auto& context : contexts)
+    {
+        context.deadline = deadline;
+    }
+    SetEvent(go);
+
+    if (!threads.empty())
+    {
+        WaitForMultipleObjects((DWORD)threads.size(), &threads[0], TRUE, INFINITE);
+    }
+    for (auto thread : threads)
+    {
+        CloseHandle(thread);
+    }
+
+    // The threads have stopped, so all of the results are in.
+    if (threads.size() < concurrency)
+    {
+        throw std::exception("ProxyLoad: CreateThread failed");
+    }
+
+    ProxyLoad::Result result;
+    result.client = ClientName(client);
+    result.concurrency = concurrency;
+    result.totalMicroseconds = MonotonicMicroseconds() - start;
+    result.cpuMicroseconds = ProcessCpuMicroseconds() - cpuStart;
+
+    vector<unsigned long long> setupMicroseconds;
+    for (const auto& context : contexts)
+    {
+        result.requests += context.requests;
+        result.failures += context.failures;
+        result.bytes += context.bytes;
+        setupMicroseconds.insert(setupMicroseconds.end(), context.setupMicroseconds.begin(), context.setupMicroseconds.end());
+    }
+
+    if (!setupMicroseconds.empty())
+    {
+        std::sort(setupMicroseconds.begin(), setupMicroseconds.end());
+        result.setupP50Microseconds = setupMicroseconds[(setupMicroseconds.size() - 1) * 50 / 100];
+        result.setupP99Microseconds = setupMicroseconds[(setupMicroseconds.size() - 1) * 99 / 100];
+    }
+
+    return result;
+}
+
+
+/***********************************************************************
+ ProxyLoad
+ */
+
+// static
+void ProxyLoad::Run(const StopInfo& stopInfo, const Target& target, std::function<void(const Result&)> onResult)
+{
+    WSADATA wsaData;
+    if (0 != WSAStartup(MAKEWORD(2, 2), &wsaData))
+    {
+        throw std::exception("ProxyLoad: WSAStartup failed");
+    }
+    auto wsaCleanup = finally([] { WSACleanup(); });
+
+    LoopbackUpstream upstream;
+    string upstreamHostPort;
+    if (target.upstreamHost.empty())
+    {
+        if (!upstream.Start())
+        {
+            throw std::exception("ProxyLoad: the loopback upstream failed to start");
+        }
+        upstreamHostPort = "127.0.0.1:" + std::to_string(upstream.GetPort());
+    }
+    else
+    {
+        upstreamHostPort = target.upstreamHost + ":" + std::to_string(target.upstreamPort);
+    }
+
+    const ProxyLoadClient clients[] = { PROXY_LOAD_CLIENT_HTTP, PROXY_LOAD_CLIENT_CONNECT, PROXY_LOAD_CLIENT_SOCKS };
+
+    for (auto client : clients)
+    {
+        int proxyPort = client == PROXY_LOAD_CLIENT_SOCKS ? target.socksProxyPort : target.httpProxyPort;
+        if (proxyPort == 0)
+        {
+            continue;
+        }
+
+        for (auto concurrency : PROXY_LOAD_CONCURRENCY)
+        {
+            stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+            Result result = RunClients(stopInfo, client, proxyPort, upstreamHostPort, concurrency);
+
+            my_print(NOT_SENSITIVE, true, _T("%s: %S x%d: %llu requests, %llu failures"), __TFUNCTION__,
+                result.client.c_str(), (int)concurrency, result.requests, result.failures);
+
+            onResult(result);
+        }
+    }
+
+    stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Load runs against a connected session's local proxy ports, for
+`--headless --proxy-load` (see headless.h), so that the Polipo path, the
+in-process proxy and the core's own listeners can be compared on the same
+hardware: concurrent plain HTTP, CONNECT and SOCKS clients each make
+request after request, one connection each, for a few seconds at a time.
+
+By default the requests go to a loopback upstream started for the run,
+which answers every request with the same response. It's only reachable
+through a proxy that connects directly -- Polipo or the in-process proxy,
+in VPN mode; through the core, the requests must go to an HTTP server
+reachable through the tunnel, given as the upstream.
+
+The CPU time is this process's, which includes the in-process proxy's, but
+not Polipo's or the core's.
+*/
+class ProxyLoad
+{
+public:
+    struct Target
+    {
+        // 0 to skip the clients that use the port
+        int httpProxyPort;
+        int socksProxyPort;
+        // Empty for the loopback upstream
+        string upstreamHost;
+        int upstreamPort;
+
+        Target() : httpProxyPort(0), socksProxyPort(0), upstreamPort(0) {}
+    };
+
+    struct Result
+    {
+        // "http", "connect" or "socks"
+        string client;
+        size_t concurrency;
+        unsigned long long requests;
+        unsigned long long failures;
+        // Response bytes received, headers included
+        unsigned long long bytes;
+        unsigned long long totalMicroseconds;
+        // Connecting to the proxy until it's ready to relay (CONNECT and
+        // SOCKS), or until the first response byte (plain HTTP)
+        unsigned long long setupP50Microseconds;
+        unsigned long long setupP99Microseconds;
+        unsigned long long cpuMicroseconds;
+
+        Result()
+            : concurrency(0), requests(0), failures(0), bytes(0), totalMicroseconds(0),
+              setupP50Microseconds(0), setupP99Microseconds(0), cpuMicroseconds(0) {}
+
+        // With the requests/s, MB/s and CPU milliseconds per MB
+        Json::Value ToJson() const;
+    };
+
+    // Runs each client, at each concurrency, in turn, calling onResult with
+    // each result as it's done. Throws the stop signal, and std::exception if
+    // the upstream or the threads can't be started.
+    static void Run(const StopInfo& stopInfo, const Target& target, std::function<void(const Result&)> onResult);
+};
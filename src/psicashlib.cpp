@@ -14,21 +14,29 @@ namespace psicash {
 static constexpr bool TESTING = false;
 static constexpr auto USER_AGENT = "Psiphon-PsiCash-Windows";
 
+enum class RequestType : int {
+    RefreshState,
+    NewExpiringPurchase,
+    Count
+};
+
 psicash::MakeHTTPRequestFn GetHTTPReqFn(const StopInfo& stopInfo);
 
 Lib::Lib()
-    : m_requestStopInfo(StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL)),
-      m_requestQueue("PsiCash request queue", 1) // we specifically only want one worker, for one request at a time
+    : m_lock("PsiCash"),
+      m_requestStopInfo(StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL)),
+      // One request of each type at a time (the ordering key is the type),
+      // so that a slow refresh doesn't hold up a purchase the user is
+      // waiting on.
+      m_requestQueue("PsiCash request queue", (size_t)RequestType::Count)
 {
-    m_mutex = CreateMutex(nullptr, FALSE, 0);
 }
 
 Lib::~Lib() {
-    CloseHandle(m_mutex);
 }
 
 error::Error Lib::Init(bool forceReset) {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
     tstring dataDir;
     if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY, _T("psicash") }, true, dataDir)) {
@@ -85,21 +93,17 @@ error::Error Lib::UpdateClientRegion(const string& region) {
     return error::nullerr;
 }
 
-enum class RequestType : int {
-    RefreshState,
-    NewExpiringPurchase
-};
-
 void Lib::RefreshState(
     std::function<void(error::Result<Status>)> callback)
 {
-    // Don't queue this if there is already an outstanding RefreshState
-    auto queued = m_requestQueue.dispatch((int)RequestType::RefreshState, { (int)RequestType::RefreshState }, [=] {
+    // If a RefreshState is already queued, there's no need for two. The newest
+    // caller gets the result, as it's the one that wants the freshest state.
+    auto replaced = m_requestQueue.dispatch_replace((int)RequestType::RefreshState, [=] {
         callback(PsiCash::RefreshState({ "speed-boost" }));
     });
 
-    if (!queued) {
-        my_print(NOT_SENSITIVE, true, _T("%s: RefreshState not queued, as another is already queued"), __TFUNCTION__);
+    if (replaced) {
+        my_print(NOT_SENSITIVE, true, _T("%s: replaced already queued RefreshState"), __TFUNCTION__);
     }
 }
 
@@ -109,9 +113,12 @@ void Lib::NewExpiringPurchase(
     const int64_t expectedPrice,
     std::function<void(error::Result<NewExpiringPurchaseResponse>)> callback)
 {
+    // The user is waiting on a purchase, so it goes ahead of any queued
+    // refresh, and doesn't wait for one that's running. Purchases are still
+    // made one at a time, in order.
     (void)m_requestQueue.dispatch((int)RequestType::NewExpiringPurchase, {}, [=] {
         callback(PsiCash::NewExpiringPurchase(transactionClass, distinguisher, expectedPrice));
-    });
+    }, dispatch_queue::priority::interactive);
 }
 
 
@@ -122,27 +129,32 @@ psicash::MakeHTTPRequestFn GetHTTPReqFn(const StopInfo& stopInfo) {
 
         my_print(NOT_SENSITIVE, true, _T("%s: PsiCashLib starting request for: %hs"), __TFUNCTION__, params.path.c_str());
 
-        wstringstream requestPath;
-        requestPath << UTF8ToWString(params.path);
-        if (!params.query.empty()) {
-            requestPath << L"?";
-        }
+        // Built in UTF-8 and converted once, rather than field by field.
+        string path = params.path;
         for (size_t i = 0; i < params.query.size(); i++) {
-            auto qp = params.query[i];
-            if (i != 0) {
-                requestPath << "&";
-            }
-            requestPath << UTF8ToWString(qp.first) << L"=" << UTF8ToWString(qp.second);
+            const auto& qp = params.query[i];
+            path += (i == 0) ? '?' : '&';
+            path += qp.first;
+            path += '=';
+            path += qp.second;
         }
-
-        wstringstream headers;
-        for (auto header : params.headers) {
-            headers << UTF8ToWString(header.first) << L": " << UTF8ToWString(header.second) << L"\r\n";
+        wstring requestPath = UTF8ToWString(path);
+
+        string headerLines;
+        for (const auto& header : params.headers) {
+            headerLines += header.first;
+            headerLines += ": ";
+            headerLines += header.second;
+            headerLines += "\r\n";
         }
+        wstring headers = UTF8ToWString(headerLines);
 
         HTTPResult result;
 
+        // Back-to-back calls (e.g., a purchase then a refresh) reuse the
+        // pooled WinHTTP session, and so the connection, from the last one.
         HTTPSRequest httpsRequest(/*silentMode=*/true);
+        httpsRequest.SetMetricsName("psicash");
         HTTPSRequest::Response httpsResponse;
 
         try
@@ -151,12 +163,12 @@ psicash::MakeHTTPRequestFn GetHTTPReqFn(const StopInfo& stopInfo) {
                     UTF8ToWString(params.hostname).c_str(),
                     params.port,
                     "",         // webServerCertificate
-                    requestPath.str().c_str(),
+                    requestPath.c_str(),
                     stopInfo,
                     HTTPSRequest::PsiphonProxy::REQUIRE,
                     httpsResponse,
                     true,       // failoverToURLProxy -- required for old WinXP
-                    headers.str().empty() ? NULL : headers.str().c_str(),
+                    headers.empty() ? NULL : headers.c_str(),
                     NULL,       // additionalData
                     0,          // additionalDataLength
                     UTF8ToWString(params.method).c_str()))
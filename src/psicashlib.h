@@ -56,7 +56,7 @@ protected:
     bool MakeLimitedRequest(std::packaged_task<void()>&& requestTask);
 
 private:
-    HANDLE m_mutex;
+    Lock m_lock;
     const StopInfo m_requestStopInfo;
 
     dispatch_queue m_requestQueue;
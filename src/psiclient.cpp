@@ -39,6 +39,18 @@
 #include "diagnostic_info.h"
 #include "systemproxysettings.h"
 #include "psicashlib.h"
+#include "serverlist.h"
+#include "startup_tasks.h"
+#include "tunnel_metrics.h"
+#include "tracing.h"
+#include "ring_log.h"
+#include "ui_watchdog.h"
+#include "thread_pool.h"
+#include "disk_janitor.h"
+#include "headless.h"
+#include "scripted_core.h"
+#include <unordered_map>
+#include <deque>
 
 //==== Globals ================================================================
 
@@ -61,12 +73,27 @@ static bool g_htmlUiReady = false;
 // The HTML control has a bad habit of sending messages after we've posted WM_QUIT,
 // which leads to a crash on exit.
 static bool g_htmlUiFinished = false;
+// While the window sits in the tray, the HTML control (and the IE engine it
+// hosts) is destroyed after a while, and created again when the window is
+// next shown. Only touched by the main window thread.
+static bool g_htmlUiReleased = false;
+// Lets the control's own initial page load through; see HandleNotify.
+static bool g_htmlCtrlFirstNav = true;
+// The settings the page script last had from us; see HtmlUI_SettingsDelta.
+// Only touched by the main window thread.
+static Json::Value g_publishedSettings;
 
 // Timer IDs
 // Note: Trying to use SetTimer/KillTimer without an explicit ID led to inconsistent behaviour.
 #define TIMER_ID_SYSTRAY_MINIMIZE       100
 #define TIMER_ID_SYSTRAY_STATE_UPDATE   101
 #define TIMER_ID_CONNECTED_REMINDER     102
+#define TIMER_ID_LOG_FLUSH              103
+#define TIMER_ID_METRICS                104
+#define TIMER_ID_HTMLUI_RELEASE         105
+
+// How long the window has to stay in the tray before the HTML UI is released.
+#define HTMLUI_RELEASE_DELAY_MS         (5 * 60 * 1000)
 
 
 //==== Forward declarations ====================================================
@@ -74,6 +101,25 @@ static bool g_htmlUiFinished = false;
 bool HandlePsiCashCommand(const string& jsonString);
 void InitPsiCash();
 void ForegroundWindow(HWND hwnd);
+void ReplayPsiCashInit();
+static void HtmlUI_ScheduleRelease();
+
+
+//==== JSON to the page script =================================================
+
+// A FastWriter reuses its output buffer from one write to the next, so each
+// thread keeps one rather than growing a fresh buffer per message.
+static string WriteJson(const Json::Value& json)
+{
+    static thread_local Json::FastWriter t_jsonWriter;
+    return t_jsonWriter.write(json);
+}
+
+// For posting to the main window, whose handler deletes it.
+static wchar_t* NewPostedJson(const string& json)
+{
+    return UTF8ToNewWideBuffer(json.data(), json.length());
+}
 
 
 //==== Controls ================================================================
@@ -88,6 +134,7 @@ void OnCreate(HWND hWndParent)
     Json::Value initJSON, settingsJSON;
     Settings::ToJson(settingsJSON);
     initJSON["Settings"] = settingsJSON;
+    g_publishedSettings = settingsJSON;
     initJSON["Cookies"] = Settings::GetCookies();
     initJSON["Config"] = Json::Value();
     initJSON["Config"]["ClientVersion"] = CLIENT_VERSION;
@@ -112,6 +159,7 @@ void OnCreate(HWND hWndParent)
     tstring url = ResourceToUrl(_T("main.html"), NULL, initJsonString.c_str());
 
     /* Create the html control */
+    g_htmlCtrlFirstNav = true;
     g_hHtmlCtrl = CreateWindow(
         MC_WC_HTML,
         url.c_str(),
@@ -123,6 +171,11 @@ void OnCreate(HWND hWndParent)
         (HMENU)IDC_HTML_CTRL,
         g_hInst,
         NULL);
+
+    if (!g_htmlUiReleased)
+    {
+        StartupTasks::Milestone("HtmlControlCreated");
+    }
 }
 
 
@@ -145,7 +198,98 @@ void OnCreate(HWND hWndParent)
 #define STRING_KEY_DISALLOWED_TRAFFIC_NOTIFICATION_TITLE    "appbackend#disallowed-traffic-notification-title"
 #define STRING_KEY_DISALLOWED_TRAFFIC_NOTIFICATION_BODY     "appbackend#disallowed-traffic-notification-body"
 
-static map<string, wstring> g_stringTable;
+static unordered_map<string, wstring> g_stringTable;
+// The locale g_stringTable was last filled for
+static string g_stringTableLocale;
+// The backend's strings for every locale, as built from the UI's locale files
+// (see webui/Gruntfile.js) and embedded. Parsed on first use.
+static Json::Value g_stringPacks;
+
+// Fills the string table with locale's strings, falling back to English for
+// any it doesn't have (as the UI does). Also sets the UI locale, so the table
+// is filled and the locale known before the UI has loaded.
+static void LoadStringTableLocale(const string& locale)
+{
+    if (g_stringPacks.isNull())
+    {
+        g_stringPacks = Json::Value(Json::objectValue);
+
+        BYTE* packBytes = 0;
+        DWORD packLen = 0;
+        Json::Value json;
+        Json::Reader reader;
+        if (!GetResourceBytes(_T("APPBACKEND_STRINGS.JSON"), RT_RCDATA, packBytes, packLen))
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s:%d: Failed to load string packs resource"), __TFUNCTION__, __LINE__);
+        }
+        else if (!reader.parse(string((char*)packBytes, packLen), json) || !json.isObject())
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s:%d: Failed to parse string packs"), __TFUNCTION__, __LINE__);
+        }
+        else
+        {
+            g_stringPacks = json;
+        }
+    }
+
+    // The UI's locales may be more specific than what it's asked for, e.g.
+    // "zh_TW" vs. "zh".
+    string packLocale = locale;
+    if (!g_stringPacks.isMember(packLocale))
+    {
+        packLocale = locale.substr(0, locale.find_first_of("_-"));
+    }
+
+    try
+    {
+        for (const string& fillLocale : { string("en"), packLocale })
+        {
+            const Json::Value& pack = g_stringPacks.get(fillLocale, Json::Value());
+            if (!pack.isObject())
+            {
+                continue;
+            }
+
+            for (auto it = pack.begin(); it != pack.end(); ++it)
+            {
+                string narrowStr = it->asString();
+                if (!narrowStr.empty())
+                {
+                    g_stringTable[it.name()] = UTF8ToWString(narrowStr);
+                }
+            }
+        }
+    }
+    catch (exception& e)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s:%d: JSON parse exception: %S"), __TFUNCTION__, __LINE__, e.what());
+    }
+
+    g_stringTableLocale = locale;
+    SetUiLocale(UTF8ToWString(locale));
+}
+
+// Picks the locale the UI will start with -- the one it last used, else the
+// system's -- and fills the string table for it.
+static void PreloadStringTable()
+{
+    string locale;
+
+    Json::Value cookies;
+    Json::Reader reader;
+    if (reader.parse(Settings::GetCookies(), cookies) && cookies.isObject())
+    {
+        const Json::Value& language = cookies["language"];
+        locale = language.isString() ? language.asString() : "";
+    }
+
+    if (locale.empty())
+    {
+        locale = WStringToUTF8(GetLocaleName());
+    }
+
+    LoadStringTableLocale(locale.empty() ? "en" : locale);
+}
 
 static void AddStringTableEntry(const string& utf8EntryJson)
 {
@@ -184,11 +328,16 @@ static void AddStringTableEntry(const string& utf8EntryJson)
         return;
     }
 
+    // The UI sends its strings one at a time; on a change of language, the
+    // whole table is switched at once.
+    if (!locale.empty() && locale != g_stringTableLocale)
+    {
+        LoadStringTableLocale(locale);
+    }
+
     auto wideStr = UTF8ToWString(narrowStr);
     g_stringTable[key] = wideStr;
 
-    SetUiLocale(UTF8ToWString(locale));
-
     // As soon as the OS_UNSUPPORTED string is available, do the OS check.
     if (key == STRING_KEY_OS_UNSUPPORTED) {
         EnforceOSSupport(g_hWnd, wideStr);
@@ -200,7 +349,7 @@ static bool GetStringTableEntry(LPSTR key, wstring& o_entry)
 {
     o_entry.clear();
 
-    map<string, wstring>::const_iterator iter = g_stringTable.find(key);
+    auto iter = g_stringTable.find(key);
     if (iter == g_stringTable.end())
     {
         return false;
@@ -399,6 +548,8 @@ static VOID CALLBACK HandleMinimizeHelper(HWND hWnd, UINT, UINT_PTR idEvent, DWO
 
         UpdateSystrayIcon(NULL, infoTitle, infoBody);
         my_print(NOT_SENSITIVE, true, _T("%s: systray updated"), __TFUNCTION__);
+
+        HtmlUI_ScheduleRelease();
     }
 }
 
@@ -430,9 +581,13 @@ What we want is:
   show anything. If it has changed, we show the change.
   (Unless the application window is foreground, because otherwise the UI and systray
   state mismatch will be weird.)
+The state is pushed by the ConnectionManager's state observer; nothing here
+reads it back.
 */
 
 static ConnectionManagerState g_UpdateSystrayConnectedState_LastState = (ConnectionManagerState)0xFFFFFFFF;
+// The most recent state delivered, for the delayed update
+static ConnectionManagerState g_UpdateSystrayConnectedState_CurrentState = CONNECTION_MANAGER_STATE_STOPPED;
 
 static void UpdateSystrayConnectedStateHelper()
 {
@@ -441,7 +596,7 @@ static void UpdateSystrayConnectedStateHelper()
         return;
     }
 
-    ConnectionManagerState currentState = g_connectionManager.GetState();
+    ConnectionManagerState currentState = g_UpdateSystrayConnectedState_CurrentState;
 
     if (currentState == g_UpdateSystrayConnectedState_LastState)
     {
@@ -501,19 +656,29 @@ static VOID CALLBACK UpdateSystrayConnectedStateTimer(HWND hWnd, UINT, UINT_PTR
     UpdateSystrayConnectedStateHelper();
 }
 
-static void UpdateSystrayConnectedState()
+static void UpdateSystrayConnectedState(ConnectionManagerState state)
 {
+    g_UpdateSystrayConnectedState_CurrentState = state;
+
+    // The systray already shows this state. (Any pending update will find
+    // nothing to do, too.)
+    if (state == g_UpdateSystrayConnectedState_LastState)
+    {
+        return;
+    }
+
     if (g_UpdateSystrayConnectedState_LastState == CONNECTION_MANAGER_STATE_CONNECTED
         && ::GetForegroundWindow() != g_hWnd)
     {
         // Don't keep resetting the timer once we've set it.
         if (g_updateSystrayConnectedStateTimerID == 0)
         {
-            g_updateSystrayConnectedStateTimerID = ::SetTimer(
+            g_updateSystrayConnectedStateTimerID = SetCoalescableTimerIfAvailable(
                 g_hWnd,
                 TIMER_ID_SYSTRAY_STATE_UPDATE,
                 5000,
-                UpdateSystrayConnectedStateTimer);
+                UpdateSystrayConnectedStateTimer,
+                1000); // tolerance
         }
     }
     else
@@ -533,11 +698,13 @@ static void StartConnectedReminderTimer()
 {
     if (g_showConnectedReminderBalloonTimerID == 0)
     {
-        g_showConnectedReminderBalloonTimerID = ::SetTimer(
+        // Nobody will notice a reminder being a little late
+        g_showConnectedReminderBalloonTimerID = SetCoalescableTimerIfAvailable(
             g_hWnd,
             TIMER_ID_CONNECTED_REMINDER,
             g_connectedReminderIntervalMs,
-            ShowConnectedReminderBalloonTimer);
+            ShowConnectedReminderBalloonTimer,
+            g_connectedReminderIntervalMs / 10); // tolerance
     }
 }
 
@@ -595,6 +762,30 @@ static VOID CALLBACK ShowConnectedReminderBalloonTimer(HWND hWnd, UINT, UINT_PTR
     StartConnectedReminderTimer();
 }
 
+// ConnectionManager state observer, for the systray and the connected
+// reminder. (The HTML UI is sent the state, with its details, by the
+// UI_SetState* functions.)
+static void OnConnectionStateChanged(ConnectionManagerState state)
+{
+    // There's no tray icon, nor anyone to remind.
+    if (Headless::IsEnabled())
+    {
+        Headless::OnStateChanged(state);
+        return;
+    }
+
+    UpdateSystrayConnectedState(state);
+
+    if (state == CONNECTION_MANAGER_STATE_CONNECTED)
+    {
+        StartConnectedReminderTimer();
+    }
+    else if (state != CONNECTION_MANAGER_STATE_STARTING)
+    {
+        ResetConnectedReminderTimer();
+    }
+}
+
 
 //==== HTML UI helpers ========================================================
 
@@ -613,87 +804,219 @@ static VOID CALLBACK ShowConnectedReminderBalloonTimer(HWND hWnd, UINT, UINT_PTR
 
 #define WM_PSIPHON_HTMLUI_BEFORENAVIGATE    WM_USER + 200
 #define WM_PSIPHON_HTMLUI_SETSTATE          WM_USER + 201
-#define WM_PSIPHON_HTMLUI_ADDLOG            WM_USER + 202
 #define WM_PSIPHON_HTMLUI_ADDNOTICE         WM_USER + 203
 #define WM_PSIPHON_HTMLUI_REFRESHSETTINGS   WM_USER + 204
 #define WM_PSIPHON_HTMLUI_UPDATEDPISCALING  WM_USER + 205
 #define WM_PSIPHON_HTMLUI_PSICASHMESSAGE    WM_USER + 206
 
-static void HtmlUI_AddLog(int priority, LPCTSTR message)
+// The log view's entries are kept here rather than in the page: a DOM that
+// grows over the session slows the IE engine down more and more. The page is
+// only told that there are new entries, and asks for the ones it's showing
+// (see HtmlUI_GetLogsHandler), so its size and cost per update stay the same
+// however long the session runs.
+// Log messages come in bursts (e.g., core notices while connecting), so the
+// page is told at most every LOG_FLUSH_INTERVAL_MS.
+// Only touched by the main window thread, which does the timer callback too.
+#define LOG_FLUSH_INTERVAL_MS   100
+#define UI_LOG_MAX_ENTRIES      5000
+// Entries handed to the page per request, at most
+#define UI_LOG_MAX_WINDOW       200
+
+struct UiLogEntry
+{
+    int priority;
+    string message;
+    // Milliseconds since the epoch, as the page script's Date takes
+    unsigned long long timestamp;
+};
+
+// Oldest first
+static deque<UiLogEntry> g_uiLog;
+// Of g_uiLog, the debug (priority 0) entries
+static size_t g_uiLogDebugCount = 0;
+static bool g_uiLogChanged = false;
+static UINT_PTR g_logFlushTimerID = 0;
+
+// Calls the page script's HtmlCtrlInterface function with one argument (a JSON
+// string), synchronously. This is the only way native code talks to the page
+// script, so it's where another renderer would be plugged in.
+// Must be called on the main window thread, once the UI is ready.
+// Throws if the function isn't found.
+static void HtmlUI_CallScript(LPCWSTR function, LPCWSTR arg)
+{
+    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
+    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
+    argStruct.cArgs = 1;
+    argStruct.pszArg1 = arg;
+    if (!SendMessage(g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC, (WPARAM)function, (LPARAM)&argStruct))
+    {
+        throw std::exception(("UI: " + WStringToUTF8(function) + " not found").c_str());
+    }
+}
+
+static void HtmlUI_FlushLogs()
 {
+    if (g_logFlushTimerID != 0)
+    {
+        ::KillTimer(g_hWnd, TIMER_ID_LOG_FLUSH);
+        g_logFlushTimerID = 0;
+    }
+
+    // A released UI is told when it's back; see HtmlUI_Replay.
+    if (!g_uiLogChanged || !g_htmlUiReady)
+    {
+        return;
+    }
+    g_uiLogChanged = false;
+
     Json::Value json;
-    json["priority"] = priority;
-    json["message"] = WStringToUTF8(message);
-    Json::FastWriter jsonWriter;
-    wstring wJson = UTF8ToWString(jsonWriter.write(json).c_str());
+    json["total"] = (Json::UInt64)g_uiLog.size();
+    json["debugTotal"] = (Json::UInt64)g_uiLogDebugCount;
+
+    const wstring& wJson = UTF8ToWStringTemp(WriteJson(json));
+
+    HtmlUI_CallScript(L"HtmlCtrlInterface_LogsChanged", wJson.c_str());
+}
+
+static VOID CALLBACK HtmlUI_FlushLogsTimer(HWND, UINT, UINT_PTR idEvent, DWORD)
+{
+    assert(TIMER_ID_LOG_FLUSH == idEvent);
+    HtmlUI_FlushLogs();
+}
+
+// Must be called on the main window thread -- i.e., from a posted message
+// handler, never from within a call into the page script.
+static void HtmlUI_AddLog(int priority, const string& message)
+{
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = now.dwLowDateTime;
+    ticks.HighPart = now.dwHighDateTime;
+
+    UiLogEntry entry;
+    entry.priority = priority;
+    entry.message = message;
+    // FILETIME counts 100ns intervals since 1601
+    entry.timestamp = (ticks.QuadPart - 116444736000000000ULL) / 10000;
+    g_uiLog.push_back(std::move(entry));
+    if (priority == 0)
+    {
+        g_uiLogDebugCount++;
+    }
+
+    if (g_uiLog.size() > UI_LOG_MAX_ENTRIES)
+    {
+        if (g_uiLog.front().priority == 0)
+        {
+            g_uiLogDebugCount--;
+        }
+        g_uiLog.pop_front();
+    }
+
+    g_uiLogChanged = true;
+
+    if (g_logFlushTimerID == 0)
+    {
+        g_logFlushTimerID = SetCoalescableTimerIfAvailable(
+            g_hWnd,
+            TIMER_ID_LOG_FLUSH,
+            LOG_FLUSH_INTERVAL_MS,
+            HtmlUI_FlushLogsTimer,
+            LOG_FLUSH_INTERVAL_MS); // tolerance
+    }
+}
 
-    size_t bufLen = wJson.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, wJson.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_ADDLOG, (WPARAM)buf, 0);
+static void HtmlUI_AddLog(int priority, LPCTSTR message)
+{
+    HtmlUI_AddLog(priority, WStringToUTF8Temp(message, wcslen(message)));
 }
 
-static void HtmlUI_AddLogHandler(LPCWSTR json)
+// The page asks for the entries it's showing: count of them, newest first,
+// starting offset entries back from the newest. Debug entries are left out,
+// and don't count towards the offset, unless debug is set.
+// Must be called on the main window thread, once the UI is ready.
+static void HtmlUI_GetLogsHandler(const string& requestJSON)
 {
     if (!g_htmlUiReady)
     {
-        delete[] json;
         return;
     }
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_AddLog"), (LPARAM)&argStruct))
+    Json::Value request;
+    Json::Reader reader;
+    if (!reader.parse(requestJSON, request) || !request.isObject())
     {
-        throw std::exception("UI: HtmlCtrlInterface_AddLog not found");
+        my_print(NOT_SENSITIVE, true, _T("%s: bad request"), __TFUNCTION__);
+        return;
     }
-    delete[] json;
+
+    size_t offset = (size_t)request.get("offset", 0).asUInt();
+    size_t count = min((size_t)request.get("count", 0).asUInt(), (size_t)UI_LOG_MAX_WINDOW);
+    bool debug = request.get("debug", false).asBool();
+
+    Json::Value json;
+    json["offset"] = (Json::UInt64)offset;
+    json["total"] = (Json::UInt64)(debug ? g_uiLog.size() : g_uiLog.size() - g_uiLogDebugCount);
+    json["debugTotal"] = (Json::UInt64)g_uiLogDebugCount;
+    Json::Value& entries = json["entries"] = Json::Value(Json::arrayValue);
+
+    size_t skipped = 0;
+    for (auto it = g_uiLog.crbegin(); it != g_uiLog.crend() && entries.size() < count; ++it)
+    {
+        if (!debug && it->priority == 0)
+        {
+            continue;
+        }
+        if (skipped < offset)
+        {
+            skipped++;
+            continue;
+        }
+
+        Json::Value entry;
+        entry["priority"] = it->priority;
+        entry["message"] = it->message;
+        entry["timestamp"] = (Json::UInt64)it->timestamp;
+        entries.append(entry);
+    }
+
+    const wstring& wJson = UTF8ToWStringTemp(WriteJson(json));
+
+    HtmlUI_CallScript(L"HtmlCtrlInterface_SetLogs", wJson.c_str());
 }
 
-static void HtmlUI_SetState(const wstring& json)
+static void HtmlUI_SetState(const Json::Value& json)
 {
-    size_t bufLen = json.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, json.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_SETSTATE, (WPARAM)buf, 0);
+    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_SETSTATE, (WPARAM)NewPostedJson(WriteJson(json)), 0);
 }
 
+// The state last given to the page script. State changes are often repeats
+// (e.g., "starting" for each attempt of a reconnect loop), and those aren't
+// passed on. Only touched by the main window thread.
+static wstring g_publishedStateJSON;
+// The most recent state, whether or not the page script could be given it;
+// for when a released UI is back.
+static wstring g_latestStateJSON;
+
 static void HtmlUI_SetStateHandler(LPCWSTR json)
 {
-    if (!g_htmlUiReady)
+    g_latestStateJSON = json;
+
+    if (!g_htmlUiReady || g_publishedStateJSON == json)
     {
         delete[] json;
         return;
     }
+    g_publishedStateJSON = json;
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_SetState"), (LPARAM)&argStruct))
-    {
-        throw std::exception("UI: HtmlCtrlInterface_SetState not found");
-    }
+    HtmlUI_CallScript(L"HtmlCtrlInterface_SetState", json);
     delete[] json;
 }
 
 static void HtmlUI_AddNotice(const string& noticeJSON)
 {
-    wstring wJson = UTF8ToWString(noticeJSON.c_str());
-
-    size_t bufLen = wJson.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, wJson.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_ADDNOTICE, (WPARAM)buf, 0);
+    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_ADDNOTICE, (WPARAM)NewPostedJson(noticeJSON), 0);
 }
 
 static void HtmlUI_AddNoticeHandler(LPCWSTR json)
@@ -704,28 +1027,88 @@ static void HtmlUI_AddNoticeHandler(LPCWSTR json)
         return;
     }
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_AddNotice"), (LPARAM)&argStruct))
+    HtmlUI_CallScript(L"HtmlCtrlInterface_AddNotice", json);
+    delete[] json;
+}
+
+// The page script is given the tunnel metrics this often, when they've
+// changed; while idle or stopped it isn't called at all. After
+// METRICS_IDLE_AFTER_SAMPLES unchanged samples in a row, sampling slows to
+// METRICS_IDLE_UPDATE_INTERVAL_MS until something changes.
+#define METRICS_UPDATE_INTERVAL_MS      1000
+#define METRICS_IDLE_UPDATE_INTERVAL_MS 5000
+#define METRICS_IDLE_AFTER_SAMPLES      30
+// Only touched by the main window thread
+static unsigned int g_unchangedMetricsSamples = 0;
+
+static VOID CALLBACK HtmlUI_UpdateMetricsTimer(HWND, UINT, UINT_PTR, DWORD);
+
+static void SetMetricsTimer(UINT intervalMilliseconds)
+{
+    // Replaces the timer, if it's already set
+    SetCoalescableTimerIfAvailable(
+        g_hWnd,
+        TIMER_ID_METRICS,
+        intervalMilliseconds,
+        HtmlUI_UpdateMetricsTimer,
+        intervalMilliseconds / 4); // tolerance
+}
+
+static VOID CALLBACK HtmlUI_UpdateMetricsTimer(HWND, UINT, UINT_PTR idEvent, DWORD)
+{
+    assert(TIMER_ID_METRICS == idEvent);
+
+    Json::Value metrics;
+    if (!TunnelMetrics::Sample(metrics))
+    {
+        if (++g_unchangedMetricsSamples == METRICS_IDLE_AFTER_SAMPLES)
+        {
+            SetMetricsTimer(METRICS_IDLE_UPDATE_INTERVAL_MS);
+        }
+        return;
+    }
+
+    if (g_unchangedMetricsSamples >= METRICS_IDLE_AFTER_SAMPLES)
     {
-        throw std::exception("UI: HtmlCtrlInterface_AddNotice not found");
+        SetMetricsTimer(METRICS_UPDATE_INTERVAL_MS);
     }
-    delete[] json;
+    g_unchangedMetricsSamples = 0;
+
+    Headless::OnMetrics(metrics);
+
+    if (!g_htmlUiReady)
+    {
+        return;
+    }
+
+    const wstring& wJson = UTF8ToWStringTemp(WriteJson(metrics));
+
+    HtmlUI_CallScript(L"HtmlCtrlInterface_UpdateMetrics", wJson.c_str());
 }
 
-static void HtmlUI_RefreshSettings(const string& settingsJSON)
+// Returns the members of settings that differ from what the page script was
+// last given, and records settings as what it has now. The script merges
+// partial settings into what it has.
+static Json::Value HtmlUI_SettingsDelta(const Json::Value& settings)
 {
-    wstring wJson = UTF8ToWString(settingsJSON.c_str());
+    Json::Value delta(Json::objectValue);
+
+    for (const auto& name : settings.getMemberNames())
+    {
+        if (!g_publishedSettings.isMember(name)
+            || g_publishedSettings[name] != settings[name])
+        {
+            delta[name] = settings[name];
+        }
+    }
 
-    size_t bufLen = wJson.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, wJson.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_REFRESHSETTINGS, (WPARAM)buf, 0);
+    g_publishedSettings = settings;
+    return delta;
+}
+
+static void HtmlUI_RefreshSettings(const string& settingsJSON)
+{
+    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_REFRESHSETTINGS, (WPARAM)NewPostedJson(settingsJSON), 0);
 }
 
 static void HtmlUI_RefreshSettingsHandler(LPCWSTR json)
@@ -736,28 +1119,13 @@ static void HtmlUI_RefreshSettingsHandler(LPCWSTR json)
         return;
     }
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_RefreshSettings"), (LPARAM)&argStruct))
-    {
-        throw std::exception("UI: HtmlCtrlInterface_RefreshSettings not found");
-    }
+    HtmlUI_CallScript(L"HtmlCtrlInterface_RefreshSettings", json);
     delete[] json;
 }
 
 static void HtmlUI_UpdateDpiScaling(const string& dpiScalingJSON)
 {
-    wstring wJson = UTF8ToWString(dpiScalingJSON.c_str());
-
-    size_t bufLen = wJson.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, wJson.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_UPDATEDPISCALING, (WPARAM)buf, 0);
+    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_UPDATEDPISCALING, (WPARAM)NewPostedJson(dpiScalingJSON), 0);
 }
 
 static void HtmlUI_UpdateDpiScalingHandler(LPCWSTR json)
@@ -768,28 +1136,13 @@ static void HtmlUI_UpdateDpiScalingHandler(LPCWSTR json)
         return;
     }
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_UpdateDpiScaling"), (LPARAM)&argStruct))
-    {
-        throw std::exception("UI: HtmlUI_UpdateDpiScaling not found");
-    }
+    HtmlUI_CallScript(L"HtmlCtrlInterface_UpdateDpiScaling", json);
     delete[] json;
 }
 
 static void HtmlUI_PsiCashMessage(const string& psicashJSON)
 {
-    wstring wJson = UTF8ToWString(psicashJSON.c_str());
-
-    size_t bufLen = wJson.length() + 1;
-    wchar_t* buf = new wchar_t[bufLen];
-    wcsncpy_s(buf, bufLen, wJson.c_str(), bufLen);
-    buf[bufLen - 1] = L'\0';
-    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_PSICASHMESSAGE, (WPARAM)buf, 0);
+    PostMessage(g_hWnd, WM_PSIPHON_HTMLUI_PSICASHMESSAGE, (WPARAM)NewPostedJson(psicashJSON), 0);
 }
 
 static void HtmlUI_PsiCashMessageHandler(LPCWSTR json)
@@ -800,17 +1153,87 @@ static void HtmlUI_PsiCashMessageHandler(LPCWSTR json)
         return;
     }
 
-    MC_HMCALLSCRIPTFUNC argStruct = { 0 };
-    argStruct.cbSize = sizeof(MC_HMCALLSCRIPTFUNC);
-    argStruct.cArgs = 1;
-    argStruct.pszArg1 = json;
-    if (!SendMessage(
-        g_hHtmlCtrl, MC_HM_CALLSCRIPTFUNC,
-        (WPARAM)_T("HtmlCtrlInterface_PsiCashMessage"), (LPARAM)&argStruct))
+    HtmlUI_CallScript(L"HtmlCtrlInterface_PsiCashMessage", json);
+    delete[] json;
+}
+
+static VOID CALLBACK HtmlUI_ReleaseTimer(HWND hWnd, UINT, UINT_PTR idEvent, DWORD)
+{
+    assert(TIMER_ID_HTMLUI_RELEASE == idEvent);
+    ::KillTimer(hWnd, TIMER_ID_HTMLUI_RELEASE);
+
+    if (!g_htmlUiReady || g_htmlUiFinished || IsWindowVisible(g_hWnd))
     {
-        throw std::exception("UI: HtmlCtrlInterface_PsiCashMessage not found");
+        return;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: releasing the HTML UI while in the tray"), __TFUNCTION__);
+
+    HtmlUI_FlushLogs();
+    g_htmlUiReady = false;
+    g_htmlUiReleased = true;
+    DestroyWindow(g_hHtmlCtrl);
+    g_hHtmlCtrl = NULL;
+
+    // What the engine was using has been freed, but much of it stays in our
+    // working set until it's trimmed.
+    (void)SetProcessWorkingSetSize(GetCurrentProcess(), (SIZE_T)-1, (SIZE_T)-1);
+}
+
+// Called once the window has been hidden in the tray. If it's still there
+// after HTMLUI_RELEASE_DELAY_MS, the HTML control is destroyed -- most users
+// never look at the window again, and the IE engine is by far our biggest
+// use of memory.
+static void HtmlUI_ScheduleRelease()
+{
+    if (!g_htmlUiReady)
+    {
+        return;
+    }
+
+    // Replaces the timer, if it's already set
+    ::SetTimer(g_hWnd, TIMER_ID_HTMLUI_RELEASE, HTMLUI_RELEASE_DELAY_MS, HtmlUI_ReleaseTimer);
+}
+
+// Called as the window is shown. Creates the HTML control again, if it was
+// released; HtmlUI_Replay catches it up once its page script is ready.
+static void HtmlUI_Restore()
+{
+    ::KillTimer(g_hWnd, TIMER_ID_HTMLUI_RELEASE);
+
+    if (!g_htmlUiReleased || g_hHtmlCtrl || g_htmlUiFinished)
+    {
+        return;
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: recreating the released HTML UI"), __TFUNCTION__);
+
+    // Settings and DPI scaling are passed in fresh.
+    OnCreate(g_hWnd);
+
+    RECT rect;
+    if (GetClientRect(g_hWnd, &rect))
+    {
+        OnResize(g_hWnd, rect.right - rect.left, rect.bottom - rect.top);
     }
-    delete[] json;
+}
+
+// Gives a recreated page script what happened while it was released.
+static void HtmlUI_Replay()
+{
+    g_htmlUiReleased = false;
+
+    if (!g_latestStateJSON.empty())
+    {
+        g_publishedStateJSON = g_latestStateJSON;
+        HtmlUI_CallScript(L"HtmlCtrlInterface_SetState", g_publishedStateJSON.c_str());
+    }
+
+    ReplayPsiCashInit();
+
+    // The page asks for whatever it wants to show.
+    g_uiLogChanged = !g_uiLog.empty();
+    HtmlUI_FlushLogs();
 }
 
 static void HtmlUI_BeforeNavigate(MC_NMHTMLURL* nmHtmlUrl)
@@ -837,6 +1260,10 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
     const size_t appStringTableLen = _tcslen(appStringTable);
     const LPCTSTR appLogCommand = PSIPHON_LINK_PREFIX _T("log?");
     const size_t appLogCommandLen = _tcslen(appLogCommand);
+    const LPCTSTR appAddLog = PSIPHON_LINK_PREFIX _T("addlog?");
+    const size_t appAddLogLen = _tcslen(appAddLog);
+    const LPCTSTR appGetLogs = PSIPHON_LINK_PREFIX _T("getlogs?");
+    const size_t appGetLogsLen = _tcslen(appGetLogs);
     const LPCTSTR appStart = PSIPHON_LINK_PREFIX _T("start");
     const LPCTSTR appStop = PSIPHON_LINK_PREFIX _T("stop");
     const LPCTSTR appReconnect = PSIPHON_LINK_PREFIX _T("reconnect?");
@@ -856,7 +1283,15 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
     {
         my_print(NOT_SENSITIVE, true, _T("%s: Ready requested"), __TFUNCTION__);
         g_htmlUiReady = true;
+        if (g_htmlUiReleased)
+        {
+            // Recreated after being released; startup was done long ago.
+            HtmlUI_Replay();
+            goto done;
+        }
+        StartupTasks::Milestone("HtmlUiReady");
         InitPsiCash();
+        StartupTasks::Milestone("PsiCashInitialized");
         PostMessage(g_hWnd, WM_PSIPHON_CREATED, 0, 0);
     }
     else if (_tcsncmp(url, appStringTable, appStringTableLen) == 0
@@ -887,6 +1322,39 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
 
         my_print(NOT_SENSITIVE, true, _T("UILog: %s"), urlDecoded.c_str() + appLogCommandLen);
     }
+    else if (_tcsncmp(url, appAddLog, appAddLogLen) == 0
+        && _tcslen(url) > appAddLogLen)
+    {
+        // An entry made by the page itself. Into the log view only, as before
+        // the view was kept here: not into the message history.
+        tstring urlDecoded = UrlDecode(url);
+        if (urlDecoded.length() < appAddLogLen + 1)
+        {
+            goto done;
+        }
+
+        // This is already UTF-8 encoded, we just need to narrow it into a string.
+        string logJSON(WStringToNarrow(urlDecoded).c_str() + appAddLogLen);
+
+        Json::Value log;
+        Json::Reader reader;
+        if (reader.parse(logJSON, log) && log.isObject())
+        {
+            HtmlUI_AddLog(log.get("priority", 1).asInt(), log.get("message", "").asString());
+        }
+    }
+    else if (_tcsncmp(url, appGetLogs, appGetLogsLen) == 0
+        && _tcslen(url) > appGetLogsLen)
+    {
+        tstring urlDecoded = UrlDecode(url);
+        if (urlDecoded.length() < appGetLogsLen + 1)
+        {
+            goto done;
+        }
+
+        // This is already UTF-8 encoded, we just need to narrow it into a string.
+        HtmlUI_GetLogsHandler(string(WStringToNarrow(urlDecoded).c_str() + appGetLogsLen));
+    }
     else if (_tcscmp(url, appStart) == 0)
     {
         my_print(NOT_SENSITIVE, true, _T("%s: Start requested"), __TFUNCTION__);
@@ -910,7 +1378,9 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
 
         // We only need to check the last character, as it's of the form ?suppress=1
         bool suppressHomePage = *(urlDecoded.end()-1) == _T('1');
-        g_connectionManager.Reconnect(suppressHomePage);
+        // Requested to apply new PsiCash authorizations, which only the
+        // tunnel's configuration depends on.
+        g_connectionManager.RestartTunnel(suppressHomePage);
     }
     else if (_tcsncmp(url, appSaveSettings, appSaveSettingsLen) == 0
         && _tcslen(url) > appSaveSettingsLen)
@@ -924,10 +1394,10 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
         }
 
         string stringJSON(WStringToNarrow(urlDecoded).c_str() + appSaveSettingsLen);
-        bool reconnectRequired = false;
-        bool success = Settings::FromJson(stringJSON, reconnectRequired);
+        SettingsChangeScope changeScope = SETTINGS_CHANGE_NONE;
+        bool success = Settings::FromJson(stringJSON, changeScope);
 
-        bool doReconnect = success && reconnectRequired &&
+        bool doReconnect = success && changeScope != SETTINGS_CHANGE_NONE &&
             (g_connectionManager.GetState() == CONNECTION_MANAGER_STATE_CONNECTED
                 || g_connectionManager.GetState() == CONNECTION_MANAGER_STATE_STARTING);
 
@@ -935,21 +1405,30 @@ static void HtmlUI_BeforeNavigateHandler(LPCTSTR url)
         Json::Value settingsJSON;
         Settings::ToJson(settingsJSON);
 
+        // Only what's changed is sent, unless the save failed: then the
+        // page's (unsaved) values need resetting to the stored ones.
+        Json::Value settingsDelta = HtmlUI_SettingsDelta(settingsJSON);
+
         Json::Value settingsRefreshJSON;
-        settingsRefreshJSON["settings"] = settingsJSON;
+        settingsRefreshJSON["settings"] = success ? settingsDelta : settingsJSON;
         settingsRefreshJSON["success"] = success;
         settingsRefreshJSON["reconnectRequired"] = doReconnect;
 
-        Json::FastWriter jsonWriter;
-        string strSettingsRefreshJSON = jsonWriter.write(settingsRefreshJSON);
-        UI_RefreshSettings(strSettingsRefreshJSON);
+        UI_RefreshSettings(WriteJson(settingsRefreshJSON));
 
         if (doReconnect)
         {
             // Instead of reconnecting here, we could let the JS see that it's
             // required and then trigger it. But that seems like an unnecessary round-trip.
             my_print(NOT_SENSITIVE, false, _T("Settings change detected. Reconnecting."));
-            g_connectionManager.Reconnect(false);
+            if (changeScope == SETTINGS_CHANGE_TUNNEL)
+            {
+                g_connectionManager.RestartTunnel(false);
+            }
+            else
+            {
+                g_connectionManager.Reconnect(false);
+            }
         }
     }
     else if (_tcsncmp(url, appSendFeedback, appSendFeedbackLen) == 0
@@ -1042,55 +1521,36 @@ done:
 
 void UI_SetStateStopped()
 {
-    UpdateSystrayConnectedState();
-    ResetConnectedReminderTimer();
-
     Json::Value json;
     json["state"] = "stopped";
-    Json::FastWriter jsonWriter;
-    wstring wJson = UTF8ToWString(jsonWriter.write(json).c_str());
-    HtmlUI_SetState(wJson);
+    HtmlUI_SetState(json);
 }
 
 void UI_SetStateStopping()
 {
-    UpdateSystrayConnectedState();
-    ResetConnectedReminderTimer();
-
     Json::Value json;
     json["state"] = "stopping";
-    Json::FastWriter jsonWriter;
-    wstring wJson = UTF8ToWString(jsonWriter.write(json).c_str());
-    HtmlUI_SetState(wJson);
+    HtmlUI_SetState(json);
 }
 
 void UI_SetStateStarting(const tstring& transportProtocolName)
 {
-    UpdateSystrayConnectedState();
-
     Json::Value json;
     json["state"] = "starting";
-    json["transport"] = WStringToUTF8(transportProtocolName.c_str());
-    Json::FastWriter jsonWriter;
-    wstring wJson = UTF8ToWString(jsonWriter.write(json).c_str());
-    HtmlUI_SetState(wJson);
+    json["transport"] = WStringToUTF8Temp(transportProtocolName);
+    HtmlUI_SetState(json);
 }
 
 void UI_SetStateConnected(const tstring& transportProtocolName, int socksPort, int httpPort)
 {
-    UpdateSystrayConnectedState();
-    StartConnectedReminderTimer();
-
     Json::Value json;
     json["state"] = "connected";
-    json["transport"] = WStringToUTF8(transportProtocolName.c_str());
+    json["transport"] = WStringToUTF8Temp(transportProtocolName);
     json["socksPort"] = socksPort;
     json["socksPortAuto"] = Settings::LocalSocksProxyPort() == 0;
     json["httpPort"] = httpPort;
     json["httpPortAuto"] = Settings::LocalHttpProxyPort() == 0;
-    Json::FastWriter jsonWriter;
-    wstring wJson = UTF8ToWString(jsonWriter.write(json).c_str());
-    HtmlUI_SetState(wJson);
+    HtmlUI_SetState(json);
 }
 
 // Take JSON in the form provided by CoreTransport
@@ -1107,8 +1567,7 @@ void UI_Notice(const string& noticeID, const string& techInfo)
     Json::Value json;
     json["noticeType"] = noticeID;
     json["data"] = techInfo;
-    Json::FastWriter jsonWriter;
-    UI_Notice(jsonWriter.write(json));
+    UI_Notice(WriteJson(json));
 }
 
 void UI_RefreshSettings(const string& settingsJSON)
@@ -1128,6 +1587,48 @@ BOOL InitInstance(HINSTANCE, int);
 LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
 INT_PTR CALLBACK About(HWND, UINT, WPARAM, LPARAM);
 
+// What the UI watchdog blames a stall on. Timer callbacks are called by
+// DispatchMessage without going through the window procedure, so they're
+// named here too.
+static const char* UIWatchdogMessageName(const MSG& msg)
+{
+    switch (msg.message)
+    {
+    case WM_PSIPHON_MY_PRINT:                   return "MyPrint";
+    case WM_PSIPHON_FEEDBACK_SUCCESS:           return "FeedbackSuccess";
+    case WM_PSIPHON_FEEDBACK_FAILED:            return "FeedbackFailed";
+    case WM_PSIPHON_CREATED:                    return "Created";
+    case WM_PSIPHON_TRAY_ICON_NOTIFY:           return "TrayIconNotify";
+    case WM_PSIPHON_CONNECTED_REMINDER_NOTIFY:  return "ConnectedReminderNotify";
+    case WM_PSIPHON_CONNECTION_STATE_CHANGED:   return "ConnectionStateChanged";
+    case WM_PSIPHON_UI_WATCHDOG_PING:           return "UIWatchdogPing";
+    case WM_PSIPHON_HTMLUI_BEFORENAVIGATE:      return "HtmlUI_BeforeNavigate";
+    case WM_PSIPHON_HTMLUI_SETSTATE:            return "HtmlUI_SetState";
+    case WM_PSIPHON_HTMLUI_ADDNOTICE:           return "HtmlUI_AddNotice";
+    case WM_PSIPHON_HTMLUI_REFRESHSETTINGS:     return "HtmlUI_RefreshSettings";
+    case WM_PSIPHON_HTMLUI_UPDATEDPISCALING:    return "HtmlUI_UpdateDpiScaling";
+    case WM_PSIPHON_HTMLUI_PSICASHMESSAGE:      return "HtmlUI_PsiCashMessage";
+    case WM_NOTIFY:                             return "WM_NOTIFY";
+    case WM_COMMAND:                            return "WM_COMMAND";
+    case WM_PAINT:                              return "WM_PAINT";
+    case WM_SIZE:                               return "WM_SIZE";
+    case WM_TIMER:
+        switch (msg.wParam)
+        {
+        case TIMER_ID_SYSTRAY_MINIMIZE:         return "SystrayMinimizeTimer";
+        case TIMER_ID_SYSTRAY_STATE_UPDATE:     return "SystrayStateUpdateTimer";
+        case TIMER_ID_CONNECTED_REMINDER:       return "ConnectedReminderTimer";
+        case TIMER_ID_LOG_FLUSH:                return "LogFlushTimer";
+        case TIMER_ID_METRICS:                  return "MetricsTimer";
+        case TIMER_ID_HTMLUI_RELEASE:           return "HtmlUI_ReleaseTimer";
+        }
+        return "WM_TIMER";
+    }
+
+    // Mostly the HTML control's own messages
+    return "Other";
+}
+
 int APIENTRY _tWinMain(
     HINSTANCE hInstance,
     HINSTANCE hPrevInstance,
@@ -1137,6 +1638,32 @@ int APIENTRY _tWinMain(
     UNREFERENCED_PARAMETER(hPrevInstance);
     UNREFERENCED_PARAMETER(lpCmdLine);
 
+    // Vista and later use the low-fragmentation heap by default, but XP
+    // doesn't. Without it, the steady churn of small allocations (parsing
+    // core notices, mostly) fragments our 32-bit address space over a long
+    // session. The CRT allocates from the process heap. This fails under a
+    // debugger, which is harmless.
+    ULONG heapCompatibility = 2; // low-fragmentation heap
+    (void)HeapSetInformation(
+            GetProcessHeap(),
+            HeapCompatibilityInformation,
+            &heapCompatibility,
+            sizeof(heapCompatibility));
+
+    // Spawned by CoreTransport in place of the core; see scripted_core.h
+    if (ScriptedCore::IsStandIn())
+    {
+        return ScriptedCore::RunStandIn();
+    }
+
+    Headless::ParseCommandLine();
+
+    TraceStart();
+
+    // Includes static initialization (e.g., Settings::Initialize, done by the
+    // ConnectionManager's constructor).
+    StartupTasks::Milestone("WinMainEntered");
+
     LoadString(hInstance, IDS_APP_TITLE, g_szTitle, MAX_LOADSTRING);
     LoadString(hInstance, IDC_PSICLIENT, g_szWindowClass, MAX_LOADSTRING);
     MyRegisterClass(hInstance);
@@ -1145,19 +1672,53 @@ int APIENTRY _tWinMain(
     mc_StaticLibInitialize();
     mcHtml_Initialize();
 
+    g_connectionManager.AddStateObserver(OnConnectionStateChanged);
+    g_connectionManager.SetHomePagesDisabled(Headless::IsEnabled());
+
     // Perform application initialization
 
     if (!InitInstance(hInstance, nCmdShow))
     {
+        if (Headless::IsEnabled())
+        {
+            Headless::Fail("AnotherInstanceRunning");
+            return Headless::ExitCode();
+        }
         return FALSE;
     }
+    StartupTasks::Milestone("InstanceInitialized");
 
     HACCEL hAccelTable;
     hAccelTable = LoadAccelerators(hInstance, MAKEINTRESOURCE(IDC_PSICLIENT));
 
-    // If this set of calls gets any longer, we may want to do something generic.
-    DoStartupSystemProxyWork();
-    DoStartupDiagnosticCollection();
+    StartupTasks::Milestone("WindowCreated");
+
+    // The rest of startup runs off the UI thread, while the HTML UI loads.
+    // Connecting waits for the system proxy and diagnostic work.
+    StartupTasks::Add(STARTUP_TASK_SYSTEM_PROXY, DoStartupSystemProxyWork);
+    // Collects the original network info, so it comes after any proxy
+    // settings left by a crash are restored.
+    StartupTasks::Add(
+        STARTUP_TASK_DIAGNOSTIC_COLLECTION, DoStartupDiagnosticCollection,
+        { STARTUP_TASK_SYSTEM_PROXY });
+    // Loads the selected transport's server list into its cache, ready for
+    // the first connection.
+    StartupTasks::Add(STARTUP_TASK_SERVER_LIST, [] {
+        (void)ServerList(WStringToUTF8(Settings::Transport()).c_str()).GetSnapshot();
+    });
+    StartupTasks::Start();
+
+    // Only needed for feedback and the core's config, but slow to get.
+    StartSystemInfoCollection();
+
+    StartResourceUsageMonitor();
+
+    StartDiskJanitor();
+
+    UIWatchdog::Start(g_hWnd);
+
+    // Dispatch stays responsive while the pool is busy with maintenance.
+    ThreadQoSScope uiQoS(THREAD_QOS_LATENCY_CRITICAL);
 
     // Main message loop
 
@@ -1169,13 +1730,15 @@ int APIENTRY _tWinMain(
             // Bit of a dirty hack to prevent the HTML control code from crashing
             // on exit.
             // WM_APP+2 is the message used for MC_HN_STATUSTEXT. Sometimes it
-            // arrives after the control is destroyed and will cause an app
-            // crash if we let it through.
-            if (msg.message == (WM_APP + 2) && g_htmlUiFinished)
+            // arrives after the control is destroyed (on exit, or when it's
+            // released in the tray) and will cause an app crash if we let it
+            // through.
+            if (msg.message == (WM_APP + 2) && (g_htmlUiFinished || !g_hHtmlCtrl))
             {
                 continue;
             }
 
+            UIWatchdog::DispatchScope dispatchScope(UIWatchdogMessageName(msg));
             TranslateMessage(&msg);
             DispatchMessage(&msg);
         }
@@ -1186,7 +1749,10 @@ int APIENTRY _tWinMain(
     mcHtml_Terminate();
     mc_StaticLibTerminate();
 
-    return (int)msg.wParam;
+    RingLogStop();
+    TraceStop();
+
+    return Headless::IsEnabled() ? Headless::ExitCode() : (int)msg.wParam;
 }
 
 ATOM MyRegisterClass(HINSTANCE hInstance)
@@ -1317,9 +1883,8 @@ static LRESULT HandleNotify(HWND hWnd, NMHDR* hdr)
         {
             MC_NMHTMLURL* nmHtmlUrl = (MC_NMHTMLURL*)hdr;
             // We should not interfere with the initial page load
-            static bool s_firstNav = true;
-            if (s_firstNav) {
-                s_firstNav = false;
+            if (g_htmlCtrlFirstNav) {
+                g_htmlCtrlFirstNav = false;
                 return 0;
             }
 
@@ -1358,6 +1923,9 @@ BOOL InitInstance(HINSTANCE hInstance, int nCmdShow)
         return FALSE;
     }
 
+    // Only now that no other instance is using it.
+    RingLogStart();
+
     g_hInst = hInstance;
 
     // This isn't supported for all OS versions.
@@ -1387,7 +1955,21 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     switch (message)
     {
     case WM_CREATE:
-        OnCreate(hWnd);
+        // Notifications may need strings before the UI has loaded.
+        PreloadStringTable();
+        if (!Headless::IsEnabled())
+        {
+            OnCreate(hWnd);
+        }
+        else if (Headless::Start(hWnd))
+        {
+            // There's no HTML UI to be ready, so startup carries on now.
+            PostMessage(hWnd, WM_PSIPHON_CREATED, 0, 0);
+        }
+        else
+        {
+            PostMessage(hWnd, WM_CLOSE, 0, 0);
+        }
         break;
 
     case WM_PSIPHON_CREATED:
@@ -1402,18 +1984,38 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             break;
         }
 
-        // Content is loaded, so show the window.
-        RestoreWindowPlacement();
-        UpdateSystrayConnectedState();
+        // Content is loaded, so show the window -- unless it's headless.
+        if (!Headless::IsEnabled())
+        {
+            RestoreWindowPlacement();
+            UpdateSystrayConnectedState(g_connectionManager.GetState());
+        }
+        else
+        {
+            // Done once the HTML UI is ready, otherwise
+            InitPsiCash();
+        }
 
         // Set initial state.
         UI_SetStateStopped();
+        StartupTasks::Milestone("WindowShown");
 
-        // Start a connection
-        if (!Settings::SkipAutoConnect())
+        SetMetricsTimer(METRICS_UPDATE_INTERVAL_MS);
+
+        // Start a connection. A headless run only connects if asked to,
+        // and a benchmark run doesn't.
+        if (Headless::IsEnabled() && Headless::HasBackgroundRun())
+        {
+            Headless::StartBackgroundRun();
+        }
+        else if (Headless::IsEnabled() ? Headless::ShouldConnect() : !Settings::SkipAutoConnect())
         {
             g_connectionManager.Toggle();
+            StartupTasks::Milestone("AutoConnectStarted");
         }
+
+        // The UI is interactive now, which is the end of startup.
+        StartupTasks::SaveTimeline();
         break;
     }
 
@@ -1445,9 +2047,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         Json::Value dpiScalingJSON;
         dpiScalingJSON["dpiScaling"] = g_dpiScaling;
 
-        Json::FastWriter jsonWriter;
-        string strDpiScalingJSON = jsonWriter.write(dpiScalingJSON);
-        UI_UpdateDpiScaling(strDpiScalingJSON);
+        UI_UpdateDpiScaling(WriteJson(dpiScalingJSON));
 
         break;
     }
@@ -1458,8 +2058,11 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     case WM_PSIPHON_HTMLUI_SETSTATE:
         HtmlUI_SetStateHandler((LPCWSTR)wParam);
         break;
-    case WM_PSIPHON_HTMLUI_ADDLOG:
-        HtmlUI_AddLogHandler((LPCWSTR)wParam);
+    case WM_PSIPHON_CONNECTION_STATE_CHANGED:
+        g_connectionManager.DeliverStateChange();
+        break;
+    case WM_PSIPHON_UI_WATCHDOG_PING:
+        UIWatchdog::HandlePing(lParam);
         break;
     case WM_PSIPHON_HTMLUI_ADDNOTICE:
         HtmlUI_AddNoticeHandler((LPCWSTR)wParam);
@@ -1515,7 +2118,17 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         return DefWindowProc(hWnd, message, wParam, lParam);
 
     case WM_SETFOCUS:
-        SetFocus(g_hHtmlCtrl);
+        if (g_hHtmlCtrl)
+        {
+            SetFocus(g_hHtmlCtrl);
+        }
+        break;
+
+    case WM_SHOWWINDOW:
+        if (wParam)
+        {
+            HtmlUI_Restore();
+        }
         break;
 
     case WM_NOTIFY:
@@ -1548,7 +2161,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         int priority = (int)wParam;
         TCHAR* log = (TCHAR*)lParam;
         HtmlUI_AddLog(priority, log);
-        auto timestamp = UTF8ToWString(psicash::datetime::DateTime::Now().ToISO8601() + ": ");
+        const wstring& timestamp = UTF8ToWStringTemp(psicash::datetime::DateTime::Now().ToISO8601() + ": ");
         OutputDebugString(timestamp.c_str());
         OutputDebugString(log);
         OutputDebugString(L"\n");
@@ -1564,15 +2177,60 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         my_print(NOT_SENSITIVE, false, _T("Failed to send feedback."));
         break;
 
+    case WM_POWERBROADCAST:
+        if (wParam == PBT_APMSUSPEND)
+        {
+            // Nothing to show while asleep
+            ::KillTimer(hWnd, TIMER_ID_METRICS);
+            g_connectionManager.Suspend();
+        }
+        else if (wParam == PBT_APMRESUMEAUTOMATIC)
+        {
+            // Sent on every resume, whether or not there's a user to see it
+            InvalidateHostEnvironment(HOST_ENVIRONMENT_NETWORK);
+            ServerStats::NoteNetworkChange();
+            g_connectionManager.Resume();
+            if (g_htmlUiReady)
+            {
+                g_unchangedMetricsSamples = 0;
+                SetMetricsTimer(METRICS_UPDATE_INTERVAL_MS);
+            }
+        }
+        return TRUE;
+
+    case WM_SETTINGCHANGE:
+        // lParam names the section that changed, if anything
+        if (lParam && 0 == _tcsicmp((LPCTSTR)lParam, _T("intl")))
+        {
+            InvalidateHostEnvironment(HOST_ENVIRONMENT_LOCALE);
+        }
+        else if (lParam && 0 == _tcsicmp((LPCTSTR)lParam, _T("Environment")))
+        {
+            InvalidateHostEnvironment(HOST_ENVIRONMENT_PATHS);
+        }
+        break;
+
     case WM_ENDSESSION:
         // Stop the tunnel -- particularly to ensure system proxy settings are reverted -- on OS shutdown
         // Note: due to the following bug, the system proxy settings revert may silently fail:
         // https://connect.microsoft.com/IE/feedback/details/838086/internet-explorer-10-11-wininet-api-drops-proxy-change-events-during-system-shutdown
+        // The settings are reverted first thing, as we may be killed before
+        // the orderly stop -- which waits on the core process -- is done.
+        if (wParam)
+        {
+            (void)SystemProxySettings::RevertForShutdown();
+        }
     case WM_DESTROY:
         // Stop transport if running
         g_connectionManager.Stop(STOP_REASON_EXIT);
+        // Write out any pending server list changes
+        ServerList::FlushAll();
         g_htmlUiFinished = true;
-        SaveWindowPlacement();
+        // A headless window was never placed.
+        if (!Headless::IsEnabled())
+        {
+            SaveWindowPlacement();
+        }
         PostQuitMessage(0);
         break;
 
@@ -1640,6 +2298,10 @@ struct PsiCashMessage {
 };
 
 // Initialize the PsiCash library. Must be called after the UI is ready.
+// The init-done message, for a recreated UI; see ReplayPsiCashInit.
+// Only touched by the main window thread.
+static string g_psiCashInitDoneJSON;
+
 void InitPsiCash() {
     PsiCashMessage evt(PsiCashMessageType::INIT_DONE, "");
 
@@ -1670,9 +2332,30 @@ void InitPsiCash() {
         return;
     }
 
+    g_psiCashInitDoneJSON = jsonString;
     HtmlUI_PsiCashMessage(jsonString);
 }
 
+// The library is only initialized once, but a recreated UI needs to be told
+// it's done (and how it went) again.
+void ReplayPsiCashInit() {
+    if (!g_psiCashInitDoneJSON.empty()) {
+        HtmlUI_PsiCashMessage(g_psiCashInitDoneJSON);
+    }
+}
+
+// The UI is always answered from the library's locally cached state; a
+// "hard" refresh revalidates it with the server in the background, no more
+// often than this unless the reason calls for fresh state.
+#define PSICASH_REVALIDATE_MIN_INTERVAL_MS  60000
+
+static Lock g_psiCashRefreshLock("PsiCashRefresh");
+static DWORD g_psiCashLastRevalidateTime = 0;
+static bool g_psiCashRevalidated = false;
+// What the UI was last sent, so unsolicited refreshes are only pushed when
+// something changed.
+static nlohmann::json g_psiCashLastPayload;
+
 nlohmann::json MakeRefreshPsiCashPayload() {
     nlohmann::json res = {
         { "valid_token_types", psicash::Lib::_().ValidTokenTypes() },
@@ -1698,6 +2381,17 @@ void UI_RefreshPsiCash(const string& commandID)
     PsiCashMessage evt(PsiCashMessageType::REFRESH, commandID);
     evt.payload = MakeRefreshPsiCashPayload();
 
+    {
+        AutoLock lock(g_psiCashRefreshLock);
+
+        // A command's reply must always be sent; the UI is waiting on it.
+        if (commandID.empty() && evt.payload == g_psiCashLastPayload) {
+            my_print(NOT_SENSITIVE, true, _T("%s: unchanged; not sent"), __TFUNCTION__);
+            return;
+        }
+        g_psiCashLastPayload = evt.payload;
+    }
+
     string jsonString;
     if (!evt.JSON(jsonString)) {
         my_print(NOT_SENSITIVE, true, _T("%s: PsiCashMessage.JSON failed"), __TFUNCTION__);
@@ -1727,12 +2421,36 @@ bool HandlePsiCashCommand(const string& jsonString)
 
     if (json["command"] == "refresh")
     {
+        string reason = json["reason"].asString();
+
+        // Answer right away with the locally cached info, so the UI doesn't
+        // wait on a round trip through the tunnel.
+        UI_RefreshPsiCash(commandID);
+
+        bool revalidate = false;
         if (CONNECTION_MANAGER_STATE_CONNECTED == g_connectionManager.GetState())
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: hard PsiCash::RefreshState because %S"), __TFUNCTION__, json["reason"].asCString());
+            // After a purchase or a (re)connect, the cached state may well be stale.
+            bool force = (reason == "purchase-response" || reason == "connected-state-change");
+
+            AutoLock lock(g_psiCashRefreshLock);
+            DWORD now = GetTickCount();
+            if (force
+                || !g_psiCashRevalidated
+                || now - g_psiCashLastRevalidateTime >= PSICASH_REVALIDATE_MIN_INTERVAL_MS)
+            {
+                g_psiCashLastRevalidateTime = now;
+                g_psiCashRevalidated = true;
+                revalidate = true;
+            }
+        }
+
+        if (revalidate)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: hard PsiCash::RefreshState because %S"), __TFUNCTION__, reason.c_str());
 
             // We're connected, so ask the server for fresh info
-            psicash::Lib::_().RefreshState([commandID](psicash::error::Result<psicash::Status> result)
+            psicash::Lib::_().RefreshState([](psicash::error::Result<psicash::Status> result)
             {
                 // NOTE: This callback is (likely) _not_ on the same thread as the original call.
 
@@ -1740,17 +2458,15 @@ bool HandlePsiCashCommand(const string& jsonString)
                     my_print(NOT_SENSITIVE, true, _T("%s: PsiCash::RefreshState failed: %S"), __TFUNCTION__, result.error().ToString().c_str());
                 }
 
-                // Refreshing the UI regardless of request result, as there might still
-                // good data cached locally.
-                UI_RefreshPsiCash(commandID);
+                // Pushed only if the state changed from what the UI was
+                // given, regardless of request result, as the local state
+                // may still have changed.
+                UI_RefreshPsiCash("");
             });
         }
         else
         {
-            my_print(NOT_SENSITIVE, true, _T("%s: soft PsiCash::RefreshState because %S"), __TFUNCTION__, json["reason"].asCString());
-
-            // Use locally cached info for the refresh.
-            UI_RefreshPsiCash(commandID);
+            my_print(NOT_SENSITIVE, true, _T("%s: soft PsiCash::RefreshState because %S"), __TFUNCTION__, reason.c_str());
         }
     }
     else if (json["command"] == "purchase")
@@ -37,6 +37,8 @@ extern ConnectionManager g_connectionManager;
 #define WM_PSIPHON_CREATED                      WM_USER + 103
 #define WM_PSIPHON_TRAY_ICON_NOTIFY             WM_USER + 104
 #define WM_PSIPHON_CONNECTED_REMINDER_NOTIFY    WM_USER + 105
+#define WM_PSIPHON_CONNECTION_STATE_CHANGED     WM_USER + 106
+#define WM_PSIPHON_UI_WATCHDOG_PING             WM_USER + 107
 
 
 //==== UI Interaction ==================================================
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "ras_inventory.h"
+#include "raserror.h"
+#include "logging.h"
+
+
+// static
+RasInventory& RasInventory::Instance()
+{
+    static RasInventory instance;
+    return instance;
+}
+
+RasInventory::RasInventory()
+    : m_lock("RasInventory"),
+      m_changedEvent(NULL),
+      m_entriesValid(false),
+      m_connectionsValid(false)
+{
+    // Auto-reset; it's only checked with the lock held.
+    m_changedEvent = CreateEvent(NULL, FALSE, FALSE, 0);
+
+    // INVALID_HANDLE_VALUE means any connection.
+    DWORD returnCode = m_changedEvent
+                        ? RasConnectionNotification(
+                            (HRASCONN)INVALID_HANDLE_VALUE,
+                            m_changedEvent,
+                            RASCN_Connection | RASCN_Disconnection)
+                        : GetLastError();
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: RasConnectionNotification failed (%d); not caching"), __TFUNCTION__, returnCode);
+        if (m_changedEvent)
+        {
+            CloseHandle(m_changedEvent);
+            m_changedEvent = NULL;
+        }
+    }
+}
+
+RasInventory::~RasInventory()
+{
+    if (m_changedEvent)
+    {
+        CloseHandle(m_changedEvent);
+    }
+}
+
+void RasInventory::CheckForChanges()
+{
+    if (!m_changedEvent || WAIT_OBJECT_0 == WaitForSingleObject(m_changedEvent, 0))
+    {
+        m_entriesValid = false;
+        m_connectionsValid = false;
+    }
+}
+
+// static
+vector<tstring> RasInventory::GetEntryNames()
+{
+    RasInventory& inventory = Instance();
+    AutoLock lock(inventory.m_lock);
+
+    inventory.CheckForChanges();
+
+    if (!inventory.m_entriesValid)
+    {
+        inventory.m_entryNames.clear();
+        // Failures aren't cached
+        inventory.m_entriesValid = inventory.EnumEntries(inventory.m_entryNames)
+                                   && inventory.m_changedEvent;
+    }
+
+    return inventory.m_entryNames;
+}
+
+// static
+HRASCONN RasInventory::GetActiveConnection(const tstring& entryName)
+{
+    RasInventory& inventory = Instance();
+    AutoLock lock(inventory.m_lock);
+
+    inventory.CheckForChanges();
+
+    if (!inventory.m_connectionsValid)
+    {
+        inventory.m_connections.clear();
+        inventory.m_connectionsValid = inventory.EnumConnections(inventory.m_connections)
+                                       && inventory.m_changedEvent;
+    }
+
+    for (auto it = inventory.m_connections.begin(); it != inventory.m_connections.end(); ++it)
+    {
+        // Entry names are unique
+        if (it->first == entryName)
+        {
+            return it->second;
+        }
+    }
+
+    return NULL;
+}
+
+// static
+void RasInventory::InvalidateEntries()
+{
+    RasInventory& inventory = Instance();
+    AutoLock lock(inventory.m_lock);
+
+    inventory.m_entriesValid = false;
+}
+
+// static
+void RasInventory::SetPhonebook(const tstring& path)
+{
+    RasInventory& inventory = Instance();
+    AutoLock lock(inventory.m_lock);
+
+    inventory.m_phonebookPath = path;
+    inventory.m_entriesValid = false;
+}
+
+bool RasInventory::EnumEntries(vector<tstring>& o_entryNames)
+{
+    o_entryNames.clear();
+
+    // The RasEnumEntries API requires that we pass in a buffer first
+    // and if the buffer is too small, it tells us how big a buffer it needs.
+    // For the first call we will pass in a single RASENTRYNAME struct.
+    DWORD bufferSize = sizeof(RASENTRYNAME);
+    DWORD entries = 0;
+    DWORD returnCode = ERROR_BUFFER_TOO_SMALL;
+    vector<BYTE> buffer;
+
+    // Retried in case entries are added between the calls
+    for (int attempt = 0; attempt < 3 && ERROR_BUFFER_TOO_SMALL == returnCode; attempt++)
+    {
+        buffer.assign(max(bufferSize, (DWORD)sizeof(RASENTRYNAME)), 0);
+
+        // The first RASENTRYNAME structure in the array must contain the structure size
+        LPRASENTRYNAME rasEntryNames = (LPRASENTRYNAME)&buffer[0];
+        rasEntryNames[0].dwSize = sizeof(RASENTRYNAME);
+
+        returnCode = RasEnumEntries(
+                        0,
+                        m_phonebookPath.empty() ? 0 : m_phonebookPath.c_str(),
+                        rasEntryNames,
+                        &bufferSize,
+                        &entries);
+    }
+
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, false, _T("failed to enumerate RAS connections (%d)"), returnCode);
+        return false;
+    }
+
+    LPRASENTRYNAME rasEntryNames = (LPRASENTRYNAME)&buffer[0];
+    for (DWORD i = 0; i < entries; i++)
+    {
+        o_entryNames.push_back(rasEntryNames[i].szEntryName);
+    }
+
+    return true;
+}
+
+bool RasInventory::EnumConnections(vector<pair<tstring, HRASCONN>>& o_connections)
+{
+    o_connections.clear();
+
+    // On Windows XP, we can't call RasEnumConnections with rasConnections = 0 because it
+    // fails with 632 ERROR_INVALID_SIZE.  So we pass a single RASCONN first, and size
+    // the buffer from what it tells us.
+    DWORD bufferSize = sizeof(RASCONN);
+    DWORD connections = 0;
+    DWORD returnCode = ERROR_BUFFER_TOO_SMALL;
+    vector<BYTE> buffer;
+
+    // Retried in case a connection is added between the calls
+    for (int attempt = 0; attempt < 3 && ERROR_BUFFER_TOO_SMALL == returnCode; attempt++)
+    {
+        // See "A fix to work with older versions of Windows"
+        if (bufferSize < (connections * sizeof(RASCONN)))
+        {
+            bufferSize = connections * sizeof(RASCONN);
+        }
+        buffer.assign(max(bufferSize, (DWORD)sizeof(RASCONN)), 0);
+
+        // The first RASCONN structure in the array must contain the RASCONN structure size
+        LPRASCONN rasConnections = (LPRASCONN)&buffer[0];
+        rasConnections[0].dwSize = sizeof(RASCONN);
+
+        returnCode = RasEnumConnections(rasConnections, &bufferSize, &connections);
+    }
+
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, false, _T("RasEnumConnections failed (%d)"), returnCode);
+        return false;
+    }
+
+    LPRASCONN rasConnections = (LPRASCONN)&buffer[0];
+    for (DWORD i = 0; i < connections; i++)
+    {
+        o_connections.push_back(make_pair(tstring(rasConnections[i].szEntryName), rasConnections[i].hrasconn));
+    }
+
+    return true;
+}
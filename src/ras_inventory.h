@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "ras.h"
+#include "utilities.h"
+
+
+/*
+Process-wide cache of the RAS phonebook entries (dial-up, VPN, etc.) and
+active RAS connections, as enumerating them can take a long time on systems
+with many entries.
+
+The cache is dropped whenever a RAS connection is made or ended, as notified
+by RasConnectionNotification. Phonebook changes aren't notified, so code that
+adds or removes an entry must call InvalidateEntries; entries changed from
+outside the app are picked up on the next connection event.
+
+Threadsafe.
+*/
+class RasInventory
+{
+public:
+    // Names of all phonebook entries. Empty on failure.
+    static vector<tstring> GetEntryNames();
+
+    // The active connection for the named entry, or NULL if there isn't one.
+    static HRASCONN GetActiveConnection(const tstring& entryName);
+
+    static void InvalidateEntries();
+
+    // Enumerates the entries of the phonebook at path in place of the
+    // system's; empty for the system's again. For SystemProxyBenchmark.
+    static void SetPhonebook(const tstring& path);
+
+private:
+    RasInventory();
+    ~RasInventory();
+    static RasInventory& Instance();
+
+    // Must be called with m_lock held
+    void CheckForChanges();
+    bool EnumEntries(vector<tstring>& o_entryNames);
+    bool EnumConnections(vector<pair<tstring, HRASCONN>>& o_connections);
+
+private:
+    Lock m_lock;
+    // Set on connection events. NULL if notification isn't available, in
+    // which case nothing is cached.
+    HANDLE m_changedEvent;
+    bool m_entriesValid;
+    vector<tstring> m_entryNames;
+    // Empty for the system's
+    tstring m_phonebookPath;
+    bool m_connectionsValid;
+    vector<pair<tstring, HRASCONN>> m_connections;
+};
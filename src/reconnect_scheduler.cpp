@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include <WinSock2.h>
+#include <iphlpapi.h>
+#include "reconnect_scheduler.h"
+#include "logging.h"
+#include "utilities.h"
+#include "serverlist.h"
+
+#pragma comment(lib, "iphlpapi.lib")
+
+
+// The first retry waits 1-2 seconds, as the connection loop always has.
+// Each consecutive failure doubles that, up to the max (plus jitter).
+#define RECONNECT_BASE_BACKOFF_MS           1000
+#define RECONNECT_MAX_BACKOFF_MS            16000
+// In case an address change notification is missed
+#define OFFLINE_RECHECK_INTERVAL_MS         30000
+
+
+ReconnectScheduler::ReconnectScheduler()
+    : m_addrChangePending(false),
+      m_consecutiveFailures(0)
+{
+    m_addrChangeEvent = CreateEvent(
+                            NULL,
+                            TRUE,  // manual reset
+                            FALSE, // initial state
+                            0);
+
+    m_wakeEvent = CreateEvent(
+                        NULL,
+                        FALSE, // auto reset
+                        FALSE, // initial state
+                        0);
+
+    StartAddrChangeNotification();
+}
+
+ReconnectScheduler::~ReconnectScheduler()
+{
+    if (m_addrChangePending)
+    {
+        // CancelIPChangeNotify isn't available on XP. There, the notification
+        // is left pending -- along with the event and OVERLAPPED it refers
+        // to, which is why this object should live as long as the process.
+        typedef BOOL (WINAPI *CANCELIPCHANGENOTIFYFN)(LPOVERLAPPED notifyOverlapped);
+        CANCELIPCHANGENOTIFYFN pfnCancelIPChangeNotify = NULL;
+
+        HMODULE hIphlpapi = GetModuleHandle(_T("iphlpapi.dll"));
+        if (hIphlpapi)
+        {
+            pfnCancelIPChangeNotify = (CANCELIPCHANGENOTIFYFN)GetProcAddress(hIphlpapi, "CancelIPChangeNotify");
+        }
+
+        if (!pfnCancelIPChangeNotify || !pfnCancelIPChangeNotify(&m_addrChangeOverlapped))
+        {
+            return;
+        }
+
+        m_addrChangePending = false;
+    }
+
+    CloseHandle(m_addrChangeEvent);
+    if (m_wakeEvent)
+    {
+        CloseHandle(m_wakeEvent);
+    }
+}
+
+void ReconnectScheduler::Reset()
+{
+    m_consecutiveFailures = 0;
+}
+
+void ReconnectScheduler::Wake()
+{
+    if (m_wakeEvent)
+    {
+        SetEvent(m_wakeEvent);
+    }
+}
+
+void ReconnectScheduler::StartAddrChangeNotification()
+{
+    assert(!m_addrChangePending);
+
+    if (!m_addrChangeEvent)
+    {
+        return;
+    }
+
+    ResetEvent(m_addrChangeEvent);
+
+    memset(&m_addrChangeOverlapped, 0, sizeof(m_addrChangeOverlapped));
+    m_addrChangeOverlapped.hEvent = m_addrChangeEvent;
+
+    HANDLE notifyHandle = NULL;
+    DWORD result = NotifyAddrChange(&notifyHandle, &m_addrChangeOverlapped);
+    if (result != ERROR_IO_PENDING)
+    {
+        // We'll still back off and notice when we're back online; just not
+        // as quickly.
+        my_print(NOT_SENSITIVE, true, _T("%s: NotifyAddrChange failed (%d)"), __TFUNCTION__, result);
+        return;
+    }
+
+    m_addrChangePending = true;
+}
+
+void ReconnectScheduler::WaitForNextAttempt(const StopInfo& stopInfo)
+{
+    DWORD backoff = RECONNECT_BASE_BACKOFF_MS << min(m_consecutiveFailures, 16u);
+    backoff = min(backoff, (DWORD)RECONNECT_MAX_BACKOFF_MS);
+    DWORD delay = backoff + rand() % backoff;
+
+    m_consecutiveFailures++;
+
+    DWORD startTime = GetTickCount();
+    bool addrChanged = false;
+    bool offlineReported = false;
+
+    while (true)
+    {
+        DWORD timeout = 0;
+
+        if (!IsNetworkAvailable())
+        {
+            if (!offlineReported)
+            {
+                my_print(NOT_SENSITIVE, false, _T("Waiting for a network connection..."));
+                offlineReported = true;
+            }
+
+            timeout = OFFLINE_RECHECK_INTERVAL_MS;
+        }
+        else if (addrChanged)
+        {
+            // A new network may well work where the old one didn't, so
+            // start over from the shortest backoff. The same goes for Wake.
+            my_print(NOT_SENSITIVE, true, _T("%s: network changed; retrying now"), __TFUNCTION__);
+            m_consecutiveFailures = 0;
+            return;
+        }
+        else if (offlineReported)
+        {
+            // Back online after waiting; no point waiting any longer.
+            return;
+        }
+        else
+        {
+            // Note: GetTickCount wraps after 49 days; unsigned subtraction
+            // still gives the right elapsed time.
+            DWORD elapsed = GetTickCount() - startTime;
+            if (elapsed >= delay)
+            {
+                return;
+            }
+
+            timeout = delay - elapsed;
+        }
+
+        HANDLE waitHandles[3];
+        DWORD waitHandlesCount = 0;
+        waitHandles[waitHandlesCount++] = stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons);
+        DWORD wakeIndex = MAXIMUM_WAIT_OBJECTS;
+        if (m_wakeEvent)
+        {
+            wakeIndex = waitHandlesCount;
+            waitHandles[waitHandlesCount++] = m_wakeEvent;
+        }
+        DWORD addrChangeIndex = MAXIMUM_WAIT_OBJECTS;
+        if (m_addrChangePending)
+        {
+            addrChangeIndex = waitHandlesCount;
+            waitHandles[waitHandlesCount++] = m_addrChangeEvent;
+        }
+
+        DWORD result = WaitForMultipleObjects(waitHandlesCount, waitHandles, FALSE, timeout);
+
+        if (result == WAIT_OBJECT_0)
+        {
+            // The caller will find out why.
+            return;
+        }
+        else if (result == WAIT_OBJECT_0 + wakeIndex)
+        {
+            // Treated like a network change: retried as soon as there's a
+            // network.
+            addrChanged = true;
+        }
+        else if (result == WAIT_OBJECT_0 + addrChangeIndex)
+        {
+            m_addrChangePending = false;
+            addrChanged = true;
+            InvalidateHostEnvironment(HOST_ENVIRONMENT_NETWORK);
+            ServerStats::NoteNetworkChange();
+            StartAddrChangeNotification();
+        }
+        else if (result == WAIT_FAILED)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: WaitForMultipleObjects failed (%d)"), __TFUNCTION__, GetLastError());
+            Sleep(delay);
+            return;
+        }
+    }
+}
+
+// static
+bool ReconnectScheduler::IsNetworkAvailable()
+{
+    ULONG flags = GAA_FLAG_SKIP_ANYCAST | GAA_FLAG_SKIP_MULTICAST | GAA_FLAG_SKIP_DNS_SERVER;
+
+    // 15KB is the size recommended by MSDN, and enough for almost all machines.
+    ULONG bufferSize = 15 * 1024;
+    vector<BYTE> buffer;
+    ULONG result = ERROR_BUFFER_OVERFLOW;
+    for (int i = 0; i < 3 && result == ERROR_BUFFER_OVERFLOW; i++)
+    {
+        buffer.resize(bufferSize);
+        result = GetAdaptersAddresses(AF_UNSPEC, flags, NULL, (PIP_ADAPTER_ADDRESSES)&buffer[0], &bufferSize);
+    }
+
+    if (result != ERROR_SUCCESS)
+    {
+        // If we can't tell, don't stop trying to connect.
+        return true;
+    }
+
+    for (PIP_ADAPTER_ADDRESSES adapter = (PIP_ADAPTER_ADDRESSES)&buffer[0];
+         adapter != NULL;
+         adapter = adapter->Next)
+    {
+        // Loopback and tunnel (e.g., Teredo, ISATAP) adapters are up even
+        // when there's no network.
+        if (adapter->OperStatus == IfOperStatusUp
+            && adapter->IfType != IF_TYPE_SOFTWARE_LOOPBACK
+            && adapter->IfType != IF_TYPE_TUNNEL
+            && adapter->FirstUnicastAddress != NULL)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
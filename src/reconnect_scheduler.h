@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Decides when the connection loop should make its next attempt. Failed
+attempts back off exponentially (with jitter); a change to the machine's IP
+addresses -- e.g., a cable plugged in or a Wi-Fi network joined -- cuts the
+wait short; and while no network adapter is up there's no retrying at all.
+
+Not threadsafe. It's meant to be used by the connection thread only.
+*/
+class ReconnectScheduler
+{
+public:
+    ReconnectScheduler();
+    virtual ~ReconnectScheduler();
+
+    // Call once a connection has been established, so that the next
+    // disconnect is retried promptly.
+    void Reset();
+
+    // Blocks until the next connection attempt should be made. Returns early
+    // if the stop signal is set; the caller must check for that itself.
+    void WaitForNextAttempt(const StopInfo& stopInfo);
+
+    // Cuts a current (or the next) wait short, once the network is up, and
+    // starts over from the shortest backoff; e.g., on resume from sleep.
+    // Unlike the rest, this may be called from any thread.
+    void Wake();
+
+private:
+    void StartAddrChangeNotification();
+    static bool IsNetworkAvailable();
+
+private:
+    HANDLE m_addrChangeEvent;
+    HANDLE m_wakeEvent;
+    OVERLAPPED m_addrChangeOverlapped;
+    bool m_addrChangePending;
+    unsigned int m_consecutiveFailures;
+};
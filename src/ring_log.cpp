@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "ring_log.h"
+#include "logging.h"
+#include "utilities.h"
+#include "config.h"
+
+
+#define RING_LOG_MAGIC              0x474F4C52 // "RLOG"
+#define RING_LOG_VERSION            1
+// Several sessions' worth of ordinary logging
+#define RING_LOG_DATA_BYTES         (1024 * 1024)
+// The header is padded out to this, so the records start aligned
+#define RING_LOG_HEADER_BYTES       64
+// Longer records (e.g., some diagnostic JSON) are truncated
+#define RING_LOG_MAX_TEXT_BYTES     8192
+// Records start at multiples of this
+#define RING_LOG_ALIGNMENT          8
+
+// Positions are counts of bytes ever written, so they don't wrap; a record
+// at position p is at offset (p % dataBytes) in the data.
+struct RingLogHeader
+{
+    DWORD magic;
+    DWORD version;
+    DWORD dataBytes;
+    // Set by RingLogStop; a log that's still 0 is from a session that crashed
+    volatile LONG cleanExit;
+    FILETIME sessionStartTime;
+    // Position of the oldest record. Moved past a record before it's
+    // overwritten.
+    volatile ULONGLONG tail;
+    // Position after the newest record. Moved past a record only once it's
+    // been written.
+    volatile ULONGLONG head;
+};
+static_assert(sizeof(RingLogHeader) <= RING_LOG_HEADER_BYTES, "ring log header too big");
+
+// Records never run past the end of the data: what's left is skipped with a
+// padding record, or without one if there's no room for one.
+struct RingLogRecord
+{
+    // Including this header and the padding to the next record
+    DWORD length;
+    BYTE type;
+    BYTE debug;
+    WORD textBytes;
+    FILETIME time;
+    // Followed by the text
+};
+static_assert(sizeof(RingLogRecord) % RING_LOG_ALIGNMENT == 0, "ring log record misaligned");
+
+
+static Lock g_ringLogLock("RingLog");
+static HANDLE g_ringLogFile = INVALID_HANDLE_VALUE;
+static HANDLE g_ringLogMapping = NULL;
+// Set once the log is mapped, and only then written to
+static RingLogHeader* volatile g_ringLogHeader = NULL;
+
+
+static inline BYTE* RingLogData(RingLogHeader* header)
+{
+    return (BYTE*)header + RING_LOG_HEADER_BYTES;
+}
+
+// Records are timestamped as they're written, but only formatted if there's a
+// crash to report.
+static string FileTimeToISO8601(const FILETIME& fileTime)
+{
+    SYSTEMTIME time;
+    if (!FileTimeToSystemTime(&fileTime, &time))
+    {
+        return "";
+    }
+
+    char ret[64];
+    _snprintf_s(
+        ret,
+        sizeof(ret),
+        _TRUNCATE,
+        "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+        time.wYear, time.wMonth, time.wDay,
+        time.wHour, time.wMinute, time.wSecond, time.wMilliseconds);
+    return ret;
+}
+
+// The records of a log file, oldest first. Everything read is checked, as
+// the writer may have been stopped at any point.
+static bool DecodeRingLog(const string& contents, Json::Value& o_json)
+{
+    if (contents.length() < RING_LOG_HEADER_BYTES)
+    {
+        return false;
+    }
+
+    const RingLogHeader* header = (const RingLogHeader*)contents.data();
+    const BYTE* data = (const BYTE*)contents.data() + RING_LOG_HEADER_BYTES;
+    ULONGLONG dataBytes = header->dataBytes;
+    if (header->magic != RING_LOG_MAGIC
+        || header->version != RING_LOG_VERSION
+        || dataBytes < sizeof(RingLogRecord)
+        || dataBytes % RING_LOG_ALIGNMENT != 0
+        || contents.length() < RING_LOG_HEADER_BYTES + dataBytes
+        || header->head < header->tail
+        || header->head - header->tail > dataBytes)
+    {
+        return false;
+    }
+
+    Json::Value records(Json::arrayValue);
+
+    ULONGLONG position = header->tail;
+    while (position < header->head)
+    {
+        ULONGLONG offset = position % dataBytes;
+        if (dataBytes - offset < sizeof(RingLogRecord))
+        {
+            position += dataBytes - offset;
+            continue;
+        }
+
+        const RingLogRecord* record = (const RingLogRecord*)(data + offset);
+        if (record->length < sizeof(RingLogRecord)
+            || record->length > dataBytes - offset
+            || record->length % RING_LOG_ALIGNMENT != 0
+            || record->textBytes > record->length - sizeof(RingLogRecord))
+        {
+            // What's left can't be trusted
+            break;
+        }
+        position += record->length;
+
+        const char* text = (const char*)(record + 1);
+        string formatted;
+        if (record->type == RING_LOG_RECORD_MESSAGE || record->type == RING_LOG_RECORD_DIAGNOSTIC)
+        {
+            formatted.assign(text, record->textBytes);
+        }
+        else if (record->type == RING_LOG_RECORD_STRUCTURED)
+        {
+            // Formatted only now that there's a crash to report
+            const char* messageEnd = (const char*)memchr(text, '\0', record->textBytes);
+            if (!messageEnd)
+            {
+                continue;
+            }
+            formatted.assign(text, messageEnd - text);
+            (void)_LogFormatArgs(messageEnd + 1, record->textBytes - (messageEnd + 1 - text), formatted);
+        }
+        else
+        {
+            continue;
+        }
+
+        Json::Value entry;
+        entry["timestamp!!timestamp"] = FileTimeToISO8601(record->time);
+        entry["type"] = (record->type == RING_LOG_RECORD_DIAGNOSTIC) ? "diagnostic" : "message";
+        entry["debug"] = record->debug != 0;
+        entry["text"] = formatted;
+        records.append(entry);
+    }
+
+    o_json = Json::Value(Json::objectValue);
+    o_json["sessionStart!!timestamp"] = FileTimeToISO8601(header->sessionStartTime);
+    o_json["records"] = records;
+    return true;
+}
+
+static bool GetRingLogPaths(tstring& o_path, tstring& o_crashedPath)
+{
+    tstring dataDirectory;
+    if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, true, dataDirectory))
+    {
+        return false;
+    }
+
+    o_path = (filesystem::path(dataDirectory) / LOCAL_SETTINGS_APPDATA_RING_LOG_FILENAME).wstring();
+    o_crashedPath = (filesystem::path(dataDirectory) / LOCAL_SETTINGS_APPDATA_CRASHED_RING_LOG_FILENAME).wstring();
+    return true;
+}
+
+void RingLogStart()
+{
+    tstring path, crashedPath;
+    if (!GetRingLogPaths(path, crashedPath))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: GetDataPath failed"), __TFUNCTION__);
+        return;
+    }
+
+    // Set aside the last session's log if it didn't end cleanly; a log that
+    // did is simply reused.
+    string previous;
+    if (ReadFileContents(path, previous)
+        && previous.length() >= RING_LOG_HEADER_BYTES
+        && ((const RingLogHeader*)previous.data())->magic == RING_LOG_MAGIC
+        && !((const RingLogHeader*)previous.data())->cleanExit)
+    {
+        if (!MoveFileEx(path.c_str(), crashedPath.c_str(), MOVEFILE_REPLACE_EXISTING))
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: MoveFileEx failed (%d)"), __TFUNCTION__, GetLastError());
+        }
+    }
+    previous.clear();
+
+    HANDLE file = CreateFile(
+                    path.c_str(),
+                    GENERIC_READ | GENERIC_WRITE,
+                    FILE_SHARE_READ,
+                    NULL,
+                    OPEN_ALWAYS,
+                    FILE_ATTRIBUTE_NORMAL,
+                    NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateFile failed (%d)"), __TFUNCTION__, GetLastError());
+        return;
+    }
+
+    // CreateFileMapping extends the file to the mapping size
+    HANDLE mapping = CreateFileMapping(
+                        file,
+                        NULL,
+                        PAGE_READWRITE,
+                        0,
+                        RING_LOG_HEADER_BYTES + RING_LOG_DATA_BYTES,
+                        NULL);
+    if (!mapping)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateFileMapping failed (%d)"), __TFUNCTION__, GetLastError());
+        CloseHandle(file);
+        return;
+    }
+
+    RingLogHeader* header = (RingLogHeader*)MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+    if (!header)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: MapViewOfFile failed (%d)"), __TFUNCTION__, GetLastError());
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return;
+    }
+
+    // Always started afresh; the records are only of use if there's a crash.
+    // Only the header needs clearing: nothing before the tail is read.
+    ZeroMemory(header, RING_LOG_HEADER_BYTES);
+    header->magic = RING_LOG_MAGIC;
+    header->version = RING_LOG_VERSION;
+    header->dataBytes = RING_LOG_DATA_BYTES;
+    GetSystemTimeAsFileTime(&header->sessionStartTime);
+
+    AutoLock lock(g_ringLogLock);
+    g_ringLogFile = file;
+    g_ringLogMapping = mapping;
+    g_ringLogHeader = header;
+}
+
+void RingLogStop()
+{
+    AutoLock lock(g_ringLogLock);
+
+    if (!g_ringLogHeader)
+    {
+        return;
+    }
+
+    InterlockedExchange(&g_ringLogHeader->cleanExit, TRUE);
+
+    UnmapViewOfFile(g_ringLogHeader);
+    CloseHandle(g_ringLogMapping);
+    CloseHandle(g_ringLogFile);
+    g_ringLogHeader = NULL;
+    g_ringLogMapping = NULL;
+    g_ringLogFile = INVALID_HANDLE_VALUE;
+}
+
+// Moves the tail past the oldest records until there's room for bytes
+// more at head. Must be called with g_ringLogLock held.
+static void RingLogMakeRoom(RingLogHeader* header, ULONGLONG head, DWORD bytes)
+{
+    BYTE* data = RingLogData(header);
+    ULONGLONG tail = header->tail;
+
+    while (head + bytes - tail > RING_LOG_DATA_BYTES)
+    {
+        ULONGLONG offset = tail % RING_LOG_DATA_BYTES;
+        if (RING_LOG_DATA_BYTES - offset < sizeof(RingLogRecord))
+        {
+            tail += RING_LOG_DATA_BYTES - offset;
+            continue;
+        }
+
+        const RingLogRecord* record = (const RingLogRecord*)(data + offset);
+        if (record->length < sizeof(RingLogRecord) || record->length > RING_LOG_DATA_BYTES - offset)
+        {
+            // Can't happen, but there's no way past it if it does but to
+            // drop everything.
+            tail = head;
+            break;
+        }
+        tail += record->length;
+    }
+
+    header->tail = tail;
+}
+
+void RingLogWrite(RingLogRecordType type, bool debug, const char* text, size_t length)
+{
+    if (!g_ringLogHeader)
+    {
+        return;
+    }
+
+    if (length > RING_LOG_MAX_TEXT_BYTES)
+    {
+        // Not splitting a UTF-8 sequence
+        length = RING_LOG_MAX_TEXT_BYTES;
+        while (length > 0 && (text[length] & 0xC0) == 0x80)
+        {
+            length--;
+        }
+    }
+    DWORD recordBytes = (DWORD)((sizeof(RingLogRecord) + length + RING_LOG_ALIGNMENT - 1)
+                                & ~(size_t)(RING_LOG_ALIGNMENT - 1));
+
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+
+    AutoLock lock(g_ringLogLock);
+
+    RingLogHeader* header = g_ringLogHeader;
+    if (!header)
+    {
+        return;
+    }
+    BYTE* data = RingLogData(header);
+
+    ULONGLONG head = header->head;
+    DWORD offset = (DWORD)(head % RING_LOG_DATA_BYTES);
+
+    if (RING_LOG_DATA_BYTES - offset < recordBytes)
+    {
+        DWORD skipBytes = RING_LOG_DATA_BYTES - offset;
+        RingLogMakeRoom(header, head, skipBytes);
+        if (skipBytes >= sizeof(RingLogRecord))
+        {
+            RingLogRecord* padding = (RingLogRecord*)(data + offset);
+            padding->length = skipBytes;
+            padding->type = RING_LOG_RECORD_PADDING;
+            padding->debug = 0;
+            padding->textBytes = 0;
+        }
+        head += skipBytes;
+        header->head = head;
+        offset = 0;
+    }
+
+    RingLogMakeRoom(header, head, recordBytes);
+
+    RingLogRecord* record = (RingLogRecord*)(data + offset);
+    record->length = recordBytes;
+    record->type = (BYTE)type;
+    record->debug = debug ? 1 : 0;
+    record->textBytes = (WORD)length;
+    record->time = now;
+    memcpy(record + 1, text, length);
+
+    // The header fields are volatile, so this store isn't reordered before
+    // the record's.
+    header->head = head + recordBytes;
+}
+
+bool GetCrashedSessionRingLog(Json::Value& o_json)
+{
+    tstring path, crashedPath;
+    string contents;
+    if (!GetRingLogPaths(path, crashedPath)
+        || !ReadFileContents(crashedPath, contents))
+    {
+        return false;
+    }
+
+    return DecodeRingLog(contents, o_json);
+}
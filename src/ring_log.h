@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+/*
+A small rolling log, kept in a memory-mapped file in the data directory, of
+what goes into the in-memory message and diagnostic histories. It's there so
+that when the app crashes -- or is killed -- there's still a record of what
+that session was doing: the dirty pages belong to the OS, which writes them
+out whether or not the process ever gets to.
+
+The file is a fixed-size ring; the oldest records are overwritten. A session
+that doesn't end with RingLogStop leaves its file flagged unclean, and the
+next session keeps it aside, to be included with feedback.
+
+Writing a record is a copy into the mapped view; nothing is flushed.
+Threadsafe.
+*/
+
+// Maps this session's log, first setting aside the previous session's if it
+// didn't end cleanly. Must only be done by the single running instance.
+// Logging works as before if this fails, just without the file.
+void RingLogStart();
+// Marks the log as cleanly ended and unmaps it, as the app exits.
+void RingLogStop();
+
+enum RingLogRecordType
+{
+    RING_LOG_RECORD_PADDING = 0,
+    RING_LOG_RECORD_MESSAGE,
+    RING_LOG_RECORD_DIAGNOSTIC,
+    // The message, a NUL, and the arguments as _LogEncodeArgs encodes them
+    RING_LOG_RECORD_STRUCTURED
+};
+
+// Appends a record; text is UTF-8, and is truncated if it's very long.
+// Does nothing if the log isn't mapped.
+void RingLogWrite(RingLogRecordType type, bool debug, const char* text, size_t length);
+
+// The session start time and records, oldest first, of the last session that
+// didn't end cleanly. False if there's no such log, or it's unreadable.
+bool GetCrashedSessionRingLog(Json::Value& o_json);
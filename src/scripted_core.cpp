@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "scripted_core.h"
+#include "logging.h"
+#include "utilities.h"
+
+
+// Given to the stand-in, in place of the core's --config and --serverList
+// (which it ignores)
+#define SCRIPTED_CORE_STAND_IN_OPTION       L"--scripted-core-stand-in"
+#define SCRIPTED_CORE_SPEED_OPTION          L"--speed"
+
+// Set by IsStandIn in the stand-in, and by Enable in the client
+static bool g_scriptedCoreEnabled = false;
+static tstring g_scriptedCoreScriptPath;
+static double g_scriptedCoreSpeed = 1.0;
+
+
+// The time of a core notice, from its "timestamp" (RFC 3339, as the core
+// writes them), in milliseconds. Returns false if it has none.
+static bool GetNoticeTime(const string& notice, unsigned long long& o_milliseconds)
+{
+    static const char TIMESTAMP_FIELD[] = "\"timestamp\":\"";
+
+    size_t start = notice.find(TIMESTAMP_FIELD);
+    if (start == string::npos)
+    {
+        return false;
+    }
+    const char* timestamp = notice.c_str() + start + sizeof(TIMESTAMP_FIELD) - 1;
+
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    int length = 0;
+    if (6 != sscanf_s(timestamp, "%4d-%2d-%2dT%2d:%2d:%2d%n", &year, &month, &day, &hour, &minute, &second, &length))
+    {
+        return false;
+    }
+
+    // Fractional seconds, to the millisecond. The zone is the same for a
+    // whole recording, so it doesn't matter.
+    unsigned int milliseconds = 0;
+    const char* fraction = timestamp + length;
+    if (*fraction == '.')
+    {
+        unsigned int scale = 100;
+        for (fraction++; isdigit((unsigned char)*fraction); fraction++)
+        {
+            milliseconds += (*fraction - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    SYSTEMTIME systemTime;
+    ZeroMemory(&systemTime, sizeof(systemTime));
+    systemTime.wYear = (WORD)year;
+    systemTime.wMonth = (WORD)month;
+    systemTime.wDay = (WORD)day;
+    systemTime.wHour = (WORD)hour;
+    systemTime.wMinute = (WORD)minute;
+    systemTime.wSecond = (WORD)second;
+
+    FILETIME fileTime;
+    if (!SystemTimeToFileTime(&systemTime, &fileTime))
+    {
+        return false;
+    }
+
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = fileTime.dwLowDateTime;
+    ticks.HighPart = fileTime.dwHighDateTime;
+    o_milliseconds = ticks.QuadPart / 10000 + milliseconds;
+    return true;
+}
+
+// The notice lines of a script
+static vector<string> GetScriptNotices(const string& script)
+{
+    vector<string> notices;
+
+    size_t start = 0;
+    while (start < script.length())
+    {
+        size_t end = script.find('\n', start);
+        if (end == string::npos)
+        {
+            end = script.length();
+        }
+
+        size_t first = script.find_first_not_of(" \t", start);
+        size_t last = script.find_last_not_of(" \t\r", end - 1);
+        if (first != string::npos && first < end && last != string::npos && last >= first && script[first] == '{')
+        {
+            notices.push_back(script.substr(first, last - first + 1));
+        }
+
+        start = end + 1;
+    }
+
+    return notices;
+}
+
+// The core notices of a feedback diagnostic dump, in the order they were
+// recorded. Returns false if script isn't a diagnostic dump.
+static bool GetDiagnosticDumpNotices(const string& script, vector<string>& o_notices)
+{
+    Json::Value root;
+    Json::Reader reader;
+    if (!reader.parse(script, root, false)
+        || !root.isObject()
+        || !root.isMember("DiagnosticInfo")
+        || !root["DiagnosticInfo"].isObject()
+        || !root["DiagnosticInfo"]["DiagnosticHistory"].isArray())
+    {
+        return false;
+    }
+
+    const Json::Value& history = root["DiagnosticInfo"]["DiagnosticHistory"];
+
+    // The core's notices are re-serialized, as one line each.
+    Json::FastWriter jsonWriter;
+    for (Json::Value::ArrayIndex i = 0; i < history.size(); i++)
+    {
+        const Json::Value& record = history[i];
+        if (!record.isObject()
+            || !record["msg"].isString()
+            || record["msg"].asString() != "CoreNotice"
+            || !record["data"].isObject())
+        {
+            continue;
+        }
+
+        string notice = jsonWriter.write(record["data"]);
+        while (!notice.empty() && isspace((unsigned char)notice.back()))
+        {
+            notice.pop_back();
+        }
+        o_notices.push_back(notice);
+    }
+
+    return true;
+}
+
+// static
+bool ScriptedCore::IsStandIn()
+{
+    int argc = 0;
+    LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+    if (!argv)
+    {
+        return false;
+    }
+    auto freeArgv = finally([argv] { (void)LocalFree(argv); });
+
+    bool standIn = false;
+    for (int i = 1; i < argc; i++)
+    {
+        wstring arg = argv[i];
+        wstring::size_type equals = arg.find(L'=');
+        wstring name = arg.substr(0, equals);
+        wstring value = equals == arg.npos ? L"" : arg.substr(equals + 1);
+
+        if (name == SCRIPTED_CORE_STAND_IN_OPTION)
+        {
+            standIn = true;
+            g_scriptedCoreScriptPath = value;
+        }
+        else if (name == SCRIPTED_CORE_SPEED_OPTION)
+        {
+            g_scriptedCoreSpeed = wcstod(value.c_str(), NULL);
+        }
+    }
+
+    return standIn;
+}
+
+// static
+int ScriptedCore::RunStandIn()
+{
+    string script;
+    if (!ReadFileContents(g_scriptedCoreScriptPath, script))
+    {
+        return 1;
+    }
+
+    HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (!output || output == INVALID_HANDLE_VALUE)
+    {
+        return 1;
+    }
+
+    vector<string> notices;
+    if (!GetDiagnosticDumpNotices(script, notices))
+    {
+        notices = GetScriptNotices(script);
+    }
+
+    DWORD start = GetTickCount();
+    bool timed = false;
+    unsigned long long firstTime = 0, time = 0;
+
+    for (auto& notice : notices)
+    {
+        unsigned long long noticeTime = 0;
+        if (GetNoticeTime(notice, noticeTime))
+        {
+            if (!timed)
+            {
+                firstTime = noticeTime;
+                timed = true;
+            }
+            // Out of order notices are written at once.
+            time = max(time, noticeTime - min(noticeTime, firstTime));
+        }
+
+        if (g_scriptedCoreSpeed > 0)
+        {
+            DWORD due = (DWORD)(time / g_scriptedCoreSpeed);
+            DWORD elapsed = GetTickCount() - start;
+            if (due > elapsed)
+            {
+                Sleep(due - elapsed);
+            }
+        }
+
+        notice += '\n';
+        DWORD written = 0;
+        if (!WriteFile(output, notice.data(), (DWORD)notice.length(), &written, NULL))
+        {
+            // The client has gone
+            return 0;
+        }
+    }
+
+    // As a connected core does, until it's stopped
+    Sleep(INFINITE);
+    return 0;
+}
+
+// static
+void ScriptedCore::Enable(const tstring& scriptPath, double speed)
+{
+    g_scriptedCoreEnabled = true;
+    g_scriptedCoreScriptPath = scriptPath;
+    g_scriptedCoreSpeed = speed;
+}
+
+// static
+bool ScriptedCore::IsEnabled()
+{
+    return g_scriptedCoreEnabled;
+}
+
+// static
+tstring ScriptedCore::GetStandInPath()
+{
+    TCHAR filename[1000];
+    if (!GetModuleFileName(NULL, filename, 1000))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: GetModuleFileName failed (%d)"), __TFUNCTION__, GetLastError());
+        return _T("");
+    }
+    return filename;
+}
+
+// static
+tstring ScriptedCore::GetStandInArguments()
+{
+    tstringstream arguments;
+    arguments << _T(" ") << SCRIPTED_CORE_STAND_IN_OPTION << _T("=\"") << g_scriptedCoreScriptPath << _T("\"")
+              << _T(" ") << SCRIPTED_CORE_SPEED_OPTION << _T("=") << g_scriptedCoreSpeed;
+    return arguments.str();
+}
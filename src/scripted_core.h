@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+/*
+A scripted stand-in for the tunnel core, so that connects can be timed
+reproducibly, and without a network:
+
+    psiphon.exe --headless --connect --scripted-core=<script> [--speed=<x>]
+
+or, to run the UI against it, at real or accelerated speed:
+
+    psiphon.exe --scripted-core=<script> [--speed=<x>]
+
+CoreTransport then spawns this same executable in place of the embedded
+core, with the same pipes, job and command line, plus an argument that makes
+it the stand-in. The stand-in does nothing but write the script's notices to
+its stdout, paced by their timestamps, and then waits to be stopped, as a
+connected core does. Nothing listens on the ports the script announces.
+
+A script is a recorded core notice stream, one notice per line, as the core
+writes them, e.g.:
+
+    {"data":{"port":1080},"noticeType":"ListeningSocksProxyPort","showUser":false,"timestamp":"2026-01-01T00:00:00.100Z"}
+    {"data":{"port":8080},"noticeType":"ListeningHttpProxyPort","showUser":false,"timestamp":"2026-01-01T00:00:00.120Z"}
+    {"data":{"count":1},"noticeType":"Tunnels","showUser":false,"timestamp":"2026-01-01T00:00:01.800Z"}
+
+A script can also be a feedback diagnostic dump (with "DiagnosticInfo" at
+its root), in which case its "CoreNotice" records are played, in the order
+they were recorded: e.g., to reproduce a field report of a slow connect.
+
+Lines that aren't notices are skipped, and a notice without a timestamp is
+written along with the one before it. The first notice is written at once;
+each after it once its offset from the first, divided by the speed, has
+passed. A speed of 0 writes them all at once.
+*/
+class ScriptedCore
+{
+public:
+    // Reads the command line for the stand-in's argument; done first thing
+    // in WinMain. If this process is the stand-in, WinMain returns RunStandIn.
+    static bool IsStandIn();
+
+    // Plays the script to stdout. Only returns -- with the exit code -- if
+    // the script can't be read, or stdout is closed.
+    static int RunStandIn();
+
+    // Has CoreTransport spawn the stand-in, with the script at scriptPath.
+    // Set by Headless::ParseCommandLine, before any transport is started.
+    static void Enable(const tstring& scriptPath, double speed);
+
+    static bool IsEnabled();
+
+    // The executable and arguments to spawn the stand-in with, in place of
+    // the core's. Only meaningful if IsEnabled.
+    static tstring GetStandInPath();
+    static tstring GetStandInArguments();
+};
@@ -19,25 +19,68 @@
 
 #include "stdafx.h"
 #include <WinSock2.h>
+#include <WS2tcpip.h>
+#include <set>
+#include <memory>
 #include "logging.h"
 #include "config.h"
 #include "psiclient.h"
 #include "utilities.h"
 #include "diagnostic_info.h"
+#include "thread_pool.h"
+#include "tracing.h"
+#include "usersettings.h"
+#include "tunnel_metrics.h"
 #include "server_list_reordering.h"
 
 
-const int MAX_WORKER_THREADS = 30;
+// Servers probed per run; each is probed on every port it serves.
+const size_t MAX_PROBES = 200;
+// A run soon after the last one, on the same network, only needs to check
+// that the best servers are still good: it probes this many. If the top
+// REORDER_HEALTHY_TOP_COUNT are already known to be good, it's skipped.
+const size_t REORDER_SHORT_MAX_PROBES = 40;
+const size_t REORDER_HEALTHY_TOP_COUNT = 3;
+const time_t REORDER_FRESH_SECONDS = 10*60;
+// After this many failed runs in a row, the next is a full one regardless.
+const unsigned int REORDER_MAX_FAILED_RUNS = 2;
+// Per probe
 const int MAX_CHECK_TIME_MILLISECONDS = 5000;
-const int RESPONSE_TIME_THRESHOLD_FACTOR = 2;
-
-void ReorderServerList(ServerList& serverList, const StopInfo& stopInfo);
+// Probes not started this long into a run are left for the next one.
+const int MAX_PROBING_TIME_MILLISECONDS = 15000;
+// Probes in flight at once; see ProbeWindow
+const size_t PROBE_WINDOW_INITIAL = 8;
+const size_t PROBE_WINDOW_MIN = 2;
+const size_t PROBE_WINDOW_MAX = 64;
+// A response time more than this multiple of the fastest seen, plus the
+// slack, counts as inflated: servers are spread around the world, so only a
+// large difference says more about the local network than the server.
+const unsigned int PROBE_RTT_INFLATION_FACTOR = 4;
+const unsigned int PROBE_RTT_INFLATION_SLACK_MILLISECONDS = 250;
+// Fronting endpoints (CDN edges) probed per run. Any number of servers may
+// share one, and they all get its result.
+const size_t MAX_FRONTED_PROBES = 16;
+// Resolving the fronting endpoints isn't counted in their response times.
+const int MAX_RESOLVE_TIME_MILLISECONDS = 3000;
+// Keyed like the capability, alongside GetReachabilityTestPorts' protocols
+#define FRONTED_MEEK_PROBE_PROTOCOL "FRONTED-MEEK"
+
+// How often ServerListRefresh refreshes the ranking while connected
+const DWORD REFRESH_INTERVAL_MILLISECONDS = 10*60*1000;
+// Servers probed per refresh, and at most this many probes in flight at once
+const size_t REFRESH_SAMPLE_SIZE = 20;
+const size_t REFRESH_MAX_CONCURRENCY = 4;
+// Less tunnel traffic than this, on average since the previous refresh,
+// counts as idle.
+const unsigned long long REFRESH_IDLE_BYTES_PER_SECOND = 4*1024;
+
+bool ReorderServerList(ServerList& serverList, size_t maxProbes, const StopInfo& stopInfo);
 
 
 ServerListReorder::ServerListReorder()
-    : m_thread(NULL), m_serverList(0)
+    : m_thread(NULL), m_serverList(0), m_maxProbes(MAX_PROBES),
+      m_lastRunTime(0), m_lastRunFull(false), m_failedRuns(0)
 {
-    m_mutex = CreateMutex(NULL, FALSE, 0);
 }
 
 
@@ -46,13 +89,12 @@ ServerListReorder::~ServerListReorder()
     // Ensure thread is not running.
 
     Stop(STOP_REASON_EXIT);
-    CloseHandle(m_mutex);
 }
 
 
 void ServerListReorder::Start(ServerList* serverList)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
     m_serverList = serverList;
 
@@ -63,10 +105,16 @@ void ServerListReorder::Start(ServerList* serverList)
 
     Stop(STOP_REASON_CANCEL);
 
-    m_thread = CreateThread(0, 0, ReorderServerListThread, this, 0, 0);
+    m_maxProbes = ScheduleRun(*serverList);
+    if (m_maxProbes == 0)
+    {
+        return;
+    }
+
+    m_thread = ThreadPool::Instance().Run(ReorderServerListThread, this);
     if (!m_thread)
     {
-        my_print(NOT_SENSITIVE, false, _T("Server List Reorder: CreateThread failed (%d)"), GetLastError());
+        my_print(NOT_SENSITIVE, false, _T("Server List Reorder: ThreadPool::Run failed (%d)"), GetLastError());
         return;
     }
 }
@@ -74,7 +122,7 @@ void ServerListReorder::Start(ServerList* serverList)
 
 void ServerListReorder::Stop(DWORD stopReason)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
     // This signal causes the thread to terminate
     m_stopSignal.SignalStop(stopReason);
@@ -94,7 +142,7 @@ void ServerListReorder::Stop(DWORD stopReason)
 
 bool ServerListReorder::IsRunning()
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
 
     return (m_thread != NULL);
 }
@@ -102,7 +150,7 @@ bool ServerListReorder::IsRunning()
 
 DWORD WINAPI ServerListReorder::ReorderServerListThread(void* data)
 {
-    // No mutex here.  This is the main thread of execution that can be cancelled
+    // No lock here.  This is the main thread of execution that can be cancelled
     // by Stop().
 
     ServerListReorder* object = (ServerListReorder*)data;
@@ -111,231 +159,1083 @@ DWORD WINAPI ServerListReorder::ReorderServerListThread(void* data)
     unsigned int seed = (unsigned)time(NULL);
     srand(seed);
 
-    ReorderServerList(*(object->m_serverList), StopInfo(&object->m_stopSignal, STOP_REASON_ALL));
+    // Runs alongside the connect attempt it's meant to improve on, so it
+    // mustn't slow that down.
+    ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
+    bool completed = ReorderServerList(*(object->m_serverList), object->m_maxProbes, StopInfo(&object->m_stopSignal, STOP_REASON_ALL));
+    object->RecordRun(object->m_maxProbes, completed);
 
     object->m_thread = NULL;
     return 0;
 }
 
 
-struct WorkerThreadData
+size_t ServerListReorder::ScheduleRun(ServerList& serverList)
+{
+    // Connect attempts come one after another while the network is bad, and
+    // each one starting a full run over again mostly re-measures what the
+    // last run just did.
+
+    // The best servers are healthy if they've all been measured recently
+    // and none has failed since.
+    bool topHealthy = true;
+    {
+        ServerListSnapshotPtr snapshot = serverList.GetSnapshot();
+        const ServerEntries& serverEntries = snapshot->entries;
+        ServerStatsMap serverStats = serverList.GetServerStats();
+
+        size_t count = min(serverEntries.size(), REORDER_HEALTHY_TOP_COUNT);
+        for (size_t i = 0; i < count && topHealthy; i++)
+        {
+            ServerStatsMap::const_iterator stats = serverStats.find(serverEntries[i].serverAddress);
+            topHealthy = stats != serverStats.end()
+                         && stats->second.IsFresh()
+                         && stats->second.failureCount == 0
+                         && !stats->second.IsQuarantined();
+        }
+        topHealthy = topHealthy && count > 0;
+    }
+
+    AutoLock lock(m_scheduleLock);
+
+    time_t now = time(0);
+    bool recent = m_lastRunTime != 0
+                  && m_lastRunTime <= now
+                  && now - m_lastRunTime < REORDER_FRESH_SECONDS;
+    bool networkChanged = ServerStats::LastNetworkChange() >= m_lastRunTime;
+
+    // Being asked again with the top servers failing means the last run's
+    // ranking didn't help.
+    if (recent && !networkChanged && !topHealthy)
+    {
+        m_failedRuns++;
+    }
+
+    const TCHAR* reason = NULL;
+    size_t maxProbes = MAX_PROBES;
+    if (!recent)
+    {
+        reason = (m_lastRunTime == 0) ? _T("first run") : _T("stale");
+    }
+    else if (networkChanged)
+    {
+        reason = _T("network changed");
+    }
+    else if (m_failedRuns >= REORDER_MAX_FAILED_RUNS)
+    {
+        reason = _T("repeated failures");
+    }
+    else if (topHealthy && m_lastRunFull)
+    {
+        maxProbes = 0;
+        reason = _T("fresh");
+    }
+    else
+    {
+        maxProbes = REORDER_SHORT_MAX_PROBES;
+        reason = _T("recent");
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %s, probing up to %d servers (%d failed runs)"), __TFUNCTION__,
+        reason, maxProbes, m_failedRuns);
+
+    return maxProbes;
+}
+
+
+void ServerListReorder::RecordRun(size_t maxProbes, bool completed)
 {
-    ServerEntry m_entry;
+    AutoLock lock(m_scheduleLock);
+
+    if (!completed)
+    {
+        // The results are partial, so the time isn't updated: the next run
+        // is judged by the last complete one.
+        m_failedRuns++;
+        return;
+    }
+
+    m_lastRunTime = time(0);
+    m_lastRunFull = (maxProbes >= MAX_PROBES);
+    if (m_lastRunFull)
+    {
+        m_failedRuns = 0;
+    }
+}
+
+
+struct ReachabilityProbe
+{
+    // The servers the result applies to: one for a direct probe, every
+    // server sharing the fronting endpoint for a TLS probe.
+    vector<string> m_serverAddresses;
+    string m_protocol;
+    // IPv4 for a direct probe, as that's all server entries have; either
+    // family for a TLS probe, as fronting endpoints are resolved
+    sockaddr_storage m_address;
+    int m_addressLength;
+    // TLS probes only: the SNI sent in the ClientHello, which is also the
+    // endpoint's name in the logs. Empty for a TCP connect probe.
+    string m_tlsServerName;
+    SOCKET m_socket;
+    // Probes that weren't started aren't counted either way
+    bool m_started;
+    // MonotonicMilliseconds
+    unsigned long long m_startTime;
+    unsigned int m_sequence;
+    bool m_pending;
     bool m_responded;
     unsigned int m_responseTime;
-    StopInfo m_stopInfo;
 
-    WorkerThreadData(ServerEntry entry, StopInfo stopInfo)
-        : m_entry(entry),
+    ReachabilityProbe(const string& serverAddress, const string& protocol, int port)
+        : m_protocol(protocol),
+          m_socket(INVALID_SOCKET),
+          m_started(false),
+          m_startTime(0),
+          m_sequence(0),
+          m_pending(false),
+          m_responded(false),
+          m_responseTime(UINT_MAX)
+    {
+        m_serverAddresses.push_back(serverAddress);
+
+        ZeroMemory(&m_address, sizeof(m_address));
+        sockaddr_in* address = (sockaddr_in*)&m_address;
+        address->sin_family = AF_INET;
+        address->sin_addr.s_addr = inet_addr(serverAddress.c_str());
+        address->sin_port = htons((unsigned short)port);
+        m_addressLength = sizeof(sockaddr_in);
+    }
+
+    ReachabilityProbe(const sockaddr_storage& address, int addressLength, const string& tlsServerName, const vector<string>& serverAddresses)
+        : m_serverAddresses(serverAddresses),
+          m_protocol(FRONTED_MEEK_PROBE_PROTOCOL),
+          m_address(address),
+          m_addressLength(addressLength),
+          m_tlsServerName(tlsServerName),
+          m_socket(INVALID_SOCKET),
+          m_started(false),
+          m_startTime(0),
+          m_sequence(0),
+          m_pending(false),
           m_responded(false),
-          m_responseTime(UINT_MAX),
-          m_stopInfo(stopInfo)
+          m_responseTime(UINT_MAX)
     {
     }
+
+    bool IsIPv6() const { return m_address.ss_family == AF_INET6; }
 };
 
 
-DWORD WINAPI CheckServerReachabilityThread(void* object)
+// A fronting endpoint -- the address dialed and the SNI -- and the servers
+// fronted through it. Servers with the same endpoint reach it the same way,
+// so one probe stands in for all of them.
+struct FrontingEndpoint
 {
-    WorkerThreadData* data = (WorkerThreadData*)object;
-
-    // Test for reachability by establishing a TCP socket
-    // connection to the specified port on the target host.
+    string dialHost;
+    string serverName;
+    vector<string> serverAddresses;
+};
 
-    DWORD start_time = GetTickCount();
 
-    bool success = true;
+// Resolves each endpoint's dial host in parallel. Only endpoints that
+// resolved within the time budget get a probe; the rest are left unprobed
+// this run rather than counted as unreachable. An endpoint with both IPv4
+// and IPv6 addresses gets a probe for each, so the faster path shows.
+static void MakeFrontedProbes(
+                const vector<FrontingEndpoint>& endpoints,
+                const StopInfo& stopInfo,
+                vector<ReachabilityProbe>& o_probes)
+{
+    // A lookup can outlast the wait, so each one's state is shared with the
+    // task doing it.
+    struct Resolution
+    {
+        string host;
+        // The first of each family; a zero length if there was none
+        sockaddr_storage addressV4;
+        int addressV4Length;
+        sockaddr_storage addressV6;
+        int addressV6Length;
+        bool resolved;
+        HANDLE doneEvent;
+
+        Resolution() : addressV4Length(0), addressV6Length(0), resolved(false), doneEvent(CreateEvent(NULL, TRUE, FALSE, NULL)) {}
+        ~Resolution() { if (doneEvent) CloseHandle(doneEvent); }
+    };
+
+    vector<shared_ptr<Resolution>> resolutions;
+    vector<HANDLE> waitEvents;
+
+    for (auto endpoint = endpoints.begin(); endpoint != endpoints.end(); ++endpoint)
+    {
+        shared_ptr<Resolution> resolution(new Resolution());
+        resolution->host = endpoint->dialHost;
+        resolutions.push_back(resolution);
 
-    WSADATA wsaData;
-    WSAStartup(MAKEWORD(2, 2), &wsaData);
-    sockaddr_in serverAddr;
-    WSAEVENT connectedEvent = NULL;
-    WSANETWORKEVENTS networkEvents;
-    SOCKET sock = INVALID_SOCKET;
+        if (!resolution->doneEvent)
+        {
+            continue;
+        }
 
-    serverAddr.sin_family = AF_INET;
-    serverAddr.sin_addr.s_addr = inet_addr(data->m_entry.serverAddress.c_str());
-    // NOTE: we've already checked for the presence of a reachability port below
-    serverAddr.sin_port = htons((unsigned short)data->m_entry.GetPreferredReachablityTestPort());
+        bool posted = ThreadPool::Instance().Post([resolution]()
+        {
+            addrinfo hints;
+            ZeroMemory(&hints, sizeof(hints));
+            // Without an IPv6 stack (e.g., by default on XP) there are no
+            // IPv6 results.
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            hints.ai_protocol = IPPROTO_TCP;
+
+            addrinfo* result = NULL;
+            if (0 == getaddrinfo(resolution->host.c_str(), "443", &hints, &result))
+            {
+                for (addrinfo* info = result; info != NULL; info = info->ai_next)
+                {
+                    if (info->ai_family == AF_INET && resolution->addressV4Length == 0)
+                    {
+                        memcpy(&resolution->addressV4, info->ai_addr, info->ai_addrlen);
+                        resolution->addressV4Length = (int)info->ai_addrlen;
+                    }
+                    else if (info->ai_family == AF_INET6 && resolution->addressV6Length == 0)
+                    {
+                        memcpy(&resolution->addressV6, info->ai_addr, info->ai_addrlen);
+                        resolution->addressV6Length = (int)info->ai_addrlen;
+                    }
+                }
+                resolution->resolved = resolution->addressV4Length > 0 || resolution->addressV6Length > 0;
+            }
 
-    connectedEvent = WSACreateEvent();
+            if (result)
+            {
+                freeaddrinfo(result);
+            }
 
-    sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+            SetEvent(resolution->doneEvent);
+        });
 
-    if (INVALID_SOCKET == sock ||
-        0 != WSAEventSelect(sock, connectedEvent, FD_CONNECT) ||
-        SOCKET_ERROR != connect(sock, (SOCKADDR*)&serverAddr, sizeof(serverAddr)) ||
-        WSAEWOULDBLOCK != WSAGetLastError())
-    {
-        success = false;
+        if (posted)
+        {
+            waitEvents.push_back(resolution->doneEvent);
+        }
     }
 
-    while (success)
+    // MAX_FRONTED_PROBES keeps this within MAXIMUM_WAIT_OBJECTS. Stops are
+    // noticed between waits.
+    unsigned long long startTime = MonotonicMilliseconds();
+    while (!waitEvents.empty())
     {
-        DWORD waitResult = WSAWaitForMultipleEvents(1, &connectedEvent, TRUE, 100, FALSE);
-
-        if (WSA_WAIT_EVENT_0 == waitResult
-            && 0 == WSAEnumNetworkEvents(sock, connectedEvent, &networkEvents)
-            && (networkEvents.lNetworkEvents & FD_CONNECT)
-            && networkEvents.iErrorCode[FD_CONNECT_BIT] == 0)
+        DWORD elapsed = (DWORD)(MonotonicMilliseconds() - startTime);
+        if (elapsed >= (DWORD)MAX_RESOLVE_TIME_MILLISECONDS
+            || stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, false))
         {
-            // Successfully connected
             break;
         }
 
-        // Check for stop (abort) signal
-        if (data->m_stopInfo.stopSignal->CheckSignal(data->m_stopInfo.stopReasons, false))
+        if (WAIT_TIMEOUT != WaitForMultipleObjects(
+                                (DWORD)waitEvents.size(), &waitEvents[0], TRUE,
+                                min((DWORD)100, (DWORD)MAX_RESOLVE_TIME_MILLISECONDS - elapsed)))
         {
-            success = false;
             break;
         }
     }
 
-    closesocket(sock);
-    WSACloseEvent(connectedEvent);
-    WSACleanup();
+    for (size_t i = 0; i < resolutions.size(); i++)
+    {
+        // Only read once the task is done with it
+        if (!resolutions[i]->doneEvent
+            || WAIT_OBJECT_0 != WaitForSingleObject(resolutions[i]->doneEvent, 0)
+            || !resolutions[i]->resolved)
+        {
+            my_print(SENSITIVE_LOG, true, _T("%s: failed to resolve %S"), __TFUNCTION__, endpoints[i].dialHost.c_str());
+            continue;
+        }
 
-    DWORD end_time = GetTickCount(); // GetTickCount can wrap
+        const Resolution& resolution = *resolutions[i];
+        if (resolution.addressV4Length > 0)
+        {
+            o_probes.push_back(ReachabilityProbe(resolution.addressV4, resolution.addressV4Length, endpoints[i].serverName, endpoints[i].serverAddresses));
+        }
+        if (resolution.addressV6Length > 0)
+        {
+            o_probes.push_back(ReachabilityProbe(resolution.addressV6, resolution.addressV6Length, endpoints[i].serverName, endpoints[i].serverAddresses));
+        }
+    }
+}
 
-    data->m_responseTime = (end_time >= start_time) ?
-                           (end_time - start_time) :
-                           (0xFFFFFFFF - start_time + end_time);
 
-    data->m_responded = success;
+// A TLS 1.2 ClientHello much like a browser's, so that a CDN edge answers it
+// with a ServerHello. The handshake isn't completed: the ServerHello arriving
+// marks the edge's response time, and the client-side crypto that would
+// follow costs every server the same.
+static string MakeTLSClientHello(const string& serverName)
+{
+    static const unsigned char cipherSuites[] = {
+        0xc0, 0x2b, 0xc0, 0x2f, 0xc0, 0x2c, 0xc0, 0x30, 0xcc, 0xa9, 0xcc, 0xa8,
+        0xc0, 0x13, 0xc0, 0x14, 0x00, 0x9c, 0x00, 0x9d, 0x00, 0x2f, 0x00, 0x35 };
+    static const unsigned char otherExtensions[] = {
+        // supported_groups: x25519, secp256r1, secp384r1
+        0x00, 0x0a, 0x00, 0x08, 0x00, 0x06, 0x00, 0x1d, 0x00, 0x17, 0x00, 0x18,
+        // ec_point_formats: uncompressed
+        0x00, 0x0b, 0x00, 0x02, 0x01, 0x00,
+        // signature_algorithms
+        0x00, 0x0d, 0x00, 0x16, 0x00, 0x14,
+        0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x08, 0x04, 0x08, 0x05,
+        0x08, 0x06, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x02, 0x01,
+        // renegotiation_info
+        0xff, 0x01, 0x00, 0x01, 0x00 };
+
+    auto put16 = [](string& s, size_t value) { s += (char)((value >> 8) & 0xff); s += (char)(value & 0xff); };
+
+    string extensions;
+    if (!serverName.empty())
+    {
+        put16(extensions, 0x0000); // server_name
+        put16(extensions, serverName.length() + 5);
+        put16(extensions, serverName.length() + 3);
+        extensions += (char)0x00; // host_name
+        put16(extensions, serverName.length());
+        extensions += serverName;
+    }
+    extensions.append((const char*)otherExtensions, sizeof(otherExtensions));
 
-    return 0;
+    string body;
+    put16(body, 0x0303); // TLS 1.2
+    for (int i = 0; i < 32; i++)
+    {
+        // Not used for anything but looking like a ClientHello
+        body += (char)(rand() & 0xff);
+    }
+    body += (char)0x00; // no session ID
+    put16(body, sizeof(cipherSuites));
+    body.append((const char*)cipherSuites, sizeof(cipherSuites));
+    body += (char)0x01; // one compression method...
+    body += (char)0x00; // ...null
+    put16(body, extensions.length());
+    body += extensions;
+
+    string record;
+    record += (char)0x16; // handshake
+    put16(record, 0x0301);
+    put16(record, body.length() + 4);
+    record += (char)0x01; // client_hello
+    record += (char)0x00;
+    put16(record, body.length());
+    record += body;
+
+    return record;
 }
 
 
-void ReorderServerList(ServerList& serverList, const StopInfo& stopInfo)
+// Adapts how many probes are in flight to what the network can take
+// (additive increase, multiplicative decrease). Cheap home routers and XP's
+// limit of 10 half-open connections drop connects past their capacity, which
+// would look like unreachable or slow servers. The window starts within XP's
+// limit and doubles while probes respond promptly, then grows by one per
+// window's worth of prompt responses after the first backoff. A timeout, or
+// a response time inflated well past the fastest seen, halves it -- once for
+// all the probes already in flight when that happened.
+class ProbeWindow
 {
-    ServerEntries serverEntries = serverList.GetList();
+public:
+    ProbeWindow(size_t maxSize)
+        : m_maxSize(max(maxSize, PROBE_WINDOW_MIN)),
+          m_size(min(PROBE_WINDOW_INITIAL, m_maxSize)),
+          m_peakSize(m_size),
+          m_credit(0),
+          m_slowStart(true),
+          m_minResponseTime(UINT_MAX),
+          m_nextSequence(0),
+          m_recoverSequence(0),
+          m_backoffCount(0)
+    {
+    }
 
-    // Check response time from each server (in parallel).
-    // At most the first MAX_WORKER_THREADS servers in the
-    // current server list will be checked. We select the
-    // first MAX/2 server from the top of the list (they
-    // may be better/fresher) and then MAX/2 random servers
-    // from the rest of the list (they may be underused).
+    size_t Size() const { return m_size; }
+    size_t PeakSize() const { return m_peakSize; }
+    unsigned int BackoffCount() const { return m_backoffCount; }
+
+    // Numbers probes in the order they're started
+    unsigned int NextSequence() { return m_nextSequence++; }
 
-    // TODO: use a thread pool?
+    void OnResponse(unsigned int sequence, unsigned int responseTime)
+    {
+        m_minResponseTime = min(m_minResponseTime, responseTime);
 
-    vector<HANDLE> threadHandles;
-    vector<WorkerThreadData*> threadData;
+        if (responseTime > m_minResponseTime * PROBE_RTT_INFLATION_FACTOR + PROBE_RTT_INFLATION_SLACK_MILLISECONDS)
+        {
+            Backoff(sequence);
+            return;
+        }
 
-    if (serverEntries.size() > MAX_WORKER_THREADS)
+        if (m_slowStart || ++m_credit >= m_size)
+        {
+            m_credit = 0;
+            m_size = min(m_size + 1, m_maxSize);
+            m_peakSize = max(m_peakSize, m_size);
+        }
+    }
+
+    void OnTimeout(unsigned int sequence)
     {
-        random_shuffle(serverEntries.begin() + MAX_WORKER_THREADS/2, serverEntries.end());
+        Backoff(sequence);
     }
 
-    for (ServerEntryIterator entry = serverEntries.begin(); entry != serverEntries.end(); ++entry)
+private:
+    void Backoff(unsigned int sequence)
     {
-        if (-1 != entry->GetPreferredReachablityTestPort())
+        // Probes started before the last backoff were sent into the old
+        // window; they're why it was cut.
+        if (sequence < m_recoverSequence)
         {
-            WorkerThreadData* data = new WorkerThreadData(*entry, stopInfo);
+            return;
+        }
 
-            HANDLE threadHandle = CreateThread(0, 0, CheckServerReachabilityThread, (void*)data, 0, 0);
-            if (!threadHandle)
+        m_size = max(m_size / 2, PROBE_WINDOW_MIN);
+        m_credit = 0;
+        m_slowStart = false;
+        m_recoverSequence = m_nextSequence;
+        m_backoffCount++;
+    }
+
+    size_t m_maxSize;
+    size_t m_size;
+    size_t m_peakSize;
+    size_t m_credit;
+    bool m_slowStart;
+    unsigned int m_minResponseTime;
+    unsigned int m_nextSequence;
+    unsigned int m_recoverSequence;
+    unsigned int m_backoffCount;
+};
+
+
+// Test for reachability by establishing TCP socket connections to the
+// probe's port of each target host. A TLS probe also sends a ClientHello
+// once connected and waits for the first record of the reply, so its
+// response time covers the connect plus a handshake round trip. Connects are
+// issued non-blocking, in order, as the ProbeWindow allows, and completed
+// from a single wait loop: every socket is associated with the same event
+// object, so the number of probes isn't bounded by WSA_MAXIMUM_WAIT_EVENTS.
+// Each probe gets MAX_CHECK_TIME_MILLISECONDS; any not started within
+// MAX_PROBING_TIME_MILLISECONDS are left unstarted, and so unprobed.
+// maxConcurrency caps the window.
+// Returns as soon as every started probe has completed, or a stop is
+// signalled. Returns false if the probes were interrupted, in which case
+// non-responders are inconclusive.
+bool CheckServerReachability(vector<ReachabilityProbe>& probes, size_t maxConcurrency, const StopInfo& stopInfo)
+{
+    WSAEVENT networkEvent = WSACreateEvent();
+    if (WSA_INVALID_EVENT == networkEvent)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: WSACreateEvent failed (%d)"), __TFUNCTION__, WSAGetLastError());
+        return false;
+    }
+
+    bool interrupted = false;
+
+    // Wait on the stop event too, so a stop interrupts the wait right away.
+    WSAEVENT waitEvents[2] = { networkEvent, stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons) };
+    DWORD waitEventsCount = waitEvents[1] ? 2 : 1;
+
+    ProbeWindow window(maxConcurrency);
+    // Response times feed the servers' scores, so they're taken on the
+    // high-resolution clock: the tick count's 10-16 ms steps are as big as
+    // the differences between nearby servers.
+    unsigned long long startTime = MonotonicMilliseconds();
+    // Probes before this have been started
+    size_t nextProbe = 0;
+    size_t pendingCount = 0;
+
+    auto finishProbe = [&pendingCount](ReachabilityProbe& probe) {
+        // Closed right away, so it stops taking up a half-open slot
+        closesocket(probe.m_socket);
+        probe.m_socket = INVALID_SOCKET;
+        probe.m_pending = false;
+        pendingCount--;
+    };
+
+    while (true)
+    {
+        unsigned long long now = MonotonicMilliseconds();
+
+        if (now - startTime < (unsigned long long)MAX_PROBING_TIME_MILLISECONDS)
+        {
+            while (nextProbe < probes.size() && pendingCount < window.Size())
             {
-                continue;
+                ReachabilityProbe& probe = probes[nextProbe++];
+                probe.m_started = true;
+                probe.m_startTime = now;
+                probe.m_sequence = window.NextSequence();
+
+                long networkEventsWanted = probe.m_tlsServerName.empty() ? FD_CONNECT : (FD_CONNECT | FD_READ | FD_CLOSE);
+
+                probe.m_socket = socket(probe.m_address.ss_family, SOCK_STREAM, IPPROTO_TCP);
+
+                if (INVALID_SOCKET == probe.m_socket ||
+                    0 != WSAEventSelect(probe.m_socket, networkEvent, networkEventsWanted) ||
+                    SOCKET_ERROR != connect(probe.m_socket, (SOCKADDR*)&probe.m_address, probe.m_addressLength) ||
+                    WSAEWOULDBLOCK != WSAGetLastError())
+                {
+                    continue;
+                }
+
+                probe.m_pending = true;
+                pendingCount++;
             }
+        }
 
-            threadHandles.push_back(threadHandle);
-            threadData.push_back(data);
+        if (pendingCount == 0)
+        {
+            break;
+        }
+
+        // Also wake periodically, for probe timeouts and for stop signals
+        // whose event doesn't cover every reason (see TempTunnelStopSignal).
+        DWORD waitResult = WSAWaitForMultipleEvents(waitEventsCount, waitEvents, FALSE, 100, FALSE);
 
-            if (threadHandles.size() >= MAX_WORKER_THREADS)
+        if (stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, false))
+        {
+            // Stop waiting early if exiting the app, etc.
+            // NOTE: results collected so far are still processed
+            interrupted = true;
+            break;
+        }
+
+        now = MonotonicMilliseconds();
+
+        if (WSA_WAIT_EVENT_0 == waitResult)
+        {
+            // The event is shared by all sockets, so reset it here and then
+            // collect the records of each socket still outstanding. Passing a
+            // NULL event to WSAEnumNetworkEvents leaves the shared event alone.
+            WSAResetEvent(networkEvent);
+
+            for (size_t i = 0; i < nextProbe; i++)
+            {
+                ReachabilityProbe& probe = probes[i];
+                WSANETWORKEVENTS networkEvents;
+
+                if (!probe.m_pending
+                    || 0 != WSAEnumNetworkEvents(probe.m_socket, NULL, &networkEvents))
+                {
+                    continue;
+                }
+
+                bool done = false;
+                bool responded = false;
+
+                if (networkEvents.lNetworkEvents & FD_CONNECT)
+                {
+                    if (networkEvents.iErrorCode[FD_CONNECT_BIT] != 0)
+                    {
+                        done = true;
+                    }
+                    else if (probe.m_tlsServerName.empty())
+                    {
+                        done = true;
+                        responded = true;
+                    }
+                    else
+                    {
+                        // A ClientHello fits in the empty send buffer of a new
+                        // connection, so it's never partly sent.
+                        string clientHello = MakeTLSClientHello(probe.m_tlsServerName);
+                        done = (SOCKET_ERROR == send(probe.m_socket, clientHello.c_str(), (int)clientHello.length(), 0));
+                    }
+                }
+
+                if (!done && (networkEvents.lNetworkEvents & FD_READ))
+                {
+                    // A ServerHello starts with a handshake record; anything
+                    // else (i.e., an alert) means the edge won't talk to us.
+                    char recordType = 0;
+                    int received = recv(probe.m_socket, &recordType, 1, 0);
+                    if (received == SOCKET_ERROR && WSAGetLastError() == WSAEWOULDBLOCK)
+                    {
+                        // Spurious; wait for the next one
+                    }
+                    else
+                    {
+                        done = true;
+                        responded = (received == 1 && recordType == 0x16);
+                    }
+                }
+
+                if (!done && (networkEvents.lNetworkEvents & FD_CLOSE))
+                {
+                    done = true;
+                }
+
+                if (!done)
+                {
+                    continue;
+                }
+
+                finishProbe(probe);
+
+                // A refusal is an answer too, so it doesn't move the window.
+                if (responded)
+                {
+                    probe.m_responded = true;
+                    probe.m_responseTime = (unsigned int)(now - probe.m_startTime);
+                    window.OnResponse(probe.m_sequence, probe.m_responseTime);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < nextProbe; i++)
+        {
+            ReachabilityProbe& probe = probes[i];
+            if (probe.m_pending
+                && now - probe.m_startTime >= (unsigned long long)MAX_CHECK_TIME_MILLISECONDS)
             {
-                break;
+                finishProbe(probe);
+                window.OnTimeout(probe.m_sequence);
             }
         }
     }
 
-    // Wait for all threads to finish
+    for (vector<ReachabilityProbe>::iterator probe = probes.begin(); probe != probes.end(); ++probe)
+    {
+        if (INVALID_SOCKET != probe->m_socket)
+        {
+            closesocket(probe->m_socket);
+            probe->m_socket = INVALID_SOCKET;
+        }
+        probe->m_pending = false;
+    }
+
+    WSACloseEvent(networkEvent);
+
+    my_print(NOT_SENSITIVE, true, _T("%s: started %d of %d probes in %d ms; window %d, peak %d, %d backoffs"), __TFUNCTION__,
+        (int)nextProbe, (int)probes.size(), (int)(MonotonicMilliseconds() - startTime),
+        (int)window.Size(), (int)window.PeakSize(), window.BackoffCount());
+
+    return !interrupted;
+}
 
-    // TODO: stop waiting early if all threads finish?
 
-    for (int waits = 0; waits < MAX_CHECK_TIME_MILLISECONDS/100; waits++)
+// Probes entries -- at most maxServers of them, plus any that share a
+// fronting endpoint with those -- and folds the results into serverList's
+// history. maxConcurrency limits how many probes are in flight at once; 0
+// leaves it to the ProbeWindow alone. Returns false if nothing could be
+// probed.
+static bool ProbeServers(
+                ServerList& serverList,
+                const vector<const ServerEntry*>& entries,
+                size_t maxServers,
+                size_t maxConcurrency,
+                const StopInfo& stopInfo)
+{
+    vector<ReachabilityProbe> probes;
+    vector<FrontingEndpoint> frontingEndpoints;
+    map<string, size_t> frontingEndpointIndexes;
+
+    // A server that's blocked on one protocol may still be reachable on
+    // another, so every port a transport might use is probed. Fronted meek
+    // is probed at the fronting endpoint instead, with a TLS handshake as
+    // that's what connecting costs. Servers joining an endpoint that's
+    // already being probed don't count against maxServers.
+    size_t probedServerCount = 0;
+    for (auto it = entries.begin(); it != entries.end(); ++it)
     {
-        Sleep(100);
+        const ServerEntry* entry = *it;
+        bool probed = false;
 
-        if (stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons))
+        if (probedServerCount < maxServers)
         {
-            // Stop waiting early if exiting the app, etc.
-            // NOTE: we still process results in this case
-            break;
+            vector<pair<string, int>> ports = entry->GetReachabilityTestPorts();
+            for (auto port = ports.begin(); port != ports.end(); ++port)
+            {
+                probes.push_back(ReachabilityProbe(entry->serverAddress, port->first, port->second));
+                probed = true;
+            }
+        }
+
+        const string& frontingDomain = entry->meekFrontingDomain.get();
+        if (entry->HasCapabilities(SERVER_CAPABILITY_FRONTED_MEEK) && !frontingDomain.empty())
+        {
+            const vector<string>& frontingAddresses = entry->meekFrontingAddresses.get();
+            string dialHost = frontingAddresses.empty() ? frontingDomain : frontingAddresses.front();
+            string key = dialHost + " " + frontingDomain;
+
+            auto index = frontingEndpointIndexes.find(key);
+            if (index != frontingEndpointIndexes.end())
+            {
+                frontingEndpoints[index->second].serverAddresses.push_back(entry->serverAddress);
+            }
+            else if (frontingEndpoints.size() < MAX_FRONTED_PROBES && probedServerCount < maxServers)
+            {
+                FrontingEndpoint endpoint;
+                endpoint.dialHost = dialHost;
+                endpoint.serverName = frontingDomain;
+                endpoint.serverAddresses.push_back(entry->serverAddress);
+                frontingEndpointIndexes[key] = frontingEndpoints.size();
+                frontingEndpoints.push_back(endpoint);
+                probed = true;
+            }
+        }
+
+        if (probed)
+        {
+            probedServerCount++;
         }
     }
-    stopInfo.stopSignal->SignalStop(STOP_REASON_CANCEL);
 
-    for (vector<HANDLE>::iterator handle = threadHandles.begin(); handle != threadHandles.end(); ++handle)
+    my_print(NOT_SENSITIVE, true, _T("%s: probing %d of %d servers (%d ports, %d fronting endpoints)"), __TFUNCTION__,
+        probedServerCount, entries.size(), probes.size(), frontingEndpoints.size());
+
+    bool completed = false;
+
+    if (probes.size() > 0 || frontingEndpoints.size() > 0)
     {
-        WaitForSingleObject(*handle, INFINITE);
-        CloseHandle(*handle);
+        WSADATA wsaData;
+        if (0 != WSAStartup(MAKEWORD(2, 2), &wsaData))
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: WSAStartup failed (%d)"), __TFUNCTION__, WSAGetLastError());
+            return false;
+        }
+
+        MakeFrontedProbes(frontingEndpoints, stopInfo, probes);
+
+        unsigned long long probeStartTime = MonotonicMilliseconds();
+        completed = CheckServerReachability(
+                        probes,
+                        maxConcurrency == 0 ? PROBE_WINDOW_MAX : min(maxConcurrency, PROBE_WINDOW_MAX),
+                        stopInfo);
+
+        TRACE_EVENT(TRACE_KEYWORD_SERVER_PROBE, _T("ServerProbe/Done: %d probes, %s, %d ms"),
+            (int)probes.size(), completed ? _T("completed") : _T("interrupted"), (int)(MonotonicMilliseconds() - probeStartTime));
+
+        WSACleanup();
     }
 
-    // Build a list of all servers that responded within the threshold
-    // time (+100%) of the best server. Using the best server as a base
-    // is intended to factor out local network conditions, local cpu
-    // conditions (e.g., SSL overhead) etc. We randomly shuffle the
-    // resulting list for some client-side load balancing. Any server
-    // that meets the threshold is considered equally qualified for
-    // any position towards the top of the list.
+    // Fold the results into the persistent per-server history. A server is
+    // reachable if any of its ports responded. Probes cut short by a stop
+    // signal aren't counted as failures.
 
-    unsigned int fastestResponseTime = UINT_MAX;
+    map<string, ProtocolResponseTimes> responseTimes;
+    set<string> probedAddresses;
+    // Response times of each fronting endpoint's probes by family; UINT_MAX
+    // if it didn't respond
+    struct FamilyResponseTimes
+    {
+        unsigned int ipv4;
+        unsigned int ipv6;
+        bool probedIPv6;
 
-    for (vector<WorkerThreadData*>::iterator data = threadData.begin(); data != threadData.end(); ++data)
+        FamilyResponseTimes() : ipv4(UINT_MAX), ipv6(UINT_MAX), probedIPv6(false) {}
+    };
+    map<string, FamilyResponseTimes> frontingFamilyTimes;
+
+    for (vector<ReachabilityProbe>::iterator probe = probes.begin(); probe != probes.end(); ++probe)
     {
+        if (!probe->m_started)
+        {
+            continue;
+        }
+
+        // A TLS probe is named by its endpoint, as it may stand in for
+        // many servers.
+        const string& probeName = probe->m_tlsServerName.empty() ? probe->m_serverAddresses.front() : probe->m_tlsServerName;
+
         my_print(
             SENSITIVE_LOG,
             true,
-            _T("server: %s, responded: %s, response time: %d"),
-            UTF8ToWString((*data)->m_entry.serverAddress).c_str(),
-            (*data)->m_responded ? L"yes" : L"no",
-            (*data)->m_responseTime);
+            _T("server: %s, protocol: %S%s, servers: %d, responded: %s, response time: %d"),
+            UTF8ToWString(probeName).c_str(),
+            probe->m_protocol.c_str(),
+            probe->IsIPv6() ? L" (IPv6)" : L"",
+            probe->m_serverAddresses.size(),
+            probe->m_responded ? L"yes" : L"no",
+            probe->m_responseTime);
+
+        TRACE_EVENT(TRACE_KEYWORD_SERVER_PROBE, _T("ServerProbe/Result: %S %S servers: %d, responded: %s, response time: %d"),
+            probeName.c_str(), probe->m_protocol.c_str(), (int)probe->m_serverAddresses.size(),
+            probe->m_responded ? _T("yes") : _T("no"), probe->m_responseTime);
+
+        for (auto address = probe->m_serverAddresses.begin(); address != probe->m_serverAddresses.end(); ++address)
+        {
+            probedAddresses.insert(*address);
+            if (probe->m_responded)
+            {
+                // The faster family's time, as that's the path to be had
+                ProtocolResponseTimes& times = responseTimes[*address];
+                auto time = times.find(probe->m_protocol);
+                if (time == times.end() || probe->m_responseTime < time->second)
+                {
+                    times[probe->m_protocol] = probe->m_responseTime;
+                }
+            }
+        }
 
-        if ((*data)->m_responded && (*data)->m_responseTime < fastestResponseTime)
+        if (!probe->m_tlsServerName.empty())
         {
-            fastestResponseTime = (*data)->m_responseTime;
+            FamilyResponseTimes& familyTimes = frontingFamilyTimes[probeName];
+            if (probe->IsIPv6())
+            {
+                familyTimes.ipv6 = probe->m_responseTime;
+                familyTimes.probedIPv6 = true;
+            }
+            else
+            {
+                familyTimes.ipv4 = probe->m_responseTime;
+            }
         }
 
         Json::Value json;
-        json["ipAddress"] = (*data)->m_entry.serverAddress;
-        json["responded"] = (*data)->m_responded;
-        json["responseTime"] = (*data)->m_responseTime;
+        if (probe->m_tlsServerName.empty())
+        {
+            json["ipAddress"] = probeName;
+        }
+        else
+        {
+            json["frontingDomain"] = probeName;
+            json["serverCount"] = (Json::UInt)probe->m_serverAddresses.size();
+        }
+        json["protocol"] = probe->m_protocol;
+        json["addressFamily"] = probe->IsIPv6() ? "IPv6" : "IPv4";
+        json["responded"] = probe->m_responded;
+        json["responseTime"] = probe->m_responseTime;
         AddDiagnosticInfoJson("ServerResponseCheck", json);
     }
 
-    ServerEntries respondingServers;
+    // Which family is faster, for the endpoints that have both. The core
+    // picks the family itself when it dials, so this is for diagnosis.
+    for (auto it = frontingFamilyTimes.begin(); it != frontingFamilyTimes.end(); ++it)
+    {
+        if (!it->second.probedIPv6)
+        {
+            continue;
+        }
+
+        unsigned int ipv4Time = it->second.ipv4;
+        unsigned int ipv6Time = it->second.ipv6;
 
-    for (vector<WorkerThreadData*>::iterator data = threadData.begin(); data != threadData.end(); ++data)
+        Json::Value json;
+        json["frontingDomain"] = it->first;
+        json["ipv4ResponseTime"] = ipv4Time;
+        json["ipv6ResponseTime"] = ipv6Time;
+        json["faster"] = (ipv4Time == UINT_MAX && ipv6Time == UINT_MAX) ? "neither"
+                         : (ipv6Time < ipv4Time ? "IPv6" : "IPv4");
+        AddDiagnosticInfoJson("FrontingAddressFamily", json);
+    }
+
+    vector<string> unreachable;
+    if (completed)
     {
-        if ((*data)->m_responded && (*data)->m_responseTime <=
-                fastestResponseTime*RESPONSE_TIME_THRESHOLD_FACTOR)
+        for (auto address = probedAddresses.begin(); address != probedAddresses.end(); ++address)
         {
-            respondingServers.push_back((*data)->m_entry);
+            if (responseTimes.find(*address) == responseTimes.end())
+            {
+                unreachable.push_back(*address);
+            }
         }
     }
 
-    random_shuffle(respondingServers.begin(), respondingServers.end());
+    serverList.RecordServerResponses(responseTimes, unreachable);
+
+    return true;
+}
 
-    // Merge back into server entry list. MoveEntriesToFront will move
-    // these servers to the top of the list in the order submitted. Any
-    // other servers, including non-responders and new servers discovered
-    // while this process ran will remain in position after the move-to-front
-    // list. By using the ConnectionManager's ServerList object we ensure
-    // there's no conflict while reading/writing the persistent server list.
 
-    if (respondingServers.size() > 0)
+// Returns false if it was stopped before the results were merged.
+bool ReorderServerList(ServerList& serverList, size_t maxProbes, const StopInfo& stopInfo)
+{
+    // Entries are pointed to rather than copied; the snapshot keeps them alive.
+    ServerListSnapshotPtr snapshot = serverList.GetSnapshot();
+    const ServerEntries& serverEntries = snapshot->entries;
+    ServerStatsMap serverStats = serverList.GetServerStats();
+
+    // Check response time from each server (in parallel).
+    // Servers with a recent reachability history aren't re-probed; their
+    // stored score is used as-is. At most maxProbes of the remaining
+    // servers will be checked. We select the first MAX/2 server from the
+    // top of the list (they may be better/fresher) and then MAX/2 random
+    // servers from the rest of the list (they may be underused).
+    // When the user has chosen an egress region, that region's servers are
+    // selected first, the same way, and any remaining probes go to the rest.
+
+    string egressRegion = serverList.GetEgressRegion();
+
+    vector<const ServerEntry*> regionEntries;
+    vector<const ServerEntry*> otherEntries;
+    for (ServerEntryIterator entry = serverEntries.begin(); entry != serverEntries.end(); ++entry)
     {
-        serverList.MoveEntriesToFront(respondingServers);
+        ServerStatsMap::const_iterator stats = serverStats.find(entry->serverAddress);
+        if (stats == serverStats.end() || !stats->second.IsFresh())
+        {
+            if (!egressRegion.empty() && entry->region.get() == egressRegion)
+            {
+                regionEntries.push_back(&*entry);
+            }
+            else
+            {
+                otherEntries.push_back(&*entry);
+            }
+        }
+    }
 
-        my_print(NOT_SENSITIVE, true, _T("Preferred servers: %d"), respondingServers.size());
+    if (regionEntries.size() > maxProbes)
+    {
+        random_shuffle(regionEntries.begin() + maxProbes/2, regionEntries.end());
     }
 
-    // Cleanup
+    size_t otherBudget = maxProbes - min(regionEntries.size(), maxProbes);
+    if (otherEntries.size() > otherBudget)
+    {
+        random_shuffle(otherEntries.begin() + otherBudget/2, otherEntries.end());
+    }
 
-    for (vector<WorkerThreadData*>::iterator data = threadData.begin(); data != threadData.end(); ++data)
+    vector<const ServerEntry*> unprobedEntries(regionEntries);
+    unprobedEntries.insert(unprobedEntries.end(), otherEntries.begin(), otherEntries.end());
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %d of %d servers unprobed, %d in the egress region"), __TFUNCTION__,
+        unprobedEntries.size(), serverEntries.size(), regionEntries.size());
+
+    if (!ProbeServers(serverList, unprobedEntries, maxProbes, 0, stopInfo))
+    {
+        return false;
+    }
+
+    // Merge back into server entry list, ordered by score. Using the history
+    // rather than a single sample smooths out transient local network and
+    // cpu conditions. Non-responders and new servers discovered while this
+    // process ran will remain in position after the scored servers. By using
+    // the ConnectionManager's ServerList object we ensure there's no conflict
+    // while reading/writing the persistent server list.
+
+    serverList.OrderEntriesByScore(egressRegion);
+
+    UI_Notice(serverList.GetEgressRegionStatsNotice());
+
+    return true;
+}
+
+
+/***********************************************************************
+ ServerListRefresh
+ */
+
+static unsigned long long TunnelBytes()
+{
+    unsigned long long sent = 0, received = 0;
+    int tunnelCount = 0;
+    TunnelMetrics::GetTotals(sent, received, tunnelCount);
+    return sent + received;
+}
+
+ServerListRefresh::ServerListRefresh(const string& serverListName)
+    : m_timer(0),
+      m_serverList(serverListName.c_str()),
+      m_cursor(0),
+      m_lastTunnelBytes(0)
+{
+}
+
+ServerListRefresh::~ServerListRefresh()
+{
+    Stop();
+}
+
+void ServerListRefresh::Start()
+{
+    AutoLock lock(m_lock);
+
+    if (m_timer)
+    {
+        return;
+    }
+
+    m_stopSignal.ClearStopSignal(STOP_REASON_ALL);
+    m_lastTunnelBytes = TunnelBytes();
+
+    // Refreshes take far less than the interval, and the service never
+    // overlaps runs anyway.
+    m_timer = TimerService::Instance().Schedule(
+                REFRESH_INTERVAL_MILLISECONDS,
+                REFRESH_INTERVAL_MILLISECONDS,
+                [this]() { Refresh(); });
+    if (!m_timer)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: TimerService::Schedule failed"), __TFUNCTION__);
+    }
+}
+
+void ServerListRefresh::Stop()
+{
+    TimerService::TimerID timer = 0;
     {
-        delete *data;
+        AutoLock lock(m_lock);
+        timer = m_timer;
+        m_timer = 0;
     }
+
+    if (!timer)
+    {
+        return;
+    }
+
+    // Cuts a refresh in progress short, then waits for it
+    m_stopSignal.SignalStop(STOP_REASON_CANCEL);
+    TimerService::Instance().Cancel(timer);
+}
+
+void ServerListRefresh::Refresh()
+{
+    // The totals are reset if the connection stops, in which case we're
+    // about to be stopped too.
+    unsigned long long tunnelBytes = TunnelBytes();
+    unsigned long long recentBytes = (tunnelBytes >= m_lastTunnelBytes) ? tunnelBytes - m_lastTunnelBytes : tunnelBytes;
+    m_lastTunnelBytes = tunnelBytes;
+
+    if (recentBytes > REFRESH_IDLE_BYTES_PER_SECOND * (REFRESH_INTERVAL_MILLISECONDS / 1000))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: tunnel busy, skipped"), __TFUNCTION__);
+        return;
+    }
+
+    ServerListSnapshotPtr snapshot = m_serverList.GetSnapshot();
+    const ServerEntries& serverEntries = snapshot->entries;
+    if (serverEntries.empty())
+    {
+        return;
+    }
+
+    ServerStatsMap serverStats = m_serverList.GetServerStats();
+
+    // Servers with a fresh history are passed over. The cursor moves past
+    // everything looked at, so the next sample carries on from there.
+    vector<const ServerEntry*> sample;
+    size_t looked = 0;
+    for (; looked < serverEntries.size() && sample.size() < REFRESH_SAMPLE_SIZE; looked++)
+    {
+        const ServerEntry& entry = serverEntries[(m_cursor + looked) % serverEntries.size()];
+        ServerStatsMap::const_iterator stats = serverStats.find(entry.serverAddress);
+        if (stats == serverStats.end() || !stats->second.IsFresh())
+        {
+            sample.push_back(&entry);
+        }
+    }
+    m_cursor = (m_cursor + looked) % serverEntries.size();
+
+    if (sample.empty())
+    {
+        return;
+    }
+
+    // Timer threads are shared; the scope puts this one back afterwards.
+    ThreadQoSScope qos(THREAD_QOS_BACKGROUND);
+
+    if (!ProbeServers(m_serverList, sample, REFRESH_SAMPLE_SIZE, REFRESH_MAX_CONCURRENCY, StopInfo(&m_stopSignal, STOP_REASON_ALL)))
+    {
+        return;
+    }
+
+    m_serverList.OrderEntriesByScore(m_serverList.GetEgressRegion());
+
+    UI_Notice(m_serverList.GetEgressRegionStatsNotice());
 }
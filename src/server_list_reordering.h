@@ -21,6 +21,7 @@
 
 #include "serverlist.h"
 #include "stopsignal.h"
+#include "timer_service.h"
 
 
 class ServerListReorder
@@ -36,11 +37,61 @@ public:
 private:
     static DWORD WINAPI ReorderServerListThread(void* data);
 
-    HANDLE m_mutex;
+    // How much of the list the next run should probe, given how the last one
+    // went: 0 to skip it.
+    size_t ScheduleRun(ServerList& serverList);
+    void RecordRun(size_t maxProbes, bool completed);
+
+    Lock m_lock;
     HANDLE m_thread;
     ServerList* m_serverList;
+    size_t m_maxProbes;
+
+    // As of the last run. Written by the reorder thread, so not guarded by
+    // m_lock, which Stop() holds while waiting for it.
+    Lock m_scheduleLock;
+    time_t m_lastRunTime;
+    bool m_lastRunFull;
+    // Runs since the last full one that were cut short, or that were
+    // followed by another connect attempt with the top servers failing
+    unsigned int m_failedRuns;
 
     // We use a custom stop signal because we only want to respond to Stop()
     // being called, and no other events.
     StopSignal m_stopSignal;
 };
+
+
+/*
+Keeps the ranking of a server list fresh while connected, so that the next
+reconnect starts from it rather than from what was probed before connecting.
+Every so often, if the tunnel has been idle, a small rotating sample of the
+list is probed -- a few at a time, at low thread priority -- and the results
+go into the list's history like a reorder's.
+Only for transports whose traffic doesn't all go through the tunnel: a
+probe made while the VPN is up measures the tunnel, not the server.
+*/
+class ServerListRefresh
+{
+public:
+    ServerListRefresh(const string& serverListName);
+    virtual ~ServerListRefresh();
+
+    void Start();
+    // Waits for a refresh in progress.
+    void Stop();
+
+private:
+    void Refresh();
+
+    Lock m_lock;
+    TimerService::TimerID m_timer;
+    ServerList m_serverList;
+    // Where the next sample starts, so samples rotate through the list
+    size_t m_cursor;
+    // Tunnel traffic as of the previous check
+    unsigned long long m_lastTunnelBytes;
+
+    // As for ServerListReorder
+    StopSignal m_stopSignal;
+};
@@ -75,11 +75,107 @@ request through them.
 #include "transport_registry.h"
 #include "httpsrequest.h"
 #include "transport_connection.h"
+#include "temp_tunnel_pool.h"
+#include "thread_pool.h"
 #include "psiclient.h"
 #include "serverlist.h"
 #include "config.h"
 
 
+// How long the direct HTTPS attempts get before a temp tunnel (which is slower
+// to try, and reveals more) joins the race.
+#define SERVER_REQUEST_TEMP_TUNNEL_STAGGER_MS   3000
+
+
+/*
+One way of making the request: direct to a port, or via a temp tunnel.
+Run with RequestAttemptThread, either alone or racing others.
+*/
+struct RequestParams
+{
+    const SessionInfo& sessionInfo;
+    const TCHAR* requestPath;
+    LPCWSTR additionalHeaders;
+    LPVOID additionalData;
+    DWORD additionalDataLength;
+};
+
+struct RequestAttempt
+{
+    RequestAttempt(
+        const RequestParams& params,
+        const StopInfo& parentStopInfo,
+        int directPort,
+        shared_ptr<ITransport> tempTransport)
+        : params(params),
+          stopSignal(parentStopInfo.stopSignal),
+          stopInfo(&stopSignal, parentStopInfo.stopReasons | STOP_REASON_CANCEL),
+          directPort(directPort),
+          tempTransport(tempTransport),
+          thread(NULL),
+          success(false)
+    {
+    }
+
+    ~RequestAttempt()
+    {
+        if (thread)
+        {
+            CloseHandle(thread);
+        }
+    }
+
+    const RequestParams& params;
+    RaceStopSignal stopSignal;
+    StopInfo stopInfo;
+    int directPort;
+    shared_ptr<ITransport> tempTransport;
+    HANDLE thread;
+    bool success;
+    string response;
+};
+
+/*
+Identical requests -- same server, endpoint, parameters and body -- made while
+one is in flight share its result, rather than each making the round trip.
+If the one making the request is stopped, the others carry on with one of
+their own.
+*/
+struct InFlightRequest
+{
+    InFlightRequest() : completed(false), success(false)
+    {
+        doneEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    }
+
+    ~InFlightRequest()
+    {
+        if (doneEvent)
+        {
+            CloseHandle(doneEvent);
+        }
+    }
+
+    // Set when the request is done, whether or not it completed
+    HANDLE doneEvent;
+    // Only read after doneEvent is set
+    bool completed;
+    bool success;
+    string response;
+};
+
+static Lock g_inFlightRequestsLock("InFlightServerRequests");
+static map<string, shared_ptr<InFlightRequest>> g_inFlightRequests;
+
+// The request's endpoint, for TunnelMetrics: e.g., "handshake" for
+// "/handshake?...".
+static string RequestMetricsName(const TCHAR* requestPath)
+{
+    tstring name(requestPath[0] == _T('/') ? requestPath + 1 : requestPath);
+    name.resize(min(name.find(_T('?')), name.length()));
+    return WStringToUTF8(name);
+}
+
 ServerRequest::ServerRequest()
 {
 }
@@ -93,11 +189,94 @@ bool ServerRequest::MakeRequest(
         const ITransport* currentTransport,
         const SessionInfo& sessionInfo,
         const TCHAR* requestPath,
-        string& response,
+        string& o_response,
         const StopInfo& stopInfo,
         LPCWSTR additionalHeaders/*=NULL*/,
         LPVOID additionalData/*=NULL*/,
         DWORD additionalDataLength/*=0*/)
+{
+    // Throws if signaled
+    stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+    assert(requestPath);
+
+    ostringstream keyStream;
+    keyStream << (int)reqLevel << "|" << sessionInfo.GetServerAddress()
+              << "|" << WStringToUTF8(requestPath)
+              << "|" << (additionalHeaders ? WStringToUTF8(additionalHeaders) : "")
+              << "|" << Sha256Hex((const unsigned char*)additionalData, additionalData ? additionalDataLength : 0);
+    string key = keyStream.str();
+
+    while (true)
+    {
+        shared_ptr<InFlightRequest> inFlight;
+        bool ours = false;
+        {
+            AutoLock lock(g_inFlightRequestsLock);
+            auto it = g_inFlightRequests.find(key);
+            if (it != g_inFlightRequests.end())
+            {
+                inFlight = it->second;
+            }
+            else if ((inFlight = make_shared<InFlightRequest>())->doneEvent)
+            {
+                g_inFlightRequests[key] = inFlight;
+                ours = true;
+            }
+        }
+
+        if (!inFlight->doneEvent)
+        {
+            // Can't be shared; just make it
+            return MakeUnsharedRequest(
+                        reqLevel, currentTransport, sessionInfo, requestPath, o_response,
+                        stopInfo, additionalHeaders, additionalData, additionalDataLength);
+        }
+
+        if (ours)
+        {
+            auto done = finally([&key, &inFlight]()
+            {
+                AutoLock lock(g_inFlightRequestsLock);
+                g_inFlightRequests.erase(key);
+                SetEvent(inFlight->doneEvent);
+            });
+
+            // Throws if stopped, leaving completed false
+            inFlight->success = MakeUnsharedRequest(
+                                    reqLevel, currentTransport, sessionInfo, requestPath, inFlight->response,
+                                    stopInfo, additionalHeaders, additionalData, additionalDataLength);
+            inFlight->completed = true;
+            o_response = inFlight->response;
+            return inFlight->success;
+        }
+
+        my_print(NOT_SENSITIVE, true, _T("%s: sharing in-flight %S request"), __TFUNCTION__, RequestMetricsName(requestPath).c_str());
+
+        HANDLE waitHandles[2] = { inFlight->doneEvent, stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons) };
+        (void)WaitForMultipleObjects(2, waitHandles, FALSE, INFINITE);
+
+        // Throws if signaled
+        stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+        if (inFlight->completed)
+        {
+            o_response = inFlight->response;
+            return inFlight->success;
+        }
+    }
+}
+
+bool ServerRequest::MakeUnsharedRequest(
+        ReqLevel reqLevel,
+        const ITransport* currentTransport,
+        const SessionInfo& sessionInfo,
+        const TCHAR* requestPath,
+        string& response,
+        const StopInfo& stopInfo,
+        LPCWSTR additionalHeaders,
+        LPVOID additionalData,
+        DWORD additionalDataLength)
 {
     // See comments at the top of this file for full discussion of logic.
 
@@ -124,6 +303,7 @@ bool ServerRequest::MakeRequest(
 
         // This is the simple case: we just connect through the transport
         HTTPSRequest httpsRequest;
+        httpsRequest.SetMetricsName(RequestMetricsName(requestPath));
         HTTPSRequest::Response httpsResponse;
         bool requestSuccess =
             httpsRequest.MakeRequest(
@@ -150,118 +330,289 @@ bool ServerRequest::MakeRequest(
     }
 
     // We don't have a connected transport.
-    // We'll fail over between a bunch of methods.
+    // We'll fail over between a bunch of methods. The direct HTTPS ports are
+    // tried in parallel, and the first temp tunnel joins them after a
+    // stagger; the first to succeed wins and the others are cancelled.
+    // Any further temp tunnels are then tried one at a time.
+
+    RequestParams params = {
+        sessionInfo, requestPath, additionalHeaders, additionalData, additionalDataLength };
+
+    vector<shared_ptr<RequestAttempt>> directAttempts;
 
     if (sessionInfo.GetServerEntry().HasCapability(UNTUNNELED_WEB_REQUEST_CAPABILITY))
     {
         // TODO: check separate capability for additional ports
 
-        // The ports we'll try to connect to directly, in order.
+        // The ports we'll try to connect to directly.
         vector<int> ports;
         ports.push_back(sessionInfo.GetWebPort());
-        ports.push_back(443); // Also try the standard HTTPS port.
-        vector<int>::const_iterator port_iter;
-        for (port_iter = ports.begin(); port_iter != ports.end(); port_iter++)
+        if (sessionInfo.GetWebPort() != 443)
         {
-            HTTPSRequest httpsRequest;
-            HTTPSRequest::Response httpsResponse;
-            if (httpsRequest.MakeRequest(
-                    UTF8ToWString(sessionInfo.GetServerAddress()).c_str(),
-                    *port_iter,
-                    sessionInfo.GetWebServerCertificate(),
-                    requestPath,
-                    stopInfo,
-                    HTTPSRequest::PsiphonProxy::DONT_USE, // don't try to tunnel -- there's no transport
-                    httpsResponse,
-                    false, // don't fail over to URL proxy
-                    additionalHeaders,
-                    additionalData,
-                    additionalDataLength)
-                || httpsResponse.code != HTTPSRequest::OK)
-            {
-                response = httpsResponse.body;
-                return true;
-            }
+            ports.push_back(443); // Also try the standard HTTPS port.
+        }
 
-            my_print(NOT_SENSITIVE, true, _T("%s: HTTPS:%d failed"), __TFUNCTION__, *port_iter);
+        for (auto port : ports)
+        {
+            directAttempts.push_back(make_shared<RequestAttempt>(params, stopInfo, port, shared_ptr<ITransport>()));
         }
     }
 
-    if (reqLevel == NO_TEMP_TUNNEL)
+    vector<shared_ptr<ITransport>> tempTransports;
+    if (reqLevel != NO_TEMP_TUNNEL)
     {
-        // Caller doesn't want a temp tunnel.
-        return false;
+        GetTempTransports(sessionInfo.GetServerEntry(), tempTransports);
     }
 
-    // Connecting directly via HTTPS failed.
-    // Now we'll try don't-need-handshake transports.
+    shared_ptr<RequestAttempt> staggeredAttempt;
+    if (!tempTransports.empty())
+    {
+        staggeredAttempt = make_shared<RequestAttempt>(params, stopInfo, 0, tempTransports[0]);
+    }
 
-    vector<shared_ptr<ITransport>> tempTransports;
-    GetTempTransports(sessionInfo.GetServerEntry(), tempTransports);
+    if (RaceRequestAttempts(directAttempts, staggeredAttempt, SERVER_REQUEST_TEMP_TUNNEL_STAGGER_MS, stopInfo, response))
+    {
+        return true;
+    }
 
     bool success = false;
 
-    for (const auto& transport : tempTransports)
+    for (size_t i = 1; i < tempTransports.size() && !success; i++)
     {
-        TransportConnection connection;
+        RequestAttempt attempt(params, stopInfo, 0, tempTransports[i]);
+        RequestAttemptThread(&attempt);
 
-        try
+        // Throws if signaled
+        stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+        if (attempt.success)
         {
-            // Note that it's important that we indicate that we're not
-            // collecting stats -- otherwise we could end up with a loop of
-            // final /status request attempts.
+            response = attempt.response;
+            success = true;
+        }
+    }
 
-            const auto& serverEntry = sessionInfo.GetServerEntry();
+    // We've tried everything we can.
 
-            // Throws on failure
-            connection.Connect(
-                stopInfo,
-                transport.get(),
-                NULL, // not receiving reconnection notifications
-                NULL, // not receiving upgrade paver calls
-                NULL, // not collecting stats
-                NULL, // not supplying authorizations
-                &serverEntry);  // force use of this server
+    return success;
+}
+
+// static
+DWORD WINAPI ServerRequest::RequestAttemptThread(void* object)
+{
+    RequestAttempt* attempt = (RequestAttempt*)object;
+    const RequestParams& params = attempt->params;
+    const SessionInfo& sessionInfo = params.sessionInfo;
 
+    attempt->success = false;
+
+    try
+    {
+        if (!attempt->tempTransport)
+        {
             HTTPSRequest httpsRequest;
+            httpsRequest.SetMetricsName(RequestMetricsName(params.requestPath));
             HTTPSRequest::Response httpsResponse;
             if (httpsRequest.MakeRequest(
                     UTF8ToWString(sessionInfo.GetServerAddress()).c_str(),
-                    sessionInfo.GetWebPort(),
+                    attempt->directPort,
                     sessionInfo.GetWebServerCertificate(),
-                    requestPath,
-                    stopInfo,
-                    HTTPSRequest::PsiphonProxy::USE,
+                    params.requestPath,
+                    attempt->stopInfo,
+                    HTTPSRequest::PsiphonProxy::DONT_USE, // don't try to tunnel -- there's no transport
                     httpsResponse,
                     false, // don't fail over to URL proxy
-                    additionalHeaders,
-                    additionalData,
-                    additionalDataLength)
-                || httpsResponse.code != HTTPSRequest::OK)
+                    params.additionalHeaders,
+                    params.additionalData,
+                    params.additionalDataLength)
+                && httpsResponse.code == HTTPSRequest::OK)
             {
-                response = httpsResponse.body;
-                success = true;
+                attempt->response = httpsResponse.body;
+                attempt->success = true;
+                return 0;
+            }
+
+            my_print(NOT_SENSITIVE, true, _T("%s: HTTPS:%d failed"), __TFUNCTION__, attempt->directPort);
+            return 0;
+        }
+
+        // Note that the temp tunnel doesn't collect stats -- otherwise we
+        // could end up with a loop of final /status request attempts.
+
+        const auto& serverEntry = sessionInfo.GetServerEntry();
+
+        // Throws on failure
+        unique_ptr<TempTunnel> tunnel = TempTunnelPool::Acquire(
+            attempt->tempTransport->GetTransportProtocolName() + _T(":") + UTF8ToWString(serverEntry.serverAddress),
+            attempt->tempTransport,
+            serverEntry,  // force use of this server
+            false,        // do apply system proxy settings
+            attempt->stopInfo);
+
+        HTTPSRequest httpsRequest;
+        httpsRequest.SetMetricsName(RequestMetricsName(params.requestPath));
+        HTTPSRequest::Response httpsResponse;
+        if (httpsRequest.MakeRequest(
+                UTF8ToWString(sessionInfo.GetServerAddress()).c_str(),
+                sessionInfo.GetWebPort(),
+                sessionInfo.GetWebServerCertificate(),
+                params.requestPath,
+                attempt->stopInfo,
+                HTTPSRequest::PsiphonProxy::USE,
+                httpsResponse,
+                false, // don't fail over to URL proxy
+                params.additionalHeaders,
+                params.additionalData,
+                params.additionalDataLength)
+            && httpsResponse.code == HTTPSRequest::OK)
+        {
+            attempt->response = httpsResponse.body;
+            attempt->success = true;
+        }
+        else
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: transport:%s failed"), __TFUNCTION__, attempt->tempTransport->GetTransportProtocolName().c_str());
+        }
+
+        // Kept for a following request, if it's still up
+        TempTunnelPool::Release(std::move(tunnel));
+    }
+    catch (...)
+    {
+        // Stops (including being cancelled) and failures alike; the caller
+        // checks its own stop signal.
+    }
+
+    return 0;
+}
+
+/*
+Runs the attempts in parallel, each on its own thread, with staggeredAttempt
+(if any) starting after staggerMilliseconds -- or as soon as all the others
+have failed. Returns true with o_response set once one succeeds; the rest are
+cancelled. Doesn't return until all the attempt threads are done.
+Throws if stopInfo is signaled.
+*/
+// static
+bool ServerRequest::RaceRequestAttempts(
+                        vector<shared_ptr<RequestAttempt>>& attempts,
+                        shared_ptr<RequestAttempt> staggeredAttempt,
+                        DWORD staggerMilliseconds,
+                        const StopInfo& stopInfo,
+                        string& o_response)
+{
+    vector<shared_ptr<RequestAttempt>> running;
+    shared_ptr<RequestAttempt> winner;
+
+    // Starts the attempt, or runs it inline if no thread can be made.
+    auto start = [&running](shared_ptr<RequestAttempt> attempt)
+    {
+        attempt->thread = ThreadPool::Instance().Run(RequestAttemptThread, (void*)attempt.get());
+        if (!attempt->thread)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: ThreadPool::Run failed (%d)"), __TFUNCTION__, GetLastError());
+            RequestAttemptThread((void*)attempt.get());
+        }
+        running.push_back(attempt);
+    };
+
+    for (auto& attempt : attempts)
+    {
+        start(attempt);
+    }
+
+    if (staggeredAttempt && attempts.empty())
+    {
+        start(staggeredAttempt);
+        staggeredAttempt.reset();
+    }
+
+    DWORD startTime = GetTickCount();
+
+    while (!winner)
+    {
+        // Collect the attempts still running; check the finished ones.
+        vector<HANDLE> waitHandles;
+        for (auto& attempt : running)
+        {
+            if (attempt->thread && WaitForSingleObject(attempt->thread, 0) == WAIT_TIMEOUT)
+            {
+                waitHandles.push_back(attempt->thread);
+            }
+            else if (attempt->success)
+            {
+                winner = attempt;
+                break;
+            }
+        }
+
+        if (winner)
+        {
+            break;
+        }
+
+        if (waitHandles.empty())
+        {
+            if (!staggeredAttempt)
+            {
+                // Everything failed
                 break;
             }
 
-            my_print(NOT_SENSITIVE, true, _T("%s: transport:%s failed"), __TFUNCTION__, transport->GetTransportProtocolName().c_str());
+            start(staggeredAttempt);
+            staggeredAttempt.reset();
+            continue;
+        }
 
-            // Note that when we leave this scope, the TransportConnection will
-            // clean up the transport connection.
+        DWORD timeout = INFINITE;
+        if (staggeredAttempt)
+        {
+            DWORD elapsed = GetTickCount() - startTime;
+            if (elapsed >= staggerMilliseconds)
+            {
+                start(staggeredAttempt);
+                staggeredAttempt.reset();
+                continue;
+            }
+            timeout = staggerMilliseconds - elapsed;
         }
-        catch (StopSignal::StopException&)
+
+        // The attempts watch the stop signal themselves, so there's no need
+        // to wait on it here.
+        DWORD result = WaitForMultipleObjects((DWORD)waitHandles.size(), &waitHandles[0], FALSE, timeout);
+        if (result == WAIT_FAILED)
         {
-            throw;
+            my_print(NOT_SENSITIVE, true, _T("%s: WaitForMultipleObjects failed (%d)"), __TFUNCTION__, GetLastError());
+            break;
         }
-        catch (...)
+    }
+
+    for (auto& attempt : running)
+    {
+        if (attempt != winner)
         {
-            // pass and continue
+            attempt->stopSignal.SignalStop(STOP_REASON_CANCEL);
         }
     }
 
-    // We've tried everything we can.
+    for (auto& attempt : running)
+    {
+        if (attempt->thread)
+        {
+            WaitForSingleObject(attempt->thread, INFINITE);
+        }
+    }
 
-    return success;
+    // Throws if signaled
+    stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+    if (winner)
+    {
+        o_response = winner->response;
+        return true;
+    }
+
+    return false;
 }
 
 /*
@@ -281,16 +632,13 @@ void ServerRequest::GetTempTransports(
 {
     o_tempTransports.clear();
 
-    vector<shared_ptr<ITransport>> all_transports;
-    TransportRegistry::NewAll(all_transports);
+    // Only transports that don't require a handshake.
+    vector<shared_ptr<ITransport>> candidateTransports;
+    TransportRegistry::NewAllWithoutHandshake(candidateTransports);
 
-    for (const auto& it : all_transports)
+    for (const auto& it : candidateTransports)
     {
-        // Only try transports that aren't the same as the current
-        // transport (because there's a reason it's not connected)
-        // and doesn't require a handshake.
-        if (!it->IsHandshakeRequired()
-            && it->ServerHasCapabilities(serverEntry))
+        if (it->ServerHasCapabilities(serverEntry))
         {
             o_tempTransports.push_back(it);
             // no early break, so that we delete all the unused transports
@@ -303,7 +651,7 @@ bool ServerRequest::ServerHasRequestCapabilities(const ServerEntry& serverEntry)
     // We can make a request if the server supports either direct web requests
     // or tunnelled requests through a tunnel that doesn't need a handshake.
 
-    if (serverEntry.HasCapability("handshake"))
+    if (serverEntry.HasCapabilities(SERVER_CAPABILITY_HANDSHAKE))
     {
         return true;
     }
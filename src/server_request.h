@@ -24,6 +24,7 @@
 class ITransport;
 class SessionInfo;
 struct ServerEntry;
+struct RequestAttempt;
 
 
 class ServerRequest
@@ -48,6 +49,8 @@ public:
     };
 
     // Throws stop signal.
+    // Shares the result of an identical request that's already in flight,
+    // if there is one.
     static bool MakeRequest(
         ReqLevel reqLevel,
         const ITransport* currentTransport,
@@ -62,6 +65,26 @@ public:
     static bool ServerHasRequestCapabilities(const ServerEntry& serverEntry);
 
 private:
+    static bool MakeUnsharedRequest(
+        ReqLevel reqLevel,
+        const ITransport* currentTransport,
+        const SessionInfo& sessionInfo,
+        const TCHAR* requestPath,
+        string& o_response,
+        const StopInfo& stopInfo,
+        LPCWSTR additionalHeaders,
+        LPVOID additionalData,
+        DWORD additionalDataLength);
+
+    static DWORD WINAPI RequestAttemptThread(void* object);
+
+    static bool RaceRequestAttempts(
+                    vector<shared_ptr<RequestAttempt>>& attempts,
+                    shared_ptr<RequestAttempt> staggeredAttempt,
+                    DWORD staggerMilliseconds,
+                    const StopInfo& stopInfo,
+                    string& o_response);
+
     static void GetTempTransports(
                     const ServerEntry& serverEntry,
                     vector<shared_ptr<ITransport>>& o_tempTransports);
@@ -24,421 +24,1971 @@
 #include "embeddedvalues.h"
 #include "config.h"
 #include "utilities.h"
+#include "thread_pool.h"
+#include "usersettings.h"
 #include <algorithm>
 #include <sstream>
+#include <set>
+#include <list>
+#include <unordered_map>
+#include <float.h>
+#include <time.h>
+
+
+// Weight given to the newest sample in the response time moving average.
+static const double SERVER_STATS_EWMA_ALPHA = 0.3;
+// Each consecutive failure is penalized as if the server took this much longer to respond.
+static const double SERVER_STATS_FAILURE_PENALTY_MILLISECONDS = 5000.0;
+// Servers with this many consecutive failures aren't moved to the front.
+static const unsigned int SERVER_STATS_MAX_FAILURES = 3;
+// History older than this is re-probed.
+static const time_t SERVER_STATS_FRESH_SECONDS = 60*60;
+// Servers with this many consecutive failures are quarantined: first for the
+// minimum time, doubling with each further failure up to the maximum.
+static const unsigned int SERVER_STATS_QUARANTINE_FAILURES = 2;
+static const time_t SERVER_STATS_QUARANTINE_MIN_SECONDS = 60;
+static const time_t SERVER_STATS_QUARANTINE_MAX_SECONDS = 60*60;
+// A request through the tunnel takes about two round trips to the server, and
+// a connect about one, so half the tunnel latency is comparable to the
+// response time. It only counts against a server when it's the larger.
+static const double SERVER_STATS_TUNNEL_LATENCY_FACTOR = 0.5;
+// Throughput is only observed, not probed, so it's a lower bound on what the
+// server can do: proving this much earns the full bonus, and less earns a
+// proportional share.
+static const double SERVER_STATS_THROUGHPUT_REFERENCE_BYTES_PER_SECOND = 1024.0*1024.0;
+static const double SERVER_STATS_THROUGHPUT_BONUS_MILLISECONDS = 200.0;
+// Establishing a tunnel takes a TCP connect, the obfuscation and SSH
+// handshakes and the API handshake: about four round trips, where a probe
+// takes one.
+static const double SERVER_STATS_ESTABLISH_LATENCY_FACTOR = 0.25;
+
+
+// Delay before a modified list is written back to the registry. Changes
+// made within this window are coalesced into a single write.
+static const DWORD SERVER_LIST_WRITE_DELAY_MILLISECONDS = 2000;
+
+// The most entries a list keeps. Beyond this, the worst are evicted when the
+// list is written (see ServerList::SelectEntriesToKeep).
+static const size_t SERVER_LIST_MAX_ENTRIES = 1000;
+// History this old no longer says anything about a server, which is then
+// ranked as if it had never been tried.
+static const time_t SERVER_LIST_STALE_SECONDS = 30*24*60*60;
 
 
+/***********************************************
+ServerListCache
+*/
+
+// Process-wide, indexed copy of a named server list. All ServerList instances
+// with the same name share one cache, which is guarded by its lock. The registry is only read when the cache is
+// first loaded, and is written lazily (see ScheduleWrite).
+struct ServerListCache
+{
+    typedef list<ServerEntry> Entries;
+
+    ServerListCache(const string& name)
+        : name(name), lock(("ServerList-" + name).c_str()),
+          loaded(false), dirty(false), writeTimer(NULL), version(0)
+    {
+    }
+
+    Entries::iterator Find(const string& serverAddress)
+    {
+        auto indexEntry = index.find(serverAddress);
+        return (indexEntry == index.end()) ? entries.end() : indexEntry->second;
+    }
+
+    // Inserts at the head, or as the second entry so that the first entry can
+    // continue to be used if it is reachable.
+    void Insert(const ServerEntry& entry, bool atHead)
+    {
+        Entries::iterator position = (atHead || entries.empty()) ? entries.begin() : next(entries.begin());
+        index[entry.serverAddress] = entries.insert(position, entry);
+        Changed();
+    }
+
+    // Moves an existing node without copying the entry.
+    void Move(Entries::iterator entry, bool atHead)
+    {
+        Entries::iterator position = (atHead || entries.size() <= 1) ? entries.begin() : next(entries.begin());
+        if (entry == position)
+        {
+            return;
+        }
+        entries.splice(position, entries, entry);
+        Changed();
+    }
+
+    // Inserts all of newEntries, in order, with one splice; newEntries is left
+    // empty. The addresses must not already be in the list.
+    void InsertAll(Entries& newEntries, bool atHead)
+    {
+        for (Entries::iterator entry = newEntries.begin(); entry != newEntries.end(); ++entry)
+        {
+            index[entry->serverAddress] = entry;
+        }
+        Entries::iterator position = (atHead || entries.empty()) ? entries.begin() : next(entries.begin());
+        entries.splice(position, newEntries);
+        Changed();
+    }
+
+    void MoveToBack(Entries::iterator entry)
+    {
+        entries.splice(entries.end(), entries, entry);
+        Changed();
+    }
+
+    void Assign(const ServerEntries& newEntries)
+    {
+        entries.clear();
+        index.clear();
+        for (ServerEntryIterator entry = newEntries.begin(); entry != newEntries.end(); ++entry)
+        {
+            if (index.find(entry->serverAddress) != index.end())
+            {
+                continue;
+            }
+            index[entry->serverAddress] = entries.insert(entries.end(), *entry);
+        }
+        Changed();
+    }
+
+    // Must be called after any change to the entries, including changing
+    // one in place; the above do it themselves.
+    void Changed()
+    {
+        version++;
+        snapshot.reset();
+    }
+
+    // Made on the first call after a change, then shared until the next.
+    ServerListSnapshotPtr Snapshot()
+    {
+        if (!snapshot)
+        {
+            snapshot = make_shared<const ServerListSnapshot>(ServerEntries(entries.begin(), entries.end()), version);
+        }
+        return snapshot;
+    }
+
+    string name;
+    Lock lock;
+    Entries entries;
+    unordered_map<string, Entries::iterator> index;
+    bool loaded;
+    bool dirty;
+    HANDLE writeTimer;
+    unsigned long long version;
+    ServerListSnapshotPtr snapshot;
+};
+
+static map<string, ServerListCache*> g_serverListCaches;
+static Lock g_serverListCachesLock("ServerListCaches");
+
+// The embedded list is the same for every named list and never changes, so
+// it's parsed once per process rather than on each list's first load.
+static Lock g_embeddedServerEntriesLock("EmbeddedServerEntries");
+static unique_ptr<ServerEntries> g_embeddedServerEntries;
+// Each embedded line's server address, offset and length, for handing the
+// lines to the core reordered but otherwise as embedded.
+struct EmbeddedServerLine
+{
+    string serverAddress;
+    size_t offset;
+    size_t length;
+};
+static unique_ptr<vector<EmbeddedServerLine>> g_embeddedServerLines;
+
+static ServerListCache* GetServerListCache(const string& name)
+{
+    AutoLock lock(g_serverListCachesLock);
+
+    auto cache = g_serverListCaches.find(name);
+    if (cache != g_serverListCaches.end())
+    {
+        return cache->second;
+    }
+
+    // Caches live for the lifetime of the process.
+    ServerListCache* newCache = new ServerListCache(name);
+    g_serverListCaches[name] = newCache;
+    return newCache;
+}
+
+
+/***********************************************
+ServerList members
+*/
+
 ServerList::ServerList(LPCSTR listName)
 {
     assert(listName && strlen(listName));
     m_name = listName;
 
-    // Used a named mutex, because we'll need to use the mutex across instances.
-    tstring mutexName = _T("Local\\ServerListMutex-") + UTF8ToWString(listName);
-    m_mutex = CreateMutex(NULL, FALSE, mutexName.c_str());
+    // Instances with the same name share the cache, and its lock.
+    m_cache = GetServerListCache(m_name);
 }
 
 ServerList::~ServerList()
 {
-    CloseHandle(m_mutex);
 }
 
-// This function may throw
-size_t ServerList::AddEntriesToList(
-                    const vector<string>& newServerEntryList,
-                    const ServerEntry* serverEntry)
+// static
+void ServerList::FlushAll()
 {
-    AutoMUTEX lock(m_mutex);
-
-    size_t entriesAdded = 0;
+    vector<ServerListCache*> caches;
+    {
+        AutoLock lock(g_serverListCachesLock);
+        for (auto it = g_serverListCaches.begin(); it != g_serverListCaches.end(); ++it)
+        {
+            caches.push_back(it->second);
+        }
+    }
 
-    if (newServerEntryList.size() < 1 && !serverEntry)
+    for (auto it = caches.begin(); it != caches.end(); ++it)
     {
-        return entriesAdded;
+        ServerList((*it)->name.c_str()).Flush();
     }
+}
 
-    // We're going to loop through the server entries twice -- once to decode
-    // them and once to process them (after adding in serverEntry). This is
-    // not optimally efficient, but the array will never be very large and the
-    // code will be cleaner.
+// Heap used by the entry's strings and vectors, beyond the entry itself
+static size_t ServerEntryHeapBytes(const ServerEntry& entry)
+{
+    size_t total =
+        StringHeapBytes(entry.serverAddress)
+        + StringHeapBytes(entry.webServerSecret)
+        + StringHeapBytes(entry.webServerCertificate)
+        + StringHeapBytes(entry.sshUsername)
+        + StringHeapBytes(entry.sshPassword)
+        + StringHeapBytes(entry.sshHostKey)
+        + StringHeapBytes(entry.sshObfuscatedKey)
+        + StringHeapBytes(entry.meekObfuscatedKey)
+        + StringHeapBytes(entry.meekCookieEncryptionPublicKey)
+        + StringHeapBytes(entry.meekFrontingAddressesRegex)
+        + entry.SerializedHeapBytes();
+
+    // The interned fields are counted once, with their pools.
+
+    return total;
+}
 
-    vector<ServerEntry> decodedServerEntries;
-    vector<string>::const_iterator entryStringIter;
-    for (entryStringIter = newServerEntryList.begin();
-         entryStringIter != newServerEntryList.end();
-         ++entryStringIter)
+// static
+size_t ServerList::GetCacheMemoryUsage()
+{
+    vector<ServerListCache*> caches;
     {
-        decodedServerEntries.push_back(ParseServerEntry(*entryStringIter));
+        AutoLock lock(g_serverListCachesLock);
+        for (auto it = g_serverListCaches.begin(); it != g_serverListCaches.end(); ++it)
+        {
+            caches.push_back(it->second);
+        }
     }
 
-    if (serverEntry) decodedServerEntries.push_back(*serverEntry);
+    size_t total = 0;
 
-    // This list may contain more than one discovered server
-    // Randomize this list for load-balancing
-    random_shuffle(decodedServerEntries.begin(), decodedServerEntries.end());
+    for (auto it = caches.begin(); it != caches.end(); ++it)
+    {
+        ServerListCache* cache = *it;
+        AutoLock lock(cache->lock);
 
-    ServerEntries oldServerEntryList = GetList();
+        // Each entry is a list node (two links) plus an index node (a link,
+        // the key and the iterator) and its bucket.
+        for (auto entry = cache->entries.begin(); entry != cache->entries.end(); ++entry)
+        {
+            total += sizeof(ServerEntry) + 2 * sizeof(void*) + ServerEntryHeapBytes(*entry);
+            total += sizeof(void*) + sizeof(string) + StringHeapBytes(entry->serverAddress)
+                     + sizeof(ServerListCache::Entries::iterator);
+        }
+        total += cache->index.bucket_count() * 2 * sizeof(void*);
 
-    vector<ServerEntry>::const_iterator decodedEntryIter;
-    for (decodedEntryIter = decodedServerEntries.begin();
-         decodedEntryIter != decodedServerEntries.end(); ++decodedEntryIter)
-    {
-        // Check if we already know about this server
-        bool alreadyKnown = false;
-        for (ServerEntries::iterator oldServerEntry = oldServerEntryList.begin();
-             oldServerEntry != oldServerEntryList.end(); ++oldServerEntry)
+        // The current snapshot, if there is one. Older ones still held by
+        // readers aren't counted.
+        if (cache->snapshot)
         {
-            if ((*decodedEntryIter).serverAddress == oldServerEntry->serverAddress)
+            for (auto entry = cache->snapshot->entries.begin(); entry != cache->snapshot->entries.end(); ++entry)
             {
-                alreadyKnown = true;
-                // NOTE: We always update the values for known servers, because we trust the
-                //       discovery mechanisms
-                oldServerEntry->Copy(*decodedEntryIter);
-                break;
+                total += sizeof(ServerEntry) + ServerEntryHeapBytes(*entry);
             }
         }
+    }
 
-        if (!alreadyKnown)
+    {
+        AutoLock lock(g_embeddedServerEntriesLock);
+        if (g_embeddedServerEntries)
         {
-            // Insert the new entry as the second entry, so that the first entry can continue
-            // to be used if it is reachable (unless there are no pre-existing entries).
-            oldServerEntryList.insert(
-                oldServerEntryList.size() == 0 ?
-                    oldServerEntryList.begin() :
-                    oldServerEntryList.begin() + 1,
-                *decodedEntryIter);
-
-            entriesAdded++;
+            for (auto entry = g_embeddedServerEntries->begin(); entry != g_embeddedServerEntries->end(); ++entry)
+            {
+                total += sizeof(ServerEntry) + ServerEntryHeapBytes(*entry);
+            }
         }
     }
 
-    WriteListToSystem(oldServerEntryList);
+    total += Interned<string>::PoolHeapBytes() + Interned<vector<string>>::PoolHeapBytes();
 
-    return entriesAdded;
+    return total;
 }
 
-void ServerList::MoveEntriesToFront(const ServerEntries& entries, bool veryFront/*=false*/)
+void ServerList::Flush()
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_cache->lock);
+
+    if (m_cache->writeTimer)
+    {
+        // Don't wait for the callback; it also takes the lock, and will find nothing to do.
+        DeleteTimerQueueTimer(NULL, m_cache->writeTimer, NULL);
+        m_cache->writeTimer = NULL;
+    }
 
-    ServerEntries persistentServerEntryList = GetList();
+    if (!m_cache->dirty)
+    {
+        return;
+    }
 
-    // Insert entries in input order
+    m_cache->dirty = false;
 
-    for (ServerEntries::const_reverse_iterator entry = entries.rbegin(); entry != entries.rend(); ++entry)
+    EnforceCapacity(SERVER_LIST_MAX_ENTRIES);
+
+    // Serialized in the list itself, so that the snapshot's copies share the
+    // results, and later writes only serialize what's new or changed. A
+    // snapshot made before then has none of them.
+    bool serialized = false;
+    for (auto entry = m_cache->entries.begin(); entry != m_cache->entries.end(); ++entry)
+    {
+        if (!entry->IsSerialized())
+        {
+            (void)entry->ToString();
+            serialized = true;
+        }
+    }
+    if (serialized)
     {
-        // Remove existing entry for server, if present. In the case where
-        // the existing entry has different data, we must assume that a
-        // discovery has happened that overwrote the data that's being
-        // passed in. In that edge case, we just keep the existing entry
-        // in its current position.
+        m_cache->snapshot.reset();
+    }
+
+    ServerListSnapshotPtr snapshot = m_cache->Snapshot();
+    size_t written = WriteListToSystem(snapshot->entries);
+
+    // WriteListToSystem could truncate the list if it had to fall back to the
+    // registry and the list is too long to write there. It keeps the same
+    // entries this does, so the cache stays consistent with what is stored
+    // in the system.
+    EnforceCapacity(written);
+}
 
-        bool existingEntryChanged = false;
+ServerEntries ServerList::SelectEntriesToKeep(const ServerEntries& serverEntryList, size_t capacity)
+{
+    if (serverEntryList.size() <= capacity)
+    {
+        return serverEntryList;
+    }
 
-        // If we replace the head item, we want to make sure we insert at the head.
-        bool forceHead = false;
+    // Ranked best first: the head of the list, which is kept for server
+    // affinity; then servers that have responded, by score; then those
+    // with no (or only stale) history, in list order; then those that have
+    // failed repeatedly, fewest failures first.
+    // Embedded entries needn't be treated specially: any that are evicted
+    // are merged back in the next time the list is loaded.
+    ServerStatsMap stats = GetStatsFromSystem();
+    time_t now = time(0);
+
+    vector<pair<pair<int, double>, size_t>> ranked;
+    for (size_t i = 0; i < serverEntryList.size(); i++)
+    {
+        int rankClass = 2;
+        double rankValue = 0.0;
 
-        for (ServerEntries::iterator persistentEntry = persistentServerEntryList.begin();
-             persistentEntry != persistentServerEntryList.end();
-             ++persistentEntry)
+        auto entryStats = stats.find(serverEntryList[i].serverAddress);
+        if (i == 0)
         {
-            if (entry->serverAddress == persistentEntry->serverAddress)
-            {
-                if (entry->ToString() != persistentEntry->ToString())
-                {
-                    existingEntryChanged = true;
-                }
-                else
-                {
-                    forceHead = (persistentEntry == persistentServerEntryList.begin());
-                    persistentServerEntryList.erase(persistentEntry);
-                }
-                break;
-            }
+            rankClass = 0;
+        }
+        else if (entryStats == stats.end()
+                 || entryStats->second.lastUpdated > now
+                 || now - entryStats->second.lastUpdated >= SERVER_LIST_STALE_SECONDS)
+        {
+            rankClass = 2;
+        }
+        else if (entryStats->second.failureCount >= SERVER_STATS_MAX_FAILURES)
+        {
+            rankClass = 3;
+            rankValue = entryStats->second.failureCount;
+        }
+        else if (entryStats->second.successCount > 0)
+        {
+            rankClass = 1;
+            rankValue = entryStats->second.Score();
         }
 
-        // Re-insert entry for server in new position
+        ranked.push_back(make_pair(make_pair(rankClass, rankValue), i));
+    }
 
-        if (!existingEntryChanged)
+    stable_sort(
+        ranked.begin(),
+        ranked.end(),
+        [](const pair<pair<int, double>, size_t>& a, const pair<pair<int, double>, size_t>& b)
         {
-            ServerEntries::const_iterator insertionPoint;
-            if (veryFront || forceHead || persistentServerEntryList.size() == 0)
-            {
-                insertionPoint = persistentServerEntryList.begin();
-            }
-            else
-            {
-                insertionPoint = persistentServerEntryList.begin() + 1;
-            }
+            return a.first < b.first;
+        });
+
+    // Kept in list order
+    vector<bool> keep(serverEntryList.size(), false);
+    for (size_t i = 0; i < capacity; i++)
+    {
+        keep[ranked[i].second] = true;
+    }
 
-            persistentServerEntryList.insert(insertionPoint, *entry);
+    ServerEntries kept;
+    for (size_t i = 0; i < serverEntryList.size(); i++)
+    {
+        if (keep[i])
+        {
+            kept.push_back(serverEntryList[i]);
         }
     }
+    return kept;
+}
+
+void ServerList::EnforceCapacity(size_t capacity)
+{
+    // Caller must hold m_cache->lock
+
+    if (m_cache->entries.size() <= capacity)
+    {
+        return;
+    }
 
-    WriteListToSystem(persistentServerEntryList);
+    size_t count = m_cache->entries.size();
+    m_cache->Assign(SelectEntriesToKeep(m_cache->Snapshot()->entries, capacity));
+
+    my_print(NOT_SENSITIVE, true, _T("%s: evicted %d of %d entries"), __TFUNCTION__, count - capacity, count);
 }
 
-void ServerList::MoveEntryToFront(const ServerEntry& serverEntry, bool veryFront/*=false*/)
+// static
+VOID CALLBACK ServerList::WriteTimerCallback(PVOID param, BOOLEAN /*timerOrWaitFired*/)
 {
-    ServerEntries serverEntries;
-    serverEntries.push_back(serverEntry);
-    MoveEntriesToFront(serverEntries, veryFront);
+    ServerListCache* cache = (ServerListCache*)param;
+    ServerList(cache->name.c_str()).Flush();
 }
 
-void ServerList::MarkServersFailed(const ServerEntries& failedServerEntries)
+void ServerList::ScheduleWrite()
+{
+    // Caller must hold m_cache->lock
+
+    m_cache->dirty = true;
+
+    if (m_cache->writeTimer)
+    {
+        // A write is already pending; this change will be included in it.
+        return;
+    }
+
+    if (!CreateTimerQueueTimer(
+            &m_cache->writeTimer,
+            NULL,
+            WriteTimerCallback,
+            m_cache,
+            SERVER_LIST_WRITE_DELAY_MILLISECONDS,
+            0,
+            WT_EXECUTEONLYONCE))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateTimerQueueTimer failed (%d)"), __TFUNCTION__, GetLastError());
+        m_cache->writeTimer = NULL;
+        Flush();
+    }
+}
+
+void ServerList::LoadCache()
 {
-    AutoMUTEX lock(m_mutex);
+    // Caller must hold m_cache->lock
 
-    ServerEntries serverEntryList = GetList();
-    if (serverEntryList.size() == 0 || failedServerEntries.size() == 0)
+    if (m_cache->loaded)
     {
         return;
     }
 
-    my_print(NOT_SENSITIVE, true, _T("%s: Marking %d servers failed"), __TFUNCTION__, failedServerEntries.size());
+    // Load persistent list of servers from system (registry)
 
-    bool changeMade = false;
+    ServerEntries systemServerEntryList;
 
-    for (ServerEntries::const_iterator failed = failedServerEntries.begin();
-            failed != failedServerEntries.end();
-            ++failed)
+    if (!IGNORE_SYSTEM_SERVER_LIST)
     {
-        for (ServerEntries::iterator entry = serverEntryList.begin();
-             entry != serverEntryList.end();
-             ++entry)
+        try
         {
-            if (failed->serverAddress == entry->serverAddress)
-            {
-                ServerEntry failedServer;
-                failedServer.Copy(*entry);
+            systemServerEntryList = GetListFromSystem();
+        }
+        catch (std::exception &ex)
+        {
+            my_print(NOT_SENSITIVE, false, string("Not using corrupt System Server List: ") + ex.what());
+        }
+    }
 
-                // Move the failed server to the end of the list
-                serverEntryList.erase(entry);
-                serverEntryList.push_back(failedServer);
+    m_cache->Assign(systemServerEntryList);
 
-                changeMade = true;
-                break;
+    // Add embedded list to system list.
+    // Cases:
+    // - This may be a new client run on a system with an existing registry entry; we want the new embedded values
+    // - This may be the first run, in which case the system list is empty
+
+    ServerEntries embeddedServerEntryList;
+    try
+    {
+        embeddedServerEntryList = GetListFromEmbeddedValues();
+        // Randomize this list for load-balancing
+        random_shuffle(embeddedServerEntryList.begin(), embeddedServerEntryList.end());
+    }
+    catch (std::exception &ex)
+    {
+        my_print(NOT_SENSITIVE, false, string("Not using corrupt Embedded Server List: ") + ex.what());
+        embeddedServerEntryList.clear();
+    }
+
+    for (ServerEntries::iterator embeddedServerEntry = embeddedServerEntryList.begin();
+         embeddedServerEntry != embeddedServerEntryList.end(); ++embeddedServerEntry)
+    {
+        // Check if we already know about this server
+        // We prioritize discovery information, so skip embedded entry entirely when already known
+        ServerListCache::Entries::iterator systemServerEntry = m_cache->Find(embeddedServerEntry->serverAddress);
+        if (systemServerEntry != m_cache->entries.end())
+        {
+            // Special case: if the embedded server entry has new info that the
+            // existing system entry does not, we know the embedded entry is actually newer
+            if (embeddedServerEntry->sshObfuscatedKey.length() > 0 &&
+                systemServerEntry->sshObfuscatedKey.length() == 0)
+            {
+                systemServerEntry->Copy(*embeddedServerEntry);
+                m_cache->Changed();
             }
+
+            continue;
+        }
+
+        // Insert the new entry as the second entry (if there already is at least one),
+        // so that the first entry can continue to be used if it is reachable
+        m_cache->Insert(*embeddedServerEntry, false);
+    }
+
+    m_cache->loaded = true;
+
+    // Write this out immediately, so the next run will get it from the system
+    m_cache->dirty = true;
+    Flush();
+}
+
+// This function may throw
+size_t ServerList::AddEntriesToList(
+                    const vector<string>& newServerEntryList,
+                    const ServerEntry* serverEntry)
+{
+    size_t entriesAdded = 0;
+
+    if (newServerEntryList.size() < 1 && !serverEntry)
+    {
+        return entriesAdded;
+    }
+
+    // Decode everything before modifying the cache, so that a corrupt entry
+    // doesn't leave a partial update behind. It's done without the lock, as a
+    // remote server list can have thousands of entries.
+
+    ServerEntries decodedServerEntries = ParseServerEntries(newServerEntryList);
+
+    if (serverEntry) decodedServerEntries.push_back(*serverEntry);
+
+    // This list may contain more than one discovered server
+    // Randomize this list for load-balancing
+    random_shuffle(decodedServerEntries.begin(), decodedServerEntries.end());
+
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    // New entries are collected here and spliced in together. Their addresses
+    // are indexed as they're added, so a repeat within the batch updates the
+    // first copy.
+    ServerListCache::Entries newEntries;
+    unordered_map<string, ServerListCache::Entries::iterator> newEntriesIndex;
+
+    for (ServerEntries::iterator decodedEntry = decodedServerEntries.begin();
+         decodedEntry != decodedServerEntries.end(); ++decodedEntry)
+    {
+        // Check if we already know about this server
+        ServerListCache::Entries::iterator knownEntry = m_cache->Find(decodedEntry->serverAddress);
+        if (knownEntry != m_cache->entries.end())
+        {
+            // NOTE: We always update the values for known servers, because we trust the
+            //       discovery mechanisms
+            knownEntry->Copy(*decodedEntry);
+            m_cache->Changed();
+            continue;
+        }
+
+        auto newEntry = newEntriesIndex.find(decodedEntry->serverAddress);
+        if (newEntry != newEntriesIndex.end())
+        {
+            newEntry->second->Copy(*decodedEntry);
+            continue;
         }
+
+        newEntriesIndex[decodedEntry->serverAddress] =
+            newEntries.insert(newEntries.end(), std::move(*decodedEntry));
+
+        entriesAdded++;
+    }
+
+    // Insert the new entries after the first entry, so that the first entry can continue
+    // to be used if it is reachable (unless there are no pre-existing entries).
+    m_cache->InsertAll(newEntries, false);
+
+    ScheduleWrite();
+
+    return entriesAdded;
+}
+
+void ServerList::MoveEntriesToFront(const ServerEntries& entries, bool veryFront/*=false*/)
+{
+    // Moved last-first, so that the entries end up in input order
+    Batch batch(*this);
+    for (ServerEntries::const_reverse_iterator entry = entries.rbegin(); entry != entries.rend(); ++entry)
+    {
+        batch.MoveEntryToFront(*entry, veryFront);
+    }
+    batch.Commit();
+}
+
+void ServerList::MoveEntryToFront(const ServerEntry& serverEntry, bool veryFront/*=false*/)
+{
+    Batch batch(*this);
+    batch.MoveEntryToFront(serverEntry, veryFront);
+    batch.Commit();
+}
+
+void ServerList::MarkServersFailed(const ServerEntries& failedServerEntries)
+{
+    Batch batch(*this);
+    for (ServerEntries::const_iterator failed = failedServerEntries.begin();
+            failed != failedServerEntries.end();
+            ++failed)
+    {
+        batch.MarkServerFailed(*failed);
+    }
+    batch.Commit();
+}
+
+void ServerList::MarkServerFailed(const ServerEntry& failedServerEntry)
+{
+    Batch batch(*this);
+    batch.MarkServerFailed(failedServerEntry);
+    batch.Commit();
+}
+
+void ServerList::Batch::MarkServerFailed(const ServerEntry& failedServerEntry)
+{
+    Change change = { failedServerEntry, true, false };
+    m_changes.push_back(change);
+}
+
+void ServerList::Batch::MoveEntryToFront(const ServerEntry& serverEntry, bool veryFront/*=false*/)
+{
+    Change change = { serverEntry, false, veryFront };
+    m_changes.push_back(change);
+}
+
+void ServerList::Batch::Commit()
+{
+    if (m_changes.empty())
+    {
+        return;
+    }
+
+    m_serverList.ApplyBatch(*this);
+    m_changes.clear();
+}
+
+void ServerList::ApplyBatch(const Batch& batch)
+{
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    bool changeMade = false;
+    size_t failedCount = 0;
+    vector<string> failedAddresses;
+
+    for (auto change = batch.m_changes.begin(); change != batch.m_changes.end(); ++change)
+    {
+        const ServerEntry& entry = change->serverEntry;
+        ServerListCache::Entries::iterator persistentEntry = m_cache->Find(entry.serverAddress);
+
+        if (change->failed)
+        {
+            failedCount++;
+            if (persistentEntry != m_cache->entries.end())
+            {
+                // Move the failed server to the end of the list
+                m_cache->MoveToBack(persistentEntry);
+                failedAddresses.push_back(entry.serverAddress);
+                changeMade = true;
+            }
+        }
+        else if (persistentEntry == m_cache->entries.end())
+        {
+            m_cache->Insert(entry, change->veryFront);
+            changeMade = true;
+        }
+        else if (entry.ToString() == persistentEntry->ToString())
+        {
+            // In the case where the existing entry has different data, we must
+            // assume that a discovery has happened that overwrote the data that's
+            // being passed in. In that edge case, we just keep the existing entry
+            // in its current position.
+
+            // If we replace the head item, we want to make sure we insert at the head.
+            bool forceHead = (persistentEntry == m_cache->entries.begin());
+            m_cache->Move(persistentEntry, change->veryFront || forceHead);
+            changeMade = true;
+        }
+    }
+
+    if (failedCount > 0)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Marking %d servers failed"), __TFUNCTION__, failedCount);
+
+        if (failedAddresses.empty())
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: Couldn't find server"), __TFUNCTION__);
+        }
+    }
+
+    if (changeMade)
+    {
+        ScheduleWrite();
+    }
+
+    if (!failedAddresses.empty())
+    {
+        // Connection failures feed into the server's reachability history.
+        ServerStatsMap stats = GetStatsFromSystem();
+        for (auto failed = failedAddresses.begin(); failed != failedAddresses.end(); ++failed)
+        {
+            stats[*failed].RecordFailure();
+        }
+        WriteStatsToSystem(stats);
+    }
+}
+
+// This function should not throw
+ServerEntries ServerList::GetList()
+{
+    return GetSnapshot()->entries;
+}
+
+// This function should not throw
+ServerListSnapshotPtr ServerList::GetSnapshot()
+{
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    return m_cache->Snapshot();
+}
+
+// This function should not throw
+ServerEntries ServerList::GetList(unsigned int capabilityMask)
+{
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    ServerEntries matches;
+    for (auto entry = m_cache->entries.begin(); entry != m_cache->entries.end(); ++entry)
+    {
+        if (entry->HasCapabilities(capabilityMask))
+        {
+            matches.push_back(*entry);
+        }
+    }
+    return matches;
+}
+
+bool ServerList::HasEntryWithCapabilities(unsigned int capabilityMask)
+{
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    for (auto entry = m_cache->entries.begin(); entry != m_cache->entries.end(); ++entry)
+    {
+        if (entry->HasCapabilities(capabilityMask))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ServerList::CountViableEntries(unsigned int capabilityMask, size_t& o_total)
+{
+    AutoLock lock(m_cache->lock);
+
+    ServerStatsMap stats = GetStatsFromSystem();
+    LoadCache();
+
+    size_t viable = 0;
+    o_total = 0;
+    for (auto entry = m_cache->entries.begin(); entry != m_cache->entries.end(); ++entry)
+    {
+        if (!entry->HasCapabilities(capabilityMask))
+        {
+            continue;
+        }
+
+        o_total++;
+
+        auto entryStats = stats.find(entry->serverAddress);
+        if (entryStats == stats.end()
+            || (entryStats->second.failureCount < SERVER_STATS_MAX_FAILURES
+                && !entryStats->second.IsQuarantined()))
+        {
+            viable++;
+        }
+    }
+    return viable;
+}
+
+ServerStatsMap ServerList::GetServerStats()
+{
+    AutoLock lock(m_cache->lock);
+
+    return GetStatsFromSystem();
+}
+
+void ServerList::RecordServerResponses(
+                    const map<string, ProtocolResponseTimes>& responseTimes,
+                    const vector<string>& unreachable)
+{
+    AutoLock lock(m_cache->lock);
+
+    ServerStatsMap stats = GetStatsFromSystem();
+
+    for (auto it = responseTimes.begin(); it != responseTimes.end(); ++it)
+    {
+        stats[it->first].RecordProbe(it->second);
+    }
+
+    for (auto it = unreachable.begin(); it != unreachable.end(); ++it)
+    {
+        stats[*it].RecordFailure();
+    }
+
+    // Drop history for servers that are no longer in the list
+    ServerListSnapshotPtr snapshot = GetSnapshot();
+    const ServerEntries& serverEntryList = snapshot->entries;
+    set<string> knownAddresses;
+    for (ServerEntryIterator entry = serverEntryList.begin(); entry != serverEntryList.end(); ++entry)
+    {
+        knownAddresses.insert(entry->serverAddress);
+    }
+    for (auto it = stats.begin(); it != stats.end();)
+    {
+        if (knownAddresses.find(it->first) == knownAddresses.end())
+        {
+            it = stats.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    WriteStatsToSystem(stats);
+}
+
+void ServerList::RecordTunnelQuality(
+                    const string& serverAddress,
+                    unsigned int latency,
+                    unsigned long long bytesPerSecond)
+{
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    if (m_cache->Find(serverAddress) == m_cache->entries.end())
+    {
+        return;
+    }
+
+    ServerStatsMap stats = GetStatsFromSystem();
+    stats[serverAddress].RecordTunnelQuality(latency, bytesPerSecond);
+    WriteStatsToSystem(stats);
+}
+
+void ServerList::RecordServerEstablishments(const vector<ServerEstablishment>& establishments)
+{
+    if (establishments.empty())
+    {
+        return;
+    }
+
+    AutoLock lock(m_cache->lock);
+
+    LoadCache();
+
+    ServerStatsMap stats = GetStatsFromSystem();
+    for (auto it = establishments.begin(); it != establishments.end(); ++it)
+    {
+        if (m_cache->Find(it->serverAddress) != m_cache->entries.end())
+        {
+            stats[it->serverAddress].RecordEstablishment(it->protocol, it->success, it->establishTime);
+        }
+    }
+    WriteStatsToSystem(stats);
+}
+
+void ServerList::OrderEntriesByScore(const string& preferredRegion/*=""*/)
+{
+    AutoLock lock(m_cache->lock);
+
+    ServerStatsMap stats = GetStatsFromSystem();
+    ServerListSnapshotPtr snapshot = GetSnapshot();
+    const ServerEntries& serverEntryList = snapshot->entries;
+
+    vector<pair<double, ServerEntry>> scoredEntries;
+    for (ServerEntryIterator entry = serverEntryList.begin(); entry != serverEntryList.end(); ++entry)
+    {
+        auto entryStats = stats.find(entry->serverAddress);
+        if (entryStats == stats.end()
+            || entryStats->second.successCount == 0
+            || entryStats->second.failureCount >= SERVER_STATS_MAX_FAILURES)
+        {
+            continue;
+        }
+
+        scoredEntries.push_back(make_pair(entryStats->second.Score(), *entry));
+    }
+
+    if (scoredEntries.empty())
+    {
+        return;
+    }
+
+    stable_sort(
+        scoredEntries.begin(),
+        scoredEntries.end(),
+        [&preferredRegion](const pair<double, ServerEntry>& a, const pair<double, ServerEntry>& b)
+        {
+            if (!preferredRegion.empty())
+            {
+                bool aPreferred = (a.second.region.get() == preferredRegion);
+                bool bPreferred = (b.second.region.get() == preferredRegion);
+                if (aPreferred != bPreferred)
+                {
+                    return aPreferred;
+                }
+            }
+            return a.first < b.first;
+        });
+
+    ServerEntries orderedEntries;
+    for (auto it = scoredEntries.begin(); it != scoredEntries.end(); ++it)
+    {
+        orderedEntries.push_back(it->second);
+    }
+
+    MoveEntriesToFront(orderedEntries);
+
+    my_print(NOT_SENSITIVE, true, _T("%s: Preferred servers: %d"), __TFUNCTION__, orderedEntries.size());
+}
+
+string ServerList::GetRankedEmbeddedServerList(const string& preferredRegion/*=""*/)
+{
+    {
+        AutoLock lock(g_embeddedServerEntriesLock);
+
+        if (!g_embeddedServerLines)
+        {
+            unique_ptr<vector<EmbeddedServerLine>> lines(new vector<EmbeddedServerLine>());
+
+            const char* begin = EMBEDDED_SERVER_LIST;
+            const char* end = begin + strlen(EMBEDDED_SERVER_LIST);
+            const char* pos = begin;
+            string decoded;
+
+            while (pos < end)
+            {
+                const char* lineEnd = (const char*)memchr(pos, '\n', end - pos);
+                if (!lineEnd)
+                {
+                    lineEnd = end;
+                }
+
+                Dehexlify(pos, lineEnd - pos, decoded);
+
+                // Throws if the list is corrupt, in which case it's not kept.
+                ServerEntry entry;
+                entry.FromString(decoded.data(), decoded.length());
+
+                EmbeddedServerLine line = { entry.serverAddress, (size_t)(pos - begin), (size_t)(lineEnd - pos) };
+                lines->push_back(line);
+
+                pos = lineEnd + 1;
+            }
+
+            g_embeddedServerLines = std::move(lines);
+        }
+    }
+
+    ServerStatsMap stats;
+    map<string, string> regions;
+    {
+        AutoLock lock(m_cache->lock);
+
+        stats = GetStatsFromSystem();
+        ServerListSnapshotPtr snapshot = GetSnapshot();
+        for (auto entry = snapshot->entries.begin(); entry != snapshot->entries.end(); ++entry)
+        {
+            regions[entry->serverAddress] = entry->region.get();
+        }
+    }
+
+    // Ranked by class, then by score within the scored classes. Tunnel
+    // measurements count for servers never probed, as they're all the core
+    // transport gets.
+    enum { RANK_PREFERRED, RANK_SCORED, RANK_UNKNOWN, RANK_FAILING };
+    vector<pair<pair<int, double>, const EmbeddedServerLine*>> rankedLines;
+    for (auto line = g_embeddedServerLines->begin(); line != g_embeddedServerLines->end(); ++line)
+    {
+        int rankClass = RANK_UNKNOWN;
+        double score = 0.0;
+
+        auto lineStats = stats.find(line->serverAddress);
+        if (lineStats != stats.end())
+        {
+            double lineScore = lineStats->second.successCount > 0
+                               ? lineStats->second.Score()
+                               : lineStats->second.Latency();
+
+            if (lineStats->second.failureCount >= SERVER_STATS_MAX_FAILURES
+                || lineStats->second.IsQuarantined())
+            {
+                rankClass = RANK_FAILING;
+            }
+            else if (lineScore < DBL_MAX)
+            {
+                rankClass = (preferredRegion.empty() || regions[line->serverAddress] == preferredRegion)
+                            ? RANK_PREFERRED
+                            : RANK_SCORED;
+                score = lineScore;
+            }
+        }
+
+        rankedLines.push_back(make_pair(make_pair(rankClass, score), &(*line)));
+    }
+
+    stable_sort(
+        rankedLines.begin(),
+        rankedLines.end(),
+        [](const pair<pair<int, double>, const EmbeddedServerLine*>& a,
+           const pair<pair<int, double>, const EmbeddedServerLine*>& b)
+        {
+            return a.first < b.first;
+        });
+
+    string rankedList;
+    rankedList.reserve(strlen(EMBEDDED_SERVER_LIST));
+    for (auto it = rankedLines.begin(); it != rankedLines.end(); ++it)
+    {
+        if (!rankedList.empty())
+        {
+            rankedList += '\n';
+        }
+        rankedList.append(EMBEDDED_SERVER_LIST + it->second->offset, it->second->length);
+    }
+
+    return rankedList;
+}
+
+RegionStatsMap ServerList::GetRegionStats()
+{
+    AutoLock lock(m_cache->lock);
+
+    ServerStatsMap stats = GetStatsFromSystem();
+    ServerListSnapshotPtr snapshot = GetSnapshot();
+    const ServerEntries& serverEntryList = snapshot->entries;
+
+    RegionStatsMap regions;
+    for (ServerEntryIterator entry = serverEntryList.begin(); entry != serverEntryList.end(); ++entry)
+    {
+        auto entryStats = stats.find(entry->serverAddress);
+        if (entry->region.get().empty() || entryStats == stats.end())
+        {
+            continue;
+        }
+
+        RegionStats& region = regions[entry->region.get()];
+        region.serverCount++;
+
+        double latency = entryStats->second.Latency();
+        if (latency < DBL_MAX && entryStats->second.failureCount == 0)
+        {
+            region.reachableCount++;
+            region.bestLatency = min(region.bestLatency, latency);
+        }
+    }
+
+    return regions;
+}
+
+// Only from the latest AvailableEgressRegions notice
+static Lock g_availableEgressRegionsLock("AvailableEgressRegions");
+static set<string> g_availableEgressRegions;
+static bool g_availableEgressRegionsKnown = false;
+
+// static
+void ServerList::SetAvailableEgressRegions(const vector<string>& regions)
+{
+    AutoLock lock(g_availableEgressRegionsLock);
+
+    g_availableEgressRegions = set<string>(regions.begin(), regions.end());
+    g_availableEgressRegionsKnown = true;
+}
+
+static bool IsEgressRegionAvailable(const string& region)
+{
+    AutoLock lock(g_availableEgressRegionsLock);
+
+    return !g_availableEgressRegionsKnown
+           || g_availableEgressRegions.find(region) != g_availableEgressRegions.end();
+}
+
+string ServerList::GetEgressRegion()
+{
+    string egressRegion = Settings::EgressRegion();
+    if (egressRegion != EGRESS_REGION_FASTEST)
+    {
+        return egressRegion;
+    }
+
+    RegionStatsMap regions = GetRegionStats();
+
+    string fastest;
+    double bestScore = DBL_MAX;
+    for (auto it = regions.begin(); it != regions.end(); ++it)
+    {
+        double score = it->second.Score();
+        if (score < bestScore && IsEgressRegionAvailable(it->first))
+        {
+            fastest = it->first;
+            bestScore = score;
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: fastest region: %S"), __TFUNCTION__, fastest.empty() ? "(none yet)" : fastest.c_str());
+
+    return fastest;
+}
+
+string ServerList::GetEgressRegionStatsNotice()
+{
+    RegionStatsMap regions = GetRegionStats();
+
+    Json::Value regionsJson(Json::objectValue);
+    for (auto it = regions.begin(); it != regions.end(); ++it)
+    {
+        if (IsEgressRegionAvailable(it->first))
+        {
+            regionsJson[it->first] = it->second.ToJson();
+        }
+    }
+
+    Json::Value notice;
+    notice["noticeType"] = "EgressRegionStats";
+    notice["data"]["regions"] = regionsJson;
+    return Json::FastWriter().write(notice);
+}
+
+string ServerList::GetStatsName() const
+{
+    return string(LOCAL_SETTINGS_REGISTRY_VALUE_SERVER_STATS) + m_name;
+}
+
+// This function should not throw; corrupt history is discarded.
+ServerStatsMap ServerList::GetStatsFromSystem()
+{
+    ServerStatsMap stats;
+
+    string statsString;
+    if (!ReadRegistryStringValue(GetStatsName().c_str(), statsString) || statsString.empty())
+    {
+        return stats;
+    }
+
+    Json::Value json;
+    Json::Reader reader;
+    if (!reader.parse(statsString, json) || !json.isObject())
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Discarding corrupt server stats"), __TFUNCTION__);
+        return stats;
+    }
+
+    try
+    {
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            stats[it.name()].FromJson(*it);
+        }
+    }
+    catch (exception& e)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Discarding corrupt server stats: %S"), __TFUNCTION__, e.what());
+        stats.clear();
+    }
+
+    return stats;
+}
+
+// NOTE: This function does not throw; losing history only costs a re-probe.
+void ServerList::WriteStatsToSystem(const ServerStatsMap& stats)
+{
+    Json::Value json(Json::objectValue);
+    for (auto it = stats.begin(); it != stats.end(); ++it)
+    {
+        json[it->first] = it->second.ToJson();
+    }
+
+    Json::FastWriter jsonWriter;
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+
+    if (!WriteRegistryStringValue(GetStatsName(), jsonWriter.write(json), reason))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Failed to write server stats (%d)"), __TFUNCTION__, reason);
+    }
+}
+
+string ServerList::GetListName() const
+{
+    return string(LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS) + m_name;
+}
+
+ServerEntries ServerList::GetListFromEmbeddedValues()
+{
+    AutoLock lock(g_embeddedServerEntriesLock);
+
+    if (!g_embeddedServerEntries)
+    {
+        // Throws if the list is corrupt, in which case it's not kept.
+        g_embeddedServerEntries.reset(new ServerEntries(ParseServerEntries(EMBEDDED_SERVER_LIST)));
+    }
+
+    return *g_embeddedServerEntries;
+}
+
+// Reads the binary store if it exists. Otherwise this is the first run since
+// the store was introduced, and the legacy registry value is migrated; the
+// store will be written the next time the list is written.
+ServerEntries ServerList::GetListFromSystem()
+{
+    ServerEntries serverEntryList;
+    if (ReadListFromStore(serverEntryList))
+    {
+        return serverEntryList;
+    }
+
+    return GetListFromSystem(GetListName().c_str());
+}
+
+ServerEntries ServerList::GetListFromSystem(const char* listName)
+{
+    string serverEntryListString;
+
+    if (!ReadRegistryStringValue(
+            listName,
+            serverEntryListString))
+    {
+        // If we're migrating from an old version, there's no m_name qualifier.
+        if (!ReadRegistryStringValue(
+                LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS,
+                serverEntryListString))
+        {
+            return ServerEntries();
+        }
+    }
+
+    return ParseServerEntries(serverEntryListString.c_str());
+}
+
+// The errors below throw (preventing any Server connection from starting)
+// Lines are sliced out of the input in place and dehexlified into a single
+// reused buffer; entries are moved, not copied, into the result.
+ServerEntries ServerList::ParseServerEntries(const char* serverEntryListString)
+{
+    ServerEntries serverEntryList;
+
+    const char* pos = serverEntryListString;
+    const char* end = pos + strlen(serverEntryListString);
+    string decoded;
+
+    while (pos < end)
+    {
+        const char* lineEnd = (const char*)memchr(pos, '\n', end - pos);
+        if (!lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        Dehexlify(pos, lineEnd - pos, decoded);
+
+        ServerEntry entry;
+        entry.FromString(decoded.data(), decoded.length());
+        if (entry.webServerCertificate != "None")
+        {
+            serverEntryList.push_back(std::move(entry));
+        }
+
+        pos = lineEnd + 1;
+    }
+
+    return serverEntryList;
+}
+
+ServerEntry ServerList::ParseServerEntry(const string& serverEntry)
+{
+    string line;
+    Dehexlify(serverEntry.data(), serverEntry.length(), line);
+
+    ServerEntry entry;
+    entry.FromString(line.data(), line.length());
+
+    return entry;
+}
+
+// Batches smaller than this aren't worth handing to other threads.
+#define PARALLEL_PARSE_MIN_ENTRIES_PER_CHUNK    256
+#define PARALLEL_PARSE_MAX_CHUNKS               8
+
+struct ParseServerEntriesChunk
+{
+    const vector<string>* serverEntries;
+    size_t begin;
+    size_t end;
+    ServerEntries* output; // Presized; this chunk fills [begin, end)
+    string error;          // Set if an entry is corrupt
+    HANDLE doneEvent;
+};
+
+// static
+DWORD WINAPI ServerList::ParseServerEntriesThread(void* object)
+{
+    ParseServerEntriesChunk* chunk = (ParseServerEntriesChunk*)object;
+    try
+    {
+        for (size_t i = chunk->begin; i < chunk->end; i++)
+        {
+            (*chunk->output)[i] = ParseServerEntry((*chunk->serverEntries)[i]);
+        }
+    }
+    catch (std::exception& ex)
+    {
+        chunk->error = ex.what();
+    }
+    return 0;
+}
+
+// static
+ServerEntries ServerList::ParseServerEntries(const vector<string>& serverEntries)
+{
+    ServerEntries parsed(serverEntries.size());
+
+    size_t chunkCount = serverEntries.size() / PARALLEL_PARSE_MIN_ENTRIES_PER_CHUNK;
+    chunkCount = max((size_t)1, min(chunkCount, (size_t)PARALLEL_PARSE_MAX_CHUNKS));
+
+    vector<ParseServerEntriesChunk> chunks(chunkCount);
+    size_t chunkSize = (serverEntries.size() + chunkCount - 1) / chunkCount;
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        chunks[i].serverEntries = &serverEntries;
+        chunks[i].begin = min(i * chunkSize, serverEntries.size());
+        chunks[i].end = min(chunks[i].begin + chunkSize, serverEntries.size());
+        chunks[i].output = &parsed;
+        chunks[i].doneEvent = NULL;
+    }
+
+    // The first chunk is done on this thread. If a chunk can't be handed off,
+    // it's done here too.
+    for (size_t i = 1; i < chunkCount; i++)
+    {
+        chunks[i].doneEvent = ThreadPool::Instance().Run(ParseServerEntriesThread, &chunks[i]);
+    }
+    ParseServerEntriesThread(&chunks[0]);
+
+    for (size_t i = 1; i < chunkCount; i++)
+    {
+        if (chunks[i].doneEvent)
+        {
+            WaitForSingleObject(chunks[i].doneEvent, INFINITE);
+            CloseHandle(chunks[i].doneEvent);
+        }
+        else
+        {
+            ParseServerEntriesThread(&chunks[i]);
+        }
+    }
+
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        if (!chunks[i].error.empty())
+        {
+            throw std::exception(chunks[i].error.c_str());
+        }
+    }
+
+    return parsed;
+}
+
+// NOTE: This function does not throw because we don't want a failure to prevent a connection attempt.
+// Returns the number of entries actually written, which is less than the
+// list size only if the store couldn't be written and the registry fallback
+// had to truncate the list.
+size_t ServerList::WriteListToSystem(const ServerEntries& serverEntryList)
+{
+    if (WriteListToStore(serverEntryList))
+    {
+        return serverEntryList.size();
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: Falling back to registry"), __TFUNCTION__);
+
+    return WriteListToRegistry(serverEntryList);
+}
+
+// Legacy storage: one registry string value holding hexlified entries. Only
+// used when the store file can't be written.
+size_t ServerList::WriteListToRegistry(const ServerEntries& serverEntryList)
+{
+    string encodedServerEntryList = EncodeServerEntries(serverEntryList);
+
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+
+    if (WriteRegistryStringValue(
+            GetListName().c_str(),
+            encodedServerEntryList,
+            reason))
+    {
+        return serverEntryList.size();
+    }
+
+    if (REGISTRY_FAILURE_WRITE_TOO_LONG == reason)
+    {
+        int bisect = serverEntryList.size()/2;
+        if (bisect > 1)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: List is too long to write to registry, truncating"), __TFUNCTION__);
+            return WriteListToRegistry(SelectEntriesToKeep(serverEntryList, bisect));
+        }
+        else
+        {
+            my_print(NOT_SENSITIVE, true,
+                _T("%s: List is still too long to write to registry, but there are only %ld entries"),
+                __TFUNCTION__, serverEntryList.size());
+        }
+    }
+
+    // Nothing was written; leave the cached list as it is.
+    return serverEntryList.size();
+}
+
+string ServerList::EncodeServerEntries(const ServerEntries& serverEntryList)
+{
+    // Sized first, so the list is written into one buffer
+    size_t length = 0;
+    for (ServerEntryIterator it = serverEntryList.begin(); it != serverEntryList.end(); ++it)
+    {
+        length += it->ToHexString().length() + 1;
+    }
+
+    string encodedServerList;
+    encodedServerList.reserve(length);
+    for (ServerEntryIterator it = serverEntryList.begin(); it != serverEntryList.end(); ++it)
+    {
+        encodedServerList.append(it->ToHexString()).append(1, '\n');
+    }
+    return encodedServerList;
+}
+
+
+/***********************************************
+Server list store
+
+The store file is a versioned, length-prefixed binary image of the list:
+  magic "PSLS" | uint32 version | uint32 entry count |
+  { uint32 length | ServerEntry::ToString() bytes } * count
+All integers are little-endian. Entries are stored unencoded, so the file
+is about half the size of the hexlified registry value, and there is no
+size limit that forces the list to be truncated.
+*/
+
+static const char SERVER_LIST_STORE_MAGIC[4] = { 'P', 'S', 'L', 'S' };
+static const unsigned int SERVER_LIST_STORE_VERSION = 1;
+
+static void AppendUInt32(string& buffer, unsigned int value)
+{
+    unsigned char bytes[4] = {
+        (unsigned char)(value & 0xFF),
+        (unsigned char)((value >> 8) & 0xFF),
+        (unsigned char)((value >> 16) & 0xFF),
+        (unsigned char)((value >> 24) & 0xFF) };
+    buffer.append((const char*)bytes, sizeof(bytes));
+}
+
+static bool ReadUInt32(const string& buffer, size_t& offset, unsigned int& o_value)
+{
+    if (buffer.length() < 4 || offset > buffer.length() - 4)
+    {
+        return false;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)buffer.data() + offset;
+    o_value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+    offset += 4;
+    return true;
+}
+
+bool ServerList::GetStorePath(tstring& o_path) const
+{
+    tstring dataDirectory;
+    if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, true, dataDirectory))
+    {
+        return false;
+    }
+
+    o_path = (filesystem::path(dataDirectory)
+                / (tstring(LOCAL_SETTINGS_APPDATA_SERVER_LIST_STORE_FILENAME_PREFIX)
+                    + UTF8ToWString(m_name) + _T(".bin"))).wstring();
+    return true;
+}
+
+// Returns false if there is no store file.
+// The errors below throw (preventing any Server connection from starting)
+bool ServerList::ReadListFromStore(ServerEntries& o_serverEntryList) const
+{
+    o_serverEntryList.clear();
+
+    tstring storePath;
+    string buffer;
+    if (!GetStorePath(storePath) || !ReadFileContents(storePath, buffer))
+    {
+        return false;
+    }
+
+    if (buffer.length() < sizeof(SERVER_LIST_STORE_MAGIC)
+        || 0 != memcmp(buffer.data(), SERVER_LIST_STORE_MAGIC, sizeof(SERVER_LIST_STORE_MAGIC)))
+    {
+        throw std::exception("Server list store is corrupt: bad magic");
+    }
+
+    size_t offset = sizeof(SERVER_LIST_STORE_MAGIC);
+    unsigned int version = 0, count = 0;
+
+    if (!ReadUInt32(buffer, offset, version) || version != SERVER_LIST_STORE_VERSION)
+    {
+        throw std::exception("Server list store is corrupt: unsupported version");
+    }
+
+    if (!ReadUInt32(buffer, offset, count))
+    {
+        throw std::exception("Server list store is corrupt: can't read count");
+    }
+
+    o_serverEntryList.reserve(count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int length = 0;
+        if (!ReadUInt32(buffer, offset, length) || length > buffer.length() - offset)
+        {
+            throw std::exception("Server list store is corrupt: truncated entry");
+        }
+
+        ServerEntry entry;
+        entry.FromString(buffer.data() + offset, length);
+        offset += length;
+
+        if (entry.webServerCertificate != "None")
+        {
+            o_serverEntryList.push_back(std::move(entry));
+        }
+    }
+
+    return true;
+}
+
+// Writes to a temporary file and then replaces the store, so a failure part
+// way through never leaves a partial list behind.
+bool ServerList::WriteListToStore(const ServerEntries& serverEntryList) const
+{
+    tstring storePath;
+    if (!GetStorePath(storePath))
+    {
+        return false;
+    }
+
+    string buffer(SERVER_LIST_STORE_MAGIC, sizeof(SERVER_LIST_STORE_MAGIC));
+    AppendUInt32(buffer, SERVER_LIST_STORE_VERSION);
+    AppendUInt32(buffer, (unsigned int)serverEntryList.size());
+
+    size_t length = buffer.length();
+    for (ServerEntryIterator it = serverEntryList.begin(); it != serverEntryList.end(); ++it)
+    {
+        length += sizeof(unsigned int) + it->ToString().length();
+    }
+    buffer.reserve(length);
+
+    for (ServerEntryIterator it = serverEntryList.begin(); it != serverEntryList.end(); ++it)
+    {
+        const string& stringServerEntry = it->ToString();
+        AppendUInt32(buffer, (unsigned int)stringServerEntry.length());
+        buffer += stringServerEntry;
+    }
+
+    tstring tempPath = storePath + _T(".tmp");
+
+    if (!WriteFile(tempPath, buffer))
+    {
+        return false;
+    }
+
+    if (!MoveFileEx(tempPath.c_str(), storePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: MoveFileEx failed (%d)"), __TFUNCTION__, GetLastError());
+        DeleteFile(tempPath.c_str());
+        return false;
     }
 
-    if (changeMade)
+    return true;
+}
+
+
+/***********************************************
+ServerStats members
+*/
+
+void ServerStats::RecordSuccess(unsigned int responseTime)
+{
+    if (successCount == 0)
     {
-        WriteListToSystem(serverEntryList);
+        responseTimeEWMA = responseTime;
     }
     else
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: Couldn't find server"), __TFUNCTION__);
+        responseTimeEWMA = SERVER_STATS_EWMA_ALPHA * responseTime
+                           + (1.0 - SERVER_STATS_EWMA_ALPHA) * responseTimeEWMA;
     }
-}
 
-void ServerList::MarkServerFailed(const ServerEntry& failedServerEntry)
-{
-    ServerEntries failedServerEntries;
-    failedServerEntries.push_back(failedServerEntry);
-    MarkServersFailed(failedServerEntries);
+    successCount++;
+    failureCount = 0;
+    quarantinedAt = 0;
+    quarantinedUntil = 0;
+    lastUpdated = time(0);
 }
 
-// This function should not throw
-ServerEntries ServerList::GetList()
+void ServerStats::RecordTunnelQuality(unsigned int latency, unsigned long long bytesPerSecond)
 {
-    AutoMUTEX lock(m_mutex);
+    if (qualitySampleCount == 0)
+    {
+        tunnelLatencyEWMA = latency;
+        peakThroughputEWMA = (double)bytesPerSecond;
+    }
+    else
+    {
+        tunnelLatencyEWMA = SERVER_STATS_EWMA_ALPHA * latency
+                            + (1.0 - SERVER_STATS_EWMA_ALPHA) * tunnelLatencyEWMA;
+        peakThroughputEWMA = SERVER_STATS_EWMA_ALPHA * bytesPerSecond
+                             + (1.0 - SERVER_STATS_EWMA_ALPHA) * peakThroughputEWMA;
+    }
 
-    // Load persistent list of servers from system (registry)
+    qualitySampleCount++;
+    lastUpdated = time(0);
+}
 
-    ServerEntries systemServerEntryList;
+void ServerStats::RecordEstablishment(const string& protocol, bool success, unsigned int establishTime)
+{
+    ProtocolEstablishStats& protocolStats = protocolEstablishments[protocol];
+    protocolStats.attempts++;
 
-    if (!IGNORE_SYSTEM_SERVER_LIST)
+    if (!success)
     {
-        try
-        {
-            systemServerEntryList = GetListFromSystem();
-        }
-        catch (std::exception &ex)
-        {
-            my_print(NOT_SENSITIVE, false, string("Not using corrupt System Server List: ") + ex.what());
-        }
+        RecordFailure();
+        return;
     }
 
-    // Add embedded list to system list.
-    // Cases:
-    // - This may be a new client run on a system with an existing registry entry; we want the new embedded values
-    // - This may be the first run, in which case the system list is empty
-
-    ServerEntries embeddedServerEntryList;
-    try
+    if (protocolStats.successes == 0)
     {
-        embeddedServerEntryList = GetListFromEmbeddedValues();
-        // Randomize this list for load-balancing
-        random_shuffle(embeddedServerEntryList.begin(), embeddedServerEntryList.end());
+        protocolStats.establishTimeEWMA = establishTime;
     }
-    catch (std::exception &ex)
+    else
     {
-        my_print(NOT_SENSITIVE, false, string("Not using corrupt Embedded Server List: ") + ex.what());
-        embeddedServerEntryList.clear();
+        protocolStats.establishTimeEWMA = SERVER_STATS_EWMA_ALPHA * establishTime
+                                          + (1.0 - SERVER_STATS_EWMA_ALPHA) * protocolStats.establishTimeEWMA;
     }
+    protocolStats.successes++;
+    lastProtocol = protocol;
 
-    for (ServerEntries::iterator embeddedServerEntry = embeddedServerEntryList.begin();
-         embeddedServerEntry != embeddedServerEntryList.end(); ++embeddedServerEntry)
+    RecordSuccess((unsigned int)(establishTime * SERVER_STATS_ESTABLISH_LATENCY_FACTOR));
+}
+
+void ServerStats::RecordFailure()
+{
+    failureCount++;
+    protocolResponseTimes.clear();
+    lastUpdated = time(0);
+
+    if (failureCount >= SERVER_STATS_QUARANTINE_FAILURES)
     {
-        // Check if we already know about this server
-        // We prioritize discovery information, so skip embedded entry entirely when already known
-        bool alreadyKnown = false;
-        for (ServerEntries::iterator systemServerEntry = systemServerEntryList.begin();
-             systemServerEntry != systemServerEntryList.end(); ++systemServerEntry)
-        {
-            if (embeddedServerEntry->serverAddress == systemServerEntry->serverAddress)
-            {
-                alreadyKnown = true;
+        // Shifting past the maximum is avoided, not just capped after
+        unsigned int doublings = min(failureCount - SERVER_STATS_QUARANTINE_FAILURES, 16U);
+        time_t duration = min(SERVER_STATS_QUARANTINE_MIN_SECONDS << doublings,
+                              SERVER_STATS_QUARANTINE_MAX_SECONDS);
+        quarantinedAt = lastUpdated;
+        quarantinedUntil = lastUpdated + duration;
+    }
+}
 
-                // Special case: if the embedded server entry has new info that the
-                // existing system entry does not, we know the embedded entry is actually newer
-                if (embeddedServerEntry->sshObfuscatedKey.length() > 0 &&
-                    systemServerEntry->sshObfuscatedKey.length() == 0)
-                {
-                    systemServerEntry->Copy(*embeddedServerEntry);
-                }
+void ServerStats::RecordProbe(const ProtocolResponseTimes& responseTimes)
+{
+    unsigned int fastest = UINT_MAX;
+    for (auto it = responseTimes.begin(); it != responseTimes.end(); ++it)
+    {
+        fastest = min(fastest, it->second);
+    }
 
-                break;
-            }
-        }
+    RecordSuccess(fastest);
+    protocolResponseTimes = responseTimes;
+}
 
-        if (!alreadyKnown)
-        {
-            // Insert the new entry as the second entry (if there already is at least one),
-            // so that the first entry can continue to be used if it is reachable
-            systemServerEntryList.insert(systemServerEntryList.size() > 0 ?
-                                            systemServerEntryList.begin() + 1 :
-                                            systemServerEntryList.begin(),
-                                         *embeddedServerEntry);
-        }
+double ServerStats::Score() const
+{
+    if (successCount == 0)
+    {
+        return DBL_MAX;
     }
 
-    // Write this out immediately, so the next time we'll get it from the system
-    // (Also so MarkCurrentServerFailed reads the same list we're returning)
-    WriteListToSystem(systemServerEntryList);
+    double latency = Latency();
+    double throughputBonus = 0.0;
 
-    // WriteListToSystem could truncate the list if it is too long to write to the registry.
-    // Try to return what is stored in the system for consistency.
-    try
+    if (qualitySampleCount > 0)
     {
-        return GetListFromSystem();
+        throughputBonus = SERVER_STATS_THROUGHPUT_BONUS_MILLISECONDS
+                          * min(1.0, peakThroughputEWMA / SERVER_STATS_THROUGHPUT_REFERENCE_BYTES_PER_SECOND);
     }
-    catch (std::exception &ex)
+
+    return latency - throughputBonus + failureCount * SERVER_STATS_FAILURE_PENALTY_MILLISECONDS;
+}
+
+double ServerStats::Latency() const
+{
+    double latency = (successCount > 0) ? responseTimeEWMA : DBL_MAX;
+
+    if (qualitySampleCount > 0)
     {
-        my_print(NOT_SENSITIVE, true, string("Just wrote a corrupt System Server List: ") + ex.what());
-        return systemServerEntryList;
+        double tunnelLatency = tunnelLatencyEWMA * SERVER_STATS_TUNNEL_LATENCY_FACTOR;
+        latency = (latency == DBL_MAX) ? tunnelLatency : max(latency, tunnelLatency);
     }
+
+    return latency;
 }
 
-string ServerList::GetListName() const
+bool ServerStats::IsFresh() const
 {
-    return string(LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS) + m_name;
+    time_t now = time(0);
+    return lastUpdated <= now && now - lastUpdated < SERVER_STATS_FRESH_SECONDS;
 }
 
-ServerEntries ServerList::GetListFromEmbeddedValues()
+// When the network last changed; quarantines that started before then are
+// lifted.
+static Lock g_lastNetworkChangeLock("LastNetworkChange");
+static time_t g_lastNetworkChange = 0;
+
+// static
+void ServerStats::NoteNetworkChange()
 {
-    return ParseServerEntries(EMBEDDED_SERVER_LIST);
+    AutoLock lock(g_lastNetworkChangeLock);
+    g_lastNetworkChange = time(0);
 }
 
-ServerEntries ServerList::GetListFromSystem()
+// static
+time_t ServerStats::LastNetworkChange()
 {
-    return GetListFromSystem(GetListName().c_str());
+    AutoLock lock(g_lastNetworkChangeLock);
+    return g_lastNetworkChange;
 }
 
-ServerEntries ServerList::GetListFromSystem(const char* listName)
+bool ServerStats::IsQuarantined() const
 {
-    string serverEntryListString;
+    if (quarantinedUntil <= time(0))
+    {
+        return false;
+    }
 
-    if (!ReadRegistryStringValue(
-            listName,
-            serverEntryListString))
+    AutoLock lock(g_lastNetworkChangeLock);
+    return quarantinedAt > g_lastNetworkChange;
+}
+
+Json::Value ServerStats::ToJson() const
+{
+    Json::Value json;
+    json["responseTimeEWMA"] = responseTimeEWMA;
+    json["successCount"] = successCount;
+    json["failureCount"] = failureCount;
+    json["lastUpdated"] = (Json::Int64)lastUpdated;
+    if (quarantinedUntil > 0)
     {
-        // If we're migrating from an old version, there's no m_name qualifier.
-        if (!ReadRegistryStringValue(
-                LOCAL_SETTINGS_REGISTRY_VALUE_SERVERS,
-                serverEntryListString))
+        json["quarantinedAt"] = (Json::Int64)quarantinedAt;
+        json["quarantinedUntil"] = (Json::Int64)quarantinedUntil;
+    }
+    if (qualitySampleCount > 0)
+    {
+        json["tunnelLatencyEWMA"] = tunnelLatencyEWMA;
+        json["peakThroughputEWMA"] = peakThroughputEWMA;
+        json["qualitySampleCount"] = qualitySampleCount;
+    }
+    if (!protocolResponseTimes.empty())
+    {
+        Json::Value protocols(Json::objectValue);
+        for (auto it = protocolResponseTimes.begin(); it != protocolResponseTimes.end(); ++it)
         {
-            return ServerEntries();
+            protocols[it->first] = it->second;
         }
+        json["protocolResponseTimes"] = protocols;
     }
-
-    return ParseServerEntries(serverEntryListString.c_str());
+    if (!protocolEstablishments.empty())
+    {
+        Json::Value protocols(Json::objectValue);
+        for (auto it = protocolEstablishments.begin(); it != protocolEstablishments.end(); ++it)
+        {
+            Json::Value protocol;
+            protocol["attempts"] = it->second.attempts;
+            protocol["successes"] = it->second.successes;
+            protocol["establishTimeEWMA"] = it->second.establishTimeEWMA;
+            protocols[it->first] = protocol;
+        }
+        json["protocolEstablishments"] = protocols;
+        json["lastProtocol"] = lastProtocol;
+    }
+    return json;
 }
 
-// The errors below throw (preventing any Server connection from starting)
-ServerEntries ServerList::ParseServerEntries(const char* serverEntryListString)
+void ServerStats::FromJson(const Json::Value& json)
 {
-    ServerEntries serverEntryList;
-
-    stringstream stream(serverEntryListString);
-    string item;
-
-    while (getline(stream, item, '\n'))
+    responseTimeEWMA = json.get("responseTimeEWMA", 0.0).asDouble();
+    successCount = json.get("successCount", 0).asUInt();
+    failureCount = json.get("failureCount", 0).asUInt();
+    lastUpdated = (time_t)json.get("lastUpdated", 0).asInt64();
+    quarantinedAt = (time_t)json.get("quarantinedAt", 0).asInt64();
+    quarantinedUntil = (time_t)json.get("quarantinedUntil", 0).asInt64();
+    tunnelLatencyEWMA = json.get("tunnelLatencyEWMA", 0.0).asDouble();
+    peakThroughputEWMA = json.get("peakThroughputEWMA", 0.0).asDouble();
+    qualitySampleCount = json.get("qualitySampleCount", 0).asUInt();
+
+    protocolResponseTimes.clear();
+    const Json::Value& protocols = json["protocolResponseTimes"];
+    if (protocols.isObject())
     {
-        ServerEntry entry = ParseServerEntry(item);
-        if (entry.webServerCertificate != "None")
+        for (auto it = protocols.begin(); it != protocols.end(); ++it)
         {
-            serverEntryList.push_back(entry);
+            protocolResponseTimes[it.name()] = (*it).asUInt();
         }
     }
 
-    return serverEntryList;
+    protocolEstablishments.clear();
+    const Json::Value& establishments = json["protocolEstablishments"];
+    if (establishments.isObject())
+    {
+        for (auto it = establishments.begin(); it != establishments.end(); ++it)
+        {
+            ProtocolEstablishStats& protocolStats = protocolEstablishments[it.name()];
+            protocolStats.attempts = (*it).get("attempts", 0).asUInt();
+            protocolStats.successes = (*it).get("successes", 0).asUInt();
+            protocolStats.establishTimeEWMA = (*it).get("establishTimeEWMA", 0.0).asDouble();
+        }
+    }
+    lastProtocol = json.get("lastProtocol", "").asString();
 }
 
-ServerEntry ServerList::ParseServerEntry(const string& serverEntry)
+double RegionStats::Score() const
 {
-    string line = Dehexlify(serverEntry);
+    if (reachableCount == 0)
+    {
+        return DBL_MAX;
+    }
 
-    ServerEntry entry;
-    entry.FromString(line);
+    // A region where many servers fail is likely to keep failing, however
+    // fast its best server is.
+    double failureRate = 1.0 - (double)reachableCount / serverCount;
+    return bestLatency + failureRate * SERVER_STATS_FAILURE_PENALTY_MILLISECONDS;
+}
 
-    return entry;
+Json::Value RegionStats::ToJson() const
+{
+    Json::Value json;
+    if (reachableCount > 0)
+    {
+        json["latency"] = (Json::UInt)bestLatency;
+    }
+    json["successRate"] = serverCount > 0 ? (double)reachableCount / serverCount : 0.0;
+    json["servers"] = serverCount;
+    return json;
 }
 
-// NOTE: This function does not throw because we don't want a failure to prevent a connection attempt.
-void ServerList::WriteListToSystem(const ServerEntries& serverEntryList)
+
+/***********************************************
+Interned field values
+*/
+
+// Set nodes don't move, so pointers to the values stay valid.
+static Lock g_internedValuesLock("InternedValues");
+static set<string> g_internedStrings;
+static set<vector<string>> g_internedStringLists;
+
+template<>
+const string* Interned<string>::Intern(const string& value)
 {
-    string encodedServerEntryList = EncodeServerEntries(serverEntryList);
+    AutoLock lock(g_internedValuesLock);
+    return &*g_internedStrings.insert(value).first;
+}
 
-    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+template<>
+const vector<string>* Interned<vector<string>>::Intern(const vector<string>& value)
+{
+    AutoLock lock(g_internedValuesLock);
+    return &*g_internedStringLists.insert(value).first;
+}
 
-    if (!WriteRegistryStringValue(
-            GetListName().c_str(),
-            encodedServerEntryList,
-            reason))
+template<>
+size_t Interned<string>::PoolHeapBytes()
+{
+    AutoLock lock(g_internedValuesLock);
+    size_t total = 0;
+    for (auto it = g_internedStrings.begin(); it != g_internedStrings.end(); ++it)
     {
-        if (REGISTRY_FAILURE_WRITE_TOO_LONG == reason)
-        {
-            int bisect = serverEntryList.size()/2;
-            if (bisect > 1)
-            {
-                my_print(NOT_SENSITIVE, true, _T("%s: List is too long to write to registry, truncating"), __TFUNCTION__);
-                ServerEntries truncatedServerEntryList(serverEntryList.begin(),
-                                                       serverEntryList.begin() + bisect);
-                WriteListToSystem(truncatedServerEntryList);
-            }
-            else
-            {
-                my_print(NOT_SENSITIVE, true,
-                    _T("%s: List is still too long to write to registry, but there are only %ld entries"),
-                    __TFUNCTION__, serverEntryList.size());
-            }
-        }
+        // A tree node is three links, a colour and the value
+        total += 4 * sizeof(void*) + sizeof(string) + StringHeapBytes(*it);
     }
+    return total;
 }
 
-string ServerList::EncodeServerEntries(const ServerEntries& serverEntryList)
+template<>
+size_t Interned<vector<string>>::PoolHeapBytes()
 {
-    string encodedServerList;
-    for (ServerEntryIterator it = serverEntryList.begin(); it != serverEntryList.end(); ++it)
+    AutoLock lock(g_internedValuesLock);
+    size_t total = 0;
+    for (auto it = g_internedStringLists.begin(); it != g_internedStringLists.end(); ++it)
     {
-        string stringServerEntry = it->ToString();
-        encodedServerList += Hexlify(
-                                (const unsigned char*)stringServerEntry.c_str(),
-                                stringServerEntry.length()) + "\n";
+        total += 4 * sizeof(void*) + sizeof(vector<string>) + it->capacity() * sizeof(string);
+        for (auto item = it->begin(); item != it->end(); ++item)
+        {
+            total += StringHeapBytes(*item);
+        }
     }
-    return encodedServerList;
+    return total;
 }
 
 
@@ -458,6 +2008,7 @@ ServerEntry::ServerEntry(
     const string& meekFrontingAddressesRegex,
     const vector<string>& meekFrontingAddresses,
     const vector<string>& capabilities)
+    : capabilityMask(0)
 {
     this->serverAddress = serverAddress;
     this->region = region;
@@ -478,7 +2029,94 @@ ServerEntry::ServerEntry(
     this->meekFrontingAddressesRegex = meekFrontingAddressesRegex;
     this->meekFrontingAddresses = meekFrontingAddresses;
 
-    this->capabilities = capabilities;
+    SetCapabilities(capabilities);
+}
+
+ServerEntry::ServerEntry(const ServerEntry& src)
+    : m_serialized(atomic_load(&src.m_serialized)),
+      m_serializedHex(atomic_load(&src.m_serializedHex))
+{
+    CopyFields(src);
+}
+
+ServerEntry::ServerEntry(ServerEntry&& src)
+    : m_serialized(atomic_load(&src.m_serialized)),
+      m_serializedHex(atomic_load(&src.m_serializedHex))
+{
+    MoveFields(std::move(src));
+}
+
+ServerEntry& ServerEntry::operator=(const ServerEntry& src)
+{
+    if (this != &src)
+    {
+        CopyFields(src);
+        m_serialized = atomic_load(&src.m_serialized);
+        m_serializedHex = atomic_load(&src.m_serializedHex);
+    }
+    return *this;
+}
+
+ServerEntry& ServerEntry::operator=(ServerEntry&& src)
+{
+    if (this != &src)
+    {
+        m_serialized = atomic_load(&src.m_serialized);
+        m_serializedHex = atomic_load(&src.m_serializedHex);
+        MoveFields(std::move(src));
+    }
+    return *this;
+}
+
+void ServerEntry::CopyFields(const ServerEntry& src)
+{
+    serverAddress = src.serverAddress;
+    region = src.region;
+    webServerPort = src.webServerPort;
+    webServerSecret = src.webServerSecret;
+    webServerCertificate = src.webServerCertificate;
+    sshPort = src.sshPort;
+    sshUsername = src.sshUsername;
+    sshPassword = src.sshPassword;
+    sshHostKey = src.sshHostKey;
+    sshObfuscatedPort = src.sshObfuscatedPort;
+    sshObfuscatedKey = src.sshObfuscatedKey;
+    capabilities = src.capabilities;
+    capabilityMask = src.capabilityMask;
+    meekObfuscatedKey = src.meekObfuscatedKey;
+    meekServerPort = src.meekServerPort;
+    meekCookieEncryptionPublicKey = src.meekCookieEncryptionPublicKey;
+    meekFrontingDomain = src.meekFrontingDomain;
+    meekFrontingHost = src.meekFrontingHost;
+    meekFrontingAddressesRegex = src.meekFrontingAddressesRegex;
+    meekFrontingAddresses = src.meekFrontingAddresses;
+}
+
+void ServerEntry::MoveFields(ServerEntry&& src)
+{
+    serverAddress = std::move(src.serverAddress);
+    region = src.region;
+    webServerPort = src.webServerPort;
+    webServerSecret = std::move(src.webServerSecret);
+    webServerCertificate = std::move(src.webServerCertificate);
+    sshPort = src.sshPort;
+    sshUsername = std::move(src.sshUsername);
+    sshPassword = std::move(src.sshPassword);
+    sshHostKey = std::move(src.sshHostKey);
+    sshObfuscatedPort = src.sshObfuscatedPort;
+    sshObfuscatedKey = std::move(src.sshObfuscatedKey);
+    capabilities = src.capabilities;
+    capabilityMask = src.capabilityMask;
+    meekObfuscatedKey = std::move(src.meekObfuscatedKey);
+    meekServerPort = src.meekServerPort;
+    meekCookieEncryptionPublicKey = std::move(src.meekCookieEncryptionPublicKey);
+    meekFrontingDomain = src.meekFrontingDomain;
+    meekFrontingHost = src.meekFrontingHost;
+    meekFrontingAddressesRegex = std::move(src.meekFrontingAddressesRegex);
+    meekFrontingAddresses = src.meekFrontingAddresses;
+
+    // Its fields are gone, so its serialized forms no longer match them.
+    src.ClearSerialized();
 }
 
 void ServerEntry::Copy(const ServerEntry& src)
@@ -486,32 +2124,76 @@ void ServerEntry::Copy(const ServerEntry& src)
     *this = src;
 }
 
-string ServerEntry::ToString() const
+const string& ServerEntry::ToString() const
 {
-    stringstream ss;
+    shared_ptr<const string> serialized = atomic_load(&m_serialized);
+    if (!serialized)
+    {
+        // If another reader got there first, theirs is kept: a reference to
+        // it may already have been returned.
+        shared_ptr<const string> expected;
+        serialized = make_shared<const string>(Serialize());
+        if (!atomic_compare_exchange_strong(&m_serialized, &expected, serialized))
+        {
+            serialized = expected;
+        }
+    }
+    return *serialized;
+}
 
-    //
-    // Legacy values are simply space-separated strings
-    //
+const string& ServerEntry::ToHexString() const
+{
+    shared_ptr<const string> hex = atomic_load(&m_serializedHex);
+    if (!hex)
+    {
+        const string& serialized = ToString();
+        shared_ptr<const string> expected;
+        hex = make_shared<const string>(Hexlify((const unsigned char*)serialized.data(), serialized.length()));
+        if (!atomic_compare_exchange_strong(&m_serializedHex, &expected, hex))
+        {
+            hex = expected;
+        }
+    }
+    return *hex;
+}
 
-    ss << serverAddress << " ";
-    ss << webServerPort << " ";
-    ss << webServerSecret << " ";
-    ss << webServerCertificate << " ";
+size_t ServerEntry::SerializedHeapBytes() const
+{
+    // Each is a shared control block holding the string
+    size_t total = 0;
+    shared_ptr<const string> serialized = atomic_load(&m_serialized);
+    if (serialized)
+    {
+        total += 2 * sizeof(void*) + sizeof(string) + StringHeapBytes(*serialized);
+    }
+    shared_ptr<const string> hex = atomic_load(&m_serializedHex);
+    if (hex)
+    {
+        total += 2 * sizeof(void*) + sizeof(string) + StringHeapBytes(*hex);
+    }
+    return total;
+}
+
+void ServerEntry::ClearSerialized()
+{
+    m_serialized.reset();
+    m_serializedHex.reset();
+}
+
+string ServerEntry::Serialize() const
+{
+    // Note: for legacy reasons, webServerPort is a string, not an int
+    string webServerPortString = std::to_string(webServerPort);
 
     //
     // Extended values are JSON-encoded.
     //
 
-    // Note: for legacy reasons, webServerPort is a string, not an int
-    ostringstream webServerPortString;
-    webServerPortString << webServerPort;
-
     Json::Value entry;
 
     entry["ipAddress"] = serverAddress;
-    entry["region"] = region;
-    entry["webServerPort"] = webServerPortString.str();
+    entry["region"] = region.get();
+    entry["webServerPort"] = webServerPortString;
     entry["webServerCertificate"] = webServerCertificate;
     entry["webServerSecret"] = webServerSecret;
     entry["sshPort"] = sshPort;
@@ -522,69 +2204,122 @@ string ServerEntry::ToString() const
     entry["sshObfuscatedKey"] = sshObfuscatedKey;
     entry["meekObfuscatedKey"] = meekObfuscatedKey;
     entry["meekServerPort"] = meekServerPort;
-    entry["meekFrontingDomain"] = meekFrontingDomain;
-    entry["meekFrontingHost"] = meekFrontingHost;
+    entry["meekFrontingDomain"] = meekFrontingDomain.get();
+    entry["meekFrontingHost"] = meekFrontingHost.get();
     entry["meekCookieEncryptionPublicKey"] = meekCookieEncryptionPublicKey;
     entry["meekFrontingAddressesRegex"] = meekFrontingAddressesRegex;
 
     Json::Value capabilitiesJson(Json::arrayValue);
-    for (const auto& i : this->capabilities)
+    for (const auto& i : this->capabilities.get())
     {
         capabilitiesJson.append(i);
     }
     entry["capabilities"] = capabilitiesJson;
 
     Json::Value meekFrontingAddressesJson(Json::arrayValue);
-    for (const auto& i : this->meekFrontingAddresses)
+    for (const auto& i : this->meekFrontingAddresses.get())
     {
         meekFrontingAddressesJson.append(i);
     }
     entry["meekFrontingAddresses"] = meekFrontingAddressesJson;
 
     Json::FastWriter jsonWriter;
-    ss << jsonWriter.write(entry);
+    string json = jsonWriter.write(entry);
+
+    //
+    // Legacy values are simply space-separated strings
+    //
 
-    return ss.str();
+    string serialized;
+    serialized.reserve(
+        serverAddress.length() + webServerPortString.length() + webServerSecret.length()
+        + webServerCertificate.length() + 4 + json.length());
+    serialized.append(serverAddress).append(1, ' ');
+    serialized.append(webServerPortString).append(1, ' ');
+    serialized.append(webServerSecret).append(1, ' ');
+    serialized.append(webServerCertificate).append(1, ' ');
+    serialized.append(json);
+
+    return serialized;
 }
 
 void ServerEntry::FromString(const string& str)
 {
-    stringstream lineStream(str);
-    string lineItem;
+    FromString(str.data(), str.length());
+}
+
+// Splits the next space-delimited legacy field off the front of [pos, end).
+// Mirrors getline(stream, item, ' '): fails only if there is nothing left.
+static bool NextLegacyField(const char*& pos, const char* end, const char*& o_begin, const char*& o_end)
+{
+    if (pos >= end)
+    {
+        return false;
+    }
+
+    o_begin = pos;
+    o_end = (const char*)memchr(pos, ' ', end - pos);
+    if (!o_end)
+    {
+        o_end = end;
+        pos = end;
+    }
+    else
+    {
+        pos = o_end + 1;
+    }
+    return true;
+}
+
+void ServerEntry::FromString(const char* str, size_t length)
+{
+    ClearSerialized();
+
+    const char* pos = str;
+    const char* end = str + length;
+    const char* fieldBegin;
+    const char* fieldEnd;
 
     //
     // Legacy values are simply space-separated strings
     //
 
-    if (!getline(lineStream, lineItem, ' '))
+    if (!NextLegacyField(pos, end, fieldBegin, fieldEnd))
     {
         throw std::exception("Server Entries are corrupt: can't parse Server Address");
     }
-    serverAddress = lineItem;
+    serverAddress.assign(fieldBegin, fieldEnd);
 
-    if (!getline(lineStream, lineItem, ' '))
+    if (!NextLegacyField(pos, end, fieldBegin, fieldEnd))
     {
         throw std::exception("Server Entries are corrupt: can't parse Web Server Port");
     }
-    webServerPort = (int) strtol(lineItem.c_str(), NULL, 10);
+    webServerPort = (int) strtol(string(fieldBegin, fieldEnd).c_str(), NULL, 10);
 
-    if (!getline(lineStream, lineItem, ' '))
+    if (!NextLegacyField(pos, end, fieldBegin, fieldEnd))
     {
         throw std::exception("Server Entries are corrupt: can't parse Web Server Secret");
     }
-    webServerSecret = lineItem;
+    webServerSecret.assign(fieldBegin, fieldEnd);
 
-    if (!getline(lineStream, lineItem, ' '))
+    if (!NextLegacyField(pos, end, fieldBegin, fieldEnd))
     {
         throw std::exception("Server Entries are corrupt: can't parse Web Server Certificate");
     }
-    webServerCertificate = lineItem;
+    webServerCertificate.assign(fieldBegin, fieldEnd);
 
     //
     // Extended values are JSON-encoded.
     //
 
-    if (!getline(lineStream, lineItem, '\0'))
+    // The JSON runs to the end of the buffer (or to an embedded NUL).
+    const char* jsonEnd = (const char*)memchr(pos, '\0', end - pos);
+    if (!jsonEnd)
+    {
+        jsonEnd = end;
+    }
+
+    if (pos >= end)
     {
         my_print(NOT_SENSITIVE, true, _T("%s: Extended JSON values not present"), __TFUNCTION__);
 
@@ -596,7 +2331,7 @@ void ServerEntry::FromString(const string& str)
 
     Json::Value json_entry;
     Json::Reader reader;
-    bool parsingSuccessful = reader.parse(lineItem, json_entry);
+    bool parsingSuccessful = reader.parse(pos, jsonEnd, json_entry);
     if (!parsingSuccessful)
     {
         string fail = reader.getFormattedErrorMessages();
@@ -626,17 +2361,18 @@ void ServerEntry::FromString(const string& str)
         Json::Value capabilitiesJson;
         capabilitiesJson = json_entry.get("capabilities", defaultCapabilities);
 
-        this->capabilities.clear();
+        vector<string> newCapabilities;
         for (Json::ArrayIndex i = 0; i < capabilitiesJson.size(); i++)
         {
             string item = capabilitiesJson.get(i, "").asString();
             if (!item.empty())
             {
-                this->capabilities.push_back(item);
+                newCapabilities.push_back(item);
             }
         }
+        SetCapabilities(newCapabilities);
 
-        if (HasCapability("FRONTED-MEEK") || HasCapability("UNFRONTED-MEEK") || HasCapability("UNFRONTED-MEEK-HTTPS"))
+        if (capabilityMask & (SERVER_CAPABILITY_FRONTED_MEEK | SERVER_CAPABILITY_UNFRONTED_MEEK | SERVER_CAPABILITY_UNFRONTED_MEEK_HTTPS))
         {
             meekServerPort = json_entry.get("meekServerPort", 0).asInt();
             meekObfuscatedKey = json_entry.get("meekObfuscatedKey", "").asString();
@@ -649,7 +2385,7 @@ void ServerEntry::FromString(const string& str)
             meekCookieEncryptionPublicKey = "";
         }
 
-        if (HasCapability("FRONTED-MEEK"))
+        if (HasCapabilities(SERVER_CAPABILITY_FRONTED_MEEK))
         {
             meekFrontingDomain = json_entry.get("meekFrontingDomain", "").asString();
             meekFrontingHost  = json_entry.get("meekFrontingHost", "").asString();
@@ -657,22 +2393,23 @@ void ServerEntry::FromString(const string& str)
             Json::Value meekFrontingAddressesJson;
             Json::Value emptyArray(Json::arrayValue);
             meekFrontingAddressesJson = json_entry.get("meekFrontingAddresses", emptyArray);
-            this->meekFrontingAddresses.clear();
+            vector<string> newMeekFrontingAddresses;
             for (Json::ArrayIndex i = 0; i < meekFrontingAddressesJson.size(); i++)
             {
                 string item = meekFrontingAddressesJson.get(i, "").asString();
                 if (!item.empty())
                 {
-                    this->meekFrontingAddresses.push_back(item);
+                    newMeekFrontingAddresses.push_back(item);
                 }
             }
+            this->meekFrontingAddresses = newMeekFrontingAddresses;
         }
         else
         {
             meekFrontingDomain = "";
             meekFrontingHost  = "";
             meekFrontingAddressesRegex = "";
-            meekFrontingAddresses.clear();
+            meekFrontingAddresses = vector<string>();
         }
     }
     catch (exception& e)
@@ -682,11 +2419,59 @@ void ServerEntry::FromString(const string& str)
     }
 }
 
+// static
+unsigned int ServerEntry::CapabilityBit(const string& capability)
+{
+    static const struct
+    {
+        const char* name;
+        unsigned int bit;
+    } knownCapabilities[] = {
+        { "OSSH", SERVER_CAPABILITY_OSSH },
+        { "SSH", SERVER_CAPABILITY_SSH },
+        { "VPN", SERVER_CAPABILITY_VPN },
+        { "handshake", SERVER_CAPABILITY_HANDSHAKE },
+        { "FRONTED-MEEK", SERVER_CAPABILITY_FRONTED_MEEK },
+        { "UNFRONTED-MEEK", SERVER_CAPABILITY_UNFRONTED_MEEK },
+        { "UNFRONTED-MEEK-HTTPS", SERVER_CAPABILITY_UNFRONTED_MEEK_HTTPS }
+    };
+
+    for (size_t i = 0; i < sizeof(knownCapabilities) / sizeof(knownCapabilities[0]); i++)
+    {
+        if (capability == knownCapabilities[i].name)
+        {
+            return knownCapabilities[i].bit;
+        }
+    }
+
+    return 0;
+}
+
+void ServerEntry::SetCapabilities(const vector<string>& newCapabilities)
+{
+    ClearSerialized();
+
+    this->capabilities = newCapabilities;
+
+    this->capabilityMask = 0;
+    for (size_t i = 0; i < newCapabilities.size(); i++)
+    {
+        this->capabilityMask |= CapabilityBit(newCapabilities[i]);
+    }
+}
+
 bool ServerEntry::HasCapability(const string& capability) const
 {
-    for (size_t i = 0; i < this->capabilities.size(); i++)
+    unsigned int bit = CapabilityBit(capability);
+    if (bit)
     {
-        if (this->capabilities[i] == capability)
+        return HasCapabilities(bit);
+    }
+
+    const vector<string>& capabilities = this->capabilities.get();
+    for (size_t i = 0; i < capabilities.size(); i++)
+    {
+        if (capabilities[i] == capability)
         {
             return true;
         }
@@ -695,20 +2480,40 @@ bool ServerEntry::HasCapability(const string& capability) const
     return false;
 }
 
-int ServerEntry::GetPreferredReachablityTestPort() const
+vector<pair<string, int>> ServerEntry::GetReachabilityTestPorts() const
 {
-    if (HasCapability("OSSH"))
+    vector<pair<string, int>> candidates;
+    if (HasCapabilities(SERVER_CAPABILITY_OSSH))
+    {
+        candidates.push_back(make_pair(string("OSSH"), sshObfuscatedPort));
+    }
+    if (HasCapabilities(SERVER_CAPABILITY_SSH))
+    {
+        candidates.push_back(make_pair(string("SSH"), sshPort));
+    }
+    if (capabilityMask & (SERVER_CAPABILITY_UNFRONTED_MEEK | SERVER_CAPABILITY_UNFRONTED_MEEK_HTTPS))
     {
-        return sshObfuscatedPort;
+        candidates.push_back(make_pair(string("MEEK"), meekServerPort));
     }
-    else if (HasCapability("SSH"))
+    if (HasCapabilities(SERVER_CAPABILITY_HANDSHAKE))
     {
-        return sshPort;
+        candidates.push_back(make_pair(string("WEB"), webServerPort));
     }
-    else if (HasCapability("handshake"))
+
+    // A port shared by protocols is probed once, for the preferred one.
+    vector<pair<string, int>> ports;
+    for (auto candidate = candidates.begin(); candidate != candidates.end(); ++candidate)
     {
-        return webServerPort;
+        bool seen = candidate->second <= 0;
+        for (auto port = ports.begin(); !seen && port != ports.end(); ++port)
+        {
+            seen = (port->second == candidate->second);
+        }
+        if (!seen)
+        {
+            ports.push_back(*candidate);
+        }
     }
 
-    return -1;
+    return ports;
 }
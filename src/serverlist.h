@@ -20,13 +20,68 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <float.h>
 
 using namespace std;
 
+// The capabilities the client checks for, interned when an entry is parsed so
+// that a check is a bit test. Any others are only in ServerEntry::capabilities.
+enum ServerCapability
+{
+    SERVER_CAPABILITY_OSSH                  = 1 << 0,
+    SERVER_CAPABILITY_SSH                   = 1 << 1,
+    SERVER_CAPABILITY_VPN                   = 1 << 2,
+    SERVER_CAPABILITY_HANDSHAKE             = 1 << 3,
+    SERVER_CAPABILITY_FRONTED_MEEK          = 1 << 4,
+    SERVER_CAPABILITY_UNFRONTED_MEEK        = 1 << 5,
+    SERVER_CAPABILITY_UNFRONTED_MEEK_HTTPS  = 1 << 6
+};
+
+/*
+A server entry field whose value is shared by many entries (a region, a
+fronting domain, a capabilities list), stored once in a process-wide pool.
+Copying one is a pointer copy, and comparing two is a pointer compare.
+Pooled values are kept for the life of the process, so this is only for
+fields with few distinct values. Threadsafe.
+*/
+template<typename T>
+class Interned
+{
+public:
+    Interned() : m_value(Intern(T())) {}
+    explicit Interned(const T& value) : m_value(Intern(value)) {}
+    Interned& operator=(const T& value) { m_value = Intern(value); return *this; }
+
+    const T& get() const { return *m_value; }
+    operator const T&() const { return *m_value; }
+
+    bool operator==(const Interned& other) const { return m_value == other.m_value; }
+    bool operator!=(const Interned& other) const { return m_value != other.m_value; }
+
+    // Heap used by the pool for all values of this type
+    static size_t PoolHeapBytes();
+
+private:
+    static const T* Intern(const T& value);
+
+    const T* m_value;
+};
+
+template<> const string* Interned<string>::Intern(const string& value);
+template<> const vector<string>* Interned<vector<string>>::Intern(const vector<string>& value);
+template<> size_t Interned<string>::PoolHeapBytes();
+template<> size_t Interned<vector<string>>::PoolHeapBytes();
+
 struct ServerEntry
 {
-    ServerEntry() : webServerPort(0), sshPort(0), sshObfuscatedPort(0) {}
-    ServerEntry(const ServerEntry& src) { Copy(src); }
+    ServerEntry() : webServerPort(0), sshPort(0), sshObfuscatedPort(0), capabilityMask(0) {}
+    // Written out, rather than defaulted, so that the serialized forms are
+    // read atomically: an entry may be copied while others serialize it.
+    ServerEntry(const ServerEntry& src);
+    ServerEntry(ServerEntry&& src);
+    ServerEntry& operator=(const ServerEntry& src);
+    ServerEntry& operator=(ServerEntry&& src);
     ServerEntry(
         const string& serverAddress, const string& region, int webServerPort,
         const string& webServerSecret, const string& webServerCertificate,
@@ -41,16 +96,41 @@ struct ServerEntry
         const vector<string>& capabilities);
     void Copy(const ServerEntry& src);
 
-    string ToString() const;
+    // The serialized entry, as stored: the legacy space-separated values,
+    // then the JSON extension. Made on first use and kept with the entry
+    // (shared by its copies) until FromString or SetCapabilities changes it;
+    // no other change may be made to an entry that's been serialized.
+    const string& ToString() const;
+    // ToString, hexlified, as in the registry list and TargetServerEntry.
+    // Kept in the same way.
+    const string& ToHexString() const;
+    // Whether ToString has been made
+    bool IsSerialized() const { return !!atomic_load(&m_serialized); }
+    // Heap held by the serialized forms, for memory accounting
+    size_t SerializedHeapBytes() const;
+
     void FromString(const string& str);
+    // Parses directly from a buffer; `str` need not be NUL-terminated.
+    void FromString(const char* str, size_t length);
 
     bool HasCapability(const string& capability) const;
+    // True if the entry has all of the ServerCapability bits in mask.
+    bool HasCapabilities(unsigned int mask) const { return (capabilityMask & mask) == mask; }
 
-    // returns -1 if there's no port
-    int GetPreferredReachablityTestPort() const;
+    // Also updates capabilityMask; use instead of assigning capabilities.
+    void SetCapabilities(const vector<string>& newCapabilities);
+
+    // The ServerCapability bit for capability, or 0 if it's not one of them.
+    static unsigned int CapabilityBit(const string& capability);
+
+    // Every distinct port a transport may connect to for this server, keyed
+    // by the protocol that uses it, most preferred first. Fronted meek goes
+    // through the fronting domain, not the server, so it isn't included; the
+    // reorder probes it with a TLS handshake to the fronting endpoint.
+    vector<pair<string, int>> GetReachabilityTestPorts() const;
 
     string serverAddress;
-    string region;
+    Interned<string> region;
     int webServerPort;
     string webServerSecret;
     string webServerCertificate;
@@ -60,27 +140,210 @@ struct ServerEntry
     string sshHostKey;
     int sshObfuscatedPort;
     string sshObfuscatedKey;
-    vector<string> capabilities;
+    Interned<vector<string>> capabilities;
+    unsigned int capabilityMask; // The ServerCapability bits in capabilities
     string meekObfuscatedKey;
     int meekServerPort;
     string meekCookieEncryptionPublicKey;
-    string meekFrontingDomain;
-    string meekFrontingHost;
+    Interned<string> meekFrontingDomain;
+    Interned<string> meekFrontingHost;
     string meekFrontingAddressesRegex;
-    vector<string> meekFrontingAddresses;
+    Interned<vector<string>> meekFrontingAddresses;
+
+private:
+    // The fields, without the serialized forms. A new field must be added to
+    // both.
+    void CopyFields(const ServerEntry& src);
+    void MoveFields(ServerEntry&& src);
+
+    string Serialize() const;
+    void ClearSerialized();
+
+    // See ToString and ToHexString. Only ever set once, as entries may be
+    // serialized by several readers at once.
+    mutable shared_ptr<const string> m_serialized;
+    mutable shared_ptr<const string> m_serializedHex;
 };
 
 typedef vector<ServerEntry> ServerEntries;
+
+// Keyed by protocol, as in ServerEntry::GetReachabilityTestPorts, plus
+// FRONTED-MEEK for the fronting endpoint's TLS handshake time
+typedef map<string, unsigned int> ProtocolResponseTimes;
 typedef ServerEntries::const_iterator ServerEntryIterator;
 
+// Tunnels the core established, or failed to, with one protocol to a server
+struct ProtocolEstablishStats
+{
+    ProtocolEstablishStats() : attempts(0), successes(0), establishTimeEWMA(0.0) {}
+
+    unsigned int attempts;
+    unsigned int successes;
+    // Milliseconds from dial to active tunnel; only meaningful if successes > 0
+    double establishTimeEWMA;
+};
+
+// A tunnel establishment attempt reported by the core
+struct ServerEstablishment
+{
+    ServerEstablishment(const string& serverAddress, const string& protocol, bool success, unsigned int establishTime)
+        : serverAddress(serverAddress), protocol(protocol), success(success), establishTime(establishTime) {}
+
+    string serverAddress;
+    string protocol;
+    bool success;
+    // Milliseconds; only meaningful on success
+    unsigned int establishTime;
+};
+
+// Rolling reachability history for a single server, persisted alongside the
+// server list so that ordering survives across reorder runs and restarts.
+struct ServerStats
+{
+    ServerStats()
+        : responseTimeEWMA(0.0), successCount(0), failureCount(0), lastUpdated(0),
+          tunnelLatencyEWMA(0.0), peakThroughputEWMA(0.0), qualitySampleCount(0),
+          quarantinedAt(0), quarantinedUntil(0) {}
+
+    void RecordSuccess(unsigned int responseTime);
+    void RecordFailure();
+
+    // A probe of each of the server's ports: the fastest response counts as
+    // the server's response time. At least one protocol must have responded.
+    void RecordProbe(const ProtocolResponseTimes& responseTimes);
+
+    // A measurement made through an established tunnel to the server:
+    // round trip time of a request, and the highest received rate seen.
+    void RecordTunnelQuality(unsigned int latency, unsigned long long bytesPerSecond);
+
+    // A tunnel establishment by the core. Counts as a success or failure of
+    // the server as a whole, too, with the establishment time scaled to be
+    // comparable to a probe's response time.
+    void RecordEstablishment(const string& protocol, bool success, unsigned int establishTime);
+
+    // Lower is better. Servers that have never responded score DBL_MAX.
+    double Score() const;
+
+    // Milliseconds to connect, estimated from probes and tunnel
+    // measurements alike; DBL_MAX if there's been neither.
+    double Latency() const;
+
+    // True if the history is recent enough that re-probing isn't needed.
+    bool IsFresh() const;
+
+    // True while the server is sitting out after repeated failures: it's
+    // only tried when there's nothing else. Quarantines from before the last
+    // network change don't count, as the failures may have been the
+    // network's.
+    bool IsQuarantined() const;
+
+    // To be called when the local network changes. Threadsafe.
+    static void NoteNetworkChange();
+
+    // When NoteNetworkChange was last called; zero if it hasn't been.
+    // Threadsafe.
+    static time_t LastNetworkChange();
+
+    Json::Value ToJson() const;
+    void FromJson(const Json::Value& json);
+
+    double responseTimeEWMA;
+    unsigned int successCount;
+    // Consecutive failures since the last success
+    unsigned int failureCount;
+    time_t lastUpdated;
+    // From the last probe; protocols that didn't respond are absent
+    ProtocolResponseTimes protocolResponseTimes;
+    // Only meaningful if qualitySampleCount > 0
+    double tunnelLatencyEWMA;
+    double peakThroughputEWMA;
+    unsigned int qualitySampleCount;
+    // Keyed by protocol
+    map<string, ProtocolEstablishStats> protocolEstablishments;
+    // The protocol of the last tunnel established; empty if there's been none
+    string lastProtocol;
+    // The quarantine doubles with each further failure, and a success ends
+    // it; zero if there's been none
+    time_t quarantinedAt;
+    time_t quarantinedUntil;
+};
+
+typedef map<string, ServerStats> ServerStatsMap;
+
+// The histories of a region's servers, summarized for choosing between
+// regions. Only servers with a history are counted.
+struct RegionStats
+{
+    RegionStats() : bestLatency(DBL_MAX), serverCount(0), reachableCount(0) {}
+
+    // Lower is better. DBL_MAX if none of the region's servers is reachable.
+    double Score() const;
+
+    // For the UI: latency (ms, absent if unknown), successRate (0 to 1)
+    // and servers.
+    Json::Value ToJson() const;
+
+    // The best Latency() of the region's reachable servers
+    double bestLatency;
+    unsigned int serverCount;
+    // Servers whose last probe or connect didn't fail
+    unsigned int reachableCount;
+};
+
+typedef map<string, RegionStats> RegionStatsMap;
+
+// An immutable copy of a list, shared by every reader until the list next
+// changes.
+struct ServerListSnapshot
+{
+    ServerListSnapshot(ServerEntries&& entries, unsigned long long version)
+        : entries(std::move(entries)), version(version) {}
+
+    const ServerEntries entries;
+    // Differs between snapshots of the same list iff the list changed
+    const unsigned long long version;
+};
+
+typedef shared_ptr<const ServerListSnapshot> ServerListSnapshotPtr;
+
+struct ServerListCache;
+
+// All instances with the same name share a process-wide, indexed cache of the
+// list. Changes are written back to the registry lazily; call Flush (or
+// FlushAll, before exit) to force the write.
 class ServerList
 {
 public:
     ServerList(LPCSTR listName);
     virtual ~ServerList();
 
+    void Flush();
+    static void FlushAll();
+
+    // Approximate bytes held by all the process-wide caches, for memory
+    // accounting.
+    static size_t GetCacheMemoryUsage();
+
+    // A copy of the entries that's the caller's to change. Readers should use
+    // GetSnapshot instead.
     ServerEntries GetList();
 
+    // The entries, in list order. Only copied when the list has changed
+    // since the last snapshot of it (through any instance with this name).
+    ServerListSnapshotPtr GetSnapshot();
+
+    // Just the entries with all of the ServerCapability bits in
+    // capabilityMask, in list order. The others aren't copied.
+    ServerEntries GetList(unsigned int capabilityMask);
+
+    // True if any entry has all of the bits in capabilityMask.
+    bool HasEntryWithCapabilities(unsigned int capabilityMask);
+
+    // Of the entries with all of the bits in capabilityMask (o_total of
+    // them), how many are still worth trying: neither quarantined nor
+    // failing repeatedly. Entries with no history count as worth trying.
+    size_t CountViableEntries(unsigned int capabilityMask, size_t& o_total);
+
     // serverEntry is optional. It is an extra server entry that should be
     // stored. Typically this is the current server with additional info.
     // Returns the number of new entries added.
@@ -96,17 +359,118 @@ public:
     void MoveEntriesToFront(const ServerEntries& entries, bool veryFront=false);
     void MoveEntryToFront(const ServerEntry& serverEntry, bool veryFront=false);
 
+    // Changes to a list, recorded and then applied together: one pass over
+    // the list under one lock, with one write of the list and of the stats.
+    // Changes are applied in the order they're recorded, with the same effect
+    // as the corresponding ServerList calls made one after another.
+    class Batch
+    {
+    public:
+        Batch(ServerList& serverList) : m_serverList(serverList) {}
+
+        void MarkServerFailed(const ServerEntry& failedServerEntry);
+        void MoveEntryToFront(const ServerEntry& serverEntry, bool veryFront=false);
+
+        // Applies the recorded changes and clears them.
+        void Commit();
+
+    private:
+        friend class ServerList;
+
+        struct Change
+        {
+            ServerEntry serverEntry;
+            bool failed;    // Otherwise it's a move to the front
+            bool veryFront;
+        };
+
+        ServerList& m_serverList;
+        vector<Change> m_changes;
+    };
+
+    // Keyed by serverAddress. Entries are pruned when their server is no
+    // longer in the list.
+    ServerStatsMap GetServerStats();
+
+    // Folds reachability results, keyed by serverAddress, into the persistent
+    // history. A failure is recorded for each address in `unreachable`.
+    void RecordServerResponses(
+        const map<string, ProtocolResponseTimes>& responseTimes,
+        const vector<string>& unreachable);
+
+    // Folds a tunnel quality measurement for serverAddress into its history.
+    // Ignored if the server isn't in the list.
+    void RecordTunnelQuality(
+        const string& serverAddress,
+        unsigned int latency,
+        unsigned long long bytesPerSecond);
+
+    // Folds the core's establishment results into the persistent history.
+    // Results for servers that aren't in the list are ignored.
+    void RecordServerEstablishments(const vector<ServerEstablishment>& establishments);
+
+    // Move servers with a usable history to the front of the list, best score
+    // first. If preferredRegion is set, that region's servers are ranked on
+    // their own, ahead of the rest.
+    void OrderEntriesByScore(const string& preferredRegion="");
+
+    // EMBEDDED_SERVER_LIST with its lines reordered by this list's ranking:
+    // servers with a usable history first (preferredRegion's ahead, as in
+    // OrderEntriesByScore), then the rest as embedded, then servers that keep
+    // failing. The lines themselves are passed through untouched, as they
+    // carry fields only the core reads.
+    // Throws if the embedded list is corrupt.
+    string GetRankedEmbeddedServerList(const string& preferredRegion="");
+
+    // Keyed by region. Servers without a region aren't counted.
+    RegionStatsMap GetRegionStats();
+
+    // Settings::EgressRegion(), with EGRESS_REGION_FASTEST resolved to the
+    // best scoring available region, or to "" (any region) if none has a
+    // usable history yet.
+    string GetEgressRegion();
+
+    // An EgressRegionStats notice for the UI, with the stats of each
+    // available region.
+    string GetEgressRegionStatsNotice();
+
+    // As given by the core. Until then, every region in a list counts as
+    // available.
+    static void SetAvailableEgressRegions(const vector<string>& regions);
+
     static ServerEntries GetListFromSystem(const char* listName);
     static string EncodeServerEntries(const ServerEntries& serverEntryList);
 
 private:
+    // Times the parsing
+    friend class Microbenchmarks;
+
     string GetListName() const;
     ServerEntries GetListFromEmbeddedValues();
     ServerEntries GetListFromSystem();
     static ServerEntries ParseServerEntries(const char* serverEntryListString);
     static ServerEntry ParseServerEntry(const string& serverEntry);
-    void WriteListToSystem(const ServerEntries& serverEntryList);
+    // Large batches are decoded on several pool threads. Throws if any entry
+    // is corrupt.
+    static ServerEntries ParseServerEntries(const vector<string>& serverEntries);
+    static DWORD WINAPI ParseServerEntriesThread(void* object);
+    // The best `capacity` entries of serverEntryList, in list order.
+    ServerEntries SelectEntriesToKeep(const ServerEntries& serverEntryList, size_t capacity);
+    // Evicts all but the entries SelectEntriesToKeep picks.
+    void EnforceCapacity(size_t capacity);
+    size_t WriteListToSystem(const ServerEntries& serverEntryList);
+    size_t WriteListToRegistry(const ServerEntries& serverEntryList);
+    bool GetStorePath(tstring& o_path) const;
+    bool ReadListFromStore(ServerEntries& o_serverEntryList) const;
+    bool WriteListToStore(const ServerEntries& serverEntryList) const;
+    void LoadCache();
+    void ScheduleWrite();
+    void ApplyBatch(const Batch& batch);
+    static VOID CALLBACK WriteTimerCallback(PVOID param, BOOLEAN timerOrWaitFired);
+    string GetStatsName() const;
+    ServerStatsMap GetStatsFromSystem();
+    void WriteStatsToSystem(const ServerStatsMap& stats);
 
-    HANDLE m_mutex;
     string m_name;
+    ServerListCache* m_cache;
 };
@@ -22,6 +22,7 @@
 #include "logging.h"
 #include "psiclient.h"
 #include "config.h"
+#include "embeddedvalues.h"
 #include "utilities.h"
 #include <sstream>
 
@@ -32,6 +33,156 @@
 #define PREEMPTIVE_RECONNECT_LIFETIME_MILLISECONDS_DEFAULT MAXDWORD
 
 
+// The compiled regexes from the last config processed, by pattern. Only those
+// are kept: a config with new regexes replaces the lot.
+static Lock g_compiledRegexesLock("CompiledRegexes");
+static map<string, shared_ptr<const regex>> g_compiledRegexes;
+
+// Returns the compiled `pattern`, from the last config's if it was there, and
+// adds it to o_compiled. May throw regex_error.
+static shared_ptr<const regex> GetCompiledRegex(
+                                    const string& pattern,
+                                    map<string, shared_ptr<const regex>>& o_compiled)
+{
+    shared_ptr<const regex>& compiled = o_compiled[pattern];
+    if (compiled)
+    {
+        return compiled;
+    }
+
+    {
+        AutoLock lock(g_compiledRegexesLock);
+        auto cached = g_compiledRegexes.find(pattern);
+        if (cached != g_compiledRegexes.end())
+        {
+            compiled = cached->second;
+            return compiled;
+        }
+    }
+
+    try
+    {
+        compiled = make_shared<const regex>(
+                        pattern,
+                        regex::ECMAScript | regex::icase | regex::optimize);
+    }
+    catch (...)
+    {
+        o_compiled.erase(pattern);
+        throw;
+    }
+    return compiled;
+}
+
+// Appends the regexes in a handshake's regexes JSON to o_regexes. May throw
+// regex_error.
+static void AppendRegexes(
+                const Json::Value& regexes,
+                map<string, shared_ptr<const regex>>& o_compiled,
+                vector<RegexReplace>& o_regexes)
+{
+    for (Json::Value::ArrayIndex i = 0; i < regexes.size(); i++)
+    {
+        RegexReplace rx_re;
+        rx_re.pattern = regexes[i].get("regex", "").asString();
+        rx_re.regex = GetCompiledRegex(rx_re.pattern, o_compiled);
+        rx_re.replace = regexes[i].get("replace", "").asString();
+
+        o_regexes.push_back(rx_re);
+    }
+}
+
+
+/*
+The sections of a handshake's config that are only built when first asked
+for: the home pages are only needed once connected, the discovered servers
+once, and the regexes -- slow to compile -- only by a stats-collecting local
+proxy. Each section's JSON is dropped once it's built.
+*/
+struct SessionInfo::HandshakeSections
+{
+    HandshakeSections()
+        : lock("HandshakeSections"), homepagesBuilt(false), serversBuilt(false), regexesBuilt(false) {}
+
+    Lock lock;
+
+    Json::Value homepagesJson;
+    bool homepagesBuilt;
+    vector<tstring> homepages;
+
+    Json::Value serversJson;
+    bool serversBuilt;
+    vector<string> servers;
+
+    Json::Value pageViewRegexesJson;
+    Json::Value httpsRequestRegexesJson;
+    bool regexesBuilt;
+    vector<RegexReplace> pageViewRegexes;
+    vector<RegexReplace> httpsRequestRegexes;
+
+    void BuildHomepages()
+    {
+        AutoLock autoLock(lock);
+        if (homepagesBuilt)
+        {
+            return;
+        }
+        for (Json::Value::ArrayIndex i = 0; i < homepagesJson.size(); i++)
+        {
+            homepages.push_back(UTF8ToWString(homepagesJson[i].asString()));
+        }
+        homepagesJson = Json::Value();
+        homepagesBuilt = true;
+    }
+
+    void BuildServers()
+    {
+        AutoLock autoLock(lock);
+        if (serversBuilt)
+        {
+            return;
+        }
+        servers.reserve(serversJson.size());
+        for (Json::Value::ArrayIndex i = 0; i < serversJson.size(); i++)
+        {
+            servers.push_back(serversJson[i].asString());
+        }
+        serversJson = Json::Value();
+        serversBuilt = true;
+    }
+
+    void BuildRegexes()
+    {
+        AutoLock autoLock(lock);
+        if (regexesBuilt)
+        {
+            return;
+        }
+
+        map<string, shared_ptr<const regex>> compiledRegexes;
+        try
+        {
+            AppendRegexes(pageViewRegexesJson, compiledRegexes, pageViewRegexes);
+            AppendRegexes(httpsRequestRegexesJson, compiledRegexes, httpsRequestRegexes);
+
+            AutoLock compiledLock(g_compiledRegexesLock);
+            g_compiledRegexes.swap(compiledRegexes);
+        }
+        catch (exception& e)
+        {
+            // Without all of them, the stats would be wrong; better none.
+            my_print(NOT_SENSITIVE, false, _T("%s:%d: Regex compile exception: %S"), __TFUNCTION__, __LINE__, e.what());
+            pageViewRegexes.clear();
+            httpsRequestRegexes.clear();
+        }
+
+        pageViewRegexesJson = Json::Value();
+        httpsRequestRegexesJson = Json::Value();
+        regexesBuilt = true;
+    }
+};
+
+
 SessionInfo::SessionInfo()
 {
     Clear();
@@ -40,6 +191,7 @@ SessionInfo::SessionInfo()
 void SessionInfo::Clear()
 {
     m_clientSessionID.clear();
+    m_requestParams.clear();
     m_upgradeVersion.clear();
     m_psk.clear();
     m_sshPort = 0;
@@ -54,11 +206,11 @@ void SessionInfo::Clear()
     m_meekCookieEncryptionPublicKey.clear();
     m_meekFrontingDomain.clear();
     m_meekFrontingHost.clear();
+    m_handshakeSections.reset();
     m_homepages.clear();
-    m_servers.clear();
-    m_pageViewRegexes.clear();
-    m_httpsRequestRegexes.clear();
+    m_homepagesTaken = false;
     m_preemptiveReconnectLifetimeMilliseconds = PREEMPTIVE_RECONNECT_LIFETIME_MILLISECONDS_DEFAULT;
+    m_statusRequestCompression = false;
     m_localHttpProxyPort = 0;
     m_localHttpsProxyPort = 0;
     m_localSocksProxyPort = 0;
@@ -74,6 +226,10 @@ void SessionInfo::Set(const ServerEntry& serverEntry, bool generateClientSession
     {
         GenerateClientSessionID();
     }
+    else
+    {
+        UpdateRequestParams();
+    }
 }
 
 void SessionInfo::GenerateClientSessionID()
@@ -85,6 +241,17 @@ void SessionInfo::GenerateClientSessionID()
         rand_s(((unsigned int*)bytes) + i);
     }
     m_clientSessionID = Hexlify(bytes, CLIENT_SESSION_ID_BYTES);
+
+    UpdateRequestParams();
+}
+
+void SessionInfo::UpdateRequestParams()
+{
+    m_requestParams = tstring(_T("client_session_id=")) + UTF8ToWString(m_clientSessionID) +
+                      _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
+                      _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
+                      _T("&client_version=") + UTF8ToWString(CLIENT_VERSION) +
+                      _T("&server_secret=") + UTF8ToWString(m_serverEntry.webServerSecret);
 }
 
 bool SessionInfo::ParseHandshakeResponse(const string& response)
@@ -125,11 +292,11 @@ bool SessionInfo::ProcessConfig(const string& config_json)
     m_sshSessionID.clear();
     m_sshObfuscatedPort = 0;
     m_sshObfuscatedKey.clear();
+    m_handshakeSections.reset();
     m_homepages.clear();
-    m_servers.clear();
-    m_pageViewRegexes.clear();
-    m_httpsRequestRegexes.clear();
+    m_homepagesTaken = false;
     m_preemptiveReconnectLifetimeMilliseconds = PREEMPTIVE_RECONNECT_LIFETIME_MILLISECONDS_DEFAULT;
+    m_statusRequestCompression = false;
     m_localHttpProxyPort = 0;
     m_localHttpsProxyPort = 0;
     m_localSocksProxyPort = 0;
@@ -146,23 +313,17 @@ bool SessionInfo::ProcessConfig(const string& config_json)
 
     try
     {
-        // Homepages
-        Json::Value homepages = config["homepages"];
-        for (Json::Value::ArrayIndex i = 0; i < homepages.size(); i++)
-        {
-            m_homepages.push_back(UTF8ToWString(homepages[i].asString()));
-        }
+        // Home pages, servers and regexes are built when they're asked for.
+        // Their JSON is taken out of the config rather than copied.
+        shared_ptr<HandshakeSections> sections = make_shared<HandshakeSections>();
+        sections->homepagesJson.swap(config["homepages"]);
+        sections->serversJson.swap(config["encoded_server_list"]);
+        sections->pageViewRegexesJson.swap(config["page_view_regexes"]);
+        sections->httpsRequestRegexesJson.swap(config["https_request_regexes"]);
 
         // Upgrade
         m_upgradeVersion = config.get("upgrade_client_version", "").asString();
 
-        // Servers
-        Json::Value servers = config["encoded_server_list"];
-        for (Json::Value::ArrayIndex i = 0; i < servers.size(); i++)
-        {
-            m_servers.push_back(servers[i].asString());
-        }
-
         // SSH and OSSH values
         m_sshPort = config.get("ssh_port", 0).asInt();
         m_sshUsername = config.get("ssh_username", "").asString();
@@ -175,35 +336,15 @@ bool SessionInfo::ProcessConfig(const string& config_json)
         // VPN PSK
         m_psk = config.get("l2tp_ipsec_psk", "").asString();
 
-        // Page view regexes
-        Json::Value regexes = config["page_view_regexes"];
-        for (Json::Value::ArrayIndex i = 0; i < regexes.size(); i++)
-        {
-            RegexReplace rx_re;
-            rx_re.regex = regex(
-                            regexes[i].get("regex", "").asString(),
-                            regex::ECMAScript | regex::icase | regex::optimize);
-            rx_re.replace = regexes[i].get("replace", "").asString();
-
-            m_pageViewRegexes.push_back(rx_re);
-        }
-
-        // HTTPS request regexes
-        regexes = config["https_request_regexes"];
-        for (Json::Value::ArrayIndex i = 0; i < regexes.size(); i++)
-        {
-            RegexReplace rx_re;
-            rx_re.regex = regex(
-                            regexes[i].get("regex", "").asString(),
-                            regex::ECMAScript | regex::icase | regex::optimize);
-            rx_re.replace = regexes[i].get("replace", "").asString();
-
-            m_httpsRequestRegexes.push_back(rx_re);
-        }
-
         // Preemptive Reconnect Lifetime Milliseconds
         m_preemptiveReconnectLifetimeMilliseconds = (DWORD)config.get("preemptive_reconnect_lifetime_milliseconds", 0).asUInt();
         // A zero value indicates that it should be disabled.
+
+        // Servers that can decode gzip status request bodies say so. Older
+        // servers omit this, and get plain JSON.
+        m_statusRequestCompression = config.get("status_request_compression", false).asBool();
+
+        m_handshakeSections = sections;
     }
     catch (exception& e)
     {
@@ -214,8 +355,19 @@ bool SessionInfo::ProcessConfig(const string& config_json)
     return true;
 }
 
+void SessionInfo::TakeHomepages()
+{
+    if (!m_homepagesTaken)
+    {
+        m_homepages = GetHomepages();
+        m_homepagesTaken = true;
+    }
+}
+
 void SessionInfo::SetHomepage(const char* homepage)
 {
+    TakeHomepages();
+
     tstring newHomepage = UTF8ToWString(homepage);
     if (m_homepages.end() == std::find(m_homepages.begin(), m_homepages.end(), newHomepage))
     {
@@ -225,6 +377,8 @@ void SessionInfo::SetHomepage(const char* homepage)
 
 void SessionInfo::RotateHomepages()
 {
+    TakeHomepages();
+
     if (!m_homepages.empty())
     {
         std::rotate(m_homepages.begin(), m_homepages.begin() + 1, m_homepages.end());
@@ -335,9 +489,64 @@ string SessionInfo::GetMeekCookieEncryptionPublicKey() const
     return Coalesce(m_meekCookieEncryptionPublicKey, m_serverEntry.meekCookieEncryptionPublicKey);
 }
 
-vector<string> SessionInfo::GetDiscoveredServerEntries() const
+const vector<tstring>& SessionInfo::GetHomepages() const
+{
+    if (m_homepagesTaken || !m_handshakeSections)
+    {
+        return m_homepages;
+    }
+    m_handshakeSections->BuildHomepages();
+    return m_handshakeSections->homepages;
+}
+
+const vector<string>& SessionInfo::GetDiscoveredServerEntries() const
+{
+    static const vector<string> none;
+    if (!m_handshakeSections)
+    {
+        return none;
+    }
+    m_handshakeSections->BuildServers();
+    return m_handshakeSections->servers;
+}
+
+const vector<RegexReplace>& SessionInfo::GetPageViewRegexes() const
+{
+    static const vector<RegexReplace> none;
+    if (!m_handshakeSections)
+    {
+        return none;
+    }
+    m_handshakeSections->BuildRegexes();
+    return m_handshakeSections->pageViewRegexes;
+}
+
+const vector<RegexReplace>& SessionInfo::GetHttpsRequestRegexes() const
+{
+    static const vector<RegexReplace> none;
+    if (!m_handshakeSections)
+    {
+        return none;
+    }
+    m_handshakeSections->BuildRegexes();
+    return m_handshakeSections->httpsRequestRegexes;
+}
+
+bool SessionInfo::HasStatsRegexes() const
 {
-    return m_servers;
+    if (!m_handshakeSections)
+    {
+        return false;
+    }
+
+    AutoLock lock(m_handshakeSections->lock);
+    if (m_handshakeSections->regexesBuilt)
+    {
+        return !m_handshakeSections->pageViewRegexes.empty()
+               || !m_handshakeSections->httpsRequestRegexes.empty();
+    }
+    return m_handshakeSections->pageViewRegexesJson.size() > 0
+           || m_handshakeSections->httpsRequestRegexesJson.size() > 0;
 }
 
 bool SessionInfo::HasServerEntry() const
@@ -20,15 +20,29 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 #include "serverlist.h"
 #include "tstring.h"
 
 struct RegexReplace
 {
-    regex regex;
+    // The source of `regex`, kept for analysis; see RegexReplaceMatcher
+    string pattern;
+    // Compiled once per distinct pattern and shared, as compiling is slow
+    // and reconnects normally get the same regexes again
+    shared_ptr<const std::regex> regex;
     string replace;
 };
 
+/*
+Once filled in, a SessionInfo is shared as an immutable snapshot -- a
+shared_ptr<const SessionInfo> -- rather than being copied: a change is made
+to a new copy, which then replaces the snapshot wholesale.
+
+The handshake's larger sections -- home pages, discovered server entries and
+the stats regexes -- are kept as received, and only built on first access;
+copies share them, built or not. Threadsafe for const access.
+*/
 class SessionInfo
 {
 public:
@@ -41,6 +55,11 @@ public:
 
     string GetClientSessionID() const {return m_clientSessionID;}
 
+    // The query parameters every web server request starts with, from
+    // client_session_id to server_secret (with no leading '?'). Built when the
+    // session is set rather than for each request.
+    const tstring& GetRequestParams() const {return m_requestParams;}
+
     string GetServerAddress() const;
     string GetRegion() const;
     int GetWebPort() const;
@@ -62,14 +81,20 @@ public:
     string GetSSHSessionID() const {return m_sshSessionID;}
     string GetUpgradeVersion() const {return m_upgradeVersion;}
     string GetPSK() const {return m_psk;}
-    vector<tstring> GetHomepages() const {return m_homepages;}
-    vector<string> GetDiscoveredServerEntries() const;
-    vector<RegexReplace> GetPageViewRegexes() const {return m_pageViewRegexes;}
-    vector<RegexReplace> GetHttpsRequestRegexes() const {return m_httpsRequestRegexes;}
+    const vector<tstring>& GetHomepages() const;
+    const vector<string>& GetDiscoveredServerEntries() const;
+    // A regex that fails to compile leaves its list empty; that's logged.
+    const vector<RegexReplace>& GetPageViewRegexes() const;
+    const vector<RegexReplace>& GetHttpsRequestRegexes() const;
+    // Whether there are regexes of either kind, without compiling them
+    bool HasStatsRegexes() const;
 
     // A value of zero means disabled.
     DWORD GetPreemptiveReconnectLifetimeMilliseconds() const {return m_preemptiveReconnectLifetimeMilliseconds;}
 
+    // True if the server accepts gzip-encoded status request bodies.
+    bool GetStatusRequestCompression() const {return m_statusRequestCompression;}
+
     int GetLocalHttpProxyPort() const { return m_localHttpProxyPort; }
     int GetLocalHttpsProxyPort() const { return m_localHttpsProxyPort; }
     int GetLocalSocksProxyPort() const { return m_localSocksProxyPort; }
@@ -92,9 +117,19 @@ protected:
     void Clear();
 
 private:
+    void UpdateRequestParams();
+
+    // Before SetHomepage or RotateHomepages, the home pages are the
+    // handshake's; after, they're this SessionInfo's own.
+    void TakeHomepages();
+
+    // In sessioninfo.cpp
+    struct HandshakeSections;
+
     ServerEntry m_serverEntry;
 
     string m_clientSessionID;
+    tstring m_requestParams;
     string m_upgradeVersion;
     string m_psk;
     int m_sshPort;
@@ -109,11 +144,13 @@ private:
     string m_meekCookieEncryptionPublicKey;
     string m_meekFrontingDomain;
     string m_meekFrontingHost;
+    // Null before a handshake
+    shared_ptr<HandshakeSections> m_handshakeSections;
+    // Only used once m_homepagesTaken; see TakeHomepages
     vector<tstring> m_homepages;
-    vector<string> m_servers;
-    vector<RegexReplace> m_pageViewRegexes;
-    vector<RegexReplace> m_httpsRequestRegexes;
+    bool m_homepagesTaken;
     DWORD m_preemptiveReconnectLifetimeMilliseconds;
+    bool m_statusRequestCompression;
     int m_localHttpProxyPort;
     int m_localHttpsProxyPort;
     int m_localSocksProxyPort;
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "startup_tasks.h"
+#include "thread_pool.h"
+#include "diagnostic_info.h"
+#include "logging.h"
+#include "utilities.h"
+#include "config.h"
+#include "embeddedvalues.h"
+#include "performance_budget.h"
+
+
+struct StartupTask
+{
+    string name;
+    std::function<void()> function;
+    vector<size_t> dependents;
+    // Dependencies that haven't finished yet
+    volatile LONG pending;
+    HANDLE doneEvent;
+    DWORD startTime;
+    DWORD endTime;
+
+    StartupTask() : pending(0), doneEvent(NULL), startTime(0), endTime(0) {}
+};
+
+// Only added to before Start, so it's safe to read without the lock after.
+static vector<StartupTask> g_startupTasks;
+static volatile LONG g_startupTasksRemaining = 0;
+static bool g_startupTasksStarted = false;
+static DWORD g_startupTasksStartTime = 0;
+
+static size_t FindStartupTask(const char* name)
+{
+    for (size_t i = 0; i < g_startupTasks.size(); i++)
+    {
+        if (g_startupTasks[i].name == name)
+        {
+            return i;
+        }
+    }
+    return g_startupTasks.size();
+}
+
+// Startup timelines kept in the data directory
+#define STARTUP_TIMELINES_FILENAME          _T("startup_timelines.json")
+#define STARTUP_TIMELINES_MAX_SAVED         10
+// Boot times (see GetBootTime) closer than this are the same boot.
+#define STARTUP_TIMELINE_BOOT_TOLERANCE_S   120
+
+// Milestone name -> ms since process start, in the order reached
+static Lock g_startupTimelineLock("StartupTimeline");
+static vector<pair<string, double>> g_startupTimeline;
+static LARGE_INTEGER g_startupTimelineCounterBase = { 0 };
+static double g_startupTimelineElapsedBase = 0;
+static bool g_startupTimelineSaved = false;
+
+// Milliseconds since the process was created
+static DWORD MillisecondsSinceProcessStart()
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0;
+    }
+
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+
+    ULONGLONG created = ((ULONGLONG)creationTime.dwHighDateTime << 32) | creationTime.dwLowDateTime;
+    ULONGLONG current = ((ULONGLONG)now.dwHighDateTime << 32) | now.dwLowDateTime;
+
+    // FILETIMEs are in 100ns units
+    return current > created ? (DWORD)((current - created) / 10000) : 0;
+}
+
+static void RunStartupTask(size_t index);
+
+static void PostStartupTask(size_t index)
+{
+    if (!ThreadPool::Instance().Post([index]() { RunStartupTask(index); }))
+    {
+        // Better late than never
+        RunStartupTask(index);
+    }
+}
+
+static void RunStartupTask(size_t index)
+{
+    StartupTask& task = g_startupTasks[index];
+
+    task.startTime = GetTickCount();
+    task.function();
+    task.endTime = GetTickCount();
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %S took %d ms (started at +%d ms)"),
+        __TFUNCTION__, task.name.c_str(), task.endTime - task.startTime, task.startTime - g_startupTasksStartTime);
+
+    SetEvent(task.doneEvent);
+
+    for (auto it = task.dependents.begin(); it != task.dependents.end(); ++it)
+    {
+        if (InterlockedDecrement(&g_startupTasks[*it].pending) == 0)
+        {
+            PostStartupTask(*it);
+        }
+    }
+
+    if (InterlockedDecrement(&g_startupTasksRemaining) == 0)
+    {
+        // They've all finished, so all the times are set.
+        Json::Value timings(Json::objectValue);
+        for (auto it = g_startupTasks.begin(); it != g_startupTasks.end(); ++it)
+        {
+            timings[it->name]["startMs"] = (Json::UInt)(it->startTime - g_startupTasksStartTime);
+            timings[it->name]["durationMs"] = (Json::UInt)(it->endTime - it->startTime);
+        }
+        AddDiagnosticInfoJson("StartupTasks", timings);
+
+        my_print(NOT_SENSITIVE, true, _T("%s: all startup tasks done after %d ms"),
+            __TFUNCTION__, GetTickCount() - g_startupTasksStartTime);
+    }
+}
+
+// static
+void StartupTasks::Add(
+                    const char* name,
+                    std::function<void()>&& function,
+                    const vector<string>& dependencies/*=vector<string>()*/)
+{
+    assert(!g_startupTasksStarted);
+
+    StartupTask task;
+    task.name = name;
+    task.function = std::move(function);
+    task.doneEvent = CreateEvent(
+                        NULL,
+                        TRUE,  // manual reset
+                        FALSE, // initial state
+                        0);
+    if (!task.doneEvent)
+    {
+        // Just run it now, on this thread
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateEvent failed (%d)"), __TFUNCTION__, GetLastError());
+        task.function();
+        return;
+    }
+
+    size_t index = g_startupTasks.size();
+    for (auto it = dependencies.begin(); it != dependencies.end(); ++it)
+    {
+        size_t dependency = FindStartupTask(it->c_str());
+        if (dependency < g_startupTasks.size())
+        {
+            g_startupTasks[dependency].dependents.push_back(index);
+            task.pending++;
+        }
+    }
+
+    g_startupTasks.push_back(std::move(task));
+}
+
+// static
+void StartupTasks::Start()
+{
+    assert(!g_startupTasksStarted);
+
+    g_startupTasksStarted = true;
+    g_startupTasksStartTime = GetTickCount();
+    g_startupTasksRemaining = (LONG)g_startupTasks.size();
+
+    // Collect the roots first: once one is posted, it may finish and post
+    // its dependents before we're done here.
+    vector<size_t> roots;
+    for (size_t i = 0; i < g_startupTasks.size(); i++)
+    {
+        if (g_startupTasks[i].pending == 0)
+        {
+            roots.push_back(i);
+        }
+    }
+
+    for (auto it = roots.begin(); it != roots.end(); ++it)
+    {
+        PostStartupTask(*it);
+    }
+}
+
+// static
+void StartupTasks::Wait(const char* name)
+{
+    if (!g_startupTasksStarted)
+    {
+        return;
+    }
+
+    size_t index = FindStartupTask(name);
+    if (index >= g_startupTasks.size())
+    {
+        return;
+    }
+
+    if (WaitForSingleObject(g_startupTasks[index].doneEvent, 0) == WAIT_OBJECT_0)
+    {
+        return;
+    }
+
+    DWORD waitStart = GetTickCount();
+    WaitForSingleObject(g_startupTasks[index].doneEvent, INFINITE);
+    my_print(NOT_SENSITIVE, true, _T("%s: waited %d ms for %S"), __TFUNCTION__, GetTickCount() - waitStart, name);
+}
+
+// static
+void StartupTasks::Milestone(const char* name)
+{
+    double elapsed = 0;
+
+    {
+        AutoLock lock(g_startupTimelineLock);
+
+        // The process start time only has system clock resolution, so it's
+        // only used for the first milestone; the rest are timed from that.
+        LARGE_INTEGER counter, frequency;
+        bool haveCounter = QueryPerformanceCounter(&counter) && QueryPerformanceFrequency(&frequency);
+
+        if (g_startupTimeline.empty() || !haveCounter || g_startupTimelineCounterBase.QuadPart == 0)
+        {
+            elapsed = MillisecondsSinceProcessStart();
+            if (haveCounter && g_startupTimeline.empty())
+            {
+                g_startupTimelineCounterBase = counter;
+                g_startupTimelineElapsedBase = elapsed;
+            }
+        }
+        else
+        {
+            elapsed = g_startupTimelineElapsedBase
+                      + (double)(counter.QuadPart - g_startupTimelineCounterBase.QuadPart) * 1000.0 / (double)frequency.QuadPart;
+        }
+
+        if (!g_startupTimelineSaved)
+        {
+            g_startupTimeline.push_back(make_pair(string(name), elapsed));
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: %S at +%.1f ms"), __TFUNCTION__, name, elapsed);
+
+    Json::Value json;
+    json["name"] = name;
+    json["elapsedMs"] = elapsed;
+    AddDiagnosticInfoJson("StartupMilestone", json);
+}
+
+// When the system booted, in seconds since 1601 -- i.e., FILETIME units.
+// Only approximate, as the tick count and the clock drift apart.
+static ULONGLONG GetBootTime()
+{
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    ULONGLONG current = ((ULONGLONG)now.dwHighDateTime << 32) | now.dwLowDateTime;
+    // GetTickCount wraps after 49 days, which only makes the boot seem later.
+    return current / 10000000 - GetTickCount() / 1000;
+}
+
+static void SaveStartupTimeline(const Json::Value& timeline)
+{
+    tstring dataDirectory;
+    if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, true, dataDirectory))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: GetDataPath failed (%d)"), __TFUNCTION__, GetLastError());
+        return;
+    }
+    tstring path = (filesystem::path(dataDirectory) / STARTUP_TIMELINES_FILENAME).wstring();
+
+    // A missing or corrupt file just means there's no history.
+    Json::Value timelines(Json::arrayValue);
+    string contents;
+    if (ReadFileContents(path, contents))
+    {
+        Json::Reader reader;
+        if (!reader.parse(contents, timelines) || !timelines.isArray())
+        {
+            timelines = Json::Value(Json::arrayValue);
+        }
+    }
+
+    Json::Value current = timeline;
+    bool cold = true;
+    for (Json::ArrayIndex i = 0; i < timelines.size(); i++)
+    {
+        ULONGLONG bootTime = timelines[i].get("bootTime", (Json::UInt64)0).asUInt64();
+        ULONGLONG thisBootTime = current["bootTime"].asUInt64();
+        if ((bootTime > thisBootTime ? bootTime - thisBootTime : thisBootTime - bootTime) <= STARTUP_TIMELINE_BOOT_TOLERANCE_S)
+        {
+            cold = false;
+            break;
+        }
+    }
+    current["cold"] = cold;
+
+    // Warm starts are quicker, and would hide a slow cold one.
+    if (cold)
+    {
+        const Json::Value& milestones = current["milestones"];
+        for (Json::ArrayIndex i = 0; i < milestones.size(); i++)
+        {
+            if (milestones[i]["name"].asString() == "WindowShown")
+            {
+                PerformanceBudget::Record(PERF_METRIC_COLD_START_TO_WINDOW, milestones[i]["elapsedMs"].asDouble());
+                break;
+            }
+        }
+    }
+
+    for (Json::ArrayIndex i = 0; i < timelines.size(); i++)
+    {
+        const Json::Value& previous = timelines[i];
+        const Json::Value& milestones = previous["milestones"];
+        double total = milestones.empty() ? 0 : milestones[milestones.size() - 1]["elapsedMs"].asDouble();
+        my_print(NOT_SENSITIVE, true, _T("%s: previous %s start (%S): %.1f ms"),
+            __TFUNCTION__, previous["cold"].asBool() ? _T("cold") : _T("warm"),
+            previous["clientVersion"].asString().c_str(), total);
+    }
+
+    timelines.append(current);
+    while (timelines.size() > STARTUP_TIMELINES_MAX_SAVED)
+    {
+        Json::Value removed;
+        timelines.removeIndex(0, &removed);
+    }
+
+    AddDiagnosticInfoJson("StartupTimelines", timelines);
+
+    Json::FastWriter jsonWriter;
+    (void)WriteFile(path, jsonWriter.write(timelines));
+}
+
+// static
+void StartupTasks::SaveTimeline()
+{
+    Json::Value timeline;
+    double total = 0;
+
+    {
+        AutoLock lock(g_startupTimelineLock);
+
+        if (g_startupTimelineSaved)
+        {
+            return;
+        }
+        g_startupTimelineSaved = true;
+
+        timeline["clientVersion"] = CLIENT_VERSION;
+        timeline["bootTime"] = (Json::UInt64)GetBootTime();
+        timeline["timestamp"] = WStringToUTF8(GetISO8601DatetimeString());
+        timeline["milestones"] = Json::Value(Json::arrayValue);
+        for (auto it = g_startupTimeline.begin(); it != g_startupTimeline.end(); ++it)
+        {
+            Json::Value milestone;
+            milestone["name"] = it->first;
+            milestone["elapsedMs"] = it->second;
+            timeline["milestones"].append(milestone);
+            total = it->second;
+        }
+    }
+
+    my_print(NOT_SENSITIVE, true, _T("%s: startup took %.1f ms"), __TFUNCTION__, total);
+
+    // What startup's I/O came to, for comparison with the timeline
+    IoStatsReport("startup");
+
+    // File I/O, so not on the UI thread
+    if (!ThreadPool::Instance().Post([timeline]() { SaveStartupTimeline(timeline); }))
+    {
+        SaveStartupTimeline(timeline);
+    }
+}
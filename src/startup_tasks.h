@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include <functional>
+
+
+// Names of the tasks _tWinMain adds
+#define STARTUP_TASK_SYSTEM_PROXY           "SystemProxy"
+#define STARTUP_TASK_DIAGNOSTIC_COLLECTION  "DiagnosticCollection"
+#define STARTUP_TASK_SERVER_LIST            "ServerList"
+
+
+/*
+The startup work that doesn't need the UI thread, run on pool threads while
+the UI thread gets the window up. Each task may depend on others added before
+it, and is started once they've all finished; ones without dependencies all
+start at once.
+
+Anything that needs a task's result must Wait for it first. How long each
+task took, and when the startup milestones were reached, is logged and goes
+into the diagnostic info.
+
+Threadsafe, except that all tasks must be added before Start.
+*/
+class StartupTasks
+{
+public:
+    static void Add(
+                    const char* name,
+                    std::function<void()>&& function,
+                    const vector<string>& dependencies=vector<string>());
+
+    static void Start();
+
+    // Returns once the named task has finished. Returns immediately if it was
+    // never added, or if the tasks haven't been started at all.
+    static void Wait(const char* name);
+
+    // Records how long after the process was created it got to name (e.g.,
+    // showing the window). Milestones after the first are timed with the
+    // performance counter.
+    static void Milestone(const char* name);
+
+    // Ends the startup timeline: the milestones so far are saved, with the
+    // last few startups' timelines, in the data directory, and logged and put
+    // in the diagnostic info along with those. Each is marked as a cold start
+    // (the first since the system booted) or a warm one. Done off the
+    // calling thread; only the first call does anything.
+    static void SaveTimeline();
+};
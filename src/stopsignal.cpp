@@ -46,6 +46,8 @@ Complications to remember:
 #include "stopsignal.h"
 #include "psiclient.h"
 #include "utilities.h"
+#include "logging.h"
+#include <algorithm>
 
 
 /***********************************************************************
@@ -53,43 +55,143 @@ Complications to remember:
  */
 
 StopSignal::StopSignal()
+    : m_stop(STOP_REASON_NONE), m_parent(NULL), m_parentReasons(STOP_REASON_NONE)
 {
-    m_stop = STOP_REASON_NONE;
+    Init();
+}
+
+StopSignal::StopSignal(StopSignal* parent, DWORD parentReasons)
+    : m_stop(STOP_REASON_NONE), m_parent(parent), m_parentReasons(parentReasons)
+{
+    Init();
+
+    if (m_parent)
+    {
+        AutoLock lock(m_parent->m_lock);
+        m_parent->m_children.push_back(this);
+    }
+}
 
-    // Note that because our stop signal is a simple primitive type, and we're
-    // only doing simple sets or simple checks (but not check-and-set), then we
-    // don't really need to use a mutex. But a) this simple functionality might
-    // change in the future; b) using a mutex isn't a lot of overhead; c) using
-    // a mutex makes it clear that this is threadsafe.
-    m_mutex = CreateMutex(NULL, FALSE, 0);
+void StopSignal::Init()
+{
+    // Checks are frequent -- and often in tight loops -- so they don't lock;
+    // the reasons are an atomic bitmask. Setting and clearing are rare, and
+    // take m_lock so that the events are updated consistently.
 }
 
 StopSignal::~StopSignal()
 {
-    CloseHandle(m_mutex);
-    m_mutex = 0;
+    if (m_parent)
+    {
+        AutoLock lock(m_parent->m_lock);
+        m_parent->m_children.erase(
+            std::remove(m_parent->m_children.begin(), m_parent->m_children.end(), this),
+            m_parent->m_children.end());
+    }
+
+    {
+        AutoLock lock(m_lock);
+
+        // In case we're the parent of a signal that outlives us (which is
+        // only likely as static objects are destroyed at exit)
+        for (vector<StopSignal*>::iterator it = m_children.begin(); it != m_children.end(); ++it)
+        {
+            (*it)->m_parent = NULL;
+        }
+        m_children.clear();
+
+        for (vector<pair<DWORD, HANDLE>>::iterator it = m_stopEvents.begin(); it != m_stopEvents.end(); ++it)
+        {
+            CloseHandle(it->second);
+        }
+        m_stopEvents.clear();
+    }
 }
 
 DWORD StopSignal::CheckSignal(DWORD reasons, bool throwIfTrue/*=false*/) const
 {
-    AutoMUTEX lock(m_mutex);
-    if (throwIfTrue && (reasons & m_stop))
+    DWORD matched = reasons & m_stop.load();
+    if (throwIfTrue && matched)
     {
-        ThrowSignalException(reasons & m_stop);
+        ThrowSignalException(matched);
     }
-    return (reasons & m_stop);
+    return matched;
 }
 
 void StopSignal::SignalStop(DWORD reason)
 {
-    AutoMUTEX lock(m_mutex);
-    m_stop = m_stop | reason;
+    m_stop.fetch_or(reason);
+    UpdateStopEvents();
 }
 
 void StopSignal::ClearStopSignal(DWORD reason)
 {
-    AutoMUTEX lock(m_mutex);
-    m_stop = m_stop & ~reason;
+    m_stop.fetch_and(~reason);
+    UpdateStopEvents();
+}
+
+DWORD StopSignal::GetEventReasons() const
+{
+    DWORD reasons = m_stop.load();
+    if (m_parent)
+    {
+        reasons |= m_parent->GetEventReasons() & m_parentReasons;
+    }
+    return reasons;
+}
+
+void StopSignal::UpdateStopEvents()
+{
+    AutoLock lock(m_lock);
+
+    // Computed under the lock, from the current reasons, so concurrent
+    // updates can't leave an event out of step.
+    DWORD current = GetEventReasons();
+
+    for (vector<pair<DWORD, HANDLE>>::iterator it = m_stopEvents.begin(); it != m_stopEvents.end(); ++it)
+    {
+        if (current & it->first)
+        {
+            SetEvent(it->second);
+        }
+        else
+        {
+            ResetEvent(it->second);
+        }
+    }
+
+    // Always locked parent first, then child
+    for (vector<StopSignal*>::iterator it = m_children.begin(); it != m_children.end(); ++it)
+    {
+        (*it)->UpdateStopEvents();
+    }
+}
+
+HANDLE StopSignal::GetStopEvent(DWORD reasons/*=STOP_REASON_ALL*/) const
+{
+    AutoLock lock(m_lock);
+
+    for (vector<pair<DWORD, HANDLE>>::const_iterator it = m_stopEvents.begin(); it != m_stopEvents.end(); ++it)
+    {
+        if (it->first == reasons)
+        {
+            return it->second;
+        }
+    }
+
+    HANDLE stopEvent = CreateEvent(
+                        NULL,
+                        TRUE,  // manual reset
+                        (GetEventReasons() & reasons) ? TRUE : FALSE,
+                        0);
+    if (!stopEvent)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateEvent failed (%d)"), __TFUNCTION__, GetLastError());
+        return NULL;
+    }
+
+    m_stopEvents.push_back(make_pair(reasons, stopEvent));
+    return stopEvent;
 }
 
 // static
@@ -114,6 +216,46 @@ void StopSignal::ThrowSignalException(DWORD reason)
 }
 
 
+/***********************************************************************
+ RaceStopSignal
+ */
+
+RaceStopSignal::RaceStopSignal(StopSignal* parentStopSignal)
+    : StopSignal(parentStopSignal, STOP_REASON_ALL),
+      m_parentStopSignal(parentStopSignal)
+{
+}
+
+DWORD RaceStopSignal::CheckSignal(DWORD reasons, bool throwIfTrue/*=false*/) const
+{
+    DWORD matched = StopSignal::CheckSignal(reasons)
+                    | m_parentStopSignal->CheckSignal(reasons);
+    if (throwIfTrue && matched)
+    {
+        ThrowSignalException(matched);
+    }
+    return matched;
+}
+
+void RaceStopSignal::SignalStop(DWORD reason)
+{
+    if (reason & STOP_REASON_CANCEL)
+    {
+        StopSignal::SignalStop(STOP_REASON_CANCEL);
+    }
+    if (reason & ~STOP_REASON_CANCEL)
+    {
+        m_parentStopSignal->SignalStop(reason & ~STOP_REASON_CANCEL);
+    }
+}
+
+void RaceStopSignal::ClearStopSignal(DWORD reason)
+{
+    StopSignal::ClearStopSignal(reason);
+    m_parentStopSignal->ClearStopSignal(reason);
+}
+
+
 /***********************************************************************
  GlobalStopSignal
  */
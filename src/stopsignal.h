@@ -19,6 +19,9 @@
 
 #pragma once
 
+#include <atomic>
+#include "utilities.h"
+
 //
 // Stop conditions
 //
@@ -94,14 +97,65 @@ public:
     // Removes `reason` from the set of currently set reasons.
     virtual void ClearStopSignal(DWORD reason);
 
+    // Returns a manual-reset event that is set while any of `reasons` is set
+    // -- including, for a signal with a parent, the parent's -- so that a
+    // stop can be waited for alongside other handles. The event is owned
+    // by the signal.
+    // Checking the signal after a wake is still required, and is cheap.
+    HANDLE GetStopEvent(DWORD reasons=STOP_REASON_ALL) const;
+
     static void ThrowSignalException(DWORD reason);
 
     StopSignal();
     virtual ~StopSignal();
 
+protected:
+    // For signals that combine their own reasons with a parent's. The stop
+    // events then also reflect the parent's `parentReasons`. Ownership of
+    // parent is *not* taken; it must outlive this signal.
+    StopSignal(StopSignal* parent, DWORD parentReasons);
+
+private:
+    void Init();
+    // Reasons the stop events reflect: ours plus the parent's.
+    DWORD GetEventReasons() const;
+    void UpdateStopEvents();
+
+    // not copyable
+    StopSignal(StopSignal const&);
+    StopSignal& operator=(StopSignal const&);
+
+private:
+    // The reasons are read without locking. The lock keeps the events (and
+    // the linked signals) consistent with them.
+    std::atomic<DWORD> m_stop;
+    Lock m_lock;
+    StopSignal* m_parent;
+    DWORD m_parentReasons;
+    vector<StopSignal*> m_children;
+    // Events by the reasons they're for. Created on demand; there are only
+    // ever a few distinct sets of reasons waited for.
+    mutable vector<pair<DWORD, HANDLE>> m_stopEvents;
+};
+
+/*
+Stop signal for one of several attempts racing each other (e.g., to connect,
+or to make a request). STOP_REASON_CANCEL is kept local, so that a losing
+attempt can be cancelled -- and an attempt can cancel itself -- without
+affecting the others. All other reasons go to the parent.
+*/
+class RaceStopSignal : public StopSignal
+{
+public:
+    // Note that ownership of parentStopSignal is *not* taken (won't be deleted)
+    RaceStopSignal(StopSignal* parentStopSignal);
+
+    virtual DWORD CheckSignal(DWORD reasons, bool throwIfTrue=false) const;
+    virtual void SignalStop(DWORD reason);
+    virtual void ClearStopSignal(DWORD reason);
+
 private:
-    HANDLE m_mutex;
-    DWORD m_stop;
+    StopSignal* m_parentStopSignal;
 };
 
 // Convenience struct for passing around a stop signal and set of reasons
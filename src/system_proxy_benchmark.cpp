@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "system_proxy_benchmark.h"
+#include "systemproxysettings.h"
+#include "ras_inventory.h"
+#include "startup_tasks.h"
+#include "logging.h"
+#include "utilities.h"
+#include <shlwapi.h>
+
+
+// Including the default connection, that's 1, 11, 51 and 201 connections
+static const size_t SYSTEM_PROXY_BENCHMARK_ENTRY_COUNTS[] = { 0, 10, 50, 200 };
+
+#define SYSTEM_PROXY_BENCHMARK_PHONEBOOK_NAME       _T("psiphon-proxy-benchmark.pbk")
+#define SYSTEM_PROXY_BENCHMARK_ENTRY_NAME_PREFIX    _T("Psiphon Proxy Benchmark ")
+// Nothing listens on it; the settings are only set and reverted.
+#define SYSTEM_PROXY_BENCHMARK_PROXY_PORT           58080
+// Where WinINet keeps each connection's proxy settings, by name
+#define SYSTEM_PROXY_BENCHMARK_CONNECTIONS_KEY      _T("Software\\Microsoft\\Windows\\CurrentVersion\\Internet Settings\\Connections")
+
+
+/***********************************************************************
+ Result
+ */
+
+Json::Value SystemProxyBenchmark::Result::ToJson() const
+{
+    size_t count = max(connections, (size_t)1);
+
+    Json::Value json;
+    json["connections"] = (Json::UInt)connections;
+    json["success"] = success;
+    json["applyMicroseconds"] = (Json::UInt64)applyMicroseconds;
+    json["revertMicroseconds"] = (Json::UInt64)revertMicroseconds;
+    json["startupMicroseconds"] = (Json::UInt64)startupMicroseconds;
+    json["startupRecoveryMicroseconds"] = (Json::UInt64)startupRecoveryMicroseconds;
+    json["perConnection"]["applyMicroseconds"] = (Json::UInt64)(applyMicroseconds / count);
+    json["perConnection"]["revertMicroseconds"] = (Json::UInt64)(revertMicroseconds / count);
+    json["perConnection"]["startupMicroseconds"] = (Json::UInt64)(startupMicroseconds / count);
+    json["perConnection"]["startupRecoveryMicroseconds"] = (Json::UInt64)(startupRecoveryMicroseconds / count);
+    return json;
+}
+
+
+/***********************************************************************
+ SystemProxyBenchmark
+ */
+
+static tstring EntryName(size_t index)
+{
+    tstringstream name;
+    name << SYSTEM_PROXY_BENCHMARK_ENTRY_NAME_PREFIX << index + 1;
+    return name.str();
+}
+
+// A VPN entry that's never dialed
+static bool AddEntry(const tstring& phonebookPath, const tstring& entryName)
+{
+    RASENTRY rasEntry;
+    memset(&rasEntry, 0, sizeof(rasEntry));
+    rasEntry.dwSize = sizeof(rasEntry);
+    rasEntry.dwVpnStrategy = VS_PptpOnly;
+    rasEntry.dwfNetProtocols = RASNP_Ip;
+    rasEntry.dwFramingProtocol = RASFP_Ppp;
+    if (wcscpy_s(rasEntry.szLocalPhoneNumber, _T("127.0.0.1")) ||
+        wcscpy_s(rasEntry.szDeviceType, RASDT_Vpn))
+    {
+        return false;
+    }
+
+    DWORD returnCode = RasSetEntryProperties(phonebookPath.c_str(), entryName.c_str(), &rasEntry, sizeof(rasEntry), 0, 0);
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: RasSetEntryProperties failed (%d)"), __TFUNCTION__, returnCode);
+        return false;
+    }
+    return true;
+}
+
+// Deletes the first entryCount entries, with the proxy settings Apply gave
+// them, and the phonebook.
+static void DeletePhonebook(const tstring& phonebookPath, size_t entryCount)
+{
+    RasInventory::SetPhonebook(_T(""));
+
+    for (size_t i = 0; i < entryCount; i++)
+    {
+        tstring entryName = EntryName(i);
+        (void)RasDeleteEntry(phonebookPath.c_str(), entryName.c_str());
+        (void)SHDeleteValue(HKEY_CURRENT_USER, SYSTEM_PROXY_BENCHMARK_CONNECTIONS_KEY, entryName.c_str());
+    }
+
+    (void)DeleteFile(phonebookPath.c_str());
+}
+
+static void SetBenchmarkPorts(SystemProxySettings& settings)
+{
+    settings.SetHttpProxyPort(SYSTEM_PROXY_BENCHMARK_PROXY_PORT);
+    settings.SetHttpsProxyPort(SYSTEM_PROXY_BENCHMARK_PROXY_PORT);
+    settings.SetSocksProxyPort(SYSTEM_PROXY_BENCHMARK_PROXY_PORT + 1);
+}
+
+// The phonebook must hold connections - 1 entries.
+static SystemProxyBenchmark::Result MeasureConnections(size_t connections)
+{
+    SystemProxyBenchmark::Result result;
+    result.connections = connections;
+
+    // Records the native settings of the entries, as at startup
+    unsigned long long start = MonotonicMicroseconds();
+    DoStartupSystemProxyWork();
+    result.startupMicroseconds = MonotonicMicroseconds() - start;
+
+    SystemProxySettings settings;
+    SetBenchmarkPorts(settings);
+
+    start = MonotonicMicroseconds();
+    bool applied = settings.Apply(false);
+    result.applyMicroseconds = MonotonicMicroseconds() - start;
+
+    start = MonotonicMicroseconds();
+    bool reverted = settings.Revert();
+    result.revertMicroseconds = MonotonicMicroseconds() - start;
+
+    // Applied, and left as a crashed run leaves them, for the next startup
+    // to restore
+    SystemProxySettings crashed;
+    SetBenchmarkPorts(crashed);
+    bool crashedApplied = crashed.Apply(false);
+
+    start = MonotonicMicroseconds();
+    DoStartupSystemProxyWork();
+    result.startupRecoveryMicroseconds = MonotonicMicroseconds() - start;
+
+    // Already restored; this only clears its state.
+    (void)crashed.Revert();
+
+    result.success = applied && reverted && crashedApplied;
+    return result;
+}
+
+// static
+void SystemProxyBenchmark::Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult)
+{
+    // The startup task records the native settings that Revert restores.
+    StartupTasks::Wait(STARTUP_TASK_SYSTEM_PROXY);
+
+    TCHAR tempPath[MAX_PATH];
+    DWORD length = GetTempPath(MAX_PATH, tempPath);
+    if (length == 0 || length >= MAX_PATH)
+    {
+        throw std::exception("SystemProxyBenchmark: GetTempPath failed");
+    }
+    tstring phonebookPath = tstring(tempPath) + SYSTEM_PROXY_BENCHMARK_PHONEBOOK_NAME;
+
+    // Left by a run that didn't get to clean up
+    (void)DeleteFile(phonebookPath.c_str());
+
+    size_t entryCount = 0;
+    auto cleanup = finally([&phonebookPath, &entryCount]
+    {
+        DeletePhonebook(phonebookPath, entryCount);
+        // The native settings are those of the system's entries again.
+        DoStartupSystemProxyWork();
+    });
+
+    RasInventory::SetPhonebook(phonebookPath);
+
+    for (auto count : SYSTEM_PROXY_BENCHMARK_ENTRY_COUNTS)
+    {
+        stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+
+        for (; entryCount < count; entryCount++)
+        {
+            if (!AddEntry(phonebookPath, EntryName(entryCount)))
+            {
+                throw std::exception("SystemProxyBenchmark: failed to add a phonebook entry");
+            }
+        }
+        RasInventory::InvalidateEntries();
+
+        Result result = MeasureConnections(count + 1);
+
+        my_print(NOT_SENSITIVE, true, _T("%s: %d connections: apply %llu us, revert %llu us, startup %llu us, recovery %llu us"),
+            __TFUNCTION__, (int)result.connections, result.applyMicroseconds, result.revertMicroseconds,
+            result.startupMicroseconds, result.startupRecoveryMicroseconds);
+
+        onResult(result);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Times SystemProxySettings::Apply and Revert, and DoStartupSystemProxyWork,
+against growing numbers of RAS phonebook entries, for
+`--headless --system-proxy-benchmark` (see headless.h): their cost is per
+connection, and machines with many entries are slow in ways that can't be
+reproduced elsewhere.
+
+The entries are synthetic VPN entries in a private phonebook, which
+RasInventory enumerates in place of the system's for the run; the system's
+own entries are left alone. The default (LAN) connection is still set and
+reverted, as in any Apply. So this must only be run while there's no
+connection. Afterwards the entries' proxy settings and the phonebook are
+deleted, and the native proxy info is recorded again, as at startup.
+*/
+class SystemProxyBenchmark
+{
+public:
+    struct Result
+    {
+        // Including the default connection
+        size_t connections;
+        bool success;
+        unsigned long long applyMicroseconds;
+        unsigned long long revertMicroseconds;
+        // With nothing to restore, and restoring what a crashed run left
+        // applied
+        unsigned long long startupMicroseconds;
+        unsigned long long startupRecoveryMicroseconds;
+
+        Result()
+            : connections(0), success(false), applyMicroseconds(0), revertMicroseconds(0),
+              startupMicroseconds(0), startupRecoveryMicroseconds(0) {}
+
+        // With each time per connection too
+        Json::Value ToJson() const;
+    };
+
+    // Runs each number of entries in turn, calling onResult with each result
+    // as it's done. Throws the stop signal, and std::exception if the
+    // phonebook can't be made.
+    static void Run(const StopInfo& stopInfo, std::function<void(const Result&)> onResult);
+};
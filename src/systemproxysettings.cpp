@@ -18,6 +18,7 @@
  */
 
 #include "stdafx.h"
+#include <shlwapi.h>
 #include "systemproxysettings.h"
 #include "logging.h"
 #include "psiclient.h"
@@ -25,26 +26,57 @@
 #include "config.h"
 #include "ras.h"
 #include "raserror.h"
+#include "ras_inventory.h"
 #include "usersettings.h"
 #include "utilities.h"
+#include "vpntransport.h"
 
 
 static const TCHAR* DEFAULT_CONNECTION_NAME = _T("");
 static const TCHAR* SYSTEM_PROXY_SETTINGS_PROXY_BYPASS = _T("<local>");
-static const int INTERNET_OPTIONS_NUMBER = 3;
+static const int INTERNET_OPTIONS_NUMBER = 4;
+
+// Sent direct by the PAC script, in addition to <local>'s plain host names.
+// Only IP literals are matched against the ranges: isInNet on a name would
+// resolve it, outside the tunnel, for every request.
+static const char* PROXY_AUTO_CONFIG_DIRECT_SUFFIXES[] = {
+    ".local", ".localdomain", ".lan", ".home", ".home.arpa", ".corp", ".internal", ".intranet"
+};
+static const char* PROXY_AUTO_CONFIG_DIRECT_RANGES[][2] = {
+    { "127.0.0.0", "255.0.0.0" },
+    { "10.0.0.0", "255.0.0.0" },
+    { "172.16.0.0", "255.240.0.0" },
+    { "192.168.0.0", "255.255.0.0" },
+    { "169.254.0.0", "255.255.0.0" },
+    { "100.64.0.0", "255.192.0.0" }
+};
+
+// The proxy setting string of the settings left applied by
+// Revert(holdForReconnect), or empty.
+static Lock g_heldSettingsLock("SystemProxySettingsHeld");
+static tstring g_heldProxySettingString;
+
+// GetNativeDefaultProxyConfig's answer, and the stored native proxy info it
+// was derived from.
+static Lock g_nativeProxyConfigLock("NativeProxyConfig");
+static bool g_nativeProxyConfigCached = false;
+static string g_nativeProxyInfoString;
+static ProxyConfig g_nativeProxyConfig;
 
 bool GetCurrentSystemConnectionsProxyInfo(vector<ConnectionProxy>& o_proxyInfo);
 bool GetCurrentSystemConnectionProxy(tstring connectionName, ConnectionProxy& o_proxyInfo);
 bool SetCurrentSystemConnectionsProxy(const vector<ConnectionProxy>& connectionsProxies);
 void SetPsiphonProxyForConnections(vector<ConnectionProxy>& io_connectionsProxies,
-                                   const tstring& psiphonProxyAddress);
+                                   const tstring& psiphonProxyAddress,
+                                   const tstring& psiphonAutoConfigUrl);
 void ClearRegistryProxyInfo(const char* regKey);
 void ReadRegistryProxyInfo(const char* regKey, vector<ConnectionProxy>& o_proxyInfo);
 void WriteRegistryProxyInfo(const char* regKey, const vector<ConnectionProxy>& proxyInfo);
 
 
 SystemProxySettings::SystemProxySettings()
-    : m_settingsApplied(false)
+    : m_settingsApplied(false),
+      m_proxyInfoPrepared(false)
 {
     SetHttpProxyPort(0);
     SetHttpsProxyPort(0);
@@ -92,6 +124,14 @@ void SystemProxySettings::SetSocksProxyPort(int port)
     m_socksProxyPort = port;
 }
 
+void SystemProxySettings::Prepare()
+{
+    assert(!m_settingsApplied);
+
+    // If this fails, Apply will just try again.
+    m_proxyInfoPrepared = GetCurrentSystemConnectionsProxyInfo(m_preparedProxyInfo);
+}
+
 bool SystemProxySettings::Apply(bool allowedToSkipProxySettings)
 {
     // Configure Windows Internet Settings to use our HTTP Proxy
@@ -100,18 +140,50 @@ bool SystemProxySettings::Apply(bool allowedToSkipProxySettings)
     assert(!m_settingsApplied);
 
     tstring psiphonProxyAddress = MakeProxySettingString();
-    if(psiphonProxyAddress.length() == 0)
+    // A whole-system transport may have no local proxy (see
+    // LocalProxy::UseInterfaceStats). It still can't leave the original
+    // settings, whose proxy is (probably) unreachable, so connections are set
+    // direct instead.
+    if(psiphonProxyAddress.length() == 0 && allowedToSkipProxySettings)
     {
         return false;
     }
 
+    tstring psiphonAutoConfigUrl = MakeProxyAutoConfigUrl();
+
+    {
+        AutoLock lock(g_heldSettingsLock);
+
+        bool held = !g_heldProxySettingString.empty();
+        bool same = held && g_heldProxySettingString == psiphonProxyAddress + psiphonAutoConfigUrl;
+        g_heldProxySettingString.clear();
+
+        if (same && !(allowedToSkipProxySettings && Settings::SkipProxySettings()))
+        {
+            // Already in effect, and PSIPHON_PROXY_INFO still records them
+            my_print(NOT_SENSITIVE, true, _T("%s: keeping the held system proxy settings"), __TFUNCTION__);
+            m_preparedProxyInfo.clear();
+            m_proxyInfoPrepared = false;
+            m_settingsApplied = true;
+            return true;
+        }
+
+        // Otherwise they're simply set over, below; the native settings to
+        // revert to are unchanged.
+    }
+
     vector<ConnectionProxy> proxyInfo;
-    if (!GetCurrentSystemConnectionsProxyInfo(proxyInfo))
+    if (m_proxyInfoPrepared)
+    {
+        proxyInfo.swap(m_preparedProxyInfo);
+        m_proxyInfoPrepared = false;
+    }
+    else if (!GetCurrentSystemConnectionsProxyInfo(proxyInfo))
     {
         return false;
     }
 
-    SetPsiphonProxyForConnections(proxyInfo, psiphonProxyAddress);
+    SetPsiphonProxyForConnections(proxyInfo, psiphonProxyAddress, psiphonAutoConfigUrl);
     WriteRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO, proxyInfo);
 
     if (allowedToSkipProxySettings && Settings::SkipProxySettings())
@@ -158,13 +230,97 @@ tstring SystemProxySettings::MakeProxySettingString() const
     return proxySetting.str();
 }
 
-bool SystemProxySettings::Revert()
+tstring SystemProxySettings::MakeProxyAutoConfigUrl() const
+{
+    if (!Settings::ProxyAutoConfig())
+    {
+        return tstring();
+    }
+
+    // Everything else goes through the local proxies, as with the fixed
+    // setting; SOCKS is the fallback, or the only one if there's no HTTP proxy.
+    ostringstream proxies;
+    if (m_httpProxyPort > 0)
+    {
+        proxies << "PROXY 127.0.0.1:" << m_httpProxyPort;
+    }
+    if (m_socksProxyPort > 0)
+    {
+        if (proxies.str().length() > 0) proxies << "; ";
+        proxies << "SOCKS 127.0.0.1:" << m_socksProxyPort;
+    }
+    if (proxies.str().empty())
+    {
+        return tstring();
+    }
+
+    ostringstream script;
+    script << "function FindProxyForURL(url, host) {\n"
+           << "  if (isPlainHostName(host) || host == \"localhost\"";
+    for (size_t i = 0; i < _countof(PROXY_AUTO_CONFIG_DIRECT_SUFFIXES); i++)
+    {
+        script << "\n      || dnsDomainIs(host, \"" << PROXY_AUTO_CONFIG_DIRECT_SUFFIXES[i] << "\")";
+    }
+    script << ") {\n"
+           << "    return \"DIRECT\";\n"
+           << "  }\n"
+           << "  if (/^\\d+\\.\\d+\\.\\d+\\.\\d+$/.test(host) && (false";
+    for (size_t i = 0; i < _countof(PROXY_AUTO_CONFIG_DIRECT_RANGES); i++)
+    {
+        script << "\n      || isInNet(host, \"" << PROXY_AUTO_CONFIG_DIRECT_RANGES[i][0]
+               << "\", \"" << PROXY_AUTO_CONFIG_DIRECT_RANGES[i][1] << "\")";
+    }
+    script << ")) {\n"
+           << "    return \"DIRECT\";\n"
+           << "  }\n"
+           << "  return \"" << proxies.str() << "\";\n"
+           << "}\n";
+
+    tstring dataDirectory;
+    if (!GetDataPath({ LOCAL_SETTINGS_APPDATA_SUBDIRECTORY }, true, dataDirectory))
+    {
+        return tstring();
+    }
+    tstring scriptPath = (filesystem::path(dataDirectory) / LOCAL_SETTINGS_APPDATA_PROXY_AUTO_CONFIG_FILENAME).wstring();
+
+    // Usually unchanged since the last connect
+    if (!WriteFileIfChanged(scriptPath, script.str()))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: write PAC file failed (%d)"), __TFUNCTION__, GetLastError());
+        return tstring();
+    }
+
+    TCHAR url[INTERNET_MAX_URL_LENGTH];
+    DWORD urlLength = _countof(url);
+    if (S_OK != UrlCreateFromPath(scriptPath.c_str(), url, &urlLength, NULL))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: UrlCreateFromPath failed"), __TFUNCTION__);
+        return tstring();
+    }
+
+    return url;
+}
+
+bool SystemProxySettings::Revert(bool holdForReconnect/*=false*/)
 {
     // Revert Windows Internet Settings back to user's original configuration
 
     if (!m_settingsApplied)
     {
-        ClearRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO);
+        AutoLock lock(g_heldSettingsLock);
+        // Held settings still need PSIPHON_PROXY_INFO for crash recovery.
+        if (g_heldProxySettingString.empty())
+        {
+            ClearRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO);
+        }
+        return true;
+    }
+
+    if (holdForReconnect)
+    {
+        AutoLock lock(g_heldSettingsLock);
+        g_heldProxySettingString = MakeProxySettingString() + MakeProxyAutoConfigUrl();
+        m_settingsApplied = false;
         return true;
     }
 
@@ -190,126 +346,101 @@ bool SystemProxySettings::IsApplied() const
     return m_settingsApplied;
 }
 
-
-/**********************************************************
-*
-* Proxy settings helpers
-*
-
-Terminology:
-    native: the system proxy settings before Psiphon runs
-    default: the default connection (there might be a lot of system connections with different proxies)
-
-**********************************************************/
-
-static DWORD GetRasEntries(LPRASENTRYNAME& rasEntryNames, DWORD& bufferSize, DWORD& entries)
+// static
+bool SystemProxySettings::RevertHeld()
 {
-    if (rasEntryNames)
+    AutoLock lock(g_heldSettingsLock);
+
+    if (g_heldProxySettingString.empty())
     {
-        // Deallocate memory for the entries buffer
-        HeapFree(GetProcessHeap(), 0, rasEntryNames);
-        rasEntryNames = 0;
+        return true;
     }
 
-    rasEntryNames = (LPRASENTRYNAME)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, bufferSize);
+    vector<ConnectionProxy> originalProxySettings;
+    ReadRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_NATIVE_PROXY_INFO, originalProxySettings);
 
-    if (!rasEntryNames)
+    if (!SetCurrentSystemConnectionsProxy(originalProxySettings))
     {
-        my_print(NOT_SENSITIVE, false, _T("HeapAlloc failed when trying to enumerate RAS connections"));
-        throw 0;
+        // Still held, as far as the next Apply is concerned
+        return false;
     }
 
-    // The first RASENTRYNAME structure in the array must contain the structure size
-    rasEntryNames[0].dwSize = sizeof(RASENTRYNAME);
+    g_heldProxySettingString.clear();
+    ClearRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO);
 
-    // Call RasEnumEntries to enumerate all RAS entry names
-    return RasEnumEntries(0, 0, rasEntryNames, &bufferSize, &entries);
+    return true;
 }
 
-
-vector<tstring> GetRasConnectionNames()
+// static
+bool SystemProxySettings::RevertForShutdown()
 {
-    vector<tstring> connections;
-    LPRASENTRYNAME rasEntryNames = 0;
-    // The RasEnumEntries API requires that we pass in a buffer first
-    // and if the buffer is too small, it tells us how big a buffer it needs.
-    // For the first call we will pass in a single RASENTRYNAME struct.
-    DWORD bufferSize = sizeof(RASENTRYNAME);
-    DWORD entries = 0;
-    DWORD returnCode = ERROR_SUCCESS;
-
-    try
+    vector<ConnectionProxy> psiphonProxyInfo;
+    ReadRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_PSIPHON_PROXY_INFO, psiphonProxyInfo);
+    if (psiphonProxyInfo.empty())
     {
-        returnCode = GetRasEntries(rasEntryNames, bufferSize, entries);
-
-        if (ERROR_BUFFER_TOO_SMALL == returnCode)
-        {
-            returnCode = GetRasEntries(rasEntryNames, bufferSize, entries);
-        }
+        return true;
+    }
 
-        if (ERROR_SUCCESS != returnCode)
-        {
-            my_print(NOT_SENSITIVE, false, _T("failed to enumerate RAS connections (%d)"), returnCode);
-            throw 0;
-        }
+    vector<ConnectionProxy> originalProxySettings;
+    ReadRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_NATIVE_PROXY_INFO, originalProxySettings);
 
-        for (DWORD i = 0; i < entries; i++)
-        {
-            connections.push_back(rasEntryNames[i].szEntryName);
-        }
-    }
-    catch (...)
-    {
-    }
-    // TODO: Don't throw 0.  Throw and catch a std::exception.
-    // Maybe put the error message in the exception.
+    return SetCurrentSystemConnectionsProxy(originalProxySettings);
+}
 
-    // Clean up
 
-    if (rasEntryNames)
-    {
-        //Deallocate memory for the entries buffer
-        HeapFree(GetProcessHeap(), 0, rasEntryNames);
-        rasEntryNames = 0;
-    }
+/**********************************************************
+*
+* Proxy settings helpers
+*
 
-    return connections;
-}
+Terminology:
+    native: the system proxy settings before Psiphon runs
+    default: the default connection (there might be a lot of system connections with different proxies)
 
+**********************************************************/
 
-bool SetCurrentSystemConnectionProxy(const ConnectionProxy& setting)
+// The options for one connection, ready to pass to InternetSetOption. Refers
+// to the ConnectionProxy's strings, which must outlive it.
+struct ConnectionProxyOptions
 {
     INTERNET_PER_CONN_OPTION_LIST list;
     INTERNET_PER_CONN_OPTION options[INTERNET_OPTIONS_NUMBER];
-    list.dwSize = sizeof(list);
-    // Pointer to a string that contains the name of the RAS connection
-    // or NULL, which indicates the default or LAN connection, to set or query options on.
-    list.pszConnection = setting.name.length() ? const_cast<TCHAR*>(setting.name.c_str()) : 0;
-    list.dwOptionCount = sizeof(options)/sizeof(INTERNET_PER_CONN_OPTION);
-    list.pOptions = options;
 
-    list.pOptions[0].dwOption = INTERNET_PER_CONN_FLAGS;
-    list.pOptions[0].Value.dwValue = setting.flags;
+    ConnectionProxyOptions(const ConnectionProxy& setting)
+    {
+        list.dwSize = sizeof(list);
+        // Pointer to a string that contains the name of the RAS connection
+        // or NULL, which indicates the default or LAN connection, to set or query options on.
+        list.pszConnection = setting.name.length() ? const_cast<TCHAR*>(setting.name.c_str()) : 0;
+        list.dwOptionCount = sizeof(options)/sizeof(INTERNET_PER_CONN_OPTION);
+        list.pOptions = options;
 
-    list.pOptions[1].dwOption = INTERNET_PER_CONN_PROXY_SERVER;
-    list.pOptions[1].Value.pszValue = const_cast<TCHAR*>(setting.proxy.c_str());
+        options[0].dwOption = INTERNET_PER_CONN_FLAGS;
+        options[0].Value.dwValue = setting.flags;
 
-    list.pOptions[2].dwOption = INTERNET_PER_CONN_PROXY_BYPASS;
-    list.pOptions[2].Value.pszValue = const_cast<TCHAR*>(setting.bypass.c_str());
+        options[1].dwOption = INTERNET_PER_CONN_PROXY_SERVER;
+        options[1].Value.pszValue = const_cast<TCHAR*>(setting.proxy.c_str());
 
-    bool success = (0 != InternetSetOption(0, INTERNET_OPTION_PER_CONNECTION_OPTION, &list, list.dwSize)) &&
-                   (0 != InternetSetOption(NULL, INTERNET_OPTION_SETTINGS_CHANGED, NULL, 0)) &&
-                   (0 != InternetSetOption(NULL, INTERNET_OPTION_REFRESH , NULL, 0));
+        options[2].dwOption = INTERNET_PER_CONN_PROXY_BYPASS;
+        options[2].Value.pszValue = const_cast<TCHAR*>(setting.bypass.c_str());
 
-    if (!success)
-    {
-        my_print(NOT_SENSITIVE, false, _T("InternetSetOption error: %d"), GetLastError());
-        // NOTE: We are calling the Unicode version of InternetSetOption.
-        // In Microsoft Internet Explorer 5, only the ANSI versions of InternetQueryOption and InternetSetOption
-        // will work with the INTERNET_PER_CONN_OPTION_LIST structure.
+        options[3].dwOption = INTERNET_PER_CONN_AUTOCONFIG_URL;
+        options[3].Value.pszValue = const_cast<TCHAR*>(setting.autoConfigUrl.c_str());
     }
 
-    return success;
+private:
+    // Not copyable: list points into options
+    ConnectionProxyOptions(const ConnectionProxyOptions&);
+    ConnectionProxyOptions& operator=(const ConnectionProxyOptions&);
+};
+
+// InternetSetOption for all of WinINet (no session handle), counted in the
+// I/O stats
+static BOOL SetInternetOption(DWORD option, LPVOID buffer, DWORD length)
+{
+    IoStatsScope ioStats(IO_STATS_WININET_OPTION);
+    ioStats.AddBytes(length);
+    return InternetSetOption(NULL, option, buffer, length);
 }
 
 
@@ -317,18 +448,57 @@ bool SetCurrentSystemConnectionsProxy(const vector<ConnectionProxy>& connections
 {
     bool success = true;
 
+    // The cost grows with the number of connections, and varies a lot between
+    // machines (see SystemProxyBenchmark); the breakdown is logged.
+    DWORD startTime = GetTickCount();
+
+    // Build all the option lists first, so the commits below are back to back.
+    vector<unique_ptr<ConnectionProxyOptions>> optionLists;
+    optionLists.reserve(connectionsProxies.size());
     for (vector<ConnectionProxy>::const_iterator ii = connectionsProxies.begin();
          ii != connectionsProxies.end();
          ++ii)
     {
-        if (!SetCurrentSystemConnectionProxy(*ii))
+        optionLists.push_back(unique_ptr<ConnectionProxyOptions>(new ConnectionProxyOptions(*ii)));
+    }
+
+    size_t committed = 0;
+    for (; committed < optionLists.size(); committed++)
+    {
+        INTERNET_PER_CONN_OPTION_LIST& list = optionLists[committed]->list;
+        if (0 == SetInternetOption(INTERNET_OPTION_PER_CONNECTION_OPTION, &list, list.dwSize))
         {
+            my_print(NOT_SENSITIVE, false, _T("InternetSetOption error: %d"), GetLastError());
+            // NOTE: We are calling the Unicode version of InternetSetOption.
+            // In Microsoft Internet Explorer 5, only the ANSI versions of InternetQueryOption and InternetSetOption
+            // will work with the INTERNET_PER_CONN_OPTION_LIST structure.
             success = false;
             break;
         }
+    }
+
+    // One notification for the lot: every WinINet client reloads its settings
+    // on each one, which is what makes browsers stall.
+    if (committed > 0
+        && (0 == SetInternetOption(INTERNET_OPTION_SETTINGS_CHANGED, NULL, 0)
+            || 0 == SetInternetOption(INTERNET_OPTION_REFRESH, NULL, 0)))
+    {
+        my_print(NOT_SENSITIVE, false, _T("InternetSetOption error: %d"), GetLastError());
+        success = false;
+    }
 
+    DWORD setTime = GetTickCount();
+
+    if (!success)
+    {
+        return false;
+    }
 
-        // Read back the settings to verify that they have been applied
+    // Read back the settings to verify that they have been applied
+    for (vector<ConnectionProxy>::const_iterator ii = connectionsProxies.begin();
+         ii != connectionsProxies.end();
+         ++ii)
+    {
         ConnectionProxy entry;
         if (!GetCurrentSystemConnectionProxy(ii->name, entry) ||
             entry != *ii)
@@ -350,6 +520,12 @@ bool SetCurrentSystemConnectionsProxy(const vector<ConnectionProxy>& connections
         }
     }
 
+    size_t count = max(connectionsProxies.size(), (size_t)1);
+    DWORD now = GetTickCount();
+    my_print(NOT_SENSITIVE, true, _T("%s: %d connections; set %d ms, verified %d ms (%d us per connection)"),
+        __TFUNCTION__, (int)connectionsProxies.size(), setTime - startTime, now - setTime,
+        (int)((now - startTime) * 1000 / count));
+
     return success;
 }
 
@@ -371,8 +547,14 @@ bool GetCurrentSystemConnectionProxy(tstring connectionName, ConnectionProxy& o_
     options[0].dwOption = INTERNET_PER_CONN_FLAGS;
     options[1].dwOption = INTERNET_PER_CONN_PROXY_SERVER;
     options[2].dwOption = INTERNET_PER_CONN_PROXY_BYPASS;
+    options[3].dwOption = INTERNET_PER_CONN_AUTOCONFIG_URL;
 
-    if (0 == InternetQueryOption(0, INTERNET_OPTION_PER_CONNECTION_OPTION, &list, &length))
+    BOOL queried = FALSE;
+    {
+        IoStatsScope ioStats(IO_STATS_WININET_OPTION);
+        queried = InternetQueryOption(0, INTERNET_OPTION_PER_CONNECTION_OPTION, &list, &length);
+    }
+    if (!queried)
     {
         my_print(NOT_SENSITIVE, false, _T("InternetQueryOption error: %d"), GetLastError());
         // NOTE: We are calling the Unicode version of InternetQueryOption.
@@ -385,6 +567,7 @@ bool GetCurrentSystemConnectionProxy(tstring connectionName, ConnectionProxy& o_
     o_proxyInfo.flags = options[0].Value.dwValue;
     o_proxyInfo.proxy = options[1].Value.pszValue ? options[1].Value.pszValue : _T("");
     o_proxyInfo.bypass = options[2].Value.pszValue ? options[2].Value.pszValue : _T("");
+    o_proxyInfo.autoConfigUrl = options[3].Value.pszValue ? options[3].Value.pszValue : _T("");
 
     // Cleanup
     if (options[1].Value.pszValue)
@@ -395,6 +578,10 @@ bool GetCurrentSystemConnectionProxy(tstring connectionName, ConnectionProxy& o_
     {
         GlobalFree(options[2].Value.pszValue);
     }
+    if (options[3].Value.pszValue)
+    {
+        GlobalFree(options[3].Value.pszValue);
+    }
 
     return true;
 }
@@ -406,7 +593,7 @@ bool GetCurrentSystemConnectionsProxyInfo(vector<ConnectionProxy>& o_proxyInfo)
     vector<tstring> connections;
 
     // Get a list of connections, starting with the dial-up connections
-    connections = GetRasConnectionNames();
+    connections = RasInventory::GetEntryNames();
 
     // NULL indicates the default or LAN connection
     connections.push_back(DEFAULT_CONNECTION_NAME);
@@ -415,6 +602,13 @@ bool GetCurrentSystemConnectionsProxyInfo(vector<ConnectionProxy>& o_proxyInfo)
          ii != connections.end();
          ++ii)
     {
+        // Our VPN entry is kept between connections, but isn't used while
+        // the proxy settings are, and isn't the user's to restore.
+        if (*ii == VPN_CONNECTION_NAME)
+        {
+            continue;
+        }
+
         ConnectionProxy entry;
 
         if (GetCurrentSystemConnectionProxy(*ii, entry))
@@ -433,16 +627,33 @@ bool GetCurrentSystemConnectionsProxyInfo(vector<ConnectionProxy>& o_proxyInfo)
 
 
 void SetPsiphonProxyForConnections(vector<ConnectionProxy>& io_connectionsProxies,
-                                   const tstring& psiphonProxyAddress)
+                                   const tstring& psiphonProxyAddress,
+                                   const tstring& psiphonAutoConfigUrl)
 {
     for (vector<ConnectionProxy>::iterator ii = io_connectionsProxies.begin();
          ii != io_connectionsProxies.end();
          ++ii)
     {
-        // These are the new proxy settings we want to use
+        if (psiphonProxyAddress.empty())
+        {
+            ii->flags = PROXY_TYPE_DIRECT;
+            ii->proxy.clear();
+            ii->bypass.clear();
+            ii->autoConfigUrl.clear();
+            continue;
+        }
+
+        // These are the new proxy settings we want to use. With a PAC URL,
+        // the fixed proxy is still set: it's what's used if the script can't
+        // be loaded, and what GetTunneledDefaultProxyConfig reports.
         ii->flags = PROXY_TYPE_PROXY;
         ii->proxy = psiphonProxyAddress;
         ii->bypass = SYSTEM_PROXY_SETTINGS_PROXY_BYPASS;
+        ii->autoConfigUrl = psiphonAutoConfigUrl;
+        if (!psiphonAutoConfigUrl.empty())
+        {
+            ii->flags |= PROXY_TYPE_AUTO_PROXY_URL;
+        }
     }
 }
 
@@ -465,13 +676,35 @@ void GetDefaultProxyInfo(const vector<ConnectionProxy>& proxyInfos, ConnectionPr
 
 ProxyConfig GetNativeDefaultProxyConfig()
 {
+    // Asked for on every connect and by every request, but it only changes
+    // when the stored native proxy info does -- and reading that is cheap,
+    // as registry values are cached.
+    string proxyJsonString;
+    (void)ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_NATIVE_PROXY_INFO, proxyJsonString);
+
+    {
+        AutoLock lock(g_nativeProxyConfigLock);
+        if (g_nativeProxyConfigCached && proxyJsonString == g_nativeProxyInfoString)
+        {
+            return g_nativeProxyConfig;
+        }
+    }
+
+    // If the value changes in between, the next call won't match and will
+    // redo this.
     vector<ConnectionProxy> proxyInfo;
     ReadRegistryProxyInfo(LOCAL_SETTINGS_REGISTRY_VALUE_NATIVE_PROXY_INFO, proxyInfo);
 
     ConnectionProxy undecomposedProxyInfo;
     GetDefaultProxyInfo(proxyInfo, undecomposedProxyInfo);
 
-    return ProxyConfig::DecomposeProxyInfo(undecomposedProxyInfo);
+    ProxyConfig proxyConfig = ProxyConfig::DecomposeProxyInfo(undecomposedProxyInfo);
+
+    AutoLock lock(g_nativeProxyConfigLock);
+    g_nativeProxyInfoString = proxyJsonString;
+    g_nativeProxyConfig = proxyConfig;
+    g_nativeProxyConfigCached = true;
+    return proxyConfig;
 }
 
 ProxyConfig GetTunneledDefaultProxyConfig()
@@ -499,24 +732,25 @@ void GetSanitizedOriginalProxyInfo(vector<ConnectionProxy>& o_originalProxyInfo)
 
     // ASSUMPTION: Proxy entries will always have a port number.
     // There are a number of forms (of interest to us) that a proxy server entry can take:
+    // Compiling these is far more work than using them, so it's done once.
     // localhost or 127.0.0.1
-    tregex localhost_regex = tregex(
+    static const tregex localhost_regex = tregex(
                     _T("^([\\w]+=)?([a-z]+:\\/\\/)?(?:(?:localhost)|(?:127\\.0\\.0\\.1))(:[0-9]+)$"),
                     regex::ECMAScript | regex::icase);
     // IPv4 (Note: very rough, but probably good enough)
-    tregex ipv4_regex = tregex(
+    static const tregex ipv4_regex = tregex(
                     _T("^([\\w]+=)?([a-z]+:\\/\\/)?(?:\\d+\\.\\d+\\.\\d+\\.\\d+)(:[0-9]+)$"),
                     regex::ECMAScript | regex::icase);
     // IPv6 (Note: also very rough but probably good enough)
-    tregex ipv6_regex = tregex(
+    static const tregex ipv6_regex = tregex(
                     _T("^([\\w]+=)?([a-z]+:\\/\\/)?(?:\\[[a-fA-F0-9:]+\\])(:[0-9]+)$"),
                     regex::ECMAScript | regex::icase);
     // not-fully-qualified domain name
-    tregex nonfqdn_regex = tregex(
+    static const tregex nonfqdn_regex = tregex(
                     _T("^([\\w]+=)?([a-z]+:\\/\\/)?(?:[\\w\\-]+)(:[0-9]+)$"),
                     regex::ECMAScript | regex::icase);
     // fully qualified domain name
-    tregex fqdn_regex = tregex(
+    static const tregex fqdn_regex = tregex(
                     _T("^([\\w]+=)?([a-z]+:\\/\\/)?(?:[\\w\\-\\.]+)(:[0-9]+)$"),
                     regex::ECMAScript | regex::icase);
 
@@ -739,6 +973,7 @@ void ReadRegistryProxyInfo(const char* regKey, vector<ConnectionProxy>& o_proxyI
             proxy.flags = proxiesJson[i].get("flags", 0).asUInt();
             proxy.proxy = UTF8ToWString(proxiesJson[i].get("proxy", "").asString());
             proxy.bypass = UTF8ToWString(proxiesJson[i].get("bypass", "").asString());
+            proxy.autoConfigUrl = UTF8ToWString(proxiesJson[i].get("autoConfigUrl", "").asString());
             o_proxyInfo.push_back(proxy);
         }
     }
@@ -765,6 +1000,7 @@ void WriteRegistryProxyInfo(const char* regKey, const vector<ConnectionProxy>& p
         entry["flags"] = Json::UInt(ii->flags);
         entry["proxy"] = WStringToUTF8(ii->proxy);
         entry["bypass"] = WStringToUTF8(ii->bypass);
+        entry["autoConfigUrl"] = WStringToUTF8(ii->autoConfigUrl);
         proxies.append(entry);
     }
 
@@ -46,15 +46,44 @@ public:
 
     int GetHttpProxyPort() { return m_httpProxyPort; }
 
+    // Reads the current proxy settings of the system's connections ahead of
+    // Apply, which is the slow part of it. Optional, and may be called from a
+    // different thread than Apply -- but not concurrently with it. Don't call
+    // it if the set of connections may change before Apply (e.g., VPN).
+    void Prepare();
+
+    // If settings left applied by Revert(true) are the same as these, they're
+    // taken over rather than set again.
     bool Apply(bool allowedToSkipProxySettings);
-    bool Revert();
+    // With holdForReconnect, the settings are left applied -- each change is
+    // broadcast, and browsers drop their connections on it -- for the next
+    // Apply to take over. RevertHeld must then be called if there's no next
+    // connection. The crash recovery in DoStartupSystemProxyWork still
+    // covers held settings.
+    bool Revert(bool holdForReconnect=false);
     bool IsApplied() const;
 
+    // Reverts the settings held by Revert, if any. Threadsafe.
+    static bool RevertHeld();
+
+    // Restores the native settings right away, if ours are in effect, ahead
+    // of the orderly stop -- for when the process may not get to finish it
+    // (e.g., at logoff). PSIPHON_PROXY_INFO is left for the orderly Revert,
+    // or the next run's crash recovery, to clear.
+    static bool RevertForShutdown();
+
 private:
     tstring MakeProxySettingString() const;
+    // Writes the PAC script for Settings::ProxyAutoConfig and returns its
+    // URL. Empty if the setting is off or the script couldn't be written, in
+    // which case the fixed proxy setting is used alone.
+    tstring MakeProxyAutoConfigUrl() const;
 
     bool m_settingsApplied;
 
+    bool m_proxyInfoPrepared;
+    vector<ConnectionProxy> m_preparedProxyInfo;
+
     int m_httpProxyPort;
     int m_httpsProxyPort;
     int m_socksProxyPort;
@@ -68,6 +97,7 @@ struct ConnectionProxy
     tstring flagsString;
     tstring proxy;
     tstring bypass;
+    tstring autoConfigUrl; // used with PROXY_TYPE_AUTO_PROXY_URL
 
     ConnectionProxy() : flags(0) {}
 
@@ -77,7 +107,8 @@ struct ConnectionProxy
             this->name == rhs.name &&
             this->flags == rhs.flags &&
             this->proxy == rhs.proxy &&
-            this->bypass == rhs.bypass;
+            this->bypass == rhs.bypass &&
+            this->autoConfigUrl == rhs.autoConfigUrl;
     }
 
     bool operator!=(const ConnectionProxy& rhs)
@@ -92,6 +123,7 @@ struct ConnectionProxy
         this->flagsString.clear();
         this->proxy.clear();
         this->bypass.clear();
+        this->autoConfigUrl.clear();
     }
 };
 
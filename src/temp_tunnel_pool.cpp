@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "temp_tunnel_pool.h"
+#include "transport.h"
+#include "logging.h"
+#include "utilities.h"
+#include "timer_service.h"
+
+
+#define TEMP_TUNNEL_POOL_TTL_MS             30000
+#define TEMP_TUNNEL_POOL_MAX_ENTRIES        2
+#define TEMP_TUNNEL_POOL_CHECK_INTERVAL_MS  5000
+// While a tunnel for the key is lent out, a caller waits this long for it to
+// come back before connecting another: starting a core is most of the cost.
+#define TEMP_TUNNEL_POOL_SHARE_WAIT_MS      5000
+#define TEMP_TUNNEL_POOL_SHARE_POLL_MS      100
+
+
+/***********************************************************************
+ TempTunnelStopSignal
+ */
+
+TempTunnelStopSignal::TempTunnelStopSignal()
+    : StopSignal(&GlobalStopSignal::Instance(), STOP_REASON_EXIT)
+{
+}
+
+TempTunnelStopSignal::~TempTunnelStopSignal()
+{
+}
+
+DWORD TempTunnelStopSignal::CheckSignal(DWORD reasons, bool throwIfTrue/*=false*/) const
+{
+    DWORD matched = StopSignal::CheckSignal(reasons)
+                    | GlobalStopSignal::Instance().CheckSignal(reasons & STOP_REASON_EXIT);
+
+    {
+        // Checked far more often than the borrower changes
+        AutoSharedLock lock(m_borrowerLock);
+        if (m_borrower.stopSignal)
+        {
+            matched |= m_borrower.stopSignal->CheckSignal(reasons & m_borrower.stopReasons);
+        }
+    }
+
+    if (throwIfTrue && matched)
+    {
+        ThrowSignalException(matched);
+    }
+    return matched;
+}
+
+void TempTunnelStopSignal::SetBorrower(const StopInfo& stopInfo)
+{
+    AutoExclusiveLock lock(m_borrowerLock);
+    m_borrower = stopInfo;
+}
+
+
+/***********************************************************************
+ TempTunnel
+ */
+
+// Only idle tunnels are in the pool.
+static Lock g_tempTunnelPoolLock("TempTunnelPool");
+static vector<unique_ptr<TempTunnel>> g_tempTunnelPool;
+static TimerService::TimerID g_tempTunnelPoolTimer = 0;
+
+// Tunnels lent out (or connecting), by key. Guarded by g_tempTunnelPoolLock.
+static map<tstring, int> g_tempTunnelsLent;
+
+TempTunnel::~TempTunnel()
+{
+    SetLent(false);
+}
+
+void TempTunnel::SetLent(bool lent)
+{
+    if (lent == m_lent)
+    {
+        return;
+    }
+
+    AutoLock lock(g_tempTunnelPoolLock);
+    m_lent = lent;
+    if (lent)
+    {
+        g_tempTunnelsLent[key]++;
+    }
+    else if (--g_tempTunnelsLent[key] <= 0)
+    {
+        g_tempTunnelsLent.erase(key);
+    }
+}
+
+bool TempTunnel::IsAlive() const
+{
+    return transport->IsConnected(false)
+           && !stopSignal.CheckSignal(STOP_REASON_ALL);
+}
+
+
+/***********************************************************************
+ TempTunnelPool
+ */
+
+
+// static
+unique_ptr<TempTunnel> TempTunnelPool::Acquire(
+                            const tstring& key,
+                            shared_ptr<ITransport> transport,
+                            const ServerEntry& serverEntry,
+                            bool skipApplySystemProxySettings,
+                            const StopInfo& stopInfo)
+{
+    unique_ptr<TempTunnel> tunnel;
+    HANDLE stopEvent = stopInfo.stopSignal ? stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons) : NULL;
+    DWORD waitStart = GetTickCount();
+
+    // Tunnels applying the system proxy settings are never pooled, so there's
+    // none to reuse or wait for.
+    while (skipApplySystemProxySettings)
+    {
+        vector<unique_ptr<TempTunnel>> dead;
+        bool lentOut = false;
+
+        {
+            AutoLock lock(g_tempTunnelPoolLock);
+
+            for (auto it = g_tempTunnelPool.begin(); it != g_tempTunnelPool.end();)
+            {
+                if (!(*it)->IsAlive())
+                {
+                    dead.push_back(std::move(*it));
+                    it = g_tempTunnelPool.erase(it);
+                }
+                else if (!tunnel
+                         && (*it)->key == key
+                         && (*it)->skipApplySystemProxySettings == skipApplySystemProxySettings)
+                {
+                    tunnel = std::move(*it);
+                    it = g_tempTunnelPool.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            lentOut = g_tempTunnelsLent.find(key) != g_tempTunnelsLent.end();
+        }
+
+        // Tearing down can take a while, so it's done without the lock.
+        dead.clear();
+
+        if (tunnel)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: reusing temp tunnel"), __TFUNCTION__);
+            tunnel->SetLent(true);
+            tunnel->stopSignal.SetBorrower(stopInfo);
+            return tunnel;
+        }
+
+        // Someone else is using -- or still connecting -- one for the same
+        // key; it's likely back before a new one would be up.
+        if (!lentOut
+            || GetTickCount() - waitStart >= TEMP_TUNNEL_POOL_SHARE_WAIT_MS)
+        {
+            break;
+        }
+
+        if (stopEvent)
+        {
+            (void)WaitForSingleObject(stopEvent, TEMP_TUNNEL_POOL_SHARE_POLL_MS);
+            // Throws if signaled
+            stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons, true);
+        }
+        else
+        {
+            Sleep(TEMP_TUNNEL_POOL_SHARE_POLL_MS);
+        }
+    }
+
+    tunnel.reset(new TempTunnel());
+    tunnel->key = key;
+    tunnel->skipApplySystemProxySettings = skipApplySystemProxySettings;
+    tunnel->transport = transport;
+    tunnel->serverEntry = serverEntry;
+    if (skipApplySystemProxySettings)
+    {
+        tunnel->SetLent(true);
+    }
+    tunnel->stopSignal.SetBorrower(stopInfo);
+
+    // Throws on failure
+    tunnel->connection.Connect(
+        StopInfo(&tunnel->stopSignal, STOP_REASON_ALL),
+        tunnel->transport.get(),
+        NULL, // not receiving reconnection notifications
+        NULL, // not receiving upgrade paver calls
+        NULL, // not collecting stats
+        NULL, // not supplying authorizations
+        &tunnel->serverEntry,
+        skipApplySystemProxySettings);
+
+    return tunnel;
+}
+
+// static
+void TempTunnelPool::Release(unique_ptr<TempTunnel> tunnel)
+{
+    tunnel->stopSignal.SetBorrower(StopInfo());
+
+    // Torn down here, on the caller's thread, so that its system proxy
+    // settings are reverted before the caller goes on.
+    if (!tunnel->skipApplySystemProxySettings || !tunnel->IsAlive())
+    {
+        return;
+    }
+
+    tunnel->SetLent(false);
+
+    // Torn down after the lock is released, if set
+    unique_ptr<TempTunnel> evicted;
+
+    {
+        AutoLock lock(g_tempTunnelPoolLock);
+
+        if (g_tempTunnelPool.size() >= TEMP_TUNNEL_POOL_MAX_ENTRIES)
+        {
+            // Evict the oldest
+            evicted = std::move(g_tempTunnelPool.front());
+            g_tempTunnelPool.erase(g_tempTunnelPool.begin());
+        }
+
+        tunnel->lastUsedTime = GetTickCount();
+        g_tempTunnelPool.push_back(std::move(tunnel));
+
+        // The timer is left running for the life of the process; it's cheap
+        // when the pool is empty.
+        if (!g_tempTunnelPoolTimer)
+        {
+            g_tempTunnelPoolTimer = TimerService::Instance().Schedule(
+                                        TEMP_TUNNEL_POOL_CHECK_INTERVAL_MS,
+                                        TEMP_TUNNEL_POOL_CHECK_INTERVAL_MS,
+                                        ExpiryTimerCallback);
+            if (!g_tempTunnelPoolTimer)
+            {
+                // Tunnels will still be torn down by Flush.
+                my_print(NOT_SENSITIVE, true, _T("%s: TimerService::Schedule failed"), __TFUNCTION__);
+            }
+        }
+    }
+}
+
+// static
+void TempTunnelPool::Flush()
+{
+    vector<unique_ptr<TempTunnel>> flushed;
+
+    {
+        AutoLock lock(g_tempTunnelPoolLock);
+        flushed.swap(g_tempTunnelPool);
+    }
+
+    if (!flushed.empty())
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: tearing down %d temp tunnel(s)"), __TFUNCTION__, flushed.size());
+    }
+}
+
+// static
+void TempTunnelPool::ExpiryTimerCallback()
+{
+    vector<unique_ptr<TempTunnel>> expired;
+
+    {
+        AutoLock lock(g_tempTunnelPoolLock);
+
+        DWORD now = GetTickCount();
+        for (auto it = g_tempTunnelPool.begin(); it != g_tempTunnelPool.end();)
+        {
+            if (now - (*it)->lastUsedTime >= TEMP_TUNNEL_POOL_TTL_MS || !(*it)->IsAlive())
+            {
+                expired.push_back(std::move(*it));
+                it = g_tempTunnelPool.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include "stopsignal.h"
+#include "serverlist.h"
+#include "transport_connection.h"
+#include "utilities.h"
+
+
+class ITransport;
+
+
+/*
+Stop signal for a pooled temp tunnel. The tunnel outlives any one request, so
+it can't use the requester's stop signal directly: that's only consulted
+while the tunnel is lent out (see SetBorrower). Otherwise only the app
+exiting -- or the tunnel failing, which is kept local -- stops it.
+The stop events cover the app exiting and local stops; a borrower's stop
+is noticed on the next periodic check.
+*/
+class TempTunnelStopSignal : public StopSignal
+{
+public:
+    TempTunnelStopSignal();
+    virtual ~TempTunnelStopSignal();
+
+    virtual DWORD CheckSignal(DWORD reasons, bool throwIfTrue=false) const;
+
+    // Set while the tunnel is in use; stopInfo.stopSignal must outlive that.
+    // Pass StopInfo() when done.
+    void SetBorrower(const StopInfo& stopInfo);
+
+private:
+    SharedLock m_borrowerLock;
+    StopInfo m_borrower;
+};
+
+
+/*
+A temp tunnel: a TransportConnection made just to get requests through, when
+there's no connected transport.
+*/
+struct TempTunnel
+{
+    // Members are in dependency order; the connection is torn down first.
+    tstring key;
+    // Only tunnels that leave the system proxy settings alone are pooled.
+    bool skipApplySystemProxySettings;
+    shared_ptr<ITransport> transport;
+    ServerEntry serverEntry;
+    TempTunnelStopSignal stopSignal;
+    TransportConnection connection;
+    DWORD lastUsedTime;
+
+    TempTunnel() : skipApplySystemProxySettings(true), lastUsedTime(0), m_lent(false) {}
+    ~TempTunnel();
+
+    // True if the tunnel can still be used.
+    bool IsAlive() const;
+
+    // Counts the tunnel as lent out (or connecting) or not, so that callers
+    // wanting one for the same key wait for it rather than starting another.
+    void SetLent(bool lent);
+
+private:
+    bool m_lent;
+};
+
+
+/*
+Keeps temp tunnels running for a short while after use, keyed by what they
+connect to, so back-to-back requests (e.g., a failed-connect report followed
+by a feedback upload) don't each pay for a new one -- for the core transport,
+that's a process spawn and a fresh datastore.
+Only tunnels that skip applying the system proxy settings are pooled: one
+that applied them would leave the system pointed at it after its request,
+and reverting them when it's finally torn down could undo a later
+connection's. Others are connected afresh and torn down by Release.
+Threadsafe. A pooled tunnel is only ever used by one caller at a time.
+*/
+class TempTunnelPool
+{
+public:
+    // Returns a connected temp tunnel for key: a pooled one if there's a live
+    // one, otherwise a new one connected with transport (whose ownership is
+    // shared) to serverEntry. If one for key is lent out, it's waited for a
+    // little before a new one is connected. A tunnel that's to apply the
+    // system proxy settings is always new. The tunnel watches stopInfo until
+    // it's passed to Release.
+    // Throws whatever TransportConnection::Connect throws, and the stop
+    // signal.
+    static unique_ptr<TempTunnel> Acquire(
+                                    const tstring& key,
+                                    shared_ptr<ITransport> transport,
+                                    const ServerEntry& serverEntry,
+                                    bool skipApplySystemProxySettings,
+                                    const StopInfo& stopInfo);
+
+    // Returns a tunnel to the pool, if it's still alive and poolable;
+    // otherwise it's torn down before this returns. A tunnel that's not
+    // returned (e.g., after an exception) is simply torn down.
+    static void Release(unique_ptr<TempTunnel> tunnel);
+
+    // Tears down all idle tunnels. Must be done before the app exits.
+    static void Flush();
+
+private:
+    static void ExpiryTimerCallback();
+};
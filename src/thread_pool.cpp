@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "thread_pool.h"
+#include "logging.h"
+#include "utilities.h"
+
+
+// Enough for the most parallel work we do (e.g., racing server request
+// attempts inside a feedback upload) with room to spare.
+#define THREAD_POOL_MAX_WORKERS             64
+// Workers beyond the minimum exit after this long with nothing to do.
+#define THREAD_POOL_IDLE_TIMEOUT_MS         30000
+
+// The worker running on this thread, if it's a pool thread
+static thread_local void* t_currentWorker = NULL;
+
+// Vista+, so not in the headers when targeting XP
+#ifndef THREAD_MODE_BACKGROUND_BEGIN
+#define THREAD_MODE_BACKGROUND_BEGIN    0x00010000
+#define THREAD_MODE_BACKGROUND_END      0x00020000
+#endif
+
+// Windows 10 1709+ power throttling (EcoQoS), through SetThreadInformation
+// (Windows 8+); neither is in the XP headers, nor XP's kernel32.
+#define THREAD_INFORMATION_CLASS_POWER_THROTTLING   3 // ThreadPowerThrottling
+#define THREAD_POWER_THROTTLING_VERSION             1
+#define THREAD_POWER_THROTTLING_SPEED               0x1 // THREAD_POWER_THROTTLING_EXECUTION_SPEED
+
+struct ThreadPowerThrottlingState
+{
+    ULONG version;
+    ULONG controlMask;
+    ULONG stateMask;
+};
+
+typedef BOOL (WINAPI *SETTHREADINFORMATIONFN)(HANDLE, int, LPVOID, DWORD);
+
+// controlMask/stateMask as for THREAD_POWER_THROTTLING_STATE: both zero
+// hands the decision back to the system. Returns false if unsupported.
+static bool SetThreadPowerThrottling(HANDLE thread, ULONG controlMask, ULONG stateMask)
+{
+    static SETTHREADINFORMATIONFN s_pfnSetThreadInformation =
+        (SETTHREADINFORMATIONFN)GetSystemLibraryProc(_T("kernel32.dll"), "SetThreadInformation");
+    if (!s_pfnSetThreadInformation)
+    {
+        return false;
+    }
+
+    ThreadPowerThrottlingState state = { THREAD_POWER_THROTTLING_VERSION, controlMask, stateMask };
+    // Fails before 1709, which doesn't know the class
+    return !!s_pfnSetThreadInformation(thread, THREAD_INFORMATION_CLASS_POWER_THROTTLING, &state, sizeof(state));
+}
+
+
+/***********************************************************************
+ ThreadQoSScope
+ */
+
+ThreadQoSScope::ThreadQoSScope(ThreadQoS qos)
+    : m_thread(GetCurrentThread()),
+      m_priority(GetThreadPriority(GetCurrentThread())),
+      m_priorityChanged(false),
+      m_backgroundMode(false),
+      m_throttlingChanged(false)
+{
+    if (qos == THREAD_QOS_BACKGROUND)
+    {
+        // Background mode lowers the CPU priority too; where it's not
+        // available, that's done alone.
+        m_backgroundMode = !!SetThreadPriority(m_thread, THREAD_MODE_BACKGROUND_BEGIN);
+        if (!m_backgroundMode)
+        {
+            m_priorityChanged = !!SetThreadPriority(m_thread, THREAD_PRIORITY_LOWEST);
+        }
+        m_throttlingChanged = SetThreadPowerThrottling(m_thread, THREAD_POWER_THROTTLING_SPEED, THREAD_POWER_THROTTLING_SPEED);
+    }
+    else if (qos == THREAD_QOS_LATENCY_CRITICAL)
+    {
+        m_priorityChanged = !!SetThreadPriority(m_thread, THREAD_PRIORITY_ABOVE_NORMAL);
+        m_throttlingChanged = SetThreadPowerThrottling(m_thread, THREAD_POWER_THROTTLING_SPEED, 0);
+    }
+}
+
+ThreadQoSScope::~ThreadQoSScope()
+{
+    if (m_throttlingChanged)
+    {
+        (void)SetThreadPowerThrottling(m_thread, 0, 0);
+    }
+    if (m_backgroundMode)
+    {
+        (void)SetThreadPriority(m_thread, THREAD_MODE_BACKGROUND_END);
+    }
+    if (m_priorityChanged)
+    {
+        (void)SetThreadPriority(m_thread, m_priority);
+    }
+}
+
+
+/***********************************************************************
+ ThreadPool
+ */
+
+
+// static
+ThreadPool& ThreadPool::Instance()
+{
+    // Deliberately never destroyed: tasks may still be running as the process
+    // exits, and workers are simply terminated with it.
+    static ThreadPool* instance = new ThreadPool();
+    return *instance;
+}
+
+ThreadPool::ThreadPool()
+    : m_queuedCount(0), m_idleCount(0), m_activeCount(0)
+{
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    m_minWorkers = max((size_t)systemInfo.dwNumberOfProcessors, (size_t)2);
+    m_minWorkers = min(m_minWorkers, (size_t)THREAD_POOL_MAX_WORKERS);
+
+    m_workers.reset(new Worker[THREAD_POOL_MAX_WORKERS]);
+    for (size_t i = 0; i < THREAD_POOL_MAX_WORKERS; i++)
+    {
+        m_workers[i].index = i;
+        m_workers[i].pool = this;
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+}
+
+HANDLE ThreadPool::Run(LPTHREAD_START_ROUTINE function, void* param, const StopInfo& stopInfo/*=StopInfo()*/)
+{
+    Task task;
+    task.function = [function, param]() { (void)function(param); };
+    task.stopInfo = stopInfo;
+
+    task.doneEvent = CreateEvent(
+                        NULL,
+                        TRUE,  // manual reset
+                        FALSE, // initial state
+                        0);
+    if (!task.doneEvent)
+    {
+        return NULL;
+    }
+
+    // One handle for the pool to set, one for the caller to wait on
+    HANDLE callerEvent = NULL;
+    if (!DuplicateHandle(
+            GetCurrentProcess(), task.doneEvent,
+            GetCurrentProcess(), &callerEvent,
+            0, FALSE, DUPLICATE_SAME_ACCESS))
+    {
+        CloseHandle(task.doneEvent);
+        return NULL;
+    }
+
+    HANDLE doneEvent = task.doneEvent;
+    if (!Submit(std::move(task)))
+    {
+        CloseHandle(doneEvent);
+        CloseHandle(callerEvent);
+        return NULL;
+    }
+
+    return callerEvent;
+}
+
+bool ThreadPool::Post(std::function<void()>&& function)
+{
+    Task task;
+    task.function = std::move(function);
+    task.doneEvent = NULL;
+    return Submit(std::move(task));
+}
+
+bool ThreadPool::Submit(Task&& task)
+{
+    // Make sure there'll be someone to run it before queuing it.
+    {
+        std::lock_guard<std::mutex> lock(m_idleLock);
+
+        if (m_idleCount == 0
+            && m_activeCount < THREAD_POOL_MAX_WORKERS
+            && !StartWorker()
+            && m_activeCount == 0)
+        {
+            return false;
+        }
+    }
+
+    Worker* self = (Worker*)t_currentWorker;
+
+    if (self && self->pool == this)
+    {
+        std::lock_guard<std::mutex> lock(self->lock);
+        self->tasks.push_back(std::move(task));
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_injectLock);
+        m_injected.push_back(std::move(task));
+    }
+
+    // If no one is idle, the task is picked up as a busy worker finishes.
+    std::lock_guard<std::mutex> lock(m_idleLock);
+    m_queuedCount++;
+    if (m_idleCount > 0)
+    {
+        m_workAvailable.notify_one();
+    }
+
+    return true;
+}
+
+bool ThreadPool::StartWorker()
+{
+    for (size_t i = 0; i < THREAD_POOL_MAX_WORKERS; i++)
+    {
+        Worker& worker = m_workers[i];
+        if (worker.active)
+        {
+            continue;
+        }
+
+        HANDLE thread = CreateThread(0, 0, WorkerThread, &worker, 0, 0);
+        if (!thread)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: CreateThread failed (%d)"), __TFUNCTION__, GetLastError());
+            return false;
+        }
+        CloseHandle(thread);
+
+        worker.active = true;
+        m_activeCount++;
+        return true;
+    }
+
+    return false;
+}
+
+bool ThreadPool::TakeTask(Worker& self, Task& o_task)
+{
+    bool taken = false;
+
+    // Our own newest first: it's likely what we were just working on needs.
+    {
+        std::lock_guard<std::mutex> lock(self.lock);
+        if (!self.tasks.empty())
+        {
+            o_task = std::move(self.tasks.back());
+            self.tasks.pop_back();
+            taken = true;
+        }
+    }
+
+    if (!taken)
+    {
+        std::lock_guard<std::mutex> lock(m_injectLock);
+        if (!m_injected.empty())
+        {
+            o_task = std::move(m_injected.front());
+            m_injected.pop_front();
+            taken = true;
+        }
+    }
+
+    // Then steal the oldest from someone else, starting after ourselves so
+    // that thieves spread out.
+    for (size_t i = 1; !taken && i < THREAD_POOL_MAX_WORKERS; i++)
+    {
+        Worker& victim = m_workers[(self.index + i) % THREAD_POOL_MAX_WORKERS];
+        std::lock_guard<std::mutex> lock(victim.lock);
+        if (!victim.tasks.empty())
+        {
+            o_task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            taken = true;
+        }
+    }
+
+    if (taken)
+    {
+        std::lock_guard<std::mutex> lock(m_idleLock);
+        m_queuedCount--;
+    }
+
+    return taken;
+}
+
+void ThreadPool::RunTask(Task& task)
+{
+    if (!task.stopInfo.stopSignal
+        || !task.stopInfo.stopSignal->CheckSignal(task.stopInfo.stopReasons))
+    {
+        try
+        {
+            task.function();
+        }
+        catch (std::exception& ex)
+        {
+            // Thread functions handle their own errors; this is just so a
+            // stray exception can't leave a waiter hanging on doneEvent.
+            my_print(NOT_SENSITIVE, false, string("Pool task failed: ") + ex.what());
+        }
+    }
+
+    if (task.doneEvent)
+    {
+        SetEvent(task.doneEvent);
+        CloseHandle(task.doneEvent);
+    }
+}
+
+void ThreadPool::WorkerLoop(Worker& self)
+{
+    while (true)
+    {
+        Task task;
+        if (TakeTask(self, task))
+        {
+            RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_idleLock);
+
+        // A task may have been queued since we looked.
+        if (m_queuedCount > 0)
+        {
+            continue;
+        }
+
+        m_idleCount++;
+        bool woken = m_workAvailable.wait_for(
+                        lock,
+                        std::chrono::milliseconds(THREAD_POOL_IDLE_TIMEOUT_MS),
+                        [this] { return m_queuedCount > 0; });
+        m_idleCount--;
+
+        // Our own deque is empty -- only we add to it -- so nothing is
+        // stranded when we go.
+        if (!woken && m_activeCount > m_minWorkers)
+        {
+            self.active = false;
+            m_activeCount--;
+            return;
+        }
+    }
+}
+
+// static
+DWORD WINAPI ThreadPool::WorkerThread(void* object)
+{
+    Worker* worker = (Worker*)object;
+    t_currentWorker = worker;
+    worker->pool->WorkerLoop(*worker);
+    return 0;
+}
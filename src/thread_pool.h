@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include "stopsignal.h"
+
+
+/*
+How much a thread's work matters to the user right now. See ThreadQoSScope.
+*/
+enum ThreadQoS
+{
+    // Left as the system has it
+    THREAD_QOS_DEFAULT,
+    // Maintenance nothing is waiting on (probing, diagnostics, list parsing):
+    // lowest CPU priority, background I/O priority (Vista+), and EcoQoS --
+    // power throttled, which favours efficiency cores -- where the system
+    // has it (Windows 10 1709+).
+    THREAD_QOS_BACKGROUND,
+    // Work the tunnel or the UI waits on (e.g., reading the core's notices):
+    // above normal CPU priority, and never power throttled.
+    THREAD_QOS_LATENCY_CRITICAL
+};
+
+/*
+Applies a ThreadQoS to the current thread for its lifetime, then puts the
+thread back as it was; pool threads are shared, so work that changes its
+thread's QoS must use one of these. Each part is best effort: what the
+system doesn't have is skipped.
+*/
+class ThreadQoSScope
+{
+public:
+    ThreadQoSScope(ThreadQoS qos);
+    ~ThreadQoSScope();
+
+private:
+    ThreadQoSScope(const ThreadQoSScope&);
+    ThreadQoSScope& operator=(const ThreadQoSScope&);
+
+    HANDLE m_thread;
+    int m_priority;
+    bool m_priorityChanged;
+    bool m_backgroundMode;
+    bool m_throttlingChanged;
+};
+
+
+/*
+Process-wide pool of threads for short-lived work, instead of a thread
+created (and its stack reserved) for each job.
+
+Each worker has its own task deque: work submitted from a pool thread goes
+on that thread's deque and is taken newest-first, while idle workers steal
+oldest-first from the others'. Work submitted from elsewhere goes on a
+shared queue.
+
+Tasks may block -- e.g., on a network request, or on other tasks they've
+submitted -- so when there's work waiting and no idle worker, another is
+started, up to a limit. Workers beyond one per core exit after idling
+for a while.
+
+Long-lived threads (the connection thread, IWorkerThreads, etc.) should keep
+their own threads: they'd hold a pool thread for the life of a connection.
+
+Threadsafe. The instance is never destroyed, so tasks are free to run while
+the process exits.
+*/
+class ThreadPool
+{
+public:
+    static ThreadPool& Instance();
+
+    // Runs the function on a pool thread, like CreateThread. Returns a
+    // manual-reset event that's set once the function has returned -- wait
+    // on it as on a thread handle; the caller must close it -- or NULL on
+    // failure. If stopInfo is signalled before the function starts, it's
+    // not run at all (the event is still set).
+    HANDLE Run(LPTHREAD_START_ROUTINE function, void* param, const StopInfo& stopInfo=StopInfo());
+
+    // Runs task on a pool thread. There's no completion event; the task must
+    // signal its own completion, if anyone cares. Returns false on failure.
+    bool Post(std::function<void()>&& task);
+
+private:
+    struct Task
+    {
+        std::function<void()> function;
+        StopInfo stopInfo;
+        HANDLE doneEvent; // May be NULL
+
+        Task() : doneEvent(NULL) {}
+    };
+
+    struct Worker
+    {
+        std::mutex lock;
+        std::deque<Task> tasks; // Only the worker's own thread adds to this
+        bool active;            // Guarded by m_idleLock
+        size_t index;
+        ThreadPool* pool;
+
+        Worker() : active(false), index(0), pool(NULL) {}
+    };
+
+    ThreadPool();
+    ~ThreadPool();
+
+    bool Submit(Task&& task);
+    bool TakeTask(Worker& self, Task& o_task);
+    void RunTask(Task& task);
+    void WorkerLoop(Worker& self);
+    static DWORD WINAPI WorkerThread(void* object);
+
+    // Must be called with m_idleLock held
+    bool StartWorker();
+
+private:
+    size_t m_minWorkers;
+    std::unique_ptr<Worker[]> m_workers;
+
+    std::mutex m_injectLock;
+    std::deque<Task> m_injected;
+
+    // Tasks queued anywhere. Changed with m_idleLock held, so that idle
+    // workers can't miss a wakeup.
+    std::mutex m_idleLock;
+    std::condition_variable m_workAvailable;
+    size_t m_queuedCount;
+    size_t m_idleCount;
+    size_t m_activeCount;
+};
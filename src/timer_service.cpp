@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "timer_service.h"
+#include "thread_pool.h"
+#include "logging.h"
+#include "utilities.h"
+
+
+// The timer whose task is running on this thread, if any; so it can cancel
+// itself without waiting for itself.
+static thread_local TimerService::TimerID t_currentTimer = 0;
+
+
+// static
+TimerService& TimerService::Instance()
+{
+    // Deliberately never destroyed: tasks may still be running as the process
+    // exits.
+    static TimerService* instance = new TimerService();
+    return *instance;
+}
+
+TimerService::TimerService()
+    : m_nextID(1), m_threadStarted(false)
+{
+}
+
+TimerService::~TimerService()
+{
+}
+
+TimerService::TimerID TimerService::Schedule(DWORD dueMilliseconds, DWORD periodMilliseconds, std::function<void()>&& task)
+{
+    std::shared_ptr<Timer> timer(new Timer());
+    timer->due = MonotonicMilliseconds() + dueMilliseconds;
+    timer->period = periodMilliseconds;
+    timer->task = std::move(task);
+    timer->running = false;
+    timer->cancelled = false;
+
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    if (!StartThread())
+    {
+        return 0;
+    }
+
+    timer->id = m_nextID++;
+    m_timers[timer->id] = timer;
+    m_deadlines.insert(std::make_pair(timer->due, timer->id));
+    m_changed.notify_all();
+
+    return timer->id;
+}
+
+void TimerService::Cancel(TimerID id)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    auto it = m_timers.find(id);
+    if (it == m_timers.end())
+    {
+        return;
+    }
+
+    std::shared_ptr<Timer> timer = it->second;
+    m_timers.erase(it);
+    timer->cancelled = true;
+    RemoveDeadline(*timer);
+
+    if (t_currentTimer != id)
+    {
+        m_changed.wait(lock, [&timer] { return !timer->running; });
+    }
+}
+
+void TimerService::RemoveDeadline(const Timer& timer)
+{
+    auto range = m_deadlines.equal_range(timer.due);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == timer.id)
+        {
+            m_deadlines.erase(it);
+            return;
+        }
+    }
+}
+
+void TimerService::RunTimer(std::shared_ptr<Timer> timer)
+{
+    t_currentTimer = timer->id;
+    try
+    {
+        timer->task();
+    }
+    catch (std::exception& ex)
+    {
+        // Tasks handle their own errors; this is just so a stray exception
+        // can't stop the timer for good.
+        my_print(NOT_SENSITIVE, false, string("Timer task failed: ") + ex.what());
+    }
+    t_currentTimer = 0;
+
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    timer->running = false;
+
+    if (timer->cancelled)
+    {
+        // Cancel is waiting for this
+    }
+    else if (timer->period == 0)
+    {
+        m_timers.erase(timer->id);
+    }
+    else
+    {
+        // Kept to the original schedule; whole periods that have gone by
+        // are skipped.
+        unsigned long long now = MonotonicMilliseconds();
+        timer->due += timer->period;
+        if (timer->due <= now)
+        {
+            timer->due += ((now - timer->due) / timer->period + 1) * timer->period;
+        }
+        m_deadlines.insert(std::make_pair(timer->due, timer->id));
+    }
+
+    m_changed.notify_all();
+}
+
+void TimerService::TimerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    while (true)
+    {
+        if (m_deadlines.empty())
+        {
+            m_changed.wait(lock);
+            continue;
+        }
+
+        auto next = m_deadlines.begin();
+        unsigned long long now = MonotonicMilliseconds();
+        if (next->first > now)
+        {
+            m_changed.wait_for(lock, std::chrono::milliseconds(next->first - now));
+            continue;
+        }
+
+        auto it = m_timers.find(next->second);
+        m_deadlines.erase(next);
+        if (it == m_timers.end())
+        {
+            continue;
+        }
+
+        std::shared_ptr<Timer> timer = it->second;
+        timer->running = true;
+
+        lock.unlock();
+        if (!ThreadPool::Instance().Post([this, timer]() { RunTimer(timer); }))
+        {
+            // Better late than never
+            RunTimer(timer);
+        }
+        lock.lock();
+    }
+}
+
+bool TimerService::StartThread()
+{
+    if (m_threadStarted)
+    {
+        return true;
+    }
+
+    HANDLE thread = CreateThread(0, 0, TimerThread, this, 0, 0);
+    if (!thread)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateThread failed (%d)"), __TFUNCTION__, GetLastError());
+        return false;
+    }
+    CloseHandle(thread);
+
+    m_threadStarted = true;
+    return true;
+}
+
+// static
+DWORD WINAPI TimerService::TimerThread(void* object)
+{
+    ((TimerService*)object)->TimerLoop();
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <map>
+#include <memory>
+
+
+/*
+The one timer for the app's timed work -- periodic tasks and deadlines --
+instead of a timer-queue timer (and its wakeups) per subsystem. A single
+thread sleeps until the earliest deadline, on the monotonic clock (see
+MonotonicMilliseconds), and hands the task to the thread pool, so a slow
+task doesn't hold up the others.
+
+A periodic task isn't run again until its previous run has returned; runs
+missed meanwhile are skipped rather than bunched up, and the schedule
+doesn't drift with how long each run takes.
+
+Threadsafe. The instance is never destroyed, like the thread pool's.
+*/
+class TimerService
+{
+public:
+    // Zero is never a valid ID
+    typedef unsigned long long TimerID;
+
+    static TimerService& Instance();
+
+    // Runs task after dueMilliseconds, then -- if periodMilliseconds isn't
+    // zero -- every periodMilliseconds. Returns 0 on failure.
+    TimerID Schedule(DWORD dueMilliseconds, DWORD periodMilliseconds, std::function<void()>&& task);
+
+    // The task isn't run again once this returns: a run in progress is
+    // waited for, unless it's the task itself cancelling. IDs that have
+    // finished or were never valid are ignored.
+    void Cancel(TimerID id);
+
+private:
+    struct Timer
+    {
+        TimerID id;
+        unsigned long long due;
+        DWORD period;
+        std::function<void()> task;
+        // Guarded by m_lock
+        bool running;
+        bool cancelled;
+    };
+
+    TimerService();
+    ~TimerService();
+
+    void RunTimer(std::shared_ptr<Timer> timer);
+    void TimerLoop();
+    static DWORD WINAPI TimerThread(void* object);
+
+    // Must be called with m_lock held
+    bool StartThread();
+    void RemoveDeadline(const Timer& timer);
+
+private:
+    std::mutex m_lock;
+    // A deadline was added, or a run finished
+    std::condition_variable m_changed;
+    std::map<TimerID, std::shared_ptr<Timer>> m_timers;
+    // Timers waiting to run, by when they're due
+    std::multimap<unsigned long long, TimerID> m_deadlines;
+    TimerID m_nextID;
+    bool m_threadStarted;
+};
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "tracing.h"
+#include "logging.h"
+
+
+// {D9FA9B26-C2A5-4E4F-B11E-2D42847711DE}
+static const GUID PSIPHON_TRACE_PROVIDER_GUID =
+    { 0xd9fa9b26, 0xc2a5, 0x4e4f, { 0xb1, 0x1e, 0x2d, 0x42, 0x84, 0x77, 0x11, 0xde } };
+
+// TRACE_LEVEL_INFORMATION
+#define TRACE_EVENT_LEVEL       4
+#define TRACE_EVENT_MAX_CHARS   512
+
+// The evntprov.h API is Vista+, so it's declared here and loaded at runtime.
+typedef ULONGLONG TRACE_REGHANDLE;
+typedef VOID (NTAPI *TRACE_ENABLECALLBACK)(
+                LPCGUID sourceId, ULONG isEnabled, UCHAR level,
+                ULONGLONG matchAnyKeyword, ULONGLONG matchAllKeyword,
+                PVOID filterData, PVOID callbackContext);
+typedef ULONG (WINAPI *EVENTREGISTER)(LPCGUID, TRACE_ENABLECALLBACK, PVOID, TRACE_REGHANDLE*);
+typedef ULONG (WINAPI *EVENTUNREGISTER)(TRACE_REGHANDLE);
+typedef ULONG (WINAPI *EVENTWRITESTRING)(TRACE_REGHANDLE, UCHAR, ULONGLONG, PCWSTR);
+
+volatile LONG g_traceEnabledKeywords = 0;
+
+static TRACE_REGHANDLE g_traceRegHandle = 0;
+static EVENTUNREGISTER g_eventUnregister = NULL;
+static EVENTWRITESTRING g_eventWriteString = NULL;
+
+
+// Called by ETW whenever a session enables or disables the provider.
+static VOID NTAPI TraceEnableCallback(
+                    LPCGUID /*sourceId*/, ULONG isEnabled, UCHAR level,
+                    ULONGLONG matchAnyKeyword, ULONGLONG /*matchAllKeyword*/,
+                    PVOID /*filterData*/, PVOID /*callbackContext*/)
+{
+    LONG keywords = 0;
+
+    // Level 0 means all levels.
+    if (isEnabled && (level == 0 || level >= TRACE_EVENT_LEVEL))
+    {
+        // No keywords means all of them.
+        keywords = matchAnyKeyword ? (LONG)(matchAnyKeyword & 0x7FFFFFFF) : 0x7FFFFFFF;
+    }
+
+    InterlockedExchange(&g_traceEnabledKeywords, keywords);
+}
+
+void TraceStart()
+{
+    HMODULE advapi = GetModuleHandle(_T("advapi32.dll"));
+    if (!advapi)
+    {
+        return;
+    }
+
+    EVENTREGISTER eventRegister = (EVENTREGISTER)GetProcAddress(advapi, "EventRegister");
+    g_eventUnregister = (EVENTUNREGISTER)GetProcAddress(advapi, "EventUnregister");
+    g_eventWriteString = (EVENTWRITESTRING)GetProcAddress(advapi, "EventWriteString");
+
+    if (!eventRegister || !g_eventUnregister || !g_eventWriteString)
+    {
+        // Pre-Vista
+        return;
+    }
+
+    ULONG result = eventRegister(&PSIPHON_TRACE_PROVIDER_GUID, TraceEnableCallback, NULL, &g_traceRegHandle);
+    if (result != ERROR_SUCCESS)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: EventRegister failed (%d)"), __TFUNCTION__, result);
+        g_traceRegHandle = 0;
+    }
+}
+
+void TraceStop()
+{
+    if (g_traceRegHandle)
+    {
+        InterlockedExchange(&g_traceEnabledKeywords, 0);
+        (void)g_eventUnregister(g_traceRegHandle);
+        g_traceRegHandle = 0;
+    }
+}
+
+void _TraceEvent(LONG keyword, const TCHAR* format, ...)
+{
+    if (!g_traceRegHandle)
+    {
+        return;
+    }
+
+    TCHAR event[TRACE_EVENT_MAX_CHARS];
+
+    va_list args;
+    va_start(args, format);
+    // Truncated if need be
+    (void)_vsntprintf_s(event, _countof(event), _TRUNCATE, format, args);
+    va_end(args);
+
+    (void)g_eventWriteString(g_traceRegHandle, TRACE_EVENT_LEVEL, (ULONGLONG)keyword, event);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+/*
+ETW tracing, so that sessions can be profiled with WPR/WPA alongside CPU and
+disk activity. Events are plain strings on the "Psiphon-Client" provider:
+    {D9FA9B26-C2A5-4E4F-B11E-2D42847711DE}
+e.g., "xperf -start psiphon -on D9FA9B26-C2A5-4E4F-B11E-2D42847711DE".
+
+Each event belongs to one of the keywords below, and a session can enable
+just some of them. When no one is listening, TRACE_EVENT is a single test
+of a global, and the arguments aren't even evaluated.
+
+ETW providers need Vista or later; on XP tracing is simply never enabled.
+Threadsafe.
+*/
+
+#define TRACE_KEYWORD_CONNECTION    0x01 // ConnectionManager state changes
+#define TRACE_KEYWORD_TRANSPORT     0x02 // Transport connection phases
+#define TRACE_KEYWORD_SERVER_PROBE  0x04 // Server reachability checks
+#define TRACE_KEYWORD_HTTPS         0x08 // HTTPS requests
+#define TRACE_KEYWORD_LOCAL_PROXY   0x10 // Local proxy stats sends
+
+// Registers the provider; must be done before anything is traced.
+void TraceStart();
+// Unregisters the provider, as the app exits.
+void TraceStop();
+
+// Keywords a trace session currently wants; 0 when no one is listening.
+extern volatile LONG g_traceEnabledKeywords;
+
+inline bool TraceEnabled(LONG keyword)
+{
+    return (g_traceEnabledKeywords & keyword) != 0;
+}
+
+// Use TRACE_EVENT instead.
+void _TraceEvent(LONG keyword, const TCHAR* format, ...);
+
+#define TRACE_EVENT(keyword, format, ...) \
+    do { if (TraceEnabled(keyword)) _TraceEvent(keyword, format, __VA_ARGS__); } while (0)
@@ -28,6 +28,33 @@
 #include "config.h"
 #include "transport_registry.h"
 #include "systemproxysettings.h"
+#include "diagnostic_info.h"
+
+
+// How long a cached handshake can be used for
+#define HANDSHAKE_CACHE_TTL_MS      (30*60*1000)
+
+
+struct CachedHandshake
+{
+    shared_ptr<const SessionInfo> sessionInfo;
+    DWORD time;
+};
+
+// By server address
+static Lock g_handshakeCacheLock("HandshakeCache");
+static map<string, CachedHandshake> g_handshakeCache;
+
+
+static void CacheHandshake(const SessionInfo& sessionInfo)
+{
+    CachedHandshake cached;
+    cached.sessionInfo = make_shared<SessionInfo>(sessionInfo);
+    cached.time = GetTickCount();
+
+    AutoLock lock(g_handshakeCacheLock);
+    g_handshakeCache[sessionInfo.GetServerAddress()] = cached;
+}
 
 
 /******************************************************************************
@@ -41,6 +68,7 @@ ITransport::ITransport(LPCTSTR transportProtocolName)
       m_firstConnectionAttempt(true),
       m_reconnectStateReceiver(NULL),
       m_upgradePaver(NULL),
+      m_authorizationsProvider(NULL),
       m_connectRetryOkay(true)
 {
 }
@@ -48,11 +76,12 @@ ITransport::ITransport(LPCTSTR transportProtocolName)
 
 bool ITransport::ServerWithCapabilitiesExists()
 {
-    ServerEntries entries = m_serverList.GetList();
+    ServerListSnapshotPtr snapshot = m_serverList.GetSnapshot();
+    unsigned int requiredCapabilities = RequiredServerCapabilities();
 
-    for (size_t i = 0; i < entries.size(); i++)
+    for (ServerEntryIterator entry = snapshot->entries.begin(); entry != snapshot->entries.end(); ++entry)
     {
-        if (ServerHasCapabilities(entries[i]))
+        if (entry->HasCapabilities(requiredCapabilities) && ServerHasCapabilities(*entry))
         {
             return true;
         }
@@ -188,16 +217,12 @@ tstring ITransport::GetHandshakeRequestPath(const SessionInfo& sessionInfo)
 {
     tstring handshakeRequestPath;
     handshakeRequestPath = tstring(HTTP_HANDSHAKE_REQUEST_PATH) +
-                           _T("?client_session_id=") + UTF8ToWString(sessionInfo.GetClientSessionID()) +
-                           _T("&propagation_channel_id=") + UTF8ToWString(PROPAGATION_CHANNEL_ID) +
-                           _T("&sponsor_id=") + UTF8ToWString(SPONSOR_ID) +
-                           _T("&client_version=") + UTF8ToWString(CLIENT_VERSION) +
-                           _T("&server_secret=") + UTF8ToWString(sessionInfo.GetWebServerSecret()) +
+                           _T("?") + sessionInfo.GetRequestParams() +
                            _T("&relay_protocol=") + GetTransportRequestName();
 
     // Include a list of known server IP addresses in the request query string as required by /handshake
-    ServerEntries serverEntries = m_serverList.GetList();
-    for (ServerEntryIterator ii = serverEntries.begin(); ii != serverEntries.end(); ++ii)
+    ServerListSnapshotPtr snapshot = m_serverList.GetSnapshot();
+    for (ServerEntryIterator ii = snapshot->entries.begin(); ii != snapshot->entries.end(); ++ii)
     {
         handshakeRequestPath += _T("&known_server=");
         handshakeRequestPath += UTF8ToWString(ii->serverAddress);
@@ -208,6 +233,12 @@ tstring ITransport::GetHandshakeRequestPath(const SessionInfo& sessionInfo)
 
 
 bool ITransport::DoHandshake(bool preTransport, SessionInfo& sessionInfo)
+{
+    return DoHandshake(preTransport, sessionInfo, m_stopInfo);
+}
+
+
+bool ITransport::DoHandshake(bool preTransport, SessionInfo& sessionInfo, const StopInfo& stopInfo)
 {
     string handshakeResponse;
 
@@ -224,7 +255,7 @@ bool ITransport::DoHandshake(bool preTransport, SessionInfo& sessionInfo)
                         sessionInfo,
                         handshakeRequestPath.c_str(),
                         handshakeResponse,
-                        m_stopInfo)
+                        stopInfo)
         || handshakeResponse.length() <= 0)
     {
         my_print(NOT_SENSITIVE, false, _T("Handshake failed"));
@@ -239,10 +270,51 @@ bool ITransport::DoHandshake(bool preTransport, SessionInfo& sessionInfo)
         throw TransportFailed();
     }
 
+    ConnectTimingMark("Handshake");
+
+    CacheHandshake(sessionInfo);
+
     return true;
 }
 
 
+// static
+bool ITransport::GetCachedHandshake(const ServerEntry& serverEntry, SessionInfo& o_sessionInfo)
+{
+    shared_ptr<const SessionInfo> sessionInfo;
+
+    {
+        AutoLock lock(g_handshakeCacheLock);
+
+        auto it = g_handshakeCache.find(serverEntry.serverAddress);
+        if (it == g_handshakeCache.end())
+        {
+            return false;
+        }
+
+        if (GetTickCount() - it->second.time >= HANDSHAKE_CACHE_TTL_MS)
+        {
+            g_handshakeCache.erase(it);
+            return false;
+        }
+
+        sessionInfo = it->second.sessionInfo;
+    }
+
+    // Copied outside the lock; the cached one is never modified.
+    o_sessionInfo = *sessionInfo;
+    return true;
+}
+
+
+// static
+void ITransport::ForgetCachedHandshake(const ServerEntry& serverEntry)
+{
+    AutoLock lock(g_handshakeCacheLock);
+    g_handshakeCache.erase(serverEntry.serverAddress);
+}
+
+
 // static
 size_t ITransport::AddServerEntries(
         LPCTSTR transportProtocolName,
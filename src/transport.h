@@ -43,7 +43,9 @@ public:
 class IUpgradePaver
 {
 public:
-    virtual void PaveUpgrade(const string&) = 0;
+    // base64Download is the verified upgrade package data, still Base64
+    // encoded. Returns true if the new version is in place.
+    virtual bool PaveUpgrade(const string& base64Download) = 0;
 };
 
 class IAuthorizationsProvider
@@ -82,7 +84,10 @@ public:
     //              tstring& o_transportDisplayName,
     //              tstring& o_transportProtocolName,
     //              TransportFactoryFn& o_transportFactoryFn,
-    //              AddServerEntriesFn& o_addServerEntriesFn);
+    //              AddServerEntriesFn& o_addServerEntriesFn,
+    //              bool& o_handshakeRequired);
+    // o_handshakeRequired must match IsHandshakeRequired, so that the registry
+    // can answer for the transport without creating one.
 
     // Only valid when connected
     virtual tstring GetSessionID(const SessionInfo& sessionInfo) = 0;
@@ -92,6 +97,17 @@ public:
     // - needs assistance in calling /connected and /status requests
     virtual bool RequiresStatsSupport() const = 0;
 
+    // Returns true if the transport can count the bytes its own network
+    // interface carries (see GetInterfaceBytesTransferred). Where there are
+    // no page view or HTTPS request stats to collect, those counts are all
+    // the stats need, and no local HTTP proxy is run for them.
+    virtual bool SupportsInterfaceStats() const { return false; }
+
+    // The total bytes sent and received through the transport's interface
+    // since it connected. Returns false if they can't be read (e.g., it's not
+    // connected). May be called from any thread.
+    virtual bool GetInterfaceBytesTransferred(unsigned long long& o_bytes) { return false; }
+
     virtual tstring GetLastTransportError() const = 0;
 
     // Returns true if pre-handshake is required to connect, false otherwise.
@@ -112,6 +128,20 @@ public:
     // Returns true if the specified server supports this transport.
     virtual bool ServerHasCapabilities(const ServerEntry& entry) const = 0;
 
+    // ServerCapability bits that every server this transport supports has,
+    // so that the server list can be filtered before ServerHasCapabilities
+    // is called. The default is none.
+    virtual unsigned int RequiredServerCapabilities() const { return 0; }
+
+    // The tunnel protocols the transport can connect to serverEntry with,
+    // most preferred first, so that they can be measured one by one (see
+    // TransportBenchmark). Empty, the default, if it doesn't distinguish them.
+    virtual vector<string> GetTunnelProtocols(const ServerEntry& serverEntry) const { return vector<string>(); }
+
+    // Limits temp connections to one of GetTunnelProtocols; empty, the
+    // default, for any. Must only be set while not connecting.
+    virtual void SetTempTunnelProtocol(const string& protocol) {}
+
     // Call to create the connection.
     // A failed attempt must clean itself up as needed.
     // May throw TransportFailed or Abort.
@@ -185,6 +215,15 @@ protected:
     tstring GetHandshakeRequestPath(const SessionInfo& sessionInfo);
     // May throw StopSignal::StopException
     bool DoHandshake(bool preTransport, SessionInfo& sessionInfo);
+    // As above, but watching stopInfo rather than the transport's own. For
+    // handshakes made off the connect thread.
+    bool DoHandshake(bool preTransport, SessionInfo& sessionInfo, const StopInfo& stopInfo);
+
+    // Successful handshakes are cached, already parsed, per server for a
+    // while, so that a reconnect to the same server needn't wait for one.
+    // Returns false if there's no fresh cached handshake for serverEntry.
+    static bool GetCachedHandshake(const ServerEntry& serverEntry, SessionInfo& o_sessionInfo);
+    static void ForgetCachedHandshake(const ServerEntry& serverEntry);
 
 protected:
     SessionInfo m_sessionInfo;
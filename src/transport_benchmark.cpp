@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "transport_benchmark.h"
+#include "transport.h"
+#include "transport_registry.h"
+#include "transport_connection.h"
+#include "temp_tunnel_pool.h"
+#include "httpsrequest.h"
+#include "serverlist.h"
+#include "usersettings.h"
+#include "config.h"
+#include "logging.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+#define TRANSPORT_BENCHMARK_REQUEST_COUNT           3
+#define TRANSPORT_BENCHMARK_REQUEST_PATH            _T("/")
+// A session makes many round trips for each connect, so the round trip
+// counts for more than the establishment time.
+#define TRANSPORT_BENCHMARK_LATENCY_WEIGHT          10.0
+// Results older than this, or from before a network change, aren't used.
+#define TRANSPORT_BENCHMARK_MAX_AGE_SECONDS         (7*24*60*60)
+#define TRANSPORT_BENCHMARK_PREFERRED_PROTOCOLS     2
+
+
+/***********************************************************************
+ Result
+ */
+
+double TransportBenchmark::Result::Score() const
+{
+    if (!success)
+    {
+        return DBL_MAX;
+    }
+
+    // Connecting takes a few round trips, so it stands in for the round trip
+    // when the web port didn't answer.
+    double latency = latencyMs > 0 ? latencyMs : establishMs;
+    return establishMs + latency * TRANSPORT_BENCHMARK_LATENCY_WEIGHT;
+}
+
+Json::Value TransportBenchmark::Result::ToJson() const
+{
+    Json::Value json;
+    json["transport"] = WStringToUTF8(transportProtocolName);
+    json["protocol"] = protocol;
+    json["serverAddress"] = serverAddress;
+    json["success"] = success;
+    if (success)
+    {
+        json["establishMs"] = (Json::UInt)establishMs;
+        json["latencyMs"] = (Json::UInt)latencyMs;
+        json["bytesPerSecond"] = (Json::UInt64)bytesPerSecond;
+    }
+    return json;
+}
+
+void TransportBenchmark::Result::FromJson(const Json::Value& json)
+{
+    transportProtocolName = UTF8ToWString(json.get("transport", "").asString());
+    protocol = json.get("protocol", "").asString();
+    serverAddress = json.get("serverAddress", "").asString();
+    success = json.get("success", false).asBool();
+    establishMs = json.get("establishMs", 0).asUInt();
+    latencyMs = json.get("latencyMs", 0).asUInt();
+    bytesPerSecond = json.get("bytesPerSecond", 0).asUInt64();
+}
+
+
+/***********************************************************************
+ TransportBenchmark
+ */
+
+static bool CompareResults(const TransportBenchmark::Result& lhs, const TransportBenchmark::Result& rhs)
+{
+    return lhs.Score() < rhs.Score();
+}
+
+// Connects transport to serverEntry with protocol, and measures the tunnel.
+// A failure to connect is a result too. Throws the stop signal.
+static TransportBenchmark::Result MeasureTunnel(
+                                    ITransport* transport,
+                                    const ServerEntry& serverEntry,
+                                    const string& protocol,
+                                    const StopInfo& stopInfo)
+{
+    TransportBenchmark::Result result;
+    result.transportProtocolName = transport->GetTransportProtocolName();
+    result.protocol = protocol;
+    result.serverAddress = serverEntry.serverAddress;
+
+    transport->SetTempTunnelProtocol(protocol);
+    auto clearProtocol = finally([transport] { transport->SetTempTunnelProtocol(""); });
+
+    try
+    {
+        TransportConnection connection;
+
+        unsigned long long connectStart = MonotonicMilliseconds();
+        connection.Connect(
+            stopInfo,
+            transport,
+            NULL, // not receiving reconnection notifications
+            NULL, // not receiving upgrade paver calls
+            NULL, // not collecting stats
+            NULL, // not supplying authorizations
+            &serverEntry,
+            false); // the requests go through the system proxy settings
+        result.establishMs = (DWORD)(MonotonicMilliseconds() - connectStart);
+        result.success = true;
+
+        // As for TunnelQuality, the first request pays for the TLS handshake,
+        // so the lowest is the best estimate of the round trip.
+        size_t responseBytes = 0;
+        unsigned long long responseMs = 0;
+        for (int i = 0; i < TRANSPORT_BENCHMARK_REQUEST_COUNT; i++)
+        {
+            HTTPSRequest httpsRequest(true); // silent
+            HTTPSRequest::Response httpsResponse;
+            unsigned long long requestStart = MonotonicMilliseconds();
+            if (httpsRequest.MakeRequest(
+                    UTF8ToWString(serverEntry.serverAddress).c_str(),
+                    serverEntry.webServerPort,
+                    serverEntry.webServerCertificate,
+                    TRANSPORT_BENCHMARK_REQUEST_PATH,
+                    stopInfo,
+                    HTTPSRequest::PsiphonProxy::REQUIRE,
+                    httpsResponse))
+            {
+                // Whatever the status code, the round trip was made.
+                DWORD elapsed = max((DWORD)(MonotonicMilliseconds() - requestStart), (DWORD)1);
+                result.latencyMs = result.latencyMs == 0 ? elapsed : min(result.latencyMs, elapsed);
+                responseBytes += httpsResponse.body.length();
+                responseMs += elapsed;
+            }
+        }
+
+        if (responseMs > 0)
+        {
+            result.bytesPerSecond = responseBytes * 1000ULL / responseMs;
+        }
+    }
+    catch (StopSignal::StopException&)
+    {
+        throw;
+    }
+    catch (...)
+    {
+        // Failing to connect, in whatever way, is what's being measured.
+    }
+    // The connection is torn down, reverting the system proxy settings,
+    // before the next one is made.
+
+    return result;
+}
+
+static void StoreResults(const vector<TransportBenchmark::Result>& results)
+{
+    Json::Value json;
+    json["time"] = (Json::Int64)time(0);
+    json["results"] = Json::Value(Json::arrayValue);
+    for (const auto& result : results)
+    {
+        json["results"].append(result.ToJson());
+    }
+
+    Json::FastWriter jsonWriter;
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+
+    if (!WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_TRANSPORT_BENCHMARK, jsonWriter.write(json), reason))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Failed to write benchmark results (%d)"), __TFUNCTION__, reason);
+    }
+}
+
+// static
+bool TransportBenchmark::Run(const StopInfo& stopInfo, vector<Result>& o_results)
+{
+    o_results.clear();
+
+    // An idle pooled tunnel may have applied the system proxy settings.
+    TempTunnelPool::Flush();
+
+    vector<shared_ptr<ITransport>> transports;
+    TransportRegistry::NewAllWithoutHandshake(transports);
+
+    for (auto& transport : transports)
+    {
+        ServerList serverList(WStringToUTF8(transport->GetTransportProtocolName()).c_str());
+        ServerEntries serverEntries = serverList.GetList(transport->RequiredServerCapabilities());
+
+        // Each protocol is measured with the first server -- in list order,
+        // so the best known -- that supports it.
+        vector<pair<string, const ServerEntry*>> targets;
+        for (const auto& serverEntry : serverEntries)
+        {
+            if (!transport->ServerHasCapabilities(serverEntry))
+            {
+                continue;
+            }
+
+            vector<string> protocols = transport->GetTunnelProtocols(serverEntry);
+            if (protocols.empty())
+            {
+                // One measurement for the transport as a whole
+                targets.push_back(make_pair(string(), &serverEntry));
+                break;
+            }
+
+            for (const auto& protocol : protocols)
+            {
+                auto seen = std::find_if(targets.begin(), targets.end(),
+                    [&protocol](const pair<string, const ServerEntry*>& target) { return target.first == protocol; });
+                if (seen == targets.end())
+                {
+                    targets.push_back(make_pair(protocol, &serverEntry));
+                }
+            }
+        }
+
+        if (targets.empty())
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: no servers for %s"), __TFUNCTION__, transport->GetTransportProtocolName().c_str());
+            continue;
+        }
+
+        for (const auto& target : targets)
+        {
+            Result result = MeasureTunnel(transport.get(), *target.second, target.first, stopInfo);
+
+            if (result.success)
+            {
+                my_print(NOT_SENSITIVE, false, _T("Benchmark: %s %S connected in %dms, round trip %dms"),
+                    transport->GetTransportDisplayName().c_str(), result.protocol.c_str(),
+                    result.establishMs, result.latencyMs);
+            }
+            else
+            {
+                my_print(NOT_SENSITIVE, false, _T("Benchmark: %s %S failed to connect"),
+                    transport->GetTransportDisplayName().c_str(), result.protocol.c_str());
+            }
+
+            o_results.push_back(result);
+        }
+    }
+
+    std::stable_sort(o_results.begin(), o_results.end(), CompareResults);
+
+    if (o_results.empty() || !o_results.front().success)
+    {
+        my_print(NOT_SENSITIVE, false, _T("Benchmark: nothing connected"));
+        // Failed measurements are kept too: they rank the transports as
+        // much as successful ones do.
+        if (!o_results.empty())
+        {
+            StoreResults(o_results);
+        }
+        return false;
+    }
+
+    StoreResults(o_results);
+
+    const Result& best = o_results.front();
+    if (best.transportProtocolName == Settings::Transport())
+    {
+        my_print(NOT_SENSITIVE, false, _T("Benchmark: %s performed best (the current setting)"),
+            TransportRegistry::GetDisplayName(best.transportProtocolName).c_str());
+    }
+    else
+    {
+        my_print(NOT_SENSITIVE, false, _T("Benchmark: %s performed best; the current setting is %s"),
+            TransportRegistry::GetDisplayName(best.transportProtocolName).c_str(),
+            TransportRegistry::GetDisplayName(Settings::Transport()).c_str());
+    }
+
+    return true;
+}
+
+// static
+bool TransportBenchmark::GetResults(vector<Result>& o_results, time_t& o_time)
+{
+    o_results.clear();
+    o_time = 0;
+
+    string resultsString;
+    if (!ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_TRANSPORT_BENCHMARK, resultsString))
+    {
+        return false;
+    }
+
+    Json::Value json;
+    Json::Reader reader;
+    if (!reader.parse(resultsString, json) || !json.isObject())
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: Failed to parse benchmark results"), __TFUNCTION__);
+        return false;
+    }
+
+    time_t resultsTime = (time_t)json.get("time", 0).asInt64();
+    time_t now = time(0);
+    if (resultsTime > now
+        || now - resultsTime >= TRANSPORT_BENCHMARK_MAX_AGE_SECONDS
+        || resultsTime < ServerStats::LastNetworkChange())
+    {
+        return false;
+    }
+
+    const Json::Value& results = json["results"];
+    for (Json::Value::ArrayIndex i = 0; results.isArray() && i < results.size(); i++)
+    {
+        Result result;
+        result.FromJson(results[i]);
+        o_results.push_back(result);
+    }
+
+    // Stored in order, but they're cheap to sort again.
+    std::stable_sort(o_results.begin(), o_results.end(), CompareResults);
+    o_time = resultsTime;
+    return !o_results.empty();
+}
+
+// static
+vector<tstring> TransportBenchmark::GetTransportRanking()
+{
+    vector<tstring> ranking;
+    vector<Result> results;
+    time_t resultsTime;
+    if (!GetResults(results, resultsTime))
+    {
+        return ranking;
+    }
+
+    // Best first, so each transport is ranked by its best result.
+    for (const auto& result : results)
+    {
+        if (std::find(ranking.begin(), ranking.end(), result.transportProtocolName) == ranking.end())
+        {
+            ranking.push_back(result.transportProtocolName);
+        }
+    }
+    return ranking;
+}
+
+// static
+tstring TransportBenchmark::GetRecommendedTransport()
+{
+    vector<Result> results;
+    time_t resultsTime;
+    if (!GetResults(results, resultsTime) || !results.front().success)
+    {
+        return _T("");
+    }
+    return results.front().transportProtocolName;
+}
+
+// static
+vector<string> TransportBenchmark::GetPreferredProtocols(const tstring& transportProtocolName)
+{
+    vector<string> protocols;
+    vector<Result> results;
+    time_t resultsTime;
+    if (!GetResults(results, resultsTime))
+    {
+        return protocols;
+    }
+
+    for (const auto& result : results)
+    {
+        if (protocols.size() >= TRANSPORT_BENCHMARK_PREFERRED_PROTOCOLS)
+        {
+            break;
+        }
+        if (result.success
+            && result.transportProtocolName == transportProtocolName
+            && !result.protocol.empty())
+        {
+            protocols.push_back(result.protocol);
+        }
+    }
+    return protocols;
+}
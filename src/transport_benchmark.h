@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include "stopsignal.h"
+
+
+/*
+Compares the transports, and each transport's tunnel protocols, on the
+current network. Each is connected in turn, as a temp tunnel to the best
+server in the transport's list that supports it, timing how long it takes to
+establish; then a few requests are made through it to the server's web port,
+for the round trip time and throughput. Only transports that can make temp
+tunnels are measured: VPN needs a handshake before it can connect.
+
+The latest results are kept in the registry until they're stale. The best
+transport is recommended, but Settings::Transport is left for the user to
+change. The best protocols seed the core's first connection candidates, and
+the transport ranking picks the connect race's alternate transport.
+*/
+class TransportBenchmark
+{
+public:
+    struct Result
+    {
+        tstring transportProtocolName;
+        // Empty if the transport doesn't distinguish protocols
+        string protocol;
+        string serverAddress;
+        bool success;
+        // Milliseconds from starting to connect to connected; only
+        // meaningful on success
+        DWORD establishMs;
+        // Lowest round trip of the requests; 0 if none were answered
+        DWORD latencyMs;
+        // Response bytes over the time taken to get them. The web port has
+        // little to send, so this is a lower bound on what the tunnel can do.
+        unsigned long long bytesPerSecond;
+
+        Result() : success(false), establishMs(0), latencyMs(0), bytesPerSecond(0) {}
+
+        // Lower is better. DBL_MAX unless successful.
+        double Score() const;
+
+        Json::Value ToJson() const;
+        void FromJson(const Json::Value& json);
+    };
+
+    // Measures each transport and protocol, one after another, and stores
+    // the results; o_results are best first. The temp tunnels apply the
+    // system proxy settings, so this must only be run while there's no
+    // connection. Returns false if nothing could be connected.
+    // Throws the stop signal.
+    static bool Run(const StopInfo& stopInfo, vector<Result>& o_results);
+
+    // The stored results, best first, and when they were taken. Returns false
+    // if there are none, or if they're stale: too old, or from before the
+    // network last changed.
+    static bool GetResults(vector<Result>& o_results, time_t& o_time);
+
+    // The measured transports, best first; empty if there are no fresh
+    // results. Those that couldn't be connected come last.
+    static vector<tstring> GetTransportRanking();
+
+    // The best transport to use for Settings::Transport; empty if there are
+    // no fresh results or none connected.
+    static tstring GetRecommendedTransport();
+
+    // The protocols that connected for transportProtocolName, best first,
+    // at most a few of them; empty if there are no fresh results.
+    static vector<string> GetPreferredProtocols(const tstring& transportProtocolName);
+};
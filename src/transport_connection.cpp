@@ -23,12 +23,20 @@
 #include "local_proxy.h"
 #include "transport.h"
 #include "psiclient.h"
+#include "diagnostic_info.h"
+#include "httpsrequest.h"
+#include "thread_pool.h"
 
 
 TransportConnection::TransportConnection()
     : m_transport(0),
       m_localProxy(0),
-      m_skipApplySystemProxySettings(false)
+      m_sessionInfo(make_shared<SessionInfo>()),
+      m_skipApplySystemProxySettings(false),
+      m_holdSystemProxySettings(false),
+      m_startupStopInfo(0),
+      m_prepareSystemProxySettings(false),
+      m_localProxyStarted(false)
 {
 }
 
@@ -43,7 +51,7 @@ TransportConnection::~TransportConnection()
     }
 }
 
-SessionInfo TransportConnection::GetUpdatedSessionInfo() const
+shared_ptr<const SessionInfo> TransportConnection::GetUpdatedSessionInfo() const
 {
     return m_sessionInfo;
 }
@@ -72,71 +80,137 @@ void TransportConnection::Connect(
     {
         m_workerThreadSynch.Reset();
 
-        // Connect with the transport. Will throw on error.
-        m_transport->Connect(
-                    &m_systemProxySettings,
-                    stopInfo,
-                    reconnectStateReceiver,
-                    upgradePaver,
-                    authorizationsProvider,
-                    &m_workerThreadSynch,
-                    tempConnectServerEntry);
+        // Only applying the system proxy settings has to wait for the
+        // transport. The local proxy has no parent port to wait for, and the
+        // system's current proxy settings can be read up front -- except for
+        // whole-system transports, whose own connection will appear among the
+        // ones to set. That work is done on another thread while the transport
+        // connects.
+        m_startupStopInfo = &stopInfo;
+        m_prepareSystemProxySettings =
+            !m_skipApplySystemProxySettings && !m_transport->IsWholeSystemTunneled();
+        m_localProxyStarted = false;
+        m_startupError = nullptr;
 
-        // Get initial SessionInfo. Note that this might be pre-handshake
-        // and therefore not be totally filled in.
-        m_sessionInfo = m_transport->GetSessionInfo();
+        // A transport that counts its own bytes may not need the local proxy
+        // at all -- but that depends on the page view regexes, which come
+        // with its handshake, so for it the local proxy waits for the transport.
+        bool deferLocalProxy = m_transport->RequiresStatsSupport()
+                               && m_transport->SupportsInterfaceStats();
 
-        if (m_transport->RequiresStatsSupport())
+        if (m_transport->RequiresStatsSupport() && !deferLocalProxy)
         {
-            // Set up and start the local proxy.
+            // Set up the local proxy. The server address is only used with
+            // a parent port, so it doesn't matter that it isn't known yet.
             m_localProxy = new LocalProxy(
                                 statsCollector, 
-                                m_sessionInfo.GetServerAddress().c_str(), 
+                                m_transport->GetSessionInfo().GetServerAddress().c_str(), 
                                 &m_systemProxySettings,
                                 0, // no parent port
                                 tstring()); // no split tunnel file path
+        }
 
-            // Launches the local proxy thread and doesn't return until it
-            // observes a successful (or not) connection.
-            if (!m_localProxy->Start(stopInfo, &m_workerThreadSynch))
+        HANDLE startupThread = NULL;
+        if (m_localProxy || m_prepareSystemProxySettings)
+        {
+            startupThread = ThreadPool::Instance().Run(ParallelStartupThread, (void*)this);
+            if (!startupThread)
             {
-                throw IWorkerThread::Error("LocalProxy::Start failed");
+                my_print(NOT_SENSITIVE, true, _T("%s: ThreadPool::Run failed (%d)"), __TFUNCTION__, GetLastError());
+                ParallelStartupThread((void*)this);
             }
         }
 
+        try
+        {
+            // Connect with the transport. Will throw on error.
+            m_transport->Connect(
+                        &m_systemProxySettings,
+                        stopInfo,
+                        reconnectStateReceiver,
+                        upgradePaver,
+                        authorizationsProvider,
+                        &m_workerThreadSynch,
+                        tempConnectServerEntry);
+        }
+        catch (...)
+        {
+            // Cleanup mustn't race with the startup thread.
+            if (startupThread)
+            {
+                WaitForSingleObject(startupThread, INFINITE);
+                CloseHandle(startupThread);
+            }
+            throw;
+        }
+
+        ConnectTimingMark("TransportConnected");
+
+        if (startupThread)
+        {
+            WaitForSingleObject(startupThread, INFINITE);
+            CloseHandle(startupThread);
+        }
+
+        if (m_startupError)
+        {
+            std::exception_ptr error = m_startupError;
+            m_startupError = nullptr;
+            std::rethrow_exception(error);
+        }
+
+        if (deferLocalProxy)
+        {
+            m_localProxy = new LocalProxy(
+                                statsCollector,
+                                m_transport->GetSessionInfo().GetServerAddress().c_str(),
+                                &m_systemProxySettings,
+                                0, // no parent port
+                                tstring()); // no split tunnel file path
+
+            // Without regexes, there's nothing for it to see that the
+            // interface counters don't, and it's an extra hop for all traffic.
+            if (!m_transport->GetSessionInfo().HasStatsRegexes())
+            {
+                m_localProxy->UseInterfaceStats(m_transport);
+            }
+
+            m_localProxyStarted = m_localProxy->Start(stopInfo, &m_workerThreadSynch);
+        }
+
+        if (m_localProxy && !m_localProxyStarted)
+        {
+            throw IWorkerThread::Error("LocalProxy::Start failed");
+        }
+
+        // Get initial SessionInfo. Note that this might be pre-handshake
+        // and therefore not be totally filled in.
+        m_sessionInfo = make_shared<SessionInfo>(m_transport->GetSessionInfo());
+
         // In the case of the URL proxy, which might be created while another transport
         // is running, we don't want to change the system proxy settings or change the registry
         // keys that hold any information about proxy settings.
         if (!m_skipApplySystemProxySettings)
         {
-            // If the whole system is tunneled (i.e., VPN), then we can't leave the
-            // original system proxy settings intact -- because that proxy would 
-            // (probably) not be reachable in VPN mode and the user would 
-            // effectively have no connectivity.
-            bool allowedToSkipProxySettings = !m_transport->IsWholeSystemTunneled();
-
-            // Apply the system proxy settings that have been collected by the transport
-            // and the local proxy.
-            if (!m_systemProxySettings.Apply(allowedToSkipProxySettings))
-            {
-                throw IWorkerThread::Error("SystemProxySettings::Apply failed");
-            }
+            ApplySystemProxySettings();
         }
 
         // If the transport did a handshake, there may be updated session info.
-        m_sessionInfo = m_transport->GetSessionInfo();
+        shared_ptr<SessionInfo> sessionInfo = make_shared<SessionInfo>(m_transport->GetSessionInfo());
 
         // Update the session info with local proxy ports.
-        m_sessionInfo.SetLocalProxyPorts(
+        sessionInfo->SetLocalProxyPorts(
             m_systemProxySettings.GetHttpProxyPort(), 
             m_systemProxySettings.GetHttpsProxyPort(), 
             m_systemProxySettings.GetSocksProxyPort());
 
+        m_sessionInfo = sessionInfo;
+
         // Now that we have extra info from the server via the handshake 
         // (specifically page view regexes), we need to update the local proxy.
         if (m_localProxy)
         {
-            m_localProxy->UpdateSessionInfo(m_sessionInfo);
+            m_localProxy->UpdateSessionInfo(*m_sessionInfo);
         }
     }
     catch (ITransport::TransportFailed&)
@@ -161,6 +235,63 @@ void TransportConnection::Connect(
     }
 }
 
+// static
+DWORD WINAPI TransportConnection::ParallelStartupThread(void* object)
+{
+    TransportConnection* _this = (TransportConnection*)object;
+
+    if (_this->m_prepareSystemProxySettings)
+    {
+        _this->m_systemProxySettings.Prepare();
+    }
+
+    if (_this->m_localProxy)
+    {
+        // Launches the local proxy thread and doesn't return until it
+        // observes a successful (or not) connection. Exceptions are passed
+        // back to Connect.
+        try
+        {
+            _this->m_localProxyStarted = _this->m_localProxy->Start(
+                                            *_this->m_startupStopInfo,
+                                            &_this->m_workerThreadSynch);
+        }
+        catch (...)
+        {
+            _this->m_startupError = std::current_exception();
+        }
+
+        if (_this->m_localProxyStarted)
+        {
+            ConnectTimingMark("LocalProxyReady");
+        }
+    }
+
+    return 0;
+}
+
+void TransportConnection::ApplySystemProxySettings()
+{
+    assert(m_transport);
+
+    m_skipApplySystemProxySettings = false;
+
+    // If the whole system is tunneled (i.e., VPN), then we can't leave the
+    // original system proxy settings intact -- because that proxy would 
+    // (probably) not be reachable in VPN mode and the user would 
+    // effectively have no connectivity.
+    bool allowedToSkipProxySettings = !m_transport->IsWholeSystemTunneled();
+
+    // Apply the system proxy settings that have been collected by the transport
+    // and the local proxy.
+    if (!m_systemProxySettings.Apply(allowedToSkipProxySettings))
+    {
+        throw IWorkerThread::Error("SystemProxySettings::Apply failed");
+    }
+
+    ConnectTimingMark("SystemProxySettingsApplied");
+}
+
 void TransportConnection::WaitForDisconnect()
 {
     HANDLE waitHandles[2];
@@ -195,7 +326,15 @@ void TransportConnection::Cleanup()
         // before the transport and local proxy do. Otherwise, all web connections
         // will have a window of being guaranteed to fail (including and especially
         // our own -- like final /status requests).
-        m_systemProxySettings.Revert();
+        // When reconnecting, though, they're held: that window lasts until
+        // the next connection, but browsers aren't told of two changes.
+        // Whole-system transports change the set of connections to set, so
+        // aren't held.
+        bool hold = m_holdSystemProxySettings
+                    && m_transport
+                    && !m_transport->IsWholeSystemTunneled()
+                    && !GlobalStopSignal::Instance().CheckSignal(STOP_REASON_USER_DISCONNECT | STOP_REASON_EXIT);
+        m_systemProxySettings.Revert(hold);
     }
 
     if (m_localProxy) 
@@ -210,4 +349,8 @@ void TransportConnection::Cleanup()
         m_transport->Stop();
         m_transport->Cleanup();
     }
+
+    // Kept-alive connections may have gone through the tunnel (or the URL
+    // proxy) that just went away.
+    HTTPSRequest::ReleasePooledSessions();
 }
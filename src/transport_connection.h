@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <exception>
 #include "sessioninfo.h"
 #include "systemproxysettings.h"
 #include "utilities.h"
@@ -67,12 +68,23 @@ public:
             const ServerEntry* tempConnectServerEntry=NULL,
             bool skipApplySystemProxySettings=false);
 
+    // For a connection made with skipApplySystemProxySettings, applies the
+    // system proxy settings after all (e.g., once it has won a connect race).
+    // They'll then be reverted on cleanup. Throws IWorkerThread::Error.
+    void ApplySystemProxySettings();
+
+    // Leaves the system proxy settings applied on cleanup -- unless the user
+    // stopped or the app is exiting -- for the next connection to take over
+    // if its local proxy ports are the same. The caller must call
+    // SystemProxySettings::RevertHeld when it's done reconnecting.
+    void HoldSystemProxySettingsOnCleanup() { m_holdSystemProxySettings = true; }
+
     // Blocks until the transport disconnects.
     void WaitForDisconnect();
 
     // When a connection is made, a handshake is done to get extra information
     // from the server. That info can be retrieved with this function.
-    SessionInfo GetUpdatedSessionInfo() const;
+    shared_ptr<const SessionInfo> GetUpdatedSessionInfo() const;
 
     // The local http proxy port that the transport provides.
     // NOTE that this might not always be set (such as in the case of vpntransport).
@@ -86,12 +98,23 @@ public:
 private:
     void Cleanup();
 
+    // Does the transport-independent startup work while the transport
+    // connects. See Connect.
+    static DWORD WINAPI ParallelStartupThread(void* object);
+
 private:
     ITransport* m_transport;
     LocalProxy* m_localProxy;
-    SessionInfo m_sessionInfo;
+    shared_ptr<const SessionInfo> m_sessionInfo;
     SystemProxySettings m_systemProxySettings;
     WorkerThreadSynch m_workerThreadSynch;
     bool m_skipApplySystemProxySettings;
+    bool m_holdSystemProxySettings;
+
+    // Used by ParallelStartupThread
+    const StopInfo* m_startupStopInfo;
+    bool m_prepareSystemProxySettings;
+    bool m_localProxyStarted;
+    std::exception_ptr m_startupError;
 };
 
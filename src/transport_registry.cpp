@@ -25,6 +25,7 @@
 #include "coretransport.h"
 #include "serverlist.h"
 #include "psiclient.h"
+#include "transport_benchmark.h"
 
 
 /******************************************************************************
@@ -43,7 +44,8 @@ int TransportRegistry::Register()
                         registeredTransport.transportDisplayName, 
                         registeredTransport.transportProtocolName, 
                         registeredTransport.transportFactoryFn,
-                        registeredTransport.addServerEntriesFn);
+                        registeredTransport.addServerEntriesFn,
+                        registeredTransport.handshakeRequired);
 
     m_registeredTransports.push_back(registeredTransport);
 
@@ -73,19 +75,83 @@ ITransport* TransportRegistry::New(tstring transportProtocolName)
 
 
 // static 
-void TransportRegistry::NewAll(vector<shared_ptr<ITransport>>& all_transports)
+ITransport* TransportRegistry::NewAlternate(tstring transportProtocolName)
 {
-    all_transports.clear();
+    // Transports that weren't measured aren't ranked; the ranked ones may no
+    // longer be registered.
+    vector<tstring> ranking = TransportBenchmark::GetTransportRanking();
+    for (vector<tstring>::const_iterator ranked = ranking.begin();
+         ranked != ranking.end();
+         ++ranked)
+    {
+        if (*ranked == transportProtocolName)
+        {
+            continue;
+        }
+
+        for (vector<RegisteredTransport>::const_iterator it = m_registeredTransports.begin();
+             it != m_registeredTransports.end();
+             ++it)
+        {
+            if (it->transportProtocolName == *ranked)
+            {
+                return it->transportFactoryFn();
+            }
+        }
+    }
+
+    for (vector<RegisteredTransport>::const_iterator it = m_registeredTransports.begin();
+         it != m_registeredTransports.end();
+         ++it)
+    {
+        if (it->transportProtocolName != transportProtocolName)
+        {
+            return it->transportFactoryFn();
+        }
+    }
+
+    return NULL;
+}
+
+
+// static 
+void TransportRegistry::NewAllWithoutHandshake(vector<shared_ptr<ITransport>>& o_transports)
+{
+    o_transports.clear();
 
     for (vector<RegisteredTransport>::const_iterator it = m_registeredTransports.begin();
          it != m_registeredTransports.end();
          ++it)
     {
-        all_transports.push_back(shared_ptr<ITransport>(it->transportFactoryFn()));
+        if (it->handshakeRequired)
+        {
+            continue;
+        }
+
+        shared_ptr<ITransport> transport(it->transportFactoryFn());
+        assert(!transport->IsHandshakeRequired());
+        o_transports.push_back(transport);
     }
 }
 
 
+// static
+tstring TransportRegistry::GetDisplayName(const tstring& transportProtocolName)
+{
+    for (vector<RegisteredTransport>::const_iterator it = m_registeredTransports.begin();
+         it != m_registeredTransports.end();
+         ++it)
+    {
+        if (it->transportProtocolName == transportProtocolName)
+        {
+            return it->transportDisplayName;
+        }
+    }
+
+    return transportProtocolName;
+}
+
+
 // static
 void TransportRegistry::AddServerEntries(
                             const vector<string>& newServerEntryList, 
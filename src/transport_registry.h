@@ -38,6 +38,7 @@ struct RegisteredTransport
     tstring transportProtocolName;
     TransportFactoryFn transportFactoryFn;
     AddServerEntriesFn addServerEntriesFn;
+    bool handshakeRequired;
 };
 
 class TransportRegistry
@@ -49,9 +50,22 @@ public:
 
     // Create new instance of a particular transport
     static ITransport* New(tstring transportProtocolName);
+
+    // Create new instance of the highest-priority transport that isn't
+    // transportProtocolName: the best in the latest fresh benchmark results
+    // (see TransportBenchmark), otherwise the first registered. Returns NULL
+    // if there is no other transport.
+    static ITransport* NewAlternate(tstring transportProtocolName);
     
-    // Create new instances of all available transports.
-    static void NewAll(vector<shared_ptr<ITransport>>& all_transports);
+    // Create new instances of the available transports that don't require a
+    // pre-handshake, i.e., those that can make temp tunnels. The others are
+    // ruled out from their registration, without being created -- creating
+    // (and destroying) a VPN transport touches RAS, for one.
+    static void NewAllWithoutHandshake(vector<shared_ptr<ITransport>>& o_transports);
+
+    // The display name of a registered transport; transportProtocolName
+    // itself if there's no such transport.
+    static tstring GetDisplayName(const tstring& transportProtocolName);
 
     // Add new server entries to all transports.
     static void AddServerEntries(
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "tstring.h"
+#include "codec_kernels.h"
+
+
+void WStringToUTF8(const wchar_t* wString, size_t length, string& o_output)
+{
+    // A UTF-16 unit is at most 3 UTF-8 bytes (a surrogate pair is 4 for 2)
+    o_output.resize(length * 3);
+    if (length == 0)
+    {
+        return;
+    }
+
+    size_t converted = NarrowASCII(wString, length, &o_output[0]);
+    if (converted < length)
+    {
+        int written = WideCharToMultiByte(
+                        CP_UTF8,
+                        0,
+                        wString + converted,
+                        (int)(length - converted),
+                        &o_output[converted],
+                        (int)(o_output.length() - converted),
+                        NULL,
+                        NULL);
+        converted += written;
+    }
+
+    o_output.resize(converted);
+}
+
+// output must have room for length units: a UTF-8 byte is at most 1 UTF-16
+// unit. Returns the number of units written.
+static size_t UTF8ToWideChars(const char* utf8String, size_t length, wchar_t* output)
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+
+    size_t converted = WidenASCII(utf8String, length, output);
+    if (converted < length)
+    {
+        int written = MultiByteToWideChar(
+                        CP_UTF8,
+                        0,
+                        utf8String + converted,
+                        (int)(length - converted),
+                        output + converted,
+                        (int)(length - converted));
+        converted += written;
+    }
+
+    return converted;
+}
+
+void UTF8ToWString(const char* utf8String, size_t length, wstring& o_output)
+{
+    o_output.resize(length);
+    if (length == 0)
+    {
+        return;
+    }
+
+    o_output.resize(UTF8ToWideChars(utf8String, length, &o_output[0]));
+}
+
+wchar_t* UTF8ToNewWideBuffer(const char* utf8String, size_t length)
+{
+    wchar_t* buffer = new wchar_t[length + 1];
+    buffer[UTF8ToWideChars(utf8String, length, buffer)] = L'\0';
+    return buffer;
+}
+
+const string& WStringToUTF8Temp(const wchar_t* wString, size_t length)
+{
+    static thread_local string t_buffer;
+    WStringToUTF8(wString, length, t_buffer);
+    return t_buffer;
+}
+
+const wstring& UTF8ToWStringTemp(const char* utf8String, size_t length)
+{
+    static thread_local wstring t_buffer;
+    UTF8ToWString(utf8String, length, t_buffer);
+    return t_buffer;
+}
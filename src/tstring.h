@@ -39,37 +39,59 @@ using namespace std;
 
 typedef basic_stringstream<TCHAR> tstringstream;
 
+// UTF-8 <-> UTF-16 conversion into o_output, reusing its storage. Pure
+// ASCII -- which is most of what we convert -- takes a fast path. Invalid
+// sequences are replaced with U+FFFD.
+void WStringToUTF8(const wchar_t* wString, size_t length, string& o_output);
+void UTF8ToWString(const char* utf8String, size_t length, wstring& o_output);
+
+// As above, but into a per-thread buffer that's overwritten by the thread's
+// next call of the same one. For conversions that are used right away, e.g.
+// as an argument.
+const string& WStringToUTF8Temp(const wchar_t* wString, size_t length);
+const wstring& UTF8ToWStringTemp(const char* utf8String, size_t length);
+
+// As UTF8ToWString, but into a new[]'d, NUL-terminated buffer that the
+// caller owns. For strings that are handed off, e.g. in a posted message,
+// without first being converted into a wstring and then copied.
+wchar_t* UTF8ToNewWideBuffer(const char* utf8String, size_t length);
+
+static const string& WStringToUTF8Temp(const wstring& wString)
+{
+    return WStringToUTF8Temp(wString.data(), wString.length());
+}
+
+static const wstring& UTF8ToWStringTemp(const string& utf8String)
+{
+    return UTF8ToWStringTemp(utf8String.data(), utf8String.length());
+}
+
 static string WStringToUTF8(LPCWSTR wString)
 {
-    wstring_convert<std::codecvt_utf8<wchar_t>> converter;
-    const string utf8_string = converter.to_bytes(wString);
-    return utf8_string;
+    string utf8String;
+    WStringToUTF8(wString, wcslen(wString), utf8String);
+    return utf8String;
 }
 
 static string WStringToUTF8(const wstring& wString)
 {
-    return WStringToUTF8(wString.c_str());
+    string utf8String;
+    WStringToUTF8(wString.data(), wString.length(), utf8String);
+    return utf8String;
 }
 
 static wstring UTF8ToWString(LPCSTR utf8String)
-{    
-    // There is an issue in VS2015 that messes up codecvt. For a bit of info
-    // and the workaround, see here:
-    // https://social.msdn.microsoft.com/Forums/en-US/8f40dcd8-c67f-4eba-9134-a19b9178e481/vs-2015-rc-linker-stdcodecvt-error?forum=vcgeneral
-    // These two lines are the correct (and currently broken) form:
-    //std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> utf16conv;
-    //std::u16string utf16 = utf16conv.from_bytes(utf8String);
-    // And these two lines are the workaround:
-    std::wstring_convert<std::codecvt_utf8_utf16<__int16>, __int16> utf16conv;
-    basic_string<__int16, char_traits<__int16>, allocator<__int16> > utf16 = utf16conv.from_bytes(utf8String);
-
-    wstring wide_string(utf16.begin(), utf16.end());
-    return wide_string;
+{
+    wstring wString;
+    UTF8ToWString(utf8String, strlen(utf8String), wString);
+    return wString;
 }
 
 static wstring UTF8ToWString(const string& utf8String)
 {
-    return UTF8ToWString(utf8String.c_str());
+    wstring wString;
+    UTF8ToWString(utf8String.data(), utf8String.length(), wString);
+    return wString;
 }
 
 // This function is used to handle UTF-8 encoded data stored inside of a wstring
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "tunnel_metrics.h"
+#include "diagnostic_info.h"
+#include "httpsrequest.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+#define TUNNEL_METRICS_SUMMARY_INTERVAL_MS  60000
+// Weight of each new request latency in the smoothed value, out of 8
+#define TUNNEL_METRICS_LATENCY_WEIGHT       2
+// Destination buckets kept, and how many of the largest go in a sample
+#define TUNNEL_METRICS_MAX_DESTINATIONS     200
+#define TUNNEL_METRICS_TOP_DESTINATIONS     10
+
+
+// Smoothed phase times of one endpoint's requests
+struct RequestTimingStats
+{
+    unsigned int count;
+    DWORD dnsMs;
+    DWORD connectMs;
+    DWORD tlsMs;
+    DWORD ttfbMs;
+    DWORD transferMs;
+
+    RequestTimingStats() : count(0), dnsMs(0), connectMs(0), tlsMs(0), ttfbMs(0), transferMs(0) {}
+
+    Json::Value ToJson() const
+    {
+        Json::Value json;
+        json["count"] = count;
+        json["dnsMs"] = (Json::UInt)dnsMs;
+        json["connectMs"] = (Json::UInt)connectMs;
+        json["tlsMs"] = (Json::UInt)tlsMs;
+        json["ttfbMs"] = (Json::UInt)ttfbMs;
+        json["transferMs"] = (Json::UInt)transferMs;
+        return json;
+    }
+};
+
+struct TunnelMetricsCounters
+{
+    unsigned long long bytesSent;
+    unsigned long long bytesReceived;
+    unsigned long long bytesProxied;
+    int tunnelCount;
+    int tunnelTarget;
+    map<string, unsigned int> errors;
+    unsigned int errorCount;
+    // Smoothed, and the latest; 0 if there's been no request
+    DWORD requestLatencyMs;
+    DWORD lastRequestLatencyMs;
+    // Keyed by endpoint
+    map<string, RequestTimingStats> requestTimings;
+
+    TunnelMetricsCounters() { Clear(); }
+
+    void Clear()
+    {
+        bytesSent = bytesReceived = bytesProxied = 0;
+        tunnelCount = tunnelTarget = 0;
+        errors.clear();
+        errorCount = 0;
+        requestLatencyMs = lastRequestLatencyMs = 0;
+        requestTimings.clear();
+    }
+};
+
+static Lock g_tunnelMetricsLock("TunnelMetrics");
+// Totals since the last Reset
+static TunnelMetricsCounters g_tunnelMetrics;
+// Set by any change, cleared by Sample
+static bool g_tunnelMetricsChanged = false;
+// The totals as of the last Sample, and of the last summary
+static TunnelMetricsCounters g_tunnelMetricsAtSample;
+static TunnelMetricsCounters g_tunnelMetricsAtSummary;
+static DWORD g_tunnelMetricsSampleTime = 0;
+static DWORD g_tunnelMetricsSummaryTime = 0;
+// Whether the last sample had nonzero rates, in which case the next one
+// (with zero rates) is news even if nothing else changed.
+static bool g_tunnelMetricsWasActive = false;
+// Highest received rate sampled since the last TakePeakReceiveRate
+static unsigned long long g_tunnelMetricsPeakReceiveRate = 0;
+// Bytes per stats bucket since the last Reset. Not in the counters, as it
+// needn't be copied at each sample, and it's kept out of the diagnostic info.
+static map<string, unsigned long long> g_tunnelMetricsDestinationBytes;
+
+
+// static
+void TunnelMetrics::AddTunnelBytes(unsigned long long sent, unsigned long long received)
+{
+    if (sent == 0 && received == 0)
+    {
+        return;
+    }
+
+    AutoLock lock(g_tunnelMetricsLock);
+    g_tunnelMetrics.bytesSent += sent;
+    g_tunnelMetrics.bytesReceived += received;
+    g_tunnelMetricsChanged = true;
+}
+
+// static
+void TunnelMetrics::AddProxiedBytes(unsigned long long bytes)
+{
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    AutoLock lock(g_tunnelMetricsLock);
+    g_tunnelMetrics.bytesProxied += bytes;
+    g_tunnelMetricsChanged = true;
+}
+
+// static
+void TunnelMetrics::SetTunnelCount(int count, int target)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+    if (g_tunnelMetrics.tunnelCount != count || g_tunnelMetrics.tunnelTarget != target)
+    {
+        g_tunnelMetrics.tunnelCount = count;
+        g_tunnelMetrics.tunnelTarget = target;
+        g_tunnelMetricsChanged = true;
+    }
+}
+
+// static
+void TunnelMetrics::AddError(const char* source)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+    g_tunnelMetrics.errors[source]++;
+    g_tunnelMetrics.errorCount++;
+    g_tunnelMetricsChanged = true;
+}
+
+// static
+void TunnelMetrics::AddDestinationBytes(const string& bucket, unsigned long long bytes)
+{
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    AutoLock lock(g_tunnelMetricsLock);
+
+    auto it = g_tunnelMetricsDestinationBytes.find(bucket);
+    if (it == g_tunnelMetricsDestinationBytes.end())
+    {
+        const string& key = g_tunnelMetricsDestinationBytes.size() < TUNNEL_METRICS_MAX_DESTINATIONS
+                            ? bucket : string("(OTHER)");
+        it = g_tunnelMetricsDestinationBytes.insert(make_pair(key, 0ULL)).first;
+    }
+    it->second += bytes;
+    g_tunnelMetricsChanged = true;
+}
+
+// Folds milliseconds into a smoothed value, which is 0 until the first one.
+static void SmoothLatency(DWORD& smoothed, DWORD milliseconds)
+{
+    if (smoothed == 0)
+    {
+        smoothed = milliseconds;
+    }
+    else
+    {
+        smoothed = (DWORD)(((unsigned long long)smoothed * (8 - TUNNEL_METRICS_LATENCY_WEIGHT)
+                            + (unsigned long long)milliseconds * TUNNEL_METRICS_LATENCY_WEIGHT) / 8);
+    }
+}
+
+// static
+void TunnelMetrics::AddRequestLatency(DWORD milliseconds)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+
+    SmoothLatency(g_tunnelMetrics.requestLatencyMs, milliseconds);
+    g_tunnelMetrics.lastRequestLatencyMs = milliseconds;
+    g_tunnelMetricsChanged = true;
+}
+
+// static
+void TunnelMetrics::AddRequestTiming(const string& endpoint, const HTTPSRequestTiming& timing)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+
+    RequestTimingStats& stats = g_tunnelMetrics.requestTimings[endpoint];
+    // Reused connections have no DNS, connect or TLS time to average in.
+    if (!timing.reusedConnection)
+    {
+        SmoothLatency(stats.dnsMs, timing.dns);
+        SmoothLatency(stats.connectMs, timing.connect);
+        SmoothLatency(stats.tlsMs, timing.tls);
+    }
+    SmoothLatency(stats.ttfbMs, timing.ttfb);
+    SmoothLatency(stats.transferMs, timing.transfer);
+    stats.count++;
+    g_tunnelMetricsChanged = true;
+}
+
+// Bytes per second, given a byte count over elapsedMs
+static Json::UInt64 BytesPerSecond(unsigned long long bytes, DWORD elapsedMs)
+{
+    return elapsedMs > 0 ? (Json::UInt64)(bytes * 1000 / elapsedMs) : 0;
+}
+
+// Must be called with g_tunnelMetricsLock held
+static void AddTunnelMetricsSummary(DWORD now)
+{
+    const TunnelMetricsCounters& current = g_tunnelMetrics;
+    const TunnelMetricsCounters& previous = g_tunnelMetricsAtSummary;
+    DWORD elapsedMs = now - g_tunnelMetricsSummaryTime;
+
+    unsigned long long sent = current.bytesSent - previous.bytesSent;
+    unsigned long long received = current.bytesReceived - previous.bytesReceived;
+    unsigned long long proxied = current.bytesProxied - previous.bytesProxied;
+    unsigned int errorCount = current.errorCount - previous.errorCount;
+
+    // Idle minutes aren't worth recording.
+    if (sent > 0 || received > 0 || proxied > 0 || errorCount > 0)
+    {
+        Json::Value summary;
+        summary["intervalMs"] = (Json::UInt)elapsedMs;
+        summary["bytesSent"] = (Json::UInt64)sent;
+        summary["bytesReceived"] = (Json::UInt64)received;
+        summary["bytesProxied"] = (Json::UInt64)proxied;
+        summary["tunnels"] = current.tunnelCount;
+        summary["requestLatencyMs"] = (Json::UInt)current.requestLatencyMs;
+        summary["errors"] = Json::Value(Json::objectValue);
+        for (auto it = current.errors.begin(); it != current.errors.end(); ++it)
+        {
+            auto before = previous.errors.find(it->first);
+            unsigned int count = it->second - (before == previous.errors.end() ? 0 : before->second);
+            if (count > 0)
+            {
+                summary["errors"][it->first] = count;
+            }
+        }
+        summary["requestTimings"] = Json::Value(Json::objectValue);
+        for (auto it = current.requestTimings.begin(); it != current.requestTimings.end(); ++it)
+        {
+            auto before = previous.requestTimings.find(it->first);
+            if (before == previous.requestTimings.end() || before->second.count != it->second.count)
+            {
+                summary["requestTimings"][it->first] = it->second.ToJson();
+            }
+        }
+        AddDiagnosticInfoJson("TunnelMetrics", summary);
+    }
+
+    g_tunnelMetricsAtSummary = current;
+    g_tunnelMetricsSummaryTime = now;
+}
+
+// static
+bool TunnelMetrics::Sample(Json::Value& o_sample)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+
+    DWORD now = GetTickCount();
+
+    if (g_tunnelMetricsSampleTime == 0)
+    {
+        // First sample since a reset: there's nothing to get a rate over yet.
+        g_tunnelMetricsSampleTime = g_tunnelMetricsSummaryTime = now;
+    }
+    else if (now - g_tunnelMetricsSummaryTime >= TUNNEL_METRICS_SUMMARY_INTERVAL_MS)
+    {
+        AddTunnelMetricsSummary(now);
+    }
+
+    if (!g_tunnelMetricsChanged && !g_tunnelMetricsWasActive)
+    {
+        return false;
+    }
+
+    const TunnelMetricsCounters& current = g_tunnelMetrics;
+    const TunnelMetricsCounters& previous = g_tunnelMetricsAtSample;
+    DWORD elapsedMs = now - g_tunnelMetricsSampleTime;
+
+    Json::UInt64 sentRate = BytesPerSecond(current.bytesSent - previous.bytesSent, elapsedMs);
+    Json::UInt64 receivedRate = BytesPerSecond(current.bytesReceived - previous.bytesReceived, elapsedMs);
+    Json::UInt64 proxiedRate = BytesPerSecond(current.bytesProxied - previous.bytesProxied, elapsedMs);
+
+    o_sample = Json::Value(Json::objectValue);
+    o_sample["bytesSentPerSecond"] = sentRate;
+    o_sample["bytesReceivedPerSecond"] = receivedRate;
+    o_sample["bytesProxiedPerSecond"] = proxiedRate;
+    o_sample["bytesSent"] = (Json::UInt64)current.bytesSent;
+    o_sample["bytesReceived"] = (Json::UInt64)current.bytesReceived;
+    o_sample["tunnels"] = current.tunnelCount;
+    o_sample["tunnelsTarget"] = current.tunnelTarget;
+    o_sample["errors"] = current.errorCount;
+    o_sample["requestLatencyMs"] = (Json::UInt)current.requestLatencyMs;
+    o_sample["lastRequestLatencyMs"] = (Json::UInt)current.lastRequestLatencyMs;
+    o_sample["requestTimings"] = Json::Value(Json::objectValue);
+    for (auto it = current.requestTimings.begin(); it != current.requestTimings.end(); ++it)
+    {
+        o_sample["requestTimings"][it->first] = it->second.ToJson();
+    }
+
+    // Largest first
+    vector<pair<unsigned long long, string>> destinations;
+    destinations.reserve(g_tunnelMetricsDestinationBytes.size());
+    for (auto it = g_tunnelMetricsDestinationBytes.begin(); it != g_tunnelMetricsDestinationBytes.end(); ++it)
+    {
+        destinations.push_back(make_pair(it->second, it->first));
+    }
+    size_t topCount = min(destinations.size(), (size_t)TUNNEL_METRICS_TOP_DESTINATIONS);
+    partial_sort(destinations.begin(), destinations.begin() + topCount, destinations.end(),
+                 [](const pair<unsigned long long, string>& a, const pair<unsigned long long, string>& b) { return a.first > b.first; });
+    o_sample["destinations"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < topCount; i++)
+    {
+        Json::Value destination;
+        destination["bucket"] = destinations[i].second;
+        destination["bytes"] = (Json::UInt64)destinations[i].first;
+        o_sample["destinations"].append(destination);
+    }
+
+    g_tunnelMetricsAtSample = current;
+    g_tunnelMetricsSampleTime = now;
+    g_tunnelMetricsChanged = false;
+    g_tunnelMetricsWasActive = sentRate > 0 || receivedRate > 0 || proxiedRate > 0;
+    g_tunnelMetricsPeakReceiveRate = max(g_tunnelMetricsPeakReceiveRate, (unsigned long long)receivedRate);
+
+    return true;
+}
+
+// static
+unsigned long long TunnelMetrics::TakePeakReceiveRate()
+{
+    AutoLock lock(g_tunnelMetricsLock);
+    unsigned long long peak = g_tunnelMetricsPeakReceiveRate;
+    g_tunnelMetricsPeakReceiveRate = 0;
+    return peak;
+}
+
+// static
+void TunnelMetrics::GetTotals(
+                        unsigned long long& o_bytesSent,
+                        unsigned long long& o_bytesReceived,
+                        int& o_tunnelCount)
+{
+    AutoLock lock(g_tunnelMetricsLock);
+    o_bytesSent = g_tunnelMetrics.bytesSent;
+    o_bytesReceived = g_tunnelMetrics.bytesReceived;
+    o_tunnelCount = g_tunnelMetrics.tunnelCount;
+}
+
+// static
+void TunnelMetrics::Reset()
+{
+    AutoLock lock(g_tunnelMetricsLock);
+
+    // Don't lose the partial minute.
+    if (g_tunnelMetricsSummaryTime != 0)
+    {
+        AddTunnelMetricsSummary(GetTickCount());
+    }
+
+    g_tunnelMetrics.Clear();
+    g_tunnelMetricsAtSample.Clear();
+    g_tunnelMetricsAtSummary.Clear();
+    g_tunnelMetricsSampleTime = 0;
+    g_tunnelMetricsSummaryTime = 0;
+    g_tunnelMetricsWasActive = false;
+    g_tunnelMetricsPeakReceiveRate = 0;
+    g_tunnelMetricsDestinationBytes.clear();
+    // So the UI gets the cleared values
+    g_tunnelMetricsChanged = true;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+struct HTTPSRequestTiming;
+
+
+/*
+Live throughput and health of the current connection, for the UI to poll and
+show (transfer rates, tunnel count, errors) while connected.
+
+The transports feed it as traffic and events happen; only the main connection
+does, never temp tunnels. Sample is called about once a second; each call
+gives the rates since the previous one, and about once a minute a summary of
+that minute goes into the diagnostic info.
+
+Threadsafe. The feed calls are cheap, so they're fine on hot paths.
+*/
+class TunnelMetrics
+{
+public:
+    // Bytes carried by the tunnel itself, as reported by the tunnel core
+    static void AddTunnelBytes(unsigned long long sent, unsigned long long received);
+
+    // Bytes through the local HTTP proxy
+    static void AddProxiedBytes(unsigned long long bytes);
+
+    // Bytes through the local HTTP proxy for one page view or HTTPS request
+    // stats bucket (as the stats classify it). The largest are in the sample,
+    // for the UI only; they're never in the diagnostic info.
+    static void AddDestinationBytes(const string& bucket, unsigned long long bytes);
+
+    // Number of tunnels currently established, out of the number wanted
+    static void SetTunnelCount(int count, int target);
+
+    // source names what failed (e.g., "UpstreamProxyError"); errors are
+    // counted per source.
+    static void AddError(const char* source);
+
+    // How long a request through the tunnel took. The tunnel core doesn't
+    // report round trip times, so this is the best estimate there is.
+    static void AddRequestLatency(DWORD milliseconds);
+
+    // The phases of a request the client made itself, aggregated per
+    // endpoint (e.g., "handshake", "psicash"), so that the tunnel's share of
+    // the time (connect, TLS) can be told apart from the server's (TTFB).
+    static void AddRequestTiming(const string& endpoint, const HTTPSRequestTiming& timing);
+
+    // Fills o_sample with the current metrics. Returns false, leaving
+    // o_sample alone, if nothing has changed since the last sample -- e.g.,
+    // when idle or not connected -- so there's nothing new to show.
+    static bool Sample(Json::Value& o_sample);
+
+    // The highest received rate seen by Sample since the last call (or
+    // Reset), in bytes per second. Clears it.
+    static unsigned long long TakePeakReceiveRate();
+
+    // Totals since the last Reset, and the current tunnel count
+    static void GetTotals(
+                    unsigned long long& o_bytesSent,
+                    unsigned long long& o_bytesReceived,
+                    int& o_tunnelCount);
+
+    // Clears everything; done when the connection stops.
+    static void Reset();
+};
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "tunnel_quality.h"
+#include "httpsrequest.h"
+#include "serverlist.h"
+#include "stopsignal.h"
+#include "thread_pool.h"
+#include "timer_service.h"
+#include "tunnel_metrics.h"
+#include "diagnostic_info.h"
+#include "tracing.h"
+#include "logging.h"
+#include "utilities.h"
+#include <algorithm>
+
+
+#define TUNNEL_QUALITY_CHECK_INTERVAL_MS        15000
+#define TUNNEL_QUALITY_FIRST_MEASUREMENT_MS     60000
+#define TUNNEL_QUALITY_INTERVAL_MS              (30*60*1000)
+#define TUNNEL_QUALITY_REQUEST_COUNT            3
+// Any response will do -- only its timing is used -- so this needn't exist.
+#define TUNNEL_QUALITY_REQUEST_PATH             _T("/")
+// A round trip counts as inflated if it's both this many times the session's
+// best and this much more than it.
+#define TUNNEL_QUALITY_INFLATION_FACTOR         3
+#define TUNNEL_QUALITY_INFLATION_MIN_MS         500
+// Consecutive bad measurements before the tunnel is reported as degraded.
+// With a measurement per check, that's sustained for about 30 seconds.
+#define TUNNEL_QUALITY_DEGRADED_MEASUREMENTS    3
+
+
+static Lock g_tunnelQualityLock("TunnelQuality");
+static shared_ptr<const SessionInfo> g_tunnelQualitySession;
+static string g_tunnelQualityServerList;
+static std::function<void()> g_tunnelQualityOnDegraded;
+// Bumped by Start and Stop, so a measurement that outlives its session
+// doesn't record against the next one.
+static unsigned int g_tunnelQualityGeneration = 0;
+static bool g_tunnelQualityMeasuring = false;
+static TimerService::TimerID g_tunnelQualityTimer = 0;
+static TunnelQuality::Sample g_tunnelQualityLastSample;
+
+// Degradation tracking, per Start
+struct TunnelQualityState
+{
+    DWORD startTime;
+    DWORD lastMeasureTime;      // 0 until the first measurement
+    DWORD bestLatencyMs;        // 0 until there's been a response
+    unsigned int badMeasurements;
+    bool suspect;               // Measure on the next check
+    bool degradedReported;
+    unsigned long long bytesSent;
+    unsigned long long bytesReceived;
+
+    TunnelQualityState() { Clear(); }
+
+    void Clear()
+    {
+        startTime = lastMeasureTime = 0;
+        bestLatencyMs = 0;
+        badMeasurements = 0;
+        suspect = degradedReported = false;
+        bytesSent = bytesReceived = 0;
+    }
+};
+
+static TunnelQualityState g_tunnelQualityState;
+
+
+// static
+void TunnelQuality::Start(
+                        shared_ptr<const SessionInfo> sessionInfo,
+                        const string& serverListName,
+                        std::function<void()> onDegraded)
+{
+    Stop();
+
+    AutoLock lock(g_tunnelQualityLock);
+
+    g_tunnelQualitySession = sessionInfo;
+    g_tunnelQualityServerList = serverListName;
+    g_tunnelQualityOnDegraded = onDegraded;
+    g_tunnelQualityGeneration++;
+    g_tunnelQualityLastSample = Sample();
+    g_tunnelQualityState.Clear();
+    g_tunnelQualityState.startTime = GetTickCount();
+
+    g_tunnelQualityTimer = TimerService::Instance().Schedule(
+                                TUNNEL_QUALITY_CHECK_INTERVAL_MS,
+                                TUNNEL_QUALITY_CHECK_INTERVAL_MS,
+                                CheckTimerCallback);
+    if (!g_tunnelQualityTimer)
+    {
+        // MeasureNow still works.
+        my_print(NOT_SENSITIVE, true, _T("%s: TimerService::Schedule failed"), __TFUNCTION__);
+    }
+}
+
+// static
+void TunnelQuality::Stop()
+{
+    TimerService::TimerID timer = 0;
+
+    {
+        AutoLock lock(g_tunnelQualityLock);
+        timer = g_tunnelQualityTimer;
+        g_tunnelQualityTimer = 0;
+        g_tunnelQualitySession.reset();
+        g_tunnelQualityOnDegraded = nullptr;
+        g_tunnelQualityGeneration++;
+    }
+
+    // Not done under the lock, as the callback takes it.
+    if (timer)
+    {
+        TimerService::Instance().Cancel(timer);
+    }
+}
+
+// static
+bool TunnelQuality::MeasureNow()
+{
+    unsigned int generation = 0;
+
+    {
+        AutoLock lock(g_tunnelQualityLock);
+        if (!g_tunnelQualitySession || g_tunnelQualityMeasuring)
+        {
+            return false;
+        }
+        generation = g_tunnelQualityGeneration;
+    }
+
+    return ThreadPool::Instance().Post([generation]() { Measure(generation); });
+}
+
+// static
+bool TunnelQuality::GetLastSample(Sample& o_sample)
+{
+    AutoLock lock(g_tunnelQualityLock);
+    if (g_tunnelQualityLastSample.time == 0)
+    {
+        return false;
+    }
+    o_sample = g_tunnelQualityLastSample;
+    return true;
+}
+
+// static
+void TunnelQuality::Measure(unsigned int generation)
+{
+    shared_ptr<const SessionInfo> sessionInfo;
+    string serverListName;
+
+    {
+        AutoLock lock(g_tunnelQualityLock);
+        if (generation != g_tunnelQualityGeneration
+            || !g_tunnelQualitySession
+            || g_tunnelQualityMeasuring)
+        {
+            return;
+        }
+        g_tunnelQualityMeasuring = true;
+        sessionInfo = g_tunnelQualitySession;
+        serverListName = g_tunnelQualityServerList;
+    }
+
+    auto doneMeasuring = finally([]
+    {
+        AutoLock lock(g_tunnelQualityLock);
+        g_tunnelQualityMeasuring = false;
+    });
+
+    // The first request pays for the TLS handshake; later ones reuse the
+    // pooled session, so the lowest is the best estimate of the round trip.
+    DWORD bestLatency = MAXDWORD;
+    int responses = 0;
+
+    try
+    {
+        for (int i = 0; i < TUNNEL_QUALITY_REQUEST_COUNT; i++)
+        {
+            HTTPSRequest httpsRequest(true); // silent
+            HTTPSRequest::Response httpsResponse;
+            DWORD start = GetTickCount();
+            if (httpsRequest.MakeRequest(
+                    UTF8ToWString(sessionInfo->GetServerAddress()).c_str(),
+                    sessionInfo->GetWebPort(),
+                    sessionInfo->GetWebServerCertificate(),
+                    TUNNEL_QUALITY_REQUEST_PATH,
+                    StopInfo(&GlobalStopSignal::Instance(), STOP_REASON_ALL),
+                    HTTPSRequest::PsiphonProxy::REQUIRE,
+                    httpsResponse))
+            {
+                // Whatever the status code, the round trip was made.
+                bestLatency = min(bestLatency, GetTickCount() - start);
+                responses++;
+            }
+        }
+    }
+    catch (StopSignal::StopException&)
+    {
+        return;
+    }
+
+    unsigned long long peakRate = TunnelMetrics::TakePeakReceiveRate();
+    std::function<void()> onDegraded;
+    bool bad = false;
+
+    {
+        AutoLock lock(g_tunnelQualityLock);
+        if (generation != g_tunnelQualityGeneration)
+        {
+            return;
+        }
+
+        TunnelQualityState& state = g_tunnelQualityState;
+        state.lastMeasureTime = GetTickCount();
+
+        if (responses == 0)
+        {
+            // Some servers don't serve their web port through the tunnel;
+            // that only counts as bad if this one has responded before.
+            bad = state.bestLatencyMs != 0;
+        }
+        else
+        {
+            bad = state.bestLatencyMs != 0
+                  && bestLatency >= state.bestLatencyMs * TUNNEL_QUALITY_INFLATION_FACTOR
+                  && bestLatency >= state.bestLatencyMs + TUNNEL_QUALITY_INFLATION_MIN_MS;
+            if (state.bestLatencyMs == 0 || bestLatency < state.bestLatencyMs)
+            {
+                state.bestLatencyMs = bestLatency;
+            }
+
+            g_tunnelQualityLastSample.latencyMs = bestLatency;
+            g_tunnelQualityLastSample.peakBytesPerSecond = peakRate;
+            g_tunnelQualityLastSample.time = GetTickCount();
+        }
+
+        state.badMeasurements = bad ? state.badMeasurements + 1 : 0;
+        state.suspect = bad;
+
+        if (state.badMeasurements >= TUNNEL_QUALITY_DEGRADED_MEASUREMENTS
+            && !state.degradedReported)
+        {
+            state.degradedReported = true;
+            onDegraded = g_tunnelQualityOnDegraded;
+        }
+    }
+
+    if (responses == 0)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: no responses"), __TFUNCTION__);
+        TunnelMetrics::AddError("TunnelQuality");
+    }
+    else
+    {
+        ServerList(serverListName.c_str()).RecordTunnelQuality(
+            sessionInfo->GetServerAddress(), bestLatency, peakRate);
+
+        my_print(NOT_SENSITIVE, true, _T("%s: latency %d ms, peak %llu bytes/s"), __TFUNCTION__, bestLatency, peakRate);
+        TRACE_EVENT(TRACE_KEYWORD_TRANSPORT, _T("TunnelQuality: latency %d ms, peak %llu bytes/s"), bestLatency, peakRate);
+
+        Json::Value json;
+        json["latencyMs"] = (Json::UInt)bestLatency;
+        json["peakBytesPerSecond"] = (Json::UInt64)peakRate;
+        json["responses"] = responses;
+        json["transport"] = serverListName;
+        json["degraded"] = bad;
+        AddDiagnosticInfoJson("TunnelQuality", json);
+    }
+
+    if (onDegraded)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: tunnel quality degraded"), __TFUNCTION__);
+        TRACE_EVENT(TRACE_KEYWORD_TRANSPORT, _T("TunnelQuality: degraded"));
+        onDegraded();
+    }
+}
+
+// static
+void TunnelQuality::CheckTimerCallback()
+{
+    unsigned long long bytesSent = 0, bytesReceived = 0;
+    int tunnelCount = 0;
+    TunnelMetrics::GetTotals(bytesSent, bytesReceived, tunnelCount);
+
+    unsigned int generation = 0;
+    bool measure = false;
+
+    {
+        AutoLock lock(g_tunnelQualityLock);
+
+        TunnelQualityState& state = g_tunnelQualityState;
+        DWORD now = GetTickCount();
+
+        // Traffic going out with nothing at all coming back means requests
+        // are waiting on a stalled tunnel. Only the tunnel core reports
+        // bytes, and while it has no tunnel it's already reconnecting.
+        bool stalled = tunnelCount > 0
+                       && bytesSent > state.bytesSent
+                       && bytesReceived == state.bytesReceived;
+        state.bytesSent = bytesSent;
+        state.bytesReceived = bytesReceived;
+
+        bool due = now - state.startTime >= TUNNEL_QUALITY_FIRST_MEASUREMENT_MS
+                   && (state.lastMeasureTime == 0
+                       || now - state.lastMeasureTime >= TUNNEL_QUALITY_INTERVAL_MS);
+
+        measure = stalled || state.suspect || due;
+        generation = g_tunnelQualityGeneration;
+    }
+
+    if (measure)
+    {
+        Measure(generation);
+    }
+}
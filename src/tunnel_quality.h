@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <functional>
+#include "sessioninfo.h"
+
+
+/*
+Measures the quality of the established tunnel: the round trip time of
+requests through it to the connected server's web port, and the highest
+throughput the tunnel has been seen to carry. Results are kept per server in
+the transport's server list, where they feed into server scoring.
+
+Measurements are made a minute after connecting and then periodically while
+connected, and can also be asked for. They're light: a few small requests,
+with no synthetic download -- the server web port has nothing to download,
+so throughput is what real traffic achieved (a lower bound on capacity).
+
+It also watches for the tunnel degrading while still connected: round trips
+inflated well beyond the best seen this session, or bytes going out with
+nothing coming back. Either makes the next check measure again rather than
+waiting for the next periodic measurement; when several measurements in a
+row are bad, the degradation is reported, once per Start.
+
+Threadsafe.
+*/
+class TunnelQuality
+{
+public:
+    struct Sample
+    {
+        // Lowest round trip of the measurement's requests
+        DWORD latencyMs;
+        // Highest received rate since the previous measurement
+        unsigned long long peakBytesPerSecond;
+        DWORD time; // GetTickCount() when taken
+
+        Sample() : latencyMs(0), peakBytesPerSecond(0), time(0) {}
+    };
+
+    // Starts measuring the tunnel to sessionInfo's server. serverListName is
+    // the transport's server list (its protocol name). onDegraded is called,
+    // on a timer thread, if the tunnel's quality stays degraded; it must not
+    // call Stop.
+    static void Start(
+                    shared_ptr<const SessionInfo> sessionInfo,
+                    const string& serverListName,
+                    std::function<void()> onDegraded);
+
+    // Stops measuring, waiting for a check in progress.
+    static void Stop();
+
+    // Makes a measurement now, in the background. Returns false if not
+    // started, or if one is already in progress.
+    static bool MeasureNow();
+
+    // The latest successful measurement since Start. Returns false if
+    // there's none.
+    static bool GetLastSample(Sample& o_sample);
+
+private:
+    static void Measure(unsigned int generation);
+    static void CheckTimerCallback();
+};
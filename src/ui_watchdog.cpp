@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "stdafx.h"
+#include "ui_watchdog.h"
+#include "psiclient.h"
+#include "diagnostic_info.h"
+#include "logging.h"
+#include "utilities.h"
+#include "performance_budget.h"
+
+
+#define UI_WATCHDOG_CHECK_INTERVAL_MS       100
+#define UI_WATCHDOG_PING_INTERVAL_MS        1000
+// Long enough to feel like the UI is stuck
+#define UI_WATCHDOG_STALL_THRESHOLD_MS      250
+#define UI_WATCHDOG_SUMMARY_INTERVAL_MS     (5 * 60 * 1000)
+// Fewer pings in an interval than this (e.g., while suspended) say too little
+// about the 99th percentile to count against its budget.
+#define UI_WATCHDOG_MIN_PINGS_FOR_P99       100
+
+// Upper bounds of the ping latency histogram buckets; the last bucket is
+// everything above the last bound.
+static const DWORD UI_WATCHDOG_HISTOGRAM_BOUNDS_MS[] = { 16, 50, 100, 250, 500, 1000, 2000, 5000 };
+#define UI_WATCHDOG_HISTOGRAM_BUCKETS   (sizeof(UI_WATCHDOG_HISTOGRAM_BOUNDS_MS) / sizeof(DWORD) + 1)
+
+// Stalls blamed on one message
+struct UIStallStats
+{
+    unsigned int count;
+    DWORD totalMs;
+    DWORD maxMs;
+
+    UIStallStats() : count(0), totalMs(0), maxMs(0) {}
+};
+
+// Only written by the main window thread. A pointer write is atomic, so the
+// timer thread can read it without a lock; it's only ever a literal.
+static const char* volatile g_uiWatchdogDispatching = NULL;
+
+static Lock g_uiWatchdogLock("UIWatchdog");
+static HWND g_uiWatchdogWindow = NULL;
+static HANDLE g_uiWatchdogTimer = NULL;
+static bool g_uiWatchdogPingPending = false;
+// When the pending ping was posted, or the last one was handled
+static DWORD g_uiWatchdogPingTime = 0;
+// What was being dispatched when the pending ping was found to be late;
+// NULL if it isn't (yet)
+static const char* g_uiWatchdogStallCulprit = NULL;
+// Since the last summary
+static unsigned int g_uiWatchdogHistogram[UI_WATCHDOG_HISTOGRAM_BUCKETS] = { 0 };
+static DWORD g_uiWatchdogMaxLatency = 0;
+static map<string, UIStallStats> g_uiWatchdogStalls;
+static DWORD g_uiWatchdogSummaryTime = 0;
+
+
+static void AddUIWatchdogSummaryLocked()
+{
+    Json::Value histogram(Json::arrayValue);
+    for (size_t i = 0; i < UI_WATCHDOG_HISTOGRAM_BUCKETS; i++)
+    {
+        Json::Value bucket;
+        if (i < UI_WATCHDOG_HISTOGRAM_BUCKETS - 1)
+        {
+            bucket["maxMs"] = (Json::UInt)UI_WATCHDOG_HISTOGRAM_BOUNDS_MS[i];
+        }
+        bucket["count"] = g_uiWatchdogHistogram[i];
+        histogram.append(bucket);
+    }
+
+    Json::Value stalls(Json::objectValue);
+    for (auto it = g_uiWatchdogStalls.cbegin(); it != g_uiWatchdogStalls.cend(); ++it)
+    {
+        Json::Value stall;
+        stall["count"] = it->second.count;
+        stall["totalMs"] = (Json::UInt)it->second.totalMs;
+        stall["maxMs"] = (Json::UInt)it->second.maxMs;
+        stalls[it->first] = stall;
+    }
+
+    Json::Value summary;
+    summary["pingLatency"] = histogram;
+    summary["stalls"] = stalls;
+    AddDiagnosticInfoJson("UIResponsiveness", summary);
+}
+
+// The 99th percentile ping latency, to the histogram's resolution: the upper
+// bound of the bucket it falls in, or the largest latency for the last one.
+// Returns false if there have been too few pings to tell.
+static bool GetUIWatchdogP99Locked(DWORD& o_p99)
+{
+    unsigned int total = 0;
+    for (size_t i = 0; i < UI_WATCHDOG_HISTOGRAM_BUCKETS; i++)
+    {
+        total += g_uiWatchdogHistogram[i];
+    }
+    if (total < UI_WATCHDOG_MIN_PINGS_FOR_P99)
+    {
+        return false;
+    }
+
+    // Pings beyond the 99th percentile
+    unsigned int tail = total / 100;
+    unsigned int above = 0;
+    size_t bucket = UI_WATCHDOG_HISTOGRAM_BUCKETS - 1;
+    while (bucket > 0 && above + g_uiWatchdogHistogram[bucket] <= tail)
+    {
+        above += g_uiWatchdogHistogram[bucket];
+        bucket--;
+    }
+
+    o_p99 = (bucket < UI_WATCHDOG_HISTOGRAM_BUCKETS - 1)
+            ? min(UI_WATCHDOG_HISTOGRAM_BOUNDS_MS[bucket], g_uiWatchdogMaxLatency)
+            : g_uiWatchdogMaxLatency;
+    return true;
+}
+
+static VOID CALLBACK UIWatchdogTimerCallback(PVOID /*context*/, BOOLEAN /*timerOrWaitFired*/)
+{
+    AutoLock lock(g_uiWatchdogLock);
+
+    DWORD now = GetTickCount();
+
+    if (g_uiWatchdogPingPending)
+    {
+        // Blamed on what's running when the stall is first noticed, which
+        // is what's holding things up if it's one long handler.
+        if (!g_uiWatchdogStallCulprit
+            && now - g_uiWatchdogPingTime >= UI_WATCHDOG_STALL_THRESHOLD_MS)
+        {
+            const char* dispatching = g_uiWatchdogDispatching;
+            g_uiWatchdogStallCulprit = dispatching ? dispatching : "NotDispatching";
+        }
+    }
+    else if (now - g_uiWatchdogPingTime >= UI_WATCHDOG_PING_INTERVAL_MS)
+    {
+        if (PostMessage(g_uiWatchdogWindow, WM_PSIPHON_UI_WATCHDOG_PING, 0, (LPARAM)now))
+        {
+            g_uiWatchdogPingPending = true;
+            g_uiWatchdogPingTime = now;
+        }
+    }
+
+    if (now - g_uiWatchdogSummaryTime >= UI_WATCHDOG_SUMMARY_INTERVAL_MS)
+    {
+        // No stalls is no news
+        if (!g_uiWatchdogStalls.empty())
+        {
+            AddUIWatchdogSummaryLocked();
+        }
+
+        DWORD p99 = 0;
+        if (GetUIWatchdogP99Locked(p99))
+        {
+            PerformanceBudget::Record(PERF_METRIC_UI_DISPATCH_P99, p99);
+        }
+
+        memset(g_uiWatchdogHistogram, 0, sizeof(g_uiWatchdogHistogram));
+        g_uiWatchdogMaxLatency = 0;
+        g_uiWatchdogStalls.clear();
+        g_uiWatchdogSummaryTime = now;
+    }
+}
+
+// static
+void UIWatchdog::Start(HWND hWnd)
+{
+    AutoLock lock(g_uiWatchdogLock);
+
+    if (g_uiWatchdogTimer)
+    {
+        return;
+    }
+
+    g_uiWatchdogWindow = hWnd;
+    g_uiWatchdogPingTime = g_uiWatchdogSummaryTime = GetTickCount();
+
+    if (!CreateTimerQueueTimer(
+            &g_uiWatchdogTimer,
+            NULL, // default timer queue
+            UIWatchdogTimerCallback,
+            NULL,
+            UI_WATCHDOG_CHECK_INTERVAL_MS,
+            UI_WATCHDOG_CHECK_INTERVAL_MS,
+            WT_EXECUTELONGFUNCTION))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: CreateTimerQueueTimer failed (%d)"), __TFUNCTION__, GetLastError());
+        g_uiWatchdogTimer = NULL;
+    }
+}
+
+// static
+void UIWatchdog::HandlePing(LPARAM lParam)
+{
+    DWORD now = GetTickCount();
+    DWORD latency = now - (DWORD)lParam;
+    const char* culprit = NULL;
+
+    {
+        AutoLock lock(g_uiWatchdogLock);
+
+        g_uiWatchdogPingPending = false;
+        g_uiWatchdogPingTime = now;
+
+        size_t bucket = 0;
+        while (bucket < UI_WATCHDOG_HISTOGRAM_BUCKETS - 1
+               && latency > UI_WATCHDOG_HISTOGRAM_BOUNDS_MS[bucket])
+        {
+            bucket++;
+        }
+        g_uiWatchdogHistogram[bucket]++;
+        g_uiWatchdogMaxLatency = max(g_uiWatchdogMaxLatency, latency);
+
+        culprit = g_uiWatchdogStallCulprit;
+        g_uiWatchdogStallCulprit = NULL;
+
+        if (culprit)
+        {
+            UIStallStats& stats = g_uiWatchdogStalls[culprit];
+            stats.count++;
+            stats.totalMs += latency;
+            stats.maxMs = max(stats.maxMs, latency);
+        }
+    }
+
+    if (culprit)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: UI thread stalled for %d ms in %S"), __TFUNCTION__, latency, culprit);
+    }
+}
+
+UIWatchdog::DispatchScope::DispatchScope(const char* name)
+    : m_previous(g_uiWatchdogDispatching)
+{
+    g_uiWatchdogDispatching = name;
+}
+
+UIWatchdog::DispatchScope::~DispatchScope()
+{
+    g_uiWatchdogDispatching = m_previous;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+
+/*
+Watches how responsive the main window thread is. About once a second a
+timer thread posts a ping to the message loop, and how long each one takes
+to be handled goes into a histogram. If a ping is late by more than the
+stall threshold, whatever message was being dispatched at the time is blamed
+for the stall, and the stall is logged once the ping gets through. The
+histogram and the stalls per message go into the diagnostic info every few
+minutes, if there's been a stall since the last time.
+
+Threadsafe. The dispatch scope is cheap enough to wrap every message.
+*/
+class UIWatchdog
+{
+public:
+    // Starts pinging hWnd, whose window procedure must pass
+    // WM_PSIPHON_UI_WATCHDOG_PING to HandlePing. Runs for the life of the
+    // process; only the first call does anything.
+    static void Start(HWND hWnd);
+
+    // Called on the main window thread, for WM_PSIPHON_UI_WATCHDOG_PING
+    static void HandlePing(LPARAM lParam);
+
+    // Marks the message the main window thread is dispatching, for as long
+    // as it's in scope. name must be a literal. Scopes nest, as handlers can
+    // run message loops of their own (e.g., a message box).
+    class DispatchScope
+    {
+    public:
+        DispatchScope(const char* name);
+        ~DispatchScope();
+
+    private:
+        const char* m_previous;
+    };
+};
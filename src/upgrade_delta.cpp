@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stdafx.h"
+#include "upgrade_delta.h"
+#include "logging.h"
+#include "utilities.h"
+#include <algorithm>
+
+#pragma warning(push, 0)
+#pragma warning(disable: 4244)
+#include "cryptlib.h"
+#include "sha.h"
+#pragma warning(pop)
+
+
+#define UPGRADE_DELTA_MAGIC             "PSIDLT01"
+#define UPGRADE_DELTA_MAGIC_LENGTH      8
+#define UPGRADE_DELTA_HEADER_LENGTH     (UPGRADE_DELTA_MAGIC_LENGTH + 2*CryptoPP::SHA256::DIGESTSIZE + 8)
+#define UPGRADE_DELTA_RECORD_LENGTH     12
+// Hex digits of the source hash in the delta's path; plenty to tell builds
+// apart, and the full hash is checked anyway.
+#define UPGRADE_DELTA_PATH_HASH_LENGTH  16
+#define UPGRADE_DELTA_WRITE_BUFFER_SIZE (64*1024)
+
+
+namespace {
+
+// A read-only view of a whole file. Mapped rather than read, so the binary
+// doesn't take up heap.
+class MappedFile
+{
+public:
+    MappedFile(const tstring& filename)
+        : m_file(INVALID_HANDLE_VALUE), m_mapping(NULL), m_view(NULL), m_size(0)
+    {
+        m_file = CreateFile(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        DWORD size = GetFileSize(m_file, NULL);
+        if (size == 0 || size == INVALID_FILE_SIZE)
+        {
+            return;
+        }
+
+        m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_mapping)
+        {
+            m_view = (const unsigned char*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+            m_size = m_view ? size : 0;
+        }
+    }
+
+    ~MappedFile()
+    {
+        if (m_view) UnmapViewOfFile(m_view);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+    }
+
+    // NULL if the file couldn't be mapped (or is empty)
+    const unsigned char* Data() const { return m_view; }
+    size_t Size() const { return m_size; }
+
+private:
+    HANDLE m_file;
+    HANDLE m_mapping;
+    const unsigned char* m_view;
+    size_t m_size;
+};
+
+unsigned long long ReadLittleEndian(const unsigned char* data, size_t length)
+{
+    unsigned long long value = 0;
+    for (size_t i = length; i > 0; i--)
+    {
+        value = (value << 8) | data[i - 1];
+    }
+    return value;
+}
+
+// Writes through a buffer, hashing what's written.
+class HashingWriter
+{
+public:
+    HashingWriter(HANDLE file) : m_file(file), m_failed(false)
+    {
+        m_buffer.reserve(UPGRADE_DELTA_WRITE_BUFFER_SIZE);
+    }
+
+    void Put(unsigned char byte)
+    {
+        m_buffer.push_back(byte);
+        if (m_buffer.size() == UPGRADE_DELTA_WRITE_BUFFER_SIZE)
+        {
+            Flush();
+        }
+    }
+
+    void Put(const unsigned char* data, size_t length)
+    {
+        Flush();
+        Write(data, length);
+    }
+
+    // Returns false if any write failed.
+    bool Finish(unsigned char* o_digest)
+    {
+        Flush();
+        m_hash.Final(o_digest);
+        return !m_failed;
+    }
+
+private:
+    void Flush()
+    {
+        if (!m_buffer.empty())
+        {
+            Write(&m_buffer[0], m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
+    void Write(const unsigned char* data, size_t length)
+    {
+        m_hash.Update(data, length);
+
+        DWORD written;
+        if (!m_failed
+            && (!WriteFile(m_file, data, (DWORD)length, &written, NULL) || written != length))
+        {
+            m_failed = true;
+        }
+    }
+
+    HANDLE m_file;
+    bool m_failed;
+    vector<unsigned char> m_buffer;
+    CryptoPP::SHA256 m_hash;
+};
+
+bool HashFile(const tstring& filename, unsigned char* o_digest)
+{
+    MappedFile file(filename);
+    if (!file.Data())
+    {
+        return false;
+    }
+
+    CryptoPP::SHA256().CalculateDigest(o_digest, file.Data(), file.Size());
+    return true;
+}
+
+// Applies the records, writing to writer. Returns false if the delta is
+// malformed.
+bool ApplyDeltaRecords(
+        const unsigned char* records,
+        size_t recordsLength,
+        const MappedFile& source,
+        unsigned long long targetLength,
+        HashingWriter& writer)
+{
+    const unsigned char* position = records;
+    const unsigned char* end = records + recordsLength;
+    long long sourceOffset = 0;
+    unsigned long long produced = 0;
+
+    while (produced < targetLength)
+    {
+        if ((size_t)(end - position) < UPGRADE_DELTA_RECORD_LENGTH)
+        {
+            return false;
+        }
+
+        unsigned long long diffLength = ReadLittleEndian(position, 4);
+        unsigned long long extraLength = ReadLittleEndian(position + 4, 4);
+        long long seek = (long long)(int)(unsigned int)ReadLittleEndian(position + 8, 4);
+        position += UPGRADE_DELTA_RECORD_LENGTH;
+
+        if ((unsigned long long)(end - position) < diffLength + extraLength
+            || targetLength - produced < diffLength + extraLength
+            || (diffLength > 0
+                && (sourceOffset < 0
+                    || (unsigned long long)sourceOffset + diffLength > source.Size())))
+        {
+            return false;
+        }
+
+        const unsigned char* sourceBytes = source.Data() + sourceOffset;
+        for (size_t i = 0; i < diffLength; i++)
+        {
+            writer.Put((unsigned char)(sourceBytes[i] + position[i]));
+        }
+        position += diffLength;
+
+        writer.Put(position, (size_t)extraLength);
+        position += extraLength;
+
+        produced += diffLength + extraLength;
+        sourceOffset += diffLength + seek;
+    }
+
+    return position == end;
+}
+
+} // namespace
+
+
+bool GetUpgradeDeltaRequestPath(
+        const tstring& sourceFilename,
+        const string& fullRequestPath,
+        string& o_deltaRequestPath)
+{
+    unsigned char digest[CryptoPP::SHA256::DIGESTSIZE];
+    if (!HashFile(sourceFilename, digest))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: HashFile failed (%d)"), __TFUNCTION__, GetLastError());
+        return false;
+    }
+
+    string hash = Hexlify(digest, sizeof(digest)).substr(0, UPGRADE_DELTA_PATH_HASH_LENGTH);
+    std::transform(hash.begin(), hash.end(), hash.begin(), ::tolower);
+
+    o_deltaRequestPath = fullRequestPath + "." + hash + ".delta";
+    return true;
+}
+
+bool ApplyUpgradeDelta(
+        const string& delta,
+        const tstring& sourceFilename,
+        const tstring& targetFilename)
+{
+    const unsigned char* data = (const unsigned char*)delta.data();
+    const size_t digestSize = CryptoPP::SHA256::DIGESTSIZE;
+
+    if (delta.length() < UPGRADE_DELTA_HEADER_LENGTH
+        || 0 != memcmp(data, UPGRADE_DELTA_MAGIC, UPGRADE_DELTA_MAGIC_LENGTH))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: not a delta"), __TFUNCTION__);
+        return false;
+    }
+
+    const unsigned char* sourceDigest = data + UPGRADE_DELTA_MAGIC_LENGTH;
+    const unsigned char* targetDigest = sourceDigest + digestSize;
+    unsigned long long targetLength = ReadLittleEndian(targetDigest + digestSize, 8);
+
+    MappedFile source(sourceFilename);
+    if (!source.Data())
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: can't map the current binary (%d)"), __TFUNCTION__, GetLastError());
+        return false;
+    }
+
+    unsigned char digest[digestSize];
+    CryptoPP::SHA256().CalculateDigest(digest, source.Data(), source.Size());
+    if (0 != memcmp(digest, sourceDigest, digestSize))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s: delta is for a different binary"), __TFUNCTION__);
+        return false;
+    }
+
+    bool success = false;
+
+    {
+        AutoHANDLE file = CreateFile(targetFilename.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: CreateFile failed (%d)"), __TFUNCTION__, GetLastError());
+            return false;
+        }
+
+        HashingWriter writer(file);
+        bool applied = ApplyDeltaRecords(
+                            data + UPGRADE_DELTA_HEADER_LENGTH,
+                            delta.length() - UPGRADE_DELTA_HEADER_LENGTH,
+                            source,
+                            targetLength,
+                            writer);
+        bool written = writer.Finish(digest) && FlushFileBuffers(file);
+
+        if (!applied)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: malformed delta"), __TFUNCTION__);
+        }
+        else if (!written)
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: write failed (%d)"), __TFUNCTION__, GetLastError());
+        }
+        else if (0 != memcmp(digest, targetDigest, digestSize))
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s: result doesn't match the target hash"), __TFUNCTION__);
+        }
+        else
+        {
+            success = true;
+        }
+    }
+
+    if (!success)
+    {
+        DeleteFile(targetFilename.c_str());
+    }
+
+    return success;
+}
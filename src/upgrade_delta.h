@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2015, Psiphon Inc.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+/*
+Binary delta upgrades: a new client binary described as a patch against the
+running one, which is a small fraction of the size of the full package.
+
+A delta is published next to the full upgrade package, at a path derived
+from the (SHA-256) hash of the binary it applies to, and is signed and
+compressed the same way. Its data, once Base64 decoded, is:
+
+    "PSIDLT01"
+    source SHA-256 (32 bytes), target SHA-256 (32 bytes)
+    target length (uint64)
+    records, until the target is complete:
+        diff length (uint32), extra length (uint32), seek (int32)
+        diff bytes: added, bytewise, to the source bytes at the source offset
+        extra bytes: copied as is
+        then the source offset moves by diff length plus seek
+
+That is, bsdiff's control/diff/extra scheme, interleaved and uncompressed --
+the package's gzip compresses the (mostly zero) diff bytes -- with integers
+little-endian.
+*/
+
+// The path of the delta that upgrades sourceFilename, for the full package at
+// fullRequestPath. Returns false if sourceFilename can't be hashed.
+bool GetUpgradeDeltaRequestPath(
+        const tstring& sourceFilename,
+        const string& fullRequestPath,
+        string& o_deltaRequestPath);
+
+// Applies delta to sourceFilename, writing the result to targetFilename.
+// Returns false -- leaving no targetFilename -- if the delta is malformed, is
+// for a different source, or doesn't produce the target it's for.
+bool ApplyUpgradeDelta(
+        const string& delta,
+        const tstring& sourceFilename,
+        const tstring& targetFilename);
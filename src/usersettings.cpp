@@ -57,6 +57,31 @@
 #define SKIP_AUTO_CONNECT_NAME          "SkipAutoConnect"
 #define SKIP_AUTO_CONNECT_DEFAULT       FALSE
 
+#define IN_PROCESS_HTTP_PROXY_NAME      "InProcessHttpProxy"
+#define IN_PROCESS_HTTP_PROXY_DEFAULT   FALSE
+
+#define PROXY_AUTO_CONFIG_NAME          "ProxyAutoConfig"
+#define PROXY_AUTO_CONFIG_DEFAULT       FALSE
+
+#define TRANSPORT_RACE_STAGGER_NAME     "TransportRaceStaggerMilliseconds"
+#define TRANSPORT_RACE_STAGGER_DEFAULT  0
+
+#define PERSISTENT_CORE_NAME            "PersistentCore"
+#define PERSISTENT_CORE_DEFAULT         FALSE
+
+#define TUNNEL_POOL_SIZE_NAME           "TunnelPoolSize"
+#define TUNNEL_POOL_SIZE_DEFAULT        1
+#define TUNNEL_POOL_SIZE_MAX            4
+
+#define LOCAL_PROXY_PROFILE_NAME        "LocalProxyPerformanceProfile"
+#define LOCAL_PROXY_PROFILE_DEFAULT     LOCAL_PROXY_PROFILE_STANDARD
+
+#define REPORT_TRAFFIC_BY_DESTINATION_NAME      "ReportTrafficByDestination"
+#define REPORT_TRAFFIC_BY_DESTINATION_DEFAULT   FALSE
+
+#define INCREMENTAL_FEEDBACK_NAME       "IncrementalFeedback"
+#define INCREMENTAL_FEEDBACK_DEFAULT    FALSE
+
 #define SKIP_UPSTREAM_PROXY_NAME        "SSHParentProxySkip"
 #define SKIP_UPSTREAM_PROXY_DEFAULT     FALSE
 
@@ -95,11 +120,15 @@
 #define WINDOW_PLACEMENT_DEFAULT        ""
 
 
-static HANDLE g_registryMutex = CreateMutex(NULL, FALSE, 0);
+static Lock g_registryLock("UserSettingsRegistry");
+
+// See "Settings snapshot", below
+struct SettingsSnapshot;
+static shared_ptr<const SettingsSnapshot> ReloadSettings();
 
 int GetSettingDword(const string& settingName, int defaultValue, bool writeDefault=false)
 {
-    AutoMUTEX lock(g_registryMutex);
+    AutoLock lock(g_registryLock);
 
     DWORD value = 0;
 
@@ -118,7 +147,7 @@ int GetSettingDword(const string& settingName, int defaultValue, bool writeDefau
 
 string GetSettingString(const string& settingName, string defaultValue, bool writeDefault=false)
 {
-    AutoMUTEX lock(g_registryMutex);
+    AutoLock lock(g_registryLock);
 
     string value;
 
@@ -138,7 +167,7 @@ string GetSettingString(const string& settingName, string defaultValue, bool wri
 
 wstring GetSettingString(const string& settingName, wstring defaultValue, bool writeDefault=false)
 {
-    AutoMUTEX lock(g_registryMutex);
+    AutoLock lock(g_registryLock);
 
     wstring value;
 
@@ -158,7 +187,7 @@ wstring GetSettingString(const string& settingName, wstring defaultValue, bool w
 
 bool DoesSettingExist(const string& settingName)
 {
-    AutoMUTEX lock(g_registryMutex);
+    AutoLock lock(g_registryLock);
 
     return DoesRegistryValueExist(settingName);
 }
@@ -169,6 +198,17 @@ void Settings::Initialize()
     // This is to help users find and modify them.
     (void)GetSettingDword(SKIP_PROXY_SETTINGS_NAME, SKIP_PROXY_SETTINGS_DEFAULT, true);
     (void)GetSettingDword(SKIP_AUTO_CONNECT_NAME, SKIP_AUTO_CONNECT_DEFAULT, true);
+    (void)GetSettingDword(IN_PROCESS_HTTP_PROXY_NAME, IN_PROCESS_HTTP_PROXY_DEFAULT, true);
+    (void)GetSettingDword(PROXY_AUTO_CONFIG_NAME, PROXY_AUTO_CONFIG_DEFAULT, true);
+    (void)GetSettingDword(TRANSPORT_RACE_STAGGER_NAME, TRANSPORT_RACE_STAGGER_DEFAULT, true);
+    (void)GetSettingDword(PERSISTENT_CORE_NAME, PERSISTENT_CORE_DEFAULT, true);
+    (void)GetSettingDword(TUNNEL_POOL_SIZE_NAME, TUNNEL_POOL_SIZE_DEFAULT, true);
+    (void)GetSettingDword(LOCAL_PROXY_PROFILE_NAME, LOCAL_PROXY_PROFILE_DEFAULT, true);
+    (void)GetSettingDword(REPORT_TRAFFIC_BY_DESTINATION_NAME, REPORT_TRAFFIC_BY_DESTINATION_DEFAULT, true);
+    (void)GetSettingDword(INCREMENTAL_FEEDBACK_NAME, INCREMENTAL_FEEDBACK_DEFAULT, true);
+
+    // Also starts watching for changes, from a long-lived thread
+    (void)ReloadSettings();
 }
 
 void Settings::ToJson(Json::Value& o_json)
@@ -216,9 +256,9 @@ void Settings::ToJson(Json::Value& o_json)
 // FromJson updates the stores settings from an object stored in JSON format.
 bool Settings::FromJson(
     const string& utf8JSON,
-    bool& o_reconnectRequired)
+    SettingsChangeScope& o_changeScope)
 {
-    o_reconnectRequired = false;
+    o_changeScope = SETTINGS_CHANGE_NONE;
 
     Json::Value json;
     Json::Reader reader;
@@ -230,89 +270,102 @@ bool Settings::FromJson(
         return false;
     }
 
-    bool reconnectRequiredValueChanged = false;
+    // Everything but the transport ends up in the tunnel core's config, which
+    // it only reads at startup. (The local ports are also in the system proxy
+    // settings, which the restarted tunnel applies anew.)
+    bool tunnelValueChanged = false;
+    bool transportValueChanged = false;
 
     try
     {
-        AutoMUTEX lock(g_registryMutex);
+        AutoLock lock(g_registryLock);
 
         // Note: We're purposely not bothering to check registry write return values.
 
         RegistryFailureReason failReason;
 
-        BOOL splitTunnel = json.get("SplitTunnel", SPLIT_TUNNEL_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || !!splitTunnel != Settings::SplitTunnel();
-        WriteRegistryDwordValue(SPLIT_TUNNEL_NAME, splitTunnel);
-
-        BOOL disableTimeouts = json.get("DisableTimeouts", DISABLE_TIMEOUTS_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || !!disableTimeouts != Settings::DisableTimeouts();
-        WriteRegistryDwordValue(DISABLE_TIMEOUTS_NAME, disableTimeouts);
-
-        wstring transport = json.get("VPN", TRANSPORT_DEFAULT).asUInt() ? TRANSPORT_VPN : TRANSPORT_DEFAULT;
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || transport != Settings::Transport();
-        WriteRegistryStringValue(
-            TRANSPORT_NAME,
-            transport,
-            failReason);
-
-        DWORD httpPort = json.get("LocalHttpProxyPort", HTTP_PROXY_PORT_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || httpPort != Settings::LocalHttpProxyPort();
-        WriteRegistryDwordValue(HTTP_PROXY_PORT_NAME, httpPort);
-
-        DWORD socksPort = json.get("LocalSocksProxyPort", SOCKS_PROXY_PORT_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || socksPort != Settings::LocalSocksProxyPort();
-        WriteRegistryDwordValue(SOCKS_PROXY_PORT_NAME, socksPort);
-
-        string upstreamProxyUsername = json.get("UpstreamProxyUsername", UPSTREAM_PROXY_USERNAME_DEFAULT).asString();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || upstreamProxyUsername != Settings::UpstreamProxyUsername();
-        WriteRegistryStringValue(
-            UPSTREAM_PROXY_USERNAME_NAME,
-            upstreamProxyUsername,
-            failReason);
-
-        string upstreamProxyPassword = json.get("UpstreamProxyPassword", UPSTREAM_PROXY_PASSWORD_DEFAULT).asString();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || upstreamProxyPassword != Settings::UpstreamProxyPassword();
-        WriteRegistryStringValue(
-            UPSTREAM_PROXY_PASSWORD_NAME,
-            upstreamProxyPassword,
-            failReason);
-
-        string upstreamProxyDomain = json.get("UpstreamProxyDomain", UPSTREAM_PROXY_DOMAIN_DEFAULT).asString();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || upstreamProxyDomain != Settings::UpstreamProxyDomain();
-        WriteRegistryStringValue(
-            UPSTREAM_PROXY_DOMAIN_NAME,
-            upstreamProxyDomain,
-            failReason);
-
-        string upstreamProxyHostname = json.get("UpstreamProxyHostname", UPSTREAM_PROXY_HOSTNAME_DEFAULT).asString();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || upstreamProxyHostname != Settings::UpstreamProxyHostname();
-        WriteRegistryStringValue(
-            UPSTREAM_PROXY_HOSTNAME_NAME,
-            upstreamProxyHostname,
-            failReason);
-
-        DWORD upstreamProxyPort = json.get("UpstreamProxyPort", UPSTREAM_PROXY_PORT_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || upstreamProxyPort != Settings::UpstreamProxyPort();
-        WriteRegistryDwordValue(UPSTREAM_PROXY_PORT_NAME, upstreamProxyPort);
-
-        BOOL skipUpstreamProxy = json.get("SkipUpstreamProxy", SKIP_UPSTREAM_PROXY_DEFAULT).asUInt();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || !!skipUpstreamProxy != Settings::SkipUpstreamProxy();
-        WriteRegistryDwordValue(SKIP_UPSTREAM_PROXY_NAME, skipUpstreamProxy);
-
-        string egressRegion = json.get("EgressRegion", EGRESS_REGION_DEFAULT).asString();
-        reconnectRequiredValueChanged = reconnectRequiredValueChanged || egressRegion != Settings::EgressRegion();
-        WriteRegistryStringValue(
-            EGRESS_REGION_NAME,
-            egressRegion,
-            failReason);
-
-        BOOL systrayMinimize = json.get("SystrayMinimize", SYSTRAY_MINIMIZE_DEFAULT).asUInt();
-        // Does not require reconnect to apply change.
-        WriteRegistryDwordValue(SYSTRAY_MINIMIZE_NAME, systrayMinimize);
-
-        BOOL disableDisallowedTrafficAlert = json.get("DisableDisallowedTrafficAlert", DISABLE_DISALLOWED_TRAFFIC_ALERT_DEFAULT).asUInt();
-        // Does not require reconnect to apply change.
-        WriteRegistryDwordValue(DISABLE_DISALLOWED_TRAFFIC_ALERT_NAME, disableDisallowedTrafficAlert);
+        {
+            // Written all at once, before the reload below
+            RegistryWriteBatch batch;
+
+            BOOL splitTunnel = json.get("SplitTunnel", SPLIT_TUNNEL_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || !!splitTunnel != Settings::SplitTunnel();
+            WriteRegistryDwordValue(SPLIT_TUNNEL_NAME, splitTunnel);
+
+            BOOL disableTimeouts = json.get("DisableTimeouts", DISABLE_TIMEOUTS_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || !!disableTimeouts != Settings::DisableTimeouts();
+            WriteRegistryDwordValue(DISABLE_TIMEOUTS_NAME, disableTimeouts);
+
+            wstring transport = json.get("VPN", TRANSPORT_DEFAULT).asUInt() ? TRANSPORT_VPN : TRANSPORT_DEFAULT;
+            transportValueChanged = transport != Settings::Transport();
+            WriteRegistryStringValue(
+                TRANSPORT_NAME,
+                transport,
+                failReason);
+
+            DWORD httpPort = json.get("LocalHttpProxyPort", HTTP_PROXY_PORT_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || httpPort != Settings::LocalHttpProxyPort();
+            WriteRegistryDwordValue(HTTP_PROXY_PORT_NAME, httpPort);
+
+            DWORD socksPort = json.get("LocalSocksProxyPort", SOCKS_PROXY_PORT_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || socksPort != Settings::LocalSocksProxyPort();
+            WriteRegistryDwordValue(SOCKS_PROXY_PORT_NAME, socksPort);
+
+            string upstreamProxyUsername = json.get("UpstreamProxyUsername", UPSTREAM_PROXY_USERNAME_DEFAULT).asString();
+            tunnelValueChanged = tunnelValueChanged || upstreamProxyUsername != Settings::UpstreamProxyUsername();
+            WriteRegistryStringValue(
+                UPSTREAM_PROXY_USERNAME_NAME,
+                upstreamProxyUsername,
+                failReason);
+
+            string upstreamProxyPassword = json.get("UpstreamProxyPassword", UPSTREAM_PROXY_PASSWORD_DEFAULT).asString();
+            tunnelValueChanged = tunnelValueChanged || upstreamProxyPassword != Settings::UpstreamProxyPassword();
+            WriteRegistryStringValue(
+                UPSTREAM_PROXY_PASSWORD_NAME,
+                upstreamProxyPassword,
+                failReason);
+
+            string upstreamProxyDomain = json.get("UpstreamProxyDomain", UPSTREAM_PROXY_DOMAIN_DEFAULT).asString();
+            tunnelValueChanged = tunnelValueChanged || upstreamProxyDomain != Settings::UpstreamProxyDomain();
+            WriteRegistryStringValue(
+                UPSTREAM_PROXY_DOMAIN_NAME,
+                upstreamProxyDomain,
+                failReason);
+
+            string upstreamProxyHostname = json.get("UpstreamProxyHostname", UPSTREAM_PROXY_HOSTNAME_DEFAULT).asString();
+            tunnelValueChanged = tunnelValueChanged || upstreamProxyHostname != Settings::UpstreamProxyHostname();
+            WriteRegistryStringValue(
+                UPSTREAM_PROXY_HOSTNAME_NAME,
+                upstreamProxyHostname,
+                failReason);
+
+            DWORD upstreamProxyPort = json.get("UpstreamProxyPort", UPSTREAM_PROXY_PORT_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || upstreamProxyPort != Settings::UpstreamProxyPort();
+            WriteRegistryDwordValue(UPSTREAM_PROXY_PORT_NAME, upstreamProxyPort);
+
+            BOOL skipUpstreamProxy = json.get("SkipUpstreamProxy", SKIP_UPSTREAM_PROXY_DEFAULT).asUInt();
+            tunnelValueChanged = tunnelValueChanged || !!skipUpstreamProxy != Settings::SkipUpstreamProxy();
+            WriteRegistryDwordValue(SKIP_UPSTREAM_PROXY_NAME, skipUpstreamProxy);
+
+            string egressRegion = json.get("EgressRegion", EGRESS_REGION_DEFAULT).asString();
+            tunnelValueChanged = tunnelValueChanged || egressRegion != Settings::EgressRegion();
+            WriteRegistryStringValue(
+                EGRESS_REGION_NAME,
+                egressRegion,
+                failReason);
+
+            BOOL systrayMinimize = json.get("SystrayMinimize", SYSTRAY_MINIMIZE_DEFAULT).asUInt();
+            // Does not require reconnect to apply change.
+            WriteRegistryDwordValue(SYSTRAY_MINIMIZE_NAME, systrayMinimize);
+
+            BOOL disableDisallowedTrafficAlert = json.get("DisableDisallowedTrafficAlert", DISABLE_DISALLOWED_TRAFFIC_ALERT_DEFAULT).asUInt();
+            // Does not require reconnect to apply change.
+            WriteRegistryDwordValue(DISABLE_DISALLOWED_TRAFFIC_ALERT_NAME, disableDisallowedTrafficAlert);
+        }
+
+        // Don't wait for the change notification: callers expect to see the
+        // new values right away.
+        (void)ReloadSettings();
     }
     catch (exception& e)
     {
@@ -320,57 +373,70 @@ bool Settings::FromJson(
         return false;
     }
 
-    o_reconnectRequired = reconnectRequiredValueChanged;
+    o_changeScope = transportValueChanged ? SETTINGS_CHANGE_TRANSPORT
+                    : tunnelValueChanged ? SETTINGS_CHANGE_TUNNEL
+                    : SETTINGS_CHANGE_NONE;
 
     return true;
 }
 
-bool Settings::SplitTunnel()
-{
-    return !!GetSettingDword(SPLIT_TUNNEL_NAME, SPLIT_TUNNEL_DEFAULT);
-}
-
-bool Settings::DisableTimeouts()
-{
-    return !!GetSettingDword(DISABLE_TIMEOUTS_NAME, DISABLE_TIMEOUTS_DEFAULT);
-}
+/*
+Settings snapshot
 
-tstring Settings::Transport()
-{
-    tstring transport = GetSettingString(TRANSPORT_NAME, TRANSPORT_DEFAULT);
-    if (transport != TRANSPORT_VPN)
-    {
-        transport = TRANSPORT_DEFAULT;
-    }
-    return transport;
-}
+Settings are read far more often than they change -- e.g., a connect attempt
+reads a dozen of them -- so they're read from the registry into a snapshot,
+which accessors read without locking or registry access. The snapshot is
+replaced wholesale when the settings key changes (including by FromJson).
+Cookies and the window placement aren't in it: only the UI uses them.
+*/
 
-unsigned int Settings::LocalHttpProxyPort()
+struct SettingsSnapshot
 {
-    DWORD port = GetSettingDword(HTTP_PROXY_PORT_NAME, HTTP_PROXY_PORT_DEFAULT);
-    if (port > MAX_PORT)
-    {
-        port = HTTP_PROXY_PORT_DEFAULT;
-    }
-    return (unsigned int)port;
-}
-
-unsigned int Settings::LocalSocksProxyPort()
+    bool splitTunnel;
+    bool disableTimeouts;
+    tstring transport;
+    unsigned int localHttpProxyPort;
+    unsigned int localSocksProxyPort;
+    bool skipUpstreamProxy;
+    string upstreamProxyHostname;
+    unsigned int upstreamProxyPort;
+    string upstreamProxyUsername;
+    string upstreamProxyPassword;
+    string upstreamProxyDomain;
+    string egressRegion;
+    bool systrayMinimize;
+    bool disableDisallowedTrafficAlert;
+    bool skipProxySettings;
+    bool skipAutoConnect;
+    bool inProcessHttpProxy;
+    bool proxyAutoConfig;
+    DWORD transportRaceStaggerMilliseconds;
+    bool persistentCore;
+    unsigned int tunnelPoolSize;
+    LocalProxyProfile localProxyProfile;
+    bool reportTrafficByDestination;
+    bool incrementalFeedback;
+};
+
+// Replaced with atomic_store, under g_registryLock; read with atomic_load.
+static shared_ptr<const SettingsSnapshot> g_settingsSnapshot;
+
+// Guarded by g_registryLock
+static HKEY g_settingsKey = NULL;
+static HANDLE g_settingsChangedEvent = NULL;
+static HANDLE g_settingsChangedWait = NULL;
+
+static unsigned int ReadPortSetting(const string& settingName, unsigned int defaultValue)
 {
-    DWORD port = GetSettingDword(SOCKS_PROXY_PORT_NAME, SOCKS_PROXY_PORT_DEFAULT);
+    DWORD port = GetSettingDword(settingName, defaultValue);
     if (port > MAX_PORT)
     {
-        port = SOCKS_PROXY_PORT_DEFAULT;
+        port = defaultValue;
     }
     return (unsigned int)port;
 }
 
-string Settings::UpstreamProxyType()
-{
-    return UPSTREAM_PROXY_TYPE_DEFAULT;
-}
-
-string Settings::UpstreamProxyHostname()
+static string ReadUpstreamProxyHostname()
 {
     if (DoesSettingExist(UPSTREAM_PROXY_HOSTNAME_NAME))
     {
@@ -392,17 +458,7 @@ string Settings::UpstreamProxyHostname()
     return hostname;
 }
 
-unsigned int Settings::UpstreamProxyPort()
-{
-    DWORD port = GetSettingDword(UPSTREAM_PROXY_PORT_NAME, UPSTREAM_PROXY_PORT_DEFAULT);
-    if (port > MAX_PORT)
-    {
-        port = UPSTREAM_PROXY_PORT_DEFAULT;
-    }
-    return (unsigned int)port;
-}
-
-string Settings::UpstreamProxyUsername()
+static string ReadUpstreamProxyUsername()
 {
     if (DoesSettingExist(UPSTREAM_PROXY_USERNAME_NAME))
     {
@@ -433,7 +489,7 @@ string Settings::UpstreamProxyUsername()
     return username;
 }
 
-string Settings::UpstreamProxyPassword()
+static string ReadUpstreamProxyPassword()
 {
     if (DoesSettingExist(UPSTREAM_PROXY_PASSWORD_NAME))
     {
@@ -459,7 +515,7 @@ string Settings::UpstreamProxyPassword()
     return password;
 }
 
-string Settings::UpstreamProxyDomain()
+static string ReadUpstreamProxyDomain()
 {
     if (DoesSettingExist(UPSTREAM_PROXY_DOMAIN_NAME))
     {
@@ -482,6 +538,226 @@ string Settings::UpstreamProxyDomain()
     return domain;
 }
 
+static shared_ptr<const SettingsSnapshot> ReadSettingsSnapshot()
+{
+    shared_ptr<SettingsSnapshot> settings = make_shared<SettingsSnapshot>();
+
+    settings->splitTunnel = !!GetSettingDword(SPLIT_TUNNEL_NAME, SPLIT_TUNNEL_DEFAULT);
+    settings->disableTimeouts = !!GetSettingDword(DISABLE_TIMEOUTS_NAME, DISABLE_TIMEOUTS_DEFAULT);
+
+    settings->transport = GetSettingString(TRANSPORT_NAME, TRANSPORT_DEFAULT);
+    if (settings->transport != TRANSPORT_VPN)
+    {
+        settings->transport = TRANSPORT_DEFAULT;
+    }
+
+    settings->localHttpProxyPort = ReadPortSetting(HTTP_PROXY_PORT_NAME, HTTP_PROXY_PORT_DEFAULT);
+    settings->localSocksProxyPort = ReadPortSetting(SOCKS_PROXY_PORT_NAME, SOCKS_PROXY_PORT_DEFAULT);
+
+    settings->skipUpstreamProxy = !!GetSettingDword(SKIP_UPSTREAM_PROXY_NAME, SKIP_UPSTREAM_PROXY_DEFAULT);
+    settings->upstreamProxyHostname = ReadUpstreamProxyHostname();
+    settings->upstreamProxyPort = ReadPortSetting(UPSTREAM_PROXY_PORT_NAME, UPSTREAM_PROXY_PORT_DEFAULT);
+    settings->upstreamProxyUsername = ReadUpstreamProxyUsername();
+    settings->upstreamProxyPassword = ReadUpstreamProxyPassword();
+    settings->upstreamProxyDomain = ReadUpstreamProxyDomain();
+
+    settings->egressRegion = GetSettingString(EGRESS_REGION_NAME, EGRESS_REGION_DEFAULT);
+    settings->systrayMinimize = !!GetSettingDword(SYSTRAY_MINIMIZE_NAME, SYSTRAY_MINIMIZE_DEFAULT);
+    settings->disableDisallowedTrafficAlert = !!GetSettingDword(DISABLE_DISALLOWED_TRAFFIC_ALERT_NAME, DISABLE_DISALLOWED_TRAFFIC_ALERT_DEFAULT);
+
+    settings->skipProxySettings = !!GetSettingDword(SKIP_PROXY_SETTINGS_NAME, SKIP_PROXY_SETTINGS_DEFAULT);
+    settings->skipAutoConnect = !!GetSettingDword(SKIP_AUTO_CONNECT_NAME, SKIP_AUTO_CONNECT_DEFAULT);
+    settings->inProcessHttpProxy = !!GetSettingDword(IN_PROCESS_HTTP_PROXY_NAME, IN_PROCESS_HTTP_PROXY_DEFAULT);
+    settings->proxyAutoConfig = !!GetSettingDword(PROXY_AUTO_CONFIG_NAME, PROXY_AUTO_CONFIG_DEFAULT);
+    settings->transportRaceStaggerMilliseconds = (DWORD)GetSettingDword(TRANSPORT_RACE_STAGGER_NAME, TRANSPORT_RACE_STAGGER_DEFAULT);
+    settings->persistentCore = !!GetSettingDword(PERSISTENT_CORE_NAME, PERSISTENT_CORE_DEFAULT);
+
+    settings->tunnelPoolSize = (unsigned int)GetSettingDword(TUNNEL_POOL_SIZE_NAME, TUNNEL_POOL_SIZE_DEFAULT);
+    if (settings->tunnelPoolSize < 1 || settings->tunnelPoolSize > TUNNEL_POOL_SIZE_MAX)
+    {
+        settings->tunnelPoolSize = TUNNEL_POOL_SIZE_DEFAULT;
+    }
+
+    DWORD localProxyProfile = (DWORD)GetSettingDword(LOCAL_PROXY_PROFILE_NAME, LOCAL_PROXY_PROFILE_DEFAULT);
+    settings->localProxyProfile = localProxyProfile <= LOCAL_PROXY_PROFILE_BANDWIDTH_SAVER
+                                  ? (LocalProxyProfile)localProxyProfile
+                                  : LOCAL_PROXY_PROFILE_DEFAULT;
+
+    settings->reportTrafficByDestination = !!GetSettingDword(REPORT_TRAFFIC_BY_DESTINATION_NAME, REPORT_TRAFFIC_BY_DESTINATION_DEFAULT);
+    settings->incrementalFeedback = !!GetSettingDword(INCREMENTAL_FEEDBACK_NAME, INCREMENTAL_FEEDBACK_DEFAULT);
+
+    return settings;
+}
+
+static VOID CALLBACK SettingsChangedCallback(PVOID param, BOOLEAN timerOrWaitFired);
+
+// Arms (or re-arms) the change notification. Must be called with
+// g_registryLock held. Failure isn't fatal: the snapshot is still refreshed
+// by FromJson, just not on changes from outside the app.
+static void WatchSettingsKey()
+{
+    if (!g_settingsKey)
+    {
+        HKEY key = NULL;
+        LONG returnCode = RegCreateKeyEx(
+                            HKEY_CURRENT_USER,
+                            LOCAL_SETTINGS_REGISTRY_KEY,
+                            0,
+                            0,
+                            0,
+                            KEY_NOTIFY,
+                            0,
+                            &key,
+                            0);
+        if (returnCode != ERROR_SUCCESS)
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: RegCreateKeyEx failed (%ld)"), __TFUNCTION__, returnCode);
+            return;
+        }
+
+        // Auto-reset, as there's just the one waiter
+        HANDLE changedEvent = CreateEvent(NULL, FALSE, FALSE, 0);
+        HANDLE changedWait = NULL;
+
+        // The callback runs in the wait thread, which lives as long as the
+        // wait does. That matters because a notification is cancelled when
+        // the thread that armed it exits; re-arming there keeps it alive.
+        if (!changedEvent
+            || !RegisterWaitForSingleObject(
+                    &changedWait,
+                    changedEvent,
+                    SettingsChangedCallback,
+                    NULL,
+                    INFINITE,
+                    WT_EXECUTEINWAITTHREAD))
+        {
+            my_print(NOT_SENSITIVE, true, _T("%s: CreateEvent/RegisterWaitForSingleObject failed (%d)"), __TFUNCTION__, GetLastError());
+            if (changedEvent) CloseHandle(changedEvent);
+            RegCloseKey(key);
+            return;
+        }
+
+        // Left open for the life of the process
+        g_settingsKey = key;
+        g_settingsChangedEvent = changedEvent;
+        g_settingsChangedWait = changedWait;
+    }
+
+    // Also signalled if the arming thread exits, which just means a
+    // (harmless) extra reload and a re-arm from the wait thread.
+    LONG returnCode = RegNotifyChangeKeyValue(
+                        g_settingsKey,
+                        FALSE, // not subkeys
+                        REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET,
+                        g_settingsChangedEvent,
+                        TRUE); // asynchronous
+    if (returnCode != ERROR_SUCCESS)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: RegNotifyChangeKeyValue failed (%ld)"), __TFUNCTION__, returnCode);
+    }
+}
+
+// Rereads the snapshot from the registry.
+static shared_ptr<const SettingsSnapshot> ReloadSettings()
+{
+    AutoLock lock(g_registryLock);
+
+    // Armed before reading, so that a change made while we read still
+    // triggers another reload.
+    WatchSettingsKey();
+
+    shared_ptr<const SettingsSnapshot> settings = ReadSettingsSnapshot();
+    atomic_store(&g_settingsSnapshot, settings);
+    return settings;
+}
+
+static VOID CALLBACK SettingsChangedCallback(PVOID /*param*/, BOOLEAN /*timerOrWaitFired*/)
+{
+    (void)ReloadSettings();
+}
+
+static shared_ptr<const SettingsSnapshot> GetSettings()
+{
+    shared_ptr<const SettingsSnapshot> settings = atomic_load(&g_settingsSnapshot);
+    if (settings)
+    {
+        return settings;
+    }
+
+    // First use. Settings can be read before Initialize is called.
+    AutoLock lock(g_registryLock);
+    settings = atomic_load(&g_settingsSnapshot);
+    return settings ? settings : ReloadSettings();
+}
+
+bool Settings::SplitTunnel()
+{
+    return GetSettings()->splitTunnel;
+}
+
+bool Settings::DisableTimeouts()
+{
+    return GetSettings()->disableTimeouts;
+}
+
+// See SetTransportOverride; never changes once other threads are running.
+static tstring g_transportOverride;
+
+tstring Settings::Transport()
+{
+    if (!g_transportOverride.empty())
+    {
+        return g_transportOverride;
+    }
+
+    return GetSettings()->transport;
+}
+
+void Settings::SetTransportOverride(const tstring& transport)
+{
+    g_transportOverride = transport;
+}
+
+unsigned int Settings::LocalHttpProxyPort()
+{
+    return GetSettings()->localHttpProxyPort;
+}
+
+unsigned int Settings::LocalSocksProxyPort()
+{
+    return GetSettings()->localSocksProxyPort;
+}
+
+string Settings::UpstreamProxyType()
+{
+    return UPSTREAM_PROXY_TYPE_DEFAULT;
+}
+
+string Settings::UpstreamProxyHostname()
+{
+    return GetSettings()->upstreamProxyHostname;
+}
+
+unsigned int Settings::UpstreamProxyPort()
+{
+    return GetSettings()->upstreamProxyPort;
+}
+
+string Settings::UpstreamProxyUsername()
+{
+    return GetSettings()->upstreamProxyUsername;
+}
+
+string Settings::UpstreamProxyPassword()
+{
+    return GetSettings()->upstreamProxyPassword;
+}
+
+string Settings::UpstreamProxyDomain()
+{
+    return GetSettings()->upstreamProxyDomain;
+}
+
 string Settings::UpstreamProxyFullHostname()
 {
     // Assumes HTTP proxy
@@ -527,22 +803,22 @@ string Settings::UpstreamProxyFullHostname()
 
 bool Settings::SkipUpstreamProxy()
 {
-    return !!GetSettingDword(SKIP_UPSTREAM_PROXY_NAME, SKIP_UPSTREAM_PROXY_DEFAULT);
+    return GetSettings()->skipUpstreamProxy;
 }
 
 string Settings::EgressRegion()
 {
-    return GetSettingString(EGRESS_REGION_NAME, EGRESS_REGION_DEFAULT);
+    return GetSettings()->egressRegion;
 }
 
 bool Settings::SystrayMinimize()
 {
-    return !!GetSettingDword(SYSTRAY_MINIMIZE_NAME, SYSTRAY_MINIMIZE_DEFAULT);
+    return GetSettings()->systrayMinimize;
 }
 
 bool Settings::DisableDisallowedTrafficAlert()
 {
-    return !!GetSettingDword(DISABLE_DISALLOWED_TRAFFIC_ALERT_NAME, DISABLE_DISALLOWED_TRAFFIC_ALERT_DEFAULT);
+    return GetSettings()->disableDisallowedTrafficAlert;
 }
 
 /*
@@ -551,12 +827,52 @@ Settings that are not exposed in the UI.
 
 bool Settings::SkipProxySettings()
 {
-    return !!GetSettingDword(SKIP_PROXY_SETTINGS_NAME, SKIP_PROXY_SETTINGS_DEFAULT);
+    return GetSettings()->skipProxySettings;
 }
 
 bool Settings::SkipAutoConnect()
 {
-    return !!GetSettingDword(SKIP_AUTO_CONNECT_NAME, SKIP_AUTO_CONNECT_DEFAULT);
+    return GetSettings()->skipAutoConnect;
+}
+
+bool Settings::InProcessHttpProxy()
+{
+    return GetSettings()->inProcessHttpProxy;
+}
+
+bool Settings::ProxyAutoConfig()
+{
+    return GetSettings()->proxyAutoConfig;
+}
+
+DWORD Settings::TransportRaceStaggerMilliseconds()
+{
+    return GetSettings()->transportRaceStaggerMilliseconds;
+}
+
+bool Settings::PersistentCore()
+{
+    return GetSettings()->persistentCore;
+}
+
+unsigned int Settings::TunnelPoolSize()
+{
+    return GetSettings()->tunnelPoolSize;
+}
+
+LocalProxyProfile Settings::LocalProxyPerformanceProfile()
+{
+    return GetSettings()->localProxyProfile;
+}
+
+bool Settings::ReportTrafficByDestination()
+{
+    return GetSettings()->reportTrafficByDestination;
+}
+
+bool Settings::IncrementalFeedback()
+{
+    return GetSettings()->incrementalFeedback;
 }
 
 /*
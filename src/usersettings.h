@@ -20,14 +20,41 @@
 #pragma once
 
 
+// EgressRegion value asking for whichever available region has measured
+// fastest; see ServerList::GetEgressRegion. The core is never given it.
+#define EGRESS_REGION_FASTEST   "FASTEST"
+
+// What has to be restarted for changed settings to take effect
+enum SettingsChangeScope
+{
+    SETTINGS_CHANGE_NONE = 0,
+    // Only the tunnel's configuration changed (e.g., egress region, upstream
+    // proxy, local ports): the tunnel can be restarted in place.
+    SETTINGS_CHANGE_TUNNEL,
+    // The transport itself changed: a full reconnect is needed.
+    SETTINGS_CHANGE_TRANSPORT
+};
+
+// How Polipo, as the local HTTP proxy, trades memory for caching. The values
+// are what's stored in the registry.
+enum LocalProxyProfile
+{
+    LOCAL_PROXY_PROFILE_STANDARD = 0,
+    // A small in-memory cache, for machines short of RAM
+    LOCAL_PROXY_PROFILE_LOW_MEMORY = 1,
+    // A large in-memory cache, so repeated fetches of cacheable content
+    // don't cross the tunnel, for metered links
+    LOCAL_PROXY_PROFILE_BANDWIDTH_SAVER = 2
+};
+
 namespace Settings
 {
     void Initialize();
 
     void ToJson(Json::Value& o_json);
-    // Returns false on error. o_reconnectRequired will be true if a reconnect
-    // is going to occur to apply the settings.
-    bool FromJson(const string& utf8JSON, bool& o_reconnectRequired);
+    // Returns false on error. o_changeScope is set to what must be restarted
+    // to apply the settings.
+    bool FromJson(const string& utf8JSON, SettingsChangeScope& o_changeScope);
 
     // Returns true if settings changed.
     bool Show(HINSTANCE hInst, HWND hParentWnd);
@@ -35,6 +62,9 @@ namespace Settings
     bool DisableTimeouts();
     bool SplitTunnel();
     tstring Transport();
+    // For this run only, Transport returns transport rather than the stored
+    // setting. Must be called at startup, before other threads read settings.
+    void SetTransportOverride(const tstring& transport);
     
     // Returns 0 if port should be chosen automatically.
     unsigned int LocalHttpProxyPort();
@@ -58,6 +88,31 @@ namespace Settings
 
     bool SkipProxySettings();
     bool SkipAutoConnect();
+    // Use HttpProxyEngine instead of Polipo for the local HTTP proxy
+    bool InProcessHttpProxy();
+    // Set the system proxy with a PAC script that sends local and intranet
+    // destinations direct, rather than with a fixed proxy and <local> bypass
+    bool ProxyAutoConfig();
+    // If non-zero, another transport is raced against the selected one,
+    // starting this long after it. Zero disables racing.
+    DWORD TransportRaceStaggerMilliseconds();
+    // Keep the tunnel core process running across reconnects, when its
+    // configuration allows; see CoreTransport::SetKeepResidentOnStop
+    bool PersistentCore();
+    // How many concurrent tunnels, to different servers, the tunnel core
+    // keeps. Traffic is spread over them, and losing one isn't a disconnect:
+    // the others carry on at once while the core replaces it in the
+    // background. So 2 is a warm standby for unstable networks.
+    unsigned int TunnelPoolSize();
+    // Takes effect when the local proxy next starts. Not used by the
+    // in-process proxy, which doesn't cache.
+    LocalProxyProfile LocalProxyPerformanceProfile();
+    // Include bytes per page view and HTTPS request bucket in the stats sent
+    // to the server. Only the in-process proxy can break traffic down.
+    bool ReportTrafficByDestination();
+    // Send only what's new since the last feedback upload of the session,
+    // with a reference to it, rather than the whole history again.
+    bool IncrementalFeedback();
 
     // These are used by the web UI
     void SetCookies(const string& value);
@@ -32,6 +32,10 @@
 #include "stopsignal.h"
 #include "diagnostic_info.h"
 #include "webbrowser.h"
+#include "codec_kernels.h"
+#include "wininet_network_check.h"
+#include "country_dialing_codes.h"
+#include <set>
 #include <iomanip>
 
 #pragma warning(push, 0)
@@ -42,6 +46,7 @@
 #include "osrng.h"
 #include "modes.h"
 #include "hmac.h"
+#include "sha.h"
 #pragma warning(pop)
 
 
@@ -50,10 +55,132 @@ using namespace std::experimental;
 
 extern HINSTANCE g_hInst;
 
+// The child processes we've started, kept in the registry so that a run can
+// find ones left over from an earlier one without scanning every process on
+// the machine (there can be thousands, on a terminal server). Each record is
+// the executable's file name, the PID and the process creation time, which
+// tells a live child from an unrelated process that's since reused the PID.
+#define CHILD_PROCESS_RECORDS_MAX   8
+
+static Lock g_childProcessRecordsLock("ChildProcessRecords");
+
+// Returns 0 if the time can't be had.
+static ULONGLONG GetProcessCreationTime(HANDLE process)
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0;
+    }
+    return ((ULONGLONG)creationTime.dwHighDateTime << 32) | creationTime.dwLowDateTime;
+}
+
+static Json::Value ReadChildProcessRecords()
+{
+    string recordsString;
+    Json::Value records;
+    Json::Reader reader;
+    if (!ReadRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_CHILD_PROCESSES, recordsString)
+        || !reader.parse(recordsString, records)
+        || !records.isArray())
+    {
+        return Json::Value(Json::arrayValue);
+    }
+    return records;
+}
+
+static void WriteChildProcessRecords(const Json::Value& records)
+{
+    Json::FastWriter jsonWriter;
+    RegistryFailureReason reason = REGISTRY_FAILURE_NO_REASON;
+    if (!WriteRegistryStringValue(LOCAL_SETTINGS_REGISTRY_VALUE_CHILD_PROCESSES, jsonWriter.write(records), reason))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s - WriteRegistryStringValue failed (%d)"), __TFUNCTION__, reason);
+    }
+}
+
+static void RecordChildProcess(const tstring& exePath, const PROCESS_INFORMATION& processInfo)
+{
+    Json::Value record;
+    record["name"] = WStringToUTF8(PathFindFileName(exePath.c_str()));
+    record["pid"] = (Json::UInt)processInfo.dwProcessId;
+    record["created"] = (Json::UInt64)GetProcessCreationTime(processInfo.hProcess);
+
+    AutoLock lock(g_childProcessRecordsLock);
+
+    // Newest first; the oldest are the least likely to still be running.
+    Json::Value records = ReadChildProcessRecords();
+    Json::Value newRecords(Json::arrayValue);
+    newRecords.append(record);
+    for (Json::ArrayIndex i = 0; i < records.size() && newRecords.size() < CHILD_PROCESS_RECORDS_MAX; i++)
+    {
+        newRecords.append(records[i]);
+    }
+    WriteChildProcessRecords(newRecords);
+}
+
+// Returns true if any recorded child was found running.
+static bool TerminateRecordedChildProcesses(const TCHAR* executableName)
+{
+    AutoLock lock(g_childProcessRecordsLock);
+
+    Json::Value records = ReadChildProcessRecords();
+    Json::Value remainingRecords(Json::arrayValue);
+    bool found = false;
+
+    for (Json::ArrayIndex i = 0; i < records.size(); i++)
+    {
+        const Json::Value& record = records[i];
+        if (!record.isObject())
+        {
+            continue;
+        }
+
+        if (0 != _tcsicmp(UTF8ToWString(record.get("name", "").asString()).c_str(), executableName))
+        {
+            remainingRecords.append(record);
+            continue;
+        }
+
+        HANDLE process = OpenProcess(
+                            PROCESS_TERMINATE | PROCESS_QUERY_INFORMATION | SYNCHRONIZE,
+                            FALSE,
+                            record.get("pid", 0).asUInt());
+        if (!process)
+        {
+            continue;
+        }
+
+        ULONGLONG created = GetProcessCreationTime(process);
+        if (created != 0 && created == record.get("created", 0).asUInt64())
+        {
+            found = true;
+            if (!TerminateProcess(process, 0) ||
+                WAIT_OBJECT_0 != WaitForSingleObject(process, TERMINATE_PROCESS_WAIT_MS))
+            {
+                my_print(NOT_SENSITIVE, false, _T("TerminateProcess failed for process with name %s"), executableName);
+                my_print(NOT_SENSITIVE, false, _T("Please terminate this process manually"));
+            }
+        }
+        CloseHandle(process);
+    }
+
+    WriteChildProcessRecords(remainingRecords);
+
+    return found;
+}
+
 // Adapted from here:
 // http://stackoverflow.com/questions/865152/how-can-i-get-a-process-handle-by-its-name-in-c
 void TerminateProcessByName(const TCHAR* executableName)
 {
+    // Children we started are found directly. Scanning is for what's left:
+    // e.g., those of a version that didn't record them.
+    if (TerminateRecordedChildProcesses(executableName))
+    {
+        return;
+    }
+
     PROCESSENTRY32 entry;
     entry.dwSize = sizeof(PROCESSENTRY32);
     HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
@@ -80,13 +207,154 @@ void TerminateProcessByName(const TCHAR* executableName)
 }
 
 
+/*
+ExtractExecutable keeps a manifest next to each file it extracts, so that on
+later launches it can tell the file is already up to date without rewriting
+it -- or even reading it. Rewriting a multi-MB binary on every start is slow,
+and gets it rescanned by antivirus each time.
+*/
+
+#define EXTRACT_MANIFEST_SUFFIX     _T(".manifest")
+
+struct ExtractManifest
+{
+    // Of the resource the file was extracted from
+    DWORD size;
+    string digest;
+    // Of the file, when it was extracted
+    ULONGLONG lastWriteTime;
+
+    ExtractManifest() : size(0), lastWriteTime(0) {}
+};
+
+// Resources don't change while we're running, so each is only hashed once.
+static Lock g_resourceDigestsLock("ResourceDigests");
+static map<DWORD, string> g_resourceDigests;
+
+static string GetResourceDigest(DWORD resourceID, const BYTE* data, DWORD size)
+{
+    AutoLock lock(g_resourceDigestsLock);
+
+    auto entry = g_resourceDigests.find(resourceID);
+    if (entry != g_resourceDigests.end())
+    {
+        return entry->second;
+    }
+
+    byte digest[CryptoPP::SHA256::DIGESTSIZE];
+    CryptoPP::SHA256().CalculateDigest(digest, data, size);
+    return g_resourceDigests[resourceID] = Hexlify(digest, sizeof(digest));
+}
+
+bool GetFileSizeAndTime(const TCHAR* filePath, ULONGLONG& o_size, ULONGLONG& o_lastWriteTime)
+{
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesEx(filePath, GetFileExInfoStandard, &attributes))
+    {
+        return false;
+    }
+
+    o_size = ((ULONGLONG)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+    o_lastWriteTime = ((ULONGLONG)attributes.ftLastWriteTime.dwHighDateTime << 32)
+                      | attributes.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
+static bool ReadExtractManifest(const TCHAR* filePath, ExtractManifest& o_manifest)
+{
+    tstring manifestPath = tstring(filePath) + EXTRACT_MANIFEST_SUFFIX;
+
+    IoStatsScope ioStats(IO_STATS_FILE_READ);
+
+    HANDLE file = CreateFile(
+                    manifestPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                    NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    char buffer[256];
+    DWORD bytesRead = 0;
+    BOOL readOK = ReadFile(file, buffer, sizeof(buffer) - 1, &bytesRead, NULL);
+    CloseHandle(file);
+    if (!readOK)
+    {
+        return false;
+    }
+    buffer[bytesRead] = '\0';
+    ioStats.AddBytes(bytesRead);
+
+    // Format: "<size> <SHA-256 hex> <last write time>"
+    stringstream stream(buffer);
+    stream >> o_manifest.size >> o_manifest.digest >> o_manifest.lastWriteTime;
+    return !stream.fail();
+}
+
+static void WriteExtractManifest(const TCHAR* filePath, const ExtractManifest& manifest)
+{
+    stringstream stream;
+    stream << manifest.size << " " << manifest.digest << " " << manifest.lastWriteTime;
+
+    // Failing just means a rewrite next time
+    (void)WriteFile(tstring(filePath) + EXTRACT_MANIFEST_SUFFIX, stream.str());
+}
+
+// For when there's no (valid) manifest, e.g. for a file extracted by an older
+// version. Compares against the file contents, mapped rather than read.
+static bool FileContentsMatch(const TCHAR* filePath, const BYTE* data, DWORD size)
+{
+    IoStatsScope ioStats(IO_STATS_FILE_READ);
+
+    // A running executable can still be opened this way.
+    HANDLE file = CreateFile(
+                    filePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                    NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    bool match = false;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart == size)
+    {
+        if (size == 0)
+        {
+            match = true;
+        }
+        else
+        {
+            HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping)
+            {
+                const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (view)
+                {
+                    match = (memcmp(view, data, size) == 0);
+                    ioStats.AddBytes(size);
+                    UnmapViewOfFile(view);
+                }
+                CloseHandle(mapping);
+            }
+        }
+    }
+
+    CloseHandle(file);
+    return match;
+}
+
+
 bool ExtractExecutable(
     DWORD resourceID,
     const TCHAR* exeFilename,
     tstring& path,
     bool succeedIfExists/*=false*/)
 {
-    // Extract executable from resources and write to temporary file
+    // Extract executable from resources and write to temporary file.
+    // The resource is already mapped into memory, so it's written straight
+    // from there.
 
     BYTE* data;
     DWORD size;
@@ -111,11 +379,39 @@ bool ExtractExecutable(
         return false;
     }
 
+    ExtractManifest current;
+    current.size = size;
+    current.digest = GetResourceDigest(resourceID, data, size);
+
+    // If the file hasn't changed since we wrote it, and the resource hasn't
+    // changed since then, there's nothing to do.
+    ULONGLONG fileSize = 0;
+    if (GetFileSizeAndTime(filePath, fileSize, current.lastWriteTime)
+        && fileSize == size)
+    {
+        ExtractManifest previous;
+        if (ReadExtractManifest(filePath, previous)
+            && previous.size == current.size
+            && previous.digest == current.digest
+            && previous.lastWriteTime == current.lastWriteTime)
+        {
+            path = filePath;
+            return true;
+        }
+
+        if (FileContentsMatch(filePath, data, size))
+        {
+            WriteExtractManifest(filePath, current);
+            path = filePath;
+            return true;
+        }
+    }
+
     HANDLE tempFile = INVALID_HANDLE_VALUE;
     bool attemptedTerminate = false;
     while (true)
     {
-        tempFile = CreateFile(filePath, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        tempFile = CreateFile(filePath, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
         if (tempFile == INVALID_HANDLE_VALUE)
         {
             int lastError = GetLastError();
@@ -127,10 +423,10 @@ bool ExtractExecutable(
                     // The file must exist, and we can't write to it, most likely because it is
                     // locked by a currently executing process. We can go ahead and consider the
                     // file extracted.
-                    // TODO: We should check that the file size and contents are the same. If the file
-                    // is different, it would be better to proceed with attempting to extract the
-                    // executable and even terminating any locking process -- for example, the locking
-                    // process may be a dangling child process left over from before a client upgrade.
+                    // NOTE: We only get here if the file differs from the resource (or can't
+                    // be checked), e.g. it's a dangling child process left over from before a
+                    // client upgrade. It would be better to terminate it, but in this mode
+                    // there may be other instances of the client using it.
                     path = filePath;
                     return true;
                 }
@@ -151,9 +447,16 @@ bool ExtractExecutable(
     }
 
     DWORD written = 0;
-    if (!WriteFile(tempFile, data, size, &written, NULL)
-        || written != size
-        || !FlushFileBuffers(tempFile))
+    bool writeOK = false;
+    {
+        // Not counting the manifest's own write, below
+        IoStatsScope ioStats(IO_STATS_FILE_WRITE);
+        ioStats.AddBytes(size);
+        writeOK = WriteFile(tempFile, data, size, &written, NULL)
+                  && written == size
+                  && FlushFileBuffers(tempFile);
+    }
+    if (!writeOK)
     {
         auto lastError = GetLastError();
         CloseHandle(tempFile);
@@ -164,32 +467,116 @@ bool ExtractExecutable(
 
     CloseHandle(tempFile);
 
+    // Record the file as written, so the next launch can skip all this.
+    if (GetFileSizeAndTime(filePath, fileSize, current.lastWriteTime))
+    {
+        WriteExtractManifest(filePath, current);
+    }
+
     path = filePath;
 
     return true;
 }
 
 
+/*
+Host environment cache: answers that only change when the user or system
+changes something, but which are asked for on every connect attempt. See
+InvalidateHostEnvironment. Failures aren't cached.
+*/
+static Lock g_hostEnvironmentLock("HostEnvironment");
+static tstring g_appDataPath;
+static set<tstring> g_ensuredDataPaths;
+static tstring g_tempPath;
+static map<tstring, tstring> g_shortPaths;
+static bool g_localeNameCached = false;
+static tstring g_localeName;
+static bool g_deviceRegionCached = false;
+static wstring g_deviceRegion;
+// Bumped on each locale invalidation, so that a region computed (without the
+// lock) from what's since changed isn't cached.
+static DWORD g_localeGeneration = 0;
+
+void InvalidateHostEnvironment(DWORD changes)
+{
+    {
+        AutoLock lock(g_hostEnvironmentLock);
+
+        if (changes & HOST_ENVIRONMENT_PATHS)
+        {
+            g_appDataPath.clear();
+            g_ensuredDataPaths.clear();
+            g_tempPath.clear();
+            g_shortPaths.clear();
+        }
+
+        if (changes & HOST_ENVIRONMENT_LOCALE)
+        {
+            g_localeNameCached = false;
+            g_deviceRegionCached = false;
+            g_localeGeneration++;
+        }
+    }
+
+    if (changes & HOST_ENVIRONMENT_NETWORK)
+    {
+        InvalidateWininetNetworkInfo();
+    }
+}
+
+
 bool GetDataPath(const vector<tstring>& pathSuffixes, bool ensureExists, tstring& o_path) {
-    TCHAR path[MAX_PATH];
-    if (!SHGetSpecialFolderPath(NULL, path, CSIDL_APPDATA, FALSE))
+    tstring appDataPath;
     {
-        my_print(NOT_SENSITIVE, false, _T("%s - SHGetFolderPath failed (%d)"), __TFUNCTION__, GetLastError());
-        return false;
+        AutoLock lock(g_hostEnvironmentLock);
+        appDataPath = g_appDataPath;
     }
 
-    filesystem::path appDataPath(path);
-    auto dataDirectory = filesystem::path(appDataPath);
+    if (appDataPath.empty())
+    {
+        TCHAR path[MAX_PATH];
+        if (!SHGetSpecialFolderPath(NULL, path, CSIDL_APPDATA, FALSE))
+        {
+            my_print(NOT_SENSITIVE, false, _T("%s - SHGetFolderPath failed (%d)"), __TFUNCTION__, GetLastError());
+            return false;
+        }
+
+        appDataPath = path;
+
+        AutoLock lock(g_hostEnvironmentLock);
+        g_appDataPath = appDataPath;
+    }
 
+    auto dataDirectory = filesystem::path(appDataPath);
     for (auto suffix : pathSuffixes) {
         dataDirectory.append(suffix);
+    }
 
-        if (ensureExists) {
-            if (!CreateDirectory(dataDirectory.c_str(), NULL) && ERROR_ALREADY_EXISTS != GetLastError())
-            {
-                my_print(NOT_SENSITIVE, false, _T("%s - create directory failed (%d)"), __TFUNCTION__, GetLastError());
-                return false;
+    if (ensureExists && !pathSuffixes.empty()) {
+        bool ensured = false;
+        {
+            AutoLock lock(g_hostEnvironmentLock);
+            ensured = (g_ensuredDataPaths.count(dataDirectory) > 0);
+        }
+
+        // One check instead of creating each level -- but it may have been
+        // deleted since.
+        DWORD attributes = ensured ? GetFileAttributes(dataDirectory.c_str()) : INVALID_FILE_ATTRIBUTES;
+        if (attributes == INVALID_FILE_ATTRIBUTES || !(attributes & FILE_ATTRIBUTE_DIRECTORY))
+        {
+            auto createDirectory = filesystem::path(appDataPath);
+            for (auto suffix : pathSuffixes) {
+                createDirectory.append(suffix);
+
+                if (!CreateDirectory(createDirectory.c_str(), NULL) && ERROR_ALREADY_EXISTS != GetLastError())
+                {
+                    my_print(NOT_SENSITIVE, false, _T("%s - create directory failed (%d)"), __TFUNCTION__, GetLastError());
+                    return false;
+                }
             }
+
+            AutoLock lock(g_hostEnvironmentLock);
+            g_ensuredDataPaths.insert(dataDirectory);
         }
     }
 
@@ -203,6 +590,15 @@ bool GetTempPath(tstring& o_path)
 {
     o_path.clear();
 
+    {
+        AutoLock lock(g_hostEnvironmentLock);
+        if (!g_tempPath.empty())
+        {
+            o_path = g_tempPath;
+            return true;
+        }
+    }
+
     DWORD ret;
     TCHAR tempPath[MAX_PATH];
     // http://msdn.microsoft.com/en-us/library/aa364991%28v=vs.85%29.aspx notes
@@ -214,6 +610,9 @@ bool GetTempPath(tstring& o_path)
     }
 
     o_path = tempPath;
+
+    AutoLock lock(g_hostEnvironmentLock);
+    g_tempPath = o_path;
     return true;
 }
 
@@ -307,6 +706,16 @@ bool MakeGUID(tstring& o_guid) {
 // Caller can check GetLastError() on failure
 bool GetShortPathName(const tstring& path, tstring& o_shortPath)
 {
+    {
+        AutoLock lock(g_hostEnvironmentLock);
+        auto cached = g_shortPaths.find(path);
+        if (cached != g_shortPaths.end())
+        {
+            o_shortPath = cached->second;
+            return true;
+        }
+    }
+
     DWORD ret = GetShortPathName(path.c_str(), NULL, 0);
     if (ret == 0)
     {
@@ -321,12 +730,18 @@ bool GetShortPathName(const tstring& path, tstring& o_shortPath)
     }
     o_shortPath = buffer;
     delete[] buffer;
+
+    AutoLock lock(g_hostEnvironmentLock);
+    g_shortPaths[path] = o_shortPath;
     return true;
 }
 
 
 bool WriteFile(const tstring& filename, const string& data)
 {
+    IoStatsScope ioStats(IO_STATS_FILE_WRITE);
+    ioStats.AddBytes(data.length());
+
     HANDLE file;
     DWORD bytesWritten;
     if (INVALID_HANDLE_VALUE == (file = CreateFile(
@@ -348,6 +763,114 @@ bool WriteFile(const tstring& filename, const string& data)
     return true;
 }
 
+bool ReadFileContents(const tstring& filename, string& o_data)
+{
+    IoStatsScope ioStats(IO_STATS_FILE_READ);
+
+    o_data.clear();
+
+    AutoHANDLE file = CreateFile(
+                        filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.HighPart != 0)
+    {
+        return false;
+    }
+
+    o_data.resize(fileSize.LowPart);
+
+    DWORD bytesRead = 0;
+    if (fileSize.LowPart > 0
+        && (!ReadFile(file, &o_data[0], fileSize.LowPart, &bytesRead, NULL)
+            || bytesRead != fileSize.LowPart))
+    {
+        o_data.clear();
+        return false;
+    }
+
+    ioStats.AddBytes(bytesRead);
+    return true;
+}
+
+
+// What was last written (or found) by WriteFileIfChanged, so an unchanged
+// file isn't even read to compare.
+struct WrittenFile
+{
+    string digest;
+    ULONGLONG size;
+    ULONGLONG lastWriteTime;
+};
+static Lock g_writtenFilesLock("WrittenFiles");
+static map<tstring, WrittenFile> g_writtenFiles;
+
+bool WriteFileIfChanged(const tstring& filename, const string& data)
+{
+    string digest = Sha256Hex(data);
+
+    AutoLock lock(g_writtenFilesLock);
+
+    WrittenFile current;
+    bool exists = GetFileSizeAndTime(filename.c_str(), current.size, current.lastWriteTime);
+    if (exists && current.size == data.length())
+    {
+        auto written = g_writtenFiles.find(filename);
+        if (written != g_writtenFiles.end()
+            && written->second.size == current.size
+            && written->second.lastWriteTime == current.lastWriteTime)
+        {
+            if (written->second.digest == digest)
+            {
+                return true;
+            }
+        }
+        else
+        {
+            string existing;
+            if (ReadFileContents(filename, existing) && existing == data)
+            {
+                current.digest = digest;
+                g_writtenFiles[filename] = current;
+                return true;
+            }
+        }
+    }
+
+    g_writtenFiles.erase(filename);
+
+    tstring tempFilename = filename + _T(".tmp");
+    if (!WriteFile(tempFilename, data))
+    {
+        return false;
+    }
+
+    if (!MoveFileEx(tempFilename.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        // E.g., the file is open without FILE_SHARE_DELETE. Fall back to
+        // rewriting it in place.
+        my_print(NOT_SENSITIVE, true, _T("%s - MoveFileEx failed (%d)"), __TFUNCTION__, GetLastError());
+        DeleteFile(tempFilename.c_str());
+        if (!WriteFile(filename, data))
+        {
+            return false;
+        }
+    }
+
+    if (GetFileSizeAndTime(filename.c_str(), current.size, current.lastWriteTime))
+    {
+        current.digest = digest;
+        g_writtenFiles[filename] = current;
+    }
+
+    return true;
+}
+
 
 DWORD WaitForConnectability(
     USHORT port,
@@ -391,6 +914,21 @@ DWORD WaitForConnectability(
 
     DWORD returnValue = ERROR_SUCCESS;
 
+    // The connect attempt is waited for alongside the process and the stop
+    // signal, so either of those ends the wait right away.
+    HANDLE waitHandles[3];
+    DWORD waitHandlesCount = 0;
+    waitHandles[waitHandlesCount++] = connectedEvent;
+    if (process != NULL)
+    {
+        waitHandles[waitHandlesCount++] = process;
+    }
+    HANDLE stopEvent = stopInfo.stopSignal ? stopInfo.stopSignal->GetStopEvent(stopInfo.stopReasons) : NULL;
+    if (stopEvent != NULL)
+    {
+        waitHandles[waitHandlesCount++] = stopEvent;
+    }
+
     while (true)
     {
         DWORD now = GetTickCount();
@@ -403,7 +941,7 @@ DWORD WaitForConnectability(
         }
 
         // Attempt to connect to SOCKS proxy
-        // Just wait 100 ms. and then check for user cancel etc.
+        // Wait up to 100 ms. and then check for user cancel etc.
 
         closesocket(sock);
         sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
@@ -412,7 +950,7 @@ DWORD WaitForConnectability(
             && 0 == WSAEventSelect(sock, connectedEvent, FD_CONNECT)
             && SOCKET_ERROR == connect(sock, (SOCKADDR*)&serverAddr, sizeof(serverAddr))
             && WSAEWOULDBLOCK == WSAGetLastError()
-            && WSA_WAIT_EVENT_0 == WSAWaitForMultipleEvents(1, &connectedEvent, TRUE, 100, FALSE)
+            && WAIT_OBJECT_0 == WaitForMultipleObjects(waitHandlesCount, waitHandles, FALSE, 100)
             && 0 == WSAEnumNetworkEvents(sock, connectedEvent, &networkEvents)
             && (networkEvents.lNetworkEvents & FD_CONNECT)
             && networkEvents.iErrorCode[FD_CONNECT_BIT] == 0)
@@ -448,23 +986,55 @@ DWORD WaitForConnectability(
 }
 
 
-bool TestForOpenPort(int& targetPort, int maxIncrement, const StopInfo& stopInfo)
+// A port is available if it can be bound exclusively. Unlike connecting to
+// it, that's immediate, and nothing is sent to whatever may be listening.
+static bool IsLocalPortAvailable(USHORT port)
 {
-    int maxPort = targetPort + maxIncrement;
-    do
+    SOCKET sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock == INVALID_SOCKET)
     {
-        if (targetPort > 0 && targetPort <= 0xFFFF)
-        {
-            if (ERROR_SUCCESS != WaitForConnectability(
-                (USHORT)targetPort,
-                100,
-                0,
-                stopInfo))
-            {
-                return true;
-            }
+        // Can't tell; let the listener find out
+        return true;
+    }
+
+    // Also fails if something is bound to the wildcard address
+    BOOL exclusive = TRUE;
+    (void)setsockopt(sock, SOL_SOCKET, SO_EXCLUSIVEADDRUSE, (const char*)&exclusive, sizeof(exclusive));
+
+    sockaddr_in addr;
+    ZeroMemory(&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    addr.sin_port = htons(port);
+
+    bool available = (0 == bind(sock, (SOCKADDR*)&addr, sizeof(addr)));
+
+    closesocket(sock);
+    return available;
+}
+
+bool TestForOpenPort(int& targetPort, int maxIncrement, const StopInfo& stopInfo)
+{
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
+    auto wsaCleanup = finally([] { WSACleanup(); });
+
+    int maxPort = targetPort + maxIncrement;
+    do
+    {
+        if (targetPort > 0 && targetPort <= 0xFFFF)
+        {
+            if (IsLocalPortAvailable((USHORT)targetPort))
+            {
+                return true;
+            }
             my_print(NOT_SENSITIVE, false, _T("Localhost port %d is already in use."), targetPort);
         }
+
+        if (stopInfo.stopSignal && stopInfo.stopSignal->CheckSignal(stopInfo.stopReasons))
+        {
+            return false;
+        }
     } while (++targetPort <= maxPort);
 
     return false;
@@ -491,17 +1061,131 @@ void StopProcess(DWORD processID, HANDLE process)
 }
 
 
+// Never closed: the system closes it as the process exits, which is what
+// kills the children.
+static Lock g_childProcessJobLock("ChildProcessJob");
+static HANDLE g_childProcessJob = NULL;
+static bool g_childProcessJobFailed = false;
+
+static HANDLE GetChildProcessJob()
+{
+    AutoLock lock(g_childProcessJobLock);
+
+    if (g_childProcessJob || g_childProcessJobFailed)
+    {
+        return g_childProcessJob;
+    }
+
+    HANDLE job = CreateJobObject(NULL, NULL);
+    if (!job)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s - CreateJobObject failed (%d)"), __TFUNCTION__, GetLastError());
+        g_childProcessJobFailed = true;
+        return NULL;
+    }
+
+    JOBOBJECT_EXTENDED_LIMIT_INFORMATION limits;
+    ZeroMemory(&limits, sizeof(limits));
+    // Breakaway is allowed so that the browser, etc., launched by a child
+    // isn't tied to us.
+    limits.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE | JOB_OBJECT_LIMIT_BREAKAWAY_OK;
+    if (!SetInformationJobObject(job, JobObjectExtendedLimitInformation, &limits, sizeof(limits)))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s - SetInformationJobObject failed (%d)"), __TFUNCTION__, GetLastError());
+        CloseHandle(job);
+        g_childProcessJobFailed = true;
+        return NULL;
+    }
+
+    g_childProcessJob = job;
+    return g_childProcessJob;
+}
+
+bool ResumeChildProcessInJob(const PROCESS_INFORMATION& processInfo, const tstring& exePath)
+{
+    HANDLE job = GetChildProcessJob();
+    if (job && !AssignProcessToJobObject(job, processInfo.hProcess))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s - AssignProcessToJobObject failed (%d)"), __TFUNCTION__, GetLastError());
+    }
+
+    if ((DWORD)-1 == ResumeThread(processInfo.hThread))
+    {
+        my_print(NOT_SENSITIVE, false, _T("%s - ResumeThread failed (%d)"), __TFUNCTION__, GetLastError());
+        TerminateProcess(processInfo.hProcess, 0);
+        return false;
+    }
+
+    RecordChildProcess(exePath, processInfo);
+
+    return true;
+}
+
+
 // Create the pipe that will be used to communicate between the child process
 // process and this process.
 // Note that this function effectively causes the subprocess's stdout and stderr
 // to come to the same pipe.
 // Returns true on success.
+// Anonymous pipes don't support overlapped I/O, so this creates a uniquely
+// named single-instance pipe instead. The read end is opened for overlapped
+// I/O and the write end uses `writeAttributes` (e.g., to make it inheritable).
+static BOOL CreateOverlappedPipe(
+    PHANDLE o_readPipe,
+    PHANDLE o_writePipe,
+    LPSECURITY_ATTRIBUTES writeAttributes)
+{
+    static volatile LONG pipeSerialNumber = 0;
+
+    *o_readPipe = INVALID_HANDLE_VALUE;
+    *o_writePipe = INVALID_HANDLE_VALUE;
+
+    tstringstream pipeName;
+    pipeName << _T("\\\\.\\pipe\\Psiphon.") << GetCurrentProcessId()
+             << _T(".") << InterlockedIncrement(&pipeSerialNumber);
+
+    HANDLE readPipe = CreateNamedPipe(
+                        pipeName.str().c_str(),
+                        PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE,
+                        PIPE_TYPE_BYTE | PIPE_WAIT,
+                        1,      // one instance
+                        4096,   // out buffer size
+                        4096,   // in buffer size
+                        0,
+                        NULL);  // not inheritable
+    if (readPipe == INVALID_HANDLE_VALUE)
+    {
+        return FALSE;
+    }
+
+    HANDLE writePipe = CreateFile(
+                        pipeName.str().c_str(),
+                        GENERIC_WRITE,
+                        0,
+                        writeAttributes,
+                        OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL,
+                        NULL);
+    if (writePipe == INVALID_HANDLE_VALUE)
+    {
+        DWORD lastError = GetLastError();
+        CloseHandle(readPipe);
+        SetLastError(lastError);
+        return FALSE;
+    }
+
+    *o_readPipe = readPipe;
+    *o_writePipe = writePipe;
+    return TRUE;
+}
+
 bool CreateSubprocessPipes(
     HANDLE& o_parentOutputPipe, // Parent reads the child's stdout/stdin from this
     HANDLE& o_parentInputPipe,  // Parent writes to the child's stdin with this
     HANDLE& o_childStdinPipe,   // Child's stdin pipe
     HANDLE& o_childStdoutPipe,  // Child's stdout pipe
-    HANDLE& o_childStderrPipe)  // Child's stderr pipe (dup of stdout)
+    HANDLE& o_childStderrPipe,  // Child's stderr pipe (dup of stdout)
+    bool overlappedParentOutput/*=false*/)
 {
     o_parentOutputPipe = INVALID_HANDLE_VALUE;
     o_parentInputPipe = INVALID_HANDLE_VALUE;
@@ -528,7 +1212,9 @@ bool CreateSubprocessPipes(
         hParentInputWrite = INVALID_HANDLE_VALUE;
 
     // Create the child output pipe.
-    if (!CreatePipe(&hParentOutputReadTmp, &hChildStdoutWrite, &sa, 0))
+    if (overlappedParentOutput ?
+            !CreateOverlappedPipe(&hParentOutputReadTmp, &hChildStdoutWrite, &sa) :
+            !CreatePipe(&hParentOutputReadTmp, &hChildStdoutWrite, &sa, 0))
     {
         if (hParentOutputReadTmp != INVALID_HANDLE_VALUE) CloseHandle(hParentOutputReadTmp);
         if (hParentOutputRead != INVALID_HANDLE_VALUE) CloseHandle(hParentOutputRead);
@@ -657,372 +1343,481 @@ bool CreateSubprocessPipes(
 }
 
 
-bool DoesRegistryValueExist(const string& name)
-{
-    HKEY key = 0;
+/*
+Registry access
 
-    LONG returnCode = RegOpenKeyEx(
-        HKEY_CURRENT_USER,
-        LOCAL_SETTINGS_REGISTRY_KEY,
-        0,
-        KEY_READ,
-        &key);
-    if (returnCode != ERROR_SUCCESS)
-    {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegOpenKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
-    }
+The settings key is opened once and kept open. Values read are cached until
+the key changes (by us or anyone else), which is watched for with a change
+notification. All values go through the wide APIs; narrow strings are
+converted with the ANSI code page, as the A APIs would.
+*/
+
+// Larger values (e.g., server lists) are rarely read twice, so aren't cached.
+#define REGISTRY_CACHE_MAX_VALUE_BYTES      16384
+// Most values fit in the first query, without a sizing call.
+#define REGISTRY_QUERY_INITIAL_BUFFER_BYTES 512
 
+struct RegistryValue
+{
+    bool exists;
     DWORD type;
-    returnCode = RegQueryValueExA(
-        key,
-        name.c_str(),
-        NULL,
-        &type,
-        NULL,
-        NULL);
+    vector<BYTE> data;
 
-    auto lastError = GetLastError();
-    RegCloseKey(key);
-    SetLastError(lastError); // restore the previous error code
+    RegistryValue() : exists(false), type(REG_NONE) {}
+};
 
-    return returnCode == ERROR_SUCCESS;
-}
+static Lock g_registryKeyLock("RegistryKey");
+static HKEY g_registryKey = NULL;
+static HANDLE g_registryChangedEvent = NULL;
+static bool g_registryWatchArmed = false;
+static map<wstring, RegistryValue> g_registryCache;
 
+// Writes deferred by a RegistryWriteBatch on this thread, in the order made
+typedef vector<pair<wstring, RegistryValue>> RegistryWrites;
+static thread_local int t_registryBatchDepth = 0;
+static thread_local RegistryWrites* t_registryBatch = NULL;
 
-bool WriteRegistryDwordValue(const string& name, DWORD value)
+// Must be called with g_registryKeyLock held.
+static LONG OpenRegistryKey(bool reopen=false)
 {
-    HKEY key = 0;
-    DWORD disposition = 0;
-    DWORD bufferLength = sizeof(value);
+    if (g_registryKey && !reopen)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    if (g_registryKey)
+    {
+        RegCloseKey(g_registryKey);
+        g_registryKey = NULL;
+        g_registryWatchArmed = false;
+        g_registryCache.clear();
+    }
 
+    // Created rather than opened, as it may not exist before the first write.
+    HKEY key = NULL;
     LONG returnCode = RegCreateKeyEx(
-        HKEY_CURRENT_USER,
-        LOCAL_SETTINGS_REGISTRY_KEY,
-        0,
-        0,
-        0,
-        KEY_WRITE,
-        0,
-        &key,
-        &disposition);
+                        HKEY_CURRENT_USER,
+                        LOCAL_SETTINGS_REGISTRY_KEY,
+                        0,
+                        0,
+                        0,
+                        KEY_READ | KEY_WRITE,
+                        0,
+                        &key,
+                        0);
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegCreateKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        my_print(NOT_SENSITIVE, true, _T("%s: RegCreateKeyEx failed with code %ld"), __TFUNCTION__, returnCode);
+        return returnCode;
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
-
-    returnCode = RegSetValueExA(
-                key,
-                name.c_str(),
-                0,
-                REG_DWORD,
-                (LPBYTE)&value,
-                bufferLength);
-    if (returnCode != ERROR_SUCCESS)
+    g_registryKey = key;
+    return ERROR_SUCCESS;
+}
+
+// Drops the cache if the key has changed since it was filled, and re-arms
+// the notification. An armed notification is cancelled -- and its event set
+// -- when the thread that armed it exits, which just costs a refill.
+// Must be called with g_registryKeyLock held.
+static void CheckRegistryCache()
+{
+    if (!g_registryChangedEvent)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExA failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        // Auto-reset, as it's only ever checked here
+        g_registryChangedEvent = CreateEvent(NULL, FALSE, FALSE, 0);
     }
 
-    return true;
+    if (g_registryWatchArmed
+        && WAIT_TIMEOUT == WaitForSingleObject(g_registryChangedEvent, 0))
+    {
+        return;
+    }
+
+    g_registryCache.clear();
+
+    // Armed before the cache is refilled, so no change can be missed.
+    g_registryWatchArmed =
+        g_registryChangedEvent
+        && ERROR_SUCCESS == RegNotifyChangeKeyValue(
+                                g_registryKey,
+                                FALSE, // not subkeys
+                                REG_NOTIFY_CHANGE_LAST_SET,
+                                g_registryChangedEvent,
+                                TRUE); // asynchronous
 }
 
+static const RegistryValue* FindBatchedRegistryWrite(const wstring& name)
+{
+    if (!t_registryBatch)
+    {
+        return NULL;
+    }
 
-bool ReadRegistryDwordValue(const string& name, DWORD& value)
+    for (auto it = t_registryBatch->rbegin(); it != t_registryBatch->rend(); ++it)
+    {
+        if (it->first == name)
+        {
+            return &it->second;
+        }
+    }
+    return NULL;
+}
+
+// Returns ERROR_SUCCESS and sets o_value if the value exists;
+// ERROR_FILE_NOT_FOUND if it doesn't.
+static LONG QueryRegistryValue(const wstring& name, RegistryValue& o_value)
 {
-    HKEY key = 0;
-    DWORD bufferLength = sizeof(value);
-    DWORD type;
+    const RegistryValue* batched = FindBatchedRegistryWrite(name);
+    if (batched)
+    {
+        o_value = *batched;
+        return ERROR_SUCCESS;
+    }
 
-    LONG returnCode = RegOpenKeyEx(
-                        HKEY_CURRENT_USER,
-                        LOCAL_SETTINGS_REGISTRY_KEY,
-                        0,
-                        KEY_READ,
-                        &key);
+    AutoLock lock(g_registryKeyLock);
+
+    LONG returnCode = OpenRegistryKey();
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegOpenKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        return returnCode;
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
-
-    returnCode = RegQueryValueExA(
-                    key,
-                    name.c_str(),
-                    0,
-                    &type,
-                    (LPBYTE)&value,
-                    &bufferLength);
-    if (returnCode != ERROR_SUCCESS)
+    CheckRegistryCache();
+
+    auto cached = g_registryCache.find(name);
+    if (cached != g_registryCache.end())
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExA failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        o_value = cached->second;
+        return o_value.exists ? ERROR_SUCCESS : ERROR_FILE_NOT_FOUND;
     }
 
-    if (type != REG_DWORD)
+    o_value = RegistryValue();
+    o_value.data.resize(REGISTRY_QUERY_INITIAL_BUFFER_BYTES);
+
+    IoStatsScope ioStats(IO_STATS_REGISTRY_READ);
+
+    for (int attempt = 0; attempt < 3; attempt++)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExA says type of '%hs' is %ld, not REG_DWORD"), __TFUNCTION__, name.c_str(), type);
-        return false;
+        DWORD bufferLength = o_value.data.size();
+        returnCode = RegQueryValueExW(
+                        g_registryKey,
+                        name.c_str(),
+                        0,
+                        &o_value.type,
+                        o_value.data.empty() ? NULL : &o_value.data[0],
+                        &bufferLength);
+        if (returnCode == ERROR_MORE_DATA)
+        {
+            // The value may still grow before the next try; that's what the
+            // retries are for.
+            o_value.data.resize(bufferLength);
+            continue;
+        }
+        else if (returnCode == ERROR_KEY_DELETED && attempt == 0)
+        {
+            // Deleted from under us; a fresh handle will see the new one.
+            returnCode = OpenRegistryKey(true);
+            if (returnCode != ERROR_SUCCESS)
+            {
+                return returnCode;
+            }
+            CheckRegistryCache();
+            continue;
+        }
+
+        if (returnCode == ERROR_SUCCESS)
+        {
+            o_value.data.resize(bufferLength);
+            ioStats.AddBytes(bufferLength);
+        }
+        break;
     }
 
-    return true;
-}
+    if (returnCode == ERROR_SUCCESS || returnCode == ERROR_FILE_NOT_FOUND)
+    {
+        o_value.exists = (returnCode == ERROR_SUCCESS);
+        if (!o_value.exists)
+        {
+            o_value.data.clear();
+        }
+
+        if (g_registryWatchArmed && o_value.data.size() <= REGISTRY_CACHE_MAX_VALUE_BYTES)
+        {
+            g_registryCache[name] = o_value;
+        }
+    }
 
+    return returnCode;
+}
 
-bool WriteRegistryStringValue(const string& name, const string& value, RegistryFailureReason& reason)
+// Must be called with g_registryKeyLock held.
+static LONG SetRegistryValueNow(const wstring& name, const RegistryValue& value)
 {
-    HKEY key = 0;
-    reason = REGISTRY_FAILURE_NO_REASON;
+    IoStatsScope ioStats(IO_STATS_REGISTRY_WRITE);
+    ioStats.AddBytes(value.data.size());
 
-    LONG returnCode = RegCreateKeyEx(
-                        HKEY_CURRENT_USER,
-                        LOCAL_SETTINGS_REGISTRY_KEY,
-                        0,
-                        0,
-                        0,
-                        KEY_WRITE,
+    LONG returnCode = OpenRegistryKey();
+
+    for (int attempt = 0; returnCode == ERROR_SUCCESS && attempt < 2; attempt++)
+    {
+        returnCode = RegSetValueExW(
+                        g_registryKey,
+                        name.c_str(),
                         0,
-                        &key,
-                        0);
-    if (returnCode != ERROR_SUCCESS)
+                        value.type,
+                        value.data.empty() ? NULL : &value.data[0],
+                        value.data.size());
+        if (returnCode != ERROR_KEY_DELETED || attempt > 0)
+        {
+            break;
+        }
+        returnCode = OpenRegistryKey(true);
+    }
+
+    // Our own write will also trip the change notification; this just saves
+    // a query for the value until then.
+    if (returnCode == ERROR_SUCCESS
+        && g_registryWatchArmed
+        && value.data.size() <= REGISTRY_CACHE_MAX_VALUE_BYTES)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegCreateKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        g_registryCache[name] = value;
+    }
+    else
+    {
+        g_registryCache.erase(name);
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
+    return returnCode;
+}
 
-    returnCode = RegSetValueExA(
-        key,
-        name.c_str(),
-        0,
-        REG_SZ,
-        (LPBYTE)value.c_str(),
-        value.length() + 1); // Write the null terminator
-    if (returnCode != ERROR_SUCCESS)
-    {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExA failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
+static LONG SetRegistryValue(const wstring& name, DWORD type, const BYTE* data, DWORD dataLength)
+{
+    RegistryValue value;
+    value.exists = true;
+    value.type = type;
+    value.data.assign(data, data + dataLength);
 
-        if (ERROR_NO_SYSTEM_RESOURCES == returnCode)
+    if (t_registryBatch)
+    {
+        for (auto it = t_registryBatch->begin(); it != t_registryBatch->end(); ++it)
         {
-            reason = REGISTRY_FAILURE_WRITE_TOO_LONG;
+            if (it->first == name)
+            {
+                t_registryBatch->erase(it);
+                break;
+            }
         }
-
-        return false;
+        t_registryBatch->push_back(make_pair(name, value));
+        return ERROR_SUCCESS;
     }
 
-    return true;
+    AutoLock lock(g_registryKeyLock);
+    return SetRegistryValueNow(name, value);
 }
 
-
-bool WriteRegistryStringValue(const string& name, const wstring& value, RegistryFailureReason& reason)
+RegistryWriteBatch::RegistryWriteBatch()
 {
-    HKEY key = 0;
-    reason = REGISTRY_FAILURE_NO_REASON;
-    wstring wName = UTF8ToWString(name);
+    if (t_registryBatchDepth++ == 0)
+    {
+        t_registryBatch = new RegistryWrites();
+    }
+}
 
-    LONG returnCode = RegCreateKeyEx(
-                        HKEY_CURRENT_USER,
-                        LOCAL_SETTINGS_REGISTRY_KEY,
-                        0,
-                        0,
-                        0,
-                        KEY_WRITE,
-                        0,
-                        &key,
-                        0);
-    if (returnCode != ERROR_SUCCESS)
+RegistryWriteBatch::~RegistryWriteBatch()
+{
+    if (--t_registryBatchDepth > 0)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegCreateKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
-        return false;
+        return;
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
+    unique_ptr<RegistryWrites> writes(t_registryBatch);
+    t_registryBatch = NULL;
 
-    returnCode = RegSetValueExW(
-        key,
-        wName.c_str(),
-        0,
-        REG_SZ,
-        (LPBYTE)value.c_str(),
-        (value.length() + 1) * sizeof(wchar_t)); // Write the null terminator
-    if (returnCode != ERROR_SUCCESS)
+    if (writes->empty())
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExW failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
+        return;
+    }
 
-        if (ERROR_NO_SYSTEM_RESOURCES == returnCode)
+    AutoLock lock(g_registryKeyLock);
+
+    for (auto it = writes->begin(); it != writes->end(); ++it)
+    {
+        LONG returnCode = SetRegistryValueNow(it->first, it->second);
+        if (returnCode != ERROR_SUCCESS)
         {
-            reason = REGISTRY_FAILURE_WRITE_TOO_LONG;
+            my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExW failed for '%s' with code %ld"), __TFUNCTION__, it->first.c_str(), returnCode);
         }
+    }
+}
 
-        return false;
+static wstring AnsiToWString(const string& ansiString)
+{
+    if (ansiString.empty())
+    {
+        return wstring();
     }
 
-    return true;
+    int length = MultiByteToWideChar(CP_ACP, 0, ansiString.c_str(), ansiString.length(), NULL, 0);
+    wstring wString(length, L'\0');
+    if (length > 0)
+    {
+        (void)MultiByteToWideChar(CP_ACP, 0, ansiString.c_str(), ansiString.length(), &wString[0], length);
+    }
+    return wString;
 }
 
+static string WStringToAnsi(const wstring& wString)
+{
+    if (wString.empty())
+    {
+        return string();
+    }
 
-bool ReadRegistryStringValue(LPCSTR name, string& value)
+    int length = WideCharToMultiByte(CP_ACP, 0, wString.c_str(), wString.length(), NULL, 0, NULL, NULL);
+    string ansiString(length, '\0');
+    if (length > 0)
+    {
+        (void)WideCharToMultiByte(CP_ACP, 0, wString.c_str(), wString.length(), &ansiString[0], length, NULL, NULL);
+    }
+    return ansiString;
+}
+
+// Gets a REG_SZ value's string, without its terminating null(s).
+static bool GetRegistryStringValue(LPCSTR name, wstring& value)
 {
     value.clear();
 
-    HKEY key = 0;
-    LONG returnCode = RegOpenKeyEx(
-                        HKEY_CURRENT_USER,
-                        LOCAL_SETTINGS_REGISTRY_KEY,
-                        0,
-                        KEY_READ,
-                        &key);
+    RegistryValue regValue;
+    LONG returnCode = QueryRegistryValue(UTF8ToWString(name), regValue);
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegOpenKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
         return false;
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
-
-    DWORD bufferLength = 0;
-    returnCode = RegQueryValueExA(
-                    key,
-                    name,
-                    0,
-                    0,
-                    NULL,
-                    &bufferLength);
-    if (returnCode != ERROR_SUCCESS)
+    if (regValue.type != REG_SZ)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExA(1) failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW says type of '%hs' is %ld, not REG_SZ"), __TFUNCTION__, name, regValue.type);
         return false;
     }
 
-    // resize to string length excluding the terminating null character
-    if (bufferLength > 0)
+    // regValue.data is the size of the data in bytes.
+    if (regValue.data.size() % sizeof(wchar_t) != 0)
     {
-        value.resize(bufferLength - 1);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW for %hs says bufferLength is not a multiple of sizeof(wchar_t): %ld"), __TFUNCTION__, name, regValue.data.size());
+        return false;
     }
 
-    DWORD type;
-    returnCode = RegQueryValueExA(
-                    key,
-                    name,
-                    0,
-                    &type,
-                    (LPBYTE)value.c_str(),
-                    &bufferLength);
-    if (returnCode != ERROR_SUCCESS)
+    if (!regValue.data.empty())
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExA(2) failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
-        return false;
+        value.assign((const wchar_t*)&regValue.data[0], regValue.data.size() / sizeof(wchar_t));
     }
 
-    if (type != REG_SZ)
+    // The terminator is stored, but isn't guaranteed to be.
+    while (!value.empty() && value.back() == L'\0')
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExA says type of '%hs' is %ld, not REG_SZ"), __TFUNCTION__, name, type);
-        return false;
+        value.pop_back();
     }
 
     return true;
 }
 
-bool ReadRegistryStringValue(LPCSTR name, wstring& value)
+
+bool DoesRegistryValueExist(const string& name)
 {
-    value.clear();
+    RegistryValue value;
+    return ERROR_SUCCESS == QueryRegistryValue(UTF8ToWString(name), value);
+}
 
-    wstring wName = UTF8ToWString(name);
 
-    HKEY key = 0;
-    LONG returnCode = RegOpenKeyEx(
-                        HKEY_CURRENT_USER,
-                        LOCAL_SETTINGS_REGISTRY_KEY,
-                        0,
-                        KEY_READ,
-                        &key);
+bool WriteRegistryDwordValue(const string& name, DWORD value)
+{
+    LONG returnCode = SetRegistryValue(
+                        UTF8ToWString(name),
+                        REG_DWORD,
+                        (const BYTE*)&value,
+                        sizeof(value));
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegOpenKeyEx failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExW failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
         return false;
     }
 
-    auto closeKey = finally([=]() {
-        auto lastError = GetLastError();
-        RegCloseKey(key);
-        SetLastError(lastError); // restore the previous error code
-    });
-
-    DWORD bufferLength = 0;
-    returnCode = RegQueryValueExW(
-                    key,
-                    wName.c_str(),
-                    0,
-                    0,
-                    NULL,
-                    &bufferLength);
+    return true;
+}
+
+
+bool ReadRegistryDwordValue(const string& name, DWORD& value)
+{
+    RegistryValue regValue;
+    LONG returnCode = QueryRegistryValue(UTF8ToWString(name), regValue);
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW(1) failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
         return false;
     }
 
-    // bufferLength is the size of the data in bytes.
-    if (bufferLength % sizeof(wchar_t) != 0) {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW(1) for %hs says bufferLength is not a multiple of sizeof(wchar_t): %ld"), __TFUNCTION__, name, bufferLength);
+    if (regValue.type != REG_DWORD || regValue.data.size() != sizeof(value))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW says type of '%hs' is %ld, not REG_DWORD"), __TFUNCTION__, name.c_str(), regValue.type);
         return false;
     }
 
-    // resize to string length excluding the terminating null character
-    if (bufferLength > 0)
-    {
-        value.resize((bufferLength / sizeof(wchar_t)) - 1);
-    }
+    memcpy(&value, &regValue.data[0], sizeof(value));
+    return true;
+}
 
-    DWORD type;
-    returnCode = RegQueryValueExW(
-        key,
-        wName.c_str(),
-        0,
-        &type,
-        (LPBYTE)value.c_str(),
-        &bufferLength);
+
+bool WriteRegistryStringValue(const string& name, const string& value, RegistryFailureReason& reason)
+{
+    // Stored as the A API would store it
+    return WriteRegistryStringValue(name, AnsiToWString(value), reason);
+}
+
+
+bool WriteRegistryStringValue(const string& name, const wstring& value, RegistryFailureReason& reason)
+{
+    reason = REGISTRY_FAILURE_NO_REASON;
+
+    LONG returnCode = SetRegistryValue(
+                        UTF8ToWString(name),
+                        REG_SZ,
+                        (const BYTE*)value.c_str(),
+                        (value.length() + 1) * sizeof(wchar_t)); // Write the null terminator
     if (returnCode != ERROR_SUCCESS)
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW(2) failed for '%hs' with code %ld"), __TFUNCTION__, name, returnCode);
+        my_print(NOT_SENSITIVE, true, _T("%s: RegSetValueExW failed for '%hs' with code %ld"), __TFUNCTION__, name.c_str(), returnCode);
+
+        if (ERROR_NO_SYSTEM_RESOURCES == returnCode)
+        {
+            reason = REGISTRY_FAILURE_WRITE_TOO_LONG;
+        }
+
         return false;
     }
 
-    if (type != REG_SZ)
+    return true;
+}
+
+
+bool ReadRegistryStringValue(LPCSTR name, string& value)
+{
+    value.clear();
+
+    wstring wValue;
+    if (!GetRegistryStringValue(name, wValue))
     {
-        my_print(NOT_SENSITIVE, true, _T("%s: RegQueryValueExW says type of '%hs' is %ld, not REG_SZ"), __TFUNCTION__, name, type);
         return false;
     }
 
+    value = WStringToAnsi(wValue);
     return true;
 }
 
+bool ReadRegistryStringValue(LPCSTR name, wstring& value)
+{
+    return GetRegistryStringValue(name, value);
+}
 
 int TextHeight(void)
 {
@@ -1077,135 +1872,71 @@ bool TestBoolArray(const vector<const bool*>& boolArray)
 }
 
 
-// Note that this does not work for hex encoding. Its output is stupid.
-string CryptBinaryToStringWrapper(const unsigned char* input, size_t length, DWORD flags)
+string Base64Encode(const unsigned char* input, size_t length)
 {
-    DWORD outsize = 0;
-
-    // Get the required size
-    if (!CryptBinaryToStringA(
-        input,
-        length,
-        flags | CRYPT_STRING_NOCR,
-        NULL,
-        &outsize))
+    string output(Base64EncodedLength(length), '\0');
+    if (!output.empty())
     {
-        return "";
-    }
-
-    string output;
-    output.resize(outsize + 1);
-
-    if (!CryptBinaryToStringA(
-        input,
-        length,
-        flags | CRYPT_STRING_NOCR,
-        (LPSTR)output.c_str(),
-        &outsize))
-    {
-        return "";
+        Base64EncodeBytes(input, length, &output[0]);
     }
-
-    ((LPSTR)output.c_str())[outsize] = '\0';
-
     return output;
 }
 
-string CryptStringToBinaryWrapper(const string& input, DWORD flags)
+string Base64Decode(const string& input)
 {
-    DWORD outsize = 0;
-
-    // Get the required size
-    if (!CryptStringToBinaryA(
-        input.c_str(),
-        input.length(),
-        flags,
-        NULL,
-        &outsize,
-        NULL,
-        NULL))
+    string output(Base64MaxDecodedLength(input.length()), '\0');
+    size_t outputLength = 0;
+    if (!Base64DecodeBytes(input.data(), input.length(), (unsigned char*)&output[0], outputLength))
     {
         return "";
     }
-
-    string output;
-    output.resize(outsize);
-
-    if (!CryptStringToBinaryA(
-        input.c_str(),
-        input.length(),
-        flags,
-        (BYTE*)output.c_str(),
-        &outsize,
-        NULL,
-        NULL))
-    {
-        return "";
-    }
-
+    output.resize(outputLength);
     return output;
 }
 
-
-string Base64Encode(const unsigned char* input, size_t length)
+string Sha256Hex(const string& input)
 {
-    return CryptBinaryToStringWrapper(input, length, CRYPT_STRING_BASE64);
+    return Sha256Hex((const unsigned char*)input.data(), input.length());
 }
 
-string Base64Decode(const string& input)
+string Sha256Hex(const unsigned char* input, size_t length)
 {
-    return CryptStringToBinaryWrapper(input, CRYPT_STRING_BASE64);
+    byte digest[CryptoPP::SHA256::DIGESTSIZE];
+    CryptoPP::SHA256().CalculateDigest(digest, input, length);
+    return Hexlify(digest, sizeof(digest));
 }
 
 
-// Adapted from here:
-// http://stackoverflow.com/questions/3381614/c-convert-string-to-hexadecimal-and-vice-versa
 string Hexlify(const unsigned char* input, size_t length)
 {
-    static const char* const lut = "0123456789ABCDEF";
-
-    string output;
-    output.reserve(2 * length);
-    for (size_t i = 0; i < length; ++i)
+    string output(2 * length, '\0');
+    if (length > 0)
     {
-        const unsigned char c = input[i];
-        output.push_back(lut[c >> 4]);
-        output.push_back(lut[c & 15]);
+        HexEncode(input, length, &output[0]);
     }
     return output;
 }
 
 string Dehexlify(const string& input)
 {
-    static const char* const lut = "0123456789ABCDEF";
-    size_t len = input.length();
-    if (len & 1)
+    string output;
+    Dehexlify(input.data(), input.length(), output);
+    return output;
+}
+
+void Dehexlify(const char* input, size_t length, string& o_output)
+{
+    if (length & 1)
     {
         throw std::invalid_argument("Dehexlify: odd length");
     }
 
-    string output;
-    output.reserve(len / 2);
-    for (size_t i = 0; i < len; i += 2)
+    o_output.resize(length / 2);
+    if (length > 0 && !HexDecode(input, length, (unsigned char*)&o_output[0]))
     {
-        char a = (char)toupper(input[i]);
-        const char* p = std::lower_bound(lut, lut + 16, a);
-        if (*p != a)
-        {
-            throw std::invalid_argument("Dehexlify: not a hex digit");
-        }
-
-        char b = (char)toupper(input[i + 1]);
-        const char* q = std::lower_bound(lut, lut + 16, b);
-        if (*q != b)
-        {
-            throw std::invalid_argument("Dehexlify: not a hex digit");
-        }
-
-        output.push_back((char)(((p - lut) << 4) | (q - lut)));
+        o_output.clear();
+        throw std::invalid_argument("Dehexlify: not a hex digit");
     }
-
-    return output;
 }
 
 
@@ -1281,6 +2012,12 @@ tstring UrlDecode(const tstring& input)
 
 tstring GetLocaleName()
 {
+    AutoLock lock(g_hostEnvironmentLock);
+    if (g_localeNameCached)
+    {
+        return g_localeName;
+    }
+
     int size = GetLocaleInfo(
         LOCALE_USER_DEFAULT,
         LOCALE_SISO639LANGNAME,
@@ -1309,6 +2046,8 @@ tstring GetLocaleName()
 
     delete[] buf;
 
+    g_localeName = ret;
+    g_localeNameCached = true;
     return ret;
 }
 
@@ -1338,10 +2077,76 @@ tstring GetISO8601DatetimeString()
 static wstring g_uiLocale;
 void SetUiLocale(const wstring& uiLocale)
 {
-    g_uiLocale = uiLocale;
+    AutoLock lock(g_hostEnvironmentLock);
+    if (uiLocale != g_uiLocale)
+    {
+        g_uiLocale = uiLocale;
+        g_deviceRegionCached = false;
+        g_localeGeneration++;
+    }
+}
+
+static wstring ComputeDeviceRegion();
+
+wstring GetDeviceRegion()
+{
+    DWORD generation;
+    {
+        AutoLock lock(g_hostEnvironmentLock);
+        if (g_deviceRegionCached)
+        {
+            return g_deviceRegion;
+        }
+        generation = g_localeGeneration;
+    }
+
+    // Not done with the lock held, as it may wait for WMI.
+    wstring region = ComputeDeviceRegion();
+
+    AutoLock lock(g_hostEnvironmentLock);
+    if (generation == g_localeGeneration)
+    {
+        g_deviceRegion = region;
+        g_deviceRegionCached = true;
+    }
+    return region;
+}
+
+// Appends the countries using dialingCode, per COUNTRY_DIALING_CODES, in the
+// table's order. Codes that can't be in the table (e.g., with a leading zero)
+// match nothing, as they never did when compared as JSON strings.
+static void AppendDialingCodeCountries(const wstring& dialingCode, vector<wstring>& o_countries)
+{
+    if (dialingCode.empty() || dialingCode.length() > 5
+        || (dialingCode[0] == L'0' && dialingCode.length() > 1))
+    {
+        return;
+    }
+
+    unsigned long code = 0;
+    for (wchar_t c : dialingCode)
+    {
+        if (c < L'0' || c > L'9')
+        {
+            return;
+        }
+        code = code * 10 + (c - L'0');
+    }
+
+    auto first = COUNTRY_DIALING_CODES;
+    auto last = COUNTRY_DIALING_CODES + _countof(COUNTRY_DIALING_CODES);
+    assert(std::is_sorted(first, last,
+        [](const CountryDialingCode& a, const CountryDialingCode& b) { return a.dialingCode < b.dialingCode; }));
+
+    auto match = std::lower_bound(first, last, code,
+        [](const CountryDialingCode& entry, unsigned long code) { return entry.dialingCode < code; });
+    for (; match != last && match->dialingCode == code; ++match)
+    {
+        o_countries.push_back(wstring(match->countryCode, match->countryCode + 2));
+    }
 }
 
-wstring GetDeviceRegion()
+static wstring ComputeDeviceRegion()
 {
     // There are a few different indicators of the device region, none of which
     // are perfect. So we'll look at what indicators we have and take a best guess.
@@ -1361,71 +2166,17 @@ wstring GetDeviceRegion()
     if (GetCountryDialingCode(countryDialingCode)
         && countryDialingCode.length() > 0)
     {
-        BYTE* countryDialingCodesBytes = 0;
-        DWORD countryDialingCodesLen = 0;
-        if (GetResourceBytes(
-            _T("COUNTRY_DIALING_CODES.JSON"), RT_RCDATA,
-            countryDialingCodesBytes, countryDialingCodesLen))
-        {
-            Json::Value json;
-            Json::Reader reader;
-
-            string utf8JSON((char*)countryDialingCodesBytes, countryDialingCodesLen);
-            bool parsingSuccessful = reader.parse(utf8JSON, json);
-            if (parsingSuccessful)
-            {
-                // Sometimes (for some reason) the country dialing code given by the system
-                // has an additional trailing digit. So we'll also match against a truncated
-                // version of that value. If we don't get a match on the full value, we'll
-                // use the matches on the truncated value.
-                wstring countryDialingCodeTruncated;
-                vector<wstring> dialingCodeCountriesTruncatedMatch;
-                if (countryDialingCode.length() > 1)
-                {
-                    countryDialingCodeTruncated = countryDialingCode.substr(0, countryDialingCode.length() - 1);
-                }
-
-                for (const Json::Value& entry : json)
-                {
-                    wstring entryDialingCode = UTF8ToWString(entry.get("dialing_code", "").asString());
-                    if (!entryDialingCode.empty()
-                        && entryDialingCode == countryDialingCode)
-                    {
-                        wstring entryCountryCode = UTF8ToWString(entry.get("country_code", "").asString());
-                        if (!entryCountryCode.empty())
-                        {
-                            std::transform(entryCountryCode.begin(), entryCountryCode.end(), entryCountryCode.begin(), ::toupper);
-                            dialingCodeCountries.push_back(entryCountryCode);
-                        }
-                    }
-
-                    if (!entryDialingCode.empty()
-                        && entryDialingCode == countryDialingCodeTruncated)
-                    {
-                        wstring entryCountryCode = UTF8ToWString(entry.get("country_code", "").asString());
-                        if (!entryCountryCode.empty())
-                        {
-                            std::transform(entryCountryCode.begin(), entryCountryCode.end(), entryCountryCode.begin(), ::toupper);
-                            dialingCodeCountriesTruncatedMatch.push_back(entryCountryCode);
-                        }
-                    }
-                }
+        // Sometimes (for some reason) the country dialing code given by the system
+        // has an additional trailing digit. So we'll also match against a truncated
+        // version of that value. If we don't get a match on the full value, we'll
+        // use the matches on the truncated value.
+        AppendDialingCodeCountries(countryDialingCode, dialingCodeCountries);
 
-                if (dialingCodeCountries.empty() && !dialingCodeCountriesTruncatedMatch.empty())
-                {
-                    // We failed to match on the full country dialing code, but
-                    // we did get matches on the truncated form.
-                    dialingCodeCountries = dialingCodeCountriesTruncatedMatch;
-                }
-            }
-            else
-            {
-                my_print(NOT_SENSITIVE, true, _T("%s:%d: Failed to parse country dialing codes JSON"), __TFUNCTION__, __LINE__);
-            }
-        }
-        else
+        if (dialingCodeCountries.empty() && countryDialingCode.length() > 1)
         {
-            my_print(NOT_SENSITIVE, true, _T("%s:%d: Failed to load country dialing codes JSON resource"), __TFUNCTION__, __LINE__);
+            AppendDialingCodeCountries(
+                countryDialingCode.substr(0, countryDialingCode.length() - 1),
+                dialingCodeCountries);
         }
     }
     else
@@ -1442,11 +2193,16 @@ wstring GetDeviceRegion()
     // Country information defaults to "US", so that tells us very little.
     const wstring GENERIC_COUNTRY = L"US";
 
-    wstring uiLocaleUpper = g_uiLocale;
+    wstring uiLocaleUpper;
+    {
+        AutoLock lock(g_hostEnvironmentLock);
+        uiLocaleUpper = g_uiLocale;
+    }
     std::transform(uiLocaleUpper.begin(), uiLocaleUpper.end(), uiLocaleUpper.begin(), ::toupper);
 
     // This is hand-wavy, imperfect, and will need to be expanded in the future.
-    std::map<wstring, wstring> localeToCountryMap = {
+    // Sorted by locale, for binary search.
+    static const struct { const wchar_t* locale; const wchar_t* country; } LOCALE_TO_COUNTRY[] = {
         { L"AR", L"SA" },
         { L"EN", L"US" },
         { L"FA", L"IR" },
@@ -1457,7 +2213,14 @@ wstring GetDeviceRegion()
         { L"ZH", L"CN" },
     };
 
-    wstring uiLocaleCountry = localeToCountryMap[uiLocaleUpper];
+    wstring uiLocaleCountry;
+    auto localeMatch = std::lower_bound(
+        std::begin(LOCALE_TO_COUNTRY), std::end(LOCALE_TO_COUNTRY), uiLocaleUpper,
+        [](const decltype(LOCALE_TO_COUNTRY[0])& entry, const wstring& locale) { return locale.compare(entry.locale) > 0; });
+    if (localeMatch != std::end(LOCALE_TO_COUNTRY) && uiLocaleUpper == localeMatch->locale)
+    {
+        uiLocaleCountry = localeMatch->country;
+    }
 
     //
     // Combine values to make best guess.
@@ -1602,11 +2365,15 @@ bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string&
 
     CryptoPP::AutoSeededRandomPool rng;
 
-    string b64Ciphertext, b64Mac, b64WrappedEncryptionKey, b64WrappedMacKey, b64IV;
+    // The plaintext may be tens of MB (e.g., feedback from a long session),
+    // so the ciphertext is only copied once more: Base64-encoded straight
+    // into o_encrypted.
+    string ciphertext;
+    string b64Mac, b64WrappedEncryptionKey, b64WrappedMacKey, b64IV;
 
     try
     {
-        string ciphertext, mac, wrappedEncryptionKey, wrappedMacKey;
+        string mac, wrappedEncryptionKey, wrappedMacKey;
 
         // NOTE: We are doing encrypt-then-MAC.
 
@@ -1626,6 +2393,7 @@ bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string&
         CryptoPP::CBC_Mode<CryptoPP::AES>::Encryption encryptor;
         encryptor.SetKeyWithIV(encryptionKey, encryptionKey.size(), iv);
 
+        ciphertext.reserve(strlen(plaintext) + CryptoPP::AES::BLOCKSIZE);
         CryptoPP::StringSource(
             plaintext,
             true,
@@ -1634,13 +2402,6 @@ bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string&
                 new CryptoPP::StringSink(ciphertext),
                 CryptoPP::StreamTransformationFilter::PKCS_PADDING));
 
-        CryptoPP::StringSource(
-            ciphertext,
-            true,
-            new CryptoPP::Base64Encoder(
-                new CryptoPP::StringSink(b64Ciphertext),
-                false));
-
         size_t ivLength = sizeof(iv) * sizeof(iv[0]);
         CryptoPP::StringSource(
             iv,
@@ -1655,29 +2416,15 @@ bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string&
         //
 
         // Include the IV in the MAC'd data, as per http://tools.ietf.org/html/draft-mcgrew-aead-aes-cbc-hmac-sha2-01
-        size_t ciphertextLength = ciphertext.length() * sizeof(ciphertext[0]);
-        byte* ivPlusCiphertext = new byte[ivLength + ciphertextLength];
-        if (!ivPlusCiphertext)
-        {
-            return false;
-        }
-        memcpy(ivPlusCiphertext, iv, ivLength);
-        memcpy(ivPlusCiphertext + ivLength, ciphertext.data(), ciphertextLength);
-
+        // It's MAC'd incrementally, rather than copied in front of the ciphertext.
         CryptoPP::SecByteBlock macKey(KEY_LENGTH);
         rng.GenerateBlock(macKey, macKey.size());
 
         CryptoPP::HMAC<CryptoPP::SHA256> hmac(macKey, macKey.size());
-
-        CryptoPP::StringSource(
-            ivPlusCiphertext,
-            ivLength + ciphertextLength,
-            true,
-            new CryptoPP::HashFilter(
-                hmac,
-                new CryptoPP::StringSink(mac)));
-
-        delete[] ivPlusCiphertext;
+        hmac.Update(iv, ivLength);
+        hmac.Update((const byte*)ciphertext.data(), ciphertext.length());
+        mac.resize(hmac.DigestSize());
+        hmac.Final((byte*)&mac[0]);
 
         CryptoPP::StringSource(
             mac,
@@ -1737,16 +2484,22 @@ bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string&
         return false;
     }
 
-    stringstream ss;
-    ss << "{  \n";
-    ss << "  \"contentCiphertext\": \"" << b64Ciphertext << "\",\n";
-    ss << "  \"iv\": \"" << b64IV << "\",\n";
-    ss << "  \"wrappedEncryptionKey\": \"" << b64WrappedEncryptionKey << "\",\n";
-    ss << "  \"contentMac\": \"" << b64Mac << "\",\n";
-    ss << "  \"wrappedMacKey\": \"" << b64WrappedMacKey << "\"\n";
-    ss << "}";
+    const char* ciphertextPrefix = "{  \n  \"contentCiphertext\": \"";
+    size_t ciphertextOffset = strlen(ciphertextPrefix);
+    size_t b64CiphertextLength = Base64EncodedLength(ciphertext.length());
 
-    o_encrypted = ss.str();
+    o_encrypted.reserve(ciphertextOffset + b64CiphertextLength + 256 + b64WrappedEncryptionKey.length() + b64WrappedMacKey.length());
+    o_encrypted = ciphertextPrefix;
+    o_encrypted.resize(ciphertextOffset + b64CiphertextLength);
+    Base64EncodeBytes((const unsigned char*)ciphertext.data(), ciphertext.length(), &o_encrypted[ciphertextOffset]);
+    string().swap(ciphertext);
+
+    o_encrypted += "\",\n";
+    o_encrypted += "  \"iv\": \"" + b64IV + "\",\n";
+    o_encrypted += "  \"wrappedEncryptionKey\": \"" + b64WrappedEncryptionKey + "\",\n";
+    o_encrypted += "  \"contentMac\": \"" + b64Mac + "\",\n";
+    o_encrypted += "  \"wrappedMacKey\": \"" + b64WrappedMacKey + "\"\n";
+    o_encrypted += "}";
 
     return true;
 }
@@ -1768,6 +2521,60 @@ DWORD GetTickCountDiff(DWORD start, DWORD end)
     return end - start;
 }
 
+typedef ULONGLONG (WINAPI *GETTICKCOUNT64FN)();
+
+// The tick count in milliseconds, without the 49-day wrap
+static unsigned long long TickCount64()
+{
+    // Vista+
+    static GETTICKCOUNT64FN s_pfnGetTickCount64 =
+        (GETTICKCOUNT64FN)GetSystemLibraryProc(_T("kernel32.dll"), "GetTickCount64");
+    if (s_pfnGetTickCount64)
+    {
+        return s_pfnGetTickCount64();
+    }
+
+    // Extended by hand, which works as long as it's called at least once
+    // every 49 days -- which the watchdogs and timers see to.
+    static Lock s_lock("TickCount64");
+    static DWORD s_last = 0;
+    static unsigned long long s_high = 0;
+
+    AutoLock lock(s_lock);
+    DWORD now = GetTickCount();
+    if (now < s_last)
+    {
+        s_high += 0x100000000ULL;
+    }
+    s_last = now;
+    return s_high + now;
+}
+
+unsigned long long MonotonicMicroseconds()
+{
+    // Never fails on XP and later, but the tick count is there just in case.
+    static const LONGLONG s_frequency = [] {
+        LARGE_INTEGER frequency;
+        return QueryPerformanceFrequency(&frequency) ? frequency.QuadPart : 0;
+    }();
+
+    if (s_frequency <= 0)
+    {
+        return TickCount64() * 1000;
+    }
+
+    LARGE_INTEGER counter;
+    (void)QueryPerformanceCounter(&counter);
+    // Split so that the multiplication can't overflow
+    return (unsigned long long)(counter.QuadPart / s_frequency) * 1000000
+           + (unsigned long long)(counter.QuadPart % s_frequency) * 1000000 / s_frequency;
+}
+
+unsigned long long MonotonicMilliseconds()
+{
+    return MonotonicMicroseconds() / 1000;
+}
+
 /*
 AutoHANDLE and AutoMUTEX
 */
@@ -1788,70 +2595,458 @@ AutoMUTEX::~AutoMUTEX()
 }
 
 /*
-DPI Awareness Utilities
+I/O stats
 */
 
-HRESULT SetProcessDpiAwareness(PROCESS_DPI_AWARENESS value)
+const char* IoStatsKindName(IoStatsKind kind)
+{
+    switch (kind)
+    {
+    case IO_STATS_REGISTRY_READ:    return "registryRead";
+    case IO_STATS_REGISTRY_WRITE:   return "registryWrite";
+    case IO_STATS_FILE_READ:        return "fileRead";
+    case IO_STATS_FILE_WRITE:       return "fileWrite";
+    case IO_STATS_WININET_OPTION:   return "wininetOption";
+    }
+    return "unknown";
+}
+
+#if IO_STATS
+
+// Updated with interlocked operations. Times are in performance counter ticks.
+struct IoStatsCounters
+{
+    volatile LONGLONG operations;
+    volatile LONGLONG bytes;
+    volatile LONGLONG ticks;
+};
+static IoStatsCounters g_ioStats[IO_STATS_KIND_COUNT];
+
+IoStatsScope::IoStatsScope(IoStatsKind kind)
+    : m_kind(kind), m_bytes(0)
 {
-    // In the no-op/unsupported case we're going to return success.
-    HRESULT res = S_OK;
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    m_start = now.QuadPart;
+}
 
-    HINSTANCE hinstSHCORE = NULL;
+IoStatsScope::~IoStatsScope()
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
 
-    static const int maxPathBufferSize = MAX_PATH + 1;
-    TCHAR SystemDirectoryPathBuffer[maxPathBufferSize];
-    if (GetSystemDirectory(SystemDirectoryPathBuffer, maxPathBufferSize))
+    IoStatsCounters& counters = g_ioStats[m_kind];
+    InterlockedIncrement64(&counters.operations);
+    InterlockedAdd64(&counters.bytes, (LONGLONG)m_bytes);
+    InterlockedAdd64(&counters.ticks, now.QuadPart - m_start);
+}
+
+void GetIoStats(IoStatsTotals o_totals[IO_STATS_KIND_COUNT])
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    for (int i = 0; i < IO_STATS_KIND_COUNT; i++)
+    {
+        o_totals[i].operations = (unsigned long long)g_ioStats[i].operations;
+        o_totals[i].bytes = (unsigned long long)g_ioStats[i].bytes;
+        o_totals[i].microseconds = (unsigned long long)(g_ioStats[i].ticks * 1000000 / frequency.QuadPart);
+    }
+}
+
+#else
+
+void GetIoStats(IoStatsTotals o_totals[IO_STATS_KIND_COUNT])
+{
+    for (int i = 0; i < IO_STATS_KIND_COUNT; i++)
     {
-        tstring libraryPath = tstring(SystemDirectoryPathBuffer) + TEXT("\\SHCORE.DLL");
-        hinstSHCORE = LoadLibrary(libraryPath.c_str());
+        o_totals[i].operations = o_totals[i].bytes = o_totals[i].microseconds = 0;
     }
+}
+
+#endif // IO_STATS
+
+/*
+Lock, SharedLock
+*/
+
+// Spin briefly before blocking: the locks we hold are held for short times.
+#define LOCK_SPIN_COUNT 4000
+
+#if LOCK_STATS
+
+// Updated with interlocked operations: locks with the same name share one.
+// Times are in performance counter ticks.
+struct LockStats
+{
+    string name;
+    volatile LONGLONG acquisitions;
+    volatile LONGLONG contended;
+    volatile LONGLONG totalWait;
+    volatile LONGLONG maxWait;
+    volatile LONGLONG totalHold;
+    volatile LONGLONG maxHold;
+
+    LockStats(const string& name)
+        : name(name), acquisitions(0), contended(0),
+          totalWait(0), maxWait(0), totalHold(0), maxHold(0) {}
+};
+
+// The registry of stats is guarded by a plain critical section, as the stats
+// are never removed: locks come and go, and a name's totals carry on.
+struct LockStatsRegistry
+{
+    CRITICAL_SECTION criticalSection;
+    map<string, LockStats*> stats;
+
+    LockStatsRegistry() { InitializeCriticalSection(&criticalSection); }
+};
+
+// Function-local so that it's ready for Locks with static storage.
+static LockStatsRegistry& GetLockStatsRegistry()
+{
+    // Never destroyed, so that static Locks can outlive it at exit.
+    static LockStatsRegistry* registry = new LockStatsRegistry();
+    return *registry;
+}
+
+static LockStats* GetLockStatsForName(const char* name)
+{
+    LockStatsRegistry& registry = GetLockStatsRegistry();
+    EnterCriticalSection(&registry.criticalSection);
 
-    if (hinstSHCORE)
+    LockStats*& stats = registry.stats[name];
+    if (!stats)
     {
-        typedef HRESULT STDAPICALLTYPE SETPROCESSDPIAWARENESSFN(PROCESS_DPI_AWARENESS value);
-        SETPROCESSDPIAWARENESSFN *pfnSetProcessDpiAwareness;
-        pfnSetProcessDpiAwareness = (SETPROCESSDPIAWARENESSFN*)GetProcAddress(hinstSHCORE, "SetProcessDpiAwareness");
+        stats = new LockStats(name);
+    }
+
+    LeaveCriticalSection(&registry.criticalSection);
+    return stats;
+}
+
+static LONGLONG LockStatsNow()
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return now.QuadPart;
+}
 
-        if (pfnSetProcessDpiAwareness)
+static void LockStatsUpdateMax(volatile LONGLONG& max, LONGLONG value)
+{
+    LONGLONG current = max;
+    while (value > current)
+    {
+        LONGLONG previous = InterlockedCompareExchange64(&max, value, current);
+        if (previous == current)
         {
-            res = pfnSetProcessDpiAwareness(value);
+            break;
         }
+        current = previous;
+    }
+}
+
+vector<LockStatsSnapshot> GetLockStats()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    auto toMicroseconds = [&frequency](LONGLONG ticks) {
+        return (unsigned long long)(ticks * 1000000 / frequency.QuadPart);
+    };
+
+    vector<LockStatsSnapshot> snapshots;
 
-        FreeLibrary(hinstSHCORE);
+    LockStatsRegistry& registry = GetLockStatsRegistry();
+    EnterCriticalSection(&registry.criticalSection);
+
+    for (auto it = registry.stats.begin(); it != registry.stats.end(); ++it)
+    {
+        const LockStats* stats = it->second;
+        LockStatsSnapshot snapshot;
+        snapshot.name = stats->name;
+        snapshot.acquisitions = (unsigned long long)stats->acquisitions;
+        snapshot.contended = (unsigned long long)stats->contended;
+        snapshot.totalWaitMicroseconds = toMicroseconds(stats->totalWait);
+        snapshot.maxWaitMicroseconds = toMicroseconds(stats->maxWait);
+        snapshot.totalHoldMicroseconds = toMicroseconds(stats->totalHold);
+        snapshot.maxHoldMicroseconds = toMicroseconds(stats->maxHold);
+        snapshots.push_back(snapshot);
     }
 
-    return res;
+    LeaveCriticalSection(&registry.criticalSection);
+    return snapshots;
 }
 
-HRESULT GetDpiForMonitor(HMONITOR hmonitor, MONITOR_DPI_TYPE dpiType, UINT *dpiX, UINT *dpiY)
+#else
+
+vector<LockStatsSnapshot> GetLockStats()
+{
+    return vector<LockStatsSnapshot>();
+}
+
+#endif // LOCK_STATS
+
+Lock::Lock(const char* statsName/*=NULL*/)
+{
+    // Can only fail on XP, under low memory, which we don't recover from anyway.
+    (void)InitializeCriticalSectionAndSpinCount(&m_criticalSection, LOCK_SPIN_COUNT);
+
+#if LOCK_STATS
+    m_stats = statsName ? GetLockStatsForName(statsName) : NULL;
+    m_depth = 0;
+    m_acquiredTime = 0;
+#else
+    (void)statsName;
+#endif
+}
+
+Lock::~Lock()
+{
+    DeleteCriticalSection(&m_criticalSection);
+}
+
+void Lock::Acquire() const
 {
-    HRESULT res = ERROR_NOT_SUPPORTED;
+#if LOCK_STATS
+    if (m_stats)
+    {
+        if (!TryEnterCriticalSection(&m_criticalSection))
+        {
+            LONGLONG waitStart = LockStatsNow();
+            EnterCriticalSection(&m_criticalSection);
+            LONGLONG wait = LockStatsNow() - waitStart;
+
+            InterlockedIncrement64(&m_stats->contended);
+            InterlockedAdd64(&m_stats->totalWait, wait);
+            LockStatsUpdateMax(m_stats->maxWait, wait);
+        }
+
+        InterlockedIncrement64(&m_stats->acquisitions);
+
+        // Hold time is from the outermost acquisition to its release.
+        if (m_depth++ == 0)
+        {
+            m_acquiredTime = LockStatsNow();
+        }
+        return;
+    }
+#endif
+
+    EnterCriticalSection(&m_criticalSection);
+}
+
+void Lock::Release() const
+{
+#if LOCK_STATS
+    if (m_stats && --m_depth == 0)
+    {
+        LONGLONG hold = LockStatsNow() - m_acquiredTime;
+        InterlockedAdd64(&m_stats->totalHold, hold);
+        LockStatsUpdateMax(m_stats->maxHold, hold);
+    }
+#endif
+
+    LeaveCriticalSection(&m_criticalSection);
+}
+
+// Slim reader/writer lock functions are Vista+, so they're looked up once.
+typedef VOID (WINAPI *SRWLOCK_FUNCTION)(PSRWLOCK);
+
+struct SRWLockFunctions
+{
+    SRWLOCK_FUNCTION acquireShared;
+    SRWLOCK_FUNCTION releaseShared;
+    SRWLOCK_FUNCTION acquireExclusive;
+    SRWLOCK_FUNCTION releaseExclusive;
+
+    SRWLockFunctions()
+    {
+        HMODULE kernel32 = GetModuleHandle(_T("kernel32.dll"));
+        acquireShared = (SRWLOCK_FUNCTION)GetProcAddress(kernel32, "AcquireSRWLockShared");
+        releaseShared = (SRWLOCK_FUNCTION)GetProcAddress(kernel32, "ReleaseSRWLockShared");
+        acquireExclusive = (SRWLOCK_FUNCTION)GetProcAddress(kernel32, "AcquireSRWLockExclusive");
+        releaseExclusive = (SRWLOCK_FUNCTION)GetProcAddress(kernel32, "ReleaseSRWLockExclusive");
+
+        if (!acquireShared || !releaseShared || !acquireExclusive || !releaseExclusive)
+        {
+            acquireShared = releaseShared = acquireExclusive = releaseExclusive = NULL;
+        }
+    }
+
+    bool Available() const { return acquireShared != NULL; }
+};
+
+// Function-local so that it's ready for SharedLocks with static storage.
+static const SRWLockFunctions& GetSRWLockFunctions()
+{
+    static SRWLockFunctions functions;
+    return functions;
+}
+
+SharedLock::SharedLock()
+{
+    SRWLOCK init = SRWLOCK_INIT;
+    m_srwLock = init;
+    if (!GetSRWLockFunctions().Available())
+    {
+        (void)InitializeCriticalSectionAndSpinCount(&m_criticalSection, LOCK_SPIN_COUNT);
+    }
+}
+
+SharedLock::~SharedLock()
+{
+    // An SRW lock needs no cleanup.
+    if (!GetSRWLockFunctions().Available())
+    {
+        DeleteCriticalSection(&m_criticalSection);
+    }
+}
+
+void SharedLock::AcquireShared() const
+{
+    const SRWLockFunctions& srw = GetSRWLockFunctions();
+    if (srw.Available()) srw.acquireShared(&m_srwLock);
+    else EnterCriticalSection(&m_criticalSection);
+}
+
+void SharedLock::ReleaseShared() const
+{
+    const SRWLockFunctions& srw = GetSRWLockFunctions();
+    if (srw.Available()) srw.releaseShared(&m_srwLock);
+    else LeaveCriticalSection(&m_criticalSection);
+}
+
+void SharedLock::AcquireExclusive() const
+{
+    const SRWLockFunctions& srw = GetSRWLockFunctions();
+    if (srw.Available()) srw.acquireExclusive(&m_srwLock);
+    else EnterCriticalSection(&m_criticalSection);
+}
+
+void SharedLock::ReleaseExclusive() const
+{
+    const SRWLockFunctions& srw = GetSRWLockFunctions();
+    if (srw.Available()) srw.releaseExclusive(&m_srwLock);
+    else LeaveCriticalSection(&m_criticalSection);
+}
+
+/*
+Optional System APIs
+*/
 
-    HINSTANCE hinstSHCORE = NULL;
+// Library name -> module, or NULL if it couldn't be loaded
+static Lock g_systemLibrariesLock("SystemLibraries");
+static map<tstring, HMODULE> g_systemLibraries;
 
+HMODULE GetSystemLibrary(LPCTSTR name)
+{
+    AutoLock lock(g_systemLibrariesLock);
+
+    auto it = g_systemLibraries.find(name);
+    if (it != g_systemLibraries.end())
+    {
+        return it->second;
+    }
+
+    // Only from the system directory, so a DLL planted beside us can't be
+    // loaded in its place.
+    HMODULE module = NULL;
     static const int maxPathBufferSize = MAX_PATH + 1;
     TCHAR SystemDirectoryPathBuffer[maxPathBufferSize];
     if (GetSystemDirectory(SystemDirectoryPathBuffer, maxPathBufferSize))
     {
-        tstring libraryPath = tstring(SystemDirectoryPathBuffer) + TEXT("\\SHCORE.DLL");
-        hinstSHCORE = LoadLibrary(TEXT("SHCORE.DLL"));
+        tstring libraryPath = tstring(SystemDirectoryPathBuffer) + _T("\\") + name;
+        module = LoadLibrary(libraryPath.c_str());
     }
 
-    if (hinstSHCORE)
+    if (!module)
     {
-        typedef HRESULT STDAPICALLTYPE GETDPIFORMONITORFN(HMONITOR hmonitor, MONITOR_DPI_TYPE dpiType, UINT *dpiX, UINT *dpiY);
-        GETDPIFORMONITORFN *pfnGetDpiForMonitor;
-        pfnGetDpiForMonitor = (GETDPIFORMONITORFN*)GetProcAddress(hinstSHCORE, "GetDpiForMonitor");
+        my_print(NOT_SENSITIVE, true, _T("%s: %s not available (%d)"), __TFUNCTION__, name, GetLastError());
+    }
 
-        if (pfnGetDpiForMonitor)
-        {
-            res = pfnGetDpiForMonitor(hmonitor, dpiType, dpiX, dpiY);
-        }
+    g_systemLibraries[name] = module;
+    return module;
+}
+
+FARPROC GetSystemLibraryProc(LPCTSTR library, LPCSTR proc)
+{
+    HMODULE module = GetSystemLibrary(library);
+    if (!module)
+    {
+        return NULL;
+    }
+    return GetProcAddress(module, proc);
+}
+
+/*
+Timer Utilities
+*/
+
+typedef UINT_PTR (WINAPI *SETCOALESCABLETIMERFN)(HWND, UINT_PTR, UINT, TIMERPROC, ULONG);
+
+static SETCOALESCABLETIMERFN GetSetCoalescableTimer()
+{
+    // Not in XP's user32, so it's looked up. Timers are only set from the
+    // main window thread.
+    static bool s_looked = false;
+    static SETCOALESCABLETIMERFN s_pfnSetCoalescableTimer = NULL;
+    if (!s_looked)
+    {
+        s_pfnSetCoalescableTimer = (SETCOALESCABLETIMERFN)GetProcAddress(GetModuleHandle(_T("user32.dll")), "SetCoalescableTimer");
+        s_looked = true;
+    }
+    return s_pfnSetCoalescableTimer;
+}
+
+UINT_PTR SetCoalescableTimerIfAvailable(
+            HWND hWnd,
+            UINT_PTR idEvent,
+            UINT elapseMilliseconds,
+            TIMERPROC timerFunc,
+            ULONG toleranceMilliseconds)
+{
+    SETCOALESCABLETIMERFN pfnSetCoalescableTimer = GetSetCoalescableTimer();
+    if (pfnSetCoalescableTimer)
+    {
+        return pfnSetCoalescableTimer(hWnd, idEvent, elapseMilliseconds, timerFunc, toleranceMilliseconds);
+    }
+    return ::SetTimer(hWnd, idEvent, elapseMilliseconds, timerFunc);
+}
+
+/*
+DPI Awareness Utilities
+*/
+
+// SHCORE.DLL is Windows 8.1 and later. GetDpiForMonitor is called as the
+// window moves, so its lookup is only done once.
+
+HRESULT SetProcessDpiAwareness(PROCESS_DPI_AWARENESS value)
+{
+    typedef HRESULT STDAPICALLTYPE SETPROCESSDPIAWARENESSFN(PROCESS_DPI_AWARENESS value);
+    static SETPROCESSDPIAWARENESSFN* pfnSetProcessDpiAwareness =
+        (SETPROCESSDPIAWARENESSFN*)GetSystemLibraryProc(_T("SHCORE.DLL"), "SetProcessDpiAwareness");
+
+    if (!pfnSetProcessDpiAwareness)
+    {
+        // In the no-op/unsupported case we're going to return success.
+        return S_OK;
+    }
+
+    return pfnSetProcessDpiAwareness(value);
+}
+
+HRESULT GetDpiForMonitor(HMONITOR hmonitor, MONITOR_DPI_TYPE dpiType, UINT *dpiX, UINT *dpiY)
+{
+    typedef HRESULT STDAPICALLTYPE GETDPIFORMONITORFN(HMONITOR hmonitor, MONITOR_DPI_TYPE dpiType, UINT *dpiX, UINT *dpiY);
+    static GETDPIFORMONITORFN* pfnGetDpiForMonitor =
+        (GETDPIFORMONITORFN*)GetSystemLibraryProc(_T("SHCORE.DLL"), "GetDpiForMonitor");
 
-        FreeLibrary(hinstSHCORE);
+    if (!pfnGetDpiForMonitor)
+    {
+        return ERROR_NOT_SUPPORTED;
     }
 
-    return res;
+    return pfnGetDpiForMonitor(hmonitor, dpiType, dpiX, dpiY);
 }
 
 HRESULT GetDpiForCurrentMonitor(HWND hWnd, UINT& o_dpi)
@@ -1925,3 +3120,51 @@ float ConvertDpiToScaling(UINT dpi)
     const UINT defaultDPI = 96;
     return dpi / (float)defaultDPI;
 }
+
+
+/*
+ * RecentlySeenSet
+ */
+
+RecentlySeenSet::RecentlySeenSet(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+bool RecentlySeenSet::CheckAndInsert(const string& value)
+{
+    // FNV-1a
+    unsigned long long hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < value.length(); i++)
+    {
+        hash = (hash ^ (unsigned char)value[i]) * 1099511628211ULL;
+    }
+
+    Index::iterator found = m_index.find(hash);
+    if (found != m_index.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, found->second);
+        return true;
+    }
+
+    if (m_capacity == 0)
+    {
+        return false;
+    }
+
+    if (m_lru.size() >= m_capacity)
+    {
+        m_index.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+
+    m_lru.push_front(hash);
+    m_index[hash] = m_lru.begin();
+    return false;
+}
+
+void RecentlySeenSet::Clear()
+{
+    m_index.clear();
+    m_lru.clear();
+}
@@ -19,6 +19,9 @@
 
 #pragma once
 
+#include <list>
+#include <unordered_map>
+
 struct StopInfo;
 
 
@@ -36,6 +39,18 @@ bool GetShortPathName(const tstring& path, tstring& o_shortPath);
 
 bool WriteFile(const tstring& filename, const string& data);
 
+// Returns false if the file doesn't exist or can't be read. Caller can check GetLastError().
+bool ReadFileContents(const tstring& filename, string& o_data);
+
+// Like WriteFile, but leaves the file alone if it already holds data, and
+// otherwise writes a temp file and moves it into place, so the file is never
+// seen half-written. For files rewritten on every connect: each write is
+// rescanned by antivirus software.
+bool WriteFileIfChanged(const tstring& filename, const string& data);
+
+// Gets what the file system says about the file, without opening it.
+bool GetFileSizeAndTime(const TCHAR* filePath, ULONGLONG& o_size, ULONGLONG& o_lastWriteTime);
+
 // Makes a directory that has a path with the given suffix that is suitable for
 // storing data (such as the DataStoreDirectory).
 // pathSuffixes may be empty. Directory will be created if ensureExists is true.
@@ -75,12 +90,22 @@ bool TestForOpenPort(int& targetPort, int maxIncrement, const StopInfo& stopInfo
 
 void StopProcess(DWORD processID, HANDLE process);
 
+// For a child process created with CREATE_SUSPENDED: adds it to a job shared
+// by all our child processes, then lets it run. The job is closed -- and the
+// children killed -- when this process exits, even if it crashes, so none
+// are left running. Not being able to add it isn't fatal (e.g., we're in a
+// job already, and jobs don't nest before Windows 8). Returns false if the
+// process couldn't be resumed, in which case it's been terminated.
+// The process is also recorded, so a later run can find it if it's left over.
+bool ResumeChildProcessInJob(const PROCESS_INFORMATION& processInfo, const tstring& exePath);
+
 bool CreateSubprocessPipes(
         HANDLE& o_parentOutputPipe, // Parent reads the child's stdout/stdin from this
         HANDLE& o_parentInputPipe,  // Parent writes to the child's stdin with this
         HANDLE& o_childStdinPipe,   // Child's stdin pipe
         HANDLE& o_childStdoutPipe,  // Child's stdout pipe
-        HANDLE& o_childStderrPipe);  // Child's stderr pipe (dup of stdout)
+        HANDLE& o_childStderrPipe,  // Child's stderr pipe (dup of stdout)
+        bool overlappedParentOutput=false); // If true, o_parentOutputPipe is opened for overlapped reads
 
 
 /*
@@ -101,6 +126,24 @@ bool WriteRegistryStringValue(const string& name, const wstring& value, Registry
 bool ReadRegistryStringValue(LPCSTR name, string& value);
 bool ReadRegistryStringValue(LPCSTR name, wstring& value);
 
+/*
+While one of these is in scope, registry writes made on this thread are held
+and then made together when the outermost one goes out of scope. Reads on
+this thread see the held values; other threads don't until then.
+Writes while batched always succeed; failures are only logged, so anything
+that needs to know whether its write succeeded (or the failure reason)
+shouldn't be batched.
+*/
+class RegistryWriteBatch
+{
+public:
+    RegistryWriteBatch();
+    ~RegistryWriteBatch();
+
+    RegistryWriteBatch(const RegistryWriteBatch&) = delete;
+    RegistryWriteBatch& operator=(const RegistryWriteBatch&) = delete;
+};
+
 
 /*
  * Text Display Utilities
@@ -125,10 +168,16 @@ bool TestBoolArray(const vector<const bool*>& boolArray);
 string Hexlify(const unsigned char* input, size_t length);
 
 string Dehexlify(const string& input);
+// Decodes into o_output, reusing its storage. Throws std::invalid_argument.
+void Dehexlify(const char* input, size_t length, string& o_output);
 
 string Base64Encode(const unsigned char* input, size_t length);
 string Base64Decode(const string& input);
 
+// Returns the hex-encoded SHA-256 digest of input.
+string Sha256Hex(const string& input);
+string Sha256Hex(const unsigned char* input, size_t length);
+
 bool PublicKeyEncryptData(const char* publicKey, const char* plaintext, string& o_encrypted);
 
 tstring UrlEncode(const tstring& input);
@@ -141,6 +190,14 @@ tstring UrlDecode(const tstring& input);
 
 DWORD GetTickCountDiff(DWORD start, DWORD end);
 
+// A clock for deadlines and measuring intervals that never wraps or goes
+// backwards, unlike GetTickCount, and has the performance counter's
+// resolution (well under a millisecond) rather than the tick's 10-16 ms.
+// Counts from an arbitrary point, so only differences mean anything.
+// Threadsafe.
+unsigned long long MonotonicMicroseconds();
+unsigned long long MonotonicMilliseconds();
+
 tstring GetLocaleName();
 
 // Should be called (by psiclient) when the UI locale is set.
@@ -151,6 +208,20 @@ void SetUiLocale(const wstring& uiLocale);
 // running in. Returns ISO 3166-1 alpha-2 format.
 wstring GetDeviceRegion();
 
+enum HostEnvironmentChange
+{
+    HOST_ENVIRONMENT_LOCALE     = 1 << 0,
+    HOST_ENVIRONMENT_NETWORK    = 1 << 1,
+    HOST_ENVIRONMENT_PATHS      = 1 << 2,
+    HOST_ENVIRONMENT_ALL        = HOST_ENVIRONMENT_LOCALE | HOST_ENVIRONMENT_NETWORK | HOST_ENVIRONMENT_PATHS
+};
+
+// GetDataPath, GetTempPath, GetShortPathName, GetLocaleName, GetDeviceRegion
+// and WininetGetNetworkInfo cache their answers. This drops those affected
+// by `changes` (HostEnvironmentChange flags), to be called when the system
+// says they've changed.
+void InvalidateHostEnvironment(DWORD changes);
+
 /// Returns true if the current Windows version is supported by the Psiphon client.
 /// Otherwise Psiphon will not and cannot function and the user should be told.
 bool IsOSSupported();
@@ -191,6 +262,14 @@ std::vector<basic_string<charT>> split(const basic_string<charT> &s, charT delim
     return split(s, delim, elems);
 }
 
+// Approximately how much heap a string's buffer takes, for memory accounting.
+// Short strings fit in the object itself and take none.
+template <typename charT>
+size_t StringHeapBytes(const basic_string<charT>& s) {
+    const size_t inlineCapacity = (16 / sizeof(charT)) - 1;
+    return s.capacity() > inlineCapacity ? (s.capacity() + 1) * sizeof(charT) : 0;
+}
+
 #ifndef STRINGIZE
 // From MSVC++ 2012's _STRINGIZE macro
 #define __STRINGIZEX(x) #x
@@ -211,6 +290,9 @@ bool GetResourceBytes(LPCTSTR name, LPCTSTR type, BYTE*& o_pBytes, DWORD& o_size
 
 /*
  * AutoHANDLE and AutoMUTEX
+ * AutoMUTEX is for kernel mutexes, which are only needed when the lock is
+ * shared with another process (or named, for single instance checks). Locks
+ * within the process should be a Lock or SharedLock, below.
  */
 class AutoHANDLE
 {
@@ -233,6 +315,183 @@ private:
 };
 
 
+/*
+ * Lock stats
+ * When LOCK_STATS is set (by default, in debug builds), named Locks count
+ * their acquisitions and how long they're waited for and held. Unnamed locks,
+ * and all locks in builds without it, pay nothing.
+ */
+#ifndef LOCK_STATS
+#ifdef _DEBUG
+#define LOCK_STATS 1
+#else
+#define LOCK_STATS 0
+#endif
+#endif
+
+// Totals since startup for all locks with the same name. Times are in
+// microseconds; "contended" acquisitions are those that had to wait.
+struct LockStatsSnapshot
+{
+    string name;
+    unsigned long long acquisitions;
+    unsigned long long contended;
+    unsigned long long totalWaitMicroseconds;
+    unsigned long long maxWaitMicroseconds;
+    unsigned long long totalHoldMicroseconds;
+    unsigned long long maxHoldMicroseconds;
+};
+
+// Empty when built without LOCK_STATS.
+vector<LockStatsSnapshot> GetLockStats();
+
+struct LockStats;
+
+
+/*
+ * I/O stats
+ * When IO_STATS is set (by default, in debug builds), the registry and file
+ * helpers here and the WinINet option calls count their operations, the bytes
+ * they move and the time they take, per kind of I/O. The totals are
+ * process-wide. Builds without it pay nothing.
+ */
+#ifndef IO_STATS
+#ifdef _DEBUG
+#define IO_STATS 1
+#else
+#define IO_STATS 0
+#endif
+#endif
+
+enum IoStatsKind
+{
+    // Registry reads that missed the cache, and registry writes
+    IO_STATS_REGISTRY_READ = 0,
+    IO_STATS_REGISTRY_WRITE,
+    IO_STATS_FILE_READ,
+    IO_STATS_FILE_WRITE,
+    IO_STATS_WININET_OPTION,
+    IO_STATS_KIND_COUNT
+};
+
+struct IoStatsTotals
+{
+    unsigned long long operations;
+    unsigned long long bytes;
+    unsigned long long microseconds;
+};
+
+// E.g., "registryRead"
+const char* IoStatsKindName(IoStatsKind kind);
+
+// Totals since startup, indexed by IoStatsKind. All zero when built without
+// IO_STATS.
+void GetIoStats(IoStatsTotals o_totals[IO_STATS_KIND_COUNT]);
+
+// Counts one operation, timed from construction to destruction.
+class IoStatsScope
+{
+public:
+#if IO_STATS
+    IoStatsScope(IoStatsKind kind);
+    ~IoStatsScope();
+    void AddBytes(size_t bytes) { m_bytes += bytes; }
+private:
+    IoStatsKind m_kind;
+    LONGLONG m_start;
+    unsigned long long m_bytes;
+#else
+    IoStatsScope(IoStatsKind) {}
+    void AddBytes(size_t) {}
+#endif
+};
+
+
+/*
+ * Lock and AutoLock
+ * In-process lock that stays in user mode unless it's contended. Like a
+ * kernel mutex, it may be re-acquired by the thread that holds it.
+ * statsName, if given, is what the lock's stats are kept under (see above);
+ * it's copied.
+ */
+class Lock
+{
+public:
+    Lock(const char* statsName=NULL);
+    ~Lock();
+    void Acquire() const;
+    void Release() const;
+private:
+    Lock(const Lock&);
+    Lock& operator=(const Lock&);
+    mutable CRITICAL_SECTION m_criticalSection;
+#if LOCK_STATS
+    LockStats* m_stats;
+    // Only touched by the thread holding the lock
+    mutable LONG m_depth;
+    mutable LONGLONG m_acquiredTime;
+#endif
+};
+
+class AutoLock
+{
+public:
+    AutoLock(const Lock& lock) : m_lock(lock) { m_lock.Acquire(); }
+    ~AutoLock() { m_lock.Release(); }
+private:
+    AutoLock(const AutoLock&);
+    AutoLock& operator=(const AutoLock&);
+    const Lock& m_lock;
+};
+
+
+/*
+ * SharedLock, AutoSharedLock and AutoExclusiveLock
+ * In-process reader/writer lock, for data that's read much more often than
+ * it's changed. Unlike Lock, it's NOT re-entrant: a thread holding it in
+ * either mode must not acquire it again.
+ * Uses a slim reader/writer lock where there is one (Vista+); on XP it falls
+ * back to an exclusive lock, which is correct, just not concurrent.
+ */
+class SharedLock
+{
+public:
+    SharedLock();
+    ~SharedLock();
+    void AcquireShared() const;
+    void ReleaseShared() const;
+    void AcquireExclusive() const;
+    void ReleaseExclusive() const;
+private:
+    SharedLock(const SharedLock&);
+    SharedLock& operator=(const SharedLock&);
+    mutable SRWLOCK m_srwLock;
+    mutable CRITICAL_SECTION m_criticalSection; // XP fallback
+};
+
+class AutoSharedLock
+{
+public:
+    AutoSharedLock(const SharedLock& lock) : m_lock(lock) { m_lock.AcquireShared(); }
+    ~AutoSharedLock() { m_lock.ReleaseShared(); }
+private:
+    AutoSharedLock(const AutoSharedLock&);
+    AutoSharedLock& operator=(const AutoSharedLock&);
+    const SharedLock& m_lock;
+};
+
+class AutoExclusiveLock
+{
+public:
+    AutoExclusiveLock(const SharedLock& lock) : m_lock(lock) { m_lock.AcquireExclusive(); }
+    ~AutoExclusiveLock() { m_lock.ReleaseExclusive(); }
+private:
+    AutoExclusiveLock(const AutoExclusiveLock&);
+    AutoExclusiveLock& operator=(const AutoExclusiveLock&);
+    const SharedLock& m_lock;
+};
+
+
 /*
 finally function
 
@@ -257,6 +516,64 @@ FinalAction<F> finally(F f) {
 }
 
 
+/*
+A bounded set of recently seen strings, for deduping things like log lines
+that can repeat without end. Only a 64-bit hash of each string is kept, and
+the least recently seen is dropped at capacity, so memory is fixed. A hash
+collision makes a new string look seen; that's fine for its uses.
+Not threadsafe.
+*/
+class RecentlySeenSet
+{
+public:
+    RecentlySeenSet(size_t capacity);
+
+    // Returns true if value was seen recently; either way, it's now the most
+    // recently seen.
+    bool CheckAndInsert(const string& value);
+
+    void Clear();
+
+private:
+    typedef list<unsigned long long> LRU;
+    typedef unordered_map<unsigned long long, LRU::iterator> Index;
+
+    size_t m_capacity;
+    LRU m_lru;
+    Index m_index;
+};
+
+
+/*
+ * Optional System APIs
+ */
+
+// Loads the named DLL from the system directory the first time it's asked
+// for, and keeps it loaded for the life of the process. Returns NULL if it
+// isn't there (which is remembered too). Threadsafe.
+HMODULE GetSystemLibrary(LPCTSTR name);
+
+// Looks up a function in an optional system DLL; NULL if either is missing.
+// As this is cheap but not free, callers should hold on to what they're given,
+// e.g. in a function-local static.
+FARPROC GetSystemLibraryProc(LPCTSTR library, LPCSTR proc);
+
+
+/*
+ * Timer Utilities
+ */
+
+// SetTimer, but the timer may fire up to toleranceMilliseconds late so that
+// Windows can coalesce it with other wakeups (SetCoalescableTimer, Windows 8
+// and later). Plain SetTimer elsewhere.
+UINT_PTR SetCoalescableTimerIfAvailable(
+            HWND hWnd,
+            UINT_PTR idEvent,
+            UINT elapseMilliseconds,
+            TIMERPROC timerFunc,
+            ULONG toleranceMilliseconds);
+
+
 /*
  * DPI Awareness Utilities
  */
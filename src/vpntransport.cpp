@@ -25,13 +25,23 @@
 #include "psiclient.h"
 #include "ras.h"
 #include "raserror.h"
+#include "ras_inventory.h"
 #include "utilities.h"
 #include "server_request.h"
 #include "diagnostic_info.h"
+#include "thread_pool.h"
+#include "config.h"
 
 
 #define VPN_CONNECTION_TIMEOUT_SECONDS  20
-#define VPN_CONNECTION_NAME             _T("Psiphon3")
+// How many servers after the current one to get PSKs for while it's dialled.
+// 0 disables prefetching.
+#define VPN_HANDSHAKE_PREFETCH_COUNT    2
+// Older prefetched handshakes aren't used.
+#define VPN_HANDSHAKE_PREFETCH_MAX_AGE_MS   (2*60*1000)
+// Bump when the phonebook entry set up in EnsurePhonebookEntry changes, so
+// that existing entries are rewritten.
+#define VPN_PHONEBOOK_ENTRY_VERSION     1
 
 
 void TweakVPN();
@@ -49,12 +59,14 @@ void VPNTransport::GetFactory(
                     tstring& o_transportDisplayName,
                     tstring& o_transportProtocolName,
                     TransportFactoryFn& o_transportFactory,
-                    AddServerEntriesFn& o_addServerEntriesFn)
+                    AddServerEntriesFn& o_addServerEntriesFn,
+                    bool& o_handshakeRequired)
 {
     o_transportFactory = New;
     o_transportDisplayName = VPN_TRANSPORT_DISPLAY_NAME;
     o_transportProtocolName = VPN_TRANSPORT_PROTOCOL_NAME;
     o_addServerEntriesFn = ITransport::AddServerEntries;
+    o_handshakeRequired = true;
 }
 
 
@@ -62,8 +74,14 @@ VPNTransport::VPNTransport()
     : ITransport(GetTransportProtocolName().c_str()),
       m_state(CONNECTION_STATE_STOPPED),
       m_stateChangeEvent(INVALID_HANDLE_VALUE),
+      m_disconnectedEvent(NULL),
+      m_disconnectedWait(NULL),
       m_rasConnection(0),
-      m_lastErrorCode(0)
+      m_lastErrorCode(0),
+      m_refreshHandshake(false),
+      m_lastRasBytesSent(0),
+      m_lastRasBytesReceived(0),
+      m_interfaceBytes(0)
 {
     m_stateChangeEvent = CreateEvent(NULL, FALSE, FALSE, 0);
 }
@@ -72,6 +90,10 @@ VPNTransport::~VPNTransport()
 {
     IWorkerThread::Stop();
 
+    // They use this object, so must finish first
+    m_handshakePrefetches.clear();
+    m_handshakeRefresh.reset();
+
     // We must be careful about cleaning up if we're upgrading -- we expect the
     // client to restart again and don't want a race between the old and
     // new processes to potentially mess with the new process's session.
@@ -80,6 +102,7 @@ VPNTransport::~VPNTransport()
     {
         (void)Cleanup();
     }
+    StopWatchingForDisconnection();
     CloseHandle(m_stateChangeEvent);
 }
 
@@ -112,6 +135,38 @@ bool VPNTransport::RequiresStatsSupport() const
     return true;
 }
 
+bool VPNTransport::GetInterfaceBytesTransferred(unsigned long long& o_bytes)
+{
+    AutoLock lock(m_interfaceStatsLock);
+
+    HRASCONN rasConnection = m_rasConnection;
+    if (!rasConnection || CONNECTION_STATE_CONNECTED != GetConnectionState())
+    {
+        return false;
+    }
+
+    // Counted at the PPP layer, so it's the user's traffic, without the
+    // L2TP/IPSec overhead.
+    RAS_STATS stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.dwSize = sizeof(stats);
+    DWORD returnCode = RasGetConnectionStatistics(rasConnection, &stats);
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: RasGetConnectionStatistics failed (%d)"), __TFUNCTION__, returnCode);
+        return false;
+    }
+
+    // Unsigned differences are right across a wrap.
+    m_interfaceBytes += (DWORD)(stats.dwBytesXmited - m_lastRasBytesSent);
+    m_interfaceBytes += (DWORD)(stats.dwBytesRcved - m_lastRasBytesReceived);
+    m_lastRasBytesSent = stats.dwBytesXmited;
+    m_lastRasBytesReceived = stats.dwBytesRcved;
+
+    o_bytes = m_interfaceBytes;
+    return true;
+}
+
 tstring VPNTransport::GetLastTransportError() const
 {
     tstringstream s;
@@ -136,11 +191,16 @@ bool VPNTransport::SupportsAuthorizations() const
 
 bool VPNTransport::ServerHasCapabilities(const ServerEntry& entry) const
 {
-    // VPN requires a pre-tunnel handshake
+    // VPN requires a pre-tunnel handshake. That check can involve making
+    // temp transports, so it's done last.
 
-    bool canHandshake = ServerRequest::ServerHasRequestCapabilities(entry);
+    return entry.HasCapabilities(RequiredServerCapabilities())
+           && ServerRequest::ServerHasRequestCapabilities(entry);
+}
 
-    return canHandshake && entry.HasCapability(WStringToUTF8(GetTransportProtocolName()));
+unsigned int VPNTransport::RequiredServerCapabilities() const
+{
+    return SERVER_CAPABILITY_VPN;
 }
 
 bool VPNTransport::Cleanup()
@@ -156,12 +216,19 @@ bool VPNTransport::Cleanup()
     if (!rasConnection)
     {
         // If there is no active RAS connection, we don't want to do anything.
-        // We especially don't want to delete the phone book entry for a connection
-        // that is connecting (but not active so does not enumerate) because that will
-        // result in an ERROR_PORT_NOT_AVAILABLE error from RasDial until a reboot.
+        // We especially don't want to delete or rewrite the phone book entry for
+        // a connection that is connecting (but not active so does not enumerate)
+        // because that will result in an ERROR_PORT_NOT_AVAILABLE error from
+        // RasDial until a reboot.
         return true;
     }
 
+    // Registered before hanging up, so the disconnection can't be missed.
+    // Without it we fall back to polling.
+    AutoHANDLE disconnectedEvent = CreateEvent(0, FALSE, FALSE, 0);
+    bool notifying = disconnectedEvent
+                     && ERROR_SUCCESS == RasConnectionNotification(rasConnection, disconnectedEvent, RASCN_Disconnection);
+
     // Hang up
     returnCode = RasHangUp(rasConnection);
     if (ERROR_NO_CONNECTION == returnCode)
@@ -172,7 +239,7 @@ bool VPNTransport::Cleanup()
     {
         my_print(NOT_SENSITIVE, false, _T("RasHangUp failed (%d)"), returnCode);
 
-        // Don't delete entry when in this state -- Windows gets confused
+        // Don't touch the entry when in this state -- Windows gets confused
         return false;
     }
 
@@ -184,32 +251,38 @@ bool VPNTransport::Cleanup()
     // Wait until the connection has been terminated.
     // See the remarks here:
     // http://msdn.microsoft.com/en-us/library/aa377567(VS.85).aspx
-    const int sleepTime = 100; // milliseconds
-    const int maxSleepTime = 5000; // 5 seconds max wait time
-    int totalSleepTime = 0;
+    const DWORD pollTime = 10; // milliseconds
+    const DWORD maxWaitTime = 5000; // 5 seconds max wait time
+    DWORD startTime = GetTickCount();
     while(ERROR_INVALID_HANDLE != RasGetConnectStatus(rasConnection, &status))
     {
-        Sleep(sleepTime);
-        totalSleepTime += sleepTime;
+        DWORD elapsedTime = GetTickCount() - startTime;
         // Don't hang forever
-        if (totalSleepTime >= maxSleepTime)
+        if (elapsedTime >= maxWaitTime)
         {
             my_print(NOT_SENSITIVE, false, _T("RasHangUp/RasGetConnectStatus timed out (%d)"), GetLastError());
 
-            // Don't delete entry when in this state -- Windows gets confused
+            // Don't touch the entry when in this state -- Windows gets confused
             return false;
         }
-    }
 
-    // Delete the entry
-    returnCode = RasDeleteEntry(0, VPN_CONNECTION_NAME);
-    if (ERROR_SUCCESS != returnCode &&
-        ERROR_CANNOT_FIND_PHONEBOOK_ENTRY != returnCode)
-    {
-        my_print(NOT_SENSITIVE, false, _T("RasDeleteEntry failed (%d)"), returnCode);
-        return false;
+        // Sleep until the disconnection is notified. The handle becomes
+        // invalid right after that, so from then on briefly poll for it.
+        if (notifying)
+        {
+            if (WAIT_OBJECT_0 == WaitForSingleObject(disconnectedEvent, maxWaitTime - elapsedTime))
+            {
+                notifying = false;
+            }
+        }
+        else
+        {
+            Sleep(pollTime);
+        }
     }
 
+    // The entry is left for the next connection: phonebook writes are slow,
+    // and serialized system-wide.
     m_rasConnection = 0;
 
     return true;
@@ -276,8 +349,8 @@ void VPNTransport::TransportConnectHelper()
         throw Abort();
     }
 
-    ServerEntry serverEntry;
-    if (!GetConnectionServerEntry(serverEntry))
+    ServerEntries candidates;
+    if (!GetConnectionServerEntries(1 + VPN_HANDSHAKE_PREFETCH_COUNT, candidates))
     {
         my_print(NOT_SENSITIVE, false, _T("No known servers support this transport type."));
 
@@ -287,6 +360,8 @@ void VPNTransport::TransportConnectHelper()
         throw Abort();
     }
 
+    const ServerEntry& serverEntry = candidates.front();
+
     SessionInfo sessionInfo;
     sessionInfo.Set(serverEntry);
 
@@ -295,11 +370,40 @@ void VPNTransport::TransportConnectHelper()
     json["ipAddress"] = sessionInfo.GetServerAddress();
     AddDiagnosticInfoJson("ConnectingServer", json);
 
-    // Do pre-handshake
+    // Do pre-handshake, unless it was done while dialling an earlier server,
+    // or there's a recent one for this server to reconnect with
 
-    if (!DoHandshake(
-            true,  // pre-handshake
-            sessionInfo))
+    bool handshakeSucceeded = false;
+    bool usedCachedHandshake = false;
+    unique_ptr<HandshakePrefetch> prefetch = TakeHandshakePrefetch(serverEntry);
+    if (prefetch)
+    {
+        HANDLE waitHandles[] = { prefetch->thread, m_stopInfo.stopSignal->GetStopEvent(m_stopInfo.stopReasons) };
+        if (WAIT_OBJECT_0 != WaitForMultipleObjects(sizeof(waitHandles)/sizeof(HANDLE), waitHandles, FALSE, INFINITE)
+            || m_stopInfo.stopSignal->CheckSignal(m_stopInfo.stopReasons, false))
+        {
+            // A stopped prefetch isn't a failed server
+            throw Abort();
+        }
+
+        my_print(NOT_SENSITIVE, true, _T("%s: using prefetched handshake"), __TFUNCTION__);
+        sessionInfo = prefetch->sessionInfo;
+        handshakeSucceeded = prefetch->succeeded;
+    }
+    else if (GetCachedHandshake(serverEntry, sessionInfo))
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: using cached handshake"), __TFUNCTION__);
+        handshakeSucceeded = true;
+        usedCachedHandshake = true;
+    }
+    else
+    {
+        handshakeSucceeded = DoHandshake(
+                                true,  // pre-handshake
+                                sessionInfo);
+    }
+
+    if (!handshakeSucceeded)
     {
         MarkServerFailed(sessionInfo.GetServerEntry());
         throw TransportFailed();
@@ -313,6 +417,9 @@ void VPNTransport::TransportConnectHelper()
     // always need all tweaks to connect.
     TweakVPN();
 
+    // So that if this server fails, the next is ready to dial right away
+    PrefetchHandshakes(candidates);
+
     //
     // Start VPN connection
     //
@@ -321,7 +428,7 @@ void VPNTransport::TransportConnectHelper()
             UTF8ToWString(sessionInfo.GetServerAddress()), 
             UTF8ToWString(sessionInfo.GetPSK())))
     {
-        MarkServerFailed(sessionInfo.GetServerEntry());
+        MarkConnectionFailed(sessionInfo, usedCachedHandshake);
         throw TransportFailed();
     }
 
@@ -335,7 +442,7 @@ void VPNTransport::TransportConnectHelper()
             CONNECTION_STATE_STARTING, 
             VPN_CONNECTION_TIMEOUT_SECONDS*1000))
     {
-        MarkServerFailed(sessionInfo.GetServerEntry());
+        MarkConnectionFailed(sessionInfo, usedCachedHandshake);
         throw TransportFailed();
     }
     
@@ -343,7 +450,7 @@ void VPNTransport::TransportConnectHelper()
     {
         // Note: WaitForConnectionStateToChangeFrom throws Abort if user
         // cancelled, so if we're here it's a FAILED case.
-        MarkServerFailed(sessionInfo.GetServerEntry());
+        MarkConnectionFailed(sessionInfo, usedCachedHandshake);
         throw TransportFailed();
     }
 
@@ -351,6 +458,11 @@ void VPNTransport::TransportConnectHelper()
     MarkServerSucceeded(sessionInfo.GetServerEntry());
     m_sessionInfo = sessionInfo;
 
+    // The cached handshake got us connected; a fresh one keeps the cache
+    // (and so the next reconnect) up to date. It's made by DoPeriodicCheck,
+    // once we count as connected, so that it goes through the VPN.
+    m_refreshHandshake = usedCachedHandshake;
+
     //
     // Patch DNS bug on Windowx XP; and flush DNS
     // to ensure domains are resolved with VPN's DNS server
@@ -362,25 +474,164 @@ void VPNTransport::TransportConnectHelper()
 }
 
 
-bool VPNTransport::GetConnectionServerEntry(ServerEntry& o_serverEntry)
+bool VPNTransport::GetConnectionServerEntries(size_t maxCount, ServerEntries& o_serverEntries)
 {
-    // Return the first ServerEntry that can be used. This will encourage
+    // The first ServerEntry that can be used comes first. This will encourage
     // server affinity (i.e., using the last successful server).
 
-    ServerEntries serverEntries = m_serverList.GetList();
+    o_serverEntries.clear();
+
+    ServerListSnapshotPtr snapshot = m_serverList.GetSnapshot();
+    ServerStatsMap serverStats = m_serverList.GetServerStats();
+    unsigned int requiredCapabilities = RequiredServerCapabilities();
 
-    for (ServerEntryIterator it = serverEntries.begin();
-         it != serverEntries.end();
+    // Quarantined servers are only tried if there are no others.
+    ServerEntries quarantined;
+
+    for (ServerEntryIterator it = snapshot->entries.begin();
+         it != snapshot->entries.end() && o_serverEntries.size() < maxCount;
          ++it)
     {
-        if (ServerHasCapabilities(*it))
+        if (it->HasCapabilities(requiredCapabilities) && ServerHasCapabilities(*it))
         {
-            o_serverEntry = *it;
-            return true;
+            auto stats = serverStats.find(it->serverAddress);
+            if (stats != serverStats.end() && stats->second.IsQuarantined())
+            {
+                if (quarantined.size() < maxCount)
+                {
+                    quarantined.push_back(*it);
+                }
+                continue;
+            }
+
+            o_serverEntries.push_back(*it);
         }
     }
 
-    return false;
+    if (o_serverEntries.empty())
+    {
+        o_serverEntries.swap(quarantined);
+    }
+
+    return !o_serverEntries.empty();
+}
+
+
+VPNTransport::HandshakePrefetch::~HandshakePrefetch()
+{
+    if (thread)
+    {
+        // The handshake watches the same stop signal as the connect, so
+        // this only takes long if nothing is stopping.
+        WaitForSingleObject(thread, INFINITE);
+        CloseHandle(thread);
+    }
+}
+
+
+void VPNTransport::PrefetchHandshakes(const ServerEntries& candidates)
+{
+    vector<unique_ptr<HandshakePrefetch>> prefetches;
+
+    for (size_t i = 1; i < candidates.size(); i++)
+    {
+        const ServerEntry& candidate = candidates[i];
+
+        unique_ptr<HandshakePrefetch> prefetch = TakeHandshakePrefetch(candidate);
+        if (!prefetch)
+        {
+            SessionInfo sessionInfo;
+            sessionInfo.Set(candidate);
+            prefetch = StartHandshakePrefetch(sessionInfo);
+        }
+
+        if (prefetch)
+        {
+            prefetches.push_back(std::move(prefetch));
+        }
+    }
+
+    // Any left over are for servers that have dropped out of the running.
+    // Still-running ones are waited for here, but the new ones are already
+    // under way.
+    m_handshakePrefetches.swap(prefetches);
+}
+
+
+unique_ptr<VPNTransport::HandshakePrefetch> VPNTransport::StartHandshakePrefetch(const SessionInfo& sessionInfo)
+{
+    unique_ptr<HandshakePrefetch> prefetch(new HandshakePrefetch());
+    prefetch->transport = this;
+    prefetch->stopInfo = m_stopInfo;
+    prefetch->sessionInfo = sessionInfo;
+    prefetch->startTime = GetTickCount();
+    prefetch->thread = ThreadPool::Instance().Run(HandshakePrefetchThread, prefetch.get(), m_stopInfo);
+    if (!prefetch->thread)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: ThreadPool::Run failed"), __TFUNCTION__);
+        return NULL;
+    }
+
+    return prefetch;
+}
+
+
+unique_ptr<VPNTransport::HandshakePrefetch> VPNTransport::TakeHandshakePrefetch(const ServerEntry& serverEntry)
+{
+    unique_ptr<HandshakePrefetch> prefetch;
+
+    for (auto it = m_handshakePrefetches.begin(); it != m_handshakePrefetches.end(); ++it)
+    {
+        if ((*it)->sessionInfo.GetServerAddress() == serverEntry.serverAddress)
+        {
+            prefetch = std::move(*it);
+            m_handshakePrefetches.erase(it);
+            break;
+        }
+    }
+
+    if (prefetch && GetTickCount() - prefetch->startTime >= VPN_HANDSHAKE_PREFETCH_MAX_AGE_MS)
+    {
+        prefetch.reset();
+    }
+
+    return prefetch;
+}
+
+
+// static
+DWORD WINAPI VPNTransport::HandshakePrefetchThread(void* object)
+{
+    HandshakePrefetch* prefetch = (HandshakePrefetch*)object;
+
+    try
+    {
+        prefetch->succeeded = prefetch->transport->DoHandshake(
+                                true,  // pre-handshake
+                                prefetch->sessionInfo,
+                                prefetch->stopInfo);
+    }
+    catch (...)
+    {
+        // Stopped, or the server failed; either way it's not usable
+        prefetch->succeeded = false;
+    }
+
+    return 0;
+}
+
+
+void VPNTransport::MarkConnectionFailed(const SessionInfo& sessionInfo, bool usedCachedHandshake)
+{
+    if (usedCachedHandshake)
+    {
+        // The server stays where it is, to be retried with a fresh handshake.
+        my_print(NOT_SENSITIVE, true, _T("%s: discarding cached handshake"), __TFUNCTION__);
+        ForgetCachedHandshake(sessionInfo.GetServerEntry());
+        return;
+    }
+
+    MarkServerFailed(sessionInfo.GetServerEntry());
 }
 
 
@@ -389,14 +640,15 @@ size_t VPNTransport::GetConnectionServerEntryCount()
     // Return the first ServerEntry that can be used. This will encourage
     // server affinity (i.e., using the last successful server).
 
-    ServerEntries serverEntries = m_serverList.GetList();
+    ServerListSnapshotPtr snapshot = m_serverList.GetSnapshot();
+    unsigned int requiredCapabilities = RequiredServerCapabilities();
     size_t count = 0;
 
-    for (ServerEntryIterator it = serverEntries.begin();
-         it != serverEntries.end();
+    for (ServerEntryIterator it = snapshot->entries.begin();
+         it != snapshot->entries.end();
          ++it)
     {
-        if (ServerHasCapabilities(*it))
+        if (it->HasCapabilities(requiredCapabilities) && ServerHasCapabilities(*it))
         {
             count++;
         }
@@ -418,6 +670,74 @@ bool VPNTransport::Establish(const tstring& serverAddress, const tstring& PSK)
         return false;
     }
 
+    if (!EnsurePhonebookEntry(serverAddress))
+    {
+        return false;
+    }
+
+    // Set the Preshared Secret
+    RASCREDENTIALS vpnCredentials;
+    memset(&vpnCredentials, 0, sizeof(vpnCredentials));
+    vpnCredentials.dwSize = sizeof(vpnCredentials);
+    vpnCredentials.dwMask = RASCM_PreSharedKey;
+    if (wcscpy_s(vpnCredentials.szPassword, PSK.c_str())) 
+    {
+        throw std::exception("failed to copy PSK");
+    }
+    returnCode = RasSetCredentials(0, VPN_CONNECTION_NAME, &vpnCredentials, FALSE);
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, false, _T("RasSetCredentials failed (%d)"), returnCode);
+        SetLastErrorCode(returnCode);
+        return false;
+    }
+
+    // Make the vpn connection
+    RASDIALPARAMS vpnParams;
+    memset(&vpnParams, 0, sizeof(vpnParams));
+    vpnParams.dwSize = sizeof(vpnParams);
+    if (wcscpy_s(vpnParams.szEntryName, VPN_CONNECTION_NAME) ||
+        // Overrides the entry's, so the entry needn't be rewritten for each server
+        wcscpy_s(vpnParams.szPhoneNumber, serverAddress.c_str()) ||
+        wcscpy_s(vpnParams.szUserName, _T("user")) || // The server does not care about username
+        wcscpy_s(vpnParams.szPassword, _T("password"))) // This can also be hardcoded because the server authentication (which we really care about) is in IPSec using PSK
+    {
+        throw std::exception("failed to copy VPN params");
+    }
+
+    // Pass pointer to this object to callback for state change updates
+    vpnParams.dwCallbackId = (ULONG_PTR)this;
+
+    {
+        // The new connection's counters start from zero
+        AutoLock lock(m_interfaceStatsLock);
+        m_rasConnection = 0;
+        m_lastRasBytesSent = 0;
+        m_lastRasBytesReceived = 0;
+        m_interfaceBytes = 0;
+    }
+    SetConnectionState(CONNECTION_STATE_STARTING);
+    returnCode = RasDial(0, 0, &vpnParams, 2, &(VPNTransport::RasDialCallback), &m_rasConnection);
+    if (ERROR_SUCCESS != returnCode)
+    {
+        my_print(NOT_SENSITIVE, false, _T("RasDial failed (%d)"), returnCode);
+        SetConnectionState(CONNECTION_STATE_FAILED);
+        SetLastErrorCode(returnCode);
+
+        // In case the entry was changed by someone else, it's rewritten next time.
+        (void)WriteRegistryDwordValue(LOCAL_SETTINGS_REGISTRY_VALUE_VPN_ENTRY_VERSION, 0);
+        return false;
+    }
+
+    return true;
+}
+
+// Creates the phonebook entry, or brings it up to date, unless it's already
+// the one we made. Must only be called when there's no connection using it.
+bool VPNTransport::EnsurePhonebookEntry(const tstring& serverAddress)
+{
+    DWORD returnCode = ERROR_SUCCESS;
+
     // The RasValidateEntryName function validates the format of a connection
     // entry name. The name must contain at least one non-white-space alphanumeric character.
     returnCode = RasValidateEntryName(0, VPN_CONNECTION_NAME);
@@ -429,6 +749,14 @@ bool VPNTransport::Establish(const tstring& serverAddress, const tstring& PSK)
         return false;
     }
 
+    DWORD entryVersion = 0;
+    if (ERROR_ALREADY_EXISTS == returnCode
+        && ReadRegistryDwordValue(LOCAL_SETTINGS_REGISTRY_VALUE_VPN_ENTRY_VERSION, entryVersion)
+        && entryVersion == VPN_PHONEBOOK_ENTRY_VERSION)
+    {
+        return true;
+    }
+
     // Set up the VPN connection properties
     RASENTRY rasEntry;
     memset(&rasEntry, 0, sizeof(rasEntry));
@@ -459,6 +787,7 @@ bool VPNTransport::Establish(const tstring& serverAddress, const tstring& PSK)
     // If the entry name does not match an existing entry, RasSetEntryProperties
     // creates a new phone-book entry.
     returnCode = RasSetEntryProperties(0, VPN_CONNECTION_NAME, &rasEntry, sizeof(rasEntry), 0, 0);
+    RasInventory::InvalidateEntries();
     if (ERROR_SUCCESS != returnCode)
     {
         my_print(NOT_SENSITIVE, false, _T("RasSetEntryProperties failed (%d)"), returnCode);
@@ -466,48 +795,7 @@ bool VPNTransport::Establish(const tstring& serverAddress, const tstring& PSK)
         return false;
     }
 
-    // Set the Preshared Secret
-    RASCREDENTIALS vpnCredentials;
-    memset(&vpnCredentials, 0, sizeof(vpnCredentials));
-    vpnCredentials.dwSize = sizeof(vpnCredentials);
-    vpnCredentials.dwMask = RASCM_PreSharedKey;
-    if (wcscpy_s(vpnCredentials.szPassword, PSK.c_str())) 
-    {
-        throw std::exception("failed to copy PSK");
-    }
-    returnCode = RasSetCredentials(0, VPN_CONNECTION_NAME, &vpnCredentials, FALSE);
-    if (ERROR_SUCCESS != returnCode)
-    {
-        my_print(NOT_SENSITIVE, false, _T("RasSetCredentials failed (%d)"), returnCode);
-        SetLastErrorCode(returnCode);
-        return false;
-    }
-
-    // Make the vpn connection
-    RASDIALPARAMS vpnParams;
-    memset(&vpnParams, 0, sizeof(vpnParams));
-    vpnParams.dwSize = sizeof(vpnParams);
-    if (wcscpy_s(vpnParams.szEntryName, VPN_CONNECTION_NAME) ||
-        wcscpy_s(vpnParams.szUserName, _T("user")) || // The server does not care about username
-        wcscpy_s(vpnParams.szPassword, _T("password"))) // This can also be hardcoded because the server authentication (which we really care about) is in IPSec using PSK
-    {
-        throw std::exception("failed to copy VPN params");
-    }
-
-    // Pass pointer to this object to callback for state change updates
-    vpnParams.dwCallbackId = (ULONG_PTR)this;
-
-    m_rasConnection = 0;
-    SetConnectionState(CONNECTION_STATE_STARTING);
-    returnCode = RasDial(0, 0, &vpnParams, 2, &(VPNTransport::RasDialCallback), &m_rasConnection);
-    if (ERROR_SUCCESS != returnCode)
-    {
-        my_print(NOT_SENSITIVE, false, _T("RasDial failed (%d)"), returnCode);
-        SetConnectionState(CONNECTION_STATE_FAILED);
-        SetLastErrorCode(returnCode);
-        return false;
-    }
-
+    (void)WriteRegistryDwordValue(LOCAL_SETTINGS_REGISTRY_VALUE_VPN_ENTRY_VERSION, VPN_PHONEBOOK_ENTRY_VERSION);
     return true;
 }
 
@@ -539,39 +827,53 @@ unsigned int VPNTransport::GetLastErrorCode(void) const
 
 bool VPNTransport::DoPeriodicCheck()
 {
-    return GetConnectionState() == CONNECTION_STATE_CONNECTED;
+    if (GetConnectionState() != CONNECTION_STATE_CONNECTED)
+    {
+        return false;
+    }
+
+    if (m_refreshHandshake)
+    {
+        m_refreshHandshake = false;
+        m_handshakeRefresh = StartHandshakePrefetch(m_sessionInfo);
+    }
+
+    return true;
 }
 
 bool VPNTransport::WaitForConnectionStateToChangeFrom(ConnectionState state, DWORD timeout)
 {
-    DWORD totalWaitMilliseconds = 0;
+    DWORD startTime = GetTickCount();
+    HANDLE waitHandles[] = { GetStateChangeEvent(), m_stopInfo.stopSignal->GetStopEvent(m_stopInfo.stopReasons) };
 
     while (state == GetConnectionState())
     {
-        // Wait for RasDialCallback to set a new state, or timeout (to check cancel/termination)
-
-        DWORD waitMilliseconds = 100;
-
-        DWORD result = WaitForSingleObject(GetStateChangeEvent(), waitMilliseconds);
-
-        totalWaitMilliseconds += waitMilliseconds;
+        if (m_stopInfo.stopSignal->CheckSignal(m_stopInfo.stopReasons, false))
+        {
+            // TODO: Maybe this should let CheckSignalStop throw
+            throw Abort();
+        }
 
-        if (result == WAIT_TIMEOUT)
+        DWORD elapsedTime = GetTickCount() - startTime;
+        if (elapsedTime >= timeout)
         {
-            if (totalWaitMilliseconds >= timeout)
-                return false;
+            return false;
         }
-        else if (result == WAIT_OBJECT_0)
+
+        // Wait for RasDialCallback (or the disconnection watch) to set a new
+        // state, or for a stop
+        DWORD result = WaitForMultipleObjects(
+                        sizeof(waitHandles)/sizeof(HANDLE),
+                        waitHandles,
+                        FALSE, // wait for any
+                        timeout - elapsedTime);
+
+        if (result == WAIT_TIMEOUT || result == WAIT_OBJECT_0 || result == WAIT_OBJECT_0 + 1)
         {
             // State event set, but that doesn't mean that the state actually changed.
-            // Let the loop condition check.
+            // Let the loop checks decide.
             continue;
         }
-        else if (m_stopInfo.stopSignal->CheckSignal(m_stopInfo.stopReasons, false)) // stop event signalled
-        {
-            // TODO: Maybe this should let CheckSignalStop throw
-            throw Abort();
-        }
         else
         {
             std::stringstream s;
@@ -614,78 +916,67 @@ HRASCONN VPNTransport::GetActiveRasConnection()
 
     // In case the application starts while the VPN connection is already active, 
     // we need to find the rasConnection by name.
+    return RasInventory::GetActiveConnection(VPN_CONNECTION_NAME);
+}
 
-    HRASCONN rasConnection = 0;
-    RASCONN conn;
-    memset(&conn, 0, sizeof(conn));
-    conn.dwSize = sizeof(conn);
-    LPRASCONN rasConnections = &conn;
-    DWORD bufferSize = sizeof(conn);
-    DWORD connections = 0;
-
-    DWORD returnCode = RasEnumConnections(rasConnections, &bufferSize, &connections);
+bool VPNTransport::WatchForDisconnection(HRASCONN rasConnection)
+{
+    // From an earlier dial
+    StopWatchingForDisconnection();
 
-    // On Windows XP, we can't call RasEnumConnections with rasConnections = 0 because it
-    // fails with 632 ERROR_INVALID_SIZE.  So we set rasConnections to point to a single
-    // RASCONN, and we'll always reallocate, even if there is only one RASCONN and the
-    // first call succeeds.
-    if (ERROR_SUCCESS == returnCode)
+    m_disconnectedEvent = CreateEvent(0, FALSE, FALSE, 0);
+    if (!m_disconnectedEvent)
     {
-        returnCode = ERROR_BUFFER_TOO_SMALL;
+        my_print(NOT_SENSITIVE, false, _T("CreateEvent failed (%d)"), GetLastError());
+        return false;
     }
 
-    // NOTE: Race condition where a new connection is added between the buffersize check
-    //       and the second call.
-    if (ERROR_BUFFER_TOO_SMALL != returnCode && connections > 0)
+    DWORD returnCode = RasConnectionNotification(rasConnection, m_disconnectedEvent, RASCN_Disconnection);
+    if (ERROR_SUCCESS != returnCode)
     {
-        my_print(NOT_SENSITIVE, false, _T("RasEnumConnections failed (%d)"), returnCode);
+        my_print(NOT_SENSITIVE, false, _T("RasConnectionNotification failed (%d)"), returnCode);
+        StopWatchingForDisconnection();
+        return false;
     }
-    else if (ERROR_BUFFER_TOO_SMALL == returnCode && connections > 0)
+
+    if (!RegisterWaitForSingleObject(
+            &m_disconnectedWait,
+            m_disconnectedEvent,
+            DisconnectedCallback,
+            this,
+            INFINITE,
+            WT_EXECUTEONLYONCE))
     {
-        // See "A fix to work with older versions of Windows"
-        if (bufferSize < (connections * sizeof(RASCONN)))
-        {
-            bufferSize = connections * sizeof(RASCONN);
-        }
+        my_print(NOT_SENSITIVE, false, _T("RegisterWaitForSingleObject failed (%d)"), GetLastError());
+        m_disconnectedWait = NULL;
+        StopWatchingForDisconnection();
+        return false;
+    }
 
-        // Allocate the memory needed for the array of RAS structure(s).
-        rasConnections = (LPRASCONN)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, bufferSize);
-        if (!rasConnections)
-        {
-            my_print(NOT_SENSITIVE, false, _T("HeapAlloc failed"));
-            return rasConnection;
-        }
- 
-        // The first RASCONN structure in the array must contain the RASCONN structure size
-        rasConnections[0].dwSize = sizeof(RASCONN);
-        
-        // Call RasEnumConnections to enumerate active connections
-        returnCode = RasEnumConnections(rasConnections, &bufferSize, &connections);
+    return true;
+}
 
-        // If successful, find the one with VPN_CONNECTION_NAME.
-        if (ERROR_SUCCESS != returnCode)
-        {
-            my_print(NOT_SENSITIVE, false, _T("RasEnumConnections failed (%d)"), returnCode);
-        }
-        else
-        {
-            for (DWORD i = 0; i < connections; i++)
-            {
-                if (!_tcscmp(rasConnections[i].szEntryName, VPN_CONNECTION_NAME))
-                {
-                    // Entry name is unique and we found it
-                    rasConnection = rasConnections[i].hrasconn;
-                    break;
-                }
-            }
-        }
+void VPNTransport::StopWatchingForDisconnection()
+{
+    if (m_disconnectedWait)
+    {
+        // Waits for a running callback to finish
+        (void)UnregisterWaitEx(m_disconnectedWait, INVALID_HANDLE_VALUE);
+        m_disconnectedWait = NULL;
+    }
 
-        //Deallocate memory for the connection buffer
-        HeapFree(GetProcessHeap(), 0, rasConnections);
-        rasConnections = 0;
+    if (m_disconnectedEvent)
+    {
+        CloseHandle(m_disconnectedEvent);
+        m_disconnectedEvent = NULL;
     }
+}
 
-    return rasConnection;
+// static
+VOID CALLBACK VPNTransport::DisconnectedCallback(PVOID param, BOOLEAN /*timerOrWaitFired*/)
+{
+    VPNTransport* vpnTransport = (VPNTransport*)param;
+    vpnTransport->SetConnectionState(CONNECTION_STATE_STOPPED);
 }
 
 void CALLBACK VPNTransport::RasDialCallback(
@@ -716,25 +1007,14 @@ void CALLBACK VPNTransport::RasDialCallback(
     }
     else if (RASCS_Connected == rasConnState)
     {
-        // Set up a disconnection notification event
-        AutoHANDLE rasEvent = CreateEvent(0, FALSE, FALSE, 0);
-        DWORD returnCode = RasConnectionNotification(rasConnection, rasEvent, RASCN_Disconnection);
-        if (ERROR_SUCCESS != returnCode)
+        // The disconnection is watched for on a wait thread, rather than by
+        // blocking RAS's callback thread until it happens.
+        if (!vpnTransport->WatchForDisconnection(rasConnection))
         {
-            my_print(NOT_SENSITIVE, false, _T("RasConnectionNotification failed (%d)"), returnCode);
             return;
         }
 
         vpnTransport->SetConnectionState(CONNECTION_STATE_CONNECTED);
-
-        if (WAIT_FAILED == WaitForSingleObject(rasEvent, INFINITE))
-        {
-            my_print(NOT_SENSITIVE, false, _T("WaitForSingleObject failed (%d)"), GetLastError());
-            // Fall through to VPN_CONNECTION_STATE_STOPPED.
-            // Otherwise we'd be stuck in a connected state.
-        }
-
-        vpnTransport->SetConnectionState(CONNECTION_STATE_STOPPED);
     }
     else
     {
@@ -1255,24 +1535,16 @@ static bool FlushDNS()
     // Adapted code from: http://www.codeproject.com/KB/cpp/Setting_DNS.aspx
 
     bool result = false;
-    HINSTANCE hDnsDll = NULL;
-    DNSFLUSHPROC pDnsFlushProc;
 
-    static const int maxPathBufferSize = MAX_PATH + 1;
-    TCHAR SystemDirectoryPathBuffer[maxPathBufferSize];
-    if (GetSystemDirectory(SystemDirectoryPathBuffer, maxPathBufferSize))
-    {
-        tstring libraryPath = tstring(SystemDirectoryPathBuffer) + TEXT("\\DNSAPI.DLL");
-        hDnsDll = LoadLibrary(libraryPath.c_str());
-    }
-
-    if (hDnsDll == NULL)
+    if (!GetSystemLibrary(_T("DNSAPI.DLL")))
     {
         my_print(NOT_SENSITIVE, false, _T("LoadLibrary DNSAPI failed"));
         return result;
     }
 
-    if ((pDnsFlushProc = (DNSFLUSHPROC)GetProcAddress(hDnsDll, "DnsFlushResolverCache")) != NULL)
+    static DNSFLUSHPROC pDnsFlushProc = (DNSFLUSHPROC)GetSystemLibraryProc(_T("DNSAPI.DLL"), "DnsFlushResolverCache");
+
+    if (pDnsFlushProc != NULL)
     {
         if (FALSE == (pDnsFlushProc)())
         {
@@ -1288,7 +1560,6 @@ static bool FlushDNS()
         my_print(NOT_SENSITIVE, false, _T("GetProcAddress DnsFlushResolverCache failed"));
     }
 
-    FreeLibrary(hDnsDll);
     return result;
 }
 
@@ -28,6 +28,8 @@ class SessionInfo;
 
 #define VPN_TRANSPORT_PROTOCOL_NAME     _T("VPN")
 #define VPN_TRANSPORT_DISPLAY_NAME      _T("VPN")
+// The phonebook entry, which is kept between connections
+#define VPN_CONNECTION_NAME             _T("Psiphon3")
 
 class VPNTransport: public ITransport
 {
@@ -47,18 +49,22 @@ public:
                     tstring& o_transportDisplayName,
                     tstring& o_transportProtocolName,
                     TransportFactoryFn& o_transportFactory, 
-                    AddServerEntriesFn& o_addServerEntriesFn);
+                    AddServerEntriesFn& o_addServerEntriesFn,
+                    bool& o_handshakeRequired);
 
     virtual tstring GetTransportProtocolName() const;
     virtual tstring GetTransportDisplayName() const;
     virtual tstring GetTransportRequestName() const;
     virtual tstring GetSessionID(const SessionInfo& sessionInfo);
     virtual bool RequiresStatsSupport() const;
+    virtual bool SupportsInterfaceStats() const { return true; }
+    virtual bool GetInterfaceBytesTransferred(unsigned long long& o_bytes);
     virtual tstring GetLastTransportError() const;
     virtual bool IsHandshakeRequired() const;
     virtual bool IsWholeSystemTunneled() const;
     virtual bool SupportsAuthorizations() const override;
     virtual bool ServerHasCapabilities(const ServerEntry& entry) const;
+    virtual unsigned int RequiredServerCapabilities() const;
 
     virtual bool Cleanup();
 
@@ -68,7 +74,8 @@ protected:
     virtual bool DoPeriodicCheck();
     
     void TransportConnectHelper();
-    bool GetConnectionServerEntry(ServerEntry& o_serverEntry);
+    // The first maxCount usable entries, in the order they'd be tried.
+    bool GetConnectionServerEntries(size_t maxCount, ServerEntries& o_serverEntries);
     size_t GetConnectionServerEntryCount();
     ConnectionState GetConnectionState() const;
     void SetConnectionState(ConnectionState newState);
@@ -79,6 +86,12 @@ protected:
     tstring GetPPPIPAddress() const;
     HRASCONN GetActiveRasConnection();
     bool Establish(const tstring& serverAddress, const tstring& PSK);
+    bool EnsurePhonebookEntry(const tstring& serverAddress);
+    // Sets the state to STOPPED when rasConnection disconnects.
+    bool WatchForDisconnection(HRASCONN rasConnection);
+    // Must not be called from DisconnectedCallback
+    void StopWatchingForDisconnection();
+    static VOID CALLBACK DisconnectedCallback(PVOID param, BOOLEAN timerOrWaitFired);
     static void CALLBACK RasDialCallback(
                             DWORD userData,
                             DWORD,
@@ -88,11 +101,58 @@ protected:
                             DWORD dwError,
                             DWORD);
 
+    // A pre-handshake -- which is what gets the PSK -- made in the
+    // background: ahead of time for a server that's next in line, while the
+    // current one is dialled, or to refresh a cached one that was used.
+    struct HandshakePrefetch
+    {
+        VPNTransport* transport;
+        StopInfo stopInfo;
+        SessionInfo sessionInfo;
+        bool succeeded;  // Only valid once thread is set
+        HANDLE thread;
+        DWORD startTime;
+
+        HandshakePrefetch() : transport(NULL), succeeded(false), thread(NULL), startTime(0) {}
+        // Waits for the handshake to finish
+        ~HandshakePrefetch();
+
+    private:
+        // not copyable
+        HandshakePrefetch(const HandshakePrefetch&);
+        HandshakePrefetch& operator=(const HandshakePrefetch&);
+    };
+
+    // Starts prefetches for the candidates after the first that don't have
+    // one yet, and drops those for servers that are no longer candidates.
+    void PrefetchHandshakes(const ServerEntries& candidates);
+    // Returns NULL on failure.
+    unique_ptr<HandshakePrefetch> StartHandshakePrefetch(const SessionInfo& sessionInfo);
+    // Returns NULL if there's no (fresh) prefetch for serverEntry.
+    unique_ptr<HandshakePrefetch> TakeHandshakePrefetch(const ServerEntry& serverEntry);
+    static DWORD WINAPI HandshakePrefetchThread(void* object);
+
+    // A server failed to connect with sessionInfo. If that was a cached
+    // handshake, it's the cache that's suspect, not the server.
+    void MarkConnectionFailed(const SessionInfo& sessionInfo, bool usedCachedHandshake);
+
 private:
     ConnectionState m_state;
     HANDLE m_stateChangeEvent;
+    HANDLE m_disconnectedEvent;
+    HANDLE m_disconnectedWait;
     HRASCONN m_rasConnection;
     unsigned int m_lastErrorCode;
     tstring m_pppIPAddress;
+    // GetInterfaceBytesTransferred state. The RAS counters are 32 bits, so
+    // they're accumulated here across wraps.
+    Lock m_interfaceStatsLock;
+    DWORD m_lastRasBytesSent;
+    DWORD m_lastRasBytesReceived;
+    unsigned long long m_interfaceBytes;
     ServerListReorder m_serverListReorder;
+    // Only used by the worker thread, which also does the connecting
+    vector<unique_ptr<HandshakePrefetch>> m_handshakePrefetches;
+    bool m_refreshHandshake;
+    unique_ptr<HandshakePrefetch> m_handshakeRefresh;
 };
@@ -28,6 +28,9 @@
 
 extern HWND g_hWnd;
 
+// How long a newly launched browser gets to be ready for more URLs
+#define BROWSER_INPUT_IDLE_TIMEOUT_MS   5000
+
 // Creates a process with the given command line and returns a HANDLE to the 
 // resulting process. Returns 0 on error; call GetLastError to find out why.
 HANDLE LaunchApplication(LPCTSTR command)
@@ -63,13 +66,31 @@ HANDLE LaunchApplication(LPCTSTR command)
 }
 
 // Wait for the browser to become available for more page launching.
-// This is pretty much voodoo.
 // hProcess should be a handle to the browser process, but can be 0.
 void WaitForProcessToQuiesce(HANDLE hProcess)
 {
-    if (hProcess) ::WaitForInputIdle(hProcess, 10000);
-    Sleep(2000);
-    if (hProcess) ::WaitForInputIdle(hProcess, 10000);
+    if (!hProcess)
+    {
+        return;
+    }
+
+    // Fails right away if the process has no message queue -- e.g., it's
+    // just handed the URL to an already-running instance and exited -- in
+    // which case there's nothing to wait for.
+    DWORD result = ::WaitForInputIdle(hProcess, BROWSER_INPUT_IDLE_TIMEOUT_MS);
+    if (result == WAIT_TIMEOUT)
+    {
+        my_print(NOT_SENSITIVE, true, _T("%s: timed out"), __TFUNCTION__);
+    }
+}
+
+// Chromium-based browsers register a command line ending in `-- "%1"`:
+// everything after the `--` is a URL, so any number can be given at once.
+// Others (e.g., Firefox's `-osint -url "%1"`) take just the one.
+bool BrowserCommandLineTakesMultipleURLs(const tstring& commandLine)
+{
+    return commandLine.find(_T(" -- \"%1\"")) != tstring::npos
+           || commandLine.find(_T(" -- %1")) != tstring::npos;
 }
 
 // Get the command line for the default browser (should include URL placeholder,
@@ -141,9 +162,29 @@ void OpenBrowser(const vector<tstring>& urls)
             break;
         }
 
-        browserCommandLine.replace(placeholder_pos, placeholder.length(), *currentURL);
+        // If the browser takes them, pass all the URLs at once, so there's no
+        // waiting on it between them. Each takes the place of the placeholder,
+        // quoted the same way.
+        tstring placeholderURLs = *currentURL;
+        vector<tstring>::const_iterator nextURL = currentURL + 1;
+        if (nextURL != urls.end() && BrowserCommandLineTakesMultipleURLs(browserCommandLine))
+        {
+            bool quoted = placeholder_pos > 0 && browserCommandLine[placeholder_pos - 1] == _T('"');
+            for (; nextURL != urls.end(); ++nextURL)
+            {
+                if (nextURL->find_first_of(_T("\" ")) != tstring::npos)
+                {
+                    // Can't be passed safely; it's opened separately below.
+                    break;
+                }
+                placeholderURLs += quoted ? _T("\" \"") : _T(" ");
+                placeholderURLs += *nextURL;
+            }
+        }
+
+        browserCommandLine.replace(placeholder_pos, placeholder.length(), placeholderURLs);
 
-        // Launch the application with the first URL.
+        // Launch the application with the first URL(s).
 
         hProcess = LaunchApplication(browserCommandLine.c_str());
         if (hProcess == 0)
@@ -154,7 +195,7 @@ void OpenBrowser(const vector<tstring>& urls)
         }
 
         // Success. Advance the URL iterator.
-        currentURL++;
+        currentURL = nextURL;
     } while (false);
 
     // Either the browser is open now or we failed to open it and we're going to try other methods
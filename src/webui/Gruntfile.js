@@ -97,7 +97,14 @@ module.exports = function(grunt) {
     locales: {
       dist: {
         src: '_locales/',
-        dest: 'js/locales.js'
+        dest: 'js/locales.js',
+        // Translations other than the fallback (English) go in a file per
+        // locale, loaded when the locale is first used. See switchLocale.
+        localeDestPrefix: 'dist/locale-',
+        fallbackLocale: 'en',
+        // Just the strings the app backend uses, for it to embed, so that it
+        // has them before the UI has loaded.
+        appBackendDest: 'appbackend-strings.json'
       }
     },
 
@@ -198,9 +205,36 @@ module.exports = function(grunt) {
         };
       });
 
+      // Only the locale names (for the language menu) and the fallback's
+      // translation are in the page itself.
+      var pageLocales = {};
+      for (var localeCode in locales) {
+        pageLocales[localeCode] = { name: locales[localeCode].name };
+        if (localeCode === this.data.fallbackLocale) {
+          pageLocales[localeCode].translation = locales[localeCode].translation;
+        }
+        else {
+          grunt.file.write(
+            this.data.localeDestPrefix + localeCode + '.js',
+            'window.PSIPHON.LOCALES[' + JSON.stringify(localeCode) + '].translation = ' + JSON.stringify(locales[localeCode].translation, null, '  ') + ';');
+        }
+      }
+
       grunt.file.write(
         this.data.dest,
-        '(window.PSIPHON || (window.PSIPHON={})).LOCALES = ' + JSON.stringify(locales, null, '  ') + ';');
+        '(window.PSIPHON || (window.PSIPHON={})).LOCALES = ' + JSON.stringify(pageLocales, null, '  ') + ';');
+
+      var appBackendStrings = {};
+      for (var locale in locales) {
+        appBackendStrings[locale] = {};
+        for (var key in locales[locale].translation) {
+          if (key.indexOf('appbackend#') === 0) {
+            appBackendStrings[locale][key] = locales[locale].translation[key];
+          }
+        }
+      }
+      grunt.file.write(this.data.appBackendDest, JSON.stringify(appBackendStrings, null, '  '));
+
       grunt.log.ok();
     });
 };
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["am"].translation = {
+  "banner#long-connecting": "<strong> ወይኔ!</strong> ለመገናኘት በሚያደርጉት ጥረት እየተቸገሩ ያሉ ይመስላል! <br>\nየመጨረሻውን የPsiphon ሥሪት <a class=\"NewVersionURL\" href=\"#\">ከማውረጃ ገጹ</a> ላይ ያውርዱ \nወይም ወደ <a class=\"NewVersionEmail\" href=\"#\"></a> ኤፖስታ በመላክ ያግኙ። ",
+  "nav#connection#starting": "በመገናኘት ላይ",
+  "nav#connection#connected": "ተገናኝቷል",
+  "nav#connection#stopping": "ግንኙነት በማቋረጥ ላይ",
+  "nav#connection#stopped": "ግንኙነት ተቋርጧል",
+  "nav#settings": "ቅንብሮች",
+  "nav#feedback": "ግብረመልስ",
+  "nav#logs": "መዝገቦች",
+  "nav#about": "ስለ",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">በመገናኘት ላይ</span> ነው...",
+  "connection#stop-btn": "አቁም",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">ተገናኝቷል</span>",
+  "connection#disconnect-btn": "ግንኙነት አቋርጥ",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">ግንኙነት በማቋረጥ ላይ</span> ነው...",
+  "connection#wait-btn": "እብክዎ ይጠብቁ...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">ግንኙነት አቋርጧል </span>።",
+  "connection#connect-btn": "አገናኝ",
+  "connection#egress-region-combo-label": "የአገልጋይ ቀጠና ምረጥ",
+  "settings#error-alert": "<strong>ስህተት!</strong> ከመቀጠልዎ በፊት እባክዎ የተሳሳቱ ዕሴቶችን ያስተካክሉ።",
+  "settings#reset-button": "ወደ ነባሪ መልስ",
+  "settings#apply-button": "ለውጦቹን ተግብር",
+  "settings#unapplied-changes-prompt#title": "ቅንብሮች ተቀይረዋል",
+  "settings#unapplied-changes-prompt#body": "በቅንብርዎት ላይ ለውጦችን አድርገዋል ነገር ግን ለውጦቹ እንዲተገበሩ አላደረጉም። <br><br>ለውጦችዎን አሁን መተግበር ወይስ ማስወገድ ይፈልጋሉ? ",
+  "settings#unapplied-changes-prompt#apply-button": "ተግብር",
+  "settings#unapplied-changes-prompt#discard-button": "አስወግድ",
+  "settings#vpn-incompatible-msg": "(ከL2TP/IPSec ሁነታ ጋር አይሠራም።)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "መተላለፊያ ዋሻን ክፈል",
+  "settings#split-tunnel#help-text": "ይህ ከነቃ በሀገርዎ ወዳሉ አገልጋዮች የሚቀርቡ ጥያቄዎች በPsiphon ማስተላለፊያ ዋሻዎች አማካኝነት አይተላለፉም። ",
+  "settings#split-tunnel#reason": "በሀገርዎ ያሉ ድረጣቢያዎች አብዛኛውን ግዜ የታገዱ አይደሉም። በመሆኑም ይህንን ምርጫ ማንቃት ለነዚህ ድረጣቢያዎች ፈጣን ተደራሽነት ይሰጣል። አንዳንዴም የኢንተርኔት አግልግሎት ሰጪ የውሂብ ጥቅም ክፍያዎትን ሊቀንስ ይችላል።",
+  "settings#split-tunnel#enable-label": "በሀገርዎ ያሉ ድር ጣቢያዎች በወኪል አይተላለፉ",
+  "settings#disable-timeouts#heading": "ለዝግተኛ አውታረመረቦች የጊዜ እረፍቶችን አቦዝን",
+  "settings#disable-timeouts#help-text": "ይህ ከነቃ ከPsiphon አጋልጋዩ ጋር የሚኖረው ግንኙነት የጊዜ እረፍትን አይወስድም።  ",
+  "settings#disable-timeouts#reason": "ይሄንን ለዘግተኛ አውታረመረብ ግንኙነቶች በሚያበሩበት ጊዜ ያልተጠበቁ የግንኙነት መቋረጦች የመፈጠር ዕድል ይቀንሳል።",
+  "settings#disable-timeouts#enable-label": "ለዝግተኛ አውታረመረቦች የጊዜ እረፍቶችን አቦዝን",
+  "settings#egress-region#heading": "የPsiphon አገልጋይ ቀጠና",
+  "settings#egress-region#select-best-performance": "ከሁሉም የላቀ አፈጻጸም",
+  "settings#egress-region#select-us": "ዩናይትድ ስቴትስ",
+  "settings#egress-region#select-ca": "ካናዳ",
+  "settings#egress-region#select-gb": "ዩናይትድ ኪንግደም",
+  "settings#egress-region#select-jp": "ጃፓን",
+  "settings#egress-region#select-sg": "ሲንጋፖር",
+  "settings#egress-region#select-sk": "ስሎቫኪያ",
+  "settings#egress-region#select-nl": "ኔዘርላንድ",
+  "settings#egress-region#select-de": "ጀርመን",
+  "settings#egress-region#select-in": "ሕንድ",
+  "settings#egress-region#select-es": "ስፔይን",
+  "settings#egress-region#select-hk": "ሆንክ ኮንግ",
+  "settings#egress-region#select-at": "ኦስትሪያ",
+  "settings#egress-region#select-be": "ቤልጂየም",
+  "settings#egress-region#select-bg": "ቡልጋሪያ",
+  "settings#egress-region#select-ch": "ስዊዘርላንድ",
+  "settings#egress-region#select-cz": "ቼክ ሪፐብሊክ",
+  "settings#egress-region#select-dk": "ዴንማርክ ",
+  "settings#egress-region#select-fr": "ፈረንሳይ",
+  "settings#egress-region#select-hu": "ሃንጋሪ",
+  "settings#egress-region#select-it": "ጣሊያን",
+  "settings#egress-region#select-no": "ኖርዌይ",
+  "settings#egress-region#select-ro": "ሮማንያ",
+  "settings#egress-region#select-se": "ስዊድን",
+  "settings#egress-region#select-pl": "ፖላንድ",
+  "settings#egress-region#select-rs": "ሰርቢያ",
+  "settings#egress-region#select-au": "አውስትራሊያ",
+  "settings#egress-region#description": "Psiphon በተለያዩ ሃገራት አገልጋዮች አሉት። አሁን ላሉበት ሃገር ቅርብ የሆነ፣ የPsiphon አገልጋይ ያለበትን ሃገር መጠቀም አብዛኛውን ግዜ የተሻለ የአውታረመረብ ግንኙነት እንዲኖር ያደርጋል፤ ነገር ግን በመረጡት ሀገር ላይ እንደሆኑ መስለው ድረጣቢያን እና አገልግሎቶቹን ማግኘት ይችላሉ።",
+  "settings#egress-region#default": "ነባሪ <strong>\"ከሁሉም የላቀ አፈጻጸም\"</strong> ምርጫ Psiphon በራስ ሠር አገልጋይ እንዲመርጥ ያደርገዋል፤ ይህም ብዙ ግዜ ከሁሉም የላቀ አፈጻጸም እንዲኖር ያደርጋል።",
+  "settings#egress-region#invalid-error-msg": "ተቀባይነት ያለው የPsiphon አገልጋይ ቀጠና ይምረጡ።",
+  "settings#egress-region#error-modal-title": "የአገልጋይ ቀጠና አልተገኘም",
+  "settings#egress-region#error-modal-body-http": "Psiphonን በልዩ ቀጠና ያለን አገልጋይ እንዲጠቀም አዋቅረውታል። <br>\nይሁንና ይህ ቀጠና አሁን የለም።  <br>\nአዲስ ቀጠና መምረጥ ወይም ወደ ነባሪው  “ከሁሉም የላቀ ፍጥነት ያለው ሀገር” ምርጫ መቀየር ይኖርብዎታል።",
+  "settings#local-proxy-ports#heading": "የአካባቢው ወኪል ወደቦች",
+  "settings#local-proxy-ports#leave-blank": "ለራስሠር ወደብ ምርጫ <strong>ባዶ</strong> ይተዉት (የሚመከር)።",
+  "settings#local-proxy-ports#reason": "በኮምፒውተርዎ ላይ ከPsiphon ጋር ለመሥራት የማኑዋል ቅንብርን የሚፈልጉ መሣሪያዎች የሚጠቀሙ ከሆነ Psiphon ተመሳሳይ የሆኑ የአካባቢ ወደብ ቁጥሮችን መጠቀም ያስፈልገዋል። የወደብ ቁጥርን መለየት የማያስፈልግ ከሆነ ግጭቶችን ለማስወገድ Psiphon በራሱ እንዲመርጥ መፍቀድ አለብዎት።",
+  "settings#local-proxy-ports#http-label": "ኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል)/ኤችቲቲፔኤስ (ደህንነቱ የተጠበቀ የዳበረ ጽሁፍ ማስተላለፊያ)",
+  "settings#port-value-error-msg": "በ1 እና 65535 መካከል መሆን አለበት።",
+  "settings#local-proxy-ports#socks-label": "SOCKS ",
+  "settings#local-proxy-ports#unique-error-msg": "የአካባቢ ወደቦች እርስ በርቻቸው የተለዩ መሆን አለባቸው።",
+  "settings#local-proxy-ports#error-modal-title": "የአካባቢ ወኪል ወደቦች ግጭት",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphonን ለኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪል የተለየ የአካባቢ ወደብ እንዲጠቀም አዋቅረውታል።<br>\nይሁንና ይህ ወደብ ጥቅም ላይ እይዋለ ይመስል፤ Psiphon ሊጠቀመው አልቻለም።\n</p>\n<p>\nእባክዎትን የተዋቀረውን የኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪል ወደብ ዕሴት ይቀይሩ እና እንደገና ይሞክሩ። Psiphon በራስሠር ወደብ እንዲመርጥ ዕሴቱን እንዲያጸዱ እንመክራለን።\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphonን ለSOCKS ወኪል የተለየ የአካባቢ ወደብን እንዲጠቀም አዋቅረውታል።<br>\nይሁን እና ይህ ወደብ ጥቅም ላይ እየዋለ ይመስላል፤ Psiphon ሊጠቀመው አልቻለም።\n</p>\n<p>\nእባክዎን የተዋቀረውን የSOCKS ወኪል ወደብ ዕሴት ይቀይሩ እና እንደገና ይሞክሩ። Psiphon በራስሠር ወደብ እንዲመርጥ ዕሴቱን እንዲያጸዱ እንመክራለን።\n</p>",
+  "settings#upstream-proxy#heading": "የላይ ወኪል",
+  "settings#upstream-proxy#by-default": "ኮምፒውተርዎ ቀድሞውኑ የተዋቀረ ወኪል ካለው Psiphon በነባሪው ሁነታ ግንኙነቱን ሲፈጽም ያንን ወኪል ይጠቀማል። ይህንን ባህሪ የተለየ ወኪል እንዲጠቀም ወይም እንደዚህ ያለ ”የላይ ወኪል“  እንዳይጠቀም በመወሰን መቀየር ይችላሉ።",
+  "settings#upstream-proxy#reason": "አንዳንዴ የላይ ወኪልዎች በትምህርት ቤቶች፣ በዩኒቨርስቲዎች ወይም በቢዝነሶች አስፈላጊ ይሆናሉ። የአውታረመረብ አቅራቢዎ የላይ ወኪል ቅንብሮችን የሚሰጥዎት ከሆነ ለመገናኘት እዚህ ጋር በራስዎ ማቀናበር ሊያስፈልግዎ ይችላል።",
+  "settings#upstream-proxy#proxy-reqs": "ኤችቲቲፒኤስ ( ጥብቅ የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል)HTTPSን የሚደግፉ የኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪልዎች ብቻ ይፈቀዳሉ። ",
+  "settings#upstream-proxy#hostname-label": "ስመ አስተናጋጅ",
+  "settings#upstream-proxy#port-label": "ወደብ",
+  "settings#upstream-proxy#username-label": "የተጠቃሚ ስም",
+  "settings#upstream-proxy#password-label": "የይለፍ ቃል",
+  "settings#upstream-proxy#domain-label": "ጎራ",
+  "settings#upstream-proxy#skip-label": "የላይ ወኪል አትጠቀም",
+  "settings#upstream-proxy#set-hostname-error-msg": "ስመ አስተናጋጅ ማቅረብ ይኖርብወታል ወይም ደግሞ የላዥረት ወኪል መስክ ባዶ ይተዉ ለራስሠር ምርጫ።",
+  "settings#upstream-proxy#set-username-error-msg": "የተጠቃሚ ስም ማቅረብ ይኖርብወታል የይለፍ ቃል ወይም ጎራ የሚያዋቅሩ ከሆነ፤ ወይም ደግሞ ሁሉንም የማረጋገጫ ዘርፍ ባዶ ይተዉ ማረጋገጫ ላለመጠቀም።",
+  "settings#upstream-proxy#error-modal-title": "የላይ ወኪል ስህተት ",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon በአሁኑ ሰአት የተዋቀረው የሥርአት ወኪልዎን እንደ “የላይ ወኪል” እንዲጠቀም ተደርጎ ነው። <br>\nይሁንና ያንን ወኪል በመጠቀም ከPsiphon አገልጋይ ጋር መገናኘት አልቻልንም።   <br>\nእባክዎን “የላይ ወኪልን አትጠቀም”  የሚለውን ያንቁ እና እንደገና ይሞክሩ።",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphonን “የላይ ወኪል” እንዲጠቀም አድርገው አዋቅረውታል ። <br>\nይሁንና ይህንን ወኪል በመጠቀም ከPsiphon አገልጋይ ጋር መገናኘት አልቻልንም።   <br>\nእባክዎን መዋቅሩን ያስተካክሉ እና እንደገና ይሞክሩ።",
+  "settings#transport-mode#heading": "ትራንስፖርት ሁነታ",
+  "settings#transport-mode#check-label": "የL2TP/IPSec ሁነታን ተጠቀም",
+  "settings#transport-mode#help-text": "የWindows L2TP/IPSec ምናባዊ አውታረመረብን ይጠቀማል። ይህ ሁነታ ለሁሉም መተግበሪያዎች መተላለፊያ ይፈጥራል ነገር ግን ጥብቅ ስላልሆነ ጠንካራ ሳንሱርን የማለፊያ ችሎታዎች የሉትም። አብዛኛዎቹን ኬላዎችን ለማለፊያነት መጠቀም <strong>አይመከርም</strong>።",
+  "settings#systray-minimize#heading": "ወደ ማሳወቂያ ቦታዎች አሳንስ (የሥርአት ትሪ)",
+  "settings#systray-minimize#help-text": "ካነቁት ሲያሳንሱት የPsiphon መተግበሪያ መስኮት ወደ ማሳወቂያ ስፍራው ይደበቃል ( ይህ “የሥርአት ትሪ” ወይም “ሢስትሪ” በመባል የሚታወቅ ሲሆን በዊንዶውስ የተግባር አሞሌ ከሰአቱ አጠገብ ይገኛል)።",
+  "settings#systray-minimize#reason": "Psiphonን ወደ ማሳወቂያ ቦታዎች (የሥርአት ትሪ) ማሳነስ የተግባር  አሞሌዎ ላይ ክፍት ቦታ ይፈጥራል። ይህ በተለይ Psiphonን ለረጅም ሰአት የሚያሠሩ ከሆነ ይጠቅማል። ",
+  "settings#systray-minimize#enable-label": "ወደ ማሳወቂያ ቦታዎች አሳንስ (የሥርአት ትሪ)",
+  "settings#applying-message": "ቅንብርችዎን ለመተግበር እንደገና በመገናኘት ላይ ነው። ",
+  "settings#saved-message": "ቅንብሩ ተቀምጧል።",
+  "settings#error-modal#title": "የቅንብሮች ስህተት",
+  "settings#error-modal#body": "በቅንብርዎት ዕሴትዎች ላይ ስህተቶች አሉ። ከመቀጠልዎ በፊት እባክዎ ያስተካክሏቸው።",
+  "feedback#top_content_title": "ግብረመልስ ይላኩልን",
+  "feedback#top_para_2": "ብዙ ችግሮች የመጨረሻውን ሥሪት በማውረድ ሊፈቱ ይችላሉ። የ<a class=\"NewVersionURL\" href=\"#\">የመጨረሻውን ሥሪት ይህንን ጠቅ በማድረግ ማውረድ ይችላሉ</a> ወይም ወደ <a class=\"NewVersionEmail\" href=\"#\"></a> ኤፖስታ መላክ ይችላሉ።",
+  "feedback#top_para_3": "በተጨማሪም ለብዙ የተለመዱ ችግሮች መፍትሄዎችን<a class=\"FaqURL\" href=\"#\"> በተደጋጋሚ የሚጠየቁ ጥያቄዎች እና መልሶቻቸው</a> ክፍል ሊያገኙ ይችላሉ።",
+  "feedback#smiley_happy": "Psiphon የሚገናኘው እና የሚሠራው እኔ በምፈልገው መንገድ ነው። ",
+  "feedback#smiley_sad": "አብዛኛውን ጊዜ Psiphon ሳይገናኝ ወይም በደንብ ሳይሠራ ይቀራል። ",
+  "feedback#text_feedback_prompt": "እባክዎን አስተያየትዎን እዚህ ጋር ያስገቡ፡-",
+  "feedback#text_feedback_email_prompt": "ምላሽ እንድንሰጥዎት የሚፈልጉ ከሆነ እባክዎን የኤፖስታ አድራሻዎትን አዚህ ጋር ያስገቡ፡-",
+  "feedback#diagnostic_check": "የምርመራ ውሂብ ይስቀሉ። ይህ የምርመራ ውሂብ ማንነትዎን አያጋልጥም፤ Psiphonን ያለምንም ችግር እንድናሠራ የሚረዳ ነው። <a class=\"DataCollectionInfoURL\" href=\"#\">ምን አይነት ውሂብ እንደምንሰበስብ ለማየት ይህንን ጠቅ ያድርጉ </a>።",
+  "feedback#submit_button": "አስገባ",
+  "feedback#text_feedback_bottom_para": "ከላይ ያለው ቅጽ የማይሠራ ከሆነ ወይም ቅጽበታዊ ገጽ እይታን መላክ የሚፈልጉ ከሆነ እባክዎን በ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ኤፖስታ ይላኩልን። ",
+  "feedback#success-message": "<strong>እናመሰግናለን!</strong> ግብረመልስዎ ተልኳል።",
+  "logs#show-debug-label": "የስህተት መዝገቦችን አሳይ",
+  "logs#placeholder": "እስካሁን ምንም መዝገብ የለም",
+  "language#success-message": "<strong>ሰላም!</strong> ወደ Psiphon እንኳን ደህና መጡ።",
+  "about#wordart-tag": "ከድምበር ባሻገር",
+  "about#description": "Psiphon <strong> ሳንሱር የማለፊያ መሣሪያ </strong>ሲሆን ክፍት የኢንተርኔት አገልግሎትን ለማግኘት፣ ሳንሱር እና ኬላን ለማለፍ የተሠራ ነው። <strong>ምንጨ ክፍት </strong> ሲሆን የበለጸገው በቶሮንቶ፣ ካናዳ ነው።",
+  "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">አዲስ ሥሪትን ለማውረድ</a></strong> ወይም <strong><a class=\"InfoURL\" href=\"#\">እርዳታ እና መረጃን ለማግኘት</a></strong> እባክዎን ድረጣቢያውን ይጎብኙ። Psiphon ለAndroid እና ለWindows ይገኛል።",
+  "about#get-by-email": "<strong>ድረጣቢያው የማይገኝ ከሆነ</strong> የPsiphonን አዲስ ሥሪት ወደዚህ አድራሻ ኤፖስታ በመላክ ማግኘት ይችላሉ፡-",
+  "about#client-version": "Psiphon ለWindows ተጠቃሚ ሥሪት፡-",
+  "general#modal-close-button": "ዝጋ",
+  "general#notice-modal-tech-preamble": "የቴክኒክ ስህተቶች መረጃ ይኸው፡- ",
+  "notice#systemproxysettings-setproxy-error-title": "የሥርአት ወኪል ስህተት",
+  "notice#systemproxysettings-setproxy-error-body": "<p>ሳይፈን የሥርአቱን ወኪል ቅንብር ማዋቀር አልቻለም።</p>\n<p> ይህ ከጸረ ቫይረስ ሶፍትዌርዎ ጋር ግጭት ውስጥ ስለገባ ሊሆን ይችላል። የአካባቢው Psiphon ወኪልዎችን ለመጠቀም የመተግበሪያዎን ወይም የሥርአት ወኪል ቅንብሮን በራስዎ ማዋቀር ሊያስፈልግዎ ይችላል።</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” ለተባለ የኢንተርኔት ግንኙነት የሥርአቱን ወኪል ቅንብር ማዋቀር አልቻለም። ይህ ከጸረ ቫይረስ ሶፍትዌርዎ ጋር ግጭት ውስጥ ስለገባ ሊሆን ይችላል። የአካባቢው Psiphon ወኪልዎችን ለመጠቀም የመተግበሪያዎን ወይም የሥርአት ወኪል ቅንብሮን በራስዎ ማዋቀር ሊያስፈልግዎ ይችላል።",
+  "appbackend#state-stopped-title": "Psiphon ግንኙነት አቋርጧል",
+  "appbackend#state-starting-title": "Psiphon በመገናኘት ላይ ነው",
+  "appbackend#state-starting-body": "እብክዎ ይጠብቁ...",
+  "appbackend#state-connected-title": "Psiphon ተገናኝቷል",
+  "appbackend#state-connected-body": "ከድምበርዎት ባሻገር ያስሱ!",
+  "appbackend#state-connected-reminder-title": "Psiphon ተገናኝተው እንዲቆዩ  እያደረገ ነው",
+  "appbackend#state-connected-reminder-body": "Psiphonን ከክፍያ ነጻ አድርገው ያቆዩ። የስፖንሰር ገጾቻችንን  ለመጎብኘት እዚህ ጋር ጠቅ ያድርጉ!",
+  "appbackend#state-connected-reminder-body-2": "የስፖንሰሮቻችንን ገጾች በመጎብኘት Psiphonን ከክፍያ ነጻ አድርገው ያቆዩት! ",
+  "appbackend#minimized-to-systray-title": "Psiphon ወደ ማሳወቂያ ስፍራ አንሷል ",
+  "appbackend#minimized-to-systray-body": "መተግበሪያውን ለመመለስ አዶው ላይ ጠቅ ያድርጉ",
+  "appbackend#os-unsupported": "Psiphonን በWindows XP እና VISTA መጠቀም አይችሉም። ለተጨማሪ መረጃ ድር ጣቢያችንን ይጎብኙ።",
+  "psicash#transaction-error-title": "የPsiCash ግብይት ስህተት",
+  "psicash#transaction-error-body": "የእርስዎ PsiCash ግብይት ሙከራ ባልተጠበቀ ሁኔታ ሳይሳካ ቀርቷል።",
+  "psicash#transaction-ExistingTransaction-title": "የPsiCash ግዢ ቀድሞውኑ አለ",
+  "psicash#transaction-ExistingTransaction-body": "የዚህ አይነት የPsiCash ግዢ ቀድሞውኑ አለ። የዚህ ዐይነት ሌላ ግዢ ቀድሞ የተገዛው ቀኑ እስኪያልፍበት ድረስ የተከለከለ ነው።",
+  "psicash#transaction-InsufficientBalance-title": "የPsiCash ቀሪ ሂሳብዎ በቂ አይደለም",
+  "psicash#transaction-InsufficientBalance-body": "ለዚህ ግዢ የPsiCash ቀሪ ሂሳብዎ በቂ አይደለም።",
+  "psicash#transaction-TransactionAmountMismatch-title": "የPsiCash ግዢ ዋጋ አለመዛመድ",
+  "psicash#transaction-TransactionAmountMismatch-body": "የPsiCash ግዢ ዋጋዎች ግዜ ያለፈባቸው ናቸው። የPsiCash ዕሴት ዳግም ይቀናበራል።",
+  "psicash#transaction-TransactionTypeNotFound-title": "የPsiCash ግዢ ዐይነት አልተገኘም",
+  "psicash#transaction-TransactionTypeNotFound-body": "ለመግዛት የሚሞክሩት ምርት አሁን አይገኝም። መተግበሪያውን ማዘመን ወይም ዳግም መጫን ሊጠበቅቦት ይችላል።",
+  "psicash#transaction-InvalidTokens-title": "ተቀባይነት የሌላቸው የPsiCash ቦኖዎች",
+  "psicash#transaction-InvalidTokens-body": "የPsiCash ቦኖዋችዎት ተቀባይነት የሌላቸው ናቸው። መተግበሪያውን ዳግም ለማስጀመር ይሞክሩ። ያ የማይሠራ ከሆነ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">የአካባቢውን ማከማቻ ማጽዳት </a>ይኖርቦታል።",
+  "psicash#transaction-ServerError-title": "የPsiCash አገልጋይ ስህተት",
+  "psicash#transaction-ServerError-body": "የPsiCash አገልጋይ ግዢውን ለመፈጸም በሚያደርገው ጥረት ስህተት ተፈጥሯል። እባክዎትን ግዢውን ዳግም በሌላ ሰአት ለመፈጸም ይሞክሩ።",
+  "psicash#ui-speedboost-active": "ፍጥነት&nbsp;ጭማሬ ለ፡- %s ነቅቷል።",
+  "psicash#ui-zerobalance-title": "ፍጥነት&nbsp;ጭማሬ ያስፈልግዎታል?",
+  "psicash#ui-buypsi": "PsiCash ይግዙ",
+  "psicash#ui-buymorepsi": "ተጨማሪ PsiCash ይግዙ",
+  "psicash#ui-nsfbalance-buttontext": "ለፍጥነት&nbsp;ጭማሬ ያስፈልጋል",
+  "psicash#ui-enoughbalance-buttontext": "ፍጥነት&nbsp;ጭማሬ ያስጀምሩ",
+  "psicash#1-hour": "1 ሰዓት",
+  "psicash#1-day": "1 ቀን",
+  "psicash#ui-buyingboost-buttontext": "ፍጥነት&nbsp;ጭማሬን በማስጀመር ላይ!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon ግንኙነት ያስፈልጋል",
+  "psicash#mustconnect-modal#body": "PsiCashን ለመጠቀም ከPsiphon አውታረመረብ ጋር መገናኘት ያስፈልጋል።",
+  "psicash#init-error-title": "የPsiCash ጅማሬ ስህተት",
+  "psicash#init-error-body-unrecovered": "PsiCash ለመጀመር አልቻለም። ይህ ብዙ ግዜ የሚፈጠረው ልክ እንደ የዲስክ ቦታ ማጠር ያለ የፋይል ሥርአት ውስጥ በሚፈጠር ችግር ነው። ቀሪ ሂሳብዎ እና ሌሎችም ዕሴቶች ጠፍተዋል። PsiCash ከጥቅም ውጭ ይሆናል። ችግሩን ለመቅረፍ ለመሞከር መተግበሪያውን ዳግም ማስጀመር ይችላሉ።",
+  "psicash#init-error-body-recovered": "PsiCash ለመጀመር አልቻለም። ይህ ብዙ ግዜ የሚፈጠረው ልክ እንደ የዲስክ ቦታ ማጠር ያለ የፋይል ሥርአት ውስጥ በሚፈጠር ችግር ነው። ቀሪ ሂሳብዎ እና ሌሎችም ዕሴቶች ዳግም ተቀናብረዋል።",
+  "psicash#psiphon-speed": "Psiphon<br>ፍጥነት",
+  "notice#disallowed-traffic-alert-title": "የPsiphon ግንኙነትዎን ደረጃ ያልቁ",
+  "notice#disallowed-traffic-alert-body": "<p>መተገበሪያዎች እየሠሩ አይደለም?</p>\n<p>አንዳንድ የኢንተርኔት ትራፊክ በንቁ የፍጥነት ጭማሪ ካልሆነ በቀር እይደገፍም። የPsiphon ተሞክሮዎን ሙሉ እምቅ ኃይል ለመተግበር የፍጥነት ጭማሪን በPsiCash ያንቁ።</p>",
+  "appbackend#disallowed-traffic-notification-title": "መተግበሪያዎች እየሠሩ አይደለም?",
+  "appbackend#disallowed-traffic-notification-body": "የPsiphon ተሞክሮዎን ሙሉ እምቅ ኃይል ለመተግበር የፍጥነት ጭማሪን ያንቁ።",
+  "settings#disallowed-traffic-alert#heading": "የተከለከለ የትራፊክ ማስጠንቀቂያ",
+  "settings#disallowed-traffic-alert#help-text": "አንዳንድ የኢንተርኔት ትራፊክ በንቁ የፍጥነት ጭማሪ ካልሆነ በቀር እይደገፍም። እንደዚህ አይነት ትራፊክ በማይፈቀድበት ወቅት ማስጠቀቂያ ይታያል። (ዳግም ለማንቃት ዳግም መገናኘት ያስፈልጋል።)",
+  "settings#disallowed-traffic-alert#disable-label": "የተከለከሉ የትራፊክ ማስጠንቀቂያዎችን አሰናክል",
+  "banner#sponsored-by": "ስፖንሰር ያደረገው"
+};
\ No newline at end of file
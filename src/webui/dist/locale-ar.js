@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ar"].translation = {
+  "banner#long-connecting": "<strong>للأسف! </strong> يظهر إنك تواجه مشاكل في الإتصال!  <br>\nنزّل آخر نسخة من سايفون من  <a class=\"NewVersionURL\" href=\"#\">موقع التحميل </a>\nأو عبر إرسال بريد إلكتروني إلى  <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "جاري الإتصال ",
+  "nav#connection#connected": "تم الإتصال ",
+  "nav#connection#stopping": "جاري قطع الإتصال ",
+  "nav#connection#stopped": "تم قطع الإتصال ",
+  "nav#settings": "إعدادات",
+  "nav#feedback": "ملاحظات  ",
+  "nav#logs": "السجلات ",
+  "nav#about": "من نحن؟ ",
+  "connection#starting-msg": " <span class=\"state-word\">جاري الإتصال </span> بسايفون …",
+  "connection#stop-btn": "توقف",
+  "connection#connected-msg": "<span class=\"state-word\">تم الإتصال</span> بسايفون ",
+  "connection#disconnect-btn": "قطع الإتصال",
+  "connection#stopping-msg": "<span class=\"state-word\">جاري قطع الإتصال</span> بسايفون  …",
+  "connection#wait-btn": "الرجاء الإنتظار ",
+  "connection#stopped-msg": "<span class=\"state-word\">إنقطع الإتصال</span> بسايفون",
+  "connection#connect-btn": "إتصل ",
+  "connection#egress-region-combo-label": "تحديد منطقة الخادوم",
+  "settings#error-alert": "<strong>خطأ! </strong> يرجى تصحيح القيم غير الصحيحة قبل المتابعة.",
+  "settings#reset-button": "إعادة الضبط إلى الافتراضي",
+  "settings#apply-button": "طبق التغييرات ",
+  "settings#unapplied-changes-prompt#title": "تم تغيير الإعدادات ",
+  "settings#unapplied-changes-prompt#body": "لقد أجريت تغييرات لإعداداتك، ولكنك لم تطبقها بعد.<br><br> ا ؟هل تريد تطبيق هذه التغييرات أو إبطالها؟ ",
+  "settings#unapplied-changes-prompt#apply-button": "طبق ",
+  "settings#unapplied-changes-prompt#discard-button": "أبطل  ",
+  "settings#vpn-incompatible-msg": "(لا يعمل مع مود (L2TP/IPSec) ",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "شق المسار الآمن  ",
+  "settings#split-tunnel#help-text": "لو تم تفعيله فلن يتم تمرير الطلبات الموجهة لخوادم في بلدك عبر Psiphon.",
+  "settings#split-tunnel#reason": "المواقع في بلدك غير محجوبة بشكل عام، لذلك إذا فعلت هذا الخيار فسيعطيك وصول أسرع إلى هذه المواقع وفي بعض الأحيان سيخفف من تكلفة إستهلاك البيانات من موفر خدمة الإنترنت خاصتك.",
+  "settings#split-tunnel#enable-label": "لا تستعمل  بروكسي للمواقع في بلدك.",
+  "settings#disable-timeouts#heading": "تعطيل المهلات بالنسبة للشبكات البطيئة",
+  "settings#disable-timeouts#help-text": "إذا تم تمكين الاتصال بخادم سايفون فانه لن يتوقف.",
+  "settings#disable-timeouts#reason": "عند تفعيل هذا الإعداد على اتصال بالشبكة بطيء جدا، فسوف تقلل من احتمالية تعرض اتصالك للإنقطاع الغير متوقع.",
+  "settings#disable-timeouts#enable-label": "إبطال الانقطاعات للإتصالات البطيئة ",
+  "settings#egress-region#heading": "سيرفر سايفون الإقليمي  ",
+  "settings#egress-region#select-best-performance": "أفضل أداء",
+  "settings#egress-region#select-us": "الولايات المتحدة الأمريكية",
+  "settings#egress-region#select-ca": "كندا",
+  "settings#egress-region#select-gb": "المملكة المتحدة",
+  "settings#egress-region#select-jp": "اليابان",
+  "settings#egress-region#select-sg": "سنغافورة",
+  "settings#egress-region#select-sk": "سلوفاكيا",
+  "settings#egress-region#select-nl": "هولندا",
+  "settings#egress-region#select-de": "ألمانيا",
+  "settings#egress-region#select-in": "الهند",
+  "settings#egress-region#select-es": "إسبانيا",
+  "settings#egress-region#select-hk": "هونغ كونغ",
+  "settings#egress-region#select-at": "النمسا",
+  "settings#egress-region#select-be": "بلجيكا",
+  "settings#egress-region#select-bg": "بلغاريا",
+  "settings#egress-region#select-ch": "سويسرا",
+  "settings#egress-region#select-cz": "جمهورية التشيك",
+  "settings#egress-region#select-dk": "الدنمارك",
+  "settings#egress-region#select-fr": "فرنسا",
+  "settings#egress-region#select-hu": "اليونان",
+  "settings#egress-region#select-it": "إيطاليا",
+  "settings#egress-region#select-no": "النرويج",
+  "settings#egress-region#select-ro": "رومانيا",
+  "settings#egress-region#select-se": "السويد",
+  "settings#egress-region#select-pl": "بولندا",
+  "settings#egress-region#select-rs": "صربيا",
+  "settings#egress-region#select-au": "أستراليا",
+  "settings#egress-region#description": "Psiphon لديه خوادم كثيرة في بلدان مختلفة. إستعمال خادم سايفون لبلد قريب من بلدك سيوفر بشكل عام إتصال شبكة أسرع، ولكن ربما تود أن تصل إلى مواقع وخدمات كما لو كنت موجود افتراضيا في بلد أو منطقة معينة.",
+  "settings#egress-region#default": "اختيار الخيار الإفتراضي <strong>\"أفضل أداء\"</strong>  يتيح لسايفون إختيار خادوم تلقائيا، ذلك سينتج عادة أفضل إتصال باشبكة.",
+  "settings#egress-region#invalid-error-msg": "إختر سيرفر إقليمي لسايفون صالح للإستعمال ",
+  "settings#egress-region#error-modal-title": "إقليم السيرفر غير متوفر ",
+  "settings#egress-region#error-modal-body-http": "لقد قمت بضبط Psiphon لاستخدام خادوم في منطقة محددة.<br>\nولكن هذه المنطقة لم تعد متاحة.<br>\nلا بد من اختيار منطقة جديدة أو تغيير الاختيار الافتراضي ليكون \"أفضل أداء\".",
+  "settings#local-proxy-ports#heading": "المنافذ  المحلية للبروكسي ",
+  "settings#local-proxy-ports#leave-blank": "أتركها  <strong>فارغة </strong> للإنتقاء الأوتوماتيكي للمنافذ (يوصى  به).",
+  "settings#local-proxy-ports#reason": "إذا كنت تستعمل على حاسوبك الشخصي أدوات تستوجب ضبط يدوي لتعمل مع سايفون، يجب أن تدع سايفون يستعمل دائما نفس أرقام المنافذ المحلية. إذا لم يكن لديك سبب لتحديد أرقام المنافذ، يجب أن تدع سايفون ينتقيهم أوتوماتيكيا كي تساعد على تجنب التضارب.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "يجب أن تكون بين 1 و 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS  سوكس ",
+  "settings#local-proxy-ports#unique-error-msg": "يجب أن تكون المنافذ (البورتات) المحلية مختلفة عن بعضها البعض. ",
+  "settings#local-proxy-ports#error-modal-title": "تضارب في  منفذ البروكسي المحلي ",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nلقد ضبطت سايفون لإستعمال منفذ  محلي خاص لبروكسي أل  HTTP.<br>\nمع الأسف    يظهر أن هذا المنفذ في طور الإستعمال حاليا ولا يمكن لسايفون إستعماله .  \n</p>\n<p>الرجاء تغيير قيمة منفذ بروكسي  HTTP المضبوطة  \"configured HTTP proxy port value \" والمحاولة  من جديد.  ننصح بإزالة القيمة كي يستطيع سايفون إختيار منفذ متوفر أوتوماتيكيا. \n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>لقد ضبطت سايفون  لإستعمال منفذ محلي خاص  للبروكسي  سوكس  SOCKS\" <br\">\nمع الأسف  ظهر أن هذا المنفذ في طور الإستعمال حاليا ولا يمكن لسايفون إستعماله .\n</p>\n<p>\nالرجاء تغيير قيمة منفذ بروكسي  سوكس (SOCKS)  المضبوطة  \"configured SOCKS  proxy port value \" والمحاولة  من جديد.  ننصح بإزالة القيمة كي يستطيع سايفون إختيار منفذ متوفر أوتوماتيكيا. </p>",
+  "settings#upstream-proxy#heading": "أبستريم بروكسي  ",
+  "settings#upstream-proxy#by-default": "إذا كان جهاز الكمبيوتر الخاص بك لديه بروكسي مثبت، سايفون  سيستعمل أوتوماتيكيا هذا البروكسي عندما ينشئ النفق. يمكنك تجاوز هذا السلوك عن طريق تحديد بروكسي للإستعمال، أو بتحديد عدم جواز إستعمال \"أبستريم بروكسي\" كهذا .",
+  "settings#upstream-proxy#reason": "ألأبستريم بروكسي مطلوبين أحيانا في المدارس، الجامعات، وأماكن العمل. إذا كنت تعلم إعدادات الأبستريم بروكسي المطلوب من موفر خدمة الإنترنت خاصتك فقد يكون إدخالهم يدويا هنا مطلوب للإتصال.",
+  "settings#upstream-proxy#proxy-reqs": "وحدهم ال HTTP بروكسي  الذين يدعمون HTTPS مسموح بهم.",
+  "settings#upstream-proxy#hostname-label": "إسم المضيف ",
+  "settings#upstream-proxy#port-label": "منفذ ",
+  "settings#upstream-proxy#username-label": "اسم المستخدم",
+  "settings#upstream-proxy#password-label": "كلمة المرور",
+  "settings#upstream-proxy#domain-label": "النطاق",
+  "settings#upstream-proxy#skip-label": "لا تستعمل أبستريم بروكسي  ",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "خطأ بروكسي أبستريم.\nUpstream Proxy Error  ",
+  "settings#upstream-proxy#error-modal-body-default": "سايفون مضبوط حاليا لإستعمال بروكسي نظامك كأبستريم بروكسي ”. <br>\nومع ذلك، يظهر إننا غير قادرين على الإتصال بسيرفر سايفون من خلال هذا البروكسي .<br>\nالرجاء تفعيل  \"لا تستخدم أبستريم بروكسي\"  “Don't use upstream proxy” والمحاولة من جديد.",
+  "settings#upstream-proxy#error-modal-body-configured": "لقد  ضبطت سايفون ليستعمل أبستريم بروكسي  upstream proxy\" .<br\">\nومع ذلك، يظهر إننا غير قادرين على الإتصال بسيرفر سايفون من خلال هذا البروكسي.<br>\nالرجاء إعادة ضبط  الإعدادات والمحاولة  من جديد .",
+  "settings#transport-mode#heading": "أسلوب النقل ",
+  "settings#transport-mode#check-label": "إستعمل  أسلوب L2TP/IPSec",
+  "settings#transport-mode#help-text": "يستعمل ويندوز  L2TP/IPSec ربط الشبكات الإفتراضي  \"Virtual Networking\". هذا الوضع سيمرر كل التطبيقات  في نفق ، لكن  لن  يوفر  التجهيل   وبذلك لا  يؤمن  قدرات قوية لتجاوز الرقابة. لا  <strong>ننصح به </strong> لتجاوز أغلب جدران النار (Firewalls) .",
+  "settings#systray-minimize#heading": "صغّر إلى منطقة الإعلام (لوحة  النظام)   ",
+  "settings#systray-minimize#help-text": "إذا طبّق الإعداد المناسب، عندما يصّغر تطبيق سايفون سيختبئ في منطقة الإعلام (كما تعرف أيضا  بلوحة النظام  الموجودة قرب الساعة على شريط المهمة في الويندوز) ",
+  "settings#systray-minimize#reason": "تصغير سايفون إلى منطقة  الإعلام (لوحة النظام) يحرر مساحة على شريط المهام الخاص بك. هذا يساعد جدا، خصوصا إذا كنت تستعمل سايفون لمدة طويلة من الوقت. ",
+  "settings#systray-minimize#enable-label": "صغر إلى  شريط  الإعلام (لوحة النظام) ",
+  "settings#applying-message": "يتم إعادة الإتصال لتثبيت إعداداتك. ",
+  "settings#saved-message": " تم حفظ  الإعدادات  ",
+  "settings#error-modal#title": "خطأ في الإعدادات ",
+  "settings#error-modal#body": "هناك أخطاء في قيم إعداداتك. ألرجاء تصحيحهم قبل المباشرة. ",
+  "feedback#top_content_title": "شاركنا برأيك ",
+  "feedback#top_para_2": "الكثير من المشاكل يمكن حلها عبر التحديث إلى آخر إصدار. يمكنك  <a class=\"NewVersionURL\" href=\"#\">تنزيل آخر إصدار من خلال النقر هنا </a>, أو يمكنك إرسال بريد إلكتروني إلى  <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "يمكنك أيضا إيجاد حلول لمشكلاتك على صفحة  <a class=\"FaqURL\" href=\"#\">الأسئلة المتداولة  </a>.",
+  "feedback#smiley_happy": "سايفون يعمل ويتصل كما أريد. ",
+  "feedback#smiley_sad": "سايفون  غالبا ما يفشل بالإتصال أو لا يعمل جيدا. ",
+  "feedback#text_feedback_prompt": "الرجاء إدخال تعليقاتكم هنا:",
+  "feedback#text_feedback_email_prompt": "إذا  أردتم ردا مباشرا يجب إدخال بريدكم الإلكتروني:  ",
+  "feedback#diagnostic_check": "حمّل البيانات التشخيصية.  الرجاء الإنتباه أن هذه البيانات التشخيصية لا تكشف هويتك، إنما تساعد سايفون على العمل أفضل  <a class=\"DataCollectionInfoURL\" href=\"#\">أنقر هنا لرؤية نوع المعلومات التي نجمعها </a>",
+  "feedback#submit_button": "أرسل",
+  "feedback#text_feedback_bottom_para": "إذا كانت الإستمارة أعلاه لا تعمل، أو تريد إرسال لقطات شاشة، الرجاء مراسلتنا عبر هذا البريد الإلكتروني  <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>شكرا!</strong> قد تم إرسال ملاحظاتك.",
+  "logs#show-debug-label": "أظهر سجلات التصحيح ",
+  "logs#placeholder": "ليس هناك سجلات حاليا ",
+  "language#success-message": "<strong> مرحباً </strong> أهلاً بكم في سايفون. ",
+  "about#wordart-tag": "ما وراء الحدود ",
+  "about#description": "سايفون هو<strong> أداة لتجاوز الرقابة على الإنترنت.</strong> — لقد صمم لكي يساعد على الوصول إلى الإنترنت المفتوح، متجاوزا الرقابة والجدران النارية <strong>سايفون مصدر مفتوح</strong>  جرى تصميمه في تورنتو، كندا",
+  "about#visit-download-site": "الرجاء زيارة الموقع <strong><a class=\"NewVersionURL\" href=\"#\">لتحميل  نسخة جديدة  </a></strong> أو لكي <strong><a class=\"InfoURL\" href=\"#\">تحصل على مساعدة ومعلومات  and</a></strong>. سايفون متوفر للأندرويد والويندوز.",
+  "about#get-by-email": "<strong>إذا كنتم لا تستطيعون الدخول إلى الموقع </strong>, يمكنكم الحصول على نسخة جديدة  من سايفون  عبر إرسال بريد إلكتروني إلى:  ",
+  "about#client-version": "سايفون لإصدارات أجهزة سطح مكتب من ويندوز (Windows Client Version)",
+  "general#modal-close-button": "أغلق ",
+  "general#notice-modal-tech-preamble": "هذه هي معلومات الخطأ التقني ",
+  "notice#systemproxysettings-setproxy-error-title": "خطأ في بروكسي النظام   ",
+  "notice#systemproxysettings-setproxy-error-body": "<p>فشل سايفون في ضبط إعدادات البروكسي للنظام .</p>\n<p>يمكن أن يعود ذلك لوجود تصادم مع نظام مكافحة الفيروسات خاصتك .  قد تحتاج إلى الضبط اليدوي لتطبيقك أو لإعدادات  بروكسي النظام لكي تستعمل بروكسي سايفون المحلي .  </p>",
+  "notice#systemproxysettings-setproxy-warning-template": "سايفون فشل في ضبط إعدادات بروكسي النظام لإتصال الإنترنت المسمى “<%- data %>”. قد يكون ذلك سببه تصادم مع  نظام مكافحة الفيروسات. قد تحتاج إلى الضبط اليدوي لتطبيقك أو لإعدادات  بروكسي النظام لكي تستعمل بروكسي سايفون المحلي. ",
+  "appbackend#state-stopped-title": "لقد إنقطع الإتصال بسايفون",
+  "appbackend#state-starting-title": "سايفون يحاول الإتصال ",
+  "appbackend#state-starting-body": "الرجاء الإنتظار ",
+  "appbackend#state-connected-title": "سايفون متصل ",
+  "appbackend#state-connected-body": "إكتشف ما وراء حدودك! ",
+  "appbackend#state-connected-reminder-title": "سايفون يقوم بالحفاظ على إتصالك",
+  "appbackend#state-connected-reminder-body": "ساهم في إبقاء سايفون مجاني. إضغط هنا لزيارة مواقع داعمينا!",
+  "appbackend#state-connected-reminder-body-2": "ساهم في إبقاء سايفون مجاني بزيارة مواقع داعمينا!",
+  "appbackend#minimized-to-systray-title": "لقد تّم تصغير سايفون إلى منطقة الإعلام ",
+  "appbackend#minimized-to-systray-body": "إضغط الأيقونة لإسترجاع التطبيق ",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "رصيد PsiCash غير كاف",
+  "psicash#transaction-InsufficientBalance-body": "ليس عندك ما يكفي من رصيد PsiCash لاتمام هذا الشراء.",
+  "psicash#transaction-TransactionAmountMismatch-title": "عدم توافق في سعر شراء PsiCash",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "هل تحتاج إلى السرعة الفائقة؟",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "ابدأ السرعة&nbspالفائقة",
+  "psicash#1-hour": "ساعة",
+  "psicash#1-day": "1 يوم",
+  "psicash#ui-buyingboost-buttontext": "جارٍ البدء في السرعةnbsp;الفائفة!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "يلزم الاتصال ب Psiphon",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "برعاية "
+};
\ No newline at end of file
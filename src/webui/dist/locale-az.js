@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["az"].translation = {
+  "banner#long-connecting": "<strong>Yox!</strong> Qoşulmaqda çətinlik çəkirsiniz!<br>\nPsiphonun son versiyasını yükləmək üçün <a class=\"NewVersionURL\" href=\"#\">sayta keçin</a>\nvə ya email göndərin <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Qoşulur",
+  "nav#connection#connected": "Qoşuldu",
+  "nav#connection#stopping": "Ayrılır",
+  "nav#connection#stopped": "Ayrıldı",
+  "nav#settings": "Quraşdırmalar",
+  "nav#feedback": "Şərhiniz",
+  "nav#logs": "Girişlər",
+  "nav#about": "Haqqında",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">qoşulur</span>…",
+  "connection#stop-btn": "Dayan",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">qoşuldu</span>",
+  "connection#disconnect-btn": "Ayrıl",
+  "connection#stopping-msg": "Psiphondan <span class=\"state-word\">ayrıl</span>…",
+  "connection#wait-btn": "Gözləyin...",
+  "connection#stopped-msg": "Psiphondan <span class=\"state-word\">ayrıldı</span>",
+  "connection#connect-btn": "Qoşul",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Xəta!</strong> Zəhmət olmasa, səhv elementləri düzəldin.",
+  "settings#reset-button": "İlkin versiyaya qayıt",
+  "settings#apply-button": "Dəyişiklikləri tətbiq et",
+  "settings#unapplied-changes-prompt#title": "Quraşdırmalar dəyişdi",
+  "settings#unapplied-changes-prompt#body": "Seçimlərinizə dəyişikliklər etmisiniz, amma onları tətbiq etməmisiniz.<br><br>Dəyşiklikləri tətbiq etmək, yoxsa silmək istəyirsiniz?",
+  "settings#unapplied-changes-prompt#apply-button": "Tətbiq et",
+  "settings#unapplied-changes-prompt#discard-button": "Çıxar",
+  "settings#vpn-incompatible-msg": "(L2TP/IPsec modeli ilə işləmir)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Tuneli böl",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Öz ölkəniz daxilində saytları proksiləməyin",
+  "settings#disable-timeouts#heading": "Aşağı sürətli şəbəkələr üçün dayanmaları söndürün",
+  "settings#disable-timeouts#help-text": "Aktivləşdirilibsə, Psiphon serveri ilə dayanma olmayacaq.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Aşağı sürətli şəbəkələr üçün dayanmaları söndürün",
+  "settings#egress-region#heading": "Psiphon Serveri bölgəsi",
+  "settings#egress-region#select-best-performance": "Ən sürətli qoşulma",
+  "settings#egress-region#select-us": "ABŞ",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Birləşmiş Krallıq",
+  "settings#egress-region#select-jp": "Yaponiya",
+  "settings#egress-region#select-sg": "Sinqapur",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Niderland",
+  "settings#egress-region#select-de": "Almaniya",
+  "settings#egress-region#select-in": "Hindistan",
+  "settings#egress-region#select-es": "İspaniya",
+  "settings#egress-region#select-hk": "Hong Konq",
+  "settings#egress-region#select-at": "Avstriya",
+  "settings#egress-region#select-be": "Belçika",
+  "settings#egress-region#select-bg": "Bolqarıstan",
+  "settings#egress-region#select-ch": "İsveçrə",
+  "settings#egress-region#select-cz": "Çexiya",
+  "settings#egress-region#select-dk": "Danimarka",
+  "settings#egress-region#select-fr": "Fransa",
+  "settings#egress-region#select-hu": "Macarıstan",
+  "settings#egress-region#select-it": "İtaliya",
+  "settings#egress-region#select-no": "Norveç",
+  "settings#egress-region#select-ro": "Rumıniya",
+  "settings#egress-region#select-se": "İsveç",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Düzgün Psiphon bölgəsi seçin.",
+  "settings#egress-region#error-modal-title": "Server Bölgəsi İşləmir",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Yerli proksi portları",
+  "settings#local-proxy-ports#leave-blank": "Avtomatik port seçimi üçün <strong>boş</strong> buraxın (məsləhətdir).",
+  "settings#local-proxy-ports#reason": "Kompüterinizdəki alətlər Psiphon üzərindən fəaliyyət göstərmək üçün əllə quraşdırma tələb edirsə, Psiphonun eyni port nömrələrindən istifadə etməsini istəyəcəksiniz. Port nömrələrini  müəyyənləşdirmək vacib deyilsə, problemlərdən qaçmaq üçün Psiphonun onları avtomatik seçməsinə icazə verməlisiniz.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 və 65535 arasında olmalıdır.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Yerli portlar bir-birindən seçilməlidirlər.",
+  "settings#local-proxy-ports#error-modal-title": "Yerli Proksi Port Münaqişəsi",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphonu müəyyən yerli portdan onun HTTS proksisi ilə işləmək üçün quraşdırmısınız.<br>\nAncaq həmin port artıq istifadədir və Psiphon ona qoşula bilmir.\n</p>\n<p>\nZəhmət olmasa, HTTP proksi portu elementini dəyişdirin və yenidən cəhd edin. Həmin elementi silməyi tövsiyyə edirik. Silin ki, Psiphon boş olan portu avtmatik seçsin.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphonu müəyyən yerli portdan onun SOCKS proksisi ilə işləmək üçün quraşdırmısınız.2\nAncaq həmin port artıq istifadədir və Psiphon ona qoşula bilmir.\n</p>\n<p>\nZəhmət olmasa, SOCKS proksi portu elementini dəyişdirin və yenidən cəhd ediin. Həmin elementi silməyi tövsiyyə edirik. Silin ki, Psiphon boş olan portu avtmatik seçsin.\n</p>",
+  "settings#upstream-proxy#heading": "Yuxarı axın proksisi",
+  "settings#upstream-proxy#by-default": "Kompüterindizdə proksi artıq quraşdırılıbsa, tunel yaradanda Psiphon avtomatik olarq həmin proksidən istifadə edəcək. Buna yol verməmək üçün istifadə olunacaq proksini seçməli, ya da \"yuxarı axınlı proksi\"dən istifadə olunmayacağını qeyd etməlisiniz.",
+  "settings#upstream-proxy#reason": "Yuxarı axın proksiləri bəzən məktəb, universitet və şirkətlər istəyir. Provayderiniz sizə yuxarı axınlı proksi quraşdırmaları veribsə, onları dəyişmək üçün qoşulma tələb oluna bilər.",
+  "settings#upstream-proxy#proxy-reqs": "Yalnız HTTPS-i dəstəkləyən HTTP proksilərə icazə verilir.",
+  "settings#upstream-proxy#hostname-label": "Host adı",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "İstifadəçi adı",
+  "settings#upstream-proxy#password-label": "Parol",
+  "settings#upstream-proxy#domain-label": "Domen",
+  "settings#upstream-proxy#skip-label": "Yuxarı axınlı proksidən istifadə etməyin",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Yuxarı axın proksi xətası",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon sistem proksinizin istifadəsi üçün quraşdırılıb və onu \"yuxarı axın proksisi\" kimi tanıyır.<br>\nAncaq, Psiphon serverinə qeyd olunan proksidən qoşula bilmirik.<br>\nZəhmət olmasa, \"Yuxarı axın proksisindən istifadə etmə\" seçimini aktivləşdirin və yenidən cəhd edin.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphonu \"yuxarı axın proksisinin\" istifadəsi üçün quraşdırmısnız.<br>\nAncaq, Psiphon serverinə qeyd olunan proksidən qoşula bilmirik.<br>\nZəhmət olmasa, quraşdırmanı müəyyən edin və yenidən cəhd göstərin.",
+  "settings#transport-mode#heading": "Transport modeli",
+  "settings#transport-mode#check-label": "L2TP/IPSec modelindən istifadə edin",
+  "settings#transport-mode#help-text": "Windows-un L2TP/IPSec virtual şəbəkəsindən istifadə edir. Bu modeldə bütün tətbiqetmələriniz tuneldən keçir, amma gizlilik təmin olunmur deyə güclü anti-senzura imkanlarına malik deyil. Əksər fayervolları keçmək üçün <strong>məsləhət deyil</strong> .",
+  "settings#systray-minimize#heading": "Xəbərdarlıq bölgəsinə endir (Sistem xəttinə)",
+  "settings#systray-minimize#help-text": "Aktivləşdirilibsə, endiriləndə Psiphon proqramının pəncərəsi xəbərdarlıqlar bölməsində gizlənəcək (ona həm də \"sistem çubuğu\" deyirlər, Windowsda saat işarəsinin yanında yerləşir).",
+  "settings#systray-minimize#reason": "Psiphonun xəbərdarlıq bölməsinə endirilməsi (\"sistem çubuğu\") ekranınızda yer boşaldır. Bu, xüsusilə Psiphondan tez-tez və uzun müddət istifadə edəndə işə yarayır. ",
+  "settings#systray-minimize#enable-label": "Xəbərdarlıq bölgəsinə endir (Sistem xəttinə)",
+  "settings#applying-message": "Quraşdırmalarınızı fəallaşdırmaq üçün yenidən qoşulur.",
+  "settings#saved-message": "Quraşdırmalar saxlandı.",
+  "settings#error-modal#title": "Quraşdırma səhvi",
+  "settings#error-modal#body": "Quraşdırma elementlərinizdə xətalar var. Davam etməzdən əvvəl onları düzəldin.",
+  "feedback#top_content_title": "Öz Qiymətləndirmənizi Verin",
+  "feedback#top_para_2": "Son versiyanı yükləməklə xeyli problemdən qurtaracaqsınız. Siz<a class=\"NewVersionURL\" href=\"#\">son versiyanı bura klikləməklə yükləyə</a>, və ya email göndərməklə əldə edə bilərsiniz <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Bəzi ümumi problemlərin həlli yollarını <a class=\"FaqURL\" href=\"#\">Tez-Tez Verilən Suallarda</a> tapa bilərsiniz.",
+  "feedback#smiley_happy": "Psiphon istədiyim kimi qoşulur və işləyir.",
+  "feedback#smiley_sad": "Psiphon tez-tez dayanır və yaxşı işləmir.",
+  "feedback#text_feedback_prompt": "Şərhlərinizi bura yazın:",
+  "feedback#text_feedback_email_prompt": "Sizə cavab verməyimizi istəyirsinizsə, öz email ünvanınızı bura qeyd edin:",
+  "feedback#diagnostic_check": "Diaqnoz məlumatını yüklə. Qeyd edək ki, diaqnoz məlumatı sizi müəyyən etmir və Psiphonun düzgün işləməsinə yardım edir. <a class=\"DataCollectionInfoURL\" href=\"#\"> Hansı məlumatların toplandığını görmək üçün klikləyin.</a>",
+  "feedback#submit_button": "Göndər",
+  "feedback#text_feedback_bottom_para": "Yuxarıdakı anket işləmirsə və ya ekran görüntüsünü göndərmək istəyirsinizsə, zəhmət olmasa, bizə email yazın <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Sağ olun!</strong> Şərhiniz göndərildi.",
+  "logs#show-debug-label": "Xəta girişlərini göstər",
+  "logs#placeholder": "Giriş yoxdur",
+  "language#success-message": "<strong>Salam!</strong> Psiphona xoş gəldiniz.",
+  "about#wordart-tag": "Sərhədsiz",
+  "about#description": "Psiphon <strong>senzuradan qurtulmaq üçündür</strong> , internetdən limitsiz və əngəlsiz istifadə etməkdən ötrü yaradılıb. O, <strong>açıq mənbəliir</strong> və Torontoda, Kanadada təsis edilib.",
+  "about#visit-download-site": "Zəhmət olmasa sayta daxil olun ki, <strong><a class=\"NewVersionURL\" href=\"#\">yeni versiyanı yükləyəsiniz</a></strong> və ya <strong><a class=\"InfoURL\" href=\"#\">yardım məlumatı alasınız</a></strong>. Psiphon iAndroid və Windows-da işləyir.",
+  "about#get-by-email": "<strong>Sayta giriş mümkün deyilsə</strong>, Psiphonu əldə etmək üçün email göndərin:",
+  "about#client-version": "Windows üçün Psiphon versiyası:",
+  "general#modal-close-button": "Bağla",
+  "general#notice-modal-tech-preamble": "Texniki xəta haqda məlumat:",
+  "notice#systemproxysettings-setproxy-error-title": "Sistem proksi xətası",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistem proksi quraşdırmalarını edə bilmədi.</p>\n<p>Bu antivirus proqramınızla münaqişə ilə bağlı ola bilər. Gərək tətbiqetmənizi və ya sistem proksi quraşdırmalarınızı yerli Psiphon proksiləri ilə işləmək üçün sazlayasınız.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” adlı internet qoşulması üçün sistem proksi quraşdırmalarını müəyyənləşdirə bilmədi. Bu, sizin antivirusla münaqişə ilə bağlı ola bilər. Yerli Psiphon proksilərindən istifadə üçün tətbiqetmənizi və ya sistem proksi quraşdırmalarınızı bir-bir dəyişdirməlisiniz.",
+  "appbackend#state-stopped-title": "Psiphon ayrılıb",
+  "appbackend#state-starting-title": "Psiphon  qoşulur",
+  "appbackend#state-starting-body": "Gözləyin...",
+  "appbackend#state-connected-title": "Psiphon qoşuldu",
+  "appbackend#state-connected-body": "Sərhədlərinizi aşın!",
+  "appbackend#state-connected-reminder-title": "Psiphon sizin qoşulmanızı təmin edir",
+  "appbackend#state-connected-reminder-body": "Psiphonu pulsuz istifadə edin. Sponsor səhifələrinə keçmək üçün bura klikləyin!",
+  "appbackend#state-connected-reminder-body-2": "Sponsor səhifələrinə keçməklə Psiphonu pulsuz saxlamağa yardım edirsiniz!",
+  "appbackend#minimized-to-systray-title": "Psiphon xəbərdarlıq bölgəsinə endirildi",
+  "appbackend#minimized-to-systray-body": "Tətbiqetməni bərpa etmək üçün kliklə",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Sponsoru:"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["be"].translation = {
+  "banner#long-connecting": "<strong>Ой, не!</strong> Выглядае на праблемы са злучэннем!<br>\nЗагрузіце найноўшую версію Psiphon з <a class=\"NewVersionURL\" href=\"#\">сайту загрузак</a>або дашліце нам ліст на <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "nav#connection#starting": "Ідзе злучэнне...",
+  "nav#connection#connected": "Падлучана",
+  "nav#connection#stopping": "Ідзе адлучэнне",
+  "nav#connection#stopped": "Адлучана",
+  "nav#settings": "Налады",
+  "nav#feedback": "Зваротная сувязь",
+  "nav#logs": "Журналы",
+  "nav#about": "Пра праграму",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">падлучаецца</span>…",
+  "connection#stop-btn": "Стоп",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">падлучаны</span>",
+  "connection#disconnect-btn": "Адлучыць",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">адлучаецца</span>…",
+  "connection#wait-btn": "Калі ласка, пачакайце...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">адлучаны</span>",
+  "connection#connect-btn": "Злучыцца",
+  "connection#egress-region-combo-label": "Выбраць рэгіён серверу",
+  "settings#error-alert": "<strong>Памылка!</strong> Калі ласка, перш чым працягваць, выпраўце няслушныя значэнні.",
+  "settings#reset-button": "Скінуць да стандартнага",
+  "settings#apply-button": "Прымяніць змены",
+  "settings#unapplied-changes-prompt#title": "Налады змененыя",
+  "settings#unapplied-changes-prompt#body": "Вы ўнеслі змены ў налады, але не прымянілі іх.<br><br> Жадаеце прымяніць змены зараз або адмяніць іх?",
+  "settings#unapplied-changes-prompt#apply-button": "Прымяніць",
+  "settings#unapplied-changes-prompt#discard-button": "Адмяніць",
+  "settings#vpn-incompatible-msg": "(Не працуе ў рэжыме L2TP/IPSec).",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Падзяліць тунэль",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Не пускаць праз проксі-сервер сайты з вашай краіны",
+  "settings#disable-timeouts#heading": "Адключыць час чакання для павольных злучэнняў",
+  "settings#disable-timeouts#help-text": "Калі ўключана, сувязь з серверам Psiphon не будзе перапыняцца праз доўгі час чакання.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Адключыць час чакання для павольных злучэнняў",
+  "settings#egress-region#heading": "Рэгіён сервера Psiphon ",
+  "settings#egress-region#select-best-performance": "Лепшая прадукцыйнасць",
+  "settings#egress-region#select-us": "Злучаныя Штаты Амерыкі",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Вялікабрытанія",
+  "settings#egress-region#select-jp": "Японія",
+  "settings#egress-region#select-sg": "Сінгапур",
+  "settings#egress-region#select-sk": "Славакія",
+  "settings#egress-region#select-nl": "Нідэрланды",
+  "settings#egress-region#select-de": "Германія",
+  "settings#egress-region#select-in": "Індыя",
+  "settings#egress-region#select-es": "Іспанія",
+  "settings#egress-region#select-hk": "Ганконг",
+  "settings#egress-region#select-at": "Аўстрыя",
+  "settings#egress-region#select-be": "Бельгія",
+  "settings#egress-region#select-bg": "Балгарыя",
+  "settings#egress-region#select-ch": "Швейцарыя",
+  "settings#egress-region#select-cz": "Чэхія",
+  "settings#egress-region#select-dk": "Данія",
+  "settings#egress-region#select-fr": "Францыя",
+  "settings#egress-region#select-hu": "Венгрыя",
+  "settings#egress-region#select-it": "Італія",
+  "settings#egress-region#select-no": "Нарвегія",
+  "settings#egress-region#select-ro": "Румынія",
+  "settings#egress-region#select-se": "Швецыя",
+  "settings#egress-region#select-pl": "Польшчы",
+  "settings#egress-region#select-rs": "Сербія",
+  "settings#egress-region#select-au": "Аўстралія",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Выберыце дзейсны рэгіён сервера Psiphon ",
+  "settings#egress-region#error-modal-title": "Рэгіён сервера недаступны",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Порты лакальнага проксі-сервера",
+  "settings#local-proxy-ports#leave-blank": "Пакіньце <strong>пустым</strong>для аўтаматычнага выбару порту (рэкамендуецца).",
+  "settings#local-proxy-ports#reason": "Калі вы выкарыстоўваеце такія інструменты, якія патрабуюць ручнога канфігуравання працы з Psiphon, у вас будзе жаданне, каб Psiphon выкарыстоўваў адны і тыя ж лакальныя нумары портаў. Калі ў вас няма прычынаў для пазначэння нумара порта, варта дазволіць Psiphon выбіраць іх аўтаматычна, каб пазбегнуць канфліктаў.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Павінна быць паміж 1 і 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Лакальныя порты павінны быць адрознымі адзін ад аднаго.",
+  "settings#local-proxy-ports#error-modal-title": "Канфлікт портаў лакальнага проксі-сервера",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nВы сканфігуравалі Psiphon на выкарыстанне канкрэтнага лакальнага порту для яго HTTP-проксі-сервера<br>.\nАднак выглядае, што гэты порт ужо выкарыстоўваецца і таму Psiphon ня можа яго выкарыстаць.\n</p>\n<p>\nКалі ласка, змяніце сканфігураванае значэнне порта HTTP проксі-сервера і паспрабуйце зноў. Мы рэкамендуем ачысціць гэтае значэнне, каб Psiphon мог аўтаматычна выбраць свабодны порт.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВы сканфігуравалі Psiphon на выкарыстанне канкрэтнага лакальнага порту для яго SOCKS-проксі-сервера<br>.\nАднак выглядае, што гэты порт ужо выкарыстоўваецца і таму Psiphon не можа яго выкарыстаць.\n</p>\n<p>\nКалі ласка, змяніце сканфігураванае значэнне порта SOCKS-проксі-сервера і паспрабуйце зноў. Мы рэкамендуем ачысціць гэтае значэнне, каб Psiphon мог аўтаматычна выбраць свабодны порт.\n</p>",
+  "settings#upstream-proxy#heading": "Вышэйстаячы проксі-сервер",
+  "settings#upstream-proxy#by-default": "Калі на Вашым камп'ютары проксі-сервер ужо сканфігураваны, па змаўчанні Psiphon будзе выкарыстоўваць гэты проксі-сервер пры стварэнні тунэля. Вы можаце змяніць гэтыя паводзіны шляхам вызначэння проксі-сервера для выкарыстання або ўдакладніўшы, што ніякі «вышэйстаячы проксі-сервер» не павінен выкарыстоўвацца.",
+  "settings#upstream-proxy#reason": "Школы, універсітэты, або фірмы часам вымагаюць мець вышэйстаячыя проксі-серверы. Калі ваш інтэрнэт-правайдэр надаў вам налады вышэйстаячага проксі-сервера, ручное іх наладжванне можа вымагаць наяўнасці падлучэння.",
+  "settings#upstream-proxy#proxy-reqs": "Дазволеныя толькі проксі-серверы HTTP, якія падтрымліваюць HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Назва вузла",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Імя карыстальніка",
+  "settings#upstream-proxy#password-label": "Пароль",
+  "settings#upstream-proxy#domain-label": "Дамен",
+  "settings#upstream-proxy#skip-label": "Не ўжываць вышэйстаячы проксі-сервер",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Памылка вышэйстаячага проксі-сервера",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon цяпер сканфігураваны на выкарыстанне проксі-сервера вашай сістэмы як свайго \"вышэйстаячага проксі-сервера\"<br>.\nАднак мы, здаецца, ня можам падлучыцца да сервера Psiphon праз гэты проксі-сервер<br>.\nКалі ласка, уключыце «Не ўжываць вышэйстаячы проксі-сервер» і паспрабуйце зноў.",
+  "settings#upstream-proxy#error-modal-body-configured": "Вы сканфігуравалі Psiphon на выкарыстанне \"вышэйстаячага проксі-сервера\"<br>.\nАднак мы, здаецца, не можам падлучыцца да сервера Psiphon праз гэты проксі-сервер<br>.\nКалі ласка, выпраўце налады і паспрабуйце зноў.",
+  "settings#transport-mode#heading": "Рэжым транспартавання",
+  "settings#transport-mode#check-label": "Ужыць рэжым L2TP/IPSec",
+  "settings#transport-mode#help-text": "Выкарыстоўвае віртуальную сетку Windows L2TP/IPSec. Гэты рэжым тунэлюе ўсе вашы прыкладанні, але не забяспечвае заблытвання коду і таму не дае вялікіай магчымасці абыходу цэнзуры. Ён не рэкамендуецца для пераадолення большасці міжсеткавых экранаў.",
+  "settings#systray-minimize#heading": "Згарнуць да вобласці апавяшчэнняў (сістэмны латок)",
+  "settings#systray-minimize#help-text": "Калі гэты параметр уключаны, пры згортванні акно Psiphon будзе схаванае ў вобласці апавяшчэнняў (таксама вядомай як «сістэмны латок» або «systray», размешчанай побач з гадзіннікам на панэлі задач Windows).",
+  "settings#systray-minimize#reason": "Згорванне Psiphon да вобласці апавяшчэнняў (\"сістэмны латок\") вызваляе месца на панэлі задач. Гэта асабліва зручна, калі вы часта ўжываеце Psiphon на працягу доўгага часу. ",
+  "settings#systray-minimize#enable-label": "Згарнуць да вобласці апавяшчэнняў (сістэмны латок)",
+  "settings#applying-message": "Паўторнае злучэнне, каб дастасаваць налады.",
+  "settings#saved-message": "Налады захаваныя.",
+  "settings#error-modal#title": "Памылка наладаў",
+  "settings#error-modal#body": "Ёсць памылкі ў значэннях наладаў. Перш чым працягнуць, калі ласка, выпраўце.",
+  "feedback#top_content_title": "Дашліце водгук",
+  "feedback#top_para_2": "Шмат праблем могуць быць вырашаныя праз загрузку найноўшай версіі. Вы можаце загрузіць найноўшую версію праз клік тут</a> або можаце даслаць нам ліст на <a class=\"NewVersionEmail\" href=\"#\">адрас</a>.",
+  "feedback#top_para_3": "Таксама можна знайсці вырашэнне шмат якіх агульных праблем у нашай рубрыцы <a class=\"FaqURL\" href=\"#\">Тыповыя пытанні</a>.",
+  "feedback#smiley_happy": "Psiphon злучае і працуе так, як я хачу.",
+  "feedback#smiley_sad": "Psiphon часта дае памылку злучэння ці не працуе дастаткова добра.",
+  "feedback#text_feedback_prompt": "Калі ласка, напішыце каментарыі тут:",
+  "feedback#text_feedback_email_prompt": "Калі вы хацелі б, каб мы адказалі, калі ласка, упішыце тут ваш адрас электроннай пошты:",
+  "feedback#diagnostic_check": "Загрузіць даныя дыягностыкі. Калі ласка, звярніце ўвагу, што гэтыя даныя дыягностыкі не дазваляюць індэнтыфікаваць вас, а нам гэта дазволіць падтрымліваць спраўную працу Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Націснуць тут, каб пабачыць, якія даныя мы збіраем</a>.",
+  "feedback#submit_button": "Даслаць",
+  "feedback#text_feedback_bottom_para": "Калі форма вышэй не спрацоўвае або вы хацелі б даслаць скрыншоты, дашліце ліст на адрас <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Дзякуй!</strong> Ваш водгук дасланы.",
+  "logs#show-debug-label": "Паказаць журналы адладкі",
+  "logs#placeholder": "Няма запісаў у журналах",
+  "language#success-message": "<strong>Вітаем!</strong> Запрашаем да Psiphon.",
+  "about#wordart-tag": "Па-за межамі",
+  "about#description": "Psiphon - <strong>гэта інструмент для абыходу цэнзуры</strong> — ён прызначаны для доступу да адкрытага інтэрнэту, абмінаючы цэнзараў і міжсеткавыя экраны. Ён мае <strong>адкрыты зыходны код</strong> і распрацоўваецца ў Таронта, Канада.",
+  "about#visit-download-site": "Калі ласка, наведайце наш вэб-сайт, каб <strong><a class=\"NewVersionURL\" href=\"#\">загрузіць новую версію</a></strong> або <strong><a class=\"InfoURL\" href=\"#\">атрымаць дапамогу ці інфармацыю</a></strong>. Psiphon даступны для Android і Windows.",
+  "about#get-by-email": "<strong>Калі вэб-сайт недаступны</strong>, можна атрымаць новую версію Psiphon, даслаўшы нам ліст на адрас:",
+  "about#client-version": "Кліенцкая версія Psiphon для Windows",
+  "general#modal-close-button": " Закрыць",
+  "general#notice-modal-tech-preamble": "Вось інфармацыя адносна тэхнічнай памылкі:",
+  "notice#systemproxysettings-setproxy-error-title": "Памылка сістэмнага проксі-сервера",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не не змог задаць параметры проксі-сервера сістэмы</p>.\n<p>Гэта можа здарыцца па прычыне канфлікту з антывіруснай праграмай. Вам, магчыма, давядзецца ўручную сканфігураваць параметры праграмы або стэмныя налады проксі-сервера, каб выкарыстоўваць лакальныя проксі-серверы Psiphon</p>.",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon не не змог задаць параметры проксі-сервера сістэмы для інтэрнэт-злучэння “<%- data %>”. Гэта можа быць па прычыне канфлікту з антывіруснай праграмай. Вам, магчыма, спатрэбіцца ўручную сканфігураваць параметры праграмы або сістэмныя налады проксі-сервера, каб выкарыстоўваць лакальныя проксі-серверы Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon адлучаны",
+  "appbackend#state-starting-title": "Psiphon злучаецца",
+  "appbackend#state-starting-body": "Калі ласка, пачакайце...",
+  "appbackend#state-connected-title": "Psiphon падлучаны",
+  "appbackend#state-connected-body": "Вандруйце па-за межамі!",
+  "appbackend#state-connected-reminder-title": "Psiphon трымае вас на сувязі",
+  "appbackend#state-connected-reminder-body": "Няхай Psiphon застаецца бясплатным. Націсніце сюды, каб наведаць старонкі нашых спонсараў!",
+  "appbackend#state-connected-reminder-body-2": "Захавайма бясплатнасць Psiphon, наведваючы старонкі нашых спонсараў!",
+  "appbackend#minimized-to-systray-title": "Psiphon згорнуты да вобласці апавяшчэнняў (сістэмны латок)",
+  "appbackend#minimized-to-systray-body": "Націснуць на значок, каб вярнуць праграму",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Спонсар"
+};
\ No newline at end of file
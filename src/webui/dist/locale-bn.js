@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["bn"].translation = {
+  "banner#long-connecting": "<strong>ওহ না! </strong>আপনি সংযোগ-এ সমস্যার সম্মুখীন হচ্ছেন বলে মনে হচ্ছে!<br> ডাউনলোড সাইট থেকে<a class=\"NewVersionURL\" href=\"#\"> বা একটি ইমেল পাঠিয়ে<a class=\"NewVersionEmail\" href=\"#\">  সাইফন এর সর্বশেষ সংস্করণ ডাউনলোড করুন </a> ",
+  "nav#connection#starting": "সংযোগ করা হচ্ছে",
+  "nav#connection#connected": "সংযুক্ত",
+  "nav#connection#stopping": "সংযোগ বিচ্ছিন্ন করা হচ্ছে",
+  "nav#connection#stopped": "সংযোগ বিচ্ছিন্ন",
+  "nav#settings": "বিন্যাস",
+  "nav#feedback": "প্রতিক্রিয়া",
+  "nav#logs": "কার্যবিবরণীগুলি",
+  "nav#about": "সম্বন্ধে",
+  "connection#starting-msg": "সাইফন হল<span class=\"state-word\"> সংযোগ করা</span>...",
+  "connection#stop-btn": "থামুন",
+  "connection#connected-msg": "সাইফন<span class=\"state-word\">সংযুক্ত</span>",
+  "connection#disconnect-btn": "সংযোগ বিচ্ছিন্ন করা",
+  "connection#stopping-msg": "সাইফন<span class=\"state-word\">সংযোগ বিচ্ছিন্ন হচ্ছে</span>...",
+  "connection#wait-btn": "অনুগ্রহপূর্বক অপেক্ষা করুন…",
+  "connection#stopped-msg": "সাইফন<span class=\"state-word\">সংযোগ বিচ্ছিন্ন</span>",
+  "connection#connect-btn": "সংযোগ করুন",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>ত্রুটি!</strong>অগ্রসর হওয়ার আগে অনুগ্রহ করে ভুল মানগুলি ঠিক করুন।",
+  "settings#reset-button": "ডিফল্ট পুন:স্থাপন করুন",
+  "settings#apply-button": "পরিবর্তনগুলি প্রয়োগ করুন",
+  "settings#unapplied-changes-prompt#title": "সেটিংস পরিবর্তন হয়েছে",
+  "settings#unapplied-changes-prompt#body": "আপনি আপনার সেটিংস পরিবর্তন করেছেন, কিন্তু আপনি পরিবর্তন প্রয়োগ করেন নি।<br><br>আপনি কি এখন আপনার পরিবর্তনগুলি প্রয়োগ করতে চান বা তাদের বাতিল করতে চান?",
+  "settings#unapplied-changes-prompt#apply-button": "প্রয়োগ করা",
+  "settings#unapplied-changes-prompt#discard-button": "বাতিল করা",
+  "settings#vpn-incompatible-msg": "(L2TP / IPSec মোড এর সঙ্গে কাজ করে না।)",
+  "settings#vpn-incompatible-label": "L2TP / IP সেক",
+  "settings#split-tunnel#heading": "বিভক্ত টানেল",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "আপনার দেশের মধ্যে ওয়েবসাইটগুলি  প্রক্সি করবেন না",
+  "settings#disable-timeouts#heading": "ধীর নেটওয়ার্কগুলির জন্য সময়সীমা অক্ষম করুন",
+  "settings#disable-timeouts#help-text": "যদি সক্ষম করা হয়, তবে সাইফন সার্ভারের সাথে যোগাযোগ টাইম আউট হবে না।",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "ধীর গতির নেটওয়ার্কগুলির জন্য সময়সীমা অক্ষম করুন",
+  "settings#egress-region#heading": "সাইফন সার্ভার অঞ্চল",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "যুক্তরাষ্ট্র",
+  "settings#egress-region#select-ca": "কানাডা",
+  "settings#egress-region#select-gb": "যুক্তরাজ্য",
+  "settings#egress-region#select-jp": "জাপান",
+  "settings#egress-region#select-sg": "সিঙ্গাপুর",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "নেদারল্যান্ডস",
+  "settings#egress-region#select-de": "জার্মানি",
+  "settings#egress-region#select-in": "ভারত",
+  "settings#egress-region#select-es": "স্পেন",
+  "settings#egress-region#select-hk": "হংকং",
+  "settings#egress-region#select-at": "অস্ট্রিয়া",
+  "settings#egress-region#select-be": "বেলজিয়াম",
+  "settings#egress-region#select-bg": "বুলগেরিয়া",
+  "settings#egress-region#select-ch": "সুইজারল্যান্ড",
+  "settings#egress-region#select-cz": "চেক প্রজাতন্ত্র",
+  "settings#egress-region#select-dk": "ডেনমার্ক",
+  "settings#egress-region#select-fr": "ফ্রান্স",
+  "settings#egress-region#select-hu": "হাঙ্গেরি",
+  "settings#egress-region#select-it": "ইতালি",
+  "settings#egress-region#select-no": "নরওয়ে",
+  "settings#egress-region#select-ro": "রোমানিয়া",
+  "settings#egress-region#select-se": "সুইডেন",
+  "settings#egress-region#select-pl": "পোল্যান্ড",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "একটি বৈধ/কার্যকর সাইফন সার্ভার অঞ্চল নির্বাচন করুন।",
+  "settings#egress-region#error-modal-title": "সার্ভার অঞ্চল অনুপলব্ধ",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "স্থানীয় প্রক্সি পোর্ট",
+  "settings#local-proxy-ports#leave-blank": "ছেড়ে দিন<strong>খালি</strong>স্বয়ংক্রিয় পোর্ট নির্বাচনের জন্য (প্রস্তাবিত)।",
+  "settings#local-proxy-ports#reason": "আপনি যদি আপনার কম্পিউটারে টুলগুলি ব্যবহার করেন যার সাইফনের সাথে কাজ করার জন্য ম্যানুয়াল কনফিগারেশনের প্রয়োজন হয়, তাহলে আপনি সাইফোনকে একই স্থানীয় পোর্ট নম্বরগুলিকে ধারাবাহিকভাবে ব্যবহার করতে চান।যদি আপনার পোর্ট সংখ্যা নির্দিষ্ট করার কোনও কারণ না থাকে, তবে আপনার  সাইফনকে বিরোধিতা থেকে রক্ষা করতে স্বয়ংক্রিয়ভাবে পোর্ট সংখ্যা নির্বাচন করতে দেওয়া উচিত।",
+  "settings#local-proxy-ports#http-label": "এইচটিটিপি / এইচটিটিপিএস ",
+  "settings#port-value-error-msg": "1 এবং 65535 এর মধ্যে হওয়া আবশ্যক।",
+  "settings#local-proxy-ports#socks-label": "সক্স",
+  "settings#local-proxy-ports#unique-error-msg": "স্থানীয় পোর্ট একে অপরের থেকে আলাদা হতে হবে।",
+  "settings#local-proxy-ports#error-modal-title": "স্থানীয় প্রক্সি পোর্ট সংঘর্ষ",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>আপনি SOCKS প্রক্সির জন্য একটি নির্দিষ্ট স্থানীয় পোর্ট ব্যবহার করার জন্য Psiphon কনফিগার করেছেন।<br> তবে, যে পোর্ট ইতিমধ্যেই ব্যবহৃত হয় এবং তাই Psiphon এটি ব্যবহার করতে পারবে না। </p><p>অনুগ্রহ করে কনফিগার করা SOCKS প্রক্সি পোর্ট মান পরিবর্তন করুন এবং আবার চেষ্টা করুন। আমরা সুপারিশ করেছি যে আপনি মানটি স্পষ্ট করবেন যাতে সাইফোন স্বয়ংক্রিয়ভাবে একটি উপলব্ধ পোর্ট বেছে নিতে পারে।</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>আপনি SOCKS প্রক্সির জন্য একটি নির্দিষ্ট স্থানীয় পোর্ট ব্যবহার করার জন্য Psiphon কনফিগার করেছেন।<br> তবে, যে পোর্ট ইতিমধ্যেই ব্যবহৃত হয় এবং তাই Psiphon এটি ব্যবহার করতে পারবেন না। </p><p>অনুগ্রহ করে কনফিগার করা SOCKS প্রক্সি পোর্ট মান পরিবর্তন করুন এবং আবার চেষ্টা করুন। আমরা সুপারিশ করেছি যে আপনি মানটি স্পষ্ট করবেন যাতে সাইফোন স্বয়ংক্রিয়ভাবে একটি উপলব্ধ পোর্ট বেছে নিতে পারে।</p>",
+  "settings#upstream-proxy#heading": "আপস্ট্রিম প্রক্সি",
+  "settings#upstream-proxy#by-default": "আপনার কম্পিউটারে ইতিমধ্যে যে একটি প্রক্সি কনফিগার আছে, ডিফল্টভাবে সাইফন একটি টানেল স্থাপন করার সময় যে প্রক্সি ব্যবহার করবে। আপনি ব্যবহার করার জন্য একটি প্রক্সি উল্লেখ করে বা এই ধরনের \"আপস্ট্রিম প্রক্সি\" ব্যবহার করা উচিত না তা উল্লেখ করে, সে আচরণটি অগ্রাহ্য করতে পারেন।",
+  "settings#upstream-proxy#reason": "আপস্ট্রিম প্রক্সি কখনও কখনও বিদ্যালয়, বিশ্ববিদ্যালয়, বা ব্যবসার প্রয়োজন হয়। যদি আপনার নেটওয়ার্ক সরবরাহকারী আপনাকে আপস্ট্রিম প্রক্সি সেটিংস দেয়, তবে তাদের ম্যানুয়ালি সেটিংস এখানে সংযোগ করতে প্রয়োজন হতে পারে।",
+  "settings#upstream-proxy#proxy-reqs": "শুধু HTTPS / এইচটিটিপিএস সমর্থন করে এমন HTTP/ এইচটিটিপি প্রক্সিগুলি অনুমোদিত।",
+  "settings#upstream-proxy#hostname-label": "হোস্টনেম",
+  "settings#upstream-proxy#port-label": "পোর্ট",
+  "settings#upstream-proxy#username-label": "ব্যবহারকারীর নাম",
+  "settings#upstream-proxy#password-label": "পাসওয়ার্ড",
+  "settings#upstream-proxy#domain-label": "ডোমেইন",
+  "settings#upstream-proxy#skip-label": "আপস্ট্রিম প্রক্সি ব্যবহার করবেন না",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "আপস্ট্রিম প্রক্সি ত্রুটি",
+  "settings#upstream-proxy#error-modal-body-default": "সাইফোন বর্তমানে \"আপস্ট্রিম প্রক্সি\" হিসাবে আপনার সিস্টেম প্রক্সি ব্যবহার করার জন্য কনফিগার করা হয়।<br> যদিও, আমরা সেই প্রক্সির মাধ্যমে একটি সাইফন সার্ভারে সংযোগ করতে অক্ষম বলে মনে করি।<br> দয়া করে \"আপস্ট্রিম প্রক্সি ব্যবহার করবেন না\" সক্ষম করুন এবং আবার চেষ্টা করুন।",
+  "settings#upstream-proxy#error-modal-body-configured": "আপনি একটি \"\"আপস্ট্রিম প্রক্সি\" ব্যবহার করার জন্য সাইফন কনফিগার করেছেন।<br> যাইহোক, আমরা সেই প্রক্সির মাধ্যমে একটি সাইফন সার্ভারে সংযোগ করতে অক্ষম বলে মনে হচ্ছে।<br> অনুগ্রহপূর্বক সেটিংস ঠিক করুন এবং আবার চেষ্টা করুন।",
+  "settings#transport-mode#heading": "পরিবহন মোড",
+  "settings#transport-mode#check-label": "L2TP / IPSec মোড ব্যবহার করুন",
+  "settings#transport-mode#help-text": "উইন্ডোজ L2TP / IPSec ভার্চুয়াল নেটওয়ার্কিং ব্যবহার করে।এই মোড-এ আপনার সমস্ত অ্যাপ্লিকেশন টানেল হবে, কিন্তু এটি অপ্রকাশিত করা হয় না এবং তাই শক্তিশালী সেন্সরশিপ এড়ানোর ক্ষমতা নেই।অধিকাংশ ফায়ারওয়ালকে বাইপাস<strong> করার জন্য এটি</strong> সুপারিশ করা হয় না।",
+  "settings#systray-minimize#heading": "বিজ্ঞপ্তি এলাকা (সিস্টেম ট্রে) ছোট করুন",
+  "settings#systray-minimize#help-text": "যদি সক্ষম করা হয়, তবে যখন সাইফন অ্যাপ্লিকেশন উইন্ডোটি ছোট করে তখন সেটি বিজ্ঞপ্তি এলাকায় (যেটি আপনার উইন্ডোজ টাস্ক বারের ঘড়ির কাছাকাছি অবস্থিত \"সিস্টেম ট্রে\" বা \"সিস্ট্রে\" নামেও পরিচিত) লুকিয়ে রাখে।",
+  "settings#systray-minimize#reason": "নোটপ্যাডিং এলাকা (\"সিস্টেম ট্রে\") থেকে সাইফনকে ছোট করা আপনার টাস্ক বারে স্থান মুক্ত করে। এটি বিশেষভাবে সহায়ক যদি আপনি প্রায়ই দীর্ঘ সময় ধরে সাইফন চালান।",
+  "settings#systray-minimize#enable-label": "বিজ্ঞপ্তি এলাকা (সিস্টেম ট্রে) ছোট করুন",
+  "settings#applying-message": "আপনার সেটিংস প্রয়োগ করতে পুনরায় সংযোগ স্থাপন।",
+  "settings#saved-message": "সেটিংস সংরক্ষিত হয়েছে।",
+  "settings#error-modal#title": "সেটিংস ত্রুটি",
+  "settings#error-modal#body": "আপনার সেটিংস মানের মধ্যে ত্রুটি আছে। এগিয়ে যাওয়ার আগে তাদের সংশোধন করুন।",
+  "feedback#top_content_title": "আমাদের আপনার প্রতিক্রিয়া জানান",
+  "feedback#top_para_2": "সর্বশেষ সংস্করণটি ডাউনলোড করে অনেক সমস্যার সমাধান করা যেতে পারে।<a class=\"NewVersionURL\" href=\"#\">আপনি এখানে ক্লিক করে সর্বশেষ সংস্করণটি ডাউনলোড করতে পারেন</a>,অথবা আপনি একটি ইমেল পাঠাতে পারেন<a class=\"NewVersionEmail\" href=\"#\"></a>।",
+  "feedback#top_para_3": "আপনি আমাদের <a class=\"FaqURL\" href=\"#\">প্রায়শই জিজ্ঞাসিত প্রশ্নাবলীগুলির মধ্যে অনেক সাধারণ সমস্যার সমাধান খুঁজে পেতে পারেন</a>",
+  "feedback#smiley_happy": "সাইফন যেভাবে চান তা দিয়ে সংযোগ করে এবং সঞ্চালন করে।",
+  "feedback#smiley_sad": "সাইফন প্রায়ই সংযোগ স্থাপন করতে ব্যর্থ হয় বা যথেষ্ট পরিমাণে সঞ্চালন করে না।",
+  "feedback#text_feedback_prompt": "দয়া করে এখানে আপনার মন্তব্য লিখুন :",
+  "feedback#text_feedback_email_prompt": "আপনি যদি আমাদের উত্তর চান,তাহলে দয়া করে আপনার ইমেল ঠিকানা লিখুন :",
+  "feedback#diagnostic_check": "ডায়গনিস্টিক ডেটা আপলোড করুন। দয়া করে মনে রাখবেন যে এই ডায়গনিস্টিক ডেটা আপনাকে শনাক্ত করে না, এবং এটি সাইফনকে স্বচ্ছন্দে চালানোর জন্য আমাদের সহায়তা করবে।<a class=\"DataCollectionInfoURL\" href=\"#\">আমরা যে তথ্য সংগ্রহ করি তা দেখার জন্য এখানে ক্লিক করুন।</a>",
+  "feedback#submit_button": "দাখিল করা",
+  "feedback#text_feedback_bottom_para": "যদি উপরের ফর্মটি কাজ না করে, অথবা আপনি স্ক্রিনশটগুলি পাঠাতে চান, তাহলে দয়া করে আমাদের ইমেল করুন<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca-এ </a>।",
+  "feedback#success-message": "<strong>আপনাকে ধন্যবাদ!</strong>আপনার মতামত পাঠানো হয়েছে।",
+  "logs#show-debug-label": "ডিবাগ লগ দেখান",
+  "logs#placeholder": "এখনো কোন লগ নেই",
+  "language#success-message": "<strong>হ্যালো!</strong> সাইফন এ স্বাগতম।",
+  "about#wordart-tag": "সীমানার বাহিরে",
+  "about#description": "Psiphon একটি <strong>সেন্সরশিপ প্রতারণা টুল </strong>এটি খোলা ইন্টারনেট, অতীত সেন্সর এবং ফায়ারওয়াল-এ অ্যাক্সেস দেওয়ার জন্য ডিজাইন করা হয়েছে। এটা<strong> ওপেন সোর্স </strong>এবং টরন্টো, কানাডা- এ উন্নত হয়।",
+  "about#visit-download-site": "দয়া করে ওয়েবসাইট ভিজিট করুন<strong><a class=\"NewVersionURL\" href=\"#\">একটি নতুন সংস্করণ ডাউনলোড</a></strong> করতে বা <strong><a class=\"InfoURL\" href=\"#\">সহায়তা এবং তথ্যের জন্য।</a></strong>সাইফন অ্যান্ড্রয়েড এবং উইন্ডোজ এর জন্য উপলব্ধ।",
+  "about#get-by-email": "<strong>যদি ওয়েবসাইটটি উপলব্ধ না হয় </strong>তবে আপনি একটি ইমেল পাঠিয়ে সাইফনের একটি নতুন সংস্করণ পেতে পারেন:",
+  "about#client-version": "উইন্ডোজ ক্লায়েন্ট সংস্করণের জন্য সাইফন:",
+  "general#modal-close-button": "বন্ধ করা",
+  "general#notice-modal-tech-preamble": "এখানে প্রযুক্তিগত ত্রুটি তথ্য:",
+  "notice#systemproxysettings-setproxy-error-title": "সিস্টেম প্রক্সি ত্রুটি",
+  "notice#systemproxysettings-setproxy-error-body": "<p>সাইফন সিস্টেমের প্রক্সি সেটিংস সেট করতে ব্যর্থ হয়েছে।</p><p> এটি আপনার অ্যান্টিভাইরাস সফটওয়্যারের সাথে  বিরোধের কারণ হতে পারে।স্থানীয় সাইফন প্রক্সি ব্যবহার করার জন্য আপনাকে আপনার অ্যাপ্লিকেশন বা সিস্টেম প্রক্সি সেটিংসগুলি ম্যানুয়ালি কনফিগার করতে হতে পারে।</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "\"<% - data%>\" নামের ইন্টারনেট সংযোগের জন্য সাইফন সিস্টেমের প্রক্সি সেটিংস সেট করতে ব্যর্থ হয়েছে। এটি আপনার অ্যান্টিভাইরাস সফটওয়্যারের সাথে বিরোধের কারণে হতে পারে। স্থানীয় সাইফন প্রক্সি ব্যবহার করার জন্য আপনাকে আপনার অ্যাপ্লিকেশন বা সিস্টেম প্রক্সি সেটিংসগুলি ম্যানুয়ালি কনফিগার করতে হতে পারে।",
+  "appbackend#state-stopped-title": "সাইফন সংযোগ বিচ্ছিন্ন",
+  "appbackend#state-starting-title": "সাইফন সংযোগ করছে",
+  "appbackend#state-starting-body": "অনুগ্রহপূর্বক অপেক্ষা করুন…",
+  "appbackend#state-connected-title": "সাইফন সংযুক্ত",
+  "appbackend#state-connected-body": "আপনার সীমানার বাহিরে অন্বেষণ করুন",
+  "appbackend#state-connected-reminder-title": "সাইফন আপনাকে সংযুক্ত রেখেছে",
+  "appbackend#state-connected-reminder-body": "সাইফন বিনামূল্যে রাখুন। আমাদের পৃষ্ঠপোষক পৃষ্ঠা দেখার জন্য এখানে ক্লিক করুন!",
+  "appbackend#state-connected-reminder-body-2": "আমাদের পৃষ্ঠপোষক পৃষ্ঠাগুলি পরিদর্শন করে সাইফন বিনামূল্যে রাখুন!",
+  "appbackend#minimized-to-systray-title": "সাইফন বিজ্ঞপ্তি এলাকা থেকে ছোট করা হয়েছে",
+  "appbackend#minimized-to-systray-body": "অ্যাপ্লিকেশন পুনরুদ্ধার- এ আইকনে ক্লিক করুন",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 ঘন্টা",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "সৌজন্যে"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["bo"].translation = {
+  "banner#long-connecting": "<strong>ཡིན་གྱི་མ་རེད། !</strong> ཁྱེད་རང་མཐུད་པའི་སྐབས་ལ་དཀའ་ངལ་འདུག!<br>\nསཡི་ཕོན་ཐོན་རིམ་གསར་ཤོས་ཕབ་ལེན་དྲྭ་ཚིགས་ནས <a class=\"NewVersionURL\" href=\"#\">ཕབ་ལེན་བྱེད།</a>\nཡང་ན་ང་ཚོར་གློག་འཕྲིན་གཏོང་སྟེ་ཕབ་ལེན་བྱེད། <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "མཐུད་བཞིན་པ།",
+  "nav#connection#connected": "མཐུད་ཚར་སོང་།",
+  "nav#connection#stopping": "མཐུད་མཚམས་བཞག་བཞིན་པ།",
+  "nav#connection#stopped": "མཐུད་མཚམས་བཞག",
+  "nav#settings": "སྒྲིག་བཀོད།",
+  "nav#feedback": "དགོངས་འཆར།",
+  "nav#logs": "ཉིན་ཐོ།",
+  "nav#about": "སྐོར།",
+  "connection#starting-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་བཞིན་པ།</span>…",
+  "connection#stop-btn": "མཚམས་འཇོག",
+  "connection#connected-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་བཞིན་པ།</span>",
+  "connection#disconnect-btn": "མཐུད་མཚམས་བཞག",
+  "connection#stopping-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་མཚམས་བཞག་བཞིན་པ།</span>…",
+  "connection#wait-btn": "ཏོག་ཙམ་འགུགས་རོགས།...",
+  "connection#stopped-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་མཚམས་བཞག་བཞིན་པ།</span>…",
+  "connection#connect-btn": "མཐུད།",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>ནོར་སྐྱོན།</strong>ནོར་སྐྱོན་ཤོར་བ་རྣམས་མདུན་བསྐྱོད་མ་བྱས་གོང་དུ་བཅོས་རོགས་གནང་།",
+  "settings#reset-button": "བསྐྱར་དུ་སྒྲིག་སྟེ་རང་སོར་བཞག",
+  "settings#apply-button": "བསྒྱུར་བཅོས་ལག་བསྟར།",
+  "settings#unapplied-changes-prompt#title": "སྒྲིག་བཀོད་བསྒྱུར་བཅོས།",
+  "settings#unapplied-changes-prompt#body": "ཁྱེད་རང་གིས་སྒྲིག་བཀོད་ནང་ལ་བསྒྱུར་བ་བཏང་འདུག འོན་ཀྱང་ཁྱེད་རང་གིས་ལག་བསྟར་མཐེབ་གཞོངས་སྣོན་མིན་འདུག<br><br>ཁྱེད་རང་བསྒྱུར་བ་བཏང་བ་དེ་བེད་སྤྱོད་བཏང་འདོད་ཡོད་དམ་ཡང་ན་དོར་གྱི་ཡིན་ནམ།",
+  "settings#unapplied-changes-prompt#apply-button": "ལག་བསྟར།",
+  "settings#unapplied-changes-prompt#discard-button": "དོར་བ།",
+  "settings#vpn-incompatible-msg": "( L2TP/IPSec མཉམ་དུ་ལས་ཀ་བྱེད་མི་ཐུབ།)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "ཡུར་བ་ཁ་གྱེས་པ།",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "དྲྭ་རྒྱ་ངོ་ཚབ་འདི་སོ་སོའི་ལུང་པའི་ནང་ལ་མ་བཟོས།",
+  "settings#disable-timeouts#heading": "དྲྭ་རྒྱ་དལ་པོ་ཡོད་ཚེ་དུས་རྫོགས་མེད་པ་བཟོས",
+  "settings#disable-timeouts#help-text": "གལ་ཏེ་ཡོད་ན། སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ཁང་དང་འབྲེལ་མོལ་གྱི་དུས་ཚོད་རྫོགས་རྒྱུ་མེད།",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "དྲྭ་རྒྱ་དལ་པོ་ཡོད་ཚེ་དུས་རྫོགས་མེད་པ་བཟོས།",
+  "settings#egress-region#heading": "སཡི་ཕོན་ས་ཁུལ་ཞབས་ཞུ་འཕྲུལ་ཆས་",
+  "settings#egress-region#select-best-performance": "ནུས་པ་བཟང་ཤོས།",
+  "settings#egress-region#select-us": "ཨ་རི།",
+  "settings#egress-region#select-ca": "ཀེ་ན་ཌ།",
+  "settings#egress-region#select-gb": "དབྱིན་ཡུལ།",
+  "settings#egress-region#select-jp": "ཉི་ཧོང་།",
+  "settings#egress-region#select-sg": "སིངྒ་པུར།",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "ནེ་ཐར་ལེཌ།",
+  "settings#egress-region#select-de": "ཇར་མ་ནི།",
+  "settings#egress-region#select-in": "རྒྱ་གར།",
+  "settings#egress-region#select-es": "སི་པན།",
+  "settings#egress-region#select-hk": "ཧོང་ཀོང་།",
+  "settings#egress-region#select-at": "ཨོས་ཀྲི་ཡ།",
+  "settings#egress-region#select-be": "བྷེལ་ཇེམ།",
+  "settings#egress-region#select-bg": "བྷེལ་གེ་རེ་ཡ།",
+  "settings#egress-region#select-ch": "སུད་སི།",
+  "settings#egress-region#select-cz": "ཅེཀ་རི་པཱ་ལིཀ",
+  "settings#egress-region#select-dk": "ཌེན་མཀ།",
+  "settings#egress-region#select-fr": "ཕཱ་རན་སི།",
+  "settings#egress-region#select-hu": "ཧང་ཀ་རི།",
+  "settings#egress-region#select-it": "ཨི་ཀྲ་ལི།",
+  "settings#egress-region#select-no": "ནོར་ཝེ།",
+  "settings#egress-region#select-ro": "རོ་མ་ནི་ཡ།",
+  "settings#egress-region#select-se": "སི་ཝི་ཌན།",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "སཡི་ཕོན་ཁུངས་ལྡན་ས་གནས་ཞབས་ཞུ་འཕྲུལ་ཆས་གདམ་ག",
+  "settings#egress-region#error-modal-title": "ས་གནས་ཞབས་ཞུ་འཕྲུལ་ཆས་རྙེད་མ་སོང་།",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "ངོ་ཚབ་བསྟི་གནས་མཐུད་སྒོ།",
+  "settings#local-proxy-ports#leave-blank": "བཞག <strong>སྟོང་པ། </strong> རང་འགུལ་གྱི་མཐུད་ཁ་གདམ་ག་ (ངོ་སྤྲོད།)",
+  "settings#local-proxy-ports#reason": "གལ་ཏེ་ཁྱེད་རང་གི་གློག་ཀླད་སྒང་ལ་་སཡི་ཕོན་དང་མཉམ་དུ་ལས་ཀ་བྱེད་ཐུབ་པའི་ཆེད་དུ་མཛུབ་འདེབས་སྒྲིག་བཀོད་བྱེད་དགོས་ན། སཡི་ཕོན་གྱིས་ས་ཁུལ་མཐུད་སྒོ་ཨང་གྲངས་གཅིག་པ་ཞིག་ག་དུས་ཡིན་རུང་བེད་སྤྱོད་བྱེད་དགོས། གལ་ཏེ་ཁྱེད་རང་ལ་མཐུད་སྒོའི་ཨང་གྲངས་་དམིགས་སུ་བཀར་ནས་སྟོན་ཐུབ་པའི་རྒྱུ་མཚན་མ་མཐོང་ན། ཁྱེད་རང་གིས་སཡི་ཕོན་རང་འགུལ་ངང་ནས་འདེམས་བཅུག་པའི་ཆོག་མཆན་སྤྲད་ནས་དཀའ་ངལ་སེལ་བར་ཕན་ཐོག་བྱེད་ཀྱི་རེད།",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "ངེས་པར་དུ་1 ནས་ 65535བར་དུ་དགོས།",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "བསྟི་གནས་མཐུད་སྒོ་རྣམས་ཕན་ཚུན་མི་འདྲ་ངེས་པར་དུ་དགོས།",
+  "settings#local-proxy-ports#error-modal-title": "བསྟི་གནས་ངོ་ཚབ་མཐུད་སྒོར་འགལ་ཟླ།",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nཁྱེད་རང་གིས་སཡི་ཕོན་ལ་HTTP ངོ་ཚབ་ཀྱི་ཆེད་དུ་བསྟི་གནས་ངོ་ཚབ་མཐུད་སྒོ་བེད་སྤྱོད་བྱེད་རྒྱུར་སྒྲིག་བཀོད་བྱས་འདུག<br>.\nཡིན་ནའང་མཐུད་སྒོ་དེ་ད་ལྟ་གཞན་ཞིག་གིས་བེད་སྤྱོད་གཏོང་བཞིན་པ་ཡིན་སྟབས་སཡི་ཕོན་གྱིས་བེད་སྤྱོད་བྱེད་མི་ཐུབ།\n</p>\n<p>\nསྒྲིག་བཀོད་བྱས་པའི་HTTP ངོ་ཚབ་མཐུད་སྒོ་བརྗེས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གཅིག་གནང་རོགས། ང་ཚོའི་རེ་བ་་ལ་ཁྱེད་རང་གིས་མཐུད་སྒོ་དེ་གཙང་མ་བཟོས་ཏེ་སཡི་ཕོན་གྱིས་རང་འགུལ་ངང་ནས་མཐུད་སྒོ་གཞན་ཞིག་འདེམས་ཐུབ།\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nཁྱེད་རང་གིས་སཡི་ཕོན་སྒྲིག་བཀོད་བྱད་ནས་་SOCKS ངོ་ཚབ་བསྟི་གནས་མཐུད་སྒོ་བེད་སྤྱོད་བྱེ་བྲག་པ་བེད་སྤྱོད་བྱེད་ཆེད་དུ་ཡིན་<br>\nཡིན་ནའང་མཐུད་སྒོ་དེ་ད་ལྟ་བེད་སྤྱོད་གཏོང་བཞིན་པས་སཡི་ཕོན་གྱིས་བེད་སྤྱོད་བཏང་མི་ཐུབ།\n</p>\n<p>\nམཁྱེན་རྟོགས་ཀྱི་སླད་དུ་སྒྲིག་བཀོད་བྱས་པའིSOCKS ངོ་ཚབ་མཐུད་སྒོ་བརྗེས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གཅིག་གནང་རོགས། ང་ཚོའི་རེ་བ་་ལ་ཁྱེད་རང་གིས་མཐུད་སྒོ་དེ་གཙང་མ་བཟོས་ཏེ་སཡི་ཕོན་གྱིས་རང་འགུལ་ངང་ནས་མཐུད་སྒོ་གཞན་ཞིག་འདེམས་ཐུབ།.\n</p>",
+  "settings#upstream-proxy#heading": "ངོ་ཚབ་ནང་འཇུག",
+  "settings#upstream-proxy#by-default": "གལ་ཏེ་ཁྱེད་རང་གི་གློག་ཀླད་འདི་ལ་ངོ་ཚབ་སྒྲིག་བཀོད་བྱེད་ཚར་ཡོད་ན། ཡུར་བ་གསར་འཛུགས་བྱས་པའི་ཚེ་སཡི་ཕོན་གྱིས་རང་སོར་བཞག་པའི་ཐོག་ལ་ངོ་ཚབ་བེད་སྤྱོད་བྱེད་ཀྱི་རེད། ཁྱེད་རང་གིས་སྤྱོད་ཚུལ་འདི་ལ་སྐྱར་དུ་འཇུག་ཏེ་མིང་ངོ་ཚབ་བྱེ་བྲག་པ་ཞིག་བེད་སྤྱོད་བཏང་བའམ།  ཡང་ན་\"ངོ་ཚབ་ནང་བཅུག\"་འདི་འདྲ་ཞིག་ངེས་པར་དུ་སྤྱོད་དགོས་ཞེས་མིང་སྨོས་བྱེད་དགོས།",
+  "settings#upstream-proxy#reason": "ངོ་ཚབ་ནང་བཅུག་རྣམས་སྐབས་རེ་སློབ་གྲྭ་ཁག་དང་། མཐོ་སློབ། ཡང་ན་ཚོང་འབྲེལ་སོགས་ལ་དགོས་མཁོ་ཡོད། གལ་ཏེ་ཁྱེད་རང་གི་དྲྭ་རྒྱ་ཞབས་ཞུ་ཁང་གིས་རང་ལ་ངོ་ཚབ་ནང་བཅུག་སྒྲིག་བཀོད་སྤྲད་པ་ན་འདིར་མཐུད་ཐུབ་པའི་ཆེད་དུ་མཛུབ་འདེམས་སྒྲིག་བཀོད་བྱེད་དགོས་ཀྱི་རེད།",
+  "settings#upstream-proxy#proxy-reqs": "HTTPངོ་ཚབ་ཀྱིས་ HTTPS ལ་རྒྱབ་སྐྱོར་ངོས་ལེན་ཡོད།",
+  "settings#upstream-proxy#hostname-label": "དོ་བདག་གི་མིང་།",
+  "settings#upstream-proxy#port-label": "མཐུད་སྒོ།",
+  "settings#upstream-proxy#username-label": "སྤྱོད་མིང་།",
+  "settings#upstream-proxy#password-label": "གསང་ཨང་།",
+  "settings#upstream-proxy#domain-label": "དྲྭ་རྒྱའི་ཁ་བྱང་།",
+  "settings#upstream-proxy#skip-label": "ངོ་ཚབ་ནང་འཇུག་བེད་སྤྱོད་མ་བྱས།",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "ངོ་ཚབ་ནང་འཇུག་ནོར་སྐྱོན།",
+  "settings#upstream-proxy#error-modal-body-default": "གནས་སྐབས་རིང་ལ་སཡི་ཕོན་ནས་ཁྱེད་རང་གི་ངོ་ཚབ་འགྲོ་ལུགས་དེ་བཞིན་དེའི་\"ནང་འཇུག་ངོ་ཚབ་\"ལ་བཀོད་སྒྲིག་བྱས་ཡོད<br>\nཡིན་ནའང་ང་ཚོས་ངོ་ཚབ་དེ་རྒྱུད་དེ་སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ལ་མཐུད་ཐུབ་ཀྱི་མིན་འདུག<br>\n\"ནང་འཇུག་ངོ་ཚབ་བེད་སྤྱོད་མ་བྱེད་\" འདེམས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གནང་རོགས།",
+  "settings#upstream-proxy#error-modal-body-configured": "ཁྱེད་རང་གིས་སཡི་ཕོན་ལ་\"ནང་འཇུག་ངོ་ཚབ་\" བེད་སྤྱོད་བྱེད་རྒྱུར་སྒྲིག་བཀོད་བྱས་འདུག<br>\nཡིན་ནའང་ང་ཚོས་ངོ་ཚབ་དེ་རྒྱུད་དེ་སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ལ་མཐུད་ཐུབ་ཀྱི་མིན་འདུག<br>\nསྒྲིག་བཀོད་ལ་བཟོ་བཅོས་རྒྱབ་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གནང་རོགས།",
+  "settings#transport-mode#heading": "འོར་འདྲེན་བྱེད་ཚུལ།",
+  "settings#transport-mode#check-label": " L2TP/IPSec བེད་སྤྱོད་བྱེད་ཚུལ།",
+  "settings#transport-mode#help-text": "ཝིན་ཌོ་ནང་L2TP/IPSec རྟོག་བཟོའི་དྲྭ་རྒྱ་བེད་སྤྱོད་བྱེད།་ འདིས་ཁྱེད་རང་གི་མཉེན་ཆས་ཚང་མ་ཡུར་བའི་ནང་བཅུག་གི་རེད། ཡིན་ནའི་དེས་གནས་ཚུལ་དེ་དག་སྦས་ཀྱི་མེད་ཅིང་ཉེན་གཡོལ་གྱི་ནུས་པའང་ཤུགས་ཆེན་པོ་མེད། འདི་ནི་ <strong>མེ་གྱང་བརྒལ་ནས་འགྲོ་ཐུབ་པའི་ཆེད་དུ་</strong> ང་ཚོས་ངོས་སྦྱོར་བྱེད་ཀྱི་མེད།",
+  "settings#systray-minimize#heading": "བརྡ་ཐོ་གནས་ས་སྟིམ་ (System Tray)",
+  "settings#systray-minimize#help-text": "གལ་ཏེ་འདེམས་ན། སཡི་ཕྷོན་མཉེན་ཆས་སྟིམ་སྐབས་ཝིན་ཌོ་ཡིས་བརྡོ་ཐོ་གནས་ས་སྦས་ཀྱི་ཡོད་ལ། (འདི་ལ་མིང་གཞན་“system tray” or “systray”ཡང་ཟེར་ཞིང་དེ་ནི་དྲྭ་ཤེལ་སྒང་གི་ལས་འགན་ཚན་བྱང་གི་ཆུ་ཚོད་གི་འགྲམ་ལ་ཡོད།)",
+  "settings#systray-minimize#reason": "སཡི་ཕོན་འདི་ཆུང་དུ་བཏང་ནས་་བརྡ་ཐོ་གནས་སར་“system tray”་བཀོད་ནས་ལས་འགན་ཚན་བྱང་གི་ས་མིག་སྟོང་པ་བཟོས་། འདིས་ཁྱེད་རང་ལ་སཡི་ཕོན་མཉེན་ཆས་དུས་ཡུན་རིང་པོའི་བར་དུ་འཁོར་སྐྱོད་བྱེད་པ་ལ་དམིགས་བསལ་གྱི་ཕན་ཐོག་ཡོད།",
+  "settings#systray-minimize#enable-label": "བརྡ་ཁྱབ་གནས་ས་ཆུང་དུ་གཏོང་། ",
+  "settings#applying-message": "ཁྱེད་རང་གིས་སྒྲིག་བཀོད་བྱས་པ་འདི་ཡང་སྐྱར་མཐུད་བཞིན་ཡོད།",
+  "settings#saved-message": "སྒྲིག་བཀོད་ཉར་ཚགས།",
+  "settings#error-modal#title": "སྒྲིག་བཀོད་ནོར་བ།",
+  "settings#error-modal#body": "ཁྱེད་རང་གི་སྒྲིག་བཀོད་ནང་ལ་ནོར་སྐྱོན་ཤོར་འདུག རྒྱུན་སྐྱོང་མ་གནང་གོང་ལ་བསྒྱུར་བ་གཏོང་རོགས་གནང་།",
+  "feedback#top_content_title": "སྐུ་ཉིད་ནས་ང་ཚོར་དགོངས་འཆར་གནང་རོགས།",
+  "feedback#top_para_2": "མཉེན་ཆས་ཐོན་གསར་ཤོས་དེ་ཕབ་ལེན་བྱས་པ་ལ་བརྟེན་ནས་དཀའ་ངལ་མང་དག་ཅིག་བཅོས་ཐུབ་།  ཁྱེད་རང་<a class=\"NewVersionURL\" href=\"#\">འདིར་སྣོན་ནས་ཐོན་གསར་ཤོས་འདི་ཕབ་ལེན་བྱེད།</a>ཡང་ན་ཁྱེད་རང་གིས་ཁ་བྱང་འདིའི་སྒང་ལ་གློག་འཕྲིན་གཏོང་།<a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "feedback#top_para_3": "ང་ཚོས་ཁྱེད་རང་ལ་<a class=\"FaqURL\" href=\"#\">ཡང་སེ་དྲིས་པའི་དྲི་བ་</a>ཁག་དང་ཐུན་མོང་ལ་ཕྲད་བཞིན་པའི་དཀའ་ངལ་རྣམས་སེལ་བའི་ཐབས་ལམ་རྣམས་རྙེད་ཐུབ། ",
+  "feedback#smiley_happy": "ང་རང་གི་འདོད་མོས་ལྟར་སཡི་ཕོན་བེད་སྤྱོད་བྱེད་ཐུབ་ཀྱི་འདུག",
+  "feedback#smiley_sad": "སཡི་ཕོན་ཡང་སེ་མཐུད་མི་ཐུབ་པ་དང་ལས་ཀ་ཡག་པོ་ཞེ་དྲག་བྱེད་ཐུབ་ཀྱི་མིན་འདུག",
+  "feedback#text_feedback_prompt": "ཁྱེད་རང་གི་མཆན་འདིར་བཞག་རོགས།",
+  "feedback#text_feedback_email_prompt": "གལ་ཏེ་ང་ཚོས་ཁྱེད་རང་ལ་ལན་འདེབས་བྱེད་དགོས་ན་ཁྱེད་རང་གི་གློག་འཕྲིན་ཁ་བྱང་བཅུག་རོགས་གནང་།",
+  "feedback#diagnostic_check": "བརྟག་དཔྱད་བྱས་པའི་ཡིག་ཆ་རྣམས་ནང་འཇུག་བྱེད། མཁྱེན་རྟོགས་ཀྱི་སླད་དུ་བརྟག་དཔྱད་བྱས་པའི་ཡིག་ཆ་ཁག་གིས་རང་ངོས་འཛིན་ཐུབ་ཀྱི་མེད། འདིས་སཡི་ཕོན་ལས་སླ་པོའི་ངང་ནས་འཁོར་སྐྱོད་བྱེད་ཐུབ་པར་ཕན་ཐོག་ཡོང་གི་ཡོད།  <a class=\"DataCollectionInfoURL\" href=\"#\">ང་ཚོས་ཡིག་ཆ་གང་མཁོ་བསྡུ་བྱས་ཡོད་མེད་གཟིགས་ན་འདིར་སྣོན།</a>",
+  "feedback#submit_button": "ཐོ་བཀོད་བྱས་པ།",
+  "feedback#text_feedback_bottom_para": "གོང་གི་འགེངས་ཤོག་འདི་ལས་ཀ་བྱེད་ཀྱི་མེད་པ་དང་། ཡང་ན་ཁྱེད་རང་གིས་ང་ཚོར་པར་ལེན་བྱེད་འདོད་ན་གཤམ་གྱི་གློག་འཕྲིན་ལ་ཡིག་ལན་སྐུར་རོགས།<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>ཐུགས་རྗེ་ཆེ། </strong> ཁྱེད་རང་གི་དགོངས་འཆར་སྐུར་ཟིན།",
+  "logs#show-debug-label": "སྐྱོན་སེལ་གྱི་ཉིན་ཐོ་སྟོན།",
+  "logs#placeholder": "ད་ལྟ་ཉིན་ཐོ་མིན་འདུག",
+  "language#success-message": "<strong>འཚམས་འདྲི་ཞུ།</strong> སཡི་ཕོན་ལ་ཕེབས་པར་དགའ་བསུ་ཞུ།",
+  "about#wordart-tag": "བརྒལ་མཚམས་མེད་པ།",
+  "about#description": "སཡི་ཕོན་ནི་ <strong>དམ་བསྒྲགས་ཅན་གྱི་ཉེན་གཡོལ་ལག་ཆ་ཞིག་ཡིན། </strong> — བཟོ་བཀོད་འདིས་དྲྭ་རྒྱ་རང་དབང་གིས་ཐོག་ནས་ལྟ་ཐུབ་པ་མ་ཟད་ཞ་སྔར་གྱི་དམ་བསྒྲགས་དང་མེ་གྱང་སོགས་བརྒལ་ནས་ལྟ་ཐུབ། འདི་ནི་<strong>ཕྱི་གསལ་ནང་གསལ་གྱི་ཨང་རྟགས་</strong> དང་ཁེ་ན་ཌའི་རྒྱལ་ས་ཊོ་རོན་ཌོ་ནས་བཟོས་པ་རེད།",
+  "about#visit-download-site": "དྲྭ་རྒྱར་གཟིགས་ཞིབ་ <strong><a class=\"NewVersionURL\" href=\"#\">དང་ཐོན་གསར་པ་ཕབ་ལེན་གནང་རོགས། </a></strong> ཡང་ན། <strong><a class=\"InfoURL\" href=\"#\">འདི་ནས་རོགས་རམ་དང་གནས་ཚུལ་ཤེས་ཐུབ་</a></strong> སཡི་ཕོན་ནི་ཨེན་ཀྲོཌ་དང་ཝིན་ཌོ་གཉིས་ཀར་ཡོད། ",
+  "about#get-by-email": "<strong>གལ་ཏེ་དྲྭ་ཚིགས་འདི་བལྟ་མ་ཐུབ་ན་</strong>ཁྱེད་རང་གིས་འདིར་གློག་་འཕྲིན་བཏང་ནས་སཡི་ཕོན་ཐོན་གསར་པ་འདི་རགས་ཐུབ།:",
+  "about#client-version": "ཝིན་ཌོ་སྒེར་སྤྱོད་གྱི་ཐོན་རིམ་ཆེད་དུ་སཡི་ཕོན་:",
+  "general#modal-close-button": "སྒོ་རྒྱབ།",
+  "general#notice-modal-tech-preamble": "འདིར་འཕྲུལ་ཆས་དང་འབྲེལ་བའི་དཀའ་ངལ་ཕྲད་འདུག:",
+  "notice#systemproxysettings-setproxy-error-title": "ངོ་ཚབ་འགྲོ་ལུགས་ནོར་བ།",
+  "notice#systemproxysettings-setproxy-error-body": "<p>སཡི་ཕོན་གྱི་ལམ་ལུགས་ངོ་ཚབ་སྒྲིག་བཀོད་དེ་སྒྲིག་ཐུབ་མ་སོང་།</p>\n<p>དེ་ནི་ཁྱེད་རང་གི་དྲྭ་འབུ་འགོག་བྱེད་ཀྱི་མཉེན་ཆས་ལ་འགལ་ཟླ་འབྱུང་བའི་རྐྱེན་གྱིས་མིན་ནམ་སྙམ། དེར་ཁྱེད་རང་གི་མཉེན་ཆས་འདི་མཛུབ་འདེམས་སྒྲིག་དགོས་པ་དང་། ཡང་ན་ལམ་ལུགས་སྒྲིག་བཀོད་བེད་སྤྱོད་བྱས་ནས་བསྟི་གནས་སཡི་ཕོན་ངོ་ཚབ་བེད་སྤོྱོད་བྱེད།</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "སཡི་ཕོན་གྱིས་དྲྭ་རྒྱ་མཐུད་མིང་“<%- data %>”འདིར་འགྲོ་ལུགས་ངོ་ཚབ་སྒྲིག་བཀོད་བྱེད་ཐུབ་མ་སོང་། དེ་ནི་ཁྱེད་རང་གི་དྲྭ་འབུ་འགོག་བྱེད་ཀྱི་མཉེན་ཆས་དང་འགལ་ཟླ་ཡོད་པའི་རྐྱེན་གྱིས་ཡིན་སྲིད། དེར་ཁྱེད་རང་གི་མཉེན་ཆས་འདི་མཛུབ་འདེམས་སྒྲིག་དགོས་པ་དང་། ཡང་ན་ལམ་ལུགས་སྒྲིག་བཀོད་བེད་སྤྱོད་བྱས་ནས་བསྟི་གནས་སཡི་ཕོན་ངོ་ཚབ་བེད་སྤོྱོད་བྱེད།",
+  "appbackend#state-stopped-title": "སཡི་ཕོན་མཐུད་ཁ་ཆད་སོང་།",
+  "appbackend#state-starting-title": "སཡི་ཕོན་མཐུད་བཞིན་པ།",
+  "appbackend#state-starting-body": "ཏོག་ཙམ་འགུགས་རོགས།",
+  "appbackend#state-connected-title": "སཡི་ཕོན་མཐུད་ཡོད།",
+  "appbackend#state-connected-body": "རང་གི་བརྒལ་མཚམས་ནས་བརྒལ་ཏེ་བསྐྱོད།",
+  "appbackend#state-connected-reminder-title": "སཡི་ཕོན་མཉེས་ཆས་ཀྱིས་ཁྱེད་རང་མཐུད་ཡོད།",
+  "appbackend#state-connected-reminder-body": "སཡི་ཕོན་རིན་མེད་བཞག་རོགས་གནང་། འདིར་སྣོན་ནས་ང་ཚོའི་སྦྱིན་བདག་ཁག་གི་ཐོ་གཞུང་ལ་གཟིགས་།",
+  "appbackend#state-connected-reminder-body-2": "ང་ཚོའི་སྦྱིན་བདག་ཁག་གི་དྲྭ་ངོས་གཟིགས་ན་སཡི་ཕོན་དྲ་ཚིགས་རིན་མེད་ཐོག་བཞག་རོགས།!",
+  "appbackend#minimized-to-systray-title": "སཡི་ཕོན་དྲྭ་ཚིགས་འདི་བརྡ་གཏོང་སའི་གནས་སུ་ཆུང་དུ་བཏང་ནས་བཞག་ཡོད།",
+  "appbackend#minimized-to-systray-body": "འདྲ་རྟགས་འདི་ལ་སྣོན་ནས་མཉེན་ཆས་སྐྱར་འཇུག་བྱེད།",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "ཆུ་ཚོད་༡",
+  "psicash#1-day": "ཉིན་༡",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "སྦྱིན་བདག་བྱེད་མཁན།"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["de"].translation = {
+  "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Verbinde",
+  "nav#connection#connected": "Verbunden",
+  "nav#connection#stopping": "Trenne",
+  "nav#connection#stopped": "Getrennt",
+  "nav#settings": "Einstellungen",
+  "nav#feedback": "Rückmeldung",
+  "nav#logs": "Protokolle",
+  "nav#about": "Über",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">verbindet</span> sich…",
+  "connection#stop-btn": "Stopp",
+  "connection#connected-msg": "Psiphon ist <span class=\"state-word\">verbunden</span>",
+  "connection#disconnect-btn": "Trennen",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">trennt</span> sich…",
+  "connection#wait-btn": "Bitte warten…",
+  "connection#stopped-msg": "Psiphon ist <span class=\"state-word\">getrennt</span>",
+  "connection#connect-btn": "Verbinden",
+  "connection#egress-region-combo-label": "Serverregion auswählen",
+  "settings#error-alert": "<strong>Fehler!</strong> Bitte korrigieren Sie falsche Werte, bevor Sie fortfahren.",
+  "settings#reset-button": "Auf Standardeinstellung zurücksetzen",
+  "settings#apply-button": "Änderungen anwenden",
+  "settings#unapplied-changes-prompt#title": "Einstellungen geändert.",
+  "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
+  "settings#unapplied-changes-prompt#apply-button": "Anwenden",
+  "settings#unapplied-changes-prompt#discard-button": "Verwerfen",
+  "settings#vpn-incompatible-msg": "(Funktioniert nicht mit dem L2TP/IPSec-Modus.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Tunnel aufteilen",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Webseiten innerhalb Ihres Landes nicht über Proxy leiten",
+  "settings#disable-timeouts#heading": "Zeitüberschreitungen für langsame Netzwerke deaktivieren",
+  "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Zeitüberschreitungen für langsame Netzwerke deaktivieren",
+  "settings#egress-region#heading": "Psiphon-Serverregion",
+  "settings#egress-region#select-best-performance": "Beste Leistung",
+  "settings#egress-region#select-us": "Vereinigte Staaten",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Vereinigtes Königreich",
+  "settings#egress-region#select-jp": "Japan",
+  "settings#egress-region#select-sg": "Singapur",
+  "settings#egress-region#select-sk": "Slowakei",
+  "settings#egress-region#select-nl": "Niederlande",
+  "settings#egress-region#select-de": "Deutschland",
+  "settings#egress-region#select-in": "Indien",
+  "settings#egress-region#select-es": "Spanien",
+  "settings#egress-region#select-hk": "Hongkong",
+  "settings#egress-region#select-at": "Österreich",
+  "settings#egress-region#select-be": "Belgien",
+  "settings#egress-region#select-bg": "Bulgarien",
+  "settings#egress-region#select-ch": "Schweiz",
+  "settings#egress-region#select-cz": "Tschechische Republik",
+  "settings#egress-region#select-dk": "Dänemark",
+  "settings#egress-region#select-fr": "Frankreich",
+  "settings#egress-region#select-hu": "Ungarn",
+  "settings#egress-region#select-it": "Italien",
+  "settings#egress-region#select-no": "Norwegen",
+  "settings#egress-region#select-ro": "Rumänien",
+  "settings#egress-region#select-se": "Schweden",
+  "settings#egress-region#select-pl": "Polen",
+  "settings#egress-region#select-rs": "Serbien",
+  "settings#egress-region#select-au": "Australien",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Wählen Sie eine gültige Psiphon-Serverregion aus.",
+  "settings#egress-region#error-modal-title": "Serverregion nicht verfügbar",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Lokale Proxy-Ports",
+  "settings#local-proxy-ports#leave-blank": "<strong>Leer</strong> lassen für automatische Portauswahl (empfohlen).",
+  "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Muss zwischen 1 und 65535 sein.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Lokale Ports müssen voneinander verschieden sein.",
+  "settings#local-proxy-ports#error-modal-title": "Lokaler Proxy-Portkonflikt",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#upstream-proxy#heading": "Vorgeschalteter Proxy",
+  "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
+  "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
+  "settings#upstream-proxy#proxy-reqs": "Zulässig sind nur HTTP-Proxies die HTTPS unterstützen.",
+  "settings#upstream-proxy#hostname-label": "Hostname",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Benutzername",
+  "settings#upstream-proxy#password-label": "Passwort",
+  "settings#upstream-proxy#domain-label": "Domain",
+  "settings#upstream-proxy#skip-label": "Vorgeschalteten Proxy nicht verwenden",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Fehler beim vorgeschalteten Proxy",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
+  "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
+  "settings#transport-mode#heading": "Übertragungsmodus",
+  "settings#transport-mode#check-label": "L2TP/IPSec-Modus verwenden",
+  "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
+  "settings#systray-minimize#heading": "In Benachrichtigungsfeld (Infobereich) minimieren",
+  "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
+  "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
+  "settings#systray-minimize#enable-label": "In das Benachrichtigungsfeld (Infobereich) minimieren",
+  "settings#applying-message": "Neuer Verbindungsaufbau, um Ihre Einstellungen anzuwenden.",
+  "settings#saved-message": "Einstellungen gespeichert.",
+  "settings#error-modal#title": "Einstellungsfehler",
+  "settings#error-modal#body": "Es gibt Fehler in Ihren Einstellungswerten. Bitte korrigieren Sie diese, bevor Sie fortfahren.",
+  "feedback#top_content_title": "Geben Sie uns Ihre Rückmeldung",
+  "feedback#top_para_2": "Viele Probleme können durch das Herunterladen der neuesten Version behoben werden. Sie können die <a class=\"NewVersionURL\" href=\"#\">neueste Version herunterladen, wenn Sie hier klicken</a> oder eine E-Mail an <a class=\"NewVersionEmail\" href=\"#\"></a> senden.",
+  "feedback#top_para_3": "Lösungen für viele häufig auftretende Probleme finden Sie auch in unseren <a class=\"FaqURL\" href=\"#\">häufig gestellten Fragen</a>.",
+  "feedback#smiley_happy": "Psiphon verbindet sich und funktioniert wie ich es haben will.",
+  "feedback#smiley_sad": "Psiphon schlägt oft fehl oder funktioniert nicht gut genug.",
+  "feedback#text_feedback_prompt": "Bitte geben Sie Ihre Kommentare hier ein:",
+  "feedback#text_feedback_email_prompt": "Bitte geben Sie Ihre E-Mail-Adresse ein, wenn Sie möchten, dass wir Ihnen antworten:",
+  "feedback#diagnostic_check": "Diagnosedaten hochladen. Bitte beachten Sie, dass diese Diagnosedaten Sie nicht identifizieren und sie werden uns dabei helfen, Psiphon reibungslos am Laufen zu halten. <a class=\"DataCollectionInfoURL\" href=\"#\">Klicken Sie hier, um zu sehen, welche Daten wir erheben.</a>",
+  "feedback#submit_button": "Absenden",
+  "feedback#text_feedback_bottom_para": "Schreiben Sie bitte eine E-Mail an <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>, wenn das Formular oben nicht funktioniert oder Sie uns Bildschirmfotos schicken möchten.",
+  "feedback#success-message": "<strong>Danke!</strong> Ihre Rückmeldung wurde gesendet.",
+  "logs#show-debug-label": "Fehlersuchprotokolle anzeigen",
+  "logs#placeholder": "Noch keine Protokolle",
+  "language#success-message": "<strong>Hallo!</strong> Willkommen bei Psiphon.",
+  "about#wordart-tag": "Jenseits von Grenzen",
+  "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
+  "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
+  "about#get-by-email": "<strong>Wenn die Webseite nicht erreichbar ist</ strong>, können Sie eine neue Version von Psiphon erhalten, indem Sie eine E-Mail senden an:",
+  "about#client-version": "Psiphon für Windows-Client-Version:",
+  "general#modal-close-button": "Schließen",
+  "general#notice-modal-tech-preamble": "Hier ist die technische Fehlerinformation:",
+  "notice#systemproxysettings-setproxy-error-title": "Systemproxyfehler",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
+  "appbackend#state-stopped-title": "Psiphon ist getrennt",
+  "appbackend#state-starting-title": "Psiphon verbindet sich",
+  "appbackend#state-starting-body": "Bitte warten…",
+  "appbackend#state-connected-title": "Psiphon ist verbunden",
+  "appbackend#state-connected-body": "Entdecken Sie jenseits Ihrer Grenzen!",
+  "appbackend#state-connected-reminder-title": "Psiphon hält Sie verbunden",
+  "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+  "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+  "appbackend#minimized-to-systray-title": "Psiphon wurde in das Benachrichtigungsfeld minimiert",
+  "appbackend#minimized-to-systray-body": "Klicken Sie auf das Symbol, um die Anwendung wiederherzustellen",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash-Serverfehler",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 Stunde",
+  "psicash#1-day": "1 Tag",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon-Verbindung erforderlich",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Gefördert durch"
+};
\ No newline at end of file
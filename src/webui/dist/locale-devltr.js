@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["devltr"].translation = {
+  "about#client-version": "[Ƥşīīƥħǿǿƞ ƒǿǿř Ẇīīƞḓǿǿẇş ƈŀīīḗḗƞŧ ṽḗḗřşīīǿǿƞ:]",
+  "about#description": "[Ƥşīīƥħǿǿƞ īīş ȧȧ <strong>ƈḗḗƞşǿǿřşħīīƥ ƈīīřƈŭŭḿṽḗḗƞŧīīǿǿƞ ŧǿǿǿǿŀ</strong> — īīŧ īīş ḓḗḗşīīɠƞḗḗḓ ŧǿǿ ɠīīṽḗḗ ȧȧƈƈḗḗşş ŧǿǿ ŧħḗḗ ǿǿƥḗḗƞ Īīƞŧḗḗřƞḗḗŧ, ƥȧȧşŧ ƈḗḗƞşǿǿřş ȧȧƞḓ ƒīīřḗḗẇȧȧŀŀş. Īīŧ īīş <strong>ǿǿƥḗḗƞ şǿǿŭŭřƈḗḗ</strong> ȧȧƞḓ ḓḗḗṽḗḗŀǿǿƥḗḗḓ īīƞ Ŧǿǿřǿǿƞŧǿǿ, Ƈȧȧƞȧȧḓȧȧ.]",
+  "about#get-by-email": "[<strong>Īīƒ ŧħḗḗ ẇḗḗƀşīīŧḗḗ īīş īīƞȧȧƈƈḗḗşşīīƀŀḗḗ</strong>, ẏǿǿŭŭ ƈȧȧƞ ɠḗḗŧ ȧȧ ƞḗḗẇ ṽḗḗřşīīǿǿƞ ǿǿƒ Ƥşīīƥħǿǿƞ ƀẏ şḗḗƞḓīīƞɠ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ:]",
+  "about#visit-download-site": "[Ƥŀḗḗȧȧşḗḗ ṽīīşīīŧ ŧħḗḗ ẇḗḗƀşīīŧḗḗ ŧǿǿ <strong><a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ ȧȧ ƞḗḗẇ ṽḗḗřşīīǿǿƞ</a></strong> ǿǿř ŧǿǿ <strong><a class=\"InfoURL\" href=\"#\">ɠḗḗŧ ħḗḗŀƥ ȧȧƞḓ īīƞƒǿǿřḿȧȧŧīīǿǿƞ</a></strong>. Ƥşīīƥħǿǿƞ īīş ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƒǿǿř Ȧȧƞḓřǿǿīīḓ ȧȧƞḓ Ẇīīƞḓǿǿẇş.]",
+  "about#wordart-tag": "[Ɓḗḗẏǿǿƞḓ Ɓǿǿřḓḗḗřş]",
+  "appbackend#disallowed-traffic-notification-body": "[Ȧȧƈŧīīṽȧȧŧḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ ŧǿǿ ŭŭƞŀǿǿƈķ ŧħḗḗ ƒŭŭŀŀ ƥǿǿŧḗḗƞŧīīȧȧŀ ǿǿƒ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ.]",
+  "appbackend#disallowed-traffic-notification-title": "[Ȧȧƥƥş ƞǿǿŧ ẇǿǿřķīīƞɠ?]",
+  "appbackend#minimized-to-systray-body": "[Ƈŀīīƈķ ŧħḗḗ īīƈǿǿƞ ŧǿǿ řḗḗşŧǿǿřḗḗ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ]",
+  "appbackend#minimized-to-systray-title": "[Ƥşīīƥħǿǿƞ ħȧȧş ƀḗḗḗḗƞ ḿīīƞīīḿīīẑḗḗḓ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ]",
+  "appbackend#os-unsupported": "[Ƥşīīƥħǿǿƞ ƞǿǿ ŀǿǿƞɠḗḗř şŭŭƥƥǿǿřŧş Ẇīīƞḓǿǿẇş ẊƤ ǿǿř Ṽīīşŧȧȧ.\nƤŀḗḗȧȧşḗḗ ṽīīşīīŧ ǿǿŭŭř ẇḗḗƀşīīŧḗḗ ƒǿǿř ḿǿǿřḗḗ īīƞƒǿǿřḿȧȧŧīīǿǿƞ.]",
+  "appbackend#state-connected-body": "[Ḗḗẋƥŀǿǿřḗḗ ƀḗḗẏǿǿƞḓ ẏǿǿŭŭř ƀǿǿřḓḗḗřş!]",
+  "appbackend#state-connected-reminder-body": "[Ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ ƒřḗḗḗḗ. Ƈŀīīƈķ ħḗḗřḗḗ ŧǿǿ ṽīīşīīŧ ǿǿŭŭř şƥǿǿƞşǿǿř ƥȧȧɠḗḗş!]",
+  "appbackend#state-connected-reminder-body-2": "[Ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ ƒřḗḗḗḗ ƀẏ ṽīīşīīŧīīƞɠ ǿǿŭŭř şƥǿǿƞşǿǿř ƥȧȧɠḗḗş!]",
+  "appbackend#state-connected-reminder-title": "[Ƥşīīƥħǿǿƞ īīş ķḗḗḗḗƥīīƞɠ ẏǿǿŭŭ ƈǿǿƞƞḗḗƈŧḗḗḓ]",
+  "appbackend#state-connected-title": "[Ƥşīīƥħǿǿƞ īīş ƈǿǿƞƞḗḗƈŧḗḗḓ]",
+  "appbackend#state-starting-body": "[Ƥŀḗḗȧȧşḗḗ ẇȧȧīīŧ…]",
+  "appbackend#state-starting-title": "[Ƥşīīƥħǿǿƞ īīş ƈǿǿƞƞḗḗƈŧīīƞɠ]",
+  "appbackend#state-stopped-title": "[Ƥşīīƥħǿǿƞ īīş ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ]",
+  "banner#long-connecting": "[<strong>Ǿǿħ ƞǿǿ!</strong> Ẏǿǿŭŭ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ħȧȧṽīīƞɠ ŧřǿǿŭŭƀŀḗḗ ƈǿǿƞƞḗḗƈŧīīƞɠ!<br>\nḒǿǿẇƞŀǿǿȧȧḓ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ ǿǿƒ Ƥşīīƥħǿǿƞ ƒřǿǿḿ ŧħḗḗ <a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ şīīŧḗḗ</a>\nǿǿř ƀẏ şḗḗƞḓīīƞɠ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ <a class=\"NewVersionEmail\" href=\"#\"></a>]",
+  "banner#sponsored-by": "[Şƥǿǿƞşǿǿřḗḗḓ ƀẏ]",
+  "connection#connect-btn": "[Ƈǿǿƞƞḗḗƈŧ]",
+  "connection#connected-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ƈǿǿƞƞḗḗƈŧḗḗḓ</span>]",
+  "connection#disconnect-btn": "[Ḓīīşƈǿǿƞƞḗḗƈŧ]",
+  "connection#egress-region-combo-label": "[Şḗḗŀḗḗƈŧ şḗḗřṽḗḗř řḗḗɠīīǿǿƞ]",
+  "connection#starting-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ƈǿǿƞƞḗḗƈŧīīƞɠ</span>…]",
+  "connection#stop-btn": "[Şŧǿǿƥ]",
+  "connection#stopped-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ</span>]",
+  "connection#stopping-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ḓīīşƈǿǿƞƞḗḗƈŧīīƞɠ</span>…]",
+  "connection#wait-btn": "[Ƥŀḗḗȧȧşḗḗ ẇȧȧīīŧ…]",
+  "feedback#diagnostic_check": "[Ŭŭƥŀǿǿȧȧḓ ḓīīȧȧɠƞǿǿşŧīīƈ ḓȧȧŧȧȧ. Ƥŀḗḗȧȧşḗḗ ƞǿǿŧḗḗ ŧħȧȧŧ ŧħīīş ḓīīȧȧɠƞǿǿşŧīīƈ ḓȧȧŧȧȧ ḓǿǿḗḗş ƞǿǿŧ īīḓḗḗƞŧīīƒẏ ẏǿǿŭŭ, ȧȧƞḓ īīŧ ẇīīŀŀ ħḗḗŀƥ ŭŭş ŧǿǿ ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ řŭŭƞƞīīƞɠ şḿǿǿǿǿŧħŀẏ. <a class=\"DataCollectionInfoURL\" href=\"#\">Ƈŀīīƈķ ħḗḗřḗḗ ŧǿǿ şḗḗḗḗ ẇħȧȧŧ ḓȧȧŧȧȧ ẇḗḗ ƈǿǿŀŀḗḗƈŧ.</a>]",
+  "feedback#smiley_happy": "[Ƥşīīƥħǿǿƞ ƈǿǿƞƞḗḗƈŧş ȧȧƞḓ ƥḗḗřƒǿǿřḿş ŧħḗḗ ẇȧȧẏ Īī ẇȧȧƞŧ īīŧ ŧǿǿ.]",
+  "feedback#smiley_sad": "[Ƥşīīƥħǿǿƞ ǿǿƒŧḗḗƞ ƒȧȧīīŀş ŧǿǿ ƈǿǿƞƞḗḗƈŧ ǿǿř ḓǿǿḗḗşƞ'ŧ ƥḗḗřƒǿǿřḿ ẇḗḗŀŀ ḗḗƞǿǿŭŭɠħ.]",
+  "feedback#submit_button": "[Şŭŭƀḿīīŧ]",
+  "feedback#success-message": "[<strong>Ŧħȧȧƞķ ẏǿǿŭŭ!</strong> Ẏǿǿŭŭř ƒḗḗḗḗḓƀȧȧƈķ ħȧȧş ƀḗḗḗḗƞ şḗḗƞŧ.]",
+  "feedback#text_feedback_bottom_para": "[Īīƒ ŧħḗḗ ȧȧƀǿǿṽḗḗ ƒǿǿřḿ īīş ƞǿǿŧ ẇǿǿřķīīƞɠ, ǿǿř ẏǿǿŭŭ ẇǿǿŭŭŀḓ ŀīīķḗḗ ŧǿǿ şḗḗƞḓ şƈřḗḗḗḗƞşħǿǿŧş, ƥŀḗḗȧȧşḗḗ ḗḗḿȧȧīīŀ ŭŭş ȧȧŧ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">ƒḗḗḗḗḓƀȧȧƈķ@ƥşīīƥħǿǿƞ.ƈȧȧ</a>.]",
+  "feedback#text_feedback_email_prompt": "[Īīƒ ẏǿǿŭŭ ẇǿǿŭŭŀḓ ŀīīķḗḗ ŭŭş ŧǿǿ řḗḗşƥǿǿƞḓ ŧǿǿ ẏǿǿŭŭ, ƥŀḗḗȧȧşḗḗ ḗḗƞŧḗḗř ẏǿǿŭŭř ḗḗḿȧȧīīŀ ȧȧḓḓřḗḗşş:]",
+  "feedback#text_feedback_prompt": "[Ƥŀḗḗȧȧşḗḗ ḗḗƞŧḗḗř ẏǿǿŭŭř ƈǿǿḿḿḗḗƞŧş ħḗḗřḗḗ:]",
+  "feedback#top_content_title": "[Ɠīīṽḗḗ Ŭŭş Ẏǿǿŭŭř Ƒḗḗḗḗḓƀȧȧƈķ]",
+  "feedback#top_para_2": "[Ḿȧȧƞẏ ƥřǿǿƀŀḗḗḿş ƈȧȧƞ ƀḗḗ ƒīīẋḗḗḓ ƀẏ ḓǿǿẇƞŀǿǿȧȧḓīīƞɠ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ. Ẏǿǿŭŭ ƈȧȧƞ <a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ ƀẏ ƈŀīīƈķīīƞɠ ħḗḗřḗḗ</a>, ǿǿř ẏǿǿŭŭ ƈȧȧƞ şḗḗƞḓ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ <a class=\"NewVersionEmail\" href=\"#\"></a>.]",
+  "feedback#top_para_3": "[Ẏǿǿŭŭ ƈȧȧƞ ȧȧŀşǿǿ ƒīīƞḓ şǿǿŀŭŭŧīīǿǿƞş ŧǿǿ ḿȧȧƞẏ ƈǿǿḿḿǿǿƞ ƥřǿǿƀŀḗḗḿş īīƞ ǿǿŭŭř <a class=\"FaqURL\" href=\"#\">Ƒřḗḗɋŭŭḗḗƞŧŀẏ Ȧȧşķḗḗḓ Ɋŭŭḗḗşŧīīǿǿƞş</a>.]",
+  "general#modal-close-button": "[Ƈŀǿǿşḗḗ]",
+  "general#notice-modal-tech-preamble": "[Ħḗḗřḗḗ īīş ŧħḗḗ ŧḗḗƈħƞīīƈȧȧŀ ḗḗřřǿǿř īīƞƒǿǿ:]",
+  "language#success-message": "[<strong>Ħḗḗŀŀǿǿ!</strong> Ẇḗḗŀƈǿǿḿḗḗ ŧǿǿ Ƥşīīƥħǿǿƞ.]",
+  "logs#placeholder": "[Ƞǿǿ ŀǿǿɠş ẏḗḗŧ]",
+  "logs#show-debug-label": "[Şħǿǿẇ ḓḗḗƀŭŭɠ ŀǿǿɠş]",
+  "nav#about": "[Ȧȧƀǿǿŭŭŧ]",
+  "nav#connection#connected": "[Ƈǿǿƞƞḗḗƈŧḗḗḓ]",
+  "nav#connection#starting": "[Ƈǿǿƞƞḗḗƈŧīīƞɠ]",
+  "nav#connection#stopped": "[Ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ]",
+  "nav#connection#stopping": "[Ḓīīşƈǿǿƞƞḗḗƈŧīīƞɠ]",
+  "nav#feedback": "[Ƒḗḗḗḗḓƀȧȧƈķ]",
+  "nav#logs": "[Ŀǿǿɠş]",
+  "nav#settings": "[Şḗḗŧŧīīƞɠş]",
+  "notice#disallowed-traffic-alert-body": "[<p>Ȧȧƥƥş ƞǿǿŧ ẇǿǿřķīīƞɠ?</p>\n<p>Şǿǿḿḗḗ īīƞŧḗḗřƞḗḗŧ ŧřȧȧƒƒīīƈ īīş ƞǿǿŧ şŭŭƥƥǿǿřŧḗḗḓ ẇīīŧħǿǿŭŭŧ ȧȧƞ ȧȧƈŧīīṽḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ. Ȧȧƈŧīīṽȧȧŧḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ ẇīīŧħ ƤşīīƇȧȧşħ ŧǿǿ ŭŭƞŀǿǿƈķ ŧħḗḗ ƒŭŭŀŀ ƥǿǿŧḗḗƞŧīīȧȧŀ ǿǿƒ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ.</p>]",
+  "notice#disallowed-traffic-alert-title": "[Ŭŭƥɠřȧȧḓḗḗ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ƈǿǿƞƞḗḗƈŧīīǿǿƞ]",
+  "notice#systemproxysettings-setproxy-error-body": "[<p>Ƥşīīƥħǿǿƞ ƒȧȧīīŀḗḗḓ ŧǿǿ şḗḗŧ ŧħḗḗ şẏşŧḗḗḿ’ş ƥřǿǿẋẏ şḗḗŧŧīīƞɠş.</p>\n<p>Ŧħīīş ḿīīɠħŧ ƀḗḗ ḓŭŭḗḗ ŧǿǿ ȧȧ ƈǿǿƞƒŀīīƈŧ ẇīīŧħ ẏǿǿŭŭř ȧȧƞŧīīṽīīřŭŭş şǿǿƒŧẇȧȧřḗḗ. Ẏǿǿŭŭ ḿīīɠħŧ ƞḗḗḗḗḓ ŧǿǿ ḿȧȧƞŭŭȧȧŀŀẏ ƈǿǿƞƒīīɠŭŭřḗḗ ẏǿǿŭŭř ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ǿǿř şẏşŧḗḗḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ŧǿǿ ŭŭşḗḗ ŧħḗḗ ŀǿǿƈȧȧŀ Ƥşīīƥħǿǿƞ ƥřǿǿẋīīḗḗş.</p>]",
+  "notice#systemproxysettings-setproxy-error-title": "[Şẏşŧḗḗḿ Ƥřǿǿẋẏ Ḗḗřřǿǿř]",
+  "notice#systemproxysettings-setproxy-warning-template": "[Ƥşīīƥħǿǿƞ ƒȧȧīīŀḗḗḓ ŧǿǿ şḗḗŧ ŧħḗḗ şẏşŧḗḗḿ’ş ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ƒǿǿř ŧħḗḗ Īīƞŧḗḗřƞḗḗŧ ƈǿǿƞƞḗḗƈŧīīǿǿƞ ƞȧȧḿḗḗḓ “<%- data %>”. Ŧħīīş ḿīīɠħŧ ƀḗḗ ḓŭŭḗḗ ŧǿǿ ȧȧ ƈǿǿƞƒŀīīƈŧ ẇīīŧħ ẏǿǿŭŭř ȧȧƞŧīīṽīīřŭŭş şǿǿƒŧẇȧȧřḗḗ. Ẏǿǿŭŭ ḿīīɠħŧ ƞḗḗḗḗḓ ŧǿǿ ḿȧȧƞŭŭȧȧŀŀẏ ƈǿǿƞƒīīɠŭŭřḗḗ ẏǿǿŭŭř ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ǿǿř şẏşŧḗḗḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ŧǿǿ ŭŭşḗḗ ŧħḗḗ ŀǿǿƈȧȧŀ Ƥşīīƥħǿǿƞ ƥřǿǿẋīīḗḗş.]",
+  "positive-value-indicator": "[+%d]",
+  "psicash#1-day": "[1 ḓȧȧẏ]",
+  "psicash#1-hour": "[1 ħǿǿŭŭř]",
+  "psicash#init-error-body-recovered": "[ƤşīīƇȧȧşħ ƒȧȧīīŀḗḗḓ ŧǿǿ īīƞīīŧīīȧȧŀīīẑḗḗ. Ŧħīīş īīş ƥřǿǿƀȧȧƀŀẏ ḓŭŭḗḗ ŧǿǿ ȧȧ ƒīīŀḗḗ şẏşŧḗḗḿ ƥřǿǿƀŀḗḗḿ, şŭŭƈħ ȧȧş ƀḗḗīīƞɠ ǿǿŭŭŧ ǿǿƒ ḓīīşķ şƥȧȧƈḗḗ. Ẏǿǿŭŭř ƀȧȧŀȧȧƞƈḗḗ ȧȧƞḓ ǿǿŧħḗḗř şŧȧȧŧḗḗ ħȧȧṽḗḗ ƀḗḗḗḗƞ řḗḗşḗḗŧ.]",
+  "psicash#init-error-body-unrecovered": "[ƤşīīƇȧȧşħ ƒȧȧīīŀḗḗḓ ŧǿǿ īīƞīīŧīīȧȧŀīīẑḗḗ. Ŧħīīş īīş ƥřǿǿƀȧȧƀŀẏ ḓŭŭḗḗ ŧǿǿ ȧȧ ƒīīŀḗḗ şẏşŧḗḗḿ ƥřǿǿƀŀḗḗḿ, şŭŭƈħ ȧȧş ƀḗḗīīƞɠ ǿǿŭŭŧ ǿǿƒ ḓīīşķ şƥȧȧƈḗḗ. Ẏǿǿŭŭř ƀȧȧŀȧȧƞƈḗḗ ȧȧƞḓ ǿǿŧħḗḗř şŧȧȧŧḗḗ ħȧȧṽḗḗ ƀḗḗḗḗƞ ŀǿǿşŧ. ƤşīīƇȧȧşħ ẇīīŀŀ ƞǿǿŧ ƀḗḗ ŭŭşȧȧƀŀḗḗ. Ẏǿǿŭŭ ƈȧȧƞ ŧřẏ řḗḗşŧȧȧřŧīīƞɠ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ŧǿǿ řḗḗƈǿǿṽḗḗř ƒřǿǿḿ ŧħḗḗ ƥřǿǿƀŀḗḗḿ.]",
+  "psicash#init-error-title": "[ƤşīīƇȧȧşħ īīƞīīŧīīȧȧŀīīẑȧȧŧīīǿǿƞ ḗḗřřǿǿř]",
+  "psicash#mustconnect-modal#body": "[Īīƞ ǿǿřḓḗḗř ŧǿǿ ŭŭşḗḗ ƤşīīƇȧȧşħ, ẏǿǿŭŭ ḿŭŭşŧ ƀḗḗ ƈǿǿƞƞḗḗƈŧḗḗḓ ŧǿǿ ŧħḗḗ Ƥşīīƥħǿǿƞ ƞḗḗŧẇǿǿřķ.]",
+  "psicash#mustconnect-modal#title": "[Ƥşīīƥħǿǿƞ Ƈǿǿƞƞḗḗƈŧīīǿǿƞ Řḗḗɋŭŭīīřḗḗḓ]",
+  "psicash#psiphon-speed": "[Ƥşīīƥħǿǿƞ<br>Şƥḗḗḗḗḓ]",
+  "psicash#transaction-ExistingTransaction-body": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ȧȧƞ ḗḗẋīīşŧīīƞɠ ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ǿǿƒ ŧħīīş ŧẏƥḗḗ. Ȧȧƞǿǿŧħḗḗř ƥŭŭřƈħȧȧşḗḗ ǿǿƒ ŧħīīş ŧẏƥḗḗ īīş ƞǿǿŧ ȧȧŀŀǿǿẇḗḗḓ ŭŭƞŧīīŀ ŧħḗḗ ƥřḗḗṽīīǿǿŭŭş ǿǿƞḗḗ ḗḗẋƥīīřḗḗş. Ẏǿǿŭŭř ƤşīīƇȧȧşħ şŧȧȧŧḗḗ ẇīīŀŀ ƀḗḗ řḗḗƒřḗḗşħḗḗḓ ƞǿǿẇ.]",
+  "psicash#transaction-ExistingTransaction-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ȧȧŀřḗḗȧȧḓẏ ḗḗẋīīşŧş]",
+  "psicash#transaction-InsufficientBalance-body": "[Ẏǿǿŭŭ ḓǿǿ ƞǿǿŧ ħȧȧṽḗḗ şŭŭƒƒīīƈīīḗḗƞŧ ƤşīīƇȧȧşħ ƀȧȧŀȧȧƞƈḗḗ ƒǿǿř ŧħīīş ƥŭŭřƈħȧȧşḗḗ.]",
+  "psicash#transaction-InsufficientBalance-title": "[Īīƞşŭŭƒƒīīƈīīḗḗƞŧ ƤşīīƇȧȧşħ ƀȧȧŀȧȧƞƈḗḗ]",
+  "psicash#transaction-InvalidTokens-body": "[Ẏǿǿŭŭř ƤşīīƇȧȧşħ ŧǿǿķḗḗƞş ȧȧřḗḗ īīƞṽȧȧŀīīḓ. Ŧřẏ řḗḗşŧȧȧřŧīīƞɠ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ. Īīƒ ŧħȧȧŧ ḓǿǿḗḗşƞ'ŧ ẇǿǿřķ, ẏǿǿŭŭ ẇīīŀŀ ƞḗḗḗḗḓ ŧǿǿ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">ƈŀḗḗȧȧř ẏǿǿŭŭř ŀǿǿƈȧȧŀ şŧǿǿřȧȧɠḗḗ</a>.]",
+  "psicash#transaction-InvalidTokens-title": "[Īīƞṽȧȧŀīīḓ ƤşīīƇȧȧşħ ŧǿǿķḗḗƞş]",
+  "psicash#transaction-ServerError-body": "[Ŧħḗḗ ƤşīīƇȧȧşħ şḗḗřṽḗḗř řḗḗşƥǿǿƞḓḗḗḓ ẇīīŧħ ȧȧƞ ḗḗřřǿǿř ẇħīīŀḗḗ ŧřẏīīƞɠ ŧǿǿ ḿȧȧķḗḗ ŧħḗḗ ƥŭŭřƈħȧȧşḗḗ. Ƥŀḗḗȧȧşḗḗ řḗḗŧřẏ ẏǿǿŭŭř ƥŭŭřƈħȧȧşḗḗ ŀȧȧŧḗḗř.]",
+  "psicash#transaction-ServerError-title": "[ƤşīīƇȧȧşħ şḗḗřṽḗḗř ḗḗřřǿǿř]",
+  "psicash#transaction-TransactionAmountMismatch-body": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ƥřīīƈḗḗş ȧȧřḗḗ ǿǿŭŭŧ-ǿǿƒ-ḓȧȧŧḗḗ. Ẏǿǿŭŭř ƤşīīƇȧȧşħ şŧȧȧŧḗḗ ẇīīŀŀ ƀḗḗ řḗḗƒřḗḗşħḗḗḓ ƞǿǿẇ.]",
+  "psicash#transaction-TransactionAmountMismatch-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ƥřīīƈḗḗ ḿīīşḿȧȧŧƈħ]",
+  "psicash#transaction-TransactionTypeNotFound-body": "[Ŧħḗḗ ƥřǿǿḓŭŭƈŧ ẏǿǿŭŭ ȧȧřḗḗ ŧřẏīīƞɠ ŧǿǿ ƀŭŭẏ ƞǿǿ ŀǿǿƞɠḗḗř ḗḗẋīīşŧş. Ẏǿǿŭŭ ḿȧȧẏ ƞḗḗḗḗḓ ŧǿǿ ŭŭƥḓȧȧŧḗḗ ǿǿř řḗḗīīƞşŧȧȧŀŀ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ.]",
+  "psicash#transaction-TransactionTypeNotFound-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ŧẏƥḗḗ ƞǿǿŧ ƒǿǿŭŭƞḓ]",
+  "psicash#transaction-error-body": "[Ẏǿǿŭŭř ƤşīīƇȧȧşħ ŧřȧȧƞşȧȧƈŧīīǿǿƞ ȧȧŧŧḗḗḿƥŧ ƒȧȧīīŀḗḗḓ ŭŭƞḗḗẋƥḗḗƈŧḗḗḓŀẏ.]",
+  "psicash#transaction-error-title": "[ƤşīīƇȧȧşħ ŧřȧȧƞşȧȧƈŧīīǿǿƞ ḗḗřřǿǿř]",
+  "psicash#ui-buyingboost-buttontext": "[Şŧȧȧřŧīīƞɠ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ!]",
+  "psicash#ui-buymorepsi": "[Ɓŭŭẏ ḿǿǿřḗḗ ƤşīīƇȧȧşħ]",
+  "psicash#ui-buypsi": "[Ɓŭŭẏ ƤşīīƇȧȧşħ]",
+  "psicash#ui-enoughbalance-buttontext": "[Şŧȧȧřŧ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ]",
+  "psicash#ui-nsfbalance-buttontext": "[Ƞḗḗḗḗḓḗḗḓ ƒǿǿř Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ]",
+  "psicash#ui-speedboost-active": "[Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ ȧȧƈŧīīṽḗḗ ƒǿǿř %s]",
+  "psicash#ui-zerobalance-title": "[Ƞḗḗḗḗḓ ȧȧ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ?]",
+  "settings#apply-button": "[Ȧȧƥƥŀẏ Ƈħȧȧƞɠḗḗş]",
+  "settings#applying-message": "[Řḗḗƈǿǿƞƞḗḗƈŧīīƞɠ ŧǿǿ ȧȧƥƥŀẏ ẏǿǿŭŭř şḗḗŧŧīīƞɠş.]",
+  "settings#disable-timeouts#enable-label": "[Ḓīīşȧȧƀŀḗḗ ŧīīḿḗḗǿǿŭŭŧş ƒǿǿř şŀǿǿẇ ƞḗḗŧẇǿǿřķş]",
+  "settings#disable-timeouts#heading": "[Ḓīīşȧȧƀŀḗḗ Ŧīīḿḗḗǿǿŭŭŧş ƒǿǿř Şŀǿǿẇ Ƞḗḗŧẇǿǿřķş]",
+  "settings#disable-timeouts#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, ƈǿǿḿḿŭŭƞīīƈȧȧŧīīǿǿƞ ẇīīŧħ ŧħḗḗ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ẇīīŀŀ ƞǿǿŧ ŧīīḿḗḗ ǿǿŭŭŧ.]",
+  "settings#disable-timeouts#reason": "[Ẇħḗḗƞ ḗḗƞȧȧƀŀīīƞɠ ŧħīīş ƒǿǿř ȧȧ ṽḗḗřẏ şŀǿǿẇ ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ, ẏǿǿŭŭ ȧȧřḗḗ ŀḗḗşş ŀīīķḗḗŀẏ ŧǿǿ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ ŭŭƞḗḗẋƥḗḗƈŧḗḗḓ ḓīīşƈǿǿƞƞḗḗƈŧīīǿǿƞş.]",
+  "settings#disallowed-traffic-alert#disable-label": "[Ḓīīşȧȧƀŀḗḗ ḓīīşȧȧŀŀǿǿẇḗḗḓ ŧřȧȧƒƒīīƈ ȧȧŀḗḗřŧş]",
+  "settings#disallowed-traffic-alert#heading": "[Ḓīīşȧȧŀŀǿǿẇḗḗḓ Ŧřȧȧƒƒīīƈ Ȧȧŀḗḗřŧ]",
+  "settings#disallowed-traffic-alert#help-text": "[Şǿǿḿḗḗ ŧẏƥḗḗş ǿǿƒ īīƞŧḗḗřƞḗḗŧ ŧřȧȧƒƒīīƈ ȧȧřḗḗ ƞǿǿŧ şŭŭƥƥǿǿřŧḗḗḓ ẇīīŧħǿǿŭŭŧ ȧȧƞ ȧȧƈŧīīṽḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ. Ẇħḗḗƞ şŭŭƈħ ŧřȧȧƒƒīīƈ īīş ḓīīşȧȧŀŀǿǿẇḗḗḓ, ȧȧƞ ȧȧŀḗḗřŧ īīş şħǿǿẇƞ. (Řḗḗ-ḗḗƞȧȧƀŀīīƞɠ ẇīīŀŀ řḗḗɋŭŭīīřḗḗ ȧȧ řḗḗƈǿǿƞƞḗḗƈŧīīǿǿƞ.)]",
+  "settings#egress-region#default": "[Ƈħǿǿǿǿşīīƞɠ ŧħḗḗ ḓḗḗƒȧȧŭŭŀŧ <strong>“Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ”</strong> ǿǿƥŧīīǿǿƞ ȧȧŀŀǿǿẇş Ƥşīīƥħǿǿƞ ŧǿǿ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƈħǿǿǿǿşḗḗ ȧȧ şḗḗřṽḗḗř, ẇħīīƈħ ẇīīŀŀ ɠḗḗƞḗḗřȧȧŀŀẏ řḗḗşŭŭŀŧ īīƞ ŧħḗḗ ƀḗḗşŧ ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ.]",
+  "settings#egress-region#description": "[Ƥşīīƥħǿǿƞ ħȧȧş şḗḗřṽḗḗřş īīƞ ḿȧȧƞẏ ḓīīƒƒḗḗřḗḗƞŧ ƈǿǿŭŭƞŧřīīḗḗş ȧȧƞḓ řḗḗɠīīǿǿƞş. Ŭŭşīīƞɠ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř īīƞ ȧȧ řḗḗɠīīǿǿƞ ƈŀǿǿşḗḗ ŧǿǿ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ẇīīŀŀ ɠḗḗƞḗḗřȧȧŀŀẏ ƥřǿǿṽīīḓḗḗ ȧȧ ƀḗḗŧŧḗḗř ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ, ƀŭŭŧ ẏǿǿŭŭ ḿȧȧẏ ẇīīşħ ŧǿǿ ȧȧƈƈḗḗşş ẇḗḗƀşīīŧḗḗş ȧȧƞḓ şḗḗřṽīīƈḗḗş ŀīīķḗḗ ẏǿǿŭŭ ȧȧřḗḗ ṽīīřŧŭŭȧȧŀŀẏ īīƞ ȧȧ şƥḗḗƈīīƒīīƈ ƈǿǿŭŭƞŧřẏ ǿǿř řḗḗɠīīǿǿƞ.]",
+  "settings#egress-region#error-modal-body-http": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şḗḗřṽḗḗř īīƞ ȧȧ şƥḗḗƈīīƒīīƈ řḗḗɠīīǿǿƞ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ řḗḗɠīīǿǿƞ īīş ƞǿǿ ŀǿǿƞɠḗḗř ȧȧṽȧȧīīŀȧȧƀŀḗḗ.<br>\nẎǿǿŭŭ ḿŭŭşŧ ƈħǿǿǿǿşḗḗ ȧȧ ƞḗḗẇ řḗḗɠīīǿǿƞ ǿǿř ƈħȧȧƞɠḗḗ ŧǿǿ ŧħḗḗ ḓḗḗƒȧȧŭŭŀŧ “Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ” ƈħǿǿīīƈḗḗ.]",
+  "settings#egress-region#error-modal-title": "[Şḗḗřṽḗḗř Řḗḗɠīīǿǿƞ Ŭŭƞȧȧṽȧȧīīŀȧȧƀŀḗḗ]",
+  "settings#egress-region#heading": "[Ƥşīīƥħǿǿƞ Şḗḗřṽḗḗř Řḗḗɠīīǿǿƞ]",
+  "settings#egress-region#invalid-error-msg": "[Ƈħǿǿǿǿşḗḗ ȧȧ ṽȧȧŀīīḓ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř řḗḗɠīīǿǿƞ.]",
+  "settings#egress-region#select-at": "[Ȧȧŭŭşŧřīīȧȧ]",
+  "settings#egress-region#select-au": "[Ȧȧŭŭşŧřȧȧŀīīȧȧ]",
+  "settings#egress-region#select-be": "[Ɓḗḗŀɠīīŭŭḿ]",
+  "settings#egress-region#select-best-performance": "[Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ]",
+  "settings#egress-region#select-bg": "[Ɓŭŭŀɠȧȧřīīȧȧ]",
+  "settings#egress-region#select-ca": "[Ƈȧȧƞȧȧḓȧȧ]",
+  "settings#egress-region#select-ch": "[Şẇīīŧẑḗḗřŀȧȧƞḓ]",
+  "settings#egress-region#select-cz": "[Ƈẑḗḗƈħ Řḗḗƥŭŭƀŀīīƈ]",
+  "settings#egress-region#select-de": "[Ɠḗḗřḿȧȧƞẏ]",
+  "settings#egress-region#select-dk": "[Ḓḗḗƞḿȧȧřķ]",
+  "settings#egress-region#select-es": "[Şƥȧȧīīƞ]",
+  "settings#egress-region#select-fr": "[Ƒřȧȧƞƈḗḗ]",
+  "settings#egress-region#select-gb": "[Ŭŭƞīīŧḗḗḓ Ķīīƞɠḓǿǿḿ]",
+  "settings#egress-region#select-hk": "[Ħǿǿƞɠ Ķǿǿƞɠ]",
+  "settings#egress-region#select-hu": "[Ħŭŭƞɠȧȧřẏ]",
+  "settings#egress-region#select-in": "[Īīƞḓīīȧȧ]",
+  "settings#egress-region#select-it": "[Īīŧȧȧŀẏ]",
+  "settings#egress-region#select-jp": "[Ĵȧȧƥȧȧƞ]",
+  "settings#egress-region#select-nl": "[Ƞḗḗŧħḗḗřŀȧȧƞḓş]",
+  "settings#egress-region#select-no": "[Ƞǿǿřẇȧȧẏ]",
+  "settings#egress-region#select-pl": "[Ƥǿǿŀȧȧƞḓ]",
+  "settings#egress-region#select-ro": "[Řǿǿḿȧȧƞīīȧȧ]",
+  "settings#egress-region#select-rs": "[Şḗḗřƀīīȧȧ]",
+  "settings#egress-region#select-se": "[Şẇḗḗḓḗḗƞ]",
+  "settings#egress-region#select-sg": "[Şīīƞɠȧȧƥǿǿřḗḗ]",
+  "settings#egress-region#select-sk": "[Şŀǿǿṽȧȧķīīȧȧ]",
+  "settings#egress-region#select-us": "[Ŭŭƞīīŧḗḗḓ Şŧȧȧŧḗḗş]",
+  "settings#error-alert": "[<strong>Ḗḗřřǿǿř!</strong> Ƥŀḗḗȧȧşḗḗ ƒīīẋ īīƞƈǿǿřřḗḗƈŧ ṽȧȧŀŭŭḗḗş ƀḗḗƒǿǿřḗḗ ƥřǿǿƈḗḗḗḗḓīīƞɠ.]",
+  "settings#error-modal#body": "[Ŧħḗḗřḗḗ ȧȧřḗḗ ḗḗřřǿǿřş īīƞ ẏǿǿŭŭř şḗḗŧŧīīƞɠş ṽȧȧŀŭŭḗḗş. Ƥŀḗḗȧȧşḗḗ ƈǿǿřřḗḗƈŧ ŧħḗḗḿ ƀḗḗƒǿǿřḗḗ ƥřǿǿƈḗḗḗḗḓīīƞɠ.]",
+  "settings#error-modal#title": "[Şḗḗŧŧīīƞɠş Ḗḗřřǿǿř]",
+  "settings#local-proxy-ports#error-modal-body-http": "[<p>\nẎǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şƥḗḗƈīīƒīīƈ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƒǿǿř īīŧş ĦŦŦƤ ƥřǿǿẋẏ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ ƥǿǿřŧ ȧȧƥƥḗḗȧȧřş ŧǿǿ ƀḗḗ ȧȧŀřḗḗȧȧḓẏ īīƞ ŭŭşḗḗ ȧȧƞḓ şǿǿ Ƥşīīƥħǿǿƞ ƈȧȧƞƞǿǿŧ ŭŭşḗḗ īīŧ.\n</p>\n<p>\nƤŀḗḗȧȧşḗḗ ƈħȧȧƞɠḗḗ ŧħḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ ĦŦŦƤ ƥřǿǿẋẏ ƥǿǿřŧ ṽȧȧŀŭŭḗḗ ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ. Ẇḗḗ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ ŧħȧȧŧ ẏǿǿŭŭ ƈŀḗḗȧȧř ŧħḗḗ ṽȧȧŀŭŭḗḗ şǿǿ ŧħȧȧŧ Ƥşīīƥħǿǿƞ ƈȧȧƞ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƥīīƈķ ȧȧƞ ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƥǿǿřŧ.\n</p>]",
+  "settings#local-proxy-ports#error-modal-body-socks": "[<p>\nẎǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şƥḗḗƈīīƒīīƈ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƒǿǿř īīŧş ŞǾǿƇĶŞ ƥřǿǿẋẏ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ ƥǿǿřŧ ȧȧƥƥḗḗȧȧřş ŧǿǿ ƀḗḗ ȧȧŀřḗḗȧȧḓẏ īīƞ ŭŭşḗḗ ȧȧƞḓ şǿǿ Ƥşīīƥħǿǿƞ ƈȧȧƞƞǿǿŧ ŭŭşḗḗ īīŧ.\n</p>\n<p>\nƤŀḗḗȧȧşḗḗ ƈħȧȧƞɠḗḗ ŧħḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ ŞǾǿƇĶŞ ƥřǿǿẋẏ ƥǿǿřŧ ṽȧȧŀŭŭḗḗ ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ. Ẇḗḗ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ ŧħȧȧŧ ẏǿǿŭŭ ƈŀḗḗȧȧř ŧħḗḗ ṽȧȧŀŭŭḗḗ şǿǿ ŧħȧȧŧ Ƥşīīƥħǿǿƞ ƈȧȧƞ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƥīīƈķ ȧȧƞ ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƥǿǿřŧ.\n</p>]",
+  "settings#local-proxy-ports#error-modal-title": "[Ŀǿǿƈȧȧŀ Ƥřǿǿẋẏ Ƥǿǿřŧ Ƈǿǿƞƒŀīīƈŧ]",
+  "settings#local-proxy-ports#heading": "[Ŀǿǿƈȧȧŀ Ƥřǿǿẋẏ Ƥǿǿřŧş]",
+  "settings#local-proxy-ports#http-label": "[ĦŦŦƤ/ĦŦŦƤŞ]",
+  "settings#local-proxy-ports#leave-blank": "[Ŀḗḗȧȧṽḗḗ <strong>ƀŀȧȧƞķ</strong> ƒǿǿř ȧȧŭŭŧǿǿḿȧȧŧīīƈ ƥǿǿřŧ şḗḗŀḗḗƈŧīīǿǿƞ (řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ).]",
+  "settings#local-proxy-ports#reason": "[Īīƒ ẏǿǿŭŭ ŭŭşḗḗ ŧǿǿǿǿŀş ǿǿƞ ẏǿǿŭŭř ƈǿǿḿƥŭŭŧḗḗř ŧħȧȧŧ řḗḗɋŭŭīīřḗḗ ḿȧȧƞŭŭȧȧŀ ƈǿǿƞƒīīɠŭŭřȧȧŧīīǿǿƞ ŧǿǿ ẇǿǿřķ ẇīīŧħ Ƥşīīƥħǿǿƞ, ẏǿǿŭŭ ẇīīŀŀ ẇȧȧƞŧ Ƥşīīƥħǿǿƞ ŧǿǿ ƈǿǿƞşīīşŧḗḗƞŧŀẏ ŭŭşḗḗ ŧħḗḗ şȧȧḿḗḗ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƞŭŭḿƀḗḗřş. Īīƒ ẏǿǿŭŭ ḓǿǿƞ’ŧ ħȧȧṽḗḗ ȧȧ řḗḗȧȧşǿǿƞ ŧǿǿ şƥḗḗƈīīƒẏ ƥǿǿřŧ ƞŭŭḿƀḗḗřş, ẏǿǿŭŭ şħǿǿŭŭŀḓ ȧȧŀŀǿǿẇ Ƥşīīƥħǿǿƞ ŧǿǿ ƈħǿǿǿǿşḗḗ ŧħḗḗḿ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ŧǿǿ ħḗḗŀƥ ȧȧṽǿǿīīḓ ƈǿǿƞƒŀīīƈŧş.]",
+  "settings#local-proxy-ports#socks-label": "[ŞǾǿƇĶŞ]",
+  "settings#local-proxy-ports#unique-error-msg": "[Ŀǿǿƈȧȧŀ ƥǿǿřŧş ḿŭŭşŧ ƀḗḗ ḓīīşŧīīƞƈŧ ƒřǿǿḿ ḗḗȧȧƈħ ǿǿŧħḗḗř.]",
+  "settings#port-value-error-msg": "[Ḿŭŭşŧ ƀḗḗ ƀḗḗŧẇḗḗḗḗƞ 1 ȧȧƞḓ 65535.]",
+  "settings#reset-button": "[Řḗḗşḗḗŧ ŧǿǿ Ḓḗḗƒȧȧŭŭŀŧ]",
+  "settings#saved-message": "[Şḗḗŧŧīīƞɠş şȧȧṽḗḗḓ.]",
+  "settings#split-tunnel#enable-label": "[Ḓǿǿƞ'ŧ ƥřǿǿẋẏ ẇḗḗƀşīīŧḗḗş ẇīīŧħīīƞ ẏǿǿŭŭř ƈǿǿŭŭƞŧřẏ]",
+  "settings#split-tunnel#heading": "[Şƥŀīīŧ Ŧŭŭƞƞḗḗŀ]",
+  "settings#split-tunnel#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, řḗḗɋŭŭḗḗşŧş ḿȧȧḓḗḗ ŧǿǿ şḗḗřṽḗḗřş ẇīīŧħīīƞ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ẇīīŀŀ ƞǿǿŧ ƀḗḗ ŧŭŭƞƞḗḗŀḗḗḓ ŧħřǿǿŭŭɠħ Ƥşīīƥħǿǿƞ.]",
+  "settings#split-tunnel#reason": "[Ẇḗḗƀşīīŧḗḗş ẇīīŧħīīƞ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ȧȧřḗḗ ɠḗḗƞḗḗřȧȧŀŀẏ ƞǿǿŧ ƀŀǿǿƈķḗḗḓ, şǿǿ ḗḗƞȧȧƀŀīīƞɠ ŧħīīş ǿǿƥŧīīǿǿƞ ẇīīŀŀ ɠīīṽḗḗ ẏǿǿŭŭ ƒȧȧşŧḗḗř ȧȧƈƈḗḗşş ŧǿǿ ŧħǿǿşḗḗ şīīŧḗḗş ȧȧƞḓ ƈȧȧƞ şǿǿḿḗḗŧīīḿḗḗş řḗḗḓŭŭƈḗḗ ĪīŞƤ ḓȧȧŧȧȧ ŭŭşȧȧɠḗḗ ƈǿǿşŧş.]",
+  "settings#systray-minimize#enable-label": "[Ḿīīƞīīḿīīẑḗḗ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (şẏşŧḗḗḿ ŧřȧȧẏ)]",
+  "settings#systray-minimize#heading": "[Ḿīīƞīīḿīīẑḗḗ ŧǿǿ Ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ Ȧȧřḗḗȧȧ (Şẏşŧḗḗḿ Ŧřȧȧẏ)]",
+  "settings#systray-minimize#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, ẇħḗḗƞ ḿīīƞīīḿīīẑḗḗḓ ŧħḗḗ Ƥşīīƥħǿǿƞ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ẇīīƞḓǿǿẇ ẇīīŀŀ ħīīḓḗḗ īīƞ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (ȧȧŀşǿǿ ķƞǿǿẇƞ ȧȧş ŧħḗḗ “şẏşŧḗḗḿ ŧřȧȧẏ” ǿǿř “şẏşŧřȧȧẏ”, ŀǿǿƈȧȧŧḗḗḓ ƞḗḗȧȧř ŧħḗḗ ƈŀǿǿƈķ ǿǿƞ ẏǿǿŭŭř Ẇīīƞḓǿǿẇş ŧȧȧşķ ƀȧȧř).]",
+  "settings#systray-minimize#reason": "[Ḿīīƞīīḿīīẑīīƞɠ Ƥşīīƥħǿǿƞ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (“şẏşŧḗḗḿ ŧřȧȧẏ”) ƒřḗḗḗḗş ŭŭƥ şƥȧȧƈḗḗ ǿǿƞ ẏǿǿŭŭř ŧȧȧşķ ƀȧȧř. Ŧħīīş īīş ḗḗşƥḗḗƈīīȧȧŀŀẏ ħḗḗŀƥƒŭŭŀ īīƒ ẏǿǿŭŭ ǿǿƒŧḗḗƞ řŭŭƞ Ƥşīīƥħǿǿƞ ƒǿǿř ŀǿǿƞɠ ƥḗḗřīīǿǿḓş ǿǿƒ ŧīīḿḗḗ.]",
+  "settings#transport-mode#check-label": "[Ŭŭşḗḗ Ŀ2ŦƤ/ĪīƤŞḗḗƈ ḿǿǿḓḗḗ]",
+  "settings#transport-mode#heading": "[Ŧřȧȧƞşƥǿǿřŧ Ḿǿǿḓḗḗ]",
+  "settings#transport-mode#help-text": "[Ŭŭşḗḗş Ẇīīƞḓǿǿẇş Ŀ2ŦƤ/ĪīƤŞḗḗƈ ṽīīřŧŭŭȧȧŀ ƞḗḗŧẇǿǿřķīīƞɠ. Ŧħīīş ḿǿǿḓḗḗ ẇīīŀŀ ŧŭŭƞƞḗḗŀ ȧȧŀŀ ǿǿƒ ẏǿǿŭŭř ȧȧƥƥş, ƀŭŭŧ īīŧ ḓǿǿḗḗşƞ’ŧ ƥřǿǿṽīīḓḗḗ ǿǿƀƒŭŭşƈȧȧŧīīǿǿƞ ȧȧƞḓ şǿǿ ḓǿǿḗḗş ƞǿǿŧ ħȧȧṽḗḗ şŧřǿǿƞɠ ƈḗḗƞşǿǿřşħīīƥ ƈīīřƈŭŭḿṽḗḗƞŧīīǿǿƞ ƈȧȧƥȧȧƀīīŀīīŧīīḗḗş. Īīŧ īīş <strong>ƞǿǿŧ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ</strong> ƒǿǿř ƀẏƥȧȧşşīīƞɠ ḿǿǿşŧ ƒīīřḗḗẇȧȧŀŀş.]",
+  "settings#unapplied-changes-prompt#apply-button": "[Ȧȧƥƥŀẏ]",
+  "settings#unapplied-changes-prompt#body": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ḿȧȧḓḗḗ ƈħȧȧƞɠḗḗş ŧǿǿ ẏǿǿŭŭř şḗḗŧŧīīƞɠş, ƀŭŭŧ ẏǿǿŭŭ ħȧȧṽḗḗ ƞǿǿŧ ȧȧƥƥŀīīḗḗḓ ŧħḗḗ ƈħȧȧƞɠḗḗş.<br><br>Ḓǿǿ ẏǿǿŭŭ ẇīīşħ ŧǿǿ ȧȧƥƥŀẏ ẏǿǿŭŭř ƈħȧȧƞɠḗḗş ƞǿǿẇ ǿǿř ḓīīşƈȧȧřḓ ŧħḗḗḿ?]",
+  "settings#unapplied-changes-prompt#discard-button": "[Ḓīīşƈȧȧřḓ]",
+  "settings#unapplied-changes-prompt#title": "[Şḗḗŧŧīīƞɠş Ƈħȧȧƞɠḗḗḓ]",
+  "settings#upstream-proxy#by-default": "[Īīƒ ẏǿǿŭŭř ƈǿǿḿƥŭŭŧḗḗř ȧȧŀřḗḗȧȧḓẏ ħȧȧş ȧȧ ƥřǿǿẋẏ ƈǿǿƞƒīīɠŭŭřḗḗḓ, ƀẏ ḓḗḗƒȧȧŭŭŀŧ Ƥşīīƥħǿǿƞ ẇīīŀŀ ŭŭşḗḗ ŧħȧȧŧ ƥřǿǿẋẏ ẇħḗḗƞ ḗḗşŧȧȧƀŀīīşħīīƞɠ ȧȧ ŧŭŭƞƞḗḗŀ. Ẏǿǿŭŭ ƈȧȧƞ ǿǿṽḗḗřřīīḓḗḗ ŧħȧȧŧ ƀḗḗħȧȧṽīīǿǿř ƀẏ şƥḗḗƈīīƒẏīīƞɠ ȧȧ ƥřǿǿẋẏ ŧǿǿ ŭŭşḗḗ, ǿǿř ƀẏ şƥḗḗƈīīƒẏīīƞɠ ŧħȧȧŧ ƞǿǿ şŭŭƈħ “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ” şħǿǿŭŭŀḓ ƀḗḗ ŭŭşḗḗḓ.]",
+  "settings#upstream-proxy#domain-label": "[Ḓǿǿḿȧȧīīƞ]",
+  "settings#upstream-proxy#error-modal-body-configured": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧƞ “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ”.<br>\nĦǿǿẇḗḗṽḗḗř, ẇḗḗ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ŭŭƞȧȧƀŀḗḗ ŧǿǿ ƈǿǿƞƞḗḗƈŧ ŧǿǿ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ŧħřǿǿŭŭɠħ ŧħȧȧŧ ƥřǿǿẋẏ.<br>\nƤŀḗḗȧȧşḗḗ ƒīīẋ ŧħḗḗ şḗḗŧŧīīƞɠş ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ.]",
+  "settings#upstream-proxy#error-modal-body-default": "[Ƥşīīƥħǿǿƞ īīş ƈŭŭřřḗḗƞŧŀẏ ƈǿǿƞƒīīɠŭŭřḗḗḓ ŧǿǿ ŭŭşḗḗ ẏǿǿŭŭř şẏşŧḗḗḿ ƥřǿǿẋẏ ȧȧş īīŧş “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ”.<br>\nĦǿǿẇḗḗṽḗḗř, ẇḗḗ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ŭŭƞȧȧƀŀḗḗ ŧǿǿ ƈǿǿƞƞḗḗƈŧ ŧǿǿ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ŧħřǿǿŭŭɠħ ŧħȧȧŧ ƥřǿǿẋẏ.<br>\nƤŀḗḗȧȧşḗḗ ḗḗƞȧȧƀŀḗḗ “Ḓǿǿƞ'ŧ ŭŭşḗḗ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ” ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ.]",
+  "settings#upstream-proxy#error-modal-title": "[Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ Ḗḗřřǿǿř]",
+  "settings#upstream-proxy#heading": "[Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ]",
+  "settings#upstream-proxy#hostname-label": "[Ħǿǿşŧƞȧȧḿḗḗ]",
+  "settings#upstream-proxy#password-label": "[Ƥȧȧşşẇǿǿřḓ]",
+  "settings#upstream-proxy#port-label": "[Ƥǿǿřŧ]",
+  "settings#upstream-proxy#proxy-reqs": "[Ǿǿƞŀẏ ĦŦŦƤ ƥřǿǿẋīīḗḗş ŧħȧȧŧ şŭŭƥƥǿǿřŧ ĦŦŦƤŞ ȧȧřḗḗ ȧȧŀŀǿǿẇḗḗḓ.]",
+  "settings#upstream-proxy#reason": "[Ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋīīḗḗş ȧȧřḗḗ şǿǿḿḗḗŧīīḿḗḗş řḗḗɋŭŭīīřḗḗḓ ƀẏ şƈħǿǿǿǿŀş, ŭŭƞīīṽḗḗřşīīŧīīḗḗş, ǿǿř ƀŭŭşīīƞḗḗşşḗḗş. Īīƒ ẏǿǿŭŭř ƞḗḗŧẇǿǿřķ ƥřǿǿṽīīḓḗḗř ħȧȧş ɠīīṽḗḗƞ ẏǿǿŭŭ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş, ŧħḗḗƞ ḿȧȧƞŭŭȧȧŀŀẏ şḗḗŧŧīīƞɠ ŧħḗḗḿ ħḗḗřḗḗ ḿȧȧẏ ƀḗḗ řḗḗɋŭŭīīřḗḗḓ ŧǿǿ ƈǿǿƞƞḗḗƈŧ.]",
+  "settings#upstream-proxy#set-hostname-error-msg": "[Ẏǿǿŭŭ ḿŭŭşŧ ƥřǿǿṽīīḓḗḗ ȧȧ Ħǿǿşŧƞȧȧḿḗḗ, ǿǿř ŀḗḗȧȧṽḗḗ ȧȧŀŀ Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ ƒīīḗḗŀḓş ƀŀȧȧƞķ ƒǿǿř ȧȧŭŭŧǿǿḿȧȧŧīīƈ şḗḗŀḗḗƈŧīīǿǿƞ.]",
+  "settings#upstream-proxy#set-username-error-msg": "[Ẏǿǿŭŭ ḿŭŭşŧ ƥřǿǿṽīīḓḗḗ ȧȧ Ŭŭşḗḗřƞȧȧḿḗḗ īīƒ ẏǿǿŭŭ ȧȧřḗḗ şḗḗŧŧīīƞɠ Ƥȧȧşşẇǿǿřḓ ǿǿř Ḓǿǿḿȧȧīīƞ; ǿǿř ŀḗḗȧȧṽḗḗ ȧȧŀŀ ȧȧŭŭŧħḗḗƞŧīīƈȧȧŧīīǿǿƞ ƒīīḗḗŀḓş ƀŀȧȧƞķ ƒǿǿř ƞǿǿ ȧȧŭŭŧħḗḗƞŧīīƈȧȧŧīīǿǿƞ.]",
+  "settings#upstream-proxy#skip-label": "[Ḓǿǿƞ'ŧ ŭŭşḗḗ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ]",
+  "settings#upstream-proxy#username-label": "[Ŭŭşḗḗřƞȧȧḿḗḗ]",
+  "settings#vpn-incompatible-label": "[Ŀ2ŦƤ/ĪīƤŞḗḗƈ]",
+  "settings#vpn-incompatible-msg": "[(Ḓǿǿḗḗşƞ'ŧ ẇǿǿřķ ẇīīŧħ Ŀ2ŦƤ/ĪīƤŞḗḗƈ ḿǿǿḓḗḗ.)]"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["devrtl"].translation = {
+  "about#client-version": "‮Ԁsıdɥou‬ ‮ɟoɹ‬ ‮Ｍıupoʍs‬ ‮ɔʅıǝuʇ‬ ‮ʌǝɹsıou‬:",
+  "about#description": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɐ‬ <strong>‮ɔǝusoɹsɥıd‬ ‮ɔıɹɔnɯʌǝuʇıou‬ ‮ʇooʅ‬</strong> — ‮ıʇ‬ ‮ıs‬ ‮pǝsıƃuǝp‬ ‮ʇo‬ ‮ƃıʌǝ‬ ‮ɐɔɔǝss‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮odǝu‬ ‮Iuʇǝɹuǝʇ‬, ‮dɐsʇ‬ ‮ɔǝusoɹs‬ ‮ɐup‬ ‮ɟıɹǝʍɐʅʅs‬. ‮Iʇ‬ ‮ıs‬ <strong>‮odǝu‬ ‮sonɹɔǝ‬</strong> ‮ɐup‬ ‮pǝʌǝʅodǝp‬ ‮ıu‬ ‮⊥oɹouʇo‬, ‮Ↄɐuɐpɐ‬.",
+  "about#get-by-email": "<strong>‮Iɟ‬ ‮ʇɥǝ‬ ‮ʍǝqsıʇǝ‬ ‮ıs‬ ‮ıuɐɔɔǝssıqʅǝ‬</strong>, ‮ʎon‬ ‮ɔɐu‬ ‮ƃǝʇ‬ ‮ɐ‬ ‮uǝʍ‬ ‮ʌǝɹsıou‬ ‮oɟ‬ ‮Ԁsıdɥou‬ ‮qʎ‬ ‮sǝupıuƃ‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬:",
+  "about#visit-download-site": "‮Ԁʅǝɐsǝ‬ ‮ʌısıʇ‬ ‮ʇɥǝ‬ ‮ʍǝqsıʇǝ‬ ‮ʇo‬ <strong><a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮ɐ‬ ‮uǝʍ‬ ‮ʌǝɹsıou‬</a></strong> ‮oɹ‬ ‮ʇo‬ <strong><a class=\"InfoURL\" href=\"#\">‮ƃǝʇ‬ ‮ɥǝʅd‬ ‮ɐup‬ ‮ıuɟoɹɯɐʇıou‬</a></strong>. ‮Ԁsıdɥou‬ ‮ıs‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮ɟoɹ‬ ‮∀upɹoıp‬ ‮ɐup‬ ‮Ｍıupoʍs‬.",
+  "about#wordart-tag": "‮Ԑǝʎoup‬ ‮Ԑoɹpǝɹs‬",
+  "appbackend#disallowed-traffic-notification-body": "‮∀ɔʇıʌɐʇǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬ ‮ʇo‬ ‮nuʅoɔʞ‬ ‮ʇɥǝ‬ ‮ɟnʅʅ‬ ‮doʇǝuʇıɐʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ǝxdǝɹıǝuɔǝ‬.",
+  "appbackend#disallowed-traffic-notification-title": "‮∀dds‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬?",
+  "appbackend#minimized-to-systray-body": "‮Ↄʅıɔʞ‬ ‮ʇɥǝ‬ ‮ıɔou‬ ‮ʇo‬ ‮ɹǝsʇoɹǝ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬",
+  "appbackend#minimized-to-systray-title": "‮Ԁsıdɥou‬ ‮ɥɐs‬ ‮qǝǝu‬ ‮ɯıuıɯızǝp‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬",
+  "appbackend#os-unsupported": "‮Ԁsıdɥou‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮snddoɹʇs‬ ‮Ｍıupoʍs‬ ‮XԀ‬ ‮oɹ‬ ‮Ʌısʇɐ‬.\n‮Ԁʅǝɐsǝ‬ ‮ʌısıʇ‬ ‮onɹ‬ ‮ʍǝqsıʇǝ‬ ‮ɟoɹ‬ ‮ɯoɹǝ‬ ‮ıuɟoɹɯɐʇıou‬.",
+  "appbackend#state-connected-body": "‮Ǝxdʅoɹǝ‬ ‮qǝʎoup‬ ‮ʎonɹ‬ ‮qoɹpǝɹs‬!",
+  "appbackend#state-connected-reminder-body": "‮Ӽǝǝd‬ ‮Ԁsıdɥou‬ ‮ɟɹǝǝ‬. ‮Ↄʅıɔʞ‬ ‮ɥǝɹǝ‬ ‮ʇo‬ ‮ʌısıʇ‬ ‮onɹ‬ ‮sdousoɹ‬ ‮dɐƃǝs‬!",
+  "appbackend#state-connected-reminder-body-2": "‮Ӽǝǝd‬ ‮Ԁsıdɥou‬ ‮ɟɹǝǝ‬ ‮qʎ‬ ‮ʌısıʇıuƃ‬ ‮onɹ‬ ‮sdousoɹ‬ ‮dɐƃǝs‬!",
+  "appbackend#state-connected-reminder-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ʞǝǝdıuƃ‬ ‮ʎon‬ ‮ɔouuǝɔʇǝp‬",
+  "appbackend#state-connected-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔouuǝɔʇǝp‬",
+  "appbackend#state-starting-body": "‮Ԁʅǝɐsǝ‬ ‮ʍɐıʇ‬…",
+  "appbackend#state-starting-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔouuǝɔʇıuƃ‬",
+  "appbackend#state-stopped-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮pısɔouuǝɔʇǝp‬",
+  "banner#long-connecting": "<strong>‮Oɥ‬ ‮uo‬!</strong> ‮ʎon‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮ɥɐʌıuƃ‬ ‮ʇɹonqʅǝ‬ ‮ɔouuǝɔʇıuƃ‬!<br>\n‮poʍuʅoɐp‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬ ‮oɟ‬ ‮Ԁsıdɥou‬ ‮ɟɹoɯ‬ ‮ʇɥǝ‬ <a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮sıʇǝ‬</a>\n‮oɹ‬ ‮qʎ‬ ‮sǝupıuƃ‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬ <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "banner#sponsored-by": "‮Sdousoɹǝp‬ ‮qʎ‬",
+  "connection#connect-btn": "‮Ↄouuǝɔʇ‬",
+  "connection#connected-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮ɔouuǝɔʇǝp‬</span>",
+  "connection#disconnect-btn": "‮pısɔouuǝɔʇ‬",
+  "connection#egress-region-combo-label": "‮Sǝʅǝɔʇ‬ ‮sǝɹʌǝɹ‬ ‮ɹǝƃıou‬",
+  "connection#starting-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮ɔouuǝɔʇıuƃ‬</span>…",
+  "connection#stop-btn": "‮Sʇod‬",
+  "connection#stopped-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮pısɔouuǝɔʇǝp‬</span>",
+  "connection#stopping-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮pısɔouuǝɔʇıuƃ‬</span>…",
+  "connection#wait-btn": "‮Ԁʅǝɐsǝ‬ ‮ʍɐıʇ‬…",
+  "feedback#diagnostic_check": "‮∩dʅoɐp‬ ‮pıɐƃuosʇıɔ‬ ‮pɐʇɐ‬. ‮Ԁʅǝɐsǝ‬ ‮uoʇǝ‬ ‮ʇɥɐʇ‬ ‮ʇɥıs‬ ‮pıɐƃuosʇıɔ‬ ‮pɐʇɐ‬ ‮poǝs‬ ‮uoʇ‬ ‮ıpǝuʇıɟʎ‬ ‮ʎon‬, ‮ɐup‬ ‮ıʇ‬ ‮ʍıʅʅ‬ ‮ɥǝʅd‬ ‮ns‬ ‮ʇo‬ ‮ʞǝǝd‬ ‮Ԁsıdɥou‬ ‮ɹnuuıuƃ‬ ‮sɯooʇɥʅʎ‬. <a class=\"DataCollectionInfoURL\" href=\"#\">‮Ↄʅıɔʞ‬ ‮ɥǝɹǝ‬ ‮ʇo‬ ‮sǝǝ‬ ‮ʍɥɐʇ‬ ‮pɐʇɐ‬ ‮ʍǝ‬ ‮ɔoʅʅǝɔʇ‬.</a>",
+  "feedback#smiley_happy": "‮Ԁsıdɥou‬ ‮ɔouuǝɔʇs‬ ‮ɐup‬ ‮dǝɹɟoɹɯs‬ ‮ʇɥǝ‬ ‮ʍɐʎ‬ ‮I‬ ‮ʍɐuʇ‬ ‮ıʇ‬ ‮ʇo‬.",
+  "feedback#smiley_sad": "‮Ԁsıdɥou‬ ‮oɟʇǝu‬ ‮ɟɐıʅs‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮oɹ‬ ‮poǝsu‬'‮ʇ‬ ‮dǝɹɟoɹɯ‬ ‮ʍǝʅʅ‬ ‮ǝuonƃɥ‬.",
+  "feedback#submit_button": "‮Snqɯıʇ‬",
+  "feedback#success-message": "<strong>‮⊥ɥɐuʞ‬ ‮ʎon‬!</strong> ‮ʎonɹ‬ ‮ɟǝǝpqɐɔʞ‬ ‮ɥɐs‬ ‮qǝǝu‬ ‮sǝuʇ‬.",
+  "feedback#text_feedback_bottom_para": "‮Iɟ‬ ‮ʇɥǝ‬ ‮ɐqoʌǝ‬ ‮ɟoɹɯ‬ ‮ıs‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬, ‮oɹ‬ ‮ʎon‬ ‮ʍonʅp‬ ‮ʅıʞǝ‬ ‮ʇo‬ ‮sǝup‬ ‮sɔɹǝǝusɥoʇs‬, ‮dʅǝɐsǝ‬ ‮ǝɯɐıʅ‬ ‮ns‬ ‮ɐʇ‬ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">‮ɟǝǝpqɐɔʞ‬@‮dsıdɥou‬.‮ɔɐ‬</a>.",
+  "feedback#text_feedback_email_prompt": "‮Iɟ‬ ‮ʎon‬ ‮ʍonʅp‬ ‮ʅıʞǝ‬ ‮ns‬ ‮ʇo‬ ‮ɹǝsdoup‬ ‮ʇo‬ ‮ʎon‬, ‮dʅǝɐsǝ‬ ‮ǝuʇǝɹ‬ ‮ʎonɹ‬ ‮ǝɯɐıʅ‬ ‮ɐppɹǝss‬:",
+  "feedback#text_feedback_prompt": "‮Ԁʅǝɐsǝ‬ ‮ǝuʇǝɹ‬ ‮ʎonɹ‬ ‮ɔoɯɯǝuʇs‬ ‮ɥǝɹǝ‬:",
+  "feedback#top_content_title": "‮פıʌǝ‬ ‮∩s‬ ‮ʎonɹ‬ ‮ɟǝǝpqɐɔʞ‬",
+  "feedback#top_para_2": "‮Wɐuʎ‬ ‮dɹoqʅǝɯs‬ ‮ɔɐu‬ ‮qǝ‬ ‮ɟıxǝp‬ ‮qʎ‬ ‮poʍuʅoɐpıuƃ‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬. ‮ʎon‬ ‮ɔɐu‬ <a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬ ‮qʎ‬ ‮ɔʅıɔʞıuƃ‬ ‮ɥǝɹǝ‬</a>, ‮oɹ‬ ‮ʎon‬ ‮ɔɐu‬ ‮sǝup‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬ <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "‮ʎon‬ ‮ɔɐu‬ ‮ɐʅso‬ ‮ɟıup‬ ‮soʅnʇıous‬ ‮ʇo‬ ‮ɯɐuʎ‬ ‮ɔoɯɯou‬ ‮dɹoqʅǝɯs‬ ‮ıu‬ ‮onɹ‬ <a class=\"FaqURL\" href=\"#\">‮ɟɹǝbnǝuʇʅʎ‬ ‮∀sʞǝp‬ ‮Ònǝsʇıous‬</a>.",
+  "general#modal-close-button": "‮Ↄʅosǝ‬",
+  "general#notice-modal-tech-preamble": "‮Hǝɹǝ‬ ‮ıs‬ ‮ʇɥǝ‬ ‮ʇǝɔɥuıɔɐʅ‬ ‮ǝɹɹoɹ‬ ‮ıuɟo‬:",
+  "language#success-message": "<strong>‮Hǝʅʅo‬!</strong> ‮Ｍǝʅɔoɯǝ‬ ‮ʇo‬ ‮Ԁsıdɥou‬.",
+  "logs#placeholder": "‮No‬ ‮ʅoƃs‬ ‮ʎǝʇ‬",
+  "logs#show-debug-label": "‮Sɥoʍ‬ ‮pǝqnƃ‬ ‮ʅoƃs‬",
+  "nav#about": "‮∀qonʇ‬",
+  "nav#connection#connected": "‮Ↄouuǝɔʇǝp‬",
+  "nav#connection#starting": "‮Ↄouuǝɔʇıuƃ‬",
+  "nav#connection#stopped": "‮pısɔouuǝɔʇǝp‬",
+  "nav#connection#stopping": "‮pısɔouuǝɔʇıuƃ‬",
+  "nav#feedback": "‮ɟǝǝpqɐɔʞ‬",
+  "nav#logs": "‮˥oƃs‬",
+  "nav#settings": "‮Sǝʇʇıuƃs‬",
+  "notice#disallowed-traffic-alert-body": "<p>‮∀dds‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬?</p>\n<p>‮Soɯǝ‬ ‮ıuʇǝɹuǝʇ‬ ‮ʇɹɐɟɟıɔ‬ ‮ıs‬ ‮uoʇ‬ ‮snddoɹʇǝp‬ ‮ʍıʇɥonʇ‬ ‮ɐu‬ ‮ɐɔʇıʌǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬. ‮∀ɔʇıʌɐʇǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬ ‮ʍıʇɥ‬ ‮ԀsıↃɐsɥ‬ ‮ʇo‬ ‮nuʅoɔʞ‬ ‮ʇɥǝ‬ ‮ɟnʅʅ‬ ‮doʇǝuʇıɐʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ǝxdǝɹıǝuɔǝ‬.</p>",
+  "notice#disallowed-traffic-alert-title": "‮∩dƃɹɐpǝ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ɔouuǝɔʇıou‬",
+  "notice#systemproxysettings-setproxy-error-body": "<p>‮Ԁsıdɥou‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮sǝʇ‬ ‮ʇɥǝ‬ ‮sʎsʇǝɯ‬’‮s‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬.</p>\n<p>‮⊥ɥıs‬ ‮ɯıƃɥʇ‬ ‮qǝ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɔouɟʅıɔʇ‬ ‮ʍıʇɥ‬ ‮ʎonɹ‬ ‮ɐuʇıʌıɹns‬ ‮soɟʇʍɐɹǝ‬. ‮ʎon‬ ‮ɯıƃɥʇ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ɯɐunɐʅʅʎ‬ ‮ɔouɟıƃnɹǝ‬ ‮ʎonɹ‬ ‮ɐddʅıɔɐʇıou‬ ‮oɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ʇo‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮ʅoɔɐʅ‬ ‮Ԁsıdɥou‬ ‮dɹoxıǝs‬.</p>",
+  "notice#systemproxysettings-setproxy-error-title": "‮Sʎsʇǝɯ‬ ‮Ԁɹoxʎ‬ ‮Ǝɹɹoɹ‬",
+  "notice#systemproxysettings-setproxy-warning-template": "‮Ԁsıdɥou‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮sǝʇ‬ ‮ʇɥǝ‬ ‮sʎsʇǝɯ‬’‮s‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ɟoɹ‬ ‮ʇɥǝ‬ ‮Iuʇǝɹuǝʇ‬ ‮ɔouuǝɔʇıou‬ ‮uɐɯǝp‬ “<%- data %>”. ‮⊥ɥıs‬ ‮ɯıƃɥʇ‬ ‮qǝ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɔouɟʅıɔʇ‬ ‮ʍıʇɥ‬ ‮ʎonɹ‬ ‮ɐuʇıʌıɹns‬ ‮soɟʇʍɐɹǝ‬. ‮ʎon‬ ‮ɯıƃɥʇ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ɯɐunɐʅʅʎ‬ ‮ɔouɟıƃnɹǝ‬ ‮ʎonɹ‬ ‮ɐddʅıɔɐʇıou‬ ‮oɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ʇo‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮ʅoɔɐʅ‬ ‮Ԁsıdɥou‬ ‮dɹoxıǝs‬.",
+  "positive-value-indicator": "+%d",
+  "psicash#1-day": "1 ‮pɐʎ‬",
+  "psicash#1-hour": "1 ‮ɥonɹ‬",
+  "psicash#init-error-body-recovered": "‮ԀsıↃɐsɥ‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮ıuıʇıɐʅızǝ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮dɹoqɐqʅʎ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɟıʅǝ‬ ‮sʎsʇǝɯ‬ ‮dɹoqʅǝɯ‬, ‮snɔɥ‬ ‮ɐs‬ ‮qǝıuƃ‬ ‮onʇ‬ ‮oɟ‬ ‮pısʞ‬ ‮sdɐɔǝ‬. ‮ʎonɹ‬ ‮qɐʅɐuɔǝ‬ ‮ɐup‬ ‮oʇɥǝɹ‬ ‮sʇɐʇǝ‬ ‮ɥɐʌǝ‬ ‮qǝǝu‬ ‮ɹǝsǝʇ‬.",
+  "psicash#init-error-body-unrecovered": "‮ԀsıↃɐsɥ‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮ıuıʇıɐʅızǝ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮dɹoqɐqʅʎ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɟıʅǝ‬ ‮sʎsʇǝɯ‬ ‮dɹoqʅǝɯ‬, ‮snɔɥ‬ ‮ɐs‬ ‮qǝıuƃ‬ ‮onʇ‬ ‮oɟ‬ ‮pısʞ‬ ‮sdɐɔǝ‬. ‮ʎonɹ‬ ‮qɐʅɐuɔǝ‬ ‮ɐup‬ ‮oʇɥǝɹ‬ ‮sʇɐʇǝ‬ ‮ɥɐʌǝ‬ ‮qǝǝu‬ ‮ʅosʇ‬. ‮ԀsıↃɐsɥ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮qǝ‬ ‮nsɐqʅǝ‬. ‮ʎon‬ ‮ɔɐu‬ ‮ʇɹʎ‬ ‮ɹǝsʇɐɹʇıuƃ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬ ‮ʇo‬ ‮ɹǝɔoʌǝɹ‬ ‮ɟɹoɯ‬ ‮ʇɥǝ‬ ‮dɹoqʅǝɯ‬.",
+  "psicash#init-error-title": "‮ԀsıↃɐsɥ‬ ‮ıuıʇıɐʅızɐʇıou‬ ‮ǝɹɹoɹ‬",
+  "psicash#mustconnect-modal#body": "‮Iu‬ ‮oɹpǝɹ‬ ‮ʇo‬ ‮nsǝ‬ ‮ԀsıↃɐsɥ‬, ‮ʎon‬ ‮ɯnsʇ‬ ‮qǝ‬ ‮ɔouuǝɔʇǝp‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮uǝʇʍoɹʞ‬.",
+  "psicash#mustconnect-modal#title": "‮Ԁsıdɥou‬ ‮Ↄouuǝɔʇıou‬ ‮ᴚǝbnıɹǝp‬",
+  "psicash#psiphon-speed": "‮Ԁsıdɥou‬<br>‮Sdǝǝp‬",
+  "psicash#transaction-ExistingTransaction-body": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɐu‬ ‮ǝxısʇıuƃ‬ ‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮oɟ‬ ‮ʇɥıs‬ ‮ʇʎdǝ‬. ‮∀uoʇɥǝɹ‬ ‮dnɹɔɥɐsǝ‬ ‮oɟ‬ ‮ʇɥıs‬ ‮ʇʎdǝ‬ ‮ıs‬ ‮uoʇ‬ ‮ɐʅʅoʍǝp‬ ‮nuʇıʅ‬ ‮ʇɥǝ‬ ‮dɹǝʌıons‬ ‮ouǝ‬ ‮ǝxdıɹǝs‬. ‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮sʇɐʇǝ‬ ‮ʍıʅʅ‬ ‮qǝ‬ ‮ɹǝɟɹǝsɥǝp‬ ‮uoʍ‬.",
+  "psicash#transaction-ExistingTransaction-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ǝxısʇs‬",
+  "psicash#transaction-InsufficientBalance-body": "‮ʎon‬ ‮po‬ ‮uoʇ‬ ‮ɥɐʌǝ‬ ‮snɟɟıɔıǝuʇ‬ ‮ԀsıↃɐsɥ‬ ‮qɐʅɐuɔǝ‬ ‮ɟoɹ‬ ‮ʇɥıs‬ ‮dnɹɔɥɐsǝ‬.",
+  "psicash#transaction-InsufficientBalance-title": "‮Iusnɟɟıɔıǝuʇ‬ ‮ԀsıↃɐsɥ‬ ‮qɐʅɐuɔǝ‬",
+  "psicash#transaction-InvalidTokens-body": "‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮ʇoʞǝus‬ ‮ɐɹǝ‬ ‮ıuʌɐʅıp‬. ‮⊥ɹʎ‬ ‮ɹǝsʇɐɹʇıuƃ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬. ‮Iɟ‬ ‮ʇɥɐʇ‬ ‮poǝsu‬'‮ʇ‬ ‮ʍoɹʞ‬, ‮ʎon‬ ‮ʍıʅʅ‬ ‮uǝǝp‬ ‮ʇo‬ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">‮ɔʅǝɐɹ‬ ‮ʎonɹ‬ ‮ʅoɔɐʅ‬ ‮sʇoɹɐƃǝ‬</a>.",
+  "psicash#transaction-InvalidTokens-title": "‮Iuʌɐʅıp‬ ‮ԀsıↃɐsɥ‬ ‮ʇoʞǝus‬",
+  "psicash#transaction-ServerError-body": "‮⊥ɥǝ‬ ‮ԀsıↃɐsɥ‬ ‮sǝɹʌǝɹ‬ ‮ɹǝsdoupǝp‬ ‮ʍıʇɥ‬ ‮ɐu‬ ‮ǝɹɹoɹ‬ ‮ʍɥıʅǝ‬ ‮ʇɹʎıuƃ‬ ‮ʇo‬ ‮ɯɐʞǝ‬ ‮ʇɥǝ‬ ‮dnɹɔɥɐsǝ‬. ‮Ԁʅǝɐsǝ‬ ‮ɹǝʇɹʎ‬ ‮ʎonɹ‬ ‮dnɹɔɥɐsǝ‬ ‮ʅɐʇǝɹ‬.",
+  "psicash#transaction-ServerError-title": "‮ԀsıↃɐsɥ‬ ‮sǝɹʌǝɹ‬ ‮ǝɹɹoɹ‬",
+  "psicash#transaction-TransactionAmountMismatch-body": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮dɹıɔǝs‬ ‮ɐɹǝ‬ ‮onʇ‬-‮oɟ‬-‮pɐʇǝ‬. ‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮sʇɐʇǝ‬ ‮ʍıʅʅ‬ ‮qǝ‬ ‮ɹǝɟɹǝsɥǝp‬ ‮uoʍ‬.",
+  "psicash#transaction-TransactionAmountMismatch-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮dɹıɔǝ‬ ‮ɯısɯɐʇɔɥ‬",
+  "psicash#transaction-TransactionTypeNotFound-body": "‮⊥ɥǝ‬ ‮dɹopnɔʇ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮ʇɹʎıuƃ‬ ‮ʇo‬ ‮qnʎ‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮ǝxısʇs‬. ‮ʎon‬ ‮ɯɐʎ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ndpɐʇǝ‬ ‮oɹ‬ ‮ɹǝıusʇɐʅʅ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬.",
+  "psicash#transaction-TransactionTypeNotFound-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮ʇʎdǝ‬ ‮uoʇ‬ ‮ɟonup‬",
+  "psicash#transaction-error-body": "‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮ʇɹɐusɐɔʇıou‬ ‮ɐʇʇǝɯdʇ‬ ‮ɟɐıʅǝp‬ ‮nuǝxdǝɔʇǝpʅʎ‬.",
+  "psicash#transaction-error-title": "‮ԀsıↃɐsɥ‬ ‮ʇɹɐusɐɔʇıou‬ ‮ǝɹɹoɹ‬",
+  "psicash#ui-buyingboost-buttontext": "‮Sʇɐɹʇıuƃ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬!",
+  "psicash#ui-buymorepsi": "‮Ԑnʎ‬ ‮ɯoɹǝ‬ ‮ԀsıↃɐsɥ‬",
+  "psicash#ui-buypsi": "‮Ԑnʎ‬ ‮ԀsıↃɐsɥ‬",
+  "psicash#ui-enoughbalance-buttontext": "‮Sʇɐɹʇ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬",
+  "psicash#ui-nsfbalance-buttontext": "‮Nǝǝpǝp‬ ‮ɟoɹ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬",
+  "psicash#ui-speedboost-active": "‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬ ‮ɐɔʇıʌǝ‬ ‮ɟoɹ‬ %s",
+  "psicash#ui-zerobalance-title": "‮Nǝǝp‬ ‮ɐ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬?",
+  "settings#apply-button": "‮∀ddʅʎ‬ ‮Ↄɥɐuƃǝs‬",
+  "settings#applying-message": "‮ᴚǝɔouuǝɔʇıuƃ‬ ‮ʇo‬ ‮ɐddʅʎ‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬.",
+  "settings#disable-timeouts#enable-label": "‮pısɐqʅǝ‬ ‮ʇıɯǝonʇs‬ ‮ɟoɹ‬ ‮sʅoʍ‬ ‮uǝʇʍoɹʞs‬",
+  "settings#disable-timeouts#heading": "‮pısɐqʅǝ‬ ‮⊥ıɯǝonʇs‬ ‮ɟoɹ‬ ‮Sʅoʍ‬ ‮Nǝʇʍoɹʞs‬",
+  "settings#disable-timeouts#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ɔoɯɯnuıɔɐʇıou‬ ‮ʍıʇɥ‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮ʇıɯǝ‬ ‮onʇ‬.",
+  "settings#disable-timeouts#reason": "‮Ｍɥǝu‬ ‮ǝuɐqʅıuƃ‬ ‮ʇɥıs‬ ‮ɟoɹ‬ ‮ɐ‬ ‮ʌǝɹʎ‬ ‮sʅoʍ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬, ‮ʎon‬ ‮ɐɹǝ‬ ‮ʅǝss‬ ‮ʅıʞǝʅʎ‬ ‮ʇo‬ ‮ǝxdǝɹıǝuɔǝ‬ ‮nuǝxdǝɔʇǝp‬ ‮pısɔouuǝɔʇıous‬.",
+  "settings#disallowed-traffic-alert#disable-label": "‮pısɐqʅǝ‬ ‮pısɐʅʅoʍǝp‬ ‮ʇɹɐɟɟıɔ‬ ‮ɐʅǝɹʇs‬",
+  "settings#disallowed-traffic-alert#heading": "‮pısɐʅʅoʍǝp‬ ‮⊥ɹɐɟɟıɔ‬ ‮∀ʅǝɹʇ‬",
+  "settings#disallowed-traffic-alert#help-text": "‮Soɯǝ‬ ‮ʇʎdǝs‬ ‮oɟ‬ ‮ıuʇǝɹuǝʇ‬ ‮ʇɹɐɟɟıɔ‬ ‮ɐɹǝ‬ ‮uoʇ‬ ‮snddoɹʇǝp‬ ‮ʍıʇɥonʇ‬ ‮ɐu‬ ‮ɐɔʇıʌǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬. ‮Ｍɥǝu‬ ‮snɔɥ‬ ‮ʇɹɐɟɟıɔ‬ ‮ıs‬ ‮pısɐʅʅoʍǝp‬, ‮ɐu‬ ‮ɐʅǝɹʇ‬ ‮ıs‬ ‮sɥoʍu‬. (‮ᴚǝ‬-‮ǝuɐqʅıuƃ‬ ‮ʍıʅʅ‬ ‮ɹǝbnıɹǝ‬ ‮ɐ‬ ‮ɹǝɔouuǝɔʇıou‬.)",
+  "settings#egress-region#default": "‮Ↄɥoosıuƃ‬ ‮ʇɥǝ‬ ‮pǝɟɐnʅʇ‬ <strong>“‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬”</strong> ‮odʇıou‬ ‮ɐʅʅoʍs‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮ɔɥoosǝ‬ ‮ɐ‬ ‮sǝɹʌǝɹ‬, ‮ʍɥıɔɥ‬ ‮ʍıʅʅ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮ɹǝsnʅʇ‬ ‮ıu‬ ‮ʇɥǝ‬ ‮qǝsʇ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬.",
+  "settings#egress-region#description": "‮Ԁsıdɥou‬ ‮ɥɐs‬ ‮sǝɹʌǝɹs‬ ‮ıu‬ ‮ɯɐuʎ‬ ‮pıɟɟǝɹǝuʇ‬ ‮ɔonuʇɹıǝs‬ ‮ɐup‬ ‮ɹǝƃıous‬. ‮∩sıuƃ‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ıu‬ ‮ɐ‬ ‮ɹǝƃıou‬ ‮ɔʅosǝ‬ ‮ʇo‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ʍıʅʅ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮qǝʇʇǝɹ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬, ‮qnʇ‬ ‮ʎon‬ ‮ɯɐʎ‬ ‮ʍısɥ‬ ‮ʇo‬ ‮ɐɔɔǝss‬ ‮ʍǝqsıʇǝs‬ ‮ɐup‬ ‮sǝɹʌıɔǝs‬ ‮ʅıʞǝ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮ʌıɹʇnɐʅʅʎ‬ ‮ıu‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ɔonuʇɹʎ‬ ‮oɹ‬ ‮ɹǝƃıou‬.",
+  "settings#egress-region#error-modal-body-http": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sǝɹʌǝɹ‬ ‮ıu‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ɹǝƃıou‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮ɹǝƃıou‬ ‮ıs‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮ɐʌɐıʅɐqʅǝ‬.<br>\n‮ʎon‬ ‮ɯnsʇ‬ ‮ɔɥoosǝ‬ ‮ɐ‬ ‮uǝʍ‬ ‮ɹǝƃıou‬ ‮oɹ‬ ‮ɔɥɐuƃǝ‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮pǝɟɐnʅʇ‬ “‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬” ‮ɔɥoıɔǝ‬.",
+  "settings#egress-region#error-modal-title": "‮Sǝɹʌǝɹ‬ ‮ᴚǝƃıou‬ ‮∩uɐʌɐıʅɐqʅǝ‬",
+  "settings#egress-region#heading": "‮Ԁsıdɥou‬ ‮Sǝɹʌǝɹ‬ ‮ᴚǝƃıou‬",
+  "settings#egress-region#invalid-error-msg": "‮Ↄɥoosǝ‬ ‮ɐ‬ ‮ʌɐʅıp‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ɹǝƃıou‬.",
+  "settings#egress-region#select-at": "‮∀nsʇɹıɐ‬",
+  "settings#egress-region#select-au": "‮∀nsʇɹɐʅıɐ‬",
+  "settings#egress-region#select-be": "‮Ԑǝʅƃınɯ‬",
+  "settings#egress-region#select-best-performance": "‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬",
+  "settings#egress-region#select-bg": "‮Ԑnʅƃɐɹıɐ‬",
+  "settings#egress-region#select-ca": "‮Ↄɐuɐpɐ‬",
+  "settings#egress-region#select-ch": "‮Sʍıʇzǝɹʅɐup‬",
+  "settings#egress-region#select-cz": "‮Ↄzǝɔɥ‬ ‮ᴚǝdnqʅıɔ‬",
+  "settings#egress-region#select-de": "‮פǝɹɯɐuʎ‬",
+  "settings#egress-region#select-dk": "‮pǝuɯɐɹʞ‬",
+  "settings#egress-region#select-es": "‮Sdɐıu‬",
+  "settings#egress-region#select-fr": "‮ɟɹɐuɔǝ‬",
+  "settings#egress-region#select-gb": "‮∩uıʇǝp‬ ‮Ӽıuƃpoɯ‬",
+  "settings#egress-region#select-hk": "‮Houƃ‬ ‮Ӽouƃ‬",
+  "settings#egress-region#select-hu": "‮Hnuƃɐɹʎ‬",
+  "settings#egress-region#select-in": "‮Iupıɐ‬",
+  "settings#egress-region#select-it": "‮Iʇɐʅʎ‬",
+  "settings#egress-region#select-jp": "‮ſɐdɐu‬",
+  "settings#egress-region#select-nl": "‮Nǝʇɥǝɹʅɐups‬",
+  "settings#egress-region#select-no": "‮Noɹʍɐʎ‬",
+  "settings#egress-region#select-pl": "‮Ԁoʅɐup‬",
+  "settings#egress-region#select-ro": "‮ᴚoɯɐuıɐ‬",
+  "settings#egress-region#select-rs": "‮Sǝɹqıɐ‬",
+  "settings#egress-region#select-se": "‮Sʍǝpǝu‬",
+  "settings#egress-region#select-sg": "‮Sıuƃɐdoɹǝ‬",
+  "settings#egress-region#select-sk": "‮Sʅoʌɐʞıɐ‬",
+  "settings#egress-region#select-us": "‮∩uıʇǝp‬ ‮Sʇɐʇǝs‬",
+  "settings#error-alert": "<strong>‮Ǝɹɹoɹ‬!</strong> ‮Ԁʅǝɐsǝ‬ ‮ɟıx‬ ‮ıuɔoɹɹǝɔʇ‬ ‮ʌɐʅnǝs‬ ‮qǝɟoɹǝ‬ ‮dɹoɔǝǝpıuƃ‬.",
+  "settings#error-modal#body": "‮⊥ɥǝɹǝ‬ ‮ɐɹǝ‬ ‮ǝɹɹoɹs‬ ‮ıu‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬ ‮ʌɐʅnǝs‬. ‮Ԁʅǝɐsǝ‬ ‮ɔoɹɹǝɔʇ‬ ‮ʇɥǝɯ‬ ‮qǝɟoɹǝ‬ ‮dɹoɔǝǝpıuƃ‬.",
+  "settings#error-modal#title": "‮Sǝʇʇıuƃs‬ ‮Ǝɹɹoɹ‬",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\n‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮ɟoɹ‬ ‮ıʇs‬ ‮H⊥⊥Ԁ‬ ‮dɹoxʎ‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮doɹʇ‬ ‮ɐddǝɐɹs‬ ‮ʇo‬ ‮qǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ıu‬ ‮nsǝ‬ ‮ɐup‬ ‮so‬ ‮Ԁsıdɥou‬ ‮ɔɐuuoʇ‬ ‮nsǝ‬ ‮ıʇ‬.\n</p>\n<p>\n‮Ԁʅǝɐsǝ‬ ‮ɔɥɐuƃǝ‬ ‮ʇɥǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮H⊥⊥Ԁ‬ ‮dɹoxʎ‬ ‮doɹʇ‬ ‮ʌɐʅnǝ‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬. ‮Ｍǝ‬ ‮ɹǝɔoɯɯǝupǝp‬ ‮ʇɥɐʇ‬ ‮ʎon‬ ‮ɔʅǝɐɹ‬ ‮ʇɥǝ‬ ‮ʌɐʅnǝ‬ ‮so‬ ‮ʇɥɐʇ‬ ‮Ԁsıdɥou‬ ‮ɔɐu‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮dıɔʞ‬ ‮ɐu‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮doɹʇ‬.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\n‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮ɟoɹ‬ ‮ıʇs‬ ‮SOↃӼS‬ ‮dɹoxʎ‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮doɹʇ‬ ‮ɐddǝɐɹs‬ ‮ʇo‬ ‮qǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ıu‬ ‮nsǝ‬ ‮ɐup‬ ‮so‬ ‮Ԁsıdɥou‬ ‮ɔɐuuoʇ‬ ‮nsǝ‬ ‮ıʇ‬.\n</p>\n<p>\n‮Ԁʅǝɐsǝ‬ ‮ɔɥɐuƃǝ‬ ‮ʇɥǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮SOↃӼS‬ ‮dɹoxʎ‬ ‮doɹʇ‬ ‮ʌɐʅnǝ‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬. ‮Ｍǝ‬ ‮ɹǝɔoɯɯǝupǝp‬ ‮ʇɥɐʇ‬ ‮ʎon‬ ‮ɔʅǝɐɹ‬ ‮ʇɥǝ‬ ‮ʌɐʅnǝ‬ ‮so‬ ‮ʇɥɐʇ‬ ‮Ԁsıdɥou‬ ‮ɔɐu‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮dıɔʞ‬ ‮ɐu‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮doɹʇ‬.\n</p>",
+  "settings#local-proxy-ports#error-modal-title": "‮˥oɔɐʅ‬ ‮Ԁɹoxʎ‬ ‮Ԁoɹʇ‬ ‮Ↄouɟʅıɔʇ‬",
+  "settings#local-proxy-ports#heading": "‮˥oɔɐʅ‬ ‮Ԁɹoxʎ‬ ‮Ԁoɹʇs‬",
+  "settings#local-proxy-ports#http-label": "‮H⊥⊥Ԁ‬/‮H⊥⊥ԀS‬",
+  "settings#local-proxy-ports#leave-blank": "‮˥ǝɐʌǝ‬ <strong>‮qʅɐuʞ‬</strong> ‮ɟoɹ‬ ‮ɐnʇoɯɐʇıɔ‬ ‮doɹʇ‬ ‮sǝʅǝɔʇıou‬ (‮ɹǝɔoɯɯǝupǝp‬).",
+  "settings#local-proxy-ports#reason": "‮Iɟ‬ ‮ʎon‬ ‮nsǝ‬ ‮ʇooʅs‬ ‮ou‬ ‮ʎonɹ‬ ‮ɔoɯdnʇǝɹ‬ ‮ʇɥɐʇ‬ ‮ɹǝbnıɹǝ‬ ‮ɯɐunɐʅ‬ ‮ɔouɟıƃnɹɐʇıou‬ ‮ʇo‬ ‮ʍoɹʞ‬ ‮ʍıʇɥ‬ ‮Ԁsıdɥou‬, ‮ʎon‬ ‮ʍıʅʅ‬ ‮ʍɐuʇ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɔousısʇǝuʇʅʎ‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮sɐɯǝ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮unɯqǝɹs‬. ‮Iɟ‬ ‮ʎon‬ ‮pou‬’‮ʇ‬ ‮ɥɐʌǝ‬ ‮ɐ‬ ‮ɹǝɐsou‬ ‮ʇo‬ ‮sdǝɔıɟʎ‬ ‮doɹʇ‬ ‮unɯqǝɹs‬, ‮ʎon‬ ‮sɥonʅp‬ ‮ɐʅʅoʍ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɔɥoosǝ‬ ‮ʇɥǝɯ‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮ʇo‬ ‮ɥǝʅd‬ ‮ɐʌoıp‬ ‮ɔouɟʅıɔʇs‬.",
+  "settings#local-proxy-ports#socks-label": "‮SOↃӼS‬",
+  "settings#local-proxy-ports#unique-error-msg": "‮˥oɔɐʅ‬ ‮doɹʇs‬ ‮ɯnsʇ‬ ‮qǝ‬ ‮pısʇıuɔʇ‬ ‮ɟɹoɯ‬ ‮ǝɐɔɥ‬ ‮oʇɥǝɹ‬.",
+  "settings#port-value-error-msg": "‮Wnsʇ‬ ‮qǝ‬ ‮qǝʇʍǝǝu‬ 1 ‮ɐup‬ 65535.",
+  "settings#reset-button": "‮ᴚǝsǝʇ‬ ‮ʇo‬ ‮pǝɟɐnʅʇ‬",
+  "settings#saved-message": "‮Sǝʇʇıuƃs‬ ‮sɐʌǝp‬.",
+  "settings#split-tunnel#enable-label": "‮pou‬'‮ʇ‬ ‮dɹoxʎ‬ ‮ʍǝqsıʇǝs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɔonuʇɹʎ‬",
+  "settings#split-tunnel#heading": "‮Sdʅıʇ‬ ‮⊥nuuǝʅ‬",
+  "settings#split-tunnel#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ɹǝbnǝsʇs‬ ‮ɯɐpǝ‬ ‮ʇo‬ ‮sǝɹʌǝɹs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮qǝ‬ ‮ʇnuuǝʅǝp‬ ‮ʇɥɹonƃɥ‬ ‮Ԁsıdɥou‬.",
+  "settings#split-tunnel#reason": "‮Ｍǝqsıʇǝs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ɐɹǝ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮uoʇ‬ ‮qʅoɔʞǝp‬, ‮so‬ ‮ǝuɐqʅıuƃ‬ ‮ʇɥıs‬ ‮odʇıou‬ ‮ʍıʅʅ‬ ‮ƃıʌǝ‬ ‮ʎon‬ ‮ɟɐsʇǝɹ‬ ‮ɐɔɔǝss‬ ‮ʇo‬ ‮ʇɥosǝ‬ ‮sıʇǝs‬ ‮ɐup‬ ‮ɔɐu‬ ‮soɯǝʇıɯǝs‬ ‮ɹǝpnɔǝ‬ ‮ISԀ‬ ‮pɐʇɐ‬ ‮nsɐƃǝ‬ ‮ɔosʇs‬.",
+  "settings#systray-minimize#enable-label": "‮Wıuıɯızǝ‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬)",
+  "settings#systray-minimize#heading": "‮Wıuıɯızǝ‬ ‮ʇo‬ ‮Noʇıɟıɔɐʇıou‬ ‮∀ɹǝɐ‬ (‮Sʎsʇǝɯ‬ ‮⊥ɹɐʎ‬)",
+  "settings#systray-minimize#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ʍɥǝu‬ ‮ɯıuıɯızǝp‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮ɐddʅıɔɐʇıou‬ ‮ʍıupoʍ‬ ‮ʍıʅʅ‬ ‮ɥıpǝ‬ ‮ıu‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (‮ɐʅso‬ ‮ʞuoʍu‬ ‮ɐs‬ ‮ʇɥǝ‬ “‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬” ‮oɹ‬ “‮sʎsʇɹɐʎ‬”, ‮ʅoɔɐʇǝp‬ ‮uǝɐɹ‬ ‮ʇɥǝ‬ ‮ɔʅoɔʞ‬ ‮ou‬ ‮ʎonɹ‬ ‮Ｍıupoʍs‬ ‮ʇɐsʞ‬ ‮qɐɹ‬).",
+  "settings#systray-minimize#reason": "‮Wıuıɯızıuƃ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (“‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬”) ‮ɟɹǝǝs‬ ‮nd‬ ‮sdɐɔǝ‬ ‮ou‬ ‮ʎonɹ‬ ‮ʇɐsʞ‬ ‮qɐɹ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮ǝsdǝɔıɐʅʅʎ‬ ‮ɥǝʅdɟnʅ‬ ‮ıɟ‬ ‮ʎon‬ ‮oɟʇǝu‬ ‮ɹnu‬ ‮Ԁsıdɥou‬ ‮ɟoɹ‬ ‮ʅouƃ‬ ‮dǝɹıops‬ ‮oɟ‬ ‮ʇıɯǝ‬.",
+  "settings#transport-mode#check-label": "‮∩sǝ‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ɯopǝ‬",
+  "settings#transport-mode#heading": "‮⊥ɹɐusdoɹʇ‬ ‮Wopǝ‬",
+  "settings#transport-mode#help-text": "‮∩sǝs‬ ‮Ｍıupoʍs‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ʌıɹʇnɐʅ‬ ‮uǝʇʍoɹʞıuƃ‬. ‮⊥ɥıs‬ ‮ɯopǝ‬ ‮ʍıʅʅ‬ ‮ʇnuuǝʅ‬ ‮ɐʅʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮ɐdds‬, ‮qnʇ‬ ‮ıʇ‬ ‮poǝsu‬’‮ʇ‬ ‮dɹoʌıpǝ‬ ‮oqɟnsɔɐʇıou‬ ‮ɐup‬ ‮so‬ ‮poǝs‬ ‮uoʇ‬ ‮ɥɐʌǝ‬ ‮sʇɹouƃ‬ ‮ɔǝusoɹsɥıd‬ ‮ɔıɹɔnɯʌǝuʇıou‬ ‮ɔɐdɐqıʅıʇıǝs‬. ‮Iʇ‬ ‮ıs‬ <strong>‮uoʇ‬ ‮ɹǝɔoɯɯǝupǝp‬</strong> ‮ɟoɹ‬ ‮qʎdɐssıuƃ‬ ‮ɯosʇ‬ ‮ɟıɹǝʍɐʅʅs‬.",
+  "settings#unapplied-changes-prompt#apply-button": "‮∀ddʅʎ‬",
+  "settings#unapplied-changes-prompt#body": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɯɐpǝ‬ ‮ɔɥɐuƃǝs‬ ‮ʇo‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬, ‮qnʇ‬ ‮ʎon‬ ‮ɥɐʌǝ‬ ‮uoʇ‬ ‮ɐddʅıǝp‬ ‮ʇɥǝ‬ ‮ɔɥɐuƃǝs‬.<br><br>‮po‬ ‮ʎon‬ ‮ʍısɥ‬ ‮ʇo‬ ‮ɐddʅʎ‬ ‮ʎonɹ‬ ‮ɔɥɐuƃǝs‬ ‮uoʍ‬ ‮oɹ‬ ‮pısɔɐɹp‬ ‮ʇɥǝɯ‬?",
+  "settings#unapplied-changes-prompt#discard-button": "‮pısɔɐɹp‬",
+  "settings#unapplied-changes-prompt#title": "‮Sǝʇʇıuƃs‬ ‮Ↄɥɐuƃǝp‬",
+  "settings#upstream-proxy#by-default": "‮Iɟ‬ ‮ʎonɹ‬ ‮ɔoɯdnʇǝɹ‬ ‮ɐʅɹǝɐpʎ‬ ‮ɥɐs‬ ‮ɐ‬ ‮dɹoxʎ‬ ‮ɔouɟıƃnɹǝp‬, ‮qʎ‬ ‮pǝɟɐnʅʇ‬ ‮Ԁsıdɥou‬ ‮ʍıʅʅ‬ ‮nsǝ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬ ‮ʍɥǝu‬ ‮ǝsʇɐqʅısɥıuƃ‬ ‮ɐ‬ ‮ʇnuuǝʅ‬. ‮ʎon‬ ‮ɔɐu‬ ‮oʌǝɹɹıpǝ‬ ‮ʇɥɐʇ‬ ‮qǝɥɐʌıoɹ‬ ‮qʎ‬ ‮sdǝɔıɟʎıuƃ‬ ‮ɐ‬ ‮dɹoxʎ‬ ‮ʇo‬ ‮nsǝ‬, ‮oɹ‬ ‮qʎ‬ ‮sdǝɔıɟʎıuƃ‬ ‮ʇɥɐʇ‬ ‮uo‬ ‮snɔɥ‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬” ‮sɥonʅp‬ ‮qǝ‬ ‮nsǝp‬.",
+  "settings#upstream-proxy#domain-label": "‮poɯɐıu‬",
+  "settings#upstream-proxy#error-modal-body-configured": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐu‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬”.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʍǝ‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮nuɐqʅǝ‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮ʇo‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʇɥɹonƃɥ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬.<br>\n‮Ԁʅǝɐsǝ‬ ‮ɟıx‬ ‮ʇɥǝ‬ ‮sǝʇʇıuƃs‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬.",
+  "settings#upstream-proxy#error-modal-body-default": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔnɹɹǝuʇʅʎ‬ ‮ɔouɟıƃnɹǝp‬ ‮ʇo‬ ‮nsǝ‬ ‮ʎonɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮ɐs‬ ‮ıʇs‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬”.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʍǝ‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮nuɐqʅǝ‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮ʇo‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʇɥɹonƃɥ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬.<br>\n‮Ԁʅǝɐsǝ‬ ‮ǝuɐqʅǝ‬ “‮pou‬'‮ʇ‬ ‮nsǝ‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬” ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬.",
+  "settings#upstream-proxy#error-modal-title": "‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬ ‮Ǝɹɹoɹ‬",
+  "settings#upstream-proxy#heading": "‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬",
+  "settings#upstream-proxy#hostname-label": "‮Hosʇuɐɯǝ‬",
+  "settings#upstream-proxy#password-label": "‮Ԁɐssʍoɹp‬",
+  "settings#upstream-proxy#port-label": "‮Ԁoɹʇ‬",
+  "settings#upstream-proxy#proxy-reqs": "‮Ouʅʎ‬ ‮H⊥⊥Ԁ‬ ‮dɹoxıǝs‬ ‮ʇɥɐʇ‬ ‮snddoɹʇ‬ ‮H⊥⊥ԀS‬ ‮ɐɹǝ‬ ‮ɐʅʅoʍǝp‬.",
+  "settings#upstream-proxy#reason": "‮∩dsʇɹǝɐɯ‬ ‮dɹoxıǝs‬ ‮ɐɹǝ‬ ‮soɯǝʇıɯǝs‬ ‮ɹǝbnıɹǝp‬ ‮qʎ‬ ‮sɔɥooʅs‬, ‮nuıʌǝɹsıʇıǝs‬, ‮oɹ‬ ‮qnsıuǝssǝs‬. ‮Iɟ‬ ‮ʎonɹ‬ ‮uǝʇʍoɹʞ‬ ‮dɹoʌıpǝɹ‬ ‮ɥɐs‬ ‮ƃıʌǝu‬ ‮ʎon‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬, ‮ʇɥǝu‬ ‮ɯɐunɐʅʅʎ‬ ‮sǝʇʇıuƃ‬ ‮ʇɥǝɯ‬ ‮ɥǝɹǝ‬ ‮ɯɐʎ‬ ‮qǝ‬ ‮ɹǝbnıɹǝp‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬.",
+  "settings#upstream-proxy#set-hostname-error-msg": "‮ʎon‬ ‮ɯnsʇ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮Hosʇuɐɯǝ‬, ‮oɹ‬ ‮ʅǝɐʌǝ‬ ‮ɐʅʅ‬ ‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬ ‮ɟıǝʅps‬ ‮qʅɐuʞ‬ ‮ɟoɹ‬ ‮ɐnʇoɯɐʇıɔ‬ ‮sǝʅǝɔʇıou‬.",
+  "settings#upstream-proxy#set-username-error-msg": "‮ʎon‬ ‮ɯnsʇ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮∩sǝɹuɐɯǝ‬ ‮ıɟ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮sǝʇʇıuƃ‬ ‮Ԁɐssʍoɹp‬ ‮oɹ‬ ‮poɯɐıu‬; ‮oɹ‬ ‮ʅǝɐʌǝ‬ ‮ɐʅʅ‬ ‮ɐnʇɥǝuʇıɔɐʇıou‬ ‮ɟıǝʅps‬ ‮qʅɐuʞ‬ ‮ɟoɹ‬ ‮uo‬ ‮ɐnʇɥǝuʇıɔɐʇıou‬.",
+  "settings#upstream-proxy#skip-label": "‮pou‬'‮ʇ‬ ‮nsǝ‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬",
+  "settings#upstream-proxy#username-label": "‮∩sǝɹuɐɯǝ‬",
+  "settings#vpn-incompatible-label": "‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬",
+  "settings#vpn-incompatible-msg": "(‮poǝsu‬'‮ʇ‬ ‮ʍoɹʞ‬ ‮ʍıʇɥ‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ɯopǝ‬.)"
+};
\ No newline at end of file
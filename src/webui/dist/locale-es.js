@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["es"].translation = {
+  "banner#long-connecting": "<strong>¡Oh no!</strong> ¡Parece que está teniendo problemas al conectar!<br>\nDescargue la última versión de Psiphon del <a class=\"NewVersionURL\" href=\"#\">sitio de descargas</a>\nenvíenos un correo electrónico para facilitársela a <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Conectando",
+  "nav#connection#connected": "Conectado",
+  "nav#connection#stopping": "Desconectando",
+  "nav#connection#stopped": "Desconectado",
+  "nav#settings": "Configuración",
+  "nav#feedback": "Comentarios",
+  "nav#logs": "Registros (logs)",
+  "nav#about": "Acerca de",
+  "connection#starting-msg": "Psiphon está <span class=\"state-word\">conectando</span>…",
+  "connection#stop-btn": "Detener",
+  "connection#connected-msg": "Psiphon está <span class=\"state-word\">conectado</span>",
+  "connection#disconnect-btn": "Desconectar",
+  "connection#stopping-msg": "Psiphon está <span class=\"state-word\">desconectando</span>…",
+  "connection#wait-btn": "Por favor, espere...",
+  "connection#stopped-msg": "Psiphon está <span class=\"state-word\">desconectado</span>",
+  "connection#connect-btn": "Conectar",
+  "connection#egress-region-combo-label": "Seleccionar región del servidor",
+  "settings#error-alert": "<strong>¡Error!</strong> Por favor, repare los valores incorrectos antes de proseguir.",
+  "settings#reset-button": "Restablecer predeterminados",
+  "settings#apply-button": "Aplicar cambios",
+  "settings#unapplied-changes-prompt#title": "La configuración cambió",
+  "settings#unapplied-changes-prompt#body": "Ha realizado cambios en su configuración, pero no ha aplicado los cambios.<br><br>¿Desea aplicar sus cambios ahora o descartarlos?",
+  "settings#unapplied-changes-prompt#apply-button": "Aplicar",
+  "settings#unapplied-changes-prompt#discard-button": "Descartar",
+  "settings#vpn-incompatible-msg": "(No funciona con el modo L2TP/IPSec (VPN).)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec (VPN)",
+  "settings#split-tunnel#heading": "Túnel dividido",
+  "settings#split-tunnel#help-text": "Si se habilita, las solicitudes hechas a servidores dentro de su país de residencia no serán enviadas a través del túnel de Psiphon.",
+  "settings#split-tunnel#reason": "Los sitios web dentro de su país de residencia generalmente no se encuentran bloqueados, por lo que habilitando esta opción le dará a ud. un acceso veloz a estos sitios y algunas veces reducirá los costos de uso de ISP.",
+  "settings#split-tunnel#enable-label": "No proxyficar sitios web dentro de su país",
+  "settings#disable-timeouts#heading": "Deshabilitar límite de tiempo de espera para redes lentas",
+  "settings#disable-timeouts#help-text": "Si está habilitada, la comunicación con el servidor Psiphon se cerrará por límite de tiempo.",
+  "settings#disable-timeouts#reason": "Al habilitar esto sobre una conexión de red muy lenta, es menos probable que experimentes desconexiones inesperadas.",
+  "settings#disable-timeouts#enable-label": "Deshabilitar límite de tiempo de espera para redes lentas",
+  "settings#egress-region#heading": "Región del servidor Psiphon",
+  "settings#egress-region#select-best-performance": "Mejor rendimiento",
+  "settings#egress-region#select-us": "Estados Unidos",
+  "settings#egress-region#select-ca": "Canadá",
+  "settings#egress-region#select-gb": "Reino Unido",
+  "settings#egress-region#select-jp": "Japón",
+  "settings#egress-region#select-sg": "Singapur",
+  "settings#egress-region#select-sk": "Eslovaquia",
+  "settings#egress-region#select-nl": "Países Bajos",
+  "settings#egress-region#select-de": "Alemania",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "España",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austria",
+  "settings#egress-region#select-be": "Bélgica",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Suiza",
+  "settings#egress-region#select-cz": "República checa",
+  "settings#egress-region#select-dk": "Dinamarca",
+  "settings#egress-region#select-fr": "Francia",
+  "settings#egress-region#select-hu": "Hungría",
+  "settings#egress-region#select-it": "Italia",
+  "settings#egress-region#select-no": "Noruega",
+  "settings#egress-region#select-ro": "Rumanía",
+  "settings#egress-region#select-se": "Suecia",
+  "settings#egress-region#select-pl": "Polonia",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon tiene servidores en muchos países y regiones diferentes. Usar un servidor Psiphon en una región cercana a su país natal generalmente proporcionará una mejor conexión a la red, pero puede que desee acceder a sitios web y servicios como si estuviera virtualmente en un país o región específica.",
+  "settings#egress-region#default": "Elegir la opción predeterminada <strong>“Mejor Desempeño”</strong> permite a Psiphon escoger automáticamente un servidor, que generalmente resultará en la mejor conexión posible a la red.",
+  "settings#egress-region#invalid-error-msg": "Escoja una región válida de servidor Psiphon.",
+  "settings#egress-region#error-modal-title": "Región de servidor no disponible",
+  "settings#egress-region#error-modal-body-http": "Ha configurado Psiphon para que use un servidor en una región específica.<br>\nSin embargo, esa región ya no está disponible.<br>\nTiene que elegir una nueva región o cambiar a la opción predeterminada \"Mejor Desempeño\".",
+  "settings#local-proxy-ports#heading": "Puertos de proxy local",
+  "settings#local-proxy-ports#leave-blank": "Dejar <strong>en blanco</strong> para selección automática de puerto (recomendado).",
+  "settings#local-proxy-ports#reason": "Si en su computadora utiliza herramientas que requieren configuración manual para funcionar con Psiphon, querrá que Psiphon use los mismos números de puerto local de forma consistente. Si no tiene un motivo para especificar números de puerto, debe permitir a Psiphon escogerlos automáticamente para ayudar a evitar conflictos.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Debe estar entre 1 y 65535",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Los puertos locales tienen que ser distintos entre si.",
+  "settings#local-proxy-ports#error-modal-title": "Conflicto de puerto de proxy local",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nHa configurado Psiphon para que use un puerto local específico para su propio proxy HTTP.<br>\nSin embargo, ese puerto parece estar ya en uso y por tanto Psiphon no puede usarlo.\n</p>\n<p>\nPor favor, cambie el valor configurado de puerto para proxy HTTP e inténtelo de nuevo. Recomendamos que deje en blanco el valor de forma que Psiphon pueda seleccionar automáticamente un puerto disponible.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nHa configurado Psiphon para que use un puerto local específico para su propio proxy SOCKS.<br>\nSin embargo, ese puerto parece estar ya en uso y por tanto Psiphon no puede usarlo.\n</p>\n<p>\nPor favor, cambie el valor configurado de puerto para proxy SOCKS e inténtelo de nuevo. Recomendamos que deje en blanco el valor de forma que Psiphon pueda seleccionar automáticamente un puerto disponible.\n</p>",
+  "settings#upstream-proxy#heading": "Proxy hacia Internet",
+  "settings#upstream-proxy#by-default": "Si su computadora ya tiene un proxy (interpuesto) configurado, Psiphon usará por defecto ese proxy al establecer un túnel. Puede reemplazar ese comportamiento especificando un proxy a utilizar, o especificando que no debe usarse tal \"proxy al exterior\".",
+  "settings#upstream-proxy#reason": "Los proxys (interpuestos) al exterior a veces son requeridos por escuelas, universidades, o negocios. Si conoce la configuración de proxy al exterior requerida por su proveedor de red, entonces configurarlo manualmente aquí puede que sea necesario para conectar.",
+  "settings#upstream-proxy#proxy-reqs": "Sólo están permitidos proxys HTTP que soporten HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Nombre del servidor",
+  "settings#upstream-proxy#port-label": "Puerto",
+  "settings#upstream-proxy#username-label": "Nombre de usuario",
+  "settings#upstream-proxy#password-label": "Contraseña",
+  "settings#upstream-proxy#domain-label": "Dominio",
+  "settings#upstream-proxy#skip-label": "No usar proxy hacia Internet",
+  "settings#upstream-proxy#set-hostname-error-msg": "Tienes que proveer un Nombre de Servidor, o dejar todos los campos de Proxy de Nivel Superior en blanco para su selección automática.",
+  "settings#upstream-proxy#set-username-error-msg": "Tienes que proveer un Nombre de Usuario si estás estableciendo la Contraseña o el Dominio, o dejar todos los campos en blanco para no usar autentificación.",
+  "settings#upstream-proxy#error-modal-title": "Proxy hacia Internet",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon actualmente está configurado para usar el proxy (interpuesto) de su sistema como su \"proxy al exterior\".<br>\nSin embargo, parece que no podemos conectar a un servidor Psiphon a través de ese proxy.<br>\nPor favor, habilite \"No usar el proxy al exterior\" e inténtelo de nuevo.",
+  "settings#upstream-proxy#error-modal-body-configured": "Ha configurado Psiphon para que use un \"proxy al exterior\".<br>\nSin embargo, parace que no podemos conectar a un servidor Psiphon a través de ese proxy.<br>\nPor favor, corrija la configuración e inténtelo de nuevo.",
+  "settings#transport-mode#heading": "Modo de transporte",
+  "settings#transport-mode#check-label": "Usar el modo L2TP/IPSec (VPN)",
+  "settings#transport-mode#help-text": "Usa interconexión virtual L2TP/IPSec de Windows (VPN). Este modo derivará por túnel el tráfico de todas sus aplicaciones, pero no proporciona ofuscación y por tanto no tiene capacidades robustas para la elusión de la censura. <strong>No está recomendado</strong> para evitar la mayoría de los cortafuegos (firewalls).",
+  "settings#systray-minimize#heading": "Minimizar al área de notificación (bandeja del sistema)",
+  "settings#systray-minimize#help-text": "Si está habilitada, cuando la ventana de la aplicación Psiphon esté minimizada se ocultará en el área de notificación (también conocida como la \"bandeja del sistema\" o \"systray\", localizada junto al reloj en la barra de tareas de su Windows).",
+  "settings#systray-minimize#reason": "Minimizar Psiphon en el área de notificación ('bandeja del sistema') libera espacio en su barra de tareas. Esto es especialmente útil si a menudo ejecuta Psiphon durante largos periodos de tiempo.",
+  "settings#systray-minimize#enable-label": "Minimizar en el área de notificación (bandeja del sistema)",
+  "settings#applying-message": "Reconectando para aplicar su configuración.",
+  "settings#saved-message": "Configuración guardada.",
+  "settings#error-modal#title": "Error de configuración",
+  "settings#error-modal#body": "Hay errores en los valores de su configuración. Por favor, corríjalos antes de continuar.",
+  "feedback#top_content_title": "Envíenos sus comentarios",
+  "feedback#top_para_2": "Muchos problemas pueden arreglarse descargando la versión más reciente. Puede <a class=\"NewVersionURL\" href=\"#\">descargar la última versión haciendo clic aquí</a>, o puede enviar un correo electrónico a <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "También puede encontrar soluciones a muchos problemas comunes en nuestras <a class=\"FaqURL\" href=\"#\">preguntas frecuentes (FAQ)</a>.",
+  "feedback#smiley_happy": "Psiphon conecta y funciona de la forma que yo quiero.",
+  "feedback#smiley_sad": "Psiphon falla a menudo al conectar o no funciona suficientemente bien.",
+  "feedback#text_feedback_prompt": "Por favor, introduzca sus comentarios aquí:",
+  "feedback#text_feedback_email_prompt": "Si desea que le respondamos, por favor, introduzca su dirección de correo electrónico:",
+  "feedback#diagnostic_check": "Suba datos de diagnóstico. Por favor, observe que estos datos de diagnóstico no le identifican, y nos ayudarán a mantener Psiphon funcionando como la seda <a class=\"DataCollectionInfoURL\" href=\"#\">Haga clic aquí para ver qué datos recopilamos.</a>",
+  "feedback#submit_button": "Enviar",
+  "feedback#text_feedback_bottom_para": "Si el formulario de arriba no está funcionando, o si desea enviar capturas de pantalla, por favor, escríbanos un correo a <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>¡Gracias!</strong> Sus comentarios han sido enviados.",
+  "logs#show-debug-label": "Mostrar registros (logs) de depuración",
+  "logs#placeholder": "Aún no hay registros (logs)",
+  "language#success-message": "<strong>¡Hola!</strong> Bienvenido a Psiphon.",
+  "about#wordart-tag": "Cruzando fronteras",
+  "about#description": "Psiphon es una <strong>herramienta de elusión de la censura</strong> — está diseñada para proporcionar acceso a la Internet abierta, dejando atrás censores y cortafuegos (firewalls). Es de <strong>código abierto</strong> y está desarrollada en Toronto, Canadá.",
+  "about#visit-download-site": "Por favor, visite el sitio web para <strong><a class=\"NewVersionURL\" href=\"#\">descargar una nueva versión</a></strong> o para <strong><a class=\"InfoURL\" href=\"#\">obtener ayuda e información</a></strong>. Psiphon está disponible para Android y Windows.",
+  "about#get-by-email": "<strong>Si el sitio web no está accesible</strong>, puede obtener una versión nueva de Psiphon enviando un correo electrónico a:",
+  "about#client-version": "Versión del cliente para Windows de Psiphon:",
+  "general#modal-close-button": "Cerrar",
+  "general#notice-modal-tech-preamble": "Aquí tiene la información técnica del error:",
+  "notice#systemproxysettings-setproxy-error-title": "Error con el proxy del sistema",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon no pudo al establecer la configuración para proxy (interpuesto) del sistema.</p>\n<p>Esto podría deberse a un conflicto con su software antivirus. Puede que necesite configurar manualmente su aplicación o los ajustes para proxy de su sistema para que use los servidores proxy locales de Psiphon.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon no pudo establecer la configuración para proxy (interpuesto) del sistema para la conexión a Internet de nombre “<%- data %>”. Esto podría deberse a un conflicto con su software antivirus. Puede que necesite configurar manualmente su aplicación o los ajustes para proxy del sistema para que usen los servidores proxy locales de Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon está desconectado",
+  "appbackend#state-starting-title": "Psiphon está conectando",
+  "appbackend#state-starting-body": "Por favor, espere...",
+  "appbackend#state-connected-title": "Psiphon está conectado",
+  "appbackend#state-connected-body": "¡Explore más allá de sus fronteras!",
+  "appbackend#state-connected-reminder-title": "Psiphon le mantiene conectado",
+  "appbackend#state-connected-reminder-body": "Contribuya a que Psiphon siga siendo gratuito. ¡Pulse aquí para visitar las páginas de nuestros patrocinadores!",
+  "appbackend#state-connected-reminder-body-2": "¡Contribuya que Psiphon siga siendo gratuito visitando las páginas de nuestros patrocinadores!",
+  "appbackend#minimized-to-systray-title": "Psiphon se ha minimizado en el área de notificación",
+  "appbackend#minimized-to-systray-body": "Haga clic en el icono para restaurar la aplicación",
+  "appbackend#os-unsupported": "Psiphon ya no soporta Windows XP o Vista.\nPor favor visita nuestro sitio web para más información.",
+  "psicash#transaction-error-title": "Error de transacción PsiCash",
+  "psicash#transaction-error-body": "Su intento de transacción PsiCash falló inesperadamente.",
+  "psicash#transaction-ExistingTransaction-title": "Ya compra de PsiCash ya existe",
+  "psicash#transaction-ExistingTransaction-body": "Ya existe hecha una compra de PsiCash de este tipo. Otra compra de este tipo no es permitida hasta que expire la previamente realizada. Su estado de PsiCash será actualizado ahora.",
+  "psicash#transaction-InsufficientBalance-title": "Saldo insuficiente de PsiCash",
+  "psicash#transaction-InsufficientBalance-body": "Ud. no tiene suficiente saldo de PsiCash para esta compra.",
+  "psicash#transaction-TransactionAmountMismatch-title": "El precio de compra de PsiCash no coincide",
+  "psicash#transaction-TransactionAmountMismatch-body": "Lo precios de compra de PsiCash está desactualizados. Su estado de PsiCash se actualizará ahora.",
+  "psicash#transaction-TransactionTypeNotFound-title": "Tipo de compra de PsiCash no encontrado",
+  "psicash#transaction-TransactionTypeNotFound-body": "El producto que está intentando comprar no existe más. Puede que sea necesario actualizar o reinstalar la aplicación.",
+  "psicash#transaction-InvalidTokens-title": "Credenciales PsiCash inválidas",
+  "psicash#transaction-InvalidTokens-body": "Sus credenciales PsiCash son inválidas. Intente reinstalar la aplicación. Si eso no funciona, necesitará <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">limpiar su almacenamiento local</a>.",
+  "psicash#transaction-ServerError-title": "Error del servidor PsiCash",
+  "psicash#transaction-ServerError-body": "El servidor PsiCash respondió con un error mientras intentaba realizar la compra. Por favor intenta realizar tu compra más tarde.",
+  "psicash#ui-speedboost-active": "Aumento de&nbsp;Velocidad activo por %s",
+  "psicash#ui-zerobalance-title": "¿Necesitas Aumento de&nbsp;Velocidad?",
+  "psicash#ui-buypsi": "Compre PsiCash",
+  "psicash#ui-buymorepsi": "Compre más PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Necesario para Aumento de&nbsp;Velocidad",
+  "psicash#ui-enoughbalance-buttontext": "Arrancar Aumento de&nbsp;Velocidad",
+  "psicash#1-hour": "1 hora",
+  "psicash#1-day": "1 día",
+  "psicash#ui-buyingboost-buttontext": "Arrancando Aumento de&nbsp;Velocidad",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Una conexion a Psiphon es requerida.",
+  "psicash#mustconnect-modal#body": "Para poder utilizar PsiCash, debe estar conectado a la red Psiphon.",
+  "psicash#init-error-title": "Error de inicialización de PsiCash",
+  "psicash#init-error-body-unrecovered": "PsiCash falló al inicializarse. Esto es debido probablemente a un problema del sistema de archivos, como quedarse sin espacio en disco. Tu saldo y otros estados se han perdido. PsiCash no podrá usarse. Puedes intentar reiniciando la aplicación para recuperarse del problema.",
+  "psicash#init-error-body-recovered": "PsiCash falló al inicializarse. Esto es debido probablemente a un problema del sistema de archivos, como quedarse sin espacio en disco. Tu saldo y otros estados se han restablecido.",
+  "psicash#psiphon-speed": "<br>Velocidad de Psiphon",
+  "notice#disallowed-traffic-alert-title": "Actualiza tu conexión de Psiphon",
+  "notice#disallowed-traffic-alert-body": "<p>¿Las aplicaciones no están funcionando?</p>\n<p>Algún tráfico de Internet no está soportado sin un Aumento de Velocidad activo. Activa Aumento de Velocidad con PsiCash para desbloquear el potencial completo de tu experiencia Psiphon.</p>",
+  "appbackend#disallowed-traffic-notification-title": "¿Las aplicaciones no están funcionando?",
+  "appbackend#disallowed-traffic-notification-body": "Activa Aumento de Velocidad para desbloquear el potencial completo de tu experiencia Psiphon.",
+  "settings#disallowed-traffic-alert#heading": "Alerta de Tráfico Denegada",
+  "settings#disallowed-traffic-alert#help-text": "Algunos tipos de tráfico de Internet no están soportados sin un Aumento de Velocidad activo. Cuando tal tráfico es denegado, se muestra una alerta. (Re-habilitarla requerirá una reconexión.)",
+  "settings#disallowed-traffic-alert#disable-label": "Deshabilitar alertas de tráfico denegado",
+  "banner#sponsored-by": "Patrocinado por"
+};
\ No newline at end of file
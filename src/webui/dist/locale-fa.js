@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["fa"].translation = {
+  "banner#long-connecting": "<strong>ای بابا!</strong>به نظر میاد شما برای اتصال به Psiphon با مشکل روبرو هستید<br>\nجدیدترین نسخه Psiphon را از وبسایت \n<a class=\"NewVersionURL\" href=\"#\">دانلود کنید</a>\nیا به این آدرس ایمیل بفرستید.  \n<a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "در حال اتصال",
+  "nav#connection#connected": "متصل شد",
+  "nav#connection#stopping": "قطع شدن",
+  "nav#connection#stopped": "قطع شد",
+  "nav#settings": "تنظیمات",
+  "nav#feedback": "بازخوردها",
+  "nav#logs": "گزارش ها",
+  "nav#about": "درباره",
+  "connection#starting-msg": "Psiphon در حال <span class=\"state-word\">متصل شدن است</span>…",
+  "connection#stop-btn": "متوقف کن",
+  "connection#connected-msg": "Psiphon<span class=\"state-word\"> وصل شد</span>",
+  "connection#disconnect-btn": "قطع کردن",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">در حال قطع شدن است</span>…",
+  "connection#wait-btn": "لطفا صبر کنید ...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">قطع شد.</span>",
+  "connection#connect-btn": "اتصال",
+  "connection#egress-region-combo-label": "منطقه سرور را انتخاب کنید",
+  "settings#error-alert": "<strong>خطا!</strong> لطفا ورودی های نادرست را قبل از اجرا رفع کنید.",
+  "settings#reset-button": "تنظیم مجدد به حالت پیش فرض",
+  "settings#apply-button": "تغغیرات را اعمال کن",
+  "settings#unapplied-changes-prompt#title": "تنظیمات تغییر داده شد",
+  "settings#unapplied-changes-prompt#body": "شما تغییراتی در تنظیمات ایجاد کرده اید، اما همچنان آن ها را به عملی نکرده اید. <br><br> آیا تمایل دارید این تغییرات اجرایی شوند و یا از بین بروند؟",
+  "settings#unapplied-changes-prompt#apply-button": "انجام دادن",
+  "settings#unapplied-changes-prompt#discard-button": "دور انداختن",
+  "settings#vpn-incompatible-msg": "(با حالت L2TP / IPSec  کار نمی کند.)",
+  "settings#vpn-incompatible-label": "L2TP / IPSec",
+  "settings#split-tunnel#heading": "تقسیم تونل",
+  "settings#split-tunnel#help-text": "اگر این گزینه فعال شود، درخواست هایی که به سرورهای درون کشور شما فرستاده می‌شوند از تونل Psiphon (Psiphon) عبور داده نخواهند شد.",
+  "settings#split-tunnel#reason": "وبسایت های درون کشور خودتان معمولا مسدود نیستند. بنابراین فعال کردن این گزینه دسترسی به این سایت ها را سریع‌تر می کند و گاهی می تواند هزینه‌ی مصرف داده های سرویس اینترنت شما را کاهش دهد.",
+  "settings#split-tunnel#enable-label": "وبسایت های داخل کشور من را پراکسی نکن. ",
+  "settings#disable-timeouts#heading": "غیر فعال کردن زمان انتظار برای شبکه‌های کم سرعت",
+  "settings#disable-timeouts#help-text": "در صورت فعال بودن، اتصال شما به سرور Psiphon قطع نخواهد شد",
+  "settings#disable-timeouts#reason": "وقتی این گزینه برای یک شبکه‌ی بسیار کند فعال شود، احتمال قطع پیش‌بینی نشده‌ی اتصال شما کمتر می‌شود.",
+  "settings#disable-timeouts#enable-label": "غیر فعال کردن وقفه برای شبکه‌های کم سرعت",
+  "settings#egress-region#heading": "کشور سرور خروجی Psiphon ",
+  "settings#egress-region#select-best-performance": "بهترین عملکرد",
+  "settings#egress-region#select-us": "ایالات متحده آمریکا",
+  "settings#egress-region#select-ca": "کانادا",
+  "settings#egress-region#select-gb": "انگلستان",
+  "settings#egress-region#select-jp": "ژاپن",
+  "settings#egress-region#select-sg": "سنگاپور",
+  "settings#egress-region#select-sk": "اسلواکی",
+  "settings#egress-region#select-nl": "هلند",
+  "settings#egress-region#select-de": "آلمان",
+  "settings#egress-region#select-in": "هند",
+  "settings#egress-region#select-es": "اسپانیا",
+  "settings#egress-region#select-hk": "هنگ‌کنگ",
+  "settings#egress-region#select-at": "اتریش",
+  "settings#egress-region#select-be": "بلژیک",
+  "settings#egress-region#select-bg": "بلغارستان",
+  "settings#egress-region#select-ch": "سوییس",
+  "settings#egress-region#select-cz": "جمهوری چک",
+  "settings#egress-region#select-dk": "دانمارک",
+  "settings#egress-region#select-fr": "فرانسه",
+  "settings#egress-region#select-hu": "مجارستان",
+  "settings#egress-region#select-it": "ایتالیا",
+  "settings#egress-region#select-no": "نروژ",
+  "settings#egress-region#select-ro": "رومانی",
+  "settings#egress-region#select-se": "سوئد",
+  "settings#egress-region#select-pl": "لهستان",
+  "settings#egress-region#select-rs": "صربستان",
+  "settings#egress-region#select-au": "استرالیا",
+  "settings#egress-region#description": "(Psiphon) در بسیاری از کشورها سرور دارد. معمولا استفاده از یک سرور (Psiphon) که به کشور شما نزدیک‌تر است اتصال بهتری به شبکه فراهم می کند، اما شاید شما بخواهید به وبسایت‌ها و خدمات طوری دسترسی داشته باشید که انگار که در کشور خاصی هستید.\n ",
+  "settings#egress-region#default": "انتخاب گزینه <strong>“بهترین عملکرد“</strong> به Psiphon اجازه می دهد که به صورت خودکار یک سرور را انتخاب کند که عموما نتیجه آن یک ارتباط بهتر و پایدارتر است.",
+  "settings#egress-region#invalid-error-msg": "یک منطقه سرور معتبر Psiphon را انتخاب کنید.",
+  "settings#egress-region#error-modal-title": "سرور منطقه در دسترس نیست",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "پراکسی پورت محلی",
+  "settings#local-proxy-ports#leave-blank": "به منظور انتخاب خودکار پورت این بخش را <strong>خالی</strong> بگذارید (پیشنهاد شده).",
+  "settings#local-proxy-ports#reason": "اگر از ابزارهایی استفاده می کنید که برای کار با Psiphon از تنظیمات دستی استفاده می کنند، نیاز دارید که Psiphon به طور مداوم از پورت محلی یکسانی استفاده کند. اگر دلیل خاصی برای انتخاب یک شماره پورت ندارید باید به Psiphon اجازه دهید شماره پورت را خودکار بیابد که این کار باعث جلوگیری از اخلال نیز می شود.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "باید بین 1 و 65535 باشد.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "پورت های محلی نباید یکسان باشند.",
+  "settings#local-proxy-ports#error-modal-title": "درگیری در پراکسی پورت محلی",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nشما Psiphon را تنظیم کردید که از یک پورت محلی خاص برای پراکسی HTTP استفاده کند.\n<br>\nاما٬ به نظر میرسد که آن پورت در حال استفاده شدن است و Psiphon نمیتواند از آن استفاده کند. \n</p>\n<p>\nلطفا تنظیم پورت HTTP پراکسی را تغییر دهید و دوباره امتحان کنید. ما پیشنهاد میکنیم که قسمت   این تنظیم را خالی بگذارید تا Psiphon بتواند بطور خودکار یک پورت در دسترس را استفاده کند.  </p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nشما Psiphon را تنظیم کردید که از یک پورت محلی خاص برای پراکسی SOCKS استفاده کند.\n<br>\nاما٬ به نظر میرسد که آن پورت در حال استفاده شدن است و Psiphon نمیتواند از آن استفاده کند. \n</p>\n<p>\nلطفا تنظیم پورت SOCKS پراکسی را تغییر دهید و دوباره امتحان کنید. ما پیشنهاد میکنیم که قسمت   این تنظیم را خالی بگذارید تا Psiphon بتواند بطور خودکار یک پورت در دسترس را استفاده کند.  </p>",
+  "settings#upstream-proxy#heading": "پروکسی بالادست",
+  "settings#upstream-proxy#by-default": "اگر  پروکسی بر روی کامپیوترتان تنظیم شده باشد، به شکل پیش فرض Psiphon از همان تنظیمات برای تشکیل یک تونل استفاده می کند. شما می توانید این تنظیمات را با انتخاب یک پروکسی خاص برای استفاده یا با ممنوع کردن یک پروکسی بالادستی بازنویسی کنید.",
+  "settings#upstream-proxy#reason": "گاهی مدارس، دانشگاه ها و یا بیزینس ها نیاز به پروکسی بالادستی دارند. اگر تنظیمات پورکسی بالادستی مورد درخواست سرویس دهنده شبکه را می دانید، شاید نیاز باشد برای اتصال آن ها را به صورت دستی اینجا وارد کنید.",
+  "settings#upstream-proxy#proxy-reqs": "تنها پورکسی های HTTP که از HTTPS پشتیبانی می کنند مجاز هستند.",
+  "settings#upstream-proxy#hostname-label": "نام سرور",
+  "settings#upstream-proxy#port-label": "پورت ",
+  "settings#upstream-proxy#username-label": "نام کاربری",
+  "settings#upstream-proxy#password-label": "کلمه عبور",
+  "settings#upstream-proxy#domain-label": "دامنه",
+  "settings#upstream-proxy#skip-label": "پروکسی بالادست استفاده نکنید",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "ارور پراکسی آپستریم",
+  "settings#upstream-proxy#error-modal-body-default": "در حال حاضر Psiphon تنظیم شده است که از تنظیمات پروکسی سیستم که تنظیمات بالادستی پروکسی است استفاده کند. <br>\nهرچند، با این تنظیمات پروکسی به نظر می رسد که امکان اتصال به سرور Psiphon را نداریم. <br>\nلطفا گزینه \"از پروکسی بالادستی استفاده نکن\" را فعل کرده و مجددا تلاش کنید.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon را برای استفاده از پروکسی بالادستی تنظیم کرده اید. <br>\nبا این حال و با توجه به این تنظیمات، نمی توانیم به سرور Psiphon متصل شویم. <br>\nلطفا این مشکل را برطرف کرده و مجددا تلاش کنید.",
+  "settings#transport-mode#heading": "Transport Mode",
+  "settings#transport-mode#check-label": "استفاده از حالت L2TP / IPSec ",
+  "settings#transport-mode#help-text": "از شبکه سازی مجازی L2TP/IPSec ویندوز استفاده می کند. این حالت تمام ترافیک نرم افزارها را تونل می کند، اما لایه مبهم اضافی را فراهم نمی کند و به همین دلیل توانایی دور زدن سانسور محدودی دارد. این شیوه برای دور زدن بیشتر دیوارهای آتش <strong>توصیه نمی شود</strong>. ",
+  "settings#systray-minimize#heading": "کوچک کردن برنامه به بخش System Tray ویندوز",
+  "settings#systray-minimize#help-text": "در صورت فعال کردن این گزینه، پس از مینیمایز کردن پنجره نرم افزار، Psiphon مخفی شده و به نوار اعلان منتقل می شود. (نوار اعلان یا سیستم تِرِی به نواری در پایین سمت راست صفحه ویندوز گفته می شود که نرم افزارهای فعال در پس زمینه در کنار ساعت نمایش داده می شوند.)",
+  "settings#systray-minimize#reason": "مینیمایز کردن Psiphon و فرستادن آن به نوار اعلان باعث باز شدن فضا در نوار ابزار می شود. این امکان به خصوص زمانی که از Psiphon برای زمان های طولانی استفاده می کنید کار آمد است. ",
+  "settings#systray-minimize#enable-label": "کوچک کردن برنامه به بخش System Tray ویندوز",
+  "settings#applying-message": "اتصال مجدد برای درخواست تنظیمات شما .",
+  "settings#saved-message": "تنظیمات ذخیره شد.",
+  "settings#error-modal#title": "خطا در تنظیمات",
+  "settings#error-modal#body": "اشتباهاتی در تنظیمات رخ داده است. لطفا پیش از ادامه کار، آن ها را تصحیح کنید.",
+  "feedback#top_content_title": "نظرات خود را با ما در میان بگذارید",
+  "feedback#top_para_2": "بیشتر مشکلات Psiphon با دانلود جدیدترین نسخه برطرف می‌شوند. جدیدترین نسخه Psiphon را با کلیک روی این <a class=\"NewVersionURL\" href=\"#\">لینک</a> دانلود کنید. جدیدترین نسخه را با فرستادن ایمیل به آدرس <a class=\"NewVersionEmail\" href=\"#\"></a> نیز می‌توانید دریافت کنید. ",
+  "feedback#top_para_3": "شما می‌توانید جواب بیشتر مشکلات رایج را در قسمت <a class=\"FaqURL\" href=\"#\">سوال و جواب متداول</a> پیدا کنید.  ",
+  "feedback#smiley_happy": "Psiphon به خوبی وصل می‌شود و کار می‌کند.   ",
+  "feedback#smiley_sad": "Psiphon معمولا وصل نمی‌شود و خوب کار نمی‌کند. ",
+  "feedback#text_feedback_prompt": "لطفا نظرهای خود را اینجا وارد کنید:",
+  "feedback#text_feedback_email_prompt": "اگر دوست دارید که ما به شما جواب دهیم٬ لطفا ایمیل خود را وارد کنید. ",
+  "feedback#diagnostic_check": "آپلود و ارسال اطلاعات فنی/تشخیصی کارکرد Psiphon. لطفا به خاطر داشته باشید که این اطلاعات به هیچ عنوان \nهویت شما را آشکار نمی‌کند، و به ما کمک می‌کند که Psiphon کارکرد بهتری داشته باشد. \n<a class=\"dataCollectionInfoURL\" href=\"#\"> اینجا کلیک کنید تا ببینید ما چه اطلاعاتی را جمع آوری می‌کنیم. </a>",
+  "feedback#submit_button": "ارسال",
+  "feedback#text_feedback_bottom_para": "اگر فرم بالا کار نمی‌کند و می‌خواهید برای ما عکس از صفحه‌ خودتون بفرستید. می‌توانید آن را به آدرس <a id=\"emailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ایمیل کنید.",
+  "feedback#success-message": "<strong>متشکرم!</strong> بازخورد شما ارسال شد.",
+  "logs#show-debug-label": "نمایش سیاهه های مربوط به اشکال زدایی",
+  "logs#placeholder": "بدون سیاهه های مربوط هنوز",
+  "language#success-message": "<strong>سلام!</strong> به Psiphon خوش آمدید.",
+  "about#wordart-tag": "فراتر از مرزها",
+  "about#description": "فیلترشکن Psiphon برای دور زدن فیلترینگ اینترنت و ایجاد دسترسی به اطلاعات سانسور شده طراحی شده است. کد برنامه Psiphon \n<strong>\nمتن باز / اپن سورس</strong> \nدر شهر تورنتو٬ کانادا نوشته شده است. ",
+  "about#visit-download-site": "لطفا برای <strong><a class=\"NewVersionURL\" href=\"#\">دانلود نسخه جدید</a></strong> و یا <strong><a class=\"InfoURL\" href=\"#\">دریافت کمک و اطلاعات بیشتر</a></strong> به وبسایت مراجعه کنید. Psiphon برای اندروید و ویندوز عرضه شده است.",
+  "about#get-by-email": "اگر وبسایت در دسترس شما نیست٬ نسخه جدید Psiphon را میتوانید با فرستادن ایمیل به این آدرس دریافت کنید: ",
+  "about#client-version": "Psiphon برای نسخه ویندوز سرویس گیرنده:",
+  "general#modal-close-button": "بستن",
+  "general#notice-modal-tech-preamble": "در این جا اطلاعات تکنیکی پیغام خطا را مشاهده می کنید:",
+  "notice#systemproxysettings-setproxy-error-title": "خطای پروکسی سیستم",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon نتوانست تنظیمات پروکسی سیستم را انجام دهد.</p>\n <p>ممکن است برنامه ضدویروس شما مانع این کار شده باشد. برای استفاده از پروکسی محلی Psiphon شاید لازم باشد که تنظیمات پروکسی نرم افزار و یا سیستم را دستی تغییر دهید.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon نتوانست تنظیمات پروکسی سیستم برای اتصال اینترنتی با نام  “<%- data %>” انجام دهد. این مساله ممکن است به دلیل تداخل با برنامه ضد ویروس به وجود آمده باشد. برای استفاده از پروکسی محلی Psiphon شاید لازم باشد تنظیمات پروکسی نرم افزار و یا سیستم را دستی انجام دهید.",
+  "appbackend#state-stopped-title": "Psiphon در حال قطع شدن است",
+  "appbackend#state-starting-title": "Psiphon در حال اتصال است",
+  "appbackend#state-starting-body": "لطفا صبر کنید ...",
+  "appbackend#state-connected-title": "Psiphon متصل است",
+  "appbackend#state-connected-body": "کاوش در خارج از مرزهای خود!",
+  "appbackend#state-connected-reminder-title": "Psiphon شما را متصل نگه داشته است",
+  "appbackend#state-connected-reminder-body": "Psiphon را رایگان نگه دارید. برای بازدید صفحه حامیان ما کلیک کنید!",
+  "appbackend#state-connected-reminder-body-2": "Psiphon را رایگان نگه دارید با بازدید از صفحه حامیان ما!",
+  "appbackend#minimized-to-systray-title": "Psiphon مینیمایز شد و به نوار اعلان رفت",
+  "appbackend#minimized-to-systray-body": "کلیک بر روی آیکون برای بازگرداندن نرم افزار",
+  "appbackend#os-unsupported": "Psiphon (Psiphon) دیگر از ویندوز XP و Vista پشتیبانی نمی‌کند.\nلطفا برای اطلاعات بیشتر به وبسایت ما مراجعه کنید.",
+  "psicash#transaction-error-title": "خطا در مبادله با PsiCash",
+  "psicash#transaction-error-body": "تلاش شما برای مبادله با PsiCash با مشکل ناگهانی روبرو شد.",
+  "psicash#transaction-ExistingTransaction-title": "خرید PsiCash از پیش وجود دارد. ",
+  "psicash#transaction-ExistingTransaction-body": "شما یک خرید PsiCash موجود از این نوع دارید. خریدهای دیگر از این نوع تا زمان انقضا قبلی مجاز نیست. اکنون وضعیت PsiCash شما تازه‌سازی خواهد شد.",
+  "psicash#transaction-InsufficientBalance-title": "موجودی PsiCash ناکافی است",
+  "psicash#transaction-InsufficientBalance-body": "شما PsiCash کافی برای این خرید ندارید.",
+  "psicash#transaction-TransactionAmountMismatch-title": "عدم تطابق قیمت خرید PsiCash",
+  "psicash#transaction-TransactionAmountMismatch-body": "قیمت‌های خرید PsiCash قدیمی هستند. اکنون وضعیت PsiCash شما تازه‌سازی خواهد شد.",
+  "psicash#transaction-TransactionTypeNotFound-title": "نوع خرید PsiCash یافت نشد",
+  "psicash#transaction-TransactionTypeNotFound-body": "چیزی که می‌خواهید بخرید دیگر وجود ندارد. شما باید برنامه‌ی خود را به روز رسانی یا دوباره نصب کنید.",
+  "psicash#transaction-InvalidTokens-title": "مشخصه نامعتبر PsiCash",
+  "psicash#transaction-InvalidTokens-body": "مشخصه PsiCash شما نامعتبر است. برنامه را دوباره راه‌اندازی کنید. اگر اثری نداشت، باید <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">فضای ذخیره محلی خود را پاک کنید</a>.",
+  "psicash#transaction-ServerError-title": "خطای سرور PsiCash",
+  "psicash#transaction-ServerError-body": "سرور PsiCash هنگام تلاش برای خرید با خطا مواجه شد. لطفا بعدا خرید خود را دوباره امتحان کنید.",
+  "psicash#ui-speedboost-active": "افزایش سرعت برای %s فعال است",
+  "psicash#ui-zerobalance-title": "نیاز به افزایش سرعت دارید؟",
+  "psicash#ui-buypsi": " خرید PsiCash",
+  "psicash#ui-buymorepsi": "PsiCash بیشتری بخرید.",
+  "psicash#ui-nsfbalance-buttontext": "مورد نیاز برای افزایش سرعت",
+  "psicash#ui-enoughbalance-buttontext": "شروع افزایش سرعت",
+  "psicash#1-hour": "۱ ساعت",
+  "psicash#1-day": "۱ روز",
+  "psicash#ui-buyingboost-buttontext": "در حال افزایش سرعت!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "اتصال Psiphon الزامیست",
+  "psicash#mustconnect-modal#body": "برای استفاده از PsiCash، باید به شبکه Psiphon متصل شوید.",
+  "psicash#init-error-title": "خطای آماده‌سازی اولیه PsiCash\n",
+  "psicash#init-error-body-unrecovered": "PsiCash در آماده‌سازی اولیه ناموفق بود. این احتمالا به دلیل مشکل سیستم فایل‌ها، مانند پر بودن فضای دیسک است. موجودی و وضعیت شما از دست رفته است. PsiCash قابل استفاده نخواهد بود. برای رهایی از این مشکل می‌توانید دوباره برنامه را راه‌اندازی کنید.",
+  "psicash#init-error-body-recovered": "PsiCash در آماده‌سازی اولیه ناموفق بود. این احتمالا به دلیل مشکل سیستم فایل‌ها، مانند پر بودن فضای دیسک است. موجودی و وضعیت شما بازنشانی (reset) شده است.",
+  "psicash#psiphon-speed": "سرعت<br>Psiphon",
+  "notice#disallowed-traffic-alert-title": "اتصال Psiphon خود را ارتقا دهید",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "برنامه‌ها کار نمی‌کنند؟",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "اسپانسر شده با  "
+};
\ No newline at end of file
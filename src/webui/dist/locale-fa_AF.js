@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["fa_AF"].translation = {
+  "banner#long-connecting": "<strong>اوه، نی!</strong> به نظر میرسد برای متصل شدن مشکل دارید!<br>\nآخرین نسخه سایفون را از <a class=\"NewVersionURL\" href=\"#\">سایت دانلود</a>، دانلود کنید\nیا یک ایمیل به <a class=\"NewVersionEmail\" href=\"#\"></a> بفرستید",
+  "nav#connection#starting": "درحال اتصال",
+  "nav#connection#connected": "متصل شد",
+  "nav#connection#stopping": "قطع اتصال",
+  "nav#connection#stopped": "اتصال قطع شد",
+  "nav#settings": "تنظیمات",
+  "nav#feedback": "ملاحظات",
+  "nav#logs": "گزارش ثبت",
+  "nav#about": "درباره",
+  "connection#starting-msg": "سایفون در حال<span class=\"state-word\">اتصال است</span>…",
+  "connection#stop-btn": "توقف",
+  "connection#connected-msg": "سایفون <span class=\"state-word\">متصل شده است</span>…",
+  "connection#disconnect-btn": "قطع اتصال",
+  "connection#stopping-msg": "سایفون در حال<span class=\"state-word\">قطع اتصال است</span>…",
+  "connection#wait-btn": "لطفاً صبر کنید...",
+  "connection#stopped-msg": "اتصال سایفون <span class=\"state-word\">قطع شده است</span>…",
+  "connection#connect-btn": "اتصال",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>خطا!</strong> لطفاً قبل از ادامه مقادیر نادرست را تصحیح کنید.",
+  "settings#reset-button": "تنظیم مجدد به مقادیر پیش‌فرض",
+  "settings#apply-button": "اعمال تغییرات",
+  "settings#unapplied-changes-prompt#title": "تنظیمات تغییر کرد",
+  "settings#unapplied-changes-prompt#body": "تغییرات در تنظیمات خود انجام داده‌اید، اما این تغییرات را اعمال نکرده‌اید.<br><br>آیا میخواهید تغییرات خود را اعمال کنید یا آنها را نادیده بگیرید؟",
+  "settings#unapplied-changes-prompt#apply-button": "اعمال",
+  "settings#unapplied-changes-prompt#discard-button": "نادیده گرفتن",
+  "settings#vpn-incompatible-msg": "(با حالت L2TP/IPSec کار نمیکند.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "تونل دوقسمتی",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "ویب‌سایت‌های داخل کشور خودتان پراکسی نشوند",
+  "settings#disable-timeouts#heading": "غیرفعال‌سازی مهلت زمانی برای شبکه‌های کم‌سرعت",
+  "settings#disable-timeouts#help-text": "اگر فعال باشد، مهلت زمانی برای برقراری ارتباط با سرور سایفون وجود ندارد.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "غیرفعال‌سازی مهلت زمانی برای شبکه‌های کم‌سرعت",
+  "settings#egress-region#heading": "منطقه سرور سایفون",
+  "settings#egress-region#select-best-performance": "بهترین عملکرد",
+  "settings#egress-region#select-us": "ایالات متحده",
+  "settings#egress-region#select-ca": "کانادا",
+  "settings#egress-region#select-gb": "بریتانیا",
+  "settings#egress-region#select-jp": "جاپان",
+  "settings#egress-region#select-sg": "سنگاپور",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "هالند",
+  "settings#egress-region#select-de": "آلمان",
+  "settings#egress-region#select-in": "هندوستان",
+  "settings#egress-region#select-es": "اسپانیا",
+  "settings#egress-region#select-hk": "هانگ کانگ",
+  "settings#egress-region#select-at": "اتریش",
+  "settings#egress-region#select-be": "بلجیم",
+  "settings#egress-region#select-bg": "بلغاریا",
+  "settings#egress-region#select-ch": "سوئیس",
+  "settings#egress-region#select-cz": "جمهوری چک",
+  "settings#egress-region#select-dk": "دنمارک",
+  "settings#egress-region#select-fr": "فرانسه",
+  "settings#egress-region#select-hu": "مجارستان",
+  "settings#egress-region#select-it": "ایتالیا",
+  "settings#egress-region#select-no": "ناروی",
+  "settings#egress-region#select-ro": "رومانیا",
+  "settings#egress-region#select-se": "سویدن",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "یک منطقه سرور سایفون معتبر را انتخاب کنید.",
+  "settings#egress-region#error-modal-title": "منطقه سرور در دسترس نیست",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "پورت‌های پراکسی محلی",
+  "settings#local-proxy-ports#leave-blank": "برای انتخاب پورت به صورت خودکار <strong>خالی</strong> بگذارید (مورد توصیه).",
+  "settings#local-proxy-ports#reason": "اگر از ابزارهای کمپیوتر خود استفاده میکنید که برای کار کردن با سایفون به تنظیم دستی نیاز دارند، میتوانید از سایفون بخواهید همیشه از همان شماره پورت‌های محلی استفاده کند. اگر کدام دلیل برای مشخص کردن شماره پورت‌ها ندارید، باید به سایفون اجازه بدهید آنها را به‌طور خودکار انتخاب کند تا از بروز تداخل جلوگیری شود.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "باید بین 1 تا 65535 باشد.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "پورت‌های محلی باید از یکدیگر متمایز باشند.",
+  "settings#local-proxy-ports#error-modal-title": "تعارض پورت پراکسی محلی",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nسایفون را تنظیم کرده‌اید تا از یک پورت محلی خاص برای پراکسی HTTP خود استفاده کند.<br>\nبا این حال، به نظر میرسد این پورت در حال حاضر مورد استفاده است و بنابراین سایفون نمیتواند از آن استفاده نماید.\n</p>\n<p>\nلطفاً مقدار پورت پراکسی HTTP تنظیم شده را تغییر داده و دوباره امتحان کنید. توصیه میکنیم این مقدار را پاک کنید تا سایفون بتواند به‌ صورت خودکار یک پورت موجود را انتخاب کند.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nسایفون را تنظیم کرده‌اید تا از یک پورت محلی خاص برای پراکسی SOCKS خود استفاده کند.<br>\nبا این حال، به نظر میرسد این پورت در حال حاضر مورد استفاده است و بنابراین سایفون نمیتواند از آن استفاده نماید.\n</p>\n<p>\nلطفاً مقدار پورت پراکسی SOCKS تنظیم شده را تغییر داده و دوباره امتحان کنید. توصیه میکنیم این مقدار را پاک کنید تا سایفون بتواند به‌ صورت خودکار یک پورت موجود را انتخاب کند.\n</p>",
+  "settings#upstream-proxy#heading": "پراکسی فوق",
+  "settings#upstream-proxy#by-default": "اگر کمپیوتر شما در حال حاضر دارای پراکسی تنظیم شده است، سایفون به‌طور پیش‌فرض از آن پراکسی در هنگام ایجاد تونل استفاده میکند. میتوانید با تعیین یک پراکسی جهت استفاده، یا مشخص کردن اینکه نباید از &quot;پراکسی فوق&quot; استفاده شود، این رفتار را نادیده بگیرید.",
+  "settings#upstream-proxy#reason": "بعضی اوقات استفاده از پراکسی‌های فوق توسط مکاتب، پوهنتون ها یا تجارت ها الزامی است. اگر ارائه‌دهنده شبکه تنظیمات پراکسی فوق را به شما داده است، در این صورت ممکن است برای برقراری اتصال لازم باشد آنها را به‌صورت دستی در اینجا تنظیم کنید.",
+  "settings#upstream-proxy#proxy-reqs": "فقط پراکسی‌های HTTP که از HTTPS پشتیبانی میکنند مجاز هستند.",
+  "settings#upstream-proxy#hostname-label": "نام میزبان",
+  "settings#upstream-proxy#port-label": "پورت",
+  "settings#upstream-proxy#username-label": "نام کاربری",
+  "settings#upstream-proxy#password-label": "رمز عبور",
+  "settings#upstream-proxy#domain-label": "دامنه",
+  "settings#upstream-proxy#skip-label": "از پراکسی فوق استفاده نشود",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "خطای پراکسی فوق",
+  "settings#upstream-proxy#error-modal-body-default": "سایفون در حال حاضر تنظیم شده تا از پراکسی سیستم شما به عنوان \"پراکسی فوق\" خود استفاده کند.<br>\nبا این حال، به نظر میرسد نمیتوانیم از طریق این پراکسی به یک سرور سایفون متصل شویم.<br>\nلطفاً گزینه \"از پراکسی فوق استفاده نشود\" را فعال و دوباره امتحان کنید.",
+  "settings#upstream-proxy#error-modal-body-configured": "سایفون را طوری تنظیم کرده‌اید تا از یک \"پراکسی فوق\" استفاده کند.<br>\nبا این حال، به نظر میرسد نمیتوانیم از طریق این پراکسی به یک سرور سایفون متصل شویم.<br>\nلطفاً تنظیمات را تغییر داده و دوباره امتحان کنید.",
+  "settings#transport-mode#heading": "حالت انتقال",
+  "settings#transport-mode#check-label": "استفاده از حالت L2TP/IPSec",
+  "settings#transport-mode#help-text": "استفاده از شبکه مجازی ویندوز L2TP/IPSec. این حالت تمام برنامه‌های شما را تونل میکند، اما ابهام ایجاد نمیکند و به همین دلیل قابلیت‌های عبور از سانسور نیرومند ندارد. برای عبور از اکثر فایروال‌ها <strong>توصیه نمیشود</strong>.",
+  "settings#systray-minimize#heading": "کوچک شدن به ناحیه اعلان (پطنوس سیستم)",
+  "settings#systray-minimize#help-text": "در صورت فعال بودن آن، پنجره برنامه سایفون در ناحیه اعلان (که با عنوان \"پطنوس سیستم\" شناخته میشود و در نزدیک ساعت در نوار وظیفه ویندوز قرار دارد) پنهان میگردد.",
+  "settings#systray-minimize#reason": "کوچک کردن سایفون در ناحیه اعلان (\"پطنوس سیستم\") فضای روی نوار وظیفه شما را آزاد میکند. این کار به‌خصوص در هنگام مفید است که اکثراً برای مدت زمان طولانی سایفون را اجرا کنید.",
+  "settings#systray-minimize#enable-label": "کوچک شدن به ناحیه اعلان (پطنوس سیستم)",
+  "settings#applying-message": "اتصال مجدد برای اعمال تنظیمات شما.",
+  "settings#saved-message": "تنظیمات ذخیره شد.",
+  "settings#error-modal#title": "خطا در تنظیمات",
+  "settings#error-modal#body": "خطاهای در مقادیر تنظیمات شما وجود دارند. لطفاً قبل از ادامه آنها را اصلاح کنید.",
+  "feedback#top_content_title": "نظرتان را به ما بگویید",
+  "feedback#top_para_2": "با دانلود آخرین نسخه، میتوان بسیاری از مشکلات را حل کرد. میتوانید <a class=\"NewVersionURL\" href=\"#\">آخرین نسخه را با کلیک در اینجا دانلود کنید</a>، یا میتوانید یک ایمیل به <a class=\"NewVersionEmail\" href=\"#\"></a> بفرستید.",
+  "feedback#top_para_3": "میتوانید راه های بسیار از حل‌ مشکلات رایج را در <a class=\"FaqURL\" href=\"#\">سؤالات مکرر</a> ما پیدا کنید.",
+  "feedback#smiley_happy": "سایفون متصل میشود و به شکل که میخواهم کار میکند.",
+  "feedback#smiley_sad": "سایفون اکثراً متصل نمیشود یا به‌خوبی کار نمیکند.",
+  "feedback#text_feedback_prompt": "لطفاً نظر خود را وارد کنید:",
+  "feedback#text_feedback_email_prompt": "اگر میخواهید به شما پاسخ بدهیم، لطفاً آدرس ایمیل خود را وارد کنید:",
+  "feedback#diagnostic_check": "آپلود داده‌های تشخیصی. لطفاً توجه داشته باشید که این معلومات تشخیصی موجب شناسایی شما نمیشود اما به ما کمک میکند تا اجرای سایفون را بهتر کنیم. <a class=\"DataCollectionInfoURL\" href=\"#\">اینجا را کلیک کنید تا ببینید کدام معلومات را جمع‌آوری میکنیم.</a>",
+  "feedback#submit_button": "ارسال",
+  "feedback#text_feedback_bottom_para": "اگر فورم بالا کار نمیکند یا میخواهید عکس از صفحه ارسال کنید، لطفاً به آدرس <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ایمیل بفرستید.",
+  "feedback#success-message": "<strong>با تشکر!</strong> نظر شما ارسال شد.",
+  "logs#show-debug-label": "نمایش گزارش‌های ثبت رفع مشکل",
+  "logs#placeholder": "هیچ گزارش ثبتی وجود ندارد",
+  "language#success-message": "<strong>سلام!</strong> به سایفون خوش آمدید.",
+  "about#wordart-tag": "فراتر از مرزها",
+  "about#description": "سایفون یک <strong>ابزار انحراف از سانسور است</strong> - به این منظور طراحی شده تا دسترسی به انترنیت آزاد، عبور از سانسور و فایروال‌ها را فراهم کند.  این برنامه <strong>منبع باز</strong> است و در تورنتو، کانادا انکشاف یافته است.",
+  "about#visit-download-site": "لطفاً از این ویب سایت بازدید کنید تا <strong><a class=\"NewVersionURL\" href=\"#\">یک نسخه جدید را دانلود کنید</a></strong> یا <strong><a class=\"InfoURL\" href=\"#\">راهنمایی و معلومات دریافت کنید</a></strong>. سایفون برای اندرواید و ویندوز در دسترس است.",
+  "about#get-by-email": "<strong>اگر ویب سایت غیرقابل دسترس است</strong>، میتوانید نسخه جدید سایفون را با ارسال ایمیل به این آدرس دریافت کنید:",
+  "about#client-version": "سایفون برای نسخه سرویس‌گیرنده ویندوز:",
+  "general#modal-close-button": "بستن",
+  "general#notice-modal-tech-preamble": "معلومات فنی خطا در اینجا آمده است:",
+  "notice#systemproxysettings-setproxy-error-title": "خطای پراکسی سیستم",
+  "notice#systemproxysettings-setproxy-error-body": "<p>سایفون موفق به تنظیم تنظیمات پراکسی سیستم نشد.</p>\n<p>ممکن است دلیل آن تداخل با نرم‌افزار آنتی‌ویروس شما باشد. ممکن است لازم باشد برنامه یا تنظیمات پراکسی سیستم خود را برای استفاده از پراکسی‌های محلی سایفون به‌طور دستی تنظیم نمایید.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "سایفون موفق به تنظیم تنظیمات پراکسی سیستم به نام \"<%- data %>\" برای اتصال به انترنیت نشد. ممکن است دلیل آن تداخل با نرم‌افزار آنتی‌ویروس شما باشد. ممکن است لازم باشد برنامه یا تنظیمات پراکسی سیستم خود را برای استفاده از پراکسی‌های محلی سایفون به‌طور دستی تنظیم نمایید.",
+  "appbackend#state-stopped-title": "سایفون قطع شد",
+  "appbackend#state-starting-title": "سایفون در حال اتصال است",
+  "appbackend#state-starting-body": "لطفاً صبر کنید...",
+  "appbackend#state-connected-title": "سایفون متصل است",
+  "appbackend#state-connected-body": "فراتر از مرزهای خود را بکاوید!",
+  "appbackend#state-connected-reminder-title": "سایفون ارتباط شما را حفظ میکند",
+  "appbackend#state-connected-reminder-body": "سایفون ر رایگان نگهدارید. برای بازدید از صفحات حامی مالی اینجا را کلیک کنید!",
+  "appbackend#state-connected-reminder-body-2": "با بازدید از صفحات حامی مالی ما سایفون را رایگان نگهدارید!",
+  "appbackend#minimized-to-systray-title": "سایفون در ناحیه اعلان کوچک شده است",
+  "appbackend#minimized-to-systray-body": "برای بازگرداندن برنامه روی آیکن آن کلیک کنید",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "تمویل شده توسط"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["fi"].translation = {
+  "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Connecting",
+  "nav#connection#connected": "Yhdistetty",
+  "nav#connection#stopping": "Disconnecting",
+  "nav#connection#stopped": "Yhteys katkaistu",
+  "nav#settings": "Asetukset",
+  "nav#feedback": "Palaute",
+  "nav#logs": "Logitiedostot",
+  "nav#about": "Ohjelmasta",
+  "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
+  "connection#stop-btn": "Loppu",
+  "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
+  "connection#disconnect-btn": "Katkaise yhteys",
+  "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
+  "connection#wait-btn": "Please wait…",
+  "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
+  "connection#connect-btn": "Yhdistä",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
+  "settings#reset-button": "Nollaa oletusarvoihin",
+  "settings#apply-button": "Apply Changes",
+  "settings#unapplied-changes-prompt#title": "Settings Changed",
+  "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
+  "settings#unapplied-changes-prompt#apply-button": "Apply",
+  "settings#unapplied-changes-prompt#discard-button": "Discard",
+  "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Split Tunnel",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
+  "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
+  "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
+  "settings#egress-region#heading": "Psiphon Server Region",
+  "settings#egress-region#select-best-performance": "Paras suorituskyky",
+  "settings#egress-region#select-us": "Yhdysvallat",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Yhdistynyt kuningaskunta",
+  "settings#egress-region#select-jp": "Japani",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Hollanti",
+  "settings#egress-region#select-de": "Saksa",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Spain",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austria",
+  "settings#egress-region#select-be": "Belgium",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Switzerland",
+  "settings#egress-region#select-cz": "Czech Republic",
+  "settings#egress-region#select-dk": "Denmark",
+  "settings#egress-region#select-fr": "France",
+  "settings#egress-region#select-hu": "Hungary",
+  "settings#egress-region#select-it": "Italy",
+  "settings#egress-region#select-no": "Norway",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Sweden",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
+  "settings#egress-region#error-modal-title": "Server Region Unavailable",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Local Proxy Ports",
+  "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
+  "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "On oltava välillä 1 ... 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
+  "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#upstream-proxy#heading": "Upstream Proxy",
+  "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
+  "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
+  "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
+  "settings#upstream-proxy#hostname-label": "Verkkotietokone",
+  "settings#upstream-proxy#port-label": "Portti",
+  "settings#upstream-proxy#username-label": "Käyttäjätunnus",
+  "settings#upstream-proxy#password-label": "Salasana",
+  "settings#upstream-proxy#domain-label": "Domain",
+  "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
+  "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
+  "settings#transport-mode#heading": "Siirtotila",
+  "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
+  "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
+  "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
+  "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
+  "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
+  "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
+  "settings#applying-message": "Reconnecting to apply your settings.",
+  "settings#saved-message": "Asetukset tallennettu.",
+  "settings#error-modal#title": "Settings Error",
+  "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
+  "feedback#top_content_title": "Anna meille palautettasi",
+  "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
+  "feedback#smiley_happy": "Psiphon yhdistää ja suorittaa siten kuin haluan.",
+  "feedback#smiley_sad": "Psiphon usein epäonnistuu yhdistämään tai ei suoriudu kyllin hyvin.",
+  "feedback#text_feedback_prompt": "Kirjoita kommenttisi tähän:",
+  "feedback#text_feedback_email_prompt": "Jos haluat meidän vastaavan, kirjoita sähköpostiosoitteesi:",
+  "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
+  "feedback#submit_button": "Lähetä",
+  "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Kiitos!</strong> Palautteesi on lähetetty.",
+  "logs#show-debug-label": "Show debug logs",
+  "logs#placeholder": "No logs yet",
+  "language#success-message": "<strong>Hei!</strong> Tervetuloa Psiphon-sovellukseen.",
+  "about#wordart-tag": "Beyond Borders",
+  "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
+  "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
+  "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
+  "about#client-version": "Psiphon for Windows client version:",
+  "general#modal-close-button": "Sulje",
+  "general#notice-modal-tech-preamble": "Here is the technical error info:",
+  "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
+  "appbackend#state-stopped-title": "Psiphon-yhteys on katkaistu",
+  "appbackend#state-starting-title": "Psiphon is connecting",
+  "appbackend#state-starting-body": "Please wait…",
+  "appbackend#state-connected-title": "Psiphon on yhdistetty",
+  "appbackend#state-connected-body": "Explore beyond your borders!",
+  "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
+  "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+  "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+  "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
+  "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Sponsoroija:"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["fr"].translation = {
+  "banner#long-connecting": "<strong>Oh non.</strong> Il semble que vous éprouviez des difficultés de connexion.<br>\nTéléchargez la version la plus récente de Psiphon sur le <a class=\"NewVersionURL\" href=\"#\">\nou en envoyant un courriel à <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Connexion",
+  "nav#connection#connected": "Connecté",
+  "nav#connection#stopping": "Déconnexion",
+  "nav#connection#stopped": "Déconnecté",
+  "nav#settings": "Paramètres",
+  "nav#feedback": "Rétroaction",
+  "nav#logs": "Journaux",
+  "nav#about": "À propos",
+  "connection#starting-msg": "Psiphon se <span class=\"state-word\">connecte</span>…",
+  "connection#stop-btn": "Arrêter",
+  "connection#connected-msg": "Psiphon est <span class=\"state-word\">connecté</span>",
+  "connection#disconnect-btn": "Se déconnecter",
+  "connection#stopping-msg": "Psiphon se <span class=\"state-word\">déconnecte</span>…",
+  "connection#wait-btn": "Veuillez patientez…",
+  "connection#stopped-msg": "Psiphon est <span class=\"state-word\">déconnecté</span>",
+  "connection#connect-btn": "Se connecter",
+  "connection#egress-region-combo-label": "Sélectionner la région du serveur",
+  "settings#error-alert": "<strong>Erreur.</strong> Veuillez corriger les valeurs erronées avant de continuer.",
+  "settings#reset-button": "Réinitialiser aux valeurs par défaut",
+  "settings#apply-button": "Appliquer les changements",
+  "settings#unapplied-changes-prompt#title": "Paramètres modifiés.",
+  "settings#unapplied-changes-prompt#body": "Vous avez apporté des changements à vos paramètres, mais vous ne les avez pas appliqués.\n<br><br>Voulez-vous appliquer ces changements maintenant ou les abandonner ?",
+  "settings#unapplied-changes-prompt#apply-button": "Appliquer",
+  "settings#unapplied-changes-prompt#discard-button": "Abandonner",
+  "settings#vpn-incompatible-msg": "(ne fonctionne pas avec le mode L2TP/IPSec.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Tunnel scindé",
+  "settings#split-tunnel#help-text": "Si cette option est activée, les requêtes faites aux serveurs qui se trouvent dans votre pays de résidence ne seront pas tunnellisées par Psiphon.",
+  "settings#split-tunnel#reason": "Les sites Web de votre pays de résidence ne sont généralement pas bloqués. L’activation de cette option vous donnera donc un accès plus rapide vers ces sites et pourrait parfois réduire les coûts d’utilisation de données de votre FAI.",
+  "settings#split-tunnel#enable-label": "Ne pas relayer les sites Web de votre pays",
+  "settings#disable-timeouts#heading": "Désactiver les temporisations pour les réseaux lents",
+  "settings#disable-timeouts#help-text": "Si cette option est activée, la communication avec le serveur Psiphon n’arrivera jamais au bout de son délai.",
+  "settings#disable-timeouts#reason": "En activant cette option sur une connexion réseau très lente, les déconnexions imprévues sont moins probables.",
+  "settings#disable-timeouts#enable-label": "Désactiver les temporisations pour les réseaux lents",
+  "settings#egress-region#heading": "Région de serveur Psiphon",
+  "settings#egress-region#select-best-performance": "Les meilleures performances",
+  "settings#egress-region#select-us": "États-Unis",
+  "settings#egress-region#select-ca": "Canada",
+  "settings#egress-region#select-gb": "Royaume-Uni",
+  "settings#egress-region#select-jp": "Japon",
+  "settings#egress-region#select-sg": "Singapour",
+  "settings#egress-region#select-sk": "Slovaquie",
+  "settings#egress-region#select-nl": "Pays-Bas",
+  "settings#egress-region#select-de": "Allemagne",
+  "settings#egress-region#select-in": "Inde",
+  "settings#egress-region#select-es": "Espagne",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Autriche",
+  "settings#egress-region#select-be": "Belgique",
+  "settings#egress-region#select-bg": "Bulgarie",
+  "settings#egress-region#select-ch": "Suisse",
+  "settings#egress-region#select-cz": "République tchèque",
+  "settings#egress-region#select-dk": "Danemark",
+  "settings#egress-region#select-fr": "France",
+  "settings#egress-region#select-hu": "Hongrie",
+  "settings#egress-region#select-it": "Italie",
+  "settings#egress-region#select-no": "Norvège",
+  "settings#egress-region#select-ro": "Roumanie",
+  "settings#egress-region#select-se": "Suède",
+  "settings#egress-region#select-pl": "Pologne",
+  "settings#egress-region#select-rs": "Serbie",
+  "settings#egress-region#select-au": "Australie",
+  "settings#egress-region#description": "Psiphon a des serveurs dans de nombreux pays et régions différents. L’utilisation d’un serveur Psiphon dans une région proche de votre pays de résidence fournira habituellement une meilleure connexion réseau, mais vous pourriez souhaiter accéder à des sites Web et des services comme si vous étiez virtuellement dans un pays ou une région particuliers.",
+  "settings#egress-region#default": "Le choix de l’option du <strong>« Les meilleures performances »</strong> permet à Psiphon de choisir automatiquement un serveur, ce qui donnera habituellement la meilleure connexion réseau.",
+  "settings#egress-region#invalid-error-msg": "Choisir une région valide de serveur Psiphon.",
+  "settings#egress-region#error-modal-title": "La région de serveurs n’est pas proposée",
+  "settings#egress-region#error-modal-body-http": "Vous avez configuré Psiphon pour qu’il utilise un serveur dans une région particulière.<br>\nToutefois, cette région n’est plus proposée.<br>\nVous devez choisir une nouvelle région ou changer pour le choix par défaut « Les meilleures performances ».",
+  "settings#local-proxy-ports#heading": "Ports de mandataires locaux",
+  "settings#local-proxy-ports#leave-blank": "Laisser <strong>vide</strong> pour une sélection automatique du port (recommandé).",
+  "settings#local-proxy-ports#reason": "Si vous utilisez sur votre ordinateur des outils demandant une configuration manuelle afin de fonctionner avec Psiphon, Psiphon devrait systématiquement utiliser les mêmes numéros de port local. Si vous n’avez pas de raison de spécifier des numéros de port, vous devriez permettre à Psiphon de les choisir automatiquement pour aider à éviter les conflits.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Doit être entre 1 et 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Les ports locaux doivent être distincts les uns des autres.",
+  "settings#local-proxy-ports#error-modal-title": "Conflit de port pour le mandataire local",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nVous avez configuré Psiphon pour qu’il utilise un port local spécifique pour son serveur mandataire HTTP.<br>\nCependant, il semble que ce port est déjà utilisé et donc, Psiphon ne peut pas s’en servir.\n</p>\n<p>\nVeuillez changer la valeur de port de mandataire HTTP configurée et réessayer. Nous vous recommandons de supprimer la valeur afin que Psiphon puisse choisir automatiquement un port disponible.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nVous avez configuré Psiphon pour qu’il utilise un port local spécifique pour son serveur mandataire SOCKS.<br>\nCependant, il semble que ce port est déjà utilisé et donc, Psiphon ne peut pas s’en servir.\n</p>\n<p>\nVeuillez changer la valeur de port de mandataire SOCKS configurée et réessayer. Nous vous recommandons de supprimer la valeur afin que Psiphon puisse choisir automatiquement un port disponible.\n</p>",
+  "settings#upstream-proxy#heading": "Mandataire ascendant",
+  "settings#upstream-proxy#by-default": "Si un mandataire est déjà configuré sur votre ordinateur, par défaut Psiphon utilisera ce mandataire lors de la mise en place d’un tunnel. Vous pouvez passer outre ce comportement en spécifiant un mandataire à utiliser ou en spécifiant qu’aucun « mandataire ascendant » ne devrait être utilisé.",
+  "settings#upstream-proxy#reason": "Les serveurs mandataires ascendants sont parfois exigés par les écoles, les universités ou les entreprises. Si votre fournisseur de réseau vous a donné des paramètres de mandataire ascendant, il sera peut-être nécessaire de les configurer manuellement ici pour vous connecter.",
+  "settings#upstream-proxy#proxy-reqs": "Seuls les mandataires HTTP prenant en charge HTTPS sont permis.",
+  "settings#upstream-proxy#hostname-label": "Nom d’hôte",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Nom d’utilisateur",
+  "settings#upstream-proxy#password-label": "Mot de passe",
+  "settings#upstream-proxy#domain-label": "Domaine",
+  "settings#upstream-proxy#skip-label": "Ne pas utiliser de mandataire ascendant",
+  "settings#upstream-proxy#set-hostname-error-msg": "Vous devez indiquer un Nom d’hôte ou, pour une sélection automatique, laisser tous les champs Mandataire ascendant vides.",
+  "settings#upstream-proxy#set-username-error-msg": "Vous devez indiquer un Nom d’utilisateur si vous définissez un Mot de passe ou un Domaine ou, pour aucune authentification, laisser tous les champs d’authentification vides.",
+  "settings#upstream-proxy#error-modal-title": "Erreur de mandataire ascendant",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon est actuellement configuré pour utiliser le mandataire de votre système comme « mandataire ascendant ».<br>\nCependant, il nous semble impossible de nous connecter à un serveur Psiphon par ce mandataire.<br>\nVeuillez activer « Ne pas utiliser de mandataire ascendant » et réessayer.",
+  "settings#upstream-proxy#error-modal-body-configured": "Vous avez configuré Psiphon pour qu’il utilise un serveur « mandataire ascendant ».<br>\nCependant, il nous semble impossible de nous connecter à un serveur Psiphon par ce mandataire.<br>\nVeuillez corriger les paramètres et réessayer.",
+  "settings#transport-mode#heading": "Mode de transport",
+  "settings#transport-mode#check-label": "Utiliser le mode L2TP/IPSec",
+  "settings#transport-mode#help-text": "Utilise le réseautage virtuel L2TP/IPSec de Windows. Ce mode tunnellisera toutes vos applis, mais ne fournit pas de brouillage, ni de réelle capacité de contournement de la censure. Il <strong>n’est pas recommandé</strong> pour passer outre la plupart des pare-feu.",
+  "settings#systray-minimize#heading": "Minimiser vers la zone de notification",
+  "settings#systray-minimize#help-text": "Si cette option est activée, la fenêtre d’application de Psiphon minimisée sera cachée dans la zone de notification (située près de l’horloge dans la barre des tâches de Windows).",
+  "settings#systray-minimize#reason": "La minimisation de Psiphon vers la zone de notification libère de l’espace sur la barre des tâches, ce qui est particulièrement pratique si vous exécutez souvent Psiphon durant de longues périodes.",
+  "settings#systray-minimize#enable-label": "Minimiser vers la zone de notification",
+  "settings#applying-message": "Reconnexion pour mettre en place vos paramètres.",
+  "settings#saved-message": "Paramètres enregistrés.",
+  "settings#error-modal#title": "Erreur de paramétrage",
+  "settings#error-modal#body": "Les valeurs de vos paramètres comportent des erreurs. Veuillez les corriger avant de continuer.",
+  "feedback#top_content_title": "Laissez-nous une rétroaction",
+  "feedback#top_para_2": "De nombreux problèmes peuvent être corrigés en téléchargeant la dernière version. Vous pouvez <a class=\"NewVersionURL\" href=\"#\">télécharger la dernière version en cliquant ici</a> ou vous pouvez envoyer un courriel à <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Vous trouverez aussi des solutions à de nombreux problèmes habituels dans notre <a class=\"FaqURL\" href=\"#\">foire aux questions</a>.",
+  "feedback#smiley_happy": "Psiphon se connecte et fonctionne comme je le veux.",
+  "feedback#smiley_sad": "Psiphon n’arrive souvent pas à se connecter et ne fonctionne pas assez bien.",
+  "feedback#text_feedback_prompt": "Veuillez saisir vos commentaires ici :",
+  "feedback#text_feedback_email_prompt": "Si vous souhaitez que nous vous répondions, veuillez saisir votre adresse courriel :",
+  "feedback#diagnostic_check": "Téléverser des données de diagnostic. Veuillez prendre note que ces données de diagnostic ne vous identifient pas et elles nous aideront à offrir une exécution sans heurt de Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Cliquez ici pour voir quelles données nous recueillons.</a>",
+  "feedback#submit_button": "Envoyer",
+  "feedback#text_feedback_bottom_para": "Si le formulaire ci-dessus ne fonctionne pas  ou si vous voulez envoyer des captures d’écran, veuillez nous envoyer un courriel à <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Merci.</strong> Votre rétroaction a été envoyée.",
+  "logs#show-debug-label": "Montrer les journaux de débogage",
+  "logs#placeholder": "Pas encore de journal",
+  "language#success-message": "<strong>Bonjour.</strong> Bienvenue à Psiphon.",
+  "about#wordart-tag": "Par-delà les frontières",
+  "about#description": "Psiphon est un <strong>outil de contournement de la censure</strong> — il est conçu pour donner l’accès à l’Internet ouvert, au-delà des censeurs et des pare-feu. Il est à <strong>code source ouvert</strong> et développé à Toronto, Canada.",
+  "about#visit-download-site": "Veuillez visiter le site Web pour <strong><a class=\"NewVersionURL\" href=\"#\">télécharger une nouvelle version</a></strong> ou pour <strong><a class=\"InfoURL\" href=\"#\">obtenir de l’aide et des renseignements</a></strong>. Psiphon est proposé pour Android et Windows.",
+  "about#get-by-email": "<strong>Si le site Web n’est pas accessible</strong>, vous pouvez obtenir une nouvelle version de Psiphon en envoyant un courriel à :",
+  "about#client-version": "Version du client Psiphon pour Windows :",
+  "general#modal-close-button": "Fermer",
+  "general#notice-modal-tech-preamble": "Voici les infos techniques de l’erreur :",
+  "notice#systemproxysettings-setproxy-error-title": "Erreur de mandataire système",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon n’a pas réussi à paramétrer le mandataire système.</p>\n<p>Cela pourrait être dû à un conflit avec votre antivirus. Il vous faudra peut-être configurer manuellement votre application ou votre mandataire système afin qu’ils utilisent les mandataires locaux de Psiphon.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon n’a pas réussi à paramétrer le mandataire système pour la connexion Internet « %- data %> ». Cela pourrait être dû à un conflit avec votre antivirus. Il vous faudra peut-être configurer manuellement votre application ou votre mandataire système afin qu’ils utilisent les mandataires locaux de Psiphon.</p>",
+  "appbackend#state-stopped-title": "Psiphon est déconnecté",
+  "appbackend#state-starting-title": "Psiphon se connecte",
+  "appbackend#state-starting-body": "Veuillez patientez…",
+  "appbackend#state-connected-title": "Psiphon est connecté",
+  "appbackend#state-connected-body": "Explorez par-delà vos frontières.",
+  "appbackend#state-connected-reminder-title": "Psiphon vous garde connecté",
+  "appbackend#state-connected-reminder-body": "Préservez la gratuité de Psiphon. Cliquez ici pour visiter les pages de nos commanditaires.",
+  "appbackend#state-connected-reminder-body-2": "Préservez la gratuité de Psiphon en visitant les pages de nos commanditaires.",
+  "appbackend#minimized-to-systray-title": "Psiphon a été minimisé vers la zone de notification",
+  "appbackend#minimized-to-systray-body": "Cliquez sur l’icône pour restaurer l’application",
+  "appbackend#os-unsupported": "Psiphon ne prend plus en charge ni Windows XP ni Vista. Veuillez visiter notre site Web pour plus de précisions.",
+  "psicash#transaction-error-title": "Erreur transactionnelle PsiCash",
+  "psicash#transaction-error-body": "Échec inattendu de votre tentative de transaction PsiCash.",
+  "psicash#transaction-ExistingTransaction-title": "L’achat PsiCash existe déjà",
+  "psicash#transaction-ExistingTransaction-body": "Vous avez déjà un achat PsiCash de ce type. Il ne peut y avoir d’autre achat de ce type tant que le précédent n’est pas expiré. L’état de votre PsiCash sera actualisé maintenant.",
+  "psicash#transaction-InsufficientBalance-title": "Le solde PsiCash est insuffisant",
+  "psicash#transaction-InsufficientBalance-body": "Votre solde PsiCash est insuffisant pour cet achat.",
+  "psicash#transaction-TransactionAmountMismatch-title": "Différence de prix d’achat PsiCash",
+  "psicash#transaction-TransactionAmountMismatch-body": "Les prix d’achat PsiCash ne sont pas à jour. Votre état PsiCash sera actualisé maintenant.",
+  "psicash#transaction-TransactionTypeNotFound-title": "Le type d’achat PsiCash est introuvable",
+  "psicash#transaction-TransactionTypeNotFound-body": "Le produit que vous tentez d’acheter n’existe plus. Vous devrez peut-être mettre l’appli à jour ou la réinstaller.",
+  "psicash#transaction-InvalidTokens-title": "Les jetons PsiCash sont invalides",
+  "psicash#transaction-InvalidTokens-body": "Vos jetons PsiCash sont invalides. Essayez de redémarrer l’appli. Si cela ne suffit pas, vous devrez <a href=\"https://psiphon3.com/fr/faq.html#clear-windows-data\"> vider votre cache local.</a>.",
+  "psicash#transaction-ServerError-title": "Erreur du serveur PsiCash",
+  "psicash#transaction-ServerError-body": "Le serveur PsiCash a répondu par une erreur lors de la tentative d’achat. Veuillez réessayer votre achat plus tard.",
+  "psicash#ui-speedboost-active": "La Survitesse est active pendant %s",
+  "psicash#ui-zerobalance-title": "Avez-vous besoin de plus de vitesse ?",
+  "psicash#ui-buypsi": "Acheter du PsiCash",
+  "psicash#ui-buymorepsi": "Acheter plus de PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Requis pour la Survitesse",
+  "psicash#ui-enoughbalance-buttontext": "Lancer la Survitesse",
+  "psicash#1-hour": "1 heure",
+  "psicash#1-day": "1  jour",
+  "psicash#ui-buyingboost-buttontext": "Lancement de la Survitesse…",
+  "positive-value-indicator": "+ %d",
+  "psicash#mustconnect-modal#title": "La connexion à Psiphon est exigée",
+  "psicash#mustconnect-modal#body": "Afin utiliser le PsiCash, vous devez être connecté au réseau Psiphon.",
+  "psicash#init-error-title": "Erreur d’initialisation PsiCash",
+  "psicash#init-error-body-unrecovered": "L’initialisation de PsiCash a échoué. Cela est probablement causé par un problème du système de fichiers, tel qu’un manque d’espace disque. Vos solde et autre état sont perdus. PsiCash sera inutilisable. Vous pouvez tenter de redémarrer l’appli pour régler ce problème.",
+  "psicash#init-error-body-recovered": "L’initialisation de PsiCash a échoué. Cela est probablement causé par un problème du système de fichiers, tel qu’un manque d’espace disque. Vos solde et autre état sont réinitialisés.",
+  "psicash#psiphon-speed": "Vitesse<br>Psiphon",
+  "notice#disallowed-traffic-alert-title": "Surclassez votre connexion Psiphon",
+  "notice#disallowed-traffic-alert-body": "<p>Les applis ne fonctionnent-elles pas ?</p>\n<p>Une partie du trafic Internet n’est pas prise en charge sans une Survitesse active. Activez la Survitesse avec du PsiCash afin de libérer le plein potentiel de votre expérience Psiphon.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Les applis ne fonctionnent-elles pas ?",
+  "appbackend#disallowed-traffic-notification-body": "Activez la Survitesse afin de libérer le plein potentiel de votre expérience Psiphon.",
+  "settings#disallowed-traffic-alert#heading": "Alerte de trafic refusé",
+  "settings#disallowed-traffic-alert#help-text": "Certains types de trafic Internet ne sont pas pris en charge sans une Survitesse active. Quand un tel trafic est refusé, une alerte est affichée. (La réactivation demandera une reconnexion.)",
+  "settings#disallowed-traffic-alert#disable-label": "Désactiver les alertes de trafic refusé",
+  "banner#sponsored-by": "Commandité par"
+};
\ No newline at end of file
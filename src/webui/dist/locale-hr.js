@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["hr"].translation = {
+  "banner#long-connecting": "<strong>O ne!</strong> Čini se da imate problema sa spajanjem!<br>\nPreuzmite najnoviju verziju Psiphona sa <a class=\"NewVersionURL\" href=\"#\">stranice za preuzimanje</a>\nili pošaljite email na <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Spajanje",
+  "nav#connection#connected": "Spojeno",
+  "nav#connection#stopping": "Odspajanje",
+  "nav#connection#stopped": "Odspojeno",
+  "nav#settings": "Postavke",
+  "nav#feedback": "Povratne informacije",
+  "nav#logs": "Zapisi",
+  "nav#about": "O Psiphonu",
+  "connection#starting-msg": "Psiphon se <span class=\"state-word\">spaja</span>…",
+  "connection#stop-btn": "Stop",
+  "connection#connected-msg": "Psiphon je <span class=\"state-word\">spojen</span>",
+  "connection#disconnect-btn": "Odspoji",
+  "connection#stopping-msg": "Psiphon se <span class=\"state-word\">odspaja</span>…",
+  "connection#wait-btn": "Molimo pričekajte...",
+  "connection#stopped-msg": "Psiphon je <span class=\"state-word\">odspojen</span>",
+  "connection#connect-btn": "Spoji",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Greška!</strong> Molimo Vas ispravite netočne vrijednosti prije nego što nastavite.",
+  "settings#reset-button": "Ponovno postavi na zadano",
+  "settings#apply-button": "Primjeni promjene",
+  "settings#unapplied-changes-prompt#title": "Postavke promijenjene",
+  "settings#unapplied-changes-prompt#body": "Promijenili ste svoje postavke, ali ih niste primjenili.<br><br>Želite li primjeniti svoje promjene sad ili ih želite odbaciti?",
+  "settings#unapplied-changes-prompt#apply-button": "Primjeni",
+  "settings#unapplied-changes-prompt#discard-button": "Odbaci",
+  "settings#vpn-incompatible-msg": "(Ne radi u L2TP/IPSec načinu rada.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Podijeli tunel",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Ne proxyaj stranice unutar države",
+  "settings#disable-timeouts#heading": "Onemogući pauze za spore mreže",
+  "settings#disable-timeouts#help-text": "Ako je ovo omgućeno, komunikacija sa Psiphon poslužiteljem neće pauzirati.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Onemogući pauze za spore mreže",
+  "settings#egress-region#heading": "Regija Psiphon poslužitelja",
+  "settings#egress-region#select-best-performance": "Najbolje performanse",
+  "settings#egress-region#select-us": "Sjedinjenih Američkih Država",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Ujedinjenog Kraljevstva",
+  "settings#egress-region#select-jp": "Japana",
+  "settings#egress-region#select-sg": "Singapura",
+  "settings#egress-region#select-sk": "Slovačka",
+  "settings#egress-region#select-nl": "Nizozemske",
+  "settings#egress-region#select-de": "Njemačke",
+  "settings#egress-region#select-in": "Indija",
+  "settings#egress-region#select-es": "Španjolska",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austrija",
+  "settings#egress-region#select-be": "Belgija",
+  "settings#egress-region#select-bg": "Bugarska",
+  "settings#egress-region#select-ch": "Švicarska",
+  "settings#egress-region#select-cz": "Češka Republika",
+  "settings#egress-region#select-dk": "Danska",
+  "settings#egress-region#select-fr": "Francuska",
+  "settings#egress-region#select-hu": "Mađarska",
+  "settings#egress-region#select-it": "Italija",
+  "settings#egress-region#select-no": "Norveška",
+  "settings#egress-region#select-ro": "Rumunjska",
+  "settings#egress-region#select-se": "Švedska",
+  "settings#egress-region#select-pl": "Poljska",
+  "settings#egress-region#select-rs": "Srbija",
+  "settings#egress-region#select-au": "Australija",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Odaberite ispravnu regiju Psiphon poslužitelja.",
+  "settings#egress-region#error-modal-title": "Regija poslužitelja nedostupna",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Lokalni proxy portovi",
+  "settings#local-proxy-ports#leave-blank": "Ostavite <strong>prazno</strong> za automatski odabir porta (preporučeno).",
+  "settings#local-proxy-ports#reason": "Ako koristite alate na svom računalu koji zahtjevaju ručno konfiguriranje kako bi radili sa Psiphonom, želite da Psiphon konzistentno koristi iste brojeve lokalnih portova. Ako nema razloga specificirati brojeve portova, trebali bi dopustiti Psiphonu da ih odabere automatski kako bi izbjegli konflikte.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Mora biti između 1 i 65535",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Lokalni portovi moraju biti različiti jedni od drugih.",
+  "settings#local-proxy-ports#error-modal-title": "Konflikt portova lokalnog proxya",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nKonfigurirali ste Psiphon da koristi specifičan lokalni port za HTTP proxy.<br>\nKako bilo, čini se da se taj port već koristi tako da ga Psiphon ne može koristiti.\n</p>\n<p>\nMolimo promijenite konfiguriranu HTTP proxy port vrijednost i pokušajte ponovo. Preporučamo da očistiti tu vrijednost tako da Psiphon može automatski odabrati dostupan port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nKonfigurirali ste Psiphon da koristi specifičan lokalni port za SOCKS proxy.<br>\nKako bilo, čini se da se taj port već koristi tako da ga Psiphon ne može koristiti.\n</p>\n<p>\nMolimo promijenite konfiguriranu SOCKS proxy port vrijednost i pokušajte ponovo. Preporučamo da očistite tu vrijednost tako da Psiphon može automatski odabrati dostupan port.\n</p>",
+  "settings#upstream-proxy#heading": "Uzvodni proxy",
+  "settings#upstream-proxy#by-default": "Ako vaše računalo već ima konfiguriran proxy, Psiphon će pod zadano koristiti taj proxy kad uspostavlja tunel. Ovo ponašanje možete zaobići specificirajući proxy koji će se koristiti, ili specificirajući da se nijedan takav \"uzvodni proxy\" ne koristi.",
+  "settings#upstream-proxy#reason": "Uzvodni proxyi su nekad zahtjevani od strane škola, sveučilišta ili tvrtki. Ako znate postavke uzvodnog proxya zahtjevanog od strane Vašeg mrežnog davatelja, možda ćete ih morati ručno unijeti kako bi se spojili.",
+  "settings#upstream-proxy#proxy-reqs": "Samo HTTP proxyi koji podržavaju HTTPS su dopušteni.",
+  "settings#upstream-proxy#hostname-label": "Ime domaćina",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Korisničko ime",
+  "settings#upstream-proxy#password-label": "Lozinka",
+  "settings#upstream-proxy#domain-label": "Domena",
+  "settings#upstream-proxy#skip-label": "Ne koristi uzvodni proxy",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Greška uzvodnog proxya",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon je trenutno konfiguriran da koristi proxy Vašeg sustava kao svoj \"uzvodni proxy\". <br>\nKako bilo, čini se da nismo u mogućnosti spojiti se sa Psiphon poslužiteljem kroz taj proxy.<br>\nMolimo Vas da omogućite \"Ne koristi uzvodni proxy\" i pokušate ponovno.",
+  "settings#upstream-proxy#error-modal-body-configured": "Konfigurirali ste Psiphon da koristi \"uzvodni proxy\".<br>\nKako bilo, čini se da nismo u mogućnosti spojiti se sa Psiphon poslužiteljem kroz taj proxy.<br>\nMolimo Vas da to popravite i pokušate ponovno.",
+  "settings#transport-mode#heading": "Transportni način rada",
+  "settings#transport-mode#check-label": "Koristi L2TP/IPSec način rada",
+  "settings#transport-mode#help-text": "Koristi Windows L2TP/IPSec virtualno umrežavanje. Ovaj način rada će tunelirati sve Vaše aplikacije, ali ne pruža skrivanje i samim time nema snažne mogućnosti obilaženja cenzure. <strong>Nije preporučeno</strong> za obilaženje većine vatrozida.",
+  "settings#systray-minimize#heading": "Smanji u područja obavijesti (traka zadataka)",
+  "settings#systray-minimize#help-text": "Ako je ovo omogućeno, smanjivanjem prozora Psiphona, aplikacija će se sakriti u područje obavijesti (također poznato kao traka zadataka, smješteno blizu sata).",
+  "settings#systray-minimize#reason": "Minimaliziranje Psiphona u obavijesni prostor (sistemska ploča) oslobađa prostor na Vašoj traci zadataka. Ovo je naročito korisno ako često koristite Psiphon u dužim periodima.",
+  "settings#systray-minimize#enable-label": "Smanji u područja obavijesti (traka zadataka)",
+  "settings#applying-message": "Ponovno spajam kako bi primjenio Vaše postavke.",
+  "settings#saved-message": "Postavke spremljene.",
+  "settings#error-modal#title": "Pogreška postavki",
+  "settings#error-modal#body": "Postoje pogreške u vrijednostima Vaših postavki. Molimo, ispravite ih prije nastavljanja.",
+  "feedback#top_content_title": "Dajte nam povratnu informaciju",
+  "feedback#top_para_2": "Mnogi problemi mogu biti riješeni preuzimanjem najnovije verzije. Možete <a class=\"NewVersionURL\" href=\"#\">preuzeti novu verziju ovdje</a>, ili nam možete poslati email na <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Također možete naći riješenja za mnoge učestale probleme među našim <a class=\"FaqURL\" href=\"#\">često postavljenim pitanjima</a>.",
+  "feedback#smiley_happy": "Psiphon se spaja i radi onako kako to i želim.",
+  "feedback#smiley_sad": "Psiphon se često ne uspijeva spojiti ili ne radi dovoljno dobro.",
+  "feedback#text_feedback_prompt": "Molimo unesite svoje komentare ovdje:",
+  "feedback#text_feedback_email_prompt": "Ako želite da Vam odgovorimo, unesite svoju email adresu:",
+  "feedback#diagnostic_check": "Postavite dijagnostičke podatke. Ovi dijagnostički podatci Vas ne identificiraju, a nama će pomoći da održimo Psiphonov rad glatkim. <a class=\"DataCollectionInfoURL\" href=\"#\">Kliknite ovdje kako bi vidjeli koje podatke prikupljamo.</a>",
+  "feedback#submit_button": "Podnesi",
+  "feedback#text_feedback_bottom_para": "Ako gornji predložak ne radi, ili želite poslati slike ekrana, pošaljite nam email na <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>. ",
+  "feedback#success-message": "<strong>Hvala Vam!</strong> Vaše povratne informacije su poslane.",
+  "logs#show-debug-label": "Prikaži zapise o otklanjanju pogreški",
+  "logs#placeholder": "Još nema zapisa",
+  "language#success-message": "<strong>Bok!</strong> Dobro došli u Psiphon.",
+  "about#wordart-tag": "Izvan granica",
+  "about#description": "Psiphon je <strong>alat za obilaženje cenzure</strong> - dizajniran je da pruži pristup otvorenom Internetu, mimo cenzura i vatrozida. <strong>Otvoren je</strong> i razvija se u Torontu, Kanada.",
+  "about#visit-download-site": "Molimo Vas da posjetite stranicu kako bi <strong><a class=\"NewVersionURL\" href=\"#\">preuzeli novu verziju</a></strong> ili kako bi <strong><a class=\"InfoURL\" href=\"#\">dobili pomoć i informacije</a></strong>. Psiphon je dostupan za Android i Windows.",
+  "about#get-by-email": "<strong>Ako je stranica nedostupna</strong>, možete dobiti novu verziju Psiphona slanjem emaila na:",
+  "about#client-version": "Psiphon za Windows verzija klijenta:",
+  "general#modal-close-button": "Zatvori",
+  "general#notice-modal-tech-preamble": "Informacije o tehničkoj pogrešci:",
+  "notice#systemproxysettings-setproxy-error-title": "Pogreška proxya sustava",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon nije uspio postaviti postavke proxya sustava.</p>\n<p>To bi moglo biti zbog konflikta s Vašim antivirusnim softare-om. Možda ćete morati ručno postaviti aplikaciju ili postavke proxya sustava da koriste lokalne Psiphon proxye.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon nije uspio postaviti postavke proxya sustava za Internet vezu \"<%- data %>\". To bi moglo biti zbog konflikta s Vašim antivirusnim softwareom. Možda ćete morati ručno postaviti aplikaciju ili postavke proxya sustava da koriste lokalne Psiphon proxye.",
+  "appbackend#state-stopped-title": "Psiphon nije spojen",
+  "appbackend#state-starting-title": "Psiphon se spaja",
+  "appbackend#state-starting-body": "Molimo pričekajte...",
+  "appbackend#state-connected-title": "Psiphon je spojen",
+  "appbackend#state-connected-body": "Istražite van svojih granica!",
+  "appbackend#state-connected-reminder-title": "Psiphon Vas drži spojene",
+  "appbackend#state-connected-reminder-body": "Nek Psiphon ostane besplatan. Kliknite ovdje kako bi posjetili stranice naših sponzora!",
+  "appbackend#state-connected-reminder-body-2": "Održite Psiphon besplatnim posjećivanjem stranica naših sponzora!",
+  "appbackend#minimized-to-systray-title": "Psiphon je smanjen u područje obavijesti",
+  "appbackend#minimized-to-systray-body": "Kliknite ikonu da bi ponovno otvorili aplikaciju",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 sat",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Sponzorira"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["id"].translation = {
+  "banner#long-connecting": "<strong>Oh, tidak!</strong> Sepertinya Anda mengalami masalah sambungan!<br>\nUnduh versi terbaru Psiphon <a class=\"NewVersionURL\" href=\"#\">di sini</a>\natau dengan mengirim surel ke <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Menyambung",
+  "nav#connection#connected": "Tersambung",
+  "nav#connection#stopping": "Memutus sambungan",
+  "nav#connection#stopped": "Tidak tersambung",
+  "nav#settings": "Setelan",
+  "nav#feedback": "Kritik dan Saran",
+  "nav#logs": "Catatan",
+  "nav#about": "Tentang",
+  "connection#starting-msg": "Psiphon sedang <span class=\"state-word\">menyambung</span>…",
+  "connection#stop-btn": "Hentikan",
+  "connection#connected-msg": "Psiphon telah <span class=\"state-word\">tersambung</span>",
+  "connection#disconnect-btn": "Putus sambungan",
+  "connection#stopping-msg": "Psiphon sedang <span class=\"state-word\">memutus sambungan</span>…",
+  "connection#wait-btn": "Silakan tunggu...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">tidak tersambung</span>",
+  "connection#connect-btn": "Sambungkan",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Galat!</strong> Ubah parameter yang salah sebelum melanjutkan.",
+  "settings#reset-button": "Kembalikan ke Awal",
+  "settings#apply-button": "Terapkan Perubahan",
+  "settings#unapplied-changes-prompt#title": "Setelan Diubah",
+  "settings#unapplied-changes-prompt#body": "Anda telah mengubah setelan, tetapi belum menerapkannya.<br><br>Apakah Anda ingin menerapkan atau membatalkannya?",
+  "settings#unapplied-changes-prompt#apply-button": "Terapkan",
+  "settings#unapplied-changes-prompt#discard-button": "Batalkan",
+  "settings#vpn-incompatible-msg": "(Tidak berfungsi dengan mode L2TP/IPSec)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Terowongan Terpisah",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Jangan alihkan situs web dalam negeri Anda ke proksi",
+  "settings#disable-timeouts#heading": "Menonaktifkan Timeout untuk Jaringan Lambat",
+  "settings#disable-timeouts#help-text": "Jika diaktifkan, komunikasi dengan server Psiphon tidak akan berhenti karena batasan waktu.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Nonaktifkan batasan waktu (timeout) untuk jaringan lambat",
+  "settings#egress-region#heading": "Wilayah Peladen Psiphon",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "Amerika Serikat",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Inggris",
+  "settings#egress-region#select-jp": "Jepang",
+  "settings#egress-region#select-sg": "Singapura",
+  "settings#egress-region#select-sk": "Slowakia",
+  "settings#egress-region#select-nl": "Belanda",
+  "settings#egress-region#select-de": "Jerman",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Spanyol",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austria",
+  "settings#egress-region#select-be": "Belgia",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Swiss",
+  "settings#egress-region#select-cz": "Republik Ceko",
+  "settings#egress-region#select-dk": "Denmark",
+  "settings#egress-region#select-fr": "Perancis",
+  "settings#egress-region#select-hu": "Hungaria",
+  "settings#egress-region#select-it": "Italia",
+  "settings#egress-region#select-no": "Norwegia",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Swedia",
+  "settings#egress-region#select-pl": "Polandia",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Pilih wilayah peladen Psiphon yang berlaku.",
+  "settings#egress-region#error-modal-title": "Wilayah Peladen Tak Tersedia",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Port Proksi Lokal",
+  "settings#local-proxy-ports#leave-blank": "<strong>Kosongkan</strong> untuk memilih port secara otomatis (dianjurkan).",
+  "settings#local-proxy-ports#reason": "JIka Anda menggunakan aplikasi di komputer yang memerlukan konfigurasi manual agar bisa berfungsi dengan Psiphon, Anda harus mengatur Psiphon agar menggunakan nomor port lokal yang sama secara konsisten. Jika Anda tidak harus menentukan nomor port, izinkan Psiphon untuk memilihnya secara otomatis agar tidak terjadi konflik.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Harus diisi antara 1 sampai 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Port lokal harus berbeda satu sama lain.",
+  "settings#local-proxy-ports#error-modal-title": "Konflik Port Proksi Lokal",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nAnda telah mengatur Psiphon agar menggunakan port lokal tertentu sebagai proksi HTTP.<br>\nAkan tetapi, port itu sepertinya telah terpakai sehingga Psiphon tidak dapat menggunakannya.\n</p>\n<p>\nHarap ubah parameter port proksi HTTP Anda, lalu coba lagi. Kami anjurkan agar Anda mengosongkannya saja sehingga Psiphon bisa memilih port yang lowong secara otomatis.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nAnda telah mengatur Psiphon agar menggunakan port lokal tertentu sebagai proksi SOCKS.<br>\nAkan tetapi, port itu sepertinya telah terpakai sehingga Psiphon tidak dapat menggunakannya.\n</p>\n<p>\nHarap ubah parameter port SOCKS Anda, lalu coba lagi. Kami anjurkan agar Anda mengosongkannya saja sehingga Psiphon bisa memilih port yang lowong secara otomatis.\n</p>",
+  "settings#upstream-proxy#heading": "Proksi Hulu (Upstream)",
+  "settings#upstream-proxy#by-default": "Jika proksi di komputer Anda telah dikonfigurasi, Psiphon secara standar akan menggunakan proksi tersebut saat membuat terowongan. Anda boleh tidak mematuhi konfigurasi tersebut dengan menentukan proksi yang digunakan atau menyatakan agar tidak menggunakan \"proksi hulu\" seperti itu.",
+  "settings#upstream-proxy#reason": "Penggunaan proksi hulu biasanya diwajibkan oleh sekolah, universitas, atau perusahaan. Jika penyedia jaringan Anda memberi setelan proksi hulu, mengaturnya di sini secara manual mungkin perlu dilakukan agar dapat tersambung.",
+  "settings#upstream-proxy#proxy-reqs": "Hanya proksi HTTP yang mendukung HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Nama host",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Nama Pengguna",
+  "settings#upstream-proxy#password-label": "Kata sandi",
+  "settings#upstream-proxy#domain-label": "Domain",
+  "settings#upstream-proxy#skip-label": "Jangan gunakan proksi hulu",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Galat Proksi Hulu",
+  "settings#upstream-proxy#error-modal-body-default": "Saat ini Psiphon disetel untuk menggunakan proksi sistem Anda sebagai \"proksi hulu\".<br>\nAkan tetapi, sepertinya kami tidak dapat tersambung ke server Psiphon melalui proksi tersebut.<br>\nHarap aktifkan “Jangan gunakan proksi hulu”, lalu coba lagi.",
+  "settings#upstream-proxy#error-modal-body-configured": "Anda telah menyetel Psiphon agar menggunakan “proksi hulu”.<br>\nAkan tetapi, sepertinya kami tidak dapat tersambung ke server Psiphon lewat proksi itu.<br>\nHarap benahi dulu setelannya, lalu coba lagi.",
+  "settings#transport-mode#heading": "Modus Transpor",
+  "settings#transport-mode#check-label": "Gunakan modus L2TP/IPSec",
+  "settings#transport-mode#help-text": "Menggunakan jaringan virtual L2TP/IPSec Windows. Modus ini akan mengalihkan lalu lintas internet semua aplikasi Anda, tetapi tidak dilengkapi pengacak sehingga tidak memiliki kemampuan penembusan sensor yang tangguh. Ini <strong>tidak dianjurkan</strong> untuk menerobos sebagian besar firewall.",
+  "settings#systray-minimize#heading": "Kecilkan ke Area Notifikasi (Baki Sistem)",
+  "settings#systray-minimize#help-text": "Jika diaktifkan, jendela aplikasi Psiphon saat dikecilkan akan disembunyikan di area notifikasi (juga dikenal sebagai \"baki sistem\" atau \"systray\", terletak di dekat jam di bilah tugas Windows Anda).",
+  "settings#systray-minimize#reason": "Meminimalkan Psiphon ke area notifikasi (\"baki sistem\") membebaskan ruang di bilah tugas Anda. Hal ini sangat membantu jika Anda sering menggunakan Psiphon untuk waktu yang lama.",
+  "settings#systray-minimize#enable-label": "Kecilkan ke area notifikasi (baki sistem)",
+  "settings#applying-message": "Menyambungkan ulang untuk menerapkan setelan Anda.",
+  "settings#saved-message": "Setelan tersimpan.",
+  "settings#error-modal#title": "Galat Setelan",
+  "settings#error-modal#body": "Ada kesalahan pada parameter setelan Anda. Benahi dulu sebelum melanjutkan.",
+  "feedback#top_content_title": "Beri Kami Kritik dan Saran",
+  "feedback#top_para_2": "Ada banyak masalah yang terselesaikan dengan mengunduh versi terbaru. Silakan <a class=\"NewVersionURL\" href=\"#\">klik di sini untuk mengunduh versi terbaru</a>, atau kirim email ke <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Temukan juga solusi masalah-masalah umum di daftar <a class=\"FaqURL\" href=\"#\">Tanya-Jawab</a> kami.",
+  "feedback#smiley_happy": "Psiphon tersambung dan berfungsi sesuai keinginan saya.",
+  "feedback#smiley_sad": "Psiphon seringkali gagal menyambung atau tidak berfungsi cukup baik.",
+  "feedback#text_feedback_prompt": "Berikan komentar Anda di sini:",
+  "feedback#text_feedback_email_prompt": "Jika Anda ingin kami membalas pesan Anda, silakan masukkan alamat surel Anda:",
+  "feedback#diagnostic_check": "Unggah data diagnostik. Perlu dicatat bahwa data diagnostik ini tidak bersifat mengenali pribadi Anda dan akan membantu kami melancarkan kinerja Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Klik di sini untuk melihat data yang kami kumpulkan</a>.",
+  "feedback#submit_button": "Kirim",
+  "feedback#text_feedback_bottom_para": "Jika formulir tidak berfungsi atau Anda ingin mengirim cuplikan layar, silakan kirim melalui surel ke <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Terima kasih!</strong> Kritik dan saran Anda telah terkirim.",
+  "logs#show-debug-label": "Tampilkan catatan awakutu (debug log)",
+  "logs#placeholder": "Belum ada catatan",
+  "language#success-message": "<strong>Halo!</strong> Selamat datang di Psiphon!",
+  "about#wordart-tag": "Melintas Batas",
+  "about#description": "Psiphon adalah <strong>aplikasi penembus sensor</strong> — Psiphon dirancang untuk menyediakan akses ke internet terbuka, menerobos sensor dan firewall. Aplikasi ini <strong>bersumber terbuka</strong> dan dikembangkan di Toronto, Kanada.",
+  "about#visit-download-site": "Silakan kunjungi situs web kami untuk <strong><a class=\"NewVersionURL\" href=\"#\">mengunduh versi terbaru</a></strong> atau <strong><a class=\"InfoURL\" href=\"#\">mencari bantuan dan informasi</a></strong>. Psiphon tersedia untuk Android dan Windows.",
+  "about#get-by-email": "<strong>Jika situs web tidak dapat diakses</strong>, Anda bisa mendapatkan versi baru Psiphon dengan mengirim surel ke:",
+  "about#client-version": "Versi aplikasi klien Psiphon untuk Windows:",
+  "general#modal-close-button": "Tutup",
+  "general#notice-modal-tech-preamble": "Berikut ini informasi galat teknisnya:",
+  "notice#systemproxysettings-setproxy-error-title": "Galat Proksi Sistem",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon gagal mengatur setelan proksi sistem.</p>\n<p>Hal ini mungkin terjadi karena ada konflik dengan antivirus Anda. Anda mungkin harus mengatur aplikasi atau setelan proksi sistem secara manual untuk menggunakan proksi lokal Psiphon.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon gagal mengatur setelan proksi sistem untuk sambungan internet “<%- data %>”. Hal ini mungkin terjadi karena ada konflik dengan antivirus Anda. Anda mungkin harus mengatur aplikasi atau setelan proksi sistem secara manual untuk menggunakan proksi lokal Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon tidak tersambung",
+  "appbackend#state-starting-title": "Psiphon sedang menyambung",
+  "appbackend#state-starting-body": "Silakan tunggu...",
+  "appbackend#state-connected-title": "Psiphon tersambung",
+  "appbackend#state-connected-body": "Jelajahi dunia di luar batasmu!",
+  "appbackend#state-connected-reminder-title": "Psiphon menjaga agar Anda tetap terkoneksi.",
+  "appbackend#state-connected-reminder-body": "Dukung agar Psiphon tetap gratis. Klik di sini untuk mengunjungi halaman sponsor kami!",
+  "appbackend#state-connected-reminder-body-2": "Dukung agar Psiphon tetap gratis dengan mengunjungi halaman sponsor kami! ",
+  "appbackend#minimized-to-systray-title": "Psiphon telah dikecilkan ke area notifikasi",
+  "appbackend#minimized-to-systray-body": "Klik ikon untuk memunculkan kembali aplikasi",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Saldo PsiCash tidak cukup",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Didukung oleh"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["it"].translation = {
+  "banner#long-connecting": "<strong>Oh no!</strong>\nSembra che tu abbia problemi di connessione!<br>\nScarica l'ultima versione di Psiphon dal <a class=\"NewVersionURL\" href=\"#\">sito download</a>\no inviando un'e-mail a <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Connessione in corso",
+  "nav#connection#connected": "Connesso",
+  "nav#connection#stopping": "Disconnessione",
+  "nav#connection#stopped": "Disconnesso",
+  "nav#settings": "Impostazioni",
+  "nav#feedback": "Feedback",
+  "nav#logs": "Log",
+  "nav#about": "Informazioni",
+  "connection#starting-msg": "Psiphon in <span class=\"state-word\">connessione</span>...",
+  "connection#stop-btn": "Stop",
+  "connection#connected-msg": "Psiphon è <span class=\"state-word\">connesso</span>",
+  "connection#disconnect-btn": "Disconnetti",
+  "connection#stopping-msg": "Psiphon in <span class=\"state-word\">disconnessione</span>…",
+  "connection#wait-btn": "Attendere…",
+  "connection#stopped-msg": "Psiphon è <span class=\"state-word\">disconnesso</span>",
+  "connection#connect-btn": "Connessione",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Errore!</strong> Correggere i valori errati prima di procedere.",
+  "settings#reset-button": "Ripristina configurazione predefinita",
+  "settings#apply-button": "Applica modifiche",
+  "settings#unapplied-changes-prompt#title": "Impostazioni modificate",
+  "settings#unapplied-changes-prompt#body": "Hai apportato modifiche alle tue impostazioni, ma non le hai applicate.<br><br> Desideri applicare le modifiche?",
+  "settings#unapplied-changes-prompt#apply-button": "Applica",
+  "settings#unapplied-changes-prompt#discard-button": "Elimina",
+  "settings#vpn-incompatible-msg": "(Non funziona in modalità L2TP/IPSec.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Split Tunnel",
+  "settings#split-tunnel#help-text": "Se abilitato, le richieste inoltrate ai server della tuo paese, non saranno gestite da Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Non usare proxy per i siti del tuo paese",
+  "settings#disable-timeouts#heading": "Disattiva timeout per reti lente",
+  "settings#disable-timeouts#help-text": "Se abilitato, la comunicazione con il server Psiphon non terminerà.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Disattiva timeout per reti lente",
+  "settings#egress-region#heading": "Regione Server Psiphon",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "Stati Uniti",
+  "settings#egress-region#select-ca": "Canada",
+  "settings#egress-region#select-gb": "Regno Unito",
+  "settings#egress-region#select-jp": "Giappone",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovacchia",
+  "settings#egress-region#select-nl": "Olanda",
+  "settings#egress-region#select-de": "Germania",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Spagna",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austria",
+  "settings#egress-region#select-be": "Belgio",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Svizzera",
+  "settings#egress-region#select-cz": "Repubblica Ceca",
+  "settings#egress-region#select-dk": "Danimarca",
+  "settings#egress-region#select-fr": "Francia",
+  "settings#egress-region#select-hu": "Ungheria",
+  "settings#egress-region#select-it": "Italia",
+  "settings#egress-region#select-no": "Norvegia",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Svezia",
+  "settings#egress-region#select-pl": "Polonia",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Scegli una Regione Server Psiphon valida.",
+  "settings#egress-region#error-modal-title": "Regione Server non disponibile",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Porte Proxy Locale",
+  "settings#local-proxy-ports#leave-blank": "Lasciare in <strong>bianco</strong> per selezione automatica delle porte (raccomandato).",
+  "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Dev'essere compreso fra 1 e 65535",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
+  "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#upstream-proxy#heading": "Proxy di transito",
+  "settings#upstream-proxy#by-default": "Se il tuo computer ha un proxy configurato, di norma Psiphon utilizza quel proxy per connettere i tunnel. Puoi cambiare questo comportamento specificando un proxy diverso, o specificando di non utilizzare il proxy configurato.",
+  "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
+  "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
+  "settings#upstream-proxy#hostname-label": "Nome host",
+  "settings#upstream-proxy#port-label": "Porta",
+  "settings#upstream-proxy#username-label": "Nome utente",
+  "settings#upstream-proxy#password-label": "Password",
+  "settings#upstream-proxy#domain-label": "Dominio",
+  "settings#upstream-proxy#skip-label": "Non usare il proxy di transito",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
+  "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
+  "settings#transport-mode#heading": "Tipo VPN",
+  "settings#transport-mode#check-label": "Usa L2TP/IPSec",
+  "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
+  "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
+  "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
+  "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
+  "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
+  "settings#applying-message": "Reconnecting to apply your settings.",
+  "settings#saved-message": "Impostazioni salvate.",
+  "settings#error-modal#title": "Errore nelle impostazioni",
+  "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
+  "feedback#top_content_title": "Inviaci il Tuo Feedback",
+  "feedback#top_para_2": "Molti problemi sono risolvibili aggiornando all'ultima versione.  Puoi <a class=\"NewVersionURL\" href=\"#\">ottenere l'ultima versione cliccando qui</a>, oppure inviando un'email a <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Inoltre è possibile trovare soluzioni a problemi comuni nelle nostre <a class=\"FaqURL\" href=\"#\">Domande Frequenti</a>.",
+  "feedback#smiley_happy": "Psiphon si collega e opera correttamente.",
+  "feedback#smiley_sad": "Psiphon spesso non si connette o non funziona abbastanza bene.",
+  "feedback#text_feedback_prompt": "Inserisci i tuoi commenti quì:",
+  "feedback#text_feedback_email_prompt": "Se desideri una risposta, inserisci il tuo indirizzo email:",
+  "feedback#diagnostic_check": "Caricare dati diagnostici. Si osservi che questi dati diagnostici non identificano l'utente e ci aiuteranno a garantire il corretto funzionamento di Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Clicca qui per vedere i dati raccolti</a>.",
+  "feedback#submit_button": "Invia",
+  "feedback#text_feedback_bottom_para": "Se il modulo precedente non funziona, o vuoi trasmettere degli screenshot, inviaci un'e-mail all'indirizzo <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Grazie!</strong> Il tuo feedback è stato inviato.",
+  "logs#show-debug-label": "Mostra registrazioni di debug",
+  "logs#placeholder": "Nessuna registrazione ancora",
+  "language#success-message": "<strong>Salve!</strong> Benvenuto su Psiphon.",
+  "about#wordart-tag": "Oltre i Confini",
+  "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
+  "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
+  "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
+  "about#client-version": "Psiphon per Windows versione client:",
+  "general#modal-close-button": "Chiudi",
+  "general#notice-modal-tech-preamble": "Here is the technical error info:",
+  "notice#systemproxysettings-setproxy-error-title": "Errore del proxy di sistema",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
+  "appbackend#state-stopped-title": "Psiphon è disconnesso",
+  "appbackend#state-starting-title": "Psiphon stà connettendosi",
+  "appbackend#state-starting-body": "Attendere…",
+  "appbackend#state-connected-title": "Psiphon è connesso",
+  "appbackend#state-connected-body": "Explore beyond your borders!",
+  "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
+  "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+  "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+  "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
+  "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 ora",
+  "psicash#1-day": "1 giorno",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Sponsorizzato da"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["kk"].translation = {
+  "banner#long-connecting": "<strong>Қап!</strong> Қосылымда қиындық туындаған сияқты!<br>\nPsiphon қолданбасының соңғы нұсқасын <a class=\"NewVersionURL\" href=\"#\">жүктеп алу сайтынан</a> немесе\n<a class=\"NewVersionEmail\" href=\"#\"></a> мекенжайына  хат жіберу арқылы жүктеп алуға болады.",
+  "nav#connection#starting": "Қосылуда",
+  "nav#connection#connected": "Қосылулы",
+  "nav#connection#stopping": "Қосылым ажырауда",
+  "nav#connection#stopped": "Қосылым үзілді",
+  "nav#settings": "Параметрлер",
+  "nav#feedback": "Кері байланыс",
+  "nav#logs": "Журналдар",
+  "nav#about": "Осы туралы",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">қосылым жасауда</span>…",
+  "connection#stop-btn": "Тоқтату",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">қосылулы</span>",
+  "connection#disconnect-btn": "Қосылымды үзу",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">қосылымды үзуде</span>…",
+  "connection#wait-btn": "Күте тұрыңыз…",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">қосылымды үзді</span>",
+  "connection#connect-btn": "Қосылу ",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Қате!</strong> Жалғастыру алдында дұрыс емес мәндерді түзетіңіз.",
+  "settings#reset-button": "Әдепкі мәндерді қайтару",
+  "settings#apply-button": "Өзгерістерді қолдану",
+  "settings#unapplied-changes-prompt#title": "Параметрлер  өзгерді",
+  "settings#unapplied-changes-prompt#body": "Сіз параметрлерді  өзгерттіңіз, бірақ оларды сақтаған жоқсыз. <br><br>Өзгерістерді қазір қолдануды немесе жоюды қалайсыз ба?",
+  "settings#unapplied-changes-prompt#apply-button": "Қолдану",
+  "settings#unapplied-changes-prompt#discard-button": "Жою",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec режимімен жұмыс істемейді).",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Бөлінген туннель",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Сіздің еліңіздегі веб-сайттар үшін проксиді қолданбау",
+  "settings#disable-timeouts#heading": "Баяу желілердің таймауттарын ажырату",
+  "settings#disable-timeouts#help-text": "Іске қосылған болса, Psiphon серверімен байланыстың уақыты бітпейді.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Баяу желілер үшін таймауттарды ажырату",
+  "settings#egress-region#heading": "Psiphon сервері аймағы",
+  "settings#egress-region#select-best-performance": "Үздік жұмысы",
+  "settings#egress-region#select-us": "АҚШ",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Ұлыбритания",
+  "settings#egress-region#select-jp": "Жапония",
+  "settings#egress-region#select-sg": "Сингапур",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Голландия",
+  "settings#egress-region#select-de": "Германия",
+  "settings#egress-region#select-in": "Үндістан",
+  "settings#egress-region#select-es": "Испания",
+  "settings#egress-region#select-hk": "Гонконг",
+  "settings#egress-region#select-at": "Аустрия",
+  "settings#egress-region#select-be": "Бельгия",
+  "settings#egress-region#select-bg": "Болгария",
+  "settings#egress-region#select-ch": "Швейцария",
+  "settings#egress-region#select-cz": "Чехия",
+  "settings#egress-region#select-dk": "Дания",
+  "settings#egress-region#select-fr": "Франция",
+  "settings#egress-region#select-hu": "Венгрия",
+  "settings#egress-region#select-it": "Италия",
+  "settings#egress-region#select-no": "Норвегия",
+  "settings#egress-region#select-ro": "Румыния",
+  "settings#egress-region#select-se": "Швеция",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Psiphon серверінің жарамды аймағын таңдаңыз.",
+  "settings#egress-region#error-modal-title": "Сервер аймағы қолжетімді емес",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Жергілікті прокси порттары",
+  "settings#local-proxy-ports#leave-blank": "Порттарды автоматты түрде таңдау үшін <strong>бос</strong> қалдырыңыз (ұсынылады).",
+  "settings#local-proxy-ports#reason": "Егер сіз компьютерде Psiphon қолданбасымен жұмыс істеу үшін қолмен баптауды талап ететін құралдарды пайдалансаңыз, Psiphon қолданбасының белгілі бір жергілікті порттарды пайдалануы керек болады. Егер жергілікті порттар санын көрсету керек болмаса, қайшылыққа жол бермеу үшін Psiphon қолданбасының оларды автоматты түрде таңдауына рұқсат ету керек.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 және 65535 арасында болуы тиіс.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Жергілікті порттар бір-бірінен бөлек болуы тиіс.",
+  "settings#local-proxy-ports#error-modal-title": "Жергілікті прокси порттар қайшылығы",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon қолданбасын оның HTTP проксиі үшін арнайы жергілікті портты пайдаланатын етіп баптағансыз.<br>\nАлайда, ол порт қазір пайдаланылуда, сондықтан Psiphon оны пайдалана алмайды.\n</p>\n<p>\nБапталған HTTP прокси портының мәтінін өзгертіп, қайталап көріңіз. Бұл мәнді өшіруді ұсынамыз, сол кезде Psiphon қолданыста бар портты автоматты түрде таңдайды.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon қолданбасын оның SOCKS проксиі үшін арнайы жергілікті портты пайдаланатын етіп баптағансыз.<br>\nАлайда, ол порт қазір пайдаланылуда, сондықтан Psiphon оны пайдалана алмайды.\n</p>\n<p>\nБапталған SOCKS прокси портының мәнін өзгертіп, қайталап көріңіз. Бұл мәнді өшіруді ұсынамыз, сол кезде Psiphon қолданыстағы портты автоматты түрде таңдайды.\n</p>",
+  "settings#upstream-proxy#heading": "Сыртқы прокси",
+  "settings#upstream-proxy#by-default": "Компьютеріңізде бапталған прокси болса, әдепкі бойынша Psiphon туннельді орнату кезінде сол проксиді қолданады. Пайдаланылатын проксиді көрсету  немесе осындай \"сыртқы прокси\" қолдану керек емес екенін көрсету арқылы осындай әрекетінен бас тартуға  болады.",
+  "settings#upstream-proxy#reason": "Сыртқы проксилерді кейде мектептер, университеттер мен кәсіпорындар пайдаланады. Егер желілік провайдер сыртқы прокси параметрлерін берген болса, қосылым орнату үшін оларды осы жерде қолдан орнату керек болуы мүмкін.",
+  "settings#upstream-proxy#proxy-reqs": "Тек HTTPS протоколын қолдайтын HTTP проксилеріне рұқсат етіледі.",
+  "settings#upstream-proxy#hostname-label": "Хост атауы",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Пайдаланушы аты",
+  "settings#upstream-proxy#password-label": "Құпиясөз",
+  "settings#upstream-proxy#domain-label": "Домен",
+  "settings#upstream-proxy#skip-label": "Сыртқы проксиді қолданбау",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Сыртқы прокси қатесі",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon қазір жүйелік проксиді “сыртқы прокси” ретінде қолдануға бапталған.<br>\nАлайда, сол прокси арқылы біз Psiphon серверіне қосылым орната алмайтын сияқтымыз.<br>\n“Сыртқы проксиді қолданбау” функциясын іске қосып, қайталап көріңіз.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon қолданбасын “сыртқы проксиді” пайдаланатын етіп баптағансыз.<br>\nАлайда, сол прокси арқылы біз Psiphon серверіне қосылым орната алмайтын сияқтымыз.<br>\nПараметрлерді түзетіп, қайталап көріңіз.",
+  "settings#transport-mode#heading": "Тасымалдау режимі",
+  "settings#transport-mode#check-label": "L2TP/IPSec режимін қолдану",
+  "settings#transport-mode#help-text": "Windows жүйесінің L2TP/IPSec виртуалды желісін қолданады. Бұл режим барлық қолданбаларыңызды туннельдейді, бірақ оны цензура құралдары оңай анықтайды және бұғаттай алады. Оны желіаралық қалқандардың көбін айналып өту үшін<strong>пайдаланбаған жөн</strong>.",
+  "settings#systray-minimize#heading": "Хабарламалар аймағына қайыру (хабарлау панелі)",
+  "settings#systray-minimize#help-text": "Іске қосылған болса, Psiphon қолданбасы қайырылған кезде оның терезесі хабарламалар аймағында жасырылады (сонымен қатар, ол “хабарлау панелі” ретінде белгілі, Windows тапсырмалар панелінде сағаттың қасында орналасқан).",
+  "settings#systray-minimize#reason": "Psiphon қолданбасын хабарламалар аймағына (“жүйелік трей”) қайыру тапсырмалар панелінен орын босатады. Бұл әсіресе Psiphon қолданбасын ұзақ уақыт бойы қолданған кезде қолайлы.",
+  "settings#systray-minimize#enable-label": "Хабарламалар аймағына қайыру (хабарлау панелі)",
+  "settings#applying-message": "Параметрлерді қолдану үшін қайта қосылу.",
+  "settings#saved-message": "Параметрлер сақталды.",
+  "settings#error-modal#title": "Параметрлер қатесі",
+  "settings#error-modal#body": "Параметрлерде қателер бар. Жалғастыру алдында оларды түзетіңіз.",
+  "feedback#top_content_title": "Пікіріңізді білдіріңіз",
+  "feedback#top_para_2": "Ақаулықтардың көбін соңғы нұсқасын жүктеп алу арқылы түзетуге болады. <a class=\"NewVersionURL\" href=\"#\">Осы жерден шерту арқылы соңғы нұсқасын жүктеп алуға</a> немесе бізге эл. пошта хатын жіберуге болады: <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Сонымен қатар, сіз әдеттегі көп ақаулықтардың шешімін біздің <a class=\"FaqURL\" href=\"#\">Жиі қойылатын сұрақтар</a> бөлімінен таба аласыз.",
+  "feedback#smiley_happy": "Psiphon мен қалайтындай түрде қосылым орнатады және жұмыс істейді.",
+  "feedback#smiley_sad": "Psiphon көбінесе қосылымды орната алмайды немесе тиісті түрде жұмыс істемейді.",
+  "feedback#text_feedback_prompt": "Пікірлеріңізді осы жерге енгізіңіз:",
+  "feedback#text_feedback_email_prompt": "Біздің сізге жауап беруімізді қаласаңыз, өз эл. пошта мекенжайыңызды енгізіңіз:",
+  "feedback#diagnostic_check": "Диагностика деректерін жүктеп салыңыз. Есіңізде болсын, бұл диагностика деректері сізді сәйкестендірмейді және бізге Psiphon қызметін жақсартуға көмектеседі. <a class=\"DataCollectionInfoURL\" href=\"#\">Біздің қандай деректерді жинайтымызды білу үшін осы жерден шертіңіз.</a>",
+  "feedback#submit_button": "Жіберу",
+  "feedback#text_feedback_bottom_para": "Егер жоғарыдағы пішін  немесе скриншот жіберуді қаласаңыз, бізге <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> мекенжайына хат жазыңыз.",
+  "feedback#success-message": "<strong>Рахмет!</strong> Сіздің пікіріңіз жіберілді.",
+  "logs#show-debug-label": "Жөндеу журналдарын көрсету",
+  "logs#placeholder": "Журналдар жоқ",
+  "language#success-message": "<strong>Сәлеметсіз бе!</strong> Psiphon қызметіне қош келдіңіз.",
+  "about#wordart-tag": "Шекарасыз",
+  "about#description": "Psiphon – <strong>цензурадан жалтару құралы</strong> – ол цензорлар мен желіаралық қалқандарға қарамай, ашық Интернетке қатынауға мүмкіндік беретін құрал. Оның <strong>бастапқы кодтары ашық</strong> және ол Канада, Торонтода әзірленген.",
+  "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Жаңа нұсқасын жүктеп алу үшін</a></strong> немесе <strong><a class=\"InfoURL\" href=\"#\">көмек пен ақпарат алу үшін</a></strong> веб-сайтқа барыңыз. Psiphon қолданбасы Android және Windows жүйелерінде жұмыс істейді.",
+  "about#get-by-email": "<strong>Егер веб-сайтқа кіру мүмкін болмаса,</strong>, Psiphon қолданбасының жаңа нұсқасын келесі адреске эл. хат жіберу арқылы алуға болады:",
+  "about#client-version": "Windows жүйесіне арналған Psiphon клиентінің нұсқасы:",
+  "general#modal-close-button": "Жабу",
+  "general#notice-modal-tech-preamble": "Қателік туралы техникалық ақпарат:",
+  "notice#systemproxysettings-setproxy-error-title": "Жүйелік прокси қателігі",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon жүйелік прокси параметрлерін орната алмады.</p>\n<p>Бұл сіздегі вирусқарсы бағдарламамен қайшылыққа байланысты болуы мүмкін. Жергілікті Psiphon проксилерін қолдану үшін қолданбаңыздың немесе жүйенің прокси параметрлерін қолдан баптау керек болуы мүмкін.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” деп аталатын қосылым үшін жүйелік прокси параметрлерін орната алмады. Бұл вирусқарсы бағдарламамен қайшылыққа байланысты болуы мүмкін. Жергілікті Psiphon проксилерін қолдану үшін қолданбаңыздың немесе жүйенің прокси параметрлерін қолдан баптау керек болуы мүмкін.",
+  "appbackend#state-stopped-title": "Psiphon ажырап қалған",
+  "appbackend#state-starting-title": "Psiphon қосылуда",
+  "appbackend#state-starting-body": "Күте тұрыңыз…",
+  "appbackend#state-connected-title": "Psiphon қосылулы",
+  "appbackend#state-connected-body": "Шекарадан асыра шарлаңыз!",
+  "appbackend#state-connected-reminder-title": "Psiphon сізді қосылулы күйде ұстайды",
+  "appbackend#state-connected-reminder-body": "Psiphon қызметін тегін қалдырыңыз. Демеушіі беттеріне кіру үшін осы жерден шертіңіз!",
+  "appbackend#state-connected-reminder-body-2": "Біздің демеушііміздің беттеріне бару арқылы Psiphon қызметінің тегін қалуына көмектесіңіз!",
+  "appbackend#minimized-to-systray-title": "Psiphon қолданбасы хабарламалар аймағына қайырылған",
+  "appbackend#minimized-to-systray-body": "Қолданбаны қалпына келтіру үшін белгішені шертіңіз",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Демеушілік еткен"
+};
\ No newline at end of file
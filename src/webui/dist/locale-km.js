@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["km"].translation = {
+  "banner#long-connecting": "<strong>អូ ទេ!</strong> អ្នកហាក់បីដូចជាមានបញ្ហាក្នុងការតភ្ជាប់!<br>\nទាញយកកម្មវិធី Psiphon ជំនាន់ចុងក្រោយពី <a class=\"NewVersionURL\" href=\"#\">គេហទំព័រទាញយក</a>\nឬតាមរយៈការផ្ញើអ៊ីម៉ែលទៅកាន់ <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "កំពុងតភ្ជាប់",
+  "nav#connection#connected": "បានតភ្ជាប់",
+  "nav#connection#stopping": "កំពុងផ្តាច់",
+  "nav#connection#stopped": "បានផ្តាច់ការតភ្ជាប់",
+  "nav#settings": "ការកំណត់",
+  "nav#feedback": "មតិយោបល់",
+  "nav#logs": "កំណត់ត្រា",
+  "nav#about": "អំពី",
+  "connection#starting-msg": "Psiphon គឺ <span class=\"state-word\">កំពុងតភ្ជាប់</span>…",
+  "connection#stop-btn": "បញ្ឈប់",
+  "connection#connected-msg": "Psiphon គឺ <span class=\"state-word\">ត្រូវបានតភ្ជាប់</span>",
+  "connection#disconnect-btn": "ផ្តាច់ការតភ្ជាប់",
+  "connection#stopping-msg": "Psiphon គឺ <span class=\"state-word\">កំពុងផ្តាច់ការតភ្ជាប់</span>…",
+  "connection#wait-btn": "សូមរង់ចាំ...",
+  "connection#stopped-msg": "Psiphon គឺ <span class=\"state-word\">ត្រូវបានផ្តាច់ការតភ្ជាប់</span>",
+  "connection#connect-btn": "តភ្ជាប់",
+  "connection#egress-region-combo-label": "ជ្រើសរើសតំបន់ម៉ាស៊ីនមេ",
+  "settings#error-alert": "<strong>បញ្ហា!</strong> សូមជួសជុលតម្លៃដែលមិនត្រឹមត្រូវមុនពេលដំណើរការ។",
+  "settings#reset-button": "កំណត់ឡើងវិញទៅលំនាំដើម",
+  "settings#apply-button": "អនុវត្តការផ្លាស់ប្តូរ",
+  "settings#unapplied-changes-prompt#title": "ការកំណត់បានផ្លាស់ប្តូរ",
+  "settings#unapplied-changes-prompt#body": "អ្នកបានធ្វើការផ្លាស់ប្តូរការកំណត់របស់អ្នក ប៉ុន្តែអ្នកមិនទាន់បានអនុវត្តការផ្លាស់ប្តូរនៅឡើយ។<br><br>តើអ្នកចង់អនុវត្តការផ្លាស់ប្តូរឥលូវ ឬបោះបង់ចោល?",
+  "settings#unapplied-changes-prompt#apply-button": "អនុវត្ត",
+  "settings#unapplied-changes-prompt#discard-button": "បោះបង់",
+  "settings#vpn-incompatible-msg": "(មិនដំណើរការជាមួយទម្រង់ L2TP/IPSec ទេ។)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Split Tunnel",
+  "settings#split-tunnel#help-text": "បើបើក ការស្នើសុំទៅកាន់ម៉ាស៊ីនមេក្នុងប្រទេសដើមរបស់អ្នក នឹងមិនអាចឆ្លងកាត់ Psiphon​ បានទេ។",
+  "settings#split-tunnel#reason": "គេហទំព័រក្នុងប្រទេសដើមរបស់អ្នកមិនត្រូវបានហាមឃាត់អ្វីទេ ដូចនេះការបើកជម្រើសនេះ នឹងជួយអ្នកចូលបើកគេហទំព័រលឿនជាងមុន និងពេលខ្លះអាចកាត់បន្ថយការចំណាយការប្រើប្រាស់ ISP បានទៀតផង។",
+  "settings#split-tunnel#enable-label": "កុំប្រូស៊ីគេហទំព័រក្នុងប្រទេសរបស់អ្នក",
+  "settings#disable-timeouts#heading": "បិទ ការហួសម៉ោង សម្រាប់បណ្តាញយឺត",
+  "settings#disable-timeouts#help-text": "ប្រសិនបើបើក ការទំនាក់ទំនងជាមួយម៉ាស៊ីនមេ Psiphon នឹងមិនហួសម៉ោងទេ។",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "បិទ ការហួសម៉ោង សម្រាប់បណ្តាញយឺត",
+  "settings#egress-region#heading": "តំបន់ម៉ាស៊ីនមេ Psiphon ",
+  "settings#egress-region#select-best-performance": "ដំណើរការល្អបំផុត",
+  "settings#egress-region#select-us": "សហរដ្ឋអាមេរិក",
+  "settings#egress-region#select-ca": "កាណាដា",
+  "settings#egress-region#select-gb": "ចក្រភពអង់គ្លេស",
+  "settings#egress-region#select-jp": "ជប៉ុន",
+  "settings#egress-region#select-sg": "សឹង្ហបុរី",
+  "settings#egress-region#select-sk": "ស្លូវ៉ាគី",
+  "settings#egress-region#select-nl": "ហូឡង់",
+  "settings#egress-region#select-de": "អាល្លឺម៉ង់",
+  "settings#egress-region#select-in": "ឥណ្ឌា",
+  "settings#egress-region#select-es": "អេស៉្បាញ",
+  "settings#egress-region#select-hk": "ហុងកុង",
+  "settings#egress-region#select-at": "អូទ្រីស",
+  "settings#egress-region#select-be": "បែលហ្សិក",
+  "settings#egress-region#select-bg": "ប៊ុលហ្គារី",
+  "settings#egress-region#select-ch": "ស្វីស",
+  "settings#egress-region#select-cz": "សាធារណរដ្ឋ​ឆែក",
+  "settings#egress-region#select-dk": "ដាណឺម៉ាក",
+  "settings#egress-region#select-fr": "បារាំង",
+  "settings#egress-region#select-hu": "ហុងគ្រី",
+  "settings#egress-region#select-it": "អ៊ីតាលី",
+  "settings#egress-region#select-no": "ន័រវែស",
+  "settings#egress-region#select-ro": "រូម៉ានី",
+  "settings#egress-region#select-se": "ស៊ុយអែត",
+  "settings#egress-region#select-pl": "ប៉ូឡូញ",
+  "settings#egress-region#select-rs": "ស៊ែប៊ី",
+  "settings#egress-region#select-au": "អូស្ត្រាលី",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "ជ្រើសរើសម៉ាស៊ីនមេ Psiphon​ ក្នុងតំបន់",
+  "settings#egress-region#error-modal-title": "ម៉ាស៊ីនមេក្នុងតំបន់មិនទំនេរ",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "ច្រក Proxy ខាងក្នុង",
+  "settings#local-proxy-ports#leave-blank": "ទុក<strong>ទទេរ</strong> សម្រាប់ការជ្រើសរើសច្រកដោយស្វ័យប្រវត្តិ (សូមណែនាំ).",
+  "settings#local-proxy-ports#reason": "ប្រសិនបើអ្នកប្រើឧបករណ៍នៅលើកុំព្យូទ័ររបស់អ្នក ដែលតម្រូវឱ្យមានការកំណត់ដោយដៃដើម្បីធ្វើការជាមួយ Psiphon អ្នកនឹងត្រូវការ Psiphon ប្រើលេខច្រកខាងក្នុងដូច ៗ គ្នាជានិច្ច។ ប្រសិនបើអ្នកមិនមានហេតុផលដើម្បីបញ្ជាក់លេខច្រកអ្នកគួរតែអនុញ្ញាតឱ្យ Psiphon ជ្រើសរើសវាដោយស្វ័យប្រវត្តិដើម្បីជួយជៀសវាងច្រកជាន់គ្នា។",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "ត្រូវតែចន្លោះពី 1 និង 65535។",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "ច្រកខាងក្នុងត្រូវតែមានភាពខុសគ្នាពីគ្នា។",
+  "settings#local-proxy-ports#error-modal-title": "ច្រក Proxy ខាងក្នុងជាន់គ្នា",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nអ្នកបានកំណត់ Psiphon ដើម្បីប្រើប្រាស់ច្រកខាងក្នុងជាក់លាក់ណាមួយ សម្រាប់ប្រូកស៊ី HTTP របស់វា។<br>\nទោះយ៉ាងណា, ច្រកនេះហាក់ដូចជាត្រូវបានប្រើ ដូចនេះហើយ Psiphon​ មិនអាចប្រើវាទេ។\n</p>\n<p>\nសូមផ្លាស់ប្តូរការកំណត់តម្លៃច្រកប្រូកស៊ី HTTP និងសាកល្បងម្តងទៀត។ យើងណែនាំ អ្នកឲ្យសំអាតតម្លៃដើម ដូចនេះ Psiphon អាចជ្រើសរើសច្រកទំនេរដោយស្វ័យប្រវត្តិ។\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nអ្នកបានកំណត់ Psiphon ដើម្បីប្រើប្រាស់ច្រកខាងក្នុងជាក់លាក់ណាមួយ សម្រាប់ប្រូកស៊ី SOCKS របស់វា។<br>\nទោះយ៉ាងណា, ច្រកនេះហាក់ដូចជាត្រូវបានប្រើ ដូចនេះហើយ Psiphon​ មិនអាចប្រើវាទេ។\n</p>\n<p>\nសូមផ្លាស់ប្តូរការកំណត់តម្លៃច្រកប្រូកស៊ី SOCKS និងសាកល្បងម្តងទៀត។ យើងណែនាំ អ្នកឲ្យសំអាតតម្លៃដើម ដូចនេះ Psiphon អាចជ្រើសរើសច្រកទំនេរដោយស្វ័យប្រវត្តិ។\n</p>",
+  "settings#upstream-proxy#heading": "Upstream Proxy",
+  "settings#upstream-proxy#by-default": "ប្រសិនបើកុំព្យូទ័រអ្នកបានកំណត់ proxy ហើយ ជាលំនាំដើម Psiphon នឹងប្រើប្រាស់ proxy នៅពេលបង្កើតការតភ្ជាប់។ អ្នកអាចបដិសេដទម្លាប់នោះ ដោយកំណត់proxy មួយដើម្បីប្រើប្រាស់, ឬកំណត់ថាគ្មាន “upstream proxy” ដែលគួរប្រើប្រាស់ទេ។",
+  "settings#upstream-proxy#reason": "ជួនកាលប្រូកស៊ីខាងលើត្រូវបានតម្រូវដោយសាលារៀន សាកលវិទ្យាល័យ ឬអាជីវកម្ម។ ប្រសិនបើអ្នកផ្តល់សេវាកម្មបណ្តាញរបស់អ្នក បានផ្តល់ការកំណត់ប្រូកស៊ីខាងលើ នោះអ្នកចាំបាច់កំណត់ដោយខ្លួនឯងនៅទីនេះ ដើម្បីតភ្ជាប់។",
+  "settings#upstream-proxy#proxy-reqs": "មានតែប្រូកស៊ី HTTP ដែលគាំទ្រ HTTPS ត្រូវបានអនុញ្ញាត។",
+  "settings#upstream-proxy#hostname-label": "Hostname",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "ឈ្មោះអ្នកប្រើប្រាស់",
+  "settings#upstream-proxy#password-label": "ពាក្យសម្ងាត់",
+  "settings#upstream-proxy#domain-label": "ដែន",
+  "settings#upstream-proxy#skip-label": "មិនប្រើ upstream proxy",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "កំហុសប្រូកស៊ីឡើងលើ",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon កំពុងត្រូវបានកំណត់ ដើម្បីប្រើប្រូកស៊ីប្រព័ន្ធអ្នកជា “ប្រូកស៊ីខាងលើ”.<br>\nទោះយ៉ាងណា, យើងហាក់ដូចជាមិនអាចតភ្ជាប់ទៅកាន់ម៉ាស៊ីនមេ Psiphon តាមរយៈប្រូកស៊ីនោះទេ។<br>\nសូមបើក “មិនប្រើប្រូកស៊ីខាងលើ” និងសាកល្បងម្តងទៀត។",
+  "settings#upstream-proxy#error-modal-body-configured": "អ្នកបានកំណត់ Psiphon ដើម្បីប្រើជា “ប្រូកស៊ីខាងលើ”។<br>\nទោះយ៉ាងណា, យើងហាក់ដូចជាមិនអាចតភ្ជាប់ទៅកាន់ម៉ាស៊ីនមេ Psiphon តាមរយៈប្រូកស៊ីនោះទេ។<br>\nសូមកែសំរួលការកំណត់ និងសាកល្បងម្តងទៀត។",
+  "settings#transport-mode#heading": "ទម្រង់បញ្ជូន",
+  "settings#transport-mode#check-label": "ប្រើទម្រង់ L2TP/IPSec",
+  "settings#transport-mode#help-text": "ប្រើបណ្តាញនិម្មិត L2TP / IPSec របស់ Windows។ ទម្រង់នេះ​ នឹងប្រើគ្រប់ច្រកកម្មវិធីរបស់អ្នកប៉ុន្តែវាមិនផ្តល់ភាពរំភើបនិងមិនមានសមត្ថភាពទប់ស្កាត់ការត្រួតពិនិត្យខ្លាំង។ វា <strong>មិនត្រូវបានណែនាំ</strong> សម្រាប់ឆ្លងកាត់ firewalls ភាគច្រើនទេ។",
+  "settings#systray-minimize#heading": "បង្រួមទៅកាន់តំបន់ជូនដំណឹង (System Tray)",
+  "settings#systray-minimize#help-text": "បើបើកវា, ពេលបង្រួមផ្ទាំងកម្មវិធី Psiphon នឹងលាក់ក្នុងតំបន់ជូនដំណឹង (ឬហៅថា “system tray” ឬ “systray”, ដែលមានទីតាំងក្បែរម៉ោង លើរបារកិច្ចការរបស់ Windows)។",
+  "settings#systray-minimize#reason": "បង្រួម Psiphon ទៅតំបន់ជូនដំណឹង (“system tray”) ដើម្បីទុកប្រឡោះទំនេរលើរបស់កិច្ចការរបស់អ្នក។ វាមានប្រយោជន៍ជាពិសេសពេលអ្នកប្រើ Psiphon រយៈពេលយូរ។",
+  "settings#systray-minimize#enable-label": "បង្រួមទៅកាន់តំបន់ជូនដំណឹង (System Tray)",
+  "settings#applying-message": "កំពុងតភ្ជាប់ឡើងវិញ ដើម្បីអនុវត្តការកំណត់របស់អ្នក។",
+  "settings#saved-message": "ការកំណត់បានរក្សាទុក។",
+  "settings#error-modal#title": "ការកំណត់មានបញ្ហា",
+  "settings#error-modal#body": "មានបញ្ហាក្នុងការកំណត់តម្លៃ។ សូមកែតម្រូវមុនពេលដំណើរការ។",
+  "feedback#top_content_title": "ប្រាប់ពីមតិយោបល់អ្នក",
+  "feedback#top_para_2": "បញ្ហាជាច្រើនអាចត្រូវបានដោះស្រាយដោយទាញយកកម្មវិធីជំនាន់ចុងក្រោយ។ អ្នកអាច <a class=\"NewVersionURL\" href=\"#\">ទាញយកជំនាន់ចុងក្រោយដោយចុចទីនេះ</a>, ឬ អ្នកអាចផ្ញើអ៊ីម៉ែលទៅកាន់ <a class=\"NewVersionEmail\" href=\"#\"></a>។",
+  "feedback#top_para_3": "អ្នកអាចស្វែងរកដំណោះស្រាយសម្រាប់បញ្ហាមួយចំនួនក្នុង<a class=\"FaqURL\" href=\"#\">សំនួរទូទៅ</a>របស់យើង។",
+  "feedback#smiley_happy": "Psiphon តភ្ជាប់និងដំណើរការតាមរបៀបដែលខ្ញុំចង់បាន។",
+  "feedback#smiley_sad": "Psiphon ជាញឹកញយបរាជ័យក្នុងការតភ្ជាប់ ឬមិនដំណើរការដោយប្រក្រតី។",
+  "feedback#text_feedback_prompt": "សូមបញ្ចូលមតិរបស់អ្នកនៅទីនេះ៖",
+  "feedback#text_feedback_email_prompt": "បើអ្នកចង់ឲ្យយើងឆ្លើយតបទៅអ្នក សូមបញ្ចូលអាសយដ្ឋានអ៊ីម៉ែលរបស់អ្នក៖",
+  "feedback#diagnostic_check": "បញ្ជូនទិន្នន័យវិភាគ។ សូមចំណាំថា ទិន្នន័យវិភាគមិនបង្ហាញអត្តសញ្ញាណអ្នក និងវានឹងជួយយើងរក្សាដំណើរការPsiphon ឲ្យរលូនជាមុន។<a class=\"DataCollectionInfoURL\" href=\"#\">ចុចទីនេះដើម្បីមើលអ្វីដែលយើងប្រមូល។</a>",
+  "feedback#submit_button": "បញ្ជូន",
+  "feedback#text_feedback_bottom_para": "បើទម្រង់មិនដំណើរការ ឬអ្នកចង់បញ្ជូនរូបភាពអេក្រង់ សូមផ្ញើអ៊ីម៉ែលមកយើងតាម <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>។",
+  "feedback#success-message": "<strong>អរគុណ!</strong> មតិយោបល់អ្នកត្រូវបានបញ្ជូន។",
+  "logs#show-debug-label": "បង្ហាញកំណត់ត្រាកំហុស",
+  "logs#placeholder": "មិនទាន់មានកំណត់ត្រា",
+  "language#success-message": "<strong>សួស្តី!</strong> ស្វាគមន៍មកកាន់ Psiphon។",
+  "about#wordart-tag": "លើសព្រំដែន",
+  "about#description": "Psiphon ជា <strong>ឧបករណ៍បញ្ចៀសការឃ្លាំមើល</strong> — វាត្រូវបានរចនាឡើងដើម្បីផ្តល់អោយអ្នកបើកអ៊ិនធ័រណិតដោយចំហរ, ឆ្លងផុតការឃ្លាំមើល និង firewalls។ វាមាន <strong>កូដបើកចំហរ</strong> ហើយត្រូវបានបង្កើតឡើងនៅតូរ៉ុនតូ ប្រទេសកាណាដា។",
+  "about#visit-download-site": "សូមចូលទៅកាន់គេហទំព័រ <strong><a class=\"NewVersionURL\" href=\"#\">ទាញយកជំនាន់ថ្មី</a></strong> ឬ <strong><a class=\"InfoURL\" href=\"#\">ទទួលជំនួយនិងព័ត៌មាន</a></strong>។ Psiphon មានសម្រាប់ Android និង Windows។",
+  "about#get-by-email": "<strong>បើគេហទំព័របើកអត់ចេញ</strong>, អ្នកអាចទាញយក Psiphon ជំនាន់ថ្មីដោយផ្ញើអ៊ីម៉ែលទៅកាន់៖",
+  "about#client-version": "Psiphon សម្រាប់ Windows ជំនាន់៖",
+  "general#modal-close-button": "បិទ",
+  "general#notice-modal-tech-preamble": "នេះជាព័ត៌មានកំហុសបច្ចេកទេស៖",
+  "notice#systemproxysettings-setproxy-error-title": "ប្រូកស៊ីប្រព័ន្ធមានបញ្ហា",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon បរាជ័យក្នុងការកំណត់ប្រូកស៊ីប្រព័ន្ធ។</p>\n<p>នេះអាចមកពីជាន់គ្នាជាមួយកម្មវិធីកំចាត់មេរោគរបស់អ្នក។ អ្នកអាចត្រូវការកំណត់កម្មវិធីរបស់អ្នក ឬប្រព័ន្ធប្រូកស៊ី ដើម្បីប្រើប្រាស់ប្រូកស៊ី Psiphon ខាងក្នុង។</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon បរាជ័យក្នុងការកំណត់ប្រព័ន្ធប្រូកស៊ី សម្រាប់ឈ្មោះការតភ្ជាប់អ៊ីនធឺណិត “<%- data %>”។ នេះអាចមកពីជាន់គ្នាជាមួយកម្មវិធីកំចាត់មេរោគរបស់អ្នក។ អ្នកអាចត្រូវការកំណត់កម្មវិធីរបស់អ្នក ឬប្រព័ន្ធប្រូកស៊ី ដើម្បីប្រើប្រាស់ប្រូកស៊ី Psiphon ខាងក្នុង។",
+  "appbackend#state-stopped-title": "Psiphon ត្រូវបានផ្តាច់",
+  "appbackend#state-starting-title": "Psiphon កំពុងភ្ជាប់",
+  "appbackend#state-starting-body": "សូមរង់ចាំ...",
+  "appbackend#state-connected-title": "Psiphon បានតភ្ជាប់",
+  "appbackend#state-connected-body": "រុករកលើសពីដែនកំណត់របស់អ្នក!",
+  "appbackend#state-connected-reminder-title": "Psiphon រក្សាការតភ្ជាប់របស់អ្នក",
+  "appbackend#state-connected-reminder-body": "រក្សា Psiphon ឲ្យនៅមិនគិតថ្លៃ។ ចុចទីនេះ ដើម្បីចូលទៅកាន់ទំព័ររបស់ម្ចាស់ឧបត្ថម្ភ!",
+  "appbackend#state-connected-reminder-body-2": "រក្សា Psiphon ឲ្យនៅឥតគិតថ្លៃ តាមរយៈការចូលទៅកាន់ទំព័រម្ចាស់ឧបត្ថម្ភរបស់យើង!",
+  "appbackend#minimized-to-systray-title": "Psiphon ត្រូវបានបង្រួមទៅកាន់តំបន់ជូនដំណឹង",
+  "appbackend#minimized-to-systray-body": "ចុច លើរូបតំណាងដើម្បីស្តារកម្មវិធីវិញ",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "សមតុល្យ PsiCash មិនគ្រប់គ្រាន់",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 ម៉ោង",
+  "psicash#1-day": "1 ថ្ងៃ",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>ល្បឿន",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "កម្មវិធីមិនដំណើរការ?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "ឧបត្ថម្ភដោយ"
+};
\ No newline at end of file
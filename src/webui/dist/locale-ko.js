@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ko"].translation = {
+  "banner#long-connecting": "<strong>오 이런!</strong> 현재 연결에 문제를 겪고있는 것 같군요!<br>\n많은 문제들이 새로운 버전에 고쳐져서 나옵니다. <a class=\"NewVersionURL\" href=\"#\">새로운 버전 다운로드</a> 링크를 통해 새로운 버전의 Psiphon을 받을 수 있습니다. 또는 다음의 이메일 주소에 메일을 보내 받을 수도 있습니다: <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "연결 중",
+  "nav#connection#connected": "연결됨",
+  "nav#connection#stopping": "연결 끊는 중",
+  "nav#connection#stopped": "연결 끊김",
+  "nav#settings": "설정",
+  "nav#feedback": "피드백",
+  "nav#logs": "로그",
+  "nav#about": "About",
+  "connection#starting-msg": "Psiphon에 <span class=\"state-word\">연결 하는 중</span>...",
+  "connection#stop-btn": "중지",
+  "connection#connected-msg": "Psiphon에 <span class=\"state-word\">연결됨</span>",
+  "connection#disconnect-btn": "연결 끊기",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">연결 끊는 중</span>...",
+  "connection#wait-btn": "잠시만 기다려주세요...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">연결 끊김</span>",
+  "connection#connect-btn": "연결",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>오류가 발생했습니다!</strong> 진행하기 전에 잘못된 값을 고쳐주세요.",
+  "settings#reset-button": "기본값으로 초기화",
+  "settings#apply-button": "변경 사항 적용",
+  "settings#unapplied-changes-prompt#title": "설정 변경됨",
+  "settings#unapplied-changes-prompt#body": "설정을 바꾸었지만 바꾼 설정이 적용되지 않았습니다. <br><br> 바꾼 설정을 바로 적용할까요? 아니면 취소할까요?",
+  "settings#unapplied-changes-prompt#apply-button": "적용",
+  "settings#unapplied-changes-prompt#discard-button": "취소",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec 모드에선 작동하지 않습니다.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "터널 분리",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "자국 내에서 서비스하는 사이트에 프록시 적용 안 함",
+  "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
+  "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
+  "settings#egress-region#heading": "Psiphon 서버 위치",
+  "settings#egress-region#select-best-performance": "가장 좋은 성능",
+  "settings#egress-region#select-us": "미국",
+  "settings#egress-region#select-ca": "캐나다",
+  "settings#egress-region#select-gb": "영국",
+  "settings#egress-region#select-jp": "일본",
+  "settings#egress-region#select-sg": "싱가포르",
+  "settings#egress-region#select-sk": "슬로바키아",
+  "settings#egress-region#select-nl": "네덜란드",
+  "settings#egress-region#select-de": "독일",
+  "settings#egress-region#select-in": "인도",
+  "settings#egress-region#select-es": "스페인",
+  "settings#egress-region#select-hk": "홍콩",
+  "settings#egress-region#select-at": "오스트리아",
+  "settings#egress-region#select-be": "벨기에",
+  "settings#egress-region#select-bg": "불가리아",
+  "settings#egress-region#select-ch": "스위스",
+  "settings#egress-region#select-cz": "체코",
+  "settings#egress-region#select-dk": "덴마크",
+  "settings#egress-region#select-fr": "프랑스",
+  "settings#egress-region#select-hu": "헝가리",
+  "settings#egress-region#select-it": "이탈리아",
+  "settings#egress-region#select-no": "노르웨이",
+  "settings#egress-region#select-ro": "로마니아",
+  "settings#egress-region#select-se": "스웨덴",
+  "settings#egress-region#select-pl": "폴란드",
+  "settings#egress-region#select-rs": "세르비아",
+  "settings#egress-region#select-au": "오스트레일리아",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Psiphon 서버의 위치를 선택해 주십시오.",
+  "settings#egress-region#error-modal-title": "해당 위치의 서버를 사용할 수 없음",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "로컬 프록시 포트",
+  "settings#local-proxy-ports#leave-blank": "<strong>빈칸</strong>으로 두면 자동으로 포트를 선택합니다 (권장됨).",
+  "settings#local-proxy-ports#reason": "만약 직접 구성한 설정을 사용하는 Psiphon과 함께 작동하는 도구를 사용하는 경우, 아마 Psiphon이 일관되도록 작동하게 하기 위해 같은 로컬 포트 숫자를 쓰는 것이 좋습니다. 만약 특정 포트 숫자를 쓸 이유가 없다면, 충돌 문제를 방지하기 위해 Psiphon이 자동으로 포트 숫자를 선택할 수 있도록 설정해야 합니다.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1부터 65535사이의 값이여야합니다.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "로컬 포트는 반드시 다른 포트와 곂치지 않아야 합니다.",
+  "settings#local-proxy-ports#error-modal-title": "로컬 프록시 포트 충돌",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\n현재 Psiphon이 HTTP 프록시를 위해 특정한 로컬 포트를 사용하도록 설정되어 있습니다.<br>\n하지만, 해당 포트는 이미 사용되고 있는 것 같으며 Psiphon이 사용할 수 없습니다.\n</p>\n<p>\nHTTP 프록시 포트를 변경하고 다시 시도해 주세요. 값을 모두 지우면 Psiphon이 자동으로 사용 가능한 포트를 지정할 수 있으니 값을 지우는 방법을 추천합니다.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\n현재 Psiphon이 SOCKS 프록시를 위해 특정한 로컬 포트를 사용하도록 설정되어 있습니다.<br>\n하지만, 해당 포트는 이미 사용되고 있는 것 같으며 Psiphon이 사용할 수 없습니다.\n</p>\n<p>\nSOCKS 프록시 포트를 변경하고 다시 시도해 주세요. 값을 모두 지우면 Psiphon이 자동으로 사용 가능한 포트를 지정할 수 있으니 값을 지우는 방법을 추천합니다.\n</p>",
+  "settings#upstream-proxy#heading": "업 스트림 프록시",
+  "settings#upstream-proxy#by-default": "컴퓨터가 이미 프록시 설정이 되어있는 경우, 기본적으로 Psiphon은 터널링을 하기 위해 해당 프록시를 이용합니다. “upstream proxy”를 사용하지 않는 것으로 지정하거나 사용할 프록시를 지정하면 이 동작을 덮어쓸 수 있습니다.",
+  "settings#upstream-proxy#reason": "업스트림 프록시는 때때로 학교나 대학, 회사에서 요구할 때가 있습니다. 만약 네트워크 제공자가 이미 업스트림 프록시 설정을 주었다면, 연결을 위해 추가적인 설정이 필요할 수 있습니다.",
+  "settings#upstream-proxy#proxy-reqs": "HTTPS를 지원하는 HTTP 프록시만 사용할 수 있습니다.",
+  "settings#upstream-proxy#hostname-label": "호스트 이름",
+  "settings#upstream-proxy#port-label": "포트",
+  "settings#upstream-proxy#username-label": "Username",
+  "settings#upstream-proxy#password-label": "비밀번호",
+  "settings#upstream-proxy#domain-label": "도메인",
+  "settings#upstream-proxy#skip-label": "업 스트림 프록시 사용 안 함",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "업 스트림 프록시 오류",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon이 현재 시스템 “upstream proxy\"를 사용하도록 설정되어 있습니다.<br>\n하지만, 현재 해당 프록시를 통해 Psiphon 서버로 접속할 수 없는 것 같습니다.<br>\n“업스트림 프록시 사용 안 함”을 선택하고 다시 시도하십시오.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon이 현재 시스템 “upstream proxy\"를 사용하도록 설정되어 있습니다.<br>\n하지만, 현재 해당 프록시를 통해 Psiphon 서버로 접속할 수 없는 것 같습니다.<br>\n“업스트림 프록시 사용 안 함”을 선택하고 다시 시도하십시오.",
+  "settings#transport-mode#heading": "전송 모드",
+  "settings#transport-mode#check-label": "L2TP / IPSec 모드를 사용",
+  "settings#transport-mode#help-text": "Windows L2TP/IPSec 가상 네트워킹을 사용합니다. 이 모드는 모든 어플리케이션에 터널링을 적용합니다. 하지만 명료하지 않고 강력한 검열 우회 기능을 가지고 있지 않습니다. 대부분의 방화벽을 뚫는데에는 <strong>추천하지</strong> 않습니다.",
+  "settings#systray-minimize#heading": "알림 영역으로 최소화 (시스템 트레이)",
+  "settings#systray-minimize#help-text": "활성화되어 있으면, 최소화 할 때 Psiphon 어플리케이션 창을 알림 영역으로 최소화 합니다. (이는 \"시스템 트레이\" 또는 \"시스트레이\"로 알려져 있으며 Windows 작업 표시줄의 시계 근처에 있습니다)",
+  "settings#systray-minimize#reason": "Psiphon을 최소화 하면 빈 공간의 작업 표시줄 알림 영역 (\"시스템 트레이\") 에 표시됩니다. 이는 특히 Psiphon을 오래 사용할 때 유용합니다.",
+  "settings#systray-minimize#enable-label": "알림 영역으로 최소화하기 (시스템 트레이)",
+  "settings#applying-message": "다시 연결하면 설정이 적용됩니다.",
+  "settings#saved-message": "설정 저장됨.",
+  "settings#error-modal#title": "설정 오류",
+  "settings#error-modal#body": "설정 값에 오류가 있습니다. 진행하기 전에 설정을 확인하세요.",
+  "feedback#top_content_title": "피드백을 제공하세요",
+  "feedback#top_para_2": "수 많은 문제들은 대부분 새로운 버전을 설치하면 해결됩니다. <a class=\"NewVersionURL\" href=\"#\">새로운 버전 다운로드</a> 링크를 통해 새로운 버전의 Psiphon을 받을 수 있습니다. 또는 다음의 이메일 주소에 메일을 보내 받을 수도 있습니다: <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "feedback#top_para_3": "흔히 일어나는 문제에 대해서는 <a class=\"FaqURL\" href=\"#\">자주 묻는 질문</a>에서도 빠르게 답변을 찾을 수 있습니다.",
+  "feedback#smiley_happy": "Psiphon이 잘 연결되며 원하는 대로 잘 작동하고 있습니다.",
+  "feedback#smiley_sad": "Psiphon이 가끔 연결에 실패하거나 잘 작동하지 않을 때가 있습니다.",
+  "feedback#text_feedback_prompt": "여기에 코멘트를 입력해 주세요:",
+  "feedback#text_feedback_email_prompt": "만약 답변을 받고 싶다면, 여기에 이메일을 남겨주세요:",
+  "feedback#diagnostic_check": "진단 정보를 업로드하세요. 참고로 이 진단 정보는 어떠한 개인 식별 정보도 포함하지 않으며, 이 소중한 정보는 Psiphon이 부드럽게 작동할 수 있도록 도움을 줄 것입니다. <a class=\"DataCollectionInfoURL\" href=\"#\">이곳</a>을 클릭하여 어떤 정보가 수집되는지 확인하세요.",
+  "feedback#submit_button": "확인",
+  "feedback#text_feedback_bottom_para": "폼이 작동하지 않거나 또는 스크린샷을 첨부하고 싶다면, 다음의 이메일로 보내주시면 됩니다: <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>감사합니다!</strong> 당신의 피드백이 보내졌습니다.",
+  "logs#show-debug-label": "디버그 로그 보이기",
+  "logs#placeholder": "로그가 없습니다.",
+  "language#success-message": "<strong>반갑습니다!</strong> Psiphon에 오신것을 환영합니다.",
+  "about#wordart-tag": "국경을 넘어",
+  "about#description": "Psiphon은 <strong>강력한 검열 우회 도구</strong>입니다 — 시대를 역행하는 검열과 방화벽을 뚫고 열린 인터넷에 접속할 수 있도록 디자인되었으며 Toronto, Canada에서 <strong>오픈 소스</strong>로 개발되었습니다.",
+  "about#visit-download-site": "웹 사이트를 방문하여 <strong><a class=\"NewVersionURL\" href=\"#\">새로운 버전</a></strong>을 다운로드 하거나 <strong><a class=\"InfoURL\" href=\"#\">도움말</a></strong>을 얻을 수 있습니다. Psiphon은 Android와 Windows에서 사용할 수 있습니다.",
+  "about#get-by-email": "<strong>만약 Psiphon 사이트 접속이 불가능한 경우</strong>, 다음 이메일 주소로 메일을 보내면 최신 버전의 Psiphon 클라이언트를 받을 수 있습니다: ",
+  "about#client-version": "Psiphon Windows 클라이언트 버전:",
+  "general#modal-close-button": "닫기",
+  "general#notice-modal-tech-preamble": "기술적인 오류 정보가 있습니다:",
+  "notice#systemproxysettings-setproxy-error-title": "시스템 프록시 에러",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon이 시스템 프록시 설정을 적용하는데 실패했습니다.</p>\n<p>이 문제는 바이러스 백신과 충돌을 일으켰을 가능성이 높습니다. 백신을 끄거나 수동으로 시스템 프록시가 Psiphon 프록시를 사용하도록 설정해야 할 수 있습니다.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon이 “<%- data %>” 시스템 프록시 설정을 적용하는데 실패했습니다. 이 문제는 바이러스 백신과 충돌을 일으켰을 가능성이 높습니다. 백신을 끄거나 수동으로 시스템 프록시가 Psiphon 프록시를 사용하도록 설정해야 할 수 있습니다.",
+  "appbackend#state-stopped-title": "Psiphon 연결 끊김",
+  "appbackend#state-starting-title": "Psiphon 연결 중",
+  "appbackend#state-starting-body": "잠시만 기다려주세요...",
+  "appbackend#state-connected-title": "Psiphon 연결됨",
+  "appbackend#state-connected-body": "국경을 넘어 탐색하세요!",
+  "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
+  "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+  "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+  "appbackend#minimized-to-systray-title": "Psiphon이 알림 영역에 최소화되었습니다",
+  "appbackend#minimized-to-systray-body": "아이콘을 클릭하면 어플리케이션을 표시합니다",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1시간",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "후원자"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ky"].translation = {
+  "banner#long-connecting": "<strong>О жок! </strong>Байланыша албай жатат окшойсуз!<br>\nPsiphon-дун акыркы нускасын <a class=\"NewVersionURL\" href=\"#\">түшүрүп алуу сайтынан</a>\nже болбосо<a class=\"NewVersionEmail\" href=\"#\"></a>дарегине эл. кат жиберүү аркылуу жүктөп алыңыз",
+  "nav#connection#starting": "Байланышуу ",
+  "nav#connection#connected": "Байланышты",
+  "nav#connection#stopping": "Байланышты үзүү",
+  "nav#connection#stopped": "Байланыш үзүлдү",
+  "nav#settings": "Баптоолор",
+  "nav#feedback": "Кайтарым байланыш",
+  "nav#logs": "Журналдар",
+  "nav#about": "Ушул тууралуу",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">байланышууда </span>...",
+  "connection#stop-btn": "Токтоо",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">байланышылды</span>",
+  "connection#disconnect-btn": "Байланышты үзүү",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">байланышты үзүүдө </span>...",
+  "connection#wait-btn": "Сураныч, күтө туруңуз...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">байланышты үздү</span>",
+  "connection#connect-btn": "Байланышуу ",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Ката!</strong> Улантуу алдында туура эмес нарктарды түзөтүңүз.",
+  "settings#reset-button": "Демейкиге кайтаруу",
+  "settings#apply-button": "Өзгөрүштөрдү ишке ашыруу",
+  "settings#unapplied-changes-prompt#title": "Баптоолор өзгөртүлдү",
+  "settings#unapplied-changes-prompt#body": "Сиз баптоолоруңузга өзгөруштөрдү киргиздиңиз, бирок аларды күчүнө киргизген жоксуз. <br><br>Өзгөрүштөрдү азыр ишке ашырууну же жокко чыгарууну калайсызбы?",
+  "settings#unapplied-changes-prompt#apply-button": "Колдонуу",
+  "settings#unapplied-changes-prompt#discard-button": "Жокко чыгаруу",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec режиминде иштебейт.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Туннелди бөлүү",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Сиздин өлкөңүздөгү вебсайттар үчүн проксини колдонбоо",
+  "settings#disable-timeouts#heading": "Жай Тармактар үчүн танаписти өчүрүү",
+  "settings#disable-timeouts#help-text": "Иштетилген болсо, Psiphon сервери менен байланыштын убакыты бүтпөйт.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Жай тармактар үчүн танаписти өчүрүү",
+  "settings#egress-region#heading": "Psiphon Сервер аймагы",
+  "settings#egress-region#select-best-performance": "Мыкты Аткаруу",
+  "settings#egress-region#select-us": "Кошмо Штаттар",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Улуу Британия",
+  "settings#egress-region#select-jp": "Япония",
+  "settings#egress-region#select-sg": "Сингапур",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Голландия",
+  "settings#egress-region#select-de": "Германия",
+  "settings#egress-region#select-in": "Индия",
+  "settings#egress-region#select-es": "Испания",
+  "settings#egress-region#select-hk": "ГоңКоң",
+  "settings#egress-region#select-at": "Австрия",
+  "settings#egress-region#select-be": "Бельгия",
+  "settings#egress-region#select-bg": "Болгария",
+  "settings#egress-region#select-ch": "Швейцария",
+  "settings#egress-region#select-cz": "Чехия",
+  "settings#egress-region#select-dk": "Дания",
+  "settings#egress-region#select-fr": "Франция",
+  "settings#egress-region#select-hu": "Венгрия",
+  "settings#egress-region#select-it": "Италия",
+  "settings#egress-region#select-no": "Норвегия",
+  "settings#egress-region#select-ro": "Румыния",
+  "settings#egress-region#select-se": "Швеция",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Жарактуу Psiphon серверинин аймагын тандаңыз.",
+  "settings#egress-region#error-modal-title": "Сервер аймагы жеткиликтүү эмес",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Локалдуу Прокси Порттору",
+  "settings#local-proxy-ports#leave-blank": "Портторду автоматтуу түрдө тандоо үчүн <strong>бош</strong> калтырыңыз (сунушталат).",
+  "settings#local-proxy-ports#reason": "Эгер сиз компьютериңизде Psiphon менен иштөө үчүн кол менен конфигурациялоону талап кыла турган куралдарды колдонсоңуз, сиз Psiphon-дун дайыма белгиленген жергиликтүү портторду колдонушун каалашыңыз мүмкүн. Ал эмесе, сизде жергиликтүү портторду көрсөтүү керектиги жок болсо, конфликттерге жол бербөө максатында Psiphon үчүн ал портторду автоматтуу түрдө тандоого уруксат берүүңүз зарыл.",
+  "settings#local-proxy-ports#http-label": " HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 жана 65535 ортосунда болушу керек.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Жергиликтүү порттор бири-биринен айырмаланып турушу керек.",
+  "settings#local-proxy-ports#error-modal-title": "Локалдуу прокси портунун келишпестиги",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nСиз Psiphon-ду анын HTTP проксиси үчүн атайын жергиликтүү портту колдонууга конфигурациялагансыз. <br>\nОшентсе да, ал порт эбак колдонулуп жаткандыктан, Psiphon аны колдоно албайт.\n</p>\n<p>\nКонфигурацияланган HTTP прокси портун өзгөртүп, кайталап көрүңүз. Бул калыптоону өчүрүүнү сунуштайбыз, ошондо Psiphon автоматтык түрдө жеткиликтүү портту тандайт.</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nСиз Psiphon-ду  SOCKS проксиси үчүн атайын жергиликтүү портту колдонууга конфигурациялагансыз.<br>\nБирок, ал порт эбак колдонулуп жаткандыктан, Psiphon аны колдоно албайт.\n</p>\n<p>\nКонфигурацияланган SOCKS прокси портунун наркын өзгөртүп, кайталап көрүңүз. Psiphon автоматту түрдө жеткиликтүү портту тандай алышы үчүн ал наркты тазалоону сунуштайбыз.\n</p>",
+  "settings#upstream-proxy#heading": "Каршы прокси",
+  "settings#upstream-proxy#by-default": "Эгер сиздин компьютериңизде прокси эбак конфигурацияланган болсо, демейки боюнча Psiphon туннелди орнотуу кезинде ал проксини колдонот. Сиз бул мүнөз-кылыкты аттап кетиш үчүн колдонууга проксини же ушундай \"каршы проксини\" колдонбоо керектигин көрсөтө аласыз.",
+  "settings#upstream-proxy#reason": "Каршы проксилер кээде мектептерде, университеттерде жана бизнесте колдонулат. Эгер тармак провайдериңиз сизге каршы прокси баптоолорун берген болсо, байланышуу үчүн аларды кол менен баптоо талап кылынышы мүмкүн. ",
+  "settings#upstream-proxy#proxy-reqs": "Бир гана HTTPS колдогон  HTTP проксилерге уруксат берилген.",
+  "settings#upstream-proxy#hostname-label": "Хост аты",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Колдонуучунун аты",
+  "settings#upstream-proxy#password-label": "Сыр сөз",
+  "settings#upstream-proxy#domain-label": "Домен",
+  "settings#upstream-proxy#skip-label": "Каршы проксини колдонбоңуз",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Каршы прокси катасы",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon азыркы учурда система проксиңизди \"каршы прокси\" катары колдонууга конфигурацияланган. <br>\nОшентсе да, ал прокси аркылуу биз Psiphon серверине байланыша албайт окшойбуз. <br>\n\"Каршы проксини колдонбоо\" дегенди иштетип, кайталап көрүңүз.",
+  "settings#upstream-proxy#error-modal-body-configured": "Сиз Psiphon-ду \"каршы проксини\" колдонууга конфигурациялагансыз. <br>\nОшентсе да, ал прокси аркылуу биз Psiphon серверине байланыша албайт окшойбуз.<br>\nБаптоолорду оңдоп, кайталап көрүңүз.",
+  "settings#transport-mode#heading": "Транспорт режими",
+  "settings#transport-mode#check-label": "L2TP/IPSec режимин колдонуу",
+  "settings#transport-mode#help-text": "Windows-дун L2TP/IPSec виртуалдык тармагын колдонот. Бул режим бардык колдонмолоруңузду туннелдейт, бирок будамалабайт жана аны цензура куралдары оңой аныктайт жана тосо алат. Ал тармактык экрандардын көбүн аттап өтүүгө <strong>сунушталбайт</strong>.",
+  "settings#systray-minimize#heading": "Билдирүү аймагына чейин кичирейтүү (Систималык Трей)",
+  "settings#systray-minimize#help-text": "Иштетилген болсо, Psiphon колдонмосу кичирейтилген кезинде анын терезеси билдирүулөр аймагына жашырылат (ошондой эле, ал \"системалык трей” же \"systray\" түрүндө белгилүү, жана Windows тапшырмалар тилкеңизде сааттын жанында жайгашкан).",
+  "settings#systray-minimize#reason": "Psiphon-ду билдирүүлөр аймагына (\"системалык трей\") чейин кичирейтүү тапшырмалар тилкеңизде орун бошотот. Бул айрыкча Psiphon-ду узак убакыт бою колдонгонго пайдалуу.",
+  "settings#systray-minimize#enable-label": "Билдирүү аймагына чейин кичирейтүү (системалык трей)",
+  "settings#applying-message": "Баптоолоруңузду ишке ашыруу үчүн кайра байланышуу.",
+  "settings#saved-message": "Баптоолор сакталды.",
+  "settings#error-modal#title": "Баптоолор катасы",
+  "settings#error-modal#body": "Баптоолорүңүздүн нарктарында каталар бар. Улантуу алдында аларды түзөтүңүз.",
+  "feedback#top_content_title": "Бизге пикиринизди билдириниз",
+  "feedback#top_para_2": "Маселелердин көбүн соңку нускасын жүктөп алуу аркылуу чечүүгө болот. Сиз <a class=\"NewVersionURL\" href=\"#\"> муну басып соңку нускасын жүктөп алсаңыз </a>, же болбосо буга имейл жиберсеңиз болот<a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Мындан тышкары, сиз көп кездешкен маселелерге чечимдерди <a class=\"FaqURL\" href=\"#\">Көп Кездешкен Суроолор</a> бөлүмүнөн тапсаңыз болот.",
+  "feedback#smiley_happy": "Psiphon мага керек болгондой байланышат жана иштейт.",
+  "feedback#smiley_sad": "Psiphon көп учурда байланышты жоготот жана анча жакшы иштебейт.",
+  "feedback#text_feedback_prompt": "Сураныч, бул жерге пикириңизди жазыңыз:",
+  "feedback#text_feedback_email_prompt": "Сизге жооп берүүбүздү кааласаңыз, имейл дарегиңизди калтырыңыз:",
+  "feedback#diagnostic_check": "Диагностикалык берилмелерди жүктөңүз. Эскертүү, бул диагностикалык берилмелер сизди аныктабайт жана бизге Psiphon-ду тегиз иштетүүгө жардам берет. <a class=\"DataCollectionInfoURL\" href=\"#\"> Биз кандай маалыматтарды чогултканыбызды көрүү үчүн бул жерди басыңыз.</a>",
+  "feedback#submit_button": "Жиберүү",
+  "feedback#text_feedback_bottom_para": "Эгерде жогорудагы форма иштебесе, же болбосо скриншотторду жиберүүнү кааласаңыз, бизге <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> дарегине жазыңыз.",
+  "feedback#success-message": "<strong>Рахмат!</strong> Сиздин пикириңизди билдирүүнүз жиберилди.",
+  "logs#show-debug-label": "Жөндөө журналын көрсөтүү",
+  "logs#placeholder": "Журналдар азырынча жок",
+  "language#success-message": "<strong>Салам!</strong>Psiphon-го Кош Келиңиз ",
+  "about#wordart-tag": "Чек аралардан өйдө",
+  "about#description": "Psiphon – бул <strong>цензураны аттап өтүү куралы</strong> — ал ачык Интернетти, цензорлор жана желелик экрандарга карабай, жеткиликтүү кылууга арналган курал. Анын <strong>булагы ачык</strong>,ал Канаданын Торонто шаарында жасалган.",
+  "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Жаңы нускасын жүктөп алуу үчүн</a></strong> же болбосо <strong><a class=\"InfoURL\" href=\"#\"> маалымат же жардам алуу үчүн </a></strong> вебсайтка кириңиз. Psiphon Android жана Windows үчүн жеткиликтүү.",
+  "about#get-by-email": "<strong>Эгерде вебсайт жеткиликтүү эмес болсо</strong>, буга имейл жиберүү аркылуу Psiphon-дун жаңы нускасын ала аласыз:",
+  "about#client-version": "Windows үчүн Psiphon клиентинин нускасы: ",
+  "general#modal-close-button": "Жабуу",
+  "general#notice-modal-tech-preamble": "Техникалык ката маалыматы:",
+  "notice#systemproxysettings-setproxy-error-title": "Системалык прокси катасы",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon системдин прокси баптоолорун койо албай койду.</p>\n<p>Бул сиздин антивирустук программаңыз менен конфликттен болушу мүмкүн. Жергиликтүү Psiphon проксилерин колдонуу үчүн колдонмоңуздун же болбосо системанын прокси баптоолорун кол менен конфигурациялоо керек болушу мүмкүн.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” деп аталган Интернет байланышы үчүн системалык прокси баптоолорун койо албай койду . Бул сиздин антивирустук программаңыз менен келишпестиктен болушу мүмкун. Жергиликтүү Psiphon проксилерин колдонуу үчүн колодонмоңуздун же системалык прокси баптоолорун кол менен конфигурациялоо керек болушу мүмкүн.",
+  "appbackend#state-stopped-title": "Psiphon ажыратылды",
+  "appbackend#state-starting-title": "Psiphon байланышууда",
+  "appbackend#state-starting-body": "Сураныч, күтө туруңуз...",
+  "appbackend#state-connected-title": "Psiphon байланышты",
+  "appbackend#state-connected-body": "Өз чек араларыңыздан ашып изилдеңиз!",
+  "appbackend#state-connected-reminder-title": "Psiphon сизди байланышта кармап турат",
+  "appbackend#state-connected-reminder-body": "Psiphon-ду эркин кармаңыз. Биздин демөөрчүлөрүбүздүн баракчаларына кирүү үчүн бул жерди басыңыз!",
+  "appbackend#state-connected-reminder-body-2": "Биздин демөөрчүлөрүбүздүн беттерине кирүү аркылуу Psiphon-ду эркин кармаңыз!",
+  "appbackend#minimized-to-systray-title": "Psiphon билдирүүлөр аймагына кичирейтилди",
+  "appbackend#minimized-to-systray-body": "Колдонмону калыбына келтирүү үчүн сүрөтчөнү басыңыз",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Демөөрлөндү"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["my"].translation = {
+  "banner#long-connecting": "<strong>အို မဟုတ်ဘူး</strong>သင့်မှာ ချိတ်ဆက်မှုနှင့် ပတ်သတ်သည့် ပြဿနာရှိနေသည်ဟု ထင်ပါသည်။<br>\nPsiphon ၏နောက်ဆုံးဗားရှင်းကို <a class=\"NewVersionURL\" href=\"#\">ဒေါင်းလုပ်ဆွဲရမည့်နေရမှ</a>ဒေါင်းလုပ်လုပ်ပါ။\nသို့မဟုတ် <a class=\"NewVersionEmail\" href=\"#\"></a>အီးမေးလ်ပေးပို့ပါ။ ",
+  "nav#connection#starting": "ချိတ်ဆက်နေပါသည်",
+  "nav#connection#connected": "ချိတ်ဆက်ပြီးပါပြီ",
+  "nav#connection#stopping": "ချိတ်ဆက်မှုဖြတ်တောက်နေပါသည်",
+  "nav#connection#stopped": "ချိတ်ဆက်မှုဖြတ်တောက်ပြီးပါပြီ",
+  "nav#settings": "အပြင်အဆင်များ",
+  "nav#feedback": "အကြံပြုချက်",
+  "nav#logs": "မှတ်တမ်းများ",
+  "nav#about": "အကြောင်း",
+  "connection#starting-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်နေပါသည်</span>...",
+  "connection#stop-btn": "ရပ်ရန်",
+  "connection#connected-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်ပြီးပါပြီ</span>",
+  "connection#disconnect-btn": "ချိတ်ဆက်မှုဖြတ်တောက်ရန်",
+  "connection#stopping-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်မှုဖြတ်တောက်နေပါသည်</span> ...",
+  "connection#wait-btn": "ကျေးဇူး၍ ​ခေတ္တစောင့်ပါ...",
+  "connection#stopped-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်မှုဖြတ်တောက်ပြီးပါပြီ</span>",
+  "connection#connect-btn": "ချိတ်ဆက်ရန်",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>မှားယွင်းနေသည်</strong>ကျေးဇူးပြု၍ဆက်လက်လုပ်ဆောင်ခြင်းမပြုမီ မှန်ကန်မှုမရှိသော တန်ဖိုးများကိုပြင်ပါ။",
+  "settings#reset-button": "မူလပုံစံပြန်ထားရန်",
+  "settings#apply-button": "ပြောင်းလဲမှုများကို လုပ်ဆောင်ပါ",
+  "settings#unapplied-changes-prompt#title": "အပြင်အဆင်များပြောင်းလဲပြီးပါပြီ",
+  "settings#unapplied-changes-prompt#body": "သင်၏အပြင်အဆင်များထဲတွင် ပြောင်းလဲပြီးသော်လည်း ပြောင်းလဲမှုများ သက်ရောက်အောင် မလုပ်ဆောင်ရသေးပါ။ <br><br> သင့်အနေဖြင့် ပြောင်းလဲမှုများကို သက်ရောက်မှုရှိရန်လုပ်ဆောင်လိုပါသလား၊ သို့မဟုတ် လျစ်လျူရှုလိုပါသလား။",
+  "settings#unapplied-changes-prompt#apply-button": "သက်ရောက်မှုရှိအောင်လုပ်ဆောင်ရန်",
+  "settings#unapplied-changes-prompt#discard-button": "လျစ်လျူရှုရန်",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec ပုံစံနှင့်အလုပ်မလုပ်ပါ)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Tunnel ကိုခွဲထုတ်ရန်",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "သင်၏နိုင်ငံအတွင်းတွင် ဝက်ဆိုက်ဒ်များကို အင်တာနက်ကြားခံ ခံ၍အသုံးမပြုပါနှင့်။",
+  "settings#disable-timeouts#heading": "နှေးသောအင်တာနက်ကွန်ယက်များအတွက် အချိန်သတ်မှတ်ချက်ကို အသုံးမပြုနိုင်အောင်ပြုလုပ်ရန်",
+  "settings#disable-timeouts#help-text": "အကယ်၍အသုံးပြုနိုင်အောင်ပြုလုပ်ထားပါက Psiphon ဆာဗာနှင့် ပြန်ကြားဆက်သွယ်မှုများသည် အချိန်သတ်မှတ်ချက် ရှိမည်မဟုတ်ပါ။",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "နှေးသောအင်တာနက်ကွန်ယက်များအတွက် အချိန်သတ်မှတ်ချက်ကို အသုံးမပြုနိုင်အောင်ပြုလုပ်ရန်",
+  "settings#egress-region#heading": "Psiphon ဆာဗာရှိရာဒေသ",
+  "settings#egress-region#select-best-performance": "အကောင်းဆုံးလုပ်ဆောင်မှု",
+  "settings#egress-region#select-us": "အမေရိကန်ပြည်ထောင်စု",
+  "settings#egress-region#select-ca": "ကနေဒါ",
+  "settings#egress-region#select-gb": "ယူကေ",
+  "settings#egress-region#select-jp": "ဂျပန်",
+  "settings#egress-region#select-sg": "စင်္ကာပူ",
+  "settings#egress-region#select-sk": "ဆလိုဗာကီးယား",
+  "settings#egress-region#select-nl": "နယ်သာလန်",
+  "settings#egress-region#select-de": "ဂျာမဏီ",
+  "settings#egress-region#select-in": "အိန္ဒိယ",
+  "settings#egress-region#select-es": "စပိန်",
+  "settings#egress-region#select-hk": "ဟောင်ကောင်",
+  "settings#egress-region#select-at": "သြစတြီးယား",
+  "settings#egress-region#select-be": "ဘယ်လ်ဂျီယမ်",
+  "settings#egress-region#select-bg": "ဘူလ်ဂေးရီးယား",
+  "settings#egress-region#select-ch": "ဆွစ်ဇာလန်",
+  "settings#egress-region#select-cz": "ချက်ဗ်",
+  "settings#egress-region#select-dk": "ဒိန်းမတ်",
+  "settings#egress-region#select-fr": "ပြင်သစ်",
+  "settings#egress-region#select-hu": "ဟန်ဂေရီ",
+  "settings#egress-region#select-it": "အီတလီ",
+  "settings#egress-region#select-no": "နော်ဝေ",
+  "settings#egress-region#select-ro": "ရိုမေးနီးယား",
+  "settings#egress-region#select-se": "ဆွီဒင်",
+  "settings#egress-region#select-pl": "ပိုလန်",
+  "settings#egress-region#select-rs": "ဆားဘီးယား",
+  "settings#egress-region#select-au": "သြစတြေးလျ",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "ဆီလျော်သော Psiphon ဆာဗာဒေသကိုရွေးချယ်ရန်။",
+  "settings#egress-region#error-modal-title": "ဆာဗာဒေသမရှိနိုင်ပါ",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Local Proxy Ports",
+  "settings#local-proxy-ports#leave-blank": "အလိုအလျောက် port ရွေးချယ်မှုနေရာတွင် <strong>ကွက်လပ်</strong>ချန်ထားခဲ့ပါ (ရန် အကြံပြုပါသည်)။",
+  "settings#local-proxy-ports#reason": "အကယ်၍ Psiphon အသုံးပြုရန်အတွက် သင်၏ကွန်ပျူတာသည် ကိုယ်တိုင်ကိုယ်ကျ ရွေးချယ်သတ်မှတ်ပြင်ဆင်ပေးရန်လိုအပ်ပါက သင်သည် တူညီသည့် local port နံပါတ်များ ဆက်လက်ရွေးချယ်ပေးရန်လိုသည်။ အကယ်၍သင်သည် port နံပါတ်များရွေးချယ်သတ်မှတ်ရန် မလိုအပ်ပါက ပဋိပက္ခများရှောင်ရှားရန်အတွက် Psiphon ကိုအလိုအလျောက်ရွေးချယ်ခွင့်ပြုသင့်သည်။",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "၁ နှင့် ၆၅၅၃၅ ကြားအတွင်းရှိရမည်။ ",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "local port များသည် တစ်ခုနှင့်တစ်ခုကွဲပြားနေရမည်။",
+  "settings#local-proxy-ports#error-modal-title": "local ကြားခံအင်တာနက် Port ပဋိပက္ခ",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nသင်သည် Psiphon ကို သူ၏ HTTP ကြားခံအတွက် local port အသုံးပြုရန် ချိန်ညှိပြီးပါပြီ။<br>\nသို့သော်လည်း ထို port သည် အသုံးပြုနှင့်ပြီးသားဖြစ်နေသောကြောင့် Psiphon အနေဖြင့် ထို port ကိုအသုံးပြု၍မရပါ။\n</p>\n<p>\nကျေးဇူးပြု၍ HTTP ကြားခံ port ရှိတန်ဖိုးများကိုပြောင်းလဲသတ်မှတ်ပြီး နောက်တစ်ကြိမ် ထပ်မံကြိုးစားကြည့်ပေးပါ။ Psiphon အနေဖြင့် ရရှိနိုင်သော port ကို အလိုအလျောက်ရွေးချယ်နိုင်စေရန်အတွက် တန်ဖိုးများကိုရှင်းလင်းပေးရန် အကြံပြုလိုပါသည်။\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nသင်သည် Psiphon ကို သူ၏ SOCKS ကြားခံအတွက် local port အသုံးပြုမည်ဟု ချိန်ညှိထားပါသည်။<br>\nသို့သော်လည်း ထို port သည် အသုံးပြုနေနှင့်ပြီးသောကြောင့် Psiphon အနေဖြင့် ထို port ကို အသုံးပြု၍ မရပါ။\n</p>\n<p>\nကျေးဇူးပြု၍ SOCKS ကြားခံ port ရှိ တန်ဖိုးများသတ်မှတ်ထားမှုကို ပြောင်းလဲပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားပေးပါ။ Psiphon အနေဖြင့် ရရှိနိုင်သော port ကို အလိုအလျောက်ရွေးချယ်နိုင်စေရန်အတွက် တန်ဖိုးများကို ရှင်းလင်းပေးရန် အကြံပြုလိုပါသည်။\n</p>",
+  "settings#upstream-proxy#heading": "အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ",
+  "settings#upstream-proxy#by-default": "အကယ်၍ သင်၏ကွန်ပျူတာတွင် အင်တာနက်ကြားခံကို သတ်မှတ်ပြီးပါက စက်တစ်ခုလုံးချိတ်ဆက်သည့် ပုံစံတွင် Psiphon သည် ထိုကြားခံကို  ကြိုတင်သတ်မှတ်ထားသည့်ပုံစံဖြင့် ရွေးချယ်ပါလိမ့်မည်။ အသုံးပြုမည့် ကြားခံတစ်ခုအား ရွေးချယ်သတ်မှတ်ပေးခြင်း သို့မဟုတ် ထိုကဲ့သို့သော ကြားခံအားအသုံးမပြုဟု ရွေးချယ်သတ်မှတ်ပေးခြင်းဖြင့် အထက်ပါပုံစံကို ပြောင်းလဲနိုင်သည်။ ",
+  "settings#upstream-proxy#reason": "အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံများကို တခါတရံတွင် ကျောင်းများ၊ တက္ကသိုလ်များ သို့မဟုတ် စီးပွါးရေးလုပ်ငန်းများက လိုအပ်လေ့ရှိသည်။ အကယ်၍ သင်၏ကွန်ယက်ကိုထောက်ပံ့သူသည် အင်တာနက်အားချိတ်ဆက်ရန် ကြားခံအတွက် အပြင်အဆင်ကိုပေးထားပါက ချိတ်ဆက်ရန်အတွက် ကိုယ်တိုင်ကိုယ်ကျ ပြန်လည်ပြင်ဆင်ပေးရန် လိုအပ်သည်။",
+  "settings#upstream-proxy#proxy-reqs": "HTTPS ကို အထောက်အပံ့ပေးနိုင်သော HTTP ကြားခံများကိုသာ ခွင့်ပြုသည်။ ",
+  "settings#upstream-proxy#hostname-label": "Hostname",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "အသုံးပြုသူအမည်",
+  "settings#upstream-proxy#password-label": "စကားဝှက်",
+  "settings#upstream-proxy#domain-label": "ဒိုမိန်း",
+  "settings#upstream-proxy#skip-label": "အင်တာနက်အားချိတ်ဆက်ရန် ကြားခံ အသုံးမပြုပါနှင့်",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "အင်တာနက်အားချိတ်ဆက်ပေးသည့် ကြားခံတွင် ပြဿနာတက်နေသည်",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon သည် လက်ရှိအချိန်တွင် သင့်စက်တွင်ပါဝင်သော ကြားခံကို \"အင်တာနက်အား ချိတ်ဆက်ရန်ကြားခံ\" အဖြစ်မှတ်ယူထားပါသည်။ <br>\nသို့သော်လည်း ထိုကြားခံကို ဖြတ်၍ Psiphon ဆာဗာတစ်ခုခုအား ချိတ်ဆက်မရနိုင် ဖြစ်နေသည်ဟု ယူဆပါသည်။<br>\nကျေးဇူးပြု၍ \"အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ အသုံးမပြုပါ။\" ကို ရွေးချယ်ပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားကြည့်ပါ။",
+  "settings#upstream-proxy#error-modal-body-configured": "သင်သည် Psiphon တွင် \"အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ\" အသုံးပြုမည်ဟု ချိန်ညှိထားပါသည်။<br>\nသို့သော်လည်း ထိုကြားခံကို အဖြတ်၍ Psiphon ဆာဗာတစ်ခုခုအား ချိတ်ဆက်မရနိုင်ဖြစ်နေသည်ဟု ယူဆပါသည်။<br>\nကျေးဇူးပြု၍ အပြင်အဆင်တွင်ပြောင်းလဲပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားကြည့်ပါ။",
+  "settings#transport-mode#heading": "သယ်ယူပို့ဆောင်ရေးပုံစံအနေအထား",
+  "settings#transport-mode#check-label": "L2TP/IPSec ပုံစံကိုအသုံးပြုမည်",
+  "settings#transport-mode#help-text": "ဝင်းဒိုးရှိ L2TP/IPSec virtual ကွန်ယက်ချိတ်ဆက်မှုကို အသုံးပြုပါ။ ဤပုံစံသည် သင်၏ app များအားလုံး Psiphon ကိုဖြတ်၍ လှိုင်ခေါင်းသဖွယ်ချိတ်ဆက်လိုက်မည်ဖြစ်သော်လည်း နားမလည်နိုင်အောင်ပြုလုပ်လိုက်ခြင်းမဟုတ်သောကြောင့် ဆင်ဆာဖြတ်တောက်မှုစွမ်းရည်ခိုင်မာမှုမရှိချေ။ ထိုကြောင်း ၎င်းနည်းကို firewall အများစုအား ဖြတ်ကျော်ရန်အတွက် <strong>အားမပေးပါ</strong>။",
+  "settings#systray-minimize#heading": "အချက်ပြဧရိယာအတွင်းသို့ချုံ့ပါ (System Tray)",
+  "settings#systray-minimize#help-text": "အကယ်၍အသုံးပြုနိုင်အောင်ပြုလုပ်ထားပါက ချုံ့ထားသည့်အချိန်အတွင်း Psiphon application ဝင်းဒိုးသည် အချက်ပြဧရိယာ (ဝင်းဒိုး  task bar ပေါ်ရှိ နာရီအနီးတွင်ရှိသော “system tray” သို့မဟုတ် “systray” ဟုလည်းသိကြသည်) အတွင်းတွင် ပုံးကွယ်နေပါလိမ့်မည်။ ",
+  "settings#systray-minimize#reason": "Psiphon ကို အချက်ပြဧရိယာ (“system tray”) အတွင်းသို့ချုံ့ခြင်းသည် သင်၏ task bar အတွင်းရှိနေရာများကိုလွတ်သွားစေသည်။ အထူးသဖြင့် သင်သည် Psiphon ကိုအချိန်ကြာမြင့်စွာဖွင့်ထားလေ့ရှိပါက အသုံးဝင်သည်။ ",
+  "settings#systray-minimize#enable-label": "အချက်ပြဧရိယာအတွင်းသို့ချုံ့ရန် (system tray)",
+  "settings#applying-message": "အပြင်အဆင်များပေါ်တွင် သက်ရောက်မှုရှိရန် ပြန်လည်ချိတ်ဆက်ပေးနေပါသည်။",
+  "settings#saved-message": "အပြင်အဆင်များ သိမ်းဆည်းပြီးပါပြီ။",
+  "settings#error-modal#title": "အပြင်အဆင်များ မှားယွင်းမှု",
+  "settings#error-modal#body": "သင်၏ အပြင်အဆင်များတန်ဖိုးထဲတွင် မှားယွင်းမှုများပါနေပါသည်။ ကျေးဇူးပြု၍ ဆက်လက်မလုပ်ဆောင်မီ ပြင်ပေးပါ။",
+  "feedback#top_content_title": "သင်၏ထင်မြင်အကြံပြုချက်ပေးရန်",
+  "feedback#top_para_2": "နောက်ဆုံးဗားရှင်းကိုဒေါင်းလုပ္လုပ်ခြင်းဖြင့် ပြဿနာအများစုကို ဖြေရှင်းနိုင်ပါသည်။ <a class=\"NewVersionURL\" href=\"#\">နောက်ဆုံး ဗားရှင်းကို ဒီမှာ ကလစ်နှိပ်ခြင့်ဖြင့်</a> သို့မဟုတ် <a class=\"NewVersionEmail\" href=\"#\"></a> သို့အီးမေးလ်ပို့ခြင်းဖြင့် ရယူနိုင်ပါသည်။",
+  "feedback#top_para_3": "<a class=\"FaqURL\" href=\"#\">မကြာခဏမေးလေ့ရှိသောမေးခွန်းများ</a> ထဲတွင် ကြုံရလေ့ရှိသောအခက်အခဲများအတွက် ဖြေရှင်းနည်းများကို တွေ့ရှိနိုင်ပါသည်။",
+  "feedback#smiley_happy": "ကျွနု်ပ်လိုချင်သည့်ပုံစံအတိုင်း Psiphon သည် ချိတ်ဆက်ပြီးလုပ်ဆောင်နေပါသည်။",
+  "feedback#smiley_sad": "Psiphon သည်မကြာခဏဆိုသလို ချိတ်ဆက်မှုပြတ်တောက်သည် သို့မဟုတ် ကောင်းမွန်စွာမလုပ်ဆောင်ပါ။",
+  "feedback#text_feedback_prompt": "သင်၏ထင်မြင်ယူဆချက်ကိုဒီမှာရေးပါ :",
+  "feedback#text_feedback_email_prompt": "အကယ်၍ သင့်ကိုအကြောင်းပြန်စေလိုပါက ကျေးဇူးပြု၍ သင်၏အီးမေးလ်လိပ်စာကိုထည့်ပါ :",
+  "feedback#diagnostic_check": "စစ်ဆေးထားသောအချက်အလက်ဒေတာများကို တင်ပါ။ ထိုဒေတာများသည် သင်မည်သူမည်ဝါဖြစ်ကြောင်းမဖေါ်ပြနိုင်ပါ၊ Psiphon ကို အဆင်ပြေချောမွေ့စွာ လည်ပတ်နိုင်ရန်အတွက် ကူညီပေးခြင်းသာ ဖြစ်သည်။ <a class=\"DataCollectionInfoURL\" href=\"#\">ကျွနု်ပ်တို့ မည်သည့် အချက်အလက်ဒေတာများ ကောက်ယူသည်ကို သိရှိရန်ဒီမှာနှိပ်ပါ။</a>",
+  "feedback#submit_button": "တင်သွင်းပါ။",
+  "feedback#text_feedback_bottom_para": "အကယ်၍ အထက်ပါဖောင်ပုံစံသည် အလုပ်မလုပ်ပါက သို့မဟုတ် သင်သည် screenshot များကို ပို့လိုပါက ကျေးဇူးပြု၍ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ထံအီးမေးလ်ပို့ပါ။",
+  "feedback#success-message": "<strong>ကျေးဇူးတင်ပါတယ်</strong> သင့်ရဲ့ အကြံပြုချက်ကို ပေးပို့ပြီးပါပြီ။",
+  "logs#show-debug-label": "ဖယ်ရှားထားသောမှတ်တမ်းများပြရန်",
+  "logs#placeholder": "မှတ်တမ်းများမရှိပါ",
+  "language#success-message": "<strong>မင်္ဂလာပါ</strong> Psiphon မှကြိုဆိုပါတယ်။",
+  "about#wordart-tag": "နယ်စည်းမျဥ်းများကိုကျော်လွန်၍",
+  "about#description": "Psiphon သည် <strong>ဆင်ဆာဖြတ်တောက်မှုကိုကျော်လွှားသည့်ကိရိယာ</strong>တစ်ခုဖြစ်သည်။ လွတ်လပ်သည့်အင်တာနက်ကို ဆင်ဆာဖြတ်တောက်မှုများနှင့် firewall များအား ကျော်ဖြတ်၍ ရယူသုံးစွဲနိုင်ရန်အတွက် ဖန်တီးပြုလုပ်ထားခြင်းဖြစ်သည်။ Psiphon သည် <strong>မည်သူမဆိုရယူအသုံးပြုနိုင်သော ပွင့်လင်းအရင်းအမြစ်</strong>ဖြစ်ပြီး ကနေဒါနိုင်ငံ၊ တိုရိုတိုတွင် ဖန်တီးခဲ့ပါသည်။",
+  "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">ဗားရှင်းအသစ်ကိုဒေါင်းလုပ်လုပ်ရန်</a></strong>အတွက် သို့မဟုတ် <strong><a class=\"InfoURL\" href=\"#\">အကူအညီနှင့် သတင်းအချက်အလက်များ လက်ခံရယူရန်</a></strong>အတွက်ဝက်ဆိုက်ကိုကျေးဇူးပြု၍သွားပါ။ Psiphon ကို Android နှင့် Windows များအတွက်ရရှိနိုင်ပါသည်။",
+  "about#get-by-email": "<strong>အကယ်၍ဝက်ဆိုက်ကိုရယူ၍မရပါက</strong>Psiphon ဗားရှင်းအသစ်ကို ရယူရန် : သို့အီးမေးလ်ပေးပို့ ရယူနိုင်ပါသည်။",
+  "about#client-version": "ဝင်းဒိုးအသုံးပြုသူများအတွက် Psiphon ဗားရှင်း :",
+  "general#modal-close-button": "ပိတ်ရန်",
+  "general#notice-modal-tech-preamble": "ဤသည်မှာ နည်းပညာပိုင်းဆိုင်ရာ မှားယွင်းမှုအတွက် သတင်းအချက်အလက်:",
+  "notice#systemproxysettings-setproxy-error-title": "စက်ရှိ အင်တာနက်ကြားခံ ပြဿနာ",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon သည် စက်၏ ကြားခံအပြင်အဆင်များ သတ်မှတ်ခြင်း မအောင်မြင်ပါ။</p>\n<p>ဤသည်မှာသင်၏ antivirus software နှင့် ပဋိပက္ခဖြစ်နေခြင်းကြောင့် ဖြစ်နိုင်သည်။ သင်၏ application ကို ကိုယ်တိုင်ကိုယ်ကျ ချိန်ညှိသတ်မှတ်ပေးခြင်း သို့မဟုတ် စက်၏ ကြားခံအင်တာနက် အပြင်အဆင်များတွင် local Psiphon ၏ ကြားခံများ ထည့်သွင်းပြင်ဆင်ခြင်းများ ပြုလုပ်ပေးရန်လိုအပ်သည်။</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon သည်အင်တာနက်ချိတ်ဆက်မှု အမည် “<%- data %>”အတွက် စက်၏ ကြားခံအပြင်အဆင်များသတ်မှတ်ခြင်း မအောင်မြင်ပါ။ ဤသည်မှာသင်၏ antivirus software နှင့် ပဋိပက္ခဖြစ်နေခြင်းကြောင့် ဖြစ်နိုင်သည်။ သင်၏ application ကို ကိုယ်တိုင်ကိုယ်ကျ ချိန်ညှိသတ်မှတ်ပေးခြင်း သို့မဟုတ် စက်၏ ကြားခံအင်တာနက် အပြင်အဆင်များတွင် local Psiphon ၏ ကြားခံများ ထည့်သွင်းပြင်ဆင်ခြင်းများ ပြုလုပ်ပေးရန်လိုအပ်သည်။",
+  "appbackend#state-stopped-title": "Psiphon သည် ချိတ်ဆက်မှုမရှိပါ",
+  "appbackend#state-starting-title": "Psiphon သည် ချိတ်ဆက်နေပါသည်",
+  "appbackend#state-starting-body": "ကျေးဇူး၍ ခေတ္တစောင့်ပါ...",
+  "appbackend#state-connected-title": "Psiphon သည် ချိတ်ဆက်ပြီးပါပြီ",
+  "appbackend#state-connected-body": "သင့်နယ်စည်းမျဥ်းများကိုကျော်လွန်၍စူးစမ်းလေ့လာပါ။",
+  "appbackend#state-connected-reminder-title": "Psiphon သည် သင့်ကိုဆက်လက်ချိတ်ဆက် ပေးနေပါသည်",
+  "appbackend#state-connected-reminder-body": "Psiphon ကိုအခမဲ့ဆက်လက်အသုံးပြုခွင့်ပေးပါ။ ကျွနု်ပ်တို့ကို ငွေကြေးထောက်ပံ့ပေးထားသူများအား သိရှိရန်အတွက် ဒီမှာကလစ်နှိပ်ပါ။",
+  "appbackend#state-connected-reminder-body-2": "ကျွနု်ပ်တို့ကိုငွေကြေးထောက်ပံ့ပေးထားသူများ၏ စာမျက်နှာကို ဝင်ရောက်လည်ပါတ်ခြင်းဖြင့် Psiphon ကို အခမဲ့ဆက်လက်အသုံးပြုခွင့်ပေးပါ။",
+  "appbackend#minimized-to-systray-title": "Psiphon ကို အချက်ပြဧရိယာအတွင်းသို့ ချုံ့ပြီးပါပြီ",
+  "appbackend#minimized-to-systray-body": "Application ကိုပြန်လည်ရယူသိမ်းဆည်းရန်အတွက် ဤပုံကိုနှိပ်ပါ",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "ထောက်ပံ့ကူညီပေးသူ"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["nb"].translation = {
+  "banner#long-connecting": "<strong>Å nei!</strong> Det ser ut til at du har problemer! <br>\nLast ned nyeste versjon av Psiphon fra <a class=\"NewVersionURL\" href=\"#\">nedlastingssiden</a>\neller ved å sende en e-post til <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Kobler til",
+  "nav#connection#connected": "Tilkoblet",
+  "nav#connection#stopping": "Kobler fra",
+  "nav#connection#stopped": "Frakoblet",
+  "nav#settings": "Innstillinger",
+  "nav#feedback": "Tilbakemeldinger",
+  "nav#logs": "Loggføring",
+  "nav#about": "Om",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">kobler til</span>…",
+  "connection#stop-btn": "Stopp",
+  "connection#connected-msg": "Psiphon er <span class=\"state-word\">tilkoblet</span>…",
+  "connection#disconnect-btn": "Koble fra",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">kobler fra</span>…",
+  "connection#wait-btn": "Vent…",
+  "connection#stopped-msg": "Psiphon er <span class=\"state-word\">frakoblet</span>",
+  "connection#connect-btn": "Koble til",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Feil!</strong> Korriger de uriktige verdiene før du fortsetter.",
+  "settings#reset-button": "Tilbakestill til forvalg",
+  "settings#apply-button": "Legg til endringer",
+  "settings#unapplied-changes-prompt#title": "Innstillinger endret",
+  "settings#unapplied-changes-prompt#body": "Du har gjort endringer i innstillingene dine, men har ikke lagt dem til.<br><br>Ønsker du å legge til dine endringer nå eller forkaste dem?",
+  "settings#unapplied-changes-prompt#apply-button": "Legg til",
+  "settings#unapplied-changes-prompt#discard-button": "Forkast",
+  "settings#vpn-incompatible-msg": "(Virker ikke i L2TP/IPSec-modus.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Delt tunnel",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Ikke mellomtjen nettsider fra ditt land",
+  "settings#disable-timeouts#heading": "Skru av tidsavbrudd for trege nettverk",
+  "settings#disable-timeouts#help-text": "Hvis påskrudd, vil kommunikasjon med Psiphon-tjeneren ikke stoppe ved tidsavbrudd.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Skru av tidsavbrudd for trege nettverk",
+  "settings#egress-region#heading": "Region for Psiphon-tjener",
+  "settings#egress-region#select-best-performance": "Best ytelse",
+  "settings#egress-region#select-us": "Amerikas forente stater",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Storbritannia",
+  "settings#egress-region#select-jp": "Japan",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Nederland",
+  "settings#egress-region#select-de": "Tyskland",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Spania",
+  "settings#egress-region#select-hk": "Hongkong",
+  "settings#egress-region#select-at": "Østerrike",
+  "settings#egress-region#select-be": "Belgia",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Sveits",
+  "settings#egress-region#select-cz": "Tsjekkia",
+  "settings#egress-region#select-dk": "Danmark",
+  "settings#egress-region#select-fr": "Frankrike",
+  "settings#egress-region#select-hu": "Ungarn",
+  "settings#egress-region#select-it": "Italia",
+  "settings#egress-region#select-no": "Norge",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Sverige",
+  "settings#egress-region#select-pl": "Polen",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Velg en gyldig adresse og region for Psiphon-tjener.",
+  "settings#egress-region#error-modal-title": "Tjenerregion utilgjengelig",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Lokale mellomtjener-porter",
+  "settings#local-proxy-ports#leave-blank": "La stå <strong>tom</storng> for automatisk portvalg (anbefales).",
+  "settings#local-proxy-ports#reason": "Hvis du bruker verktøy på din datamaskin som krever manuelt oppsett for å virke med Psiphon, blir ting mye enklere hvis Psihpon alltid bruker lokale portnummer. Hvis du ikke har en grunn til å angi portnummer bør du la Psiphon velge dem automatisk for å unngå konflikter.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Må være et tall fra 1 til 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Lokale porter må være unike",
+  "settings#local-proxy-ports#error-modal-title": "Problem med lokal mellomtjenerport",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nDu har satt opp Psiphon til å bruke en spesifikk port for dets HTTP-mellomtjener.<br>\nDog, den porten later til å allerede være i bruk, så Psiphon kan ikke bruke den.\n</p>\n<p>\nEndre den oppsatte HTTP-portverdien og prøv igjen. Det anbefales at du tømmer feltet slik at Psiphon automatisk kan velge en tilgjengelig port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nDu har satt opp Psiphon til å bruke en spesifikk port for dets SOCKS-mellomtjener.<br>\nDog, den porten later til å allerede være i bruk, så Psiphon kan ikke bruke den.\n</p>\n<p>\nEndre den oppsatte SOCKS-portverdien og prøv igjen. Det anbefales at du tømmer feltet slik at Psiphon automatisk kan velge en tilgjengelig port.\n</p>",
+  "settings#upstream-proxy#heading": "Oppstrømsmellomtjener",
+  "settings#upstream-proxy#by-default": "Hvis din datamaskin allerede har en mellomtjener satt opp vil Psiphon som forvalg bruke den mellomtjeneren til etablering av en tunnel. Du kan overstyre den oppførselen ved å oppgi en mellomtjener, eller ved å oppgi at ingen slik \"oppstrømsmellomtjener\" skal brukes.",
+  "settings#upstream-proxy#reason": "Oppstrømsmellomtjenere kreves noen ganger av skoler, universiteter eller forretninger. Hvis din nettverkstilbyder har gitt deg innstillinger til en oppstrømsmellomtjener, så kan det være at å manuelt skrive dem inn her er det som kreves for å koble til.",
+  "settings#upstream-proxy#proxy-reqs": "Bare HTTP-mellomtjenere som støtter HTTPS er tillatt.",
+  "settings#upstream-proxy#hostname-label": "Vertsnavn",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Brukernavn",
+  "settings#upstream-proxy#password-label": "Passord",
+  "settings#upstream-proxy#domain-label": "Domene",
+  "settings#upstream-proxy#skip-label": "Ikke bruk oppstrømsmellomtjener",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Feil med oppstrømsmellomtjener",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon er satt opp til å bruke ditt systems mellomtjener som sin \"oppstrømstjener\".<br>\nDog, lar det seg ikke gjøre å koble til noen Psiphon-tjener på den mellomtjeneren.<br>\nSkru på \"Ikke bruk oppstrømsmellomtjener\" og prøv igjen.",
+  "settings#upstream-proxy#error-modal-body-configured": "Du har satt opp Psiphon til å bruke en \"oppstrømstjener\".<br>\nDog, lar det seg ikke gjøre å koble til noen Psiphon-tjener på den mellomtjeneren.<br>\nFiks innstillingene og prøv igjen.",
+  "settings#transport-mode#heading": "Transport-modus",
+  "settings#transport-mode#check-label": "Bruk L2TP/IPSec modus",
+  "settings#transport-mode#help-text": "Bruker Windows L2TP/IPSec virtuelt nettverk. Dette moduset vil sende alle dine programmer gjennom en tunnel, men legger ikke til et tilfeldig lag, så det har ikke sterke omgåelsesevner. Det er <strong>ikke anbefalt</strong> for forbigåelse av de fleste brannmurer.",
+  "settings#systray-minimize#heading": "Minimer til varslingsområde (systemkurv)",
+  "settings#systray-minimize#help-text": "Hvis påskrudd, vil programvinduet til Psiphon bli gjemt i varslingsområdet (systemkurven) når det er minimert, ved siden av klokka i oppgavelinjen til Windows.",
+  "settings#systray-minimize#reason": "Minimering av Psiphon til varslingsområdet (\"systemkurven\") frigir plass på oppgavelinjen. Dette er spesielt hjelpsomt hvis du ofte kjører Psiphon lenge av gangen.",
+  "settings#systray-minimize#enable-label": "Minimer til varslingsområde (systemkurv)",
+  "settings#applying-message": "Kobler til på nytt for at endringene skal trå i kraft.",
+  "settings#saved-message": "Innstillingene ble lagret.",
+  "settings#error-modal#title": "Innstillingsfeil",
+  "settings#error-modal#body": "Det er feil i dine innstillingsverdier. Korriger dem før du fortsetter.",
+  "feedback#top_content_title": "Gi oss din tilbakemelding",
+  "feedback#top_para_2": "Mange problemer løses ved å laste ned seneste versjon. Du kan last ned <a class=\"NewVersionURL\" href=\"#\">seneste versjon</a>, eller du kan sende en e-post til <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Du kan finne svar på mange vanlige problemer i vår oversikt over\n<a class=\"FaqURL\" href=\"#\">Ofte-Stilte-Spørsmål</a>.",
+  "feedback#smiley_happy": "Psiphon kobler til og fungerer slik jeg ønsker det.",
+  "feedback#smiley_sad": "Psiphon klarer ikke og koble til eller fungerer ikke bra nok.",
+  "feedback#text_feedback_prompt": "Kommenter her:",
+  "feedback#text_feedback_email_prompt": "Hvis du ønsker at vi svarer deg, legg ved din e-postadresse:",
+  "feedback#diagnostic_check": "Last opp diagnostisk data. Bit deg merke i at denne diagnostikk-dataen ikke\nidentifiserer deg, og at du på denne måten kan hjelpe oss å holde Psiphon-hjulene i knirkefritt gjenge.\n<a class=\"DataCollectionInfoURL\" href=\"#\">Trykk her for å se hva vi samler inn.</a>",
+  "feedback#submit_button": "Send inn",
+  "feedback#text_feedback_bottom_para": "Hvis overstående skjema ikke virker, eller du vil dele skjermbilder med oss, send e-post til <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Takk!</strong> Din tilbakemelding har blitt sendt.",
+  "logs#show-debug-label": "Vis feilrettingslogg",
+  "logs#placeholder": "Ingen loggføring enda",
+  "language#success-message": "<strong>Heia.</strong> Velkommen til Psiphon.",
+  "about#wordart-tag": "Grenseløs",
+  "about#description": "Psiphon er et <strong>sensuromgåelsesverktøy</strong> — det er designet for å gi tilgang til det åpne Internett, forbi sensurorganer og brannmurer. Det er <strong>friprog</strong> utviklet i Toronto, Kanada.",
+  "about#visit-download-site": "Besøk nettsiden for å laste ned en<strong><a class=\"NewVersionURL\" href=\"#\">ny versjon</a></strong> eller for å <strong><a class=\"InfoURL\" href=\"#\">få hjelp og informasjon</a></strong>. Psiphon er tilgjengelig både for Android og Windows.",
+  "about#get-by-email": "<strong>Hvis nettsiden ikke kan nås</strong>, kan du hente en ny versjon av Psiphon ved å sende e-post til:",
+  "about#client-version": "Psiphon for Windows, klientversjon:",
+  "general#modal-close-button": "Lukk",
+  "general#notice-modal-tech-preamble": "Teknisk info om feilen:",
+  "notice#systemproxysettings-setproxy-error-title": "Feil med systemmellomtjener",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon klarte ikke å sette systemets mellomtjenerinnstillinger.</p>\n<p>Dette kan være som følge av en konflikt med din antivirusprogramvare. Det kan hende du må sette opp ditt program eller mellomtjener manuelt til bruk med de lokale Psiphon-mellomtjenerne.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "<p>Psiphon klarte ikke å sette systemets mellomtjenerinnstillinger for Internettilkoblingen ved navn “<%- data %>. Dette kan være som følge av en konflikt med din antivirusprogramvare. Det kan hende du må sette opp ditt program eller mellomtjener manuelt til bruk med de lokale Psiphon-mellomtjenerne.",
+  "appbackend#state-stopped-title": "Psiphon er frakoblet",
+  "appbackend#state-starting-title": "Psiphon kobler til",
+  "appbackend#state-starting-body": "Vent…",
+  "appbackend#state-connected-title": "Psiphon er tilkoblet",
+  "appbackend#state-connected-body": "Grenseløs utforskning!",
+  "appbackend#state-connected-reminder-title": "Psiphon holder kontakten for deg",
+  "appbackend#state-connected-reminder-body": "Behold Priphon gratis. Klikk her for å besøke våre sponsorsider.",
+  "appbackend#state-connected-reminder-body-2": "Behold Psiphon gratis ved å besøke våre sponsorsider.",
+  "appbackend#minimized-to-systray-title": "Psiphon har blitt minimert til varslingsområdet",
+  "appbackend#minimized-to-systray-body": "Klikk ikonet for å gjenopprette programmet",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 time",
+  "psicash#1-day": "1 dag",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Sponset av"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["nl"].translation = {
+  "banner#long-connecting": "<strong>Oh nee!</strong> Je lijkt moeite te hebben met verbinden!<br>\nDownload de laatste versie van Psiphon van de <a class=\"NewVersionURL\" href=\"#\">download site</a>\nof stuur een email naar <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Verbinden",
+  "nav#connection#connected": "Verbonden",
+  "nav#connection#stopping": "Verbreek",
+  "nav#connection#stopped": "Verbroken",
+  "nav#settings": "Instellingen",
+  "nav#feedback": "Feedback",
+  "nav#logs": "Logbestanden",
+  "nav#about": "Over",
+  "connection#starting-msg": "Psiphon is aan het <span class=\"state-word\">verbinden</span>…",
+  "connection#stop-btn": "Stop",
+  "connection#connected-msg": "Psiphon is <span class=\"state-word\">verbonden</span>",
+  "connection#disconnect-btn": "Verbreek",
+  "connection#stopping-msg": "Psiphon is aan het <span class=\"state-word\">verbreken</span>…",
+  "connection#wait-btn": "Wacht A.u.b.",
+  "connection#stopped-msg": "Psiphon is <span class=\"state-word\">verbroken</span>",
+  "connection#connect-btn": "Verbind",
+  "connection#egress-region-combo-label": "Selecteer een server regio",
+  "settings#error-alert": "<strong>Fout!</strong> A.u.b Corrigeer onjuiste waarden alvorens verder te gaan.",
+  "settings#reset-button": "Standaardinstellingen",
+  "settings#apply-button": "Wijzigingen Toepassen",
+  "settings#unapplied-changes-prompt#title": "Instellingen Gewijzigd",
+  "settings#unapplied-changes-prompt#body": "Je hebt wijzigingen aangebracht in de instellingen, maar je hebt niet de veranderingen toegepast.<br><br>Wilt u uw wijzigingen nu toepassen of afwijzen?",
+  "settings#unapplied-changes-prompt#apply-button": "Toepassen",
+  "settings#unapplied-changes-prompt#discard-button": "Afwijzen",
+  "settings#vpn-incompatible-msg": "(Werkt niet met L2TP/IPSec mode.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Split Tunnel",
+  "settings#split-tunnel#help-text": "Indien ingeschakeld, worden verzoeken aan servers in uw thuisland niet getunneld via Psiphon.",
+  "settings#split-tunnel#reason": "Websites in uw thuisland zijn over het algemeen niet geblokkeerd, dus als u deze optie inschakelt, krijgt u sneller toegang tot die sites en kunt u soms de kosten voor ISP-gegevensgebruik verlagen.",
+  "settings#split-tunnel#enable-label": "Geen proxy websites in uw land",
+  "settings#disable-timeouts#heading": "Uitschakelen Time-outs Voor Trage Netwerken",
+  "settings#disable-timeouts#help-text": "Indien ingeschakeld, de communicatie met de Psiphon server geen time-out.",
+  "settings#disable-timeouts#reason": "Als u dit inschakelt voor een zeer trage netwerkverbinding, is de kans kleiner dat u onverwachte verbroken verbindingen ervaart.",
+  "settings#disable-timeouts#enable-label": "Uitschakelen time-outs voor trage netwerken",
+  "settings#egress-region#heading": "Psiphon Regio Server",
+  "settings#egress-region#select-best-performance": "Beste Prestaties",
+  "settings#egress-region#select-us": "Verenigde Staten",
+  "settings#egress-region#select-ca": "Canada",
+  "settings#egress-region#select-gb": "Verenigd Koningkrijk",
+  "settings#egress-region#select-jp": "Japan",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovakije",
+  "settings#egress-region#select-nl": "Nederland",
+  "settings#egress-region#select-de": "Duitsland",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Spanje",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Oostenrijk",
+  "settings#egress-region#select-be": "Belgie",
+  "settings#egress-region#select-bg": "Bulgarije",
+  "settings#egress-region#select-ch": "Zwitserland",
+  "settings#egress-region#select-cz": "Tsjechische Republiek",
+  "settings#egress-region#select-dk": "Denemarken",
+  "settings#egress-region#select-fr": "Frankrijk",
+  "settings#egress-region#select-hu": "Hongarije",
+  "settings#egress-region#select-it": "Italië",
+  "settings#egress-region#select-no": "Noorwegen",
+  "settings#egress-region#select-ro": "Roemenië",
+  "settings#egress-region#select-se": "Zweden",
+  "settings#egress-region#select-pl": "Polen",
+  "settings#egress-region#select-rs": "Servië",
+  "settings#egress-region#select-au": "Australië",
+  "settings#egress-region#description": "Psiphon heeft servers in veel verschillende landen en regio's. Het gebruik van een Psiphon-server in een regio dicht bij uw thuisland levert over het algemeen een betere netwerkverbinding op, maar u wilt wellicht toegang krijgen tot websites en services alsof u zich virtueel in een bepaald land of regio bevindt.",
+  "settings#egress-region#default": "Door de standaardoptie <strong>\"Beste prestaties\"</strong> te kiezen, kan Psiphon automatisch een server kiezen, wat doorgaans resulteert in de beste netwerkverbinding.",
+  "settings#egress-region#invalid-error-msg": "Kies een geldige Psiphon regio server.",
+  "settings#egress-region#error-modal-title": "Regio Server Niet Beschikbaar",
+  "settings#egress-region#error-modal-body-http": "Je hebt Psiphon geconfigureerd om een server in een specifieke regio te gebruiken.<br>\nDie regio is echter niet meer beschikbaar.<br>\nU moet een nieuwe regio kiezen of overschakelen naar de standaardkeuze \"Beste prestaties\".",
+  "settings#local-proxy-ports#heading": "Lokale Proxy Poorten",
+  "settings#local-proxy-ports#leave-blank": "Laat <strong>leeg</strong> voor automatische poort selectie (aanbevolen).",
+  "settings#local-proxy-ports#reason": "Als u hulpmiddelen gebruik op uw computer die handmatige configuratie nodig hebben om te werken met Psiphon, wil je dat Psiphon op hetzelfde lokale poortnummers gebruik gaat maken. Als je niet heb’t een reden om poortnummers op te geven, u moet Psiphon toestaan om ze automatisch te laten kiezen om conflicten te vermijden.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Moet zijn tussen 1 en 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Lokale poorten moeten worden onderscheiden van elkaar.",
+  "settings#local-proxy-ports#error-modal-title": "Lokale Proxy Poort Conflict",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nJe hebt Psiphon geconfigureerd om een specifieke lokale poort te gebruiken voor zijn HTTP proxy.<br>\nEchter, die poort blijkt al in gebruik te zijn en Psiphon kan die niet gebruiken.\n</p>\n<p>\nA.u.b verander de geconfigureerde HTTP proxy-poort waarde en probeer het opnieuw. Wij raden u aan de waarde te wissen, zodat Psiphon automatisch een beschikbare poort kan halen.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nJe hebt Psiphon geconfigureerd om een specifieke lokale poort te gebruiken voor zijn SOCKS proxy.<br>\nEchter, Blijkt dat de poort al in gebruik is en Psiphon  kan die niet gebruiken.\n</p>\n<p>\nA.u.b verander de geconfigureerde SOCKS proxy-poort waarde en probeer het opnieuw. Wij raden u aan de waarde te wissen, zodat Psiphon automatisch een beschikbare poort kan halen.\n</p>",
+  "settings#upstream-proxy#heading": "Upstream Proxy",
+  "settings#upstream-proxy#by-default": "Als jouw computer al een proxy geconfigureerd heeft, standaard zal Psiphon dat proxy gebruiken bij het vaststellen van een tunnel. Jij kan overschrijven dat gedrag door specificeren van een proxy te gebruiken, of specificeren dat een dergelijke “upstream proxy” zal worden gebruikt.",
+  "settings#upstream-proxy#reason": "Upstream proxies zijn soms nodig door scholen, universiteiten of bedrijven. Als uw provider u upstream proxy-instellingen heeft gegeven, kan ze vervolgens handmatig instellen om van hier verbinden te maken.",
+  "settings#upstream-proxy#proxy-reqs": "Alleen HTTP proxy's die HTTPS ondersteunen, worden toegestaan.",
+  "settings#upstream-proxy#hostname-label": "Hostnaam",
+  "settings#upstream-proxy#port-label": "Poort",
+  "settings#upstream-proxy#username-label": "Gebruikersnaam",
+  "settings#upstream-proxy#password-label": "Paswoord ",
+  "settings#upstream-proxy#domain-label": "Domein",
+  "settings#upstream-proxy#skip-label": "Gebruik geen upstream proxy",
+  "settings#upstream-proxy#set-hostname-error-msg": "U moet een hostnaam opgeven of alle velden voor de upstream-proxy leeg laten voor automatische selectie.",
+  "settings#upstream-proxy#set-username-error-msg": "U moet een gebruikersnaam opgeven als u een wachtwoord of domein instelt; of laat alle authenticatievelden leeg voor geen authenticatie.",
+  "settings#upstream-proxy#error-modal-title": "Upstream Proxy Fout",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon is momenteel zo geconfigureerd om uw systeem proxy gebruiken als “upstream proxy”.<br>\nEchter, Lijken we niet in staat te zijn om verbinding te maken met een Psiphon server via die proxyo.<br>\nA.u.b. Inschakelen “Gebruik geen upstream proxy” en probeer opnieuw.",
+  "settings#upstream-proxy#error-modal-body-configured": "Je hebt Psiphon geconfigureert voor een “upstream proxy”.<br>\nEchter we lijken niet in staat om verbinding te maken met een Psiphon server via die proxy.<br>\nA.u.b. Corrigeer de instellingen en probeer het opnieuw.",
+  "settings#transport-mode#heading": "Transport mode",
+  "settings#transport-mode#check-label": "Gebruik L2TP/IPSec mode",
+  "settings#transport-mode#help-text": "Gebruik Windows L2TP/IPSec virtual netwerken. Deze mode wil tunnel al je apps, maar het nie’t leveren van obfuscatie en heeft geen krachtig censuur omzeilings mogelijkheden. Het is <strong>niet aanbevolen</strong> voor het omzeilen van de meeste firewalls.",
+  "settings#systray-minimize#heading": "Minimaliseren naar de plaats (Systeemvak)",
+  "settings#systray-minimize#help-text": "Indien ingeschakeld, als deze is geminimaliseerd de toepassing venster Psiphon zal verbergen in het systeemvak (ook bekend als “systeemvak” of “statusindicatie”, bevindt zich dichtbij de klok op uw (Windows-taakbalk).",
+  "settings#systray-minimize#reason": "Minimaliceer Psiphon naar de plaats (“systeemvak”) bespaart ruimte op je taakbalk. Dit is vooral handig als je Psiphon gebruikt voor langere tijd.",
+  "settings#systray-minimize#enable-label": "Minimaliseren naar het systeemvak (system tray)",
+  "settings#applying-message": "Opnieuw verbinding om uw instellingen toe te passen.",
+  "settings#saved-message": "Instellingen Opslaan.",
+  "settings#error-modal#title": "Instellings Fout",
+  "settings#error-modal#body": "Er zijn fouten in de instellingen van je waarden. Gelieve te corrigeren alvorens verder te gaan.",
+  "feedback#top_content_title": "Geef Ons Je Feedback",
+  "feedback#top_para_2": "Veel problemen kunnen worden opgelost door het downloaden van de nieuwste versie. Je kan <a class=\"NewVersionURL\" href=\"#\">downloaden de laatste versie door hier te klikken</a>, of je stuurt een email naar <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "U kunt ook oplossingen voor veel voorkomende problemen in vinden onze <a class=\"FaqURL\" href=\"#\">Veel gestelde vragen</a>.",
+  "feedback#smiley_happy": "Psiphon verbindt en presteert de manier waarop ik het wil.",
+  "feedback#smiley_sad": "Pishon kan niet goed Verbinding maken of het presteren er van.",
+  "feedback#text_feedback_prompt": "Gelieve hier je probleem te plaatsen:",
+  "feedback#text_feedback_email_prompt": "Als je wil, dat wij U terug schrijven, plaats hier dan je email adres:",
+  "feedback#diagnostic_check": "Upload diagnostische gegevens. Opmerking dat de diagnosegegevens U niet zal indentificeren, maar het zal ons helpen Psiphon te verbeteren. <a class=\"DataCollectionInfoURL\" href=\"#\">Klik hier om te zien welke gegevens wij verzamelen.</a>",
+  "feedback#submit_button": "Akkoord",
+  "feedback#text_feedback_bottom_para": "Als bovenstaand formulier niet werkt, of u wilt screenshots te sturen, kunt u mailen naar <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Dank U!</strong> Je feedback is verstuurt.",
+  "logs#show-debug-label": "Toon debug logbestanden",
+  "logs#placeholder": "Geen logbestanden",
+  "language#success-message": "<strong>Hallo!</strong> Welkom bij Psiphon.",
+  "about#wordart-tag": "Voorbij de Grenzen",
+  "about#description": "Psiphon is een <strong>censors omzeilings hulpmiddel</strong> — het is ontworpen om de toegang tot het open internet te geven, langs censors en firewalls. Het is <strong>open source</strong> en ontwikkeld in Toronto, Canada.",
+  "about#visit-download-site": "Nieuwsgierig bezoek de website en <strong><a class=\"NewVersionURL\" href=\"#\">download een nieuw versie</a></strong> of naar <strong><a class=\"InfoURL\" href=\"#\">help en informatie</a></strong>. Psiphon is beschikbaar voor Android en Windows.",
+  "about#get-by-email": "<strong>Als de website ontoegankelijk is</strong>, kunt u een nieuwe versie van Psiphon krijgen door het sturen van een e-mail naar:",
+  "about#client-version": "Psiphon voor Windows klant versie:",
+  "general#modal-close-button": "Sluit",
+  "general#notice-modal-tech-preamble": "Hier is de technische fout informatie.",
+  "notice#systemproxysettings-setproxy-error-title": "Fout Systeem Proxy",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon faald om instellen de systeem’s proxy instellingen.</p>\n<p>Dit zou te wijten zijn aan een conflict met uw antivirussoftware. Je zou handmatig moeten configureren van uw toepassing of het systeem proxy-instellingen te gebruiken, de lokale Psiphon proxies.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon faald om instellen de systeem’s proxy instelingen voor de Internet verbinding genaamd “<%- data %>”. Dit zou te wijten zijn aan een conflict met uw antivirussoftware. Je zou handmatig moeten configureren van uw toepassing of het systeem proxy-instellingen te gebruiken, de lokale Psiphon proxies.",
+  "appbackend#state-stopped-title": "Psiphon is verbroken",
+  "appbackend#state-starting-title": "Psiphon is aan het verbinden",
+  "appbackend#state-starting-body": "Wacht A.u.b.",
+  "appbackend#state-connected-title": "Psiphon is verbonden",
+  "appbackend#state-connected-body": "Verkennen voorbij jouw grenzen!",
+  "appbackend#state-connected-reminder-title": "Psiphon houdt je verbonden",
+  "appbackend#state-connected-reminder-body": "Houd Psiphon gratis. Klik hier om onze sponsorpagina's te bezoeken! ",
+  "appbackend#state-connected-reminder-body-2": "Houd Psiphon gratis door onze sponsorpagina's te bezoeken! ",
+  "appbackend#minimized-to-systray-title": "Psiphon is geminimaliseerd naar het systeemvak",
+  "appbackend#minimized-to-systray-body": "Klik op het pictogram om de toepassing te herstellen",
+  "appbackend#os-unsupported": "Psiphon ondersteunt niet langer Windows XP or Vista.\nBezoek a.u.b. onze website voor meer informatie.",
+  "psicash#transaction-error-title": "PsiCash-transactiefout",
+  "psicash#transaction-error-body": "Uw PsiCash-transactiepoging is onverwacht mislukt.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash-aankoop bestaat al",
+  "psicash#transaction-ExistingTransaction-body": "U hebt een bestaande PsiCash-aankoop van dit type. Een andere aankoop van dit type is niet toegestaan totdat de vorige verloopt. Uw PsiCash-status wordt nu vernieuwd.",
+  "psicash#transaction-InsufficientBalance-title": "Onvoldoende PsiCash-saldo",
+  "psicash#transaction-InsufficientBalance-body": "U hebt niet voldoende PsiCash-saldo voor deze aankoop.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash-aankoopprijs komt niet overeen",
+  "psicash#transaction-TransactionAmountMismatch-body": "De aankoopprijzen van PsiCash zijn verouderd. Uw PsiCash staat zal nu worden vernieuwd.",
+  "psicash#transaction-TransactionTypeNotFound-title": "Aankooptype PsiCash niet gevonden",
+  "psicash#transaction-TransactionTypeNotFound-body": "Het product dat u probeert te kopen bestaat niet meer. Mogelijk moet u de toepassing bijwerken of opnieuw installeren.",
+  "psicash#transaction-InvalidTokens-title": "Ongeldige PsiCash-tokens",
+  "psicash#transaction-InvalidTokens-body": "Uw PsiCash-tokens zijn ongeldig. Probeer de toepassing opnieuw te starten. Als dat niet werkt, moet u uw <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">lokale opslag wissen</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash-serverfout",
+  "psicash#transaction-ServerError-body": "De PsiCash-server reageerde met een fout tijdens een poging om de aankoop te doen. Probeer uw aankoop later opnieuw.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost actief voor %s",
+  "psicash#ui-zerobalance-title": "Snelheid nodig&nbsp;Boost?",
+  "psicash#ui-buypsi": "Koop PsiCash",
+  "psicash#ui-buymorepsi": "Koop meer PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Nodig voor Snelheid&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Snelheid&nbsp;Boost",
+  "psicash#1-hour": "1 uur",
+  "psicash#1-day": "1 dag",
+  "psicash#ui-buyingboost-buttontext": "Starten Snelheid&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon-verbinding vereist",
+  "psicash#mustconnect-modal#body": "Om PsiCash te gebruiken, moet u verbonden zijn met het Psiphon-netwerk.",
+  "psicash#init-error-title": "PsiCash-initialisatiefout",
+  "psicash#init-error-body-unrecovered": "PsiCash kan niet worden geïnitialiseerd. Dit komt waarschijnlijk door een probleem met het bestandssysteem, zoals onvoldoende schijfruimte. Je saldo en andere status zijn verloren. PsiCash zal niet bruikbaar zijn. U kunt proberen de toepassing opnieuw te starten om het probleem te verhelpen.",
+  "psicash#init-error-body-recovered": "PsiCash kan niet worden geïnitialiseerd. Dit komt waarschijnlijk door een probleem met het bestandssysteem, zoals onvoldoende schijfruimte. Uw saldo en andere status zijn gereset.",
+  "psicash#psiphon-speed": "Psiphon<br>snelheid",
+  "notice#disallowed-traffic-alert-title": "Upgrade uw Psiphon-verbinding ",
+  "notice#disallowed-traffic-alert-body": "<p>Apps werken niet?</p>\n<p>Sommig internetverkeer wordt niet ondersteund zonder een actieve Speed Boost. Activeer Speed Boost met PsiCash om het volledige potentieel van uw Psiphon-ervaring te ontgrendelen.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps werken niet?",
+  "appbackend#disallowed-traffic-notification-body": "Activeer Speed Boost om het volledige potentieel van de Psiphon-ervaring te ontgrendelen.",
+  "settings#disallowed-traffic-alert#heading": "Niet toegestaan dataverkeer Waarschuwing",
+  "settings#disallowed-traffic-alert#help-text": "Sommige soorten internetverkeer worden niet ondersteund zonder een actieve Speed Boost. Als dergelijk verkeer niet is toegestaan, wordt er een waarschuwing weergegeven. (Voor het opnieuw inschakelen is een nieuwe verbinding vereist.)",
+  "settings#disallowed-traffic-alert#disable-label": "Uitschakelen niet toegestaan dataverkeer waarschuwingen",
+  "banner#sponsored-by": "Gesponsord door"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["om"].translation = {
+  "banner#long-connecting": "<strong>Ohoo, miti!</strong> Wal qabsiisuu didee rakkataa waan jirtu fakkaata!<br>\n Psiphon gosa haaraa asii gad fe'adhu <a class=\"NewVersionURL\" href=\"#\">Iddoo gad-fe'insaa</a>\n  yookiin as irratti imeelii erguudhaan <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Wal qabsiisaa jira",
+  "nav#connection#connected": "Wal qabsiifameera",
+  "nav#connection#stopping": "Addaan kutaa jira",
+  "nav#connection#stopped": "Addaan cite",
+  "nav#settings": "Qindeessawwan ",
+  "nav#feedback": "Yaada",
+  "nav#logs": "Galmeelee",
+  "nav#about": "Waa'ee",
+  "connection#starting-msg": "Psiphon’niin <span class=\"state-word\">connecting</span>dha…",
+  "connection#stop-btn": "Dhaabi",
+  "connection#connected-msg": "Psiphon’niin <span class=\"state-word\">connected</span>dha",
+  "connection#disconnect-btn": "Addaan kuti",
+  "connection#stopping-msg": "Psiphon’niin <span class=\"state-word\">disconnecting</span>…",
+  "connection#wait-btn": "Maaloo eegaa...",
+  "connection#stopped-msg": "Psiphon’niin <span class=\"state-word\">disconnected</span>",
+  "connection#connect-btn": "Wal qabsiisii",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Dogoggora!</strong> Maaloo itti fufuun dura wanna dogoggoraa furi.",
+  "settings#reset-button": "Iddoo duraatii deebisii",
+  "settings#apply-button": "Jijjiirama jiru hojii irra oolchi",
+  "settings#unapplied-changes-prompt#title": "Qindeessaawwan jijjiirameera",
+  "settings#unapplied-changes-prompt#body": "Qindeessaawwan kee jijjiirteetta, garuu jijjiirama sana hojii irra hin oolchine.<br><br>Jijjiirama kee amma hojii irra oolchuu feeta moo yookiin haquu feeta?",
+  "settings#unapplied-changes-prompt#apply-button": "Hojii irra oolchi",
+  "settings#unapplied-changes-prompt#discard-button": "Balleessi",
+  "settings#vpn-incompatible-msg": "(L2TP/IPsec mooddiitiin hin hojjetu.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Dabarsituu addaan qoodi",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Weebsaayitiiwwan biyya keessan keessaa karaa bakka bu'aa hin gargaaramin",
+  "settings#disable-timeouts#heading": "Neetwoorkii suuta jedhuuf boqodhu kan jedhu akka hin hojjenne ajaji",
+  "settings#disable-timeouts#help-text": "Yoo si’eeffame, quunnamtiin serverii Psiphon waliin jiru yeroon itti hin dhumu.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Neetwoorkii boodatti hafaan akka adda hin cinne dhorki",
+  "settings#egress-region#heading": "Naannawa Serverii Psiphon",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "Yuunayitid Isteetis",
+  "settings#egress-region#select-ca": "Kanaadaa",
+  "settings#egress-region#select-gb": "Engilizii",
+  "settings#egress-region#select-jp": "Jaappaan",
+  "settings#egress-region#select-sg": "Siingaapoor",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Nezerlaand",
+  "settings#egress-region#select-de": "Jarman",
+  "settings#egress-region#select-in": "Hindii",
+  "settings#egress-region#select-es": "Ispeen",
+  "settings#egress-region#select-hk": "Hoong Koong",
+  "settings#egress-region#select-at": "Ostriyaa",
+  "settings#egress-region#select-be": "Beljiyeem",
+  "settings#egress-region#select-bg": "Bulgaariyaa",
+  "settings#egress-region#select-ch": "Iswiizerlaand",
+  "settings#egress-region#select-cz": "Cheek Ripaabilikii",
+  "settings#egress-region#select-dk": "Deenmaark",
+  "settings#egress-region#select-fr": "Faransaay",
+  "settings#egress-region#select-hu": "Hangaarii",
+  "settings#egress-region#select-it": "Xaaliyaanii",
+  "settings#egress-region#select-no": "Noorweey",
+  "settings#egress-region#select-ro": "Roomaaniya",
+  "settings#egress-region#select-se": "Iswidini",
+  "settings#egress-region#select-pl": "Polaand",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Serverii naannoo sirrii ta'e kan Psiphon filadhaa.",
+  "settings#egress-region#error-modal-title": "Serveriin naannoo hin jiru",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Buufata bakka bu'aa kan naannoo",
+  "settings#local-proxy-ports#leave-blank": "Dhiisi <strong>duwwaa</strong> buufata awutomaatikii fo'achuuf (kan gorsamedha)",
+  "settings#local-proxy-ports#reason": "Kompuutera kee irratti Psiphon waliin hojjechuuf qindeessa maanwaalii meeshaalee barbaadde gargaaramta taanaan, Psiphon lakkoobsota buufata wal fakkaataa akka gargaaramu feeta. Lakkoobsota buufataa sababaa adda itti baaftu hin qabaanne taanaan, walitti bu'iinsa ittisuuf Psiphon ofii isaatii akka filatu eeyyamuu qabda.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 fi 65535 gidduu ta'uu qaba.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Buufataaleen naannoo walittii adda ta'uu qabu.",
+  "settings#local-proxy-ports#error-modal-title": "Rakkoo Buufata Bakka bu'aa Naannoo",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon bakka bu'aa HTTP isaatiif buufata naannoof adda akka gargaaramu ta'uun qopheessite.<br>\nHaa ta'u malee, buufati sun hojii irra oolee waan jiruuf Psiphon gargaaramuu hin danda’u.\n</p>\n<p>\nMaaloo bakka bu'aa HTTP qindaa'ee jiru keessa waan jiru jijjiiri, irra deebi'uun yaali. Psiphon ofii isaatii buufataalee isaa keessatti kan argaman akka filatuuf guutummaan akka balleessitugorsineerra.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon bakka bu'aa SOCKS isaatiif bakka bu'aa addaa kan buufata naannoo  akka gargaaramuuf qindeessite.<br>\nHaa ta'u malee, buufati kun hojii irra oolee waan jiruuf Psiphon gargaarmuu hin danda'u.\n</p>\n<p>\nKanaaf kan qindaa'e gatii buufata bakka bu'aa SOCKS jijjirii tii irra deebi'uun yaali. Psiphon waanneen buufata isaa keessatti argaman akka filatuuf gatii isaa guutummaatti akka haqxan isin gorsina.\n</p>",
+  "settings#upstream-proxy#heading": "Bakka bu'aa gara olii",
+  "settings#upstream-proxy#by-default": "Kompiiterri kee durumaanuu bakka bu'aa qindaa'e yoo qabaate, Psiphon isuma dura tureen bakka bu'aan sun ennaa darbuu danda'u itti gargaarama. kan akkasii bakka bu'aa addaa baastee akka gargaaramuuf amala sana  bulchuu dandeessa, yookiin “bakka bu'aa gara olii” akka kanaa akka gargaaramamuu hin dandeenye adda-baasuu dandeessa.",
+  "settings#upstream-proxy#reason": "Yeroo tokko tokko bakka bu'oonni gara olii manneen barnootaa, Yunivarsitiiwwan yookiin daldalaawwaniin ni barbaadamu. Neetwoorkii kan siif dhi’eessu qindeessawwan bakka bu'oota gara olii yoo siif kenna ta'e, wal qabsiisuuf as irratti maanuwaaliidhaan akka qindeessitu ta'uu mala.",
+  "settings#upstream-proxy#proxy-reqs": "Bakka bu'oota HTTP kanneen HTTPS deggeran qofaatu eeyyama qaba.",
+  "settings#upstream-proxy#hostname-label": "Maqaa qopheessaa",
+  "settings#upstream-proxy#port-label": "Buufata",
+  "settings#upstream-proxy#username-label": "Maqaa fayyadamaa",
+  "settings#upstream-proxy#password-label": "Darbi-jecha",
+  "settings#upstream-proxy#domain-label": "Domenii",
+  "settings#upstream-proxy#skip-label": "Bakka bu'aa gara olii hin gargaaramiin",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Dogoggora bakka bu'aa gara olii",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon yeroo ammaatti kan qindeeffame “bakka bu'a gara olii” akka gargaaramutti ta'ee ti. <br>\n Haa ta'u malee, bakka bu'aa sana gargaaramuudhaan serverii Psiphon waliin wal  qabsiisuu hin dandeenye.<br>\n Maaloo \"Bakka bu'aa gara olii hin gargaaramin\" isa jedhu si’eessi akkasumas irra-deebi’uun yaali.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon kee \"bakka bu'aa gar olii\" akka inni gargaaramu ta'ee qopheessiteetta. <br>\nHaa ta’u malee, Kara bakka bu'aa sanaa serverii Psiphon ‘tti qabsiisuu hin dandeenye.<br>\nMaaloo qindeessawwan sirreessi akkasumas irra deebi'uun yaali.",
+  "settings#transport-mode#heading": "Haala Tiraansipoortii",
+  "settings#transport-mode#check-label": "Mooddii L2TP/IPSec gargaarami",
+  "settings#transport-mode#help-text": "L2TP/IPSec windowwan neetwoorkii yaadaaf gargaarama. Haalli kun appilikeeshiniiwwan mara darbarsa, garuu waanta dhoksu hin dhiyeessu kanaaf dandeettiiwwan uggura cimaa bira darbuu hin qabu. <strong>Hin gorfamu</strong> ta’ee fayerwoliiwwan hedduu bira darbuufidha.",
+  "settings#systray-minimize#heading": "Gara bakka beeksisaatti gad xiqqeessi (Gabatee sirnaa)",
+  "settings#systray-minimize#help-text": "Yoo si’eeffame, ennaa gad xiqqaatu windoon appilikeeshinii Psiphon naannoo beeksisi jiru jala dhokata (dabalataanis \"gabatee sirnaa\" jedhamee kan beekamu yookiin \"systray\" ka jedhu keessa, kunis kan argamu taaski baarii windowu bakka sa'aatiin jiru cinaadha).",
+  "settings#systray-minimize#reason": "Psiphon naannoo beeksisi jirutti gad xiqqeessun (\"gabatee sirnaa\") taask baarii kee irratti bakka duwwaa dhiisa. Kun keessumaayyu kan gargaaru yoo Psiphon yeroo dheeraaf itti gargaaramtedha.",
+  "settings#systray-minimize#enable-label": "Gara naannoo beeksisi jiruutti gad xiqqeessi (gabatee sirnaa)",
+  "settings#applying-message": "Qindeessawwan kee hojii irra oolchuuf irra deeb'uun wal qabsiisaa jira.",
+  "settings#saved-message": "Qindeessaawwan ol kaa'amaniiru.",
+  "settings#error-modal#title": "Dogoggora qindeessaawwanii",
+  "settings#error-modal#body": "Wanneen qindeessaawwan kee keessa dogoggorawwantuu jiru. Maaloo utuu itti hin fufin isaan sirreessaa.",
+  "feedback#top_content_title": "Yaada Kee nuun ga'i",
+  "feedback#top_para_2": "Rakkoolee hedduun gulantaa haarawaa ta'e gadii buusuun sirreeffamuu ni danda'u. </a>Asitti cuqaasuun gulantaa haaraa buusuu dandeessa <a class=\"NewVersionURL\" href=\"#\">, yookiin ergaa iimeelii kanatti erguu ni dandeessa <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Akkasumas rakkoolee wal-fakkaatoo hedduuf furmaatawwan teessoo keenya kana keessaa argachuu dandeessa <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
+  "feedback#smiley_happy": "Psiphon akka fedha kiyyaatti wal-qabsiisa akkasumas dalaga",
+  "feedback#smiley_sad": "Psiphon yeroo mara wal-qabsiisuu dadhaba yookiin haala quubsaan hin dalagu.",
+  "feedback#text_feedback_prompt": "Maaloo yaada kee asitti galchi:",
+  "feedback#text_feedback_email_prompt": "Deebii akka siif kenninu yoo feete, maaloo teessoo imeelii keetii galchi:",
+  "feedback#diagnostic_check": "Odeeffannoo qorannoo ol fe'adhaa. Odeeffannoon qorannoo kun eenyummaa kee adda hin baasu, akkasumas Psiphon sirriitti akka hojjetu nu gargaara. <a class=\"DataCollectionInfoURL\" href=\"#\">Odeeffannoo sassaabnu ilaaluuf, as cuqaasi.</a>",
+  "feedback#submit_button": "Ergi",
+  "feedback#text_feedback_bottom_para": "Unki armaan olii hin hojjetaa hin jiru yoo ta'e, yookiin fakkiiwwan iskiriinii erguu yoo feete, maaloo kana irratti imeelii nuu ergi <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Galatoomi!</strong> Yaadnii kee ergamee jira .",
+  "logs#show-debug-label": "Galmeelee sirreessa dogoggoraa mul'isi",
+  "logs#placeholder": "Hanga yoonaa galmeen hin jiru",
+  "language#success-message": "<strong>Hello!</strong> Baga nagaan gara Psiphon dhufte.",
+  "about#wordart-tag": "Daangaawwan Darbee",
+  "about#description": "Psiphon’niin <strong>meeshaa ittisa ugguraa</strong> — meeshaa ittiin dhowwii interneetii darbani Interneetii banaa, senserootaa fi fayerwolii akka argachuu danda’u godhameetu tolfame. Innis <strong>burqaa-banaa</strong> ta’ee kan Torontoo, Kanaadaa keessatti tolfamedha.",
+  "about#visit-download-site": "Maaloo gosa haaraa gad buusuuf <strong><a class=\"NewVersionURL\" href=\"#\">keenya daawwadha weebsaayitii keenya doowwadhu</a></strong> yookiin <strong><a class=\"InfoURL\" href=\"#\">gargaarsaa fi odeeffannoo argachuuf</a></strong>.  Psiphon’n Android fi Windowsi ‘dhaaf ni jira.",
+  "about#get-by-email": "<strong>Weebsaayitichi kan hin argamne yoo ta'e</strong>, Psiphon gosa haaraa imeelii  teessoo kanatti erguudhaan argachuu dandeessa:",
+  "about#client-version": "Gosa Psiphon kan Wiindows maamilaaf qophaa'e:",
+  "general#modal-close-button": "Cufi",
+  "general#notice-modal-tech-preamble": "Kuni Odeeffannoo rakkoo teekinikaati:",
+  "notice#systemproxysettings-setproxy-error-title": "Dogoggora bakka bu'aa sirnaa",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon qindeessawwan bakka bu'aa sirnaa tolchuu hin dandeenye.</p>\n<p>Kun tarii walitti bu'iinsa softiweerii vaayirasii ittisuu gidduutti uumame ta'uu mala. Bakka bu'oota Psiphon kan naannoo fayyadamuuf appilikeeshinii kee  yookiin bakka bu'aa qindeessawwan kee gargaaramuuf maanuwaalii qindeessuu qabda ta’a.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon bakka bu'aa sirnaa kan komputera keessanii interneetii maqaan \"<%-data %>\" qindeessuutti hin milkoofne. Kun tarii walitti bu'iinsa softiweerii vaayirasii ittisuu gidduutti uumame ta'uu mala. Bakka bu'oota Psiphon kan naannoo fayyadamuuf appilikeeshinii kee yookiin bakka bu'aa qindeessa keessanii gargaaramuuf maanuwaaliin qindeessuu qabda ta’a. ",
+  "appbackend#state-stopped-title": "Psiphon addaan cite",
+  "appbackend#state-starting-title": "Psiphon wal qabsiisaa jira",
+  "appbackend#state-starting-body": "Maaloo eegi...",
+  "appbackend#state-connected-title": "Psiphon wal qabsiifameera",
+  "appbackend#state-connected-body": "Daangaawwan kee darbii barbaadi!",
+  "appbackend#state-connected-reminder-title": "Psiphon wal arginsaan akka turtan godha",
+  "appbackend#state-connected-reminder-body": "Psiphon tola ta'ee akka turu godhaa. Fuula Ispoonsera keenyaa daawwachuuf as cuqaasaa!",
+  "appbackend#state-connected-reminder-body-2": "Fuula Ispoonsera keenyaa daawwachuudhaan Psiphon tola ta'ee akka turu godhaa!",
+  "appbackend#minimized-to-systray-title": "Psiphon gara naannoo beeksisaatti gad xiqqaateera",
+  "appbackend#minimized-to-systray-body": "Appilikeeshinii bakkatti deebisuuf mallatticha cuqaasi",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Spoonserri"
+};
\ No newline at end of file
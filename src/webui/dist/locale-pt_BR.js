@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["pt_BR"].translation = {
+  "banner#long-connecting": "<strong>Oh não!</strong> Você parece estar tendo problemas de conexão!<br>\nBaixe a versão mais recente do Psiphon na <a class=\"NewVersionURL\" href=\"#\">página de download</a>\nou envie o programa por email para <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Conectando",
+  "nav#connection#connected": "Conectado",
+  "nav#connection#stopping": "Desconectando",
+  "nav#connection#stopped": "Desconectado",
+  "nav#settings": "Configurações",
+  "nav#feedback": "Comentários",
+  "nav#logs": "Logs",
+  "nav#about": "Sobre",
+  "connection#starting-msg": "Psiphon está <span class=\"state-word\">conectando</span>…",
+  "connection#stop-btn": "Parar",
+  "connection#connected-msg": "Psiphon está <span class=\"state-word\">conectado</span>",
+  "connection#disconnect-btn": "Desconectar",
+  "connection#stopping-msg": "Psiphon está <span class=\"state-word\">desconectando</span>…",
+  "connection#wait-btn": "Por favor aguarde...",
+  "connection#stopped-msg": "Psiphon está <span class=\"state-word\">deconectado</span>",
+  "connection#connect-btn": "Conectar",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Erro!</strong> Por favor corrija os parâmetros incorretos antes de prosseguir.",
+  "settings#reset-button": "Retornar à Configuração Padrão",
+  "settings#apply-button": "Aplicar Mudanças",
+  "settings#unapplied-changes-prompt#title": "Configurações Alteradas",
+  "settings#unapplied-changes-prompt#body": "Você alterou configurações, mas não as aplicou.\nVocê gostaria de aplicá-las ou descartá-las?",
+  "settings#unapplied-changes-prompt#apply-button": "Aplicar",
+  "settings#unapplied-changes-prompt#discard-button": "Descartar",
+  "settings#vpn-incompatible-msg": "(Não funciona no modo L2TP/IPSec.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Tunelamento de Conexões Locais",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Não fazer proxy para sites dentro do seu país",
+  "settings#disable-timeouts#heading": "Desabilitar \"Expiração de tempo\" para Redes Lentas",
+  "settings#disable-timeouts#help-text": "Se habilitado, a comunicação com o servidor Psiphon não expirará.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Desabilitar \"Expiração de tempo\" para redes lentas",
+  "settings#egress-region#heading": "Região do Servidor Psiphon",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "Estados Unidos",
+  "settings#egress-region#select-ca": "Canadá",
+  "settings#egress-region#select-gb": "Reino Unido",
+  "settings#egress-region#select-jp": "Japão",
+  "settings#egress-region#select-sg": "Singapura",
+  "settings#egress-region#select-sk": "Eslováquia",
+  "settings#egress-region#select-nl": "Holanda",
+  "settings#egress-region#select-de": "Alemanha",
+  "settings#egress-region#select-in": "Índia",
+  "settings#egress-region#select-es": "Espanha",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Áustria",
+  "settings#egress-region#select-be": "Bélgica",
+  "settings#egress-region#select-bg": "Bulgária",
+  "settings#egress-region#select-ch": "Suíça",
+  "settings#egress-region#select-cz": "República Tcheca",
+  "settings#egress-region#select-dk": "Dinamarca",
+  "settings#egress-region#select-fr": "França",
+  "settings#egress-region#select-hu": "Hungria",
+  "settings#egress-region#select-it": "Itália",
+  "settings#egress-region#select-no": "Noruega",
+  "settings#egress-region#select-ro": "Romênia",
+  "settings#egress-region#select-se": "Suécia",
+  "settings#egress-region#select-pl": "Polônia",
+  "settings#egress-region#select-rs": "Sérvia",
+  "settings#egress-region#select-au": "Austrália",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Escolha uma região de servidor Psiphon válida.",
+  "settings#egress-region#error-modal-title": "Região do Servidor Indisponível",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Portas do Proxy Local",
+  "settings#local-proxy-ports#leave-blank": "Deixe <strong>em branco</strong> para seleção automática de porta (recomendado).",
+  "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Deve ser entre 1 e 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Portas locais devem ser diferentes.",
+  "settings#local-proxy-ports#error-modal-title": "Conflito com a Porta do Proxy Local",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nVocê configurou o Psiphon para usar uma porta local específica para seu proxy HTTP.\n <br>\nNo entanto, parece que esta porta já está em uso e o Psiphon não pode usá-la.\n</p>\n<p>\nPor favor, altere o valor da porta do proxy HTTP e tente novamente. Recomendamos que deixe o valor em branco para que o Psiphon possa escolher automaticamente uma porta disponível.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nVocê configurou o Psiphon para usar uma porta local específica para seu proxy SOCKS.<br>\nNo entanto, parece que esta porta já está em uso e o Psiphon não pode usá-la.</p>\n<p>\nPor favor, altere o valor da porta do proxy SOCKS e tente novamente. Recomendamos que deixe o valor em branco para que o Psiphon possa escolher automaticamente uma porta disponível.\n</p>",
+  "settings#upstream-proxy#heading": "Servidor Proxy",
+  "settings#upstream-proxy#by-default": "Se o seu computador já tem um proxy configurado, Psiphon utilizará por padrão este quando estabelecer um túnel. Você pode sobrescrever este comportamento, especificando qual proxy deve ser utilizado.",
+  "settings#upstream-proxy#reason": "Configurações de servidor proxy normalmente são necessárias para escolas, universidades ou negócios. Se o seu provedor de rede te informou configurações de proxy, pode ser necessária configuração manual para poder conectar.",
+  "settings#upstream-proxy#proxy-reqs": "Apenas proxies HTTP que suportam HTTPS são permitidos.",
+  "settings#upstream-proxy#hostname-label": "Nome do Host",
+  "settings#upstream-proxy#port-label": "Porta",
+  "settings#upstream-proxy#username-label": "Usuário",
+  "settings#upstream-proxy#password-label": "Senha",
+  "settings#upstream-proxy#domain-label": "Domínio",
+  "settings#upstream-proxy#skip-label": "Não usar servidor proxy",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Erro do/no Servidor Proxy",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon está configurado para usar o proxy (trazido) do seu sistema como “proxy externo”.<br>\nNo entanto, não estamos conseguindo se conectar aos servidores do Psiphon através deste proxy.<br>\nAtive \"Não usar o proxy externo\" e tente novamente.",
+  "settings#upstream-proxy#error-modal-body-configured": "Você configurou o Psiphon para se conectar a outro servidor proxy.<br>\nContudo, parece impossível se conectar a ele.<br>\nPor favor corrija as configurações e tente novamente.",
+  "settings#transport-mode#heading": "Modo de Transporte",
+  "settings#transport-mode#check-label": "Usar modo L2TP/IPSec",
+  "settings#transport-mode#help-text": "Usa a rede virtual L2TP/IPSec do Windows. Este modo vai tunelar todas as suas aplicações, mas não provê obfuscação. Então não é tão forte para passar por controles e censuras. Este <strong>não é o modo recomendado</strong> para passar a maioria dos firewalls.",
+  "settings#systray-minimize#heading": "Minimizar para Área de Notificações (Bandeja do Sistema)",
+  "settings#systray-minimize#help-text": "Se habilitado, quando o Psiphon for minimizado, a janela do aplicativo irá esconder na área de notificação (também conhecido como a \"bandeja do sistema\" ou \"systray\", localizado perto do relógio em sua barra de tarefas do Windows).",
+  "settings#systray-minimize#reason": "Minimizando o Psiphon para a área de notificações (bandeja do sistema) libera espaço em sua barra de tarefas. Isso ajuda especialmente quando você roda o Psiphon por longos períodos de tempo.",
+  "settings#systray-minimize#enable-label": "Minimizar para a área de notificações (bandeja do sistema)",
+  "settings#applying-message": "Reconectando para aplicar suas configurações.",
+  "settings#saved-message": "Configurações salvas.",
+  "settings#error-modal#title": "Erro de Configurações",
+  "settings#error-modal#body": "Existem erros nos seus parâmetros de configuração. Por favor corrija antes de proceder.",
+  "feedback#top_content_title": "Deixe Seus Comentários",
+  "feedback#top_para_2": "Muitos problemas podem ser corrigidos se você baixar a última versão.. Você pode baixar a última versão clicando <a class=\"NewVersionURL\" href=\"#\">aqui</a>, ou enviando um e-mail para <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Você também pode encontrar soluções para os problemas mais comuns na nossa seção de perguntas frequentes (FAQ): <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
+  "feedback#smiley_happy": "Psiphon se conecta e desempenha da maneira que eu quero.",
+  "feedback#smiley_sad": "Psiphon frequentemente falha para conectar ou a performance não é das melhores.",
+  "feedback#text_feedback_prompt": "Por favor insira seus comentários aqui:",
+  "feedback#text_feedback_email_prompt": "Se você desejar uma resposta nossa, por favor deixe seu endereço de e-mail:",
+  "feedback#diagnostic_check": "Enviar dados para diagnósticos. Estes dados não te identificam e nos ajudará a fazer o Psiphon funcionar mais suavemente. <a class=\"DataCollectionInfoURL\" href=\"#\">Clique aqui para ver quais dados coletamos.</a>",
+  "feedback#submit_button": "Enviar",
+  "feedback#text_feedback_bottom_para": "Se o formulário acima não estiver funcionando, ou se você gostaria de enviar print de telas, por favor escreva para <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Obrigado!</strong> Seus comentários foram enviados.",
+  "logs#show-debug-label": "Mostrar logs de depuração",
+  "logs#placeholder": "Ainda sem logs",
+  "language#success-message": "<strong>Olá!</strong> Seja Bem Vindo ao Psiphon.",
+  "about#wordart-tag": "Beyond Borders",
+  "about#description": "Psiphon é uma <strong>ferramenta para contornar censura</strong> — ela é desenvolvida para prover acesso a toda Internt, ultrapassando controles. É um aplicativo de <strong>código aberto</strong> e é desenvolvida em Toronto, no Canada.",
+  "about#visit-download-site": "Por favor visite o site para <strong><a class=\"NewVersionURL\" href=\"#\">baixar uma nova versão</a></strong> ou para <strong><a class=\"InfoURL\" href=\"#\">conseguir ajuda e informações</a></strong>. Psiphon está disponível para Android e Windows.",
+  "about#get-by-email": "<strong>Se o site estiver indisponível</strong>, você pode conseguir uma nova versão do Psiphon enviando um email para:",
+  "about#client-version": "Versão do Cliente Windos do Psiphon:",
+  "general#modal-close-button": "Fechar",
+  "general#notice-modal-tech-preamble": "Aqui estão as informações técnicas do erro:",
+  "notice#systemproxysettings-setproxy-error-title": "Erro no Proxy do Sistema",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon faihou ao tentar ajustar as configurações de proxy do sistema.</p>\n<p>Isso pode ser causado por um conflito com o seu software antivírus. Pode ser necessário uma configuração manual da aplicação ou das configurações de proxy do sistema para poder utilizar o Psiphon</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon não conseguiu realizar a configuração do proxy do sistema para a conexão chamada “<%- data %>”. Isto ocorre geralmente devido a um conflito com seu antivírus. Talvez você precise configurar manualmente seu aplicativo nas configurações de proxy do sistema para usar os servidores de proxy do Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon está desconectado",
+  "appbackend#state-starting-title": "Psiphon está conectando",
+  "appbackend#state-starting-body": "Por favor aguarde...",
+  "appbackend#state-connected-title": "Psiphon está conectado",
+  "appbackend#state-connected-body": "Explore além de suas fronteiras!",
+  "appbackend#state-connected-reminder-title": "Psiphon está mantendo você conectado",
+  "appbackend#state-connected-reminder-body": "Mantenha Psiphon gratuito. Clique aqui para visitar nosso patrocinador!",
+  "appbackend#state-connected-reminder-body-2": "Mantenha Psiphon gratuito visitando nosso patrocinador!",
+  "appbackend#minimized-to-systray-title": "Psiphon foi minimizado para a área de notificações",
+  "appbackend#minimized-to-systray-body": "Clique no ícone para restaurar a aplicação",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hora",
+  "psicash#1-day": "1 dia",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Patrocinado por"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["pt_PT"].translation = {
+  "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "A ligar",
+  "nav#connection#connected": "Ligado",
+  "nav#connection#stopping": "A desligar",
+  "nav#connection#stopped": "Desligado",
+  "nav#settings": "Configurações",
+  "nav#feedback": "Comentário",
+  "nav#logs": "Registos",
+  "nav#about": "Sobre",
+  "connection#starting-msg": "Psiphon - <span class=\"state-word\">a ligar...</span>…",
+  "connection#stop-btn": "Parar",
+  "connection#connected-msg": "Psiphon - <span class=\"state-word\">Ligado</span>…",
+  "connection#disconnect-btn": "Desligar",
+  "connection#stopping-msg": "Psiphon - <span class=\"state-word\">a desligar...</span>",
+  "connection#wait-btn": "Por favor, aguarde...",
+  "connection#stopped-msg": "Psiphon - <span class=\"state-word\">Desligado</span>",
+  "connection#connect-btn": "Ligar",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Erro!</strong> Por favor, corrija os valores incorretos antes de prosseguir.",
+  "settings#reset-button": "Repor para Predefinição",
+  "settings#apply-button": "Aplicar Alterações",
+  "settings#unapplied-changes-prompt#title": "Configurações Alteradas",
+  "settings#unapplied-changes-prompt#body": "Efetuou alterações às suas configurações, mas não aplicou as mesmas.<br><br>Deseja aplicar agora as alterações ou ignorá-las?",
+  "settings#unapplied-changes-prompt#apply-button": "Aplicar",
+  "settings#unapplied-changes-prompt#discard-button": "Rejeitar",
+  "settings#vpn-incompatible-msg": "(Não funciona com o modo L2TP/IPSec)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Split Tunnel",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Não utilize proxy nos sites da Web dentro do seu país",
+  "settings#disable-timeouts#heading": "Desativar 'Expiração' para Redes Lentas",
+  "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Desativar 'expiração' para redes lentas",
+  "settings#egress-region#heading": "Região do Servidor do Psiphon",
+  "settings#egress-region#select-best-performance": "Melhor Desempenho",
+  "settings#egress-region#select-us": "Estados Unidos da América",
+  "settings#egress-region#select-ca": "Canadá",
+  "settings#egress-region#select-gb": "Reino Unido",
+  "settings#egress-region#select-jp": "Japão",
+  "settings#egress-region#select-sg": "Singapura",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Holanda",
+  "settings#egress-region#select-de": "Alemanha",
+  "settings#egress-region#select-in": "Índia",
+  "settings#egress-region#select-es": "Espanha",
+  "settings#egress-region#select-hk": "Hong-Kong",
+  "settings#egress-region#select-at": "Áustria",
+  "settings#egress-region#select-be": "Bélgica",
+  "settings#egress-region#select-bg": "Bulgária",
+  "settings#egress-region#select-ch": "Suiça",
+  "settings#egress-region#select-cz": "República Checa",
+  "settings#egress-region#select-dk": "Dinamarca",
+  "settings#egress-region#select-fr": "França",
+  "settings#egress-region#select-hu": "Hungria",
+  "settings#egress-region#select-it": "Itália",
+  "settings#egress-region#select-no": "Noruega",
+  "settings#egress-region#select-ro": "Roménia",
+  "settings#egress-region#select-se": "Suécia",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Escolha uma região de servidor Psiphon válida.",
+  "settings#egress-region#error-modal-title": "Região de Servidor Indisponível",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Portas de Proxy Locais",
+  "settings#local-proxy-ports#leave-blank": "Deixe em <strong>branco</strong> para a seleção de porta automática (recomendado).",
+  "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Deve estar entre 1 e 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "As portas locais devem ser distintas umas das outras.",
+  "settings#local-proxy-ports#error-modal-title": "Conflito de Porta Proxy Local",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+  "settings#upstream-proxy#heading": "Proxy de Upstream",
+  "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
+  "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
+  "settings#upstream-proxy#proxy-reqs": "São permitidos apenas proxies HTTP que suportem HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Nome do Hospedeiro",
+  "settings#upstream-proxy#port-label": "Porta",
+  "settings#upstream-proxy#username-label": "Nome de utilizador",
+  "settings#upstream-proxy#password-label": "Palavra-passe",
+  "settings#upstream-proxy#domain-label": "Domínio",
+  "settings#upstream-proxy#skip-label": "Não utilizar proxy de upstream",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Erro de Proxy de Upstream",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
+  "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
+  "settings#transport-mode#heading": "Modo de Transporte",
+  "settings#transport-mode#check-label": "Utilizar modo L2TP/IPSec",
+  "settings#transport-mode#help-text": "Utiliza a rede virtual do Windows L2TP/IPSec. Este modo irá passar todas as suas aplicações, mas este não fornece ofuscar e por isso não tem grandes capacidades de contornar a censura. <strong>Não é recomendado</strong> para contornar a maiorias das firewalls.",
+  "settings#systray-minimize#heading": "Minimizar para a Área de Notificação (Bandeja do Sistema)",
+  "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
+  "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
+  "settings#systray-minimize#enable-label": "Minimize para a área de notificação (bandeja do sistema)",
+  "settings#applying-message": "A religar para aplicar as suas configurações.",
+  "settings#saved-message": "Configurações guardadas.",
+  "settings#error-modal#title": "Erro de Configurações",
+  "settings#error-modal#body": "Existem erros nos valores das suas configurações. Por favor, corrija-as antes de prosseguir.",
+  "feedback#top_content_title": "Deixe-nos o Seu Comentário",
+  "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
+  "feedback#smiley_happy": "O Psiphon liga e funciona do modo que eu esperava.",
+  "feedback#smiley_sad": "O Psiphon falha muitas vezes na ligação ou não funciona suficientemente bem.",
+  "feedback#text_feedback_prompt": "Por favor, insira aqui os seus comentários:",
+  "feedback#text_feedback_email_prompt": "Se pretender obter uma resposta da nossa parte, por favor, insira o seu endereço de e-mail:",
+  "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
+  "feedback#submit_button": "Submeter",
+  "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Obrigado!</strong> O seu comentário foi enviado.",
+  "logs#show-debug-label": "Mostrar registos de depuração",
+  "logs#placeholder": "Ainda sem registos",
+  "language#success-message": "<strong>Olá!</strong> Bem-vindo ao Psiphon.",
+  "about#wordart-tag": "Além Fronteiras",
+  "about#description": "Psiphon é uma <strong>ferramenta de contornar a censura</strong> — está desenhada para dar acesso à Internet aberta, sem censuras e firewalls. É de <strong>código aberto</strong> e desenvolvido em Toronto, Canadá.",
+  "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
+  "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
+  "about#client-version": "Psiphon para Windows, versão cliente:",
+  "general#modal-close-button": "Perto",
+  "general#notice-modal-tech-preamble": "Aqui tem a informação do erro técnico:",
+  "notice#systemproxysettings-setproxy-error-title": "Erro de Proxy do Sistema",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
+  "appbackend#state-stopped-title": "Psiphon - desligado",
+  "appbackend#state-starting-title": "Psiphon - a ligar...",
+  "appbackend#state-starting-body": "Por favor, aguarde...",
+  "appbackend#state-connected-title": "Psiphon - ligado",
+  "appbackend#state-connected-body": "Explore para além das suas fronteiras!",
+  "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
+  "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+  "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+  "appbackend#minimized-to-systray-title": "Psiphon foi minimizado para a área de notificação",
+  "appbackend#minimized-to-systray-body": "Clique no ícone para restaurar a aplicação",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hora",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Patrocinado por"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ru"].translation = {
+  "banner#long-connecting": "<strong>О нет!</strong> У вас, кажется, возникли проблемы с подключением!<br>\nЗагрузите последнюю версию Psiphon с <a class=\"NewVersionURL\" href=\"#\">нашего вебсайта</a> или отправив сообщение по адресу <a class=\"NewVersionEmail\" href=\"#\"></a>. ",
+  "nav#connection#starting": "Идет соединение",
+  "nav#connection#connected": "Соединение установлено",
+  "nav#connection#stopping": "Соединение отключается",
+  "nav#connection#stopped": "Соединение отключено",
+  "nav#settings": "Настройки",
+  "nav#feedback": "Отзыв",
+  "nav#logs": "Логи",
+  "nav#about": "О приложении",
+  "connection#starting-msg": "Идет <span class=\"state-word\">соединение</span> Psiphon…",
+  "connection#stop-btn": "Стоп",
+  "connection#connected-msg": "Соединение Psiphon <span class=\"state-word\">установлено</span>",
+  "connection#disconnect-btn": "Отключить",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">отключается</span>…",
+  "connection#wait-btn": "Пожалуйста, подождите...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">отключен</span>",
+  "connection#connect-btn": "Подключить",
+  "connection#egress-region-combo-label": "Выбор региона сервера",
+  "settings#error-alert": "<strong>Ошибка!</strong> Для продолжения исправьте неверные значения.",
+  "settings#reset-button": "Восстановить настройки по умолчанию",
+  "settings#apply-button": "Применить изменения",
+  "settings#unapplied-changes-prompt#title": "Настройки изменены",
+  "settings#unapplied-changes-prompt#body": "Вы внесли изменения в настройках, но не применили изменения. <br><br>Применить изменения сейчас или отменить их?",
+  "settings#unapplied-changes-prompt#apply-button": "Применить",
+  "settings#unapplied-changes-prompt#discard-button": "Отменить изменения",
+  "settings#vpn-incompatible-msg": "(Не применимо в режиме L2TP/IPSec)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Раздельное туннелирование",
+  "settings#split-tunnel#help-text": "Если эта опция включена, обращения к серверам в границах вашей страны не будут проходить через Psiphon.",
+  "settings#split-tunnel#reason": "Если веб-сайты в вашей стране не блокируются, включите эту опцию и получите более быстрый доступ к таким сайтам. Иногда это может снизить затраты на пользование интернетом.",
+  "settings#split-tunnel#enable-label": "Не использовать прокси для вебсайтов в вашей стране",
+  "settings#disable-timeouts#heading": "Отключение лимита времени соединения для медленных сетей",
+  "settings#disable-timeouts#help-text": "При включении этой настройки связь с сервером Psiphon не разъединится.",
+  "settings#disable-timeouts#reason": "Если включить эту опцию для очень медленных сетевых подключений, разрывы соединения будут случаться реже.",
+  "settings#disable-timeouts#enable-label": "Отключение лимита времени соединения для медленных сетей",
+  "settings#egress-region#heading": "Регион сервера Psiphon",
+  "settings#egress-region#select-best-performance": "Лучшая производительность",
+  "settings#egress-region#select-us": "США",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Великобритания",
+  "settings#egress-region#select-jp": "Япония",
+  "settings#egress-region#select-sg": "Сингапур",
+  "settings#egress-region#select-sk": "Словакия",
+  "settings#egress-region#select-nl": "Нидерланды",
+  "settings#egress-region#select-de": "Германия",
+  "settings#egress-region#select-in": "Индия",
+  "settings#egress-region#select-es": "Испания",
+  "settings#egress-region#select-hk": "Гонконг",
+  "settings#egress-region#select-at": "Австрия",
+  "settings#egress-region#select-be": "Бельгия",
+  "settings#egress-region#select-bg": "Болгария",
+  "settings#egress-region#select-ch": "Швейцария",
+  "settings#egress-region#select-cz": "Чешская Республика",
+  "settings#egress-region#select-dk": "Дания",
+  "settings#egress-region#select-fr": "Франция",
+  "settings#egress-region#select-hu": "Венгрия",
+  "settings#egress-region#select-it": "Италия",
+  "settings#egress-region#select-no": "Норвегия",
+  "settings#egress-region#select-ro": "Румыния",
+  "settings#egress-region#select-se": "Швеция",
+  "settings#egress-region#select-pl": "Польша",
+  "settings#egress-region#select-rs": "Сербия",
+  "settings#egress-region#select-au": "Австралия",
+  "settings#egress-region#description": "У Psiphon есть серверы в разных странах и регионах. Обычно чем ближе сервер Psiphon, тем лучше связь. С другой стороны, вам может понадобиться работать с сайтами и сервисами так, словно вы находитесь в одной стране с сервером Psiphon.",
+  "settings#egress-region#default": "Если оставить опцию <strong>“Лучшая производительность”</strong>, то Psiphon будет автоматически выбирать сервер. Это обычно повышает качество подключения к сети.",
+  "settings#egress-region#invalid-error-msg": "Выберите правильный регион сервера Psiphon",
+  "settings#egress-region#error-modal-title": "Регион сервера недоступен",
+  "settings#egress-region#error-modal-body-http": "Вы настроили Psiphon для использования сервера в конкретном регионе.<br>\nЭтот регион более недоступен.<br>\nНужно выбрать другой регион или опцию по умолчанию “Лучшая производительность”.",
+  "settings#local-proxy-ports#heading": "Порты локальных прокси",
+  "settings#local-proxy-ports#leave-blank": "Оставьте поле <strong>пустым</strong> для автоматического выбора порта (рекомендовано).",
+  "settings#local-proxy-ports#reason": "Внесите значения, если вы используете программы, требующие ручной установки для работы с локальными портами Psiphon, и хотите, чтобы значения этих портов оставались неизменными. Если номера локальных портов не имеют для вас значения, то вам следует позволить Psiphon выбрать их автоматически, чтобы избежать конфликтов.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Значение должно быть между 1 и 65535",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Локальные порты должны быть различны",
+  "settings#local-proxy-ports#error-modal-title": "Конфликт локальных портов прокси",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nВы настроили Psiphon на использование определенного локального порта для HTTP-прокси.<br>\nК сожалению, этот порт уже занят и не может быть использован.\n</p>\n<p>\nПожалуйста, используйте другое значение или оставьте поле пустым, чтобы Psiphon выбрал порт для локального HTTP-прокси автоматически.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВы настроили Psiphon на использование определенного локального порта для SOCKS прокси.<br>\nК сожалению, этот порт уже занят и не может быть использован.\n</p>\n<p>\nПожалуйста, используйте другое значение или оставьте поле пустым, чтобы Psiphon выбрал порт для локального SOCKS прокси автоматически.\n</p>",
+  "settings#upstream-proxy#heading": "Внешний прокси",
+  "settings#upstream-proxy#by-default": "Если ваша система использует прокси, то по умолчанию Psiphon будет использовать этот прокси при подключении. Вы можете определить прокси, отличный от системного, или же полностью отменить использование внешнего прокси.",
+  "settings#upstream-proxy#reason": "Использование внешних прокси иногда требуется для выхода в Интернет в школах, университетах и на предприятиях. Возможно вам понадобится установить настройки внешнего прокси вручную для успешного подключения.",
+  "settings#upstream-proxy#proxy-reqs": "Для HTTP-прокси обязательна поддержка HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Имя узла прокси",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Имя пользователя",
+  "settings#upstream-proxy#password-label": "Пароль",
+  "settings#upstream-proxy#domain-label": "Домен",
+  "settings#upstream-proxy#skip-label": "Не использовать внешний прокси",
+  "settings#upstream-proxy#set-hostname-error-msg": "Нужно указать имя хоста. Если нужен автоматический выбор, оставьте все поля внешнего прокси пустыми.",
+  "settings#upstream-proxy#set-username-error-msg": "Нужно указать имя пользователя (для пароля или домена). Если аутентификация не нужна, оставьте все поля пустыми.",
+  "settings#upstream-proxy#error-modal-title": "Ошибка внешнего прокси",
+  "settings#upstream-proxy#error-modal-body-default": "Текущие настройки Psiphon используют настройки прокси вашей системы в качестве \"внешнего прокси\".<br>\nТем не менее мы не в состоянии подключиться к серверу Psiphon через этот прокси<br>\nПожалуйста, включите опцию \"Не использовать внешний прокси\" и попробуйте снова.",
+  "settings#upstream-proxy#error-modal-body-configured": "Вы настроили Psiphon для использования \"внешнего прокси\".<br>\nТем не менее мы не в состоянии подключиться к серверу Psiphon через этот прокси<br>\nПожалуйста, исправьте настройки и попробуйте снова.",
+  "settings#transport-mode#heading": "Режим соединения",
+  "settings#transport-mode#check-label": "Использовать режим L2TP/IPSec",
+  "settings#transport-mode#help-text": "Выбор встроенного L2TP/IPSec VPN Windows. Туннелируется трафик всех приложений. Использование этого режима легко определяется и блокируется средствами цензуры. <strong>Не рекомендуется</strong> для обхода большинства блокировок.",
+  "settings#systray-minimize#heading": "Минимизировать в область уведомлений панели задач",
+  "settings#systray-minimize#help-text": "Если опция включена, при сворачивании окна приложения Psiphon будет скрываться в области уведомлений панели задач (рядом с часами на панели задач Windows).",
+  "settings#systray-minimize#reason": "Минимизация Psiphon в область уведомлений освобождает место на панели задач. Это особенно удобно, если вы часто используете  Psiphon в течение длительных периодов времени.",
+  "settings#systray-minimize#enable-label": "Минимизировать в область уведомлений панели задач",
+  "settings#applying-message": "Повторное соединение для применения настроек",
+  "settings#saved-message": "Настройки сохранены",
+  "settings#error-modal#title": "Ошибка настроек",
+  "settings#error-modal#body": "Ошибки в настройках значений. Пожалуйста, исправьте их, прежде чем продолжить.",
+  "feedback#top_content_title": "Обратная связь",
+  "feedback#top_para_2": "Большинство проблем решается загрузкой свежей версии Psiphon. Можно <a class=\"newVersionURL\" href=\"#\"> загрузить последнюю версию</a> или отправить email по адресу <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Вы также можете найти ответы на основные вопросы в наших <a class=\"FaqURL\" href=\"#\"> Часто задаваемых вопросах </a>.",
+  "feedback#smiley_happy": "Psiphon соединяется и работает так, как мне нужно",
+  "feedback#smiley_sad": "Psiphon часто не может соединиться или работает плохо",
+  "feedback#text_feedback_prompt": "Ваши комментарии:",
+  "feedback#text_feedback_email_prompt": "Укажите свой email, если хотите получить ответ:",
+  "feedback#diagnostic_check": "Отправить диагностические данные. Они не содержат идентифицирующей информации и помогают нам делать Psiphon лучше. <a class=\"DataCollectionInfoURL\" href=\"#\">Подробнее о том, какие данные мы собираем.</a>",
+  "feedback#submit_button": " Отправить",
+  "feedback#text_feedback_bottom_para": "Если форма вверху не работает или вы хотите прислать нам скриншоты, пожалуйста, напишите на <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Спасибо!</strong> Ваш отзыв отправлен.",
+  "logs#show-debug-label": "Показать логи отладки",
+  "logs#placeholder": "Журналов пока нет",
+  "language#success-message": "<strong>Здравствуйте!</strong> Добро пожаловать в Psiphon.",
+  "about#wordart-tag": "Без Границ",
+  "about#description": "Psiphon – инструмент обхода цензуры</strong>, предназначенный для доступа к интернету без границ, минуя блокировки. У Psiphon <strong>открытый исходный код</strong>. Разработчики находятся в Торонто (Канада).",
+  "about#visit-download-site": "На нашем сайте можно <strong><a class=\"NewVersionURL\" href=\"#\">скачать свежую версию</a></strong> и <strong><a class=\"InfoURL\" href=\"#\">получить помощь и информацию</a></strong>. Psiphon доступен для Android и Windows.",
+  "about#get-by-email": "<strong>Если сайт недоступен</strong>, можно получить новую версию Psiphon по email. Отправьте письмо по адресу: ",
+  "about#client-version": "Версия клиента Psiphon для Windows:",
+  "general#modal-close-button": "Закрыть",
+  "general#notice-modal-tech-preamble": "Техническая информация об ошибке:",
+  "notice#systemproxysettings-setproxy-error-title": "Ошибка системного прокси",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не удалось установить настройки системного прокси</p>.  \n<p>Это могло произойти из-за конфликта с антивирусным программным обеспечением. Возможно, вам потребуется вручную настроить приложения или системный прокси для использования локальных прокси Psiphon.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon не удалось установить настройки системного прокси для интернет-соединения “<%- data %>”.  Это могло произойти из-за конфликта с антивирусным программным обеспечением. Возможно, вам потребуется вручную настроить приложения или системный прокси для использования локальных прокси Psiphon.",
+  "appbackend#state-stopped-title": "Соединение Psiphon отключено",
+  "appbackend#state-starting-title": "Устанавливается соединение Psiphon",
+  "appbackend#state-starting-body": "Пожалуйста, подождите...",
+  "appbackend#state-connected-title": "Соединение Psiphon установлено",
+  "appbackend#state-connected-body": "Исследуйте за пределами ваших границ!",
+  "appbackend#state-connected-reminder-title": "С Psiphon вы всегда будете на связи",
+  "appbackend#state-connected-reminder-body": "Поддержите бесплатное использование Psiphon. Нажмите здесь для посещения веб-страницы нашего спонсора!",
+  "appbackend#state-connected-reminder-body-2": "Поддержите бесплатное использование Psiphon, посетив веб-страницу нашего спонсора!",
+  "appbackend#minimized-to-systray-title": "Psiphon минимизирован в область уведомлений панели задач",
+  "appbackend#minimized-to-systray-body": "Нажмите на иконку, чтобы развернуть приложение",
+  "appbackend#os-unsupported": "Psiphon больше не поддерживает Windows XP и Vista.\nПодробнее можно прочесть на нашем сайте.",
+  "psicash#transaction-error-title": "Ошибка транзакции PsiCash",
+  "psicash#transaction-error-body": "Ваша транзакция PsiCash почему-то прервалась.",
+  "psicash#transaction-ExistingTransaction-title": "Покупка PsiCash уже существует",
+  "psicash#transaction-ExistingTransaction-body": "У вас уже есть покупка PsiCash этого типа. Другая покупка такого же типа невозможна, пока не кончится текущая. Ваш статус PsiCash сейчас будет обновлен.",
+  "psicash#transaction-InsufficientBalance-title": "Слишком низкий баланс PsiCash",
+  "psicash#transaction-InsufficientBalance-body": "Для этой покупки у вас недостаточно средств PsiCash.",
+  "psicash#transaction-TransactionAmountMismatch-title": "Ошибка цены покупки PsiCash",
+  "psicash#transaction-TransactionAmountMismatch-body": "Стоимость покупки PsiCash изменилась. Ваш статус PsiCash будет обновлен.",
+  "psicash#transaction-TransactionTypeNotFound-title": "Тип покупки PsiCash не определен",
+  "psicash#transaction-TransactionTypeNotFound-body": "Желаемый продукт более не доступен. Возможно, понадобится обновить или переустановить приложение.",
+  "psicash#transaction-InvalidTokens-title": "Ошибка токенов PsiCash",
+  "psicash#transaction-InvalidTokens-body": "Ошибка ваших токенов PsiCash. Попробуйте перезагрузить приложение. Если не поможет, возможно, вам придется очистить  <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">локальное хранилище файлов </a>.",
+  "psicash#transaction-ServerError-title": "Ошибка сервера PsiCash",
+  "psicash#transaction-ServerError-body": "Во время покупки сервер PsiCash сообщил об ошибке. Пожалуйста, попробуйте сделать покупку позже. ",
+  "psicash#ui-speedboost-active": "Турбоскорость активна: %s",
+  "psicash#ui-zerobalance-title": "Нужна Турбоскорость?",
+  "psicash#ui-buypsi": "Купить PsiCash",
+  "psicash#ui-buymorepsi": "Купить еще PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Нужно для Турбоскорости",
+  "psicash#ui-enoughbalance-buttontext": "Запуск Турбоскорости",
+  "psicash#1-hour": "1 час",
+  "psicash#1-day": "1 день",
+  "psicash#ui-buyingboost-buttontext": "Запуск Турбоскорости!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Требуется соединение Psiphon",
+  "psicash#mustconnect-modal#body": "Чтобы использовать PsiCash, нужно подключиться к сети Psiphon.",
+  "psicash#init-error-title": "Ошибка инициализации PsiCash",
+  "psicash#init-error-body-unrecovered": "Ошибка инициализации PsiCash. Возможно, дело в файловой системе, например, нехватке дискового пространства. Ваш баланс и прочие показатели сброшены. Использовать PsiCash нельзя. Можете перезапустить приложение, чтобы решить проблему.",
+  "psicash#init-error-body-recovered": "Ошибка инициализации PsiCash. Возможно, дело в файловой системе, например, нехватке дискового пространства. Ваш баланс и прочие показатели сброшены.",
+  "psicash#psiphon-speed": "Скорость<br>Psiphon",
+  "notice#disallowed-traffic-alert-title": "Обновить ваше соединение Psiphon",
+  "notice#disallowed-traffic-alert-body": "<p>Приложения не работают?</p>\n<p>Некоторые типы интернет-трафика не поддерживаются без включенной опции Турбоскорость. Активируйте Турбоскорость при помощи PsiCash и оцените все возможности Psiphon.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Приложения не работают?",
+  "appbackend#disallowed-traffic-notification-body": "Активируйте опцию Турбоскорость, чтобы оценить все возможности Psiphon.",
+  "settings#disallowed-traffic-alert#heading": "Предупреждение о неподдерживаемом трафике",
+  "settings#disallowed-traffic-alert#help-text": "Некоторые типы интернет-трафика не поддерживаются без включенной опции Турбоскорость. Если такой трафик не поддерживается, вы увидите предупреждение. (Чтобы продолжить, придется подключиться снова).",
+  "settings#disallowed-traffic-alert#disable-label": "Отключить предупреждения о неподдерживаемом трафике",
+  "banner#sponsored-by": "При поддержке"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["sw"].translation = {
+  "banner#long-connecting": "<strong>Oh hapana!</strong>Unaonekana kua na shida ya mtandao!<br>\nPakua toleo la hivi karibuni la Psiphon kutoka kwa <a class=\"NewVersionURL\" href=\"#\">pakua tovuti</a>\n au kwa kutuma barua pepe kwenda <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Kuunganisha",
+  "nav#connection#connected": "Kushikamana",
+  "nav#connection#stopping": "Kutokuunganisha",
+  "nav#connection#stopped": "Tenganisha",
+  "nav#settings": "Mipangilio",
+  "nav#feedback": "Mrejesho",
+  "nav#logs": "Ingia",
+  "nav#about": "Kuhusu",
+  "connection#starting-msg": "Psiphon ni <span class=\"state-word\">kuunganisha</span>...",
+  "connection#stop-btn": "Simama",
+  "connection#connected-msg": "Psiphon ni <span class=\"state-word\">imeunganishwa</span>",
+  "connection#disconnect-btn": "Haijaunganishwa",
+  "connection#stopping-msg": "Psiphon ni <span class=\"state-word\"> Haijaunganishwa</span>...",
+  "connection#wait-btn": "Tfadhali subiri...",
+  "connection#stopped-msg": "Psiphon ni <span class=\"state-word\">haijaunganishwa</span>",
+  "connection#connect-btn": "Unganisha",
+  "connection#egress-region-combo-label": "Chagua eneo la seva",
+  "settings#error-alert": "<strong>Kosa! tafadhali rekebisha thamani kabla isiyosahihi kabla ya kuendelea.",
+  "settings#reset-button": "Kuweka upya kwa chaguo msingi",
+  "settings#apply-button": "Kuomba mabadiliko",
+  "settings#unapplied-changes-prompt#title": "Kuweka mabadiliko",
+  "settings#unapplied-changes-prompt#body": "Umefanya mabadiliko kwa mpangilio wako,lakini haujaomba mabadiliko.<br><br> unamatumaini ya kuomba mabadiliko sasa au waachie?",
+  "settings#unapplied-changes-prompt#apply-button": "Kuomba",
+  "settings#unapplied-changes-prompt#discard-button": "Kuacha",
+  "settings#vpn-incompatible-msg": "(Haifanyikazi na L2TP/IPMara mbili.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "kugawa kwa Tunnel",
+  "settings#split-tunnel#help-text": "Kama ikiwezesha, fanya maombi kwa seva kwenye nyumba ya nchi yako haitakua tunnel kupitia Psiphon.",
+  "settings#split-tunnel#reason": "Tovuti katika nyumba ya nchi yako kwa ujumla haita zuiwa, kwahiyo chaguo hili litakufanya ufikie kwa haraka katika tovuti hizo na muda mwingine inaeza  kupunguza gharama za utumiaji wa ISP data.",
+  "settings#split-tunnel#enable-label": "Usi proxy tovuti ndani ya nchi yako",
+  "settings#disable-timeouts#heading": "Kulemaza mwisho wa muda kwa mitandao ya chini",
+  "settings#disable-timeouts#help-text": "Kama ikiwezesha, wasiliana na Psiphon seva hautamaliza muda.",
+  "settings#disable-timeouts#reason": "Wakati unawezesha hii kwa kuunganisha mtandao wa chini sana, unauwezekano mdogo wa kupata uzoefu wa uunganisho usiotarajiwa.",
+  "settings#disable-timeouts#enable-label": "Lemaza umalizikaji wa mtandao polepole",
+  "settings#egress-region#heading": "Maeneo ya Psiphon Seva",
+  "settings#egress-region#select-best-performance": "Utendaji Mzuri",
+  "settings#egress-region#select-us": "Umoja",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Umoja uingereza",
+  "settings#egress-region#select-jp": "Japani",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Netherlands",
+  "settings#egress-region#select-de": "Ujerumani",
+  "settings#egress-region#select-in": "India",
+  "settings#egress-region#select-es": "Hispania",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Austria",
+  "settings#egress-region#select-be": "Ubelgiji",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Switzerland",
+  "settings#egress-region#select-cz": "Czech Republic",
+  "settings#egress-region#select-dk": "Denmark",
+  "settings#egress-region#select-fr": "Ufaransa",
+  "settings#egress-region#select-hu": "Hungary",
+  "settings#egress-region#select-it": "Italia",
+  "settings#egress-region#select-no": "Norway",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Uswisi",
+  "settings#egress-region#select-pl": "Polandi",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon ina seva katika nchi nyingi tofauti tofauti na maeneo. Tumia Psiphon seva kwenye mkoa uliofungwa kwenye nchi ya nyuba yako kwa ujumla itatoamunganiko mzuri wa mtandao, lakini tumaini kufikia tovuti na huduma kama ukiwa karibu kwenye nchi maalumu au mkoa.",
+  "settings#egress-region#default": "Chagua chaguo msingi <strong>\"Utendaji Mzuri\"</strong> ruhusu chaguo la Psiphonn kiautomatiki chaguaseva, ambayo kwa ujumla matokeo mazuri ya kuunganishwa kwa mtandao.",
+  "settings#egress-region#invalid-error-msg": "Chagua eneo la seva halali la Psiphon.",
+  "settings#egress-region#error-modal-title": "Eneo la seva halipatikani",
+  "settings#egress-region#error-modal-body-http": "Umesadini Psiphon kwa kutumia seva kwenye mkoa maalumu.<br>\nHataivyo, mkoa huo haipatikani tena.<br>\nUnatakiwa kuchagua mkoa mpya au badili kwenye chaguo-msingi \"Utendaji Mzuri\" chaguo.",
+  "settings#local-proxy-ports#heading": "Vituo vya proxy ya ndani.",
+  "settings#local-proxy-ports#leave-blank": "Toka 1wazi1 kwa chaguo la kituo kiautomati (imependekezwa).",
+  "settings#local-proxy-ports#reason": "Kama unatumia zana kwenye kompyuta yako amabayo inahitaji usanidi kikuli kufanya kazi na Psiphon, utahitaji Psiphon kutumia kila mara namba zilezile za eneo la kituo. Kama hauna sababu ya kubainisha namba za kituo, unatakiwa kuruhusu Psiphon ichague namba hizo  kiatomati kusaidia kuepuka migogoro.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Lazima kua kati ya 1 na 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Vituo vya ndani ni lazima vitofautiane kimoja na kingine.",
+  "settings#local-proxy-ports#error-modal-title": "Mgogoro wa Proxy ya kituo cha ndani.",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nUna Psiphon iliyo sanidiwa kutumia kituo cha ndani maaulumu kwa HTTP proxy yake.<br>\nHata hivyo, kituo hicho kina onekana kuwa kimeshatumika kwahiyo Psiphon haiwezaki kutumia.\n</p>\n<p>\nTafadhali badili hadhi ya kituo cha HTTP proxy iliyosanidiwa na ujaribu tena. Tunapendekeza kuwa usafishe hadhi ili Psiphon iweze kuchukua kituo kinacho patikana kiatomati.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nUna Psiphon iliyo sanidiwa  kutumia kituo cha ndani maalumu cha SOCKS proxy.<br>\nHata hivyo, kituo kicho kinaonekana kimeshatumika hivyo Psiphon haiwezi kutumia.\n</p>\n<p>\nTafadhali badili  hadhi ya kituo cha SOCKS proxy na ujaribu tena. Tunapendekeza kuwa usafishe hadhi ili Psiphon iweze kuchukua kituo kinacho patikana kiatomati.\n</p>",
+  "settings#upstream-proxy#heading": "Proxy ya juu zaidi.",
+  "settings#upstream-proxy#by-default": "Kama kompyuta yako tayari ina proxy iliyo sanidiwa, kwa kaida ya Psiphon itatumia proxy hiyo kipindi cha kuanzisha handaki. Unaweza kuiendesha zaidi hiyo tabia kwa kubainisha proxy ya kutumia, au kwa kubainisha kuwa hakuna \"proxy ya juu zaidi\" inatakiwa kutumika.",
+  "settings#upstream-proxy#reason": "Proxies za juu zaidi muda mwingine zinahitajika na shule, vyuo, au biashara. Kama mtoa mtandao wako amekupa mpangilio wa proxy ya juu zaidi, hivyo mpangilio wa kikuli hapa unahitaji kuunganishwa.",
+  "settings#upstream-proxy#proxy-reqs": "HTTP proxies pekee zinazo saidia HTTPs zinaruhusiwa.",
+  "settings#upstream-proxy#hostname-label": "Jina la mwenyeji",
+  "settings#upstream-proxy#port-label": "Bandari",
+  "settings#upstream-proxy#username-label": "Jina la mtumiaji",
+  "settings#upstream-proxy#password-label": "nywila/ neno siri",
+  "settings#upstream-proxy#domain-label": "Kikoa",
+  "settings#upstream-proxy#skip-label": "Usitumie proxy ya juu zaidi",
+  "settings#upstream-proxy#set-hostname-error-msg": "Wewe lazima utoe hostname au uache wakala mto mashamba matupu kwaajili ya uteuzi wa kiautomatic.",
+  "settings#upstream-proxy#set-username-error-msg": "Wewe lazima kutoa jina la utumiaji kama unaweka nywila au kikoa; au acha mashamba uthibitisho wazi kwaajili ya kutokua na uthibitishaji.",
+  "settings#upstream-proxy#error-modal-title": "Kosa katika proxy ya juu zaidi",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon iliyosanidi kwa sasa kutumia mfumo wako wa proksi kama ilivyo “proksi iliyo juu”.<br>\nWalakini, Tunaonekana kuwezesha kuunganisha kwa Psiphon seva kupitia proksi hiyo.<br>\nTafadhali wezesha “Usitumie proksi ya juu” na jaribu tena.",
+  "settings#upstream-proxy#error-modal-body-configured": "Tuna proksi iliyoundwa kwa kutumia “proksi ya juu”.<br>\nWalakini, Tunaona kua tunawezesha kuunganisha kwa Psiphon seva kupitia proksi hiyo. <br>\nTafadhali rekebishamfumo na jaribu tena.",
+  "settings#transport-mode#heading": "Hali ya usafiri",
+  "settings#transport-mode#check-label": "Tumia hali ya L2TP/IPSec ",
+  "settings#transport-mode#help-text": "Hutumia windows L2P/IPSec mitandao halisi. Hali hii itafunga programu zako zote. lakini haiwezi  kutoa obfuscation na kwahiyo haina nguvu ya mzunguko wa uwezo wa uthibiti. Ni<strong>haipelekei</strong> kwa kupitia moto zaidi.",
+  "settings#systray-minimize#heading": "Punguza kwa eneo Alifu (Tray ya mfumo)",
+  "settings#systray-minimize#help-text": "Kama ikiweseshwa, Wakati unapunguza maombi ya Psiphon dirisha litajificha kwenye eneo la arifu (pia jua kua“tray ya mfumo” au “systray”, iko karibu na saa kwenye kazi ya madirisha  yako ya bar).",
+  "settings#systray-minimize#reason": "Kupunguza Psiphon kwa eneo la arifu (\"mfumo wa tray\") nafasi ya bure katika kazi ya bar. Hii ni kwaajili ya kusaidia kama mara nyingi inaendesha Psiphon yako kwa kipindi cha mda mrefu.",
+  "settings#systray-minimize#enable-label": "Punguza kwenye maeneo ya arifu (mfumo wa tray)",
+  "settings#applying-message": "Unganisha tena kuweza kutekeleza mfumo wako.",
+  "settings#saved-message": "Mifumo imehifadhiwa.",
+  "settings#error-modal#title": "Kosa la mifumo",
+  "settings#error-modal#body": "Kuna makosa katika mpangilio wako wa dhamani. Tafadhali zisahihishe kabla ya mchakato. ",
+  "feedback#top_content_title": "Tupatie mrejesho wako",
+  "feedback#top_para_2": "Matatizo mengi yanaweza kurekebishika kwa kupakua toleo la mwisho. Unaweza <a class=\"NewVersionURL\" href=\"#\"> pakua toleo la mwisho kwa kubonyeza hapa</a>, au  unaweza kutuma kwa barua pepe kwa <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Pia unaweza kutafuta njia katika matatizo ya kawaida kwetu <a class=\"FaqURL\" href=\"#\">Maswali  Yaulizwayo Marakwamara</a>.",
+  "feedback#smiley_happy": "Psiphon inaunganisha na kutenda vile ninavyo taka iwe",
+  "feedback#smiley_sad": "Psiphon mara nyingi inashindwa kuunganisha au haifanyi vizuri vya kutosha.",
+  "feedback#text_feedback_prompt": "Tafadhali ingiza maoni yako hapa:",
+  "feedback#text_feedback_email_prompt": "Kama ungependa kwetu kukujibu, Tafadhali ingiza barua pepe yako:",
+  "feedback#diagnostic_check": "Pakia uchunguzi wa data. Tafadhali nakili kwamba uchunguzi huu wa data haukutambulishi wewe, na itatusaidia kuhifadhi uendeshaji mzuri wa Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Bonyeza hapa kuona data gani tunakusanya.</a>",
+  "feedback#submit_button": "Wasilisha",
+  "feedback#text_feedback_bottom_para": "Kama fomu hapo juu haifanyi kazi, au ungependa kutma skrini, tafadhali tutumie barua pepe kwa <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">maoni@psiphon.ca </a>.",
+  "feedback#success-message": "<strong>Ahsante!</strong> Maoni yako yameshatumwa.",
+  "logs#show-debug-label": "Onyesha kumbukumbu ya ukarabati",
+  "logs#placeholder": "Hakuna kumbukumbu bado",
+  "language#success-message": "<strong>Hello!</strong> Karibu Psiphon.",
+  "about#wordart-tag": "Zaidi ya mipaka",
+  "about#description": "Psiphon ni <strong>uthibitisho wa kifaa cha mzunguko</strong>  — imeundwa kutoa ufikio kwenye  mtandao ulio wazi,sensa z zamani na firewall. Ni <strong>chanzo wazi</strong> na kukuza kwenye Toronto, Canada.",
+  "about#visit-download-site": "Tafadhali tembele wovuti yetu kwa <strong><a class=\"NewVersionURL\" href=\"#\">pakua tolea jipya</a></strong> au kwa <strong><a class=\"InfoURL\" href=\"#\">pata msaada na taarifa</a></strong>. Psiphon inapatikana kwa Admin na madirisha.",
+  "about#get-by-email": "<strong>Kama tovuti haiwezi kufikiwa</strong>,unaeza kupata toleo jipya la Psiphon kwa kutuma barua pepe kwa:",
+  "about#client-version": "Psiphon kwa madirisha ya toleo la mteja:",
+  "general#modal-close-button": "Funga",
+  "general#notice-modal-tech-preamble": "Hizi ni taarifa za kimakosa ya ufundi:",
+  "notice#systemproxysettings-setproxy-error-title": "Kosa la mfumo wa Proksi",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon imeshindwa kuweka mpangilio wa mfumo wa proksi.</p>\n<p>Hii inaweza kua kupitia kwenye migogoro kwenye programu yako ya antivirusi. Unaweza kuhitaji kusanidi matumizi yako mwenyewe au mipangilio ya mfumo wa proksi kwa kutumia proksi za mtaa za Psiphon. ",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon imeshindwa ku seti mfumo wa mpangilio wa proksi kwa kunganisha jina la mtandao \"<%- data%>\". Hii inaweza kuwa kwa sababu ya migogoro kwenye programu yako ya antivirus. Unaweza kuhitaji kusanidi atumizi yako wenyewe au mfumo wa mpangilio wa proksi kwa kutumia proksi za mtaa za Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon haikuunganishwa",
+  "appbackend#state-starting-title": "Psiphon inaunganishwa",
+  "appbackend#state-starting-body": "Tafadhali subiri...",
+  "appbackend#state-connected-title": "Psiphon imeunganishwa",
+  "appbackend#state-connected-body": "Chunguza zaidi mipaka yako!",
+  "appbackend#state-connected-reminder-title": "Psiphon inakuweka kwa kuunganishwa",
+  "appbackend#state-connected-reminder-body": "Weka Psiphon wazi.bonyeza hapa kwa kutembelea kurasa zetu za wadhamini",
+  "appbackend#state-connected-reminder-body-2": "Weka Psiphon wazi kwa kutembelea kurasa yetu ya wadhamini ",
+  "appbackend#minimized-to-systray-title": "Psiphon imeweza kupunguza kwenye eneo la arifu",
+  "appbackend#minimized-to-systray-body": "Bonyeza ikoni ili kurejesha programu",
+  "appbackend#os-unsupported": "Psiphon haisaidii tena madirisha ya XP or Vista.\nTafadhali tembelea tovuti yetu kwa taarifa zaidi. ",
+  "psicash#transaction-error-title": "PsiCash kosa la ununuzi",
+  "psicash#transaction-error-body": "PsiCash yako kushindwa kwa jaribio la shughuli isiyotarajiwa.",
+  "psicash#transaction-ExistingTransaction-title": "Manunuzi ya PsiCash tayari yapo",
+  "psicash#transaction-ExistingTransaction-body": "Unayo kwa sasa manunuzi ya PsiCash ya aina hii. Aina ya manunuzi mengine hayajaruhusiwa mpaka moja kumalizika kwa muda.",
+  "psicash#transaction-InsufficientBalance-title": "Usawa wa PsiCash sio wa kutosha",
+  "psicash#transaction-InsufficientBalance-body": "Haitatosha kua na usawa wa PsiCash kwa manunuzi haya.",
+  "psicash#transaction-TransactionAmountMismatch-title": "Bei ya manunuzi ya PsiCash mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "Bei ya manunuzi ya PsiCash imeoita muda wake. hali ya PsiCash yako itakua imerudishwa sasa.",
+  "psicash#transaction-TransactionTypeNotFound-title": "Aina ya manunuzi ya PsiCash hayafanyi kazi.",
+  "psicash#transaction-TransactionTypeNotFound-body": "Bidhaa uliyojaribu kununua haipo tena. Unatakiwa kusasisha au kuweka tena programu-tumizi. ",
+  "psicash#transaction-InvalidTokens-title": "Tokeni batili ya PsiCash",
+  "psicash#transaction-InvalidTokens-body": "PsiCash tokeni yako ni batli . Jaribu kuanzisha maombi. Kama ikiwa haifanyi kazi, unatakiwa ku <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">futa uhifadhi wako wa karibu</a>.",
+  "psicash#transaction-ServerError-title": "Kosa la PsiCash seva",
+  "psicash#transaction-ServerError-body": "Psiphon seva ilijibu makosa wakati inajaribu kuweka manunuzi. Tafadhali jaribu tena manunuzi yako badae. ",
+  "psicash#ui-speedboost-active": "Kasi&nbsp;kuongeza utendaji kwa %s",
+  "psicash#ui-zerobalance-title": "Inahitaji Kasi&nbsp;Kuongeza?",
+  "psicash#ui-buypsi": "Nunua PsiCash",
+  "psicash#ui-buymorepsi": "Nunua zaidi PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Imehitaji kasi&nbsp;Kuongeza",
+  "psicash#ui-enoughbalance-buttontext": "Anza kwa kasi&nbsp;Ongeza",
+  "psicash#1-hour": "Lisaa1",
+  "psicash#1-day": "Siku1",
+  "psicash#ui-buyingboost-buttontext": "Anza kwa kasi&nbsp;Ongeza!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon inahitaji kuunganishwa",
+  "psicash#mustconnect-modal#body": "Kwaajili ya kutumia PsiCash, Nilazima kunganisha na mtandao wa Psiphon.",
+  "psicash#init-error-title": "PsiCash uanzishwaji wa kosa",
+  "psicash#init-error-body-unrecovered": "PsiCash ilishindwa kuanzisha.Hii inaweza kua tatizo la mfumo wa faili, kama vile kua nje ya nafasi ya diski. Usawa wako na hali nyingine zimepotea. PsiCash haitatumika. Unaweza kujaribu kuanzisha maombi kwa kunusuru tatizo.",
+  "psicash#init-error-body-recovered": "PsiCash ilishindwa kuanzisha. hii inaweza kua tatizo la mfumo wa faili, kama vile kua nje ya nafasi ya diski. Usawa wako na hali nyingine zimewekwa upya.",
+  "psicash#psiphon-speed": "Psiphon<br>Spidi",
+  "notice#disallowed-traffic-alert-title": "Kuboresha Psiphon yako kuunganishwa",
+  "notice#disallowed-traffic-alert-body": "<p>Programu haifanyikazi?</p>\n<p>Wavuti nyingine hazina msaada bila kuongeza kasi ya utendaji. Kuongeza kasi ya kufanya kazi na PsiCash kwa kufungua uwezo mzima wa uzoefu wa Psiphon yako.</p> ",
+  "appbackend#disallowed-traffic-notification-title": "Programu haifanyi kazi?",
+  "appbackend#disallowed-traffic-notification-body": "Kuongeza kasi ya kazi kwa kufungua uwezo kamili wa uzoefu wa Psiphon yako.",
+  "settings#disallowed-traffic-alert#heading": "Hairuhusiwi ku arifu traffic",
+  "settings#disallowed-traffic-alert#help-text": "Baadhi ya aina ya mtandao wa traffic haiungi mkono bila kuaongeza kasi ya utendaji. Wakati kama traffic hairuhusiwi, itaonesha arifu. (Kuwezesha tena kutahitajika kuunganisha tena.)",
+  "settings#disallowed-traffic-alert#disable-label": "Lemaza hairuhusu ku arifu traffic",
+  "banner#sponsored-by": "Imedhaminiwa na"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["tg"].translation = {
+  "banner#long-connecting": "<strong>Эҳ вой!</strong> Чунин менамояд, ки ҳангоми пайваст шудан ба мушкилиҳо дучор мешавед!<br>\nАз <a class=\"NewVersionURL\" href=\"#\">сайти боргирӣ</a>\nверсияи охирини Psiphon-ро боргирӣ кунед ё ба <a class=\"NewVersionEmail\" href=\"#\"></a> мактуб фиристонед",
+  "nav#connection#starting": "Пайваст мешавем",
+  "nav#connection#connected": "Пайваст шудем",
+  "nav#connection#stopping": "Ҷудо мешавем",
+  "nav#connection#stopped": "Ҷудо шудем",
+  "nav#settings": "Танзимот",
+  "nav#feedback": "Изҳори назар",
+  "nav#logs": "Дафтарҳои қайд",
+  "nav#about": "Маълумот",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">пайваст мешавам</span>…",
+  "connection#stop-btn": "Қатъ кардан",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">пайваст шудем</span>",
+  "connection#disconnect-btn": "Пайвастро қатъ кардан",
+  "connection#stopping-msg": "Psiphon is <span class=\"state-word\">пайвастро қатъ мекунам</span>…",
+  "connection#wait-btn": "Интизор шавед...",
+  "connection#stopped-msg": "Psiphon is <span class=\"state-word\">пайваст қатъ карда шуд</span>",
+  "connection#connect-btn": "Пайваст шудан",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Хато!</strong> Пеш аз идома додан, арзишҳои нодурустро ислоҳ кунед.",
+  "settings#reset-button": "Ба Пешфарз барқарор кардан",
+  "settings#apply-button": "Тағйиротро татбиқ кардан",
+  "settings#unapplied-changes-prompt#title": "Танзимот тағйир дода шуд",
+  "settings#unapplied-changes-prompt#body": "Шумо танзимотро тағйир додед, аммо онро татбиқ накардаед.<br><br>Мехоҳед тағйиротро татбиқ кунед ё бекор кунед?",
+  "settings#unapplied-changes-prompt#apply-button": "Татбиқ кардан",
+  "settings#unapplied-changes-prompt#discard-button": "Бекор кардан",
+  "settings#vpn-incompatible-msg": "(Бо реҷаи L2TP/IPSec кор намекунад).",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Тақсимкунии нақб",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Сайтҳои дохили кишварро бе прокси кушодан",
+  "settings#disable-timeouts#heading": "Меъёрҳои интизориро барои шабакаҳои суст ғайрифаъол кардан",
+  "settings#disable-timeouts#help-text": "Агар фаъол карда шавад, муҳлати иртибот бо сервери Psiphon ҳисобида намешавад.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Меъёрҳои интизориро барои шабакаҳои суст ғайрифаъол кардан",
+  "settings#egress-region#heading": "Минтақаи сервери Psiphon",
+  "settings#egress-region#select-best-performance": "Самаранокии беҳтарин",
+  "settings#egress-region#select-us": "Иёлоти Муттаҳидаи Амрико",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Шоҳигарии Муттаҳида",
+  "settings#egress-region#select-jp": "Ҷопон",
+  "settings#egress-region#select-sg": "Сингапур",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Нидерланд",
+  "settings#egress-region#select-de": "Олмон",
+  "settings#egress-region#select-in": "Ҳиндустон",
+  "settings#egress-region#select-es": "Испания",
+  "settings#egress-region#select-hk": "Ҳонконг",
+  "settings#egress-region#select-at": "Австрия",
+  "settings#egress-region#select-be": "Белгия",
+  "settings#egress-region#select-bg": "Булғористон",
+  "settings#egress-region#select-ch": "Швейтсария",
+  "settings#egress-region#select-cz": "Ҷумҳурии Чех",
+  "settings#egress-region#select-dk": "Дания",
+  "settings#egress-region#select-fr": "Фаронса",
+  "settings#egress-region#select-hu": "Маҷористон",
+  "settings#egress-region#select-it": "Итолиё",
+  "settings#egress-region#select-no": "Норвегия",
+  "settings#egress-region#select-ro": "Руминия",
+  "settings#egress-region#select-se": "Шветсия",
+  "settings#egress-region#select-pl": "Poland",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Минтақаи дурусти сервери Psiphon интихоб кунед.",
+  "settings#egress-region#error-modal-title": "Минтақаи сервер дастнорас аст",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Портҳои проксии маҳаллӣ",
+  "settings#local-proxy-ports#leave-blank": "Барои портҳоро ба таври худкор интихоб кардан, инро <strong>холӣ</strong> гузорид (тавсия дода мешавад).",
+  "settings#local-proxy-ports#reason": "Агар шумо дар компютери худ нармафзореро истифода баред, ки барои бо Psiphon кор кардан танзимкунии дастӣ талаб мекунад, шумо бояд Psiphon-ро барои истифодаи доимии рақамҳои ивазнашавандаи портҳои маҳаллӣ танзим кунед. Агар муайян кардани рақамҳои портҳо шарт набошад, ба Psiphon иҷозат диҳед, ки онҳоро барои пешгирии ихтилофҳо ба таври худкор интихоб кунад.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Бояд байни 1 ва 65535 бошад.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Портҳои маҳаллӣ бояд аз ҳамдигар фарқ кунанд.",
+  "settings#local-proxy-ports#error-modal-title": "Ихтилофи портҳои проксии маҳаллӣ",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nШумо Psiphon-ро барои портҳои маҳаллии муайянро барои HTTP-проксии худ истифода бурдан танзим кардаед.<br>\nАммо ин порт аллакай дар истифода қарор дорад ва Psiphon онро истифода бурда наметавонад.\n</p>\n<p>\nРақами порти HTTP-проксиро иваз карда, кӯшро такрор кунед. Тавсия медиҳем, ки рақамро пурра нест кунед, то Psiphon тавонад ба таври худкор порти холиеро интихоб кунад.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nШумо Psiphon-ро барои портҳои маҳаллии муайянро барои SOCKS-проксии худ истифода бурдан танзим кардаед.<br>\nАммо ин порт аллакай дар истифода қарор дорад ва Psiphon онро истифода бурда наметавонад.\n</p>\n<p>\nРақами порти SOCKS-проксиро иваз карда, кӯшро такрор кунед. Тавсия медиҳем, ки рақамро пурра нест кунед, то Psiphon тавонад ба таври худкор порти холиеро интихоб кунад.\n</p>",
+  "settings#upstream-proxy#heading": "Проксии баромад",
+  "settings#upstream-proxy#by-default": "Агар дар компютери шумо аллакай прокси танзим карда шуда бошад, ҳангоми нақб ташкил кардан, Psiphon ҳамон проксиро истифода мебарад. Шумо метавонед проксии истифода мешударо муайян карда ё имкони бе “проксии баромад”-ро истифода бурда, ин тартиби корро иваз кунед.",
+  "settings#upstream-proxy#reason": "Баъзан, мактабҳо, донишгоҳҳо ва корхонаҳои тиҷорӣ истифодаи проксиҳои баромадро талаб мекунанд. Агар таҳвилгари хизматрасониҳои шабакавӣ ба шумо танзимоти проксии баромад дода бошад, эҳтимол аст, ки барои пайваст шудан, бояд онҳоро дар инҷо ба таври дастӣ дохил кунед.",
+  "settings#upstream-proxy#proxy-reqs": "Танҳо HTTP-проксиҳои дорои дастгирии протоколи HTTPS истифода бурда мешаванд.",
+  "settings#upstream-proxy#hostname-label": "Номи хост",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Номи корбар",
+  "settings#upstream-proxy#password-label": "Парол",
+  "settings#upstream-proxy#domain-label": "Домен",
+  "settings#upstream-proxy#skip-label": "Проксии баромад истифода набурдан",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Хатогии проксии баромад",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon айни ҳол барои проксии системаро ҳамчун “проксии баромади” худ истифода бурдан танзим карда шудааст.<br>\nБо вуҷуди ин, мо тавассути проксии мазкур ба серверҳои Psiphon пайваст шуда наметавонем.<br>\n“Проксии баромад истифода набурдан”-ро фаъол карда, кӯшишро такрор кунед.",
+  "settings#upstream-proxy#error-modal-body-configured": "Шумо Psiphon-ро барои “проксии баромад” истифода бурдан танзим кардаед.<br>\nАммо мо бо истифодаи проксии мазкур ба серверҳои Psiphon пайваст шуда наметавонем.<br>\nТанзимро ислоҳ карда, кӯшишро такрор кунед.",
+  "settings#transport-mode#heading": "Реҷаи таҳвил",
+  "settings#transport-mode#check-label": "Реҷаи L2TP/IPSec истифода бурдан",
+  "settings#transport-mode#help-text": "Шабакасозии виртуалии Windows L2TP/IPSec-ро истифода мебарад. Ин реҷа ҳамаи трафики ҳамаи барномаҳоро тавассути нақб равона мекунад, аммо чигилкунӣ таъмин намекунад ва пас қобилиятҳои қавии фиребкунии сензура надорад. Ин реҷа барои каноргузарии бисёри дарғотҳои амниятӣ <strong>тавсия карда намешавад</strong>.",
+  "settings#systray-minimize#heading": "Ба Қитъаи огоҳиҳо (лавҳаи система) печондан",
+  "settings#systray-minimize#help-text": "Агар фаъол карда шавад, равзанаи барномаи Psiphon дар қитъаи огоҳиҳо (инчунин “лавҳаи система”, ҷойгир дар назди соат дар навори вазифаҳои Windows) печонда мешавад.",
+  "settings#systray-minimize#reason": "Агар Psiphon ба қитъаи огоҳиҳо (”лавҳаи система”) печонда шавад, дар навори вазифаҳои шумо ҷои бештар холӣ мешавад. Ин хусусан дар ҳолати Psiphon-ро дар муҳлатҳои тӯлонӣ истифода бурдан муфид аст.",
+  "settings#systray-minimize#enable-label": "Ба Қитъаи огоҳиҳо (лавҳаи система) печондан",
+  "settings#applying-message": "Барои танзимотро татбиқ кардан аз нав пайваст мешавем.",
+  "settings#saved-message": "Танзимот захира карда шуд.",
+  "settings#error-modal#title": "Хатогии танзимот",
+  "settings#error-modal#body": "Арзишҳои танзимот хатогӣ доранд. Барои идома додан, онҳоро ислоҳ кунед.",
+  "feedback#top_content_title": "Ба мо назари худро изҳор кунед",
+  "feedback#top_para_2": "Бисёри мушкилиҳо метавонанд бо насб кардани версияи охирин бартараф карда шаванд. Шумо метавонед <a class=\"NewVersionURL\" href=\"#\">инҷо зер карда, версияи навро боргирӣ кунед</a>, ё метавонед ба <a class=\"NewVersionEmail\" href=\"#\"></a> мактуби электронӣ фиристед.",
+  "feedback#top_para_3": "Шумо инчунин метавонед дар\n<a class=\"FaqURL\" href=\"#\">Саволҳои роиҷ</a> ба мушкилиҳои маъмул тарзи ислоҳ пайдо кунед.",
+  "feedback#smiley_happy": "Psiphon тарзе, ки ба ман лозим аст, пайваст мешавад ва кор мекунад.",
+  "feedback#smiley_sad": "Psiphon мунтазам пайваст шуда наметавонад ва на он қадар хуб кор мекунад.",
+  "feedback#text_feedback_prompt": "Шарҳҳои худро инҷо дохил кунед:",
+  "feedback#text_feedback_email_prompt": "Агар бихоҳед, ки мо ба шумо ҷавоб диҳем, суроғаи почтаи электронии худро дохил кунед:",
+  "feedback#diagnostic_check": "Иттилооти ташхисӣ бор кардан. Дар хотир доред, ки ин иттилооти ташхисӣ шахсияти шуморо муайян намекунад ва ба мо барои кори дурусти Psiphon-ро таъмин кардан кумак мерасонад. <a class=\"DataCollectionInfoURL\" href=\"#\">Инҷо зер карда, бубинед, ки мо кадом иттилоотро ҷамъ мекунем.</a>",
+  "feedback#submit_button": "Равон кардан",
+  "feedback#text_feedback_bottom_para": "Агар ин варақа кор накунад ё агар ба мо аксҳои экрани худро фиристодан хоҳед, ба мо дар суроғаи <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> мактуби электронӣ фиристед",
+  "feedback#success-message": "<strong>Ташаккур!</strong> Изҳори назари шумо фиристода шуд.",
+  "logs#show-debug-label": "Дафтарҳои қайди ислоҳи нуқсонҳоро нишон додан",
+  "logs#placeholder": "Ҳоло ягон дафтари қайд нест",
+  "language#success-message": "<strong>Салом!</strong> Марҳабо ба Psiphon.",
+  "about#wordart-tag": "Берун аз сарҳадҳо",
+  "about#description": "Psiphon <strong>асбоби рахнакунии маҳдудкунии дастрасӣ</strong> мебошад — он барои фароҳам овардани дастрасӣ ба интернети кушод тариқи фиреб додани воситаҳои сензура ва дарғотҳои амниятӣ тарҳбандӣ шудааст. Он лоиҳаи <strong>манбаи кушод</strong> буда, дар Торонтои Канада таҳия карда шудааст.",
+  "about#visit-download-site": "Барои <strong><a class=\"NewVersionURL\" href=\"#\">версияи навро боргирӣ кардан</a></strong> ё <strong><a class=\"InfoURL\" href=\"#\">маълумот ва кумак гирифтан</a></strong> ба вебсайт гузаред. Psiphon барои Android ва Windows дастрас аст.",
+  "about#get-by-email": "<strong>Агар вебсайт дастнорас бошад</strong>, метавонед ба инҷо мактуби электронӣ фиристода, версияи навро барои худ дастрас кунед:",
+  "about#client-version": "Версияи нармафзори муштарии Psiphon барои Windows:",
+  "general#modal-close-button": "Пӯшидан",
+  "general#notice-modal-tech-preamble": "Маълумот оиди хатогии техникӣ:",
+  "notice#systemproxysettings-setproxy-error-title": "Хатогии проксии система",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon танзимоти проксии системаро ҷӯр карда натавонист.</p>\n<p>Сабаби ин метавонад ихтилоф бо нармафзори зиддивирусӣ бошад. Инро тариқи ба таври дастӣ танзим кардани барнома ё танзимоти проксии система барои истифода бурдани проксиҳои маҳаллии Psiphon ислоҳ кардан мумкин аст.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon барои пайвасти интернетии “<%- data %” танзимоти проксии системаро ҷӯр карда натавонист. Сабаби ин метавонад ихтилоф бо нармафзори зиддивирусӣ бошад. Инро тариқи ба таври дастӣ танзим кардани барнома ё танзимоти проксии система барои истифода бурдани проксиҳои маҳаллии Psiphon ислоҳ кардан мумкин аст.",
+  "appbackend#state-stopped-title": "Psiphon ҷудо шуд",
+  "appbackend#state-starting-title": "Psiphon пайваст мешавад",
+  "appbackend#state-starting-body": "Интизор шавед...",
+  "appbackend#state-connected-title": "Psiphon пайваст шуд",
+  "appbackend#state-connected-body": "Берун аз сарҳадҳо паймоиш кунед!",
+  "appbackend#state-connected-reminder-title": "Psiphon шуморо ба интернет пайваста нигоҳ медорад",
+  "appbackend#state-connected-reminder-body": "Psiphon ройгон аст. Инҷо зер карда, саҳифаҳои парасторони моро аз назар гузаронед!",
+  "appbackend#state-connected-reminder-body-2": "Саҳифаҳои парасторони моро аз назар гузаронда, барои ройгон мондани Psiphon мусоидат кунед.",
+  "appbackend#minimized-to-systray-title": "Psiphon ба қитъаи огоҳиҳо печонда шуд",
+  "appbackend#minimized-to-systray-body": "Барои барномаро барқарор кардан, нишонаро зер кунед",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Парасторӣ аз"
+};
\ No newline at end of file
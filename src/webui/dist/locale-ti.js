@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ti"].translation = {
+  "banner#long-connecting": "<strong>ኦ ኣይኮነን!</strong> ንምርኻብ ዝተጸገምካ ትመስል<br>\nዳሕራዋይ ቨርጂን ሳይፎን (Psiphon) ካብ <a class=\"NewVersionURL\" href=\"#\">ኣውርድ</a>\nኣውርድ ገጽ ወይ ናብ <a class=\"NewVersionEmail\" href=\"#\"></a> ኢመይል ብምልኣኽ",
+  "nav#connection#starting": "ይራኸብ ኣሎ",
+  "nav#connection#connected": "ተራኺቡ",
+  "nav#connection#stopping": "ኣይራኸበን ኣሎ",
+  "nav#connection#stopped": "ኣይተራኸበን",
+  "nav#settings": "ባይታ-ውህደት",
+  "nav#feedback": "ግብረ-መልሲ",
+  "nav#logs": "መዝገባት",
+  "nav#about": "ብዛዕባ",
+  "connection#starting-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ይራኸብ ኣሎ</span>…",
+  "connection#stop-btn": "ደው ኣብል",
+  "connection#connected-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ተራኺቡ`ሎ</span>",
+  "connection#disconnect-btn": "ኣይተራኽብ",
+  "connection#stopping-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ኣይራኸብን ዘሎ</span>…",
+  "connection#wait-btn": "ሓንሳብ ጽናሕ...",
+  "connection#stopped-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ኣይተራኸበን</span> ",
+  "connection#connect-btn": "ኣራኽብ",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>ጌጋ!</strong> ቅድሚ ምቕጻልካ ዝተጋገዩ ነገራት ኣዓርዮ.",
+  "settings#reset-button": "ናብ ዝነበሮ ምለስ",
+  "settings#apply-button": "ለውጥታት ኣተግብር",
+  "settings#unapplied-changes-prompt#title": "ባይታ ውህደት ተቐይሩ`ሎ",
+  "settings#unapplied-changes-prompt#body": "ኣብ ባይታ-መወሃሃዲ ለውጢታት ጌርካ `ለኻ፡ ግን ነቲ ለውጥታት ተግባራዊ ኣይገበርካን::<br><br>ዝገበርካዮ ለውጥታት ክትፍጽሞ ተደሊ ዲኻ ወይስ ክተገድፎም ኢኻ ትደሊ?",
+  "settings#unapplied-changes-prompt#apply-button": "ኣተግብር",
+  "settings#unapplied-changes-prompt#discard-button": "ሰርዝ",
+  "settings#vpn-incompatible-msg": "(ምስL2TP/IPSec mode ኣይሰርሕን.)",
+  "settings#vpn-incompatible-label": "L2TP/IPsec",
+  "settings#split-tunnel#heading": "ስፕሊት ታነል",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "ነዚ እንተመሪጽካ ኣብ ሃገርካ ንዘሎ ሰርቨራት ንምጥቃም ዝተግብረ ሕቶ ብሳይፎን ኣይመሓላለፍን`ዩ",
+  "settings#disable-timeouts#heading": "ነትወርክ ኣብ ዝዝሕለሉ እዋን ታይምኣውትስ ኣጥፍእ",
+  "settings#disable-timeouts#help-text": "እዚ እንተተወሊዑ ምስ ናይ ሳይፎን (Psiphon) ሰርቨር ዘሎ ርክብ ኣይክጠፍእን`ዩ፡፡",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "ንዝሑላት ነትዎርክታት ናይ ግዜ ዕረፍቲታት ኣደስክል",
+  "settings#egress-region#heading": "ናይ ሳይፎን (Psiphon) ዞባ ሰርቨር",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "ዩናይትድ ስቴትስ",
+  "settings#egress-region#select-ca": "ካናዳ",
+  "settings#egress-region#select-gb": "ዓባይ ብሪጣንያ",
+  "settings#egress-region#select-jp": "ጃፓን",
+  "settings#egress-region#select-sg": "ሲንጋፖር",
+  "settings#egress-region#select-sk": "ስሎቫክያ",
+  "settings#egress-region#select-nl": "ነዘርላንድስ",
+  "settings#egress-region#select-de": "ጀርመን",
+  "settings#egress-region#select-in": "ህንዲ",
+  "settings#egress-region#select-es": "ስጳኛ",
+  "settings#egress-region#select-hk": "ሆንግ ኮንግ",
+  "settings#egress-region#select-at": "ኣውስትራሊያ",
+  "settings#egress-region#select-be": "በልጁም",
+  "settings#egress-region#select-bg": "ቡልጋርያ",
+  "settings#egress-region#select-ch": "ስዊዘርላንድ",
+  "settings#egress-region#select-cz": "ቸክ ሪፓብሊክ",
+  "settings#egress-region#select-dk": "ደንማርክ",
+  "settings#egress-region#select-fr": "ፈረንሳይ",
+  "settings#egress-region#select-hu": "ሃንጋሪ",
+  "settings#egress-region#select-it": "ኢጣልያ",
+  "settings#egress-region#select-no": "ኖርወይ",
+  "settings#egress-region#select-ro": "ሮማንያ",
+  "settings#egress-region#select-se": "ሽወደን",
+  "settings#egress-region#select-pl": "ፖላንድ",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "ትኽክለኛ ዞባ ሰርቨር ሳይፎን (Psiphon) ምረጽ",
+  "settings#egress-region#error-modal-title": "ኽሊ ሰርቨር ኣይተረኽበን",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "ውሽጣዊ ፕሮክሲ ፖርትስ",
+  "settings#local-proxy-ports#leave-blank": "ንኣውቶማቲክ ፖርት ምርጫ ካብ <strong>ባዶ</strong> ውጻእ (ዝድገፍ ሓሳብ) ",
+  "settings#local-proxy-ports#reason": "ኣብ ኮምፒተርካ ምስ ሳይፎን (Psiphon) ዝሰርሕ ማኑዋል ውህደት ዘድልዮ መሳርሒ እንተተጠቒምካ፡ ሳይፎን (Psiphon) ብቐጻሊ ሓደ ዓይነት ቁጽርታት ከባቢያዊ ፖርት ክጥቀም ክደሊ`ዩ። ቁጽርታት ፖርት ክተነጽር ምኽንያት ዘይብልካ እንተኾይኑ ግን፡ ሳይፎን (Psiphon) ብቐጥታ ክጥቀመሎም ክተፍቅደሉ ይግባእ- ግጭታት ንምውጋድ ንኽሕግዘካ፡፡ ",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "ካብ 1 ክሳብ 65535 ክኸውን ኣለዎ፡፡",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": " ከባቢያዊ ፖርትታት ነንሕድሕዶም ዝተፈላለዩ ክኾኑ`ለዎም",
+  "settings#local-proxy-ports#error-modal-title": "ግጭት ከባቢያዊ ተካኢ ፖርትታት",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\n ሳይፎን (Psiphon)  ንHTTP ፍሉይ ተካኢ ከምዝጥቀም ጌርካ ኣወሃሂድካዮ ኣለኻ<br>\nእንተኾነ እቲ ፖርት ድሮ ኣብ ስራሕ ስለዘሎ ሳይፎን (Psiphon) ክጥቀመሉ ኣይኽእል`ዩ \n</p>\n<p>\nዝተወሃሃደ HTTP ፕሮክሲ ፖርት ቀይርካ እንደገና ፈትን። ሳይፎን (Psiphon) ኣብ ናቱ ዘለዉ ፖርትታት ንኽመርጽ ዘለዉ ዋጋታት ብምልኦም ክተጥፍኦም ትምከር::\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\n ሳይፎን (Psiphon) ኣዋዲድካ `ለኻ ፍሉይ ከባቢያዊ ፖርት ንኽጥቀም ንናቱ SOCKS ፕሮክሲ። <br>\n እንተኾነ እቲ ፖርት ኣብ ጠቕሚ ውዒሉ ስለዘሎ ሳይፎን (Psiphon)  ክጥቀመሉ ኣይክእልን`ዩ። \n</p>\n<p>\nስለዚ ንዝተዋደደ SOCKS ፕሮክሲ ቀይርካ እንደገና ፈትን 3. ሳይፎን (Psiphon) ብቐጥታ ነቲ ዘሎ ፖርት መታን ክመርጽ ንኹሉ ዋጋታት ክተጽርዮ ትምከ፡፡ር\n</p>",
+  "settings#upstream-proxy#heading": "ፕሮክሲ ላዕላዋይ ዋሕዚ",
+  "settings#upstream-proxy#by-default": "ኮምፒተርካ ፕሮክሲ ዝገጠመሉ እንተኾይኑ፡ ከም ንቡር ሳይፎን (Psiphon) ነቲ ፕሮክሲ ክጥቀመሉ`ዩ፡፡ መሕለፊ ክገብር ከሎ ትጥቀመሉ ፕሮክሲ ብምንጻር ግን ንዕኡ ክትሰግሮ ትኽእል ኢኻ ወይ ከኣ ከምኡ ዓይነት \"ፕሮክሲ ላዕላዋይ ዋሕዚ\" ዘይምጥቃም ዝብል ብምጥቃም።",
+  "settings#upstream-proxy#reason": "ላዕላዋይ ዋሕዚ ተካእቲ ሓደ ሓደ ግዜ ብኣብያተ ትምህርቲ፡ ዩኒቨርሲታት ወይ ኣብያተ-ንግዲ ይድለዩ`ዮም። ነትወርክ ዘቕርበልካ፡ ላዕላዋይ-ዋሕዚ ተካኢ ባይታ ውህደት እንተሂቡካ፡ ንምርኻብ ብማኑዋል ውህደት ምስራሕ ከድሊ`ዩ፡፡",
+  "settings#upstream-proxy#proxy-reqs": "HTTP ጥራሕን ምስ HTTPS ዝሰማምዑን ተካእቲ ይፍቀደሎም ",
+  "settings#upstream-proxy#hostname-label": "ኣተኣናጋዲ ሽም",
+  "settings#upstream-proxy#port-label": "ፖርት",
+  "settings#upstream-proxy#username-label": "ሽም ተጠቃሚ",
+  "settings#upstream-proxy#password-label": "መሕለፊ",
+  "settings#upstream-proxy#domain-label": "ዶመይን",
+  "settings#upstream-proxy#skip-label": "ፕሮክሲ ላዕላይ ዋሕዚ ኣይትጠቐም",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "ናይ ላዕላዋይ ዋሕዚ ጌጋ",
+  "settings#upstream-proxy#error-modal-body-default": "ሳይፎን (Psiphon)  ተዋዲዱ ዘሎ፡ \"ላዕላዋይ ዋሕዚ ፕሮክሲ\" ንኽጥቀም`ዩ። <br>\nእንተኾነ በታ ፕሮክሲ ጌርካ ናብ ሰርቨር ሳይፎን (Psiphon) ምርኻብ ኣይተኻእለን። <br>\nስለዚ \"ላዕላዋል ፕሮክሲ ኣይትጠቐም\" ዝብል ኣንቂሕካ እንደገና ፈትን።",
+  "settings#upstream-proxy#error-modal-body-configured": "ሳይፎን (Psiphon)  \"ላዕላዋይ ተካኢ\" ከምዝጥቀም ጌርካ ኣወሃሂድካያ ኣለኻ።<br>\nነገር ግን በታ ተካኢ ወይ ፕሮክሲ ምስ ሰርቨር ሳይፎን (Psiphon) ክንራኸብ ኣይክኣልንን ይመስል ኣሎ፡፡<br>\nብኽብረትካ ነቲ ሴቲንግስ ብምዕራይ ደጊምካ ፈትን፡፡",
+  "settings#transport-mode#heading": "መጉዓዚ ሞድ",
+  "settings#transport-mode#check-label": " L2TP/IPsec  ሞድ ተጠቐም",
+  "settings#transport-mode#help-text": "ንዊንዶውስ L2TP/IPsec ሓሳባዊ ኔትወርክ ተጠቐም። እዚ ሞድ`ዚ ንኹሉ መተግበሪ ኣፓት የመሓላልፍ`ዩ:: ነገር ግን መሰወሪ ስለዘይህብ ሓያል ሰንሰርሺፕ መከላኸሊ ዓቕሚ ይብሉን፡፡ ስለዚ ንመብዛሕቲኦም ፋየርወላት ንምሕላፍ <strong>ኣይምከርን</strong>::",
+  "settings#systray-minimize#heading": "መዘኻኸሪ ከባቢ ነክይ (ሲስተም ትረይ)",
+  "settings#systray-minimize#help-text": "እንተነቒሑ፡ ናይ ሳይፎን (Psiphon) መተግበሪ ዊንደው ክተንእሶ ኸለኻ ኣብ መዘኻኸሪ ከባቢ ክሕባእ`ዩ (\"ሲስተም ትረይ\" ወይ \"ሲስትረይ\" ተባሂሉ`ውን ይጽዋዕ`ዩ)",
+  "settings#systray-minimize#reason": "ሳይፎን (Psiphon) ናብ መዘኻኸሪ ከባቢ ምንኣስ(ሲስተም ትረይ) ኣብ ታስክ ባር ቦታ ክህበካ ይኽእል`ዩ። እዚ ድማ ዝያዳ ሓጋዚ`ዩ ሳይፎን (Psiphon) ንንውሕ ዝበለ ግዜ ትጥቀመሉ እንተኾይንካ",
+  "settings#systray-minimize#enable-label": "ናብ መዘኻኸሪ ከባቢ ኣንእስ (ሲስተም ትረይ)",
+  "settings#applying-message": "ባይታ ውህደትካ ንምትግባር ኣብ ምርኻብ ኣሎ",
+  "settings#saved-message": "ውህደት ባይታታትካ ተኸዚኑ`ሎ",
+  "settings#error-modal#title": "ጌጋ ባይታ ውህደት",
+  "settings#error-modal#body": "ኣብ ዋጋታት ባይታ ውህደትካ ጌጋታት ኣለዉ። ቅድሚ ምቕጻልካ ኣርሞም፡፡",
+  "feedback#top_content_title": "ርእቶኹም ሃቡና",
+  "feedback#top_para_2": "ዳሕራዋይ ቨርጂን ብምውራድ ብዙሕ ጸገማት ክፍታሕ ይኽእል`ዩ:: ኣብ`ዚ </a>, ብምጥዋቕ <a class=\"NewVersionURL\" href=\"#\">ክተውርድ ትኽእል ኢኻ ወይ ናብ <a class=\"NewVersionEmail\" href=\"#\"></a> ኢመይል ክትልእኽ ትኽእል ኢኻ፡፡",
+  "feedback#top_para_3": "ኣብ <a class=\"FaqURL\" href=\"#\">ብተደጋጋሚ ዝሕተቱ ሕቶታት</a> ንብዙሓት ዝውቱራት ሕቶታት ፍታሕ ክተረክብ ትኽእል ኢኻ፡፡",
+  "feedback#smiley_happy": "ሳይፎን (Psiphon) በቲ ዝደልኽዎ ይሰርሕን የራኽበንን ኣሎ፡፡",
+  "feedback#smiley_sad": "ሳይፎን (Psiphon) ፅቡቕ ይሰርሕ የለን፡፡",
+  "feedback#text_feedback_prompt": "ርእይቶታትካ ኣብ`ዚ ኣእቱ፡",
+  "feedback#text_feedback_email_prompt": "ክንምልሰልካ እንተደሊኻና ኢመይልካ ኣብ`ዚ ኣእቱ፡፡",
+  "feedback#diagnostic_check": "ዳታ መመርመሪ ጽዓን። እዚ ዳታ መርመራ ከላልየካ ኣይክእልን`ዩ ከምኡ`ውን ሳይፎን (Psiphon) ብጽቡቕ ክሰርሕ ክሕግዘና`ዩ:: <a class=\"DataCollectionInfoURL\" href=\"#\">ዝኣከብናዮ ዳታ ንምርኣይ ኣብ`ዚ ጠውቕ ፡፡</a>",
+  "feedback#submit_button": "ኣረክብ",
+  "feedback#text_feedback_bottom_para": "ኣብ ላዕሊ ዘሎ ቐጥዒ ዘይሰርሕ እንተኾይኑ ወይ ስክሪሾትስ ክትልእኽ እንተደሊኻ ናብ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ልኣኸልና",
+  "feedback#success-message": "<strong>የቐንየልና!</strong> ርእይቶኻ ተላኢኹ`ሎ፡፡",
+  "logs#show-debug-label": "ዲባግ ምሎግስ ኣርኢ",
+  "logs#placeholder": "ሎግ የለን",
+  "language#success-message": "<strong>ሄሎ!</strong> ናብ ሳይፎን (Psiphon) እንቋዕ መጻእኩም",
+  "about#wordart-tag": "ኪነው ዶባት",
+  "about#description": "ሳይፎን (Psiphon)  ሓደ <strong>ሰንሰርሺፕ ዝዋጋእ መሳርሒ`ዩ</strong> — ንናጻ ኢንተርነት፡ንዝሓለፈ ሰንሰራት ከምኡ`ውን ፋየርዎላት መሕለፊ ንኽህብ ዝተሰርሐ`ዩ፡፡ ክፉት <strong>ምንጪ ኣብ</strong> ቶሮንቶ ካናዳ ዝተሰርሐ`ዩ::",
+  "about#visit-download-site": "ካብ`ዚ <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">ሓገዝን ሓበሬታን ርኸብ</a></strong>፡፡ ሳይፎን (Psiphon) ን Android ን Windows ኣሎ፡፡",
+  "about#get-by-email": "<strong>እቲ መርበብ ዘይብጻሕ እንተኾይኑ</strong> ሓዲሽ ቨርጂን ሳይፎን (Psiphon)   ምርካብ ይክኣል ናብ`ዚ ኢመይል ብምግባር፡",
+  "about#client-version": "ሳይፎን (Psiphon) ንዊንዶውስ ክሌንት ቨርጂን",
+  "general#modal-close-button": "ዕጾ",
+  "general#notice-modal-tech-preamble": "እዚ ናይ ተክኒካዊ ጌጋ ሓበረታ`ዩ፡",
+  "notice#systemproxysettings-setproxy-error-title": "ስርዓት ጌጋ ተካኢ",
+  "notice#systemproxysettings-setproxy-error-body": "<p>ሳይፎን (Psiphon) ባይታ ውህደት ተካኢ ክጅምር ኣይክኣልን፡፡</p>\n<p> እዚ ማለት ምስ ጸረ-ቫይረስ ሶፍትወርካ ተጋጭዩ ክኸውን ይኽእል`ዩ። መግበሪኻ ብማንዋል ምውህሃድ የድልየካ ይኸውን ወይ ባይታ ውህደት ተካኢ ንከባቢያዊ ሳይፎን (Psiphon) ተካእቲ ንምጥቃም፡፡</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "ሳይፎን (Psiphon) “<%- data %>” ዝብሃል ርክብ ኢንተርነት ብተካኢ ባይታ ውህደት ከጀምሮ ኣይክኣለን። ምስ ምስ ጸረ-ቫይረስ ሶፍትወርካ ስለዘይተሰማምዐ ክኸውን ይኽእል። መተግበሪኻ ማንዋል ብዝኾነ መንገዲ ምውህሃድ ከድልየካ `ዩ-ወይ ከኣ ከባቢያዊ ተካእቲ ንምጥቃም ስርዓት ባይታ ውህደት ተካኢ ክጥቀም ይኽእል፡፡",
+  "appbackend#state-stopped-title": "ሳይፎን (Psiphon) ተቛሪጹ`ሎ",
+  "appbackend#state-starting-title": "ሳይፎን (Psiphon) ይራኸብ ኣሎ",
+  "appbackend#state-starting-body": "ሓንሳብ ጽናሕ…",
+  "appbackend#state-connected-title": "ሳይፎን (Psiphon) ተራኺቡ`ሎ",
+  "appbackend#state-connected-body": "ኪነው ዶባትካ ዳህስስ",
+  "appbackend#state-connected-reminder-title": "ሳይፎን (Psiphon)  ኣራኺቡካ `ሎ",
+  "appbackend#state-connected-reminder-body": "ሳይፎን (Psiphon)  ናጻ ግደፎ:: ናብ መዋሊና ገጻት ንምብጻሕ ኣብ`ዚ ጠውቕ!",
+  "appbackend#state-connected-reminder-body-2": "ሳይፎን (Psiphon)  ናጻ ግደፎ-ናብ መዋሊና ገጻት ብምብጻሕ!",
+  "appbackend#minimized-to-systray-title": "ሳይፎን (Psiphon) ናብ መዘኻኸሪ ከባቢ ንኢሱ`ሎ",
+  "appbackend#minimized-to-systray-body": "መተግበሪ ናብ ዝነበሮ ንምምላስ ነዚ ኣይከን ጠውቕ",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "ዝተመወለ ብ"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["tk"].translation = {
+  "banner#long-connecting": "<strong>Waheý</strong> Birikmekde näsazlyk çykýar!<br>\nPsiphon-yň iň soňky görnüşini  <a class=\"NewVersionURL\" href=\"#\">şu saýtdan indir</a>\nýada email ugrat <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Birikdirilýär...",
+  "nav#connection#connected": "Birikdirildi",
+  "nav#connection#stopping": "Birikmeýär",
+  "nav#connection#stopped": "Birikmedi",
+  "nav#settings": "Sazlamalar",
+  "nav#feedback": "Seslenme",
+  "nav#logs": "Ýazgylar",
+  "nav#about": "Hakynda",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\"> birikýär</span>…",
+  "connection#stop-btn": "Dur",
+  "connection#connected-msg": "Psiphon<span class=\"state-word\">birikdi </span>",
+  "connection#disconnect-btn": "Birikme",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\"> birikdirilenok</span>…",
+  "connection#wait-btn": "Garaşyň",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">birikmedi </span>",
+  "connection#connect-btn": "Birikdirildi",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Säwlik!</strong> Hayyş, dowam etmekden öñ nädogry bellikleri düzediñ.",
+  "settings#reset-button": "Täzeden asyla dolan",
+  "settings#apply-button": "üýtgetmeleri ulan",
+  "settings#unapplied-changes-prompt#title": "Sazlamalar Üýtgedildi",
+  "settings#unapplied-changes-prompt#body": "Siz sazlamalarda üytgeşmeler edipsiñiz, ýöne ol üytgeşmeleri ulanmansyñyz.<br><br>Siz üytgeşmeleri şu wagt ulanmakçy my ýa-da ret et?",
+  "settings#unapplied-changes-prompt#apply-button": "Ulan",
+  "settings#unapplied-changes-prompt#discard-button": "Ret et",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec ülñi bilen išlänok.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Ötük bölündi",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Öz ýurduňyzdaky websaýtlary proksileme.",
+  "settings#disable-timeouts#heading": "Yuwaş network üçin goşmaça wagtalmalary öçür ",
+  "settings#disable-timeouts#help-text": "Işledilen halatynda, Psiphon serwer baglanşygy wagtdan geçmez.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Yuwaş network halatynda goşmaça wagtalmalary öçür ",
+  "settings#egress-region#heading": "Psiphon Serwer Ýurdy",
+  "settings#egress-region#select-best-performance": "Ýokary hilli işleýişi",
+  "settings#egress-region#select-us": "Amerikaň Birleşen Ştatlary",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Beýik Britaniýa",
+  "settings#egress-region#select-jp": "Ýaponiýa",
+  "settings#egress-region#select-sg": "Singapur",
+  "settings#egress-region#select-sk": "Slowakiýa",
+  "settings#egress-region#select-nl": "Gollandiýa",
+  "settings#egress-region#select-de": "Germaniýa",
+  "settings#egress-region#select-in": "Hindistan",
+  "settings#egress-region#select-es": "Ispaniýa",
+  "settings#egress-region#select-hk": "Gong Kong",
+  "settings#egress-region#select-at": "Awstriýa",
+  "settings#egress-region#select-be": "Belgiya",
+  "settings#egress-region#select-bg": "Bolgariýa",
+  "settings#egress-region#select-ch": "Şweýsariýa",
+  "settings#egress-region#select-cz": "Çeh Respublikasy",
+  "settings#egress-region#select-dk": "Daniýa",
+  "settings#egress-region#select-fr": "Fransiýa",
+  "settings#egress-region#select-hu": "Wengriýa",
+  "settings#egress-region#select-it": "Italiya",
+  "settings#egress-region#select-no": "Norwegiýa",
+  "settings#egress-region#select-ro": "Rumyniýa",
+  "settings#egress-region#select-se": "Şwesiýa",
+  "settings#egress-region#select-pl": "Olonya",
+  "settings#egress-region#select-rs": "Serbiýa",
+  "settings#egress-region#select-au": "Awstraliýa",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Ÿörgünli Psiphon serwer yurduny ulan.",
+  "settings#egress-region#error-modal-title": "Serweriň Ýurdy elýeterli däl",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Yerli Proksi portlary",
+  "settings#local-proxy-ports#leave-blank": "Automatiki port saýlawy üçin<strong>boş</strong> goýmak (maslahat berilýär).",
+  "settings#local-proxy-ports#reason": "Kompýuteriňizde elde düzediş talap edýän serişdeleri Psiphon bilen ulanýan bolsaňyz, onda ýerli birmeňzeş Psiphon port nomerlerini ulanmagy isläp bilersiňiz. Eger port nomerlerini görkezmek islemeýän bolsaňyz we näsazlyklaryň öňüni almak üçin Psiphona automatik port nomerlerini saýlamana rugsat beriň.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 bilen 65535 aralygynda bolmaly",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Yerli portlar biri-birinden tapawutly bolmaly.",
+  "settings#local-proxy-ports#error-modal-title": "Yerli Proksi portlarynda çaknyşyk",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nSiz aýratyn ýerli portyň HTTP proksini ulanmak üçin Psiphon-y sazladyňyz.<br>\nÝone, ol port eýýäm ulanylýar we Psiphon ulanyp bilenok.\n</p>\n<p>\nHaýyş sazlanan HTTP proksi port hasabyny üýtget we täzeden syna. Psiphon elýeterli porty automatiki saýlamasy üçin, port hasaby arassalamagy maslahat berýäris.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nSiz aýratyn ýerli portyň SOCKS proksini ulanmak üçin Psiphon-y sazladyňyz.<br>\nÝone, ol port eýýäm ulanylýar we Psiphon ulanyp bilenok.\n</p>\n<p>\nHaýyş sazlanan SOCKS proksi port hasabyny üýtget we täzeden syna. Psiphon elýeterli porty automatiki saýlamasy üçin, port hasaby arassalamagy maslahat berýäris.\n</p>",
+  "settings#upstream-proxy#heading": "Upstream Proksi",
+  "settings#upstream-proxy#by-default": "Komýuteriňizde öňden proksi gurnalan bolsa, Psiphon tünel gurnamakda şol proksini ulanar. Haýsy proksini ulanmagy görkezip, üýtgetmegi belläp, ýada “upstream proxy” ulanmazlygy belläp bilersiňiz.",
+  "settings#upstream-proxy#reason": "Mekdepler, ýokary okuw jaýlary we edaralar köplenç \"upstream\" proksini talap eder. Eger network üpjün ediji size \"upstream\" proksi sazlamalary beren bolsa, onda birikmek üçin el bilen düzediş gerek bolar.",
+  "settings#upstream-proxy#proxy-reqs": "Diñe HTTPS goldayan HTTP proksilara rugsat berilyär.",
+  "settings#upstream-proxy#hostname-label": "Eýeady",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Ulanjyady",
+  "settings#upstream-proxy#password-label": "Açarsözi",
+  "settings#upstream-proxy#domain-label": "Domain",
+  "settings#upstream-proxy#skip-label": "Yokarky Proksi akymyny ulanma",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Upstream prokside säwlik",
+  "settings#upstream-proxy#error-modal-body-default": "Şuwagt Psihon “upstream proxy” görnüşini ulanmak üçin sazlanan.<br>\nÝöne, Psiphon-a ol proksi arkaly serwere birikmäni başaranok.<br>\nHaýyş “upstream proxy” ulanma we täzeden syna.",
+  "settings#upstream-proxy#error-modal-body-configured": "Siz “upstream proxy” görnüşinde ulanmak üçin sazlandy.<br>\nÝöne, Psiphon-a ol proksi arkaly serwere birikmäni başaranok.<br>\nHaýyş täzeden sazla we täzeden synanyş.",
+  "settings#transport-mode#heading": "Geçirmek Görnüşi",
+  "settings#transport-mode#check-label": "L2TP/IPSec görnüşi ullan",
+  "settings#transport-mode#help-text": "Windows L2TP/IPSec wirtual network-ini ulanýar. Bu görnüş siziň ähli programmalary tunel eder, emma ol güýçli senzuralary geçmekde we gizlin galmakda ukypsyzdyr. Bu böwetli saýtlary geçmek üçin<strong>maslahat berilenok</strong>.",
+  "settings#systray-minimize#heading": "Duýduryş Bölümine Kiçelt  (System Tray)",
+  "settings#systray-minimize#help-text": "Işledilende, kiçeldilen Psiphon programma penjiresi duýduryş bölüminde gizlener.(Windows-da ýumuş çybygynda, sagat görkezijiniň ýanynda ýerleşýän köplenç \"system tray\" ýada \"systray\" atlandyrylýar)",
+  "settings#systray-minimize#reason": "Ýumuş çybygynda yer açmak, duýduryş bölümine (\"system tray\") Psiphon-y kiçeltmek arkaly bolar. Bu Psiphony uzak wagtlap işlemegini kömek eder.",
+  "settings#systray-minimize#enable-label": "Duýduryş bölümine Kiçelt  (System Tray)",
+  "settings#applying-message": "Sazlamalary ulanmak üçin täzeden birikýär.",
+  "settings#saved-message": "Sazlamalar yatda saklanyldy.",
+  "settings#error-modal#title": "Sazlamalar Säwlik",
+  "settings#error-modal#body": "Sazlama hasaplarda näsazlyk bar. Haýyş dowam etmezden öň düzediň.",
+  "feedback#top_content_title": "Seslenme beriň",
+  "feedback#top_para_2": "Iň soňky görnüşi ýüklemek arkaly köp yüze çykan meseleleri düzedip bolar. Siz<a class=\"NewVersionURL\" href=\"#\">şu ýere basyp iň soňky görnüşi ýükläp bilersiňiz</a>, ýada email ugradyp bilersiňiz<a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Siz umumy meseleriň çözgüdini biziń <a class=\"FaqURL\" href=\"#\">Yygy-ýygydan Soralýan Soraglar</a>bölüminde tapyp bilersiñ.",
+  "feedback#smiley_happy": "Psiphon islegime görä birikýär we işleýär.",
+  "feedback#smiley_sad": "Psiphon köplenç birikmegi şowsuz yada kanagatlandyryjy işlemeýär. ",
+  "feedback#text_feedback_prompt": "Haýyş, öz teswiriñizi bu ýere yaz:",
+  "feedback#text_feedback_email_prompt": "Eger-de bizden jogap almagy islesenñiz, onda öz email salgyñyzy su yerde yazyñ:",
+  "feedback#diagnostic_check": "Diagnostiki maglumatlary ýükle. Bellik, bu diagnostiki maglumatlar sizi belli etmez, we ol bize Psiphon kadaly işlemegine kömek eder. <a class=\"dataCollectionInfoURL\" href=\"#\">Biziň nähili maglumat topýanymyzy görmek üçin şu ýere bas.</a>",
+  "feedback#submit_button": "Iber",
+  "feedback#text_feedback_bottom_para": "Eger-de ýokardaky forma işlemeýän bolsa ýa-da ekran suradyny ibermek isleseňiz, haýyş bize<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> email ugradyñ. ",
+  "feedback#success-message": "<strong>Sag Boluň!</strong> Siziň seslenmäňiz iberildi.",
+  "logs#show-debug-label": "\"Debug\" loglary görkez",
+  "logs#placeholder": "Hiç hili loglar ýok",
+  "language#success-message": "<strong>Salam!</strong>Psiphon hoş geldiñiz.",
+  "about#wordart-tag": "Çäklerinden daşarda",
+  "about#description": "Psiphon  <strong>senzuranyň öňüni alyjy enjam</strong>. Senzuralary we böwetli girişleri geçmek üçin dizaýn edilen, çäksiz Internet giriş enjamy. Ol <strong>açyk çeşme</strong> we Kanadanyň Tortonto şäherinde döredilen.",
+  "about#visit-download-site": "Haýyş  <strong><a class=\"NewVersionURL\" href=\"#\">täze görnüşi indirmek</a>ýada<a class=\"InfoURL\" href=\"#\">kömek we maglumat almak üçin</a>websaýta gir. Psiphon Android we Windows üçin elýeterli.",
+  "about#get-by-email": "<strong>eger websaýtda girip bolmasa</strong>, siz Psiphon-yň täze görnüşini almak üçin email ugradyp bilersiňiz:",
+  "about#client-version": "Psiphon Windows müşderi wersiýasy üçin:",
+  "general#modal-close-button": "Ýap",
+  "general#notice-modal-tech-preamble": "Bu ýerde tehnikis äwlik informasiyasini tapyp bilersiñiz:",
+  "notice#systemproxysettings-setproxy-error-title": "Proksi Sistemasynda Säwlik",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistema proksiniň sazlamasy şowsuz.</p>\n<p>Antiwirus programmasy bilen näsazlyk sebäpli bolup biler. Ýerli Psiphon proksini ulanmak üçin siz sazlamalary täzeden elde düzeltmeli. Psiphon proksileri.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon  “<%- data %>” atly Internet baglanşygy üçin sistemanyň proksi sazlanmasy şowsuz. Antiwirus programmasy bilen näsazlyk sebäpli bolup biler. Ýerli Psiphon proksini ulanmak üçin siz sazlamalary täzeden elde düzeltmeli.",
+  "appbackend#state-stopped-title": "Psiphon birikmedi",
+  "appbackend#state-starting-title": "Psiphon birikýär",
+  "appbackend#state-starting-body": "Haýyş garaşyñ...",
+  "appbackend#state-connected-title": "Psiphon birikdi",
+  "appbackend#state-connected-body": "Çäkleriñden daşary syyahat et!",
+  "appbackend#state-connected-reminder-title": "Psiphon sizi birikdirilgi saklar",
+  "appbackend#state-connected-reminder-body": "Psiphony mugut sakla! Biziñ hemaýatkär sahypamyzy görmek üçin śu yere bas!",
+  "appbackend#state-connected-reminder-body-2": "Psiphon-y mugt saklamak üçin, hemayatkär sahypalara geç! ",
+  "appbackend#minimized-to-systray-title": " Duýduryş meýdana göra Psiphon kiçeldildi",
+  "appbackend#minimized-to-systray-body": "Programmany dikeltmek üçin şu şekiljige bas",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Hemaýatkär"
+};
\ No newline at end of file
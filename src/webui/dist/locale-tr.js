@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["tr"].translation = {
+  "banner#long-connecting": "<strong>Olamaz!</strong> Bağlantı kurmakta sorun yaşıyorsunuz gibi görünüyor!<br>\nEn son Psiphon sürümünü <a class=\"NewVersionURL\" href=\"#\">siteden indirerek</a> ya da <a class=\"NewVersionEmail\" href=\"#\"></a> adresine e-posta göndererek edinebilirsiniz.",
+  "nav#connection#starting": "Bağlantı kuruluyor",
+  "nav#connection#connected": "Bağlantı kuruldu",
+  "nav#connection#stopping": "Bağlantı kesiliyor",
+  "nav#connection#stopped": "Bağlantı kesildi",
+  "nav#settings": "Ayarlar",
+  "nav#feedback": "Geri Bildirim",
+  "nav#logs": "Günlükler",
+  "nav#about": "Hakkında",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">bağlantısı kuruluyor</span>…",
+  "connection#stop-btn": "Durdur",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">bağlantısı kuruldu</span>",
+  "connection#disconnect-btn": "Bağlantıyı Kes",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">bağlantısı kesiliyor</span>…",
+  "connection#wait-btn": "Lütfen bekleyin...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">bağlantısı kesildi</span>",
+  "connection#connect-btn": "Bağlan",
+  "connection#egress-region-combo-label": "Sunucu bölgesini seçin",
+  "settings#error-alert": "<strong>Hata!</strong> Lütfen ilerlemeden önce geçersiz değerleri düzeltin.",
+  "settings#reset-button": "Varsayılanı Yükle",
+  "settings#apply-button": "Değişiklikleri Uygula",
+  "settings#unapplied-changes-prompt#title": "Ayarlar Değiştirilmiş",
+  "settings#unapplied-changes-prompt#body": "Ayarlarınızda değişiklik yaptınız ancak bu değişiklikleri uygulamadınız.<br><br>Değişiklikleri uygulamak mı, yok saymak mı istersiniz?",
+  "settings#unapplied-changes-prompt#apply-button": "Uygula",
+  "settings#unapplied-changes-prompt#discard-button": "Yoksay",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec kipi ile çalışmaz.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Ayrık Tünel",
+  "settings#split-tunnel#help-text": "Bu seçenek etkinleştirildiğinde, bulunduğunuz ülkedeki sunuculara yapılan istekler Psiphon tarafından tünelden geçirilmez.",
+  "settings#split-tunnel#reason": "Bulunduğunuz ülkedeki web siteleri genellikle engellenmez. Bu nedenle bu seçeneğin etkinleştirilmesi bu sitelere daha hızlı erişim sağlayarak İSS veri kullanımını da azaltabilir.",
+  "settings#split-tunnel#enable-label": "Ülkenizdeki web siteleri için vekil sunucu kullanılmasın",
+  "settings#disable-timeouts#heading": "Yavaş Bağlantılarda Zaman Aşımı Kullanılmasın",
+  "settings#disable-timeouts#help-text": "Bu seçenek etkinleştirildiğinde, Psiphon sunucusu ile iletişimde zaman aşımı süresi kullanılmaz.",
+  "settings#disable-timeouts#reason": "Bu seçenek etkinleştirildiğinde, çok yavaş bağlantılarda beklenmedik bağlantı kopmaları sorunu daha az yaşanır.",
+  "settings#disable-timeouts#enable-label": "Yavaş bağlantılarda zaman aşımı kullanılmasın",
+  "settings#egress-region#heading": "Psiphon Sunucu Bölgesi",
+  "settings#egress-region#select-best-performance": "En İyi Başarım",
+  "settings#egress-region#select-us": "Birleşik Devletler",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Birleşik Krallık",
+  "settings#egress-region#select-jp": "Japonya",
+  "settings#egress-region#select-sg": "Singapur",
+  "settings#egress-region#select-sk": "Slovakya",
+  "settings#egress-region#select-nl": "Hollanda",
+  "settings#egress-region#select-de": "Almanya",
+  "settings#egress-region#select-in": "Hindistan",
+  "settings#egress-region#select-es": "İspanya",
+  "settings#egress-region#select-hk": "Hong Kong",
+  "settings#egress-region#select-at": "Avusturya",
+  "settings#egress-region#select-be": "Belçika",
+  "settings#egress-region#select-bg": "Bulgaristan",
+  "settings#egress-region#select-ch": "Isviçre",
+  "settings#egress-region#select-cz": "Çekya",
+  "settings#egress-region#select-dk": "Danimarka",
+  "settings#egress-region#select-fr": "Fransa",
+  "settings#egress-region#select-hu": "Macaristan",
+  "settings#egress-region#select-it": "Italya",
+  "settings#egress-region#select-no": "Norveç",
+  "settings#egress-region#select-ro": "Romanya",
+  "settings#egress-region#select-se": "Isveç",
+  "settings#egress-region#select-pl": "Polonya",
+  "settings#egress-region#select-rs": "Sırbistan",
+  "settings#egress-region#select-au": "Avustralya",
+  "settings#egress-region#description": "Bir çok ülkede ve bölgede Psiphon sunucuları bulunuyor. Bulunduğunuz ülkeye yakın bir bölgedeki Psiphon sunucusunuı seçmeniz daha iyi ağ bağlantısı sağlar. Ancak belirli bir ülkedeki web sitesi ve hizmetlerine erişmek istiyorsanız sanal olarak o ülkedeymiş gibi görünmek isteyebilirsiniz.",
+  "settings#egress-region#default": "Varsayılan <strong>“En İyi Başarım”</strong> seçeneği seçildiğinde, Psiphon otomatik olarak genellikle en iyi ağ bağlantısına sahip sunucuyu seçer.",
+  "settings#egress-region#invalid-error-msg": "Geçerli bir Psiphon sunucu bölgesi seçin.",
+  "settings#egress-region#error-modal-title": "Sunucu Bölgesi Kullanılamıyor",
+  "settings#egress-region#error-modal-body-http": "Belirli bir bölgedeki Psiphon sunucusunu kullanmayı seçtiniz.<br>\nAncak bu bölge artık kullanılamıyor.<br>\nYeni bir bölge seçmeli ya da varsayılan \"En İyi Başarım\" seçeneğini seçmelisiniz.",
+  "settings#local-proxy-ports#heading": "Yerel Vekil Sunucu Kapı Numaraları",
+  "settings#local-proxy-ports#leave-blank": "Otomatik kapı numarası seçimi için <strong>boş</strong> bırakın (önerilir).",
+  "settings#local-proxy-ports#reason": "Bilgisayarınızda Psiphon ile çalışabilmesi için el ile yapılandırılması gereken araçlar kullanıyorsanız, Psiphon tarafından hep aynı yerel kapı numaralarının kullanılmasını istersiniz. Özel bir kapı numarası belirtmek için bir nedeniniz yoksa, çakışmaları önlemek için kapı numaralarının Psiphon tarafından otomatik olarak seçilmesine izin vermelisiniz.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 ile 65535 arasında olmalı.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Yerel kapı numaraları birbirinden farklı olmalıdır.",
+  "settings#local-proxy-ports#error-modal-title": "Yerel Vekil Sunucu Kapı Numarası Çakışması",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon HTTP vekil sunucusu için özel bir kapı numarası yapılandırmışsınız.<br>\nAncak bu kapı numarası zaten kullanımda olduğundan Psiphon bunu kullanamaz.\n</p>\n<p>\nLütfen yapılandırılmış HTTP vekil sunucu kapı numarasını değiştirip yeniden deneyin. Bu alanı boş bırakarak kapı numarasının Psiphon tarafından otomatik olarak belirlenmesini sağlamanız önerilir.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon SOCKS vekil sunucusu için özel bir kapı numarası yapılandırmışsınız.<br>\nAncak bu kapı numarası zaten kullanımda olduğundan Psiphon bunu kullanamaz.\n</p>\n<p>\nLütfen yapılandırılmış SOCKS vekil sunucu kapı numarasını değiştirip yeniden deneyin. Bu alanı boş bırakarak kapı numarasının Psiphon tarafından otomatik olarak belirlenmesini sağlamanız önerilir.\n</p>",
+  "settings#upstream-proxy#heading": "Giden Vekil Sunucu",
+  "settings#upstream-proxy#by-default": "Bilgisayarınızda zaten yapılandırılmış bir vekil sunucu varsa, Psiphon bir tünel açarken varsayılan olarak bu vekil sunucuyu kullanır. Bu davranışı değiştirmek için kullanılacak bir vekil sunucu belirtebilirsiniz ya da \"giden vekil sunucu\" ayarını kaldırabilirsiniz.",
+  "settings#upstream-proxy#reason": "Giden vekil sunucular bazen okullar, üniversiteler ya da kurumlar tarafından zorunlu olarak kullanılır. Ağ hizmeti sağlayıcınız giden vekil sunucu ayarları belirtmiş ise, bağlantı kurabilmeniz için bu ayarları el ile yazmanız gerekebilir.",
+  "settings#upstream-proxy#proxy-reqs": "Yalnız HTTPS destekleyen HTTP vekil sunucularına izin verilir.",
+  "settings#upstream-proxy#hostname-label": "Sunucu Adı",
+  "settings#upstream-proxy#port-label": "Kapı No",
+  "settings#upstream-proxy#username-label": "Kullanıcı Adı",
+  "settings#upstream-proxy#password-label": "Parola",
+  "settings#upstream-proxy#domain-label": "Etki Alanı",
+  "settings#upstream-proxy#skip-label": "Giden vekil sunucusu kullanılmasın",
+  "settings#upstream-proxy#set-hostname-error-msg": "Bir sunucu adı yazmalı ya da otomatik seçim için tüm Giden Vekil Sunucu alanlarını boş bırakmalısınız.",
+  "settings#upstream-proxy#set-username-error-msg": "Bir Parola ya da Etki Alanı ayarlıyorsanız bir Kullanıcı Adı yazmalı ya da kimlik doğrulaması yapılmaması için tüm kimlik doğrulama alanlarını boş bırakın.",
+  "settings#upstream-proxy#error-modal-title": "Giden Vekil Sunucu Hatası",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon \"giden vekil sunucusu\" olarak sistem vekil sunucusunu kullanmak üzere yapılandırılmış.<br>\nAncak bu vekil sunucuyu kullanarak bir Psiphon sunucusu ile bağlantı kuramadık.<br>\n\nLütfen \"Giden vekil sunucusu kullanılmasın\" seçeneğini etkinleştirip yeniden deneyin.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon bir \"giden vekil sunucusu\" kullanmak üzere yapılandırılmış.<br>\nAncak bu vekil sunucuyu kullanarak bir Psiphon sunucusu ile bağlantı kuramadık.<br>\n\nLütfen ayarları düzeltip yeniden deneyin.",
+  "settings#transport-mode#heading": "Aktarım Kipi",
+  "settings#transport-mode#check-label": "L2TP/IPSec kipi kullanılsın",
+  "settings#transport-mode#help-text": "Bu seçenek etkinleştirildiğinde, Windows L2TP/IPSec sanal ağını kullanır. Bu kip tüm uygulamalarınızın trafiğini tünelden geçirir ancak herhangi bir gizlenme sağlamaz. Çoğu güvenlik duvarını aşmak için <strong>önerilmez</strong>.",
+  "settings#systray-minimize#heading": "Bildirim Alanına Küçült (Sistem Tepsisi)",
+  "settings#systray-minimize#help-text": "Bu seçenek etkinleştirildiğinde, Psiphon uygulama penceresi simge durumuna küçültüldüğünde bildirim alanına gizlenir (Windows görev çubuğundaki saatin yanında bulunan \"sistem tepsisi\" olarak da bilinir).",
+  "settings#systray-minimize#reason": "Psiphon bildirim alanına (\"sistem tepsisi\") küçültülerek, görev çubuğunda boş alan açılabilir. Psiphon uzun süreler kullanılıyorsa bu seçenek yararlı olabilir.",
+  "settings#systray-minimize#enable-label": "Bildirim alanına küçült (sistem tepsisi)",
+  "settings#applying-message": "Ayarlarınızı uygulamak için yeniden bağlantı kuruluyor.",
+  "settings#saved-message": "Ayarlar kaydedildi.",
+  "settings#error-modal#title": "Ayar Hatası",
+  "settings#error-modal#body": "Ayar değerlerinizde hatalar var. Lütfen ilerlemeden önce bunları düzeltin.",
+  "feedback#top_content_title": "Bize Geri Bildirimde Bulunun",
+  "feedback#top_para_2": "Çoğu sorun en son sürüm indirilerek çözülebilir. <a class=\"NewVersionURL\" href=\"#\">En son sürümü buraya tıklayarak</a>\nya da <a class=\"NewVersionEmail\" href=\"#\"></a> adresine\nbir e-posta göndererek indirebilirsiniz.",
+  "feedback#top_para_3": "Ayrıca yaygın karşılaşılan sorunların çözümlerini <a class=\"FaqURL\" href=\"#\">Sık Sorulan Sorular</a> bölümünde bulabilirsiniz.",
+  "feedback#smiley_happy": "Psiphon istediğim gibi bağlantı kuruyor ve çalışıyor.",
+  "feedback#smiley_sad": "Psiphon genellikle bağlantı kuramıyor ve yeterince iyi çalışmıyor.",
+  "feedback#text_feedback_prompt": "Lütfen yorumlarınızı buraya yazın:",
+  "feedback#text_feedback_email_prompt": "Size yanıt vermemizi isterseniz, lütfen e-posta adresinizi yazın:",
+  "feedback#diagnostic_check": "Kullanım verilerini gönderin. Bu veriler sizin kimliğinizi belirlemek amacıyla değil, Psiphon uygulamasının sorunsuz çalışmasını sağlamamıza yardımcı olması için kullanılır. <a class=\"DataCollectionInfoURL\" href=\"#\">Topladığımız bilgileri buradan görebilirsiniz.</a>",
+  "feedback#submit_button": "Gönder",
+  "feedback#text_feedback_bottom_para": "Yukarıdaki form çalışmıyorsa ya da ekran görüntüleri yollamak isterseniz, lütfen <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> adresini kullanarak bir e-posta gönderin.",
+  "feedback#success-message": "<strong>Teşekkürler!</strong> Geri bildiriminiz gönderildi.",
+  "logs#show-debug-label": "Hata ayıklama günlüğünü görüntüle",
+  "logs#placeholder": "Henüz bir günlük kaydı yok",
+  "language#success-message": "<strong>Merhaba!</strong> Psiphon uygulamasına hoş geldiniz.",
+  "about#wordart-tag": "Sınırları Aşın",
+  "about#description": "Psiphon, bir <strong>sansür aşma aracıdır</strong> — açık İnternet erişimi sağlamak, engellemeleri ve güvenlik duvarlarını aşmak için tasarlanmıştır. <strong>Açık kaynaklıdır</strong> ve Toronto, Kanada'da geliştirilmiştir.",
+  "about#visit-download-site": "Lütfen <strong><a class=\"NewVersionURL\" href=\"#\">yeni sürümü indirmek için</a></strong> ya da <strong><a class=\"InfoURL\" href=\"#\">yardım ve bilgi</a></strong> almak için web sitesini ziyaret edin. Psiphon Android ve Windows üzerinde kullanılabilir.",
+  "about#get-by-email": "<strong>Web sitesine erişilemiyorsa</strong>, son Psiphon sürümünü almak için şu adrese e-posta gönderebilirsiniz:",
+  "about#client-version": "Windows için Psiphon istemci sürümü:",
+  "general#modal-close-button": "Kapat",
+  "general#notice-modal-tech-preamble": "Teknik hata bilgisi şu şekilde:",
+  "notice#systemproxysettings-setproxy-error-title": "Sistem Vekil Sunucu Hatası",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistem vekil sunucu ayarlarını yapamadı.</p>\n<p>Bu soruna anti virüs yazılımınız yol açıyor olabilir. Uygulamanızı ya da sistem vekil sunucu ayarlarını, Psiphon vekil sunucularını kullanacak şekilde el ile yapılandırmanız gerekebilir.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon, “<%- data %>” adındaki İnternet bağlantısı için sistem vekil sunucu ayarlarını yapamadı. Uygulamanızı ya da sistem vekil sunucu ayarlarını Psiphon vekil sunucularını kullanacak şekilde el ile yapılandırmanız gerekebilir.",
+  "appbackend#state-stopped-title": "Psiphon bağlantısı kesildi",
+  "appbackend#state-starting-title": "Psiphon bağlantısı kuruluyor",
+  "appbackend#state-starting-body": "Lütfen bekleyin…",
+  "appbackend#state-connected-title": "Psiphon bağlantısı kuruldu",
+  "appbackend#state-connected-body": "Sınırlarınızın ötesini keşfedin!",
+  "appbackend#state-connected-reminder-title": "Psiphon bağlantınızı koruyor",
+  "appbackend#state-connected-reminder-body": "Tıklayıp destekçi sayfalarımızı açarak Pshiphon uygulamasının ücretsiz kalmasını sağlayın!",
+  "appbackend#state-connected-reminder-body-2": "Destekçi sayfalarımızı açarak Pshiphon uygulamasının ücretsiz kalmasını sağlayın!",
+  "appbackend#minimized-to-systray-title": "Psiphon bildirim alanına küçültüldü",
+  "appbackend#minimized-to-systray-body": "Uygulamayı açmak için simgeye tıklayın",
+  "appbackend#os-unsupported": "Psiphon artık Windows XP ya da Vista desteği vermiyor.\nAyrıntılı bilgi almak için web sitemize bakabilirsiniz.",
+  "psicash#transaction-error-title": "PsiCash işleminde sorun",
+  "psicash#transaction-error-body": "PsiCash işleminiz beklenmedik şekilde tamamlanamadı.",
+  "psicash#transaction-ExistingTransaction-title": "Zaten PsiCash satın alınmış",
+  "psicash#transaction-ExistingTransaction-body": "Zaten bu türde bir PsiCash satın almışsınız. Öncekinin süresi dolmadan bu türde başka bir satın alma yapamazsınız. PsiCash durumunuz şimdi yenilenecek.",
+  "psicash#transaction-InsufficientBalance-title": "PsiCash bakiyesi yetersiz",
+  "psicash#transaction-InsufficientBalance-body": "Bu satın alma için yeterli PsiCash bakiyeniz yok.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash satın alma fiyatı farklı",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash satın alma fiyatları değişmiş. PsiCash durumunuz şimdi yenilenecek.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash satın alma türü bulunamadı",
+  "psicash#transaction-TransactionTypeNotFound-body": "Satın almaya çalıştığınız ürün artık bulunmuyor. Uygulamayı güncellemeniz ya da yeniden kurmanız gerekebilir.",
+  "psicash#transaction-InvalidTokens-title": "PsiCash kodları geçersiz",
+  "psicash#transaction-InvalidTokens-body": "PsiCash kodlarınız geçersiz. Uygulamayı yeniden başlatmayı deneyin. Bu şekilde düzelmez ise, <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">yerel deponuzu temizlemeniz</a> gerekir.",
+  "psicash#transaction-ServerError-title": "PsiCash sunucu sorunu",
+  "psicash#transaction-ServerError-body": "Satın alma işlemi sırasında PsiCash sunucusunda bir sorun çıktı. Lütfen bir süre sonra yeniden satın almayı deneyin.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost, %s süre kullanılabilir",
+  "psicash#ui-zerobalance-title": "Speed&nbsp;Boost! istiyor musunuz?",
+  "psicash#ui-buypsi": "PsiCash Satın Alın",
+  "psicash#ui-buymorepsi": "Daha fazla PsiCash satın alın",
+  "psicash#ui-nsfbalance-buttontext": "Speed&nbsp;Boost! için gereken",
+  "psicash#ui-enoughbalance-buttontext": "Speed&nbsp;Boost! Kullanmaya Başla",
+  "psicash#1-hour": "1 saat",
+  "psicash#1-day": "1 gün",
+  "psicash#ui-buyingboost-buttontext": "Speed&nbsp;Boost! Başlatılıyor",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Bağlantısı Gerekli",
+  "psicash#mustconnect-modal#body": "PsiCash kullanabilmeniz için, Psiphon ağına bağlı olmalısınız.",
+  "psicash#init-error-title": "PsiCash başlatma sorunu",
+  "psicash#init-error-body-unrecovered": "PsiCash hazırlanamadı. Bu durum büyük olasılıkla disk alanının yetersiz olması gibi bir dosya sistemi sorunundan kaynaklanıyor. Bakiyeniz ve diğer durum bilgileriniz kayboldu. PsiCash kullanılamayacak. Sorunu çözmek için uygulamayı yeniden başlatmayı deneyebilirsiniz.",
+  "psicash#init-error-body-recovered": "PsiCash hazırlanamadı. Bu durum büyük olasılıkla disk alanının yetersiz olması gibi bir dosya sistemi sorunundan kaynaklanıyor. Bakiyeniz ve diğer durum bilgileriniz sıfırlandı.",
+  "psicash#psiphon-speed": "Psiphon<br>Hızı",
+  "notice#disallowed-traffic-alert-title": "Psiphon bağlantınızı yükseltin",
+  "notice#disallowed-traffic-alert-body": "</p>Çalışmayan uygulamalar mı var?</p>\n<p>İnternet trafiğinin bir kısmı Speed Boost özelliği etkin olmadan kullanılamaz. Psiphon deneyimini tam olarak yaşamak için PsiCash kullanarak Speed Boost özelliğini etkinleştirin.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Çalışmayan uygulamalar mı var?",
+  "appbackend#disallowed-traffic-notification-body": "Psiphon deneyimini tam olarak yaşamak için PsiCash kullanarak Speed Boost özelliğini etkinleştirin.",
+  "settings#disallowed-traffic-alert#heading": "İzin Verilmeyen Trafik Uyarısı",
+  "settings#disallowed-traffic-alert#help-text": "İnternet trafiğinin bir kısmı Speed Boost özelliği etkin olmadan kullanılamaz. Böyle bir trafik engellendiğinde bir uyarı görüntülenir (yeniden etkinleştirmek için yeniden bağlanmak gerekir).",
+  "settings#disallowed-traffic-alert#disable-label": "İzin verilmeyen trafik uyarıları kapatılsın",
+  "banner#sponsored-by": "Destekleyen"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["uk"].translation = {
+  "banner#long-connecting": "<strong>О ні!</strong>Здається, у вас виникли проблеми з підключенням!<br>\nЗавантажте останню версію Psiphon з <a class=\"NewVersionURL\" href=\"#\">сайту завантаження</a>\nабо надіславши лист на адресу<a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "З'єднання",
+  "nav#connection#connected": "Під'єднано",
+  "nav#connection#stopping": "Від'єднання…",
+  "nav#connection#stopped": "Від'єднано",
+  "nav#settings": "Налаштування",
+  "nav#feedback": "Відгук",
+  "nav#logs": "Журнали",
+  "nav#about": "Про",
+  "connection#starting-msg": "Psiphon <span class=\"state-word\">під'єднується</span>…",
+  "connection#stop-btn": "Зупинити",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\">з'єднано</span>",
+  "connection#disconnect-btn": "Від'єднати",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">від'єднується</span>...",
+  "connection#wait-btn": "Будь ласка, зачекайте ...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">від'єднано</span>",
+  "connection#connect-btn": "З'єднання",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Помилка!</strong>Будь ласка, виправте неправильні значення перед продовження.",
+  "settings#reset-button": "Відновити типові значення",
+  "settings#apply-button": "Застосувати зміни",
+  "settings#unapplied-changes-prompt#title": "Налаштування змінено",
+  "settings#unapplied-changes-prompt#body": "Ви внесли зміни до ваших налаштувань, але не застосували ці зміни.<br><br> Хочете застосувати свої зміни зараз або відмовитися від них?",
+  "settings#unapplied-changes-prompt#apply-button": "Застосувати",
+  "settings#unapplied-changes-prompt#discard-button": "Відкинути",
+  "settings#vpn-incompatible-msg": "(Не працює в режимі  L2TP/IPSec.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Розділити тунель",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Не уповноважувати веб-сайти в межах вашої країни",
+  "settings#disable-timeouts#heading": "Вимкнути час очікування для повільних мереж",
+  "settings#disable-timeouts#help-text": "Якщо ввімкнено, то зв'язок із сервером Psiphon буде працювати без блокування за часом.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Вимкнути час очікування для повільних мереж",
+  "settings#egress-region#heading": "Країна сервера Psiphon",
+  "settings#egress-region#select-best-performance": "Найкраща продуктивність",
+  "settings#egress-region#select-us": "Сполучені Штати",
+  "settings#egress-region#select-ca": "Канада",
+  "settings#egress-region#select-gb": "Велика Британія",
+  "settings#egress-region#select-jp": "Японія",
+  "settings#egress-region#select-sg": "Сінгапур",
+  "settings#egress-region#select-sk": "Словаччина",
+  "settings#egress-region#select-nl": "Нідерланди",
+  "settings#egress-region#select-de": "Німеччина",
+  "settings#egress-region#select-in": "Індія",
+  "settings#egress-region#select-es": "Іспанія",
+  "settings#egress-region#select-hk": "Гонконг",
+  "settings#egress-region#select-at": "Австрія",
+  "settings#egress-region#select-be": "Бельгія",
+  "settings#egress-region#select-bg": "Болгарія",
+  "settings#egress-region#select-ch": "Швейцарія",
+  "settings#egress-region#select-cz": "Чехія",
+  "settings#egress-region#select-dk": "Данія",
+  "settings#egress-region#select-fr": "Франція",
+  "settings#egress-region#select-hu": "Угорщина",
+  "settings#egress-region#select-it": "Італія",
+  "settings#egress-region#select-no": "Норвегія",
+  "settings#egress-region#select-ro": "Румунія",
+  "settings#egress-region#select-se": "Швеція",
+  "settings#egress-region#select-pl": "Польща",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Австралія",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Виберіть доступну країну сервера Psiphon.",
+  "settings#egress-region#error-modal-title": "Країна сервера недоступна",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Локальні проксі-порти",
+  "settings#local-proxy-ports#leave-blank": "Залишити <strong>порожнім</strong> для автоматичного вибору порту (рекомендовано).",
+  "settings#local-proxy-ports#reason": "Якщо ви використовуєте засоби на своєму комп'ютері, які потребують ручного налаштування для роботи з Psiphon, ви хочете, щоб Psiphon постійно використовував ті ж самі локальні номери порту. Якщо у вас немає причини вказати номери портів, ви повинні дозволити Psiphon вибрати їх автоматично, щоб уникнути конфліктів. ",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Має бути від 1 до 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Локальні порти повинні відрізнятись один від одного.",
+  "settings#local-proxy-ports#error-modal-title": "Конфлікт локальних портів проксі",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nВи налаштували Psiphon для використання певного локального порту для свого HTTP-проксі.<br>\nОднак цей порт, вірогідно, вже використовується, тому Psiphon не може його використовувати.\n</p>\n<p>\nБудь ласка, змініть задане значення порту HTTP-проксі і повторіть спробу. Ми рекомендуємо вам очистити значення, щоб Psiphon міг автоматично вибирати доступний порт.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВи налаштували Psiphon для використання певного локального порту для свого проксі-серверу SOCKS.<br>\nОднак цей порт, вірогідно, вже використовується, тому Psiphon не може використати його.\n</p>\n<p>\nБудь ласка, змініть задане значення порту проксі SOCKS та повторіть спробу. Ми рекомендуємо вам очистити значення, щоб Psiphon міг автоматично вибирати доступний порт.\n</p>",
+  "settings#upstream-proxy#heading": "Проксі-сервер вищого рангу",
+  "settings#upstream-proxy#by-default": "Якщо на вашому комп'ютері вже встановлений проксі-сервер, то Psiphon усталено використовуватиме цей проксі-сервер під час встановлення тунелю. Ви можете перевизначити цю поведінку, вказавши проксі для використання або вказавши, що такий \"проксі-сервер вищого рангу\" не варто використовувати.",
+  "settings#upstream-proxy#reason": "Проксі-сервери вищого рангу іноді потрібні школам, університетам або підприємствам. Якщо ваш мережевий провайдер надав вам параметри проксі-сервера вищого рангу, то для встановлення їх вручну може знадобитися під'єднання.",
+  "settings#upstream-proxy#proxy-reqs": "Дозволено лише HTTP проксі, які підтримують HTTPS.",
+  "settings#upstream-proxy#hostname-label": "Назва вузла",
+  "settings#upstream-proxy#port-label": "Порт",
+  "settings#upstream-proxy#username-label": "Ім'я користувача",
+  "settings#upstream-proxy#password-label": "Пароль",
+  "settings#upstream-proxy#domain-label": "Домен",
+  "settings#upstream-proxy#skip-label": "Не використовуйте проксі-сервер на виході",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Помилка проксі-сервера",
+  "settings#upstream-proxy#error-modal-body-default": "В даний час Psiphon налаштований на використання системного проксі-сервера як \"проксі-сервера вищого рангу\" .<br>\nОднак здається, ми не можемо під'єднатися до сервера Psiphon через цей проксі. <br>\nУвімкніть \"Не використовувати проксі-сервер вищого рангу\" і спробуйте ще раз.",
+  "settings#upstream-proxy#error-modal-body-configured": "Ви налаштували Psiphon для використання \"проксі-сервера вищого рангу\" .<br>\nОднак здається, не можемо підключитися до сервера Psiphon через цей проксі. <br>\nВиправте налаштування та повторіть спробу.",
+  "settings#transport-mode#heading": "Режим транспортування",
+  "settings#transport-mode#check-label": "Використовуйте режим L2TP/IPSec",
+  "settings#transport-mode#help-text": "Використання віртуальних мереж Windows L2TP/IPSec. Цей режим буде тунелювати всі ваші додатки, але це не забезпечує затуманення, а тому не має сильних можливостей для обходу цензури. Він <strong>не рекомендується</strong> для обходу більшості брандмауерів.",
+  "settings#systray-minimize#heading": "Згорнути до Області Сповіщення (Системна Панель)",
+  "settings#systray-minimize#help-text": "Якщо ввімкнено, при мінімізації вікно програми Psiphon сховається в область сповіщень (також відома як \"Системна Панель\" або \"Системний лоток\", розташований біля годинника на панелі завдань Windows).",
+  "settings#systray-minimize#reason": "Мінімізація Psiphon до області сповіщення (\"системний лоток\") звільняє місце на панелі завдань. Це особливо корисно, якщо ви часто виконуєте Psiphon протягом тривалого часового періоду .",
+  "settings#systray-minimize#enable-label": "Згорнути до області сповіщень (системний лоток)",
+  "settings#applying-message": "Повторне з'єднання для застосування ваших налаштувань.",
+  "settings#saved-message": "Налаштування збережено.",
+  "settings#error-modal#title": "Помилка налаштування",
+  "settings#error-modal#body": "У ваших значеннях налаштувань є помилки. Будь ласка, виправте їх, перш ніж продовжувати.",
+  "feedback#top_content_title": "Залиште нам свій відгук",
+  "feedback#top_para_2": "Можна виправити багато проблем шляхом завантаження останньої версії. Ви можете <a class=\"NewVersionURL\" href=\"#\">завантажити останню версію, натиснувши тут</a>, або ви можете надіслати електронний лист до <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Ви також можете знайти рішення багатьох поширених проблем у наших <a class=\"FaqURL\" href=\"#\">ЧАстих Питаннях</a>.",
+  "feedback#smiley_happy": "Psiphon з'єднується і виконує так, як я хочу це зробити.",
+  "feedback#smiley_sad": "Psiphon часто не під'єднується або не працює досить добре.",
+  "feedback#text_feedback_prompt": "Будь ласка, введіть свої коментарі тут:",
+  "feedback#text_feedback_email_prompt": "Якщо ви хочете, щоб ми відповіли вам, будь ласка, введіть свою електронну адресу:",
+  "feedback#diagnostic_check": "Завантажте дані діагностики. Зверніть увагу, що ці діагностичні дані не будуть вас ідентифікувати, і це допоможе нам забезпечити гладку роботу Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Натисніть тут, щоб побачити, які дані ми збираємо.</a>",
+  "feedback#submit_button": "Надіслати",
+  "feedback#text_feedback_bottom_para": "Якщо вищенаведена форма не працює, або ви хочете відправити знімки екрану, надішліть нам електронного листа за адресою <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Дякуємо!</strong> Ваш відгук відправлений.",
+  "logs#show-debug-label": "Показати журнали налагодження",
+  "logs#placeholder": "Ще немає журналів",
+  "language#success-message": "<strong>Вітаю!</strong> Ласкаво просимо до Psiphon.",
+  "about#wordart-tag": "За межами кордонів",
+  "about#description": "Psiphon - це інструмент <strong>для обходу цензури</strong> - він розроблений для доступу у відкритий Інтернет, минаючи цензори та брандмауери. Він містить <strong>відкритий код</strong> та розроблений в Торонто, Канада.",
+  "about#visit-download-site": "Будь ласка, відвідайте веб-сайт <strong><a class=\"NewVersionURL\" href=\"#\">, щоб завантажити нову версію </a></strong> або <strong><a class=\"InfoURL\" href=\"#\"> або щоб отримати допомогу та інформацію</a></strong>. Psiphon доступний для Android та Windows.",
+  "about#get-by-email": "<strong>Якщо веб-сайт недоступний</strong>, ви можете отримати нову версію Psiphon, відправивши електронне повідомлення на адресу:",
+  "about#client-version": "Psiphon для клієнтської версії Windows:",
+  "general#modal-close-button": "Закрити",
+  "general#notice-modal-tech-preamble": "Ось технічна інформація про помилку:",
+  "notice#systemproxysettings-setproxy-error-title": "Помилка системного проксі",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не зміг встановити налаштування системного проксі.</p>\n<p>Це може бути пов'язано з конфліктом з антивірусним програмним забезпеченням. Можливо, вам доведеться вручну налаштувати параметри програми або системного проксі-сервера для використання локальних проксі-серверів Psiphon.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon не зміг встановити налаштування проксі-сервера для під'єднання до Інтернету з назвою “<%- data %>”.  Цей конфлікт може бути пов'язаний з антивірусним програмним забезпеченням. Можливо, вам доведеться вручну налаштувати параметри програми або системного проксі-сервера для використання локальних проксі-серверів Psiphon.",
+  "appbackend#state-stopped-title": "Psiphon від'єднаний",
+  "appbackend#state-starting-title": "Psiphon під'єднується",
+  "appbackend#state-starting-body": "Будь ласка, зачекайте ...",
+  "appbackend#state-connected-title": "Psiphon під'єднаний",
+  "appbackend#state-connected-body": "Досліджуйте за межами ваших кордонів!",
+  "appbackend#state-connected-reminder-title": "Psiphon допомагає бути вам на зв'язку",
+  "appbackend#state-connected-reminder-body": "Користуйтесь Psiphon безкоштовно. Натисніть тут, щоб відвідати наші сторінки спонсорів!",
+  "appbackend#state-connected-reminder-body-2": "Користуйтесь Psiphon безкоштовно, відвідавши наші спонсорські сторінки!",
+  "appbackend#minimized-to-systray-title": "Psiphon згорнено до зони сповіщення",
+  "appbackend#minimized-to-systray-body": "Натисніть піктограму, щоб відновити програму",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 година",
+  "psicash#1-day": "1 день",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Спонсорований"
+};
\ No newline at end of file
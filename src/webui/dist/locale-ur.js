@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["ur"].translation = {
+  "banner#long-connecting": "<strong>ارے نہیں!</strong> ایسا لگتا ہے کہ آپ کو رابطے میں مشکل ہو رہی ہے!<br>\n Psiphon (سائفن) کا جدید ورژن ڈاؤن لوڈ کریں<a class=\"NewVersionURL\" href=\"#\"> ڈاؤن لوڈ سائٹ سے</a>\nیا ای میل بھیج کر<a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "منسلک ہو رہا ہے",
+  "nav#connection#connected": "منسلک ہو چکا ہے",
+  "nav#connection#stopping": "منقطع ہو رہا ہے",
+  "nav#connection#stopped": "منقطع ہو گئی",
+  "nav#settings": "ترتیبات",
+  "nav#feedback": "آراؑ",
+  "nav#logs": "لاگز",
+  "nav#about": "کے بارے میں",
+  "connection#starting-msg": "Psiphon (سائفن) <span class=\"state-word\">رابطہ کر رہا ہے</span>۔۔۔ ",
+  "connection#stop-btn": "رک جائیے",
+  "connection#connected-msg": "Psiphon (سائفن) سے <span class=\"state-word\">رابطہ ہو گیا ہے</span>",
+  "connection#disconnect-btn": "منقطع کریں",
+  "connection#stopping-msg": "Psiphon (سائفن) <span class=\"state-word\">منقطع ہو رہا ہے</span>۔۔۔",
+  "connection#wait-btn": "براہِ کرم انتظار کیجئے",
+  "connection#stopped-msg": "Psiphon (سائفن) سے <span class=\"state-word\">رابطہ منقطع ہو گیا ہے</span>",
+  "connection#connect-btn": "رابطہ کریں",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>ایرر!</strong> براہِ کرم آگے بڑھنے سے پہلے غلط اندراج کو درست کیجئے۔",
+  "settings#reset-button": "پہلے سے طے شدہ ترتیبات پر دوبارہ ترتیب دیں۔",
+  "settings#apply-button": "تبدیلیوں کا اطلاق کریں",
+  "settings#unapplied-changes-prompt#title": "ترتیبات تبدیل ہو گئیں",
+  "settings#unapplied-changes-prompt#body": "آپ نے اپنی ترتیبات میں تبدیلیاں کیں ، لیکن آپ نے تبدیلیوں کو لاگو نہیں کیا۔<br><br>کیا آپ ابھی اپنی تبدیلیاں لاگو کرنا چاہتے ہیں یا انہیں موقوف کرنا چاہتے ہیں؟",
+  "settings#unapplied-changes-prompt#apply-button": "لاگو کریں",
+  "settings#unapplied-changes-prompt#discard-button": "موقوف (ڈسکارڈ) کیجیے",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec موڈ کے ساتھ کام نہیں کرتا)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "ٹنل کو تقسیم کریں",
+  "settings#split-tunnel#help-text": "اگر فعال ہوجائے تو آپ کے آبائی ملک میں سرور سے کی جانے والی گزارشات کو Psiphon (سائفن) کے ذریعے ٹنل نہیں کیا جائے گا۔",
+  "settings#split-tunnel#reason": "آپ کے آبائی ملک کی ویب سائٹس عام طور پر بلاک نہیں کی جاتی لہٰذا اس آپشن کو فعال کرنے سے آپ کو ان سائٹس تک تیز رسائی مل جاتی ہے اور اس سے بعض دفعہ انٹرنیٹ سروس پرووائیڈر کے ڈیٹا کو استعمال کرنے کی قیمت ہو سکتی ہے۔",
+  "settings#split-tunnel#enable-label": "اپنے ملک میں ویب سائٹ پراکسی نہ بنائیں۔",
+  "settings#disable-timeouts#heading": "سست نیٹ ورک کے لئے ٹائم آوٹ کو غیر فعال بنائیں",
+  "settings#disable-timeouts#help-text": " اگر فعال ہوجائے تو ، Psiphon (سائفن) سرور کے ساتھ مواصلت کا وقت ختم نہیں ہوگا۔",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "سست نیٹ ورکس کے ٹائم آؤٹ کو غیر فعال کریں",
+  "settings#egress-region#heading": "Psiphon (سائفن) سرور ریجن",
+  "settings#egress-region#select-best-performance": "Best Performance",
+  "settings#egress-region#select-us": "ریاست ہائے متحدہ امریکہ",
+  "settings#egress-region#select-ca": "کنیڈا",
+  "settings#egress-region#select-gb": "برطانیہ",
+  "settings#egress-region#select-jp": "جاپان",
+  "settings#egress-region#select-sg": "سنگا پور",
+  "settings#egress-region#select-sk": "سلوواکیہ",
+  "settings#egress-region#select-nl": "ہالینڈ",
+  "settings#egress-region#select-de": "جرمنی",
+  "settings#egress-region#select-in": "بھارت",
+  "settings#egress-region#select-es": "سپین",
+  "settings#egress-region#select-hk": "ہانگ کانگ",
+  "settings#egress-region#select-at": "آسٹریا",
+  "settings#egress-region#select-be": "بیلجیئم",
+  "settings#egress-region#select-bg": "بلغاریہ",
+  "settings#egress-region#select-ch": "سوئٹزر لینڈ",
+  "settings#egress-region#select-cz": "جمہوریہ چک",
+  "settings#egress-region#select-dk": "ڈنمارک",
+  "settings#egress-region#select-fr": "فرانس",
+  "settings#egress-region#select-hu": "ہنگری",
+  "settings#egress-region#select-it": "اٹلی",
+  "settings#egress-region#select-no": "ناروے",
+  "settings#egress-region#select-ro": "رومانیہ",
+  "settings#egress-region#select-se": "سویڈن",
+  "settings#egress-region#select-pl": "پولینڈ",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Australia",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": " ایک معقول Psiphon (سائفن) سرور ریجن کا انتخاب کریں۔",
+  "settings#egress-region#error-modal-title": "سرور ریجن دستیاب نہیں",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "لوکل پراکسی پورٹس",
+  "settings#local-proxy-ports#leave-blank": "خود کار طریقے سے پورٹ سلیکشن کے لئے <strong>خالی</strong> چھوڑ دیں (تجویز کردہ)۔",
+  "settings#local-proxy-ports#reason": "اگر آپ اپنے کمپیوٹر پر ایسے ٹولز کا استعمال کرتے ہیں جن کے لئے Psiphon (سائفن) کے ساتھ کام کرنے کیلئے دستی ترتیب کی ضرورت ہوتی ہے تو ، آپ چاہیں گے کہ Psiphon (سائفن) اسی مقامی پورٹ نمبر کو مستقل طور پر استعمال کرے۔ اگر آپ کے پاس مخصوص پورٹ نمبرز کی کوئی وجہ نہیں ہے تو ، آپ کو تنازعات سے بچنے میں مدد کے لئے Psiphon (سائفن) کو خود بخود انتخاب کرنے کی اجازت دینی چاہئے۔",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 اور 65535 کے درمیان ہونا چاہیے۔",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "لوکل پورٹس ایک دوسرے سے الگ ہونی چاہئیں۔",
+  "settings#local-proxy-ports#error-modal-title": "لوکل پراکسی پورٹس کا تنازعہ",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nآپ نے Psiphon (سائفن) کو اس کے HTTP پراکسی کے لئے ایک مخصوص لوکل پورٹ استعمال کرنے کے لئے تشکیل دیا ہے۔<br>\n تاہم ،  وہ پورٹ پہلے ہی استعمال میں ہے اور اس لئے Psiphon (سائفن) اسے استعمال نہیں کرسکتی ہے۔\n </p>\n<p>\nبراہ کرم تشکیل شدہ HTTP پراکسی پورٹ ویلیو کو تبدیل کریں اور دوبارہ کوشش کریں۔ ہمارا مشورہ ہے کہ آپ ویلیو کو صاف کریں تاکہ Psiphon (سائفن) خود بخود دستیاب پورٹ منتخب کرسکے۔\n </p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nآپ نے Psiphon (سائفن) کو اس کے SOCKS پراکسی کے لئے ایک مخصوص لوکل پورٹ کا استعمال کرنے کے لئے تشکیل دیا ہے۔<br>\nتاہم ، وہ پورٹ پہلے ہی استعمال میں ہے اور اس لئے Psiphon (سائفن) اسے استعمال نہیں کرسکتی ہے۔\n </p>\n<p>\nبراہ کرم تشکیل شدہ SOCKS پراکسی پورٹ ویلیو کو تبدیل کریں اور دوبارہ کوشش کریں۔ ہمارا مشورہ ہے کہ آپ ویلیو کو صاف کریں تاکہ Psiphon (سائفن) خود بخود دستیاب پورٹ منتخب کرسکے۔\n </p>",
+  "settings#upstream-proxy#heading": "اپ سٹریم پراکسی",
+  "settings#upstream-proxy#by-default": "اگر آپ کا کمپیوٹر کوئی پراکسی پہلے سے تشکیل دے گا تو بائی ڈیفالٹ Psiphon (سائفن) اس پراکسی کو استعمال کرے گا جب کسی ٹنل کا قیام ہو رہا ہو گا۔ آپ کسی پروکسی کی تخصیص کرتے ہوئے اس سلوک کو مسترد کرسکتے ہیں یا پھر یہ وضاحت کرتے ہوئے کہ ایسی کوئی ’’اَپ سٹریم پراکسی‘‘ استعمال نہیں ہونی چاہئے۔",
+  "settings#upstream-proxy#reason": "اسکولوں ، یونیورسٹیوں یا کاروباری اداروں کے ذریعہ بعض اوقات اپ اسٹریم پراکسیز کی ضرورت ہوتی ہے۔ اگر آپ کے نیٹ ورک فراہم کنندہ نے آپ کو اپ اسٹریم پراکسی ترتیبات دے دی ہیں ، تو پھر انہیں دستی طور پر یہاں ترتیب دینے سے رابطہ کرنے کی ضرورت ہوگی۔",
+  "settings#upstream-proxy#proxy-reqs": "صرف ان HTTP پراکسیوں کی ہی اجازت ہے جو HTTPS کی حمایت کرتے ہیں۔",
+  "settings#upstream-proxy#hostname-label": "ھوسٹ کا نام",
+  "settings#upstream-proxy#port-label": "پورٹ",
+  "settings#upstream-proxy#username-label": "صارف کا نام",
+  "settings#upstream-proxy#password-label": "پاس ورڈ",
+  "settings#upstream-proxy#domain-label": "ڈومین",
+  "settings#upstream-proxy#skip-label": "اپ ستریم پراکسی کو استعمال نا کریں",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "اپ ستریم پراکسی ایرر",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon (سائفن) کو فی الحال آپ کے سسٹم پراکسی کو اس کے \"اپ اسٹریم پراکسی\" کے بطور استعمال کرنے کے لئے تشکیل دیا گیا ہے۔<br>\nتاہم ، ایسا لگتا ہے کہ ہم اس پراکسی کے ذریعہ Psiphon (سائفن) سرور سے رابطہ قائم کرنے سے قاصر ہیں۔<br>\nبراہ کرم \"اپ اسٹریم پراکسی استعمال نہ کریں\" کو فعال کریں اور دوبارہ کوشش کریں۔",
+  "settings#upstream-proxy#error-modal-body-configured": "آپ نے \"اپ اسٹریم پراکسی\" کو استعمال کرنے کے لئے Psiphon (سائفن) کو تشکیل دیا ہے۔<br>\nتاہم ، ایسا لگتا ہے کہ ہم اس پراکسی کے ذریعہ Psiphon (سائفن) سرور سے رابطہ قائم کرنے سے قاصر ہیں۔<br>\nبراہ کرم ترتیبات کو ٹھیک کریں اور دوبارہ کوشش کریں۔",
+  "settings#transport-mode#heading": "ٹرانسپورٹ موڈ",
+  "settings#transport-mode#check-label": "L2TP/IPSec موڈ کو  استعمال کریں",
+  "settings#transport-mode#help-text": "ونڈوز L2TP / IPSec ورچوئل نیٹ ورکنگ کا استعمال کرتا ہے۔ یہ موڈ آپ کے سبھی ایپس کو tunnel(ٹنل) میں لے جائے گا ، لیکن اس میں بے دخل نہیں ہوتا ہے اور اسی طرح سنسرشپ سے بچنے کی مضبوط قابلیت نہیں ہے۔ <strong>زیادہ تر فائر والز کو نظرانداز کرنے کی سفارش نہیں کی جاتی ہے</strong>۔",
+  "settings#systray-minimize#heading": "نوٹیفیکیشن ایریا کو کم سے کم کریں (سسٹم ٹرے)",
+  "settings#systray-minimize#help-text": "اگر فعال ہوجائے تو ، جب Psiphon (سائفن) ایپلیکیشن ونڈو کو کم سے کم کیا جائے تو وہ نوٹیفکیشن کے ریجن میں چھپ جائے گی (جسے آپ کے ونڈوز ٹاسک بار پر گھڑی کے قریب واقع \"سسٹم ٹرے\" یا \"سسٹری\" بھی کہتے ہیں)۔",
+  "settings#systray-minimize#reason": "نوٹیفکیشن ایریا (\"سسٹم ٹرے\") میں Psiphon (سائفن) کو کم سے کم کرنا آپ کے ٹاسک بار پر جگہ خالی کردیتی ہے۔ یہ خاص طور پر مددگار ثابت ہوتا ہے اگر آپ اکثر طویل مدت تک Psiphon (سائفن) چلا رہے ہیں۔",
+  "settings#systray-minimize#enable-label": "نوٹیفیکیشن ایریا کو کم سے کم کریں (سسٹم ٹرے)",
+  "settings#applying-message": "اپنی ترتیبات کو لاگو کرنے کے لئے دوبارہ رابطہ قائم کیا جا رہا ہے۔",
+  "settings#saved-message": "ترتیبات کو محفوظ کیا گیا۔",
+  "settings#error-modal#title": "ترتیبات کا ایرر",
+  "settings#error-modal#body": "آپ کی ترتیبات ویلیوز بیں ایرر ہیں، براہ کرم کاروائی کرنے سے پہلے ان کو درست کریں۔",
+  "feedback#top_content_title": "اپنی رائے سےآگاہ کریں",
+  "feedback#top_para_2": "جدید ورژن ڈاؤن لوڈ کرکے بہت ساری پریشانیوں کو حل کیا جاسکتا ہے۔ <a class=\"NewVersionURL\" href=\"#\">آپ یہاں کلک کرکے جدید ترین ورژن ڈاؤن لوڈ کرسکتے ہیں</a>، یا آپ ای میل بھیج سکتے ہیں<a class=\"NewVersionEmail\" href=\"#\"></a>۔",
+  "feedback#top_para_3": " <a class=\"FaqURL\" href=\"#\">FAQ میں</a> آپ بہت ساری عام پریشانیوں کے حل بھی تلاش کرسکتے ہیں۔",
+  "feedback#smiley_happy": "Psiphon (سائفن) کنکٹ ہے اور جس طرح سے میں چاہتا ہوں اس طرح کی کارکردگی کا مظاہرہ کرتا ہے۔",
+  "feedback#smiley_sad": "Psiphon (سائفن) اکثر رابطہ قائم کرنے میں ناکام رہتا ہے یا اچھی کارکردگی کا مظاہرہ نہیں کرتا ہے۔",
+  "feedback#text_feedback_prompt": "برائے مہربانی اپنی رائے یہاں درج کریں:",
+  "feedback#text_feedback_email_prompt": "اگر آپ چاہتے ہیں کہ ہم آپ کو جواب دیں تو ، براہ کرم اپنا ای میل ایڈریس درج کریں:",
+  "feedback#diagnostic_check": "مخصوص ڈیٹا اپ لوڈ کریں۔ براہ کرم نوٹ کریں کہ یہ مخصوص ڈیٹا آپ کی شناخت نہیں کرتا ہے، اور اس سے ہمیں Psiphon (سائفن) کو آسانی سے چلانے میں مدد ملے گی۔ <a class=\"DataCollectionInfoURL\" href=\"#\">ہم نے کون سا ڈیٹا اکٹھا کیا ہے یہ دیکھنے کے لئے یہاں کلک کریں۔</a>",
+  "feedback#submit_button": "جمع کرائیں",
+  "feedback#text_feedback_bottom_para": "اگر مذکورہ بالا فارم کام نہیں کررہا ہے ، یا آپ اسکرین شاٹس بھیجنا چاہتے ہیں تو ، براہ کرم ہمیں ای میل کریں <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>شکریہ!</strong> آپ کی رائے بھیج دی گئی ہے۔",
+  "logs#show-debug-label": "ڈی بگ لاگز دکھائیں",
+  "logs#placeholder": "لاگز ابھی تک نہیں ہے",
+  "language#success-message": "<strong>ہیلو!</strong> Psiphon (سائفن) میں خوش آمدید.",
+  "about#wordart-tag": "سرحدوں کے پار ",
+  "about#description": "Psiphon (سائفن) ایک <strong>سنسرشپ سے بچاؤ کا ٹول</strong> ہے - یہ اوپن انٹرنیٹ ، پچھلے سینسرز اور فائر والز تک رسائی دینے کے لئے تیار کیا گیا ہے۔ یہ <strong>اوپن سورس</strong> ہے اور ٹورنٹو، کینیڈا میں تیار کیا گیا ہے۔\n ",
+  "about#visit-download-site": "براہ مہربانی ویب سائٹ دیکھیں<strong><a class=\"NewVersionURL\" href=\"#\">نیا ورژن ڈاؤن لوڈ کریں</a></strong>یا پھر<strong><a class=\"InfoURL\" href=\"#\">مدد حاصل کریں اور معلومات لیں</a></strong>۔ Psiphon (سائفن) اینڈرائیڈ اور ونڈوز کے لئے دستیاب ہے۔",
+  "about#get-by-email": "<strong>اگر ویب سائٹ دستیاب نہیں ہے</strong>  تو ، آپ اس پتے پر ای میل بھیج کر Psiphon (سائفن)  کا نیا ورژن حاصل کرسکتے ہیں۔",
+  "about#client-version": "ونڈوز کلائنٹ ورژن کے لئے Psiphon (سائفن):",
+  "general#modal-close-button": "بند کیجیے",
+  "general#notice-modal-tech-preamble": "یہاں کچھ تکنیکی غلطیوں کی معلومات ہے:",
+  "notice#systemproxysettings-setproxy-error-title": "سسٹم پراکسی ایرر",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon (سائفن) سسٹم کی پراکسی ترتیبات کو سیٹ کرنے میں ناکام ہے۔</p>\n<p>اس کی وجہ آپ کا اینٹی وآئرس سافٹ وئیر ہو سکتا ہے۔ آپ کو  شاید اپنی ایپلیکشن یا سسٹم پراکسی ترتیبات کو ترتیب دینے کے لئے لوکل Psiphon (سائفن) پراکسیز کو استعمال کرنے کی ضرورت ہے۔</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon (سائفن) \"<%- data %>\" نامی انٹرنیٹ کنکشن کیلئے سسٹم کی پراکسی ترتیبات کو مرتب کرنے میں ناکام ہوا۔ آپ کا اینٹی وائرس سافٹ ویئر ہو سکتا ہے۔  آپ کو مقامی Psiphon (سائفن) پراکسیز استعمال کرنے کیلئے سسٹم پراکسی ترتیبات یا اپنی ایپلی کیشن کو دستی تشکیل دینے کی ضرورت پڑ سکتی ہے۔",
+  "appbackend#state-stopped-title": "Psiphon (سائفن) منقطع ہو گیا ہے",
+  "appbackend#state-starting-title": "Psiphon (سائفن) سے رابطہ ہو رہا ہے",
+  "appbackend#state-starting-body": "براہ کرم انتظار کیجئے",
+  "appbackend#state-connected-title": "Psiphon (سائفن) سے رابطہ ہو گیا ہے",
+  "appbackend#state-connected-body": "سرحدوں کے پار تلاش کریں!",
+  "appbackend#state-connected-reminder-title": "Psiphon (سائفن) آپ کو مربوط رکھتا ہے۔",
+  "appbackend#state-connected-reminder-body": "Psiphon (سائفن) کو مفت رکھے۔ ہمارے سپنسرز صفحات کو ملاحظہ کرنے کے لئے کلک کریں!",
+  "appbackend#state-connected-reminder-body-2": "ہمارے اسپانسر صفحات ملاحظہ کرکے Psiphon (سائفن) کو مفت رکھیں!",
+  "appbackend#minimized-to-systray-title": "Psiphon (سائفن) کو نوٹیفکیشن ایریا میں کم سے کم کردیا گیا ہے",
+  "appbackend#minimized-to-systray-body": "ایپلیکشن کو بحال کرنے کے لئے آئکن پر کلک کریں",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash ٹرانزیکشن میں خرابی۔",
+  "psicash#transaction-error-body": " آپ کے PsiCash ٹرانزیکشن کی کوشش غیر متوقع طور پر ناکام ہوگئی ہے۔",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash خریداری پہلے سے موجود ہے",
+  "psicash#transaction-ExistingTransaction-body": "آپ کے پاس اس طرح کی PsiCash خریداری پہلے سے موجود ہے۔ اسی قسم کی دوسری خریداری کی تب تک اجازت نہیں ہوگی جب تک پچھلی والی زائدالمعیاد نہیں ہوجاتی۔ آپ کی PsiCash حالت اب تازہ دم ہو جائے گی۔",
+  "psicash#transaction-InsufficientBalance-title": "ناکافی PsiCash بیلنس",
+  "psicash#transaction-InsufficientBalance-body": "اس خریداری کیلئے آپ کے پاس زیادہ PsiCash بیلنس نہیں ہے۔ ",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash کی خریداری کیلئے بے جوڑ قیمت",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash خریداری قیمت زائدالمعیاد ہیں۔ آپ کی PsiCash کی موجودہ حالت اب تازہ دم کی جائے گی۔",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash خریداری کی قسم نہیں ملی",
+  "psicash#transaction-TransactionTypeNotFound-body": "جس مصنوعات کو آپ خریدنا چاہتے ہیں وہ کہیں دکھائی نہیں دے رہی۔ آپ کو شاید ایپلی کیشن ری انسٹال یا اَپ ڈیٹ کرنے کی ضرورت پڑے۔",
+  "psicash#transaction-InvalidTokens-title": "غلط PsiCash ٹوکن",
+  "psicash#transaction-InvalidTokens-body": "آپکے PsiCash ٹوکن بے اثر ہوگئے ہیں۔ ایپلی کیشن ری سٹارٹ کرنے کی کوشش کریں۔ اگر یہ کام نا کرے تو آپ کو <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">اپنے لوکل سٹوریج کو صاف</a> کرنے کی ضرورت ہوگی۔",
+  "psicash#transaction-ServerError-title": "PsiCash سرور ایرر",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "رفتار کی ضرورت بوسٹ؟",
+  "psicash#ui-buypsi": "PsiCash خریدیں",
+  "psicash#ui-buymorepsi": "زیادہ PsiCash خریدیں",
+  "psicash#ui-nsfbalance-buttontext": "تیزی کیلئے درکار بوسٹ",
+  "psicash#ui-enoughbalance-buttontext": "تیزی کی ابتدا بوسٹ",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "تیزی کی ابتدا ہو رہی ہے بوسٹ",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon (سائفن) کنکشن کی ضرورت تھی",
+  "psicash#mustconnect-modal#body": "PsiCash استعمال کرنے کیلئے آپ کو Psiphon (سائفن) نیٹ ورک سے منسلک ہونا ضروری ہے۔",
+  "psicash#init-error-title": "PsiCash کی ابتدا میں ایرر",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "تعاون بذریعہ"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["uz@Latn"].translation = {
+  "banner#long-connecting": "<strong>Ana xolos!</strong> Aloqa o‘rnatishda muammolar borga o‘xshaydi!<br>\nPsiphonning oxirgi versiyasini <a class=\"newVersionURL\" href=\"#\">saytimizdan</a>\nyoki <a class=\"NewVersionEmail\" href=\"#\"></a> manziliga xat yuborib olishingiz mumkin.",
+  "nav#connection#starting": "Ulanmoqda",
+  "nav#connection#connected": "Ulandi",
+  "nav#connection#stopping": "Uzilmoqda",
+  "nav#connection#stopped": "Uzilgan",
+  "nav#settings": "Sozlamalar",
+  "nav#feedback": "Fikr-mulohaza",
+  "nav#logs": "Jurnallar",
+  "nav#about": "Brauzer haqida",
+  "connection#starting-msg": "Psiphon tarmoqqa <span class=\"state-word\">ulanmoqda</span>…",
+  "connection#stop-btn": "To‘xtatish",
+  "connection#connected-msg": "Psiphon tarmoqqa <span class=\"state-word\">ulandi</span>",
+  "connection#disconnect-btn": "Aloqani uzish",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">aloqasi uzilmoqda</span>…",
+  "connection#wait-btn": "Iltimos, kuting…",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">aloqasi uzildi</span>",
+  "connection#connect-btn": "Ulanish",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Xato!</strong> Davom etishdan oldin noto‘g‘ri qiymatlarni tuzating.",
+  "settings#reset-button": "Standart sozlamalarni tiklash",
+  "settings#apply-button": "Sozlamalarni qo‘llash",
+  "settings#unapplied-changes-prompt#title": "Sozlamalar o‘zgardi",
+  "settings#unapplied-changes-prompt#body": "Sozlamalarga o‘zgartirish kiritdingiz, lekin ularni qo‘llamadingiz.<br><br>Sozlamalar hozir qo‘llansinmi yoki bekor qilinsinmi?",
+  "settings#unapplied-changes-prompt#apply-button": "Qo‘llash",
+  "settings#unapplied-changes-prompt#discard-button": "Bekor qilish",
+  "settings#vpn-incompatible-msg": "(L2TP/IPSec rejimida ishlamaydi.)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Ajratib shirflash tunneli",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Mamlakatingizdagi saytlarga proksi-server ishlatilmasin",
+  "settings#disable-timeouts#heading": "Tezligi past tarmoqlar uchun kutish vaqtini o‘chirib qo‘yish",
+  "settings#disable-timeouts#help-text": "Bu sozlama yoniq bo‘lsa, Psiphon serveri bilan aloqa uzilmaydi.",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Tezligi past tarmoqlar uchun kutish vaqtini o‘chirib qo‘yish",
+  "settings#egress-region#heading": "Psiphon serveri mintaqasi",
+  "settings#egress-region#select-best-performance": "Yuqori unumdorlik",
+  "settings#egress-region#select-us": "AQSH",
+  "settings#egress-region#select-ca": "Kanada",
+  "settings#egress-region#select-gb": "Buyuk Britaniya",
+  "settings#egress-region#select-jp": "Yaponiya",
+  "settings#egress-region#select-sg": "Singapur",
+  "settings#egress-region#select-sk": "Slovakiya",
+  "settings#egress-region#select-nl": "Niderlandiya",
+  "settings#egress-region#select-de": "Germaniya",
+  "settings#egress-region#select-in": "Hindiston",
+  "settings#egress-region#select-es": "Ispaniya",
+  "settings#egress-region#select-hk": "Gonkong",
+  "settings#egress-region#select-at": "Avstriya",
+  "settings#egress-region#select-be": "Belgiya",
+  "settings#egress-region#select-bg": "Bolgariya",
+  "settings#egress-region#select-ch": "Shveytsariya",
+  "settings#egress-region#select-cz": "Chexiya Respublikasi",
+  "settings#egress-region#select-dk": "Daniya",
+  "settings#egress-region#select-fr": "Fransiya",
+  "settings#egress-region#select-hu": "Vengriya",
+  "settings#egress-region#select-it": "Italiya",
+  "settings#egress-region#select-no": "Norvegiya",
+  "settings#egress-region#select-ro": "Ruminiya",
+  "settings#egress-region#select-se": "Shvetsiya",
+  "settings#egress-region#select-pl": "Polsha",
+  "settings#egress-region#select-rs": "Serbiya",
+  "settings#egress-region#select-au": "Avstraliya",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Yaroqli Psiphon serveri mintaqasini tanlang.",
+  "settings#egress-region#error-modal-title": "Server mintaqasi ish faoliyatida emas",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Mahalliy proksi-server portlari",
+  "settings#local-proxy-ports#leave-blank": "Port avtomatik tanlanishi uchun <strong>bo‘sh qoldiring</strong>  (tavsiya etiladi).",
+  "settings#local-proxy-ports#reason": "Agar kompyuteringizda Psiphonning ma’lum portlari orqali ulanadigan dasturlar bo‘lsa, har doim o‘sha portlarni ishlating. Agar mahalliy portlar muhim bo‘lmasa, Psiphon band bo‘lmasligi uchun ularni avtomatik tanlaydi.",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "1 dan 65535 gacha bo‘lishi shart.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Mahalliy portlar bir biridan farqli bo‘lishi shart.",
+  "settings#local-proxy-ports#error-modal-title": "Mahalliy proksi-server portlari bandligi",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon hozir mahalliy HTTP proksi-server porti orqali ishlashi sozlangan. <br>\nLekin, bu port band yoki ishlamaydi\n</p>\n<p>\nIltimos, boshqa port tanlang yoki Psiphon HTTP proksi-server portini avtomatik tanlashi uchun qiymatini bo‘sh qoldiring.\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon hozir mahalliy SOCKS proksi-server porti orqali ishlashi sozlangan. <br>\nLekin, bu port band yoki ishlamaydi\n</p>\n<p>\nIltimos, boshqa port tanlang yoki Psiphon SOCKS proksi-server portini avtomatik tanlashi uchun qiymatini bo‘sh qoldiring.\n</p>",
+  "settings#upstream-proxy#heading": "Tashqi proksi",
+  "settings#upstream-proxy#by-default": "Agar kompyuteringizda proksi-server sozlangan bo‘lsa, Psiphon tunnel orqali ulanish vaqtida shu proksidan foydalanadi. Siz bu proksi-serverni o‘zgartirishingiz yoki tashqi proksi-serverni umuman taqiqlab qo‘yishingiz mumkin.",
+  "settings#upstream-proxy#reason": "Tashqi proksi-serverlar maktablar, universitetlar va tashkilotlarda ishlatiladi. Agar tarmoqqa ulanishingiz uchun tashqi proksi-server zarur bo‘lsa, ularga ulanishni o‘zingiz sozlashingiz kerak bo‘lishi mumkin.",
+  "settings#upstream-proxy#proxy-reqs": "HTTPS ta’minotiga ega HTTP proksi-serverlar.",
+  "settings#upstream-proxy#hostname-label": "Host nomi",
+  "settings#upstream-proxy#port-label": "Port",
+  "settings#upstream-proxy#username-label": "Foydalanuvchi nomi",
+  "settings#upstream-proxy#password-label": "Parol",
+  "settings#upstream-proxy#domain-label": "Domen",
+  "settings#upstream-proxy#skip-label": "Taqiqlangan tashqi proksi",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Tashqi proksi xatoligi",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon hozir tizim proksi-serveridan “tashqi proksi” sifatida foydalanishga sozlangan.<br>\nLekin, bu proksi-server orqali Psiphon serveriga ulanib bo‘lmayapti.<br>\n“upstream proksi-serverini taqiqlash” bandini yoqing va qaytadan urinib ko‘ring.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon hozir tizim proksi-serveridan “tashqi proksi” sifatida foydalanishga sozlangan.<br>\nLekin, bu proksi-server orqali Psiphon serveriga ulanib bo‘lmayapti.<br>\nSozlamani tuzating va qayta urinib ko‘ring.",
+  "settings#transport-mode#heading": "Aloqa protokoli",
+  "settings#transport-mode#check-label": "L2TP/IPSec rejimidan foydalanish",
+  "settings#transport-mode#help-text": "Windows tizimidagi ichki L2TP/IPSec VPN tarmog‘ini ishlatadi. Bu rejimda barcha dasturlar ulanishlari tunnel orqali shifrlanadi. Lekin bu rejim osongina aniqlanadi va bloklanadi. Ko‘p himoya bloklarni aylanib o‘tishda foydalanish <strong>tavsiya etilmaydi</strong>.",
+  "settings#systray-minimize#heading": "Bildirishnomalar paneliga yig‘ish (vazifalar paneli)",
+  "settings#systray-minimize#help-text": "Agar yoniq bo‘lsa, Psiphon dasturi oynasi bildirishnomalar paneliga yig‘iladi (windows vazifalar panelida soatdan keyin).",
+  "settings#systray-minimize#reason": "Psiphon’ni bildirishnomalar paneliga yig‘ish vazifalar panelida joy bo‘shatadi. Bu Psiphondan ko‘p foydalanishda juda qulay.",
+  "settings#systray-minimize#enable-label": "Bildirishnomalar paneliga yig‘ish (vazifalar paneli)",
+  "settings#applying-message": "Sozlamalaringizni qo‘llash uchun qaytadan ulanmoqda.",
+  "settings#saved-message": "Sozlamalar saqlandi.",
+  "settings#error-modal#title": "Sozlamalarda xato",
+  "settings#error-modal#body": "Sozlamalaringizda xatoliklar bor. Ularni to‘g‘irlang va qaytadan qo‘llang.",
+  "feedback#top_content_title": "Bizga fikr-mulohaza yuboring",
+  "feedback#top_para_2": "Ko‘plab muammolarga oxirgi versiyani yuklab olish yechim bo‘lishi mumkin. Siz <a class=\"newVersionURL\" href=\"#\">bu yerga bosib oxirgi versiyani yuklab olishingiz</a>, yoki <span id=\"newVersionEmail\"></span> manziliga xat yuborib olishingiz mumkin.",
+  "feedback#top_para_3": "Ko‘p tanish muammolar va ularning yechimini bizning <a class=\"faqURL\" href=\"#\">ko‘p so‘ralgan savollar</a> sahifamizdan topish mumkin.",
+  "feedback#smiley_happy": "Psiphon ulanishi va ishlashida muammolar yo‘q.",
+  "feedback#smiley_sad": "Psiphon ba’zida ulanmayapti yoki yaxshi ishlamayapti.",
+  "feedback#text_feedback_prompt": "Bu yerda izoh qoldiring:",
+  "feedback#text_feedback_email_prompt": "Xabaringizga javob olishni xohlasangiz e-pochta manzilingizni kiriting:",
+  "feedback#diagnostic_check": "Diagnostiga hisobotini yuborish. Diagnostik hisobot faylida shaxsiy axborotingiz bo‘lmaydi va tizim yaxshiroq va ishonchliroq bo‘lishini ta’minlaydi. <a class=\"dataCollectionInfoURL\" href=\"#\">Qanday ma’lumotlarni yig‘ishimiz haqida o‘rganish uchun bu yerga bosing.</a>",
+  "feedback#submit_button": "Yuborish",
+  "feedback#text_feedback_bottom_para": "Yuqoridagi shakl ishlamasa yoki skrinshotlar yuborishni istasangiz, <a id=\"emailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> manzilimizga xat yuboring.",
+  "feedback#success-message": "<strong>Rahmat!</strong> Fikr-mulohazalaringiz yuborildi.",
+  "logs#show-debug-label": "Xatolarni ko‘rish jurnali ko‘rsatilsin",
+  "logs#placeholder": "Jurnalda qaydlar yo‘q",
+  "language#success-message": "<strong>Salom!</strong> Psiphonga xush kelibsiz.",
+  "about#wordart-tag": "To‘siqlarsiz",
+  "about#description": "Psiphon – <strong>senzurani aylanib o‘tish vositasi</strong> bo‘lib, Internetni erkin kezishga yordam beradi. Ochiq kodli bu dasturiy ta’minot Kanadaning Toronto shaxrida ishlab chiqilgan.",
+  "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Yangi versiyani yuklab olish</a></strong> yoki <strong><a class=\"InfoURL\" href=\"#\">muammolar bo‘yicha yordam olish</a></strong> uchun saytimizga tashrif buyuring. Psiphon Android va Windows tizimlarida ishlaydi.",
+  "about#get-by-email": "<strong>Agar sayt ish faoliyatida bo‘lmasa</strong>, Psiphonning yangi versiyasini e-pochta orqali olish uchun quyidagi manzilga xat yuboring:",
+  "about#client-version": "Psiphonning Windows mijoz-dasturi versiyasi:",
+  "general#modal-close-button": "Yopish",
+  "general#notice-modal-tech-preamble": "Texnik xatolik axboroti:",
+  "notice#systemproxysettings-setproxy-error-title": "Tizim proksi-serveri xatoligi",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon tizim proksi-serveri sozlamalarini o‘zgartira olmadi.</p>\n<p>Bunga antivirus dasturingiz sabab bo‘lsa kerak. Antivirusda dastur yoki proksi-server sozlamalari mahalliy Psiphon proksi-serveri orqali ishlashini sozlang.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” nomli Internet ulanishini tizim proksi-serveri orqali sozlay olmadi. Bunga antivirus dasturingiz sabab bo‘lsa kerak. Antivirusda dastur yoki proksi-server sozlamalari mahalliy Psiphon proksi-serveri orqali ishlashini sozlang.",
+  "appbackend#state-stopped-title": "Psiphon aloqasi uzildi",
+  "appbackend#state-starting-title": "Psiphon tarmoqqa ulanmoqda",
+  "appbackend#state-starting-body": "Iltimos, kuting…",
+  "appbackend#state-connected-title": "Psiphon tarmoqqa ulandi",
+  "appbackend#state-connected-body": "Internetni to‘siqlarsiz kezing!",
+  "appbackend#state-connected-reminder-title": "Psiphon bilan doim aloqa bo‘lasiz",
+  "appbackend#state-connected-reminder-body": "Psiphonning bepul bo‘lishiga hissa qo‘shing. Homiy sahifalariga o‘tish uchun bu yerga bosing!",
+  "appbackend#state-connected-reminder-body-2": "Psiphonning bepul bo‘lishiga hissa qo‘shing. Homiy sahifalariga o‘tish uchun bu yerga bosing!",
+  "appbackend#minimized-to-systray-title": "Psiphon bildirishnomalar paneliga yig‘ildi",
+  "appbackend#minimized-to-systray-body": "Dasturni yoyish uchun ikonkasi ustiga bosing",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Homiy:"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["vi"].translation = {
+  "banner#long-connecting": "<strong>Ồ!</strong> Bạn dường như gặp khó khăn kết nối!<br>\nTải phiên bản Psiphon mới nhất từ <a class=\"NewVersionURL\" href=\"#\">trang tải xuống</a>\nhoặc gửi email đến <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "Đang kết nối",
+  "nav#connection#connected": "Đã kết nối",
+  "nav#connection#stopping": "Đang ngắt kết nối",
+  "nav#connection#stopped": "Đã dừng kết nối",
+  "nav#settings": "Thiết đặt",
+  "nav#feedback": "Phản hồi",
+  "nav#logs": "Ký sự",
+  "nav#about": "Giới thiệu",
+  "connection#starting-msg": "Psiphon  <span class=\"state-word\">đang kết nối </span>…",
+  "connection#stop-btn": "Dừng ",
+  "connection#connected-msg": "Psiphon <span class=\"state-word\"> được kết nối</span>",
+  "connection#disconnect-btn": "Ngắt kết nối",
+  "connection#stopping-msg": "Psiphon <span class=\"state-word\">đang ngắt kết nối </span>…",
+  "connection#wait-btn": "Xin chờ...",
+  "connection#stopped-msg": "Psiphon <span class=\"state-word\">đã ngắt kết nối </span>",
+  "connection#connect-btn": "Kết nối",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>Có Lỗi!</strong> Vui lòng điều chỉnh các con số sai trước khi tiếp tục.",
+  "settings#reset-button": "Thiết lập lại mặc định",
+  "settings#apply-button": "Áp dụng các thay đổi",
+  "settings#unapplied-changes-prompt#title": "Thiết đặt đã đổi",
+  "settings#unapplied-changes-prompt#body": "Bạn có điều chỉnh các thiết đặt nhưng chưa áp dụng các thay đổi này.<br><br>Bạn có muốn áp dụng các thay đổi này ngay hay bỏ đi?",
+  "settings#unapplied-changes-prompt#apply-button": "Áp dụng",
+  "settings#unapplied-changes-prompt#discard-button": "Hủy bỏ",
+  "settings#vpn-incompatible-msg": "(Không chạy với chế độ L2TP/IPSec)",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "Đường Hầm Tách",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "Đừng proxy các trang web bên trong quốc gia bạn",
+  "settings#disable-timeouts#heading": "Tắt Hạn Chờ cho Mạng Chậm",
+  "settings#disable-timeouts#help-text": "Nếu kích hoạt, việc thông tin liên lạc với máy chủ Psiphon sẽ không bị hết hạn chờ",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "Tắt hạn chờ cho mạng chậm",
+  "settings#egress-region#heading": "Vùng máy chủ Psiphon",
+  "settings#egress-region#select-best-performance": "Hiệu Năng Tốt Nhất",
+  "settings#egress-region#select-us": "Hoa Kỳ",
+  "settings#egress-region#select-ca": "Canada",
+  "settings#egress-region#select-gb": "Anh Quốc",
+  "settings#egress-region#select-jp": "Nhật Bản",
+  "settings#egress-region#select-sg": "Singapore",
+  "settings#egress-region#select-sk": "Slovakia",
+  "settings#egress-region#select-nl": "Hà Lan",
+  "settings#egress-region#select-de": "Đức",
+  "settings#egress-region#select-in": "Ấn Độ",
+  "settings#egress-region#select-es": "Tây Ban Nha",
+  "settings#egress-region#select-hk": "Hồng Kông",
+  "settings#egress-region#select-at": "Áo",
+  "settings#egress-region#select-be": "Bỉ",
+  "settings#egress-region#select-bg": "Bulgaria",
+  "settings#egress-region#select-ch": "Thụy Sĩ",
+  "settings#egress-region#select-cz": "Tiệp",
+  "settings#egress-region#select-dk": "Đan Mạch",
+  "settings#egress-region#select-fr": "Pháp",
+  "settings#egress-region#select-hu": "Hungary",
+  "settings#egress-region#select-it": "Ý",
+  "settings#egress-region#select-no": "Na Uy",
+  "settings#egress-region#select-ro": "Romania",
+  "settings#egress-region#select-se": "Thụy Điển",
+  "settings#egress-region#select-pl": "Ba Lan",
+  "settings#egress-region#select-rs": "Serbia",
+  "settings#egress-region#select-au": "Úc",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "Chọn một khu vực máy chủ Psiphon hợp lệ.",
+  "settings#egress-region#error-modal-title": "Khu Vực Máy Chủ Không Có Sẵn",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "Các cổng Proxy địa phương",
+  "settings#local-proxy-ports#leave-blank": "Để <strong>trống </strong> để tự động chọn cổng (đề nghị).",
+  "settings#local-proxy-ports#reason": "Nếu bạn dùng các công cụ nào trong máy tính mà cần có cấu hình đặc biệt để chạy được với Psiphon, thì bạn nên để Psiphon thường xuyên dùng cùng một cổng địa phương. Nếu bạn không có lý do gì để chọn một cổng nào đó thì nên để cho Psiphon tự động chọn cổng để tránh bị xung khắc. ",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "Phải ở giữa 1 và 65535.",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "Các cổng địa phương phải khác biệt với nhau",
+  "settings#local-proxy-ports#error-modal-title": "Xung đột cổng Proxy địa phương",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\nBạn cấu hình Psiphon dùng một cổng địa phương đặc trung cho proxy HTTP.<br>\nTuy nhiên, cổng đó hình như đã được dùng rồi và Psiphon không thể dùng nó.\n</p>\n<p>\nXin đổi qua cổng khác và thử lại. Chúng tôi đề nghị bạn xóa số cổng để Psiphon tự động chọn một cổng đang còn trống .\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\nBạn cấu hình Psiphon dùng một cổng địa phương đặc trung cho proxy SOCKS.<br>\nTuy nhiên, cổng đó hình như đã được dùng rồi và Psiphon không thể dùng nó.\n</p>\n<p>\nXin đổi qua cổng khác và thử lại. Chúng tôi đề nghị bạn xóa số cổng để Psiphon tự động chọn một cổng đang còn trống.\n</p>",
+  "settings#upstream-proxy#heading": "Proxy luồng trên",
+  "settings#upstream-proxy#by-default": "Nếu máy đã có sẵn cấu hình proxy, theo mặc định Psiphon sẽ dùng proxy đó khi mở đường hầm kết nối an toàn. Bạn có thể lờ cách đó đi bằng cách nêu rõ cần dùng proxy nào, hoặc cho biết là không dùng \"proxy luồng trên\".",
+  "settings#upstream-proxy#reason": "Proxy luồng trên đôi khi cần có cho trường học, đại học, hoặc công ty. Nếu nhà mạng có cung cấp các thiết đặt proxy luồng trên cho bạn, thì cần thiết đặt nơi đây để có thể kết nối.",
+  "settings#upstream-proxy#proxy-reqs": "Chỉ cho phép các proxy HTTP nào hỗ trợ HTTPS",
+  "settings#upstream-proxy#hostname-label": "Tên máy chủ",
+  "settings#upstream-proxy#port-label": "Cổng",
+  "settings#upstream-proxy#username-label": "Tên người dùng",
+  "settings#upstream-proxy#password-label": "Mật khẩu",
+  "settings#upstream-proxy#domain-label": "Tên miền",
+  "settings#upstream-proxy#skip-label": "Đừng dùng proxy luồng trên",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "Lỗi Proxy Luồng Trên",
+  "settings#upstream-proxy#error-modal-body-default": "Psiphon hiện được cấu hình để dùng proxy của hệ thống làm “proxy luồng trên”.<br>\nTuy nhiên, chúng tôi dường như không thể kết nối với máy chủ Psiphon qua proxy đó.<br>\nXin kích hoạt tùy chọn “Đừng dùng proxy luồng trên” và thử lại.",
+  "settings#upstream-proxy#error-modal-body-configured": "Psiphon hiện được cấu hình để dùng proxy của hệ thống làm “proxy luồng trên”.<br>\nTuy nhiên, chúng tôi dường như không thể kết nối với máy chủ Psiphon qua proxy đó.<br>\nXin điều chỉnh lại các thiết đặt và thử lại.",
+  "settings#transport-mode#heading": "Chế Độ Chuyển Giao",
+  "settings#transport-mode#check-label": "Dùng chế độ L2TP/IPSec",
+  "settings#transport-mode#help-text": "Dùng mạng ảo L2TP/IPSec của Windows. Chế độ này sẽ đưa tất cả ứng dụng xuyên qua Psiphon, nhưng không cung cấp việc rối mã và vì thế không có khả năng mạnh mẽ để vượt kiểm duyệt.  <strong>Đề nghị không dùng</strong> để vượt hầu hết tường lửa.",
+  "settings#systray-minimize#heading": "Thu nhỏ vào Vùng Thông Báo (Khay Hệ Thống)",
+  "settings#systray-minimize#help-text": "Nếu bật lên, khi thu nhỏ lại cửa sổ phần mềm Psiphon sẽ ẩn trong vùng thông báo (còn được gọi là \"khay hệ thống\" hay \"systray\", nằm gần đồng hồ trên thanh tác vụ của Windows).",
+  "settings#systray-minimize#reason": "Thu nhỏ Psiphon vào vùng thông báo (\"khay hệ thống\") làm trống chỗ trên thanh tác vụ. Việc này hữu ích nếu bạn thường chạy Psiphon cho một thời gian dài.",
+  "settings#systray-minimize#enable-label": "Thu nhỏ vào vùng thông báo (khay hệ thống)",
+  "settings#applying-message": "Kết nối lại để áp dụng các thiết đặt của bạn.",
+  "settings#saved-message": "Các thiết đặt đã được lưu.",
+  "settings#error-modal#title": "Lỗi thiết đặt",
+  "settings#error-modal#body": "Có lỗi trong các con số thiết đặt. Xin điều chỉnh lại trước khi tiếp tục.",
+  "feedback#top_content_title": "Gửi Phản Hồi của Bạn cho Chúng Tôi",
+  "feedback#top_para_2": "Nhiều vấn đề có thể được khắc phục bằng cách tải phiên bản mới nhất. Bạn có thể <a class=\"NewVersionURL\" href=\"#\">tải phiên bản mới nhất bằng cách nhấp vào đây</a>, hoặc bạn có thể gửi email tới <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+  "feedback#top_para_3": "Bạn cũng có thể tìm thấy các giải pháp cho nhiều vấn đề thông thường trong phần <a class=\"FaqURL\" href=\"#\">Các câu hỏi thường gặp</a>.",
+  "feedback#smiley_happy": "Psiphon kết nối và làm việc đúng theo cách tôi muốn.",
+  "feedback#smiley_sad": "Psiphon thường không kết nối được hay không thực hiện đủ tốt.",
+  "feedback#text_feedback_prompt": "Vui lòng điền góp ý vào đây:",
+  "feedback#text_feedback_email_prompt": "Nếu bạn muốn chúng tôi hồi đáp cho bạn, xin vui lòng cho địa chỉ email của bạn:",
+  "feedback#diagnostic_check": "Tải dữ liệu chẩn đoán lên. Xin lưu ý là dữ liệu chẩn đoán này không nhận diện bạn và nó sẽ giúp chúng tôi làm Psiphon chạy tốt hơn <a class=\"DataCollectionInfoURL\" href=\"#\">Nhấp vào đây để thấy những dữ liệu mà chúng tôi thu thập</a>",
+  "feedback#submit_button": "Gửi",
+  "feedback#text_feedback_bottom_para": "Nếu mẫu đơn trên không dùng được, hoặc bạn muốn gửi các ảnh chụp màn hình, hãy email cho chúng tôi tại  <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+  "feedback#success-message": "<strong>Cám ơn!</strong> Phản hồi của bạn đã được gửi đi.",
+  "logs#show-debug-label": "Xem ký sự gỡ lỗi",
+  "logs#placeholder": "Chưa có ký sự",
+  "language#success-message": "<strong>Xin chào!</strong> Chào mừng bạn đến với Psiphon.",
+  "about#wordart-tag": "Bên Kia Biên Giới",
+  "about#description": "Psiphon là một <strong>công cụ vượt thoát kiểm duyệt </strong> — Được thiết kế để giúp vào mạng Internet mở rộng, vượt qua kiểm duyệt và tường lửa. Psiphon là phần mềm <strong>nguồn mở </strong> và được phát triển tại Toronto, Canada.",
+  "about#visit-download-site": "Xin vào trang web để <strong><a class=\"NewVersionURL\" href=\"#\">tải xuống phiên bản mới</a></strong> hoặc <strong><a class=\"InfoURL\" href=\"#\">được giúp đỡ và có thông tin</a></strong>. Psiphon có các phiên bản cho hệ Android và Windows.",
+  "about#get-by-email": "Nếu trang web không truy cập được, bạn có thể nhận phiên bản mới của Psiphon bằng cách gửi email đến:",
+  "about#client-version": "Phiên bản trình Psiphon cho Windows:",
+  "general#modal-close-button": "Đóng",
+  "general#notice-modal-tech-preamble": "Đây là thông tin kỹ thuật về lỗi:",
+  "notice#systemproxysettings-setproxy-error-title": "Lỗi Proxy Hệ Thống",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon thất bại khi lập các thiết đặt proxy hệ thống.</p>\n<p>Đây có thể vì xung khắc với phần mềm chống vi-rút. Bạn cần cấu hình lại các thiết đặt của ứng dụng hoặc của proxy hệ thống để dùng proxy Psiphon địa phương.</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon thất bại khi lập các thiết đặt proxy hệ thống cho đường kết nối internet mang tên “<%- data %>”. Đây có thể vì xung khắc với phần mềm chống vi-rút. Bạn cần cấu hình lại các thiết đặt của ứng dụng hoặc của proxy hệ thống để dùng proxy Psiphon địa phương.",
+  "appbackend#state-stopped-title": "Psiphon đã ngắt kết nối",
+  "appbackend#state-starting-title": "Psiphon đang kết nối",
+  "appbackend#state-starting-body": "Xin chờ...",
+  "appbackend#state-connected-title": "Psiphon đã kết nối",
+  "appbackend#state-connected-body": "Tìm tòi bên kia biên giới!",
+  "appbackend#state-connected-reminder-title": "Psiphon giúp bạn được kết nối",
+  "appbackend#state-connected-reminder-body": "Giữ Pisphon miễn phí. Bấm vào đây để thăm trang của các nhà bảo trợ!",
+  "appbackend#state-connected-reminder-body-2": "Giữ Pisphon miễn phí bằng cách vào thăm trang của các nhà bảo trợ!",
+  "appbackend#minimized-to-systray-title": "Psiphon đã được thu nhỏ vào vùng thông báo",
+  "appbackend#minimized-to-systray-body": "Bấm vào biểu tượng để phục hồi ứng dụng",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash server error",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 hour",
+  "psicash#1-day": "1 day",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "Được tài trợ bởi"
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["zh"].translation = {
+  "banner#long-connecting": "<strong>真遗憾！</strong>您似乎在连接时遇到了麻烦。<br>\n从<a class=\"NewVersionURL\" href=\"#\">下载网站</a>下载赛风的最新版本，或者向我们发邮件至 <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "正在连接",
+  "nav#connection#connected": "已连接",
+  "nav#connection#stopping": "正在中断连接",
+  "nav#connection#stopped": "已中断连接",
+  "nav#settings": "设置",
+  "nav#feedback": "反馈",
+  "nav#logs": "日志",
+  "nav#about": "关于",
+  "connection#starting-msg": "赛风<span class=\"state-word\">连接中</span>…",
+  "connection#stop-btn": "停止",
+  "connection#connected-msg": "赛风<span class=\"state-word\">已连接</span>",
+  "connection#disconnect-btn": "中断连接",
+  "connection#stopping-msg": "赛风<span class=\"state-word\">断开连接中</span>…",
+  "connection#wait-btn": "请稍候...",
+  "connection#stopped-msg": "赛风<span class=\"state-word\">连接已中断</span>",
+  "connection#connect-btn": "连接",
+  "connection#egress-region-combo-label": "选择服务器地区",
+  "settings#error-alert": "<strong>出错了！</strong>请在继续前修正错误设置值。",
+  "settings#reset-button": "重置为默认值",
+  "settings#apply-button": "应用更改",
+  "settings#unapplied-changes-prompt#title": "设置已更改",
+  "settings#unapplied-changes-prompt#body": "您更改了设置，但尚未应用之。<br><br>请问是要应用更改还是放弃？",
+  "settings#unapplied-changes-prompt#apply-button": "应用",
+  "settings#unapplied-changes-prompt#discard-button": "放弃",
+  "settings#vpn-incompatible-msg": "（不能用于 L2TP/IPSec 模式）",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "拆分隧道",
+  "settings#split-tunnel#help-text": "如果启用，发往你所在国家服务器的请求将不会经过赛风隧道。",
+  "settings#split-tunnel#reason": "您所在国家的网站通常不会被屏蔽，所以启用此选项会让您有更快速的访问这些网站，并且有可能降低ISP数据流量的费用。",
+  "settings#split-tunnel#enable-label": "不代理您所在国家内的网站",
+  "settings#disable-timeouts#heading": "网速过慢的网络禁用超时",
+  "settings#disable-timeouts#help-text": "如果启用，和赛风服务器间的连接将不会超时。",
+  "settings#disable-timeouts#reason": "当您在网速较慢时启用此选项，您网络意外断开的次数将会减少。",
+  "settings#disable-timeouts#enable-label": "慢速网络中禁用超时",
+  "settings#egress-region#heading": "赛风服务器区域",
+  "settings#egress-region#select-best-performance": "最佳性能",
+  "settings#egress-region#select-us": "美国",
+  "settings#egress-region#select-ca": "加拿大",
+  "settings#egress-region#select-gb": "英国",
+  "settings#egress-region#select-jp": "日本",
+  "settings#egress-region#select-sg": "新加坡",
+  "settings#egress-region#select-sk": "斯洛伐克",
+  "settings#egress-region#select-nl": "荷兰",
+  "settings#egress-region#select-de": "德国",
+  "settings#egress-region#select-in": "印度",
+  "settings#egress-region#select-es": "西班牙",
+  "settings#egress-region#select-hk": "香港",
+  "settings#egress-region#select-at": "奧地利",
+  "settings#egress-region#select-be": "比利时",
+  "settings#egress-region#select-bg": "保加利亚",
+  "settings#egress-region#select-ch": "瑞士",
+  "settings#egress-region#select-cz": "捷克共和国",
+  "settings#egress-region#select-dk": "丹麦",
+  "settings#egress-region#select-fr": "法国",
+  "settings#egress-region#select-hu": "匈牙利",
+  "settings#egress-region#select-it": "意大利",
+  "settings#egress-region#select-no": "挪威",
+  "settings#egress-region#select-ro": "罗马尼亚",
+  "settings#egress-region#select-se": "瑞典",
+  "settings#egress-region#select-pl": "波兰",
+  "settings#egress-region#select-rs": "塞尔维亚",
+  "settings#egress-region#select-au": "澳大利亚",
+  "settings#egress-region#description": "赛风在很多不同的国家和地区都有服务器。使用一个距离您近的赛风服务器一般来说可以提供更好的网络连接，但是您也可能想要像真的在某一个国家或地区一样使用网站和服务。",
+  "settings#egress-region#default": "选择默认<strong>“最好性能”</strong>选择可以使赛风自动选择一个最好网络连接的服务器。",
+  "settings#egress-region#invalid-error-msg": "请选择一个有效的赛风服务器区域。",
+  "settings#egress-region#error-modal-title": "服务器区域不可用",
+  "settings#egress-region#error-modal-body-http": "您设置了赛风使用在某一个地区的服务器。<br>\n但是，这个地区已经不再可用。<br>\n您现在必须选择一个新地区或者设置为默认“最好性能”选项。",
+  "settings#local-proxy-ports#heading": "本地代理端口",
+  "settings#local-proxy-ports#leave-blank": "<strong>留空</strong>以自动选择端口（推荐）。",
+  "settings#local-proxy-ports#reason": "如果您在电脑上使用了需要手动配置才能利用赛风的工具，您可能希望赛风始终使用同一个本地端口号。如果您没有特定的理由来指定端口号，您应该允许赛风自动选择端口号，这样可以避免端口冲突。",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "必须在 1 到 65535 之间。",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "本地端口必须互异。",
+  "settings#local-proxy-ports#error-modal-title": "本地代理端口冲突",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\n您已配置赛风使用指定的本地端口开启 HTTP 代理。<br>\n然而，此端口似乎已被占用，赛风无法使用之。\n</p>\n<p>\n请更改配置的 HTTP 代理端口值然后再试。我们建议您清除该值，使赛风自动挑选可用端口。\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\n您已配置赛风使用指定的本地端口开启 SOCKS 代理。<br>\n然而，此端口似乎已被占用，赛风无法使用之。\n</p>\n<p>\n请更改配置的 SOCKS 代理端口值然后再试。我们建议您清除该值，使赛风自动挑选可用端口。\n</p>",
+  "settings#upstream-proxy#heading": "上游代理",
+  "settings#upstream-proxy#by-default": "如果您的电脑已经配置了代理，默认情况下赛风将在建立隧道时使用该代理。您可以变更此行为，指定要使用的代理，或者要求不使用此类“上游代理”。",
+  "settings#upstream-proxy#reason": "有些地方如学校和企业等需要使用上游代理。如果您的网络提供者给过您上层代理的参数，请在此手动设置之以便成功连接。",
+  "settings#upstream-proxy#proxy-reqs": "只允许支持 HTTPS 的 HTTP 代理。",
+  "settings#upstream-proxy#hostname-label": "主机名称",
+  "settings#upstream-proxy#port-label": "端口",
+  "settings#upstream-proxy#username-label": "用户名",
+  "settings#upstream-proxy#password-label": "密码",
+  "settings#upstream-proxy#domain-label": "域名",
+  "settings#upstream-proxy#skip-label": "不使用上游代理",
+  "settings#upstream-proxy#set-hostname-error-msg": "您必须提供一个IP地址，或者为了让系统自动选择将所有的上游代理区域留空。",
+  "settings#upstream-proxy#set-username-error-msg": "您必须提供一个用户名如果您在设置密码或域名；或者为了没有认证将所有的认证方式区域留空。",
+  "settings#upstream-proxy#error-modal-title": "上游代理错误",
+  "settings#upstream-proxy#error-modal-body-default": "赛风当前使用您的系统代理作为其“上层代理”。<br>\n然而，我们似乎无法通过该代理连接到赛风服务器。<br>\n请启用“不使用上游代理”后再试。",
+  "settings#upstream-proxy#error-modal-body-configured": "您已配置赛风使用一个“上游代理”。<br>\n然而，我们似乎无法通过该代理连接到赛风服务器。<br>\n请修正设置后再试。",
+  "settings#transport-mode#heading": "传输模式",
+  "settings#transport-mode#check-label": "使用 L2TP/IPSec 模式",
+  "settings#transport-mode#help-text": "使用 Windows L2TP/IPSec 虚拟网络。此模式将转接您的所有应用程序，但并不提供混淆效果，因此不具有很强的规避审查能力。<strong>不推荐</strong>用它来绕过大多数防火墙。",
+  "settings#systray-minimize#heading": "最小化到通知区域（系统托盘）",
+  "settings#systray-minimize#help-text": "如果启用，在最小化赛风应用程序窗口时，其将会隐藏到通知区域（也称“系统托盘”，位于 Windows 任务栏的时钟区域旁）。",
+  "settings#systray-minimize#reason": "最小化赛风到通知区域（系统托盘）可以释放您的任务栏上的空间。这在您需要长时间运行赛风时非常有益。",
+  "settings#systray-minimize#enable-label": "最小化到通知区域（系统托盘）",
+  "settings#applying-message": "重新连接以应用您的设置。",
+  "settings#saved-message": "设置已保存。",
+  "settings#error-modal#title": "设定错误",
+  "settings#error-modal#body": "设定中有错误，请先更正再继续。",
+  "feedback#top_content_title": "向我们提供您的反馈",
+  "feedback#top_para_2": "许多问题可以通过下载赛风的最新版本解决。您可以<a class=\"NewVersionURL\" href=\"#\">点击这里下载最新版本</a>，或发送电子邮件至<a class=\"NewVersionEmail\" href=\"#\"></a>。",
+  "feedback#top_para_3": "有关许多常见问题的解决方案，请参阅<a class=\"FaqURL\" href=\"#\">常见问题与解答</a>。",
+  "feedback#smiley_happy": "赛风的连接和表现如我所愿。",
+  "feedback#smiley_sad": "赛风经常连接失败或表现不尽如人意。",
+  "feedback#text_feedback_prompt": "请在此输入您的评论：",
+  "feedback#text_feedback_email_prompt": "如果您期望我们回复，请输入您的电子邮件地址：",
+  "feedback#diagnostic_check": "上传诊断数据。请注意，这些诊断数据将帮助我们保持赛风顺畅运行，并无法识别用户。<a class=\"DataCollectionInfoURL\" href=\"#\">点击这里查看我们收集的数据。</a>",
+  "feedback#submit_button": "提交",
+  "feedback#text_feedback_bottom_para": "如果以上表格无法使用，或需发送截图，请发电子邮件至 <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>。",
+  "feedback#success-message": "<strong>谢谢！</strong>您的反馈已经发出。",
+  "logs#show-debug-label": "显示调试日志",
+  "logs#placeholder": "尚无日志",
+  "language#success-message": "<strong>你好！</strong>欢迎使用赛风。",
+  "about#wordart-tag": "超越国界",
+  "about#description": "赛风是一个<strong>规避审查的工具</strong>——旨在提供开放的互联网访问，绕过审核与防火墙。其为<strong>开源软件</strong>，开发于加拿大多伦多。",
+  "about#visit-download-site": "请访问网站以<strong><a class=\"NewVersionURL\" href=\"#\">下载最新版本</a></strong>或者<strong><a class=\"InfoURL\" href=\"#\">获取帮助与相关信息</a></strong>。赛风在 Android 和 Windows 平台上可用。",
+  "about#get-by-email": "<strong>若网站无法访问</strong>，您可以发送邮件至如下地址以获取新版本的赛风：",
+  "about#client-version": "赛风 Windows 客户端版本：",
+  "general#modal-close-button": "关闭",
+  "general#notice-modal-tech-preamble": "这里是技术性的错误信息：",
+  "notice#systemproxysettings-setproxy-error-title": "系统代理错误",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon 更改系统的代理设置失败了。</p>\n<p>这可能是由于和您的防病毒软件冲突所致。您可能需要手动修改应用或系统的代理配置以便使用本地的 Psiphon 代理。</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon 更改名为“<%- data %>”的网络连接的系统代理设置失败了。这可能是由于和您的防病毒软件冲突所致。您可能需要手动修改应用或系统的代理配置以便使用本地的 Psiphon 代理。",
+  "appbackend#state-stopped-title": "Psiphon 已中断连接",
+  "appbackend#state-starting-title": "Psiphon 正在连接",
+  "appbackend#state-starting-body": "请稍候...",
+  "appbackend#state-connected-title": "Psiphon 已连接",
+  "appbackend#state-connected-body": "超越国界开启探索！",
+  "appbackend#state-connected-reminder-title": "赛风正保持已连接状态",
+  "appbackend#state-connected-reminder-body": "维持赛风免费。点击这里访问我们的赞助商页面！",
+  "appbackend#state-connected-reminder-body-2": "通过访问我们的赞助商页面来维持赛风免费！",
+  "appbackend#minimized-to-systray-title": "Psiphon 已最小化到通知区域",
+  "appbackend#minimized-to-systray-body": "点击图标恢复应用程序",
+  "appbackend#os-unsupported": "赛风不再支持Windows XP或者Vista。\n详情请访问赛风的网站。",
+  "psicash#transaction-error-title": "PsiCash交易错误",
+  "psicash#transaction-error-body": "您的PsiCash交易尝试意外失败",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash购买已经存在",
+  "psicash#transaction-ExistingTransaction-body": "您有一个同类型的PsiCash购买记录。当您之前的购买过期之前，同类型的购买将不会被允许。您的PsiCash状态已被刷新。",
+  "psicash#transaction-InsufficientBalance-title": "PsiCash余额不足",
+  "psicash#transaction-InsufficientBalance-body": "您没有足够的PsiCash余额可被用于这次购买。",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash购买价格不匹配",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash购买价格过期。您的PsiCash状态将会被刷新。",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash购买种类没有找到",
+  "psicash#transaction-TransactionTypeNotFound-body": "您正在尝试购买的产品已经不存在。您肯能需要更新或者重新下载软件。",
+  "psicash#transaction-InvalidTokens-title": "PsiCash代币无效",
+  "psicash#transaction-InvalidTokens-body": "您的PsiCash代币无效。您可以尝试重启软件。如果还是无效，您需要<a href=\"https://psiphon3.com/faq.html#clear-windows-data\">清理您的本地存储</a>。",
+  "psicash#transaction-ServerError-title": "PsiCash服务器错误",
+  "psicash#transaction-ServerError-body": "PsiCash服务器在尝试购买时响应错误。请稍后重新尝试购买。",
+  "psicash#ui-speedboost-active": "提&nbsp;速有效 %s",
+  "psicash#ui-zerobalance-title": "需要提&nbsp;速？",
+  "psicash#ui-buypsi": "购买PsiCash",
+  "psicash#ui-buymorepsi": "购买更多的PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "需要提&nbsp;速",
+  "psicash#ui-enoughbalance-buttontext": "开始提&nbsp;速",
+  "psicash#1-hour": "1 小时",
+  "psicash#1-day": "1 天",
+  "psicash#ui-buyingboost-buttontext": "正在提&nbsp;速中！",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "需要连接至赛风",
+  "psicash#mustconnect-modal#body": "您必须连接至赛风服务器，才能使用PsiCash",
+  "psicash#init-error-title": "PsiCash初始化错误",
+  "psicash#init-error-body-unrecovered": "PsiCash初始化失败。这有可能是文件系统的问题，例如没有足够的磁盘空间。您的余额和其他相关信息丢失。PsiCash将会不稳定。您可以通过重启软件从而修复这个问题。",
+  "psicash#init-error-body-recovered": "PsiCash初始化失败。这有可能是文件系统的问题，例如没有足够的磁盘空间。您的余额以及其他相关信息已经被重置。",
+  "psicash#psiphon-speed": "赛风<br>速度",
+  "notice#disallowed-traffic-alert-title": "升级您的赛风链接",
+  "notice#disallowed-traffic-alert-body": "<p>程序不能正常工作?</p>\n<p>有些网络流量需要加速的支持。通过PsiCash购买加速从而解锁赛风体验的全部潜能。</p>",
+  "appbackend#disallowed-traffic-notification-title": "程序不能正常工作?",
+  "appbackend#disallowed-traffic-notification-body": "激活加速从而解锁赛风体验的全部潜能。",
+  "settings#disallowed-traffic-alert#heading": "禁止流量警报",
+  "settings#disallowed-traffic-alert#help-text": "有些网络流量必须有加速服务的支持。当这样的流量被禁止时，一个警告将会弹出。（重新启用这样的流量需要重新连接。）",
+  "settings#disallowed-traffic-alert#disable-label": "禁止禁用流量警告",
+  "banner#sponsored-by": "赞助者："
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+window.PSIPHON.LOCALES["zh_TW"].translation = {
+  "banner#long-connecting": "<strong>真遺憾！</strong>您似乎在連接時遇到了麻煩。<br>\n從<a class=\"NewVersionURL\" href=\"#\">下載網站</a>下載賽風的最新版本，或者向我們發郵件至 <a class=\"NewVersionEmail\" href=\"#\"></a>",
+  "nav#connection#starting": "正在連接",
+  "nav#connection#connected": "已連接",
+  "nav#connection#stopping": "正在中斷連接",
+  "nav#connection#stopped": "已中斷連接",
+  "nav#settings": "設定",
+  "nav#feedback": "回饋",
+  "nav#logs": "日誌",
+  "nav#about": "關於",
+  "connection#starting-msg": "賽風<span class=\"state-word\">連接中</span>…",
+  "connection#stop-btn": "停止",
+  "connection#connected-msg": "賽風<span class=\"state-word\">已連接</span>",
+  "connection#disconnect-btn": "中斷連接",
+  "connection#stopping-msg": "賽風<span class=\"state-word\">斷開連接中</span>…",
+  "connection#wait-btn": "請稍候...",
+  "connection#stopped-msg": "賽風<span class=\"state-word\">連接已中斷</span>",
+  "connection#connect-btn": "連接",
+  "connection#egress-region-combo-label": "Select server region",
+  "settings#error-alert": "<strong>出錯了！</strong>請在繼續前修正錯誤設定值。",
+  "settings#reset-button": "重置為默認值",
+  "settings#apply-button": "應用更改",
+  "settings#unapplied-changes-prompt#title": "設置已更改",
+  "settings#unapplied-changes-prompt#body": "您更改了設置，但尚未啟用之。<br><br>請問是要啟用更改還是放棄？",
+  "settings#unapplied-changes-prompt#apply-button": "應用",
+  "settings#unapplied-changes-prompt#discard-button": "放棄",
+  "settings#vpn-incompatible-msg": "（不能用於 L2TP/IPSec 模式）",
+  "settings#vpn-incompatible-label": "L2TP/IPSec",
+  "settings#split-tunnel#heading": "拆分通道",
+  "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
+  "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
+  "settings#split-tunnel#enable-label": "不代理您所在國家內的網站",
+  "settings#disable-timeouts#heading": "慢速網路請取消暫停功能",
+  "settings#disable-timeouts#help-text": "如果啟動，與Psiphon 伺服器之間的通訊將不會逾時。",
+  "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
+  "settings#disable-timeouts#enable-label": "慢速網路請取消暫停功能",
+  "settings#egress-region#heading": "賽風伺服器區域",
+  "settings#egress-region#select-best-performance": "最佳性能",
+  "settings#egress-region#select-us": "美國",
+  "settings#egress-region#select-ca": "加拿大",
+  "settings#egress-region#select-gb": "英國",
+  "settings#egress-region#select-jp": "日本",
+  "settings#egress-region#select-sg": "新加坡",
+  "settings#egress-region#select-sk": "斯洛伐克",
+  "settings#egress-region#select-nl": "荷蘭",
+  "settings#egress-region#select-de": "德國",
+  "settings#egress-region#select-in": "印度",
+  "settings#egress-region#select-es": "西班牙",
+  "settings#egress-region#select-hk": "香港",
+  "settings#egress-region#select-at": "奧地利",
+  "settings#egress-region#select-be": "比利時",
+  "settings#egress-region#select-bg": "保加利亞",
+  "settings#egress-region#select-ch": "瑞士",
+  "settings#egress-region#select-cz": "捷克共和國",
+  "settings#egress-region#select-dk": "丹麥",
+  "settings#egress-region#select-fr": "法國",
+  "settings#egress-region#select-hu": "匈牙利",
+  "settings#egress-region#select-it": "義大利",
+  "settings#egress-region#select-no": "挪威",
+  "settings#egress-region#select-ro": "羅馬尼亞",
+  "settings#egress-region#select-se": "瑞典",
+  "settings#egress-region#select-pl": "波蘭",
+  "settings#egress-region#select-rs": "塞爾維亞",
+  "settings#egress-region#select-au": "澳洲",
+  "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
+  "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
+  "settings#egress-region#invalid-error-msg": "請選擇一個有效的賽風伺服器區域。",
+  "settings#egress-region#error-modal-title": "伺服器區域不可用",
+  "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
+  "settings#local-proxy-ports#heading": "本地代理端口",
+  "settings#local-proxy-ports#leave-blank": "<strong>留空</strong>以自動選擇端口（推薦）。",
+  "settings#local-proxy-ports#reason": "如果您在電腦上使用了需要手動配置才能利用賽風的工具，您可能希望賽風始終使用同一個本地端口號。如果您沒有特定的理由來指定端口號，您應該允許賽風自動選擇端口號，這樣可以避免端口衝突。",
+  "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
+  "settings#port-value-error-msg": "必須在 1 到 65535 之間。",
+  "settings#local-proxy-ports#socks-label": "SOCKS",
+  "settings#local-proxy-ports#unique-error-msg": "本地端口必須不同。",
+  "settings#local-proxy-ports#error-modal-title": "本地代理端口衝突",
+  "settings#local-proxy-ports#error-modal-body-http": "<p>\n您已配置賽風使用指定的本地端口開啟 HTTP 代理。<br>\n然而，此端口似乎已被占用，賽風無法使用之。\n</p>\n<p>\n請更改配置的 HTTP 代理端口值然後再試。我們建議您清除該值，使賽風自動挑選可用端口。\n</p>",
+  "settings#local-proxy-ports#error-modal-body-socks": "<p>\n您已配置賽風使用指定的本地端口開啟 SOCKS 代理。<br>\n然而，此端口似乎已被占用，賽風無法使用之。\n</p>\n<p>\n請更改配置的 SOCKS 代理端口值後再再試。我們建議您清除該值，使賽風自動挑選可用端口。\n</p>",
+  "settings#upstream-proxy#heading": "上層代理",
+  "settings#upstream-proxy#by-default": "如果您的電腦已經配置了代理，默認情況下賽風將在建立通道時使用該代理。您可以變更此行為，指定要使用的代理，或者要求不使用此類“上層代理”。",
+  "settings#upstream-proxy#reason": "有些地方如學校和企業等需要使用上層代理。如果您的網路提供者給過您上層代理的參數，請在此手動設置之以便成功連接。",
+  "settings#upstream-proxy#proxy-reqs": "只允許支持 HTTPS 的 HTTP 代理。",
+  "settings#upstream-proxy#hostname-label": "主機名稱",
+  "settings#upstream-proxy#port-label": "端口",
+  "settings#upstream-proxy#username-label": "用戶名",
+  "settings#upstream-proxy#password-label": "密碼",
+  "settings#upstream-proxy#domain-label": "域名",
+  "settings#upstream-proxy#skip-label": "不使用上層代理",
+  "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
+  "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
+  "settings#upstream-proxy#error-modal-title": "上層代理錯誤",
+  "settings#upstream-proxy#error-modal-body-default": "賽風當前使用您的系統代理作為其“上層代理”。<br>\n然而，我們似乎無法通過該代理連接到賽風伺服器。<br>\n請啟用“不使用上層代理”后再試。",
+  "settings#upstream-proxy#error-modal-body-configured": "您已配置賽風使用一個“上層代理”。<br>\n然而，我們似乎無法通過該代理連接到賽風伺服器。<br>\n請修正設置後再試。",
+  "settings#transport-mode#heading": "傳輸模式",
+  "settings#transport-mode#check-label": "使用 L2TP/IPSec 模式",
+  "settings#transport-mode#help-text": "使用 Windows L2TP/IPSec 虛擬網路。此模式將轉接您的所有應用程式，但並不提供混淆效果，因此不具有很強的規避審查能力。<strong>不推薦</strong>用它來繞過大多數防火牆。",
+  "settings#systray-minimize#heading": "最小化到通知區域（系統工作列）",
+  "settings#systray-minimize#help-text": "若啟用時最小化賽風應用程式視窗，其將會隱藏到通知區域（也稱“系統工具列”，位於 Windows 任務欄的時鐘區域旁）。",
+  "settings#systray-minimize#reason": "最小化賽風到通知區域（系統工作列）可以釋放您的任務欄上的空間。這在您需要長時間運行賽風時非常有益。",
+  "settings#systray-minimize#enable-label": "最小化到通知區域（系統工作列）",
+  "settings#applying-message": "重新連接以應用您的設置。",
+  "settings#saved-message": "設置已保存。",
+  "settings#error-modal#title": "設定錯誤",
+  "settings#error-modal#body": "設定中有錯誤，請先更正再繼續。",
+  "feedback#top_content_title": "向我們提供您的回饋意見",
+  "feedback#top_para_2": "許多問題可以通過下載賽風的最新版本解決。您可以<a class=\"NewVersionURL\" href=\"#\">點擊這裏下載最新版本</a>，或發送電子郵件至<a class=\"NewVersionEmail\" href=\"#\"></a>。",
+  "feedback#top_para_3": "您也可以在我們的<a class=\"FaqURL\" href=\"#\">常見問題</a>中找到許多常見問題的解決方案。",
+  "feedback#smiley_happy": "賽風的連接和表現如我所願。",
+  "feedback#smiley_sad": "賽風經常連接失敗或表現不盡人意。",
+  "feedback#text_feedback_prompt": "請在此輸入您的評論：",
+  "feedback#text_feedback_email_prompt": "如果您期望我們回覆，請輸入您的電子郵件地址：",
+  "feedback#diagnostic_check": "上傳診斷資料。請注意此診斷資料不會泄露您的身份，它將幫助我們保持賽風平穩運行。<a class=\"DataCollectionInfoURL\" href=\"#\">點擊這裏查看我們收集的資料。</a>",
+  "feedback#submit_button": "提交",
+  "feedback#text_feedback_bottom_para": "如果以上表單無法使用，或者你想發送截圖，請電郵至<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>。",
+  "feedback#success-message": "<strong>謝謝！</strong>您的回饋已經送出。",
+  "logs#show-debug-label": "顯示調試日誌",
+  "logs#placeholder": "尚無日誌",
+  "language#success-message": "<strong>你好！</strong>歡迎使用賽風。",
+  "about#wordart-tag": "超越國界",
+  "about#description": "賽風是一個<strong>規避審查的工具</strong>——旨在提供開放的網路訪問，繞過審查與防火牆。其為<strong>開源軟件</strong>，開發於加拿大多倫多。",
+  "about#visit-download-site": "請訪問網站以<strong><a class=\"NewVersionURL\" href=\"#\">下載最新版本</a></strong>或者<strong><a class=\"InfoURL\" href=\"#\">獲取幫助與相關資訊</a></strong>。賽風在 Android 和 Windows 平台上可用。",
+  "about#get-by-email": "<strong>若網站無法訪問</strong>，您可以發送郵件至如下地址以獲取新版本的賽風：",
+  "about#client-version": "賽風 Windows 客戶端版本：",
+  "general#modal-close-button": "關閉",
+  "general#notice-modal-tech-preamble": "這里是技術性的錯誤信息：",
+  "notice#systemproxysettings-setproxy-error-title": "系統代理錯誤",
+  "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon 更改系統的代理設置失敗了。</p>\n<p>這可能是由於和您的防病毒軟件衝突所致。您可能需要手動修改應用或系統的代理配置以便使用本地的 Psiphon 代理。</p>",
+  "notice#systemproxysettings-setproxy-warning-template": "Psiphon 更改名為“<%- data %>”的網路連接的系統代理設置失敗了。這可能是由於和您的防病毒軟件衝突所致。您可能需要手動修改應用或系統的代理配置以便使用本地的 Psiphon 代理。",
+  "appbackend#state-stopped-title": "Psiphon 已中斷連接",
+  "appbackend#state-starting-title": "Psiphon 正在連接",
+  "appbackend#state-starting-body": "請稍候...",
+  "appbackend#state-connected-title": "Psiphon 已連接",
+  "appbackend#state-connected-body": "探索邊界外面的世界！",
+  "appbackend#state-connected-reminder-title": "賽風可保持連線",
+  "appbackend#state-connected-reminder-body": "維持免費賽風，請點閱此處來訪問贊助者頁面！",
+  "appbackend#state-connected-reminder-body-2": "透過訪問點擊贊助者頁面來維持免費的賽風。",
+  "appbackend#minimized-to-systray-title": "Psiphon 已最小化到通知區域",
+  "appbackend#minimized-to-systray-body": "點擊圖標恢復應用程式",
+  "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
+  "psicash#transaction-error-title": "PsiCash transaction error",
+  "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
+  "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
+  "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-InsufficientBalance-title": "PsiCash餘額不足",
+  "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
+  "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
+  "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
+  "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
+  "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
+  "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
+  "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
+  "psicash#transaction-ServerError-title": "PsiCash 服務器錯誤",
+  "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
+  "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
+  "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
+  "psicash#ui-buypsi": "Buy PsiCash",
+  "psicash#ui-buymorepsi": "Buy more PsiCash",
+  "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
+  "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
+  "psicash#1-hour": "1 小時",
+  "psicash#1-day": "1 天",
+  "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
+  "positive-value-indicator": "+%d",
+  "psicash#mustconnect-modal#title": "Psiphon Connection Required",
+  "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
+  "psicash#init-error-title": "PsiCash initialization error",
+  "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
+  "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
+  "psicash#psiphon-speed": "Psiphon<br>Speed",
+  "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
+  "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
+  "appbackend#disallowed-traffic-notification-title": "Apps not working?",
+  "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
+  "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
+  "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
+  "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
+  "banner#sponsored-by": "贊助者："
+};
\ No newline at end of file
@@ -1,7425 +1,176 @@
 (window.PSIPHON || (window.PSIPHON={})).LOCALES = {
   "am": {
-    "name": "አማርኛ",
-    "translation": {
-      "banner#long-connecting": "<strong> ወይኔ!</strong> ለመገናኘት በሚያደርጉት ጥረት እየተቸገሩ ያሉ ይመስላል! <br>\nየመጨረሻውን የPsiphon ሥሪት <a class=\"NewVersionURL\" href=\"#\">ከማውረጃ ገጹ</a> ላይ ያውርዱ \nወይም ወደ <a class=\"NewVersionEmail\" href=\"#\"></a> ኤፖስታ በመላክ ያግኙ። ",
-      "nav#connection#starting": "በመገናኘት ላይ",
-      "nav#connection#connected": "ተገናኝቷል",
-      "nav#connection#stopping": "ግንኙነት በማቋረጥ ላይ",
-      "nav#connection#stopped": "ግንኙነት ተቋርጧል",
-      "nav#settings": "ቅንብሮች",
-      "nav#feedback": "ግብረመልስ",
-      "nav#logs": "መዝገቦች",
-      "nav#about": "ስለ",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">በመገናኘት ላይ</span> ነው...",
-      "connection#stop-btn": "አቁም",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">ተገናኝቷል</span>",
-      "connection#disconnect-btn": "ግንኙነት አቋርጥ",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">ግንኙነት በማቋረጥ ላይ</span> ነው...",
-      "connection#wait-btn": "እብክዎ ይጠብቁ...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">ግንኙነት አቋርጧል </span>።",
-      "connection#connect-btn": "አገናኝ",
-      "connection#egress-region-combo-label": "የአገልጋይ ቀጠና ምረጥ",
-      "settings#error-alert": "<strong>ስህተት!</strong> ከመቀጠልዎ በፊት እባክዎ የተሳሳቱ ዕሴቶችን ያስተካክሉ።",
-      "settings#reset-button": "ወደ ነባሪ መልስ",
-      "settings#apply-button": "ለውጦቹን ተግብር",
-      "settings#unapplied-changes-prompt#title": "ቅንብሮች ተቀይረዋል",
-      "settings#unapplied-changes-prompt#body": "በቅንብርዎት ላይ ለውጦችን አድርገዋል ነገር ግን ለውጦቹ እንዲተገበሩ አላደረጉም። <br><br>ለውጦችዎን አሁን መተግበር ወይስ ማስወገድ ይፈልጋሉ? ",
-      "settings#unapplied-changes-prompt#apply-button": "ተግብር",
-      "settings#unapplied-changes-prompt#discard-button": "አስወግድ",
-      "settings#vpn-incompatible-msg": "(ከL2TP/IPSec ሁነታ ጋር አይሠራም።)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "መተላለፊያ ዋሻን ክፈል",
-      "settings#split-tunnel#help-text": "ይህ ከነቃ በሀገርዎ ወዳሉ አገልጋዮች የሚቀርቡ ጥያቄዎች በPsiphon ማስተላለፊያ ዋሻዎች አማካኝነት አይተላለፉም። ",
-      "settings#split-tunnel#reason": "በሀገርዎ ያሉ ድረጣቢያዎች አብዛኛውን ግዜ የታገዱ አይደሉም። በመሆኑም ይህንን ምርጫ ማንቃት ለነዚህ ድረጣቢያዎች ፈጣን ተደራሽነት ይሰጣል። አንዳንዴም የኢንተርኔት አግልግሎት ሰጪ የውሂብ ጥቅም ክፍያዎትን ሊቀንስ ይችላል።",
-      "settings#split-tunnel#enable-label": "በሀገርዎ ያሉ ድር ጣቢያዎች በወኪል አይተላለፉ",
-      "settings#disable-timeouts#heading": "ለዝግተኛ አውታረመረቦች የጊዜ እረፍቶችን አቦዝን",
-      "settings#disable-timeouts#help-text": "ይህ ከነቃ ከPsiphon አጋልጋዩ ጋር የሚኖረው ግንኙነት የጊዜ እረፍትን አይወስድም።  ",
-      "settings#disable-timeouts#reason": "ይሄንን ለዘግተኛ አውታረመረብ ግንኙነቶች በሚያበሩበት ጊዜ ያልተጠበቁ የግንኙነት መቋረጦች የመፈጠር ዕድል ይቀንሳል።",
-      "settings#disable-timeouts#enable-label": "ለዝግተኛ አውታረመረቦች የጊዜ እረፍቶችን አቦዝን",
-      "settings#egress-region#heading": "የPsiphon አገልጋይ ቀጠና",
-      "settings#egress-region#select-best-performance": "ከሁሉም የላቀ አፈጻጸም",
-      "settings#egress-region#select-us": "ዩናይትድ ስቴትስ",
-      "settings#egress-region#select-ca": "ካናዳ",
-      "settings#egress-region#select-gb": "ዩናይትድ ኪንግደም",
-      "settings#egress-region#select-jp": "ጃፓን",
-      "settings#egress-region#select-sg": "ሲንጋፖር",
-      "settings#egress-region#select-sk": "ስሎቫኪያ",
-      "settings#egress-region#select-nl": "ኔዘርላንድ",
-      "settings#egress-region#select-de": "ጀርመን",
-      "settings#egress-region#select-in": "ሕንድ",
-      "settings#egress-region#select-es": "ስፔይን",
-      "settings#egress-region#select-hk": "ሆንክ ኮንግ",
-      "settings#egress-region#select-at": "ኦስትሪያ",
-      "settings#egress-region#select-be": "ቤልጂየም",
-      "settings#egress-region#select-bg": "ቡልጋሪያ",
-      "settings#egress-region#select-ch": "ስዊዘርላንድ",
-      "settings#egress-region#select-cz": "ቼክ ሪፐብሊክ",
-      "settings#egress-region#select-dk": "ዴንማርክ ",
-      "settings#egress-region#select-fr": "ፈረንሳይ",
-      "settings#egress-region#select-hu": "ሃንጋሪ",
-      "settings#egress-region#select-it": "ጣሊያን",
-      "settings#egress-region#select-no": "ኖርዌይ",
-      "settings#egress-region#select-ro": "ሮማንያ",
-      "settings#egress-region#select-se": "ስዊድን",
-      "settings#egress-region#select-pl": "ፖላንድ",
-      "settings#egress-region#select-rs": "ሰርቢያ",
-      "settings#egress-region#select-au": "አውስትራሊያ",
-      "settings#egress-region#description": "Psiphon በተለያዩ ሃገራት አገልጋዮች አሉት። አሁን ላሉበት ሃገር ቅርብ የሆነ፣ የPsiphon አገልጋይ ያለበትን ሃገር መጠቀም አብዛኛውን ግዜ የተሻለ የአውታረመረብ ግንኙነት እንዲኖር ያደርጋል፤ ነገር ግን በመረጡት ሀገር ላይ እንደሆኑ መስለው ድረጣቢያን እና አገልግሎቶቹን ማግኘት ይችላሉ።",
-      "settings#egress-region#default": "ነባሪ <strong>\"ከሁሉም የላቀ አፈጻጸም\"</strong> ምርጫ Psiphon በራስ ሠር አገልጋይ እንዲመርጥ ያደርገዋል፤ ይህም ብዙ ግዜ ከሁሉም የላቀ አፈጻጸም እንዲኖር ያደርጋል።",
-      "settings#egress-region#invalid-error-msg": "ተቀባይነት ያለው የPsiphon አገልጋይ ቀጠና ይምረጡ።",
-      "settings#egress-region#error-modal-title": "የአገልጋይ ቀጠና አልተገኘም",
-      "settings#egress-region#error-modal-body-http": "Psiphonን በልዩ ቀጠና ያለን አገልጋይ እንዲጠቀም አዋቅረውታል። <br>\nይሁንና ይህ ቀጠና አሁን የለም።  <br>\nአዲስ ቀጠና መምረጥ ወይም ወደ ነባሪው  “ከሁሉም የላቀ ፍጥነት ያለው ሀገር” ምርጫ መቀየር ይኖርብዎታል።",
-      "settings#local-proxy-ports#heading": "የአካባቢው ወኪል ወደቦች",
-      "settings#local-proxy-ports#leave-blank": "ለራስሠር ወደብ ምርጫ <strong>ባዶ</strong> ይተዉት (የሚመከር)።",
-      "settings#local-proxy-ports#reason": "በኮምፒውተርዎ ላይ ከPsiphon ጋር ለመሥራት የማኑዋል ቅንብርን የሚፈልጉ መሣሪያዎች የሚጠቀሙ ከሆነ Psiphon ተመሳሳይ የሆኑ የአካባቢ ወደብ ቁጥሮችን መጠቀም ያስፈልገዋል። የወደብ ቁጥርን መለየት የማያስፈልግ ከሆነ ግጭቶችን ለማስወገድ Psiphon በራሱ እንዲመርጥ መፍቀድ አለብዎት።",
-      "settings#local-proxy-ports#http-label": "ኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል)/ኤችቲቲፔኤስ (ደህንነቱ የተጠበቀ የዳበረ ጽሁፍ ማስተላለፊያ)",
-      "settings#port-value-error-msg": "በ1 እና 65535 መካከል መሆን አለበት።",
-      "settings#local-proxy-ports#socks-label": "SOCKS ",
-      "settings#local-proxy-ports#unique-error-msg": "የአካባቢ ወደቦች እርስ በርቻቸው የተለዩ መሆን አለባቸው።",
-      "settings#local-proxy-ports#error-modal-title": "የአካባቢ ወኪል ወደቦች ግጭት",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphonን ለኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪል የተለየ የአካባቢ ወደብ እንዲጠቀም አዋቅረውታል።<br>\nይሁንና ይህ ወደብ ጥቅም ላይ እይዋለ ይመስል፤ Psiphon ሊጠቀመው አልቻለም።\n</p>\n<p>\nእባክዎትን የተዋቀረውን የኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪል ወደብ ዕሴት ይቀይሩ እና እንደገና ይሞክሩ። Psiphon በራስሠር ወደብ እንዲመርጥ ዕሴቱን እንዲያጸዱ እንመክራለን።\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphonን ለSOCKS ወኪል የተለየ የአካባቢ ወደብን እንዲጠቀም አዋቅረውታል።<br>\nይሁን እና ይህ ወደብ ጥቅም ላይ እየዋለ ይመስላል፤ Psiphon ሊጠቀመው አልቻለም።\n</p>\n<p>\nእባክዎን የተዋቀረውን የSOCKS ወኪል ወደብ ዕሴት ይቀይሩ እና እንደገና ይሞክሩ። Psiphon በራስሠር ወደብ እንዲመርጥ ዕሴቱን እንዲያጸዱ እንመክራለን።\n</p>",
-      "settings#upstream-proxy#heading": "የላይ ወኪል",
-      "settings#upstream-proxy#by-default": "ኮምፒውተርዎ ቀድሞውኑ የተዋቀረ ወኪል ካለው Psiphon በነባሪው ሁነታ ግንኙነቱን ሲፈጽም ያንን ወኪል ይጠቀማል። ይህንን ባህሪ የተለየ ወኪል እንዲጠቀም ወይም እንደዚህ ያለ ”የላይ ወኪል“  እንዳይጠቀም በመወሰን መቀየር ይችላሉ።",
-      "settings#upstream-proxy#reason": "አንዳንዴ የላይ ወኪልዎች በትምህርት ቤቶች፣ በዩኒቨርስቲዎች ወይም በቢዝነሶች አስፈላጊ ይሆናሉ። የአውታረመረብ አቅራቢዎ የላይ ወኪል ቅንብሮችን የሚሰጥዎት ከሆነ ለመገናኘት እዚህ ጋር በራስዎ ማቀናበር ሊያስፈልግዎ ይችላል።",
-      "settings#upstream-proxy#proxy-reqs": "ኤችቲቲፒኤስ ( ጥብቅ የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል)HTTPSን የሚደግፉ የኤችቲቲፒ (የዳበረ ጽሁፍ ማስተላለፊያ ፕሮቶኮል) ወኪልዎች ብቻ ይፈቀዳሉ። ",
-      "settings#upstream-proxy#hostname-label": "ስመ አስተናጋጅ",
-      "settings#upstream-proxy#port-label": "ወደብ",
-      "settings#upstream-proxy#username-label": "የተጠቃሚ ስም",
-      "settings#upstream-proxy#password-label": "የይለፍ ቃል",
-      "settings#upstream-proxy#domain-label": "ጎራ",
-      "settings#upstream-proxy#skip-label": "የላይ ወኪል አትጠቀም",
-      "settings#upstream-proxy#set-hostname-error-msg": "ስመ አስተናጋጅ ማቅረብ ይኖርብወታል ወይም ደግሞ የላዥረት ወኪል መስክ ባዶ ይተዉ ለራስሠር ምርጫ።",
-      "settings#upstream-proxy#set-username-error-msg": "የተጠቃሚ ስም ማቅረብ ይኖርብወታል የይለፍ ቃል ወይም ጎራ የሚያዋቅሩ ከሆነ፤ ወይም ደግሞ ሁሉንም የማረጋገጫ ዘርፍ ባዶ ይተዉ ማረጋገጫ ላለመጠቀም።",
-      "settings#upstream-proxy#error-modal-title": "የላይ ወኪል ስህተት ",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon በአሁኑ ሰአት የተዋቀረው የሥርአት ወኪልዎን እንደ “የላይ ወኪል” እንዲጠቀም ተደርጎ ነው። <br>\nይሁንና ያንን ወኪል በመጠቀም ከPsiphon አገልጋይ ጋር መገናኘት አልቻልንም።   <br>\nእባክዎን “የላይ ወኪልን አትጠቀም”  የሚለውን ያንቁ እና እንደገና ይሞክሩ።",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphonን “የላይ ወኪል” እንዲጠቀም አድርገው አዋቅረውታል ። <br>\nይሁንና ይህንን ወኪል በመጠቀም ከPsiphon አገልጋይ ጋር መገናኘት አልቻልንም።   <br>\nእባክዎን መዋቅሩን ያስተካክሉ እና እንደገና ይሞክሩ።",
-      "settings#transport-mode#heading": "ትራንስፖርት ሁነታ",
-      "settings#transport-mode#check-label": "የL2TP/IPSec ሁነታን ተጠቀም",
-      "settings#transport-mode#help-text": "የWindows L2TP/IPSec ምናባዊ አውታረመረብን ይጠቀማል። ይህ ሁነታ ለሁሉም መተግበሪያዎች መተላለፊያ ይፈጥራል ነገር ግን ጥብቅ ስላልሆነ ጠንካራ ሳንሱርን የማለፊያ ችሎታዎች የሉትም። አብዛኛዎቹን ኬላዎችን ለማለፊያነት መጠቀም <strong>አይመከርም</strong>።",
-      "settings#systray-minimize#heading": "ወደ ማሳወቂያ ቦታዎች አሳንስ (የሥርአት ትሪ)",
-      "settings#systray-minimize#help-text": "ካነቁት ሲያሳንሱት የPsiphon መተግበሪያ መስኮት ወደ ማሳወቂያ ስፍራው ይደበቃል ( ይህ “የሥርአት ትሪ” ወይም “ሢስትሪ” በመባል የሚታወቅ ሲሆን በዊንዶውስ የተግባር አሞሌ ከሰአቱ አጠገብ ይገኛል)።",
-      "settings#systray-minimize#reason": "Psiphonን ወደ ማሳወቂያ ቦታዎች (የሥርአት ትሪ) ማሳነስ የተግባር  አሞሌዎ ላይ ክፍት ቦታ ይፈጥራል። ይህ በተለይ Psiphonን ለረጅም ሰአት የሚያሠሩ ከሆነ ይጠቅማል። ",
-      "settings#systray-minimize#enable-label": "ወደ ማሳወቂያ ቦታዎች አሳንስ (የሥርአት ትሪ)",
-      "settings#applying-message": "ቅንብርችዎን ለመተግበር እንደገና በመገናኘት ላይ ነው። ",
-      "settings#saved-message": "ቅንብሩ ተቀምጧል።",
-      "settings#error-modal#title": "የቅንብሮች ስህተት",
-      "settings#error-modal#body": "በቅንብርዎት ዕሴትዎች ላይ ስህተቶች አሉ። ከመቀጠልዎ በፊት እባክዎ ያስተካክሏቸው።",
-      "feedback#top_content_title": "ግብረመልስ ይላኩልን",
-      "feedback#top_para_2": "ብዙ ችግሮች የመጨረሻውን ሥሪት በማውረድ ሊፈቱ ይችላሉ። የ<a class=\"NewVersionURL\" href=\"#\">የመጨረሻውን ሥሪት ይህንን ጠቅ በማድረግ ማውረድ ይችላሉ</a> ወይም ወደ <a class=\"NewVersionEmail\" href=\"#\"></a> ኤፖስታ መላክ ይችላሉ።",
-      "feedback#top_para_3": "በተጨማሪም ለብዙ የተለመዱ ችግሮች መፍትሄዎችን<a class=\"FaqURL\" href=\"#\"> በተደጋጋሚ የሚጠየቁ ጥያቄዎች እና መልሶቻቸው</a> ክፍል ሊያገኙ ይችላሉ።",
-      "feedback#smiley_happy": "Psiphon የሚገናኘው እና የሚሠራው እኔ በምፈልገው መንገድ ነው። ",
-      "feedback#smiley_sad": "አብዛኛውን ጊዜ Psiphon ሳይገናኝ ወይም በደንብ ሳይሠራ ይቀራል። ",
-      "feedback#text_feedback_prompt": "እባክዎን አስተያየትዎን እዚህ ጋር ያስገቡ፡-",
-      "feedback#text_feedback_email_prompt": "ምላሽ እንድንሰጥዎት የሚፈልጉ ከሆነ እባክዎን የኤፖስታ አድራሻዎትን አዚህ ጋር ያስገቡ፡-",
-      "feedback#diagnostic_check": "የምርመራ ውሂብ ይስቀሉ። ይህ የምርመራ ውሂብ ማንነትዎን አያጋልጥም፤ Psiphonን ያለምንም ችግር እንድናሠራ የሚረዳ ነው። <a class=\"DataCollectionInfoURL\" href=\"#\">ምን አይነት ውሂብ እንደምንሰበስብ ለማየት ይህንን ጠቅ ያድርጉ </a>።",
-      "feedback#submit_button": "አስገባ",
-      "feedback#text_feedback_bottom_para": "ከላይ ያለው ቅጽ የማይሠራ ከሆነ ወይም ቅጽበታዊ ገጽ እይታን መላክ የሚፈልጉ ከሆነ እባክዎን በ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ኤፖስታ ይላኩልን። ",
-      "feedback#success-message": "<strong>እናመሰግናለን!</strong> ግብረመልስዎ ተልኳል።",
-      "logs#show-debug-label": "የስህተት መዝገቦችን አሳይ",
-      "logs#placeholder": "እስካሁን ምንም መዝገብ የለም",
-      "language#success-message": "<strong>ሰላም!</strong> ወደ Psiphon እንኳን ደህና መጡ።",
-      "about#wordart-tag": "ከድምበር ባሻገር",
-      "about#description": "Psiphon <strong> ሳንሱር የማለፊያ መሣሪያ </strong>ሲሆን ክፍት የኢንተርኔት አገልግሎትን ለማግኘት፣ ሳንሱር እና ኬላን ለማለፍ የተሠራ ነው። <strong>ምንጨ ክፍት </strong> ሲሆን የበለጸገው በቶሮንቶ፣ ካናዳ ነው።",
-      "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">አዲስ ሥሪትን ለማውረድ</a></strong> ወይም <strong><a class=\"InfoURL\" href=\"#\">እርዳታ እና መረጃን ለማግኘት</a></strong> እባክዎን ድረጣቢያውን ይጎብኙ። Psiphon ለAndroid እና ለWindows ይገኛል።",
-      "about#get-by-email": "<strong>ድረጣቢያው የማይገኝ ከሆነ</strong> የPsiphonን አዲስ ሥሪት ወደዚህ አድራሻ ኤፖስታ በመላክ ማግኘት ይችላሉ፡-",
-      "about#client-version": "Psiphon ለWindows ተጠቃሚ ሥሪት፡-",
-      "general#modal-close-button": "ዝጋ",
-      "general#notice-modal-tech-preamble": "የቴክኒክ ስህተቶች መረጃ ይኸው፡- ",
-      "notice#systemproxysettings-setproxy-error-title": "የሥርአት ወኪል ስህተት",
-      "notice#systemproxysettings-setproxy-error-body": "<p>ሳይፈን የሥርአቱን ወኪል ቅንብር ማዋቀር አልቻለም።</p>\n<p> ይህ ከጸረ ቫይረስ ሶፍትዌርዎ ጋር ግጭት ውስጥ ስለገባ ሊሆን ይችላል። የአካባቢው Psiphon ወኪልዎችን ለመጠቀም የመተግበሪያዎን ወይም የሥርአት ወኪል ቅንብሮን በራስዎ ማዋቀር ሊያስፈልግዎ ይችላል።</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” ለተባለ የኢንተርኔት ግንኙነት የሥርአቱን ወኪል ቅንብር ማዋቀር አልቻለም። ይህ ከጸረ ቫይረስ ሶፍትዌርዎ ጋር ግጭት ውስጥ ስለገባ ሊሆን ይችላል። የአካባቢው Psiphon ወኪልዎችን ለመጠቀም የመተግበሪያዎን ወይም የሥርአት ወኪል ቅንብሮን በራስዎ ማዋቀር ሊያስፈልግዎ ይችላል።",
-      "appbackend#state-stopped-title": "Psiphon ግንኙነት አቋርጧል",
-      "appbackend#state-starting-title": "Psiphon በመገናኘት ላይ ነው",
-      "appbackend#state-starting-body": "እብክዎ ይጠብቁ...",
-      "appbackend#state-connected-title": "Psiphon ተገናኝቷል",
-      "appbackend#state-connected-body": "ከድምበርዎት ባሻገር ያስሱ!",
-      "appbackend#state-connected-reminder-title": "Psiphon ተገናኝተው እንዲቆዩ  እያደረገ ነው",
-      "appbackend#state-connected-reminder-body": "Psiphonን ከክፍያ ነጻ አድርገው ያቆዩ። የስፖንሰር ገጾቻችንን  ለመጎብኘት እዚህ ጋር ጠቅ ያድርጉ!",
-      "appbackend#state-connected-reminder-body-2": "የስፖንሰሮቻችንን ገጾች በመጎብኘት Psiphonን ከክፍያ ነጻ አድርገው ያቆዩት! ",
-      "appbackend#minimized-to-systray-title": "Psiphon ወደ ማሳወቂያ ስፍራ አንሷል ",
-      "appbackend#minimized-to-systray-body": "መተግበሪያውን ለመመለስ አዶው ላይ ጠቅ ያድርጉ",
-      "appbackend#os-unsupported": "Psiphonን በWindows XP እና VISTA መጠቀም አይችሉም። ለተጨማሪ መረጃ ድር ጣቢያችንን ይጎብኙ።",
-      "psicash#transaction-error-title": "የPsiCash ግብይት ስህተት",
-      "psicash#transaction-error-body": "የእርስዎ PsiCash ግብይት ሙከራ ባልተጠበቀ ሁኔታ ሳይሳካ ቀርቷል።",
-      "psicash#transaction-ExistingTransaction-title": "የPsiCash ግዢ ቀድሞውኑ አለ",
-      "psicash#transaction-ExistingTransaction-body": "የዚህ አይነት የPsiCash ግዢ ቀድሞውኑ አለ። የዚህ ዐይነት ሌላ ግዢ ቀድሞ የተገዛው ቀኑ እስኪያልፍበት ድረስ የተከለከለ ነው።",
-      "psicash#transaction-InsufficientBalance-title": "የPsiCash ቀሪ ሂሳብዎ በቂ አይደለም",
-      "psicash#transaction-InsufficientBalance-body": "ለዚህ ግዢ የPsiCash ቀሪ ሂሳብዎ በቂ አይደለም።",
-      "psicash#transaction-TransactionAmountMismatch-title": "የPsiCash ግዢ ዋጋ አለመዛመድ",
-      "psicash#transaction-TransactionAmountMismatch-body": "የPsiCash ግዢ ዋጋዎች ግዜ ያለፈባቸው ናቸው። የPsiCash ዕሴት ዳግም ይቀናበራል።",
-      "psicash#transaction-TransactionTypeNotFound-title": "የPsiCash ግዢ ዐይነት አልተገኘም",
-      "psicash#transaction-TransactionTypeNotFound-body": "ለመግዛት የሚሞክሩት ምርት አሁን አይገኝም። መተግበሪያውን ማዘመን ወይም ዳግም መጫን ሊጠበቅቦት ይችላል።",
-      "psicash#transaction-InvalidTokens-title": "ተቀባይነት የሌላቸው የPsiCash ቦኖዎች",
-      "psicash#transaction-InvalidTokens-body": "የPsiCash ቦኖዋችዎት ተቀባይነት የሌላቸው ናቸው። መተግበሪያውን ዳግም ለማስጀመር ይሞክሩ። ያ የማይሠራ ከሆነ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">የአካባቢውን ማከማቻ ማጽዳት </a>ይኖርቦታል።",
-      "psicash#transaction-ServerError-title": "የPsiCash አገልጋይ ስህተት",
-      "psicash#transaction-ServerError-body": "የPsiCash አገልጋይ ግዢውን ለመፈጸም በሚያደርገው ጥረት ስህተት ተፈጥሯል። እባክዎትን ግዢውን ዳግም በሌላ ሰአት ለመፈጸም ይሞክሩ።",
-      "psicash#ui-speedboost-active": "ፍጥነት&nbsp;ጭማሬ ለ፡- %s ነቅቷል።",
-      "psicash#ui-zerobalance-title": "ፍጥነት&nbsp;ጭማሬ ያስፈልግዎታል?",
-      "psicash#ui-buypsi": "PsiCash ይግዙ",
-      "psicash#ui-buymorepsi": "ተጨማሪ PsiCash ይግዙ",
-      "psicash#ui-nsfbalance-buttontext": "ለፍጥነት&nbsp;ጭማሬ ያስፈልጋል",
-      "psicash#ui-enoughbalance-buttontext": "ፍጥነት&nbsp;ጭማሬ ያስጀምሩ",
-      "psicash#1-hour": "1 ሰዓት",
-      "psicash#1-day": "1 ቀን",
-      "psicash#ui-buyingboost-buttontext": "ፍጥነት&nbsp;ጭማሬን በማስጀመር ላይ!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon ግንኙነት ያስፈልጋል",
-      "psicash#mustconnect-modal#body": "PsiCashን ለመጠቀም ከPsiphon አውታረመረብ ጋር መገናኘት ያስፈልጋል።",
-      "psicash#init-error-title": "የPsiCash ጅማሬ ስህተት",
-      "psicash#init-error-body-unrecovered": "PsiCash ለመጀመር አልቻለም። ይህ ብዙ ግዜ የሚፈጠረው ልክ እንደ የዲስክ ቦታ ማጠር ያለ የፋይል ሥርአት ውስጥ በሚፈጠር ችግር ነው። ቀሪ ሂሳብዎ እና ሌሎችም ዕሴቶች ጠፍተዋል። PsiCash ከጥቅም ውጭ ይሆናል። ችግሩን ለመቅረፍ ለመሞከር መተግበሪያውን ዳግም ማስጀመር ይችላሉ።",
-      "psicash#init-error-body-recovered": "PsiCash ለመጀመር አልቻለም። ይህ ብዙ ግዜ የሚፈጠረው ልክ እንደ የዲስክ ቦታ ማጠር ያለ የፋይል ሥርአት ውስጥ በሚፈጠር ችግር ነው። ቀሪ ሂሳብዎ እና ሌሎችም ዕሴቶች ዳግም ተቀናብረዋል።",
-      "psicash#psiphon-speed": "Psiphon<br>ፍጥነት",
-      "notice#disallowed-traffic-alert-title": "የPsiphon ግንኙነትዎን ደረጃ ያልቁ",
-      "notice#disallowed-traffic-alert-body": "<p>መተገበሪያዎች እየሠሩ አይደለም?</p>\n<p>አንዳንድ የኢንተርኔት ትራፊክ በንቁ የፍጥነት ጭማሪ ካልሆነ በቀር እይደገፍም። የPsiphon ተሞክሮዎን ሙሉ እምቅ ኃይል ለመተግበር የፍጥነት ጭማሪን በPsiCash ያንቁ።</p>",
-      "appbackend#disallowed-traffic-notification-title": "መተግበሪያዎች እየሠሩ አይደለም?",
-      "appbackend#disallowed-traffic-notification-body": "የPsiphon ተሞክሮዎን ሙሉ እምቅ ኃይል ለመተግበር የፍጥነት ጭማሪን ያንቁ።",
-      "settings#disallowed-traffic-alert#heading": "የተከለከለ የትራፊክ ማስጠንቀቂያ",
-      "settings#disallowed-traffic-alert#help-text": "አንዳንድ የኢንተርኔት ትራፊክ በንቁ የፍጥነት ጭማሪ ካልሆነ በቀር እይደገፍም። እንደዚህ አይነት ትራፊክ በማይፈቀድበት ወቅት ማስጠቀቂያ ይታያል። (ዳግም ለማንቃት ዳግም መገናኘት ያስፈልጋል።)",
-      "settings#disallowed-traffic-alert#disable-label": "የተከለከሉ የትራፊክ ማስጠንቀቂያዎችን አሰናክል",
-      "banner#sponsored-by": "ስፖንሰር ያደረገው"
-    }
-  },
-  "ar": {
-    "name": "العربية",
-    "translation": {
-      "banner#long-connecting": "<strong>للأسف! </strong> يظهر إنك تواجه مشاكل في الإتصال!  <br>\nنزّل آخر نسخة من سايفون من  <a class=\"NewVersionURL\" href=\"#\">موقع التحميل </a>\nأو عبر إرسال بريد إلكتروني إلى  <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "جاري الإتصال ",
-      "nav#connection#connected": "تم الإتصال ",
-      "nav#connection#stopping": "جاري قطع الإتصال ",
-      "nav#connection#stopped": "تم قطع الإتصال ",
-      "nav#settings": "إعدادات",
-      "nav#feedback": "ملاحظات  ",
-      "nav#logs": "السجلات ",
-      "nav#about": "من نحن؟ ",
-      "connection#starting-msg": " <span class=\"state-word\">جاري الإتصال </span> بسايفون …",
-      "connection#stop-btn": "توقف",
-      "connection#connected-msg": "<span class=\"state-word\">تم الإتصال</span> بسايفون ",
-      "connection#disconnect-btn": "قطع الإتصال",
-      "connection#stopping-msg": "<span class=\"state-word\">جاري قطع الإتصال</span> بسايفون  …",
-      "connection#wait-btn": "الرجاء الإنتظار ",
-      "connection#stopped-msg": "<span class=\"state-word\">إنقطع الإتصال</span> بسايفون",
-      "connection#connect-btn": "إتصل ",
-      "connection#egress-region-combo-label": "تحديد منطقة الخادوم",
-      "settings#error-alert": "<strong>خطأ! </strong> يرجى تصحيح القيم غير الصحيحة قبل المتابعة.",
-      "settings#reset-button": "إعادة الضبط إلى الافتراضي",
-      "settings#apply-button": "طبق التغييرات ",
-      "settings#unapplied-changes-prompt#title": "تم تغيير الإعدادات ",
-      "settings#unapplied-changes-prompt#body": "لقد أجريت تغييرات لإعداداتك، ولكنك لم تطبقها بعد.<br><br> ا ؟هل تريد تطبيق هذه التغييرات أو إبطالها؟ ",
-      "settings#unapplied-changes-prompt#apply-button": "طبق ",
-      "settings#unapplied-changes-prompt#discard-button": "أبطل  ",
-      "settings#vpn-incompatible-msg": "(لا يعمل مع مود (L2TP/IPSec) ",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "شق المسار الآمن  ",
-      "settings#split-tunnel#help-text": "لو تم تفعيله فلن يتم تمرير الطلبات الموجهة لخوادم في بلدك عبر Psiphon.",
-      "settings#split-tunnel#reason": "المواقع في بلدك غير محجوبة بشكل عام، لذلك إذا فعلت هذا الخيار فسيعطيك وصول أسرع إلى هذه المواقع وفي بعض الأحيان سيخفف من تكلفة إستهلاك البيانات من موفر خدمة الإنترنت خاصتك.",
-      "settings#split-tunnel#enable-label": "لا تستعمل  بروكسي للمواقع في بلدك.",
-      "settings#disable-timeouts#heading": "تعطيل المهلات بالنسبة للشبكات البطيئة",
-      "settings#disable-timeouts#help-text": "إذا تم تمكين الاتصال بخادم سايفون فانه لن يتوقف.",
-      "settings#disable-timeouts#reason": "عند تفعيل هذا الإعداد على اتصال بالشبكة بطيء جدا، فسوف تقلل من احتمالية تعرض اتصالك للإنقطاع الغير متوقع.",
-      "settings#disable-timeouts#enable-label": "إبطال الانقطاعات للإتصالات البطيئة ",
-      "settings#egress-region#heading": "سيرفر سايفون الإقليمي  ",
-      "settings#egress-region#select-best-performance": "أفضل أداء",
-      "settings#egress-region#select-us": "الولايات المتحدة الأمريكية",
-      "settings#egress-region#select-ca": "كندا",
-      "settings#egress-region#select-gb": "المملكة المتحدة",
-      "settings#egress-region#select-jp": "اليابان",
-      "settings#egress-region#select-sg": "سنغافورة",
-      "settings#egress-region#select-sk": "سلوفاكيا",
-      "settings#egress-region#select-nl": "هولندا",
-      "settings#egress-region#select-de": "ألمانيا",
-      "settings#egress-region#select-in": "الهند",
-      "settings#egress-region#select-es": "إسبانيا",
-      "settings#egress-region#select-hk": "هونغ كونغ",
-      "settings#egress-region#select-at": "النمسا",
-      "settings#egress-region#select-be": "بلجيكا",
-      "settings#egress-region#select-bg": "بلغاريا",
-      "settings#egress-region#select-ch": "سويسرا",
-      "settings#egress-region#select-cz": "جمهورية التشيك",
-      "settings#egress-region#select-dk": "الدنمارك",
-      "settings#egress-region#select-fr": "فرنسا",
-      "settings#egress-region#select-hu": "اليونان",
-      "settings#egress-region#select-it": "إيطاليا",
-      "settings#egress-region#select-no": "النرويج",
-      "settings#egress-region#select-ro": "رومانيا",
-      "settings#egress-region#select-se": "السويد",
-      "settings#egress-region#select-pl": "بولندا",
-      "settings#egress-region#select-rs": "صربيا",
-      "settings#egress-region#select-au": "أستراليا",
-      "settings#egress-region#description": "Psiphon لديه خوادم كثيرة في بلدان مختلفة. إستعمال خادم سايفون لبلد قريب من بلدك سيوفر بشكل عام إتصال شبكة أسرع، ولكن ربما تود أن تصل إلى مواقع وخدمات كما لو كنت موجود افتراضيا في بلد أو منطقة معينة.",
-      "settings#egress-region#default": "اختيار الخيار الإفتراضي <strong>\"أفضل أداء\"</strong>  يتيح لسايفون إختيار خادوم تلقائيا، ذلك سينتج عادة أفضل إتصال باشبكة.",
-      "settings#egress-region#invalid-error-msg": "إختر سيرفر إقليمي لسايفون صالح للإستعمال ",
-      "settings#egress-region#error-modal-title": "إقليم السيرفر غير متوفر ",
-      "settings#egress-region#error-modal-body-http": "لقد قمت بضبط Psiphon لاستخدام خادوم في منطقة محددة.<br>\nولكن هذه المنطقة لم تعد متاحة.<br>\nلا بد من اختيار منطقة جديدة أو تغيير الاختيار الافتراضي ليكون \"أفضل أداء\".",
-      "settings#local-proxy-ports#heading": "المنافذ  المحلية للبروكسي ",
-      "settings#local-proxy-ports#leave-blank": "أتركها  <strong>فارغة </strong> للإنتقاء الأوتوماتيكي للمنافذ (يوصى  به).",
-      "settings#local-proxy-ports#reason": "إذا كنت تستعمل على حاسوبك الشخصي أدوات تستوجب ضبط يدوي لتعمل مع سايفون، يجب أن تدع سايفون يستعمل دائما نفس أرقام المنافذ المحلية. إذا لم يكن لديك سبب لتحديد أرقام المنافذ، يجب أن تدع سايفون ينتقيهم أوتوماتيكيا كي تساعد على تجنب التضارب.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "يجب أن تكون بين 1 و 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS  سوكس ",
-      "settings#local-proxy-ports#unique-error-msg": "يجب أن تكون المنافذ (البورتات) المحلية مختلفة عن بعضها البعض. ",
-      "settings#local-proxy-ports#error-modal-title": "تضارب في  منفذ البروكسي المحلي ",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nلقد ضبطت سايفون لإستعمال منفذ  محلي خاص لبروكسي أل  HTTP.<br>\nمع الأسف    يظهر أن هذا المنفذ في طور الإستعمال حاليا ولا يمكن لسايفون إستعماله .  \n</p>\n<p>الرجاء تغيير قيمة منفذ بروكسي  HTTP المضبوطة  \"configured HTTP proxy port value \" والمحاولة  من جديد.  ننصح بإزالة القيمة كي يستطيع سايفون إختيار منفذ متوفر أوتوماتيكيا. \n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>لقد ضبطت سايفون  لإستعمال منفذ محلي خاص  للبروكسي  سوكس  SOCKS\" <br\">\nمع الأسف  ظهر أن هذا المنفذ في طور الإستعمال حاليا ولا يمكن لسايفون إستعماله .\n</p>\n<p>\nالرجاء تغيير قيمة منفذ بروكسي  سوكس (SOCKS)  المضبوطة  \"configured SOCKS  proxy port value \" والمحاولة  من جديد.  ننصح بإزالة القيمة كي يستطيع سايفون إختيار منفذ متوفر أوتوماتيكيا. </p>",
-      "settings#upstream-proxy#heading": "أبستريم بروكسي  ",
-      "settings#upstream-proxy#by-default": "إذا كان جهاز الكمبيوتر الخاص بك لديه بروكسي مثبت، سايفون  سيستعمل أوتوماتيكيا هذا البروكسي عندما ينشئ النفق. يمكنك تجاوز هذا السلوك عن طريق تحديد بروكسي للإستعمال، أو بتحديد عدم جواز إستعمال \"أبستريم بروكسي\" كهذا .",
-      "settings#upstream-proxy#reason": "ألأبستريم بروكسي مطلوبين أحيانا في المدارس، الجامعات، وأماكن العمل. إذا كنت تعلم إعدادات الأبستريم بروكسي المطلوب من موفر خدمة الإنترنت خاصتك فقد يكون إدخالهم يدويا هنا مطلوب للإتصال.",
-      "settings#upstream-proxy#proxy-reqs": "وحدهم ال HTTP بروكسي  الذين يدعمون HTTPS مسموح بهم.",
-      "settings#upstream-proxy#hostname-label": "إسم المضيف ",
-      "settings#upstream-proxy#port-label": "منفذ ",
-      "settings#upstream-proxy#username-label": "اسم المستخدم",
-      "settings#upstream-proxy#password-label": "كلمة المرور",
-      "settings#upstream-proxy#domain-label": "النطاق",
-      "settings#upstream-proxy#skip-label": "لا تستعمل أبستريم بروكسي  ",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "خطأ بروكسي أبستريم.\nUpstream Proxy Error  ",
-      "settings#upstream-proxy#error-modal-body-default": "سايفون مضبوط حاليا لإستعمال بروكسي نظامك كأبستريم بروكسي ”. <br>\nومع ذلك، يظهر إننا غير قادرين على الإتصال بسيرفر سايفون من خلال هذا البروكسي .<br>\nالرجاء تفعيل  \"لا تستخدم أبستريم بروكسي\"  “Don't use upstream proxy” والمحاولة من جديد.",
-      "settings#upstream-proxy#error-modal-body-configured": "لقد  ضبطت سايفون ليستعمل أبستريم بروكسي  upstream proxy\" .<br\">\nومع ذلك، يظهر إننا غير قادرين على الإتصال بسيرفر سايفون من خلال هذا البروكسي.<br>\nالرجاء إعادة ضبط  الإعدادات والمحاولة  من جديد .",
-      "settings#transport-mode#heading": "أسلوب النقل ",
-      "settings#transport-mode#check-label": "إستعمل  أسلوب L2TP/IPSec",
-      "settings#transport-mode#help-text": "يستعمل ويندوز  L2TP/IPSec ربط الشبكات الإفتراضي  \"Virtual Networking\". هذا الوضع سيمرر كل التطبيقات  في نفق ، لكن  لن  يوفر  التجهيل   وبذلك لا  يؤمن  قدرات قوية لتجاوز الرقابة. لا  <strong>ننصح به </strong> لتجاوز أغلب جدران النار (Firewalls) .",
-      "settings#systray-minimize#heading": "صغّر إلى منطقة الإعلام (لوحة  النظام)   ",
-      "settings#systray-minimize#help-text": "إذا طبّق الإعداد المناسب، عندما يصّغر تطبيق سايفون سيختبئ في منطقة الإعلام (كما تعرف أيضا  بلوحة النظام  الموجودة قرب الساعة على شريط المهمة في الويندوز) ",
-      "settings#systray-minimize#reason": "تصغير سايفون إلى منطقة  الإعلام (لوحة النظام) يحرر مساحة على شريط المهام الخاص بك. هذا يساعد جدا، خصوصا إذا كنت تستعمل سايفون لمدة طويلة من الوقت. ",
-      "settings#systray-minimize#enable-label": "صغر إلى  شريط  الإعلام (لوحة النظام) ",
-      "settings#applying-message": "يتم إعادة الإتصال لتثبيت إعداداتك. ",
-      "settings#saved-message": " تم حفظ  الإعدادات  ",
-      "settings#error-modal#title": "خطأ في الإعدادات ",
-      "settings#error-modal#body": "هناك أخطاء في قيم إعداداتك. ألرجاء تصحيحهم قبل المباشرة. ",
-      "feedback#top_content_title": "شاركنا برأيك ",
-      "feedback#top_para_2": "الكثير من المشاكل يمكن حلها عبر التحديث إلى آخر إصدار. يمكنك  <a class=\"NewVersionURL\" href=\"#\">تنزيل آخر إصدار من خلال النقر هنا </a>, أو يمكنك إرسال بريد إلكتروني إلى  <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "يمكنك أيضا إيجاد حلول لمشكلاتك على صفحة  <a class=\"FaqURL\" href=\"#\">الأسئلة المتداولة  </a>.",
-      "feedback#smiley_happy": "سايفون يعمل ويتصل كما أريد. ",
-      "feedback#smiley_sad": "سايفون  غالبا ما يفشل بالإتصال أو لا يعمل جيدا. ",
-      "feedback#text_feedback_prompt": "الرجاء إدخال تعليقاتكم هنا:",
-      "feedback#text_feedback_email_prompt": "إذا  أردتم ردا مباشرا يجب إدخال بريدكم الإلكتروني:  ",
-      "feedback#diagnostic_check": "حمّل البيانات التشخيصية.  الرجاء الإنتباه أن هذه البيانات التشخيصية لا تكشف هويتك، إنما تساعد سايفون على العمل أفضل  <a class=\"DataCollectionInfoURL\" href=\"#\">أنقر هنا لرؤية نوع المعلومات التي نجمعها </a>",
-      "feedback#submit_button": "أرسل",
-      "feedback#text_feedback_bottom_para": "إذا كانت الإستمارة أعلاه لا تعمل، أو تريد إرسال لقطات شاشة، الرجاء مراسلتنا عبر هذا البريد الإلكتروني  <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>شكرا!</strong> قد تم إرسال ملاحظاتك.",
-      "logs#show-debug-label": "أظهر سجلات التصحيح ",
-      "logs#placeholder": "ليس هناك سجلات حاليا ",
-      "language#success-message": "<strong> مرحباً </strong> أهلاً بكم في سايفون. ",
-      "about#wordart-tag": "ما وراء الحدود ",
-      "about#description": "سايفون هو<strong> أداة لتجاوز الرقابة على الإنترنت.</strong> — لقد صمم لكي يساعد على الوصول إلى الإنترنت المفتوح، متجاوزا الرقابة والجدران النارية <strong>سايفون مصدر مفتوح</strong>  جرى تصميمه في تورنتو، كندا",
-      "about#visit-download-site": "الرجاء زيارة الموقع <strong><a class=\"NewVersionURL\" href=\"#\">لتحميل  نسخة جديدة  </a></strong> أو لكي <strong><a class=\"InfoURL\" href=\"#\">تحصل على مساعدة ومعلومات  and</a></strong>. سايفون متوفر للأندرويد والويندوز.",
-      "about#get-by-email": "<strong>إذا كنتم لا تستطيعون الدخول إلى الموقع </strong>, يمكنكم الحصول على نسخة جديدة  من سايفون  عبر إرسال بريد إلكتروني إلى:  ",
-      "about#client-version": "سايفون لإصدارات أجهزة سطح مكتب من ويندوز (Windows Client Version)",
-      "general#modal-close-button": "أغلق ",
-      "general#notice-modal-tech-preamble": "هذه هي معلومات الخطأ التقني ",
-      "notice#systemproxysettings-setproxy-error-title": "خطأ في بروكسي النظام   ",
-      "notice#systemproxysettings-setproxy-error-body": "<p>فشل سايفون في ضبط إعدادات البروكسي للنظام .</p>\n<p>يمكن أن يعود ذلك لوجود تصادم مع نظام مكافحة الفيروسات خاصتك .  قد تحتاج إلى الضبط اليدوي لتطبيقك أو لإعدادات  بروكسي النظام لكي تستعمل بروكسي سايفون المحلي .  </p>",
-      "notice#systemproxysettings-setproxy-warning-template": "سايفون فشل في ضبط إعدادات بروكسي النظام لإتصال الإنترنت المسمى “<%- data %>”. قد يكون ذلك سببه تصادم مع  نظام مكافحة الفيروسات. قد تحتاج إلى الضبط اليدوي لتطبيقك أو لإعدادات  بروكسي النظام لكي تستعمل بروكسي سايفون المحلي. ",
-      "appbackend#state-stopped-title": "لقد إنقطع الإتصال بسايفون",
-      "appbackend#state-starting-title": "سايفون يحاول الإتصال ",
-      "appbackend#state-starting-body": "الرجاء الإنتظار ",
-      "appbackend#state-connected-title": "سايفون متصل ",
-      "appbackend#state-connected-body": "إكتشف ما وراء حدودك! ",
-      "appbackend#state-connected-reminder-title": "سايفون يقوم بالحفاظ على إتصالك",
-      "appbackend#state-connected-reminder-body": "ساهم في إبقاء سايفون مجاني. إضغط هنا لزيارة مواقع داعمينا!",
-      "appbackend#state-connected-reminder-body-2": "ساهم في إبقاء سايفون مجاني بزيارة مواقع داعمينا!",
-      "appbackend#minimized-to-systray-title": "لقد تّم تصغير سايفون إلى منطقة الإعلام ",
-      "appbackend#minimized-to-systray-body": "إضغط الأيقونة لإسترجاع التطبيق ",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "رصيد PsiCash غير كاف",
-      "psicash#transaction-InsufficientBalance-body": "ليس عندك ما يكفي من رصيد PsiCash لاتمام هذا الشراء.",
-      "psicash#transaction-TransactionAmountMismatch-title": "عدم توافق في سعر شراء PsiCash",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "هل تحتاج إلى السرعة الفائقة؟",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "ابدأ السرعة&nbspالفائقة",
-      "psicash#1-hour": "ساعة",
-      "psicash#1-day": "1 يوم",
-      "psicash#ui-buyingboost-buttontext": "جارٍ البدء في السرعةnbsp;الفائفة!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "يلزم الاتصال ب Psiphon",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "برعاية "
-    }
-  },
-  "az": {
-    "name": "azərbaycan dili",
-    "translation": {
-      "banner#long-connecting": "<strong>Yox!</strong> Qoşulmaqda çətinlik çəkirsiniz!<br>\nPsiphonun son versiyasını yükləmək üçün <a class=\"NewVersionURL\" href=\"#\">sayta keçin</a>\nvə ya email göndərin <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Qoşulur",
-      "nav#connection#connected": "Qoşuldu",
-      "nav#connection#stopping": "Ayrılır",
-      "nav#connection#stopped": "Ayrıldı",
-      "nav#settings": "Quraşdırmalar",
-      "nav#feedback": "Şərhiniz",
-      "nav#logs": "Girişlər",
-      "nav#about": "Haqqında",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">qoşulur</span>…",
-      "connection#stop-btn": "Dayan",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">qoşuldu</span>",
-      "connection#disconnect-btn": "Ayrıl",
-      "connection#stopping-msg": "Psiphondan <span class=\"state-word\">ayrıl</span>…",
-      "connection#wait-btn": "Gözləyin...",
-      "connection#stopped-msg": "Psiphondan <span class=\"state-word\">ayrıldı</span>",
-      "connection#connect-btn": "Qoşul",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Xəta!</strong> Zəhmət olmasa, səhv elementləri düzəldin.",
-      "settings#reset-button": "İlkin versiyaya qayıt",
-      "settings#apply-button": "Dəyişiklikləri tətbiq et",
-      "settings#unapplied-changes-prompt#title": "Quraşdırmalar dəyişdi",
-      "settings#unapplied-changes-prompt#body": "Seçimlərinizə dəyişikliklər etmisiniz, amma onları tətbiq etməmisiniz.<br><br>Dəyşiklikləri tətbiq etmək, yoxsa silmək istəyirsiniz?",
-      "settings#unapplied-changes-prompt#apply-button": "Tətbiq et",
-      "settings#unapplied-changes-prompt#discard-button": "Çıxar",
-      "settings#vpn-incompatible-msg": "(L2TP/IPsec modeli ilə işləmir)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Tuneli böl",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Öz ölkəniz daxilində saytları proksiləməyin",
-      "settings#disable-timeouts#heading": "Aşağı sürətli şəbəkələr üçün dayanmaları söndürün",
-      "settings#disable-timeouts#help-text": "Aktivləşdirilibsə, Psiphon serveri ilə dayanma olmayacaq.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Aşağı sürətli şəbəkələr üçün dayanmaları söndürün",
-      "settings#egress-region#heading": "Psiphon Serveri bölgəsi",
-      "settings#egress-region#select-best-performance": "Ən sürətli qoşulma",
-      "settings#egress-region#select-us": "ABŞ",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Birləşmiş Krallıq",
-      "settings#egress-region#select-jp": "Yaponiya",
-      "settings#egress-region#select-sg": "Sinqapur",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Niderland",
-      "settings#egress-region#select-de": "Almaniya",
-      "settings#egress-region#select-in": "Hindistan",
-      "settings#egress-region#select-es": "İspaniya",
-      "settings#egress-region#select-hk": "Hong Konq",
-      "settings#egress-region#select-at": "Avstriya",
-      "settings#egress-region#select-be": "Belçika",
-      "settings#egress-region#select-bg": "Bolqarıstan",
-      "settings#egress-region#select-ch": "İsveçrə",
-      "settings#egress-region#select-cz": "Çexiya",
-      "settings#egress-region#select-dk": "Danimarka",
-      "settings#egress-region#select-fr": "Fransa",
-      "settings#egress-region#select-hu": "Macarıstan",
-      "settings#egress-region#select-it": "İtaliya",
-      "settings#egress-region#select-no": "Norveç",
-      "settings#egress-region#select-ro": "Rumıniya",
-      "settings#egress-region#select-se": "İsveç",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Düzgün Psiphon bölgəsi seçin.",
-      "settings#egress-region#error-modal-title": "Server Bölgəsi İşləmir",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Yerli proksi portları",
-      "settings#local-proxy-ports#leave-blank": "Avtomatik port seçimi üçün <strong>boş</strong> buraxın (məsləhətdir).",
-      "settings#local-proxy-ports#reason": "Kompüterinizdəki alətlər Psiphon üzərindən fəaliyyət göstərmək üçün əllə quraşdırma tələb edirsə, Psiphonun eyni port nömrələrindən istifadə etməsini istəyəcəksiniz. Port nömrələrini  müəyyənləşdirmək vacib deyilsə, problemlərdən qaçmaq üçün Psiphonun onları avtomatik seçməsinə icazə verməlisiniz.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 və 65535 arasında olmalıdır.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Yerli portlar bir-birindən seçilməlidirlər.",
-      "settings#local-proxy-ports#error-modal-title": "Yerli Proksi Port Münaqişəsi",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphonu müəyyən yerli portdan onun HTTS proksisi ilə işləmək üçün quraşdırmısınız.<br>\nAncaq həmin port artıq istifadədir və Psiphon ona qoşula bilmir.\n</p>\n<p>\nZəhmət olmasa, HTTP proksi portu elementini dəyişdirin və yenidən cəhd edin. Həmin elementi silməyi tövsiyyə edirik. Silin ki, Psiphon boş olan portu avtmatik seçsin.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphonu müəyyən yerli portdan onun SOCKS proksisi ilə işləmək üçün quraşdırmısınız.2\nAncaq həmin port artıq istifadədir və Psiphon ona qoşula bilmir.\n</p>\n<p>\nZəhmət olmasa, SOCKS proksi portu elementini dəyişdirin və yenidən cəhd ediin. Həmin elementi silməyi tövsiyyə edirik. Silin ki, Psiphon boş olan portu avtmatik seçsin.\n</p>",
-      "settings#upstream-proxy#heading": "Yuxarı axın proksisi",
-      "settings#upstream-proxy#by-default": "Kompüterindizdə proksi artıq quraşdırılıbsa, tunel yaradanda Psiphon avtomatik olarq həmin proksidən istifadə edəcək. Buna yol verməmək üçün istifadə olunacaq proksini seçməli, ya da \"yuxarı axınlı proksi\"dən istifadə olunmayacağını qeyd etməlisiniz.",
-      "settings#upstream-proxy#reason": "Yuxarı axın proksiləri bəzən məktəb, universitet və şirkətlər istəyir. Provayderiniz sizə yuxarı axınlı proksi quraşdırmaları veribsə, onları dəyişmək üçün qoşulma tələb oluna bilər.",
-      "settings#upstream-proxy#proxy-reqs": "Yalnız HTTPS-i dəstəkləyən HTTP proksilərə icazə verilir.",
-      "settings#upstream-proxy#hostname-label": "Host adı",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "İstifadəçi adı",
-      "settings#upstream-proxy#password-label": "Parol",
-      "settings#upstream-proxy#domain-label": "Domen",
-      "settings#upstream-proxy#skip-label": "Yuxarı axınlı proksidən istifadə etməyin",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Yuxarı axın proksi xətası",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon sistem proksinizin istifadəsi üçün quraşdırılıb və onu \"yuxarı axın proksisi\" kimi tanıyır.<br>\nAncaq, Psiphon serverinə qeyd olunan proksidən qoşula bilmirik.<br>\nZəhmət olmasa, \"Yuxarı axın proksisindən istifadə etmə\" seçimini aktivləşdirin və yenidən cəhd edin.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphonu \"yuxarı axın proksisinin\" istifadəsi üçün quraşdırmısnız.<br>\nAncaq, Psiphon serverinə qeyd olunan proksidən qoşula bilmirik.<br>\nZəhmət olmasa, quraşdırmanı müəyyən edin və yenidən cəhd göstərin.",
-      "settings#transport-mode#heading": "Transport modeli",
-      "settings#transport-mode#check-label": "L2TP/IPSec modelindən istifadə edin",
-      "settings#transport-mode#help-text": "Windows-un L2TP/IPSec virtual şəbəkəsindən istifadə edir. Bu modeldə bütün tətbiqetmələriniz tuneldən keçir, amma gizlilik təmin olunmur deyə güclü anti-senzura imkanlarına malik deyil. Əksər fayervolları keçmək üçün <strong>məsləhət deyil</strong> .",
-      "settings#systray-minimize#heading": "Xəbərdarlıq bölgəsinə endir (Sistem xəttinə)",
-      "settings#systray-minimize#help-text": "Aktivləşdirilibsə, endiriləndə Psiphon proqramının pəncərəsi xəbərdarlıqlar bölməsində gizlənəcək (ona həm də \"sistem çubuğu\" deyirlər, Windowsda saat işarəsinin yanında yerləşir).",
-      "settings#systray-minimize#reason": "Psiphonun xəbərdarlıq bölməsinə endirilməsi (\"sistem çubuğu\") ekranınızda yer boşaldır. Bu, xüsusilə Psiphondan tez-tez və uzun müddət istifadə edəndə işə yarayır. ",
-      "settings#systray-minimize#enable-label": "Xəbərdarlıq bölgəsinə endir (Sistem xəttinə)",
-      "settings#applying-message": "Quraşdırmalarınızı fəallaşdırmaq üçün yenidən qoşulur.",
-      "settings#saved-message": "Quraşdırmalar saxlandı.",
-      "settings#error-modal#title": "Quraşdırma səhvi",
-      "settings#error-modal#body": "Quraşdırma elementlərinizdə xətalar var. Davam etməzdən əvvəl onları düzəldin.",
-      "feedback#top_content_title": "Öz Qiymətləndirmənizi Verin",
-      "feedback#top_para_2": "Son versiyanı yükləməklə xeyli problemdən qurtaracaqsınız. Siz<a class=\"NewVersionURL\" href=\"#\">son versiyanı bura klikləməklə yükləyə</a>, və ya email göndərməklə əldə edə bilərsiniz <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Bəzi ümumi problemlərin həlli yollarını <a class=\"FaqURL\" href=\"#\">Tez-Tez Verilən Suallarda</a> tapa bilərsiniz.",
-      "feedback#smiley_happy": "Psiphon istədiyim kimi qoşulur və işləyir.",
-      "feedback#smiley_sad": "Psiphon tez-tez dayanır və yaxşı işləmir.",
-      "feedback#text_feedback_prompt": "Şərhlərinizi bura yazın:",
-      "feedback#text_feedback_email_prompt": "Sizə cavab verməyimizi istəyirsinizsə, öz email ünvanınızı bura qeyd edin:",
-      "feedback#diagnostic_check": "Diaqnoz məlumatını yüklə. Qeyd edək ki, diaqnoz məlumatı sizi müəyyən etmir və Psiphonun düzgün işləməsinə yardım edir. <a class=\"DataCollectionInfoURL\" href=\"#\"> Hansı məlumatların toplandığını görmək üçün klikləyin.</a>",
-      "feedback#submit_button": "Göndər",
-      "feedback#text_feedback_bottom_para": "Yuxarıdakı anket işləmirsə və ya ekran görüntüsünü göndərmək istəyirsinizsə, zəhmət olmasa, bizə email yazın <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Sağ olun!</strong> Şərhiniz göndərildi.",
-      "logs#show-debug-label": "Xəta girişlərini göstər",
-      "logs#placeholder": "Giriş yoxdur",
-      "language#success-message": "<strong>Salam!</strong> Psiphona xoş gəldiniz.",
-      "about#wordart-tag": "Sərhədsiz",
-      "about#description": "Psiphon <strong>senzuradan qurtulmaq üçündür</strong> , internetdən limitsiz və əngəlsiz istifadə etməkdən ötrü yaradılıb. O, <strong>açıq mənbəliir</strong> və Torontoda, Kanadada təsis edilib.",
-      "about#visit-download-site": "Zəhmət olmasa sayta daxil olun ki, <strong><a class=\"NewVersionURL\" href=\"#\">yeni versiyanı yükləyəsiniz</a></strong> və ya <strong><a class=\"InfoURL\" href=\"#\">yardım məlumatı alasınız</a></strong>. Psiphon iAndroid və Windows-da işləyir.",
-      "about#get-by-email": "<strong>Sayta giriş mümkün deyilsə</strong>, Psiphonu əldə etmək üçün email göndərin:",
-      "about#client-version": "Windows üçün Psiphon versiyası:",
-      "general#modal-close-button": "Bağla",
-      "general#notice-modal-tech-preamble": "Texniki xəta haqda məlumat:",
-      "notice#systemproxysettings-setproxy-error-title": "Sistem proksi xətası",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistem proksi quraşdırmalarını edə bilmədi.</p>\n<p>Bu antivirus proqramınızla münaqişə ilə bağlı ola bilər. Gərək tətbiqetmənizi və ya sistem proksi quraşdırmalarınızı yerli Psiphon proksiləri ilə işləmək üçün sazlayasınız.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” adlı internet qoşulması üçün sistem proksi quraşdırmalarını müəyyənləşdirə bilmədi. Bu, sizin antivirusla münaqişə ilə bağlı ola bilər. Yerli Psiphon proksilərindən istifadə üçün tətbiqetmənizi və ya sistem proksi quraşdırmalarınızı bir-bir dəyişdirməlisiniz.",
-      "appbackend#state-stopped-title": "Psiphon ayrılıb",
-      "appbackend#state-starting-title": "Psiphon  qoşulur",
-      "appbackend#state-starting-body": "Gözləyin...",
-      "appbackend#state-connected-title": "Psiphon qoşuldu",
-      "appbackend#state-connected-body": "Sərhədlərinizi aşın!",
-      "appbackend#state-connected-reminder-title": "Psiphon sizin qoşulmanızı təmin edir",
-      "appbackend#state-connected-reminder-body": "Psiphonu pulsuz istifadə edin. Sponsor səhifələrinə keçmək üçün bura klikləyin!",
-      "appbackend#state-connected-reminder-body-2": "Sponsor səhifələrinə keçməklə Psiphonu pulsuz saxlamağa yardım edirsiniz!",
-      "appbackend#minimized-to-systray-title": "Psiphon xəbərdarlıq bölgəsinə endirildi",
-      "appbackend#minimized-to-systray-body": "Tətbiqetməni bərpa etmək üçün kliklə",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponsoru:"
-    }
-  },
-  "be": {
-    "name": "Беларуская",
-    "translation": {
-      "banner#long-connecting": "<strong>Ой, не!</strong> Выглядае на праблемы са злучэннем!<br>\nЗагрузіце найноўшую версію Psiphon з <a class=\"NewVersionURL\" href=\"#\">сайту загрузак</a>або дашліце нам ліст на <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "nav#connection#starting": "Ідзе злучэнне...",
-      "nav#connection#connected": "Падлучана",
-      "nav#connection#stopping": "Ідзе адлучэнне",
-      "nav#connection#stopped": "Адлучана",
-      "nav#settings": "Налады",
-      "nav#feedback": "Зваротная сувязь",
-      "nav#logs": "Журналы",
-      "nav#about": "Пра праграму",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">падлучаецца</span>…",
-      "connection#stop-btn": "Стоп",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">падлучаны</span>",
-      "connection#disconnect-btn": "Адлучыць",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">адлучаецца</span>…",
-      "connection#wait-btn": "Калі ласка, пачакайце...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">адлучаны</span>",
-      "connection#connect-btn": "Злучыцца",
-      "connection#egress-region-combo-label": "Выбраць рэгіён серверу",
-      "settings#error-alert": "<strong>Памылка!</strong> Калі ласка, перш чым працягваць, выпраўце няслушныя значэнні.",
-      "settings#reset-button": "Скінуць да стандартнага",
-      "settings#apply-button": "Прымяніць змены",
-      "settings#unapplied-changes-prompt#title": "Налады змененыя",
-      "settings#unapplied-changes-prompt#body": "Вы ўнеслі змены ў налады, але не прымянілі іх.<br><br> Жадаеце прымяніць змены зараз або адмяніць іх?",
-      "settings#unapplied-changes-prompt#apply-button": "Прымяніць",
-      "settings#unapplied-changes-prompt#discard-button": "Адмяніць",
-      "settings#vpn-incompatible-msg": "(Не працуе ў рэжыме L2TP/IPSec).",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Падзяліць тунэль",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Не пускаць праз проксі-сервер сайты з вашай краіны",
-      "settings#disable-timeouts#heading": "Адключыць час чакання для павольных злучэнняў",
-      "settings#disable-timeouts#help-text": "Калі ўключана, сувязь з серверам Psiphon не будзе перапыняцца праз доўгі час чакання.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Адключыць час чакання для павольных злучэнняў",
-      "settings#egress-region#heading": "Рэгіён сервера Psiphon ",
-      "settings#egress-region#select-best-performance": "Лепшая прадукцыйнасць",
-      "settings#egress-region#select-us": "Злучаныя Штаты Амерыкі",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Вялікабрытанія",
-      "settings#egress-region#select-jp": "Японія",
-      "settings#egress-region#select-sg": "Сінгапур",
-      "settings#egress-region#select-sk": "Славакія",
-      "settings#egress-region#select-nl": "Нідэрланды",
-      "settings#egress-region#select-de": "Германія",
-      "settings#egress-region#select-in": "Індыя",
-      "settings#egress-region#select-es": "Іспанія",
-      "settings#egress-region#select-hk": "Ганконг",
-      "settings#egress-region#select-at": "Аўстрыя",
-      "settings#egress-region#select-be": "Бельгія",
-      "settings#egress-region#select-bg": "Балгарыя",
-      "settings#egress-region#select-ch": "Швейцарыя",
-      "settings#egress-region#select-cz": "Чэхія",
-      "settings#egress-region#select-dk": "Данія",
-      "settings#egress-region#select-fr": "Францыя",
-      "settings#egress-region#select-hu": "Венгрыя",
-      "settings#egress-region#select-it": "Італія",
-      "settings#egress-region#select-no": "Нарвегія",
-      "settings#egress-region#select-ro": "Румынія",
-      "settings#egress-region#select-se": "Швецыя",
-      "settings#egress-region#select-pl": "Польшчы",
-      "settings#egress-region#select-rs": "Сербія",
-      "settings#egress-region#select-au": "Аўстралія",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Выберыце дзейсны рэгіён сервера Psiphon ",
-      "settings#egress-region#error-modal-title": "Рэгіён сервера недаступны",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Порты лакальнага проксі-сервера",
-      "settings#local-proxy-ports#leave-blank": "Пакіньце <strong>пустым</strong>для аўтаматычнага выбару порту (рэкамендуецца).",
-      "settings#local-proxy-ports#reason": "Калі вы выкарыстоўваеце такія інструменты, якія патрабуюць ручнога канфігуравання працы з Psiphon, у вас будзе жаданне, каб Psiphon выкарыстоўваў адны і тыя ж лакальныя нумары портаў. Калі ў вас няма прычынаў для пазначэння нумара порта, варта дазволіць Psiphon выбіраць іх аўтаматычна, каб пазбегнуць канфліктаў.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Павінна быць паміж 1 і 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Лакальныя порты павінны быць адрознымі адзін ад аднаго.",
-      "settings#local-proxy-ports#error-modal-title": "Канфлікт портаў лакальнага проксі-сервера",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nВы сканфігуравалі Psiphon на выкарыстанне канкрэтнага лакальнага порту для яго HTTP-проксі-сервера<br>.\nАднак выглядае, што гэты порт ужо выкарыстоўваецца і таму Psiphon ня можа яго выкарыстаць.\n</p>\n<p>\nКалі ласка, змяніце сканфігураванае значэнне порта HTTP проксі-сервера і паспрабуйце зноў. Мы рэкамендуем ачысціць гэтае значэнне, каб Psiphon мог аўтаматычна выбраць свабодны порт.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВы сканфігуравалі Psiphon на выкарыстанне канкрэтнага лакальнага порту для яго SOCKS-проксі-сервера<br>.\nАднак выглядае, што гэты порт ужо выкарыстоўваецца і таму Psiphon не можа яго выкарыстаць.\n</p>\n<p>\nКалі ласка, змяніце сканфігураванае значэнне порта SOCKS-проксі-сервера і паспрабуйце зноў. Мы рэкамендуем ачысціць гэтае значэнне, каб Psiphon мог аўтаматычна выбраць свабодны порт.\n</p>",
-      "settings#upstream-proxy#heading": "Вышэйстаячы проксі-сервер",
-      "settings#upstream-proxy#by-default": "Калі на Вашым камп'ютары проксі-сервер ужо сканфігураваны, па змаўчанні Psiphon будзе выкарыстоўваць гэты проксі-сервер пры стварэнні тунэля. Вы можаце змяніць гэтыя паводзіны шляхам вызначэння проксі-сервера для выкарыстання або ўдакладніўшы, што ніякі «вышэйстаячы проксі-сервер» не павінен выкарыстоўвацца.",
-      "settings#upstream-proxy#reason": "Школы, універсітэты, або фірмы часам вымагаюць мець вышэйстаячыя проксі-серверы. Калі ваш інтэрнэт-правайдэр надаў вам налады вышэйстаячага проксі-сервера, ручное іх наладжванне можа вымагаць наяўнасці падлучэння.",
-      "settings#upstream-proxy#proxy-reqs": "Дазволеныя толькі проксі-серверы HTTP, якія падтрымліваюць HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Назва вузла",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Імя карыстальніка",
-      "settings#upstream-proxy#password-label": "Пароль",
-      "settings#upstream-proxy#domain-label": "Дамен",
-      "settings#upstream-proxy#skip-label": "Не ўжываць вышэйстаячы проксі-сервер",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Памылка вышэйстаячага проксі-сервера",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon цяпер сканфігураваны на выкарыстанне проксі-сервера вашай сістэмы як свайго \"вышэйстаячага проксі-сервера\"<br>.\nАднак мы, здаецца, ня можам падлучыцца да сервера Psiphon праз гэты проксі-сервер<br>.\nКалі ласка, уключыце «Не ўжываць вышэйстаячы проксі-сервер» і паспрабуйце зноў.",
-      "settings#upstream-proxy#error-modal-body-configured": "Вы сканфігуравалі Psiphon на выкарыстанне \"вышэйстаячага проксі-сервера\"<br>.\nАднак мы, здаецца, не можам падлучыцца да сервера Psiphon праз гэты проксі-сервер<br>.\nКалі ласка, выпраўце налады і паспрабуйце зноў.",
-      "settings#transport-mode#heading": "Рэжым транспартавання",
-      "settings#transport-mode#check-label": "Ужыць рэжым L2TP/IPSec",
-      "settings#transport-mode#help-text": "Выкарыстоўвае віртуальную сетку Windows L2TP/IPSec. Гэты рэжым тунэлюе ўсе вашы прыкладанні, але не забяспечвае заблытвання коду і таму не дае вялікіай магчымасці абыходу цэнзуры. Ён не рэкамендуецца для пераадолення большасці міжсеткавых экранаў.",
-      "settings#systray-minimize#heading": "Згарнуць да вобласці апавяшчэнняў (сістэмны латок)",
-      "settings#systray-minimize#help-text": "Калі гэты параметр уключаны, пры згортванні акно Psiphon будзе схаванае ў вобласці апавяшчэнняў (таксама вядомай як «сістэмны латок» або «systray», размешчанай побач з гадзіннікам на панэлі задач Windows).",
-      "settings#systray-minimize#reason": "Згорванне Psiphon да вобласці апавяшчэнняў (\"сістэмны латок\") вызваляе месца на панэлі задач. Гэта асабліва зручна, калі вы часта ўжываеце Psiphon на працягу доўгага часу. ",
-      "settings#systray-minimize#enable-label": "Згарнуць да вобласці апавяшчэнняў (сістэмны латок)",
-      "settings#applying-message": "Паўторнае злучэнне, каб дастасаваць налады.",
-      "settings#saved-message": "Налады захаваныя.",
-      "settings#error-modal#title": "Памылка наладаў",
-      "settings#error-modal#body": "Ёсць памылкі ў значэннях наладаў. Перш чым працягнуць, калі ласка, выпраўце.",
-      "feedback#top_content_title": "Дашліце водгук",
-      "feedback#top_para_2": "Шмат праблем могуць быць вырашаныя праз загрузку найноўшай версіі. Вы можаце загрузіць найноўшую версію праз клік тут</a> або можаце даслаць нам ліст на <a class=\"NewVersionEmail\" href=\"#\">адрас</a>.",
-      "feedback#top_para_3": "Таксама можна знайсці вырашэнне шмат якіх агульных праблем у нашай рубрыцы <a class=\"FaqURL\" href=\"#\">Тыповыя пытанні</a>.",
-      "feedback#smiley_happy": "Psiphon злучае і працуе так, як я хачу.",
-      "feedback#smiley_sad": "Psiphon часта дае памылку злучэння ці не працуе дастаткова добра.",
-      "feedback#text_feedback_prompt": "Калі ласка, напішыце каментарыі тут:",
-      "feedback#text_feedback_email_prompt": "Калі вы хацелі б, каб мы адказалі, калі ласка, упішыце тут ваш адрас электроннай пошты:",
-      "feedback#diagnostic_check": "Загрузіць даныя дыягностыкі. Калі ласка, звярніце ўвагу, што гэтыя даныя дыягностыкі не дазваляюць індэнтыфікаваць вас, а нам гэта дазволіць падтрымліваць спраўную працу Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Націснуць тут, каб пабачыць, якія даныя мы збіраем</a>.",
-      "feedback#submit_button": "Даслаць",
-      "feedback#text_feedback_bottom_para": "Калі форма вышэй не спрацоўвае або вы хацелі б даслаць скрыншоты, дашліце ліст на адрас <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Дзякуй!</strong> Ваш водгук дасланы.",
-      "logs#show-debug-label": "Паказаць журналы адладкі",
-      "logs#placeholder": "Няма запісаў у журналах",
-      "language#success-message": "<strong>Вітаем!</strong> Запрашаем да Psiphon.",
-      "about#wordart-tag": "Па-за межамі",
-      "about#description": "Psiphon - <strong>гэта інструмент для абыходу цэнзуры</strong> — ён прызначаны для доступу да адкрытага інтэрнэту, абмінаючы цэнзараў і міжсеткавыя экраны. Ён мае <strong>адкрыты зыходны код</strong> і распрацоўваецца ў Таронта, Канада.",
-      "about#visit-download-site": "Калі ласка, наведайце наш вэб-сайт, каб <strong><a class=\"NewVersionURL\" href=\"#\">загрузіць новую версію</a></strong> або <strong><a class=\"InfoURL\" href=\"#\">атрымаць дапамогу ці інфармацыю</a></strong>. Psiphon даступны для Android і Windows.",
-      "about#get-by-email": "<strong>Калі вэб-сайт недаступны</strong>, можна атрымаць новую версію Psiphon, даслаўшы нам ліст на адрас:",
-      "about#client-version": "Кліенцкая версія Psiphon для Windows",
-      "general#modal-close-button": " Закрыць",
-      "general#notice-modal-tech-preamble": "Вось інфармацыя адносна тэхнічнай памылкі:",
-      "notice#systemproxysettings-setproxy-error-title": "Памылка сістэмнага проксі-сервера",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не не змог задаць параметры проксі-сервера сістэмы</p>.\n<p>Гэта можа здарыцца па прычыне канфлікту з антывіруснай праграмай. Вам, магчыма, давядзецца ўручную сканфігураваць параметры праграмы або стэмныя налады проксі-сервера, каб выкарыстоўваць лакальныя проксі-серверы Psiphon</p>.",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon не не змог задаць параметры проксі-сервера сістэмы для інтэрнэт-злучэння “<%- data %>”. Гэта можа быць па прычыне канфлікту з антывіруснай праграмай. Вам, магчыма, спатрэбіцца ўручную сканфігураваць параметры праграмы або сістэмныя налады проксі-сервера, каб выкарыстоўваць лакальныя проксі-серверы Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon адлучаны",
-      "appbackend#state-starting-title": "Psiphon злучаецца",
-      "appbackend#state-starting-body": "Калі ласка, пачакайце...",
-      "appbackend#state-connected-title": "Psiphon падлучаны",
-      "appbackend#state-connected-body": "Вандруйце па-за межамі!",
-      "appbackend#state-connected-reminder-title": "Psiphon трымае вас на сувязі",
-      "appbackend#state-connected-reminder-body": "Няхай Psiphon застаецца бясплатным. Націсніце сюды, каб наведаць старонкі нашых спонсараў!",
-      "appbackend#state-connected-reminder-body-2": "Захавайма бясплатнасць Psiphon, наведваючы старонкі нашых спонсараў!",
-      "appbackend#minimized-to-systray-title": "Psiphon згорнуты да вобласці апавяшчэнняў (сістэмны латок)",
-      "appbackend#minimized-to-systray-body": "Націснуць на значок, каб вярнуць праграму",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Спонсар"
-    }
-  },
-  "bn": {
-    "name": "বাংলা",
-    "translation": {
-      "banner#long-connecting": "<strong>ওহ না! </strong>আপনি সংযোগ-এ সমস্যার সম্মুখীন হচ্ছেন বলে মনে হচ্ছে!<br> ডাউনলোড সাইট থেকে<a class=\"NewVersionURL\" href=\"#\"> বা একটি ইমেল পাঠিয়ে<a class=\"NewVersionEmail\" href=\"#\">  সাইফন এর সর্বশেষ সংস্করণ ডাউনলোড করুন </a> ",
-      "nav#connection#starting": "সংযোগ করা হচ্ছে",
-      "nav#connection#connected": "সংযুক্ত",
-      "nav#connection#stopping": "সংযোগ বিচ্ছিন্ন করা হচ্ছে",
-      "nav#connection#stopped": "সংযোগ বিচ্ছিন্ন",
-      "nav#settings": "বিন্যাস",
-      "nav#feedback": "প্রতিক্রিয়া",
-      "nav#logs": "কার্যবিবরণীগুলি",
-      "nav#about": "সম্বন্ধে",
-      "connection#starting-msg": "সাইফন হল<span class=\"state-word\"> সংযোগ করা</span>...",
-      "connection#stop-btn": "থামুন",
-      "connection#connected-msg": "সাইফন<span class=\"state-word\">সংযুক্ত</span>",
-      "connection#disconnect-btn": "সংযোগ বিচ্ছিন্ন করা",
-      "connection#stopping-msg": "সাইফন<span class=\"state-word\">সংযোগ বিচ্ছিন্ন হচ্ছে</span>...",
-      "connection#wait-btn": "অনুগ্রহপূর্বক অপেক্ষা করুন…",
-      "connection#stopped-msg": "সাইফন<span class=\"state-word\">সংযোগ বিচ্ছিন্ন</span>",
-      "connection#connect-btn": "সংযোগ করুন",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>ত্রুটি!</strong>অগ্রসর হওয়ার আগে অনুগ্রহ করে ভুল মানগুলি ঠিক করুন।",
-      "settings#reset-button": "ডিফল্ট পুন:স্থাপন করুন",
-      "settings#apply-button": "পরিবর্তনগুলি প্রয়োগ করুন",
-      "settings#unapplied-changes-prompt#title": "সেটিংস পরিবর্তন হয়েছে",
-      "settings#unapplied-changes-prompt#body": "আপনি আপনার সেটিংস পরিবর্তন করেছেন, কিন্তু আপনি পরিবর্তন প্রয়োগ করেন নি।<br><br>আপনি কি এখন আপনার পরিবর্তনগুলি প্রয়োগ করতে চান বা তাদের বাতিল করতে চান?",
-      "settings#unapplied-changes-prompt#apply-button": "প্রয়োগ করা",
-      "settings#unapplied-changes-prompt#discard-button": "বাতিল করা",
-      "settings#vpn-incompatible-msg": "(L2TP / IPSec মোড এর সঙ্গে কাজ করে না।)",
-      "settings#vpn-incompatible-label": "L2TP / IP সেক",
-      "settings#split-tunnel#heading": "বিভক্ত টানেল",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "আপনার দেশের মধ্যে ওয়েবসাইটগুলি  প্রক্সি করবেন না",
-      "settings#disable-timeouts#heading": "ধীর নেটওয়ার্কগুলির জন্য সময়সীমা অক্ষম করুন",
-      "settings#disable-timeouts#help-text": "যদি সক্ষম করা হয়, তবে সাইফন সার্ভারের সাথে যোগাযোগ টাইম আউট হবে না।",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "ধীর গতির নেটওয়ার্কগুলির জন্য সময়সীমা অক্ষম করুন",
-      "settings#egress-region#heading": "সাইফন সার্ভার অঞ্চল",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "যুক্তরাষ্ট্র",
-      "settings#egress-region#select-ca": "কানাডা",
-      "settings#egress-region#select-gb": "যুক্তরাজ্য",
-      "settings#egress-region#select-jp": "জাপান",
-      "settings#egress-region#select-sg": "সিঙ্গাপুর",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "নেদারল্যান্ডস",
-      "settings#egress-region#select-de": "জার্মানি",
-      "settings#egress-region#select-in": "ভারত",
-      "settings#egress-region#select-es": "স্পেন",
-      "settings#egress-region#select-hk": "হংকং",
-      "settings#egress-region#select-at": "অস্ট্রিয়া",
-      "settings#egress-region#select-be": "বেলজিয়াম",
-      "settings#egress-region#select-bg": "বুলগেরিয়া",
-      "settings#egress-region#select-ch": "সুইজারল্যান্ড",
-      "settings#egress-region#select-cz": "চেক প্রজাতন্ত্র",
-      "settings#egress-region#select-dk": "ডেনমার্ক",
-      "settings#egress-region#select-fr": "ফ্রান্স",
-      "settings#egress-region#select-hu": "হাঙ্গেরি",
-      "settings#egress-region#select-it": "ইতালি",
-      "settings#egress-region#select-no": "নরওয়ে",
-      "settings#egress-region#select-ro": "রোমানিয়া",
-      "settings#egress-region#select-se": "সুইডেন",
-      "settings#egress-region#select-pl": "পোল্যান্ড",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "একটি বৈধ/কার্যকর সাইফন সার্ভার অঞ্চল নির্বাচন করুন।",
-      "settings#egress-region#error-modal-title": "সার্ভার অঞ্চল অনুপলব্ধ",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "স্থানীয় প্রক্সি পোর্ট",
-      "settings#local-proxy-ports#leave-blank": "ছেড়ে দিন<strong>খালি</strong>স্বয়ংক্রিয় পোর্ট নির্বাচনের জন্য (প্রস্তাবিত)।",
-      "settings#local-proxy-ports#reason": "আপনি যদি আপনার কম্পিউটারে টুলগুলি ব্যবহার করেন যার সাইফনের সাথে কাজ করার জন্য ম্যানুয়াল কনফিগারেশনের প্রয়োজন হয়, তাহলে আপনি সাইফোনকে একই স্থানীয় পোর্ট নম্বরগুলিকে ধারাবাহিকভাবে ব্যবহার করতে চান।যদি আপনার পোর্ট সংখ্যা নির্দিষ্ট করার কোনও কারণ না থাকে, তবে আপনার  সাইফনকে বিরোধিতা থেকে রক্ষা করতে স্বয়ংক্রিয়ভাবে পোর্ট সংখ্যা নির্বাচন করতে দেওয়া উচিত।",
-      "settings#local-proxy-ports#http-label": "এইচটিটিপি / এইচটিটিপিএস ",
-      "settings#port-value-error-msg": "1 এবং 65535 এর মধ্যে হওয়া আবশ্যক।",
-      "settings#local-proxy-ports#socks-label": "সক্স",
-      "settings#local-proxy-ports#unique-error-msg": "স্থানীয় পোর্ট একে অপরের থেকে আলাদা হতে হবে।",
-      "settings#local-proxy-ports#error-modal-title": "স্থানীয় প্রক্সি পোর্ট সংঘর্ষ",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>আপনি SOCKS প্রক্সির জন্য একটি নির্দিষ্ট স্থানীয় পোর্ট ব্যবহার করার জন্য Psiphon কনফিগার করেছেন।<br> তবে, যে পোর্ট ইতিমধ্যেই ব্যবহৃত হয় এবং তাই Psiphon এটি ব্যবহার করতে পারবে না। </p><p>অনুগ্রহ করে কনফিগার করা SOCKS প্রক্সি পোর্ট মান পরিবর্তন করুন এবং আবার চেষ্টা করুন। আমরা সুপারিশ করেছি যে আপনি মানটি স্পষ্ট করবেন যাতে সাইফোন স্বয়ংক্রিয়ভাবে একটি উপলব্ধ পোর্ট বেছে নিতে পারে।</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>আপনি SOCKS প্রক্সির জন্য একটি নির্দিষ্ট স্থানীয় পোর্ট ব্যবহার করার জন্য Psiphon কনফিগার করেছেন।<br> তবে, যে পোর্ট ইতিমধ্যেই ব্যবহৃত হয় এবং তাই Psiphon এটি ব্যবহার করতে পারবেন না। </p><p>অনুগ্রহ করে কনফিগার করা SOCKS প্রক্সি পোর্ট মান পরিবর্তন করুন এবং আবার চেষ্টা করুন। আমরা সুপারিশ করেছি যে আপনি মানটি স্পষ্ট করবেন যাতে সাইফোন স্বয়ংক্রিয়ভাবে একটি উপলব্ধ পোর্ট বেছে নিতে পারে।</p>",
-      "settings#upstream-proxy#heading": "আপস্ট্রিম প্রক্সি",
-      "settings#upstream-proxy#by-default": "আপনার কম্পিউটারে ইতিমধ্যে যে একটি প্রক্সি কনফিগার আছে, ডিফল্টভাবে সাইফন একটি টানেল স্থাপন করার সময় যে প্রক্সি ব্যবহার করবে। আপনি ব্যবহার করার জন্য একটি প্রক্সি উল্লেখ করে বা এই ধরনের \"আপস্ট্রিম প্রক্সি\" ব্যবহার করা উচিত না তা উল্লেখ করে, সে আচরণটি অগ্রাহ্য করতে পারেন।",
-      "settings#upstream-proxy#reason": "আপস্ট্রিম প্রক্সি কখনও কখনও বিদ্যালয়, বিশ্ববিদ্যালয়, বা ব্যবসার প্রয়োজন হয়। যদি আপনার নেটওয়ার্ক সরবরাহকারী আপনাকে আপস্ট্রিম প্রক্সি সেটিংস দেয়, তবে তাদের ম্যানুয়ালি সেটিংস এখানে সংযোগ করতে প্রয়োজন হতে পারে।",
-      "settings#upstream-proxy#proxy-reqs": "শুধু HTTPS / এইচটিটিপিএস সমর্থন করে এমন HTTP/ এইচটিটিপি প্রক্সিগুলি অনুমোদিত।",
-      "settings#upstream-proxy#hostname-label": "হোস্টনেম",
-      "settings#upstream-proxy#port-label": "পোর্ট",
-      "settings#upstream-proxy#username-label": "ব্যবহারকারীর নাম",
-      "settings#upstream-proxy#password-label": "পাসওয়ার্ড",
-      "settings#upstream-proxy#domain-label": "ডোমেইন",
-      "settings#upstream-proxy#skip-label": "আপস্ট্রিম প্রক্সি ব্যবহার করবেন না",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "আপস্ট্রিম প্রক্সি ত্রুটি",
-      "settings#upstream-proxy#error-modal-body-default": "সাইফোন বর্তমানে \"আপস্ট্রিম প্রক্সি\" হিসাবে আপনার সিস্টেম প্রক্সি ব্যবহার করার জন্য কনফিগার করা হয়।<br> যদিও, আমরা সেই প্রক্সির মাধ্যমে একটি সাইফন সার্ভারে সংযোগ করতে অক্ষম বলে মনে করি।<br> দয়া করে \"আপস্ট্রিম প্রক্সি ব্যবহার করবেন না\" সক্ষম করুন এবং আবার চেষ্টা করুন।",
-      "settings#upstream-proxy#error-modal-body-configured": "আপনি একটি \"\"আপস্ট্রিম প্রক্সি\" ব্যবহার করার জন্য সাইফন কনফিগার করেছেন।<br> যাইহোক, আমরা সেই প্রক্সির মাধ্যমে একটি সাইফন সার্ভারে সংযোগ করতে অক্ষম বলে মনে হচ্ছে।<br> অনুগ্রহপূর্বক সেটিংস ঠিক করুন এবং আবার চেষ্টা করুন।",
-      "settings#transport-mode#heading": "পরিবহন মোড",
-      "settings#transport-mode#check-label": "L2TP / IPSec মোড ব্যবহার করুন",
-      "settings#transport-mode#help-text": "উইন্ডোজ L2TP / IPSec ভার্চুয়াল নেটওয়ার্কিং ব্যবহার করে।এই মোড-এ আপনার সমস্ত অ্যাপ্লিকেশন টানেল হবে, কিন্তু এটি অপ্রকাশিত করা হয় না এবং তাই শক্তিশালী সেন্সরশিপ এড়ানোর ক্ষমতা নেই।অধিকাংশ ফায়ারওয়ালকে বাইপাস<strong> করার জন্য এটি</strong> সুপারিশ করা হয় না।",
-      "settings#systray-minimize#heading": "বিজ্ঞপ্তি এলাকা (সিস্টেম ট্রে) ছোট করুন",
-      "settings#systray-minimize#help-text": "যদি সক্ষম করা হয়, তবে যখন সাইফন অ্যাপ্লিকেশন উইন্ডোটি ছোট করে তখন সেটি বিজ্ঞপ্তি এলাকায় (যেটি আপনার উইন্ডোজ টাস্ক বারের ঘড়ির কাছাকাছি অবস্থিত \"সিস্টেম ট্রে\" বা \"সিস্ট্রে\" নামেও পরিচিত) লুকিয়ে রাখে।",
-      "settings#systray-minimize#reason": "নোটপ্যাডিং এলাকা (\"সিস্টেম ট্রে\") থেকে সাইফনকে ছোট করা আপনার টাস্ক বারে স্থান মুক্ত করে। এটি বিশেষভাবে সহায়ক যদি আপনি প্রায়ই দীর্ঘ সময় ধরে সাইফন চালান।",
-      "settings#systray-minimize#enable-label": "বিজ্ঞপ্তি এলাকা (সিস্টেম ট্রে) ছোট করুন",
-      "settings#applying-message": "আপনার সেটিংস প্রয়োগ করতে পুনরায় সংযোগ স্থাপন।",
-      "settings#saved-message": "সেটিংস সংরক্ষিত হয়েছে।",
-      "settings#error-modal#title": "সেটিংস ত্রুটি",
-      "settings#error-modal#body": "আপনার সেটিংস মানের মধ্যে ত্রুটি আছে। এগিয়ে যাওয়ার আগে তাদের সংশোধন করুন।",
-      "feedback#top_content_title": "আমাদের আপনার প্রতিক্রিয়া জানান",
-      "feedback#top_para_2": "সর্বশেষ সংস্করণটি ডাউনলোড করে অনেক সমস্যার সমাধান করা যেতে পারে।<a class=\"NewVersionURL\" href=\"#\">আপনি এখানে ক্লিক করে সর্বশেষ সংস্করণটি ডাউনলোড করতে পারেন</a>,অথবা আপনি একটি ইমেল পাঠাতে পারেন<a class=\"NewVersionEmail\" href=\"#\"></a>।",
-      "feedback#top_para_3": "আপনি আমাদের <a class=\"FaqURL\" href=\"#\">প্রায়শই জিজ্ঞাসিত প্রশ্নাবলীগুলির মধ্যে অনেক সাধারণ সমস্যার সমাধান খুঁজে পেতে পারেন</a>",
-      "feedback#smiley_happy": "সাইফন যেভাবে চান তা দিয়ে সংযোগ করে এবং সঞ্চালন করে।",
-      "feedback#smiley_sad": "সাইফন প্রায়ই সংযোগ স্থাপন করতে ব্যর্থ হয় বা যথেষ্ট পরিমাণে সঞ্চালন করে না।",
-      "feedback#text_feedback_prompt": "দয়া করে এখানে আপনার মন্তব্য লিখুন :",
-      "feedback#text_feedback_email_prompt": "আপনি যদি আমাদের উত্তর চান,তাহলে দয়া করে আপনার ইমেল ঠিকানা লিখুন :",
-      "feedback#diagnostic_check": "ডায়গনিস্টিক ডেটা আপলোড করুন। দয়া করে মনে রাখবেন যে এই ডায়গনিস্টিক ডেটা আপনাকে শনাক্ত করে না, এবং এটি সাইফনকে স্বচ্ছন্দে চালানোর জন্য আমাদের সহায়তা করবে।<a class=\"DataCollectionInfoURL\" href=\"#\">আমরা যে তথ্য সংগ্রহ করি তা দেখার জন্য এখানে ক্লিক করুন।</a>",
-      "feedback#submit_button": "দাখিল করা",
-      "feedback#text_feedback_bottom_para": "যদি উপরের ফর্মটি কাজ না করে, অথবা আপনি স্ক্রিনশটগুলি পাঠাতে চান, তাহলে দয়া করে আমাদের ইমেল করুন<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca-এ </a>।",
-      "feedback#success-message": "<strong>আপনাকে ধন্যবাদ!</strong>আপনার মতামত পাঠানো হয়েছে।",
-      "logs#show-debug-label": "ডিবাগ লগ দেখান",
-      "logs#placeholder": "এখনো কোন লগ নেই",
-      "language#success-message": "<strong>হ্যালো!</strong> সাইফন এ স্বাগতম।",
-      "about#wordart-tag": "সীমানার বাহিরে",
-      "about#description": "Psiphon একটি <strong>সেন্সরশিপ প্রতারণা টুল </strong>এটি খোলা ইন্টারনেট, অতীত সেন্সর এবং ফায়ারওয়াল-এ অ্যাক্সেস দেওয়ার জন্য ডিজাইন করা হয়েছে। এটা<strong> ওপেন সোর্স </strong>এবং টরন্টো, কানাডা- এ উন্নত হয়।",
-      "about#visit-download-site": "দয়া করে ওয়েবসাইট ভিজিট করুন<strong><a class=\"NewVersionURL\" href=\"#\">একটি নতুন সংস্করণ ডাউনলোড</a></strong> করতে বা <strong><a class=\"InfoURL\" href=\"#\">সহায়তা এবং তথ্যের জন্য।</a></strong>সাইফন অ্যান্ড্রয়েড এবং উইন্ডোজ এর জন্য উপলব্ধ।",
-      "about#get-by-email": "<strong>যদি ওয়েবসাইটটি উপলব্ধ না হয় </strong>তবে আপনি একটি ইমেল পাঠিয়ে সাইফনের একটি নতুন সংস্করণ পেতে পারেন:",
-      "about#client-version": "উইন্ডোজ ক্লায়েন্ট সংস্করণের জন্য সাইফন:",
-      "general#modal-close-button": "বন্ধ করা",
-      "general#notice-modal-tech-preamble": "এখানে প্রযুক্তিগত ত্রুটি তথ্য:",
-      "notice#systemproxysettings-setproxy-error-title": "সিস্টেম প্রক্সি ত্রুটি",
-      "notice#systemproxysettings-setproxy-error-body": "<p>সাইফন সিস্টেমের প্রক্সি সেটিংস সেট করতে ব্যর্থ হয়েছে।</p><p> এটি আপনার অ্যান্টিভাইরাস সফটওয়্যারের সাথে  বিরোধের কারণ হতে পারে।স্থানীয় সাইফন প্রক্সি ব্যবহার করার জন্য আপনাকে আপনার অ্যাপ্লিকেশন বা সিস্টেম প্রক্সি সেটিংসগুলি ম্যানুয়ালি কনফিগার করতে হতে পারে।</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "\"<% - data%>\" নামের ইন্টারনেট সংযোগের জন্য সাইফন সিস্টেমের প্রক্সি সেটিংস সেট করতে ব্যর্থ হয়েছে। এটি আপনার অ্যান্টিভাইরাস সফটওয়্যারের সাথে বিরোধের কারণে হতে পারে। স্থানীয় সাইফন প্রক্সি ব্যবহার করার জন্য আপনাকে আপনার অ্যাপ্লিকেশন বা সিস্টেম প্রক্সি সেটিংসগুলি ম্যানুয়ালি কনফিগার করতে হতে পারে।",
-      "appbackend#state-stopped-title": "সাইফন সংযোগ বিচ্ছিন্ন",
-      "appbackend#state-starting-title": "সাইফন সংযোগ করছে",
-      "appbackend#state-starting-body": "অনুগ্রহপূর্বক অপেক্ষা করুন…",
-      "appbackend#state-connected-title": "সাইফন সংযুক্ত",
-      "appbackend#state-connected-body": "আপনার সীমানার বাহিরে অন্বেষণ করুন",
-      "appbackend#state-connected-reminder-title": "সাইফন আপনাকে সংযুক্ত রেখেছে",
-      "appbackend#state-connected-reminder-body": "সাইফন বিনামূল্যে রাখুন। আমাদের পৃষ্ঠপোষক পৃষ্ঠা দেখার জন্য এখানে ক্লিক করুন!",
-      "appbackend#state-connected-reminder-body-2": "আমাদের পৃষ্ঠপোষক পৃষ্ঠাগুলি পরিদর্শন করে সাইফন বিনামূল্যে রাখুন!",
-      "appbackend#minimized-to-systray-title": "সাইফন বিজ্ঞপ্তি এলাকা থেকে ছোট করা হয়েছে",
-      "appbackend#minimized-to-systray-body": "অ্যাপ্লিকেশন পুনরুদ্ধার- এ আইকনে ক্লিক করুন",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 ঘন্টা",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "সৌজন্যে"
-    }
-  },
-  "bo": {
-    "name": "བོད་ཡིག",
-    "translation": {
-      "banner#long-connecting": "<strong>ཡིན་གྱི་མ་རེད། !</strong> ཁྱེད་རང་མཐུད་པའི་སྐབས་ལ་དཀའ་ངལ་འདུག!<br>\nསཡི་ཕོན་ཐོན་རིམ་གསར་ཤོས་ཕབ་ལེན་དྲྭ་ཚིགས་ནས <a class=\"NewVersionURL\" href=\"#\">ཕབ་ལེན་བྱེད།</a>\nཡང་ན་ང་ཚོར་གློག་འཕྲིན་གཏོང་སྟེ་ཕབ་ལེན་བྱེད། <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "མཐུད་བཞིན་པ།",
-      "nav#connection#connected": "མཐུད་ཚར་སོང་།",
-      "nav#connection#stopping": "མཐུད་མཚམས་བཞག་བཞིན་པ།",
-      "nav#connection#stopped": "མཐུད་མཚམས་བཞག",
-      "nav#settings": "སྒྲིག་བཀོད།",
-      "nav#feedback": "དགོངས་འཆར།",
-      "nav#logs": "ཉིན་ཐོ།",
-      "nav#about": "སྐོར།",
-      "connection#starting-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་བཞིན་པ།</span>…",
-      "connection#stop-btn": "མཚམས་འཇོག",
-      "connection#connected-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་བཞིན་པ།</span>",
-      "connection#disconnect-btn": "མཐུད་མཚམས་བཞག",
-      "connection#stopping-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་མཚམས་བཞག་བཞིན་པ།</span>…",
-      "connection#wait-btn": "ཏོག་ཙམ་འགུགས་རོགས།...",
-      "connection#stopped-msg": "སཡི་ཕོན་ <span class=\"state-word\">མཐུད་མཚམས་བཞག་བཞིན་པ།</span>…",
-      "connection#connect-btn": "མཐུད།",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>ནོར་སྐྱོན།</strong>ནོར་སྐྱོན་ཤོར་བ་རྣམས་མདུན་བསྐྱོད་མ་བྱས་གོང་དུ་བཅོས་རོགས་གནང་།",
-      "settings#reset-button": "བསྐྱར་དུ་སྒྲིག་སྟེ་རང་སོར་བཞག",
-      "settings#apply-button": "བསྒྱུར་བཅོས་ལག་བསྟར།",
-      "settings#unapplied-changes-prompt#title": "སྒྲིག་བཀོད་བསྒྱུར་བཅོས།",
-      "settings#unapplied-changes-prompt#body": "ཁྱེད་རང་གིས་སྒྲིག་བཀོད་ནང་ལ་བསྒྱུར་བ་བཏང་འདུག འོན་ཀྱང་ཁྱེད་རང་གིས་ལག་བསྟར་མཐེབ་གཞོངས་སྣོན་མིན་འདུག<br><br>ཁྱེད་རང་བསྒྱུར་བ་བཏང་བ་དེ་བེད་སྤྱོད་བཏང་འདོད་ཡོད་དམ་ཡང་ན་དོར་གྱི་ཡིན་ནམ།",
-      "settings#unapplied-changes-prompt#apply-button": "ལག་བསྟར།",
-      "settings#unapplied-changes-prompt#discard-button": "དོར་བ།",
-      "settings#vpn-incompatible-msg": "( L2TP/IPSec མཉམ་དུ་ལས་ཀ་བྱེད་མི་ཐུབ།)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "ཡུར་བ་ཁ་གྱེས་པ།",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "དྲྭ་རྒྱ་ངོ་ཚབ་འདི་སོ་སོའི་ལུང་པའི་ནང་ལ་མ་བཟོས།",
-      "settings#disable-timeouts#heading": "དྲྭ་རྒྱ་དལ་པོ་ཡོད་ཚེ་དུས་རྫོགས་མེད་པ་བཟོས",
-      "settings#disable-timeouts#help-text": "གལ་ཏེ་ཡོད་ན། སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ཁང་དང་འབྲེལ་མོལ་གྱི་དུས་ཚོད་རྫོགས་རྒྱུ་མེད།",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "དྲྭ་རྒྱ་དལ་པོ་ཡོད་ཚེ་དུས་རྫོགས་མེད་པ་བཟོས།",
-      "settings#egress-region#heading": "སཡི་ཕོན་ས་ཁུལ་ཞབས་ཞུ་འཕྲུལ་ཆས་",
-      "settings#egress-region#select-best-performance": "ནུས་པ་བཟང་ཤོས།",
-      "settings#egress-region#select-us": "ཨ་རི།",
-      "settings#egress-region#select-ca": "ཀེ་ན་ཌ།",
-      "settings#egress-region#select-gb": "དབྱིན་ཡུལ།",
-      "settings#egress-region#select-jp": "ཉི་ཧོང་།",
-      "settings#egress-region#select-sg": "སིངྒ་པུར།",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "ནེ་ཐར་ལེཌ།",
-      "settings#egress-region#select-de": "ཇར་མ་ནི།",
-      "settings#egress-region#select-in": "རྒྱ་གར།",
-      "settings#egress-region#select-es": "སི་པན།",
-      "settings#egress-region#select-hk": "ཧོང་ཀོང་།",
-      "settings#egress-region#select-at": "ཨོས་ཀྲི་ཡ།",
-      "settings#egress-region#select-be": "བྷེལ་ཇེམ།",
-      "settings#egress-region#select-bg": "བྷེལ་གེ་རེ་ཡ།",
-      "settings#egress-region#select-ch": "སུད་སི།",
-      "settings#egress-region#select-cz": "ཅེཀ་རི་པཱ་ལིཀ",
-      "settings#egress-region#select-dk": "ཌེན་མཀ།",
-      "settings#egress-region#select-fr": "ཕཱ་རན་སི།",
-      "settings#egress-region#select-hu": "ཧང་ཀ་རི།",
-      "settings#egress-region#select-it": "ཨི་ཀྲ་ལི།",
-      "settings#egress-region#select-no": "ནོར་ཝེ།",
-      "settings#egress-region#select-ro": "རོ་མ་ནི་ཡ།",
-      "settings#egress-region#select-se": "སི་ཝི་ཌན།",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "སཡི་ཕོན་ཁུངས་ལྡན་ས་གནས་ཞབས་ཞུ་འཕྲུལ་ཆས་གདམ་ག",
-      "settings#egress-region#error-modal-title": "ས་གནས་ཞབས་ཞུ་འཕྲུལ་ཆས་རྙེད་མ་སོང་།",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "ངོ་ཚབ་བསྟི་གནས་མཐུད་སྒོ།",
-      "settings#local-proxy-ports#leave-blank": "བཞག <strong>སྟོང་པ། </strong> རང་འགུལ་གྱི་མཐུད་ཁ་གདམ་ག་ (ངོ་སྤྲོད།)",
-      "settings#local-proxy-ports#reason": "གལ་ཏེ་ཁྱེད་རང་གི་གློག་ཀླད་སྒང་ལ་་སཡི་ཕོན་དང་མཉམ་དུ་ལས་ཀ་བྱེད་ཐུབ་པའི་ཆེད་དུ་མཛུབ་འདེབས་སྒྲིག་བཀོད་བྱེད་དགོས་ན། སཡི་ཕོན་གྱིས་ས་ཁུལ་མཐུད་སྒོ་ཨང་གྲངས་གཅིག་པ་ཞིག་ག་དུས་ཡིན་རུང་བེད་སྤྱོད་བྱེད་དགོས། གལ་ཏེ་ཁྱེད་རང་ལ་མཐུད་སྒོའི་ཨང་གྲངས་་དམིགས་སུ་བཀར་ནས་སྟོན་ཐུབ་པའི་རྒྱུ་མཚན་མ་མཐོང་ན། ཁྱེད་རང་གིས་སཡི་ཕོན་རང་འགུལ་ངང་ནས་འདེམས་བཅུག་པའི་ཆོག་མཆན་སྤྲད་ནས་དཀའ་ངལ་སེལ་བར་ཕན་ཐོག་བྱེད་ཀྱི་རེད།",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "ངེས་པར་དུ་1 ནས་ 65535བར་དུ་དགོས།",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "བསྟི་གནས་མཐུད་སྒོ་རྣམས་ཕན་ཚུན་མི་འདྲ་ངེས་པར་དུ་དགོས།",
-      "settings#local-proxy-ports#error-modal-title": "བསྟི་གནས་ངོ་ཚབ་མཐུད་སྒོར་འགལ་ཟླ།",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nཁྱེད་རང་གིས་སཡི་ཕོན་ལ་HTTP ངོ་ཚབ་ཀྱི་ཆེད་དུ་བསྟི་གནས་ངོ་ཚབ་མཐུད་སྒོ་བེད་སྤྱོད་བྱེད་རྒྱུར་སྒྲིག་བཀོད་བྱས་འདུག<br>.\nཡིན་ནའང་མཐུད་སྒོ་དེ་ད་ལྟ་གཞན་ཞིག་གིས་བེད་སྤྱོད་གཏོང་བཞིན་པ་ཡིན་སྟབས་སཡི་ཕོན་གྱིས་བེད་སྤྱོད་བྱེད་མི་ཐུབ།\n</p>\n<p>\nསྒྲིག་བཀོད་བྱས་པའི་HTTP ངོ་ཚབ་མཐུད་སྒོ་བརྗེས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གཅིག་གནང་རོགས། ང་ཚོའི་རེ་བ་་ལ་ཁྱེད་རང་གིས་མཐུད་སྒོ་དེ་གཙང་མ་བཟོས་ཏེ་སཡི་ཕོན་གྱིས་རང་འགུལ་ངང་ནས་མཐུད་སྒོ་གཞན་ཞིག་འདེམས་ཐུབ།\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nཁྱེད་རང་གིས་སཡི་ཕོན་སྒྲིག་བཀོད་བྱད་ནས་་SOCKS ངོ་ཚབ་བསྟི་གནས་མཐུད་སྒོ་བེད་སྤྱོད་བྱེ་བྲག་པ་བེད་སྤྱོད་བྱེད་ཆེད་དུ་ཡིན་<br>\nཡིན་ནའང་མཐུད་སྒོ་དེ་ད་ལྟ་བེད་སྤྱོད་གཏོང་བཞིན་པས་སཡི་ཕོན་གྱིས་བེད་སྤྱོད་བཏང་མི་ཐུབ།\n</p>\n<p>\nམཁྱེན་རྟོགས་ཀྱི་སླད་དུ་སྒྲིག་བཀོད་བྱས་པའིSOCKS ངོ་ཚབ་མཐུད་སྒོ་བརྗེས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གཅིག་གནང་རོགས། ང་ཚོའི་རེ་བ་་ལ་ཁྱེད་རང་གིས་མཐུད་སྒོ་དེ་གཙང་མ་བཟོས་ཏེ་སཡི་ཕོན་གྱིས་རང་འགུལ་ངང་ནས་མཐུད་སྒོ་གཞན་ཞིག་འདེམས་ཐུབ།.\n</p>",
-      "settings#upstream-proxy#heading": "ངོ་ཚབ་ནང་འཇུག",
-      "settings#upstream-proxy#by-default": "གལ་ཏེ་ཁྱེད་རང་གི་གློག་ཀླད་འདི་ལ་ངོ་ཚབ་སྒྲིག་བཀོད་བྱེད་ཚར་ཡོད་ན། ཡུར་བ་གསར་འཛུགས་བྱས་པའི་ཚེ་སཡི་ཕོན་གྱིས་རང་སོར་བཞག་པའི་ཐོག་ལ་ངོ་ཚབ་བེད་སྤྱོད་བྱེད་ཀྱི་རེད། ཁྱེད་རང་གིས་སྤྱོད་ཚུལ་འདི་ལ་སྐྱར་དུ་འཇུག་ཏེ་མིང་ངོ་ཚབ་བྱེ་བྲག་པ་ཞིག་བེད་སྤྱོད་བཏང་བའམ།  ཡང་ན་\"ངོ་ཚབ་ནང་བཅུག\"་འདི་འདྲ་ཞིག་ངེས་པར་དུ་སྤྱོད་དགོས་ཞེས་མིང་སྨོས་བྱེད་དགོས།",
-      "settings#upstream-proxy#reason": "ངོ་ཚབ་ནང་བཅུག་རྣམས་སྐབས་རེ་སློབ་གྲྭ་ཁག་དང་། མཐོ་སློབ། ཡང་ན་ཚོང་འབྲེལ་སོགས་ལ་དགོས་མཁོ་ཡོད། གལ་ཏེ་ཁྱེད་རང་གི་དྲྭ་རྒྱ་ཞབས་ཞུ་ཁང་གིས་རང་ལ་ངོ་ཚབ་ནང་བཅུག་སྒྲིག་བཀོད་སྤྲད་པ་ན་འདིར་མཐུད་ཐུབ་པའི་ཆེད་དུ་མཛུབ་འདེམས་སྒྲིག་བཀོད་བྱེད་དགོས་ཀྱི་རེད།",
-      "settings#upstream-proxy#proxy-reqs": "HTTPངོ་ཚབ་ཀྱིས་ HTTPS ལ་རྒྱབ་སྐྱོར་ངོས་ལེན་ཡོད།",
-      "settings#upstream-proxy#hostname-label": "དོ་བདག་གི་མིང་།",
-      "settings#upstream-proxy#port-label": "མཐུད་སྒོ།",
-      "settings#upstream-proxy#username-label": "སྤྱོད་མིང་།",
-      "settings#upstream-proxy#password-label": "གསང་ཨང་།",
-      "settings#upstream-proxy#domain-label": "དྲྭ་རྒྱའི་ཁ་བྱང་།",
-      "settings#upstream-proxy#skip-label": "ངོ་ཚབ་ནང་འཇུག་བེད་སྤྱོད་མ་བྱས།",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "ངོ་ཚབ་ནང་འཇུག་ནོར་སྐྱོན།",
-      "settings#upstream-proxy#error-modal-body-default": "གནས་སྐབས་རིང་ལ་སཡི་ཕོན་ནས་ཁྱེད་རང་གི་ངོ་ཚབ་འགྲོ་ལུགས་དེ་བཞིན་དེའི་\"ནང་འཇུག་ངོ་ཚབ་\"ལ་བཀོད་སྒྲིག་བྱས་ཡོད<br>\nཡིན་ནའང་ང་ཚོས་ངོ་ཚབ་དེ་རྒྱུད་དེ་སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ལ་མཐུད་ཐུབ་ཀྱི་མིན་འདུག<br>\n\"ནང་འཇུག་ངོ་ཚབ་བེད་སྤྱོད་མ་བྱེད་\" འདེམས་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གནང་རོགས།",
-      "settings#upstream-proxy#error-modal-body-configured": "ཁྱེད་རང་གིས་སཡི་ཕོན་ལ་\"ནང་འཇུག་ངོ་ཚབ་\" བེད་སྤྱོད་བྱེད་རྒྱུར་སྒྲིག་བཀོད་བྱས་འདུག<br>\nཡིན་ནའང་ང་ཚོས་ངོ་ཚབ་དེ་རྒྱུད་དེ་སཡི་ཕོན་ཞབས་ཞུ་འཕྲུལ་ཆས་ལ་མཐུད་ཐུབ་ཀྱི་མིན་འདུག<br>\nསྒྲིག་བཀོད་ལ་བཟོ་བཅོས་རྒྱབ་ནས་ཡང་སྐྱར་ཐབས་ཤེས་གནང་རོགས།",
-      "settings#transport-mode#heading": "འོར་འདྲེན་བྱེད་ཚུལ།",
-      "settings#transport-mode#check-label": " L2TP/IPSec བེད་སྤྱོད་བྱེད་ཚུལ།",
-      "settings#transport-mode#help-text": "ཝིན་ཌོ་ནང་L2TP/IPSec རྟོག་བཟོའི་དྲྭ་རྒྱ་བེད་སྤྱོད་བྱེད།་ འདིས་ཁྱེད་རང་གི་མཉེན་ཆས་ཚང་མ་ཡུར་བའི་ནང་བཅུག་གི་རེད། ཡིན་ནའི་དེས་གནས་ཚུལ་དེ་དག་སྦས་ཀྱི་མེད་ཅིང་ཉེན་གཡོལ་གྱི་ནུས་པའང་ཤུགས་ཆེན་པོ་མེད། འདི་ནི་ <strong>མེ་གྱང་བརྒལ་ནས་འགྲོ་ཐུབ་པའི་ཆེད་དུ་</strong> ང་ཚོས་ངོས་སྦྱོར་བྱེད་ཀྱི་མེད།",
-      "settings#systray-minimize#heading": "བརྡ་ཐོ་གནས་ས་སྟིམ་ (System Tray)",
-      "settings#systray-minimize#help-text": "གལ་ཏེ་འདེམས་ན། སཡི་ཕྷོན་མཉེན་ཆས་སྟིམ་སྐབས་ཝིན་ཌོ་ཡིས་བརྡོ་ཐོ་གནས་ས་སྦས་ཀྱི་ཡོད་ལ། (འདི་ལ་མིང་གཞན་“system tray” or “systray”ཡང་ཟེར་ཞིང་དེ་ནི་དྲྭ་ཤེལ་སྒང་གི་ལས་འགན་ཚན་བྱང་གི་ཆུ་ཚོད་གི་འགྲམ་ལ་ཡོད།)",
-      "settings#systray-minimize#reason": "སཡི་ཕོན་འདི་ཆུང་དུ་བཏང་ནས་་བརྡ་ཐོ་གནས་སར་“system tray”་བཀོད་ནས་ལས་འགན་ཚན་བྱང་གི་ས་མིག་སྟོང་པ་བཟོས་། འདིས་ཁྱེད་རང་ལ་སཡི་ཕོན་མཉེན་ཆས་དུས་ཡུན་རིང་པོའི་བར་དུ་འཁོར་སྐྱོད་བྱེད་པ་ལ་དམིགས་བསལ་གྱི་ཕན་ཐོག་ཡོད།",
-      "settings#systray-minimize#enable-label": "བརྡ་ཁྱབ་གནས་ས་ཆུང་དུ་གཏོང་། ",
-      "settings#applying-message": "ཁྱེད་རང་གིས་སྒྲིག་བཀོད་བྱས་པ་འདི་ཡང་སྐྱར་མཐུད་བཞིན་ཡོད།",
-      "settings#saved-message": "སྒྲིག་བཀོད་ཉར་ཚགས།",
-      "settings#error-modal#title": "སྒྲིག་བཀོད་ནོར་བ།",
-      "settings#error-modal#body": "ཁྱེད་རང་གི་སྒྲིག་བཀོད་ནང་ལ་ནོར་སྐྱོན་ཤོར་འདུག རྒྱུན་སྐྱོང་མ་གནང་གོང་ལ་བསྒྱུར་བ་གཏོང་རོགས་གནང་།",
-      "feedback#top_content_title": "སྐུ་ཉིད་ནས་ང་ཚོར་དགོངས་འཆར་གནང་རོགས།",
-      "feedback#top_para_2": "མཉེན་ཆས་ཐོན་གསར་ཤོས་དེ་ཕབ་ལེན་བྱས་པ་ལ་བརྟེན་ནས་དཀའ་ངལ་མང་དག་ཅིག་བཅོས་ཐུབ་།  ཁྱེད་རང་<a class=\"NewVersionURL\" href=\"#\">འདིར་སྣོན་ནས་ཐོན་གསར་ཤོས་འདི་ཕབ་ལེན་བྱེད།</a>ཡང་ན་ཁྱེད་རང་གིས་ཁ་བྱང་འདིའི་སྒང་ལ་གློག་འཕྲིན་གཏོང་།<a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "feedback#top_para_3": "ང་ཚོས་ཁྱེད་རང་ལ་<a class=\"FaqURL\" href=\"#\">ཡང་སེ་དྲིས་པའི་དྲི་བ་</a>ཁག་དང་ཐུན་མོང་ལ་ཕྲད་བཞིན་པའི་དཀའ་ངལ་རྣམས་སེལ་བའི་ཐབས་ལམ་རྣམས་རྙེད་ཐུབ། ",
-      "feedback#smiley_happy": "ང་རང་གི་འདོད་མོས་ལྟར་སཡི་ཕོན་བེད་སྤྱོད་བྱེད་ཐུབ་ཀྱི་འདུག",
-      "feedback#smiley_sad": "སཡི་ཕོན་ཡང་སེ་མཐུད་མི་ཐུབ་པ་དང་ལས་ཀ་ཡག་པོ་ཞེ་དྲག་བྱེད་ཐུབ་ཀྱི་མིན་འདུག",
-      "feedback#text_feedback_prompt": "ཁྱེད་རང་གི་མཆན་འདིར་བཞག་རོགས།",
-      "feedback#text_feedback_email_prompt": "གལ་ཏེ་ང་ཚོས་ཁྱེད་རང་ལ་ལན་འདེབས་བྱེད་དགོས་ན་ཁྱེད་རང་གི་གློག་འཕྲིན་ཁ་བྱང་བཅུག་རོགས་གནང་།",
-      "feedback#diagnostic_check": "བརྟག་དཔྱད་བྱས་པའི་ཡིག་ཆ་རྣམས་ནང་འཇུག་བྱེད། མཁྱེན་རྟོགས་ཀྱི་སླད་དུ་བརྟག་དཔྱད་བྱས་པའི་ཡིག་ཆ་ཁག་གིས་རང་ངོས་འཛིན་ཐུབ་ཀྱི་མེད། འདིས་སཡི་ཕོན་ལས་སླ་པོའི་ངང་ནས་འཁོར་སྐྱོད་བྱེད་ཐུབ་པར་ཕན་ཐོག་ཡོང་གི་ཡོད།  <a class=\"DataCollectionInfoURL\" href=\"#\">ང་ཚོས་ཡིག་ཆ་གང་མཁོ་བསྡུ་བྱས་ཡོད་མེད་གཟིགས་ན་འདིར་སྣོན།</a>",
-      "feedback#submit_button": "ཐོ་བཀོད་བྱས་པ།",
-      "feedback#text_feedback_bottom_para": "གོང་གི་འགེངས་ཤོག་འདི་ལས་ཀ་བྱེད་ཀྱི་མེད་པ་དང་། ཡང་ན་ཁྱེད་རང་གིས་ང་ཚོར་པར་ལེན་བྱེད་འདོད་ན་གཤམ་གྱི་གློག་འཕྲིན་ལ་ཡིག་ལན་སྐུར་རོགས།<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>ཐུགས་རྗེ་ཆེ། </strong> ཁྱེད་རང་གི་དགོངས་འཆར་སྐུར་ཟིན།",
-      "logs#show-debug-label": "སྐྱོན་སེལ་གྱི་ཉིན་ཐོ་སྟོན།",
-      "logs#placeholder": "ད་ལྟ་ཉིན་ཐོ་མིན་འདུག",
-      "language#success-message": "<strong>འཚམས་འདྲི་ཞུ།</strong> སཡི་ཕོན་ལ་ཕེབས་པར་དགའ་བསུ་ཞུ།",
-      "about#wordart-tag": "བརྒལ་མཚམས་མེད་པ།",
-      "about#description": "སཡི་ཕོན་ནི་ <strong>དམ་བསྒྲགས་ཅན་གྱི་ཉེན་གཡོལ་ལག་ཆ་ཞིག་ཡིན། </strong> — བཟོ་བཀོད་འདིས་དྲྭ་རྒྱ་རང་དབང་གིས་ཐོག་ནས་ལྟ་ཐུབ་པ་མ་ཟད་ཞ་སྔར་གྱི་དམ་བསྒྲགས་དང་མེ་གྱང་སོགས་བརྒལ་ནས་ལྟ་ཐུབ། འདི་ནི་<strong>ཕྱི་གསལ་ནང་གསལ་གྱི་ཨང་རྟགས་</strong> དང་ཁེ་ན་ཌའི་རྒྱལ་ས་ཊོ་རོན་ཌོ་ནས་བཟོས་པ་རེད།",
-      "about#visit-download-site": "དྲྭ་རྒྱར་གཟིགས་ཞིབ་ <strong><a class=\"NewVersionURL\" href=\"#\">དང་ཐོན་གསར་པ་ཕབ་ལེན་གནང་རོགས། </a></strong> ཡང་ན། <strong><a class=\"InfoURL\" href=\"#\">འདི་ནས་རོགས་རམ་དང་གནས་ཚུལ་ཤེས་ཐུབ་</a></strong> སཡི་ཕོན་ནི་ཨེན་ཀྲོཌ་དང་ཝིན་ཌོ་གཉིས་ཀར་ཡོད། ",
-      "about#get-by-email": "<strong>གལ་ཏེ་དྲྭ་ཚིགས་འདི་བལྟ་མ་ཐུབ་ན་</strong>ཁྱེད་རང་གིས་འདིར་གློག་་འཕྲིན་བཏང་ནས་སཡི་ཕོན་ཐོན་གསར་པ་འདི་རགས་ཐུབ།:",
-      "about#client-version": "ཝིན་ཌོ་སྒེར་སྤྱོད་གྱི་ཐོན་རིམ་ཆེད་དུ་སཡི་ཕོན་:",
-      "general#modal-close-button": "སྒོ་རྒྱབ།",
-      "general#notice-modal-tech-preamble": "འདིར་འཕྲུལ་ཆས་དང་འབྲེལ་བའི་དཀའ་ངལ་ཕྲད་འདུག:",
-      "notice#systemproxysettings-setproxy-error-title": "ངོ་ཚབ་འགྲོ་ལུགས་ནོར་བ།",
-      "notice#systemproxysettings-setproxy-error-body": "<p>སཡི་ཕོན་གྱི་ལམ་ལུགས་ངོ་ཚབ་སྒྲིག་བཀོད་དེ་སྒྲིག་ཐུབ་མ་སོང་།</p>\n<p>དེ་ནི་ཁྱེད་རང་གི་དྲྭ་འབུ་འགོག་བྱེད་ཀྱི་མཉེན་ཆས་ལ་འགལ་ཟླ་འབྱུང་བའི་རྐྱེན་གྱིས་མིན་ནམ་སྙམ། དེར་ཁྱེད་རང་གི་མཉེན་ཆས་འདི་མཛུབ་འདེམས་སྒྲིག་དགོས་པ་དང་། ཡང་ན་ལམ་ལུགས་སྒྲིག་བཀོད་བེད་སྤྱོད་བྱས་ནས་བསྟི་གནས་སཡི་ཕོན་ངོ་ཚབ་བེད་སྤོྱོད་བྱེད།</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "སཡི་ཕོན་གྱིས་དྲྭ་རྒྱ་མཐུད་མིང་“<%- data %>”འདིར་འགྲོ་ལུགས་ངོ་ཚབ་སྒྲིག་བཀོད་བྱེད་ཐུབ་མ་སོང་། དེ་ནི་ཁྱེད་རང་གི་དྲྭ་འབུ་འགོག་བྱེད་ཀྱི་མཉེན་ཆས་དང་འགལ་ཟླ་ཡོད་པའི་རྐྱེན་གྱིས་ཡིན་སྲིད། དེར་ཁྱེད་རང་གི་མཉེན་ཆས་འདི་མཛུབ་འདེམས་སྒྲིག་དགོས་པ་དང་། ཡང་ན་ལམ་ལུགས་སྒྲིག་བཀོད་བེད་སྤྱོད་བྱས་ནས་བསྟི་གནས་སཡི་ཕོན་ངོ་ཚབ་བེད་སྤོྱོད་བྱེད།",
-      "appbackend#state-stopped-title": "སཡི་ཕོན་མཐུད་ཁ་ཆད་སོང་།",
-      "appbackend#state-starting-title": "སཡི་ཕོན་མཐུད་བཞིན་པ།",
-      "appbackend#state-starting-body": "ཏོག་ཙམ་འགུགས་རོགས།",
-      "appbackend#state-connected-title": "སཡི་ཕོན་མཐུད་ཡོད།",
-      "appbackend#state-connected-body": "རང་གི་བརྒལ་མཚམས་ནས་བརྒལ་ཏེ་བསྐྱོད།",
-      "appbackend#state-connected-reminder-title": "སཡི་ཕོན་མཉེས་ཆས་ཀྱིས་ཁྱེད་རང་མཐུད་ཡོད།",
-      "appbackend#state-connected-reminder-body": "སཡི་ཕོན་རིན་མེད་བཞག་རོགས་གནང་། འདིར་སྣོན་ནས་ང་ཚོའི་སྦྱིན་བདག་ཁག་གི་ཐོ་གཞུང་ལ་གཟིགས་།",
-      "appbackend#state-connected-reminder-body-2": "ང་ཚོའི་སྦྱིན་བདག་ཁག་གི་དྲྭ་ངོས་གཟིགས་ན་སཡི་ཕོན་དྲ་ཚིགས་རིན་མེད་ཐོག་བཞག་རོགས།!",
-      "appbackend#minimized-to-systray-title": "སཡི་ཕོན་དྲྭ་ཚིགས་འདི་བརྡ་གཏོང་སའི་གནས་སུ་ཆུང་དུ་བཏང་ནས་བཞག་ཡོད།",
-      "appbackend#minimized-to-systray-body": "འདྲ་རྟགས་འདི་ལ་སྣོན་ནས་མཉེན་ཆས་སྐྱར་འཇུག་བྱེད།",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "ཆུ་ཚོད་༡",
-      "psicash#1-day": "ཉིན་༡",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "སྦྱིན་བདག་བྱེད་མཁན།"
-    }
-  },
-  "de": {
-    "name": "Deutsch",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Verbinde",
-      "nav#connection#connected": "Verbunden",
-      "nav#connection#stopping": "Trenne",
-      "nav#connection#stopped": "Getrennt",
-      "nav#settings": "Einstellungen",
-      "nav#feedback": "Rückmeldung",
-      "nav#logs": "Protokolle",
-      "nav#about": "Über",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">verbindet</span> sich…",
-      "connection#stop-btn": "Stopp",
-      "connection#connected-msg": "Psiphon ist <span class=\"state-word\">verbunden</span>",
-      "connection#disconnect-btn": "Trennen",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">trennt</span> sich…",
-      "connection#wait-btn": "Bitte warten…",
-      "connection#stopped-msg": "Psiphon ist <span class=\"state-word\">getrennt</span>",
-      "connection#connect-btn": "Verbinden",
-      "connection#egress-region-combo-label": "Serverregion auswählen",
-      "settings#error-alert": "<strong>Fehler!</strong> Bitte korrigieren Sie falsche Werte, bevor Sie fortfahren.",
-      "settings#reset-button": "Auf Standardeinstellung zurücksetzen",
-      "settings#apply-button": "Änderungen anwenden",
-      "settings#unapplied-changes-prompt#title": "Einstellungen geändert.",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "Anwenden",
-      "settings#unapplied-changes-prompt#discard-button": "Verwerfen",
-      "settings#vpn-incompatible-msg": "(Funktioniert nicht mit dem L2TP/IPSec-Modus.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Tunnel aufteilen",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Webseiten innerhalb Ihres Landes nicht über Proxy leiten",
-      "settings#disable-timeouts#heading": "Zeitüberschreitungen für langsame Netzwerke deaktivieren",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Zeitüberschreitungen für langsame Netzwerke deaktivieren",
-      "settings#egress-region#heading": "Psiphon-Serverregion",
-      "settings#egress-region#select-best-performance": "Beste Leistung",
-      "settings#egress-region#select-us": "Vereinigte Staaten",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Vereinigtes Königreich",
-      "settings#egress-region#select-jp": "Japan",
-      "settings#egress-region#select-sg": "Singapur",
-      "settings#egress-region#select-sk": "Slowakei",
-      "settings#egress-region#select-nl": "Niederlande",
-      "settings#egress-region#select-de": "Deutschland",
-      "settings#egress-region#select-in": "Indien",
-      "settings#egress-region#select-es": "Spanien",
-      "settings#egress-region#select-hk": "Hongkong",
-      "settings#egress-region#select-at": "Österreich",
-      "settings#egress-region#select-be": "Belgien",
-      "settings#egress-region#select-bg": "Bulgarien",
-      "settings#egress-region#select-ch": "Schweiz",
-      "settings#egress-region#select-cz": "Tschechische Republik",
-      "settings#egress-region#select-dk": "Dänemark",
-      "settings#egress-region#select-fr": "Frankreich",
-      "settings#egress-region#select-hu": "Ungarn",
-      "settings#egress-region#select-it": "Italien",
-      "settings#egress-region#select-no": "Norwegen",
-      "settings#egress-region#select-ro": "Rumänien",
-      "settings#egress-region#select-se": "Schweden",
-      "settings#egress-region#select-pl": "Polen",
-      "settings#egress-region#select-rs": "Serbien",
-      "settings#egress-region#select-au": "Australien",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Wählen Sie eine gültige Psiphon-Serverregion aus.",
-      "settings#egress-region#error-modal-title": "Serverregion nicht verfügbar",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Lokale Proxy-Ports",
-      "settings#local-proxy-ports#leave-blank": "<strong>Leer</strong> lassen für automatische Portauswahl (empfohlen).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Muss zwischen 1 und 65535 sein.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Lokale Ports müssen voneinander verschieden sein.",
-      "settings#local-proxy-ports#error-modal-title": "Lokaler Proxy-Portkonflikt",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Vorgeschalteter Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Zulässig sind nur HTTP-Proxies die HTTPS unterstützen.",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Benutzername",
-      "settings#upstream-proxy#password-label": "Passwort",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Vorgeschalteten Proxy nicht verwenden",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Fehler beim vorgeschalteten Proxy",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Übertragungsmodus",
-      "settings#transport-mode#check-label": "L2TP/IPSec-Modus verwenden",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "In Benachrichtigungsfeld (Infobereich) minimieren",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "In das Benachrichtigungsfeld (Infobereich) minimieren",
-      "settings#applying-message": "Neuer Verbindungsaufbau, um Ihre Einstellungen anzuwenden.",
-      "settings#saved-message": "Einstellungen gespeichert.",
-      "settings#error-modal#title": "Einstellungsfehler",
-      "settings#error-modal#body": "Es gibt Fehler in Ihren Einstellungswerten. Bitte korrigieren Sie diese, bevor Sie fortfahren.",
-      "feedback#top_content_title": "Geben Sie uns Ihre Rückmeldung",
-      "feedback#top_para_2": "Viele Probleme können durch das Herunterladen der neuesten Version behoben werden. Sie können die <a class=\"NewVersionURL\" href=\"#\">neueste Version herunterladen, wenn Sie hier klicken</a> oder eine E-Mail an <a class=\"NewVersionEmail\" href=\"#\"></a> senden.",
-      "feedback#top_para_3": "Lösungen für viele häufig auftretende Probleme finden Sie auch in unseren <a class=\"FaqURL\" href=\"#\">häufig gestellten Fragen</a>.",
-      "feedback#smiley_happy": "Psiphon verbindet sich und funktioniert wie ich es haben will.",
-      "feedback#smiley_sad": "Psiphon schlägt oft fehl oder funktioniert nicht gut genug.",
-      "feedback#text_feedback_prompt": "Bitte geben Sie Ihre Kommentare hier ein:",
-      "feedback#text_feedback_email_prompt": "Bitte geben Sie Ihre E-Mail-Adresse ein, wenn Sie möchten, dass wir Ihnen antworten:",
-      "feedback#diagnostic_check": "Diagnosedaten hochladen. Bitte beachten Sie, dass diese Diagnosedaten Sie nicht identifizieren und sie werden uns dabei helfen, Psiphon reibungslos am Laufen zu halten. <a class=\"DataCollectionInfoURL\" href=\"#\">Klicken Sie hier, um zu sehen, welche Daten wir erheben.</a>",
-      "feedback#submit_button": "Absenden",
-      "feedback#text_feedback_bottom_para": "Schreiben Sie bitte eine E-Mail an <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>, wenn das Formular oben nicht funktioniert oder Sie uns Bildschirmfotos schicken möchten.",
-      "feedback#success-message": "<strong>Danke!</strong> Ihre Rückmeldung wurde gesendet.",
-      "logs#show-debug-label": "Fehlersuchprotokolle anzeigen",
-      "logs#placeholder": "Noch keine Protokolle",
-      "language#success-message": "<strong>Hallo!</strong> Willkommen bei Psiphon.",
-      "about#wordart-tag": "Jenseits von Grenzen",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>Wenn die Webseite nicht erreichbar ist</ strong>, können Sie eine neue Version von Psiphon erhalten, indem Sie eine E-Mail senden an:",
-      "about#client-version": "Psiphon für Windows-Client-Version:",
-      "general#modal-close-button": "Schließen",
-      "general#notice-modal-tech-preamble": "Hier ist die technische Fehlerinformation:",
-      "notice#systemproxysettings-setproxy-error-title": "Systemproxyfehler",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon ist getrennt",
-      "appbackend#state-starting-title": "Psiphon verbindet sich",
-      "appbackend#state-starting-body": "Bitte warten…",
-      "appbackend#state-connected-title": "Psiphon ist verbunden",
-      "appbackend#state-connected-body": "Entdecken Sie jenseits Ihrer Grenzen!",
-      "appbackend#state-connected-reminder-title": "Psiphon hält Sie verbunden",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon wurde in das Benachrichtigungsfeld minimiert",
-      "appbackend#minimized-to-systray-body": "Klicken Sie auf das Symbol, um die Anwendung wiederherzustellen",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash-Serverfehler",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 Stunde",
-      "psicash#1-day": "1 Tag",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon-Verbindung erforderlich",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Gefördert durch"
-    }
-  },
-  "devltr": {
-    "name": "[Ƥȧȧƈķȧȧɠḗḗḓ Ȧȧƈƈḗḗƞŧḗḗḓ]",
-    "translation": {
-      "about#client-version": "[Ƥşīīƥħǿǿƞ ƒǿǿř Ẇīīƞḓǿǿẇş ƈŀīīḗḗƞŧ ṽḗḗřşīīǿǿƞ:]",
-      "about#description": "[Ƥşīīƥħǿǿƞ īīş ȧȧ <strong>ƈḗḗƞşǿǿřşħīīƥ ƈīīřƈŭŭḿṽḗḗƞŧīīǿǿƞ ŧǿǿǿǿŀ</strong> — īīŧ īīş ḓḗḗşīīɠƞḗḗḓ ŧǿǿ ɠīīṽḗḗ ȧȧƈƈḗḗşş ŧǿǿ ŧħḗḗ ǿǿƥḗḗƞ Īīƞŧḗḗřƞḗḗŧ, ƥȧȧşŧ ƈḗḗƞşǿǿřş ȧȧƞḓ ƒīīřḗḗẇȧȧŀŀş. Īīŧ īīş <strong>ǿǿƥḗḗƞ şǿǿŭŭřƈḗḗ</strong> ȧȧƞḓ ḓḗḗṽḗḗŀǿǿƥḗḗḓ īīƞ Ŧǿǿřǿǿƞŧǿǿ, Ƈȧȧƞȧȧḓȧȧ.]",
-      "about#get-by-email": "[<strong>Īīƒ ŧħḗḗ ẇḗḗƀşīīŧḗḗ īīş īīƞȧȧƈƈḗḗşşīīƀŀḗḗ</strong>, ẏǿǿŭŭ ƈȧȧƞ ɠḗḗŧ ȧȧ ƞḗḗẇ ṽḗḗřşīīǿǿƞ ǿǿƒ Ƥşīīƥħǿǿƞ ƀẏ şḗḗƞḓīīƞɠ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ:]",
-      "about#visit-download-site": "[Ƥŀḗḗȧȧşḗḗ ṽīīşīīŧ ŧħḗḗ ẇḗḗƀşīīŧḗḗ ŧǿǿ <strong><a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ ȧȧ ƞḗḗẇ ṽḗḗřşīīǿǿƞ</a></strong> ǿǿř ŧǿǿ <strong><a class=\"InfoURL\" href=\"#\">ɠḗḗŧ ħḗḗŀƥ ȧȧƞḓ īīƞƒǿǿřḿȧȧŧīīǿǿƞ</a></strong>. Ƥşīīƥħǿǿƞ īīş ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƒǿǿř Ȧȧƞḓřǿǿīīḓ ȧȧƞḓ Ẇīīƞḓǿǿẇş.]",
-      "about#wordart-tag": "[Ɓḗḗẏǿǿƞḓ Ɓǿǿřḓḗḗřş]",
-      "appbackend#disallowed-traffic-notification-body": "[Ȧȧƈŧīīṽȧȧŧḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ ŧǿǿ ŭŭƞŀǿǿƈķ ŧħḗḗ ƒŭŭŀŀ ƥǿǿŧḗḗƞŧīīȧȧŀ ǿǿƒ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ.]",
-      "appbackend#disallowed-traffic-notification-title": "[Ȧȧƥƥş ƞǿǿŧ ẇǿǿřķīīƞɠ?]",
-      "appbackend#minimized-to-systray-body": "[Ƈŀīīƈķ ŧħḗḗ īīƈǿǿƞ ŧǿǿ řḗḗşŧǿǿřḗḗ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ]",
-      "appbackend#minimized-to-systray-title": "[Ƥşīīƥħǿǿƞ ħȧȧş ƀḗḗḗḗƞ ḿīīƞīīḿīīẑḗḗḓ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ]",
-      "appbackend#os-unsupported": "[Ƥşīīƥħǿǿƞ ƞǿǿ ŀǿǿƞɠḗḗř şŭŭƥƥǿǿřŧş Ẇīīƞḓǿǿẇş ẊƤ ǿǿř Ṽīīşŧȧȧ.\nƤŀḗḗȧȧşḗḗ ṽīīşīīŧ ǿǿŭŭř ẇḗḗƀşīīŧḗḗ ƒǿǿř ḿǿǿřḗḗ īīƞƒǿǿřḿȧȧŧīīǿǿƞ.]",
-      "appbackend#state-connected-body": "[Ḗḗẋƥŀǿǿřḗḗ ƀḗḗẏǿǿƞḓ ẏǿǿŭŭř ƀǿǿřḓḗḗřş!]",
-      "appbackend#state-connected-reminder-body": "[Ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ ƒřḗḗḗḗ. Ƈŀīīƈķ ħḗḗřḗḗ ŧǿǿ ṽīīşīīŧ ǿǿŭŭř şƥǿǿƞşǿǿř ƥȧȧɠḗḗş!]",
-      "appbackend#state-connected-reminder-body-2": "[Ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ ƒřḗḗḗḗ ƀẏ ṽīīşīīŧīīƞɠ ǿǿŭŭř şƥǿǿƞşǿǿř ƥȧȧɠḗḗş!]",
-      "appbackend#state-connected-reminder-title": "[Ƥşīīƥħǿǿƞ īīş ķḗḗḗḗƥīīƞɠ ẏǿǿŭŭ ƈǿǿƞƞḗḗƈŧḗḗḓ]",
-      "appbackend#state-connected-title": "[Ƥşīīƥħǿǿƞ īīş ƈǿǿƞƞḗḗƈŧḗḗḓ]",
-      "appbackend#state-starting-body": "[Ƥŀḗḗȧȧşḗḗ ẇȧȧīīŧ…]",
-      "appbackend#state-starting-title": "[Ƥşīīƥħǿǿƞ īīş ƈǿǿƞƞḗḗƈŧīīƞɠ]",
-      "appbackend#state-stopped-title": "[Ƥşīīƥħǿǿƞ īīş ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ]",
-      "banner#long-connecting": "[<strong>Ǿǿħ ƞǿǿ!</strong> Ẏǿǿŭŭ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ħȧȧṽīīƞɠ ŧřǿǿŭŭƀŀḗḗ ƈǿǿƞƞḗḗƈŧīīƞɠ!<br>\nḒǿǿẇƞŀǿǿȧȧḓ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ ǿǿƒ Ƥşīīƥħǿǿƞ ƒřǿǿḿ ŧħḗḗ <a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ şīīŧḗḗ</a>\nǿǿř ƀẏ şḗḗƞḓīīƞɠ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ <a class=\"NewVersionEmail\" href=\"#\"></a>]",
-      "banner#sponsored-by": "[Şƥǿǿƞşǿǿřḗḗḓ ƀẏ]",
-      "connection#connect-btn": "[Ƈǿǿƞƞḗḗƈŧ]",
-      "connection#connected-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ƈǿǿƞƞḗḗƈŧḗḗḓ</span>]",
-      "connection#disconnect-btn": "[Ḓīīşƈǿǿƞƞḗḗƈŧ]",
-      "connection#egress-region-combo-label": "[Şḗḗŀḗḗƈŧ şḗḗřṽḗḗř řḗḗɠīīǿǿƞ]",
-      "connection#starting-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ƈǿǿƞƞḗḗƈŧīīƞɠ</span>…]",
-      "connection#stop-btn": "[Şŧǿǿƥ]",
-      "connection#stopped-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ</span>]",
-      "connection#stopping-msg": "[Ƥşīīƥħǿǿƞ īīş <span class=\"state-word\">ḓīīşƈǿǿƞƞḗḗƈŧīīƞɠ</span>…]",
-      "connection#wait-btn": "[Ƥŀḗḗȧȧşḗḗ ẇȧȧīīŧ…]",
-      "feedback#diagnostic_check": "[Ŭŭƥŀǿǿȧȧḓ ḓīīȧȧɠƞǿǿşŧīīƈ ḓȧȧŧȧȧ. Ƥŀḗḗȧȧşḗḗ ƞǿǿŧḗḗ ŧħȧȧŧ ŧħīīş ḓīīȧȧɠƞǿǿşŧīīƈ ḓȧȧŧȧȧ ḓǿǿḗḗş ƞǿǿŧ īīḓḗḗƞŧīīƒẏ ẏǿǿŭŭ, ȧȧƞḓ īīŧ ẇīīŀŀ ħḗḗŀƥ ŭŭş ŧǿǿ ķḗḗḗḗƥ Ƥşīīƥħǿǿƞ řŭŭƞƞīīƞɠ şḿǿǿǿǿŧħŀẏ. <a class=\"DataCollectionInfoURL\" href=\"#\">Ƈŀīīƈķ ħḗḗřḗḗ ŧǿǿ şḗḗḗḗ ẇħȧȧŧ ḓȧȧŧȧȧ ẇḗḗ ƈǿǿŀŀḗḗƈŧ.</a>]",
-      "feedback#smiley_happy": "[Ƥşīīƥħǿǿƞ ƈǿǿƞƞḗḗƈŧş ȧȧƞḓ ƥḗḗřƒǿǿřḿş ŧħḗḗ ẇȧȧẏ Īī ẇȧȧƞŧ īīŧ ŧǿǿ.]",
-      "feedback#smiley_sad": "[Ƥşīīƥħǿǿƞ ǿǿƒŧḗḗƞ ƒȧȧīīŀş ŧǿǿ ƈǿǿƞƞḗḗƈŧ ǿǿř ḓǿǿḗḗşƞ'ŧ ƥḗḗřƒǿǿřḿ ẇḗḗŀŀ ḗḗƞǿǿŭŭɠħ.]",
-      "feedback#submit_button": "[Şŭŭƀḿīīŧ]",
-      "feedback#success-message": "[<strong>Ŧħȧȧƞķ ẏǿǿŭŭ!</strong> Ẏǿǿŭŭř ƒḗḗḗḗḓƀȧȧƈķ ħȧȧş ƀḗḗḗḗƞ şḗḗƞŧ.]",
-      "feedback#text_feedback_bottom_para": "[Īīƒ ŧħḗḗ ȧȧƀǿǿṽḗḗ ƒǿǿřḿ īīş ƞǿǿŧ ẇǿǿřķīīƞɠ, ǿǿř ẏǿǿŭŭ ẇǿǿŭŭŀḓ ŀīīķḗḗ ŧǿǿ şḗḗƞḓ şƈřḗḗḗḗƞşħǿǿŧş, ƥŀḗḗȧȧşḗḗ ḗḗḿȧȧīīŀ ŭŭş ȧȧŧ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">ƒḗḗḗḗḓƀȧȧƈķ@ƥşīīƥħǿǿƞ.ƈȧȧ</a>.]",
-      "feedback#text_feedback_email_prompt": "[Īīƒ ẏǿǿŭŭ ẇǿǿŭŭŀḓ ŀīīķḗḗ ŭŭş ŧǿǿ řḗḗşƥǿǿƞḓ ŧǿǿ ẏǿǿŭŭ, ƥŀḗḗȧȧşḗḗ ḗḗƞŧḗḗř ẏǿǿŭŭř ḗḗḿȧȧīīŀ ȧȧḓḓřḗḗşş:]",
-      "feedback#text_feedback_prompt": "[Ƥŀḗḗȧȧşḗḗ ḗḗƞŧḗḗř ẏǿǿŭŭř ƈǿǿḿḿḗḗƞŧş ħḗḗřḗḗ:]",
-      "feedback#top_content_title": "[Ɠīīṽḗḗ Ŭŭş Ẏǿǿŭŭř Ƒḗḗḗḗḓƀȧȧƈķ]",
-      "feedback#top_para_2": "[Ḿȧȧƞẏ ƥřǿǿƀŀḗḗḿş ƈȧȧƞ ƀḗḗ ƒīīẋḗḗḓ ƀẏ ḓǿǿẇƞŀǿǿȧȧḓīīƞɠ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ. Ẏǿǿŭŭ ƈȧȧƞ <a class=\"NewVersionURL\" href=\"#\">ḓǿǿẇƞŀǿǿȧȧḓ ŧħḗḗ ŀȧȧŧḗḗşŧ ṽḗḗřşīīǿǿƞ ƀẏ ƈŀīīƈķīīƞɠ ħḗḗřḗḗ</a>, ǿǿř ẏǿǿŭŭ ƈȧȧƞ şḗḗƞḓ ȧȧƞ ḗḗḿȧȧīīŀ ŧǿǿ <a class=\"NewVersionEmail\" href=\"#\"></a>.]",
-      "feedback#top_para_3": "[Ẏǿǿŭŭ ƈȧȧƞ ȧȧŀşǿǿ ƒīīƞḓ şǿǿŀŭŭŧīīǿǿƞş ŧǿǿ ḿȧȧƞẏ ƈǿǿḿḿǿǿƞ ƥřǿǿƀŀḗḗḿş īīƞ ǿǿŭŭř <a class=\"FaqURL\" href=\"#\">Ƒřḗḗɋŭŭḗḗƞŧŀẏ Ȧȧşķḗḗḓ Ɋŭŭḗḗşŧīīǿǿƞş</a>.]",
-      "general#modal-close-button": "[Ƈŀǿǿşḗḗ]",
-      "general#notice-modal-tech-preamble": "[Ħḗḗřḗḗ īīş ŧħḗḗ ŧḗḗƈħƞīīƈȧȧŀ ḗḗřřǿǿř īīƞƒǿǿ:]",
-      "language#success-message": "[<strong>Ħḗḗŀŀǿǿ!</strong> Ẇḗḗŀƈǿǿḿḗḗ ŧǿǿ Ƥşīīƥħǿǿƞ.]",
-      "logs#placeholder": "[Ƞǿǿ ŀǿǿɠş ẏḗḗŧ]",
-      "logs#show-debug-label": "[Şħǿǿẇ ḓḗḗƀŭŭɠ ŀǿǿɠş]",
-      "nav#about": "[Ȧȧƀǿǿŭŭŧ]",
-      "nav#connection#connected": "[Ƈǿǿƞƞḗḗƈŧḗḗḓ]",
-      "nav#connection#starting": "[Ƈǿǿƞƞḗḗƈŧīīƞɠ]",
-      "nav#connection#stopped": "[Ḓīīşƈǿǿƞƞḗḗƈŧḗḗḓ]",
-      "nav#connection#stopping": "[Ḓīīşƈǿǿƞƞḗḗƈŧīīƞɠ]",
-      "nav#feedback": "[Ƒḗḗḗḗḓƀȧȧƈķ]",
-      "nav#logs": "[Ŀǿǿɠş]",
-      "nav#settings": "[Şḗḗŧŧīīƞɠş]",
-      "notice#disallowed-traffic-alert-body": "[<p>Ȧȧƥƥş ƞǿǿŧ ẇǿǿřķīīƞɠ?</p>\n<p>Şǿǿḿḗḗ īīƞŧḗḗřƞḗḗŧ ŧřȧȧƒƒīīƈ īīş ƞǿǿŧ şŭŭƥƥǿǿřŧḗḗḓ ẇīīŧħǿǿŭŭŧ ȧȧƞ ȧȧƈŧīīṽḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ. Ȧȧƈŧīīṽȧȧŧḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ ẇīīŧħ ƤşīīƇȧȧşħ ŧǿǿ ŭŭƞŀǿǿƈķ ŧħḗḗ ƒŭŭŀŀ ƥǿǿŧḗḗƞŧīīȧȧŀ ǿǿƒ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ.</p>]",
-      "notice#disallowed-traffic-alert-title": "[Ŭŭƥɠřȧȧḓḗḗ ẏǿǿŭŭř Ƥşīīƥħǿǿƞ ƈǿǿƞƞḗḗƈŧīīǿǿƞ]",
-      "notice#systemproxysettings-setproxy-error-body": "[<p>Ƥşīīƥħǿǿƞ ƒȧȧīīŀḗḗḓ ŧǿǿ şḗḗŧ ŧħḗḗ şẏşŧḗḗḿ’ş ƥřǿǿẋẏ şḗḗŧŧīīƞɠş.</p>\n<p>Ŧħīīş ḿīīɠħŧ ƀḗḗ ḓŭŭḗḗ ŧǿǿ ȧȧ ƈǿǿƞƒŀīīƈŧ ẇīīŧħ ẏǿǿŭŭř ȧȧƞŧīīṽīīřŭŭş şǿǿƒŧẇȧȧřḗḗ. Ẏǿǿŭŭ ḿīīɠħŧ ƞḗḗḗḗḓ ŧǿǿ ḿȧȧƞŭŭȧȧŀŀẏ ƈǿǿƞƒīīɠŭŭřḗḗ ẏǿǿŭŭř ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ǿǿř şẏşŧḗḗḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ŧǿǿ ŭŭşḗḗ ŧħḗḗ ŀǿǿƈȧȧŀ Ƥşīīƥħǿǿƞ ƥřǿǿẋīīḗḗş.</p>]",
-      "notice#systemproxysettings-setproxy-error-title": "[Şẏşŧḗḗḿ Ƥřǿǿẋẏ Ḗḗřřǿǿř]",
-      "notice#systemproxysettings-setproxy-warning-template": "[Ƥşīīƥħǿǿƞ ƒȧȧīīŀḗḗḓ ŧǿǿ şḗḗŧ ŧħḗḗ şẏşŧḗḗḿ’ş ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ƒǿǿř ŧħḗḗ Īīƞŧḗḗřƞḗḗŧ ƈǿǿƞƞḗḗƈŧīīǿǿƞ ƞȧȧḿḗḗḓ “<%- data %>”. Ŧħīīş ḿīīɠħŧ ƀḗḗ ḓŭŭḗḗ ŧǿǿ ȧȧ ƈǿǿƞƒŀīīƈŧ ẇīīŧħ ẏǿǿŭŭř ȧȧƞŧīīṽīīřŭŭş şǿǿƒŧẇȧȧřḗḗ. Ẏǿǿŭŭ ḿīīɠħŧ ƞḗḗḗḗḓ ŧǿǿ ḿȧȧƞŭŭȧȧŀŀẏ ƈǿǿƞƒīīɠŭŭřḗḗ ẏǿǿŭŭř ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ǿǿř şẏşŧḗḗḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş ŧǿǿ ŭŭşḗḗ ŧħḗḗ ŀǿǿƈȧȧŀ Ƥşīīƥħǿǿƞ ƥřǿǿẋīīḗḗş.]",
-      "positive-value-indicator": "[+%d]",
-      "psicash#1-day": "[1 ḓȧȧẏ]",
-      "psicash#1-hour": "[1 ħǿǿŭŭř]",
-      "psicash#init-error-body-recovered": "[ƤşīīƇȧȧşħ ƒȧȧīīŀḗḗḓ ŧǿǿ īīƞīīŧīīȧȧŀīīẑḗḗ. Ŧħīīş īīş ƥřǿǿƀȧȧƀŀẏ ḓŭŭḗḗ ŧǿǿ ȧȧ ƒīīŀḗḗ şẏşŧḗḗḿ ƥřǿǿƀŀḗḗḿ, şŭŭƈħ ȧȧş ƀḗḗīīƞɠ ǿǿŭŭŧ ǿǿƒ ḓīīşķ şƥȧȧƈḗḗ. Ẏǿǿŭŭř ƀȧȧŀȧȧƞƈḗḗ ȧȧƞḓ ǿǿŧħḗḗř şŧȧȧŧḗḗ ħȧȧṽḗḗ ƀḗḗḗḗƞ řḗḗşḗḗŧ.]",
-      "psicash#init-error-body-unrecovered": "[ƤşīīƇȧȧşħ ƒȧȧīīŀḗḗḓ ŧǿǿ īīƞīīŧīīȧȧŀīīẑḗḗ. Ŧħīīş īīş ƥřǿǿƀȧȧƀŀẏ ḓŭŭḗḗ ŧǿǿ ȧȧ ƒīīŀḗḗ şẏşŧḗḗḿ ƥřǿǿƀŀḗḗḿ, şŭŭƈħ ȧȧş ƀḗḗīīƞɠ ǿǿŭŭŧ ǿǿƒ ḓīīşķ şƥȧȧƈḗḗ. Ẏǿǿŭŭř ƀȧȧŀȧȧƞƈḗḗ ȧȧƞḓ ǿǿŧħḗḗř şŧȧȧŧḗḗ ħȧȧṽḗḗ ƀḗḗḗḗƞ ŀǿǿşŧ. ƤşīīƇȧȧşħ ẇīīŀŀ ƞǿǿŧ ƀḗḗ ŭŭşȧȧƀŀḗḗ. Ẏǿǿŭŭ ƈȧȧƞ ŧřẏ řḗḗşŧȧȧřŧīīƞɠ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ŧǿǿ řḗḗƈǿǿṽḗḗř ƒřǿǿḿ ŧħḗḗ ƥřǿǿƀŀḗḗḿ.]",
-      "psicash#init-error-title": "[ƤşīīƇȧȧşħ īīƞīīŧīīȧȧŀīīẑȧȧŧīīǿǿƞ ḗḗřřǿǿř]",
-      "psicash#mustconnect-modal#body": "[Īīƞ ǿǿřḓḗḗř ŧǿǿ ŭŭşḗḗ ƤşīīƇȧȧşħ, ẏǿǿŭŭ ḿŭŭşŧ ƀḗḗ ƈǿǿƞƞḗḗƈŧḗḗḓ ŧǿǿ ŧħḗḗ Ƥşīīƥħǿǿƞ ƞḗḗŧẇǿǿřķ.]",
-      "psicash#mustconnect-modal#title": "[Ƥşīīƥħǿǿƞ Ƈǿǿƞƞḗḗƈŧīīǿǿƞ Řḗḗɋŭŭīīřḗḗḓ]",
-      "psicash#psiphon-speed": "[Ƥşīīƥħǿǿƞ<br>Şƥḗḗḗḗḓ]",
-      "psicash#transaction-ExistingTransaction-body": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ȧȧƞ ḗḗẋīīşŧīīƞɠ ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ǿǿƒ ŧħīīş ŧẏƥḗḗ. Ȧȧƞǿǿŧħḗḗř ƥŭŭřƈħȧȧşḗḗ ǿǿƒ ŧħīīş ŧẏƥḗḗ īīş ƞǿǿŧ ȧȧŀŀǿǿẇḗḗḓ ŭŭƞŧīīŀ ŧħḗḗ ƥřḗḗṽīīǿǿŭŭş ǿǿƞḗḗ ḗḗẋƥīīřḗḗş. Ẏǿǿŭŭř ƤşīīƇȧȧşħ şŧȧȧŧḗḗ ẇīīŀŀ ƀḗḗ řḗḗƒřḗḗşħḗḗḓ ƞǿǿẇ.]",
-      "psicash#transaction-ExistingTransaction-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ȧȧŀřḗḗȧȧḓẏ ḗḗẋīīşŧş]",
-      "psicash#transaction-InsufficientBalance-body": "[Ẏǿǿŭŭ ḓǿǿ ƞǿǿŧ ħȧȧṽḗḗ şŭŭƒƒīīƈīīḗḗƞŧ ƤşīīƇȧȧşħ ƀȧȧŀȧȧƞƈḗḗ ƒǿǿř ŧħīīş ƥŭŭřƈħȧȧşḗḗ.]",
-      "psicash#transaction-InsufficientBalance-title": "[Īīƞşŭŭƒƒīīƈīīḗḗƞŧ ƤşīīƇȧȧşħ ƀȧȧŀȧȧƞƈḗḗ]",
-      "psicash#transaction-InvalidTokens-body": "[Ẏǿǿŭŭř ƤşīīƇȧȧşħ ŧǿǿķḗḗƞş ȧȧřḗḗ īīƞṽȧȧŀīīḓ. Ŧřẏ řḗḗşŧȧȧřŧīīƞɠ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ. Īīƒ ŧħȧȧŧ ḓǿǿḗḗşƞ'ŧ ẇǿǿřķ, ẏǿǿŭŭ ẇīīŀŀ ƞḗḗḗḗḓ ŧǿǿ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">ƈŀḗḗȧȧř ẏǿǿŭŭř ŀǿǿƈȧȧŀ şŧǿǿřȧȧɠḗḗ</a>.]",
-      "psicash#transaction-InvalidTokens-title": "[Īīƞṽȧȧŀīīḓ ƤşīīƇȧȧşħ ŧǿǿķḗḗƞş]",
-      "psicash#transaction-ServerError-body": "[Ŧħḗḗ ƤşīīƇȧȧşħ şḗḗřṽḗḗř řḗḗşƥǿǿƞḓḗḗḓ ẇīīŧħ ȧȧƞ ḗḗřřǿǿř ẇħīīŀḗḗ ŧřẏīīƞɠ ŧǿǿ ḿȧȧķḗḗ ŧħḗḗ ƥŭŭřƈħȧȧşḗḗ. Ƥŀḗḗȧȧşḗḗ řḗḗŧřẏ ẏǿǿŭŭř ƥŭŭřƈħȧȧşḗḗ ŀȧȧŧḗḗř.]",
-      "psicash#transaction-ServerError-title": "[ƤşīīƇȧȧşħ şḗḗřṽḗḗř ḗḗřřǿǿř]",
-      "psicash#transaction-TransactionAmountMismatch-body": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ƥřīīƈḗḗş ȧȧřḗḗ ǿǿŭŭŧ-ǿǿƒ-ḓȧȧŧḗḗ. Ẏǿǿŭŭř ƤşīīƇȧȧşħ şŧȧȧŧḗḗ ẇīīŀŀ ƀḗḗ řḗḗƒřḗḗşħḗḗḓ ƞǿǿẇ.]",
-      "psicash#transaction-TransactionAmountMismatch-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ƥřīīƈḗḗ ḿīīşḿȧȧŧƈħ]",
-      "psicash#transaction-TransactionTypeNotFound-body": "[Ŧħḗḗ ƥřǿǿḓŭŭƈŧ ẏǿǿŭŭ ȧȧřḗḗ ŧřẏīīƞɠ ŧǿǿ ƀŭŭẏ ƞǿǿ ŀǿǿƞɠḗḗř ḗḗẋīīşŧş. Ẏǿǿŭŭ ḿȧȧẏ ƞḗḗḗḗḓ ŧǿǿ ŭŭƥḓȧȧŧḗḗ ǿǿř řḗḗīīƞşŧȧȧŀŀ ŧħḗḗ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ.]",
-      "psicash#transaction-TransactionTypeNotFound-title": "[ƤşīīƇȧȧşħ ƥŭŭřƈħȧȧşḗḗ ŧẏƥḗḗ ƞǿǿŧ ƒǿǿŭŭƞḓ]",
-      "psicash#transaction-error-body": "[Ẏǿǿŭŭř ƤşīīƇȧȧşħ ŧřȧȧƞşȧȧƈŧīīǿǿƞ ȧȧŧŧḗḗḿƥŧ ƒȧȧīīŀḗḗḓ ŭŭƞḗḗẋƥḗḗƈŧḗḗḓŀẏ.]",
-      "psicash#transaction-error-title": "[ƤşīīƇȧȧşħ ŧřȧȧƞşȧȧƈŧīīǿǿƞ ḗḗřřǿǿř]",
-      "psicash#ui-buyingboost-buttontext": "[Şŧȧȧřŧīīƞɠ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ!]",
-      "psicash#ui-buymorepsi": "[Ɓŭŭẏ ḿǿǿřḗḗ ƤşīīƇȧȧşħ]",
-      "psicash#ui-buypsi": "[Ɓŭŭẏ ƤşīīƇȧȧşħ]",
-      "psicash#ui-enoughbalance-buttontext": "[Şŧȧȧřŧ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ]",
-      "psicash#ui-nsfbalance-buttontext": "[Ƞḗḗḗḗḓḗḗḓ ƒǿǿř Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ]",
-      "psicash#ui-speedboost-active": "[Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ ȧȧƈŧīīṽḗḗ ƒǿǿř %s]",
-      "psicash#ui-zerobalance-title": "[Ƞḗḗḗḗḓ ȧȧ Şƥḗḗḗḗḓ&nbsp;Ɓǿǿǿǿşŧ?]",
-      "settings#apply-button": "[Ȧȧƥƥŀẏ Ƈħȧȧƞɠḗḗş]",
-      "settings#applying-message": "[Řḗḗƈǿǿƞƞḗḗƈŧīīƞɠ ŧǿǿ ȧȧƥƥŀẏ ẏǿǿŭŭř şḗḗŧŧīīƞɠş.]",
-      "settings#disable-timeouts#enable-label": "[Ḓīīşȧȧƀŀḗḗ ŧīīḿḗḗǿǿŭŭŧş ƒǿǿř şŀǿǿẇ ƞḗḗŧẇǿǿřķş]",
-      "settings#disable-timeouts#heading": "[Ḓīīşȧȧƀŀḗḗ Ŧīīḿḗḗǿǿŭŭŧş ƒǿǿř Şŀǿǿẇ Ƞḗḗŧẇǿǿřķş]",
-      "settings#disable-timeouts#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, ƈǿǿḿḿŭŭƞīīƈȧȧŧīīǿǿƞ ẇīīŧħ ŧħḗḗ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ẇīīŀŀ ƞǿǿŧ ŧīīḿḗḗ ǿǿŭŭŧ.]",
-      "settings#disable-timeouts#reason": "[Ẇħḗḗƞ ḗḗƞȧȧƀŀīīƞɠ ŧħīīş ƒǿǿř ȧȧ ṽḗḗřẏ şŀǿǿẇ ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ, ẏǿǿŭŭ ȧȧřḗḗ ŀḗḗşş ŀīīķḗḗŀẏ ŧǿǿ ḗḗẋƥḗḗřīīḗḗƞƈḗḗ ŭŭƞḗḗẋƥḗḗƈŧḗḗḓ ḓīīşƈǿǿƞƞḗḗƈŧīīǿǿƞş.]",
-      "settings#disallowed-traffic-alert#disable-label": "[Ḓīīşȧȧƀŀḗḗ ḓīīşȧȧŀŀǿǿẇḗḗḓ ŧřȧȧƒƒīīƈ ȧȧŀḗḗřŧş]",
-      "settings#disallowed-traffic-alert#heading": "[Ḓīīşȧȧŀŀǿǿẇḗḗḓ Ŧřȧȧƒƒīīƈ Ȧȧŀḗḗřŧ]",
-      "settings#disallowed-traffic-alert#help-text": "[Şǿǿḿḗḗ ŧẏƥḗḗş ǿǿƒ īīƞŧḗḗřƞḗḗŧ ŧřȧȧƒƒīīƈ ȧȧřḗḗ ƞǿǿŧ şŭŭƥƥǿǿřŧḗḗḓ ẇīīŧħǿǿŭŭŧ ȧȧƞ ȧȧƈŧīīṽḗḗ Şƥḗḗḗḗḓ Ɓǿǿǿǿşŧ. Ẇħḗḗƞ şŭŭƈħ ŧřȧȧƒƒīīƈ īīş ḓīīşȧȧŀŀǿǿẇḗḗḓ, ȧȧƞ ȧȧŀḗḗřŧ īīş şħǿǿẇƞ. (Řḗḗ-ḗḗƞȧȧƀŀīīƞɠ ẇīīŀŀ řḗḗɋŭŭīīřḗḗ ȧȧ řḗḗƈǿǿƞƞḗḗƈŧīīǿǿƞ.)]",
-      "settings#egress-region#default": "[Ƈħǿǿǿǿşīīƞɠ ŧħḗḗ ḓḗḗƒȧȧŭŭŀŧ <strong>“Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ”</strong> ǿǿƥŧīīǿǿƞ ȧȧŀŀǿǿẇş Ƥşīīƥħǿǿƞ ŧǿǿ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƈħǿǿǿǿşḗḗ ȧȧ şḗḗřṽḗḗř, ẇħīīƈħ ẇīīŀŀ ɠḗḗƞḗḗřȧȧŀŀẏ řḗḗşŭŭŀŧ īīƞ ŧħḗḗ ƀḗḗşŧ ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ.]",
-      "settings#egress-region#description": "[Ƥşīīƥħǿǿƞ ħȧȧş şḗḗřṽḗḗřş īīƞ ḿȧȧƞẏ ḓīīƒƒḗḗřḗḗƞŧ ƈǿǿŭŭƞŧřīīḗḗş ȧȧƞḓ řḗḗɠīīǿǿƞş. Ŭŭşīīƞɠ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř īīƞ ȧȧ řḗḗɠīīǿǿƞ ƈŀǿǿşḗḗ ŧǿǿ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ẇīīŀŀ ɠḗḗƞḗḗřȧȧŀŀẏ ƥřǿǿṽīīḓḗḗ ȧȧ ƀḗḗŧŧḗḗř ƞḗḗŧẇǿǿřķ ƈǿǿƞƞḗḗƈŧīīǿǿƞ, ƀŭŭŧ ẏǿǿŭŭ ḿȧȧẏ ẇīīşħ ŧǿǿ ȧȧƈƈḗḗşş ẇḗḗƀşīīŧḗḗş ȧȧƞḓ şḗḗřṽīīƈḗḗş ŀīīķḗḗ ẏǿǿŭŭ ȧȧřḗḗ ṽīīřŧŭŭȧȧŀŀẏ īīƞ ȧȧ şƥḗḗƈīīƒīīƈ ƈǿǿŭŭƞŧřẏ ǿǿř řḗḗɠīīǿǿƞ.]",
-      "settings#egress-region#error-modal-body-http": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şḗḗřṽḗḗř īīƞ ȧȧ şƥḗḗƈīīƒīīƈ řḗḗɠīīǿǿƞ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ řḗḗɠīīǿǿƞ īīş ƞǿǿ ŀǿǿƞɠḗḗř ȧȧṽȧȧīīŀȧȧƀŀḗḗ.<br>\nẎǿǿŭŭ ḿŭŭşŧ ƈħǿǿǿǿşḗḗ ȧȧ ƞḗḗẇ řḗḗɠīīǿǿƞ ǿǿř ƈħȧȧƞɠḗḗ ŧǿǿ ŧħḗḗ ḓḗḗƒȧȧŭŭŀŧ “Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ” ƈħǿǿīīƈḗḗ.]",
-      "settings#egress-region#error-modal-title": "[Şḗḗřṽḗḗř Řḗḗɠīīǿǿƞ Ŭŭƞȧȧṽȧȧīīŀȧȧƀŀḗḗ]",
-      "settings#egress-region#heading": "[Ƥşīīƥħǿǿƞ Şḗḗřṽḗḗř Řḗḗɠīīǿǿƞ]",
-      "settings#egress-region#invalid-error-msg": "[Ƈħǿǿǿǿşḗḗ ȧȧ ṽȧȧŀīīḓ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř řḗḗɠīīǿǿƞ.]",
-      "settings#egress-region#select-at": "[Ȧȧŭŭşŧřīīȧȧ]",
-      "settings#egress-region#select-au": "[Ȧȧŭŭşŧřȧȧŀīīȧȧ]",
-      "settings#egress-region#select-be": "[Ɓḗḗŀɠīīŭŭḿ]",
-      "settings#egress-region#select-best-performance": "[Ɓḗḗşŧ Ƥḗḗřƒǿǿřḿȧȧƞƈḗḗ]",
-      "settings#egress-region#select-bg": "[Ɓŭŭŀɠȧȧřīīȧȧ]",
-      "settings#egress-region#select-ca": "[Ƈȧȧƞȧȧḓȧȧ]",
-      "settings#egress-region#select-ch": "[Şẇīīŧẑḗḗřŀȧȧƞḓ]",
-      "settings#egress-region#select-cz": "[Ƈẑḗḗƈħ Řḗḗƥŭŭƀŀīīƈ]",
-      "settings#egress-region#select-de": "[Ɠḗḗřḿȧȧƞẏ]",
-      "settings#egress-region#select-dk": "[Ḓḗḗƞḿȧȧřķ]",
-      "settings#egress-region#select-es": "[Şƥȧȧīīƞ]",
-      "settings#egress-region#select-fr": "[Ƒřȧȧƞƈḗḗ]",
-      "settings#egress-region#select-gb": "[Ŭŭƞīīŧḗḗḓ Ķīīƞɠḓǿǿḿ]",
-      "settings#egress-region#select-hk": "[Ħǿǿƞɠ Ķǿǿƞɠ]",
-      "settings#egress-region#select-hu": "[Ħŭŭƞɠȧȧřẏ]",
-      "settings#egress-region#select-in": "[Īīƞḓīīȧȧ]",
-      "settings#egress-region#select-it": "[Īīŧȧȧŀẏ]",
-      "settings#egress-region#select-jp": "[Ĵȧȧƥȧȧƞ]",
-      "settings#egress-region#select-nl": "[Ƞḗḗŧħḗḗřŀȧȧƞḓş]",
-      "settings#egress-region#select-no": "[Ƞǿǿřẇȧȧẏ]",
-      "settings#egress-region#select-pl": "[Ƥǿǿŀȧȧƞḓ]",
-      "settings#egress-region#select-ro": "[Řǿǿḿȧȧƞīīȧȧ]",
-      "settings#egress-region#select-rs": "[Şḗḗřƀīīȧȧ]",
-      "settings#egress-region#select-se": "[Şẇḗḗḓḗḗƞ]",
-      "settings#egress-region#select-sg": "[Şīīƞɠȧȧƥǿǿřḗḗ]",
-      "settings#egress-region#select-sk": "[Şŀǿǿṽȧȧķīīȧȧ]",
-      "settings#egress-region#select-us": "[Ŭŭƞīīŧḗḗḓ Şŧȧȧŧḗḗş]",
-      "settings#error-alert": "[<strong>Ḗḗřřǿǿř!</strong> Ƥŀḗḗȧȧşḗḗ ƒīīẋ īīƞƈǿǿřřḗḗƈŧ ṽȧȧŀŭŭḗḗş ƀḗḗƒǿǿřḗḗ ƥřǿǿƈḗḗḗḗḓīīƞɠ.]",
-      "settings#error-modal#body": "[Ŧħḗḗřḗḗ ȧȧřḗḗ ḗḗřřǿǿřş īīƞ ẏǿǿŭŭř şḗḗŧŧīīƞɠş ṽȧȧŀŭŭḗḗş. Ƥŀḗḗȧȧşḗḗ ƈǿǿřřḗḗƈŧ ŧħḗḗḿ ƀḗḗƒǿǿřḗḗ ƥřǿǿƈḗḗḗḗḓīīƞɠ.]",
-      "settings#error-modal#title": "[Şḗḗŧŧīīƞɠş Ḗḗřřǿǿř]",
-      "settings#local-proxy-ports#error-modal-body-http": "[<p>\nẎǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şƥḗḗƈīīƒīīƈ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƒǿǿř īīŧş ĦŦŦƤ ƥřǿǿẋẏ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ ƥǿǿřŧ ȧȧƥƥḗḗȧȧřş ŧǿǿ ƀḗḗ ȧȧŀřḗḗȧȧḓẏ īīƞ ŭŭşḗḗ ȧȧƞḓ şǿǿ Ƥşīīƥħǿǿƞ ƈȧȧƞƞǿǿŧ ŭŭşḗḗ īīŧ.\n</p>\n<p>\nƤŀḗḗȧȧşḗḗ ƈħȧȧƞɠḗḗ ŧħḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ ĦŦŦƤ ƥřǿǿẋẏ ƥǿǿřŧ ṽȧȧŀŭŭḗḗ ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ. Ẇḗḗ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ ŧħȧȧŧ ẏǿǿŭŭ ƈŀḗḗȧȧř ŧħḗḗ ṽȧȧŀŭŭḗḗ şǿǿ ŧħȧȧŧ Ƥşīīƥħǿǿƞ ƈȧȧƞ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƥīīƈķ ȧȧƞ ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƥǿǿřŧ.\n</p>]",
-      "settings#local-proxy-ports#error-modal-body-socks": "[<p>\nẎǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧ şƥḗḗƈīīƒīīƈ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƒǿǿř īīŧş ŞǾǿƇĶŞ ƥřǿǿẋẏ.<br>\nĦǿǿẇḗḗṽḗḗř, ŧħȧȧŧ ƥǿǿřŧ ȧȧƥƥḗḗȧȧřş ŧǿǿ ƀḗḗ ȧȧŀřḗḗȧȧḓẏ īīƞ ŭŭşḗḗ ȧȧƞḓ şǿǿ Ƥşīīƥħǿǿƞ ƈȧȧƞƞǿǿŧ ŭŭşḗḗ īīŧ.\n</p>\n<p>\nƤŀḗḗȧȧşḗḗ ƈħȧȧƞɠḗḗ ŧħḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ ŞǾǿƇĶŞ ƥřǿǿẋẏ ƥǿǿřŧ ṽȧȧŀŭŭḗḗ ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ. Ẇḗḗ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ ŧħȧȧŧ ẏǿǿŭŭ ƈŀḗḗȧȧř ŧħḗḗ ṽȧȧŀŭŭḗḗ şǿǿ ŧħȧȧŧ Ƥşīīƥħǿǿƞ ƈȧȧƞ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ƥīīƈķ ȧȧƞ ȧȧṽȧȧīīŀȧȧƀŀḗḗ ƥǿǿřŧ.\n</p>]",
-      "settings#local-proxy-ports#error-modal-title": "[Ŀǿǿƈȧȧŀ Ƥřǿǿẋẏ Ƥǿǿřŧ Ƈǿǿƞƒŀīīƈŧ]",
-      "settings#local-proxy-ports#heading": "[Ŀǿǿƈȧȧŀ Ƥřǿǿẋẏ Ƥǿǿřŧş]",
-      "settings#local-proxy-ports#http-label": "[ĦŦŦƤ/ĦŦŦƤŞ]",
-      "settings#local-proxy-ports#leave-blank": "[Ŀḗḗȧȧṽḗḗ <strong>ƀŀȧȧƞķ</strong> ƒǿǿř ȧȧŭŭŧǿǿḿȧȧŧīīƈ ƥǿǿřŧ şḗḗŀḗḗƈŧīīǿǿƞ (řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ).]",
-      "settings#local-proxy-ports#reason": "[Īīƒ ẏǿǿŭŭ ŭŭşḗḗ ŧǿǿǿǿŀş ǿǿƞ ẏǿǿŭŭř ƈǿǿḿƥŭŭŧḗḗř ŧħȧȧŧ řḗḗɋŭŭīīřḗḗ ḿȧȧƞŭŭȧȧŀ ƈǿǿƞƒīīɠŭŭřȧȧŧīīǿǿƞ ŧǿǿ ẇǿǿřķ ẇīīŧħ Ƥşīīƥħǿǿƞ, ẏǿǿŭŭ ẇīīŀŀ ẇȧȧƞŧ Ƥşīīƥħǿǿƞ ŧǿǿ ƈǿǿƞşīīşŧḗḗƞŧŀẏ ŭŭşḗḗ ŧħḗḗ şȧȧḿḗḗ ŀǿǿƈȧȧŀ ƥǿǿřŧ ƞŭŭḿƀḗḗřş. Īīƒ ẏǿǿŭŭ ḓǿǿƞ’ŧ ħȧȧṽḗḗ ȧȧ řḗḗȧȧşǿǿƞ ŧǿǿ şƥḗḗƈīīƒẏ ƥǿǿřŧ ƞŭŭḿƀḗḗřş, ẏǿǿŭŭ şħǿǿŭŭŀḓ ȧȧŀŀǿǿẇ Ƥşīīƥħǿǿƞ ŧǿǿ ƈħǿǿǿǿşḗḗ ŧħḗḗḿ ȧȧŭŭŧǿǿḿȧȧŧīīƈȧȧŀŀẏ ŧǿǿ ħḗḗŀƥ ȧȧṽǿǿīīḓ ƈǿǿƞƒŀīīƈŧş.]",
-      "settings#local-proxy-ports#socks-label": "[ŞǾǿƇĶŞ]",
-      "settings#local-proxy-ports#unique-error-msg": "[Ŀǿǿƈȧȧŀ ƥǿǿřŧş ḿŭŭşŧ ƀḗḗ ḓīīşŧīīƞƈŧ ƒřǿǿḿ ḗḗȧȧƈħ ǿǿŧħḗḗř.]",
-      "settings#port-value-error-msg": "[Ḿŭŭşŧ ƀḗḗ ƀḗḗŧẇḗḗḗḗƞ 1 ȧȧƞḓ 65535.]",
-      "settings#reset-button": "[Řḗḗşḗḗŧ ŧǿǿ Ḓḗḗƒȧȧŭŭŀŧ]",
-      "settings#saved-message": "[Şḗḗŧŧīīƞɠş şȧȧṽḗḗḓ.]",
-      "settings#split-tunnel#enable-label": "[Ḓǿǿƞ'ŧ ƥřǿǿẋẏ ẇḗḗƀşīīŧḗḗş ẇīīŧħīīƞ ẏǿǿŭŭř ƈǿǿŭŭƞŧřẏ]",
-      "settings#split-tunnel#heading": "[Şƥŀīīŧ Ŧŭŭƞƞḗḗŀ]",
-      "settings#split-tunnel#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, řḗḗɋŭŭḗḗşŧş ḿȧȧḓḗḗ ŧǿǿ şḗḗřṽḗḗřş ẇīīŧħīīƞ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ẇīīŀŀ ƞǿǿŧ ƀḗḗ ŧŭŭƞƞḗḗŀḗḗḓ ŧħřǿǿŭŭɠħ Ƥşīīƥħǿǿƞ.]",
-      "settings#split-tunnel#reason": "[Ẇḗḗƀşīīŧḗḗş ẇīīŧħīīƞ ẏǿǿŭŭř ħǿǿḿḗḗ ƈǿǿŭŭƞŧřẏ ȧȧřḗḗ ɠḗḗƞḗḗřȧȧŀŀẏ ƞǿǿŧ ƀŀǿǿƈķḗḗḓ, şǿǿ ḗḗƞȧȧƀŀīīƞɠ ŧħīīş ǿǿƥŧīīǿǿƞ ẇīīŀŀ ɠīīṽḗḗ ẏǿǿŭŭ ƒȧȧşŧḗḗř ȧȧƈƈḗḗşş ŧǿǿ ŧħǿǿşḗḗ şīīŧḗḗş ȧȧƞḓ ƈȧȧƞ şǿǿḿḗḗŧīīḿḗḗş řḗḗḓŭŭƈḗḗ ĪīŞƤ ḓȧȧŧȧȧ ŭŭşȧȧɠḗḗ ƈǿǿşŧş.]",
-      "settings#systray-minimize#enable-label": "[Ḿīīƞīīḿīīẑḗḗ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (şẏşŧḗḗḿ ŧřȧȧẏ)]",
-      "settings#systray-minimize#heading": "[Ḿīīƞīīḿīīẑḗḗ ŧǿǿ Ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ Ȧȧřḗḗȧȧ (Şẏşŧḗḗḿ Ŧřȧȧẏ)]",
-      "settings#systray-minimize#help-text": "[Īīƒ ḗḗƞȧȧƀŀḗḗḓ, ẇħḗḗƞ ḿīīƞīīḿīīẑḗḗḓ ŧħḗḗ Ƥşīīƥħǿǿƞ ȧȧƥƥŀīīƈȧȧŧīīǿǿƞ ẇīīƞḓǿǿẇ ẇīīŀŀ ħīīḓḗḗ īīƞ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (ȧȧŀşǿǿ ķƞǿǿẇƞ ȧȧş ŧħḗḗ “şẏşŧḗḗḿ ŧřȧȧẏ” ǿǿř “şẏşŧřȧȧẏ”, ŀǿǿƈȧȧŧḗḗḓ ƞḗḗȧȧř ŧħḗḗ ƈŀǿǿƈķ ǿǿƞ ẏǿǿŭŭř Ẇīīƞḓǿǿẇş ŧȧȧşķ ƀȧȧř).]",
-      "settings#systray-minimize#reason": "[Ḿīīƞīīḿīīẑīīƞɠ Ƥşīīƥħǿǿƞ ŧǿǿ ŧħḗḗ ƞǿǿŧīīƒīīƈȧȧŧīīǿǿƞ ȧȧřḗḗȧȧ (“şẏşŧḗḗḿ ŧřȧȧẏ”) ƒřḗḗḗḗş ŭŭƥ şƥȧȧƈḗḗ ǿǿƞ ẏǿǿŭŭř ŧȧȧşķ ƀȧȧř. Ŧħīīş īīş ḗḗşƥḗḗƈīīȧȧŀŀẏ ħḗḗŀƥƒŭŭŀ īīƒ ẏǿǿŭŭ ǿǿƒŧḗḗƞ řŭŭƞ Ƥşīīƥħǿǿƞ ƒǿǿř ŀǿǿƞɠ ƥḗḗřīīǿǿḓş ǿǿƒ ŧīīḿḗḗ.]",
-      "settings#transport-mode#check-label": "[Ŭŭşḗḗ Ŀ2ŦƤ/ĪīƤŞḗḗƈ ḿǿǿḓḗḗ]",
-      "settings#transport-mode#heading": "[Ŧřȧȧƞşƥǿǿřŧ Ḿǿǿḓḗḗ]",
-      "settings#transport-mode#help-text": "[Ŭŭşḗḗş Ẇīīƞḓǿǿẇş Ŀ2ŦƤ/ĪīƤŞḗḗƈ ṽīīřŧŭŭȧȧŀ ƞḗḗŧẇǿǿřķīīƞɠ. Ŧħīīş ḿǿǿḓḗḗ ẇīīŀŀ ŧŭŭƞƞḗḗŀ ȧȧŀŀ ǿǿƒ ẏǿǿŭŭř ȧȧƥƥş, ƀŭŭŧ īīŧ ḓǿǿḗḗşƞ’ŧ ƥřǿǿṽīīḓḗḗ ǿǿƀƒŭŭşƈȧȧŧīīǿǿƞ ȧȧƞḓ şǿǿ ḓǿǿḗḗş ƞǿǿŧ ħȧȧṽḗḗ şŧřǿǿƞɠ ƈḗḗƞşǿǿřşħīīƥ ƈīīřƈŭŭḿṽḗḗƞŧīīǿǿƞ ƈȧȧƥȧȧƀīīŀīīŧīīḗḗş. Īīŧ īīş <strong>ƞǿǿŧ řḗḗƈǿǿḿḿḗḗƞḓḗḗḓ</strong> ƒǿǿř ƀẏƥȧȧşşīīƞɠ ḿǿǿşŧ ƒīīřḗḗẇȧȧŀŀş.]",
-      "settings#unapplied-changes-prompt#apply-button": "[Ȧȧƥƥŀẏ]",
-      "settings#unapplied-changes-prompt#body": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ḿȧȧḓḗḗ ƈħȧȧƞɠḗḗş ŧǿǿ ẏǿǿŭŭř şḗḗŧŧīīƞɠş, ƀŭŭŧ ẏǿǿŭŭ ħȧȧṽḗḗ ƞǿǿŧ ȧȧƥƥŀīīḗḗḓ ŧħḗḗ ƈħȧȧƞɠḗḗş.<br><br>Ḓǿǿ ẏǿǿŭŭ ẇīīşħ ŧǿǿ ȧȧƥƥŀẏ ẏǿǿŭŭř ƈħȧȧƞɠḗḗş ƞǿǿẇ ǿǿř ḓīīşƈȧȧřḓ ŧħḗḗḿ?]",
-      "settings#unapplied-changes-prompt#discard-button": "[Ḓīīşƈȧȧřḓ]",
-      "settings#unapplied-changes-prompt#title": "[Şḗḗŧŧīīƞɠş Ƈħȧȧƞɠḗḗḓ]",
-      "settings#upstream-proxy#by-default": "[Īīƒ ẏǿǿŭŭř ƈǿǿḿƥŭŭŧḗḗř ȧȧŀřḗḗȧȧḓẏ ħȧȧş ȧȧ ƥřǿǿẋẏ ƈǿǿƞƒīīɠŭŭřḗḗḓ, ƀẏ ḓḗḗƒȧȧŭŭŀŧ Ƥşīīƥħǿǿƞ ẇīīŀŀ ŭŭşḗḗ ŧħȧȧŧ ƥřǿǿẋẏ ẇħḗḗƞ ḗḗşŧȧȧƀŀīīşħīīƞɠ ȧȧ ŧŭŭƞƞḗḗŀ. Ẏǿǿŭŭ ƈȧȧƞ ǿǿṽḗḗřřīīḓḗḗ ŧħȧȧŧ ƀḗḗħȧȧṽīīǿǿř ƀẏ şƥḗḗƈīīƒẏīīƞɠ ȧȧ ƥřǿǿẋẏ ŧǿǿ ŭŭşḗḗ, ǿǿř ƀẏ şƥḗḗƈīīƒẏīīƞɠ ŧħȧȧŧ ƞǿǿ şŭŭƈħ “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ” şħǿǿŭŭŀḓ ƀḗḗ ŭŭşḗḗḓ.]",
-      "settings#upstream-proxy#domain-label": "[Ḓǿǿḿȧȧīīƞ]",
-      "settings#upstream-proxy#error-modal-body-configured": "[Ẏǿǿŭŭ ħȧȧṽḗḗ ƈǿǿƞƒīīɠŭŭřḗḗḓ Ƥşīīƥħǿǿƞ ŧǿǿ ŭŭşḗḗ ȧȧƞ “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ”.<br>\nĦǿǿẇḗḗṽḗḗř, ẇḗḗ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ŭŭƞȧȧƀŀḗḗ ŧǿǿ ƈǿǿƞƞḗḗƈŧ ŧǿǿ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ŧħřǿǿŭŭɠħ ŧħȧȧŧ ƥřǿǿẋẏ.<br>\nƤŀḗḗȧȧşḗḗ ƒīīẋ ŧħḗḗ şḗḗŧŧīīƞɠş ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ.]",
-      "settings#upstream-proxy#error-modal-body-default": "[Ƥşīīƥħǿǿƞ īīş ƈŭŭřřḗḗƞŧŀẏ ƈǿǿƞƒīīɠŭŭřḗḗḓ ŧǿǿ ŭŭşḗḗ ẏǿǿŭŭř şẏşŧḗḗḿ ƥřǿǿẋẏ ȧȧş īīŧş “ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ”.<br>\nĦǿǿẇḗḗṽḗḗř, ẇḗḗ şḗḗḗḗḿ ŧǿǿ ƀḗḗ ŭŭƞȧȧƀŀḗḗ ŧǿǿ ƈǿǿƞƞḗḗƈŧ ŧǿǿ ȧȧ Ƥşīīƥħǿǿƞ şḗḗřṽḗḗř ŧħřǿǿŭŭɠħ ŧħȧȧŧ ƥřǿǿẋẏ.<br>\nƤŀḗḗȧȧşḗḗ ḗḗƞȧȧƀŀḗḗ “Ḓǿǿƞ'ŧ ŭŭşḗḗ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ” ȧȧƞḓ ŧřẏ ȧȧɠȧȧīīƞ.]",
-      "settings#upstream-proxy#error-modal-title": "[Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ Ḗḗřřǿǿř]",
-      "settings#upstream-proxy#heading": "[Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ]",
-      "settings#upstream-proxy#hostname-label": "[Ħǿǿşŧƞȧȧḿḗḗ]",
-      "settings#upstream-proxy#password-label": "[Ƥȧȧşşẇǿǿřḓ]",
-      "settings#upstream-proxy#port-label": "[Ƥǿǿřŧ]",
-      "settings#upstream-proxy#proxy-reqs": "[Ǿǿƞŀẏ ĦŦŦƤ ƥřǿǿẋīīḗḗş ŧħȧȧŧ şŭŭƥƥǿǿřŧ ĦŦŦƤŞ ȧȧřḗḗ ȧȧŀŀǿǿẇḗḗḓ.]",
-      "settings#upstream-proxy#reason": "[Ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋīīḗḗş ȧȧřḗḗ şǿǿḿḗḗŧīīḿḗḗş řḗḗɋŭŭīīřḗḗḓ ƀẏ şƈħǿǿǿǿŀş, ŭŭƞīīṽḗḗřşīīŧīīḗḗş, ǿǿř ƀŭŭşīīƞḗḗşşḗḗş. Īīƒ ẏǿǿŭŭř ƞḗḗŧẇǿǿřķ ƥřǿǿṽīīḓḗḗř ħȧȧş ɠīīṽḗḗƞ ẏǿǿŭŭ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ şḗḗŧŧīīƞɠş, ŧħḗḗƞ ḿȧȧƞŭŭȧȧŀŀẏ şḗḗŧŧīīƞɠ ŧħḗḗḿ ħḗḗřḗḗ ḿȧȧẏ ƀḗḗ řḗḗɋŭŭīīřḗḗḓ ŧǿǿ ƈǿǿƞƞḗḗƈŧ.]",
-      "settings#upstream-proxy#set-hostname-error-msg": "[Ẏǿǿŭŭ ḿŭŭşŧ ƥřǿǿṽīīḓḗḗ ȧȧ Ħǿǿşŧƞȧȧḿḗḗ, ǿǿř ŀḗḗȧȧṽḗḗ ȧȧŀŀ Ŭŭƥşŧřḗḗȧȧḿ Ƥřǿǿẋẏ ƒīīḗḗŀḓş ƀŀȧȧƞķ ƒǿǿř ȧȧŭŭŧǿǿḿȧȧŧīīƈ şḗḗŀḗḗƈŧīīǿǿƞ.]",
-      "settings#upstream-proxy#set-username-error-msg": "[Ẏǿǿŭŭ ḿŭŭşŧ ƥřǿǿṽīīḓḗḗ ȧȧ Ŭŭşḗḗřƞȧȧḿḗḗ īīƒ ẏǿǿŭŭ ȧȧřḗḗ şḗḗŧŧīīƞɠ Ƥȧȧşşẇǿǿřḓ ǿǿř Ḓǿǿḿȧȧīīƞ; ǿǿř ŀḗḗȧȧṽḗḗ ȧȧŀŀ ȧȧŭŭŧħḗḗƞŧīīƈȧȧŧīīǿǿƞ ƒīīḗḗŀḓş ƀŀȧȧƞķ ƒǿǿř ƞǿǿ ȧȧŭŭŧħḗḗƞŧīīƈȧȧŧīīǿǿƞ.]",
-      "settings#upstream-proxy#skip-label": "[Ḓǿǿƞ'ŧ ŭŭşḗḗ ŭŭƥşŧřḗḗȧȧḿ ƥřǿǿẋẏ]",
-      "settings#upstream-proxy#username-label": "[Ŭŭşḗḗřƞȧȧḿḗḗ]",
-      "settings#vpn-incompatible-label": "[Ŀ2ŦƤ/ĪīƤŞḗḗƈ]",
-      "settings#vpn-incompatible-msg": "[(Ḓǿǿḗḗşƞ'ŧ ẇǿǿřķ ẇīīŧħ Ŀ2ŦƤ/ĪīƤŞḗḗƈ ḿǿǿḓḗḗ.)]"
-    }
-  },
-  "devrtl": {
-    "name": "Ԁɐɔʞɐƃǝp‬ ‮Wıɹɹoɹǝp",
-    "translation": {
-      "about#client-version": "‮Ԁsıdɥou‬ ‮ɟoɹ‬ ‮Ｍıupoʍs‬ ‮ɔʅıǝuʇ‬ ‮ʌǝɹsıou‬:",
-      "about#description": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɐ‬ <strong>‮ɔǝusoɹsɥıd‬ ‮ɔıɹɔnɯʌǝuʇıou‬ ‮ʇooʅ‬</strong> — ‮ıʇ‬ ‮ıs‬ ‮pǝsıƃuǝp‬ ‮ʇo‬ ‮ƃıʌǝ‬ ‮ɐɔɔǝss‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮odǝu‬ ‮Iuʇǝɹuǝʇ‬, ‮dɐsʇ‬ ‮ɔǝusoɹs‬ ‮ɐup‬ ‮ɟıɹǝʍɐʅʅs‬. ‮Iʇ‬ ‮ıs‬ <strong>‮odǝu‬ ‮sonɹɔǝ‬</strong> ‮ɐup‬ ‮pǝʌǝʅodǝp‬ ‮ıu‬ ‮⊥oɹouʇo‬, ‮Ↄɐuɐpɐ‬.",
-      "about#get-by-email": "<strong>‮Iɟ‬ ‮ʇɥǝ‬ ‮ʍǝqsıʇǝ‬ ‮ıs‬ ‮ıuɐɔɔǝssıqʅǝ‬</strong>, ‮ʎon‬ ‮ɔɐu‬ ‮ƃǝʇ‬ ‮ɐ‬ ‮uǝʍ‬ ‮ʌǝɹsıou‬ ‮oɟ‬ ‮Ԁsıdɥou‬ ‮qʎ‬ ‮sǝupıuƃ‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬:",
-      "about#visit-download-site": "‮Ԁʅǝɐsǝ‬ ‮ʌısıʇ‬ ‮ʇɥǝ‬ ‮ʍǝqsıʇǝ‬ ‮ʇo‬ <strong><a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮ɐ‬ ‮uǝʍ‬ ‮ʌǝɹsıou‬</a></strong> ‮oɹ‬ ‮ʇo‬ <strong><a class=\"InfoURL\" href=\"#\">‮ƃǝʇ‬ ‮ɥǝʅd‬ ‮ɐup‬ ‮ıuɟoɹɯɐʇıou‬</a></strong>. ‮Ԁsıdɥou‬ ‮ıs‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮ɟoɹ‬ ‮∀upɹoıp‬ ‮ɐup‬ ‮Ｍıupoʍs‬.",
-      "about#wordart-tag": "‮Ԑǝʎoup‬ ‮Ԑoɹpǝɹs‬",
-      "appbackend#disallowed-traffic-notification-body": "‮∀ɔʇıʌɐʇǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬ ‮ʇo‬ ‮nuʅoɔʞ‬ ‮ʇɥǝ‬ ‮ɟnʅʅ‬ ‮doʇǝuʇıɐʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ǝxdǝɹıǝuɔǝ‬.",
-      "appbackend#disallowed-traffic-notification-title": "‮∀dds‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬?",
-      "appbackend#minimized-to-systray-body": "‮Ↄʅıɔʞ‬ ‮ʇɥǝ‬ ‮ıɔou‬ ‮ʇo‬ ‮ɹǝsʇoɹǝ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬",
-      "appbackend#minimized-to-systray-title": "‮Ԁsıdɥou‬ ‮ɥɐs‬ ‮qǝǝu‬ ‮ɯıuıɯızǝp‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬",
-      "appbackend#os-unsupported": "‮Ԁsıdɥou‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮snddoɹʇs‬ ‮Ｍıupoʍs‬ ‮XԀ‬ ‮oɹ‬ ‮Ʌısʇɐ‬.\n‮Ԁʅǝɐsǝ‬ ‮ʌısıʇ‬ ‮onɹ‬ ‮ʍǝqsıʇǝ‬ ‮ɟoɹ‬ ‮ɯoɹǝ‬ ‮ıuɟoɹɯɐʇıou‬.",
-      "appbackend#state-connected-body": "‮Ǝxdʅoɹǝ‬ ‮qǝʎoup‬ ‮ʎonɹ‬ ‮qoɹpǝɹs‬!",
-      "appbackend#state-connected-reminder-body": "‮Ӽǝǝd‬ ‮Ԁsıdɥou‬ ‮ɟɹǝǝ‬. ‮Ↄʅıɔʞ‬ ‮ɥǝɹǝ‬ ‮ʇo‬ ‮ʌısıʇ‬ ‮onɹ‬ ‮sdousoɹ‬ ‮dɐƃǝs‬!",
-      "appbackend#state-connected-reminder-body-2": "‮Ӽǝǝd‬ ‮Ԁsıdɥou‬ ‮ɟɹǝǝ‬ ‮qʎ‬ ‮ʌısıʇıuƃ‬ ‮onɹ‬ ‮sdousoɹ‬ ‮dɐƃǝs‬!",
-      "appbackend#state-connected-reminder-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ʞǝǝdıuƃ‬ ‮ʎon‬ ‮ɔouuǝɔʇǝp‬",
-      "appbackend#state-connected-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔouuǝɔʇǝp‬",
-      "appbackend#state-starting-body": "‮Ԁʅǝɐsǝ‬ ‮ʍɐıʇ‬…",
-      "appbackend#state-starting-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔouuǝɔʇıuƃ‬",
-      "appbackend#state-stopped-title": "‮Ԁsıdɥou‬ ‮ıs‬ ‮pısɔouuǝɔʇǝp‬",
-      "banner#long-connecting": "<strong>‮Oɥ‬ ‮uo‬!</strong> ‮ʎon‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮ɥɐʌıuƃ‬ ‮ʇɹonqʅǝ‬ ‮ɔouuǝɔʇıuƃ‬!<br>\n‮poʍuʅoɐp‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬ ‮oɟ‬ ‮Ԁsıdɥou‬ ‮ɟɹoɯ‬ ‮ʇɥǝ‬ <a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮sıʇǝ‬</a>\n‮oɹ‬ ‮qʎ‬ ‮sǝupıuƃ‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬ <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "banner#sponsored-by": "‮Sdousoɹǝp‬ ‮qʎ‬",
-      "connection#connect-btn": "‮Ↄouuǝɔʇ‬",
-      "connection#connected-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮ɔouuǝɔʇǝp‬</span>",
-      "connection#disconnect-btn": "‮pısɔouuǝɔʇ‬",
-      "connection#egress-region-combo-label": "‮Sǝʅǝɔʇ‬ ‮sǝɹʌǝɹ‬ ‮ɹǝƃıou‬",
-      "connection#starting-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮ɔouuǝɔʇıuƃ‬</span>…",
-      "connection#stop-btn": "‮Sʇod‬",
-      "connection#stopped-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮pısɔouuǝɔʇǝp‬</span>",
-      "connection#stopping-msg": "‮Ԁsıdɥou‬ ‮ıs‬ <span class=\"state-word\">‮pısɔouuǝɔʇıuƃ‬</span>…",
-      "connection#wait-btn": "‮Ԁʅǝɐsǝ‬ ‮ʍɐıʇ‬…",
-      "feedback#diagnostic_check": "‮∩dʅoɐp‬ ‮pıɐƃuosʇıɔ‬ ‮pɐʇɐ‬. ‮Ԁʅǝɐsǝ‬ ‮uoʇǝ‬ ‮ʇɥɐʇ‬ ‮ʇɥıs‬ ‮pıɐƃuosʇıɔ‬ ‮pɐʇɐ‬ ‮poǝs‬ ‮uoʇ‬ ‮ıpǝuʇıɟʎ‬ ‮ʎon‬, ‮ɐup‬ ‮ıʇ‬ ‮ʍıʅʅ‬ ‮ɥǝʅd‬ ‮ns‬ ‮ʇo‬ ‮ʞǝǝd‬ ‮Ԁsıdɥou‬ ‮ɹnuuıuƃ‬ ‮sɯooʇɥʅʎ‬. <a class=\"DataCollectionInfoURL\" href=\"#\">‮Ↄʅıɔʞ‬ ‮ɥǝɹǝ‬ ‮ʇo‬ ‮sǝǝ‬ ‮ʍɥɐʇ‬ ‮pɐʇɐ‬ ‮ʍǝ‬ ‮ɔoʅʅǝɔʇ‬.</a>",
-      "feedback#smiley_happy": "‮Ԁsıdɥou‬ ‮ɔouuǝɔʇs‬ ‮ɐup‬ ‮dǝɹɟoɹɯs‬ ‮ʇɥǝ‬ ‮ʍɐʎ‬ ‮I‬ ‮ʍɐuʇ‬ ‮ıʇ‬ ‮ʇo‬.",
-      "feedback#smiley_sad": "‮Ԁsıdɥou‬ ‮oɟʇǝu‬ ‮ɟɐıʅs‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮oɹ‬ ‮poǝsu‬'‮ʇ‬ ‮dǝɹɟoɹɯ‬ ‮ʍǝʅʅ‬ ‮ǝuonƃɥ‬.",
-      "feedback#submit_button": "‮Snqɯıʇ‬",
-      "feedback#success-message": "<strong>‮⊥ɥɐuʞ‬ ‮ʎon‬!</strong> ‮ʎonɹ‬ ‮ɟǝǝpqɐɔʞ‬ ‮ɥɐs‬ ‮qǝǝu‬ ‮sǝuʇ‬.",
-      "feedback#text_feedback_bottom_para": "‮Iɟ‬ ‮ʇɥǝ‬ ‮ɐqoʌǝ‬ ‮ɟoɹɯ‬ ‮ıs‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬, ‮oɹ‬ ‮ʎon‬ ‮ʍonʅp‬ ‮ʅıʞǝ‬ ‮ʇo‬ ‮sǝup‬ ‮sɔɹǝǝusɥoʇs‬, ‮dʅǝɐsǝ‬ ‮ǝɯɐıʅ‬ ‮ns‬ ‮ɐʇ‬ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">‮ɟǝǝpqɐɔʞ‬@‮dsıdɥou‬.‮ɔɐ‬</a>.",
-      "feedback#text_feedback_email_prompt": "‮Iɟ‬ ‮ʎon‬ ‮ʍonʅp‬ ‮ʅıʞǝ‬ ‮ns‬ ‮ʇo‬ ‮ɹǝsdoup‬ ‮ʇo‬ ‮ʎon‬, ‮dʅǝɐsǝ‬ ‮ǝuʇǝɹ‬ ‮ʎonɹ‬ ‮ǝɯɐıʅ‬ ‮ɐppɹǝss‬:",
-      "feedback#text_feedback_prompt": "‮Ԁʅǝɐsǝ‬ ‮ǝuʇǝɹ‬ ‮ʎonɹ‬ ‮ɔoɯɯǝuʇs‬ ‮ɥǝɹǝ‬:",
-      "feedback#top_content_title": "‮פıʌǝ‬ ‮∩s‬ ‮ʎonɹ‬ ‮ɟǝǝpqɐɔʞ‬",
-      "feedback#top_para_2": "‮Wɐuʎ‬ ‮dɹoqʅǝɯs‬ ‮ɔɐu‬ ‮qǝ‬ ‮ɟıxǝp‬ ‮qʎ‬ ‮poʍuʅoɐpıuƃ‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬. ‮ʎon‬ ‮ɔɐu‬ <a class=\"NewVersionURL\" href=\"#\">‮poʍuʅoɐp‬ ‮ʇɥǝ‬ ‮ʅɐʇǝsʇ‬ ‮ʌǝɹsıou‬ ‮qʎ‬ ‮ɔʅıɔʞıuƃ‬ ‮ɥǝɹǝ‬</a>, ‮oɹ‬ ‮ʎon‬ ‮ɔɐu‬ ‮sǝup‬ ‮ɐu‬ ‮ǝɯɐıʅ‬ ‮ʇo‬ <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "‮ʎon‬ ‮ɔɐu‬ ‮ɐʅso‬ ‮ɟıup‬ ‮soʅnʇıous‬ ‮ʇo‬ ‮ɯɐuʎ‬ ‮ɔoɯɯou‬ ‮dɹoqʅǝɯs‬ ‮ıu‬ ‮onɹ‬ <a class=\"FaqURL\" href=\"#\">‮ɟɹǝbnǝuʇʅʎ‬ ‮∀sʞǝp‬ ‮Ònǝsʇıous‬</a>.",
-      "general#modal-close-button": "‮Ↄʅosǝ‬",
-      "general#notice-modal-tech-preamble": "‮Hǝɹǝ‬ ‮ıs‬ ‮ʇɥǝ‬ ‮ʇǝɔɥuıɔɐʅ‬ ‮ǝɹɹoɹ‬ ‮ıuɟo‬:",
-      "language#success-message": "<strong>‮Hǝʅʅo‬!</strong> ‮Ｍǝʅɔoɯǝ‬ ‮ʇo‬ ‮Ԁsıdɥou‬.",
-      "logs#placeholder": "‮No‬ ‮ʅoƃs‬ ‮ʎǝʇ‬",
-      "logs#show-debug-label": "‮Sɥoʍ‬ ‮pǝqnƃ‬ ‮ʅoƃs‬",
-      "nav#about": "‮∀qonʇ‬",
-      "nav#connection#connected": "‮Ↄouuǝɔʇǝp‬",
-      "nav#connection#starting": "‮Ↄouuǝɔʇıuƃ‬",
-      "nav#connection#stopped": "‮pısɔouuǝɔʇǝp‬",
-      "nav#connection#stopping": "‮pısɔouuǝɔʇıuƃ‬",
-      "nav#feedback": "‮ɟǝǝpqɐɔʞ‬",
-      "nav#logs": "‮˥oƃs‬",
-      "nav#settings": "‮Sǝʇʇıuƃs‬",
-      "notice#disallowed-traffic-alert-body": "<p>‮∀dds‬ ‮uoʇ‬ ‮ʍoɹʞıuƃ‬?</p>\n<p>‮Soɯǝ‬ ‮ıuʇǝɹuǝʇ‬ ‮ʇɹɐɟɟıɔ‬ ‮ıs‬ ‮uoʇ‬ ‮snddoɹʇǝp‬ ‮ʍıʇɥonʇ‬ ‮ɐu‬ ‮ɐɔʇıʌǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬. ‮∀ɔʇıʌɐʇǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬ ‮ʍıʇɥ‬ ‮ԀsıↃɐsɥ‬ ‮ʇo‬ ‮nuʅoɔʞ‬ ‮ʇɥǝ‬ ‮ɟnʅʅ‬ ‮doʇǝuʇıɐʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ǝxdǝɹıǝuɔǝ‬.</p>",
-      "notice#disallowed-traffic-alert-title": "‮∩dƃɹɐpǝ‬ ‮ʎonɹ‬ ‮Ԁsıdɥou‬ ‮ɔouuǝɔʇıou‬",
-      "notice#systemproxysettings-setproxy-error-body": "<p>‮Ԁsıdɥou‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮sǝʇ‬ ‮ʇɥǝ‬ ‮sʎsʇǝɯ‬’‮s‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬.</p>\n<p>‮⊥ɥıs‬ ‮ɯıƃɥʇ‬ ‮qǝ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɔouɟʅıɔʇ‬ ‮ʍıʇɥ‬ ‮ʎonɹ‬ ‮ɐuʇıʌıɹns‬ ‮soɟʇʍɐɹǝ‬. ‮ʎon‬ ‮ɯıƃɥʇ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ɯɐunɐʅʅʎ‬ ‮ɔouɟıƃnɹǝ‬ ‮ʎonɹ‬ ‮ɐddʅıɔɐʇıou‬ ‮oɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ʇo‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮ʅoɔɐʅ‬ ‮Ԁsıdɥou‬ ‮dɹoxıǝs‬.</p>",
-      "notice#systemproxysettings-setproxy-error-title": "‮Sʎsʇǝɯ‬ ‮Ԁɹoxʎ‬ ‮Ǝɹɹoɹ‬",
-      "notice#systemproxysettings-setproxy-warning-template": "‮Ԁsıdɥou‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮sǝʇ‬ ‮ʇɥǝ‬ ‮sʎsʇǝɯ‬’‮s‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ɟoɹ‬ ‮ʇɥǝ‬ ‮Iuʇǝɹuǝʇ‬ ‮ɔouuǝɔʇıou‬ ‮uɐɯǝp‬ “<%- data %>”. ‮⊥ɥıs‬ ‮ɯıƃɥʇ‬ ‮qǝ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɔouɟʅıɔʇ‬ ‮ʍıʇɥ‬ ‮ʎonɹ‬ ‮ɐuʇıʌıɹns‬ ‮soɟʇʍɐɹǝ‬. ‮ʎon‬ ‮ɯıƃɥʇ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ɯɐunɐʅʅʎ‬ ‮ɔouɟıƃnɹǝ‬ ‮ʎonɹ‬ ‮ɐddʅıɔɐʇıou‬ ‮oɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬ ‮ʇo‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮ʅoɔɐʅ‬ ‮Ԁsıdɥou‬ ‮dɹoxıǝs‬.",
-      "positive-value-indicator": "+%d",
-      "psicash#1-day": "1 ‮pɐʎ‬",
-      "psicash#1-hour": "1 ‮ɥonɹ‬",
-      "psicash#init-error-body-recovered": "‮ԀsıↃɐsɥ‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮ıuıʇıɐʅızǝ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮dɹoqɐqʅʎ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɟıʅǝ‬ ‮sʎsʇǝɯ‬ ‮dɹoqʅǝɯ‬, ‮snɔɥ‬ ‮ɐs‬ ‮qǝıuƃ‬ ‮onʇ‬ ‮oɟ‬ ‮pısʞ‬ ‮sdɐɔǝ‬. ‮ʎonɹ‬ ‮qɐʅɐuɔǝ‬ ‮ɐup‬ ‮oʇɥǝɹ‬ ‮sʇɐʇǝ‬ ‮ɥɐʌǝ‬ ‮qǝǝu‬ ‮ɹǝsǝʇ‬.",
-      "psicash#init-error-body-unrecovered": "‮ԀsıↃɐsɥ‬ ‮ɟɐıʅǝp‬ ‮ʇo‬ ‮ıuıʇıɐʅızǝ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮dɹoqɐqʅʎ‬ ‮pnǝ‬ ‮ʇo‬ ‮ɐ‬ ‮ɟıʅǝ‬ ‮sʎsʇǝɯ‬ ‮dɹoqʅǝɯ‬, ‮snɔɥ‬ ‮ɐs‬ ‮qǝıuƃ‬ ‮onʇ‬ ‮oɟ‬ ‮pısʞ‬ ‮sdɐɔǝ‬. ‮ʎonɹ‬ ‮qɐʅɐuɔǝ‬ ‮ɐup‬ ‮oʇɥǝɹ‬ ‮sʇɐʇǝ‬ ‮ɥɐʌǝ‬ ‮qǝǝu‬ ‮ʅosʇ‬. ‮ԀsıↃɐsɥ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮qǝ‬ ‮nsɐqʅǝ‬. ‮ʎon‬ ‮ɔɐu‬ ‮ʇɹʎ‬ ‮ɹǝsʇɐɹʇıuƃ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬ ‮ʇo‬ ‮ɹǝɔoʌǝɹ‬ ‮ɟɹoɯ‬ ‮ʇɥǝ‬ ‮dɹoqʅǝɯ‬.",
-      "psicash#init-error-title": "‮ԀsıↃɐsɥ‬ ‮ıuıʇıɐʅızɐʇıou‬ ‮ǝɹɹoɹ‬",
-      "psicash#mustconnect-modal#body": "‮Iu‬ ‮oɹpǝɹ‬ ‮ʇo‬ ‮nsǝ‬ ‮ԀsıↃɐsɥ‬, ‮ʎon‬ ‮ɯnsʇ‬ ‮qǝ‬ ‮ɔouuǝɔʇǝp‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮uǝʇʍoɹʞ‬.",
-      "psicash#mustconnect-modal#title": "‮Ԁsıdɥou‬ ‮Ↄouuǝɔʇıou‬ ‮ᴚǝbnıɹǝp‬",
-      "psicash#psiphon-speed": "‮Ԁsıdɥou‬<br>‮Sdǝǝp‬",
-      "psicash#transaction-ExistingTransaction-body": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɐu‬ ‮ǝxısʇıuƃ‬ ‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮oɟ‬ ‮ʇɥıs‬ ‮ʇʎdǝ‬. ‮∀uoʇɥǝɹ‬ ‮dnɹɔɥɐsǝ‬ ‮oɟ‬ ‮ʇɥıs‬ ‮ʇʎdǝ‬ ‮ıs‬ ‮uoʇ‬ ‮ɐʅʅoʍǝp‬ ‮nuʇıʅ‬ ‮ʇɥǝ‬ ‮dɹǝʌıons‬ ‮ouǝ‬ ‮ǝxdıɹǝs‬. ‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮sʇɐʇǝ‬ ‮ʍıʅʅ‬ ‮qǝ‬ ‮ɹǝɟɹǝsɥǝp‬ ‮uoʍ‬.",
-      "psicash#transaction-ExistingTransaction-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ǝxısʇs‬",
-      "psicash#transaction-InsufficientBalance-body": "‮ʎon‬ ‮po‬ ‮uoʇ‬ ‮ɥɐʌǝ‬ ‮snɟɟıɔıǝuʇ‬ ‮ԀsıↃɐsɥ‬ ‮qɐʅɐuɔǝ‬ ‮ɟoɹ‬ ‮ʇɥıs‬ ‮dnɹɔɥɐsǝ‬.",
-      "psicash#transaction-InsufficientBalance-title": "‮Iusnɟɟıɔıǝuʇ‬ ‮ԀsıↃɐsɥ‬ ‮qɐʅɐuɔǝ‬",
-      "psicash#transaction-InvalidTokens-body": "‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮ʇoʞǝus‬ ‮ɐɹǝ‬ ‮ıuʌɐʅıp‬. ‮⊥ɹʎ‬ ‮ɹǝsʇɐɹʇıuƃ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬. ‮Iɟ‬ ‮ʇɥɐʇ‬ ‮poǝsu‬'‮ʇ‬ ‮ʍoɹʞ‬, ‮ʎon‬ ‮ʍıʅʅ‬ ‮uǝǝp‬ ‮ʇo‬ <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">‮ɔʅǝɐɹ‬ ‮ʎonɹ‬ ‮ʅoɔɐʅ‬ ‮sʇoɹɐƃǝ‬</a>.",
-      "psicash#transaction-InvalidTokens-title": "‮Iuʌɐʅıp‬ ‮ԀsıↃɐsɥ‬ ‮ʇoʞǝus‬",
-      "psicash#transaction-ServerError-body": "‮⊥ɥǝ‬ ‮ԀsıↃɐsɥ‬ ‮sǝɹʌǝɹ‬ ‮ɹǝsdoupǝp‬ ‮ʍıʇɥ‬ ‮ɐu‬ ‮ǝɹɹoɹ‬ ‮ʍɥıʅǝ‬ ‮ʇɹʎıuƃ‬ ‮ʇo‬ ‮ɯɐʞǝ‬ ‮ʇɥǝ‬ ‮dnɹɔɥɐsǝ‬. ‮Ԁʅǝɐsǝ‬ ‮ɹǝʇɹʎ‬ ‮ʎonɹ‬ ‮dnɹɔɥɐsǝ‬ ‮ʅɐʇǝɹ‬.",
-      "psicash#transaction-ServerError-title": "‮ԀsıↃɐsɥ‬ ‮sǝɹʌǝɹ‬ ‮ǝɹɹoɹ‬",
-      "psicash#transaction-TransactionAmountMismatch-body": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮dɹıɔǝs‬ ‮ɐɹǝ‬ ‮onʇ‬-‮oɟ‬-‮pɐʇǝ‬. ‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮sʇɐʇǝ‬ ‮ʍıʅʅ‬ ‮qǝ‬ ‮ɹǝɟɹǝsɥǝp‬ ‮uoʍ‬.",
-      "psicash#transaction-TransactionAmountMismatch-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮dɹıɔǝ‬ ‮ɯısɯɐʇɔɥ‬",
-      "psicash#transaction-TransactionTypeNotFound-body": "‮⊥ɥǝ‬ ‮dɹopnɔʇ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮ʇɹʎıuƃ‬ ‮ʇo‬ ‮qnʎ‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮ǝxısʇs‬. ‮ʎon‬ ‮ɯɐʎ‬ ‮uǝǝp‬ ‮ʇo‬ ‮ndpɐʇǝ‬ ‮oɹ‬ ‮ɹǝıusʇɐʅʅ‬ ‮ʇɥǝ‬ ‮ɐddʅıɔɐʇıou‬.",
-      "psicash#transaction-TransactionTypeNotFound-title": "‮ԀsıↃɐsɥ‬ ‮dnɹɔɥɐsǝ‬ ‮ʇʎdǝ‬ ‮uoʇ‬ ‮ɟonup‬",
-      "psicash#transaction-error-body": "‮ʎonɹ‬ ‮ԀsıↃɐsɥ‬ ‮ʇɹɐusɐɔʇıou‬ ‮ɐʇʇǝɯdʇ‬ ‮ɟɐıʅǝp‬ ‮nuǝxdǝɔʇǝpʅʎ‬.",
-      "psicash#transaction-error-title": "‮ԀsıↃɐsɥ‬ ‮ʇɹɐusɐɔʇıou‬ ‮ǝɹɹoɹ‬",
-      "psicash#ui-buyingboost-buttontext": "‮Sʇɐɹʇıuƃ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬!",
-      "psicash#ui-buymorepsi": "‮Ԑnʎ‬ ‮ɯoɹǝ‬ ‮ԀsıↃɐsɥ‬",
-      "psicash#ui-buypsi": "‮Ԑnʎ‬ ‮ԀsıↃɐsɥ‬",
-      "psicash#ui-enoughbalance-buttontext": "‮Sʇɐɹʇ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬",
-      "psicash#ui-nsfbalance-buttontext": "‮Nǝǝpǝp‬ ‮ɟoɹ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬",
-      "psicash#ui-speedboost-active": "‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬ ‮ɐɔʇıʌǝ‬ ‮ɟoɹ‬ %s",
-      "psicash#ui-zerobalance-title": "‮Nǝǝp‬ ‮ɐ‬ ‮Sdǝǝp‬&nbsp;‮Ԑoosʇ‬?",
-      "settings#apply-button": "‮∀ddʅʎ‬ ‮Ↄɥɐuƃǝs‬",
-      "settings#applying-message": "‮ᴚǝɔouuǝɔʇıuƃ‬ ‮ʇo‬ ‮ɐddʅʎ‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬.",
-      "settings#disable-timeouts#enable-label": "‮pısɐqʅǝ‬ ‮ʇıɯǝonʇs‬ ‮ɟoɹ‬ ‮sʅoʍ‬ ‮uǝʇʍoɹʞs‬",
-      "settings#disable-timeouts#heading": "‮pısɐqʅǝ‬ ‮⊥ıɯǝonʇs‬ ‮ɟoɹ‬ ‮Sʅoʍ‬ ‮Nǝʇʍoɹʞs‬",
-      "settings#disable-timeouts#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ɔoɯɯnuıɔɐʇıou‬ ‮ʍıʇɥ‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮ʇıɯǝ‬ ‮onʇ‬.",
-      "settings#disable-timeouts#reason": "‮Ｍɥǝu‬ ‮ǝuɐqʅıuƃ‬ ‮ʇɥıs‬ ‮ɟoɹ‬ ‮ɐ‬ ‮ʌǝɹʎ‬ ‮sʅoʍ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬, ‮ʎon‬ ‮ɐɹǝ‬ ‮ʅǝss‬ ‮ʅıʞǝʅʎ‬ ‮ʇo‬ ‮ǝxdǝɹıǝuɔǝ‬ ‮nuǝxdǝɔʇǝp‬ ‮pısɔouuǝɔʇıous‬.",
-      "settings#disallowed-traffic-alert#disable-label": "‮pısɐqʅǝ‬ ‮pısɐʅʅoʍǝp‬ ‮ʇɹɐɟɟıɔ‬ ‮ɐʅǝɹʇs‬",
-      "settings#disallowed-traffic-alert#heading": "‮pısɐʅʅoʍǝp‬ ‮⊥ɹɐɟɟıɔ‬ ‮∀ʅǝɹʇ‬",
-      "settings#disallowed-traffic-alert#help-text": "‮Soɯǝ‬ ‮ʇʎdǝs‬ ‮oɟ‬ ‮ıuʇǝɹuǝʇ‬ ‮ʇɹɐɟɟıɔ‬ ‮ɐɹǝ‬ ‮uoʇ‬ ‮snddoɹʇǝp‬ ‮ʍıʇɥonʇ‬ ‮ɐu‬ ‮ɐɔʇıʌǝ‬ ‮Sdǝǝp‬ ‮Ԑoosʇ‬. ‮Ｍɥǝu‬ ‮snɔɥ‬ ‮ʇɹɐɟɟıɔ‬ ‮ıs‬ ‮pısɐʅʅoʍǝp‬, ‮ɐu‬ ‮ɐʅǝɹʇ‬ ‮ıs‬ ‮sɥoʍu‬. (‮ᴚǝ‬-‮ǝuɐqʅıuƃ‬ ‮ʍıʅʅ‬ ‮ɹǝbnıɹǝ‬ ‮ɐ‬ ‮ɹǝɔouuǝɔʇıou‬.)",
-      "settings#egress-region#default": "‮Ↄɥoosıuƃ‬ ‮ʇɥǝ‬ ‮pǝɟɐnʅʇ‬ <strong>“‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬”</strong> ‮odʇıou‬ ‮ɐʅʅoʍs‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮ɔɥoosǝ‬ ‮ɐ‬ ‮sǝɹʌǝɹ‬, ‮ʍɥıɔɥ‬ ‮ʍıʅʅ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮ɹǝsnʅʇ‬ ‮ıu‬ ‮ʇɥǝ‬ ‮qǝsʇ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬.",
-      "settings#egress-region#description": "‮Ԁsıdɥou‬ ‮ɥɐs‬ ‮sǝɹʌǝɹs‬ ‮ıu‬ ‮ɯɐuʎ‬ ‮pıɟɟǝɹǝuʇ‬ ‮ɔonuʇɹıǝs‬ ‮ɐup‬ ‮ɹǝƃıous‬. ‮∩sıuƃ‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ıu‬ ‮ɐ‬ ‮ɹǝƃıou‬ ‮ɔʅosǝ‬ ‮ʇo‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ʍıʅʅ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮qǝʇʇǝɹ‬ ‮uǝʇʍoɹʞ‬ ‮ɔouuǝɔʇıou‬, ‮qnʇ‬ ‮ʎon‬ ‮ɯɐʎ‬ ‮ʍısɥ‬ ‮ʇo‬ ‮ɐɔɔǝss‬ ‮ʍǝqsıʇǝs‬ ‮ɐup‬ ‮sǝɹʌıɔǝs‬ ‮ʅıʞǝ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮ʌıɹʇnɐʅʅʎ‬ ‮ıu‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ɔonuʇɹʎ‬ ‮oɹ‬ ‮ɹǝƃıou‬.",
-      "settings#egress-region#error-modal-body-http": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sǝɹʌǝɹ‬ ‮ıu‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ɹǝƃıou‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮ɹǝƃıou‬ ‮ıs‬ ‮uo‬ ‮ʅouƃǝɹ‬ ‮ɐʌɐıʅɐqʅǝ‬.<br>\n‮ʎon‬ ‮ɯnsʇ‬ ‮ɔɥoosǝ‬ ‮ɐ‬ ‮uǝʍ‬ ‮ɹǝƃıou‬ ‮oɹ‬ ‮ɔɥɐuƃǝ‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮pǝɟɐnʅʇ‬ “‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬” ‮ɔɥoıɔǝ‬.",
-      "settings#egress-region#error-modal-title": "‮Sǝɹʌǝɹ‬ ‮ᴚǝƃıou‬ ‮∩uɐʌɐıʅɐqʅǝ‬",
-      "settings#egress-region#heading": "‮Ԁsıdɥou‬ ‮Sǝɹʌǝɹ‬ ‮ᴚǝƃıou‬",
-      "settings#egress-region#invalid-error-msg": "‮Ↄɥoosǝ‬ ‮ɐ‬ ‮ʌɐʅıp‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ɹǝƃıou‬.",
-      "settings#egress-region#select-at": "‮∀nsʇɹıɐ‬",
-      "settings#egress-region#select-au": "‮∀nsʇɹɐʅıɐ‬",
-      "settings#egress-region#select-be": "‮Ԑǝʅƃınɯ‬",
-      "settings#egress-region#select-best-performance": "‮Ԑǝsʇ‬ ‮Ԁǝɹɟoɹɯɐuɔǝ‬",
-      "settings#egress-region#select-bg": "‮Ԑnʅƃɐɹıɐ‬",
-      "settings#egress-region#select-ca": "‮Ↄɐuɐpɐ‬",
-      "settings#egress-region#select-ch": "‮Sʍıʇzǝɹʅɐup‬",
-      "settings#egress-region#select-cz": "‮Ↄzǝɔɥ‬ ‮ᴚǝdnqʅıɔ‬",
-      "settings#egress-region#select-de": "‮פǝɹɯɐuʎ‬",
-      "settings#egress-region#select-dk": "‮pǝuɯɐɹʞ‬",
-      "settings#egress-region#select-es": "‮Sdɐıu‬",
-      "settings#egress-region#select-fr": "‮ɟɹɐuɔǝ‬",
-      "settings#egress-region#select-gb": "‮∩uıʇǝp‬ ‮Ӽıuƃpoɯ‬",
-      "settings#egress-region#select-hk": "‮Houƃ‬ ‮Ӽouƃ‬",
-      "settings#egress-region#select-hu": "‮Hnuƃɐɹʎ‬",
-      "settings#egress-region#select-in": "‮Iupıɐ‬",
-      "settings#egress-region#select-it": "‮Iʇɐʅʎ‬",
-      "settings#egress-region#select-jp": "‮ſɐdɐu‬",
-      "settings#egress-region#select-nl": "‮Nǝʇɥǝɹʅɐups‬",
-      "settings#egress-region#select-no": "‮Noɹʍɐʎ‬",
-      "settings#egress-region#select-pl": "‮Ԁoʅɐup‬",
-      "settings#egress-region#select-ro": "‮ᴚoɯɐuıɐ‬",
-      "settings#egress-region#select-rs": "‮Sǝɹqıɐ‬",
-      "settings#egress-region#select-se": "‮Sʍǝpǝu‬",
-      "settings#egress-region#select-sg": "‮Sıuƃɐdoɹǝ‬",
-      "settings#egress-region#select-sk": "‮Sʅoʌɐʞıɐ‬",
-      "settings#egress-region#select-us": "‮∩uıʇǝp‬ ‮Sʇɐʇǝs‬",
-      "settings#error-alert": "<strong>‮Ǝɹɹoɹ‬!</strong> ‮Ԁʅǝɐsǝ‬ ‮ɟıx‬ ‮ıuɔoɹɹǝɔʇ‬ ‮ʌɐʅnǝs‬ ‮qǝɟoɹǝ‬ ‮dɹoɔǝǝpıuƃ‬.",
-      "settings#error-modal#body": "‮⊥ɥǝɹǝ‬ ‮ɐɹǝ‬ ‮ǝɹɹoɹs‬ ‮ıu‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬ ‮ʌɐʅnǝs‬. ‮Ԁʅǝɐsǝ‬ ‮ɔoɹɹǝɔʇ‬ ‮ʇɥǝɯ‬ ‮qǝɟoɹǝ‬ ‮dɹoɔǝǝpıuƃ‬.",
-      "settings#error-modal#title": "‮Sǝʇʇıuƃs‬ ‮Ǝɹɹoɹ‬",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\n‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮ɟoɹ‬ ‮ıʇs‬ ‮H⊥⊥Ԁ‬ ‮dɹoxʎ‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮doɹʇ‬ ‮ɐddǝɐɹs‬ ‮ʇo‬ ‮qǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ıu‬ ‮nsǝ‬ ‮ɐup‬ ‮so‬ ‮Ԁsıdɥou‬ ‮ɔɐuuoʇ‬ ‮nsǝ‬ ‮ıʇ‬.\n</p>\n<p>\n‮Ԁʅǝɐsǝ‬ ‮ɔɥɐuƃǝ‬ ‮ʇɥǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮H⊥⊥Ԁ‬ ‮dɹoxʎ‬ ‮doɹʇ‬ ‮ʌɐʅnǝ‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬. ‮Ｍǝ‬ ‮ɹǝɔoɯɯǝupǝp‬ ‮ʇɥɐʇ‬ ‮ʎon‬ ‮ɔʅǝɐɹ‬ ‮ʇɥǝ‬ ‮ʌɐʅnǝ‬ ‮so‬ ‮ʇɥɐʇ‬ ‮Ԁsıdɥou‬ ‮ɔɐu‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮dıɔʞ‬ ‮ɐu‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮doɹʇ‬.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\n‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐ‬ ‮sdǝɔıɟıɔ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮ɟoɹ‬ ‮ıʇs‬ ‮SOↃӼS‬ ‮dɹoxʎ‬.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʇɥɐʇ‬ ‮doɹʇ‬ ‮ɐddǝɐɹs‬ ‮ʇo‬ ‮qǝ‬ ‮ɐʅɹǝɐpʎ‬ ‮ıu‬ ‮nsǝ‬ ‮ɐup‬ ‮so‬ ‮Ԁsıdɥou‬ ‮ɔɐuuoʇ‬ ‮nsǝ‬ ‮ıʇ‬.\n</p>\n<p>\n‮Ԁʅǝɐsǝ‬ ‮ɔɥɐuƃǝ‬ ‮ʇɥǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮SOↃӼS‬ ‮dɹoxʎ‬ ‮doɹʇ‬ ‮ʌɐʅnǝ‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬. ‮Ｍǝ‬ ‮ɹǝɔoɯɯǝupǝp‬ ‮ʇɥɐʇ‬ ‮ʎon‬ ‮ɔʅǝɐɹ‬ ‮ʇɥǝ‬ ‮ʌɐʅnǝ‬ ‮so‬ ‮ʇɥɐʇ‬ ‮Ԁsıdɥou‬ ‮ɔɐu‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮dıɔʞ‬ ‮ɐu‬ ‮ɐʌɐıʅɐqʅǝ‬ ‮doɹʇ‬.\n</p>",
-      "settings#local-proxy-ports#error-modal-title": "‮˥oɔɐʅ‬ ‮Ԁɹoxʎ‬ ‮Ԁoɹʇ‬ ‮Ↄouɟʅıɔʇ‬",
-      "settings#local-proxy-ports#heading": "‮˥oɔɐʅ‬ ‮Ԁɹoxʎ‬ ‮Ԁoɹʇs‬",
-      "settings#local-proxy-ports#http-label": "‮H⊥⊥Ԁ‬/‮H⊥⊥ԀS‬",
-      "settings#local-proxy-ports#leave-blank": "‮˥ǝɐʌǝ‬ <strong>‮qʅɐuʞ‬</strong> ‮ɟoɹ‬ ‮ɐnʇoɯɐʇıɔ‬ ‮doɹʇ‬ ‮sǝʅǝɔʇıou‬ (‮ɹǝɔoɯɯǝupǝp‬).",
-      "settings#local-proxy-ports#reason": "‮Iɟ‬ ‮ʎon‬ ‮nsǝ‬ ‮ʇooʅs‬ ‮ou‬ ‮ʎonɹ‬ ‮ɔoɯdnʇǝɹ‬ ‮ʇɥɐʇ‬ ‮ɹǝbnıɹǝ‬ ‮ɯɐunɐʅ‬ ‮ɔouɟıƃnɹɐʇıou‬ ‮ʇo‬ ‮ʍoɹʞ‬ ‮ʍıʇɥ‬ ‮Ԁsıdɥou‬, ‮ʎon‬ ‮ʍıʅʅ‬ ‮ʍɐuʇ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɔousısʇǝuʇʅʎ‬ ‮nsǝ‬ ‮ʇɥǝ‬ ‮sɐɯǝ‬ ‮ʅoɔɐʅ‬ ‮doɹʇ‬ ‮unɯqǝɹs‬. ‮Iɟ‬ ‮ʎon‬ ‮pou‬’‮ʇ‬ ‮ɥɐʌǝ‬ ‮ɐ‬ ‮ɹǝɐsou‬ ‮ʇo‬ ‮sdǝɔıɟʎ‬ ‮doɹʇ‬ ‮unɯqǝɹs‬, ‮ʎon‬ ‮sɥonʅp‬ ‮ɐʅʅoʍ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ɔɥoosǝ‬ ‮ʇɥǝɯ‬ ‮ɐnʇoɯɐʇıɔɐʅʅʎ‬ ‮ʇo‬ ‮ɥǝʅd‬ ‮ɐʌoıp‬ ‮ɔouɟʅıɔʇs‬.",
-      "settings#local-proxy-ports#socks-label": "‮SOↃӼS‬",
-      "settings#local-proxy-ports#unique-error-msg": "‮˥oɔɐʅ‬ ‮doɹʇs‬ ‮ɯnsʇ‬ ‮qǝ‬ ‮pısʇıuɔʇ‬ ‮ɟɹoɯ‬ ‮ǝɐɔɥ‬ ‮oʇɥǝɹ‬.",
-      "settings#port-value-error-msg": "‮Wnsʇ‬ ‮qǝ‬ ‮qǝʇʍǝǝu‬ 1 ‮ɐup‬ 65535.",
-      "settings#reset-button": "‮ᴚǝsǝʇ‬ ‮ʇo‬ ‮pǝɟɐnʅʇ‬",
-      "settings#saved-message": "‮Sǝʇʇıuƃs‬ ‮sɐʌǝp‬.",
-      "settings#split-tunnel#enable-label": "‮pou‬'‮ʇ‬ ‮dɹoxʎ‬ ‮ʍǝqsıʇǝs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɔonuʇɹʎ‬",
-      "settings#split-tunnel#heading": "‮Sdʅıʇ‬ ‮⊥nuuǝʅ‬",
-      "settings#split-tunnel#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ɹǝbnǝsʇs‬ ‮ɯɐpǝ‬ ‮ʇo‬ ‮sǝɹʌǝɹs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ʍıʅʅ‬ ‮uoʇ‬ ‮qǝ‬ ‮ʇnuuǝʅǝp‬ ‮ʇɥɹonƃɥ‬ ‮Ԁsıdɥou‬.",
-      "settings#split-tunnel#reason": "‮Ｍǝqsıʇǝs‬ ‮ʍıʇɥıu‬ ‮ʎonɹ‬ ‮ɥoɯǝ‬ ‮ɔonuʇɹʎ‬ ‮ɐɹǝ‬ ‮ƃǝuǝɹɐʅʅʎ‬ ‮uoʇ‬ ‮qʅoɔʞǝp‬, ‮so‬ ‮ǝuɐqʅıuƃ‬ ‮ʇɥıs‬ ‮odʇıou‬ ‮ʍıʅʅ‬ ‮ƃıʌǝ‬ ‮ʎon‬ ‮ɟɐsʇǝɹ‬ ‮ɐɔɔǝss‬ ‮ʇo‬ ‮ʇɥosǝ‬ ‮sıʇǝs‬ ‮ɐup‬ ‮ɔɐu‬ ‮soɯǝʇıɯǝs‬ ‮ɹǝpnɔǝ‬ ‮ISԀ‬ ‮pɐʇɐ‬ ‮nsɐƃǝ‬ ‮ɔosʇs‬.",
-      "settings#systray-minimize#enable-label": "‮Wıuıɯızǝ‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬)",
-      "settings#systray-minimize#heading": "‮Wıuıɯızǝ‬ ‮ʇo‬ ‮Noʇıɟıɔɐʇıou‬ ‮∀ɹǝɐ‬ (‮Sʎsʇǝɯ‬ ‮⊥ɹɐʎ‬)",
-      "settings#systray-minimize#help-text": "‮Iɟ‬ ‮ǝuɐqʅǝp‬, ‮ʍɥǝu‬ ‮ɯıuıɯızǝp‬ ‮ʇɥǝ‬ ‮Ԁsıdɥou‬ ‮ɐddʅıɔɐʇıou‬ ‮ʍıupoʍ‬ ‮ʍıʅʅ‬ ‮ɥıpǝ‬ ‮ıu‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (‮ɐʅso‬ ‮ʞuoʍu‬ ‮ɐs‬ ‮ʇɥǝ‬ “‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬” ‮oɹ‬ “‮sʎsʇɹɐʎ‬”, ‮ʅoɔɐʇǝp‬ ‮uǝɐɹ‬ ‮ʇɥǝ‬ ‮ɔʅoɔʞ‬ ‮ou‬ ‮ʎonɹ‬ ‮Ｍıupoʍs‬ ‮ʇɐsʞ‬ ‮qɐɹ‬).",
-      "settings#systray-minimize#reason": "‮Wıuıɯızıuƃ‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮ʇɥǝ‬ ‮uoʇıɟıɔɐʇıou‬ ‮ɐɹǝɐ‬ (“‮sʎsʇǝɯ‬ ‮ʇɹɐʎ‬”) ‮ɟɹǝǝs‬ ‮nd‬ ‮sdɐɔǝ‬ ‮ou‬ ‮ʎonɹ‬ ‮ʇɐsʞ‬ ‮qɐɹ‬. ‮⊥ɥıs‬ ‮ıs‬ ‮ǝsdǝɔıɐʅʅʎ‬ ‮ɥǝʅdɟnʅ‬ ‮ıɟ‬ ‮ʎon‬ ‮oɟʇǝu‬ ‮ɹnu‬ ‮Ԁsıdɥou‬ ‮ɟoɹ‬ ‮ʅouƃ‬ ‮dǝɹıops‬ ‮oɟ‬ ‮ʇıɯǝ‬.",
-      "settings#transport-mode#check-label": "‮∩sǝ‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ɯopǝ‬",
-      "settings#transport-mode#heading": "‮⊥ɹɐusdoɹʇ‬ ‮Wopǝ‬",
-      "settings#transport-mode#help-text": "‮∩sǝs‬ ‮Ｍıupoʍs‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ʌıɹʇnɐʅ‬ ‮uǝʇʍoɹʞıuƃ‬. ‮⊥ɥıs‬ ‮ɯopǝ‬ ‮ʍıʅʅ‬ ‮ʇnuuǝʅ‬ ‮ɐʅʅ‬ ‮oɟ‬ ‮ʎonɹ‬ ‮ɐdds‬, ‮qnʇ‬ ‮ıʇ‬ ‮poǝsu‬’‮ʇ‬ ‮dɹoʌıpǝ‬ ‮oqɟnsɔɐʇıou‬ ‮ɐup‬ ‮so‬ ‮poǝs‬ ‮uoʇ‬ ‮ɥɐʌǝ‬ ‮sʇɹouƃ‬ ‮ɔǝusoɹsɥıd‬ ‮ɔıɹɔnɯʌǝuʇıou‬ ‮ɔɐdɐqıʅıʇıǝs‬. ‮Iʇ‬ ‮ıs‬ <strong>‮uoʇ‬ ‮ɹǝɔoɯɯǝupǝp‬</strong> ‮ɟoɹ‬ ‮qʎdɐssıuƃ‬ ‮ɯosʇ‬ ‮ɟıɹǝʍɐʅʅs‬.",
-      "settings#unapplied-changes-prompt#apply-button": "‮∀ddʅʎ‬",
-      "settings#unapplied-changes-prompt#body": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɯɐpǝ‬ ‮ɔɥɐuƃǝs‬ ‮ʇo‬ ‮ʎonɹ‬ ‮sǝʇʇıuƃs‬, ‮qnʇ‬ ‮ʎon‬ ‮ɥɐʌǝ‬ ‮uoʇ‬ ‮ɐddʅıǝp‬ ‮ʇɥǝ‬ ‮ɔɥɐuƃǝs‬.<br><br>‮po‬ ‮ʎon‬ ‮ʍısɥ‬ ‮ʇo‬ ‮ɐddʅʎ‬ ‮ʎonɹ‬ ‮ɔɥɐuƃǝs‬ ‮uoʍ‬ ‮oɹ‬ ‮pısɔɐɹp‬ ‮ʇɥǝɯ‬?",
-      "settings#unapplied-changes-prompt#discard-button": "‮pısɔɐɹp‬",
-      "settings#unapplied-changes-prompt#title": "‮Sǝʇʇıuƃs‬ ‮Ↄɥɐuƃǝp‬",
-      "settings#upstream-proxy#by-default": "‮Iɟ‬ ‮ʎonɹ‬ ‮ɔoɯdnʇǝɹ‬ ‮ɐʅɹǝɐpʎ‬ ‮ɥɐs‬ ‮ɐ‬ ‮dɹoxʎ‬ ‮ɔouɟıƃnɹǝp‬, ‮qʎ‬ ‮pǝɟɐnʅʇ‬ ‮Ԁsıdɥou‬ ‮ʍıʅʅ‬ ‮nsǝ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬ ‮ʍɥǝu‬ ‮ǝsʇɐqʅısɥıuƃ‬ ‮ɐ‬ ‮ʇnuuǝʅ‬. ‮ʎon‬ ‮ɔɐu‬ ‮oʌǝɹɹıpǝ‬ ‮ʇɥɐʇ‬ ‮qǝɥɐʌıoɹ‬ ‮qʎ‬ ‮sdǝɔıɟʎıuƃ‬ ‮ɐ‬ ‮dɹoxʎ‬ ‮ʇo‬ ‮nsǝ‬, ‮oɹ‬ ‮qʎ‬ ‮sdǝɔıɟʎıuƃ‬ ‮ʇɥɐʇ‬ ‮uo‬ ‮snɔɥ‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬” ‮sɥonʅp‬ ‮qǝ‬ ‮nsǝp‬.",
-      "settings#upstream-proxy#domain-label": "‮poɯɐıu‬",
-      "settings#upstream-proxy#error-modal-body-configured": "‮ʎon‬ ‮ɥɐʌǝ‬ ‮ɔouɟıƃnɹǝp‬ ‮Ԁsıdɥou‬ ‮ʇo‬ ‮nsǝ‬ ‮ɐu‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬”.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʍǝ‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮nuɐqʅǝ‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮ʇo‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʇɥɹonƃɥ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬.<br>\n‮Ԁʅǝɐsǝ‬ ‮ɟıx‬ ‮ʇɥǝ‬ ‮sǝʇʇıuƃs‬ ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬.",
-      "settings#upstream-proxy#error-modal-body-default": "‮Ԁsıdɥou‬ ‮ıs‬ ‮ɔnɹɹǝuʇʅʎ‬ ‮ɔouɟıƃnɹǝp‬ ‮ʇo‬ ‮nsǝ‬ ‮ʎonɹ‬ ‮sʎsʇǝɯ‬ ‮dɹoxʎ‬ ‮ɐs‬ ‮ıʇs‬ “‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬”.<br>\n‮Hoʍǝʌǝɹ‬, ‮ʍǝ‬ ‮sǝǝɯ‬ ‮ʇo‬ ‮qǝ‬ ‮nuɐqʅǝ‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬ ‮ʇo‬ ‮ɐ‬ ‮Ԁsıdɥou‬ ‮sǝɹʌǝɹ‬ ‮ʇɥɹonƃɥ‬ ‮ʇɥɐʇ‬ ‮dɹoxʎ‬.<br>\n‮Ԁʅǝɐsǝ‬ ‮ǝuɐqʅǝ‬ “‮pou‬'‮ʇ‬ ‮nsǝ‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬” ‮ɐup‬ ‮ʇɹʎ‬ ‮ɐƃɐıu‬.",
-      "settings#upstream-proxy#error-modal-title": "‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬ ‮Ǝɹɹoɹ‬",
-      "settings#upstream-proxy#heading": "‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬",
-      "settings#upstream-proxy#hostname-label": "‮Hosʇuɐɯǝ‬",
-      "settings#upstream-proxy#password-label": "‮Ԁɐssʍoɹp‬",
-      "settings#upstream-proxy#port-label": "‮Ԁoɹʇ‬",
-      "settings#upstream-proxy#proxy-reqs": "‮Ouʅʎ‬ ‮H⊥⊥Ԁ‬ ‮dɹoxıǝs‬ ‮ʇɥɐʇ‬ ‮snddoɹʇ‬ ‮H⊥⊥ԀS‬ ‮ɐɹǝ‬ ‮ɐʅʅoʍǝp‬.",
-      "settings#upstream-proxy#reason": "‮∩dsʇɹǝɐɯ‬ ‮dɹoxıǝs‬ ‮ɐɹǝ‬ ‮soɯǝʇıɯǝs‬ ‮ɹǝbnıɹǝp‬ ‮qʎ‬ ‮sɔɥooʅs‬, ‮nuıʌǝɹsıʇıǝs‬, ‮oɹ‬ ‮qnsıuǝssǝs‬. ‮Iɟ‬ ‮ʎonɹ‬ ‮uǝʇʍoɹʞ‬ ‮dɹoʌıpǝɹ‬ ‮ɥɐs‬ ‮ƃıʌǝu‬ ‮ʎon‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬ ‮sǝʇʇıuƃs‬, ‮ʇɥǝu‬ ‮ɯɐunɐʅʅʎ‬ ‮sǝʇʇıuƃ‬ ‮ʇɥǝɯ‬ ‮ɥǝɹǝ‬ ‮ɯɐʎ‬ ‮qǝ‬ ‮ɹǝbnıɹǝp‬ ‮ʇo‬ ‮ɔouuǝɔʇ‬.",
-      "settings#upstream-proxy#set-hostname-error-msg": "‮ʎon‬ ‮ɯnsʇ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮Hosʇuɐɯǝ‬, ‮oɹ‬ ‮ʅǝɐʌǝ‬ ‮ɐʅʅ‬ ‮∩dsʇɹǝɐɯ‬ ‮Ԁɹoxʎ‬ ‮ɟıǝʅps‬ ‮qʅɐuʞ‬ ‮ɟoɹ‬ ‮ɐnʇoɯɐʇıɔ‬ ‮sǝʅǝɔʇıou‬.",
-      "settings#upstream-proxy#set-username-error-msg": "‮ʎon‬ ‮ɯnsʇ‬ ‮dɹoʌıpǝ‬ ‮ɐ‬ ‮∩sǝɹuɐɯǝ‬ ‮ıɟ‬ ‮ʎon‬ ‮ɐɹǝ‬ ‮sǝʇʇıuƃ‬ ‮Ԁɐssʍoɹp‬ ‮oɹ‬ ‮poɯɐıu‬; ‮oɹ‬ ‮ʅǝɐʌǝ‬ ‮ɐʅʅ‬ ‮ɐnʇɥǝuʇıɔɐʇıou‬ ‮ɟıǝʅps‬ ‮qʅɐuʞ‬ ‮ɟoɹ‬ ‮uo‬ ‮ɐnʇɥǝuʇıɔɐʇıou‬.",
-      "settings#upstream-proxy#skip-label": "‮pou‬'‮ʇ‬ ‮nsǝ‬ ‮ndsʇɹǝɐɯ‬ ‮dɹoxʎ‬",
-      "settings#upstream-proxy#username-label": "‮∩sǝɹuɐɯǝ‬",
-      "settings#vpn-incompatible-label": "‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬",
-      "settings#vpn-incompatible-msg": "(‮poǝsu‬'‮ʇ‬ ‮ʍoɹʞ‬ ‮ʍıʇɥ‬ ‮˥‬2‮⊥Ԁ‬/‮IԀSǝɔ‬ ‮ɯopǝ‬.)"
-    }
-  },
-  "el": {
-    "name": "Ελληνικά",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Γίνεται σύνδεση",
-      "nav#connection#connected": "Συνδεδεμένο",
-      "nav#connection#stopping": "Γίνεται αποσύνδεση",
-      "nav#connection#stopped": "Αποσυνδεδεμένο",
-      "nav#settings": "Ρυθμίσεις",
-      "nav#feedback": "Σχόλια",
-      "nav#logs": "Αρχεία καταγραφής",
-      "nav#about": "Σχετικά με ",
-      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
-      "connection#stop-btn": "Τερματισμός",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
-      "connection#disconnect-btn": "Αποσύνδεση",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Please wait…",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "Σύνδεση",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
-      "settings#reset-button": "Reset to Default",
-      "settings#apply-button": "Apply Changes",
-      "settings#unapplied-changes-prompt#title": "Settings Changed",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "Εφαρμογή",
-      "settings#unapplied-changes-prompt#discard-button": "Discard",
-      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon Server Region",
-      "settings#egress-region#select-best-performance": "Καλύτερη απόδοση",
-      "settings#egress-region#select-us": "Ηνωμένες Πολιτείες",
-      "settings#egress-region#select-ca": "Καναδάς",
-      "settings#egress-region#select-gb": "Ηνωμένο Βασίλειο",
-      "settings#egress-region#select-jp": "Ιαπωνία",
-      "settings#egress-region#select-sg": "Σιγκαπούρη",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Ολλανδία",
-      "settings#egress-region#select-de": "Γερμανία",
-      "settings#egress-region#select-in": "Ινδία",
-      "settings#egress-region#select-es": "Ισπανία",
-      "settings#egress-region#select-hk": "Χονγκ Κονγκ",
-      "settings#egress-region#select-at": "Αυστρία",
-      "settings#egress-region#select-be": "Βέλγιο",
-      "settings#egress-region#select-bg": "Βουλγαρία",
-      "settings#egress-region#select-ch": "Σουηδία",
-      "settings#egress-region#select-cz": "Δημοκρατία της Τσεχίας",
-      "settings#egress-region#select-dk": "Δανία",
-      "settings#egress-region#select-fr": "Γαλλία",
-      "settings#egress-region#select-hu": "Ουγγαρία",
-      "settings#egress-region#select-it": "Ιταλία",
-      "settings#egress-region#select-no": "Νορβηγία",
-      "settings#egress-region#select-ro": "Ρουμανία",
-      "settings#egress-region#select-se": "Σουηδία",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
-      "settings#egress-region#error-modal-title": "Server Region Unavailable",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Πρέπει να είναι μεταξύ του 1 και του 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Θύρα",
-      "settings#upstream-proxy#username-label": "Όνομα Χρήστη",
-      "settings#upstream-proxy#password-label": "Κωδικός ",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Transport Mode",
-      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Settings saved.",
-      "settings#error-modal#title": "Settings Error",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "Στείλτε μας τα Σχόλιά σας",
-      "feedback#top_para_2": "Πολλά προβλήματα μπορούν να επιλυθούν με την λήψη της τελευταίας έκδοσης. Μπορείτε <a class=\"NewVersionURL\" href=\"#\">να κατεβάσετε την τελευταία έκδοση πατώντας εδώ</a>, ή μπορείτε να στείλετε ένα email στο <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Μπορείτε επίσης να βρείτε λύσεις σε πολλά κοινά προβλήματα στις<a class=\"FaqURL\" href=\"#\">Συχνές Ερωτήσεις</a>.",
-      "feedback#smiley_happy": "Το Psiphon συνδέεται και αποδίδει όπως θα ηθελα.",
-      "feedback#smiley_sad": "Το Psiphon συχνά αδυνατεί να συνδεθεί ή δεν αποδίδει αρκετά καλά.",
-      "feedback#text_feedback_prompt": "Αφήστε τα σχόλιά σας εδώ:",
-      "feedback#text_feedback_email_prompt": "Αν θέλετε να λάβετε απάντηση, εισάγετε το email σας:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "Υποβολή",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Thank you!</strong> Your feedback has been sent.",
-      "logs#show-debug-label": "Show debug logs",
-      "logs#placeholder": "No logs yet",
-      "language#success-message": "<strong>Γεια!</strong> Καλωσήλθατε στο Psiphon.",
-      "about#wordart-tag": "Beyond Borders",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>Αν δεν έχετε πρόσβαση στην ιστοσελίδα</strong>, μπορείτε να λάβετε μια νέα έκδοση του Psiphon στέλνωντας ένα email στο:",
-      "about#client-version": "Psiphon for Windows client version:",
-      "general#modal-close-button": "Κλείσιμο",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Το Psiphon αποσυνδέθηκε",
-      "appbackend#state-starting-title": "Psiphon is connecting",
-      "appbackend#state-starting-body": "Please wait…",
-      "appbackend#state-connected-title": "Το Psiphon συνδέθηκε",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 ώρα",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Χρηματοδοτείται από"
-    }
-  },
-  "en": {
-    "name": "English",
-    "translation": {
-      "banner#sponsored-by": "Sponsored by",
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Connecting",
-      "nav#connection#connected": "Connected",
-      "nav#connection#stopping": "Disconnecting",
-      "nav#connection#stopped": "Disconnected",
-      "nav#settings": "Settings",
-      "nav#feedback": "Feedback",
-      "nav#logs": "Logs",
-      "nav#about": "About",
-      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
-      "connection#stop-btn": "Stop",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
-      "connection#disconnect-btn": "Disconnect",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Please wait…",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "Connect",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
-      "settings#reset-button": "Reset to Default",
-      "settings#apply-button": "Apply Changes",
-      "settings#unapplied-changes-prompt#title": "Settings Changed",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "Apply",
-      "settings#unapplied-changes-prompt#discard-button": "Discard",
-      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon Server Region",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "United States",
-      "settings#egress-region#select-ca": "Canada",
-      "settings#egress-region#select-gb": "United Kingdom",
-      "settings#egress-region#select-jp": "Japan",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Netherlands",
-      "settings#egress-region#select-de": "Germany",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spain",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Belgium",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Switzerland",
-      "settings#egress-region#select-cz": "Czech Republic",
-      "settings#egress-region#select-dk": "Denmark",
-      "settings#egress-region#select-fr": "France",
-      "settings#egress-region#select-hu": "Hungary",
-      "settings#egress-region#select-it": "Italy",
-      "settings#egress-region#select-no": "Norway",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Sweden",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
-      "settings#egress-region#error-modal-title": "Server Region Unavailable",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Must be between 1 and 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Username",
-      "settings#upstream-proxy#password-label": "Password",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Transport Mode",
-      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Settings saved.",
-      "settings#error-modal#title": "Settings Error",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "Give Us Your Feedback",
-      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "Psiphon connects and performs the way I want it to.",
-      "feedback#smiley_sad": "Psiphon often fails to connect or doesn't perform well enough.",
-      "feedback#text_feedback_prompt": "Please enter your comments here:",
-      "feedback#text_feedback_email_prompt": "If you would like us to respond to you, please enter your email address:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "Submit",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Thank you!</strong> Your feedback has been sent.",
-      "logs#show-debug-label": "Show debug logs",
-      "logs#placeholder": "No logs yet",
-      "language#success-message": "<strong>Hello!</strong> Welcome to Psiphon.",
-      "about#wordart-tag": "Beyond Borders",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon for Windows client version:",
-      "general#modal-close-button": "Close",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon is disconnected",
-      "appbackend#state-starting-title": "Psiphon is connecting",
-      "appbackend#state-starting-body": "Please wait…",
-      "appbackend#state-connected-title": "Psiphon is connected",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts"
-    }
-  },
-  "es": {
-    "name": "Español",
-    "translation": {
-      "banner#long-connecting": "<strong>¡Oh no!</strong> ¡Parece que está teniendo problemas al conectar!<br>\nDescargue la última versión de Psiphon del <a class=\"NewVersionURL\" href=\"#\">sitio de descargas</a>\nenvíenos un correo electrónico para facilitársela a <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Conectando",
-      "nav#connection#connected": "Conectado",
-      "nav#connection#stopping": "Desconectando",
-      "nav#connection#stopped": "Desconectado",
-      "nav#settings": "Configuración",
-      "nav#feedback": "Comentarios",
-      "nav#logs": "Registros (logs)",
-      "nav#about": "Acerca de",
-      "connection#starting-msg": "Psiphon está <span class=\"state-word\">conectando</span>…",
-      "connection#stop-btn": "Detener",
-      "connection#connected-msg": "Psiphon está <span class=\"state-word\">conectado</span>",
-      "connection#disconnect-btn": "Desconectar",
-      "connection#stopping-msg": "Psiphon está <span class=\"state-word\">desconectando</span>…",
-      "connection#wait-btn": "Por favor, espere...",
-      "connection#stopped-msg": "Psiphon está <span class=\"state-word\">desconectado</span>",
-      "connection#connect-btn": "Conectar",
-      "connection#egress-region-combo-label": "Seleccionar región del servidor",
-      "settings#error-alert": "<strong>¡Error!</strong> Por favor, repare los valores incorrectos antes de proseguir.",
-      "settings#reset-button": "Restablecer predeterminados",
-      "settings#apply-button": "Aplicar cambios",
-      "settings#unapplied-changes-prompt#title": "La configuración cambió",
-      "settings#unapplied-changes-prompt#body": "Ha realizado cambios en su configuración, pero no ha aplicado los cambios.<br><br>¿Desea aplicar sus cambios ahora o descartarlos?",
-      "settings#unapplied-changes-prompt#apply-button": "Aplicar",
-      "settings#unapplied-changes-prompt#discard-button": "Descartar",
-      "settings#vpn-incompatible-msg": "(No funciona con el modo L2TP/IPSec (VPN).)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec (VPN)",
-      "settings#split-tunnel#heading": "Túnel dividido",
-      "settings#split-tunnel#help-text": "Si se habilita, las solicitudes hechas a servidores dentro de su país de residencia no serán enviadas a través del túnel de Psiphon.",
-      "settings#split-tunnel#reason": "Los sitios web dentro de su país de residencia generalmente no se encuentran bloqueados, por lo que habilitando esta opción le dará a ud. un acceso veloz a estos sitios y algunas veces reducirá los costos de uso de ISP.",
-      "settings#split-tunnel#enable-label": "No proxyficar sitios web dentro de su país",
-      "settings#disable-timeouts#heading": "Deshabilitar límite de tiempo de espera para redes lentas",
-      "settings#disable-timeouts#help-text": "Si está habilitada, la comunicación con el servidor Psiphon se cerrará por límite de tiempo.",
-      "settings#disable-timeouts#reason": "Al habilitar esto sobre una conexión de red muy lenta, es menos probable que experimentes desconexiones inesperadas.",
-      "settings#disable-timeouts#enable-label": "Deshabilitar límite de tiempo de espera para redes lentas",
-      "settings#egress-region#heading": "Región del servidor Psiphon",
-      "settings#egress-region#select-best-performance": "Mejor rendimiento",
-      "settings#egress-region#select-us": "Estados Unidos",
-      "settings#egress-region#select-ca": "Canadá",
-      "settings#egress-region#select-gb": "Reino Unido",
-      "settings#egress-region#select-jp": "Japón",
-      "settings#egress-region#select-sg": "Singapur",
-      "settings#egress-region#select-sk": "Eslovaquia",
-      "settings#egress-region#select-nl": "Países Bajos",
-      "settings#egress-region#select-de": "Alemania",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "España",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Bélgica",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Suiza",
-      "settings#egress-region#select-cz": "República checa",
-      "settings#egress-region#select-dk": "Dinamarca",
-      "settings#egress-region#select-fr": "Francia",
-      "settings#egress-region#select-hu": "Hungría",
-      "settings#egress-region#select-it": "Italia",
-      "settings#egress-region#select-no": "Noruega",
-      "settings#egress-region#select-ro": "Rumanía",
-      "settings#egress-region#select-se": "Suecia",
-      "settings#egress-region#select-pl": "Polonia",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon tiene servidores en muchos países y regiones diferentes. Usar un servidor Psiphon en una región cercana a su país natal generalmente proporcionará una mejor conexión a la red, pero puede que desee acceder a sitios web y servicios como si estuviera virtualmente en un país o región específica.",
-      "settings#egress-region#default": "Elegir la opción predeterminada <strong>“Mejor Desempeño”</strong> permite a Psiphon escoger automáticamente un servidor, que generalmente resultará en la mejor conexión posible a la red.",
-      "settings#egress-region#invalid-error-msg": "Escoja una región válida de servidor Psiphon.",
-      "settings#egress-region#error-modal-title": "Región de servidor no disponible",
-      "settings#egress-region#error-modal-body-http": "Ha configurado Psiphon para que use un servidor en una región específica.<br>\nSin embargo, esa región ya no está disponible.<br>\nTiene que elegir una nueva región o cambiar a la opción predeterminada \"Mejor Desempeño\".",
-      "settings#local-proxy-ports#heading": "Puertos de proxy local",
-      "settings#local-proxy-ports#leave-blank": "Dejar <strong>en blanco</strong> para selección automática de puerto (recomendado).",
-      "settings#local-proxy-ports#reason": "Si en su computadora utiliza herramientas que requieren configuración manual para funcionar con Psiphon, querrá que Psiphon use los mismos números de puerto local de forma consistente. Si no tiene un motivo para especificar números de puerto, debe permitir a Psiphon escogerlos automáticamente para ayudar a evitar conflictos.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Debe estar entre 1 y 65535",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Los puertos locales tienen que ser distintos entre si.",
-      "settings#local-proxy-ports#error-modal-title": "Conflicto de puerto de proxy local",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nHa configurado Psiphon para que use un puerto local específico para su propio proxy HTTP.<br>\nSin embargo, ese puerto parece estar ya en uso y por tanto Psiphon no puede usarlo.\n</p>\n<p>\nPor favor, cambie el valor configurado de puerto para proxy HTTP e inténtelo de nuevo. Recomendamos que deje en blanco el valor de forma que Psiphon pueda seleccionar automáticamente un puerto disponible.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nHa configurado Psiphon para que use un puerto local específico para su propio proxy SOCKS.<br>\nSin embargo, ese puerto parece estar ya en uso y por tanto Psiphon no puede usarlo.\n</p>\n<p>\nPor favor, cambie el valor configurado de puerto para proxy SOCKS e inténtelo de nuevo. Recomendamos que deje en blanco el valor de forma que Psiphon pueda seleccionar automáticamente un puerto disponible.\n</p>",
-      "settings#upstream-proxy#heading": "Proxy hacia Internet",
-      "settings#upstream-proxy#by-default": "Si su computadora ya tiene un proxy (interpuesto) configurado, Psiphon usará por defecto ese proxy al establecer un túnel. Puede reemplazar ese comportamiento especificando un proxy a utilizar, o especificando que no debe usarse tal \"proxy al exterior\".",
-      "settings#upstream-proxy#reason": "Los proxys (interpuestos) al exterior a veces son requeridos por escuelas, universidades, o negocios. Si conoce la configuración de proxy al exterior requerida por su proveedor de red, entonces configurarlo manualmente aquí puede que sea necesario para conectar.",
-      "settings#upstream-proxy#proxy-reqs": "Sólo están permitidos proxys HTTP que soporten HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Nombre del servidor",
-      "settings#upstream-proxy#port-label": "Puerto",
-      "settings#upstream-proxy#username-label": "Nombre de usuario",
-      "settings#upstream-proxy#password-label": "Contraseña",
-      "settings#upstream-proxy#domain-label": "Dominio",
-      "settings#upstream-proxy#skip-label": "No usar proxy hacia Internet",
-      "settings#upstream-proxy#set-hostname-error-msg": "Tienes que proveer un Nombre de Servidor, o dejar todos los campos de Proxy de Nivel Superior en blanco para su selección automática.",
-      "settings#upstream-proxy#set-username-error-msg": "Tienes que proveer un Nombre de Usuario si estás estableciendo la Contraseña o el Dominio, o dejar todos los campos en blanco para no usar autentificación.",
-      "settings#upstream-proxy#error-modal-title": "Proxy hacia Internet",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon actualmente está configurado para usar el proxy (interpuesto) de su sistema como su \"proxy al exterior\".<br>\nSin embargo, parece que no podemos conectar a un servidor Psiphon a través de ese proxy.<br>\nPor favor, habilite \"No usar el proxy al exterior\" e inténtelo de nuevo.",
-      "settings#upstream-proxy#error-modal-body-configured": "Ha configurado Psiphon para que use un \"proxy al exterior\".<br>\nSin embargo, parace que no podemos conectar a un servidor Psiphon a través de ese proxy.<br>\nPor favor, corrija la configuración e inténtelo de nuevo.",
-      "settings#transport-mode#heading": "Modo de transporte",
-      "settings#transport-mode#check-label": "Usar el modo L2TP/IPSec (VPN)",
-      "settings#transport-mode#help-text": "Usa interconexión virtual L2TP/IPSec de Windows (VPN). Este modo derivará por túnel el tráfico de todas sus aplicaciones, pero no proporciona ofuscación y por tanto no tiene capacidades robustas para la elusión de la censura. <strong>No está recomendado</strong> para evitar la mayoría de los cortafuegos (firewalls).",
-      "settings#systray-minimize#heading": "Minimizar al área de notificación (bandeja del sistema)",
-      "settings#systray-minimize#help-text": "Si está habilitada, cuando la ventana de la aplicación Psiphon esté minimizada se ocultará en el área de notificación (también conocida como la \"bandeja del sistema\" o \"systray\", localizada junto al reloj en la barra de tareas de su Windows).",
-      "settings#systray-minimize#reason": "Minimizar Psiphon en el área de notificación ('bandeja del sistema') libera espacio en su barra de tareas. Esto es especialmente útil si a menudo ejecuta Psiphon durante largos periodos de tiempo.",
-      "settings#systray-minimize#enable-label": "Minimizar en el área de notificación (bandeja del sistema)",
-      "settings#applying-message": "Reconectando para aplicar su configuración.",
-      "settings#saved-message": "Configuración guardada.",
-      "settings#error-modal#title": "Error de configuración",
-      "settings#error-modal#body": "Hay errores en los valores de su configuración. Por favor, corríjalos antes de continuar.",
-      "feedback#top_content_title": "Envíenos sus comentarios",
-      "feedback#top_para_2": "Muchos problemas pueden arreglarse descargando la versión más reciente. Puede <a class=\"NewVersionURL\" href=\"#\">descargar la última versión haciendo clic aquí</a>, o puede enviar un correo electrónico a <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "También puede encontrar soluciones a muchos problemas comunes en nuestras <a class=\"FaqURL\" href=\"#\">preguntas frecuentes (FAQ)</a>.",
-      "feedback#smiley_happy": "Psiphon conecta y funciona de la forma que yo quiero.",
-      "feedback#smiley_sad": "Psiphon falla a menudo al conectar o no funciona suficientemente bien.",
-      "feedback#text_feedback_prompt": "Por favor, introduzca sus comentarios aquí:",
-      "feedback#text_feedback_email_prompt": "Si desea que le respondamos, por favor, introduzca su dirección de correo electrónico:",
-      "feedback#diagnostic_check": "Suba datos de diagnóstico. Por favor, observe que estos datos de diagnóstico no le identifican, y nos ayudarán a mantener Psiphon funcionando como la seda <a class=\"DataCollectionInfoURL\" href=\"#\">Haga clic aquí para ver qué datos recopilamos.</a>",
-      "feedback#submit_button": "Enviar",
-      "feedback#text_feedback_bottom_para": "Si el formulario de arriba no está funcionando, o si desea enviar capturas de pantalla, por favor, escríbanos un correo a <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>¡Gracias!</strong> Sus comentarios han sido enviados.",
-      "logs#show-debug-label": "Mostrar registros (logs) de depuración",
-      "logs#placeholder": "Aún no hay registros (logs)",
-      "language#success-message": "<strong>¡Hola!</strong> Bienvenido a Psiphon.",
-      "about#wordart-tag": "Cruzando fronteras",
-      "about#description": "Psiphon es una <strong>herramienta de elusión de la censura</strong> — está diseñada para proporcionar acceso a la Internet abierta, dejando atrás censores y cortafuegos (firewalls). Es de <strong>código abierto</strong> y está desarrollada en Toronto, Canadá.",
-      "about#visit-download-site": "Por favor, visite el sitio web para <strong><a class=\"NewVersionURL\" href=\"#\">descargar una nueva versión</a></strong> o para <strong><a class=\"InfoURL\" href=\"#\">obtener ayuda e información</a></strong>. Psiphon está disponible para Android y Windows.",
-      "about#get-by-email": "<strong>Si el sitio web no está accesible</strong>, puede obtener una versión nueva de Psiphon enviando un correo electrónico a:",
-      "about#client-version": "Versión del cliente para Windows de Psiphon:",
-      "general#modal-close-button": "Cerrar",
-      "general#notice-modal-tech-preamble": "Aquí tiene la información técnica del error:",
-      "notice#systemproxysettings-setproxy-error-title": "Error con el proxy del sistema",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon no pudo al establecer la configuración para proxy (interpuesto) del sistema.</p>\n<p>Esto podría deberse a un conflicto con su software antivirus. Puede que necesite configurar manualmente su aplicación o los ajustes para proxy de su sistema para que use los servidores proxy locales de Psiphon.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon no pudo establecer la configuración para proxy (interpuesto) del sistema para la conexión a Internet de nombre “<%- data %>”. Esto podría deberse a un conflicto con su software antivirus. Puede que necesite configurar manualmente su aplicación o los ajustes para proxy del sistema para que usen los servidores proxy locales de Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon está desconectado",
-      "appbackend#state-starting-title": "Psiphon está conectando",
-      "appbackend#state-starting-body": "Por favor, espere...",
-      "appbackend#state-connected-title": "Psiphon está conectado",
-      "appbackend#state-connected-body": "¡Explore más allá de sus fronteras!",
-      "appbackend#state-connected-reminder-title": "Psiphon le mantiene conectado",
-      "appbackend#state-connected-reminder-body": "Contribuya a que Psiphon siga siendo gratuito. ¡Pulse aquí para visitar las páginas de nuestros patrocinadores!",
-      "appbackend#state-connected-reminder-body-2": "¡Contribuya que Psiphon siga siendo gratuito visitando las páginas de nuestros patrocinadores!",
-      "appbackend#minimized-to-systray-title": "Psiphon se ha minimizado en el área de notificación",
-      "appbackend#minimized-to-systray-body": "Haga clic en el icono para restaurar la aplicación",
-      "appbackend#os-unsupported": "Psiphon ya no soporta Windows XP o Vista.\nPor favor visita nuestro sitio web para más información.",
-      "psicash#transaction-error-title": "Error de transacción PsiCash",
-      "psicash#transaction-error-body": "Su intento de transacción PsiCash falló inesperadamente.",
-      "psicash#transaction-ExistingTransaction-title": "Ya compra de PsiCash ya existe",
-      "psicash#transaction-ExistingTransaction-body": "Ya existe hecha una compra de PsiCash de este tipo. Otra compra de este tipo no es permitida hasta que expire la previamente realizada. Su estado de PsiCash será actualizado ahora.",
-      "psicash#transaction-InsufficientBalance-title": "Saldo insuficiente de PsiCash",
-      "psicash#transaction-InsufficientBalance-body": "Ud. no tiene suficiente saldo de PsiCash para esta compra.",
-      "psicash#transaction-TransactionAmountMismatch-title": "El precio de compra de PsiCash no coincide",
-      "psicash#transaction-TransactionAmountMismatch-body": "Lo precios de compra de PsiCash está desactualizados. Su estado de PsiCash se actualizará ahora.",
-      "psicash#transaction-TransactionTypeNotFound-title": "Tipo de compra de PsiCash no encontrado",
-      "psicash#transaction-TransactionTypeNotFound-body": "El producto que está intentando comprar no existe más. Puede que sea necesario actualizar o reinstalar la aplicación.",
-      "psicash#transaction-InvalidTokens-title": "Credenciales PsiCash inválidas",
-      "psicash#transaction-InvalidTokens-body": "Sus credenciales PsiCash son inválidas. Intente reinstalar la aplicación. Si eso no funciona, necesitará <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">limpiar su almacenamiento local</a>.",
-      "psicash#transaction-ServerError-title": "Error del servidor PsiCash",
-      "psicash#transaction-ServerError-body": "El servidor PsiCash respondió con un error mientras intentaba realizar la compra. Por favor intenta realizar tu compra más tarde.",
-      "psicash#ui-speedboost-active": "Aumento de&nbsp;Velocidad activo por %s",
-      "psicash#ui-zerobalance-title": "¿Necesitas Aumento de&nbsp;Velocidad?",
-      "psicash#ui-buypsi": "Compre PsiCash",
-      "psicash#ui-buymorepsi": "Compre más PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Necesario para Aumento de&nbsp;Velocidad",
-      "psicash#ui-enoughbalance-buttontext": "Arrancar Aumento de&nbsp;Velocidad",
-      "psicash#1-hour": "1 hora",
-      "psicash#1-day": "1 día",
-      "psicash#ui-buyingboost-buttontext": "Arrancando Aumento de&nbsp;Velocidad",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Una conexion a Psiphon es requerida.",
-      "psicash#mustconnect-modal#body": "Para poder utilizar PsiCash, debe estar conectado a la red Psiphon.",
-      "psicash#init-error-title": "Error de inicialización de PsiCash",
-      "psicash#init-error-body-unrecovered": "PsiCash falló al inicializarse. Esto es debido probablemente a un problema del sistema de archivos, como quedarse sin espacio en disco. Tu saldo y otros estados se han perdido. PsiCash no podrá usarse. Puedes intentar reiniciando la aplicación para recuperarse del problema.",
-      "psicash#init-error-body-recovered": "PsiCash falló al inicializarse. Esto es debido probablemente a un problema del sistema de archivos, como quedarse sin espacio en disco. Tu saldo y otros estados se han restablecido.",
-      "psicash#psiphon-speed": "<br>Velocidad de Psiphon",
-      "notice#disallowed-traffic-alert-title": "Actualiza tu conexión de Psiphon",
-      "notice#disallowed-traffic-alert-body": "<p>¿Las aplicaciones no están funcionando?</p>\n<p>Algún tráfico de Internet no está soportado sin un Aumento de Velocidad activo. Activa Aumento de Velocidad con PsiCash para desbloquear el potencial completo de tu experiencia Psiphon.</p>",
-      "appbackend#disallowed-traffic-notification-title": "¿Las aplicaciones no están funcionando?",
-      "appbackend#disallowed-traffic-notification-body": "Activa Aumento de Velocidad para desbloquear el potencial completo de tu experiencia Psiphon.",
-      "settings#disallowed-traffic-alert#heading": "Alerta de Tráfico Denegada",
-      "settings#disallowed-traffic-alert#help-text": "Algunos tipos de tráfico de Internet no están soportados sin un Aumento de Velocidad activo. Cuando tal tráfico es denegado, se muestra una alerta. (Re-habilitarla requerirá una reconexión.)",
-      "settings#disallowed-traffic-alert#disable-label": "Deshabilitar alertas de tráfico denegado",
-      "banner#sponsored-by": "Patrocinado por"
-    }
-  },
-  "fa": {
-    "name": "فارسی",
-    "translation": {
-      "banner#long-connecting": "<strong>ای بابا!</strong>به نظر میاد شما برای اتصال به Psiphon با مشکل روبرو هستید<br>\nجدیدترین نسخه Psiphon را از وبسایت \n<a class=\"NewVersionURL\" href=\"#\">دانلود کنید</a>\nیا به این آدرس ایمیل بفرستید.  \n<a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "در حال اتصال",
-      "nav#connection#connected": "متصل شد",
-      "nav#connection#stopping": "قطع شدن",
-      "nav#connection#stopped": "قطع شد",
-      "nav#settings": "تنظیمات",
-      "nav#feedback": "بازخوردها",
-      "nav#logs": "گزارش ها",
-      "nav#about": "درباره",
-      "connection#starting-msg": "Psiphon در حال <span class=\"state-word\">متصل شدن است</span>…",
-      "connection#stop-btn": "متوقف کن",
-      "connection#connected-msg": "Psiphon<span class=\"state-word\"> وصل شد</span>",
-      "connection#disconnect-btn": "قطع کردن",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">در حال قطع شدن است</span>…",
-      "connection#wait-btn": "لطفا صبر کنید ...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">قطع شد.</span>",
-      "connection#connect-btn": "اتصال",
-      "connection#egress-region-combo-label": "منطقه سرور را انتخاب کنید",
-      "settings#error-alert": "<strong>خطا!</strong> لطفا ورودی های نادرست را قبل از اجرا رفع کنید.",
-      "settings#reset-button": "تنظیم مجدد به حالت پیش فرض",
-      "settings#apply-button": "تغغیرات را اعمال کن",
-      "settings#unapplied-changes-prompt#title": "تنظیمات تغییر داده شد",
-      "settings#unapplied-changes-prompt#body": "شما تغییراتی در تنظیمات ایجاد کرده اید، اما همچنان آن ها را به عملی نکرده اید. <br><br> آیا تمایل دارید این تغییرات اجرایی شوند و یا از بین بروند؟",
-      "settings#unapplied-changes-prompt#apply-button": "انجام دادن",
-      "settings#unapplied-changes-prompt#discard-button": "دور انداختن",
-      "settings#vpn-incompatible-msg": "(با حالت L2TP / IPSec  کار نمی کند.)",
-      "settings#vpn-incompatible-label": "L2TP / IPSec",
-      "settings#split-tunnel#heading": "تقسیم تونل",
-      "settings#split-tunnel#help-text": "اگر این گزینه فعال شود، درخواست هایی که به سرورهای درون کشور شما فرستاده می‌شوند از تونل Psiphon (Psiphon) عبور داده نخواهند شد.",
-      "settings#split-tunnel#reason": "وبسایت های درون کشور خودتان معمولا مسدود نیستند. بنابراین فعال کردن این گزینه دسترسی به این سایت ها را سریع‌تر می کند و گاهی می تواند هزینه‌ی مصرف داده های سرویس اینترنت شما را کاهش دهد.",
-      "settings#split-tunnel#enable-label": "وبسایت های داخل کشور من را پراکسی نکن. ",
-      "settings#disable-timeouts#heading": "غیر فعال کردن زمان انتظار برای شبکه‌های کم سرعت",
-      "settings#disable-timeouts#help-text": "در صورت فعال بودن، اتصال شما به سرور Psiphon قطع نخواهد شد",
-      "settings#disable-timeouts#reason": "وقتی این گزینه برای یک شبکه‌ی بسیار کند فعال شود، احتمال قطع پیش‌بینی نشده‌ی اتصال شما کمتر می‌شود.",
-      "settings#disable-timeouts#enable-label": "غیر فعال کردن وقفه برای شبکه‌های کم سرعت",
-      "settings#egress-region#heading": "کشور سرور خروجی Psiphon ",
-      "settings#egress-region#select-best-performance": "بهترین عملکرد",
-      "settings#egress-region#select-us": "ایالات متحده آمریکا",
-      "settings#egress-region#select-ca": "کانادا",
-      "settings#egress-region#select-gb": "انگلستان",
-      "settings#egress-region#select-jp": "ژاپن",
-      "settings#egress-region#select-sg": "سنگاپور",
-      "settings#egress-region#select-sk": "اسلواکی",
-      "settings#egress-region#select-nl": "هلند",
-      "settings#egress-region#select-de": "آلمان",
-      "settings#egress-region#select-in": "هند",
-      "settings#egress-region#select-es": "اسپانیا",
-      "settings#egress-region#select-hk": "هنگ‌کنگ",
-      "settings#egress-region#select-at": "اتریش",
-      "settings#egress-region#select-be": "بلژیک",
-      "settings#egress-region#select-bg": "بلغارستان",
-      "settings#egress-region#select-ch": "سوییس",
-      "settings#egress-region#select-cz": "جمهوری چک",
-      "settings#egress-region#select-dk": "دانمارک",
-      "settings#egress-region#select-fr": "فرانسه",
-      "settings#egress-region#select-hu": "مجارستان",
-      "settings#egress-region#select-it": "ایتالیا",
-      "settings#egress-region#select-no": "نروژ",
-      "settings#egress-region#select-ro": "رومانی",
-      "settings#egress-region#select-se": "سوئد",
-      "settings#egress-region#select-pl": "لهستان",
-      "settings#egress-region#select-rs": "صربستان",
-      "settings#egress-region#select-au": "استرالیا",
-      "settings#egress-region#description": "(Psiphon) در بسیاری از کشورها سرور دارد. معمولا استفاده از یک سرور (Psiphon) که به کشور شما نزدیک‌تر است اتصال بهتری به شبکه فراهم می کند، اما شاید شما بخواهید به وبسایت‌ها و خدمات طوری دسترسی داشته باشید که انگار که در کشور خاصی هستید.\n ",
-      "settings#egress-region#default": "انتخاب گزینه <strong>“بهترین عملکرد“</strong> به Psiphon اجازه می دهد که به صورت خودکار یک سرور را انتخاب کند که عموما نتیجه آن یک ارتباط بهتر و پایدارتر است.",
-      "settings#egress-region#invalid-error-msg": "یک منطقه سرور معتبر Psiphon را انتخاب کنید.",
-      "settings#egress-region#error-modal-title": "سرور منطقه در دسترس نیست",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "پراکسی پورت محلی",
-      "settings#local-proxy-ports#leave-blank": "به منظور انتخاب خودکار پورت این بخش را <strong>خالی</strong> بگذارید (پیشنهاد شده).",
-      "settings#local-proxy-ports#reason": "اگر از ابزارهایی استفاده می کنید که برای کار با Psiphon از تنظیمات دستی استفاده می کنند، نیاز دارید که Psiphon به طور مداوم از پورت محلی یکسانی استفاده کند. اگر دلیل خاصی برای انتخاب یک شماره پورت ندارید باید به Psiphon اجازه دهید شماره پورت را خودکار بیابد که این کار باعث جلوگیری از اخلال نیز می شود.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "باید بین 1 و 65535 باشد.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "پورت های محلی نباید یکسان باشند.",
-      "settings#local-proxy-ports#error-modal-title": "درگیری در پراکسی پورت محلی",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nشما Psiphon را تنظیم کردید که از یک پورت محلی خاص برای پراکسی HTTP استفاده کند.\n<br>\nاما٬ به نظر میرسد که آن پورت در حال استفاده شدن است و Psiphon نمیتواند از آن استفاده کند. \n</p>\n<p>\nلطفا تنظیم پورت HTTP پراکسی را تغییر دهید و دوباره امتحان کنید. ما پیشنهاد میکنیم که قسمت   این تنظیم را خالی بگذارید تا Psiphon بتواند بطور خودکار یک پورت در دسترس را استفاده کند.  </p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nشما Psiphon را تنظیم کردید که از یک پورت محلی خاص برای پراکسی SOCKS استفاده کند.\n<br>\nاما٬ به نظر میرسد که آن پورت در حال استفاده شدن است و Psiphon نمیتواند از آن استفاده کند. \n</p>\n<p>\nلطفا تنظیم پورت SOCKS پراکسی را تغییر دهید و دوباره امتحان کنید. ما پیشنهاد میکنیم که قسمت   این تنظیم را خالی بگذارید تا Psiphon بتواند بطور خودکار یک پورت در دسترس را استفاده کند.  </p>",
-      "settings#upstream-proxy#heading": "پروکسی بالادست",
-      "settings#upstream-proxy#by-default": "اگر  پروکسی بر روی کامپیوترتان تنظیم شده باشد، به شکل پیش فرض Psiphon از همان تنظیمات برای تشکیل یک تونل استفاده می کند. شما می توانید این تنظیمات را با انتخاب یک پروکسی خاص برای استفاده یا با ممنوع کردن یک پروکسی بالادستی بازنویسی کنید.",
-      "settings#upstream-proxy#reason": "گاهی مدارس، دانشگاه ها و یا بیزینس ها نیاز به پروکسی بالادستی دارند. اگر تنظیمات پورکسی بالادستی مورد درخواست سرویس دهنده شبکه را می دانید، شاید نیاز باشد برای اتصال آن ها را به صورت دستی اینجا وارد کنید.",
-      "settings#upstream-proxy#proxy-reqs": "تنها پورکسی های HTTP که از HTTPS پشتیبانی می کنند مجاز هستند.",
-      "settings#upstream-proxy#hostname-label": "نام سرور",
-      "settings#upstream-proxy#port-label": "پورت ",
-      "settings#upstream-proxy#username-label": "نام کاربری",
-      "settings#upstream-proxy#password-label": "کلمه عبور",
-      "settings#upstream-proxy#domain-label": "دامنه",
-      "settings#upstream-proxy#skip-label": "پروکسی بالادست استفاده نکنید",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "ارور پراکسی آپستریم",
-      "settings#upstream-proxy#error-modal-body-default": "در حال حاضر Psiphon تنظیم شده است که از تنظیمات پروکسی سیستم که تنظیمات بالادستی پروکسی است استفاده کند. <br>\nهرچند، با این تنظیمات پروکسی به نظر می رسد که امکان اتصال به سرور Psiphon را نداریم. <br>\nلطفا گزینه \"از پروکسی بالادستی استفاده نکن\" را فعل کرده و مجددا تلاش کنید.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon را برای استفاده از پروکسی بالادستی تنظیم کرده اید. <br>\nبا این حال و با توجه به این تنظیمات، نمی توانیم به سرور Psiphon متصل شویم. <br>\nلطفا این مشکل را برطرف کرده و مجددا تلاش کنید.",
-      "settings#transport-mode#heading": "Transport Mode",
-      "settings#transport-mode#check-label": "استفاده از حالت L2TP / IPSec ",
-      "settings#transport-mode#help-text": "از شبکه سازی مجازی L2TP/IPSec ویندوز استفاده می کند. این حالت تمام ترافیک نرم افزارها را تونل می کند، اما لایه مبهم اضافی را فراهم نمی کند و به همین دلیل توانایی دور زدن سانسور محدودی دارد. این شیوه برای دور زدن بیشتر دیوارهای آتش <strong>توصیه نمی شود</strong>. ",
-      "settings#systray-minimize#heading": "کوچک کردن برنامه به بخش System Tray ویندوز",
-      "settings#systray-minimize#help-text": "در صورت فعال کردن این گزینه، پس از مینیمایز کردن پنجره نرم افزار، Psiphon مخفی شده و به نوار اعلان منتقل می شود. (نوار اعلان یا سیستم تِرِی به نواری در پایین سمت راست صفحه ویندوز گفته می شود که نرم افزارهای فعال در پس زمینه در کنار ساعت نمایش داده می شوند.)",
-      "settings#systray-minimize#reason": "مینیمایز کردن Psiphon و فرستادن آن به نوار اعلان باعث باز شدن فضا در نوار ابزار می شود. این امکان به خصوص زمانی که از Psiphon برای زمان های طولانی استفاده می کنید کار آمد است. ",
-      "settings#systray-minimize#enable-label": "کوچک کردن برنامه به بخش System Tray ویندوز",
-      "settings#applying-message": "اتصال مجدد برای درخواست تنظیمات شما .",
-      "settings#saved-message": "تنظیمات ذخیره شد.",
-      "settings#error-modal#title": "خطا در تنظیمات",
-      "settings#error-modal#body": "اشتباهاتی در تنظیمات رخ داده است. لطفا پیش از ادامه کار، آن ها را تصحیح کنید.",
-      "feedback#top_content_title": "نظرات خود را با ما در میان بگذارید",
-      "feedback#top_para_2": "بیشتر مشکلات Psiphon با دانلود جدیدترین نسخه برطرف می‌شوند. جدیدترین نسخه Psiphon را با کلیک روی این <a class=\"NewVersionURL\" href=\"#\">لینک</a> دانلود کنید. جدیدترین نسخه را با فرستادن ایمیل به آدرس <a class=\"NewVersionEmail\" href=\"#\"></a> نیز می‌توانید دریافت کنید. ",
-      "feedback#top_para_3": "شما می‌توانید جواب بیشتر مشکلات رایج را در قسمت <a class=\"FaqURL\" href=\"#\">سوال و جواب متداول</a> پیدا کنید.  ",
-      "feedback#smiley_happy": "Psiphon به خوبی وصل می‌شود و کار می‌کند.   ",
-      "feedback#smiley_sad": "Psiphon معمولا وصل نمی‌شود و خوب کار نمی‌کند. ",
-      "feedback#text_feedback_prompt": "لطفا نظرهای خود را اینجا وارد کنید:",
-      "feedback#text_feedback_email_prompt": "اگر دوست دارید که ما به شما جواب دهیم٬ لطفا ایمیل خود را وارد کنید. ",
-      "feedback#diagnostic_check": "آپلود و ارسال اطلاعات فنی/تشخیصی کارکرد Psiphon. لطفا به خاطر داشته باشید که این اطلاعات به هیچ عنوان \nهویت شما را آشکار نمی‌کند، و به ما کمک می‌کند که Psiphon کارکرد بهتری داشته باشد. \n<a class=\"dataCollectionInfoURL\" href=\"#\"> اینجا کلیک کنید تا ببینید ما چه اطلاعاتی را جمع آوری می‌کنیم. </a>",
-      "feedback#submit_button": "ارسال",
-      "feedback#text_feedback_bottom_para": "اگر فرم بالا کار نمی‌کند و می‌خواهید برای ما عکس از صفحه‌ خودتون بفرستید. می‌توانید آن را به آدرس <a id=\"emailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ایمیل کنید.",
-      "feedback#success-message": "<strong>متشکرم!</strong> بازخورد شما ارسال شد.",
-      "logs#show-debug-label": "نمایش سیاهه های مربوط به اشکال زدایی",
-      "logs#placeholder": "بدون سیاهه های مربوط هنوز",
-      "language#success-message": "<strong>سلام!</strong> به Psiphon خوش آمدید.",
-      "about#wordart-tag": "فراتر از مرزها",
-      "about#description": "فیلترشکن Psiphon برای دور زدن فیلترینگ اینترنت و ایجاد دسترسی به اطلاعات سانسور شده طراحی شده است. کد برنامه Psiphon \n<strong>\nمتن باز / اپن سورس</strong> \nدر شهر تورنتو٬ کانادا نوشته شده است. ",
-      "about#visit-download-site": "لطفا برای <strong><a class=\"NewVersionURL\" href=\"#\">دانلود نسخه جدید</a></strong> و یا <strong><a class=\"InfoURL\" href=\"#\">دریافت کمک و اطلاعات بیشتر</a></strong> به وبسایت مراجعه کنید. Psiphon برای اندروید و ویندوز عرضه شده است.",
-      "about#get-by-email": "اگر وبسایت در دسترس شما نیست٬ نسخه جدید Psiphon را میتوانید با فرستادن ایمیل به این آدرس دریافت کنید: ",
-      "about#client-version": "Psiphon برای نسخه ویندوز سرویس گیرنده:",
-      "general#modal-close-button": "بستن",
-      "general#notice-modal-tech-preamble": "در این جا اطلاعات تکنیکی پیغام خطا را مشاهده می کنید:",
-      "notice#systemproxysettings-setproxy-error-title": "خطای پروکسی سیستم",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon نتوانست تنظیمات پروکسی سیستم را انجام دهد.</p>\n <p>ممکن است برنامه ضدویروس شما مانع این کار شده باشد. برای استفاده از پروکسی محلی Psiphon شاید لازم باشد که تنظیمات پروکسی نرم افزار و یا سیستم را دستی تغییر دهید.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon نتوانست تنظیمات پروکسی سیستم برای اتصال اینترنتی با نام  “<%- data %>” انجام دهد. این مساله ممکن است به دلیل تداخل با برنامه ضد ویروس به وجود آمده باشد. برای استفاده از پروکسی محلی Psiphon شاید لازم باشد تنظیمات پروکسی نرم افزار و یا سیستم را دستی انجام دهید.",
-      "appbackend#state-stopped-title": "Psiphon در حال قطع شدن است",
-      "appbackend#state-starting-title": "Psiphon در حال اتصال است",
-      "appbackend#state-starting-body": "لطفا صبر کنید ...",
-      "appbackend#state-connected-title": "Psiphon متصل است",
-      "appbackend#state-connected-body": "کاوش در خارج از مرزهای خود!",
-      "appbackend#state-connected-reminder-title": "Psiphon شما را متصل نگه داشته است",
-      "appbackend#state-connected-reminder-body": "Psiphon را رایگان نگه دارید. برای بازدید صفحه حامیان ما کلیک کنید!",
-      "appbackend#state-connected-reminder-body-2": "Psiphon را رایگان نگه دارید با بازدید از صفحه حامیان ما!",
-      "appbackend#minimized-to-systray-title": "Psiphon مینیمایز شد و به نوار اعلان رفت",
-      "appbackend#minimized-to-systray-body": "کلیک بر روی آیکون برای بازگرداندن نرم افزار",
-      "appbackend#os-unsupported": "Psiphon (Psiphon) دیگر از ویندوز XP و Vista پشتیبانی نمی‌کند.\nلطفا برای اطلاعات بیشتر به وبسایت ما مراجعه کنید.",
-      "psicash#transaction-error-title": "خطا در مبادله با PsiCash",
-      "psicash#transaction-error-body": "تلاش شما برای مبادله با PsiCash با مشکل ناگهانی روبرو شد.",
-      "psicash#transaction-ExistingTransaction-title": "خرید PsiCash از پیش وجود دارد. ",
-      "psicash#transaction-ExistingTransaction-body": "شما یک خرید PsiCash موجود از این نوع دارید. خریدهای دیگر از این نوع تا زمان انقضا قبلی مجاز نیست. اکنون وضعیت PsiCash شما تازه‌سازی خواهد شد.",
-      "psicash#transaction-InsufficientBalance-title": "موجودی PsiCash ناکافی است",
-      "psicash#transaction-InsufficientBalance-body": "شما PsiCash کافی برای این خرید ندارید.",
-      "psicash#transaction-TransactionAmountMismatch-title": "عدم تطابق قیمت خرید PsiCash",
-      "psicash#transaction-TransactionAmountMismatch-body": "قیمت‌های خرید PsiCash قدیمی هستند. اکنون وضعیت PsiCash شما تازه‌سازی خواهد شد.",
-      "psicash#transaction-TransactionTypeNotFound-title": "نوع خرید PsiCash یافت نشد",
-      "psicash#transaction-TransactionTypeNotFound-body": "چیزی که می‌خواهید بخرید دیگر وجود ندارد. شما باید برنامه‌ی خود را به روز رسانی یا دوباره نصب کنید.",
-      "psicash#transaction-InvalidTokens-title": "مشخصه نامعتبر PsiCash",
-      "psicash#transaction-InvalidTokens-body": "مشخصه PsiCash شما نامعتبر است. برنامه را دوباره راه‌اندازی کنید. اگر اثری نداشت، باید <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">فضای ذخیره محلی خود را پاک کنید</a>.",
-      "psicash#transaction-ServerError-title": "خطای سرور PsiCash",
-      "psicash#transaction-ServerError-body": "سرور PsiCash هنگام تلاش برای خرید با خطا مواجه شد. لطفا بعدا خرید خود را دوباره امتحان کنید.",
-      "psicash#ui-speedboost-active": "افزایش سرعت برای %s فعال است",
-      "psicash#ui-zerobalance-title": "نیاز به افزایش سرعت دارید؟",
-      "psicash#ui-buypsi": " خرید PsiCash",
-      "psicash#ui-buymorepsi": "PsiCash بیشتری بخرید.",
-      "psicash#ui-nsfbalance-buttontext": "مورد نیاز برای افزایش سرعت",
-      "psicash#ui-enoughbalance-buttontext": "شروع افزایش سرعت",
-      "psicash#1-hour": "۱ ساعت",
-      "psicash#1-day": "۱ روز",
-      "psicash#ui-buyingboost-buttontext": "در حال افزایش سرعت!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "اتصال Psiphon الزامیست",
-      "psicash#mustconnect-modal#body": "برای استفاده از PsiCash، باید به شبکه Psiphon متصل شوید.",
-      "psicash#init-error-title": "خطای آماده‌سازی اولیه PsiCash\n",
-      "psicash#init-error-body-unrecovered": "PsiCash در آماده‌سازی اولیه ناموفق بود. این احتمالا به دلیل مشکل سیستم فایل‌ها، مانند پر بودن فضای دیسک است. موجودی و وضعیت شما از دست رفته است. PsiCash قابل استفاده نخواهد بود. برای رهایی از این مشکل می‌توانید دوباره برنامه را راه‌اندازی کنید.",
-      "psicash#init-error-body-recovered": "PsiCash در آماده‌سازی اولیه ناموفق بود. این احتمالا به دلیل مشکل سیستم فایل‌ها، مانند پر بودن فضای دیسک است. موجودی و وضعیت شما بازنشانی (reset) شده است.",
-      "psicash#psiphon-speed": "سرعت<br>Psiphon",
-      "notice#disallowed-traffic-alert-title": "اتصال Psiphon خود را ارتقا دهید",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "برنامه‌ها کار نمی‌کنند؟",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "اسپانسر شده با  "
-    }
-  },
-  "fa_AF": {
-    "name": "فارسی دری",
-    "translation": {
-      "banner#long-connecting": "<strong>اوه، نی!</strong> به نظر میرسد برای متصل شدن مشکل دارید!<br>\nآخرین نسخه سایفون را از <a class=\"NewVersionURL\" href=\"#\">سایت دانلود</a>، دانلود کنید\nیا یک ایمیل به <a class=\"NewVersionEmail\" href=\"#\"></a> بفرستید",
-      "nav#connection#starting": "درحال اتصال",
-      "nav#connection#connected": "متصل شد",
-      "nav#connection#stopping": "قطع اتصال",
-      "nav#connection#stopped": "اتصال قطع شد",
-      "nav#settings": "تنظیمات",
-      "nav#feedback": "ملاحظات",
-      "nav#logs": "گزارش ثبت",
-      "nav#about": "درباره",
-      "connection#starting-msg": "سایفون در حال<span class=\"state-word\">اتصال است</span>…",
-      "connection#stop-btn": "توقف",
-      "connection#connected-msg": "سایفون <span class=\"state-word\">متصل شده است</span>…",
-      "connection#disconnect-btn": "قطع اتصال",
-      "connection#stopping-msg": "سایفون در حال<span class=\"state-word\">قطع اتصال است</span>…",
-      "connection#wait-btn": "لطفاً صبر کنید...",
-      "connection#stopped-msg": "اتصال سایفون <span class=\"state-word\">قطع شده است</span>…",
-      "connection#connect-btn": "اتصال",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>خطا!</strong> لطفاً قبل از ادامه مقادیر نادرست را تصحیح کنید.",
-      "settings#reset-button": "تنظیم مجدد به مقادیر پیش‌فرض",
-      "settings#apply-button": "اعمال تغییرات",
-      "settings#unapplied-changes-prompt#title": "تنظیمات تغییر کرد",
-      "settings#unapplied-changes-prompt#body": "تغییرات در تنظیمات خود انجام داده‌اید، اما این تغییرات را اعمال نکرده‌اید.<br><br>آیا میخواهید تغییرات خود را اعمال کنید یا آنها را نادیده بگیرید؟",
-      "settings#unapplied-changes-prompt#apply-button": "اعمال",
-      "settings#unapplied-changes-prompt#discard-button": "نادیده گرفتن",
-      "settings#vpn-incompatible-msg": "(با حالت L2TP/IPSec کار نمیکند.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "تونل دوقسمتی",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "ویب‌سایت‌های داخل کشور خودتان پراکسی نشوند",
-      "settings#disable-timeouts#heading": "غیرفعال‌سازی مهلت زمانی برای شبکه‌های کم‌سرعت",
-      "settings#disable-timeouts#help-text": "اگر فعال باشد، مهلت زمانی برای برقراری ارتباط با سرور سایفون وجود ندارد.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "غیرفعال‌سازی مهلت زمانی برای شبکه‌های کم‌سرعت",
-      "settings#egress-region#heading": "منطقه سرور سایفون",
-      "settings#egress-region#select-best-performance": "بهترین عملکرد",
-      "settings#egress-region#select-us": "ایالات متحده",
-      "settings#egress-region#select-ca": "کانادا",
-      "settings#egress-region#select-gb": "بریتانیا",
-      "settings#egress-region#select-jp": "جاپان",
-      "settings#egress-region#select-sg": "سنگاپور",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "هالند",
-      "settings#egress-region#select-de": "آلمان",
-      "settings#egress-region#select-in": "هندوستان",
-      "settings#egress-region#select-es": "اسپانیا",
-      "settings#egress-region#select-hk": "هانگ کانگ",
-      "settings#egress-region#select-at": "اتریش",
-      "settings#egress-region#select-be": "بلجیم",
-      "settings#egress-region#select-bg": "بلغاریا",
-      "settings#egress-region#select-ch": "سوئیس",
-      "settings#egress-region#select-cz": "جمهوری چک",
-      "settings#egress-region#select-dk": "دنمارک",
-      "settings#egress-region#select-fr": "فرانسه",
-      "settings#egress-region#select-hu": "مجارستان",
-      "settings#egress-region#select-it": "ایتالیا",
-      "settings#egress-region#select-no": "ناروی",
-      "settings#egress-region#select-ro": "رومانیا",
-      "settings#egress-region#select-se": "سویدن",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "یک منطقه سرور سایفون معتبر را انتخاب کنید.",
-      "settings#egress-region#error-modal-title": "منطقه سرور در دسترس نیست",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "پورت‌های پراکسی محلی",
-      "settings#local-proxy-ports#leave-blank": "برای انتخاب پورت به صورت خودکار <strong>خالی</strong> بگذارید (مورد توصیه).",
-      "settings#local-proxy-ports#reason": "اگر از ابزارهای کمپیوتر خود استفاده میکنید که برای کار کردن با سایفون به تنظیم دستی نیاز دارند، میتوانید از سایفون بخواهید همیشه از همان شماره پورت‌های محلی استفاده کند. اگر کدام دلیل برای مشخص کردن شماره پورت‌ها ندارید، باید به سایفون اجازه بدهید آنها را به‌طور خودکار انتخاب کند تا از بروز تداخل جلوگیری شود.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "باید بین 1 تا 65535 باشد.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "پورت‌های محلی باید از یکدیگر متمایز باشند.",
-      "settings#local-proxy-ports#error-modal-title": "تعارض پورت پراکسی محلی",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nسایفون را تنظیم کرده‌اید تا از یک پورت محلی خاص برای پراکسی HTTP خود استفاده کند.<br>\nبا این حال، به نظر میرسد این پورت در حال حاضر مورد استفاده است و بنابراین سایفون نمیتواند از آن استفاده نماید.\n</p>\n<p>\nلطفاً مقدار پورت پراکسی HTTP تنظیم شده را تغییر داده و دوباره امتحان کنید. توصیه میکنیم این مقدار را پاک کنید تا سایفون بتواند به‌ صورت خودکار یک پورت موجود را انتخاب کند.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nسایفون را تنظیم کرده‌اید تا از یک پورت محلی خاص برای پراکسی SOCKS خود استفاده کند.<br>\nبا این حال، به نظر میرسد این پورت در حال حاضر مورد استفاده است و بنابراین سایفون نمیتواند از آن استفاده نماید.\n</p>\n<p>\nلطفاً مقدار پورت پراکسی SOCKS تنظیم شده را تغییر داده و دوباره امتحان کنید. توصیه میکنیم این مقدار را پاک کنید تا سایفون بتواند به‌ صورت خودکار یک پورت موجود را انتخاب کند.\n</p>",
-      "settings#upstream-proxy#heading": "پراکسی فوق",
-      "settings#upstream-proxy#by-default": "اگر کمپیوتر شما در حال حاضر دارای پراکسی تنظیم شده است، سایفون به‌طور پیش‌فرض از آن پراکسی در هنگام ایجاد تونل استفاده میکند. میتوانید با تعیین یک پراکسی جهت استفاده، یا مشخص کردن اینکه نباید از &quot;پراکسی فوق&quot; استفاده شود، این رفتار را نادیده بگیرید.",
-      "settings#upstream-proxy#reason": "بعضی اوقات استفاده از پراکسی‌های فوق توسط مکاتب، پوهنتون ها یا تجارت ها الزامی است. اگر ارائه‌دهنده شبکه تنظیمات پراکسی فوق را به شما داده است، در این صورت ممکن است برای برقراری اتصال لازم باشد آنها را به‌صورت دستی در اینجا تنظیم کنید.",
-      "settings#upstream-proxy#proxy-reqs": "فقط پراکسی‌های HTTP که از HTTPS پشتیبانی میکنند مجاز هستند.",
-      "settings#upstream-proxy#hostname-label": "نام میزبان",
-      "settings#upstream-proxy#port-label": "پورت",
-      "settings#upstream-proxy#username-label": "نام کاربری",
-      "settings#upstream-proxy#password-label": "رمز عبور",
-      "settings#upstream-proxy#domain-label": "دامنه",
-      "settings#upstream-proxy#skip-label": "از پراکسی فوق استفاده نشود",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "خطای پراکسی فوق",
-      "settings#upstream-proxy#error-modal-body-default": "سایفون در حال حاضر تنظیم شده تا از پراکسی سیستم شما به عنوان \"پراکسی فوق\" خود استفاده کند.<br>\nبا این حال، به نظر میرسد نمیتوانیم از طریق این پراکسی به یک سرور سایفون متصل شویم.<br>\nلطفاً گزینه \"از پراکسی فوق استفاده نشود\" را فعال و دوباره امتحان کنید.",
-      "settings#upstream-proxy#error-modal-body-configured": "سایفون را طوری تنظیم کرده‌اید تا از یک \"پراکسی فوق\" استفاده کند.<br>\nبا این حال، به نظر میرسد نمیتوانیم از طریق این پراکسی به یک سرور سایفون متصل شویم.<br>\nلطفاً تنظیمات را تغییر داده و دوباره امتحان کنید.",
-      "settings#transport-mode#heading": "حالت انتقال",
-      "settings#transport-mode#check-label": "استفاده از حالت L2TP/IPSec",
-      "settings#transport-mode#help-text": "استفاده از شبکه مجازی ویندوز L2TP/IPSec. این حالت تمام برنامه‌های شما را تونل میکند، اما ابهام ایجاد نمیکند و به همین دلیل قابلیت‌های عبور از سانسور نیرومند ندارد. برای عبور از اکثر فایروال‌ها <strong>توصیه نمیشود</strong>.",
-      "settings#systray-minimize#heading": "کوچک شدن به ناحیه اعلان (پطنوس سیستم)",
-      "settings#systray-minimize#help-text": "در صورت فعال بودن آن، پنجره برنامه سایفون در ناحیه اعلان (که با عنوان \"پطنوس سیستم\" شناخته میشود و در نزدیک ساعت در نوار وظیفه ویندوز قرار دارد) پنهان میگردد.",
-      "settings#systray-minimize#reason": "کوچک کردن سایفون در ناحیه اعلان (\"پطنوس سیستم\") فضای روی نوار وظیفه شما را آزاد میکند. این کار به‌خصوص در هنگام مفید است که اکثراً برای مدت زمان طولانی سایفون را اجرا کنید.",
-      "settings#systray-minimize#enable-label": "کوچک شدن به ناحیه اعلان (پطنوس سیستم)",
-      "settings#applying-message": "اتصال مجدد برای اعمال تنظیمات شما.",
-      "settings#saved-message": "تنظیمات ذخیره شد.",
-      "settings#error-modal#title": "خطا در تنظیمات",
-      "settings#error-modal#body": "خطاهای در مقادیر تنظیمات شما وجود دارند. لطفاً قبل از ادامه آنها را اصلاح کنید.",
-      "feedback#top_content_title": "نظرتان را به ما بگویید",
-      "feedback#top_para_2": "با دانلود آخرین نسخه، میتوان بسیاری از مشکلات را حل کرد. میتوانید <a class=\"NewVersionURL\" href=\"#\">آخرین نسخه را با کلیک در اینجا دانلود کنید</a>، یا میتوانید یک ایمیل به <a class=\"NewVersionEmail\" href=\"#\"></a> بفرستید.",
-      "feedback#top_para_3": "میتوانید راه های بسیار از حل‌ مشکلات رایج را در <a class=\"FaqURL\" href=\"#\">سؤالات مکرر</a> ما پیدا کنید.",
-      "feedback#smiley_happy": "سایفون متصل میشود و به شکل که میخواهم کار میکند.",
-      "feedback#smiley_sad": "سایفون اکثراً متصل نمیشود یا به‌خوبی کار نمیکند.",
-      "feedback#text_feedback_prompt": "لطفاً نظر خود را وارد کنید:",
-      "feedback#text_feedback_email_prompt": "اگر میخواهید به شما پاسخ بدهیم، لطفاً آدرس ایمیل خود را وارد کنید:",
-      "feedback#diagnostic_check": "آپلود داده‌های تشخیصی. لطفاً توجه داشته باشید که این معلومات تشخیصی موجب شناسایی شما نمیشود اما به ما کمک میکند تا اجرای سایفون را بهتر کنیم. <a class=\"DataCollectionInfoURL\" href=\"#\">اینجا را کلیک کنید تا ببینید کدام معلومات را جمع‌آوری میکنیم.</a>",
-      "feedback#submit_button": "ارسال",
-      "feedback#text_feedback_bottom_para": "اگر فورم بالا کار نمیکند یا میخواهید عکس از صفحه ارسال کنید، لطفاً به آدرس <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ایمیل بفرستید.",
-      "feedback#success-message": "<strong>با تشکر!</strong> نظر شما ارسال شد.",
-      "logs#show-debug-label": "نمایش گزارش‌های ثبت رفع مشکل",
-      "logs#placeholder": "هیچ گزارش ثبتی وجود ندارد",
-      "language#success-message": "<strong>سلام!</strong> به سایفون خوش آمدید.",
-      "about#wordart-tag": "فراتر از مرزها",
-      "about#description": "سایفون یک <strong>ابزار انحراف از سانسور است</strong> - به این منظور طراحی شده تا دسترسی به انترنیت آزاد، عبور از سانسور و فایروال‌ها را فراهم کند.  این برنامه <strong>منبع باز</strong> است و در تورنتو، کانادا انکشاف یافته است.",
-      "about#visit-download-site": "لطفاً از این ویب سایت بازدید کنید تا <strong><a class=\"NewVersionURL\" href=\"#\">یک نسخه جدید را دانلود کنید</a></strong> یا <strong><a class=\"InfoURL\" href=\"#\">راهنمایی و معلومات دریافت کنید</a></strong>. سایفون برای اندرواید و ویندوز در دسترس است.",
-      "about#get-by-email": "<strong>اگر ویب سایت غیرقابل دسترس است</strong>، میتوانید نسخه جدید سایفون را با ارسال ایمیل به این آدرس دریافت کنید:",
-      "about#client-version": "سایفون برای نسخه سرویس‌گیرنده ویندوز:",
-      "general#modal-close-button": "بستن",
-      "general#notice-modal-tech-preamble": "معلومات فنی خطا در اینجا آمده است:",
-      "notice#systemproxysettings-setproxy-error-title": "خطای پراکسی سیستم",
-      "notice#systemproxysettings-setproxy-error-body": "<p>سایفون موفق به تنظیم تنظیمات پراکسی سیستم نشد.</p>\n<p>ممکن است دلیل آن تداخل با نرم‌افزار آنتی‌ویروس شما باشد. ممکن است لازم باشد برنامه یا تنظیمات پراکسی سیستم خود را برای استفاده از پراکسی‌های محلی سایفون به‌طور دستی تنظیم نمایید.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "سایفون موفق به تنظیم تنظیمات پراکسی سیستم به نام \"<%- data %>\" برای اتصال به انترنیت نشد. ممکن است دلیل آن تداخل با نرم‌افزار آنتی‌ویروس شما باشد. ممکن است لازم باشد برنامه یا تنظیمات پراکسی سیستم خود را برای استفاده از پراکسی‌های محلی سایفون به‌طور دستی تنظیم نمایید.",
-      "appbackend#state-stopped-title": "سایفون قطع شد",
-      "appbackend#state-starting-title": "سایفون در حال اتصال است",
-      "appbackend#state-starting-body": "لطفاً صبر کنید...",
-      "appbackend#state-connected-title": "سایفون متصل است",
-      "appbackend#state-connected-body": "فراتر از مرزهای خود را بکاوید!",
-      "appbackend#state-connected-reminder-title": "سایفون ارتباط شما را حفظ میکند",
-      "appbackend#state-connected-reminder-body": "سایفون ر رایگان نگهدارید. برای بازدید از صفحات حامی مالی اینجا را کلیک کنید!",
-      "appbackend#state-connected-reminder-body-2": "با بازدید از صفحات حامی مالی ما سایفون را رایگان نگهدارید!",
-      "appbackend#minimized-to-systray-title": "سایفون در ناحیه اعلان کوچک شده است",
-      "appbackend#minimized-to-systray-body": "برای بازگرداندن برنامه روی آیکن آن کلیک کنید",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "تمویل شده توسط"
-    }
-  },
-  "fi": {
-    "name": "Suomi",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Connecting",
-      "nav#connection#connected": "Yhdistetty",
-      "nav#connection#stopping": "Disconnecting",
-      "nav#connection#stopped": "Yhteys katkaistu",
-      "nav#settings": "Asetukset",
-      "nav#feedback": "Palaute",
-      "nav#logs": "Logitiedostot",
-      "nav#about": "Ohjelmasta",
-      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
-      "connection#stop-btn": "Loppu",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
-      "connection#disconnect-btn": "Katkaise yhteys",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Please wait…",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "Yhdistä",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
-      "settings#reset-button": "Nollaa oletusarvoihin",
-      "settings#apply-button": "Apply Changes",
-      "settings#unapplied-changes-prompt#title": "Settings Changed",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "Apply",
-      "settings#unapplied-changes-prompt#discard-button": "Discard",
-      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon Server Region",
-      "settings#egress-region#select-best-performance": "Paras suorituskyky",
-      "settings#egress-region#select-us": "Yhdysvallat",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Yhdistynyt kuningaskunta",
-      "settings#egress-region#select-jp": "Japani",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Hollanti",
-      "settings#egress-region#select-de": "Saksa",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spain",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Belgium",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Switzerland",
-      "settings#egress-region#select-cz": "Czech Republic",
-      "settings#egress-region#select-dk": "Denmark",
-      "settings#egress-region#select-fr": "France",
-      "settings#egress-region#select-hu": "Hungary",
-      "settings#egress-region#select-it": "Italy",
-      "settings#egress-region#select-no": "Norway",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Sweden",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
-      "settings#egress-region#error-modal-title": "Server Region Unavailable",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "On oltava välillä 1 ... 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "Verkkotietokone",
-      "settings#upstream-proxy#port-label": "Portti",
-      "settings#upstream-proxy#username-label": "Käyttäjätunnus",
-      "settings#upstream-proxy#password-label": "Salasana",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Siirtotila",
-      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Asetukset tallennettu.",
-      "settings#error-modal#title": "Settings Error",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "Anna meille palautettasi",
-      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "Psiphon yhdistää ja suorittaa siten kuin haluan.",
-      "feedback#smiley_sad": "Psiphon usein epäonnistuu yhdistämään tai ei suoriudu kyllin hyvin.",
-      "feedback#text_feedback_prompt": "Kirjoita kommenttisi tähän:",
-      "feedback#text_feedback_email_prompt": "Jos haluat meidän vastaavan, kirjoita sähköpostiosoitteesi:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "Lähetä",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Kiitos!</strong> Palautteesi on lähetetty.",
-      "logs#show-debug-label": "Show debug logs",
-      "logs#placeholder": "No logs yet",
-      "language#success-message": "<strong>Hei!</strong> Tervetuloa Psiphon-sovellukseen.",
-      "about#wordart-tag": "Beyond Borders",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon for Windows client version:",
-      "general#modal-close-button": "Sulje",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon-yhteys on katkaistu",
-      "appbackend#state-starting-title": "Psiphon is connecting",
-      "appbackend#state-starting-body": "Please wait…",
-      "appbackend#state-connected-title": "Psiphon on yhdistetty",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponsoroija:"
-    }
-  },
-  "fr": {
-    "name": "Français",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh non.</strong> Il semble que vous éprouviez des difficultés de connexion.<br>\nTéléchargez la version la plus récente de Psiphon sur le <a class=\"NewVersionURL\" href=\"#\">\nou en envoyant un courriel à <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Connexion",
-      "nav#connection#connected": "Connecté",
-      "nav#connection#stopping": "Déconnexion",
-      "nav#connection#stopped": "Déconnecté",
-      "nav#settings": "Paramètres",
-      "nav#feedback": "Rétroaction",
-      "nav#logs": "Journaux",
-      "nav#about": "À propos",
-      "connection#starting-msg": "Psiphon se <span class=\"state-word\">connecte</span>…",
-      "connection#stop-btn": "Arrêter",
-      "connection#connected-msg": "Psiphon est <span class=\"state-word\">connecté</span>",
-      "connection#disconnect-btn": "Se déconnecter",
-      "connection#stopping-msg": "Psiphon se <span class=\"state-word\">déconnecte</span>…",
-      "connection#wait-btn": "Veuillez patientez…",
-      "connection#stopped-msg": "Psiphon est <span class=\"state-word\">déconnecté</span>",
-      "connection#connect-btn": "Se connecter",
-      "connection#egress-region-combo-label": "Sélectionner la région du serveur",
-      "settings#error-alert": "<strong>Erreur.</strong> Veuillez corriger les valeurs erronées avant de continuer.",
-      "settings#reset-button": "Réinitialiser aux valeurs par défaut",
-      "settings#apply-button": "Appliquer les changements",
-      "settings#unapplied-changes-prompt#title": "Paramètres modifiés.",
-      "settings#unapplied-changes-prompt#body": "Vous avez apporté des changements à vos paramètres, mais vous ne les avez pas appliqués.\n<br><br>Voulez-vous appliquer ces changements maintenant ou les abandonner ?",
-      "settings#unapplied-changes-prompt#apply-button": "Appliquer",
-      "settings#unapplied-changes-prompt#discard-button": "Abandonner",
-      "settings#vpn-incompatible-msg": "(ne fonctionne pas avec le mode L2TP/IPSec.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Tunnel scindé",
-      "settings#split-tunnel#help-text": "Si cette option est activée, les requêtes faites aux serveurs qui se trouvent dans votre pays de résidence ne seront pas tunnellisées par Psiphon.",
-      "settings#split-tunnel#reason": "Les sites Web de votre pays de résidence ne sont généralement pas bloqués. L’activation de cette option vous donnera donc un accès plus rapide vers ces sites et pourrait parfois réduire les coûts d’utilisation de données de votre FAI.",
-      "settings#split-tunnel#enable-label": "Ne pas relayer les sites Web de votre pays",
-      "settings#disable-timeouts#heading": "Désactiver les temporisations pour les réseaux lents",
-      "settings#disable-timeouts#help-text": "Si cette option est activée, la communication avec le serveur Psiphon n’arrivera jamais au bout de son délai.",
-      "settings#disable-timeouts#reason": "En activant cette option sur une connexion réseau très lente, les déconnexions imprévues sont moins probables.",
-      "settings#disable-timeouts#enable-label": "Désactiver les temporisations pour les réseaux lents",
-      "settings#egress-region#heading": "Région de serveur Psiphon",
-      "settings#egress-region#select-best-performance": "Les meilleures performances",
-      "settings#egress-region#select-us": "États-Unis",
-      "settings#egress-region#select-ca": "Canada",
-      "settings#egress-region#select-gb": "Royaume-Uni",
-      "settings#egress-region#select-jp": "Japon",
-      "settings#egress-region#select-sg": "Singapour",
-      "settings#egress-region#select-sk": "Slovaquie",
-      "settings#egress-region#select-nl": "Pays-Bas",
-      "settings#egress-region#select-de": "Allemagne",
-      "settings#egress-region#select-in": "Inde",
-      "settings#egress-region#select-es": "Espagne",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Autriche",
-      "settings#egress-region#select-be": "Belgique",
-      "settings#egress-region#select-bg": "Bulgarie",
-      "settings#egress-region#select-ch": "Suisse",
-      "settings#egress-region#select-cz": "République tchèque",
-      "settings#egress-region#select-dk": "Danemark",
-      "settings#egress-region#select-fr": "France",
-      "settings#egress-region#select-hu": "Hongrie",
-      "settings#egress-region#select-it": "Italie",
-      "settings#egress-region#select-no": "Norvège",
-      "settings#egress-region#select-ro": "Roumanie",
-      "settings#egress-region#select-se": "Suède",
-      "settings#egress-region#select-pl": "Pologne",
-      "settings#egress-region#select-rs": "Serbie",
-      "settings#egress-region#select-au": "Australie",
-      "settings#egress-region#description": "Psiphon a des serveurs dans de nombreux pays et régions différents. L’utilisation d’un serveur Psiphon dans une région proche de votre pays de résidence fournira habituellement une meilleure connexion réseau, mais vous pourriez souhaiter accéder à des sites Web et des services comme si vous étiez virtuellement dans un pays ou une région particuliers.",
-      "settings#egress-region#default": "Le choix de l’option du <strong>« Les meilleures performances »</strong> permet à Psiphon de choisir automatiquement un serveur, ce qui donnera habituellement la meilleure connexion réseau.",
-      "settings#egress-region#invalid-error-msg": "Choisir une région valide de serveur Psiphon.",
-      "settings#egress-region#error-modal-title": "La région de serveurs n’est pas proposée",
-      "settings#egress-region#error-modal-body-http": "Vous avez configuré Psiphon pour qu’il utilise un serveur dans une région particulière.<br>\nToutefois, cette région n’est plus proposée.<br>\nVous devez choisir une nouvelle région ou changer pour le choix par défaut « Les meilleures performances ».",
-      "settings#local-proxy-ports#heading": "Ports de mandataires locaux",
-      "settings#local-proxy-ports#leave-blank": "Laisser <strong>vide</strong> pour une sélection automatique du port (recommandé).",
-      "settings#local-proxy-ports#reason": "Si vous utilisez sur votre ordinateur des outils demandant une configuration manuelle afin de fonctionner avec Psiphon, Psiphon devrait systématiquement utiliser les mêmes numéros de port local. Si vous n’avez pas de raison de spécifier des numéros de port, vous devriez permettre à Psiphon de les choisir automatiquement pour aider à éviter les conflits.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Doit être entre 1 et 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Les ports locaux doivent être distincts les uns des autres.",
-      "settings#local-proxy-ports#error-modal-title": "Conflit de port pour le mandataire local",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nVous avez configuré Psiphon pour qu’il utilise un port local spécifique pour son serveur mandataire HTTP.<br>\nCependant, il semble que ce port est déjà utilisé et donc, Psiphon ne peut pas s’en servir.\n</p>\n<p>\nVeuillez changer la valeur de port de mandataire HTTP configurée et réessayer. Nous vous recommandons de supprimer la valeur afin que Psiphon puisse choisir automatiquement un port disponible.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nVous avez configuré Psiphon pour qu’il utilise un port local spécifique pour son serveur mandataire SOCKS.<br>\nCependant, il semble que ce port est déjà utilisé et donc, Psiphon ne peut pas s’en servir.\n</p>\n<p>\nVeuillez changer la valeur de port de mandataire SOCKS configurée et réessayer. Nous vous recommandons de supprimer la valeur afin que Psiphon puisse choisir automatiquement un port disponible.\n</p>",
-      "settings#upstream-proxy#heading": "Mandataire ascendant",
-      "settings#upstream-proxy#by-default": "Si un mandataire est déjà configuré sur votre ordinateur, par défaut Psiphon utilisera ce mandataire lors de la mise en place d’un tunnel. Vous pouvez passer outre ce comportement en spécifiant un mandataire à utiliser ou en spécifiant qu’aucun « mandataire ascendant » ne devrait être utilisé.",
-      "settings#upstream-proxy#reason": "Les serveurs mandataires ascendants sont parfois exigés par les écoles, les universités ou les entreprises. Si votre fournisseur de réseau vous a donné des paramètres de mandataire ascendant, il sera peut-être nécessaire de les configurer manuellement ici pour vous connecter.",
-      "settings#upstream-proxy#proxy-reqs": "Seuls les mandataires HTTP prenant en charge HTTPS sont permis.",
-      "settings#upstream-proxy#hostname-label": "Nom d’hôte",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Nom d’utilisateur",
-      "settings#upstream-proxy#password-label": "Mot de passe",
-      "settings#upstream-proxy#domain-label": "Domaine",
-      "settings#upstream-proxy#skip-label": "Ne pas utiliser de mandataire ascendant",
-      "settings#upstream-proxy#set-hostname-error-msg": "Vous devez indiquer un Nom d’hôte ou, pour une sélection automatique, laisser tous les champs Mandataire ascendant vides.",
-      "settings#upstream-proxy#set-username-error-msg": "Vous devez indiquer un Nom d’utilisateur si vous définissez un Mot de passe ou un Domaine ou, pour aucune authentification, laisser tous les champs d’authentification vides.",
-      "settings#upstream-proxy#error-modal-title": "Erreur de mandataire ascendant",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon est actuellement configuré pour utiliser le mandataire de votre système comme « mandataire ascendant ».<br>\nCependant, il nous semble impossible de nous connecter à un serveur Psiphon par ce mandataire.<br>\nVeuillez activer « Ne pas utiliser de mandataire ascendant » et réessayer.",
-      "settings#upstream-proxy#error-modal-body-configured": "Vous avez configuré Psiphon pour qu’il utilise un serveur « mandataire ascendant ».<br>\nCependant, il nous semble impossible de nous connecter à un serveur Psiphon par ce mandataire.<br>\nVeuillez corriger les paramètres et réessayer.",
-      "settings#transport-mode#heading": "Mode de transport",
-      "settings#transport-mode#check-label": "Utiliser le mode L2TP/IPSec",
-      "settings#transport-mode#help-text": "Utilise le réseautage virtuel L2TP/IPSec de Windows. Ce mode tunnellisera toutes vos applis, mais ne fournit pas de brouillage, ni de réelle capacité de contournement de la censure. Il <strong>n’est pas recommandé</strong> pour passer outre la plupart des pare-feu.",
-      "settings#systray-minimize#heading": "Minimiser vers la zone de notification",
-      "settings#systray-minimize#help-text": "Si cette option est activée, la fenêtre d’application de Psiphon minimisée sera cachée dans la zone de notification (située près de l’horloge dans la barre des tâches de Windows).",
-      "settings#systray-minimize#reason": "La minimisation de Psiphon vers la zone de notification libère de l’espace sur la barre des tâches, ce qui est particulièrement pratique si vous exécutez souvent Psiphon durant de longues périodes.",
-      "settings#systray-minimize#enable-label": "Minimiser vers la zone de notification",
-      "settings#applying-message": "Reconnexion pour mettre en place vos paramètres.",
-      "settings#saved-message": "Paramètres enregistrés.",
-      "settings#error-modal#title": "Erreur de paramétrage",
-      "settings#error-modal#body": "Les valeurs de vos paramètres comportent des erreurs. Veuillez les corriger avant de continuer.",
-      "feedback#top_content_title": "Laissez-nous une rétroaction",
-      "feedback#top_para_2": "De nombreux problèmes peuvent être corrigés en téléchargeant la dernière version. Vous pouvez <a class=\"NewVersionURL\" href=\"#\">télécharger la dernière version en cliquant ici</a> ou vous pouvez envoyer un courriel à <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Vous trouverez aussi des solutions à de nombreux problèmes habituels dans notre <a class=\"FaqURL\" href=\"#\">foire aux questions</a>.",
-      "feedback#smiley_happy": "Psiphon se connecte et fonctionne comme je le veux.",
-      "feedback#smiley_sad": "Psiphon n’arrive souvent pas à se connecter et ne fonctionne pas assez bien.",
-      "feedback#text_feedback_prompt": "Veuillez saisir vos commentaires ici :",
-      "feedback#text_feedback_email_prompt": "Si vous souhaitez que nous vous répondions, veuillez saisir votre adresse courriel :",
-      "feedback#diagnostic_check": "Téléverser des données de diagnostic. Veuillez prendre note que ces données de diagnostic ne vous identifient pas et elles nous aideront à offrir une exécution sans heurt de Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Cliquez ici pour voir quelles données nous recueillons.</a>",
-      "feedback#submit_button": "Envoyer",
-      "feedback#text_feedback_bottom_para": "Si le formulaire ci-dessus ne fonctionne pas  ou si vous voulez envoyer des captures d’écran, veuillez nous envoyer un courriel à <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Merci.</strong> Votre rétroaction a été envoyée.",
-      "logs#show-debug-label": "Montrer les journaux de débogage",
-      "logs#placeholder": "Pas encore de journal",
-      "language#success-message": "<strong>Bonjour.</strong> Bienvenue à Psiphon.",
-      "about#wordart-tag": "Par-delà les frontières",
-      "about#description": "Psiphon est un <strong>outil de contournement de la censure</strong> — il est conçu pour donner l’accès à l’Internet ouvert, au-delà des censeurs et des pare-feu. Il est à <strong>code source ouvert</strong> et développé à Toronto, Canada.",
-      "about#visit-download-site": "Veuillez visiter le site Web pour <strong><a class=\"NewVersionURL\" href=\"#\">télécharger une nouvelle version</a></strong> ou pour <strong><a class=\"InfoURL\" href=\"#\">obtenir de l’aide et des renseignements</a></strong>. Psiphon est proposé pour Android et Windows.",
-      "about#get-by-email": "<strong>Si le site Web n’est pas accessible</strong>, vous pouvez obtenir une nouvelle version de Psiphon en envoyant un courriel à :",
-      "about#client-version": "Version du client Psiphon pour Windows :",
-      "general#modal-close-button": "Fermer",
-      "general#notice-modal-tech-preamble": "Voici les infos techniques de l’erreur :",
-      "notice#systemproxysettings-setproxy-error-title": "Erreur de mandataire système",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon n’a pas réussi à paramétrer le mandataire système.</p>\n<p>Cela pourrait être dû à un conflit avec votre antivirus. Il vous faudra peut-être configurer manuellement votre application ou votre mandataire système afin qu’ils utilisent les mandataires locaux de Psiphon.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon n’a pas réussi à paramétrer le mandataire système pour la connexion Internet « %- data %> ». Cela pourrait être dû à un conflit avec votre antivirus. Il vous faudra peut-être configurer manuellement votre application ou votre mandataire système afin qu’ils utilisent les mandataires locaux de Psiphon.</p>",
-      "appbackend#state-stopped-title": "Psiphon est déconnecté",
-      "appbackend#state-starting-title": "Psiphon se connecte",
-      "appbackend#state-starting-body": "Veuillez patientez…",
-      "appbackend#state-connected-title": "Psiphon est connecté",
-      "appbackend#state-connected-body": "Explorez par-delà vos frontières.",
-      "appbackend#state-connected-reminder-title": "Psiphon vous garde connecté",
-      "appbackend#state-connected-reminder-body": "Préservez la gratuité de Psiphon. Cliquez ici pour visiter les pages de nos commanditaires.",
-      "appbackend#state-connected-reminder-body-2": "Préservez la gratuité de Psiphon en visitant les pages de nos commanditaires.",
-      "appbackend#minimized-to-systray-title": "Psiphon a été minimisé vers la zone de notification",
-      "appbackend#minimized-to-systray-body": "Cliquez sur l’icône pour restaurer l’application",
-      "appbackend#os-unsupported": "Psiphon ne prend plus en charge ni Windows XP ni Vista. Veuillez visiter notre site Web pour plus de précisions.",
-      "psicash#transaction-error-title": "Erreur transactionnelle PsiCash",
-      "psicash#transaction-error-body": "Échec inattendu de votre tentative de transaction PsiCash.",
-      "psicash#transaction-ExistingTransaction-title": "L’achat PsiCash existe déjà",
-      "psicash#transaction-ExistingTransaction-body": "Vous avez déjà un achat PsiCash de ce type. Il ne peut y avoir d’autre achat de ce type tant que le précédent n’est pas expiré. L’état de votre PsiCash sera actualisé maintenant.",
-      "psicash#transaction-InsufficientBalance-title": "Le solde PsiCash est insuffisant",
-      "psicash#transaction-InsufficientBalance-body": "Votre solde PsiCash est insuffisant pour cet achat.",
-      "psicash#transaction-TransactionAmountMismatch-title": "Différence de prix d’achat PsiCash",
-      "psicash#transaction-TransactionAmountMismatch-body": "Les prix d’achat PsiCash ne sont pas à jour. Votre état PsiCash sera actualisé maintenant.",
-      "psicash#transaction-TransactionTypeNotFound-title": "Le type d’achat PsiCash est introuvable",
-      "psicash#transaction-TransactionTypeNotFound-body": "Le produit que vous tentez d’acheter n’existe plus. Vous devrez peut-être mettre l’appli à jour ou la réinstaller.",
-      "psicash#transaction-InvalidTokens-title": "Les jetons PsiCash sont invalides",
-      "psicash#transaction-InvalidTokens-body": "Vos jetons PsiCash sont invalides. Essayez de redémarrer l’appli. Si cela ne suffit pas, vous devrez <a href=\"https://psiphon3.com/fr/faq.html#clear-windows-data\"> vider votre cache local.</a>.",
-      "psicash#transaction-ServerError-title": "Erreur du serveur PsiCash",
-      "psicash#transaction-ServerError-body": "Le serveur PsiCash a répondu par une erreur lors de la tentative d’achat. Veuillez réessayer votre achat plus tard.",
-      "psicash#ui-speedboost-active": "La Survitesse est active pendant %s",
-      "psicash#ui-zerobalance-title": "Avez-vous besoin de plus de vitesse ?",
-      "psicash#ui-buypsi": "Acheter du PsiCash",
-      "psicash#ui-buymorepsi": "Acheter plus de PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Requis pour la Survitesse",
-      "psicash#ui-enoughbalance-buttontext": "Lancer la Survitesse",
-      "psicash#1-hour": "1 heure",
-      "psicash#1-day": "1  jour",
-      "psicash#ui-buyingboost-buttontext": "Lancement de la Survitesse…",
-      "positive-value-indicator": "+ %d",
-      "psicash#mustconnect-modal#title": "La connexion à Psiphon est exigée",
-      "psicash#mustconnect-modal#body": "Afin utiliser le PsiCash, vous devez être connecté au réseau Psiphon.",
-      "psicash#init-error-title": "Erreur d’initialisation PsiCash",
-      "psicash#init-error-body-unrecovered": "L’initialisation de PsiCash a échoué. Cela est probablement causé par un problème du système de fichiers, tel qu’un manque d’espace disque. Vos solde et autre état sont perdus. PsiCash sera inutilisable. Vous pouvez tenter de redémarrer l’appli pour régler ce problème.",
-      "psicash#init-error-body-recovered": "L’initialisation de PsiCash a échoué. Cela est probablement causé par un problème du système de fichiers, tel qu’un manque d’espace disque. Vos solde et autre état sont réinitialisés.",
-      "psicash#psiphon-speed": "Vitesse<br>Psiphon",
-      "notice#disallowed-traffic-alert-title": "Surclassez votre connexion Psiphon",
-      "notice#disallowed-traffic-alert-body": "<p>Les applis ne fonctionnent-elles pas ?</p>\n<p>Une partie du trafic Internet n’est pas prise en charge sans une Survitesse active. Activez la Survitesse avec du PsiCash afin de libérer le plein potentiel de votre expérience Psiphon.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Les applis ne fonctionnent-elles pas ?",
-      "appbackend#disallowed-traffic-notification-body": "Activez la Survitesse afin de libérer le plein potentiel de votre expérience Psiphon.",
-      "settings#disallowed-traffic-alert#heading": "Alerte de trafic refusé",
-      "settings#disallowed-traffic-alert#help-text": "Certains types de trafic Internet ne sont pas pris en charge sans une Survitesse active. Quand un tel trafic est refusé, une alerte est affichée. (La réactivation demandera une reconnexion.)",
-      "settings#disallowed-traffic-alert#disable-label": "Désactiver les alertes de trafic refusé",
-      "banner#sponsored-by": "Commandité par"
-    }
-  },
-  "hi": {
-    "name": "हिन्दी",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "कनेक्ट",
-      "nav#connection#connected": "जुड़े हुए",
-      "nav#connection#stopping": "डिस्कनेक्ट कर रहा है",
-      "nav#connection#stopped": "डिस्कनेक्ट किया गया",
-      "nav#settings": "सेटिंग्स",
-      "nav#feedback": "प्रतिक्रिया",
-      "nav#logs": "लॉग्स",
-      "nav#about": "बारे में",
-      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
-      "connection#stop-btn": "रुकें",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
-      "connection#disconnect-btn": "Disconnect",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Please wait…",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "जोड़ें",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
-      "settings#reset-button": "Reset to Default",
-      "settings#apply-button": "Apply Changes",
-      "settings#unapplied-changes-prompt#title": "Settings Changed",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "लागू करें ",
-      "settings#unapplied-changes-prompt#discard-button": "रद्द करें ",
-      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon Server Region",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "अमेरिका",
-      "settings#egress-region#select-ca": "कनाडा",
-      "settings#egress-region#select-gb": "यूनाइटेड किंगडम",
-      "settings#egress-region#select-jp": "जापान",
-      "settings#egress-region#select-sg": "सिंगापुर",
-      "settings#egress-region#select-sk": "स्लोवाकिया",
-      "settings#egress-region#select-nl": "नीदरलैंड",
-      "settings#egress-region#select-de": "जर्मनी",
-      "settings#egress-region#select-in": "भारत",
-      "settings#egress-region#select-es": "स्पेन",
-      "settings#egress-region#select-hk": "हाँग काँग",
-      "settings#egress-region#select-at": "ऑस्ट्रिया",
-      "settings#egress-region#select-be": "बेल्जियम",
-      "settings#egress-region#select-bg": "बुल्गारिया",
-      "settings#egress-region#select-ch": "स्विजरलैंड",
-      "settings#egress-region#select-cz": "चेक गणराज्य",
-      "settings#egress-region#select-dk": "डेनमार्क",
-      "settings#egress-region#select-fr": "फ्रांस",
-      "settings#egress-region#select-hu": "हंगरी",
-      "settings#egress-region#select-it": "इटली",
-      "settings#egress-region#select-no": "नॉर्वे",
-      "settings#egress-region#select-ro": "रोमानिया",
-      "settings#egress-region#select-se": "स्वीडन",
-      "settings#egress-region#select-pl": "पोलैंड",
-      "settings#egress-region#select-rs": "सर्बिआ",
-      "settings#egress-region#select-au": "ऑस्ट्रेलिया",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
-      "settings#egress-region#error-modal-title": "Server Region Unavailable",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Must be between 1 and 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Username",
-      "settings#upstream-proxy#password-label": "पासवर्ड",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Transport Mode",
-      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Settings saved.",
-      "settings#error-modal#title": "Settings Error",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "हमें अपनी प्रतिक्रिया दें",
-      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "साइफॉन जिस तरह से मैं चाहता हूं उसे जोड़ता है और करता है",
-      "feedback#smiley_sad": "Psiphon अक्सर कनेक्ट करने में विफल रहता है या अच्छा प्रदर्शन नहीं करता।",
-      "feedback#text_feedback_prompt": "Please enter your comments here:",
-      "feedback#text_feedback_email_prompt": "If you would like us to respond to you, please enter your email address:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "जमा करें",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Thank you!</strong> Your feedback has been sent.",
-      "logs#show-debug-label": "Show debug logs",
-      "logs#placeholder": "No logs yet",
-      "language#success-message": "<strong>Hello!</strong> Welcome to Psiphon.",
-      "about#wordart-tag": "सीमाओं के पार",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon for Windows client version:",
-      "general#modal-close-button": "बंद करे",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon is disconnected",
-      "appbackend#state-starting-title": "Psiphon is connecting",
-      "appbackend#state-starting-body": "Please wait…",
-      "appbackend#state-connected-title": "Psiphon is connected",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 घंटा",
-      "psicash#1-day": "1 दिन",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponsored by"
-    }
-  },
-  "hr": {
-    "name": "Hrvatski",
-    "translation": {
-      "banner#long-connecting": "<strong>O ne!</strong> Čini se da imate problema sa spajanjem!<br>\nPreuzmite najnoviju verziju Psiphona sa <a class=\"NewVersionURL\" href=\"#\">stranice za preuzimanje</a>\nili pošaljite email na <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Spajanje",
-      "nav#connection#connected": "Spojeno",
-      "nav#connection#stopping": "Odspajanje",
-      "nav#connection#stopped": "Odspojeno",
-      "nav#settings": "Postavke",
-      "nav#feedback": "Povratne informacije",
-      "nav#logs": "Zapisi",
-      "nav#about": "O Psiphonu",
-      "connection#starting-msg": "Psiphon se <span class=\"state-word\">spaja</span>…",
-      "connection#stop-btn": "Stop",
-      "connection#connected-msg": "Psiphon je <span class=\"state-word\">spojen</span>",
-      "connection#disconnect-btn": "Odspoji",
-      "connection#stopping-msg": "Psiphon se <span class=\"state-word\">odspaja</span>…",
-      "connection#wait-btn": "Molimo pričekajte...",
-      "connection#stopped-msg": "Psiphon je <span class=\"state-word\">odspojen</span>",
-      "connection#connect-btn": "Spoji",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Greška!</strong> Molimo Vas ispravite netočne vrijednosti prije nego što nastavite.",
-      "settings#reset-button": "Ponovno postavi na zadano",
-      "settings#apply-button": "Primjeni promjene",
-      "settings#unapplied-changes-prompt#title": "Postavke promijenjene",
-      "settings#unapplied-changes-prompt#body": "Promijenili ste svoje postavke, ali ih niste primjenili.<br><br>Želite li primjeniti svoje promjene sad ili ih želite odbaciti?",
-      "settings#unapplied-changes-prompt#apply-button": "Primjeni",
-      "settings#unapplied-changes-prompt#discard-button": "Odbaci",
-      "settings#vpn-incompatible-msg": "(Ne radi u L2TP/IPSec načinu rada.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Podijeli tunel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Ne proxyaj stranice unutar države",
-      "settings#disable-timeouts#heading": "Onemogući pauze za spore mreže",
-      "settings#disable-timeouts#help-text": "Ako je ovo omgućeno, komunikacija sa Psiphon poslužiteljem neće pauzirati.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Onemogući pauze za spore mreže",
-      "settings#egress-region#heading": "Regija Psiphon poslužitelja",
-      "settings#egress-region#select-best-performance": "Najbolje performanse",
-      "settings#egress-region#select-us": "Sjedinjenih Američkih Država",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Ujedinjenog Kraljevstva",
-      "settings#egress-region#select-jp": "Japana",
-      "settings#egress-region#select-sg": "Singapura",
-      "settings#egress-region#select-sk": "Slovačka",
-      "settings#egress-region#select-nl": "Nizozemske",
-      "settings#egress-region#select-de": "Njemačke",
-      "settings#egress-region#select-in": "Indija",
-      "settings#egress-region#select-es": "Španjolska",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austrija",
-      "settings#egress-region#select-be": "Belgija",
-      "settings#egress-region#select-bg": "Bugarska",
-      "settings#egress-region#select-ch": "Švicarska",
-      "settings#egress-region#select-cz": "Češka Republika",
-      "settings#egress-region#select-dk": "Danska",
-      "settings#egress-region#select-fr": "Francuska",
-      "settings#egress-region#select-hu": "Mađarska",
-      "settings#egress-region#select-it": "Italija",
-      "settings#egress-region#select-no": "Norveška",
-      "settings#egress-region#select-ro": "Rumunjska",
-      "settings#egress-region#select-se": "Švedska",
-      "settings#egress-region#select-pl": "Poljska",
-      "settings#egress-region#select-rs": "Srbija",
-      "settings#egress-region#select-au": "Australija",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Odaberite ispravnu regiju Psiphon poslužitelja.",
-      "settings#egress-region#error-modal-title": "Regija poslužitelja nedostupna",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Lokalni proxy portovi",
-      "settings#local-proxy-ports#leave-blank": "Ostavite <strong>prazno</strong> za automatski odabir porta (preporučeno).",
-      "settings#local-proxy-ports#reason": "Ako koristite alate na svom računalu koji zahtjevaju ručno konfiguriranje kako bi radili sa Psiphonom, želite da Psiphon konzistentno koristi iste brojeve lokalnih portova. Ako nema razloga specificirati brojeve portova, trebali bi dopustiti Psiphonu da ih odabere automatski kako bi izbjegli konflikte.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Mora biti između 1 i 65535",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Lokalni portovi moraju biti različiti jedni od drugih.",
-      "settings#local-proxy-ports#error-modal-title": "Konflikt portova lokalnog proxya",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nKonfigurirali ste Psiphon da koristi specifičan lokalni port za HTTP proxy.<br>\nKako bilo, čini se da se taj port već koristi tako da ga Psiphon ne može koristiti.\n</p>\n<p>\nMolimo promijenite konfiguriranu HTTP proxy port vrijednost i pokušajte ponovo. Preporučamo da očistiti tu vrijednost tako da Psiphon može automatski odabrati dostupan port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nKonfigurirali ste Psiphon da koristi specifičan lokalni port za SOCKS proxy.<br>\nKako bilo, čini se da se taj port već koristi tako da ga Psiphon ne može koristiti.\n</p>\n<p>\nMolimo promijenite konfiguriranu SOCKS proxy port vrijednost i pokušajte ponovo. Preporučamo da očistite tu vrijednost tako da Psiphon može automatski odabrati dostupan port.\n</p>",
-      "settings#upstream-proxy#heading": "Uzvodni proxy",
-      "settings#upstream-proxy#by-default": "Ako vaše računalo već ima konfiguriran proxy, Psiphon će pod zadano koristiti taj proxy kad uspostavlja tunel. Ovo ponašanje možete zaobići specificirajući proxy koji će se koristiti, ili specificirajući da se nijedan takav \"uzvodni proxy\" ne koristi.",
-      "settings#upstream-proxy#reason": "Uzvodni proxyi su nekad zahtjevani od strane škola, sveučilišta ili tvrtki. Ako znate postavke uzvodnog proxya zahtjevanog od strane Vašeg mrežnog davatelja, možda ćete ih morati ručno unijeti kako bi se spojili.",
-      "settings#upstream-proxy#proxy-reqs": "Samo HTTP proxyi koji podržavaju HTTPS su dopušteni.",
-      "settings#upstream-proxy#hostname-label": "Ime domaćina",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Korisničko ime",
-      "settings#upstream-proxy#password-label": "Lozinka",
-      "settings#upstream-proxy#domain-label": "Domena",
-      "settings#upstream-proxy#skip-label": "Ne koristi uzvodni proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Greška uzvodnog proxya",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon je trenutno konfiguriran da koristi proxy Vašeg sustava kao svoj \"uzvodni proxy\". <br>\nKako bilo, čini se da nismo u mogućnosti spojiti se sa Psiphon poslužiteljem kroz taj proxy.<br>\nMolimo Vas da omogućite \"Ne koristi uzvodni proxy\" i pokušate ponovno.",
-      "settings#upstream-proxy#error-modal-body-configured": "Konfigurirali ste Psiphon da koristi \"uzvodni proxy\".<br>\nKako bilo, čini se da nismo u mogućnosti spojiti se sa Psiphon poslužiteljem kroz taj proxy.<br>\nMolimo Vas da to popravite i pokušate ponovno.",
-      "settings#transport-mode#heading": "Transportni način rada",
-      "settings#transport-mode#check-label": "Koristi L2TP/IPSec način rada",
-      "settings#transport-mode#help-text": "Koristi Windows L2TP/IPSec virtualno umrežavanje. Ovaj način rada će tunelirati sve Vaše aplikacije, ali ne pruža skrivanje i samim time nema snažne mogućnosti obilaženja cenzure. <strong>Nije preporučeno</strong> za obilaženje većine vatrozida.",
-      "settings#systray-minimize#heading": "Smanji u područja obavijesti (traka zadataka)",
-      "settings#systray-minimize#help-text": "Ako je ovo omogućeno, smanjivanjem prozora Psiphona, aplikacija će se sakriti u područje obavijesti (također poznato kao traka zadataka, smješteno blizu sata).",
-      "settings#systray-minimize#reason": "Minimaliziranje Psiphona u obavijesni prostor (sistemska ploča) oslobađa prostor na Vašoj traci zadataka. Ovo je naročito korisno ako često koristite Psiphon u dužim periodima.",
-      "settings#systray-minimize#enable-label": "Smanji u područja obavijesti (traka zadataka)",
-      "settings#applying-message": "Ponovno spajam kako bi primjenio Vaše postavke.",
-      "settings#saved-message": "Postavke spremljene.",
-      "settings#error-modal#title": "Pogreška postavki",
-      "settings#error-modal#body": "Postoje pogreške u vrijednostima Vaših postavki. Molimo, ispravite ih prije nastavljanja.",
-      "feedback#top_content_title": "Dajte nam povratnu informaciju",
-      "feedback#top_para_2": "Mnogi problemi mogu biti riješeni preuzimanjem najnovije verzije. Možete <a class=\"NewVersionURL\" href=\"#\">preuzeti novu verziju ovdje</a>, ili nam možete poslati email na <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Također možete naći riješenja za mnoge učestale probleme među našim <a class=\"FaqURL\" href=\"#\">često postavljenim pitanjima</a>.",
-      "feedback#smiley_happy": "Psiphon se spaja i radi onako kako to i želim.",
-      "feedback#smiley_sad": "Psiphon se često ne uspijeva spojiti ili ne radi dovoljno dobro.",
-      "feedback#text_feedback_prompt": "Molimo unesite svoje komentare ovdje:",
-      "feedback#text_feedback_email_prompt": "Ako želite da Vam odgovorimo, unesite svoju email adresu:",
-      "feedback#diagnostic_check": "Postavite dijagnostičke podatke. Ovi dijagnostički podatci Vas ne identificiraju, a nama će pomoći da održimo Psiphonov rad glatkim. <a class=\"DataCollectionInfoURL\" href=\"#\">Kliknite ovdje kako bi vidjeli koje podatke prikupljamo.</a>",
-      "feedback#submit_button": "Podnesi",
-      "feedback#text_feedback_bottom_para": "Ako gornji predložak ne radi, ili želite poslati slike ekrana, pošaljite nam email na <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>. ",
-      "feedback#success-message": "<strong>Hvala Vam!</strong> Vaše povratne informacije su poslane.",
-      "logs#show-debug-label": "Prikaži zapise o otklanjanju pogreški",
-      "logs#placeholder": "Još nema zapisa",
-      "language#success-message": "<strong>Bok!</strong> Dobro došli u Psiphon.",
-      "about#wordart-tag": "Izvan granica",
-      "about#description": "Psiphon je <strong>alat za obilaženje cenzure</strong> - dizajniran je da pruži pristup otvorenom Internetu, mimo cenzura i vatrozida. <strong>Otvoren je</strong> i razvija se u Torontu, Kanada.",
-      "about#visit-download-site": "Molimo Vas da posjetite stranicu kako bi <strong><a class=\"NewVersionURL\" href=\"#\">preuzeli novu verziju</a></strong> ili kako bi <strong><a class=\"InfoURL\" href=\"#\">dobili pomoć i informacije</a></strong>. Psiphon je dostupan za Android i Windows.",
-      "about#get-by-email": "<strong>Ako je stranica nedostupna</strong>, možete dobiti novu verziju Psiphona slanjem emaila na:",
-      "about#client-version": "Psiphon za Windows verzija klijenta:",
-      "general#modal-close-button": "Zatvori",
-      "general#notice-modal-tech-preamble": "Informacije o tehničkoj pogrešci:",
-      "notice#systemproxysettings-setproxy-error-title": "Pogreška proxya sustava",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon nije uspio postaviti postavke proxya sustava.</p>\n<p>To bi moglo biti zbog konflikta s Vašim antivirusnim softare-om. Možda ćete morati ručno postaviti aplikaciju ili postavke proxya sustava da koriste lokalne Psiphon proxye.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon nije uspio postaviti postavke proxya sustava za Internet vezu \"<%- data %>\". To bi moglo biti zbog konflikta s Vašim antivirusnim softwareom. Možda ćete morati ručno postaviti aplikaciju ili postavke proxya sustava da koriste lokalne Psiphon proxye.",
-      "appbackend#state-stopped-title": "Psiphon nije spojen",
-      "appbackend#state-starting-title": "Psiphon se spaja",
-      "appbackend#state-starting-body": "Molimo pričekajte...",
-      "appbackend#state-connected-title": "Psiphon je spojen",
-      "appbackend#state-connected-body": "Istražite van svojih granica!",
-      "appbackend#state-connected-reminder-title": "Psiphon Vas drži spojene",
-      "appbackend#state-connected-reminder-body": "Nek Psiphon ostane besplatan. Kliknite ovdje kako bi posjetili stranice naših sponzora!",
-      "appbackend#state-connected-reminder-body-2": "Održite Psiphon besplatnim posjećivanjem stranica naših sponzora!",
-      "appbackend#minimized-to-systray-title": "Psiphon je smanjen u područje obavijesti",
-      "appbackend#minimized-to-systray-body": "Kliknite ikonu da bi ponovno otvorili aplikaciju",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 sat",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponzorira"
-    }
-  },
-  "id": {
-    "name": "Bahasa Indonesia",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh, tidak!</strong> Sepertinya Anda mengalami masalah sambungan!<br>\nUnduh versi terbaru Psiphon <a class=\"NewVersionURL\" href=\"#\">di sini</a>\natau dengan mengirim surel ke <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Menyambung",
-      "nav#connection#connected": "Tersambung",
-      "nav#connection#stopping": "Memutus sambungan",
-      "nav#connection#stopped": "Tidak tersambung",
-      "nav#settings": "Setelan",
-      "nav#feedback": "Kritik dan Saran",
-      "nav#logs": "Catatan",
-      "nav#about": "Tentang",
-      "connection#starting-msg": "Psiphon sedang <span class=\"state-word\">menyambung</span>…",
-      "connection#stop-btn": "Hentikan",
-      "connection#connected-msg": "Psiphon telah <span class=\"state-word\">tersambung</span>",
-      "connection#disconnect-btn": "Putus sambungan",
-      "connection#stopping-msg": "Psiphon sedang <span class=\"state-word\">memutus sambungan</span>…",
-      "connection#wait-btn": "Silakan tunggu...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">tidak tersambung</span>",
-      "connection#connect-btn": "Sambungkan",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Galat!</strong> Ubah parameter yang salah sebelum melanjutkan.",
-      "settings#reset-button": "Kembalikan ke Awal",
-      "settings#apply-button": "Terapkan Perubahan",
-      "settings#unapplied-changes-prompt#title": "Setelan Diubah",
-      "settings#unapplied-changes-prompt#body": "Anda telah mengubah setelan, tetapi belum menerapkannya.<br><br>Apakah Anda ingin menerapkan atau membatalkannya?",
-      "settings#unapplied-changes-prompt#apply-button": "Terapkan",
-      "settings#unapplied-changes-prompt#discard-button": "Batalkan",
-      "settings#vpn-incompatible-msg": "(Tidak berfungsi dengan mode L2TP/IPSec)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Terowongan Terpisah",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Jangan alihkan situs web dalam negeri Anda ke proksi",
-      "settings#disable-timeouts#heading": "Menonaktifkan Timeout untuk Jaringan Lambat",
-      "settings#disable-timeouts#help-text": "Jika diaktifkan, komunikasi dengan server Psiphon tidak akan berhenti karena batasan waktu.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Nonaktifkan batasan waktu (timeout) untuk jaringan lambat",
-      "settings#egress-region#heading": "Wilayah Peladen Psiphon",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "Amerika Serikat",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Inggris",
-      "settings#egress-region#select-jp": "Jepang",
-      "settings#egress-region#select-sg": "Singapura",
-      "settings#egress-region#select-sk": "Slowakia",
-      "settings#egress-region#select-nl": "Belanda",
-      "settings#egress-region#select-de": "Jerman",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spanyol",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Belgia",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Swiss",
-      "settings#egress-region#select-cz": "Republik Ceko",
-      "settings#egress-region#select-dk": "Denmark",
-      "settings#egress-region#select-fr": "Perancis",
-      "settings#egress-region#select-hu": "Hungaria",
-      "settings#egress-region#select-it": "Italia",
-      "settings#egress-region#select-no": "Norwegia",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Swedia",
-      "settings#egress-region#select-pl": "Polandia",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Pilih wilayah peladen Psiphon yang berlaku.",
-      "settings#egress-region#error-modal-title": "Wilayah Peladen Tak Tersedia",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Port Proksi Lokal",
-      "settings#local-proxy-ports#leave-blank": "<strong>Kosongkan</strong> untuk memilih port secara otomatis (dianjurkan).",
-      "settings#local-proxy-ports#reason": "JIka Anda menggunakan aplikasi di komputer yang memerlukan konfigurasi manual agar bisa berfungsi dengan Psiphon, Anda harus mengatur Psiphon agar menggunakan nomor port lokal yang sama secara konsisten. Jika Anda tidak harus menentukan nomor port, izinkan Psiphon untuk memilihnya secara otomatis agar tidak terjadi konflik.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Harus diisi antara 1 sampai 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Port lokal harus berbeda satu sama lain.",
-      "settings#local-proxy-ports#error-modal-title": "Konflik Port Proksi Lokal",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nAnda telah mengatur Psiphon agar menggunakan port lokal tertentu sebagai proksi HTTP.<br>\nAkan tetapi, port itu sepertinya telah terpakai sehingga Psiphon tidak dapat menggunakannya.\n</p>\n<p>\nHarap ubah parameter port proksi HTTP Anda, lalu coba lagi. Kami anjurkan agar Anda mengosongkannya saja sehingga Psiphon bisa memilih port yang lowong secara otomatis.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nAnda telah mengatur Psiphon agar menggunakan port lokal tertentu sebagai proksi SOCKS.<br>\nAkan tetapi, port itu sepertinya telah terpakai sehingga Psiphon tidak dapat menggunakannya.\n</p>\n<p>\nHarap ubah parameter port SOCKS Anda, lalu coba lagi. Kami anjurkan agar Anda mengosongkannya saja sehingga Psiphon bisa memilih port yang lowong secara otomatis.\n</p>",
-      "settings#upstream-proxy#heading": "Proksi Hulu (Upstream)",
-      "settings#upstream-proxy#by-default": "Jika proksi di komputer Anda telah dikonfigurasi, Psiphon secara standar akan menggunakan proksi tersebut saat membuat terowongan. Anda boleh tidak mematuhi konfigurasi tersebut dengan menentukan proksi yang digunakan atau menyatakan agar tidak menggunakan \"proksi hulu\" seperti itu.",
-      "settings#upstream-proxy#reason": "Penggunaan proksi hulu biasanya diwajibkan oleh sekolah, universitas, atau perusahaan. Jika penyedia jaringan Anda memberi setelan proksi hulu, mengaturnya di sini secara manual mungkin perlu dilakukan agar dapat tersambung.",
-      "settings#upstream-proxy#proxy-reqs": "Hanya proksi HTTP yang mendukung HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Nama host",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Nama Pengguna",
-      "settings#upstream-proxy#password-label": "Kata sandi",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Jangan gunakan proksi hulu",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Galat Proksi Hulu",
-      "settings#upstream-proxy#error-modal-body-default": "Saat ini Psiphon disetel untuk menggunakan proksi sistem Anda sebagai \"proksi hulu\".<br>\nAkan tetapi, sepertinya kami tidak dapat tersambung ke server Psiphon melalui proksi tersebut.<br>\nHarap aktifkan “Jangan gunakan proksi hulu”, lalu coba lagi.",
-      "settings#upstream-proxy#error-modal-body-configured": "Anda telah menyetel Psiphon agar menggunakan “proksi hulu”.<br>\nAkan tetapi, sepertinya kami tidak dapat tersambung ke server Psiphon lewat proksi itu.<br>\nHarap benahi dulu setelannya, lalu coba lagi.",
-      "settings#transport-mode#heading": "Modus Transpor",
-      "settings#transport-mode#check-label": "Gunakan modus L2TP/IPSec",
-      "settings#transport-mode#help-text": "Menggunakan jaringan virtual L2TP/IPSec Windows. Modus ini akan mengalihkan lalu lintas internet semua aplikasi Anda, tetapi tidak dilengkapi pengacak sehingga tidak memiliki kemampuan penembusan sensor yang tangguh. Ini <strong>tidak dianjurkan</strong> untuk menerobos sebagian besar firewall.",
-      "settings#systray-minimize#heading": "Kecilkan ke Area Notifikasi (Baki Sistem)",
-      "settings#systray-minimize#help-text": "Jika diaktifkan, jendela aplikasi Psiphon saat dikecilkan akan disembunyikan di area notifikasi (juga dikenal sebagai \"baki sistem\" atau \"systray\", terletak di dekat jam di bilah tugas Windows Anda).",
-      "settings#systray-minimize#reason": "Meminimalkan Psiphon ke area notifikasi (\"baki sistem\") membebaskan ruang di bilah tugas Anda. Hal ini sangat membantu jika Anda sering menggunakan Psiphon untuk waktu yang lama.",
-      "settings#systray-minimize#enable-label": "Kecilkan ke area notifikasi (baki sistem)",
-      "settings#applying-message": "Menyambungkan ulang untuk menerapkan setelan Anda.",
-      "settings#saved-message": "Setelan tersimpan.",
-      "settings#error-modal#title": "Galat Setelan",
-      "settings#error-modal#body": "Ada kesalahan pada parameter setelan Anda. Benahi dulu sebelum melanjutkan.",
-      "feedback#top_content_title": "Beri Kami Kritik dan Saran",
-      "feedback#top_para_2": "Ada banyak masalah yang terselesaikan dengan mengunduh versi terbaru. Silakan <a class=\"NewVersionURL\" href=\"#\">klik di sini untuk mengunduh versi terbaru</a>, atau kirim email ke <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Temukan juga solusi masalah-masalah umum di daftar <a class=\"FaqURL\" href=\"#\">Tanya-Jawab</a> kami.",
-      "feedback#smiley_happy": "Psiphon tersambung dan berfungsi sesuai keinginan saya.",
-      "feedback#smiley_sad": "Psiphon seringkali gagal menyambung atau tidak berfungsi cukup baik.",
-      "feedback#text_feedback_prompt": "Berikan komentar Anda di sini:",
-      "feedback#text_feedback_email_prompt": "Jika Anda ingin kami membalas pesan Anda, silakan masukkan alamat surel Anda:",
-      "feedback#diagnostic_check": "Unggah data diagnostik. Perlu dicatat bahwa data diagnostik ini tidak bersifat mengenali pribadi Anda dan akan membantu kami melancarkan kinerja Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Klik di sini untuk melihat data yang kami kumpulkan</a>.",
-      "feedback#submit_button": "Kirim",
-      "feedback#text_feedback_bottom_para": "Jika formulir tidak berfungsi atau Anda ingin mengirim cuplikan layar, silakan kirim melalui surel ke <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Terima kasih!</strong> Kritik dan saran Anda telah terkirim.",
-      "logs#show-debug-label": "Tampilkan catatan awakutu (debug log)",
-      "logs#placeholder": "Belum ada catatan",
-      "language#success-message": "<strong>Halo!</strong> Selamat datang di Psiphon!",
-      "about#wordart-tag": "Melintas Batas",
-      "about#description": "Psiphon adalah <strong>aplikasi penembus sensor</strong> — Psiphon dirancang untuk menyediakan akses ke internet terbuka, menerobos sensor dan firewall. Aplikasi ini <strong>bersumber terbuka</strong> dan dikembangkan di Toronto, Kanada.",
-      "about#visit-download-site": "Silakan kunjungi situs web kami untuk <strong><a class=\"NewVersionURL\" href=\"#\">mengunduh versi terbaru</a></strong> atau <strong><a class=\"InfoURL\" href=\"#\">mencari bantuan dan informasi</a></strong>. Psiphon tersedia untuk Android dan Windows.",
-      "about#get-by-email": "<strong>Jika situs web tidak dapat diakses</strong>, Anda bisa mendapatkan versi baru Psiphon dengan mengirim surel ke:",
-      "about#client-version": "Versi aplikasi klien Psiphon untuk Windows:",
-      "general#modal-close-button": "Tutup",
-      "general#notice-modal-tech-preamble": "Berikut ini informasi galat teknisnya:",
-      "notice#systemproxysettings-setproxy-error-title": "Galat Proksi Sistem",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon gagal mengatur setelan proksi sistem.</p>\n<p>Hal ini mungkin terjadi karena ada konflik dengan antivirus Anda. Anda mungkin harus mengatur aplikasi atau setelan proksi sistem secara manual untuk menggunakan proksi lokal Psiphon.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon gagal mengatur setelan proksi sistem untuk sambungan internet “<%- data %>”. Hal ini mungkin terjadi karena ada konflik dengan antivirus Anda. Anda mungkin harus mengatur aplikasi atau setelan proksi sistem secara manual untuk menggunakan proksi lokal Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon tidak tersambung",
-      "appbackend#state-starting-title": "Psiphon sedang menyambung",
-      "appbackend#state-starting-body": "Silakan tunggu...",
-      "appbackend#state-connected-title": "Psiphon tersambung",
-      "appbackend#state-connected-body": "Jelajahi dunia di luar batasmu!",
-      "appbackend#state-connected-reminder-title": "Psiphon menjaga agar Anda tetap terkoneksi.",
-      "appbackend#state-connected-reminder-body": "Dukung agar Psiphon tetap gratis. Klik di sini untuk mengunjungi halaman sponsor kami!",
-      "appbackend#state-connected-reminder-body-2": "Dukung agar Psiphon tetap gratis dengan mengunjungi halaman sponsor kami! ",
-      "appbackend#minimized-to-systray-title": "Psiphon telah dikecilkan ke area notifikasi",
-      "appbackend#minimized-to-systray-body": "Klik ikon untuk memunculkan kembali aplikasi",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Saldo PsiCash tidak cukup",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Didukung oleh"
-    }
-  },
-  "it": {
-    "name": "Italiano",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong>\nSembra che tu abbia problemi di connessione!<br>\nScarica l'ultima versione di Psiphon dal <a class=\"NewVersionURL\" href=\"#\">sito download</a>\no inviando un'e-mail a <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Connessione in corso",
-      "nav#connection#connected": "Connesso",
-      "nav#connection#stopping": "Disconnessione",
-      "nav#connection#stopped": "Disconnesso",
-      "nav#settings": "Impostazioni",
-      "nav#feedback": "Feedback",
-      "nav#logs": "Log",
-      "nav#about": "Informazioni",
-      "connection#starting-msg": "Psiphon in <span class=\"state-word\">connessione</span>...",
-      "connection#stop-btn": "Stop",
-      "connection#connected-msg": "Psiphon è <span class=\"state-word\">connesso</span>",
-      "connection#disconnect-btn": "Disconnetti",
-      "connection#stopping-msg": "Psiphon in <span class=\"state-word\">disconnessione</span>…",
-      "connection#wait-btn": "Attendere…",
-      "connection#stopped-msg": "Psiphon è <span class=\"state-word\">disconnesso</span>",
-      "connection#connect-btn": "Connessione",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Errore!</strong> Correggere i valori errati prima di procedere.",
-      "settings#reset-button": "Ripristina configurazione predefinita",
-      "settings#apply-button": "Applica modifiche",
-      "settings#unapplied-changes-prompt#title": "Impostazioni modificate",
-      "settings#unapplied-changes-prompt#body": "Hai apportato modifiche alle tue impostazioni, ma non le hai applicate.<br><br> Desideri applicare le modifiche?",
-      "settings#unapplied-changes-prompt#apply-button": "Applica",
-      "settings#unapplied-changes-prompt#discard-button": "Elimina",
-      "settings#vpn-incompatible-msg": "(Non funziona in modalità L2TP/IPSec.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "Se abilitato, le richieste inoltrate ai server della tuo paese, non saranno gestite da Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Non usare proxy per i siti del tuo paese",
-      "settings#disable-timeouts#heading": "Disattiva timeout per reti lente",
-      "settings#disable-timeouts#help-text": "Se abilitato, la comunicazione con il server Psiphon non terminerà.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disattiva timeout per reti lente",
-      "settings#egress-region#heading": "Regione Server Psiphon",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "Stati Uniti",
-      "settings#egress-region#select-ca": "Canada",
-      "settings#egress-region#select-gb": "Regno Unito",
-      "settings#egress-region#select-jp": "Giappone",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovacchia",
-      "settings#egress-region#select-nl": "Olanda",
-      "settings#egress-region#select-de": "Germania",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spagna",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Belgio",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Svizzera",
-      "settings#egress-region#select-cz": "Repubblica Ceca",
-      "settings#egress-region#select-dk": "Danimarca",
-      "settings#egress-region#select-fr": "Francia",
-      "settings#egress-region#select-hu": "Ungheria",
-      "settings#egress-region#select-it": "Italia",
-      "settings#egress-region#select-no": "Norvegia",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Svezia",
-      "settings#egress-region#select-pl": "Polonia",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Scegli una Regione Server Psiphon valida.",
-      "settings#egress-region#error-modal-title": "Regione Server non disponibile",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Porte Proxy Locale",
-      "settings#local-proxy-ports#leave-blank": "Lasciare in <strong>bianco</strong> per selezione automatica delle porte (raccomandato).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Dev'essere compreso fra 1 e 65535",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Proxy di transito",
-      "settings#upstream-proxy#by-default": "Se il tuo computer ha un proxy configurato, di norma Psiphon utilizza quel proxy per connettere i tunnel. Puoi cambiare questo comportamento specificando un proxy diverso, o specificando di non utilizzare il proxy configurato.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "Nome host",
-      "settings#upstream-proxy#port-label": "Porta",
-      "settings#upstream-proxy#username-label": "Nome utente",
-      "settings#upstream-proxy#password-label": "Password",
-      "settings#upstream-proxy#domain-label": "Dominio",
-      "settings#upstream-proxy#skip-label": "Non usare il proxy di transito",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Tipo VPN",
-      "settings#transport-mode#check-label": "Usa L2TP/IPSec",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Impostazioni salvate.",
-      "settings#error-modal#title": "Errore nelle impostazioni",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "Inviaci il Tuo Feedback",
-      "feedback#top_para_2": "Molti problemi sono risolvibili aggiornando all'ultima versione.  Puoi <a class=\"NewVersionURL\" href=\"#\">ottenere l'ultima versione cliccando qui</a>, oppure inviando un'email a <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Inoltre è possibile trovare soluzioni a problemi comuni nelle nostre <a class=\"FaqURL\" href=\"#\">Domande Frequenti</a>.",
-      "feedback#smiley_happy": "Psiphon si collega e opera correttamente.",
-      "feedback#smiley_sad": "Psiphon spesso non si connette o non funziona abbastanza bene.",
-      "feedback#text_feedback_prompt": "Inserisci i tuoi commenti quì:",
-      "feedback#text_feedback_email_prompt": "Se desideri una risposta, inserisci il tuo indirizzo email:",
-      "feedback#diagnostic_check": "Caricare dati diagnostici. Si osservi che questi dati diagnostici non identificano l'utente e ci aiuteranno a garantire il corretto funzionamento di Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Clicca qui per vedere i dati raccolti</a>.",
-      "feedback#submit_button": "Invia",
-      "feedback#text_feedback_bottom_para": "Se il modulo precedente non funziona, o vuoi trasmettere degli screenshot, inviaci un'e-mail all'indirizzo <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Grazie!</strong> Il tuo feedback è stato inviato.",
-      "logs#show-debug-label": "Mostra registrazioni di debug",
-      "logs#placeholder": "Nessuna registrazione ancora",
-      "language#success-message": "<strong>Salve!</strong> Benvenuto su Psiphon.",
-      "about#wordart-tag": "Oltre i Confini",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon per Windows versione client:",
-      "general#modal-close-button": "Chiudi",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "Errore del proxy di sistema",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon è disconnesso",
-      "appbackend#state-starting-title": "Psiphon stà connettendosi",
-      "appbackend#state-starting-body": "Attendere…",
-      "appbackend#state-connected-title": "Psiphon è connesso",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 ora",
-      "psicash#1-day": "1 giorno",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponsorizzato da"
-    }
-  },
-  "kk": {
-    "name": "қазақ тілі",
-    "translation": {
-      "banner#long-connecting": "<strong>Қап!</strong> Қосылымда қиындық туындаған сияқты!<br>\nPsiphon қолданбасының соңғы нұсқасын <a class=\"NewVersionURL\" href=\"#\">жүктеп алу сайтынан</a> немесе\n<a class=\"NewVersionEmail\" href=\"#\"></a> мекенжайына  хат жіберу арқылы жүктеп алуға болады.",
-      "nav#connection#starting": "Қосылуда",
-      "nav#connection#connected": "Қосылулы",
-      "nav#connection#stopping": "Қосылым ажырауда",
-      "nav#connection#stopped": "Қосылым үзілді",
-      "nav#settings": "Параметрлер",
-      "nav#feedback": "Кері байланыс",
-      "nav#logs": "Журналдар",
-      "nav#about": "Осы туралы",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">қосылым жасауда</span>…",
-      "connection#stop-btn": "Тоқтату",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">қосылулы</span>",
-      "connection#disconnect-btn": "Қосылымды үзу",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">қосылымды үзуде</span>…",
-      "connection#wait-btn": "Күте тұрыңыз…",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">қосылымды үзді</span>",
-      "connection#connect-btn": "Қосылу ",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Қате!</strong> Жалғастыру алдында дұрыс емес мәндерді түзетіңіз.",
-      "settings#reset-button": "Әдепкі мәндерді қайтару",
-      "settings#apply-button": "Өзгерістерді қолдану",
-      "settings#unapplied-changes-prompt#title": "Параметрлер  өзгерді",
-      "settings#unapplied-changes-prompt#body": "Сіз параметрлерді  өзгерттіңіз, бірақ оларды сақтаған жоқсыз. <br><br>Өзгерістерді қазір қолдануды немесе жоюды қалайсыз ба?",
-      "settings#unapplied-changes-prompt#apply-button": "Қолдану",
-      "settings#unapplied-changes-prompt#discard-button": "Жою",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec режимімен жұмыс істемейді).",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Бөлінген туннель",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Сіздің еліңіздегі веб-сайттар үшін проксиді қолданбау",
-      "settings#disable-timeouts#heading": "Баяу желілердің таймауттарын ажырату",
-      "settings#disable-timeouts#help-text": "Іске қосылған болса, Psiphon серверімен байланыстың уақыты бітпейді.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Баяу желілер үшін таймауттарды ажырату",
-      "settings#egress-region#heading": "Psiphon сервері аймағы",
-      "settings#egress-region#select-best-performance": "Үздік жұмысы",
-      "settings#egress-region#select-us": "АҚШ",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Ұлыбритания",
-      "settings#egress-region#select-jp": "Жапония",
-      "settings#egress-region#select-sg": "Сингапур",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Голландия",
-      "settings#egress-region#select-de": "Германия",
-      "settings#egress-region#select-in": "Үндістан",
-      "settings#egress-region#select-es": "Испания",
-      "settings#egress-region#select-hk": "Гонконг",
-      "settings#egress-region#select-at": "Аустрия",
-      "settings#egress-region#select-be": "Бельгия",
-      "settings#egress-region#select-bg": "Болгария",
-      "settings#egress-region#select-ch": "Швейцария",
-      "settings#egress-region#select-cz": "Чехия",
-      "settings#egress-region#select-dk": "Дания",
-      "settings#egress-region#select-fr": "Франция",
-      "settings#egress-region#select-hu": "Венгрия",
-      "settings#egress-region#select-it": "Италия",
-      "settings#egress-region#select-no": "Норвегия",
-      "settings#egress-region#select-ro": "Румыния",
-      "settings#egress-region#select-se": "Швеция",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Psiphon серверінің жарамды аймағын таңдаңыз.",
-      "settings#egress-region#error-modal-title": "Сервер аймағы қолжетімді емес",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Жергілікті прокси порттары",
-      "settings#local-proxy-ports#leave-blank": "Порттарды автоматты түрде таңдау үшін <strong>бос</strong> қалдырыңыз (ұсынылады).",
-      "settings#local-proxy-ports#reason": "Егер сіз компьютерде Psiphon қолданбасымен жұмыс істеу үшін қолмен баптауды талап ететін құралдарды пайдалансаңыз, Psiphon қолданбасының белгілі бір жергілікті порттарды пайдалануы керек болады. Егер жергілікті порттар санын көрсету керек болмаса, қайшылыққа жол бермеу үшін Psiphon қолданбасының оларды автоматты түрде таңдауына рұқсат ету керек.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 және 65535 арасында болуы тиіс.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Жергілікті порттар бір-бірінен бөлек болуы тиіс.",
-      "settings#local-proxy-ports#error-modal-title": "Жергілікті прокси порттар қайшылығы",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon қолданбасын оның HTTP проксиі үшін арнайы жергілікті портты пайдаланатын етіп баптағансыз.<br>\nАлайда, ол порт қазір пайдаланылуда, сондықтан Psiphon оны пайдалана алмайды.\n</p>\n<p>\nБапталған HTTP прокси портының мәтінін өзгертіп, қайталап көріңіз. Бұл мәнді өшіруді ұсынамыз, сол кезде Psiphon қолданыста бар портты автоматты түрде таңдайды.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon қолданбасын оның SOCKS проксиі үшін арнайы жергілікті портты пайдаланатын етіп баптағансыз.<br>\nАлайда, ол порт қазір пайдаланылуда, сондықтан Psiphon оны пайдалана алмайды.\n</p>\n<p>\nБапталған SOCKS прокси портының мәнін өзгертіп, қайталап көріңіз. Бұл мәнді өшіруді ұсынамыз, сол кезде Psiphon қолданыстағы портты автоматты түрде таңдайды.\n</p>",
-      "settings#upstream-proxy#heading": "Сыртқы прокси",
-      "settings#upstream-proxy#by-default": "Компьютеріңізде бапталған прокси болса, әдепкі бойынша Psiphon туннельді орнату кезінде сол проксиді қолданады. Пайдаланылатын проксиді көрсету  немесе осындай \"сыртқы прокси\" қолдану керек емес екенін көрсету арқылы осындай әрекетінен бас тартуға  болады.",
-      "settings#upstream-proxy#reason": "Сыртқы проксилерді кейде мектептер, университеттер мен кәсіпорындар пайдаланады. Егер желілік провайдер сыртқы прокси параметрлерін берген болса, қосылым орнату үшін оларды осы жерде қолдан орнату керек болуы мүмкін.",
-      "settings#upstream-proxy#proxy-reqs": "Тек HTTPS протоколын қолдайтын HTTP проксилеріне рұқсат етіледі.",
-      "settings#upstream-proxy#hostname-label": "Хост атауы",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Пайдаланушы аты",
-      "settings#upstream-proxy#password-label": "Құпиясөз",
-      "settings#upstream-proxy#domain-label": "Домен",
-      "settings#upstream-proxy#skip-label": "Сыртқы проксиді қолданбау",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Сыртқы прокси қатесі",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon қазір жүйелік проксиді “сыртқы прокси” ретінде қолдануға бапталған.<br>\nАлайда, сол прокси арқылы біз Psiphon серверіне қосылым орната алмайтын сияқтымыз.<br>\n“Сыртқы проксиді қолданбау” функциясын іске қосып, қайталап көріңіз.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon қолданбасын “сыртқы проксиді” пайдаланатын етіп баптағансыз.<br>\nАлайда, сол прокси арқылы біз Psiphon серверіне қосылым орната алмайтын сияқтымыз.<br>\nПараметрлерді түзетіп, қайталап көріңіз.",
-      "settings#transport-mode#heading": "Тасымалдау режимі",
-      "settings#transport-mode#check-label": "L2TP/IPSec режимін қолдану",
-      "settings#transport-mode#help-text": "Windows жүйесінің L2TP/IPSec виртуалды желісін қолданады. Бұл режим барлық қолданбаларыңызды туннельдейді, бірақ оны цензура құралдары оңай анықтайды және бұғаттай алады. Оны желіаралық қалқандардың көбін айналып өту үшін<strong>пайдаланбаған жөн</strong>.",
-      "settings#systray-minimize#heading": "Хабарламалар аймағына қайыру (хабарлау панелі)",
-      "settings#systray-minimize#help-text": "Іске қосылған болса, Psiphon қолданбасы қайырылған кезде оның терезесі хабарламалар аймағында жасырылады (сонымен қатар, ол “хабарлау панелі” ретінде белгілі, Windows тапсырмалар панелінде сағаттың қасында орналасқан).",
-      "settings#systray-minimize#reason": "Psiphon қолданбасын хабарламалар аймағына (“жүйелік трей”) қайыру тапсырмалар панелінен орын босатады. Бұл әсіресе Psiphon қолданбасын ұзақ уақыт бойы қолданған кезде қолайлы.",
-      "settings#systray-minimize#enable-label": "Хабарламалар аймағына қайыру (хабарлау панелі)",
-      "settings#applying-message": "Параметрлерді қолдану үшін қайта қосылу.",
-      "settings#saved-message": "Параметрлер сақталды.",
-      "settings#error-modal#title": "Параметрлер қатесі",
-      "settings#error-modal#body": "Параметрлерде қателер бар. Жалғастыру алдында оларды түзетіңіз.",
-      "feedback#top_content_title": "Пікіріңізді білдіріңіз",
-      "feedback#top_para_2": "Ақаулықтардың көбін соңғы нұсқасын жүктеп алу арқылы түзетуге болады. <a class=\"NewVersionURL\" href=\"#\">Осы жерден шерту арқылы соңғы нұсқасын жүктеп алуға</a> немесе бізге эл. пошта хатын жіберуге болады: <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Сонымен қатар, сіз әдеттегі көп ақаулықтардың шешімін біздің <a class=\"FaqURL\" href=\"#\">Жиі қойылатын сұрақтар</a> бөлімінен таба аласыз.",
-      "feedback#smiley_happy": "Psiphon мен қалайтындай түрде қосылым орнатады және жұмыс істейді.",
-      "feedback#smiley_sad": "Psiphon көбінесе қосылымды орната алмайды немесе тиісті түрде жұмыс істемейді.",
-      "feedback#text_feedback_prompt": "Пікірлеріңізді осы жерге енгізіңіз:",
-      "feedback#text_feedback_email_prompt": "Біздің сізге жауап беруімізді қаласаңыз, өз эл. пошта мекенжайыңызды енгізіңіз:",
-      "feedback#diagnostic_check": "Диагностика деректерін жүктеп салыңыз. Есіңізде болсын, бұл диагностика деректері сізді сәйкестендірмейді және бізге Psiphon қызметін жақсартуға көмектеседі. <a class=\"DataCollectionInfoURL\" href=\"#\">Біздің қандай деректерді жинайтымызды білу үшін осы жерден шертіңіз.</a>",
-      "feedback#submit_button": "Жіберу",
-      "feedback#text_feedback_bottom_para": "Егер жоғарыдағы пішін  немесе скриншот жіберуді қаласаңыз, бізге <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> мекенжайына хат жазыңыз.",
-      "feedback#success-message": "<strong>Рахмет!</strong> Сіздің пікіріңіз жіберілді.",
-      "logs#show-debug-label": "Жөндеу журналдарын көрсету",
-      "logs#placeholder": "Журналдар жоқ",
-      "language#success-message": "<strong>Сәлеметсіз бе!</strong> Psiphon қызметіне қош келдіңіз.",
-      "about#wordart-tag": "Шекарасыз",
-      "about#description": "Psiphon – <strong>цензурадан жалтару құралы</strong> – ол цензорлар мен желіаралық қалқандарға қарамай, ашық Интернетке қатынауға мүмкіндік беретін құрал. Оның <strong>бастапқы кодтары ашық</strong> және ол Канада, Торонтода әзірленген.",
-      "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Жаңа нұсқасын жүктеп алу үшін</a></strong> немесе <strong><a class=\"InfoURL\" href=\"#\">көмек пен ақпарат алу үшін</a></strong> веб-сайтқа барыңыз. Psiphon қолданбасы Android және Windows жүйелерінде жұмыс істейді.",
-      "about#get-by-email": "<strong>Егер веб-сайтқа кіру мүмкін болмаса,</strong>, Psiphon қолданбасының жаңа нұсқасын келесі адреске эл. хат жіберу арқылы алуға болады:",
-      "about#client-version": "Windows жүйесіне арналған Psiphon клиентінің нұсқасы:",
-      "general#modal-close-button": "Жабу",
-      "general#notice-modal-tech-preamble": "Қателік туралы техникалық ақпарат:",
-      "notice#systemproxysettings-setproxy-error-title": "Жүйелік прокси қателігі",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon жүйелік прокси параметрлерін орната алмады.</p>\n<p>Бұл сіздегі вирусқарсы бағдарламамен қайшылыққа байланысты болуы мүмкін. Жергілікті Psiphon проксилерін қолдану үшін қолданбаңыздың немесе жүйенің прокси параметрлерін қолдан баптау керек болуы мүмкін.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” деп аталатын қосылым үшін жүйелік прокси параметрлерін орната алмады. Бұл вирусқарсы бағдарламамен қайшылыққа байланысты болуы мүмкін. Жергілікті Psiphon проксилерін қолдану үшін қолданбаңыздың немесе жүйенің прокси параметрлерін қолдан баптау керек болуы мүмкін.",
-      "appbackend#state-stopped-title": "Psiphon ажырап қалған",
-      "appbackend#state-starting-title": "Psiphon қосылуда",
-      "appbackend#state-starting-body": "Күте тұрыңыз…",
-      "appbackend#state-connected-title": "Psiphon қосылулы",
-      "appbackend#state-connected-body": "Шекарадан асыра шарлаңыз!",
-      "appbackend#state-connected-reminder-title": "Psiphon сізді қосылулы күйде ұстайды",
-      "appbackend#state-connected-reminder-body": "Psiphon қызметін тегін қалдырыңыз. Демеушіі беттеріне кіру үшін осы жерден шертіңіз!",
-      "appbackend#state-connected-reminder-body-2": "Біздің демеушііміздің беттеріне бару арқылы Psiphon қызметінің тегін қалуына көмектесіңіз!",
-      "appbackend#minimized-to-systray-title": "Psiphon қолданбасы хабарламалар аймағына қайырылған",
-      "appbackend#minimized-to-systray-body": "Қолданбаны қалпына келтіру үшін белгішені шертіңіз",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Демеушілік еткен"
-    }
-  },
-  "km": {
-    "name": "ភាសាខ្មែរ",
-    "translation": {
-      "banner#long-connecting": "<strong>អូ ទេ!</strong> អ្នកហាក់បីដូចជាមានបញ្ហាក្នុងការតភ្ជាប់!<br>\nទាញយកកម្មវិធី Psiphon ជំនាន់ចុងក្រោយពី <a class=\"NewVersionURL\" href=\"#\">គេហទំព័រទាញយក</a>\nឬតាមរយៈការផ្ញើអ៊ីម៉ែលទៅកាន់ <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "កំពុងតភ្ជាប់",
-      "nav#connection#connected": "បានតភ្ជាប់",
-      "nav#connection#stopping": "កំពុងផ្តាច់",
-      "nav#connection#stopped": "បានផ្តាច់ការតភ្ជាប់",
-      "nav#settings": "ការកំណត់",
-      "nav#feedback": "មតិយោបល់",
-      "nav#logs": "កំណត់ត្រា",
-      "nav#about": "អំពី",
-      "connection#starting-msg": "Psiphon គឺ <span class=\"state-word\">កំពុងតភ្ជាប់</span>…",
-      "connection#stop-btn": "បញ្ឈប់",
-      "connection#connected-msg": "Psiphon គឺ <span class=\"state-word\">ត្រូវបានតភ្ជាប់</span>",
-      "connection#disconnect-btn": "ផ្តាច់ការតភ្ជាប់",
-      "connection#stopping-msg": "Psiphon គឺ <span class=\"state-word\">កំពុងផ្តាច់ការតភ្ជាប់</span>…",
-      "connection#wait-btn": "សូមរង់ចាំ...",
-      "connection#stopped-msg": "Psiphon គឺ <span class=\"state-word\">ត្រូវបានផ្តាច់ការតភ្ជាប់</span>",
-      "connection#connect-btn": "តភ្ជាប់",
-      "connection#egress-region-combo-label": "ជ្រើសរើសតំបន់ម៉ាស៊ីនមេ",
-      "settings#error-alert": "<strong>បញ្ហា!</strong> សូមជួសជុលតម្លៃដែលមិនត្រឹមត្រូវមុនពេលដំណើរការ។",
-      "settings#reset-button": "កំណត់ឡើងវិញទៅលំនាំដើម",
-      "settings#apply-button": "អនុវត្តការផ្លាស់ប្តូរ",
-      "settings#unapplied-changes-prompt#title": "ការកំណត់បានផ្លាស់ប្តូរ",
-      "settings#unapplied-changes-prompt#body": "អ្នកបានធ្វើការផ្លាស់ប្តូរការកំណត់របស់អ្នក ប៉ុន្តែអ្នកមិនទាន់បានអនុវត្តការផ្លាស់ប្តូរនៅឡើយ។<br><br>តើអ្នកចង់អនុវត្តការផ្លាស់ប្តូរឥលូវ ឬបោះបង់ចោល?",
-      "settings#unapplied-changes-prompt#apply-button": "អនុវត្ត",
-      "settings#unapplied-changes-prompt#discard-button": "បោះបង់",
-      "settings#vpn-incompatible-msg": "(មិនដំណើរការជាមួយទម្រង់ L2TP/IPSec ទេ។)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "បើបើក ការស្នើសុំទៅកាន់ម៉ាស៊ីនមេក្នុងប្រទេសដើមរបស់អ្នក នឹងមិនអាចឆ្លងកាត់ Psiphon​ បានទេ។",
-      "settings#split-tunnel#reason": "គេហទំព័រក្នុងប្រទេសដើមរបស់អ្នកមិនត្រូវបានហាមឃាត់អ្វីទេ ដូចនេះការបើកជម្រើសនេះ នឹងជួយអ្នកចូលបើកគេហទំព័រលឿនជាងមុន និងពេលខ្លះអាចកាត់បន្ថយការចំណាយការប្រើប្រាស់ ISP បានទៀតផង។",
-      "settings#split-tunnel#enable-label": "កុំប្រូស៊ីគេហទំព័រក្នុងប្រទេសរបស់អ្នក",
-      "settings#disable-timeouts#heading": "បិទ ការហួសម៉ោង សម្រាប់បណ្តាញយឺត",
-      "settings#disable-timeouts#help-text": "ប្រសិនបើបើក ការទំនាក់ទំនងជាមួយម៉ាស៊ីនមេ Psiphon នឹងមិនហួសម៉ោងទេ។",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "បិទ ការហួសម៉ោង សម្រាប់បណ្តាញយឺត",
-      "settings#egress-region#heading": "តំបន់ម៉ាស៊ីនមេ Psiphon ",
-      "settings#egress-region#select-best-performance": "ដំណើរការល្អបំផុត",
-      "settings#egress-region#select-us": "សហរដ្ឋអាមេរិក",
-      "settings#egress-region#select-ca": "កាណាដា",
-      "settings#egress-region#select-gb": "ចក្រភពអង់គ្លេស",
-      "settings#egress-region#select-jp": "ជប៉ុន",
-      "settings#egress-region#select-sg": "សឹង្ហបុរី",
-      "settings#egress-region#select-sk": "ស្លូវ៉ាគី",
-      "settings#egress-region#select-nl": "ហូឡង់",
-      "settings#egress-region#select-de": "អាល្លឺម៉ង់",
-      "settings#egress-region#select-in": "ឥណ្ឌា",
-      "settings#egress-region#select-es": "អេស៉្បាញ",
-      "settings#egress-region#select-hk": "ហុងកុង",
-      "settings#egress-region#select-at": "អូទ្រីស",
-      "settings#egress-region#select-be": "បែលហ្សិក",
-      "settings#egress-region#select-bg": "ប៊ុលហ្គារី",
-      "settings#egress-region#select-ch": "ស្វីស",
-      "settings#egress-region#select-cz": "សាធារណរដ្ឋ​ឆែក",
-      "settings#egress-region#select-dk": "ដាណឺម៉ាក",
-      "settings#egress-region#select-fr": "បារាំង",
-      "settings#egress-region#select-hu": "ហុងគ្រី",
-      "settings#egress-region#select-it": "អ៊ីតាលី",
-      "settings#egress-region#select-no": "ន័រវែស",
-      "settings#egress-region#select-ro": "រូម៉ានី",
-      "settings#egress-region#select-se": "ស៊ុយអែត",
-      "settings#egress-region#select-pl": "ប៉ូឡូញ",
-      "settings#egress-region#select-rs": "ស៊ែប៊ី",
-      "settings#egress-region#select-au": "អូស្ត្រាលី",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "ជ្រើសរើសម៉ាស៊ីនមេ Psiphon​ ក្នុងតំបន់",
-      "settings#egress-region#error-modal-title": "ម៉ាស៊ីនមេក្នុងតំបន់មិនទំនេរ",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "ច្រក Proxy ខាងក្នុង",
-      "settings#local-proxy-ports#leave-blank": "ទុក<strong>ទទេរ</strong> សម្រាប់ការជ្រើសរើសច្រកដោយស្វ័យប្រវត្តិ (សូមណែនាំ).",
-      "settings#local-proxy-ports#reason": "ប្រសិនបើអ្នកប្រើឧបករណ៍នៅលើកុំព្យូទ័ររបស់អ្នក ដែលតម្រូវឱ្យមានការកំណត់ដោយដៃដើម្បីធ្វើការជាមួយ Psiphon អ្នកនឹងត្រូវការ Psiphon ប្រើលេខច្រកខាងក្នុងដូច ៗ គ្នាជានិច្ច។ ប្រសិនបើអ្នកមិនមានហេតុផលដើម្បីបញ្ជាក់លេខច្រកអ្នកគួរតែអនុញ្ញាតឱ្យ Psiphon ជ្រើសរើសវាដោយស្វ័យប្រវត្តិដើម្បីជួយជៀសវាងច្រកជាន់គ្នា។",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "ត្រូវតែចន្លោះពី 1 និង 65535។",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "ច្រកខាងក្នុងត្រូវតែមានភាពខុសគ្នាពីគ្នា។",
-      "settings#local-proxy-ports#error-modal-title": "ច្រក Proxy ខាងក្នុងជាន់គ្នា",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nអ្នកបានកំណត់ Psiphon ដើម្បីប្រើប្រាស់ច្រកខាងក្នុងជាក់លាក់ណាមួយ សម្រាប់ប្រូកស៊ី HTTP របស់វា។<br>\nទោះយ៉ាងណា, ច្រកនេះហាក់ដូចជាត្រូវបានប្រើ ដូចនេះហើយ Psiphon​ មិនអាចប្រើវាទេ។\n</p>\n<p>\nសូមផ្លាស់ប្តូរការកំណត់តម្លៃច្រកប្រូកស៊ី HTTP និងសាកល្បងម្តងទៀត។ យើងណែនាំ អ្នកឲ្យសំអាតតម្លៃដើម ដូចនេះ Psiphon អាចជ្រើសរើសច្រកទំនេរដោយស្វ័យប្រវត្តិ។\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nអ្នកបានកំណត់ Psiphon ដើម្បីប្រើប្រាស់ច្រកខាងក្នុងជាក់លាក់ណាមួយ សម្រាប់ប្រូកស៊ី SOCKS របស់វា។<br>\nទោះយ៉ាងណា, ច្រកនេះហាក់ដូចជាត្រូវបានប្រើ ដូចនេះហើយ Psiphon​ មិនអាចប្រើវាទេ។\n</p>\n<p>\nសូមផ្លាស់ប្តូរការកំណត់តម្លៃច្រកប្រូកស៊ី SOCKS និងសាកល្បងម្តងទៀត។ យើងណែនាំ អ្នកឲ្យសំអាតតម្លៃដើម ដូចនេះ Psiphon អាចជ្រើសរើសច្រកទំនេរដោយស្វ័យប្រវត្តិ។\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "ប្រសិនបើកុំព្យូទ័រអ្នកបានកំណត់ proxy ហើយ ជាលំនាំដើម Psiphon នឹងប្រើប្រាស់ proxy នៅពេលបង្កើតការតភ្ជាប់។ អ្នកអាចបដិសេដទម្លាប់នោះ ដោយកំណត់proxy មួយដើម្បីប្រើប្រាស់, ឬកំណត់ថាគ្មាន “upstream proxy” ដែលគួរប្រើប្រាស់ទេ។",
-      "settings#upstream-proxy#reason": "ជួនកាលប្រូកស៊ីខាងលើត្រូវបានតម្រូវដោយសាលារៀន សាកលវិទ្យាល័យ ឬអាជីវកម្ម។ ប្រសិនបើអ្នកផ្តល់សេវាកម្មបណ្តាញរបស់អ្នក បានផ្តល់ការកំណត់ប្រូកស៊ីខាងលើ នោះអ្នកចាំបាច់កំណត់ដោយខ្លួនឯងនៅទីនេះ ដើម្បីតភ្ជាប់។",
-      "settings#upstream-proxy#proxy-reqs": "មានតែប្រូកស៊ី HTTP ដែលគាំទ្រ HTTPS ត្រូវបានអនុញ្ញាត។",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "ឈ្មោះអ្នកប្រើប្រាស់",
-      "settings#upstream-proxy#password-label": "ពាក្យសម្ងាត់",
-      "settings#upstream-proxy#domain-label": "ដែន",
-      "settings#upstream-proxy#skip-label": "មិនប្រើ upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "កំហុសប្រូកស៊ីឡើងលើ",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon កំពុងត្រូវបានកំណត់ ដើម្បីប្រើប្រូកស៊ីប្រព័ន្ធអ្នកជា “ប្រូកស៊ីខាងលើ”.<br>\nទោះយ៉ាងណា, យើងហាក់ដូចជាមិនអាចតភ្ជាប់ទៅកាន់ម៉ាស៊ីនមេ Psiphon តាមរយៈប្រូកស៊ីនោះទេ។<br>\nសូមបើក “មិនប្រើប្រូកស៊ីខាងលើ” និងសាកល្បងម្តងទៀត។",
-      "settings#upstream-proxy#error-modal-body-configured": "អ្នកបានកំណត់ Psiphon ដើម្បីប្រើជា “ប្រូកស៊ីខាងលើ”។<br>\nទោះយ៉ាងណា, យើងហាក់ដូចជាមិនអាចតភ្ជាប់ទៅកាន់ម៉ាស៊ីនមេ Psiphon តាមរយៈប្រូកស៊ីនោះទេ។<br>\nសូមកែសំរួលការកំណត់ និងសាកល្បងម្តងទៀត។",
-      "settings#transport-mode#heading": "ទម្រង់បញ្ជូន",
-      "settings#transport-mode#check-label": "ប្រើទម្រង់ L2TP/IPSec",
-      "settings#transport-mode#help-text": "ប្រើបណ្តាញនិម្មិត L2TP / IPSec របស់ Windows។ ទម្រង់នេះ​ នឹងប្រើគ្រប់ច្រកកម្មវិធីរបស់អ្នកប៉ុន្តែវាមិនផ្តល់ភាពរំភើបនិងមិនមានសមត្ថភាពទប់ស្កាត់ការត្រួតពិនិត្យខ្លាំង។ វា <strong>មិនត្រូវបានណែនាំ</strong> សម្រាប់ឆ្លងកាត់ firewalls ភាគច្រើនទេ។",
-      "settings#systray-minimize#heading": "បង្រួមទៅកាន់តំបន់ជូនដំណឹង (System Tray)",
-      "settings#systray-minimize#help-text": "បើបើកវា, ពេលបង្រួមផ្ទាំងកម្មវិធី Psiphon នឹងលាក់ក្នុងតំបន់ជូនដំណឹង (ឬហៅថា “system tray” ឬ “systray”, ដែលមានទីតាំងក្បែរម៉ោង លើរបារកិច្ចការរបស់ Windows)។",
-      "settings#systray-minimize#reason": "បង្រួម Psiphon ទៅតំបន់ជូនដំណឹង (“system tray”) ដើម្បីទុកប្រឡោះទំនេរលើរបស់កិច្ចការរបស់អ្នក។ វាមានប្រយោជន៍ជាពិសេសពេលអ្នកប្រើ Psiphon រយៈពេលយូរ។",
-      "settings#systray-minimize#enable-label": "បង្រួមទៅកាន់តំបន់ជូនដំណឹង (System Tray)",
-      "settings#applying-message": "កំពុងតភ្ជាប់ឡើងវិញ ដើម្បីអនុវត្តការកំណត់របស់អ្នក។",
-      "settings#saved-message": "ការកំណត់បានរក្សាទុក។",
-      "settings#error-modal#title": "ការកំណត់មានបញ្ហា",
-      "settings#error-modal#body": "មានបញ្ហាក្នុងការកំណត់តម្លៃ។ សូមកែតម្រូវមុនពេលដំណើរការ។",
-      "feedback#top_content_title": "ប្រាប់ពីមតិយោបល់អ្នក",
-      "feedback#top_para_2": "បញ្ហាជាច្រើនអាចត្រូវបានដោះស្រាយដោយទាញយកកម្មវិធីជំនាន់ចុងក្រោយ។ អ្នកអាច <a class=\"NewVersionURL\" href=\"#\">ទាញយកជំនាន់ចុងក្រោយដោយចុចទីនេះ</a>, ឬ អ្នកអាចផ្ញើអ៊ីម៉ែលទៅកាន់ <a class=\"NewVersionEmail\" href=\"#\"></a>។",
-      "feedback#top_para_3": "អ្នកអាចស្វែងរកដំណោះស្រាយសម្រាប់បញ្ហាមួយចំនួនក្នុង<a class=\"FaqURL\" href=\"#\">សំនួរទូទៅ</a>របស់យើង។",
-      "feedback#smiley_happy": "Psiphon តភ្ជាប់និងដំណើរការតាមរបៀបដែលខ្ញុំចង់បាន។",
-      "feedback#smiley_sad": "Psiphon ជាញឹកញយបរាជ័យក្នុងការតភ្ជាប់ ឬមិនដំណើរការដោយប្រក្រតី។",
-      "feedback#text_feedback_prompt": "សូមបញ្ចូលមតិរបស់អ្នកនៅទីនេះ៖",
-      "feedback#text_feedback_email_prompt": "បើអ្នកចង់ឲ្យយើងឆ្លើយតបទៅអ្នក សូមបញ្ចូលអាសយដ្ឋានអ៊ីម៉ែលរបស់អ្នក៖",
-      "feedback#diagnostic_check": "បញ្ជូនទិន្នន័យវិភាគ។ សូមចំណាំថា ទិន្នន័យវិភាគមិនបង្ហាញអត្តសញ្ញាណអ្នក និងវានឹងជួយយើងរក្សាដំណើរការPsiphon ឲ្យរលូនជាមុន។<a class=\"DataCollectionInfoURL\" href=\"#\">ចុចទីនេះដើម្បីមើលអ្វីដែលយើងប្រមូល។</a>",
-      "feedback#submit_button": "បញ្ជូន",
-      "feedback#text_feedback_bottom_para": "បើទម្រង់មិនដំណើរការ ឬអ្នកចង់បញ្ជូនរូបភាពអេក្រង់ សូមផ្ញើអ៊ីម៉ែលមកយើងតាម <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>។",
-      "feedback#success-message": "<strong>អរគុណ!</strong> មតិយោបល់អ្នកត្រូវបានបញ្ជូន។",
-      "logs#show-debug-label": "បង្ហាញកំណត់ត្រាកំហុស",
-      "logs#placeholder": "មិនទាន់មានកំណត់ត្រា",
-      "language#success-message": "<strong>សួស្តី!</strong> ស្វាគមន៍មកកាន់ Psiphon។",
-      "about#wordart-tag": "លើសព្រំដែន",
-      "about#description": "Psiphon ជា <strong>ឧបករណ៍បញ្ចៀសការឃ្លាំមើល</strong> — វាត្រូវបានរចនាឡើងដើម្បីផ្តល់អោយអ្នកបើកអ៊ិនធ័រណិតដោយចំហរ, ឆ្លងផុតការឃ្លាំមើល និង firewalls។ វាមាន <strong>កូដបើកចំហរ</strong> ហើយត្រូវបានបង្កើតឡើងនៅតូរ៉ុនតូ ប្រទេសកាណាដា។",
-      "about#visit-download-site": "សូមចូលទៅកាន់គេហទំព័រ <strong><a class=\"NewVersionURL\" href=\"#\">ទាញយកជំនាន់ថ្មី</a></strong> ឬ <strong><a class=\"InfoURL\" href=\"#\">ទទួលជំនួយនិងព័ត៌មាន</a></strong>។ Psiphon មានសម្រាប់ Android និង Windows។",
-      "about#get-by-email": "<strong>បើគេហទំព័របើកអត់ចេញ</strong>, អ្នកអាចទាញយក Psiphon ជំនាន់ថ្មីដោយផ្ញើអ៊ីម៉ែលទៅកាន់៖",
-      "about#client-version": "Psiphon សម្រាប់ Windows ជំនាន់៖",
-      "general#modal-close-button": "បិទ",
-      "general#notice-modal-tech-preamble": "នេះជាព័ត៌មានកំហុសបច្ចេកទេស៖",
-      "notice#systemproxysettings-setproxy-error-title": "ប្រូកស៊ីប្រព័ន្ធមានបញ្ហា",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon បរាជ័យក្នុងការកំណត់ប្រូកស៊ីប្រព័ន្ធ។</p>\n<p>នេះអាចមកពីជាន់គ្នាជាមួយកម្មវិធីកំចាត់មេរោគរបស់អ្នក។ អ្នកអាចត្រូវការកំណត់កម្មវិធីរបស់អ្នក ឬប្រព័ន្ធប្រូកស៊ី ដើម្បីប្រើប្រាស់ប្រូកស៊ី Psiphon ខាងក្នុង។</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon បរាជ័យក្នុងការកំណត់ប្រព័ន្ធប្រូកស៊ី សម្រាប់ឈ្មោះការតភ្ជាប់អ៊ីនធឺណិត “<%- data %>”។ នេះអាចមកពីជាន់គ្នាជាមួយកម្មវិធីកំចាត់មេរោគរបស់អ្នក។ អ្នកអាចត្រូវការកំណត់កម្មវិធីរបស់អ្នក ឬប្រព័ន្ធប្រូកស៊ី ដើម្បីប្រើប្រាស់ប្រូកស៊ី Psiphon ខាងក្នុង។",
-      "appbackend#state-stopped-title": "Psiphon ត្រូវបានផ្តាច់",
-      "appbackend#state-starting-title": "Psiphon កំពុងភ្ជាប់",
-      "appbackend#state-starting-body": "សូមរង់ចាំ...",
-      "appbackend#state-connected-title": "Psiphon បានតភ្ជាប់",
-      "appbackend#state-connected-body": "រុករកលើសពីដែនកំណត់របស់អ្នក!",
-      "appbackend#state-connected-reminder-title": "Psiphon រក្សាការតភ្ជាប់របស់អ្នក",
-      "appbackend#state-connected-reminder-body": "រក្សា Psiphon ឲ្យនៅមិនគិតថ្លៃ។ ចុចទីនេះ ដើម្បីចូលទៅកាន់ទំព័ររបស់ម្ចាស់ឧបត្ថម្ភ!",
-      "appbackend#state-connected-reminder-body-2": "រក្សា Psiphon ឲ្យនៅឥតគិតថ្លៃ តាមរយៈការចូលទៅកាន់ទំព័រម្ចាស់ឧបត្ថម្ភរបស់យើង!",
-      "appbackend#minimized-to-systray-title": "Psiphon ត្រូវបានបង្រួមទៅកាន់តំបន់ជូនដំណឹង",
-      "appbackend#minimized-to-systray-body": "ចុច លើរូបតំណាងដើម្បីស្តារកម្មវិធីវិញ",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "សមតុល្យ PsiCash មិនគ្រប់គ្រាន់",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 ម៉ោង",
-      "psicash#1-day": "1 ថ្ងៃ",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>ល្បឿន",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "កម្មវិធីមិនដំណើរការ?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "ឧបត្ថម្ភដោយ"
-    }
-  },
-  "ko": {
-    "name": "한국어",
-    "translation": {
-      "banner#long-connecting": "<strong>오 이런!</strong> 현재 연결에 문제를 겪고있는 것 같군요!<br>\n많은 문제들이 새로운 버전에 고쳐져서 나옵니다. <a class=\"NewVersionURL\" href=\"#\">새로운 버전 다운로드</a> 링크를 통해 새로운 버전의 Psiphon을 받을 수 있습니다. 또는 다음의 이메일 주소에 메일을 보내 받을 수도 있습니다: <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "연결 중",
-      "nav#connection#connected": "연결됨",
-      "nav#connection#stopping": "연결 끊는 중",
-      "nav#connection#stopped": "연결 끊김",
-      "nav#settings": "설정",
-      "nav#feedback": "피드백",
-      "nav#logs": "로그",
-      "nav#about": "About",
-      "connection#starting-msg": "Psiphon에 <span class=\"state-word\">연결 하는 중</span>...",
-      "connection#stop-btn": "중지",
-      "connection#connected-msg": "Psiphon에 <span class=\"state-word\">연결됨</span>",
-      "connection#disconnect-btn": "연결 끊기",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">연결 끊는 중</span>...",
-      "connection#wait-btn": "잠시만 기다려주세요...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">연결 끊김</span>",
-      "connection#connect-btn": "연결",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>오류가 발생했습니다!</strong> 진행하기 전에 잘못된 값을 고쳐주세요.",
-      "settings#reset-button": "기본값으로 초기화",
-      "settings#apply-button": "변경 사항 적용",
-      "settings#unapplied-changes-prompt#title": "설정 변경됨",
-      "settings#unapplied-changes-prompt#body": "설정을 바꾸었지만 바꾼 설정이 적용되지 않았습니다. <br><br> 바꾼 설정을 바로 적용할까요? 아니면 취소할까요?",
-      "settings#unapplied-changes-prompt#apply-button": "적용",
-      "settings#unapplied-changes-prompt#discard-button": "취소",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec 모드에선 작동하지 않습니다.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "터널 분리",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "자국 내에서 서비스하는 사이트에 프록시 적용 안 함",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon 서버 위치",
-      "settings#egress-region#select-best-performance": "가장 좋은 성능",
-      "settings#egress-region#select-us": "미국",
-      "settings#egress-region#select-ca": "캐나다",
-      "settings#egress-region#select-gb": "영국",
-      "settings#egress-region#select-jp": "일본",
-      "settings#egress-region#select-sg": "싱가포르",
-      "settings#egress-region#select-sk": "슬로바키아",
-      "settings#egress-region#select-nl": "네덜란드",
-      "settings#egress-region#select-de": "독일",
-      "settings#egress-region#select-in": "인도",
-      "settings#egress-region#select-es": "스페인",
-      "settings#egress-region#select-hk": "홍콩",
-      "settings#egress-region#select-at": "오스트리아",
-      "settings#egress-region#select-be": "벨기에",
-      "settings#egress-region#select-bg": "불가리아",
-      "settings#egress-region#select-ch": "스위스",
-      "settings#egress-region#select-cz": "체코",
-      "settings#egress-region#select-dk": "덴마크",
-      "settings#egress-region#select-fr": "프랑스",
-      "settings#egress-region#select-hu": "헝가리",
-      "settings#egress-region#select-it": "이탈리아",
-      "settings#egress-region#select-no": "노르웨이",
-      "settings#egress-region#select-ro": "로마니아",
-      "settings#egress-region#select-se": "스웨덴",
-      "settings#egress-region#select-pl": "폴란드",
-      "settings#egress-region#select-rs": "세르비아",
-      "settings#egress-region#select-au": "오스트레일리아",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Psiphon 서버의 위치를 선택해 주십시오.",
-      "settings#egress-region#error-modal-title": "해당 위치의 서버를 사용할 수 없음",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "로컬 프록시 포트",
-      "settings#local-proxy-ports#leave-blank": "<strong>빈칸</strong>으로 두면 자동으로 포트를 선택합니다 (권장됨).",
-      "settings#local-proxy-ports#reason": "만약 직접 구성한 설정을 사용하는 Psiphon과 함께 작동하는 도구를 사용하는 경우, 아마 Psiphon이 일관되도록 작동하게 하기 위해 같은 로컬 포트 숫자를 쓰는 것이 좋습니다. 만약 특정 포트 숫자를 쓸 이유가 없다면, 충돌 문제를 방지하기 위해 Psiphon이 자동으로 포트 숫자를 선택할 수 있도록 설정해야 합니다.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1부터 65535사이의 값이여야합니다.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "로컬 포트는 반드시 다른 포트와 곂치지 않아야 합니다.",
-      "settings#local-proxy-ports#error-modal-title": "로컬 프록시 포트 충돌",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\n현재 Psiphon이 HTTP 프록시를 위해 특정한 로컬 포트를 사용하도록 설정되어 있습니다.<br>\n하지만, 해당 포트는 이미 사용되고 있는 것 같으며 Psiphon이 사용할 수 없습니다.\n</p>\n<p>\nHTTP 프록시 포트를 변경하고 다시 시도해 주세요. 값을 모두 지우면 Psiphon이 자동으로 사용 가능한 포트를 지정할 수 있으니 값을 지우는 방법을 추천합니다.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\n현재 Psiphon이 SOCKS 프록시를 위해 특정한 로컬 포트를 사용하도록 설정되어 있습니다.<br>\n하지만, 해당 포트는 이미 사용되고 있는 것 같으며 Psiphon이 사용할 수 없습니다.\n</p>\n<p>\nSOCKS 프록시 포트를 변경하고 다시 시도해 주세요. 값을 모두 지우면 Psiphon이 자동으로 사용 가능한 포트를 지정할 수 있으니 값을 지우는 방법을 추천합니다.\n</p>",
-      "settings#upstream-proxy#heading": "업 스트림 프록시",
-      "settings#upstream-proxy#by-default": "컴퓨터가 이미 프록시 설정이 되어있는 경우, 기본적으로 Psiphon은 터널링을 하기 위해 해당 프록시를 이용합니다. “upstream proxy”를 사용하지 않는 것으로 지정하거나 사용할 프록시를 지정하면 이 동작을 덮어쓸 수 있습니다.",
-      "settings#upstream-proxy#reason": "업스트림 프록시는 때때로 학교나 대학, 회사에서 요구할 때가 있습니다. 만약 네트워크 제공자가 이미 업스트림 프록시 설정을 주었다면, 연결을 위해 추가적인 설정이 필요할 수 있습니다.",
-      "settings#upstream-proxy#proxy-reqs": "HTTPS를 지원하는 HTTP 프록시만 사용할 수 있습니다.",
-      "settings#upstream-proxy#hostname-label": "호스트 이름",
-      "settings#upstream-proxy#port-label": "포트",
-      "settings#upstream-proxy#username-label": "Username",
-      "settings#upstream-proxy#password-label": "비밀번호",
-      "settings#upstream-proxy#domain-label": "도메인",
-      "settings#upstream-proxy#skip-label": "업 스트림 프록시 사용 안 함",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "업 스트림 프록시 오류",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon이 현재 시스템 “upstream proxy\"를 사용하도록 설정되어 있습니다.<br>\n하지만, 현재 해당 프록시를 통해 Psiphon 서버로 접속할 수 없는 것 같습니다.<br>\n“업스트림 프록시 사용 안 함”을 선택하고 다시 시도하십시오.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon이 현재 시스템 “upstream proxy\"를 사용하도록 설정되어 있습니다.<br>\n하지만, 현재 해당 프록시를 통해 Psiphon 서버로 접속할 수 없는 것 같습니다.<br>\n“업스트림 프록시 사용 안 함”을 선택하고 다시 시도하십시오.",
-      "settings#transport-mode#heading": "전송 모드",
-      "settings#transport-mode#check-label": "L2TP / IPSec 모드를 사용",
-      "settings#transport-mode#help-text": "Windows L2TP/IPSec 가상 네트워킹을 사용합니다. 이 모드는 모든 어플리케이션에 터널링을 적용합니다. 하지만 명료하지 않고 강력한 검열 우회 기능을 가지고 있지 않습니다. 대부분의 방화벽을 뚫는데에는 <strong>추천하지</strong> 않습니다.",
-      "settings#systray-minimize#heading": "알림 영역으로 최소화 (시스템 트레이)",
-      "settings#systray-minimize#help-text": "활성화되어 있으면, 최소화 할 때 Psiphon 어플리케이션 창을 알림 영역으로 최소화 합니다. (이는 \"시스템 트레이\" 또는 \"시스트레이\"로 알려져 있으며 Windows 작업 표시줄의 시계 근처에 있습니다)",
-      "settings#systray-minimize#reason": "Psiphon을 최소화 하면 빈 공간의 작업 표시줄 알림 영역 (\"시스템 트레이\") 에 표시됩니다. 이는 특히 Psiphon을 오래 사용할 때 유용합니다.",
-      "settings#systray-minimize#enable-label": "알림 영역으로 최소화하기 (시스템 트레이)",
-      "settings#applying-message": "다시 연결하면 설정이 적용됩니다.",
-      "settings#saved-message": "설정 저장됨.",
-      "settings#error-modal#title": "설정 오류",
-      "settings#error-modal#body": "설정 값에 오류가 있습니다. 진행하기 전에 설정을 확인하세요.",
-      "feedback#top_content_title": "피드백을 제공하세요",
-      "feedback#top_para_2": "수 많은 문제들은 대부분 새로운 버전을 설치하면 해결됩니다. <a class=\"NewVersionURL\" href=\"#\">새로운 버전 다운로드</a> 링크를 통해 새로운 버전의 Psiphon을 받을 수 있습니다. 또는 다음의 이메일 주소에 메일을 보내 받을 수도 있습니다: <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "feedback#top_para_3": "흔히 일어나는 문제에 대해서는 <a class=\"FaqURL\" href=\"#\">자주 묻는 질문</a>에서도 빠르게 답변을 찾을 수 있습니다.",
-      "feedback#smiley_happy": "Psiphon이 잘 연결되며 원하는 대로 잘 작동하고 있습니다.",
-      "feedback#smiley_sad": "Psiphon이 가끔 연결에 실패하거나 잘 작동하지 않을 때가 있습니다.",
-      "feedback#text_feedback_prompt": "여기에 코멘트를 입력해 주세요:",
-      "feedback#text_feedback_email_prompt": "만약 답변을 받고 싶다면, 여기에 이메일을 남겨주세요:",
-      "feedback#diagnostic_check": "진단 정보를 업로드하세요. 참고로 이 진단 정보는 어떠한 개인 식별 정보도 포함하지 않으며, 이 소중한 정보는 Psiphon이 부드럽게 작동할 수 있도록 도움을 줄 것입니다. <a class=\"DataCollectionInfoURL\" href=\"#\">이곳</a>을 클릭하여 어떤 정보가 수집되는지 확인하세요.",
-      "feedback#submit_button": "확인",
-      "feedback#text_feedback_bottom_para": "폼이 작동하지 않거나 또는 스크린샷을 첨부하고 싶다면, 다음의 이메일로 보내주시면 됩니다: <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>감사합니다!</strong> 당신의 피드백이 보내졌습니다.",
-      "logs#show-debug-label": "디버그 로그 보이기",
-      "logs#placeholder": "로그가 없습니다.",
-      "language#success-message": "<strong>반갑습니다!</strong> Psiphon에 오신것을 환영합니다.",
-      "about#wordart-tag": "국경을 넘어",
-      "about#description": "Psiphon은 <strong>강력한 검열 우회 도구</strong>입니다 — 시대를 역행하는 검열과 방화벽을 뚫고 열린 인터넷에 접속할 수 있도록 디자인되었으며 Toronto, Canada에서 <strong>오픈 소스</strong>로 개발되었습니다.",
-      "about#visit-download-site": "웹 사이트를 방문하여 <strong><a class=\"NewVersionURL\" href=\"#\">새로운 버전</a></strong>을 다운로드 하거나 <strong><a class=\"InfoURL\" href=\"#\">도움말</a></strong>을 얻을 수 있습니다. Psiphon은 Android와 Windows에서 사용할 수 있습니다.",
-      "about#get-by-email": "<strong>만약 Psiphon 사이트 접속이 불가능한 경우</strong>, 다음 이메일 주소로 메일을 보내면 최신 버전의 Psiphon 클라이언트를 받을 수 있습니다: ",
-      "about#client-version": "Psiphon Windows 클라이언트 버전:",
-      "general#modal-close-button": "닫기",
-      "general#notice-modal-tech-preamble": "기술적인 오류 정보가 있습니다:",
-      "notice#systemproxysettings-setproxy-error-title": "시스템 프록시 에러",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon이 시스템 프록시 설정을 적용하는데 실패했습니다.</p>\n<p>이 문제는 바이러스 백신과 충돌을 일으켰을 가능성이 높습니다. 백신을 끄거나 수동으로 시스템 프록시가 Psiphon 프록시를 사용하도록 설정해야 할 수 있습니다.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon이 “<%- data %>” 시스템 프록시 설정을 적용하는데 실패했습니다. 이 문제는 바이러스 백신과 충돌을 일으켰을 가능성이 높습니다. 백신을 끄거나 수동으로 시스템 프록시가 Psiphon 프록시를 사용하도록 설정해야 할 수 있습니다.",
-      "appbackend#state-stopped-title": "Psiphon 연결 끊김",
-      "appbackend#state-starting-title": "Psiphon 연결 중",
-      "appbackend#state-starting-body": "잠시만 기다려주세요...",
-      "appbackend#state-connected-title": "Psiphon 연결됨",
-      "appbackend#state-connected-body": "국경을 넘어 탐색하세요!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon이 알림 영역에 최소화되었습니다",
-      "appbackend#minimized-to-systray-body": "아이콘을 클릭하면 어플리케이션을 표시합니다",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1시간",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "후원자"
-    }
-  },
-  "ky": {
-    "name": "Кыргызча",
-    "translation": {
-      "banner#long-connecting": "<strong>О жок! </strong>Байланыша албай жатат окшойсуз!<br>\nPsiphon-дун акыркы нускасын <a class=\"NewVersionURL\" href=\"#\">түшүрүп алуу сайтынан</a>\nже болбосо<a class=\"NewVersionEmail\" href=\"#\"></a>дарегине эл. кат жиберүү аркылуу жүктөп алыңыз",
-      "nav#connection#starting": "Байланышуу ",
-      "nav#connection#connected": "Байланышты",
-      "nav#connection#stopping": "Байланышты үзүү",
-      "nav#connection#stopped": "Байланыш үзүлдү",
-      "nav#settings": "Баптоолор",
-      "nav#feedback": "Кайтарым байланыш",
-      "nav#logs": "Журналдар",
-      "nav#about": "Ушул тууралуу",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">байланышууда </span>...",
-      "connection#stop-btn": "Токтоо",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">байланышылды</span>",
-      "connection#disconnect-btn": "Байланышты үзүү",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">байланышты үзүүдө </span>...",
-      "connection#wait-btn": "Сураныч, күтө туруңуз...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">байланышты үздү</span>",
-      "connection#connect-btn": "Байланышуу ",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Ката!</strong> Улантуу алдында туура эмес нарктарды түзөтүңүз.",
-      "settings#reset-button": "Демейкиге кайтаруу",
-      "settings#apply-button": "Өзгөрүштөрдү ишке ашыруу",
-      "settings#unapplied-changes-prompt#title": "Баптоолор өзгөртүлдү",
-      "settings#unapplied-changes-prompt#body": "Сиз баптоолоруңузга өзгөруштөрдү киргиздиңиз, бирок аларды күчүнө киргизген жоксуз. <br><br>Өзгөрүштөрдү азыр ишке ашырууну же жокко чыгарууну калайсызбы?",
-      "settings#unapplied-changes-prompt#apply-button": "Колдонуу",
-      "settings#unapplied-changes-prompt#discard-button": "Жокко чыгаруу",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec режиминде иштебейт.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Туннелди бөлүү",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Сиздин өлкөңүздөгү вебсайттар үчүн проксини колдонбоо",
-      "settings#disable-timeouts#heading": "Жай Тармактар үчүн танаписти өчүрүү",
-      "settings#disable-timeouts#help-text": "Иштетилген болсо, Psiphon сервери менен байланыштын убакыты бүтпөйт.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Жай тармактар үчүн танаписти өчүрүү",
-      "settings#egress-region#heading": "Psiphon Сервер аймагы",
-      "settings#egress-region#select-best-performance": "Мыкты Аткаруу",
-      "settings#egress-region#select-us": "Кошмо Штаттар",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Улуу Британия",
-      "settings#egress-region#select-jp": "Япония",
-      "settings#egress-region#select-sg": "Сингапур",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Голландия",
-      "settings#egress-region#select-de": "Германия",
-      "settings#egress-region#select-in": "Индия",
-      "settings#egress-region#select-es": "Испания",
-      "settings#egress-region#select-hk": "ГоңКоң",
-      "settings#egress-region#select-at": "Австрия",
-      "settings#egress-region#select-be": "Бельгия",
-      "settings#egress-region#select-bg": "Болгария",
-      "settings#egress-region#select-ch": "Швейцария",
-      "settings#egress-region#select-cz": "Чехия",
-      "settings#egress-region#select-dk": "Дания",
-      "settings#egress-region#select-fr": "Франция",
-      "settings#egress-region#select-hu": "Венгрия",
-      "settings#egress-region#select-it": "Италия",
-      "settings#egress-region#select-no": "Норвегия",
-      "settings#egress-region#select-ro": "Румыния",
-      "settings#egress-region#select-se": "Швеция",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Жарактуу Psiphon серверинин аймагын тандаңыз.",
-      "settings#egress-region#error-modal-title": "Сервер аймагы жеткиликтүү эмес",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Локалдуу Прокси Порттору",
-      "settings#local-proxy-ports#leave-blank": "Портторду автоматтуу түрдө тандоо үчүн <strong>бош</strong> калтырыңыз (сунушталат).",
-      "settings#local-proxy-ports#reason": "Эгер сиз компьютериңизде Psiphon менен иштөө үчүн кол менен конфигурациялоону талап кыла турган куралдарды колдонсоңуз, сиз Psiphon-дун дайыма белгиленген жергиликтүү портторду колдонушун каалашыңыз мүмкүн. Ал эмесе, сизде жергиликтүү портторду көрсөтүү керектиги жок болсо, конфликттерге жол бербөө максатында Psiphon үчүн ал портторду автоматтуу түрдө тандоого уруксат берүүңүз зарыл.",
-      "settings#local-proxy-ports#http-label": " HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 жана 65535 ортосунда болушу керек.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Жергиликтүү порттор бири-биринен айырмаланып турушу керек.",
-      "settings#local-proxy-ports#error-modal-title": "Локалдуу прокси портунун келишпестиги",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nСиз Psiphon-ду анын HTTP проксиси үчүн атайын жергиликтүү портту колдонууга конфигурациялагансыз. <br>\nОшентсе да, ал порт эбак колдонулуп жаткандыктан, Psiphon аны колдоно албайт.\n</p>\n<p>\nКонфигурацияланган HTTP прокси портун өзгөртүп, кайталап көрүңүз. Бул калыптоону өчүрүүнү сунуштайбыз, ошондо Psiphon автоматтык түрдө жеткиликтүү портту тандайт.</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nСиз Psiphon-ду  SOCKS проксиси үчүн атайын жергиликтүү портту колдонууга конфигурациялагансыз.<br>\nБирок, ал порт эбак колдонулуп жаткандыктан, Psiphon аны колдоно албайт.\n</p>\n<p>\nКонфигурацияланган SOCKS прокси портунун наркын өзгөртүп, кайталап көрүңүз. Psiphon автоматту түрдө жеткиликтүү портту тандай алышы үчүн ал наркты тазалоону сунуштайбыз.\n</p>",
-      "settings#upstream-proxy#heading": "Каршы прокси",
-      "settings#upstream-proxy#by-default": "Эгер сиздин компьютериңизде прокси эбак конфигурацияланган болсо, демейки боюнча Psiphon туннелди орнотуу кезинде ал проксини колдонот. Сиз бул мүнөз-кылыкты аттап кетиш үчүн колдонууга проксини же ушундай \"каршы проксини\" колдонбоо керектигин көрсөтө аласыз.",
-      "settings#upstream-proxy#reason": "Каршы проксилер кээде мектептерде, университеттерде жана бизнесте колдонулат. Эгер тармак провайдериңиз сизге каршы прокси баптоолорун берген болсо, байланышуу үчүн аларды кол менен баптоо талап кылынышы мүмкүн. ",
-      "settings#upstream-proxy#proxy-reqs": "Бир гана HTTPS колдогон  HTTP проксилерге уруксат берилген.",
-      "settings#upstream-proxy#hostname-label": "Хост аты",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Колдонуучунун аты",
-      "settings#upstream-proxy#password-label": "Сыр сөз",
-      "settings#upstream-proxy#domain-label": "Домен",
-      "settings#upstream-proxy#skip-label": "Каршы проксини колдонбоңуз",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Каршы прокси катасы",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon азыркы учурда система проксиңизди \"каршы прокси\" катары колдонууга конфигурацияланган. <br>\nОшентсе да, ал прокси аркылуу биз Psiphon серверине байланыша албайт окшойбуз. <br>\n\"Каршы проксини колдонбоо\" дегенди иштетип, кайталап көрүңүз.",
-      "settings#upstream-proxy#error-modal-body-configured": "Сиз Psiphon-ду \"каршы проксини\" колдонууга конфигурациялагансыз. <br>\nОшентсе да, ал прокси аркылуу биз Psiphon серверине байланыша албайт окшойбуз.<br>\nБаптоолорду оңдоп, кайталап көрүңүз.",
-      "settings#transport-mode#heading": "Транспорт режими",
-      "settings#transport-mode#check-label": "L2TP/IPSec режимин колдонуу",
-      "settings#transport-mode#help-text": "Windows-дун L2TP/IPSec виртуалдык тармагын колдонот. Бул режим бардык колдонмолоруңузду туннелдейт, бирок будамалабайт жана аны цензура куралдары оңой аныктайт жана тосо алат. Ал тармактык экрандардын көбүн аттап өтүүгө <strong>сунушталбайт</strong>.",
-      "settings#systray-minimize#heading": "Билдирүү аймагына чейин кичирейтүү (Систималык Трей)",
-      "settings#systray-minimize#help-text": "Иштетилген болсо, Psiphon колдонмосу кичирейтилген кезинде анын терезеси билдирүулөр аймагына жашырылат (ошондой эле, ал \"системалык трей” же \"systray\" түрүндө белгилүү, жана Windows тапшырмалар тилкеңизде сааттын жанында жайгашкан).",
-      "settings#systray-minimize#reason": "Psiphon-ду билдирүүлөр аймагына (\"системалык трей\") чейин кичирейтүү тапшырмалар тилкеңизде орун бошотот. Бул айрыкча Psiphon-ду узак убакыт бою колдонгонго пайдалуу.",
-      "settings#systray-minimize#enable-label": "Билдирүү аймагына чейин кичирейтүү (системалык трей)",
-      "settings#applying-message": "Баптоолоруңузду ишке ашыруу үчүн кайра байланышуу.",
-      "settings#saved-message": "Баптоолор сакталды.",
-      "settings#error-modal#title": "Баптоолор катасы",
-      "settings#error-modal#body": "Баптоолорүңүздүн нарктарында каталар бар. Улантуу алдында аларды түзөтүңүз.",
-      "feedback#top_content_title": "Бизге пикиринизди билдириниз",
-      "feedback#top_para_2": "Маселелердин көбүн соңку нускасын жүктөп алуу аркылуу чечүүгө болот. Сиз <a class=\"NewVersionURL\" href=\"#\"> муну басып соңку нускасын жүктөп алсаңыз </a>, же болбосо буга имейл жиберсеңиз болот<a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Мындан тышкары, сиз көп кездешкен маселелерге чечимдерди <a class=\"FaqURL\" href=\"#\">Көп Кездешкен Суроолор</a> бөлүмүнөн тапсаңыз болот.",
-      "feedback#smiley_happy": "Psiphon мага керек болгондой байланышат жана иштейт.",
-      "feedback#smiley_sad": "Psiphon көп учурда байланышты жоготот жана анча жакшы иштебейт.",
-      "feedback#text_feedback_prompt": "Сураныч, бул жерге пикириңизди жазыңыз:",
-      "feedback#text_feedback_email_prompt": "Сизге жооп берүүбүздү кааласаңыз, имейл дарегиңизди калтырыңыз:",
-      "feedback#diagnostic_check": "Диагностикалык берилмелерди жүктөңүз. Эскертүү, бул диагностикалык берилмелер сизди аныктабайт жана бизге Psiphon-ду тегиз иштетүүгө жардам берет. <a class=\"DataCollectionInfoURL\" href=\"#\"> Биз кандай маалыматтарды чогултканыбызды көрүү үчүн бул жерди басыңыз.</a>",
-      "feedback#submit_button": "Жиберүү",
-      "feedback#text_feedback_bottom_para": "Эгерде жогорудагы форма иштебесе, же болбосо скриншотторду жиберүүнү кааласаңыз, бизге <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> дарегине жазыңыз.",
-      "feedback#success-message": "<strong>Рахмат!</strong> Сиздин пикириңизди билдирүүнүз жиберилди.",
-      "logs#show-debug-label": "Жөндөө журналын көрсөтүү",
-      "logs#placeholder": "Журналдар азырынча жок",
-      "language#success-message": "<strong>Салам!</strong>Psiphon-го Кош Келиңиз ",
-      "about#wordart-tag": "Чек аралардан өйдө",
-      "about#description": "Psiphon – бул <strong>цензураны аттап өтүү куралы</strong> — ал ачык Интернетти, цензорлор жана желелик экрандарга карабай, жеткиликтүү кылууга арналган курал. Анын <strong>булагы ачык</strong>,ал Канаданын Торонто шаарында жасалган.",
-      "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Жаңы нускасын жүктөп алуу үчүн</a></strong> же болбосо <strong><a class=\"InfoURL\" href=\"#\"> маалымат же жардам алуу үчүн </a></strong> вебсайтка кириңиз. Psiphon Android жана Windows үчүн жеткиликтүү.",
-      "about#get-by-email": "<strong>Эгерде вебсайт жеткиликтүү эмес болсо</strong>, буга имейл жиберүү аркылуу Psiphon-дун жаңы нускасын ала аласыз:",
-      "about#client-version": "Windows үчүн Psiphon клиентинин нускасы: ",
-      "general#modal-close-button": "Жабуу",
-      "general#notice-modal-tech-preamble": "Техникалык ката маалыматы:",
-      "notice#systemproxysettings-setproxy-error-title": "Системалык прокси катасы",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon системдин прокси баптоолорун койо албай койду.</p>\n<p>Бул сиздин антивирустук программаңыз менен конфликттен болушу мүмкүн. Жергиликтүү Psiphon проксилерин колдонуу үчүн колдонмоңуздун же болбосо системанын прокси баптоолорун кол менен конфигурациялоо керек болушу мүмкүн.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” деп аталган Интернет байланышы үчүн системалык прокси баптоолорун койо албай койду . Бул сиздин антивирустук программаңыз менен келишпестиктен болушу мүмкун. Жергиликтүү Psiphon проксилерин колдонуу үчүн колодонмоңуздун же системалык прокси баптоолорун кол менен конфигурациялоо керек болушу мүмкүн.",
-      "appbackend#state-stopped-title": "Psiphon ажыратылды",
-      "appbackend#state-starting-title": "Psiphon байланышууда",
-      "appbackend#state-starting-body": "Сураныч, күтө туруңуз...",
-      "appbackend#state-connected-title": "Psiphon байланышты",
-      "appbackend#state-connected-body": "Өз чек араларыңыздан ашып изилдеңиз!",
-      "appbackend#state-connected-reminder-title": "Psiphon сизди байланышта кармап турат",
-      "appbackend#state-connected-reminder-body": "Psiphon-ду эркин кармаңыз. Биздин демөөрчүлөрүбүздүн баракчаларына кирүү үчүн бул жерди басыңыз!",
-      "appbackend#state-connected-reminder-body-2": "Биздин демөөрчүлөрүбүздүн беттерине кирүү аркылуу Psiphon-ду эркин кармаңыз!",
-      "appbackend#minimized-to-systray-title": "Psiphon билдирүүлөр аймагына кичирейтилди",
-      "appbackend#minimized-to-systray-body": "Колдонмону калыбына келтирүү үчүн сүрөтчөнү басыңыз",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Демөөрлөндү"
-    }
-  },
-  "my": {
-    "name": "မြန်မာဘာသာ",
-    "translation": {
-      "banner#long-connecting": "<strong>အို မဟုတ်ဘူး</strong>သင့်မှာ ချိတ်ဆက်မှုနှင့် ပတ်သတ်သည့် ပြဿနာရှိနေသည်ဟု ထင်ပါသည်။<br>\nPsiphon ၏နောက်ဆုံးဗားရှင်းကို <a class=\"NewVersionURL\" href=\"#\">ဒေါင်းလုပ်ဆွဲရမည့်နေရမှ</a>ဒေါင်းလုပ်လုပ်ပါ။\nသို့မဟုတ် <a class=\"NewVersionEmail\" href=\"#\"></a>အီးမေးလ်ပေးပို့ပါ။ ",
-      "nav#connection#starting": "ချိတ်ဆက်နေပါသည်",
-      "nav#connection#connected": "ချိတ်ဆက်ပြီးပါပြီ",
-      "nav#connection#stopping": "ချိတ်ဆက်မှုဖြတ်တောက်နေပါသည်",
-      "nav#connection#stopped": "ချိတ်ဆက်မှုဖြတ်တောက်ပြီးပါပြီ",
-      "nav#settings": "အပြင်အဆင်များ",
-      "nav#feedback": "အကြံပြုချက်",
-      "nav#logs": "မှတ်တမ်းများ",
-      "nav#about": "အကြောင်း",
-      "connection#starting-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်နေပါသည်</span>...",
-      "connection#stop-btn": "ရပ်ရန်",
-      "connection#connected-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်ပြီးပါပြီ</span>",
-      "connection#disconnect-btn": "ချိတ်ဆက်မှုဖြတ်တောက်ရန်",
-      "connection#stopping-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်မှုဖြတ်တောက်နေပါသည်</span> ...",
-      "connection#wait-btn": "ကျေးဇူး၍ ​ခေတ္တစောင့်ပါ...",
-      "connection#stopped-msg": "Psiphon သည် <span class=\"state-word\">ချိတ်ဆက်မှုဖြတ်တောက်ပြီးပါပြီ</span>",
-      "connection#connect-btn": "ချိတ်ဆက်ရန်",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>မှားယွင်းနေသည်</strong>ကျေးဇူးပြု၍ဆက်လက်လုပ်ဆောင်ခြင်းမပြုမီ မှန်ကန်မှုမရှိသော တန်ဖိုးများကိုပြင်ပါ။",
-      "settings#reset-button": "မူလပုံစံပြန်ထားရန်",
-      "settings#apply-button": "ပြောင်းလဲမှုများကို လုပ်ဆောင်ပါ",
-      "settings#unapplied-changes-prompt#title": "အပြင်အဆင်များပြောင်းလဲပြီးပါပြီ",
-      "settings#unapplied-changes-prompt#body": "သင်၏အပြင်အဆင်များထဲတွင် ပြောင်းလဲပြီးသော်လည်း ပြောင်းလဲမှုများ သက်ရောက်အောင် မလုပ်ဆောင်ရသေးပါ။ <br><br> သင့်အနေဖြင့် ပြောင်းလဲမှုများကို သက်ရောက်မှုရှိရန်လုပ်ဆောင်လိုပါသလား၊ သို့မဟုတ် လျစ်လျူရှုလိုပါသလား။",
-      "settings#unapplied-changes-prompt#apply-button": "သက်ရောက်မှုရှိအောင်လုပ်ဆောင်ရန်",
-      "settings#unapplied-changes-prompt#discard-button": "လျစ်လျူရှုရန်",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec ပုံစံနှင့်အလုပ်မလုပ်ပါ)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Tunnel ကိုခွဲထုတ်ရန်",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "သင်၏နိုင်ငံအတွင်းတွင် ဝက်ဆိုက်ဒ်များကို အင်တာနက်ကြားခံ ခံ၍အသုံးမပြုပါနှင့်။",
-      "settings#disable-timeouts#heading": "နှေးသောအင်တာနက်ကွန်ယက်များအတွက် အချိန်သတ်မှတ်ချက်ကို အသုံးမပြုနိုင်အောင်ပြုလုပ်ရန်",
-      "settings#disable-timeouts#help-text": "အကယ်၍အသုံးပြုနိုင်အောင်ပြုလုပ်ထားပါက Psiphon ဆာဗာနှင့် ပြန်ကြားဆက်သွယ်မှုများသည် အချိန်သတ်မှတ်ချက် ရှိမည်မဟုတ်ပါ။",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "နှေးသောအင်တာနက်ကွန်ယက်များအတွက် အချိန်သတ်မှတ်ချက်ကို အသုံးမပြုနိုင်အောင်ပြုလုပ်ရန်",
-      "settings#egress-region#heading": "Psiphon ဆာဗာရှိရာဒေသ",
-      "settings#egress-region#select-best-performance": "အကောင်းဆုံးလုပ်ဆောင်မှု",
-      "settings#egress-region#select-us": "အမေရိကန်ပြည်ထောင်စု",
-      "settings#egress-region#select-ca": "ကနေဒါ",
-      "settings#egress-region#select-gb": "ယူကေ",
-      "settings#egress-region#select-jp": "ဂျပန်",
-      "settings#egress-region#select-sg": "စင်္ကာပူ",
-      "settings#egress-region#select-sk": "ဆလိုဗာကီးယား",
-      "settings#egress-region#select-nl": "နယ်သာလန်",
-      "settings#egress-region#select-de": "ဂျာမဏီ",
-      "settings#egress-region#select-in": "အိန္ဒိယ",
-      "settings#egress-region#select-es": "စပိန်",
-      "settings#egress-region#select-hk": "ဟောင်ကောင်",
-      "settings#egress-region#select-at": "သြစတြီးယား",
-      "settings#egress-region#select-be": "ဘယ်လ်ဂျီယမ်",
-      "settings#egress-region#select-bg": "ဘူလ်ဂေးရီးယား",
-      "settings#egress-region#select-ch": "ဆွစ်ဇာလန်",
-      "settings#egress-region#select-cz": "ချက်ဗ်",
-      "settings#egress-region#select-dk": "ဒိန်းမတ်",
-      "settings#egress-region#select-fr": "ပြင်သစ်",
-      "settings#egress-region#select-hu": "ဟန်ဂေရီ",
-      "settings#egress-region#select-it": "အီတလီ",
-      "settings#egress-region#select-no": "နော်ဝေ",
-      "settings#egress-region#select-ro": "ရိုမေးနီးယား",
-      "settings#egress-region#select-se": "ဆွီဒင်",
-      "settings#egress-region#select-pl": "ပိုလန်",
-      "settings#egress-region#select-rs": "ဆားဘီးယား",
-      "settings#egress-region#select-au": "သြစတြေးလျ",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "ဆီလျော်သော Psiphon ဆာဗာဒေသကိုရွေးချယ်ရန်။",
-      "settings#egress-region#error-modal-title": "ဆာဗာဒေသမရှိနိုင်ပါ",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "အလိုအလျောက် port ရွေးချယ်မှုနေရာတွင် <strong>ကွက်လပ်</strong>ချန်ထားခဲ့ပါ (ရန် အကြံပြုပါသည်)။",
-      "settings#local-proxy-ports#reason": "အကယ်၍ Psiphon အသုံးပြုရန်အတွက် သင်၏ကွန်ပျူတာသည် ကိုယ်တိုင်ကိုယ်ကျ ရွေးချယ်သတ်မှတ်ပြင်ဆင်ပေးရန်လိုအပ်ပါက သင်သည် တူညီသည့် local port နံပါတ်များ ဆက်လက်ရွေးချယ်ပေးရန်လိုသည်။ အကယ်၍သင်သည် port နံပါတ်များရွေးချယ်သတ်မှတ်ရန် မလိုအပ်ပါက ပဋိပက္ခများရှောင်ရှားရန်အတွက် Psiphon ကိုအလိုအလျောက်ရွေးချယ်ခွင့်ပြုသင့်သည်။",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "၁ နှင့် ၆၅၅၃၅ ကြားအတွင်းရှိရမည်။ ",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "local port များသည် တစ်ခုနှင့်တစ်ခုကွဲပြားနေရမည်။",
-      "settings#local-proxy-ports#error-modal-title": "local ကြားခံအင်တာနက် Port ပဋိပက္ခ",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nသင်သည် Psiphon ကို သူ၏ HTTP ကြားခံအတွက် local port အသုံးပြုရန် ချိန်ညှိပြီးပါပြီ။<br>\nသို့သော်လည်း ထို port သည် အသုံးပြုနှင့်ပြီးသားဖြစ်နေသောကြောင့် Psiphon အနေဖြင့် ထို port ကိုအသုံးပြု၍မရပါ။\n</p>\n<p>\nကျေးဇူးပြု၍ HTTP ကြားခံ port ရှိတန်ဖိုးများကိုပြောင်းလဲသတ်မှတ်ပြီး နောက်တစ်ကြိမ် ထပ်မံကြိုးစားကြည့်ပေးပါ။ Psiphon အနေဖြင့် ရရှိနိုင်သော port ကို အလိုအလျောက်ရွေးချယ်နိုင်စေရန်အတွက် တန်ဖိုးများကိုရှင်းလင်းပေးရန် အကြံပြုလိုပါသည်။\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nသင်သည် Psiphon ကို သူ၏ SOCKS ကြားခံအတွက် local port အသုံးပြုမည်ဟု ချိန်ညှိထားပါသည်။<br>\nသို့သော်လည်း ထို port သည် အသုံးပြုနေနှင့်ပြီးသောကြောင့် Psiphon အနေဖြင့် ထို port ကို အသုံးပြု၍ မရပါ။\n</p>\n<p>\nကျေးဇူးပြု၍ SOCKS ကြားခံ port ရှိ တန်ဖိုးများသတ်မှတ်ထားမှုကို ပြောင်းလဲပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားပေးပါ။ Psiphon အနေဖြင့် ရရှိနိုင်သော port ကို အလိုအလျောက်ရွေးချယ်နိုင်စေရန်အတွက် တန်ဖိုးများကို ရှင်းလင်းပေးရန် အကြံပြုလိုပါသည်။\n</p>",
-      "settings#upstream-proxy#heading": "အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ",
-      "settings#upstream-proxy#by-default": "အကယ်၍ သင်၏ကွန်ပျူတာတွင် အင်တာနက်ကြားခံကို သတ်မှတ်ပြီးပါက စက်တစ်ခုလုံးချိတ်ဆက်သည့် ပုံစံတွင် Psiphon သည် ထိုကြားခံကို  ကြိုတင်သတ်မှတ်ထားသည့်ပုံစံဖြင့် ရွေးချယ်ပါလိမ့်မည်။ အသုံးပြုမည့် ကြားခံတစ်ခုအား ရွေးချယ်သတ်မှတ်ပေးခြင်း သို့မဟုတ် ထိုကဲ့သို့သော ကြားခံအားအသုံးမပြုဟု ရွေးချယ်သတ်မှတ်ပေးခြင်းဖြင့် အထက်ပါပုံစံကို ပြောင်းလဲနိုင်သည်။ ",
-      "settings#upstream-proxy#reason": "အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံများကို တခါတရံတွင် ကျောင်းများ၊ တက္ကသိုလ်များ သို့မဟုတ် စီးပွါးရေးလုပ်ငန်းများက လိုအပ်လေ့ရှိသည်။ အကယ်၍ သင်၏ကွန်ယက်ကိုထောက်ပံ့သူသည် အင်တာနက်အားချိတ်ဆက်ရန် ကြားခံအတွက် အပြင်အဆင်ကိုပေးထားပါက ချိတ်ဆက်ရန်အတွက် ကိုယ်တိုင်ကိုယ်ကျ ပြန်လည်ပြင်ဆင်ပေးရန် လိုအပ်သည်။",
-      "settings#upstream-proxy#proxy-reqs": "HTTPS ကို အထောက်အပံ့ပေးနိုင်သော HTTP ကြားခံများကိုသာ ခွင့်ပြုသည်။ ",
-      "settings#upstream-proxy#hostname-label": "Hostname",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "အသုံးပြုသူအမည်",
-      "settings#upstream-proxy#password-label": "စကားဝှက်",
-      "settings#upstream-proxy#domain-label": "ဒိုမိန်း",
-      "settings#upstream-proxy#skip-label": "အင်တာနက်အားချိတ်ဆက်ရန် ကြားခံ အသုံးမပြုပါနှင့်",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "အင်တာနက်အားချိတ်ဆက်ပေးသည့် ကြားခံတွင် ပြဿနာတက်နေသည်",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon သည် လက်ရှိအချိန်တွင် သင့်စက်တွင်ပါဝင်သော ကြားခံကို \"အင်တာနက်အား ချိတ်ဆက်ရန်ကြားခံ\" အဖြစ်မှတ်ယူထားပါသည်။ <br>\nသို့သော်လည်း ထိုကြားခံကို ဖြတ်၍ Psiphon ဆာဗာတစ်ခုခုအား ချိတ်ဆက်မရနိုင် ဖြစ်နေသည်ဟု ယူဆပါသည်။<br>\nကျေးဇူးပြု၍ \"အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ အသုံးမပြုပါ။\" ကို ရွေးချယ်ပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားကြည့်ပါ။",
-      "settings#upstream-proxy#error-modal-body-configured": "သင်သည် Psiphon တွင် \"အင်တာနက်အား ချိတ်ဆက်ရန် ကြားခံ\" အသုံးပြုမည်ဟု ချိန်ညှိထားပါသည်။<br>\nသို့သော်လည်း ထိုကြားခံကို အဖြတ်၍ Psiphon ဆာဗာတစ်ခုခုအား ချိတ်ဆက်မရနိုင်ဖြစ်နေသည်ဟု ယူဆပါသည်။<br>\nကျေးဇူးပြု၍ အပြင်အဆင်တွင်ပြောင်းလဲပြီး နောက်တစ်ကြိမ်ထပ်မံကြိုးစားကြည့်ပါ။",
-      "settings#transport-mode#heading": "သယ်ယူပို့ဆောင်ရေးပုံစံအနေအထား",
-      "settings#transport-mode#check-label": "L2TP/IPSec ပုံစံကိုအသုံးပြုမည်",
-      "settings#transport-mode#help-text": "ဝင်းဒိုးရှိ L2TP/IPSec virtual ကွန်ယက်ချိတ်ဆက်မှုကို အသုံးပြုပါ။ ဤပုံစံသည် သင်၏ app များအားလုံး Psiphon ကိုဖြတ်၍ လှိုင်ခေါင်းသဖွယ်ချိတ်ဆက်လိုက်မည်ဖြစ်သော်လည်း နားမလည်နိုင်အောင်ပြုလုပ်လိုက်ခြင်းမဟုတ်သောကြောင့် ဆင်ဆာဖြတ်တောက်မှုစွမ်းရည်ခိုင်မာမှုမရှိချေ။ ထိုကြောင်း ၎င်းနည်းကို firewall အများစုအား ဖြတ်ကျော်ရန်အတွက် <strong>အားမပေးပါ</strong>။",
-      "settings#systray-minimize#heading": "အချက်ပြဧရိယာအတွင်းသို့ချုံ့ပါ (System Tray)",
-      "settings#systray-minimize#help-text": "အကယ်၍အသုံးပြုနိုင်အောင်ပြုလုပ်ထားပါက ချုံ့ထားသည့်အချိန်အတွင်း Psiphon application ဝင်းဒိုးသည် အချက်ပြဧရိယာ (ဝင်းဒိုး  task bar ပေါ်ရှိ နာရီအနီးတွင်ရှိသော “system tray” သို့မဟုတ် “systray” ဟုလည်းသိကြသည်) အတွင်းတွင် ပုံးကွယ်နေပါလိမ့်မည်။ ",
-      "settings#systray-minimize#reason": "Psiphon ကို အချက်ပြဧရိယာ (“system tray”) အတွင်းသို့ချုံ့ခြင်းသည် သင်၏ task bar အတွင်းရှိနေရာများကိုလွတ်သွားစေသည်။ အထူးသဖြင့် သင်သည် Psiphon ကိုအချိန်ကြာမြင့်စွာဖွင့်ထားလေ့ရှိပါက အသုံးဝင်သည်။ ",
-      "settings#systray-minimize#enable-label": "အချက်ပြဧရိယာအတွင်းသို့ချုံ့ရန် (system tray)",
-      "settings#applying-message": "အပြင်အဆင်များပေါ်တွင် သက်ရောက်မှုရှိရန် ပြန်လည်ချိတ်ဆက်ပေးနေပါသည်။",
-      "settings#saved-message": "အပြင်အဆင်များ သိမ်းဆည်းပြီးပါပြီ။",
-      "settings#error-modal#title": "အပြင်အဆင်များ မှားယွင်းမှု",
-      "settings#error-modal#body": "သင်၏ အပြင်အဆင်များတန်ဖိုးထဲတွင် မှားယွင်းမှုများပါနေပါသည်။ ကျေးဇူးပြု၍ ဆက်လက်မလုပ်ဆောင်မီ ပြင်ပေးပါ။",
-      "feedback#top_content_title": "သင်၏ထင်မြင်အကြံပြုချက်ပေးရန်",
-      "feedback#top_para_2": "နောက်ဆုံးဗားရှင်းကိုဒေါင်းလုပ္လုပ်ခြင်းဖြင့် ပြဿနာအများစုကို ဖြေရှင်းနိုင်ပါသည်။ <a class=\"NewVersionURL\" href=\"#\">နောက်ဆုံး ဗားရှင်းကို ဒီမှာ ကလစ်နှိပ်ခြင့်ဖြင့်</a> သို့မဟုတ် <a class=\"NewVersionEmail\" href=\"#\"></a> သို့အီးမေးလ်ပို့ခြင်းဖြင့် ရယူနိုင်ပါသည်။",
-      "feedback#top_para_3": "<a class=\"FaqURL\" href=\"#\">မကြာခဏမေးလေ့ရှိသောမေးခွန်းများ</a> ထဲတွင် ကြုံရလေ့ရှိသောအခက်အခဲများအတွက် ဖြေရှင်းနည်းများကို တွေ့ရှိနိုင်ပါသည်။",
-      "feedback#smiley_happy": "ကျွနု်ပ်လိုချင်သည့်ပုံစံအတိုင်း Psiphon သည် ချိတ်ဆက်ပြီးလုပ်ဆောင်နေပါသည်။",
-      "feedback#smiley_sad": "Psiphon သည်မကြာခဏဆိုသလို ချိတ်ဆက်မှုပြတ်တောက်သည် သို့မဟုတ် ကောင်းမွန်စွာမလုပ်ဆောင်ပါ။",
-      "feedback#text_feedback_prompt": "သင်၏ထင်မြင်ယူဆချက်ကိုဒီမှာရေးပါ :",
-      "feedback#text_feedback_email_prompt": "အကယ်၍ သင့်ကိုအကြောင်းပြန်စေလိုပါက ကျေးဇူးပြု၍ သင်၏အီးမေးလ်လိပ်စာကိုထည့်ပါ :",
-      "feedback#diagnostic_check": "စစ်ဆေးထားသောအချက်အလက်ဒေတာများကို တင်ပါ။ ထိုဒေတာများသည် သင်မည်သူမည်ဝါဖြစ်ကြောင်းမဖေါ်ပြနိုင်ပါ၊ Psiphon ကို အဆင်ပြေချောမွေ့စွာ လည်ပတ်နိုင်ရန်အတွက် ကူညီပေးခြင်းသာ ဖြစ်သည်။ <a class=\"DataCollectionInfoURL\" href=\"#\">ကျွနု်ပ်တို့ မည်သည့် အချက်အလက်ဒေတာများ ကောက်ယူသည်ကို သိရှိရန်ဒီမှာနှိပ်ပါ။</a>",
-      "feedback#submit_button": "တင်သွင်းပါ။",
-      "feedback#text_feedback_bottom_para": "အကယ်၍ အထက်ပါဖောင်ပုံစံသည် အလုပ်မလုပ်ပါက သို့မဟုတ် သင်သည် screenshot များကို ပို့လိုပါက ကျေးဇူးပြု၍ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ထံအီးမေးလ်ပို့ပါ။",
-      "feedback#success-message": "<strong>ကျေးဇူးတင်ပါတယ်</strong> သင့်ရဲ့ အကြံပြုချက်ကို ပေးပို့ပြီးပါပြီ။",
-      "logs#show-debug-label": "ဖယ်ရှားထားသောမှတ်တမ်းများပြရန်",
-      "logs#placeholder": "မှတ်တမ်းများမရှိပါ",
-      "language#success-message": "<strong>မင်္ဂလာပါ</strong> Psiphon မှကြိုဆိုပါတယ်။",
-      "about#wordart-tag": "နယ်စည်းမျဥ်းများကိုကျော်လွန်၍",
-      "about#description": "Psiphon သည် <strong>ဆင်ဆာဖြတ်တောက်မှုကိုကျော်လွှားသည့်ကိရိယာ</strong>တစ်ခုဖြစ်သည်။ လွတ်လပ်သည့်အင်တာနက်ကို ဆင်ဆာဖြတ်တောက်မှုများနှင့် firewall များအား ကျော်ဖြတ်၍ ရယူသုံးစွဲနိုင်ရန်အတွက် ဖန်တီးပြုလုပ်ထားခြင်းဖြစ်သည်။ Psiphon သည် <strong>မည်သူမဆိုရယူအသုံးပြုနိုင်သော ပွင့်လင်းအရင်းအမြစ်</strong>ဖြစ်ပြီး ကနေဒါနိုင်ငံ၊ တိုရိုတိုတွင် ဖန်တီးခဲ့ပါသည်။",
-      "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">ဗားရှင်းအသစ်ကိုဒေါင်းလုပ်လုပ်ရန်</a></strong>အတွက် သို့မဟုတ် <strong><a class=\"InfoURL\" href=\"#\">အကူအညီနှင့် သတင်းအချက်အလက်များ လက်ခံရယူရန်</a></strong>အတွက်ဝက်ဆိုက်ကိုကျေးဇူးပြု၍သွားပါ။ Psiphon ကို Android နှင့် Windows များအတွက်ရရှိနိုင်ပါသည်။",
-      "about#get-by-email": "<strong>အကယ်၍ဝက်ဆိုက်ကိုရယူ၍မရပါက</strong>Psiphon ဗားရှင်းအသစ်ကို ရယူရန် : သို့အီးမေးလ်ပေးပို့ ရယူနိုင်ပါသည်။",
-      "about#client-version": "ဝင်းဒိုးအသုံးပြုသူများအတွက် Psiphon ဗားရှင်း :",
-      "general#modal-close-button": "ပိတ်ရန်",
-      "general#notice-modal-tech-preamble": "ဤသည်မှာ နည်းပညာပိုင်းဆိုင်ရာ မှားယွင်းမှုအတွက် သတင်းအချက်အလက်:",
-      "notice#systemproxysettings-setproxy-error-title": "စက်ရှိ အင်တာနက်ကြားခံ ပြဿနာ",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon သည် စက်၏ ကြားခံအပြင်အဆင်များ သတ်မှတ်ခြင်း မအောင်မြင်ပါ။</p>\n<p>ဤသည်မှာသင်၏ antivirus software နှင့် ပဋိပက္ခဖြစ်နေခြင်းကြောင့် ဖြစ်နိုင်သည်။ သင်၏ application ကို ကိုယ်တိုင်ကိုယ်ကျ ချိန်ညှိသတ်မှတ်ပေးခြင်း သို့မဟုတ် စက်၏ ကြားခံအင်တာနက် အပြင်အဆင်များတွင် local Psiphon ၏ ကြားခံများ ထည့်သွင်းပြင်ဆင်ခြင်းများ ပြုလုပ်ပေးရန်လိုအပ်သည်။</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon သည်အင်တာနက်ချိတ်ဆက်မှု အမည် “<%- data %>”အတွက် စက်၏ ကြားခံအပြင်အဆင်များသတ်မှတ်ခြင်း မအောင်မြင်ပါ။ ဤသည်မှာသင်၏ antivirus software နှင့် ပဋိပက္ခဖြစ်နေခြင်းကြောင့် ဖြစ်နိုင်သည်။ သင်၏ application ကို ကိုယ်တိုင်ကိုယ်ကျ ချိန်ညှိသတ်မှတ်ပေးခြင်း သို့မဟုတ် စက်၏ ကြားခံအင်တာနက် အပြင်အဆင်များတွင် local Psiphon ၏ ကြားခံများ ထည့်သွင်းပြင်ဆင်ခြင်းများ ပြုလုပ်ပေးရန်လိုအပ်သည်။",
-      "appbackend#state-stopped-title": "Psiphon သည် ချိတ်ဆက်မှုမရှိပါ",
-      "appbackend#state-starting-title": "Psiphon သည် ချိတ်ဆက်နေပါသည်",
-      "appbackend#state-starting-body": "ကျေးဇူး၍ ခေတ္တစောင့်ပါ...",
-      "appbackend#state-connected-title": "Psiphon သည် ချိတ်ဆက်ပြီးပါပြီ",
-      "appbackend#state-connected-body": "သင့်နယ်စည်းမျဥ်းများကိုကျော်လွန်၍စူးစမ်းလေ့လာပါ။",
-      "appbackend#state-connected-reminder-title": "Psiphon သည် သင့်ကိုဆက်လက်ချိတ်ဆက် ပေးနေပါသည်",
-      "appbackend#state-connected-reminder-body": "Psiphon ကိုအခမဲ့ဆက်လက်အသုံးပြုခွင့်ပေးပါ။ ကျွနု်ပ်တို့ကို ငွေကြေးထောက်ပံ့ပေးထားသူများအား သိရှိရန်အတွက် ဒီမှာကလစ်နှိပ်ပါ။",
-      "appbackend#state-connected-reminder-body-2": "ကျွနု်ပ်တို့ကိုငွေကြေးထောက်ပံ့ပေးထားသူများ၏ စာမျက်နှာကို ဝင်ရောက်လည်ပါတ်ခြင်းဖြင့် Psiphon ကို အခမဲ့ဆက်လက်အသုံးပြုခွင့်ပေးပါ။",
-      "appbackend#minimized-to-systray-title": "Psiphon ကို အချက်ပြဧရိယာအတွင်းသို့ ချုံ့ပြီးပါပြီ",
-      "appbackend#minimized-to-systray-body": "Application ကိုပြန်လည်ရယူသိမ်းဆည်းရန်အတွက် ဤပုံကိုနှိပ်ပါ",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "ထောက်ပံ့ကူညီပေးသူ"
-    }
-  },
-  "nb": {
-    "name": "Norsk bokmål",
-    "translation": {
-      "banner#long-connecting": "<strong>Å nei!</strong> Det ser ut til at du har problemer! <br>\nLast ned nyeste versjon av Psiphon fra <a class=\"NewVersionURL\" href=\"#\">nedlastingssiden</a>\neller ved å sende en e-post til <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Kobler til",
-      "nav#connection#connected": "Tilkoblet",
-      "nav#connection#stopping": "Kobler fra",
-      "nav#connection#stopped": "Frakoblet",
-      "nav#settings": "Innstillinger",
-      "nav#feedback": "Tilbakemeldinger",
-      "nav#logs": "Loggføring",
-      "nav#about": "Om",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">kobler til</span>…",
-      "connection#stop-btn": "Stopp",
-      "connection#connected-msg": "Psiphon er <span class=\"state-word\">tilkoblet</span>…",
-      "connection#disconnect-btn": "Koble fra",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">kobler fra</span>…",
-      "connection#wait-btn": "Vent…",
-      "connection#stopped-msg": "Psiphon er <span class=\"state-word\">frakoblet</span>",
-      "connection#connect-btn": "Koble til",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Feil!</strong> Korriger de uriktige verdiene før du fortsetter.",
-      "settings#reset-button": "Tilbakestill til forvalg",
-      "settings#apply-button": "Legg til endringer",
-      "settings#unapplied-changes-prompt#title": "Innstillinger endret",
-      "settings#unapplied-changes-prompt#body": "Du har gjort endringer i innstillingene dine, men har ikke lagt dem til.<br><br>Ønsker du å legge til dine endringer nå eller forkaste dem?",
-      "settings#unapplied-changes-prompt#apply-button": "Legg til",
-      "settings#unapplied-changes-prompt#discard-button": "Forkast",
-      "settings#vpn-incompatible-msg": "(Virker ikke i L2TP/IPSec-modus.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Delt tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Ikke mellomtjen nettsider fra ditt land",
-      "settings#disable-timeouts#heading": "Skru av tidsavbrudd for trege nettverk",
-      "settings#disable-timeouts#help-text": "Hvis påskrudd, vil kommunikasjon med Psiphon-tjeneren ikke stoppe ved tidsavbrudd.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Skru av tidsavbrudd for trege nettverk",
-      "settings#egress-region#heading": "Region for Psiphon-tjener",
-      "settings#egress-region#select-best-performance": "Best ytelse",
-      "settings#egress-region#select-us": "Amerikas forente stater",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Storbritannia",
-      "settings#egress-region#select-jp": "Japan",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Nederland",
-      "settings#egress-region#select-de": "Tyskland",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spania",
-      "settings#egress-region#select-hk": "Hongkong",
-      "settings#egress-region#select-at": "Østerrike",
-      "settings#egress-region#select-be": "Belgia",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Sveits",
-      "settings#egress-region#select-cz": "Tsjekkia",
-      "settings#egress-region#select-dk": "Danmark",
-      "settings#egress-region#select-fr": "Frankrike",
-      "settings#egress-region#select-hu": "Ungarn",
-      "settings#egress-region#select-it": "Italia",
-      "settings#egress-region#select-no": "Norge",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Sverige",
-      "settings#egress-region#select-pl": "Polen",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Velg en gyldig adresse og region for Psiphon-tjener.",
-      "settings#egress-region#error-modal-title": "Tjenerregion utilgjengelig",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Lokale mellomtjener-porter",
-      "settings#local-proxy-ports#leave-blank": "La stå <strong>tom</storng> for automatisk portvalg (anbefales).",
-      "settings#local-proxy-ports#reason": "Hvis du bruker verktøy på din datamaskin som krever manuelt oppsett for å virke med Psiphon, blir ting mye enklere hvis Psihpon alltid bruker lokale portnummer. Hvis du ikke har en grunn til å angi portnummer bør du la Psiphon velge dem automatisk for å unngå konflikter.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Må være et tall fra 1 til 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Lokale porter må være unike",
-      "settings#local-proxy-ports#error-modal-title": "Problem med lokal mellomtjenerport",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nDu har satt opp Psiphon til å bruke en spesifikk port for dets HTTP-mellomtjener.<br>\nDog, den porten later til å allerede være i bruk, så Psiphon kan ikke bruke den.\n</p>\n<p>\nEndre den oppsatte HTTP-portverdien og prøv igjen. Det anbefales at du tømmer feltet slik at Psiphon automatisk kan velge en tilgjengelig port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nDu har satt opp Psiphon til å bruke en spesifikk port for dets SOCKS-mellomtjener.<br>\nDog, den porten later til å allerede være i bruk, så Psiphon kan ikke bruke den.\n</p>\n<p>\nEndre den oppsatte SOCKS-portverdien og prøv igjen. Det anbefales at du tømmer feltet slik at Psiphon automatisk kan velge en tilgjengelig port.\n</p>",
-      "settings#upstream-proxy#heading": "Oppstrømsmellomtjener",
-      "settings#upstream-proxy#by-default": "Hvis din datamaskin allerede har en mellomtjener satt opp vil Psiphon som forvalg bruke den mellomtjeneren til etablering av en tunnel. Du kan overstyre den oppførselen ved å oppgi en mellomtjener, eller ved å oppgi at ingen slik \"oppstrømsmellomtjener\" skal brukes.",
-      "settings#upstream-proxy#reason": "Oppstrømsmellomtjenere kreves noen ganger av skoler, universiteter eller forretninger. Hvis din nettverkstilbyder har gitt deg innstillinger til en oppstrømsmellomtjener, så kan det være at å manuelt skrive dem inn her er det som kreves for å koble til.",
-      "settings#upstream-proxy#proxy-reqs": "Bare HTTP-mellomtjenere som støtter HTTPS er tillatt.",
-      "settings#upstream-proxy#hostname-label": "Vertsnavn",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Brukernavn",
-      "settings#upstream-proxy#password-label": "Passord",
-      "settings#upstream-proxy#domain-label": "Domene",
-      "settings#upstream-proxy#skip-label": "Ikke bruk oppstrømsmellomtjener",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Feil med oppstrømsmellomtjener",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon er satt opp til å bruke ditt systems mellomtjener som sin \"oppstrømstjener\".<br>\nDog, lar det seg ikke gjøre å koble til noen Psiphon-tjener på den mellomtjeneren.<br>\nSkru på \"Ikke bruk oppstrømsmellomtjener\" og prøv igjen.",
-      "settings#upstream-proxy#error-modal-body-configured": "Du har satt opp Psiphon til å bruke en \"oppstrømstjener\".<br>\nDog, lar det seg ikke gjøre å koble til noen Psiphon-tjener på den mellomtjeneren.<br>\nFiks innstillingene og prøv igjen.",
-      "settings#transport-mode#heading": "Transport-modus",
-      "settings#transport-mode#check-label": "Bruk L2TP/IPSec modus",
-      "settings#transport-mode#help-text": "Bruker Windows L2TP/IPSec virtuelt nettverk. Dette moduset vil sende alle dine programmer gjennom en tunnel, men legger ikke til et tilfeldig lag, så det har ikke sterke omgåelsesevner. Det er <strong>ikke anbefalt</strong> for forbigåelse av de fleste brannmurer.",
-      "settings#systray-minimize#heading": "Minimer til varslingsområde (systemkurv)",
-      "settings#systray-minimize#help-text": "Hvis påskrudd, vil programvinduet til Psiphon bli gjemt i varslingsområdet (systemkurven) når det er minimert, ved siden av klokka i oppgavelinjen til Windows.",
-      "settings#systray-minimize#reason": "Minimering av Psiphon til varslingsområdet (\"systemkurven\") frigir plass på oppgavelinjen. Dette er spesielt hjelpsomt hvis du ofte kjører Psiphon lenge av gangen.",
-      "settings#systray-minimize#enable-label": "Minimer til varslingsområde (systemkurv)",
-      "settings#applying-message": "Kobler til på nytt for at endringene skal trå i kraft.",
-      "settings#saved-message": "Innstillingene ble lagret.",
-      "settings#error-modal#title": "Innstillingsfeil",
-      "settings#error-modal#body": "Det er feil i dine innstillingsverdier. Korriger dem før du fortsetter.",
-      "feedback#top_content_title": "Gi oss din tilbakemelding",
-      "feedback#top_para_2": "Mange problemer løses ved å laste ned seneste versjon. Du kan last ned <a class=\"NewVersionURL\" href=\"#\">seneste versjon</a>, eller du kan sende en e-post til <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Du kan finne svar på mange vanlige problemer i vår oversikt over\n<a class=\"FaqURL\" href=\"#\">Ofte-Stilte-Spørsmål</a>.",
-      "feedback#smiley_happy": "Psiphon kobler til og fungerer slik jeg ønsker det.",
-      "feedback#smiley_sad": "Psiphon klarer ikke og koble til eller fungerer ikke bra nok.",
-      "feedback#text_feedback_prompt": "Kommenter her:",
-      "feedback#text_feedback_email_prompt": "Hvis du ønsker at vi svarer deg, legg ved din e-postadresse:",
-      "feedback#diagnostic_check": "Last opp diagnostisk data. Bit deg merke i at denne diagnostikk-dataen ikke\nidentifiserer deg, og at du på denne måten kan hjelpe oss å holde Psiphon-hjulene i knirkefritt gjenge.\n<a class=\"DataCollectionInfoURL\" href=\"#\">Trykk her for å se hva vi samler inn.</a>",
-      "feedback#submit_button": "Send inn",
-      "feedback#text_feedback_bottom_para": "Hvis overstående skjema ikke virker, eller du vil dele skjermbilder med oss, send e-post til <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Takk!</strong> Din tilbakemelding har blitt sendt.",
-      "logs#show-debug-label": "Vis feilrettingslogg",
-      "logs#placeholder": "Ingen loggføring enda",
-      "language#success-message": "<strong>Heia.</strong> Velkommen til Psiphon.",
-      "about#wordart-tag": "Grenseløs",
-      "about#description": "Psiphon er et <strong>sensuromgåelsesverktøy</strong> — det er designet for å gi tilgang til det åpne Internett, forbi sensurorganer og brannmurer. Det er <strong>friprog</strong> utviklet i Toronto, Kanada.",
-      "about#visit-download-site": "Besøk nettsiden for å laste ned en<strong><a class=\"NewVersionURL\" href=\"#\">ny versjon</a></strong> eller for å <strong><a class=\"InfoURL\" href=\"#\">få hjelp og informasjon</a></strong>. Psiphon er tilgjengelig både for Android og Windows.",
-      "about#get-by-email": "<strong>Hvis nettsiden ikke kan nås</strong>, kan du hente en ny versjon av Psiphon ved å sende e-post til:",
-      "about#client-version": "Psiphon for Windows, klientversjon:",
-      "general#modal-close-button": "Lukk",
-      "general#notice-modal-tech-preamble": "Teknisk info om feilen:",
-      "notice#systemproxysettings-setproxy-error-title": "Feil med systemmellomtjener",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon klarte ikke å sette systemets mellomtjenerinnstillinger.</p>\n<p>Dette kan være som følge av en konflikt med din antivirusprogramvare. Det kan hende du må sette opp ditt program eller mellomtjener manuelt til bruk med de lokale Psiphon-mellomtjenerne.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "<p>Psiphon klarte ikke å sette systemets mellomtjenerinnstillinger for Internettilkoblingen ved navn “<%- data %>. Dette kan være som følge av en konflikt med din antivirusprogramvare. Det kan hende du må sette opp ditt program eller mellomtjener manuelt til bruk med de lokale Psiphon-mellomtjenerne.",
-      "appbackend#state-stopped-title": "Psiphon er frakoblet",
-      "appbackend#state-starting-title": "Psiphon kobler til",
-      "appbackend#state-starting-body": "Vent…",
-      "appbackend#state-connected-title": "Psiphon er tilkoblet",
-      "appbackend#state-connected-body": "Grenseløs utforskning!",
-      "appbackend#state-connected-reminder-title": "Psiphon holder kontakten for deg",
-      "appbackend#state-connected-reminder-body": "Behold Priphon gratis. Klikk her for å besøke våre sponsorsider.",
-      "appbackend#state-connected-reminder-body-2": "Behold Psiphon gratis ved å besøke våre sponsorsider.",
-      "appbackend#minimized-to-systray-title": "Psiphon har blitt minimert til varslingsområdet",
-      "appbackend#minimized-to-systray-body": "Klikk ikonet for å gjenopprette programmet",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 time",
-      "psicash#1-day": "1 dag",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponset av"
-    }
-  },
-  "nl": {
-    "name": "Nederlands",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh nee!</strong> Je lijkt moeite te hebben met verbinden!<br>\nDownload de laatste versie van Psiphon van de <a class=\"NewVersionURL\" href=\"#\">download site</a>\nof stuur een email naar <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Verbinden",
-      "nav#connection#connected": "Verbonden",
-      "nav#connection#stopping": "Verbreek",
-      "nav#connection#stopped": "Verbroken",
-      "nav#settings": "Instellingen",
-      "nav#feedback": "Feedback",
-      "nav#logs": "Logbestanden",
-      "nav#about": "Over",
-      "connection#starting-msg": "Psiphon is aan het <span class=\"state-word\">verbinden</span>…",
-      "connection#stop-btn": "Stop",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">verbonden</span>",
-      "connection#disconnect-btn": "Verbreek",
-      "connection#stopping-msg": "Psiphon is aan het <span class=\"state-word\">verbreken</span>…",
-      "connection#wait-btn": "Wacht A.u.b.",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">verbroken</span>",
-      "connection#connect-btn": "Verbind",
-      "connection#egress-region-combo-label": "Selecteer een server regio",
-      "settings#error-alert": "<strong>Fout!</strong> A.u.b Corrigeer onjuiste waarden alvorens verder te gaan.",
-      "settings#reset-button": "Standaardinstellingen",
-      "settings#apply-button": "Wijzigingen Toepassen",
-      "settings#unapplied-changes-prompt#title": "Instellingen Gewijzigd",
-      "settings#unapplied-changes-prompt#body": "Je hebt wijzigingen aangebracht in de instellingen, maar je hebt niet de veranderingen toegepast.<br><br>Wilt u uw wijzigingen nu toepassen of afwijzen?",
-      "settings#unapplied-changes-prompt#apply-button": "Toepassen",
-      "settings#unapplied-changes-prompt#discard-button": "Afwijzen",
-      "settings#vpn-incompatible-msg": "(Werkt niet met L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "Indien ingeschakeld, worden verzoeken aan servers in uw thuisland niet getunneld via Psiphon.",
-      "settings#split-tunnel#reason": "Websites in uw thuisland zijn over het algemeen niet geblokkeerd, dus als u deze optie inschakelt, krijgt u sneller toegang tot die sites en kunt u soms de kosten voor ISP-gegevensgebruik verlagen.",
-      "settings#split-tunnel#enable-label": "Geen proxy websites in uw land",
-      "settings#disable-timeouts#heading": "Uitschakelen Time-outs Voor Trage Netwerken",
-      "settings#disable-timeouts#help-text": "Indien ingeschakeld, de communicatie met de Psiphon server geen time-out.",
-      "settings#disable-timeouts#reason": "Als u dit inschakelt voor een zeer trage netwerkverbinding, is de kans kleiner dat u onverwachte verbroken verbindingen ervaart.",
-      "settings#disable-timeouts#enable-label": "Uitschakelen time-outs voor trage netwerken",
-      "settings#egress-region#heading": "Psiphon Regio Server",
-      "settings#egress-region#select-best-performance": "Beste Prestaties",
-      "settings#egress-region#select-us": "Verenigde Staten",
-      "settings#egress-region#select-ca": "Canada",
-      "settings#egress-region#select-gb": "Verenigd Koningkrijk",
-      "settings#egress-region#select-jp": "Japan",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovakije",
-      "settings#egress-region#select-nl": "Nederland",
-      "settings#egress-region#select-de": "Duitsland",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Spanje",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Oostenrijk",
-      "settings#egress-region#select-be": "Belgie",
-      "settings#egress-region#select-bg": "Bulgarije",
-      "settings#egress-region#select-ch": "Zwitserland",
-      "settings#egress-region#select-cz": "Tsjechische Republiek",
-      "settings#egress-region#select-dk": "Denemarken",
-      "settings#egress-region#select-fr": "Frankrijk",
-      "settings#egress-region#select-hu": "Hongarije",
-      "settings#egress-region#select-it": "Italië",
-      "settings#egress-region#select-no": "Noorwegen",
-      "settings#egress-region#select-ro": "Roemenië",
-      "settings#egress-region#select-se": "Zweden",
-      "settings#egress-region#select-pl": "Polen",
-      "settings#egress-region#select-rs": "Servië",
-      "settings#egress-region#select-au": "Australië",
-      "settings#egress-region#description": "Psiphon heeft servers in veel verschillende landen en regio's. Het gebruik van een Psiphon-server in een regio dicht bij uw thuisland levert over het algemeen een betere netwerkverbinding op, maar u wilt wellicht toegang krijgen tot websites en services alsof u zich virtueel in een bepaald land of regio bevindt.",
-      "settings#egress-region#default": "Door de standaardoptie <strong>\"Beste prestaties\"</strong> te kiezen, kan Psiphon automatisch een server kiezen, wat doorgaans resulteert in de beste netwerkverbinding.",
-      "settings#egress-region#invalid-error-msg": "Kies een geldige Psiphon regio server.",
-      "settings#egress-region#error-modal-title": "Regio Server Niet Beschikbaar",
-      "settings#egress-region#error-modal-body-http": "Je hebt Psiphon geconfigureerd om een server in een specifieke regio te gebruiken.<br>\nDie regio is echter niet meer beschikbaar.<br>\nU moet een nieuwe regio kiezen of overschakelen naar de standaardkeuze \"Beste prestaties\".",
-      "settings#local-proxy-ports#heading": "Lokale Proxy Poorten",
-      "settings#local-proxy-ports#leave-blank": "Laat <strong>leeg</strong> voor automatische poort selectie (aanbevolen).",
-      "settings#local-proxy-ports#reason": "Als u hulpmiddelen gebruik op uw computer die handmatige configuratie nodig hebben om te werken met Psiphon, wil je dat Psiphon op hetzelfde lokale poortnummers gebruik gaat maken. Als je niet heb’t een reden om poortnummers op te geven, u moet Psiphon toestaan om ze automatisch te laten kiezen om conflicten te vermijden.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Moet zijn tussen 1 en 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Lokale poorten moeten worden onderscheiden van elkaar.",
-      "settings#local-proxy-ports#error-modal-title": "Lokale Proxy Poort Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nJe hebt Psiphon geconfigureerd om een specifieke lokale poort te gebruiken voor zijn HTTP proxy.<br>\nEchter, die poort blijkt al in gebruik te zijn en Psiphon kan die niet gebruiken.\n</p>\n<p>\nA.u.b verander de geconfigureerde HTTP proxy-poort waarde en probeer het opnieuw. Wij raden u aan de waarde te wissen, zodat Psiphon automatisch een beschikbare poort kan halen.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nJe hebt Psiphon geconfigureerd om een specifieke lokale poort te gebruiken voor zijn SOCKS proxy.<br>\nEchter, Blijkt dat de poort al in gebruik is en Psiphon  kan die niet gebruiken.\n</p>\n<p>\nA.u.b verander de geconfigureerde SOCKS proxy-poort waarde en probeer het opnieuw. Wij raden u aan de waarde te wissen, zodat Psiphon automatisch een beschikbare poort kan halen.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "Als jouw computer al een proxy geconfigureerd heeft, standaard zal Psiphon dat proxy gebruiken bij het vaststellen van een tunnel. Jij kan overschrijven dat gedrag door specificeren van een proxy te gebruiken, of specificeren dat een dergelijke “upstream proxy” zal worden gebruikt.",
-      "settings#upstream-proxy#reason": "Upstream proxies zijn soms nodig door scholen, universiteiten of bedrijven. Als uw provider u upstream proxy-instellingen heeft gegeven, kan ze vervolgens handmatig instellen om van hier verbinden te maken.",
-      "settings#upstream-proxy#proxy-reqs": "Alleen HTTP proxy's die HTTPS ondersteunen, worden toegestaan.",
-      "settings#upstream-proxy#hostname-label": "Hostnaam",
-      "settings#upstream-proxy#port-label": "Poort",
-      "settings#upstream-proxy#username-label": "Gebruikersnaam",
-      "settings#upstream-proxy#password-label": "Paswoord ",
-      "settings#upstream-proxy#domain-label": "Domein",
-      "settings#upstream-proxy#skip-label": "Gebruik geen upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "U moet een hostnaam opgeven of alle velden voor de upstream-proxy leeg laten voor automatische selectie.",
-      "settings#upstream-proxy#set-username-error-msg": "U moet een gebruikersnaam opgeven als u een wachtwoord of domein instelt; of laat alle authenticatievelden leeg voor geen authenticatie.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Fout",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is momenteel zo geconfigureerd om uw systeem proxy gebruiken als “upstream proxy”.<br>\nEchter, Lijken we niet in staat te zijn om verbinding te maken met een Psiphon server via die proxyo.<br>\nA.u.b. Inschakelen “Gebruik geen upstream proxy” en probeer opnieuw.",
-      "settings#upstream-proxy#error-modal-body-configured": "Je hebt Psiphon geconfigureert voor een “upstream proxy”.<br>\nEchter we lijken niet in staat om verbinding te maken met een Psiphon server via die proxy.<br>\nA.u.b. Corrigeer de instellingen en probeer het opnieuw.",
-      "settings#transport-mode#heading": "Transport mode",
-      "settings#transport-mode#check-label": "Gebruik L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Gebruik Windows L2TP/IPSec virtual netwerken. Deze mode wil tunnel al je apps, maar het nie’t leveren van obfuscatie en heeft geen krachtig censuur omzeilings mogelijkheden. Het is <strong>niet aanbevolen</strong> voor het omzeilen van de meeste firewalls.",
-      "settings#systray-minimize#heading": "Minimaliseren naar de plaats (Systeemvak)",
-      "settings#systray-minimize#help-text": "Indien ingeschakeld, als deze is geminimaliseerd de toepassing venster Psiphon zal verbergen in het systeemvak (ook bekend als “systeemvak” of “statusindicatie”, bevindt zich dichtbij de klok op uw (Windows-taakbalk).",
-      "settings#systray-minimize#reason": "Minimaliceer Psiphon naar de plaats (“systeemvak”) bespaart ruimte op je taakbalk. Dit is vooral handig als je Psiphon gebruikt voor langere tijd.",
-      "settings#systray-minimize#enable-label": "Minimaliseren naar het systeemvak (system tray)",
-      "settings#applying-message": "Opnieuw verbinding om uw instellingen toe te passen.",
-      "settings#saved-message": "Instellingen Opslaan.",
-      "settings#error-modal#title": "Instellings Fout",
-      "settings#error-modal#body": "Er zijn fouten in de instellingen van je waarden. Gelieve te corrigeren alvorens verder te gaan.",
-      "feedback#top_content_title": "Geef Ons Je Feedback",
-      "feedback#top_para_2": "Veel problemen kunnen worden opgelost door het downloaden van de nieuwste versie. Je kan <a class=\"NewVersionURL\" href=\"#\">downloaden de laatste versie door hier te klikken</a>, of je stuurt een email naar <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "U kunt ook oplossingen voor veel voorkomende problemen in vinden onze <a class=\"FaqURL\" href=\"#\">Veel gestelde vragen</a>.",
-      "feedback#smiley_happy": "Psiphon verbindt en presteert de manier waarop ik het wil.",
-      "feedback#smiley_sad": "Pishon kan niet goed Verbinding maken of het presteren er van.",
-      "feedback#text_feedback_prompt": "Gelieve hier je probleem te plaatsen:",
-      "feedback#text_feedback_email_prompt": "Als je wil, dat wij U terug schrijven, plaats hier dan je email adres:",
-      "feedback#diagnostic_check": "Upload diagnostische gegevens. Opmerking dat de diagnosegegevens U niet zal indentificeren, maar het zal ons helpen Psiphon te verbeteren. <a class=\"DataCollectionInfoURL\" href=\"#\">Klik hier om te zien welke gegevens wij verzamelen.</a>",
-      "feedback#submit_button": "Akkoord",
-      "feedback#text_feedback_bottom_para": "Als bovenstaand formulier niet werkt, of u wilt screenshots te sturen, kunt u mailen naar <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Dank U!</strong> Je feedback is verstuurt.",
-      "logs#show-debug-label": "Toon debug logbestanden",
-      "logs#placeholder": "Geen logbestanden",
-      "language#success-message": "<strong>Hallo!</strong> Welkom bij Psiphon.",
-      "about#wordart-tag": "Voorbij de Grenzen",
-      "about#description": "Psiphon is een <strong>censors omzeilings hulpmiddel</strong> — het is ontworpen om de toegang tot het open internet te geven, langs censors en firewalls. Het is <strong>open source</strong> en ontwikkeld in Toronto, Canada.",
-      "about#visit-download-site": "Nieuwsgierig bezoek de website en <strong><a class=\"NewVersionURL\" href=\"#\">download een nieuw versie</a></strong> of naar <strong><a class=\"InfoURL\" href=\"#\">help en informatie</a></strong>. Psiphon is beschikbaar voor Android en Windows.",
-      "about#get-by-email": "<strong>Als de website ontoegankelijk is</strong>, kunt u een nieuwe versie van Psiphon krijgen door het sturen van een e-mail naar:",
-      "about#client-version": "Psiphon voor Windows klant versie:",
-      "general#modal-close-button": "Sluit",
-      "general#notice-modal-tech-preamble": "Hier is de technische fout informatie.",
-      "notice#systemproxysettings-setproxy-error-title": "Fout Systeem Proxy",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon faald om instellen de systeem’s proxy instellingen.</p>\n<p>Dit zou te wijten zijn aan een conflict met uw antivirussoftware. Je zou handmatig moeten configureren van uw toepassing of het systeem proxy-instellingen te gebruiken, de lokale Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon faald om instellen de systeem’s proxy instelingen voor de Internet verbinding genaamd “<%- data %>”. Dit zou te wijten zijn aan een conflict met uw antivirussoftware. Je zou handmatig moeten configureren van uw toepassing of het systeem proxy-instellingen te gebruiken, de lokale Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon is verbroken",
-      "appbackend#state-starting-title": "Psiphon is aan het verbinden",
-      "appbackend#state-starting-body": "Wacht A.u.b.",
-      "appbackend#state-connected-title": "Psiphon is verbonden",
-      "appbackend#state-connected-body": "Verkennen voorbij jouw grenzen!",
-      "appbackend#state-connected-reminder-title": "Psiphon houdt je verbonden",
-      "appbackend#state-connected-reminder-body": "Houd Psiphon gratis. Klik hier om onze sponsorpagina's te bezoeken! ",
-      "appbackend#state-connected-reminder-body-2": "Houd Psiphon gratis door onze sponsorpagina's te bezoeken! ",
-      "appbackend#minimized-to-systray-title": "Psiphon is geminimaliseerd naar het systeemvak",
-      "appbackend#minimized-to-systray-body": "Klik op het pictogram om de toepassing te herstellen",
-      "appbackend#os-unsupported": "Psiphon ondersteunt niet langer Windows XP or Vista.\nBezoek a.u.b. onze website voor meer informatie.",
-      "psicash#transaction-error-title": "PsiCash-transactiefout",
-      "psicash#transaction-error-body": "Uw PsiCash-transactiepoging is onverwacht mislukt.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash-aankoop bestaat al",
-      "psicash#transaction-ExistingTransaction-body": "U hebt een bestaande PsiCash-aankoop van dit type. Een andere aankoop van dit type is niet toegestaan totdat de vorige verloopt. Uw PsiCash-status wordt nu vernieuwd.",
-      "psicash#transaction-InsufficientBalance-title": "Onvoldoende PsiCash-saldo",
-      "psicash#transaction-InsufficientBalance-body": "U hebt niet voldoende PsiCash-saldo voor deze aankoop.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash-aankoopprijs komt niet overeen",
-      "psicash#transaction-TransactionAmountMismatch-body": "De aankoopprijzen van PsiCash zijn verouderd. Uw PsiCash staat zal nu worden vernieuwd.",
-      "psicash#transaction-TransactionTypeNotFound-title": "Aankooptype PsiCash niet gevonden",
-      "psicash#transaction-TransactionTypeNotFound-body": "Het product dat u probeert te kopen bestaat niet meer. Mogelijk moet u de toepassing bijwerken of opnieuw installeren.",
-      "psicash#transaction-InvalidTokens-title": "Ongeldige PsiCash-tokens",
-      "psicash#transaction-InvalidTokens-body": "Uw PsiCash-tokens zijn ongeldig. Probeer de toepassing opnieuw te starten. Als dat niet werkt, moet u uw <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">lokale opslag wissen</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash-serverfout",
-      "psicash#transaction-ServerError-body": "De PsiCash-server reageerde met een fout tijdens een poging om de aankoop te doen. Probeer uw aankoop later opnieuw.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost actief voor %s",
-      "psicash#ui-zerobalance-title": "Snelheid nodig&nbsp;Boost?",
-      "psicash#ui-buypsi": "Koop PsiCash",
-      "psicash#ui-buymorepsi": "Koop meer PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Nodig voor Snelheid&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Snelheid&nbsp;Boost",
-      "psicash#1-hour": "1 uur",
-      "psicash#1-day": "1 dag",
-      "psicash#ui-buyingboost-buttontext": "Starten Snelheid&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon-verbinding vereist",
-      "psicash#mustconnect-modal#body": "Om PsiCash te gebruiken, moet u verbonden zijn met het Psiphon-netwerk.",
-      "psicash#init-error-title": "PsiCash-initialisatiefout",
-      "psicash#init-error-body-unrecovered": "PsiCash kan niet worden geïnitialiseerd. Dit komt waarschijnlijk door een probleem met het bestandssysteem, zoals onvoldoende schijfruimte. Je saldo en andere status zijn verloren. PsiCash zal niet bruikbaar zijn. U kunt proberen de toepassing opnieuw te starten om het probleem te verhelpen.",
-      "psicash#init-error-body-recovered": "PsiCash kan niet worden geïnitialiseerd. Dit komt waarschijnlijk door een probleem met het bestandssysteem, zoals onvoldoende schijfruimte. Uw saldo en andere status zijn gereset.",
-      "psicash#psiphon-speed": "Psiphon<br>snelheid",
-      "notice#disallowed-traffic-alert-title": "Upgrade uw Psiphon-verbinding ",
-      "notice#disallowed-traffic-alert-body": "<p>Apps werken niet?</p>\n<p>Sommig internetverkeer wordt niet ondersteund zonder een actieve Speed Boost. Activeer Speed Boost met PsiCash om het volledige potentieel van uw Psiphon-ervaring te ontgrendelen.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps werken niet?",
-      "appbackend#disallowed-traffic-notification-body": "Activeer Speed Boost om het volledige potentieel van de Psiphon-ervaring te ontgrendelen.",
-      "settings#disallowed-traffic-alert#heading": "Niet toegestaan dataverkeer Waarschuwing",
-      "settings#disallowed-traffic-alert#help-text": "Sommige soorten internetverkeer worden niet ondersteund zonder een actieve Speed Boost. Als dergelijk verkeer niet is toegestaan, wordt er een waarschuwing weergegeven. (Voor het opnieuw inschakelen is een nieuwe verbinding vereist.)",
-      "settings#disallowed-traffic-alert#disable-label": "Uitschakelen niet toegestaan dataverkeer waarschuwingen",
-      "banner#sponsored-by": "Gesponsord door"
-    }
-  },
-  "om": {
-    "name": "Afaan Oromo",
-    "translation": {
-      "banner#long-connecting": "<strong>Ohoo, miti!</strong> Wal qabsiisuu didee rakkataa waan jirtu fakkaata!<br>\n Psiphon gosa haaraa asii gad fe'adhu <a class=\"NewVersionURL\" href=\"#\">Iddoo gad-fe'insaa</a>\n  yookiin as irratti imeelii erguudhaan <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Wal qabsiisaa jira",
-      "nav#connection#connected": "Wal qabsiifameera",
-      "nav#connection#stopping": "Addaan kutaa jira",
-      "nav#connection#stopped": "Addaan cite",
-      "nav#settings": "Qindeessawwan ",
-      "nav#feedback": "Yaada",
-      "nav#logs": "Galmeelee",
-      "nav#about": "Waa'ee",
-      "connection#starting-msg": "Psiphon’niin <span class=\"state-word\">connecting</span>dha…",
-      "connection#stop-btn": "Dhaabi",
-      "connection#connected-msg": "Psiphon’niin <span class=\"state-word\">connected</span>dha",
-      "connection#disconnect-btn": "Addaan kuti",
-      "connection#stopping-msg": "Psiphon’niin <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Maaloo eegaa...",
-      "connection#stopped-msg": "Psiphon’niin <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "Wal qabsiisii",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Dogoggora!</strong> Maaloo itti fufuun dura wanna dogoggoraa furi.",
-      "settings#reset-button": "Iddoo duraatii deebisii",
-      "settings#apply-button": "Jijjiirama jiru hojii irra oolchi",
-      "settings#unapplied-changes-prompt#title": "Qindeessaawwan jijjiirameera",
-      "settings#unapplied-changes-prompt#body": "Qindeessaawwan kee jijjiirteetta, garuu jijjiirama sana hojii irra hin oolchine.<br><br>Jijjiirama kee amma hojii irra oolchuu feeta moo yookiin haquu feeta?",
-      "settings#unapplied-changes-prompt#apply-button": "Hojii irra oolchi",
-      "settings#unapplied-changes-prompt#discard-button": "Balleessi",
-      "settings#vpn-incompatible-msg": "(L2TP/IPsec mooddiitiin hin hojjetu.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Dabarsituu addaan qoodi",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Weebsaayitiiwwan biyya keessan keessaa karaa bakka bu'aa hin gargaaramin",
-      "settings#disable-timeouts#heading": "Neetwoorkii suuta jedhuuf boqodhu kan jedhu akka hin hojjenne ajaji",
-      "settings#disable-timeouts#help-text": "Yoo si’eeffame, quunnamtiin serverii Psiphon waliin jiru yeroon itti hin dhumu.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Neetwoorkii boodatti hafaan akka adda hin cinne dhorki",
-      "settings#egress-region#heading": "Naannawa Serverii Psiphon",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "Yuunayitid Isteetis",
-      "settings#egress-region#select-ca": "Kanaadaa",
-      "settings#egress-region#select-gb": "Engilizii",
-      "settings#egress-region#select-jp": "Jaappaan",
-      "settings#egress-region#select-sg": "Siingaapoor",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Nezerlaand",
-      "settings#egress-region#select-de": "Jarman",
-      "settings#egress-region#select-in": "Hindii",
-      "settings#egress-region#select-es": "Ispeen",
-      "settings#egress-region#select-hk": "Hoong Koong",
-      "settings#egress-region#select-at": "Ostriyaa",
-      "settings#egress-region#select-be": "Beljiyeem",
-      "settings#egress-region#select-bg": "Bulgaariyaa",
-      "settings#egress-region#select-ch": "Iswiizerlaand",
-      "settings#egress-region#select-cz": "Cheek Ripaabilikii",
-      "settings#egress-region#select-dk": "Deenmaark",
-      "settings#egress-region#select-fr": "Faransaay",
-      "settings#egress-region#select-hu": "Hangaarii",
-      "settings#egress-region#select-it": "Xaaliyaanii",
-      "settings#egress-region#select-no": "Noorweey",
-      "settings#egress-region#select-ro": "Roomaaniya",
-      "settings#egress-region#select-se": "Iswidini",
-      "settings#egress-region#select-pl": "Polaand",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Serverii naannoo sirrii ta'e kan Psiphon filadhaa.",
-      "settings#egress-region#error-modal-title": "Serveriin naannoo hin jiru",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Buufata bakka bu'aa kan naannoo",
-      "settings#local-proxy-ports#leave-blank": "Dhiisi <strong>duwwaa</strong> buufata awutomaatikii fo'achuuf (kan gorsamedha)",
-      "settings#local-proxy-ports#reason": "Kompuutera kee irratti Psiphon waliin hojjechuuf qindeessa maanwaalii meeshaalee barbaadde gargaaramta taanaan, Psiphon lakkoobsota buufata wal fakkaataa akka gargaaramu feeta. Lakkoobsota buufataa sababaa adda itti baaftu hin qabaanne taanaan, walitti bu'iinsa ittisuuf Psiphon ofii isaatii akka filatu eeyyamuu qabda.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 fi 65535 gidduu ta'uu qaba.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Buufataaleen naannoo walittii adda ta'uu qabu.",
-      "settings#local-proxy-ports#error-modal-title": "Rakkoo Buufata Bakka bu'aa Naannoo",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon bakka bu'aa HTTP isaatiif buufata naannoof adda akka gargaaramu ta'uun qopheessite.<br>\nHaa ta'u malee, buufati sun hojii irra oolee waan jiruuf Psiphon gargaaramuu hin danda’u.\n</p>\n<p>\nMaaloo bakka bu'aa HTTP qindaa'ee jiru keessa waan jiru jijjiiri, irra deebi'uun yaali. Psiphon ofii isaatii buufataalee isaa keessatti kan argaman akka filatuuf guutummaan akka balleessitugorsineerra.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon bakka bu'aa SOCKS isaatiif bakka bu'aa addaa kan buufata naannoo  akka gargaaramuuf qindeessite.<br>\nHaa ta'u malee, buufati kun hojii irra oolee waan jiruuf Psiphon gargaarmuu hin danda'u.\n</p>\n<p>\nKanaaf kan qindaa'e gatii buufata bakka bu'aa SOCKS jijjirii tii irra deebi'uun yaali. Psiphon waanneen buufata isaa keessatti argaman akka filatuuf gatii isaa guutummaatti akka haqxan isin gorsina.\n</p>",
-      "settings#upstream-proxy#heading": "Bakka bu'aa gara olii",
-      "settings#upstream-proxy#by-default": "Kompiiterri kee durumaanuu bakka bu'aa qindaa'e yoo qabaate, Psiphon isuma dura tureen bakka bu'aan sun ennaa darbuu danda'u itti gargaarama. kan akkasii bakka bu'aa addaa baastee akka gargaaramuuf amala sana  bulchuu dandeessa, yookiin “bakka bu'aa gara olii” akka kanaa akka gargaaramamuu hin dandeenye adda-baasuu dandeessa.",
-      "settings#upstream-proxy#reason": "Yeroo tokko tokko bakka bu'oonni gara olii manneen barnootaa, Yunivarsitiiwwan yookiin daldalaawwaniin ni barbaadamu. Neetwoorkii kan siif dhi’eessu qindeessawwan bakka bu'oota gara olii yoo siif kenna ta'e, wal qabsiisuuf as irratti maanuwaaliidhaan akka qindeessitu ta'uu mala.",
-      "settings#upstream-proxy#proxy-reqs": "Bakka bu'oota HTTP kanneen HTTPS deggeran qofaatu eeyyama qaba.",
-      "settings#upstream-proxy#hostname-label": "Maqaa qopheessaa",
-      "settings#upstream-proxy#port-label": "Buufata",
-      "settings#upstream-proxy#username-label": "Maqaa fayyadamaa",
-      "settings#upstream-proxy#password-label": "Darbi-jecha",
-      "settings#upstream-proxy#domain-label": "Domenii",
-      "settings#upstream-proxy#skip-label": "Bakka bu'aa gara olii hin gargaaramiin",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Dogoggora bakka bu'aa gara olii",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon yeroo ammaatti kan qindeeffame “bakka bu'a gara olii” akka gargaaramutti ta'ee ti. <br>\n Haa ta'u malee, bakka bu'aa sana gargaaramuudhaan serverii Psiphon waliin wal  qabsiisuu hin dandeenye.<br>\n Maaloo \"Bakka bu'aa gara olii hin gargaaramin\" isa jedhu si’eessi akkasumas irra-deebi’uun yaali.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon kee \"bakka bu'aa gar olii\" akka inni gargaaramu ta'ee qopheessiteetta. <br>\nHaa ta’u malee, Kara bakka bu'aa sanaa serverii Psiphon ‘tti qabsiisuu hin dandeenye.<br>\nMaaloo qindeessawwan sirreessi akkasumas irra deebi'uun yaali.",
-      "settings#transport-mode#heading": "Haala Tiraansipoortii",
-      "settings#transport-mode#check-label": "Mooddii L2TP/IPSec gargaarami",
-      "settings#transport-mode#help-text": "L2TP/IPSec windowwan neetwoorkii yaadaaf gargaarama. Haalli kun appilikeeshiniiwwan mara darbarsa, garuu waanta dhoksu hin dhiyeessu kanaaf dandeettiiwwan uggura cimaa bira darbuu hin qabu. <strong>Hin gorfamu</strong> ta’ee fayerwoliiwwan hedduu bira darbuufidha.",
-      "settings#systray-minimize#heading": "Gara bakka beeksisaatti gad xiqqeessi (Gabatee sirnaa)",
-      "settings#systray-minimize#help-text": "Yoo si’eeffame, ennaa gad xiqqaatu windoon appilikeeshinii Psiphon naannoo beeksisi jiru jala dhokata (dabalataanis \"gabatee sirnaa\" jedhamee kan beekamu yookiin \"systray\" ka jedhu keessa, kunis kan argamu taaski baarii windowu bakka sa'aatiin jiru cinaadha).",
-      "settings#systray-minimize#reason": "Psiphon naannoo beeksisi jirutti gad xiqqeessun (\"gabatee sirnaa\") taask baarii kee irratti bakka duwwaa dhiisa. Kun keessumaayyu kan gargaaru yoo Psiphon yeroo dheeraaf itti gargaaramtedha.",
-      "settings#systray-minimize#enable-label": "Gara naannoo beeksisi jiruutti gad xiqqeessi (gabatee sirnaa)",
-      "settings#applying-message": "Qindeessawwan kee hojii irra oolchuuf irra deeb'uun wal qabsiisaa jira.",
-      "settings#saved-message": "Qindeessaawwan ol kaa'amaniiru.",
-      "settings#error-modal#title": "Dogoggora qindeessaawwanii",
-      "settings#error-modal#body": "Wanneen qindeessaawwan kee keessa dogoggorawwantuu jiru. Maaloo utuu itti hin fufin isaan sirreessaa.",
-      "feedback#top_content_title": "Yaada Kee nuun ga'i",
-      "feedback#top_para_2": "Rakkoolee hedduun gulantaa haarawaa ta'e gadii buusuun sirreeffamuu ni danda'u. </a>Asitti cuqaasuun gulantaa haaraa buusuu dandeessa <a class=\"NewVersionURL\" href=\"#\">, yookiin ergaa iimeelii kanatti erguu ni dandeessa <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Akkasumas rakkoolee wal-fakkaatoo hedduuf furmaatawwan teessoo keenya kana keessaa argachuu dandeessa <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "Psiphon akka fedha kiyyaatti wal-qabsiisa akkasumas dalaga",
-      "feedback#smiley_sad": "Psiphon yeroo mara wal-qabsiisuu dadhaba yookiin haala quubsaan hin dalagu.",
-      "feedback#text_feedback_prompt": "Maaloo yaada kee asitti galchi:",
-      "feedback#text_feedback_email_prompt": "Deebii akka siif kenninu yoo feete, maaloo teessoo imeelii keetii galchi:",
-      "feedback#diagnostic_check": "Odeeffannoo qorannoo ol fe'adhaa. Odeeffannoon qorannoo kun eenyummaa kee adda hin baasu, akkasumas Psiphon sirriitti akka hojjetu nu gargaara. <a class=\"DataCollectionInfoURL\" href=\"#\">Odeeffannoo sassaabnu ilaaluuf, as cuqaasi.</a>",
-      "feedback#submit_button": "Ergi",
-      "feedback#text_feedback_bottom_para": "Unki armaan olii hin hojjetaa hin jiru yoo ta'e, yookiin fakkiiwwan iskiriinii erguu yoo feete, maaloo kana irratti imeelii nuu ergi <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Galatoomi!</strong> Yaadnii kee ergamee jira .",
-      "logs#show-debug-label": "Galmeelee sirreessa dogoggoraa mul'isi",
-      "logs#placeholder": "Hanga yoonaa galmeen hin jiru",
-      "language#success-message": "<strong>Hello!</strong> Baga nagaan gara Psiphon dhufte.",
-      "about#wordart-tag": "Daangaawwan Darbee",
-      "about#description": "Psiphon’niin <strong>meeshaa ittisa ugguraa</strong> — meeshaa ittiin dhowwii interneetii darbani Interneetii banaa, senserootaa fi fayerwolii akka argachuu danda’u godhameetu tolfame. Innis <strong>burqaa-banaa</strong> ta’ee kan Torontoo, Kanaadaa keessatti tolfamedha.",
-      "about#visit-download-site": "Maaloo gosa haaraa gad buusuuf <strong><a class=\"NewVersionURL\" href=\"#\">keenya daawwadha weebsaayitii keenya doowwadhu</a></strong> yookiin <strong><a class=\"InfoURL\" href=\"#\">gargaarsaa fi odeeffannoo argachuuf</a></strong>.  Psiphon’n Android fi Windowsi ‘dhaaf ni jira.",
-      "about#get-by-email": "<strong>Weebsaayitichi kan hin argamne yoo ta'e</strong>, Psiphon gosa haaraa imeelii  teessoo kanatti erguudhaan argachuu dandeessa:",
-      "about#client-version": "Gosa Psiphon kan Wiindows maamilaaf qophaa'e:",
-      "general#modal-close-button": "Cufi",
-      "general#notice-modal-tech-preamble": "Kuni Odeeffannoo rakkoo teekinikaati:",
-      "notice#systemproxysettings-setproxy-error-title": "Dogoggora bakka bu'aa sirnaa",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon qindeessawwan bakka bu'aa sirnaa tolchuu hin dandeenye.</p>\n<p>Kun tarii walitti bu'iinsa softiweerii vaayirasii ittisuu gidduutti uumame ta'uu mala. Bakka bu'oota Psiphon kan naannoo fayyadamuuf appilikeeshinii kee  yookiin bakka bu'aa qindeessawwan kee gargaaramuuf maanuwaalii qindeessuu qabda ta’a.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon bakka bu'aa sirnaa kan komputera keessanii interneetii maqaan \"<%-data %>\" qindeessuutti hin milkoofne. Kun tarii walitti bu'iinsa softiweerii vaayirasii ittisuu gidduutti uumame ta'uu mala. Bakka bu'oota Psiphon kan naannoo fayyadamuuf appilikeeshinii kee yookiin bakka bu'aa qindeessa keessanii gargaaramuuf maanuwaaliin qindeessuu qabda ta’a. ",
-      "appbackend#state-stopped-title": "Psiphon addaan cite",
-      "appbackend#state-starting-title": "Psiphon wal qabsiisaa jira",
-      "appbackend#state-starting-body": "Maaloo eegi...",
-      "appbackend#state-connected-title": "Psiphon wal qabsiifameera",
-      "appbackend#state-connected-body": "Daangaawwan kee darbii barbaadi!",
-      "appbackend#state-connected-reminder-title": "Psiphon wal arginsaan akka turtan godha",
-      "appbackend#state-connected-reminder-body": "Psiphon tola ta'ee akka turu godhaa. Fuula Ispoonsera keenyaa daawwachuuf as cuqaasaa!",
-      "appbackend#state-connected-reminder-body-2": "Fuula Ispoonsera keenyaa daawwachuudhaan Psiphon tola ta'ee akka turu godhaa!",
-      "appbackend#minimized-to-systray-title": "Psiphon gara naannoo beeksisaatti gad xiqqaateera",
-      "appbackend#minimized-to-systray-body": "Appilikeeshinii bakkatti deebisuuf mallatticha cuqaasi",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Spoonserri"
-    }
-  },
-  "pt_BR": {
-    "name": "Português (Brasil)",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh não!</strong> Você parece estar tendo problemas de conexão!<br>\nBaixe a versão mais recente do Psiphon na <a class=\"NewVersionURL\" href=\"#\">página de download</a>\nou envie o programa por email para <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Conectando",
-      "nav#connection#connected": "Conectado",
-      "nav#connection#stopping": "Desconectando",
-      "nav#connection#stopped": "Desconectado",
-      "nav#settings": "Configurações",
-      "nav#feedback": "Comentários",
-      "nav#logs": "Logs",
-      "nav#about": "Sobre",
-      "connection#starting-msg": "Psiphon está <span class=\"state-word\">conectando</span>…",
-      "connection#stop-btn": "Parar",
-      "connection#connected-msg": "Psiphon está <span class=\"state-word\">conectado</span>",
-      "connection#disconnect-btn": "Desconectar",
-      "connection#stopping-msg": "Psiphon está <span class=\"state-word\">desconectando</span>…",
-      "connection#wait-btn": "Por favor aguarde...",
-      "connection#stopped-msg": "Psiphon está <span class=\"state-word\">deconectado</span>",
-      "connection#connect-btn": "Conectar",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Erro!</strong> Por favor corrija os parâmetros incorretos antes de prosseguir.",
-      "settings#reset-button": "Retornar à Configuração Padrão",
-      "settings#apply-button": "Aplicar Mudanças",
-      "settings#unapplied-changes-prompt#title": "Configurações Alteradas",
-      "settings#unapplied-changes-prompt#body": "Você alterou configurações, mas não as aplicou.\nVocê gostaria de aplicá-las ou descartá-las?",
-      "settings#unapplied-changes-prompt#apply-button": "Aplicar",
-      "settings#unapplied-changes-prompt#discard-button": "Descartar",
-      "settings#vpn-incompatible-msg": "(Não funciona no modo L2TP/IPSec.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Tunelamento de Conexões Locais",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Não fazer proxy para sites dentro do seu país",
-      "settings#disable-timeouts#heading": "Desabilitar \"Expiração de tempo\" para Redes Lentas",
-      "settings#disable-timeouts#help-text": "Se habilitado, a comunicação com o servidor Psiphon não expirará.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Desabilitar \"Expiração de tempo\" para redes lentas",
-      "settings#egress-region#heading": "Região do Servidor Psiphon",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "Estados Unidos",
-      "settings#egress-region#select-ca": "Canadá",
-      "settings#egress-region#select-gb": "Reino Unido",
-      "settings#egress-region#select-jp": "Japão",
-      "settings#egress-region#select-sg": "Singapura",
-      "settings#egress-region#select-sk": "Eslováquia",
-      "settings#egress-region#select-nl": "Holanda",
-      "settings#egress-region#select-de": "Alemanha",
-      "settings#egress-region#select-in": "Índia",
-      "settings#egress-region#select-es": "Espanha",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Áustria",
-      "settings#egress-region#select-be": "Bélgica",
-      "settings#egress-region#select-bg": "Bulgária",
-      "settings#egress-region#select-ch": "Suíça",
-      "settings#egress-region#select-cz": "República Tcheca",
-      "settings#egress-region#select-dk": "Dinamarca",
-      "settings#egress-region#select-fr": "França",
-      "settings#egress-region#select-hu": "Hungria",
-      "settings#egress-region#select-it": "Itália",
-      "settings#egress-region#select-no": "Noruega",
-      "settings#egress-region#select-ro": "Romênia",
-      "settings#egress-region#select-se": "Suécia",
-      "settings#egress-region#select-pl": "Polônia",
-      "settings#egress-region#select-rs": "Sérvia",
-      "settings#egress-region#select-au": "Austrália",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Escolha uma região de servidor Psiphon válida.",
-      "settings#egress-region#error-modal-title": "Região do Servidor Indisponível",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Portas do Proxy Local",
-      "settings#local-proxy-ports#leave-blank": "Deixe <strong>em branco</strong> para seleção automática de porta (recomendado).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Deve ser entre 1 e 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Portas locais devem ser diferentes.",
-      "settings#local-proxy-ports#error-modal-title": "Conflito com a Porta do Proxy Local",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nVocê configurou o Psiphon para usar uma porta local específica para seu proxy HTTP.\n <br>\nNo entanto, parece que esta porta já está em uso e o Psiphon não pode usá-la.\n</p>\n<p>\nPor favor, altere o valor da porta do proxy HTTP e tente novamente. Recomendamos que deixe o valor em branco para que o Psiphon possa escolher automaticamente uma porta disponível.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nVocê configurou o Psiphon para usar uma porta local específica para seu proxy SOCKS.<br>\nNo entanto, parece que esta porta já está em uso e o Psiphon não pode usá-la.</p>\n<p>\nPor favor, altere o valor da porta do proxy SOCKS e tente novamente. Recomendamos que deixe o valor em branco para que o Psiphon possa escolher automaticamente uma porta disponível.\n</p>",
-      "settings#upstream-proxy#heading": "Servidor Proxy",
-      "settings#upstream-proxy#by-default": "Se o seu computador já tem um proxy configurado, Psiphon utilizará por padrão este quando estabelecer um túnel. Você pode sobrescrever este comportamento, especificando qual proxy deve ser utilizado.",
-      "settings#upstream-proxy#reason": "Configurações de servidor proxy normalmente são necessárias para escolas, universidades ou negócios. Se o seu provedor de rede te informou configurações de proxy, pode ser necessária configuração manual para poder conectar.",
-      "settings#upstream-proxy#proxy-reqs": "Apenas proxies HTTP que suportam HTTPS são permitidos.",
-      "settings#upstream-proxy#hostname-label": "Nome do Host",
-      "settings#upstream-proxy#port-label": "Porta",
-      "settings#upstream-proxy#username-label": "Usuário",
-      "settings#upstream-proxy#password-label": "Senha",
-      "settings#upstream-proxy#domain-label": "Domínio",
-      "settings#upstream-proxy#skip-label": "Não usar servidor proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Erro do/no Servidor Proxy",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon está configurado para usar o proxy (trazido) do seu sistema como “proxy externo”.<br>\nNo entanto, não estamos conseguindo se conectar aos servidores do Psiphon através deste proxy.<br>\nAtive \"Não usar o proxy externo\" e tente novamente.",
-      "settings#upstream-proxy#error-modal-body-configured": "Você configurou o Psiphon para se conectar a outro servidor proxy.<br>\nContudo, parece impossível se conectar a ele.<br>\nPor favor corrija as configurações e tente novamente.",
-      "settings#transport-mode#heading": "Modo de Transporte",
-      "settings#transport-mode#check-label": "Usar modo L2TP/IPSec",
-      "settings#transport-mode#help-text": "Usa a rede virtual L2TP/IPSec do Windows. Este modo vai tunelar todas as suas aplicações, mas não provê obfuscação. Então não é tão forte para passar por controles e censuras. Este <strong>não é o modo recomendado</strong> para passar a maioria dos firewalls.",
-      "settings#systray-minimize#heading": "Minimizar para Área de Notificações (Bandeja do Sistema)",
-      "settings#systray-minimize#help-text": "Se habilitado, quando o Psiphon for minimizado, a janela do aplicativo irá esconder na área de notificação (também conhecido como a \"bandeja do sistema\" ou \"systray\", localizado perto do relógio em sua barra de tarefas do Windows).",
-      "settings#systray-minimize#reason": "Minimizando o Psiphon para a área de notificações (bandeja do sistema) libera espaço em sua barra de tarefas. Isso ajuda especialmente quando você roda o Psiphon por longos períodos de tempo.",
-      "settings#systray-minimize#enable-label": "Minimizar para a área de notificações (bandeja do sistema)",
-      "settings#applying-message": "Reconectando para aplicar suas configurações.",
-      "settings#saved-message": "Configurações salvas.",
-      "settings#error-modal#title": "Erro de Configurações",
-      "settings#error-modal#body": "Existem erros nos seus parâmetros de configuração. Por favor corrija antes de proceder.",
-      "feedback#top_content_title": "Deixe Seus Comentários",
-      "feedback#top_para_2": "Muitos problemas podem ser corrigidos se você baixar a última versão.. Você pode baixar a última versão clicando <a class=\"NewVersionURL\" href=\"#\">aqui</a>, ou enviando um e-mail para <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Você também pode encontrar soluções para os problemas mais comuns na nossa seção de perguntas frequentes (FAQ): <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "Psiphon se conecta e desempenha da maneira que eu quero.",
-      "feedback#smiley_sad": "Psiphon frequentemente falha para conectar ou a performance não é das melhores.",
-      "feedback#text_feedback_prompt": "Por favor insira seus comentários aqui:",
-      "feedback#text_feedback_email_prompt": "Se você desejar uma resposta nossa, por favor deixe seu endereço de e-mail:",
-      "feedback#diagnostic_check": "Enviar dados para diagnósticos. Estes dados não te identificam e nos ajudará a fazer o Psiphon funcionar mais suavemente. <a class=\"DataCollectionInfoURL\" href=\"#\">Clique aqui para ver quais dados coletamos.</a>",
-      "feedback#submit_button": "Enviar",
-      "feedback#text_feedback_bottom_para": "Se o formulário acima não estiver funcionando, ou se você gostaria de enviar print de telas, por favor escreva para <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Obrigado!</strong> Seus comentários foram enviados.",
-      "logs#show-debug-label": "Mostrar logs de depuração",
-      "logs#placeholder": "Ainda sem logs",
-      "language#success-message": "<strong>Olá!</strong> Seja Bem Vindo ao Psiphon.",
-      "about#wordart-tag": "Beyond Borders",
-      "about#description": "Psiphon é uma <strong>ferramenta para contornar censura</strong> — ela é desenvolvida para prover acesso a toda Internt, ultrapassando controles. É um aplicativo de <strong>código aberto</strong> e é desenvolvida em Toronto, no Canada.",
-      "about#visit-download-site": "Por favor visite o site para <strong><a class=\"NewVersionURL\" href=\"#\">baixar uma nova versão</a></strong> ou para <strong><a class=\"InfoURL\" href=\"#\">conseguir ajuda e informações</a></strong>. Psiphon está disponível para Android e Windows.",
-      "about#get-by-email": "<strong>Se o site estiver indisponível</strong>, você pode conseguir uma nova versão do Psiphon enviando um email para:",
-      "about#client-version": "Versão do Cliente Windos do Psiphon:",
-      "general#modal-close-button": "Fechar",
-      "general#notice-modal-tech-preamble": "Aqui estão as informações técnicas do erro:",
-      "notice#systemproxysettings-setproxy-error-title": "Erro no Proxy do Sistema",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon faihou ao tentar ajustar as configurações de proxy do sistema.</p>\n<p>Isso pode ser causado por um conflito com o seu software antivírus. Pode ser necessário uma configuração manual da aplicação ou das configurações de proxy do sistema para poder utilizar o Psiphon</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon não conseguiu realizar a configuração do proxy do sistema para a conexão chamada “<%- data %>”. Isto ocorre geralmente devido a um conflito com seu antivírus. Talvez você precise configurar manualmente seu aplicativo nas configurações de proxy do sistema para usar os servidores de proxy do Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon está desconectado",
-      "appbackend#state-starting-title": "Psiphon está conectando",
-      "appbackend#state-starting-body": "Por favor aguarde...",
-      "appbackend#state-connected-title": "Psiphon está conectado",
-      "appbackend#state-connected-body": "Explore além de suas fronteiras!",
-      "appbackend#state-connected-reminder-title": "Psiphon está mantendo você conectado",
-      "appbackend#state-connected-reminder-body": "Mantenha Psiphon gratuito. Clique aqui para visitar nosso patrocinador!",
-      "appbackend#state-connected-reminder-body-2": "Mantenha Psiphon gratuito visitando nosso patrocinador!",
-      "appbackend#minimized-to-systray-title": "Psiphon foi minimizado para a área de notificações",
-      "appbackend#minimized-to-systray-body": "Clique no ícone para restaurar a aplicação",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hora",
-      "psicash#1-day": "1 dia",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Patrocinado por"
-    }
-  },
-  "pt_PT": {
-    "name": "Português (Portugal)",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "A ligar",
-      "nav#connection#connected": "Ligado",
-      "nav#connection#stopping": "A desligar",
-      "nav#connection#stopped": "Desligado",
-      "nav#settings": "Configurações",
-      "nav#feedback": "Comentário",
-      "nav#logs": "Registos",
-      "nav#about": "Sobre",
-      "connection#starting-msg": "Psiphon - <span class=\"state-word\">a ligar...</span>…",
-      "connection#stop-btn": "Parar",
-      "connection#connected-msg": "Psiphon - <span class=\"state-word\">Ligado</span>…",
-      "connection#disconnect-btn": "Desligar",
-      "connection#stopping-msg": "Psiphon - <span class=\"state-word\">a desligar...</span>",
-      "connection#wait-btn": "Por favor, aguarde...",
-      "connection#stopped-msg": "Psiphon - <span class=\"state-word\">Desligado</span>",
-      "connection#connect-btn": "Ligar",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Erro!</strong> Por favor, corrija os valores incorretos antes de prosseguir.",
-      "settings#reset-button": "Repor para Predefinição",
-      "settings#apply-button": "Aplicar Alterações",
-      "settings#unapplied-changes-prompt#title": "Configurações Alteradas",
-      "settings#unapplied-changes-prompt#body": "Efetuou alterações às suas configurações, mas não aplicou as mesmas.<br><br>Deseja aplicar agora as alterações ou ignorá-las?",
-      "settings#unapplied-changes-prompt#apply-button": "Aplicar",
-      "settings#unapplied-changes-prompt#discard-button": "Rejeitar",
-      "settings#vpn-incompatible-msg": "(Não funciona com o modo L2TP/IPSec)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Não utilize proxy nos sites da Web dentro do seu país",
-      "settings#disable-timeouts#heading": "Desativar 'Expiração' para Redes Lentas",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Desativar 'expiração' para redes lentas",
-      "settings#egress-region#heading": "Região do Servidor do Psiphon",
-      "settings#egress-region#select-best-performance": "Melhor Desempenho",
-      "settings#egress-region#select-us": "Estados Unidos da América",
-      "settings#egress-region#select-ca": "Canadá",
-      "settings#egress-region#select-gb": "Reino Unido",
-      "settings#egress-region#select-jp": "Japão",
-      "settings#egress-region#select-sg": "Singapura",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Holanda",
-      "settings#egress-region#select-de": "Alemanha",
-      "settings#egress-region#select-in": "Índia",
-      "settings#egress-region#select-es": "Espanha",
-      "settings#egress-region#select-hk": "Hong-Kong",
-      "settings#egress-region#select-at": "Áustria",
-      "settings#egress-region#select-be": "Bélgica",
-      "settings#egress-region#select-bg": "Bulgária",
-      "settings#egress-region#select-ch": "Suiça",
-      "settings#egress-region#select-cz": "República Checa",
-      "settings#egress-region#select-dk": "Dinamarca",
-      "settings#egress-region#select-fr": "França",
-      "settings#egress-region#select-hu": "Hungria",
-      "settings#egress-region#select-it": "Itália",
-      "settings#egress-region#select-no": "Noruega",
-      "settings#egress-region#select-ro": "Roménia",
-      "settings#egress-region#select-se": "Suécia",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Escolha uma região de servidor Psiphon válida.",
-      "settings#egress-region#error-modal-title": "Região de Servidor Indisponível",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Portas de Proxy Locais",
-      "settings#local-proxy-ports#leave-blank": "Deixe em <strong>branco</strong> para a seleção de porta automática (recomendado).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Deve estar entre 1 e 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "As portas locais devem ser distintas umas das outras.",
-      "settings#local-proxy-ports#error-modal-title": "Conflito de Porta Proxy Local",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Proxy de Upstream",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "São permitidos apenas proxies HTTP que suportem HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Nome do Hospedeiro",
-      "settings#upstream-proxy#port-label": "Porta",
-      "settings#upstream-proxy#username-label": "Nome de utilizador",
-      "settings#upstream-proxy#password-label": "Palavra-passe",
-      "settings#upstream-proxy#domain-label": "Domínio",
-      "settings#upstream-proxy#skip-label": "Não utilizar proxy de upstream",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Erro de Proxy de Upstream",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Modo de Transporte",
-      "settings#transport-mode#check-label": "Utilizar modo L2TP/IPSec",
-      "settings#transport-mode#help-text": "Utiliza a rede virtual do Windows L2TP/IPSec. Este modo irá passar todas as suas aplicações, mas este não fornece ofuscar e por isso não tem grandes capacidades de contornar a censura. <strong>Não é recomendado</strong> para contornar a maiorias das firewalls.",
-      "settings#systray-minimize#heading": "Minimizar para a Área de Notificação (Bandeja do Sistema)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize para a área de notificação (bandeja do sistema)",
-      "settings#applying-message": "A religar para aplicar as suas configurações.",
-      "settings#saved-message": "Configurações guardadas.",
-      "settings#error-modal#title": "Erro de Configurações",
-      "settings#error-modal#body": "Existem erros nos valores das suas configurações. Por favor, corrija-as antes de prosseguir.",
-      "feedback#top_content_title": "Deixe-nos o Seu Comentário",
-      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "O Psiphon liga e funciona do modo que eu esperava.",
-      "feedback#smiley_sad": "O Psiphon falha muitas vezes na ligação ou não funciona suficientemente bem.",
-      "feedback#text_feedback_prompt": "Por favor, insira aqui os seus comentários:",
-      "feedback#text_feedback_email_prompt": "Se pretender obter uma resposta da nossa parte, por favor, insira o seu endereço de e-mail:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "Submeter",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Obrigado!</strong> O seu comentário foi enviado.",
-      "logs#show-debug-label": "Mostrar registos de depuração",
-      "logs#placeholder": "Ainda sem registos",
-      "language#success-message": "<strong>Olá!</strong> Bem-vindo ao Psiphon.",
-      "about#wordart-tag": "Além Fronteiras",
-      "about#description": "Psiphon é uma <strong>ferramenta de contornar a censura</strong> — está desenhada para dar acesso à Internet aberta, sem censuras e firewalls. É de <strong>código aberto</strong> e desenvolvido em Toronto, Canadá.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon para Windows, versão cliente:",
-      "general#modal-close-button": "Perto",
-      "general#notice-modal-tech-preamble": "Aqui tem a informação do erro técnico:",
-      "notice#systemproxysettings-setproxy-error-title": "Erro de Proxy do Sistema",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon - desligado",
-      "appbackend#state-starting-title": "Psiphon - a ligar...",
-      "appbackend#state-starting-body": "Por favor, aguarde...",
-      "appbackend#state-connected-title": "Psiphon - ligado",
-      "appbackend#state-connected-body": "Explore para além das suas fronteiras!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon foi minimizado para a área de notificação",
-      "appbackend#minimized-to-systray-body": "Clique no ícone para restaurar a aplicação",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hora",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Patrocinado por"
-    }
-  },
-  "ru": {
-    "name": "Русский",
-    "translation": {
-      "banner#long-connecting": "<strong>О нет!</strong> У вас, кажется, возникли проблемы с подключением!<br>\nЗагрузите последнюю версию Psiphon с <a class=\"NewVersionURL\" href=\"#\">нашего вебсайта</a> или отправив сообщение по адресу <a class=\"NewVersionEmail\" href=\"#\"></a>. ",
-      "nav#connection#starting": "Идет соединение",
-      "nav#connection#connected": "Соединение установлено",
-      "nav#connection#stopping": "Соединение отключается",
-      "nav#connection#stopped": "Соединение отключено",
-      "nav#settings": "Настройки",
-      "nav#feedback": "Отзыв",
-      "nav#logs": "Логи",
-      "nav#about": "О приложении",
-      "connection#starting-msg": "Идет <span class=\"state-word\">соединение</span> Psiphon…",
-      "connection#stop-btn": "Стоп",
-      "connection#connected-msg": "Соединение Psiphon <span class=\"state-word\">установлено</span>",
-      "connection#disconnect-btn": "Отключить",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">отключается</span>…",
-      "connection#wait-btn": "Пожалуйста, подождите...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">отключен</span>",
-      "connection#connect-btn": "Подключить",
-      "connection#egress-region-combo-label": "Выбор региона сервера",
-      "settings#error-alert": "<strong>Ошибка!</strong> Для продолжения исправьте неверные значения.",
-      "settings#reset-button": "Восстановить настройки по умолчанию",
-      "settings#apply-button": "Применить изменения",
-      "settings#unapplied-changes-prompt#title": "Настройки изменены",
-      "settings#unapplied-changes-prompt#body": "Вы внесли изменения в настройках, но не применили изменения. <br><br>Применить изменения сейчас или отменить их?",
-      "settings#unapplied-changes-prompt#apply-button": "Применить",
-      "settings#unapplied-changes-prompt#discard-button": "Отменить изменения",
-      "settings#vpn-incompatible-msg": "(Не применимо в режиме L2TP/IPSec)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Раздельное туннелирование",
-      "settings#split-tunnel#help-text": "Если эта опция включена, обращения к серверам в границах вашей страны не будут проходить через Psiphon.",
-      "settings#split-tunnel#reason": "Если веб-сайты в вашей стране не блокируются, включите эту опцию и получите более быстрый доступ к таким сайтам. Иногда это может снизить затраты на пользование интернетом.",
-      "settings#split-tunnel#enable-label": "Не использовать прокси для вебсайтов в вашей стране",
-      "settings#disable-timeouts#heading": "Отключение лимита времени соединения для медленных сетей",
-      "settings#disable-timeouts#help-text": "При включении этой настройки связь с сервером Psiphon не разъединится.",
-      "settings#disable-timeouts#reason": "Если включить эту опцию для очень медленных сетевых подключений, разрывы соединения будут случаться реже.",
-      "settings#disable-timeouts#enable-label": "Отключение лимита времени соединения для медленных сетей",
-      "settings#egress-region#heading": "Регион сервера Psiphon",
-      "settings#egress-region#select-best-performance": "Лучшая производительность",
-      "settings#egress-region#select-us": "США",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Великобритания",
-      "settings#egress-region#select-jp": "Япония",
-      "settings#egress-region#select-sg": "Сингапур",
-      "settings#egress-region#select-sk": "Словакия",
-      "settings#egress-region#select-nl": "Нидерланды",
-      "settings#egress-region#select-de": "Германия",
-      "settings#egress-region#select-in": "Индия",
-      "settings#egress-region#select-es": "Испания",
-      "settings#egress-region#select-hk": "Гонконг",
-      "settings#egress-region#select-at": "Австрия",
-      "settings#egress-region#select-be": "Бельгия",
-      "settings#egress-region#select-bg": "Болгария",
-      "settings#egress-region#select-ch": "Швейцария",
-      "settings#egress-region#select-cz": "Чешская Республика",
-      "settings#egress-region#select-dk": "Дания",
-      "settings#egress-region#select-fr": "Франция",
-      "settings#egress-region#select-hu": "Венгрия",
-      "settings#egress-region#select-it": "Италия",
-      "settings#egress-region#select-no": "Норвегия",
-      "settings#egress-region#select-ro": "Румыния",
-      "settings#egress-region#select-se": "Швеция",
-      "settings#egress-region#select-pl": "Польша",
-      "settings#egress-region#select-rs": "Сербия",
-      "settings#egress-region#select-au": "Австралия",
-      "settings#egress-region#description": "У Psiphon есть серверы в разных странах и регионах. Обычно чем ближе сервер Psiphon, тем лучше связь. С другой стороны, вам может понадобиться работать с сайтами и сервисами так, словно вы находитесь в одной стране с сервером Psiphon.",
-      "settings#egress-region#default": "Если оставить опцию <strong>“Лучшая производительность”</strong>, то Psiphon будет автоматически выбирать сервер. Это обычно повышает качество подключения к сети.",
-      "settings#egress-region#invalid-error-msg": "Выберите правильный регион сервера Psiphon",
-      "settings#egress-region#error-modal-title": "Регион сервера недоступен",
-      "settings#egress-region#error-modal-body-http": "Вы настроили Psiphon для использования сервера в конкретном регионе.<br>\nЭтот регион более недоступен.<br>\nНужно выбрать другой регион или опцию по умолчанию “Лучшая производительность”.",
-      "settings#local-proxy-ports#heading": "Порты локальных прокси",
-      "settings#local-proxy-ports#leave-blank": "Оставьте поле <strong>пустым</strong> для автоматического выбора порта (рекомендовано).",
-      "settings#local-proxy-ports#reason": "Внесите значения, если вы используете программы, требующие ручной установки для работы с локальными портами Psiphon, и хотите, чтобы значения этих портов оставались неизменными. Если номера локальных портов не имеют для вас значения, то вам следует позволить Psiphon выбрать их автоматически, чтобы избежать конфликтов.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Значение должно быть между 1 и 65535",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Локальные порты должны быть различны",
-      "settings#local-proxy-ports#error-modal-title": "Конфликт локальных портов прокси",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nВы настроили Psiphon на использование определенного локального порта для HTTP-прокси.<br>\nК сожалению, этот порт уже занят и не может быть использован.\n</p>\n<p>\nПожалуйста, используйте другое значение или оставьте поле пустым, чтобы Psiphon выбрал порт для локального HTTP-прокси автоматически.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВы настроили Psiphon на использование определенного локального порта для SOCKS прокси.<br>\nК сожалению, этот порт уже занят и не может быть использован.\n</p>\n<p>\nПожалуйста, используйте другое значение или оставьте поле пустым, чтобы Psiphon выбрал порт для локального SOCKS прокси автоматически.\n</p>",
-      "settings#upstream-proxy#heading": "Внешний прокси",
-      "settings#upstream-proxy#by-default": "Если ваша система использует прокси, то по умолчанию Psiphon будет использовать этот прокси при подключении. Вы можете определить прокси, отличный от системного, или же полностью отменить использование внешнего прокси.",
-      "settings#upstream-proxy#reason": "Использование внешних прокси иногда требуется для выхода в Интернет в школах, университетах и на предприятиях. Возможно вам понадобится установить настройки внешнего прокси вручную для успешного подключения.",
-      "settings#upstream-proxy#proxy-reqs": "Для HTTP-прокси обязательна поддержка HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Имя узла прокси",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Имя пользователя",
-      "settings#upstream-proxy#password-label": "Пароль",
-      "settings#upstream-proxy#domain-label": "Домен",
-      "settings#upstream-proxy#skip-label": "Не использовать внешний прокси",
-      "settings#upstream-proxy#set-hostname-error-msg": "Нужно указать имя хоста. Если нужен автоматический выбор, оставьте все поля внешнего прокси пустыми.",
-      "settings#upstream-proxy#set-username-error-msg": "Нужно указать имя пользователя (для пароля или домена). Если аутентификация не нужна, оставьте все поля пустыми.",
-      "settings#upstream-proxy#error-modal-title": "Ошибка внешнего прокси",
-      "settings#upstream-proxy#error-modal-body-default": "Текущие настройки Psiphon используют настройки прокси вашей системы в качестве \"внешнего прокси\".<br>\nТем не менее мы не в состоянии подключиться к серверу Psiphon через этот прокси<br>\nПожалуйста, включите опцию \"Не использовать внешний прокси\" и попробуйте снова.",
-      "settings#upstream-proxy#error-modal-body-configured": "Вы настроили Psiphon для использования \"внешнего прокси\".<br>\nТем не менее мы не в состоянии подключиться к серверу Psiphon через этот прокси<br>\nПожалуйста, исправьте настройки и попробуйте снова.",
-      "settings#transport-mode#heading": "Режим соединения",
-      "settings#transport-mode#check-label": "Использовать режим L2TP/IPSec",
-      "settings#transport-mode#help-text": "Выбор встроенного L2TP/IPSec VPN Windows. Туннелируется трафик всех приложений. Использование этого режима легко определяется и блокируется средствами цензуры. <strong>Не рекомендуется</strong> для обхода большинства блокировок.",
-      "settings#systray-minimize#heading": "Минимизировать в область уведомлений панели задач",
-      "settings#systray-minimize#help-text": "Если опция включена, при сворачивании окна приложения Psiphon будет скрываться в области уведомлений панели задач (рядом с часами на панели задач Windows).",
-      "settings#systray-minimize#reason": "Минимизация Psiphon в область уведомлений освобождает место на панели задач. Это особенно удобно, если вы часто используете  Psiphon в течение длительных периодов времени.",
-      "settings#systray-minimize#enable-label": "Минимизировать в область уведомлений панели задач",
-      "settings#applying-message": "Повторное соединение для применения настроек",
-      "settings#saved-message": "Настройки сохранены",
-      "settings#error-modal#title": "Ошибка настроек",
-      "settings#error-modal#body": "Ошибки в настройках значений. Пожалуйста, исправьте их, прежде чем продолжить.",
-      "feedback#top_content_title": "Обратная связь",
-      "feedback#top_para_2": "Большинство проблем решается загрузкой свежей версии Psiphon. Можно <a class=\"newVersionURL\" href=\"#\"> загрузить последнюю версию</a> или отправить email по адресу <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Вы также можете найти ответы на основные вопросы в наших <a class=\"FaqURL\" href=\"#\"> Часто задаваемых вопросах </a>.",
-      "feedback#smiley_happy": "Psiphon соединяется и работает так, как мне нужно",
-      "feedback#smiley_sad": "Psiphon часто не может соединиться или работает плохо",
-      "feedback#text_feedback_prompt": "Ваши комментарии:",
-      "feedback#text_feedback_email_prompt": "Укажите свой email, если хотите получить ответ:",
-      "feedback#diagnostic_check": "Отправить диагностические данные. Они не содержат идентифицирующей информации и помогают нам делать Psiphon лучше. <a class=\"DataCollectionInfoURL\" href=\"#\">Подробнее о том, какие данные мы собираем.</a>",
-      "feedback#submit_button": " Отправить",
-      "feedback#text_feedback_bottom_para": "Если форма вверху не работает или вы хотите прислать нам скриншоты, пожалуйста, напишите на <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Спасибо!</strong> Ваш отзыв отправлен.",
-      "logs#show-debug-label": "Показать логи отладки",
-      "logs#placeholder": "Журналов пока нет",
-      "language#success-message": "<strong>Здравствуйте!</strong> Добро пожаловать в Psiphon.",
-      "about#wordart-tag": "Без Границ",
-      "about#description": "Psiphon – инструмент обхода цензуры</strong>, предназначенный для доступа к интернету без границ, минуя блокировки. У Psiphon <strong>открытый исходный код</strong>. Разработчики находятся в Торонто (Канада).",
-      "about#visit-download-site": "На нашем сайте можно <strong><a class=\"NewVersionURL\" href=\"#\">скачать свежую версию</a></strong> и <strong><a class=\"InfoURL\" href=\"#\">получить помощь и информацию</a></strong>. Psiphon доступен для Android и Windows.",
-      "about#get-by-email": "<strong>Если сайт недоступен</strong>, можно получить новую версию Psiphon по email. Отправьте письмо по адресу: ",
-      "about#client-version": "Версия клиента Psiphon для Windows:",
-      "general#modal-close-button": "Закрыть",
-      "general#notice-modal-tech-preamble": "Техническая информация об ошибке:",
-      "notice#systemproxysettings-setproxy-error-title": "Ошибка системного прокси",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не удалось установить настройки системного прокси</p>.  \n<p>Это могло произойти из-за конфликта с антивирусным программным обеспечением. Возможно, вам потребуется вручную настроить приложения или системный прокси для использования локальных прокси Psiphon.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon не удалось установить настройки системного прокси для интернет-соединения “<%- data %>”.  Это могло произойти из-за конфликта с антивирусным программным обеспечением. Возможно, вам потребуется вручную настроить приложения или системный прокси для использования локальных прокси Psiphon.",
-      "appbackend#state-stopped-title": "Соединение Psiphon отключено",
-      "appbackend#state-starting-title": "Устанавливается соединение Psiphon",
-      "appbackend#state-starting-body": "Пожалуйста, подождите...",
-      "appbackend#state-connected-title": "Соединение Psiphon установлено",
-      "appbackend#state-connected-body": "Исследуйте за пределами ваших границ!",
-      "appbackend#state-connected-reminder-title": "С Psiphon вы всегда будете на связи",
-      "appbackend#state-connected-reminder-body": "Поддержите бесплатное использование Psiphon. Нажмите здесь для посещения веб-страницы нашего спонсора!",
-      "appbackend#state-connected-reminder-body-2": "Поддержите бесплатное использование Psiphon, посетив веб-страницу нашего спонсора!",
-      "appbackend#minimized-to-systray-title": "Psiphon минимизирован в область уведомлений панели задач",
-      "appbackend#minimized-to-systray-body": "Нажмите на иконку, чтобы развернуть приложение",
-      "appbackend#os-unsupported": "Psiphon больше не поддерживает Windows XP и Vista.\nПодробнее можно прочесть на нашем сайте.",
-      "psicash#transaction-error-title": "Ошибка транзакции PsiCash",
-      "psicash#transaction-error-body": "Ваша транзакция PsiCash почему-то прервалась.",
-      "psicash#transaction-ExistingTransaction-title": "Покупка PsiCash уже существует",
-      "psicash#transaction-ExistingTransaction-body": "У вас уже есть покупка PsiCash этого типа. Другая покупка такого же типа невозможна, пока не кончится текущая. Ваш статус PsiCash сейчас будет обновлен.",
-      "psicash#transaction-InsufficientBalance-title": "Слишком низкий баланс PsiCash",
-      "psicash#transaction-InsufficientBalance-body": "Для этой покупки у вас недостаточно средств PsiCash.",
-      "psicash#transaction-TransactionAmountMismatch-title": "Ошибка цены покупки PsiCash",
-      "psicash#transaction-TransactionAmountMismatch-body": "Стоимость покупки PsiCash изменилась. Ваш статус PsiCash будет обновлен.",
-      "psicash#transaction-TransactionTypeNotFound-title": "Тип покупки PsiCash не определен",
-      "psicash#transaction-TransactionTypeNotFound-body": "Желаемый продукт более не доступен. Возможно, понадобится обновить или переустановить приложение.",
-      "psicash#transaction-InvalidTokens-title": "Ошибка токенов PsiCash",
-      "psicash#transaction-InvalidTokens-body": "Ошибка ваших токенов PsiCash. Попробуйте перезагрузить приложение. Если не поможет, возможно, вам придется очистить  <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">локальное хранилище файлов </a>.",
-      "psicash#transaction-ServerError-title": "Ошибка сервера PsiCash",
-      "psicash#transaction-ServerError-body": "Во время покупки сервер PsiCash сообщил об ошибке. Пожалуйста, попробуйте сделать покупку позже. ",
-      "psicash#ui-speedboost-active": "Турбоскорость активна: %s",
-      "psicash#ui-zerobalance-title": "Нужна Турбоскорость?",
-      "psicash#ui-buypsi": "Купить PsiCash",
-      "psicash#ui-buymorepsi": "Купить еще PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Нужно для Турбоскорости",
-      "psicash#ui-enoughbalance-buttontext": "Запуск Турбоскорости",
-      "psicash#1-hour": "1 час",
-      "psicash#1-day": "1 день",
-      "psicash#ui-buyingboost-buttontext": "Запуск Турбоскорости!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Требуется соединение Psiphon",
-      "psicash#mustconnect-modal#body": "Чтобы использовать PsiCash, нужно подключиться к сети Psiphon.",
-      "psicash#init-error-title": "Ошибка инициализации PsiCash",
-      "psicash#init-error-body-unrecovered": "Ошибка инициализации PsiCash. Возможно, дело в файловой системе, например, нехватке дискового пространства. Ваш баланс и прочие показатели сброшены. Использовать PsiCash нельзя. Можете перезапустить приложение, чтобы решить проблему.",
-      "psicash#init-error-body-recovered": "Ошибка инициализации PsiCash. Возможно, дело в файловой системе, например, нехватке дискового пространства. Ваш баланс и прочие показатели сброшены.",
-      "psicash#psiphon-speed": "Скорость<br>Psiphon",
-      "notice#disallowed-traffic-alert-title": "Обновить ваше соединение Psiphon",
-      "notice#disallowed-traffic-alert-body": "<p>Приложения не работают?</p>\n<p>Некоторые типы интернет-трафика не поддерживаются без включенной опции Турбоскорость. Активируйте Турбоскорость при помощи PsiCash и оцените все возможности Psiphon.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Приложения не работают?",
-      "appbackend#disallowed-traffic-notification-body": "Активируйте опцию Турбоскорость, чтобы оценить все возможности Psiphon.",
-      "settings#disallowed-traffic-alert#heading": "Предупреждение о неподдерживаемом трафике",
-      "settings#disallowed-traffic-alert#help-text": "Некоторые типы интернет-трафика не поддерживаются без включенной опции Турбоскорость. Если такой трафик не поддерживается, вы увидите предупреждение. (Чтобы продолжить, придется подключиться снова).",
-      "settings#disallowed-traffic-alert#disable-label": "Отключить предупреждения о неподдерживаемом трафике",
-      "banner#sponsored-by": "При поддержке"
-    }
-  },
-  "sw": {
-    "name": "Kiswahili",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh hapana!</strong>Unaonekana kua na shida ya mtandao!<br>\nPakua toleo la hivi karibuni la Psiphon kutoka kwa <a class=\"NewVersionURL\" href=\"#\">pakua tovuti</a>\n au kwa kutuma barua pepe kwenda <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Kuunganisha",
-      "nav#connection#connected": "Kushikamana",
-      "nav#connection#stopping": "Kutokuunganisha",
-      "nav#connection#stopped": "Tenganisha",
-      "nav#settings": "Mipangilio",
-      "nav#feedback": "Mrejesho",
-      "nav#logs": "Ingia",
-      "nav#about": "Kuhusu",
-      "connection#starting-msg": "Psiphon ni <span class=\"state-word\">kuunganisha</span>...",
-      "connection#stop-btn": "Simama",
-      "connection#connected-msg": "Psiphon ni <span class=\"state-word\">imeunganishwa</span>",
-      "connection#disconnect-btn": "Haijaunganishwa",
-      "connection#stopping-msg": "Psiphon ni <span class=\"state-word\"> Haijaunganishwa</span>...",
-      "connection#wait-btn": "Tfadhali subiri...",
-      "connection#stopped-msg": "Psiphon ni <span class=\"state-word\">haijaunganishwa</span>",
-      "connection#connect-btn": "Unganisha",
-      "connection#egress-region-combo-label": "Chagua eneo la seva",
-      "settings#error-alert": "<strong>Kosa! tafadhali rekebisha thamani kabla isiyosahihi kabla ya kuendelea.",
-      "settings#reset-button": "Kuweka upya kwa chaguo msingi",
-      "settings#apply-button": "Kuomba mabadiliko",
-      "settings#unapplied-changes-prompt#title": "Kuweka mabadiliko",
-      "settings#unapplied-changes-prompt#body": "Umefanya mabadiliko kwa mpangilio wako,lakini haujaomba mabadiliko.<br><br> unamatumaini ya kuomba mabadiliko sasa au waachie?",
-      "settings#unapplied-changes-prompt#apply-button": "Kuomba",
-      "settings#unapplied-changes-prompt#discard-button": "Kuacha",
-      "settings#vpn-incompatible-msg": "(Haifanyikazi na L2TP/IPMara mbili.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "kugawa kwa Tunnel",
-      "settings#split-tunnel#help-text": "Kama ikiwezesha, fanya maombi kwa seva kwenye nyumba ya nchi yako haitakua tunnel kupitia Psiphon.",
-      "settings#split-tunnel#reason": "Tovuti katika nyumba ya nchi yako kwa ujumla haita zuiwa, kwahiyo chaguo hili litakufanya ufikie kwa haraka katika tovuti hizo na muda mwingine inaeza  kupunguza gharama za utumiaji wa ISP data.",
-      "settings#split-tunnel#enable-label": "Usi proxy tovuti ndani ya nchi yako",
-      "settings#disable-timeouts#heading": "Kulemaza mwisho wa muda kwa mitandao ya chini",
-      "settings#disable-timeouts#help-text": "Kama ikiwezesha, wasiliana na Psiphon seva hautamaliza muda.",
-      "settings#disable-timeouts#reason": "Wakati unawezesha hii kwa kuunganisha mtandao wa chini sana, unauwezekano mdogo wa kupata uzoefu wa uunganisho usiotarajiwa.",
-      "settings#disable-timeouts#enable-label": "Lemaza umalizikaji wa mtandao polepole",
-      "settings#egress-region#heading": "Maeneo ya Psiphon Seva",
-      "settings#egress-region#select-best-performance": "Utendaji Mzuri",
-      "settings#egress-region#select-us": "Umoja",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Umoja uingereza",
-      "settings#egress-region#select-jp": "Japani",
-      "settings#egress-region#select-sg": "Singapore",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Netherlands",
-      "settings#egress-region#select-de": "Ujerumani",
-      "settings#egress-region#select-in": "India",
-      "settings#egress-region#select-es": "Hispania",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Austria",
-      "settings#egress-region#select-be": "Ubelgiji",
-      "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Switzerland",
-      "settings#egress-region#select-cz": "Czech Republic",
-      "settings#egress-region#select-dk": "Denmark",
-      "settings#egress-region#select-fr": "Ufaransa",
-      "settings#egress-region#select-hu": "Hungary",
-      "settings#egress-region#select-it": "Italia",
-      "settings#egress-region#select-no": "Norway",
-      "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Uswisi",
-      "settings#egress-region#select-pl": "Polandi",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon ina seva katika nchi nyingi tofauti tofauti na maeneo. Tumia Psiphon seva kwenye mkoa uliofungwa kwenye nchi ya nyuba yako kwa ujumla itatoamunganiko mzuri wa mtandao, lakini tumaini kufikia tovuti na huduma kama ukiwa karibu kwenye nchi maalumu au mkoa.",
-      "settings#egress-region#default": "Chagua chaguo msingi <strong>\"Utendaji Mzuri\"</strong> ruhusu chaguo la Psiphonn kiautomatiki chaguaseva, ambayo kwa ujumla matokeo mazuri ya kuunganishwa kwa mtandao.",
-      "settings#egress-region#invalid-error-msg": "Chagua eneo la seva halali la Psiphon.",
-      "settings#egress-region#error-modal-title": "Eneo la seva halipatikani",
-      "settings#egress-region#error-modal-body-http": "Umesadini Psiphon kwa kutumia seva kwenye mkoa maalumu.<br>\nHataivyo, mkoa huo haipatikani tena.<br>\nUnatakiwa kuchagua mkoa mpya au badili kwenye chaguo-msingi \"Utendaji Mzuri\" chaguo.",
-      "settings#local-proxy-ports#heading": "Vituo vya proxy ya ndani.",
-      "settings#local-proxy-ports#leave-blank": "Toka 1wazi1 kwa chaguo la kituo kiautomati (imependekezwa).",
-      "settings#local-proxy-ports#reason": "Kama unatumia zana kwenye kompyuta yako amabayo inahitaji usanidi kikuli kufanya kazi na Psiphon, utahitaji Psiphon kutumia kila mara namba zilezile za eneo la kituo. Kama hauna sababu ya kubainisha namba za kituo, unatakiwa kuruhusu Psiphon ichague namba hizo  kiatomati kusaidia kuepuka migogoro.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Lazima kua kati ya 1 na 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Vituo vya ndani ni lazima vitofautiane kimoja na kingine.",
-      "settings#local-proxy-ports#error-modal-title": "Mgogoro wa Proxy ya kituo cha ndani.",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nUna Psiphon iliyo sanidiwa kutumia kituo cha ndani maaulumu kwa HTTP proxy yake.<br>\nHata hivyo, kituo hicho kina onekana kuwa kimeshatumika kwahiyo Psiphon haiwezaki kutumia.\n</p>\n<p>\nTafadhali badili hadhi ya kituo cha HTTP proxy iliyosanidiwa na ujaribu tena. Tunapendekeza kuwa usafishe hadhi ili Psiphon iweze kuchukua kituo kinacho patikana kiatomati.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nUna Psiphon iliyo sanidiwa  kutumia kituo cha ndani maalumu cha SOCKS proxy.<br>\nHata hivyo, kituo kicho kinaonekana kimeshatumika hivyo Psiphon haiwezi kutumia.\n</p>\n<p>\nTafadhali badili  hadhi ya kituo cha SOCKS proxy na ujaribu tena. Tunapendekeza kuwa usafishe hadhi ili Psiphon iweze kuchukua kituo kinacho patikana kiatomati.\n</p>",
-      "settings#upstream-proxy#heading": "Proxy ya juu zaidi.",
-      "settings#upstream-proxy#by-default": "Kama kompyuta yako tayari ina proxy iliyo sanidiwa, kwa kaida ya Psiphon itatumia proxy hiyo kipindi cha kuanzisha handaki. Unaweza kuiendesha zaidi hiyo tabia kwa kubainisha proxy ya kutumia, au kwa kubainisha kuwa hakuna \"proxy ya juu zaidi\" inatakiwa kutumika.",
-      "settings#upstream-proxy#reason": "Proxies za juu zaidi muda mwingine zinahitajika na shule, vyuo, au biashara. Kama mtoa mtandao wako amekupa mpangilio wa proxy ya juu zaidi, hivyo mpangilio wa kikuli hapa unahitaji kuunganishwa.",
-      "settings#upstream-proxy#proxy-reqs": "HTTP proxies pekee zinazo saidia HTTPs zinaruhusiwa.",
-      "settings#upstream-proxy#hostname-label": "Jina la mwenyeji",
-      "settings#upstream-proxy#port-label": "Bandari",
-      "settings#upstream-proxy#username-label": "Jina la mtumiaji",
-      "settings#upstream-proxy#password-label": "nywila/ neno siri",
-      "settings#upstream-proxy#domain-label": "Kikoa",
-      "settings#upstream-proxy#skip-label": "Usitumie proxy ya juu zaidi",
-      "settings#upstream-proxy#set-hostname-error-msg": "Wewe lazima utoe hostname au uache wakala mto mashamba matupu kwaajili ya uteuzi wa kiautomatic.",
-      "settings#upstream-proxy#set-username-error-msg": "Wewe lazima kutoa jina la utumiaji kama unaweka nywila au kikoa; au acha mashamba uthibitisho wazi kwaajili ya kutokua na uthibitishaji.",
-      "settings#upstream-proxy#error-modal-title": "Kosa katika proxy ya juu zaidi",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon iliyosanidi kwa sasa kutumia mfumo wako wa proksi kama ilivyo “proksi iliyo juu”.<br>\nWalakini, Tunaonekana kuwezesha kuunganisha kwa Psiphon seva kupitia proksi hiyo.<br>\nTafadhali wezesha “Usitumie proksi ya juu” na jaribu tena.",
-      "settings#upstream-proxy#error-modal-body-configured": "Tuna proksi iliyoundwa kwa kutumia “proksi ya juu”.<br>\nWalakini, Tunaona kua tunawezesha kuunganisha kwa Psiphon seva kupitia proksi hiyo. <br>\nTafadhali rekebishamfumo na jaribu tena.",
-      "settings#transport-mode#heading": "Hali ya usafiri",
-      "settings#transport-mode#check-label": "Tumia hali ya L2TP/IPSec ",
-      "settings#transport-mode#help-text": "Hutumia windows L2P/IPSec mitandao halisi. Hali hii itafunga programu zako zote. lakini haiwezi  kutoa obfuscation na kwahiyo haina nguvu ya mzunguko wa uwezo wa uthibiti. Ni<strong>haipelekei</strong> kwa kupitia moto zaidi.",
-      "settings#systray-minimize#heading": "Punguza kwa eneo Alifu (Tray ya mfumo)",
-      "settings#systray-minimize#help-text": "Kama ikiweseshwa, Wakati unapunguza maombi ya Psiphon dirisha litajificha kwenye eneo la arifu (pia jua kua“tray ya mfumo” au “systray”, iko karibu na saa kwenye kazi ya madirisha  yako ya bar).",
-      "settings#systray-minimize#reason": "Kupunguza Psiphon kwa eneo la arifu (\"mfumo wa tray\") nafasi ya bure katika kazi ya bar. Hii ni kwaajili ya kusaidia kama mara nyingi inaendesha Psiphon yako kwa kipindi cha mda mrefu.",
-      "settings#systray-minimize#enable-label": "Punguza kwenye maeneo ya arifu (mfumo wa tray)",
-      "settings#applying-message": "Unganisha tena kuweza kutekeleza mfumo wako.",
-      "settings#saved-message": "Mifumo imehifadhiwa.",
-      "settings#error-modal#title": "Kosa la mifumo",
-      "settings#error-modal#body": "Kuna makosa katika mpangilio wako wa dhamani. Tafadhali zisahihishe kabla ya mchakato. ",
-      "feedback#top_content_title": "Tupatie mrejesho wako",
-      "feedback#top_para_2": "Matatizo mengi yanaweza kurekebishika kwa kupakua toleo la mwisho. Unaweza <a class=\"NewVersionURL\" href=\"#\"> pakua toleo la mwisho kwa kubonyeza hapa</a>, au  unaweza kutuma kwa barua pepe kwa <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Pia unaweza kutafuta njia katika matatizo ya kawaida kwetu <a class=\"FaqURL\" href=\"#\">Maswali  Yaulizwayo Marakwamara</a>.",
-      "feedback#smiley_happy": "Psiphon inaunganisha na kutenda vile ninavyo taka iwe",
-      "feedback#smiley_sad": "Psiphon mara nyingi inashindwa kuunganisha au haifanyi vizuri vya kutosha.",
-      "feedback#text_feedback_prompt": "Tafadhali ingiza maoni yako hapa:",
-      "feedback#text_feedback_email_prompt": "Kama ungependa kwetu kukujibu, Tafadhali ingiza barua pepe yako:",
-      "feedback#diagnostic_check": "Pakia uchunguzi wa data. Tafadhali nakili kwamba uchunguzi huu wa data haukutambulishi wewe, na itatusaidia kuhifadhi uendeshaji mzuri wa Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Bonyeza hapa kuona data gani tunakusanya.</a>",
-      "feedback#submit_button": "Wasilisha",
-      "feedback#text_feedback_bottom_para": "Kama fomu hapo juu haifanyi kazi, au ungependa kutma skrini, tafadhali tutumie barua pepe kwa <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">maoni@psiphon.ca </a>.",
-      "feedback#success-message": "<strong>Ahsante!</strong> Maoni yako yameshatumwa.",
-      "logs#show-debug-label": "Onyesha kumbukumbu ya ukarabati",
-      "logs#placeholder": "Hakuna kumbukumbu bado",
-      "language#success-message": "<strong>Hello!</strong> Karibu Psiphon.",
-      "about#wordart-tag": "Zaidi ya mipaka",
-      "about#description": "Psiphon ni <strong>uthibitisho wa kifaa cha mzunguko</strong>  — imeundwa kutoa ufikio kwenye  mtandao ulio wazi,sensa z zamani na firewall. Ni <strong>chanzo wazi</strong> na kukuza kwenye Toronto, Canada.",
-      "about#visit-download-site": "Tafadhali tembele wovuti yetu kwa <strong><a class=\"NewVersionURL\" href=\"#\">pakua tolea jipya</a></strong> au kwa <strong><a class=\"InfoURL\" href=\"#\">pata msaada na taarifa</a></strong>. Psiphon inapatikana kwa Admin na madirisha.",
-      "about#get-by-email": "<strong>Kama tovuti haiwezi kufikiwa</strong>,unaeza kupata toleo jipya la Psiphon kwa kutuma barua pepe kwa:",
-      "about#client-version": "Psiphon kwa madirisha ya toleo la mteja:",
-      "general#modal-close-button": "Funga",
-      "general#notice-modal-tech-preamble": "Hizi ni taarifa za kimakosa ya ufundi:",
-      "notice#systemproxysettings-setproxy-error-title": "Kosa la mfumo wa Proksi",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon imeshindwa kuweka mpangilio wa mfumo wa proksi.</p>\n<p>Hii inaweza kua kupitia kwenye migogoro kwenye programu yako ya antivirusi. Unaweza kuhitaji kusanidi matumizi yako mwenyewe au mipangilio ya mfumo wa proksi kwa kutumia proksi za mtaa za Psiphon. ",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon imeshindwa ku seti mfumo wa mpangilio wa proksi kwa kunganisha jina la mtandao \"<%- data%>\". Hii inaweza kuwa kwa sababu ya migogoro kwenye programu yako ya antivirus. Unaweza kuhitaji kusanidi atumizi yako wenyewe au mfumo wa mpangilio wa proksi kwa kutumia proksi za mtaa za Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon haikuunganishwa",
-      "appbackend#state-starting-title": "Psiphon inaunganishwa",
-      "appbackend#state-starting-body": "Tafadhali subiri...",
-      "appbackend#state-connected-title": "Psiphon imeunganishwa",
-      "appbackend#state-connected-body": "Chunguza zaidi mipaka yako!",
-      "appbackend#state-connected-reminder-title": "Psiphon inakuweka kwa kuunganishwa",
-      "appbackend#state-connected-reminder-body": "Weka Psiphon wazi.bonyeza hapa kwa kutembelea kurasa zetu za wadhamini",
-      "appbackend#state-connected-reminder-body-2": "Weka Psiphon wazi kwa kutembelea kurasa yetu ya wadhamini ",
-      "appbackend#minimized-to-systray-title": "Psiphon imeweza kupunguza kwenye eneo la arifu",
-      "appbackend#minimized-to-systray-body": "Bonyeza ikoni ili kurejesha programu",
-      "appbackend#os-unsupported": "Psiphon haisaidii tena madirisha ya XP or Vista.\nTafadhali tembelea tovuti yetu kwa taarifa zaidi. ",
-      "psicash#transaction-error-title": "PsiCash kosa la ununuzi",
-      "psicash#transaction-error-body": "PsiCash yako kushindwa kwa jaribio la shughuli isiyotarajiwa.",
-      "psicash#transaction-ExistingTransaction-title": "Manunuzi ya PsiCash tayari yapo",
-      "psicash#transaction-ExistingTransaction-body": "Unayo kwa sasa manunuzi ya PsiCash ya aina hii. Aina ya manunuzi mengine hayajaruhusiwa mpaka moja kumalizika kwa muda.",
-      "psicash#transaction-InsufficientBalance-title": "Usawa wa PsiCash sio wa kutosha",
-      "psicash#transaction-InsufficientBalance-body": "Haitatosha kua na usawa wa PsiCash kwa manunuzi haya.",
-      "psicash#transaction-TransactionAmountMismatch-title": "Bei ya manunuzi ya PsiCash mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "Bei ya manunuzi ya PsiCash imeoita muda wake. hali ya PsiCash yako itakua imerudishwa sasa.",
-      "psicash#transaction-TransactionTypeNotFound-title": "Aina ya manunuzi ya PsiCash hayafanyi kazi.",
-      "psicash#transaction-TransactionTypeNotFound-body": "Bidhaa uliyojaribu kununua haipo tena. Unatakiwa kusasisha au kuweka tena programu-tumizi. ",
-      "psicash#transaction-InvalidTokens-title": "Tokeni batili ya PsiCash",
-      "psicash#transaction-InvalidTokens-body": "PsiCash tokeni yako ni batli . Jaribu kuanzisha maombi. Kama ikiwa haifanyi kazi, unatakiwa ku <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">futa uhifadhi wako wa karibu</a>.",
-      "psicash#transaction-ServerError-title": "Kosa la PsiCash seva",
-      "psicash#transaction-ServerError-body": "Psiphon seva ilijibu makosa wakati inajaribu kuweka manunuzi. Tafadhali jaribu tena manunuzi yako badae. ",
-      "psicash#ui-speedboost-active": "Kasi&nbsp;kuongeza utendaji kwa %s",
-      "psicash#ui-zerobalance-title": "Inahitaji Kasi&nbsp;Kuongeza?",
-      "psicash#ui-buypsi": "Nunua PsiCash",
-      "psicash#ui-buymorepsi": "Nunua zaidi PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Imehitaji kasi&nbsp;Kuongeza",
-      "psicash#ui-enoughbalance-buttontext": "Anza kwa kasi&nbsp;Ongeza",
-      "psicash#1-hour": "Lisaa1",
-      "psicash#1-day": "Siku1",
-      "psicash#ui-buyingboost-buttontext": "Anza kwa kasi&nbsp;Ongeza!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon inahitaji kuunganishwa",
-      "psicash#mustconnect-modal#body": "Kwaajili ya kutumia PsiCash, Nilazima kunganisha na mtandao wa Psiphon.",
-      "psicash#init-error-title": "PsiCash uanzishwaji wa kosa",
-      "psicash#init-error-body-unrecovered": "PsiCash ilishindwa kuanzisha.Hii inaweza kua tatizo la mfumo wa faili, kama vile kua nje ya nafasi ya diski. Usawa wako na hali nyingine zimepotea. PsiCash haitatumika. Unaweza kujaribu kuanzisha maombi kwa kunusuru tatizo.",
-      "psicash#init-error-body-recovered": "PsiCash ilishindwa kuanzisha. hii inaweza kua tatizo la mfumo wa faili, kama vile kua nje ya nafasi ya diski. Usawa wako na hali nyingine zimewekwa upya.",
-      "psicash#psiphon-speed": "Psiphon<br>Spidi",
-      "notice#disallowed-traffic-alert-title": "Kuboresha Psiphon yako kuunganishwa",
-      "notice#disallowed-traffic-alert-body": "<p>Programu haifanyikazi?</p>\n<p>Wavuti nyingine hazina msaada bila kuongeza kasi ya utendaji. Kuongeza kasi ya kufanya kazi na PsiCash kwa kufungua uwezo mzima wa uzoefu wa Psiphon yako.</p> ",
-      "appbackend#disallowed-traffic-notification-title": "Programu haifanyi kazi?",
-      "appbackend#disallowed-traffic-notification-body": "Kuongeza kasi ya kazi kwa kufungua uwezo kamili wa uzoefu wa Psiphon yako.",
-      "settings#disallowed-traffic-alert#heading": "Hairuhusiwi ku arifu traffic",
-      "settings#disallowed-traffic-alert#help-text": "Baadhi ya aina ya mtandao wa traffic haiungi mkono bila kuaongeza kasi ya utendaji. Wakati kama traffic hairuhusiwi, itaonesha arifu. (Kuwezesha tena kutahitajika kuunganisha tena.)",
-      "settings#disallowed-traffic-alert#disable-label": "Lemaza hairuhusu ku arifu traffic",
-      "banner#sponsored-by": "Imedhaminiwa na"
-    }
-  },
-  "tg": {
-    "name": "Тоҷикӣ",
-    "translation": {
-      "banner#long-connecting": "<strong>Эҳ вой!</strong> Чунин менамояд, ки ҳангоми пайваст шудан ба мушкилиҳо дучор мешавед!<br>\nАз <a class=\"NewVersionURL\" href=\"#\">сайти боргирӣ</a>\nверсияи охирини Psiphon-ро боргирӣ кунед ё ба <a class=\"NewVersionEmail\" href=\"#\"></a> мактуб фиристонед",
-      "nav#connection#starting": "Пайваст мешавем",
-      "nav#connection#connected": "Пайваст шудем",
-      "nav#connection#stopping": "Ҷудо мешавем",
-      "nav#connection#stopped": "Ҷудо шудем",
-      "nav#settings": "Танзимот",
-      "nav#feedback": "Изҳори назар",
-      "nav#logs": "Дафтарҳои қайд",
-      "nav#about": "Маълумот",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">пайваст мешавам</span>…",
-      "connection#stop-btn": "Қатъ кардан",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">пайваст шудем</span>",
-      "connection#disconnect-btn": "Пайвастро қатъ кардан",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">пайвастро қатъ мекунам</span>…",
-      "connection#wait-btn": "Интизор шавед...",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">пайваст қатъ карда шуд</span>",
-      "connection#connect-btn": "Пайваст шудан",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Хато!</strong> Пеш аз идома додан, арзишҳои нодурустро ислоҳ кунед.",
-      "settings#reset-button": "Ба Пешфарз барқарор кардан",
-      "settings#apply-button": "Тағйиротро татбиқ кардан",
-      "settings#unapplied-changes-prompt#title": "Танзимот тағйир дода шуд",
-      "settings#unapplied-changes-prompt#body": "Шумо танзимотро тағйир додед, аммо онро татбиқ накардаед.<br><br>Мехоҳед тағйиротро татбиқ кунед ё бекор кунед?",
-      "settings#unapplied-changes-prompt#apply-button": "Татбиқ кардан",
-      "settings#unapplied-changes-prompt#discard-button": "Бекор кардан",
-      "settings#vpn-incompatible-msg": "(Бо реҷаи L2TP/IPSec кор намекунад).",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Тақсимкунии нақб",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Сайтҳои дохили кишварро бе прокси кушодан",
-      "settings#disable-timeouts#heading": "Меъёрҳои интизориро барои шабакаҳои суст ғайрифаъол кардан",
-      "settings#disable-timeouts#help-text": "Агар фаъол карда шавад, муҳлати иртибот бо сервери Psiphon ҳисобида намешавад.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Меъёрҳои интизориро барои шабакаҳои суст ғайрифаъол кардан",
-      "settings#egress-region#heading": "Минтақаи сервери Psiphon",
-      "settings#egress-region#select-best-performance": "Самаранокии беҳтарин",
-      "settings#egress-region#select-us": "Иёлоти Муттаҳидаи Амрико",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Шоҳигарии Муттаҳида",
-      "settings#egress-region#select-jp": "Ҷопон",
-      "settings#egress-region#select-sg": "Сингапур",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Нидерланд",
-      "settings#egress-region#select-de": "Олмон",
-      "settings#egress-region#select-in": "Ҳиндустон",
-      "settings#egress-region#select-es": "Испания",
-      "settings#egress-region#select-hk": "Ҳонконг",
-      "settings#egress-region#select-at": "Австрия",
-      "settings#egress-region#select-be": "Белгия",
-      "settings#egress-region#select-bg": "Булғористон",
-      "settings#egress-region#select-ch": "Швейтсария",
-      "settings#egress-region#select-cz": "Ҷумҳурии Чех",
-      "settings#egress-region#select-dk": "Дания",
-      "settings#egress-region#select-fr": "Фаронса",
-      "settings#egress-region#select-hu": "Маҷористон",
-      "settings#egress-region#select-it": "Итолиё",
-      "settings#egress-region#select-no": "Норвегия",
-      "settings#egress-region#select-ro": "Руминия",
-      "settings#egress-region#select-se": "Шветсия",
-      "settings#egress-region#select-pl": "Poland",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Минтақаи дурусти сервери Psiphon интихоб кунед.",
-      "settings#egress-region#error-modal-title": "Минтақаи сервер дастнорас аст",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Портҳои проксии маҳаллӣ",
-      "settings#local-proxy-ports#leave-blank": "Барои портҳоро ба таври худкор интихоб кардан, инро <strong>холӣ</strong> гузорид (тавсия дода мешавад).",
-      "settings#local-proxy-ports#reason": "Агар шумо дар компютери худ нармафзореро истифода баред, ки барои бо Psiphon кор кардан танзимкунии дастӣ талаб мекунад, шумо бояд Psiphon-ро барои истифодаи доимии рақамҳои ивазнашавандаи портҳои маҳаллӣ танзим кунед. Агар муайян кардани рақамҳои портҳо шарт набошад, ба Psiphon иҷозат диҳед, ки онҳоро барои пешгирии ихтилофҳо ба таври худкор интихоб кунад.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Бояд байни 1 ва 65535 бошад.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Портҳои маҳаллӣ бояд аз ҳамдигар фарқ кунанд.",
-      "settings#local-proxy-ports#error-modal-title": "Ихтилофи портҳои проксии маҳаллӣ",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nШумо Psiphon-ро барои портҳои маҳаллии муайянро барои HTTP-проксии худ истифода бурдан танзим кардаед.<br>\nАммо ин порт аллакай дар истифода қарор дорад ва Psiphon онро истифода бурда наметавонад.\n</p>\n<p>\nРақами порти HTTP-проксиро иваз карда, кӯшро такрор кунед. Тавсия медиҳем, ки рақамро пурра нест кунед, то Psiphon тавонад ба таври худкор порти холиеро интихоб кунад.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nШумо Psiphon-ро барои портҳои маҳаллии муайянро барои SOCKS-проксии худ истифода бурдан танзим кардаед.<br>\nАммо ин порт аллакай дар истифода қарор дорад ва Psiphon онро истифода бурда наметавонад.\n</p>\n<p>\nРақами порти SOCKS-проксиро иваз карда, кӯшро такрор кунед. Тавсия медиҳем, ки рақамро пурра нест кунед, то Psiphon тавонад ба таври худкор порти холиеро интихоб кунад.\n</p>",
-      "settings#upstream-proxy#heading": "Проксии баромад",
-      "settings#upstream-proxy#by-default": "Агар дар компютери шумо аллакай прокси танзим карда шуда бошад, ҳангоми нақб ташкил кардан, Psiphon ҳамон проксиро истифода мебарад. Шумо метавонед проксии истифода мешударо муайян карда ё имкони бе “проксии баромад”-ро истифода бурда, ин тартиби корро иваз кунед.",
-      "settings#upstream-proxy#reason": "Баъзан, мактабҳо, донишгоҳҳо ва корхонаҳои тиҷорӣ истифодаи проксиҳои баромадро талаб мекунанд. Агар таҳвилгари хизматрасониҳои шабакавӣ ба шумо танзимоти проксии баромад дода бошад, эҳтимол аст, ки барои пайваст шудан, бояд онҳоро дар инҷо ба таври дастӣ дохил кунед.",
-      "settings#upstream-proxy#proxy-reqs": "Танҳо HTTP-проксиҳои дорои дастгирии протоколи HTTPS истифода бурда мешаванд.",
-      "settings#upstream-proxy#hostname-label": "Номи хост",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Номи корбар",
-      "settings#upstream-proxy#password-label": "Парол",
-      "settings#upstream-proxy#domain-label": "Домен",
-      "settings#upstream-proxy#skip-label": "Проксии баромад истифода набурдан",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Хатогии проксии баромад",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon айни ҳол барои проксии системаро ҳамчун “проксии баромади” худ истифода бурдан танзим карда шудааст.<br>\nБо вуҷуди ин, мо тавассути проксии мазкур ба серверҳои Psiphon пайваст шуда наметавонем.<br>\n“Проксии баромад истифода набурдан”-ро фаъол карда, кӯшишро такрор кунед.",
-      "settings#upstream-proxy#error-modal-body-configured": "Шумо Psiphon-ро барои “проксии баромад” истифода бурдан танзим кардаед.<br>\nАммо мо бо истифодаи проксии мазкур ба серверҳои Psiphon пайваст шуда наметавонем.<br>\nТанзимро ислоҳ карда, кӯшишро такрор кунед.",
-      "settings#transport-mode#heading": "Реҷаи таҳвил",
-      "settings#transport-mode#check-label": "Реҷаи L2TP/IPSec истифода бурдан",
-      "settings#transport-mode#help-text": "Шабакасозии виртуалии Windows L2TP/IPSec-ро истифода мебарад. Ин реҷа ҳамаи трафики ҳамаи барномаҳоро тавассути нақб равона мекунад, аммо чигилкунӣ таъмин намекунад ва пас қобилиятҳои қавии фиребкунии сензура надорад. Ин реҷа барои каноргузарии бисёри дарғотҳои амниятӣ <strong>тавсия карда намешавад</strong>.",
-      "settings#systray-minimize#heading": "Ба Қитъаи огоҳиҳо (лавҳаи система) печондан",
-      "settings#systray-minimize#help-text": "Агар фаъол карда шавад, равзанаи барномаи Psiphon дар қитъаи огоҳиҳо (инчунин “лавҳаи система”, ҷойгир дар назди соат дар навори вазифаҳои Windows) печонда мешавад.",
-      "settings#systray-minimize#reason": "Агар Psiphon ба қитъаи огоҳиҳо (”лавҳаи система”) печонда шавад, дар навори вазифаҳои шумо ҷои бештар холӣ мешавад. Ин хусусан дар ҳолати Psiphon-ро дар муҳлатҳои тӯлонӣ истифода бурдан муфид аст.",
-      "settings#systray-minimize#enable-label": "Ба Қитъаи огоҳиҳо (лавҳаи система) печондан",
-      "settings#applying-message": "Барои танзимотро татбиқ кардан аз нав пайваст мешавем.",
-      "settings#saved-message": "Танзимот захира карда шуд.",
-      "settings#error-modal#title": "Хатогии танзимот",
-      "settings#error-modal#body": "Арзишҳои танзимот хатогӣ доранд. Барои идома додан, онҳоро ислоҳ кунед.",
-      "feedback#top_content_title": "Ба мо назари худро изҳор кунед",
-      "feedback#top_para_2": "Бисёри мушкилиҳо метавонанд бо насб кардани версияи охирин бартараф карда шаванд. Шумо метавонед <a class=\"NewVersionURL\" href=\"#\">инҷо зер карда, версияи навро боргирӣ кунед</a>, ё метавонед ба <a class=\"NewVersionEmail\" href=\"#\"></a> мактуби электронӣ фиристед.",
-      "feedback#top_para_3": "Шумо инчунин метавонед дар\n<a class=\"FaqURL\" href=\"#\">Саволҳои роиҷ</a> ба мушкилиҳои маъмул тарзи ислоҳ пайдо кунед.",
-      "feedback#smiley_happy": "Psiphon тарзе, ки ба ман лозим аст, пайваст мешавад ва кор мекунад.",
-      "feedback#smiley_sad": "Psiphon мунтазам пайваст шуда наметавонад ва на он қадар хуб кор мекунад.",
-      "feedback#text_feedback_prompt": "Шарҳҳои худро инҷо дохил кунед:",
-      "feedback#text_feedback_email_prompt": "Агар бихоҳед, ки мо ба шумо ҷавоб диҳем, суроғаи почтаи электронии худро дохил кунед:",
-      "feedback#diagnostic_check": "Иттилооти ташхисӣ бор кардан. Дар хотир доред, ки ин иттилооти ташхисӣ шахсияти шуморо муайян намекунад ва ба мо барои кори дурусти Psiphon-ро таъмин кардан кумак мерасонад. <a class=\"DataCollectionInfoURL\" href=\"#\">Инҷо зер карда, бубинед, ки мо кадом иттилоотро ҷамъ мекунем.</a>",
-      "feedback#submit_button": "Равон кардан",
-      "feedback#text_feedback_bottom_para": "Агар ин варақа кор накунад ё агар ба мо аксҳои экрани худро фиристодан хоҳед, ба мо дар суроғаи <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> мактуби электронӣ фиристед",
-      "feedback#success-message": "<strong>Ташаккур!</strong> Изҳори назари шумо фиристода шуд.",
-      "logs#show-debug-label": "Дафтарҳои қайди ислоҳи нуқсонҳоро нишон додан",
-      "logs#placeholder": "Ҳоло ягон дафтари қайд нест",
-      "language#success-message": "<strong>Салом!</strong> Марҳабо ба Psiphon.",
-      "about#wordart-tag": "Берун аз сарҳадҳо",
-      "about#description": "Psiphon <strong>асбоби рахнакунии маҳдудкунии дастрасӣ</strong> мебошад — он барои фароҳам овардани дастрасӣ ба интернети кушод тариқи фиреб додани воситаҳои сензура ва дарғотҳои амниятӣ тарҳбандӣ шудааст. Он лоиҳаи <strong>манбаи кушод</strong> буда, дар Торонтои Канада таҳия карда шудааст.",
-      "about#visit-download-site": "Барои <strong><a class=\"NewVersionURL\" href=\"#\">версияи навро боргирӣ кардан</a></strong> ё <strong><a class=\"InfoURL\" href=\"#\">маълумот ва кумак гирифтан</a></strong> ба вебсайт гузаред. Psiphon барои Android ва Windows дастрас аст.",
-      "about#get-by-email": "<strong>Агар вебсайт дастнорас бошад</strong>, метавонед ба инҷо мактуби электронӣ фиристода, версияи навро барои худ дастрас кунед:",
-      "about#client-version": "Версияи нармафзори муштарии Psiphon барои Windows:",
-      "general#modal-close-button": "Пӯшидан",
-      "general#notice-modal-tech-preamble": "Маълумот оиди хатогии техникӣ:",
-      "notice#systemproxysettings-setproxy-error-title": "Хатогии проксии система",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon танзимоти проксии системаро ҷӯр карда натавонист.</p>\n<p>Сабаби ин метавонад ихтилоф бо нармафзори зиддивирусӣ бошад. Инро тариқи ба таври дастӣ танзим кардани барнома ё танзимоти проксии система барои истифода бурдани проксиҳои маҳаллии Psiphon ислоҳ кардан мумкин аст.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon барои пайвасти интернетии “<%- data %” танзимоти проксии системаро ҷӯр карда натавонист. Сабаби ин метавонад ихтилоф бо нармафзори зиддивирусӣ бошад. Инро тариқи ба таври дастӣ танзим кардани барнома ё танзимоти проксии система барои истифода бурдани проксиҳои маҳаллии Psiphon ислоҳ кардан мумкин аст.",
-      "appbackend#state-stopped-title": "Psiphon ҷудо шуд",
-      "appbackend#state-starting-title": "Psiphon пайваст мешавад",
-      "appbackend#state-starting-body": "Интизор шавед...",
-      "appbackend#state-connected-title": "Psiphon пайваст шуд",
-      "appbackend#state-connected-body": "Берун аз сарҳадҳо паймоиш кунед!",
-      "appbackend#state-connected-reminder-title": "Psiphon шуморо ба интернет пайваста нигоҳ медорад",
-      "appbackend#state-connected-reminder-body": "Psiphon ройгон аст. Инҷо зер карда, саҳифаҳои парасторони моро аз назар гузаронед!",
-      "appbackend#state-connected-reminder-body-2": "Саҳифаҳои парасторони моро аз назар гузаронда, барои ройгон мондани Psiphon мусоидат кунед.",
-      "appbackend#minimized-to-systray-title": "Psiphon ба қитъаи огоҳиҳо печонда шуд",
-      "appbackend#minimized-to-systray-body": "Барои барномаро барқарор кардан, нишонаро зер кунед",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Парасторӣ аз"
-    }
-  },
-  "th": {
-    "name": "ภาษาไทย",
-    "translation": {
-      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "กำลังติดต่อ",
-      "nav#connection#connected": "เชื่อมต่อสำเร็จ",
-      "nav#connection#stopping": "Disconnecting",
-      "nav#connection#stopped": "ตัดการเชื่อมต่อ",
-      "nav#settings": "ตั้งค่า",
-      "nav#feedback": "การตอบสนอง",
-      "nav#logs": "ปูม",
-      "nav#about": "เกี่ยวกับ",
-      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
-      "connection#stop-btn": "หยุด",
-      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
-      "connection#disconnect-btn": "ตัดการเชื่อมต่อ",
-      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
-      "connection#wait-btn": "Please wait…",
-      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
-      "connection#connect-btn": "เชื่อมต่อ",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
-      "settings#reset-button": "คืนค่าเริ่มต้น",
-      "settings#apply-button": "Apply Changes",
-      "settings#unapplied-changes-prompt#title": "Settings Changed",
-      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
-      "settings#unapplied-changes-prompt#apply-button": "ทำ",
-      "settings#unapplied-changes-prompt#discard-button": "เลิกทำ",
-      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Split Tunnel",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
-      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
-      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
-      "settings#egress-region#heading": "Psiphon Server Region",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "สหรัฐอเมริกา",
-      "settings#egress-region#select-ca": "แคนาดา",
-      "settings#egress-region#select-gb": "สหราชอาณาจักร",
-      "settings#egress-region#select-jp": "ญี่ปุ่น",
-      "settings#egress-region#select-sg": "สิงคโปร์",
-      "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Netherlands",
-      "settings#egress-region#select-de": "Germany",
-      "settings#egress-region#select-in": "อินเดีย",
-      "settings#egress-region#select-es": "สเปน",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "ออสเตรีย",
-      "settings#egress-region#select-be": "เบลเยี่ยม",
-      "settings#egress-region#select-bg": "บัลแกเรีย",
-      "settings#egress-region#select-ch": "สวิตเซอร์แลนด์",
-      "settings#egress-region#select-cz": "สาธารณรัฐเช็ก",
-      "settings#egress-region#select-dk": "เดนมาร์ก",
-      "settings#egress-region#select-fr": "France",
-      "settings#egress-region#select-hu": "ฮังการี",
-      "settings#egress-region#select-it": "อิตาลี",
-      "settings#egress-region#select-no": "นอร์เวย์",
-      "settings#egress-region#select-ro": "โรมาเนีย",
-      "settings#egress-region#select-se": "สวีเดน",
-      "settings#egress-region#select-pl": "โปแลนด์",
-      "settings#egress-region#select-rs": "เซอร์เบีย",
-      "settings#egress-region#select-au": "ออสเตรเลีย",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
-      "settings#egress-region#error-modal-title": "Server Region Unavailable",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Local Proxy Ports",
-      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
-      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Must be between 1 and 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
-      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proxy",
-      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
-      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
-      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
-      "settings#upstream-proxy#hostname-label": "ชื่อโฮสต์",
-      "settings#upstream-proxy#port-label": "พอร์ต",
-      "settings#upstream-proxy#username-label": "ชื่อผู้ใช้",
-      "settings#upstream-proxy#password-label": "รหัสผ่าน",
-      "settings#upstream-proxy#domain-label": "โดเมน",
-      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
-      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
-      "settings#transport-mode#heading": "Transport Mode",
-      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
-      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
-      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
-      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
-      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
-      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
-      "settings#applying-message": "Reconnecting to apply your settings.",
-      "settings#saved-message": "Settings saved.",
-      "settings#error-modal#title": "Settings Error",
-      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
-      "feedback#top_content_title": "Give Us Your Feedback",
-      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
-      "feedback#smiley_happy": "Psiphon connects and performs the way I want it to.",
-      "feedback#smiley_sad": "Psiphon often fails to connect or doesn't perform well enough.",
-      "feedback#text_feedback_prompt": "Please enter your comments here:",
-      "feedback#text_feedback_email_prompt": "If you would like us to respond to you, please enter your email address:",
-      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
-      "feedback#submit_button": "เสนอ",
-      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Thank you!</strong> Your feedback has been sent.",
-      "logs#show-debug-label": "Show debug logs",
-      "logs#placeholder": "No logs yet",
-      "language#success-message": "<strong>Hello!</strong> Welcome to Psiphon.",
-      "about#wordart-tag": "Beyond Borders",
-      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
-      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
-      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
-      "about#client-version": "Psiphon for Windows client version:",
-      "general#modal-close-button": "ปิด",
-      "general#notice-modal-tech-preamble": "Here is the technical error info:",
-      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
-      "appbackend#state-stopped-title": "Psiphon is disconnected",
-      "appbackend#state-starting-title": "Psiphon is connecting",
-      "appbackend#state-starting-body": "Please wait…",
-      "appbackend#state-connected-title": "Psiphon is connected",
-      "appbackend#state-connected-body": "Explore beyond your borders!",
-      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
-      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
-      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
-      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
-      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 ชั่วโมง",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Sponsored by"
-    }
-  },
-  "ti": {
-    "name": "ትግርኛ",
-    "translation": {
-      "banner#long-connecting": "<strong>ኦ ኣይኮነን!</strong> ንምርኻብ ዝተጸገምካ ትመስል<br>\nዳሕራዋይ ቨርጂን ሳይፎን (Psiphon) ካብ <a class=\"NewVersionURL\" href=\"#\">ኣውርድ</a>\nኣውርድ ገጽ ወይ ናብ <a class=\"NewVersionEmail\" href=\"#\"></a> ኢመይል ብምልኣኽ",
-      "nav#connection#starting": "ይራኸብ ኣሎ",
-      "nav#connection#connected": "ተራኺቡ",
-      "nav#connection#stopping": "ኣይራኸበን ኣሎ",
-      "nav#connection#stopped": "ኣይተራኸበን",
-      "nav#settings": "ባይታ-ውህደት",
-      "nav#feedback": "ግብረ-መልሲ",
-      "nav#logs": "መዝገባት",
-      "nav#about": "ብዛዕባ",
-      "connection#starting-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ይራኸብ ኣሎ</span>…",
-      "connection#stop-btn": "ደው ኣብል",
-      "connection#connected-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ተራኺቡ`ሎ</span>",
-      "connection#disconnect-btn": "ኣይተራኽብ",
-      "connection#stopping-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ኣይራኸብን ዘሎ</span>…",
-      "connection#wait-btn": "ሓንሳብ ጽናሕ...",
-      "connection#stopped-msg": "ሳይፎን (Psiphon) <span class=\"state-word\">ኣይተራኸበን</span> ",
-      "connection#connect-btn": "ኣራኽብ",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>ጌጋ!</strong> ቅድሚ ምቕጻልካ ዝተጋገዩ ነገራት ኣዓርዮ.",
-      "settings#reset-button": "ናብ ዝነበሮ ምለስ",
-      "settings#apply-button": "ለውጥታት ኣተግብር",
-      "settings#unapplied-changes-prompt#title": "ባይታ ውህደት ተቐይሩ`ሎ",
-      "settings#unapplied-changes-prompt#body": "ኣብ ባይታ-መወሃሃዲ ለውጢታት ጌርካ `ለኻ፡ ግን ነቲ ለውጥታት ተግባራዊ ኣይገበርካን::<br><br>ዝገበርካዮ ለውጥታት ክትፍጽሞ ተደሊ ዲኻ ወይስ ክተገድፎም ኢኻ ትደሊ?",
-      "settings#unapplied-changes-prompt#apply-button": "ኣተግብር",
-      "settings#unapplied-changes-prompt#discard-button": "ሰርዝ",
-      "settings#vpn-incompatible-msg": "(ምስL2TP/IPSec mode ኣይሰርሕን.)",
-      "settings#vpn-incompatible-label": "L2TP/IPsec",
-      "settings#split-tunnel#heading": "ስፕሊት ታነል",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "ነዚ እንተመሪጽካ ኣብ ሃገርካ ንዘሎ ሰርቨራት ንምጥቃም ዝተግብረ ሕቶ ብሳይፎን ኣይመሓላለፍን`ዩ",
-      "settings#disable-timeouts#heading": "ነትወርክ ኣብ ዝዝሕለሉ እዋን ታይምኣውትስ ኣጥፍእ",
-      "settings#disable-timeouts#help-text": "እዚ እንተተወሊዑ ምስ ናይ ሳይፎን (Psiphon) ሰርቨር ዘሎ ርክብ ኣይክጠፍእን`ዩ፡፡",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "ንዝሑላት ነትዎርክታት ናይ ግዜ ዕረፍቲታት ኣደስክል",
-      "settings#egress-region#heading": "ናይ ሳይፎን (Psiphon) ዞባ ሰርቨር",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "ዩናይትድ ስቴትስ",
-      "settings#egress-region#select-ca": "ካናዳ",
-      "settings#egress-region#select-gb": "ዓባይ ብሪጣንያ",
-      "settings#egress-region#select-jp": "ጃፓን",
-      "settings#egress-region#select-sg": "ሲንጋፖር",
-      "settings#egress-region#select-sk": "ስሎቫክያ",
-      "settings#egress-region#select-nl": "ነዘርላንድስ",
-      "settings#egress-region#select-de": "ጀርመን",
-      "settings#egress-region#select-in": "ህንዲ",
-      "settings#egress-region#select-es": "ስጳኛ",
-      "settings#egress-region#select-hk": "ሆንግ ኮንግ",
-      "settings#egress-region#select-at": "ኣውስትራሊያ",
-      "settings#egress-region#select-be": "በልጁም",
-      "settings#egress-region#select-bg": "ቡልጋርያ",
-      "settings#egress-region#select-ch": "ስዊዘርላንድ",
-      "settings#egress-region#select-cz": "ቸክ ሪፓብሊክ",
-      "settings#egress-region#select-dk": "ደንማርክ",
-      "settings#egress-region#select-fr": "ፈረንሳይ",
-      "settings#egress-region#select-hu": "ሃንጋሪ",
-      "settings#egress-region#select-it": "ኢጣልያ",
-      "settings#egress-region#select-no": "ኖርወይ",
-      "settings#egress-region#select-ro": "ሮማንያ",
-      "settings#egress-region#select-se": "ሽወደን",
-      "settings#egress-region#select-pl": "ፖላንድ",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "ትኽክለኛ ዞባ ሰርቨር ሳይፎን (Psiphon) ምረጽ",
-      "settings#egress-region#error-modal-title": "ኽሊ ሰርቨር ኣይተረኽበን",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "ውሽጣዊ ፕሮክሲ ፖርትስ",
-      "settings#local-proxy-ports#leave-blank": "ንኣውቶማቲክ ፖርት ምርጫ ካብ <strong>ባዶ</strong> ውጻእ (ዝድገፍ ሓሳብ) ",
-      "settings#local-proxy-ports#reason": "ኣብ ኮምፒተርካ ምስ ሳይፎን (Psiphon) ዝሰርሕ ማኑዋል ውህደት ዘድልዮ መሳርሒ እንተተጠቒምካ፡ ሳይፎን (Psiphon) ብቐጻሊ ሓደ ዓይነት ቁጽርታት ከባቢያዊ ፖርት ክጥቀም ክደሊ`ዩ። ቁጽርታት ፖርት ክተነጽር ምኽንያት ዘይብልካ እንተኾይኑ ግን፡ ሳይፎን (Psiphon) ብቐጥታ ክጥቀመሎም ክተፍቅደሉ ይግባእ- ግጭታት ንምውጋድ ንኽሕግዘካ፡፡ ",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "ካብ 1 ክሳብ 65535 ክኸውን ኣለዎ፡፡",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": " ከባቢያዊ ፖርትታት ነንሕድሕዶም ዝተፈላለዩ ክኾኑ`ለዎም",
-      "settings#local-proxy-ports#error-modal-title": "ግጭት ከባቢያዊ ተካኢ ፖርትታት",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\n ሳይፎን (Psiphon)  ንHTTP ፍሉይ ተካኢ ከምዝጥቀም ጌርካ ኣወሃሂድካዮ ኣለኻ<br>\nእንተኾነ እቲ ፖርት ድሮ ኣብ ስራሕ ስለዘሎ ሳይፎን (Psiphon) ክጥቀመሉ ኣይኽእል`ዩ \n</p>\n<p>\nዝተወሃሃደ HTTP ፕሮክሲ ፖርት ቀይርካ እንደገና ፈትን። ሳይፎን (Psiphon) ኣብ ናቱ ዘለዉ ፖርትታት ንኽመርጽ ዘለዉ ዋጋታት ብምልኦም ክተጥፍኦም ትምከር::\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\n ሳይፎን (Psiphon) ኣዋዲድካ `ለኻ ፍሉይ ከባቢያዊ ፖርት ንኽጥቀም ንናቱ SOCKS ፕሮክሲ። <br>\n እንተኾነ እቲ ፖርት ኣብ ጠቕሚ ውዒሉ ስለዘሎ ሳይፎን (Psiphon)  ክጥቀመሉ ኣይክእልን`ዩ። \n</p>\n<p>\nስለዚ ንዝተዋደደ SOCKS ፕሮክሲ ቀይርካ እንደገና ፈትን 3. ሳይፎን (Psiphon) ብቐጥታ ነቲ ዘሎ ፖርት መታን ክመርጽ ንኹሉ ዋጋታት ክተጽርዮ ትምከ፡፡ር\n</p>",
-      "settings#upstream-proxy#heading": "ፕሮክሲ ላዕላዋይ ዋሕዚ",
-      "settings#upstream-proxy#by-default": "ኮምፒተርካ ፕሮክሲ ዝገጠመሉ እንተኾይኑ፡ ከም ንቡር ሳይፎን (Psiphon) ነቲ ፕሮክሲ ክጥቀመሉ`ዩ፡፡ መሕለፊ ክገብር ከሎ ትጥቀመሉ ፕሮክሲ ብምንጻር ግን ንዕኡ ክትሰግሮ ትኽእል ኢኻ ወይ ከኣ ከምኡ ዓይነት \"ፕሮክሲ ላዕላዋይ ዋሕዚ\" ዘይምጥቃም ዝብል ብምጥቃም።",
-      "settings#upstream-proxy#reason": "ላዕላዋይ ዋሕዚ ተካእቲ ሓደ ሓደ ግዜ ብኣብያተ ትምህርቲ፡ ዩኒቨርሲታት ወይ ኣብያተ-ንግዲ ይድለዩ`ዮም። ነትወርክ ዘቕርበልካ፡ ላዕላዋይ-ዋሕዚ ተካኢ ባይታ ውህደት እንተሂቡካ፡ ንምርኻብ ብማኑዋል ውህደት ምስራሕ ከድሊ`ዩ፡፡",
-      "settings#upstream-proxy#proxy-reqs": "HTTP ጥራሕን ምስ HTTPS ዝሰማምዑን ተካእቲ ይፍቀደሎም ",
-      "settings#upstream-proxy#hostname-label": "ኣተኣናጋዲ ሽም",
-      "settings#upstream-proxy#port-label": "ፖርት",
-      "settings#upstream-proxy#username-label": "ሽም ተጠቃሚ",
-      "settings#upstream-proxy#password-label": "መሕለፊ",
-      "settings#upstream-proxy#domain-label": "ዶመይን",
-      "settings#upstream-proxy#skip-label": "ፕሮክሲ ላዕላይ ዋሕዚ ኣይትጠቐም",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "ናይ ላዕላዋይ ዋሕዚ ጌጋ",
-      "settings#upstream-proxy#error-modal-body-default": "ሳይፎን (Psiphon)  ተዋዲዱ ዘሎ፡ \"ላዕላዋይ ዋሕዚ ፕሮክሲ\" ንኽጥቀም`ዩ። <br>\nእንተኾነ በታ ፕሮክሲ ጌርካ ናብ ሰርቨር ሳይፎን (Psiphon) ምርኻብ ኣይተኻእለን። <br>\nስለዚ \"ላዕላዋል ፕሮክሲ ኣይትጠቐም\" ዝብል ኣንቂሕካ እንደገና ፈትን።",
-      "settings#upstream-proxy#error-modal-body-configured": "ሳይፎን (Psiphon)  \"ላዕላዋይ ተካኢ\" ከምዝጥቀም ጌርካ ኣወሃሂድካያ ኣለኻ።<br>\nነገር ግን በታ ተካኢ ወይ ፕሮክሲ ምስ ሰርቨር ሳይፎን (Psiphon) ክንራኸብ ኣይክኣልንን ይመስል ኣሎ፡፡<br>\nብኽብረትካ ነቲ ሴቲንግስ ብምዕራይ ደጊምካ ፈትን፡፡",
-      "settings#transport-mode#heading": "መጉዓዚ ሞድ",
-      "settings#transport-mode#check-label": " L2TP/IPsec  ሞድ ተጠቐም",
-      "settings#transport-mode#help-text": "ንዊንዶውስ L2TP/IPsec ሓሳባዊ ኔትወርክ ተጠቐም። እዚ ሞድ`ዚ ንኹሉ መተግበሪ ኣፓት የመሓላልፍ`ዩ:: ነገር ግን መሰወሪ ስለዘይህብ ሓያል ሰንሰርሺፕ መከላኸሊ ዓቕሚ ይብሉን፡፡ ስለዚ ንመብዛሕቲኦም ፋየርወላት ንምሕላፍ <strong>ኣይምከርን</strong>::",
-      "settings#systray-minimize#heading": "መዘኻኸሪ ከባቢ ነክይ (ሲስተም ትረይ)",
-      "settings#systray-minimize#help-text": "እንተነቒሑ፡ ናይ ሳይፎን (Psiphon) መተግበሪ ዊንደው ክተንእሶ ኸለኻ ኣብ መዘኻኸሪ ከባቢ ክሕባእ`ዩ (\"ሲስተም ትረይ\" ወይ \"ሲስትረይ\" ተባሂሉ`ውን ይጽዋዕ`ዩ)",
-      "settings#systray-minimize#reason": "ሳይፎን (Psiphon) ናብ መዘኻኸሪ ከባቢ ምንኣስ(ሲስተም ትረይ) ኣብ ታስክ ባር ቦታ ክህበካ ይኽእል`ዩ። እዚ ድማ ዝያዳ ሓጋዚ`ዩ ሳይፎን (Psiphon) ንንውሕ ዝበለ ግዜ ትጥቀመሉ እንተኾይንካ",
-      "settings#systray-minimize#enable-label": "ናብ መዘኻኸሪ ከባቢ ኣንእስ (ሲስተም ትረይ)",
-      "settings#applying-message": "ባይታ ውህደትካ ንምትግባር ኣብ ምርኻብ ኣሎ",
-      "settings#saved-message": "ውህደት ባይታታትካ ተኸዚኑ`ሎ",
-      "settings#error-modal#title": "ጌጋ ባይታ ውህደት",
-      "settings#error-modal#body": "ኣብ ዋጋታት ባይታ ውህደትካ ጌጋታት ኣለዉ። ቅድሚ ምቕጻልካ ኣርሞም፡፡",
-      "feedback#top_content_title": "ርእቶኹም ሃቡና",
-      "feedback#top_para_2": "ዳሕራዋይ ቨርጂን ብምውራድ ብዙሕ ጸገማት ክፍታሕ ይኽእል`ዩ:: ኣብ`ዚ </a>, ብምጥዋቕ <a class=\"NewVersionURL\" href=\"#\">ክተውርድ ትኽእል ኢኻ ወይ ናብ <a class=\"NewVersionEmail\" href=\"#\"></a> ኢመይል ክትልእኽ ትኽእል ኢኻ፡፡",
-      "feedback#top_para_3": "ኣብ <a class=\"FaqURL\" href=\"#\">ብተደጋጋሚ ዝሕተቱ ሕቶታት</a> ንብዙሓት ዝውቱራት ሕቶታት ፍታሕ ክተረክብ ትኽእል ኢኻ፡፡",
-      "feedback#smiley_happy": "ሳይፎን (Psiphon) በቲ ዝደልኽዎ ይሰርሕን የራኽበንን ኣሎ፡፡",
-      "feedback#smiley_sad": "ሳይፎን (Psiphon) ፅቡቕ ይሰርሕ የለን፡፡",
-      "feedback#text_feedback_prompt": "ርእይቶታትካ ኣብ`ዚ ኣእቱ፡",
-      "feedback#text_feedback_email_prompt": "ክንምልሰልካ እንተደሊኻና ኢመይልካ ኣብ`ዚ ኣእቱ፡፡",
-      "feedback#diagnostic_check": "ዳታ መመርመሪ ጽዓን። እዚ ዳታ መርመራ ከላልየካ ኣይክእልን`ዩ ከምኡ`ውን ሳይፎን (Psiphon) ብጽቡቕ ክሰርሕ ክሕግዘና`ዩ:: <a class=\"DataCollectionInfoURL\" href=\"#\">ዝኣከብናዮ ዳታ ንምርኣይ ኣብ`ዚ ጠውቕ ፡፡</a>",
-      "feedback#submit_button": "ኣረክብ",
-      "feedback#text_feedback_bottom_para": "ኣብ ላዕሊ ዘሎ ቐጥዒ ዘይሰርሕ እንተኾይኑ ወይ ስክሪሾትስ ክትልእኽ እንተደሊኻ ናብ <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> ልኣኸልና",
-      "feedback#success-message": "<strong>የቐንየልና!</strong> ርእይቶኻ ተላኢኹ`ሎ፡፡",
-      "logs#show-debug-label": "ዲባግ ምሎግስ ኣርኢ",
-      "logs#placeholder": "ሎግ የለን",
-      "language#success-message": "<strong>ሄሎ!</strong> ናብ ሳይፎን (Psiphon) እንቋዕ መጻእኩም",
-      "about#wordart-tag": "ኪነው ዶባት",
-      "about#description": "ሳይፎን (Psiphon)  ሓደ <strong>ሰንሰርሺፕ ዝዋጋእ መሳርሒ`ዩ</strong> — ንናጻ ኢንተርነት፡ንዝሓለፈ ሰንሰራት ከምኡ`ውን ፋየርዎላት መሕለፊ ንኽህብ ዝተሰርሐ`ዩ፡፡ ክፉት <strong>ምንጪ ኣብ</strong> ቶሮንቶ ካናዳ ዝተሰርሐ`ዩ::",
-      "about#visit-download-site": "ካብ`ዚ <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">ሓገዝን ሓበሬታን ርኸብ</a></strong>፡፡ ሳይፎን (Psiphon) ን Android ን Windows ኣሎ፡፡",
-      "about#get-by-email": "<strong>እቲ መርበብ ዘይብጻሕ እንተኾይኑ</strong> ሓዲሽ ቨርጂን ሳይፎን (Psiphon)   ምርካብ ይክኣል ናብ`ዚ ኢመይል ብምግባር፡",
-      "about#client-version": "ሳይፎን (Psiphon) ንዊንዶውስ ክሌንት ቨርጂን",
-      "general#modal-close-button": "ዕጾ",
-      "general#notice-modal-tech-preamble": "እዚ ናይ ተክኒካዊ ጌጋ ሓበረታ`ዩ፡",
-      "notice#systemproxysettings-setproxy-error-title": "ስርዓት ጌጋ ተካኢ",
-      "notice#systemproxysettings-setproxy-error-body": "<p>ሳይፎን (Psiphon) ባይታ ውህደት ተካኢ ክጅምር ኣይክኣልን፡፡</p>\n<p> እዚ ማለት ምስ ጸረ-ቫይረስ ሶፍትወርካ ተጋጭዩ ክኸውን ይኽእል`ዩ። መግበሪኻ ብማንዋል ምውህሃድ የድልየካ ይኸውን ወይ ባይታ ውህደት ተካኢ ንከባቢያዊ ሳይፎን (Psiphon) ተካእቲ ንምጥቃም፡፡</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "ሳይፎን (Psiphon) “<%- data %>” ዝብሃል ርክብ ኢንተርነት ብተካኢ ባይታ ውህደት ከጀምሮ ኣይክኣለን። ምስ ምስ ጸረ-ቫይረስ ሶፍትወርካ ስለዘይተሰማምዐ ክኸውን ይኽእል። መተግበሪኻ ማንዋል ብዝኾነ መንገዲ ምውህሃድ ከድልየካ `ዩ-ወይ ከኣ ከባቢያዊ ተካእቲ ንምጥቃም ስርዓት ባይታ ውህደት ተካኢ ክጥቀም ይኽእል፡፡",
-      "appbackend#state-stopped-title": "ሳይፎን (Psiphon) ተቛሪጹ`ሎ",
-      "appbackend#state-starting-title": "ሳይፎን (Psiphon) ይራኸብ ኣሎ",
-      "appbackend#state-starting-body": "ሓንሳብ ጽናሕ…",
-      "appbackend#state-connected-title": "ሳይፎን (Psiphon) ተራኺቡ`ሎ",
-      "appbackend#state-connected-body": "ኪነው ዶባትካ ዳህስስ",
-      "appbackend#state-connected-reminder-title": "ሳይፎን (Psiphon)  ኣራኺቡካ `ሎ",
-      "appbackend#state-connected-reminder-body": "ሳይፎን (Psiphon)  ናጻ ግደፎ:: ናብ መዋሊና ገጻት ንምብጻሕ ኣብ`ዚ ጠውቕ!",
-      "appbackend#state-connected-reminder-body-2": "ሳይፎን (Psiphon)  ናጻ ግደፎ-ናብ መዋሊና ገጻት ብምብጻሕ!",
-      "appbackend#minimized-to-systray-title": "ሳይፎን (Psiphon) ናብ መዘኻኸሪ ከባቢ ንኢሱ`ሎ",
-      "appbackend#minimized-to-systray-body": "መተግበሪ ናብ ዝነበሮ ንምምላስ ነዚ ኣይከን ጠውቕ",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "ዝተመወለ ብ"
-    }
-  },
-  "tk": {
-    "name": "Türkmençe",
-    "translation": {
-      "banner#long-connecting": "<strong>Waheý</strong> Birikmekde näsazlyk çykýar!<br>\nPsiphon-yň iň soňky görnüşini  <a class=\"NewVersionURL\" href=\"#\">şu saýtdan indir</a>\nýada email ugrat <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Birikdirilýär...",
-      "nav#connection#connected": "Birikdirildi",
-      "nav#connection#stopping": "Birikmeýär",
-      "nav#connection#stopped": "Birikmedi",
-      "nav#settings": "Sazlamalar",
-      "nav#feedback": "Seslenme",
-      "nav#logs": "Ýazgylar",
-      "nav#about": "Hakynda",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\"> birikýär</span>…",
-      "connection#stop-btn": "Dur",
-      "connection#connected-msg": "Psiphon<span class=\"state-word\">birikdi </span>",
-      "connection#disconnect-btn": "Birikme",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\"> birikdirilenok</span>…",
-      "connection#wait-btn": "Garaşyň",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">birikmedi </span>",
-      "connection#connect-btn": "Birikdirildi",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Säwlik!</strong> Hayyş, dowam etmekden öñ nädogry bellikleri düzediñ.",
-      "settings#reset-button": "Täzeden asyla dolan",
-      "settings#apply-button": "üýtgetmeleri ulan",
-      "settings#unapplied-changes-prompt#title": "Sazlamalar Üýtgedildi",
-      "settings#unapplied-changes-prompt#body": "Siz sazlamalarda üytgeşmeler edipsiñiz, ýöne ol üytgeşmeleri ulanmansyñyz.<br><br>Siz üytgeşmeleri şu wagt ulanmakçy my ýa-da ret et?",
-      "settings#unapplied-changes-prompt#apply-button": "Ulan",
-      "settings#unapplied-changes-prompt#discard-button": "Ret et",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec ülñi bilen išlänok.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Ötük bölündi",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Öz ýurduňyzdaky websaýtlary proksileme.",
-      "settings#disable-timeouts#heading": "Yuwaş network üçin goşmaça wagtalmalary öçür ",
-      "settings#disable-timeouts#help-text": "Işledilen halatynda, Psiphon serwer baglanşygy wagtdan geçmez.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Yuwaş network halatynda goşmaça wagtalmalary öçür ",
-      "settings#egress-region#heading": "Psiphon Serwer Ýurdy",
-      "settings#egress-region#select-best-performance": "Ýokary hilli işleýişi",
-      "settings#egress-region#select-us": "Amerikaň Birleşen Ştatlary",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Beýik Britaniýa",
-      "settings#egress-region#select-jp": "Ýaponiýa",
-      "settings#egress-region#select-sg": "Singapur",
-      "settings#egress-region#select-sk": "Slowakiýa",
-      "settings#egress-region#select-nl": "Gollandiýa",
-      "settings#egress-region#select-de": "Germaniýa",
-      "settings#egress-region#select-in": "Hindistan",
-      "settings#egress-region#select-es": "Ispaniýa",
-      "settings#egress-region#select-hk": "Gong Kong",
-      "settings#egress-region#select-at": "Awstriýa",
-      "settings#egress-region#select-be": "Belgiya",
-      "settings#egress-region#select-bg": "Bolgariýa",
-      "settings#egress-region#select-ch": "Şweýsariýa",
-      "settings#egress-region#select-cz": "Çeh Respublikasy",
-      "settings#egress-region#select-dk": "Daniýa",
-      "settings#egress-region#select-fr": "Fransiýa",
-      "settings#egress-region#select-hu": "Wengriýa",
-      "settings#egress-region#select-it": "Italiya",
-      "settings#egress-region#select-no": "Norwegiýa",
-      "settings#egress-region#select-ro": "Rumyniýa",
-      "settings#egress-region#select-se": "Şwesiýa",
-      "settings#egress-region#select-pl": "Olonya",
-      "settings#egress-region#select-rs": "Serbiýa",
-      "settings#egress-region#select-au": "Awstraliýa",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Ÿörgünli Psiphon serwer yurduny ulan.",
-      "settings#egress-region#error-modal-title": "Serweriň Ýurdy elýeterli däl",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Yerli Proksi portlary",
-      "settings#local-proxy-ports#leave-blank": "Automatiki port saýlawy üçin<strong>boş</strong> goýmak (maslahat berilýär).",
-      "settings#local-proxy-ports#reason": "Kompýuteriňizde elde düzediş talap edýän serişdeleri Psiphon bilen ulanýan bolsaňyz, onda ýerli birmeňzeş Psiphon port nomerlerini ulanmagy isläp bilersiňiz. Eger port nomerlerini görkezmek islemeýän bolsaňyz we näsazlyklaryň öňüni almak üçin Psiphona automatik port nomerlerini saýlamana rugsat beriň.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 bilen 65535 aralygynda bolmaly",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Yerli portlar biri-birinden tapawutly bolmaly.",
-      "settings#local-proxy-ports#error-modal-title": "Yerli Proksi portlarynda çaknyşyk",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nSiz aýratyn ýerli portyň HTTP proksini ulanmak üçin Psiphon-y sazladyňyz.<br>\nÝone, ol port eýýäm ulanylýar we Psiphon ulanyp bilenok.\n</p>\n<p>\nHaýyş sazlanan HTTP proksi port hasabyny üýtget we täzeden syna. Psiphon elýeterli porty automatiki saýlamasy üçin, port hasaby arassalamagy maslahat berýäris.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nSiz aýratyn ýerli portyň SOCKS proksini ulanmak üçin Psiphon-y sazladyňyz.<br>\nÝone, ol port eýýäm ulanylýar we Psiphon ulanyp bilenok.\n</p>\n<p>\nHaýyş sazlanan SOCKS proksi port hasabyny üýtget we täzeden syna. Psiphon elýeterli porty automatiki saýlamasy üçin, port hasaby arassalamagy maslahat berýäris.\n</p>",
-      "settings#upstream-proxy#heading": "Upstream Proksi",
-      "settings#upstream-proxy#by-default": "Komýuteriňizde öňden proksi gurnalan bolsa, Psiphon tünel gurnamakda şol proksini ulanar. Haýsy proksini ulanmagy görkezip, üýtgetmegi belläp, ýada “upstream proxy” ulanmazlygy belläp bilersiňiz.",
-      "settings#upstream-proxy#reason": "Mekdepler, ýokary okuw jaýlary we edaralar köplenç \"upstream\" proksini talap eder. Eger network üpjün ediji size \"upstream\" proksi sazlamalary beren bolsa, onda birikmek üçin el bilen düzediş gerek bolar.",
-      "settings#upstream-proxy#proxy-reqs": "Diñe HTTPS goldayan HTTP proksilara rugsat berilyär.",
-      "settings#upstream-proxy#hostname-label": "Eýeady",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Ulanjyady",
-      "settings#upstream-proxy#password-label": "Açarsözi",
-      "settings#upstream-proxy#domain-label": "Domain",
-      "settings#upstream-proxy#skip-label": "Yokarky Proksi akymyny ulanma",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Upstream prokside säwlik",
-      "settings#upstream-proxy#error-modal-body-default": "Şuwagt Psihon “upstream proxy” görnüşini ulanmak üçin sazlanan.<br>\nÝöne, Psiphon-a ol proksi arkaly serwere birikmäni başaranok.<br>\nHaýyş “upstream proxy” ulanma we täzeden syna.",
-      "settings#upstream-proxy#error-modal-body-configured": "Siz “upstream proxy” görnüşinde ulanmak üçin sazlandy.<br>\nÝöne, Psiphon-a ol proksi arkaly serwere birikmäni başaranok.<br>\nHaýyş täzeden sazla we täzeden synanyş.",
-      "settings#transport-mode#heading": "Geçirmek Görnüşi",
-      "settings#transport-mode#check-label": "L2TP/IPSec görnüşi ullan",
-      "settings#transport-mode#help-text": "Windows L2TP/IPSec wirtual network-ini ulanýar. Bu görnüş siziň ähli programmalary tunel eder, emma ol güýçli senzuralary geçmekde we gizlin galmakda ukypsyzdyr. Bu böwetli saýtlary geçmek üçin<strong>maslahat berilenok</strong>.",
-      "settings#systray-minimize#heading": "Duýduryş Bölümine Kiçelt  (System Tray)",
-      "settings#systray-minimize#help-text": "Işledilende, kiçeldilen Psiphon programma penjiresi duýduryş bölüminde gizlener.(Windows-da ýumuş çybygynda, sagat görkezijiniň ýanynda ýerleşýän köplenç \"system tray\" ýada \"systray\" atlandyrylýar)",
-      "settings#systray-minimize#reason": "Ýumuş çybygynda yer açmak, duýduryş bölümine (\"system tray\") Psiphon-y kiçeltmek arkaly bolar. Bu Psiphony uzak wagtlap işlemegini kömek eder.",
-      "settings#systray-minimize#enable-label": "Duýduryş bölümine Kiçelt  (System Tray)",
-      "settings#applying-message": "Sazlamalary ulanmak üçin täzeden birikýär.",
-      "settings#saved-message": "Sazlamalar yatda saklanyldy.",
-      "settings#error-modal#title": "Sazlamalar Säwlik",
-      "settings#error-modal#body": "Sazlama hasaplarda näsazlyk bar. Haýyş dowam etmezden öň düzediň.",
-      "feedback#top_content_title": "Seslenme beriň",
-      "feedback#top_para_2": "Iň soňky görnüşi ýüklemek arkaly köp yüze çykan meseleleri düzedip bolar. Siz<a class=\"NewVersionURL\" href=\"#\">şu ýere basyp iň soňky görnüşi ýükläp bilersiňiz</a>, ýada email ugradyp bilersiňiz<a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Siz umumy meseleriň çözgüdini biziń <a class=\"FaqURL\" href=\"#\">Yygy-ýygydan Soralýan Soraglar</a>bölüminde tapyp bilersiñ.",
-      "feedback#smiley_happy": "Psiphon islegime görä birikýär we işleýär.",
-      "feedback#smiley_sad": "Psiphon köplenç birikmegi şowsuz yada kanagatlandyryjy işlemeýär. ",
-      "feedback#text_feedback_prompt": "Haýyş, öz teswiriñizi bu ýere yaz:",
-      "feedback#text_feedback_email_prompt": "Eger-de bizden jogap almagy islesenñiz, onda öz email salgyñyzy su yerde yazyñ:",
-      "feedback#diagnostic_check": "Diagnostiki maglumatlary ýükle. Bellik, bu diagnostiki maglumatlar sizi belli etmez, we ol bize Psiphon kadaly işlemegine kömek eder. <a class=\"dataCollectionInfoURL\" href=\"#\">Biziň nähili maglumat topýanymyzy görmek üçin şu ýere bas.</a>",
-      "feedback#submit_button": "Iber",
-      "feedback#text_feedback_bottom_para": "Eger-de ýokardaky forma işlemeýän bolsa ýa-da ekran suradyny ibermek isleseňiz, haýyş bize<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> email ugradyñ. ",
-      "feedback#success-message": "<strong>Sag Boluň!</strong> Siziň seslenmäňiz iberildi.",
-      "logs#show-debug-label": "\"Debug\" loglary görkez",
-      "logs#placeholder": "Hiç hili loglar ýok",
-      "language#success-message": "<strong>Salam!</strong>Psiphon hoş geldiñiz.",
-      "about#wordart-tag": "Çäklerinden daşarda",
-      "about#description": "Psiphon  <strong>senzuranyň öňüni alyjy enjam</strong>. Senzuralary we böwetli girişleri geçmek üçin dizaýn edilen, çäksiz Internet giriş enjamy. Ol <strong>açyk çeşme</strong> we Kanadanyň Tortonto şäherinde döredilen.",
-      "about#visit-download-site": "Haýyş  <strong><a class=\"NewVersionURL\" href=\"#\">täze görnüşi indirmek</a>ýada<a class=\"InfoURL\" href=\"#\">kömek we maglumat almak üçin</a>websaýta gir. Psiphon Android we Windows üçin elýeterli.",
-      "about#get-by-email": "<strong>eger websaýtda girip bolmasa</strong>, siz Psiphon-yň täze görnüşini almak üçin email ugradyp bilersiňiz:",
-      "about#client-version": "Psiphon Windows müşderi wersiýasy üçin:",
-      "general#modal-close-button": "Ýap",
-      "general#notice-modal-tech-preamble": "Bu ýerde tehnikis äwlik informasiyasini tapyp bilersiñiz:",
-      "notice#systemproxysettings-setproxy-error-title": "Proksi Sistemasynda Säwlik",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistema proksiniň sazlamasy şowsuz.</p>\n<p>Antiwirus programmasy bilen näsazlyk sebäpli bolup biler. Ýerli Psiphon proksini ulanmak üçin siz sazlamalary täzeden elde düzeltmeli. Psiphon proksileri.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon  “<%- data %>” atly Internet baglanşygy üçin sistemanyň proksi sazlanmasy şowsuz. Antiwirus programmasy bilen näsazlyk sebäpli bolup biler. Ýerli Psiphon proksini ulanmak üçin siz sazlamalary täzeden elde düzeltmeli.",
-      "appbackend#state-stopped-title": "Psiphon birikmedi",
-      "appbackend#state-starting-title": "Psiphon birikýär",
-      "appbackend#state-starting-body": "Haýyş garaşyñ...",
-      "appbackend#state-connected-title": "Psiphon birikdi",
-      "appbackend#state-connected-body": "Çäkleriñden daşary syyahat et!",
-      "appbackend#state-connected-reminder-title": "Psiphon sizi birikdirilgi saklar",
-      "appbackend#state-connected-reminder-body": "Psiphony mugut sakla! Biziñ hemaýatkär sahypamyzy görmek üçin śu yere bas!",
-      "appbackend#state-connected-reminder-body-2": "Psiphon-y mugt saklamak üçin, hemayatkär sahypalara geç! ",
-      "appbackend#minimized-to-systray-title": " Duýduryş meýdana göra Psiphon kiçeldildi",
-      "appbackend#minimized-to-systray-body": "Programmany dikeltmek üçin şu şekiljige bas",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Hemaýatkär"
-    }
-  },
-  "tr": {
-    "name": "Türkçe",
-    "translation": {
-      "banner#long-connecting": "<strong>Olamaz!</strong> Bağlantı kurmakta sorun yaşıyorsunuz gibi görünüyor!<br>\nEn son Psiphon sürümünü <a class=\"NewVersionURL\" href=\"#\">siteden indirerek</a> ya da <a class=\"NewVersionEmail\" href=\"#\"></a> adresine e-posta göndererek edinebilirsiniz.",
-      "nav#connection#starting": "Bağlantı kuruluyor",
-      "nav#connection#connected": "Bağlantı kuruldu",
-      "nav#connection#stopping": "Bağlantı kesiliyor",
-      "nav#connection#stopped": "Bağlantı kesildi",
-      "nav#settings": "Ayarlar",
-      "nav#feedback": "Geri Bildirim",
-      "nav#logs": "Günlükler",
-      "nav#about": "Hakkında",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">bağlantısı kuruluyor</span>…",
-      "connection#stop-btn": "Durdur",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">bağlantısı kuruldu</span>",
-      "connection#disconnect-btn": "Bağlantıyı Kes",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">bağlantısı kesiliyor</span>…",
-      "connection#wait-btn": "Lütfen bekleyin...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">bağlantısı kesildi</span>",
-      "connection#connect-btn": "Bağlan",
-      "connection#egress-region-combo-label": "Sunucu bölgesini seçin",
-      "settings#error-alert": "<strong>Hata!</strong> Lütfen ilerlemeden önce geçersiz değerleri düzeltin.",
-      "settings#reset-button": "Varsayılanı Yükle",
-      "settings#apply-button": "Değişiklikleri Uygula",
-      "settings#unapplied-changes-prompt#title": "Ayarlar Değiştirilmiş",
-      "settings#unapplied-changes-prompt#body": "Ayarlarınızda değişiklik yaptınız ancak bu değişiklikleri uygulamadınız.<br><br>Değişiklikleri uygulamak mı, yok saymak mı istersiniz?",
-      "settings#unapplied-changes-prompt#apply-button": "Uygula",
-      "settings#unapplied-changes-prompt#discard-button": "Yoksay",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec kipi ile çalışmaz.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Ayrık Tünel",
-      "settings#split-tunnel#help-text": "Bu seçenek etkinleştirildiğinde, bulunduğunuz ülkedeki sunuculara yapılan istekler Psiphon tarafından tünelden geçirilmez.",
-      "settings#split-tunnel#reason": "Bulunduğunuz ülkedeki web siteleri genellikle engellenmez. Bu nedenle bu seçeneğin etkinleştirilmesi bu sitelere daha hızlı erişim sağlayarak İSS veri kullanımını da azaltabilir.",
-      "settings#split-tunnel#enable-label": "Ülkenizdeki web siteleri için vekil sunucu kullanılmasın",
-      "settings#disable-timeouts#heading": "Yavaş Bağlantılarda Zaman Aşımı Kullanılmasın",
-      "settings#disable-timeouts#help-text": "Bu seçenek etkinleştirildiğinde, Psiphon sunucusu ile iletişimde zaman aşımı süresi kullanılmaz.",
-      "settings#disable-timeouts#reason": "Bu seçenek etkinleştirildiğinde, çok yavaş bağlantılarda beklenmedik bağlantı kopmaları sorunu daha az yaşanır.",
-      "settings#disable-timeouts#enable-label": "Yavaş bağlantılarda zaman aşımı kullanılmasın",
-      "settings#egress-region#heading": "Psiphon Sunucu Bölgesi",
-      "settings#egress-region#select-best-performance": "En İyi Başarım",
-      "settings#egress-region#select-us": "Birleşik Devletler",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Birleşik Krallık",
-      "settings#egress-region#select-jp": "Japonya",
-      "settings#egress-region#select-sg": "Singapur",
-      "settings#egress-region#select-sk": "Slovakya",
-      "settings#egress-region#select-nl": "Hollanda",
-      "settings#egress-region#select-de": "Almanya",
-      "settings#egress-region#select-in": "Hindistan",
-      "settings#egress-region#select-es": "İspanya",
-      "settings#egress-region#select-hk": "Hong Kong",
-      "settings#egress-region#select-at": "Avusturya",
-      "settings#egress-region#select-be": "Belçika",
-      "settings#egress-region#select-bg": "Bulgaristan",
-      "settings#egress-region#select-ch": "Isviçre",
-      "settings#egress-region#select-cz": "Çekya",
-      "settings#egress-region#select-dk": "Danimarka",
-      "settings#egress-region#select-fr": "Fransa",
-      "settings#egress-region#select-hu": "Macaristan",
-      "settings#egress-region#select-it": "Italya",
-      "settings#egress-region#select-no": "Norveç",
-      "settings#egress-region#select-ro": "Romanya",
-      "settings#egress-region#select-se": "Isveç",
-      "settings#egress-region#select-pl": "Polonya",
-      "settings#egress-region#select-rs": "Sırbistan",
-      "settings#egress-region#select-au": "Avustralya",
-      "settings#egress-region#description": "Bir çok ülkede ve bölgede Psiphon sunucuları bulunuyor. Bulunduğunuz ülkeye yakın bir bölgedeki Psiphon sunucusunuı seçmeniz daha iyi ağ bağlantısı sağlar. Ancak belirli bir ülkedeki web sitesi ve hizmetlerine erişmek istiyorsanız sanal olarak o ülkedeymiş gibi görünmek isteyebilirsiniz.",
-      "settings#egress-region#default": "Varsayılan <strong>“En İyi Başarım”</strong> seçeneği seçildiğinde, Psiphon otomatik olarak genellikle en iyi ağ bağlantısına sahip sunucuyu seçer.",
-      "settings#egress-region#invalid-error-msg": "Geçerli bir Psiphon sunucu bölgesi seçin.",
-      "settings#egress-region#error-modal-title": "Sunucu Bölgesi Kullanılamıyor",
-      "settings#egress-region#error-modal-body-http": "Belirli bir bölgedeki Psiphon sunucusunu kullanmayı seçtiniz.<br>\nAncak bu bölge artık kullanılamıyor.<br>\nYeni bir bölge seçmeli ya da varsayılan \"En İyi Başarım\" seçeneğini seçmelisiniz.",
-      "settings#local-proxy-ports#heading": "Yerel Vekil Sunucu Kapı Numaraları",
-      "settings#local-proxy-ports#leave-blank": "Otomatik kapı numarası seçimi için <strong>boş</strong> bırakın (önerilir).",
-      "settings#local-proxy-ports#reason": "Bilgisayarınızda Psiphon ile çalışabilmesi için el ile yapılandırılması gereken araçlar kullanıyorsanız, Psiphon tarafından hep aynı yerel kapı numaralarının kullanılmasını istersiniz. Özel bir kapı numarası belirtmek için bir nedeniniz yoksa, çakışmaları önlemek için kapı numaralarının Psiphon tarafından otomatik olarak seçilmesine izin vermelisiniz.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 ile 65535 arasında olmalı.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Yerel kapı numaraları birbirinden farklı olmalıdır.",
-      "settings#local-proxy-ports#error-modal-title": "Yerel Vekil Sunucu Kapı Numarası Çakışması",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon HTTP vekil sunucusu için özel bir kapı numarası yapılandırmışsınız.<br>\nAncak bu kapı numarası zaten kullanımda olduğundan Psiphon bunu kullanamaz.\n</p>\n<p>\nLütfen yapılandırılmış HTTP vekil sunucu kapı numarasını değiştirip yeniden deneyin. Bu alanı boş bırakarak kapı numarasının Psiphon tarafından otomatik olarak belirlenmesini sağlamanız önerilir.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon SOCKS vekil sunucusu için özel bir kapı numarası yapılandırmışsınız.<br>\nAncak bu kapı numarası zaten kullanımda olduğundan Psiphon bunu kullanamaz.\n</p>\n<p>\nLütfen yapılandırılmış SOCKS vekil sunucu kapı numarasını değiştirip yeniden deneyin. Bu alanı boş bırakarak kapı numarasının Psiphon tarafından otomatik olarak belirlenmesini sağlamanız önerilir.\n</p>",
-      "settings#upstream-proxy#heading": "Giden Vekil Sunucu",
-      "settings#upstream-proxy#by-default": "Bilgisayarınızda zaten yapılandırılmış bir vekil sunucu varsa, Psiphon bir tünel açarken varsayılan olarak bu vekil sunucuyu kullanır. Bu davranışı değiştirmek için kullanılacak bir vekil sunucu belirtebilirsiniz ya da \"giden vekil sunucu\" ayarını kaldırabilirsiniz.",
-      "settings#upstream-proxy#reason": "Giden vekil sunucular bazen okullar, üniversiteler ya da kurumlar tarafından zorunlu olarak kullanılır. Ağ hizmeti sağlayıcınız giden vekil sunucu ayarları belirtmiş ise, bağlantı kurabilmeniz için bu ayarları el ile yazmanız gerekebilir.",
-      "settings#upstream-proxy#proxy-reqs": "Yalnız HTTPS destekleyen HTTP vekil sunucularına izin verilir.",
-      "settings#upstream-proxy#hostname-label": "Sunucu Adı",
-      "settings#upstream-proxy#port-label": "Kapı No",
-      "settings#upstream-proxy#username-label": "Kullanıcı Adı",
-      "settings#upstream-proxy#password-label": "Parola",
-      "settings#upstream-proxy#domain-label": "Etki Alanı",
-      "settings#upstream-proxy#skip-label": "Giden vekil sunucusu kullanılmasın",
-      "settings#upstream-proxy#set-hostname-error-msg": "Bir sunucu adı yazmalı ya da otomatik seçim için tüm Giden Vekil Sunucu alanlarını boş bırakmalısınız.",
-      "settings#upstream-proxy#set-username-error-msg": "Bir Parola ya da Etki Alanı ayarlıyorsanız bir Kullanıcı Adı yazmalı ya da kimlik doğrulaması yapılmaması için tüm kimlik doğrulama alanlarını boş bırakın.",
-      "settings#upstream-proxy#error-modal-title": "Giden Vekil Sunucu Hatası",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon \"giden vekil sunucusu\" olarak sistem vekil sunucusunu kullanmak üzere yapılandırılmış.<br>\nAncak bu vekil sunucuyu kullanarak bir Psiphon sunucusu ile bağlantı kuramadık.<br>\n\nLütfen \"Giden vekil sunucusu kullanılmasın\" seçeneğini etkinleştirip yeniden deneyin.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon bir \"giden vekil sunucusu\" kullanmak üzere yapılandırılmış.<br>\nAncak bu vekil sunucuyu kullanarak bir Psiphon sunucusu ile bağlantı kuramadık.<br>\n\nLütfen ayarları düzeltip yeniden deneyin.",
-      "settings#transport-mode#heading": "Aktarım Kipi",
-      "settings#transport-mode#check-label": "L2TP/IPSec kipi kullanılsın",
-      "settings#transport-mode#help-text": "Bu seçenek etkinleştirildiğinde, Windows L2TP/IPSec sanal ağını kullanır. Bu kip tüm uygulamalarınızın trafiğini tünelden geçirir ancak herhangi bir gizlenme sağlamaz. Çoğu güvenlik duvarını aşmak için <strong>önerilmez</strong>.",
-      "settings#systray-minimize#heading": "Bildirim Alanına Küçült (Sistem Tepsisi)",
-      "settings#systray-minimize#help-text": "Bu seçenek etkinleştirildiğinde, Psiphon uygulama penceresi simge durumuna küçültüldüğünde bildirim alanına gizlenir (Windows görev çubuğundaki saatin yanında bulunan \"sistem tepsisi\" olarak da bilinir).",
-      "settings#systray-minimize#reason": "Psiphon bildirim alanına (\"sistem tepsisi\") küçültülerek, görev çubuğunda boş alan açılabilir. Psiphon uzun süreler kullanılıyorsa bu seçenek yararlı olabilir.",
-      "settings#systray-minimize#enable-label": "Bildirim alanına küçült (sistem tepsisi)",
-      "settings#applying-message": "Ayarlarınızı uygulamak için yeniden bağlantı kuruluyor.",
-      "settings#saved-message": "Ayarlar kaydedildi.",
-      "settings#error-modal#title": "Ayar Hatası",
-      "settings#error-modal#body": "Ayar değerlerinizde hatalar var. Lütfen ilerlemeden önce bunları düzeltin.",
-      "feedback#top_content_title": "Bize Geri Bildirimde Bulunun",
-      "feedback#top_para_2": "Çoğu sorun en son sürüm indirilerek çözülebilir. <a class=\"NewVersionURL\" href=\"#\">En son sürümü buraya tıklayarak</a>\nya da <a class=\"NewVersionEmail\" href=\"#\"></a> adresine\nbir e-posta göndererek indirebilirsiniz.",
-      "feedback#top_para_3": "Ayrıca yaygın karşılaşılan sorunların çözümlerini <a class=\"FaqURL\" href=\"#\">Sık Sorulan Sorular</a> bölümünde bulabilirsiniz.",
-      "feedback#smiley_happy": "Psiphon istediğim gibi bağlantı kuruyor ve çalışıyor.",
-      "feedback#smiley_sad": "Psiphon genellikle bağlantı kuramıyor ve yeterince iyi çalışmıyor.",
-      "feedback#text_feedback_prompt": "Lütfen yorumlarınızı buraya yazın:",
-      "feedback#text_feedback_email_prompt": "Size yanıt vermemizi isterseniz, lütfen e-posta adresinizi yazın:",
-      "feedback#diagnostic_check": "Kullanım verilerini gönderin. Bu veriler sizin kimliğinizi belirlemek amacıyla değil, Psiphon uygulamasının sorunsuz çalışmasını sağlamamıza yardımcı olması için kullanılır. <a class=\"DataCollectionInfoURL\" href=\"#\">Topladığımız bilgileri buradan görebilirsiniz.</a>",
-      "feedback#submit_button": "Gönder",
-      "feedback#text_feedback_bottom_para": "Yukarıdaki form çalışmıyorsa ya da ekran görüntüleri yollamak isterseniz, lütfen <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> adresini kullanarak bir e-posta gönderin.",
-      "feedback#success-message": "<strong>Teşekkürler!</strong> Geri bildiriminiz gönderildi.",
-      "logs#show-debug-label": "Hata ayıklama günlüğünü görüntüle",
-      "logs#placeholder": "Henüz bir günlük kaydı yok",
-      "language#success-message": "<strong>Merhaba!</strong> Psiphon uygulamasına hoş geldiniz.",
-      "about#wordart-tag": "Sınırları Aşın",
-      "about#description": "Psiphon, bir <strong>sansür aşma aracıdır</strong> — açık İnternet erişimi sağlamak, engellemeleri ve güvenlik duvarlarını aşmak için tasarlanmıştır. <strong>Açık kaynaklıdır</strong> ve Toronto, Kanada'da geliştirilmiştir.",
-      "about#visit-download-site": "Lütfen <strong><a class=\"NewVersionURL\" href=\"#\">yeni sürümü indirmek için</a></strong> ya da <strong><a class=\"InfoURL\" href=\"#\">yardım ve bilgi</a></strong> almak için web sitesini ziyaret edin. Psiphon Android ve Windows üzerinde kullanılabilir.",
-      "about#get-by-email": "<strong>Web sitesine erişilemiyorsa</strong>, son Psiphon sürümünü almak için şu adrese e-posta gönderebilirsiniz:",
-      "about#client-version": "Windows için Psiphon istemci sürümü:",
-      "general#modal-close-button": "Kapat",
-      "general#notice-modal-tech-preamble": "Teknik hata bilgisi şu şekilde:",
-      "notice#systemproxysettings-setproxy-error-title": "Sistem Vekil Sunucu Hatası",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon sistem vekil sunucu ayarlarını yapamadı.</p>\n<p>Bu soruna anti virüs yazılımınız yol açıyor olabilir. Uygulamanızı ya da sistem vekil sunucu ayarlarını, Psiphon vekil sunucularını kullanacak şekilde el ile yapılandırmanız gerekebilir.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon, “<%- data %>” adındaki İnternet bağlantısı için sistem vekil sunucu ayarlarını yapamadı. Uygulamanızı ya da sistem vekil sunucu ayarlarını Psiphon vekil sunucularını kullanacak şekilde el ile yapılandırmanız gerekebilir.",
-      "appbackend#state-stopped-title": "Psiphon bağlantısı kesildi",
-      "appbackend#state-starting-title": "Psiphon bağlantısı kuruluyor",
-      "appbackend#state-starting-body": "Lütfen bekleyin…",
-      "appbackend#state-connected-title": "Psiphon bağlantısı kuruldu",
-      "appbackend#state-connected-body": "Sınırlarınızın ötesini keşfedin!",
-      "appbackend#state-connected-reminder-title": "Psiphon bağlantınızı koruyor",
-      "appbackend#state-connected-reminder-body": "Tıklayıp destekçi sayfalarımızı açarak Pshiphon uygulamasının ücretsiz kalmasını sağlayın!",
-      "appbackend#state-connected-reminder-body-2": "Destekçi sayfalarımızı açarak Pshiphon uygulamasının ücretsiz kalmasını sağlayın!",
-      "appbackend#minimized-to-systray-title": "Psiphon bildirim alanına küçültüldü",
-      "appbackend#minimized-to-systray-body": "Uygulamayı açmak için simgeye tıklayın",
-      "appbackend#os-unsupported": "Psiphon artık Windows XP ya da Vista desteği vermiyor.\nAyrıntılı bilgi almak için web sitemize bakabilirsiniz.",
-      "psicash#transaction-error-title": "PsiCash işleminde sorun",
-      "psicash#transaction-error-body": "PsiCash işleminiz beklenmedik şekilde tamamlanamadı.",
-      "psicash#transaction-ExistingTransaction-title": "Zaten PsiCash satın alınmış",
-      "psicash#transaction-ExistingTransaction-body": "Zaten bu türde bir PsiCash satın almışsınız. Öncekinin süresi dolmadan bu türde başka bir satın alma yapamazsınız. PsiCash durumunuz şimdi yenilenecek.",
-      "psicash#transaction-InsufficientBalance-title": "PsiCash bakiyesi yetersiz",
-      "psicash#transaction-InsufficientBalance-body": "Bu satın alma için yeterli PsiCash bakiyeniz yok.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash satın alma fiyatı farklı",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash satın alma fiyatları değişmiş. PsiCash durumunuz şimdi yenilenecek.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash satın alma türü bulunamadı",
-      "psicash#transaction-TransactionTypeNotFound-body": "Satın almaya çalıştığınız ürün artık bulunmuyor. Uygulamayı güncellemeniz ya da yeniden kurmanız gerekebilir.",
-      "psicash#transaction-InvalidTokens-title": "PsiCash kodları geçersiz",
-      "psicash#transaction-InvalidTokens-body": "PsiCash kodlarınız geçersiz. Uygulamayı yeniden başlatmayı deneyin. Bu şekilde düzelmez ise, <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">yerel deponuzu temizlemeniz</a> gerekir.",
-      "psicash#transaction-ServerError-title": "PsiCash sunucu sorunu",
-      "psicash#transaction-ServerError-body": "Satın alma işlemi sırasında PsiCash sunucusunda bir sorun çıktı. Lütfen bir süre sonra yeniden satın almayı deneyin.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost, %s süre kullanılabilir",
-      "psicash#ui-zerobalance-title": "Speed&nbsp;Boost! istiyor musunuz?",
-      "psicash#ui-buypsi": "PsiCash Satın Alın",
-      "psicash#ui-buymorepsi": "Daha fazla PsiCash satın alın",
-      "psicash#ui-nsfbalance-buttontext": "Speed&nbsp;Boost! için gereken",
-      "psicash#ui-enoughbalance-buttontext": "Speed&nbsp;Boost! Kullanmaya Başla",
-      "psicash#1-hour": "1 saat",
-      "psicash#1-day": "1 gün",
-      "psicash#ui-buyingboost-buttontext": "Speed&nbsp;Boost! Başlatılıyor",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Bağlantısı Gerekli",
-      "psicash#mustconnect-modal#body": "PsiCash kullanabilmeniz için, Psiphon ağına bağlı olmalısınız.",
-      "psicash#init-error-title": "PsiCash başlatma sorunu",
-      "psicash#init-error-body-unrecovered": "PsiCash hazırlanamadı. Bu durum büyük olasılıkla disk alanının yetersiz olması gibi bir dosya sistemi sorunundan kaynaklanıyor. Bakiyeniz ve diğer durum bilgileriniz kayboldu. PsiCash kullanılamayacak. Sorunu çözmek için uygulamayı yeniden başlatmayı deneyebilirsiniz.",
-      "psicash#init-error-body-recovered": "PsiCash hazırlanamadı. Bu durum büyük olasılıkla disk alanının yetersiz olması gibi bir dosya sistemi sorunundan kaynaklanıyor. Bakiyeniz ve diğer durum bilgileriniz sıfırlandı.",
-      "psicash#psiphon-speed": "Psiphon<br>Hızı",
-      "notice#disallowed-traffic-alert-title": "Psiphon bağlantınızı yükseltin",
-      "notice#disallowed-traffic-alert-body": "</p>Çalışmayan uygulamalar mı var?</p>\n<p>İnternet trafiğinin bir kısmı Speed Boost özelliği etkin olmadan kullanılamaz. Psiphon deneyimini tam olarak yaşamak için PsiCash kullanarak Speed Boost özelliğini etkinleştirin.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Çalışmayan uygulamalar mı var?",
-      "appbackend#disallowed-traffic-notification-body": "Psiphon deneyimini tam olarak yaşamak için PsiCash kullanarak Speed Boost özelliğini etkinleştirin.",
-      "settings#disallowed-traffic-alert#heading": "İzin Verilmeyen Trafik Uyarısı",
-      "settings#disallowed-traffic-alert#help-text": "İnternet trafiğinin bir kısmı Speed Boost özelliği etkin olmadan kullanılamaz. Böyle bir trafik engellendiğinde bir uyarı görüntülenir (yeniden etkinleştirmek için yeniden bağlanmak gerekir).",
-      "settings#disallowed-traffic-alert#disable-label": "İzin verilmeyen trafik uyarıları kapatılsın",
-      "banner#sponsored-by": "Destekleyen"
-    }
-  },
-  "uk": {
-    "name": "Українська",
-    "translation": {
-      "banner#long-connecting": "<strong>О ні!</strong>Здається, у вас виникли проблеми з підключенням!<br>\nЗавантажте останню версію Psiphon з <a class=\"NewVersionURL\" href=\"#\">сайту завантаження</a>\nабо надіславши лист на адресу<a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "З'єднання",
-      "nav#connection#connected": "Під'єднано",
-      "nav#connection#stopping": "Від'єднання…",
-      "nav#connection#stopped": "Від'єднано",
-      "nav#settings": "Налаштування",
-      "nav#feedback": "Відгук",
-      "nav#logs": "Журнали",
-      "nav#about": "Про",
-      "connection#starting-msg": "Psiphon <span class=\"state-word\">під'єднується</span>…",
-      "connection#stop-btn": "Зупинити",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\">з'єднано</span>",
-      "connection#disconnect-btn": "Від'єднати",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">від'єднується</span>...",
-      "connection#wait-btn": "Будь ласка, зачекайте ...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">від'єднано</span>",
-      "connection#connect-btn": "З'єднання",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Помилка!</strong>Будь ласка, виправте неправильні значення перед продовження.",
-      "settings#reset-button": "Відновити типові значення",
-      "settings#apply-button": "Застосувати зміни",
-      "settings#unapplied-changes-prompt#title": "Налаштування змінено",
-      "settings#unapplied-changes-prompt#body": "Ви внесли зміни до ваших налаштувань, але не застосували ці зміни.<br><br> Хочете застосувати свої зміни зараз або відмовитися від них?",
-      "settings#unapplied-changes-prompt#apply-button": "Застосувати",
-      "settings#unapplied-changes-prompt#discard-button": "Відкинути",
-      "settings#vpn-incompatible-msg": "(Не працює в режимі  L2TP/IPSec.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Розділити тунель",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Не уповноважувати веб-сайти в межах вашої країни",
-      "settings#disable-timeouts#heading": "Вимкнути час очікування для повільних мереж",
-      "settings#disable-timeouts#help-text": "Якщо ввімкнено, то зв'язок із сервером Psiphon буде працювати без блокування за часом.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Вимкнути час очікування для повільних мереж",
-      "settings#egress-region#heading": "Країна сервера Psiphon",
-      "settings#egress-region#select-best-performance": "Найкраща продуктивність",
-      "settings#egress-region#select-us": "Сполучені Штати",
-      "settings#egress-region#select-ca": "Канада",
-      "settings#egress-region#select-gb": "Велика Британія",
-      "settings#egress-region#select-jp": "Японія",
-      "settings#egress-region#select-sg": "Сінгапур",
-      "settings#egress-region#select-sk": "Словаччина",
-      "settings#egress-region#select-nl": "Нідерланди",
-      "settings#egress-region#select-de": "Німеччина",
-      "settings#egress-region#select-in": "Індія",
-      "settings#egress-region#select-es": "Іспанія",
-      "settings#egress-region#select-hk": "Гонконг",
-      "settings#egress-region#select-at": "Австрія",
-      "settings#egress-region#select-be": "Бельгія",
-      "settings#egress-region#select-bg": "Болгарія",
-      "settings#egress-region#select-ch": "Швейцарія",
-      "settings#egress-region#select-cz": "Чехія",
-      "settings#egress-region#select-dk": "Данія",
-      "settings#egress-region#select-fr": "Франція",
-      "settings#egress-region#select-hu": "Угорщина",
-      "settings#egress-region#select-it": "Італія",
-      "settings#egress-region#select-no": "Норвегія",
-      "settings#egress-region#select-ro": "Румунія",
-      "settings#egress-region#select-se": "Швеція",
-      "settings#egress-region#select-pl": "Польща",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Австралія",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Виберіть доступну країну сервера Psiphon.",
-      "settings#egress-region#error-modal-title": "Країна сервера недоступна",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Локальні проксі-порти",
-      "settings#local-proxy-ports#leave-blank": "Залишити <strong>порожнім</strong> для автоматичного вибору порту (рекомендовано).",
-      "settings#local-proxy-ports#reason": "Якщо ви використовуєте засоби на своєму комп'ютері, які потребують ручного налаштування для роботи з Psiphon, ви хочете, щоб Psiphon постійно використовував ті ж самі локальні номери порту. Якщо у вас немає причини вказати номери портів, ви повинні дозволити Psiphon вибрати їх автоматично, щоб уникнути конфліктів. ",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Має бути від 1 до 65535.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Локальні порти повинні відрізнятись один від одного.",
-      "settings#local-proxy-ports#error-modal-title": "Конфлікт локальних портів проксі",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nВи налаштували Psiphon для використання певного локального порту для свого HTTP-проксі.<br>\nОднак цей порт, вірогідно, вже використовується, тому Psiphon не може його використовувати.\n</p>\n<p>\nБудь ласка, змініть задане значення порту HTTP-проксі і повторіть спробу. Ми рекомендуємо вам очистити значення, щоб Psiphon міг автоматично вибирати доступний порт.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nВи налаштували Psiphon для використання певного локального порту для свого проксі-серверу SOCKS.<br>\nОднак цей порт, вірогідно, вже використовується, тому Psiphon не може використати його.\n</p>\n<p>\nБудь ласка, змініть задане значення порту проксі SOCKS та повторіть спробу. Ми рекомендуємо вам очистити значення, щоб Psiphon міг автоматично вибирати доступний порт.\n</p>",
-      "settings#upstream-proxy#heading": "Проксі-сервер вищого рангу",
-      "settings#upstream-proxy#by-default": "Якщо на вашому комп'ютері вже встановлений проксі-сервер, то Psiphon усталено використовуватиме цей проксі-сервер під час встановлення тунелю. Ви можете перевизначити цю поведінку, вказавши проксі для використання або вказавши, що такий \"проксі-сервер вищого рангу\" не варто використовувати.",
-      "settings#upstream-proxy#reason": "Проксі-сервери вищого рангу іноді потрібні школам, університетам або підприємствам. Якщо ваш мережевий провайдер надав вам параметри проксі-сервера вищого рангу, то для встановлення їх вручну може знадобитися під'єднання.",
-      "settings#upstream-proxy#proxy-reqs": "Дозволено лише HTTP проксі, які підтримують HTTPS.",
-      "settings#upstream-proxy#hostname-label": "Назва вузла",
-      "settings#upstream-proxy#port-label": "Порт",
-      "settings#upstream-proxy#username-label": "Ім'я користувача",
-      "settings#upstream-proxy#password-label": "Пароль",
-      "settings#upstream-proxy#domain-label": "Домен",
-      "settings#upstream-proxy#skip-label": "Не використовуйте проксі-сервер на виході",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Помилка проксі-сервера",
-      "settings#upstream-proxy#error-modal-body-default": "В даний час Psiphon налаштований на використання системного проксі-сервера як \"проксі-сервера вищого рангу\" .<br>\nОднак здається, ми не можемо під'єднатися до сервера Psiphon через цей проксі. <br>\nУвімкніть \"Не використовувати проксі-сервер вищого рангу\" і спробуйте ще раз.",
-      "settings#upstream-proxy#error-modal-body-configured": "Ви налаштували Psiphon для використання \"проксі-сервера вищого рангу\" .<br>\nОднак здається, не можемо підключитися до сервера Psiphon через цей проксі. <br>\nВиправте налаштування та повторіть спробу.",
-      "settings#transport-mode#heading": "Режим транспортування",
-      "settings#transport-mode#check-label": "Використовуйте режим L2TP/IPSec",
-      "settings#transport-mode#help-text": "Використання віртуальних мереж Windows L2TP/IPSec. Цей режим буде тунелювати всі ваші додатки, але це не забезпечує затуманення, а тому не має сильних можливостей для обходу цензури. Він <strong>не рекомендується</strong> для обходу більшості брандмауерів.",
-      "settings#systray-minimize#heading": "Згорнути до Області Сповіщення (Системна Панель)",
-      "settings#systray-minimize#help-text": "Якщо ввімкнено, при мінімізації вікно програми Psiphon сховається в область сповіщень (також відома як \"Системна Панель\" або \"Системний лоток\", розташований біля годинника на панелі завдань Windows).",
-      "settings#systray-minimize#reason": "Мінімізація Psiphon до області сповіщення (\"системний лоток\") звільняє місце на панелі завдань. Це особливо корисно, якщо ви часто виконуєте Psiphon протягом тривалого часового періоду .",
-      "settings#systray-minimize#enable-label": "Згорнути до області сповіщень (системний лоток)",
-      "settings#applying-message": "Повторне з'єднання для застосування ваших налаштувань.",
-      "settings#saved-message": "Налаштування збережено.",
-      "settings#error-modal#title": "Помилка налаштування",
-      "settings#error-modal#body": "У ваших значеннях налаштувань є помилки. Будь ласка, виправте їх, перш ніж продовжувати.",
-      "feedback#top_content_title": "Залиште нам свій відгук",
-      "feedback#top_para_2": "Можна виправити багато проблем шляхом завантаження останньої версії. Ви можете <a class=\"NewVersionURL\" href=\"#\">завантажити останню версію, натиснувши тут</a>, або ви можете надіслати електронний лист до <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Ви також можете знайти рішення багатьох поширених проблем у наших <a class=\"FaqURL\" href=\"#\">ЧАстих Питаннях</a>.",
-      "feedback#smiley_happy": "Psiphon з'єднується і виконує так, як я хочу це зробити.",
-      "feedback#smiley_sad": "Psiphon часто не під'єднується або не працює досить добре.",
-      "feedback#text_feedback_prompt": "Будь ласка, введіть свої коментарі тут:",
-      "feedback#text_feedback_email_prompt": "Якщо ви хочете, щоб ми відповіли вам, будь ласка, введіть свою електронну адресу:",
-      "feedback#diagnostic_check": "Завантажте дані діагностики. Зверніть увагу, що ці діагностичні дані не будуть вас ідентифікувати, і це допоможе нам забезпечити гладку роботу Psiphon. <a class=\"DataCollectionInfoURL\" href=\"#\">Натисніть тут, щоб побачити, які дані ми збираємо.</a>",
-      "feedback#submit_button": "Надіслати",
-      "feedback#text_feedback_bottom_para": "Якщо вищенаведена форма не працює, або ви хочете відправити знімки екрану, надішліть нам електронного листа за адресою <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Дякуємо!</strong> Ваш відгук відправлений.",
-      "logs#show-debug-label": "Показати журнали налагодження",
-      "logs#placeholder": "Ще немає журналів",
-      "language#success-message": "<strong>Вітаю!</strong> Ласкаво просимо до Psiphon.",
-      "about#wordart-tag": "За межами кордонів",
-      "about#description": "Psiphon - це інструмент <strong>для обходу цензури</strong> - він розроблений для доступу у відкритий Інтернет, минаючи цензори та брандмауери. Він містить <strong>відкритий код</strong> та розроблений в Торонто, Канада.",
-      "about#visit-download-site": "Будь ласка, відвідайте веб-сайт <strong><a class=\"NewVersionURL\" href=\"#\">, щоб завантажити нову версію </a></strong> або <strong><a class=\"InfoURL\" href=\"#\"> або щоб отримати допомогу та інформацію</a></strong>. Psiphon доступний для Android та Windows.",
-      "about#get-by-email": "<strong>Якщо веб-сайт недоступний</strong>, ви можете отримати нову версію Psiphon, відправивши електронне повідомлення на адресу:",
-      "about#client-version": "Psiphon для клієнтської версії Windows:",
-      "general#modal-close-button": "Закрити",
-      "general#notice-modal-tech-preamble": "Ось технічна інформація про помилку:",
-      "notice#systemproxysettings-setproxy-error-title": "Помилка системного проксі",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon не зміг встановити налаштування системного проксі.</p>\n<p>Це може бути пов'язано з конфліктом з антивірусним програмним забезпеченням. Можливо, вам доведеться вручну налаштувати параметри програми або системного проксі-сервера для використання локальних проксі-серверів Psiphon.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon не зміг встановити налаштування проксі-сервера для під'єднання до Інтернету з назвою “<%- data %>”.  Цей конфлікт може бути пов'язаний з антивірусним програмним забезпеченням. Можливо, вам доведеться вручну налаштувати параметри програми або системного проксі-сервера для використання локальних проксі-серверів Psiphon.",
-      "appbackend#state-stopped-title": "Psiphon від'єднаний",
-      "appbackend#state-starting-title": "Psiphon під'єднується",
-      "appbackend#state-starting-body": "Будь ласка, зачекайте ...",
-      "appbackend#state-connected-title": "Psiphon під'єднаний",
-      "appbackend#state-connected-body": "Досліджуйте за межами ваших кордонів!",
-      "appbackend#state-connected-reminder-title": "Psiphon допомагає бути вам на зв'язку",
-      "appbackend#state-connected-reminder-body": "Користуйтесь Psiphon безкоштовно. Натисніть тут, щоб відвідати наші сторінки спонсорів!",
-      "appbackend#state-connected-reminder-body-2": "Користуйтесь Psiphon безкоштовно, відвідавши наші спонсорські сторінки!",
-      "appbackend#minimized-to-systray-title": "Psiphon згорнено до зони сповіщення",
-      "appbackend#minimized-to-systray-body": "Натисніть піктограму, щоб відновити програму",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 година",
-      "psicash#1-day": "1 день",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Спонсорований"
-    }
-  },
-  "ur": {
-    "name": "اُردُو",
-    "translation": {
-      "banner#long-connecting": "<strong>ارے نہیں!</strong> ایسا لگتا ہے کہ آپ کو رابطے میں مشکل ہو رہی ہے!<br>\n Psiphon (سائفن) کا جدید ورژن ڈاؤن لوڈ کریں<a class=\"NewVersionURL\" href=\"#\"> ڈاؤن لوڈ سائٹ سے</a>\nیا ای میل بھیج کر<a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "منسلک ہو رہا ہے",
-      "nav#connection#connected": "منسلک ہو چکا ہے",
-      "nav#connection#stopping": "منقطع ہو رہا ہے",
-      "nav#connection#stopped": "منقطع ہو گئی",
-      "nav#settings": "ترتیبات",
-      "nav#feedback": "آراؑ",
-      "nav#logs": "لاگز",
-      "nav#about": "کے بارے میں",
-      "connection#starting-msg": "Psiphon (سائفن) <span class=\"state-word\">رابطہ کر رہا ہے</span>۔۔۔ ",
-      "connection#stop-btn": "رک جائیے",
-      "connection#connected-msg": "Psiphon (سائفن) سے <span class=\"state-word\">رابطہ ہو گیا ہے</span>",
-      "connection#disconnect-btn": "منقطع کریں",
-      "connection#stopping-msg": "Psiphon (سائفن) <span class=\"state-word\">منقطع ہو رہا ہے</span>۔۔۔",
-      "connection#wait-btn": "براہِ کرم انتظار کیجئے",
-      "connection#stopped-msg": "Psiphon (سائفن) سے <span class=\"state-word\">رابطہ منقطع ہو گیا ہے</span>",
-      "connection#connect-btn": "رابطہ کریں",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>ایرر!</strong> براہِ کرم آگے بڑھنے سے پہلے غلط اندراج کو درست کیجئے۔",
-      "settings#reset-button": "پہلے سے طے شدہ ترتیبات پر دوبارہ ترتیب دیں۔",
-      "settings#apply-button": "تبدیلیوں کا اطلاق کریں",
-      "settings#unapplied-changes-prompt#title": "ترتیبات تبدیل ہو گئیں",
-      "settings#unapplied-changes-prompt#body": "آپ نے اپنی ترتیبات میں تبدیلیاں کیں ، لیکن آپ نے تبدیلیوں کو لاگو نہیں کیا۔<br><br>کیا آپ ابھی اپنی تبدیلیاں لاگو کرنا چاہتے ہیں یا انہیں موقوف کرنا چاہتے ہیں؟",
-      "settings#unapplied-changes-prompt#apply-button": "لاگو کریں",
-      "settings#unapplied-changes-prompt#discard-button": "موقوف (ڈسکارڈ) کیجیے",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec موڈ کے ساتھ کام نہیں کرتا)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "ٹنل کو تقسیم کریں",
-      "settings#split-tunnel#help-text": "اگر فعال ہوجائے تو آپ کے آبائی ملک میں سرور سے کی جانے والی گزارشات کو Psiphon (سائفن) کے ذریعے ٹنل نہیں کیا جائے گا۔",
-      "settings#split-tunnel#reason": "آپ کے آبائی ملک کی ویب سائٹس عام طور پر بلاک نہیں کی جاتی لہٰذا اس آپشن کو فعال کرنے سے آپ کو ان سائٹس تک تیز رسائی مل جاتی ہے اور اس سے بعض دفعہ انٹرنیٹ سروس پرووائیڈر کے ڈیٹا کو استعمال کرنے کی قیمت ہو سکتی ہے۔",
-      "settings#split-tunnel#enable-label": "اپنے ملک میں ویب سائٹ پراکسی نہ بنائیں۔",
-      "settings#disable-timeouts#heading": "سست نیٹ ورک کے لئے ٹائم آوٹ کو غیر فعال بنائیں",
-      "settings#disable-timeouts#help-text": " اگر فعال ہوجائے تو ، Psiphon (سائفن) سرور کے ساتھ مواصلت کا وقت ختم نہیں ہوگا۔",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "سست نیٹ ورکس کے ٹائم آؤٹ کو غیر فعال کریں",
-      "settings#egress-region#heading": "Psiphon (سائفن) سرور ریجن",
-      "settings#egress-region#select-best-performance": "Best Performance",
-      "settings#egress-region#select-us": "ریاست ہائے متحدہ امریکہ",
-      "settings#egress-region#select-ca": "کنیڈا",
-      "settings#egress-region#select-gb": "برطانیہ",
-      "settings#egress-region#select-jp": "جاپان",
-      "settings#egress-region#select-sg": "سنگا پور",
-      "settings#egress-region#select-sk": "سلوواکیہ",
-      "settings#egress-region#select-nl": "ہالینڈ",
-      "settings#egress-region#select-de": "جرمنی",
-      "settings#egress-region#select-in": "بھارت",
-      "settings#egress-region#select-es": "سپین",
-      "settings#egress-region#select-hk": "ہانگ کانگ",
-      "settings#egress-region#select-at": "آسٹریا",
-      "settings#egress-region#select-be": "بیلجیئم",
-      "settings#egress-region#select-bg": "بلغاریہ",
-      "settings#egress-region#select-ch": "سوئٹزر لینڈ",
-      "settings#egress-region#select-cz": "جمہوریہ چک",
-      "settings#egress-region#select-dk": "ڈنمارک",
-      "settings#egress-region#select-fr": "فرانس",
-      "settings#egress-region#select-hu": "ہنگری",
-      "settings#egress-region#select-it": "اٹلی",
-      "settings#egress-region#select-no": "ناروے",
-      "settings#egress-region#select-ro": "رومانیہ",
-      "settings#egress-region#select-se": "سویڈن",
-      "settings#egress-region#select-pl": "پولینڈ",
-      "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Australia",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": " ایک معقول Psiphon (سائفن) سرور ریجن کا انتخاب کریں۔",
-      "settings#egress-region#error-modal-title": "سرور ریجن دستیاب نہیں",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "لوکل پراکسی پورٹس",
-      "settings#local-proxy-ports#leave-blank": "خود کار طریقے سے پورٹ سلیکشن کے لئے <strong>خالی</strong> چھوڑ دیں (تجویز کردہ)۔",
-      "settings#local-proxy-ports#reason": "اگر آپ اپنے کمپیوٹر پر ایسے ٹولز کا استعمال کرتے ہیں جن کے لئے Psiphon (سائفن) کے ساتھ کام کرنے کیلئے دستی ترتیب کی ضرورت ہوتی ہے تو ، آپ چاہیں گے کہ Psiphon (سائفن) اسی مقامی پورٹ نمبر کو مستقل طور پر استعمال کرے۔ اگر آپ کے پاس مخصوص پورٹ نمبرز کی کوئی وجہ نہیں ہے تو ، آپ کو تنازعات سے بچنے میں مدد کے لئے Psiphon (سائفن) کو خود بخود انتخاب کرنے کی اجازت دینی چاہئے۔",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 اور 65535 کے درمیان ہونا چاہیے۔",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "لوکل پورٹس ایک دوسرے سے الگ ہونی چاہئیں۔",
-      "settings#local-proxy-ports#error-modal-title": "لوکل پراکسی پورٹس کا تنازعہ",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nآپ نے Psiphon (سائفن) کو اس کے HTTP پراکسی کے لئے ایک مخصوص لوکل پورٹ استعمال کرنے کے لئے تشکیل دیا ہے۔<br>\n تاہم ،  وہ پورٹ پہلے ہی استعمال میں ہے اور اس لئے Psiphon (سائفن) اسے استعمال نہیں کرسکتی ہے۔\n </p>\n<p>\nبراہ کرم تشکیل شدہ HTTP پراکسی پورٹ ویلیو کو تبدیل کریں اور دوبارہ کوشش کریں۔ ہمارا مشورہ ہے کہ آپ ویلیو کو صاف کریں تاکہ Psiphon (سائفن) خود بخود دستیاب پورٹ منتخب کرسکے۔\n </p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nآپ نے Psiphon (سائفن) کو اس کے SOCKS پراکسی کے لئے ایک مخصوص لوکل پورٹ کا استعمال کرنے کے لئے تشکیل دیا ہے۔<br>\nتاہم ، وہ پورٹ پہلے ہی استعمال میں ہے اور اس لئے Psiphon (سائفن) اسے استعمال نہیں کرسکتی ہے۔\n </p>\n<p>\nبراہ کرم تشکیل شدہ SOCKS پراکسی پورٹ ویلیو کو تبدیل کریں اور دوبارہ کوشش کریں۔ ہمارا مشورہ ہے کہ آپ ویلیو کو صاف کریں تاکہ Psiphon (سائفن) خود بخود دستیاب پورٹ منتخب کرسکے۔\n </p>",
-      "settings#upstream-proxy#heading": "اپ سٹریم پراکسی",
-      "settings#upstream-proxy#by-default": "اگر آپ کا کمپیوٹر کوئی پراکسی پہلے سے تشکیل دے گا تو بائی ڈیفالٹ Psiphon (سائفن) اس پراکسی کو استعمال کرے گا جب کسی ٹنل کا قیام ہو رہا ہو گا۔ آپ کسی پروکسی کی تخصیص کرتے ہوئے اس سلوک کو مسترد کرسکتے ہیں یا پھر یہ وضاحت کرتے ہوئے کہ ایسی کوئی ’’اَپ سٹریم پراکسی‘‘ استعمال نہیں ہونی چاہئے۔",
-      "settings#upstream-proxy#reason": "اسکولوں ، یونیورسٹیوں یا کاروباری اداروں کے ذریعہ بعض اوقات اپ اسٹریم پراکسیز کی ضرورت ہوتی ہے۔ اگر آپ کے نیٹ ورک فراہم کنندہ نے آپ کو اپ اسٹریم پراکسی ترتیبات دے دی ہیں ، تو پھر انہیں دستی طور پر یہاں ترتیب دینے سے رابطہ کرنے کی ضرورت ہوگی۔",
-      "settings#upstream-proxy#proxy-reqs": "صرف ان HTTP پراکسیوں کی ہی اجازت ہے جو HTTPS کی حمایت کرتے ہیں۔",
-      "settings#upstream-proxy#hostname-label": "ھوسٹ کا نام",
-      "settings#upstream-proxy#port-label": "پورٹ",
-      "settings#upstream-proxy#username-label": "صارف کا نام",
-      "settings#upstream-proxy#password-label": "پاس ورڈ",
-      "settings#upstream-proxy#domain-label": "ڈومین",
-      "settings#upstream-proxy#skip-label": "اپ ستریم پراکسی کو استعمال نا کریں",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "اپ ستریم پراکسی ایرر",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon (سائفن) کو فی الحال آپ کے سسٹم پراکسی کو اس کے \"اپ اسٹریم پراکسی\" کے بطور استعمال کرنے کے لئے تشکیل دیا گیا ہے۔<br>\nتاہم ، ایسا لگتا ہے کہ ہم اس پراکسی کے ذریعہ Psiphon (سائفن) سرور سے رابطہ قائم کرنے سے قاصر ہیں۔<br>\nبراہ کرم \"اپ اسٹریم پراکسی استعمال نہ کریں\" کو فعال کریں اور دوبارہ کوشش کریں۔",
-      "settings#upstream-proxy#error-modal-body-configured": "آپ نے \"اپ اسٹریم پراکسی\" کو استعمال کرنے کے لئے Psiphon (سائفن) کو تشکیل دیا ہے۔<br>\nتاہم ، ایسا لگتا ہے کہ ہم اس پراکسی کے ذریعہ Psiphon (سائفن) سرور سے رابطہ قائم کرنے سے قاصر ہیں۔<br>\nبراہ کرم ترتیبات کو ٹھیک کریں اور دوبارہ کوشش کریں۔",
-      "settings#transport-mode#heading": "ٹرانسپورٹ موڈ",
-      "settings#transport-mode#check-label": "L2TP/IPSec موڈ کو  استعمال کریں",
-      "settings#transport-mode#help-text": "ونڈوز L2TP / IPSec ورچوئل نیٹ ورکنگ کا استعمال کرتا ہے۔ یہ موڈ آپ کے سبھی ایپس کو tunnel(ٹنل) میں لے جائے گا ، لیکن اس میں بے دخل نہیں ہوتا ہے اور اسی طرح سنسرشپ سے بچنے کی مضبوط قابلیت نہیں ہے۔ <strong>زیادہ تر فائر والز کو نظرانداز کرنے کی سفارش نہیں کی جاتی ہے</strong>۔",
-      "settings#systray-minimize#heading": "نوٹیفیکیشن ایریا کو کم سے کم کریں (سسٹم ٹرے)",
-      "settings#systray-minimize#help-text": "اگر فعال ہوجائے تو ، جب Psiphon (سائفن) ایپلیکیشن ونڈو کو کم سے کم کیا جائے تو وہ نوٹیفکیشن کے ریجن میں چھپ جائے گی (جسے آپ کے ونڈوز ٹاسک بار پر گھڑی کے قریب واقع \"سسٹم ٹرے\" یا \"سسٹری\" بھی کہتے ہیں)۔",
-      "settings#systray-minimize#reason": "نوٹیفکیشن ایریا (\"سسٹم ٹرے\") میں Psiphon (سائفن) کو کم سے کم کرنا آپ کے ٹاسک بار پر جگہ خالی کردیتی ہے۔ یہ خاص طور پر مددگار ثابت ہوتا ہے اگر آپ اکثر طویل مدت تک Psiphon (سائفن) چلا رہے ہیں۔",
-      "settings#systray-minimize#enable-label": "نوٹیفیکیشن ایریا کو کم سے کم کریں (سسٹم ٹرے)",
-      "settings#applying-message": "اپنی ترتیبات کو لاگو کرنے کے لئے دوبارہ رابطہ قائم کیا جا رہا ہے۔",
-      "settings#saved-message": "ترتیبات کو محفوظ کیا گیا۔",
-      "settings#error-modal#title": "ترتیبات کا ایرر",
-      "settings#error-modal#body": "آپ کی ترتیبات ویلیوز بیں ایرر ہیں، براہ کرم کاروائی کرنے سے پہلے ان کو درست کریں۔",
-      "feedback#top_content_title": "اپنی رائے سےآگاہ کریں",
-      "feedback#top_para_2": "جدید ورژن ڈاؤن لوڈ کرکے بہت ساری پریشانیوں کو حل کیا جاسکتا ہے۔ <a class=\"NewVersionURL\" href=\"#\">آپ یہاں کلک کرکے جدید ترین ورژن ڈاؤن لوڈ کرسکتے ہیں</a>، یا آپ ای میل بھیج سکتے ہیں<a class=\"NewVersionEmail\" href=\"#\"></a>۔",
-      "feedback#top_para_3": " <a class=\"FaqURL\" href=\"#\">FAQ میں</a> آپ بہت ساری عام پریشانیوں کے حل بھی تلاش کرسکتے ہیں۔",
-      "feedback#smiley_happy": "Psiphon (سائفن) کنکٹ ہے اور جس طرح سے میں چاہتا ہوں اس طرح کی کارکردگی کا مظاہرہ کرتا ہے۔",
-      "feedback#smiley_sad": "Psiphon (سائفن) اکثر رابطہ قائم کرنے میں ناکام رہتا ہے یا اچھی کارکردگی کا مظاہرہ نہیں کرتا ہے۔",
-      "feedback#text_feedback_prompt": "برائے مہربانی اپنی رائے یہاں درج کریں:",
-      "feedback#text_feedback_email_prompt": "اگر آپ چاہتے ہیں کہ ہم آپ کو جواب دیں تو ، براہ کرم اپنا ای میل ایڈریس درج کریں:",
-      "feedback#diagnostic_check": "مخصوص ڈیٹا اپ لوڈ کریں۔ براہ کرم نوٹ کریں کہ یہ مخصوص ڈیٹا آپ کی شناخت نہیں کرتا ہے، اور اس سے ہمیں Psiphon (سائفن) کو آسانی سے چلانے میں مدد ملے گی۔ <a class=\"DataCollectionInfoURL\" href=\"#\">ہم نے کون سا ڈیٹا اکٹھا کیا ہے یہ دیکھنے کے لئے یہاں کلک کریں۔</a>",
-      "feedback#submit_button": "جمع کرائیں",
-      "feedback#text_feedback_bottom_para": "اگر مذکورہ بالا فارم کام نہیں کررہا ہے ، یا آپ اسکرین شاٹس بھیجنا چاہتے ہیں تو ، براہ کرم ہمیں ای میل کریں <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>شکریہ!</strong> آپ کی رائے بھیج دی گئی ہے۔",
-      "logs#show-debug-label": "ڈی بگ لاگز دکھائیں",
-      "logs#placeholder": "لاگز ابھی تک نہیں ہے",
-      "language#success-message": "<strong>ہیلو!</strong> Psiphon (سائفن) میں خوش آمدید.",
-      "about#wordart-tag": "سرحدوں کے پار ",
-      "about#description": "Psiphon (سائفن) ایک <strong>سنسرشپ سے بچاؤ کا ٹول</strong> ہے - یہ اوپن انٹرنیٹ ، پچھلے سینسرز اور فائر والز تک رسائی دینے کے لئے تیار کیا گیا ہے۔ یہ <strong>اوپن سورس</strong> ہے اور ٹورنٹو، کینیڈا میں تیار کیا گیا ہے۔\n ",
-      "about#visit-download-site": "براہ مہربانی ویب سائٹ دیکھیں<strong><a class=\"NewVersionURL\" href=\"#\">نیا ورژن ڈاؤن لوڈ کریں</a></strong>یا پھر<strong><a class=\"InfoURL\" href=\"#\">مدد حاصل کریں اور معلومات لیں</a></strong>۔ Psiphon (سائفن) اینڈرائیڈ اور ونڈوز کے لئے دستیاب ہے۔",
-      "about#get-by-email": "<strong>اگر ویب سائٹ دستیاب نہیں ہے</strong>  تو ، آپ اس پتے پر ای میل بھیج کر Psiphon (سائفن)  کا نیا ورژن حاصل کرسکتے ہیں۔",
-      "about#client-version": "ونڈوز کلائنٹ ورژن کے لئے Psiphon (سائفن):",
-      "general#modal-close-button": "بند کیجیے",
-      "general#notice-modal-tech-preamble": "یہاں کچھ تکنیکی غلطیوں کی معلومات ہے:",
-      "notice#systemproxysettings-setproxy-error-title": "سسٹم پراکسی ایرر",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon (سائفن) سسٹم کی پراکسی ترتیبات کو سیٹ کرنے میں ناکام ہے۔</p>\n<p>اس کی وجہ آپ کا اینٹی وآئرس سافٹ وئیر ہو سکتا ہے۔ آپ کو  شاید اپنی ایپلیکشن یا سسٹم پراکسی ترتیبات کو ترتیب دینے کے لئے لوکل Psiphon (سائفن) پراکسیز کو استعمال کرنے کی ضرورت ہے۔</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon (سائفن) \"<%- data %>\" نامی انٹرنیٹ کنکشن کیلئے سسٹم کی پراکسی ترتیبات کو مرتب کرنے میں ناکام ہوا۔ آپ کا اینٹی وائرس سافٹ ویئر ہو سکتا ہے۔  آپ کو مقامی Psiphon (سائفن) پراکسیز استعمال کرنے کیلئے سسٹم پراکسی ترتیبات یا اپنی ایپلی کیشن کو دستی تشکیل دینے کی ضرورت پڑ سکتی ہے۔",
-      "appbackend#state-stopped-title": "Psiphon (سائفن) منقطع ہو گیا ہے",
-      "appbackend#state-starting-title": "Psiphon (سائفن) سے رابطہ ہو رہا ہے",
-      "appbackend#state-starting-body": "براہ کرم انتظار کیجئے",
-      "appbackend#state-connected-title": "Psiphon (سائفن) سے رابطہ ہو گیا ہے",
-      "appbackend#state-connected-body": "سرحدوں کے پار تلاش کریں!",
-      "appbackend#state-connected-reminder-title": "Psiphon (سائفن) آپ کو مربوط رکھتا ہے۔",
-      "appbackend#state-connected-reminder-body": "Psiphon (سائفن) کو مفت رکھے۔ ہمارے سپنسرز صفحات کو ملاحظہ کرنے کے لئے کلک کریں!",
-      "appbackend#state-connected-reminder-body-2": "ہمارے اسپانسر صفحات ملاحظہ کرکے Psiphon (سائفن) کو مفت رکھیں!",
-      "appbackend#minimized-to-systray-title": "Psiphon (سائفن) کو نوٹیفکیشن ایریا میں کم سے کم کردیا گیا ہے",
-      "appbackend#minimized-to-systray-body": "ایپلیکشن کو بحال کرنے کے لئے آئکن پر کلک کریں",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash ٹرانزیکشن میں خرابی۔",
-      "psicash#transaction-error-body": " آپ کے PsiCash ٹرانزیکشن کی کوشش غیر متوقع طور پر ناکام ہوگئی ہے۔",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash خریداری پہلے سے موجود ہے",
-      "psicash#transaction-ExistingTransaction-body": "آپ کے پاس اس طرح کی PsiCash خریداری پہلے سے موجود ہے۔ اسی قسم کی دوسری خریداری کی تب تک اجازت نہیں ہوگی جب تک پچھلی والی زائدالمعیاد نہیں ہوجاتی۔ آپ کی PsiCash حالت اب تازہ دم ہو جائے گی۔",
-      "psicash#transaction-InsufficientBalance-title": "ناکافی PsiCash بیلنس",
-      "psicash#transaction-InsufficientBalance-body": "اس خریداری کیلئے آپ کے پاس زیادہ PsiCash بیلنس نہیں ہے۔ ",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash کی خریداری کیلئے بے جوڑ قیمت",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash خریداری قیمت زائدالمعیاد ہیں۔ آپ کی PsiCash کی موجودہ حالت اب تازہ دم کی جائے گی۔",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash خریداری کی قسم نہیں ملی",
-      "psicash#transaction-TransactionTypeNotFound-body": "جس مصنوعات کو آپ خریدنا چاہتے ہیں وہ کہیں دکھائی نہیں دے رہی۔ آپ کو شاید ایپلی کیشن ری انسٹال یا اَپ ڈیٹ کرنے کی ضرورت پڑے۔",
-      "psicash#transaction-InvalidTokens-title": "غلط PsiCash ٹوکن",
-      "psicash#transaction-InvalidTokens-body": "آپکے PsiCash ٹوکن بے اثر ہوگئے ہیں۔ ایپلی کیشن ری سٹارٹ کرنے کی کوشش کریں۔ اگر یہ کام نا کرے تو آپ کو <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">اپنے لوکل سٹوریج کو صاف</a> کرنے کی ضرورت ہوگی۔",
-      "psicash#transaction-ServerError-title": "PsiCash سرور ایرر",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "رفتار کی ضرورت بوسٹ؟",
-      "psicash#ui-buypsi": "PsiCash خریدیں",
-      "psicash#ui-buymorepsi": "زیادہ PsiCash خریدیں",
-      "psicash#ui-nsfbalance-buttontext": "تیزی کیلئے درکار بوسٹ",
-      "psicash#ui-enoughbalance-buttontext": "تیزی کی ابتدا بوسٹ",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "تیزی کی ابتدا ہو رہی ہے بوسٹ",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon (سائفن) کنکشن کی ضرورت تھی",
-      "psicash#mustconnect-modal#body": "PsiCash استعمال کرنے کیلئے آپ کو Psiphon (سائفن) نیٹ ورک سے منسلک ہونا ضروری ہے۔",
-      "psicash#init-error-title": "PsiCash کی ابتدا میں ایرر",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "تعاون بذریعہ"
-    }
-  },
-  "uz@Latn": {
-    "name": "O'zbekcha",
-    "translation": {
-      "banner#long-connecting": "<strong>Ana xolos!</strong> Aloqa o‘rnatishda muammolar borga o‘xshaydi!<br>\nPsiphonning oxirgi versiyasini <a class=\"newVersionURL\" href=\"#\">saytimizdan</a>\nyoki <a class=\"NewVersionEmail\" href=\"#\"></a> manziliga xat yuborib olishingiz mumkin.",
-      "nav#connection#starting": "Ulanmoqda",
-      "nav#connection#connected": "Ulandi",
-      "nav#connection#stopping": "Uzilmoqda",
-      "nav#connection#stopped": "Uzilgan",
-      "nav#settings": "Sozlamalar",
-      "nav#feedback": "Fikr-mulohaza",
-      "nav#logs": "Jurnallar",
-      "nav#about": "Brauzer haqida",
-      "connection#starting-msg": "Psiphon tarmoqqa <span class=\"state-word\">ulanmoqda</span>…",
-      "connection#stop-btn": "To‘xtatish",
-      "connection#connected-msg": "Psiphon tarmoqqa <span class=\"state-word\">ulandi</span>",
-      "connection#disconnect-btn": "Aloqani uzish",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">aloqasi uzilmoqda</span>…",
-      "connection#wait-btn": "Iltimos, kuting…",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">aloqasi uzildi</span>",
-      "connection#connect-btn": "Ulanish",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Xato!</strong> Davom etishdan oldin noto‘g‘ri qiymatlarni tuzating.",
-      "settings#reset-button": "Standart sozlamalarni tiklash",
-      "settings#apply-button": "Sozlamalarni qo‘llash",
-      "settings#unapplied-changes-prompt#title": "Sozlamalar o‘zgardi",
-      "settings#unapplied-changes-prompt#body": "Sozlamalarga o‘zgartirish kiritdingiz, lekin ularni qo‘llamadingiz.<br><br>Sozlamalar hozir qo‘llansinmi yoki bekor qilinsinmi?",
-      "settings#unapplied-changes-prompt#apply-button": "Qo‘llash",
-      "settings#unapplied-changes-prompt#discard-button": "Bekor qilish",
-      "settings#vpn-incompatible-msg": "(L2TP/IPSec rejimida ishlamaydi.)",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Ajratib shirflash tunneli",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Mamlakatingizdagi saytlarga proksi-server ishlatilmasin",
-      "settings#disable-timeouts#heading": "Tezligi past tarmoqlar uchun kutish vaqtini o‘chirib qo‘yish",
-      "settings#disable-timeouts#help-text": "Bu sozlama yoniq bo‘lsa, Psiphon serveri bilan aloqa uzilmaydi.",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Tezligi past tarmoqlar uchun kutish vaqtini o‘chirib qo‘yish",
-      "settings#egress-region#heading": "Psiphon serveri mintaqasi",
-      "settings#egress-region#select-best-performance": "Yuqori unumdorlik",
-      "settings#egress-region#select-us": "AQSH",
-      "settings#egress-region#select-ca": "Kanada",
-      "settings#egress-region#select-gb": "Buyuk Britaniya",
-      "settings#egress-region#select-jp": "Yaponiya",
-      "settings#egress-region#select-sg": "Singapur",
-      "settings#egress-region#select-sk": "Slovakiya",
-      "settings#egress-region#select-nl": "Niderlandiya",
-      "settings#egress-region#select-de": "Germaniya",
-      "settings#egress-region#select-in": "Hindiston",
-      "settings#egress-region#select-es": "Ispaniya",
-      "settings#egress-region#select-hk": "Gonkong",
-      "settings#egress-region#select-at": "Avstriya",
-      "settings#egress-region#select-be": "Belgiya",
-      "settings#egress-region#select-bg": "Bolgariya",
-      "settings#egress-region#select-ch": "Shveytsariya",
-      "settings#egress-region#select-cz": "Chexiya Respublikasi",
-      "settings#egress-region#select-dk": "Daniya",
-      "settings#egress-region#select-fr": "Fransiya",
-      "settings#egress-region#select-hu": "Vengriya",
-      "settings#egress-region#select-it": "Italiya",
-      "settings#egress-region#select-no": "Norvegiya",
-      "settings#egress-region#select-ro": "Ruminiya",
-      "settings#egress-region#select-se": "Shvetsiya",
-      "settings#egress-region#select-pl": "Polsha",
-      "settings#egress-region#select-rs": "Serbiya",
-      "settings#egress-region#select-au": "Avstraliya",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Yaroqli Psiphon serveri mintaqasini tanlang.",
-      "settings#egress-region#error-modal-title": "Server mintaqasi ish faoliyatida emas",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Mahalliy proksi-server portlari",
-      "settings#local-proxy-ports#leave-blank": "Port avtomatik tanlanishi uchun <strong>bo‘sh qoldiring</strong>  (tavsiya etiladi).",
-      "settings#local-proxy-ports#reason": "Agar kompyuteringizda Psiphonning ma’lum portlari orqali ulanadigan dasturlar bo‘lsa, har doim o‘sha portlarni ishlating. Agar mahalliy portlar muhim bo‘lmasa, Psiphon band bo‘lmasligi uchun ularni avtomatik tanlaydi.",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "1 dan 65535 gacha bo‘lishi shart.",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Mahalliy portlar bir biridan farqli bo‘lishi shart.",
-      "settings#local-proxy-ports#error-modal-title": "Mahalliy proksi-server portlari bandligi",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nPsiphon hozir mahalliy HTTP proksi-server porti orqali ishlashi sozlangan. <br>\nLekin, bu port band yoki ishlamaydi\n</p>\n<p>\nIltimos, boshqa port tanlang yoki Psiphon HTTP proksi-server portini avtomatik tanlashi uchun qiymatini bo‘sh qoldiring.\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nPsiphon hozir mahalliy SOCKS proksi-server porti orqali ishlashi sozlangan. <br>\nLekin, bu port band yoki ishlamaydi\n</p>\n<p>\nIltimos, boshqa port tanlang yoki Psiphon SOCKS proksi-server portini avtomatik tanlashi uchun qiymatini bo‘sh qoldiring.\n</p>",
-      "settings#upstream-proxy#heading": "Tashqi proksi",
-      "settings#upstream-proxy#by-default": "Agar kompyuteringizda proksi-server sozlangan bo‘lsa, Psiphon tunnel orqali ulanish vaqtida shu proksidan foydalanadi. Siz bu proksi-serverni o‘zgartirishingiz yoki tashqi proksi-serverni umuman taqiqlab qo‘yishingiz mumkin.",
-      "settings#upstream-proxy#reason": "Tashqi proksi-serverlar maktablar, universitetlar va tashkilotlarda ishlatiladi. Agar tarmoqqa ulanishingiz uchun tashqi proksi-server zarur bo‘lsa, ularga ulanishni o‘zingiz sozlashingiz kerak bo‘lishi mumkin.",
-      "settings#upstream-proxy#proxy-reqs": "HTTPS ta’minotiga ega HTTP proksi-serverlar.",
-      "settings#upstream-proxy#hostname-label": "Host nomi",
-      "settings#upstream-proxy#port-label": "Port",
-      "settings#upstream-proxy#username-label": "Foydalanuvchi nomi",
-      "settings#upstream-proxy#password-label": "Parol",
-      "settings#upstream-proxy#domain-label": "Domen",
-      "settings#upstream-proxy#skip-label": "Taqiqlangan tashqi proksi",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Tashqi proksi xatoligi",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon hozir tizim proksi-serveridan “tashqi proksi” sifatida foydalanishga sozlangan.<br>\nLekin, bu proksi-server orqali Psiphon serveriga ulanib bo‘lmayapti.<br>\n“upstream proksi-serverini taqiqlash” bandini yoqing va qaytadan urinib ko‘ring.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon hozir tizim proksi-serveridan “tashqi proksi” sifatida foydalanishga sozlangan.<br>\nLekin, bu proksi-server orqali Psiphon serveriga ulanib bo‘lmayapti.<br>\nSozlamani tuzating va qayta urinib ko‘ring.",
-      "settings#transport-mode#heading": "Aloqa protokoli",
-      "settings#transport-mode#check-label": "L2TP/IPSec rejimidan foydalanish",
-      "settings#transport-mode#help-text": "Windows tizimidagi ichki L2TP/IPSec VPN tarmog‘ini ishlatadi. Bu rejimda barcha dasturlar ulanishlari tunnel orqali shifrlanadi. Lekin bu rejim osongina aniqlanadi va bloklanadi. Ko‘p himoya bloklarni aylanib o‘tishda foydalanish <strong>tavsiya etilmaydi</strong>.",
-      "settings#systray-minimize#heading": "Bildirishnomalar paneliga yig‘ish (vazifalar paneli)",
-      "settings#systray-minimize#help-text": "Agar yoniq bo‘lsa, Psiphon dasturi oynasi bildirishnomalar paneliga yig‘iladi (windows vazifalar panelida soatdan keyin).",
-      "settings#systray-minimize#reason": "Psiphon’ni bildirishnomalar paneliga yig‘ish vazifalar panelida joy bo‘shatadi. Bu Psiphondan ko‘p foydalanishda juda qulay.",
-      "settings#systray-minimize#enable-label": "Bildirishnomalar paneliga yig‘ish (vazifalar paneli)",
-      "settings#applying-message": "Sozlamalaringizni qo‘llash uchun qaytadan ulanmoqda.",
-      "settings#saved-message": "Sozlamalar saqlandi.",
-      "settings#error-modal#title": "Sozlamalarda xato",
-      "settings#error-modal#body": "Sozlamalaringizda xatoliklar bor. Ularni to‘g‘irlang va qaytadan qo‘llang.",
-      "feedback#top_content_title": "Bizga fikr-mulohaza yuboring",
-      "feedback#top_para_2": "Ko‘plab muammolarga oxirgi versiyani yuklab olish yechim bo‘lishi mumkin. Siz <a class=\"newVersionURL\" href=\"#\">bu yerga bosib oxirgi versiyani yuklab olishingiz</a>, yoki <span id=\"newVersionEmail\"></span> manziliga xat yuborib olishingiz mumkin.",
-      "feedback#top_para_3": "Ko‘p tanish muammolar va ularning yechimini bizning <a class=\"faqURL\" href=\"#\">ko‘p so‘ralgan savollar</a> sahifamizdan topish mumkin.",
-      "feedback#smiley_happy": "Psiphon ulanishi va ishlashida muammolar yo‘q.",
-      "feedback#smiley_sad": "Psiphon ba’zida ulanmayapti yoki yaxshi ishlamayapti.",
-      "feedback#text_feedback_prompt": "Bu yerda izoh qoldiring:",
-      "feedback#text_feedback_email_prompt": "Xabaringizga javob olishni xohlasangiz e-pochta manzilingizni kiriting:",
-      "feedback#diagnostic_check": "Diagnostiga hisobotini yuborish. Diagnostik hisobot faylida shaxsiy axborotingiz bo‘lmaydi va tizim yaxshiroq va ishonchliroq bo‘lishini ta’minlaydi. <a class=\"dataCollectionInfoURL\" href=\"#\">Qanday ma’lumotlarni yig‘ishimiz haqida o‘rganish uchun bu yerga bosing.</a>",
-      "feedback#submit_button": "Yuborish",
-      "feedback#text_feedback_bottom_para": "Yuqoridagi shakl ishlamasa yoki skrinshotlar yuborishni istasangiz, <a id=\"emailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a> manzilimizga xat yuboring.",
-      "feedback#success-message": "<strong>Rahmat!</strong> Fikr-mulohazalaringiz yuborildi.",
-      "logs#show-debug-label": "Xatolarni ko‘rish jurnali ko‘rsatilsin",
-      "logs#placeholder": "Jurnalda qaydlar yo‘q",
-      "language#success-message": "<strong>Salom!</strong> Psiphonga xush kelibsiz.",
-      "about#wordart-tag": "To‘siqlarsiz",
-      "about#description": "Psiphon – <strong>senzurani aylanib o‘tish vositasi</strong> bo‘lib, Internetni erkin kezishga yordam beradi. Ochiq kodli bu dasturiy ta’minot Kanadaning Toronto shaxrida ishlab chiqilgan.",
-      "about#visit-download-site": "<strong><a class=\"NewVersionURL\" href=\"#\">Yangi versiyani yuklab olish</a></strong> yoki <strong><a class=\"InfoURL\" href=\"#\">muammolar bo‘yicha yordam olish</a></strong> uchun saytimizga tashrif buyuring. Psiphon Android va Windows tizimlarida ishlaydi.",
-      "about#get-by-email": "<strong>Agar sayt ish faoliyatida bo‘lmasa</strong>, Psiphonning yangi versiyasini e-pochta orqali olish uchun quyidagi manzilga xat yuboring:",
-      "about#client-version": "Psiphonning Windows mijoz-dasturi versiyasi:",
-      "general#modal-close-button": "Yopish",
-      "general#notice-modal-tech-preamble": "Texnik xatolik axboroti:",
-      "notice#systemproxysettings-setproxy-error-title": "Tizim proksi-serveri xatoligi",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon tizim proksi-serveri sozlamalarini o‘zgartira olmadi.</p>\n<p>Bunga antivirus dasturingiz sabab bo‘lsa kerak. Antivirusda dastur yoki proksi-server sozlamalari mahalliy Psiphon proksi-serveri orqali ishlashini sozlang.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon “<%- data %>” nomli Internet ulanishini tizim proksi-serveri orqali sozlay olmadi. Bunga antivirus dasturingiz sabab bo‘lsa kerak. Antivirusda dastur yoki proksi-server sozlamalari mahalliy Psiphon proksi-serveri orqali ishlashini sozlang.",
-      "appbackend#state-stopped-title": "Psiphon aloqasi uzildi",
-      "appbackend#state-starting-title": "Psiphon tarmoqqa ulanmoqda",
-      "appbackend#state-starting-body": "Iltimos, kuting…",
-      "appbackend#state-connected-title": "Psiphon tarmoqqa ulandi",
-      "appbackend#state-connected-body": "Internetni to‘siqlarsiz kezing!",
-      "appbackend#state-connected-reminder-title": "Psiphon bilan doim aloqa bo‘lasiz",
-      "appbackend#state-connected-reminder-body": "Psiphonning bepul bo‘lishiga hissa qo‘shing. Homiy sahifalariga o‘tish uchun bu yerga bosing!",
-      "appbackend#state-connected-reminder-body-2": "Psiphonning bepul bo‘lishiga hissa qo‘shing. Homiy sahifalariga o‘tish uchun bu yerga bosing!",
-      "appbackend#minimized-to-systray-title": "Psiphon bildirishnomalar paneliga yig‘ildi",
-      "appbackend#minimized-to-systray-body": "Dasturni yoyish uchun ikonkasi ustiga bosing",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "Insufficient PsiCash balance",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash server error",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 hour",
-      "psicash#1-day": "1 day",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Homiy:"
-    }
+    "name": "አማርኛ"
   },
-  "vi": {
-    "name": "Tiếng Việt",
+  "ar": {
+    "name": "العربية"
+  },
+  "az": {
+    "name": "azərbaycan dili"
+  },
+  "be": {
+    "name": "Беларуская"
+  },
+  "bn": {
+    "name": "বাংলা"
+  },
+  "bo": {
+    "name": "བོད་ཡིག"
+  },
+  "de": {
+    "name": "Deutsch"
+  },
+  "devltr": {
+    "name": "[Ƥȧȧƈķȧȧɠḗḗḓ Ȧȧƈƈḗḗƞŧḗḗḓ]"
+  },
+  "devrtl": {
+    "name": "Ԁɐɔʞɐƃǝp‬ ‮Wıɹɹoɹǝp"
+  },
+  "el": {
+    "name": "Ελληνικά"
+  },
+  "en": {
+    "name": "English",
     "translation": {
-      "banner#long-connecting": "<strong>Ồ!</strong> Bạn dường như gặp khó khăn kết nối!<br>\nTải phiên bản Psiphon mới nhất từ <a class=\"NewVersionURL\" href=\"#\">trang tải xuống</a>\nhoặc gửi email đến <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "Đang kết nối",
-      "nav#connection#connected": "Đã kết nối",
-      "nav#connection#stopping": "Đang ngắt kết nối",
-      "nav#connection#stopped": "Đã dừng kết nối",
-      "nav#settings": "Thiết đặt",
-      "nav#feedback": "Phản hồi",
-      "nav#logs": "Ký sự",
-      "nav#about": "Giới thiệu",
-      "connection#starting-msg": "Psiphon  <span class=\"state-word\">đang kết nối </span>…",
-      "connection#stop-btn": "Dừng ",
-      "connection#connected-msg": "Psiphon <span class=\"state-word\"> được kết nối</span>",
-      "connection#disconnect-btn": "Ngắt kết nối",
-      "connection#stopping-msg": "Psiphon <span class=\"state-word\">đang ngắt kết nối </span>…",
-      "connection#wait-btn": "Xin chờ...",
-      "connection#stopped-msg": "Psiphon <span class=\"state-word\">đã ngắt kết nối </span>",
-      "connection#connect-btn": "Kết nối",
+      "banner#sponsored-by": "Sponsored by",
+      "banner#long-connecting": "<strong>Oh no!</strong> You seem to be having trouble connecting!<br>\nDownload the latest version of Psiphon from the <a class=\"NewVersionURL\" href=\"#\">download site</a>\nor by sending an email to <a class=\"NewVersionEmail\" href=\"#\"></a>",
+      "nav#connection#starting": "Connecting",
+      "nav#connection#connected": "Connected",
+      "nav#connection#stopping": "Disconnecting",
+      "nav#connection#stopped": "Disconnected",
+      "nav#settings": "Settings",
+      "nav#feedback": "Feedback",
+      "nav#logs": "Logs",
+      "nav#about": "About",
+      "connection#starting-msg": "Psiphon is <span class=\"state-word\">connecting</span>…",
+      "connection#stop-btn": "Stop",
+      "connection#connected-msg": "Psiphon is <span class=\"state-word\">connected</span>",
+      "connection#disconnect-btn": "Disconnect",
+      "connection#stopping-msg": "Psiphon is <span class=\"state-word\">disconnecting</span>…",
+      "connection#wait-btn": "Please wait…",
+      "connection#stopped-msg": "Psiphon is <span class=\"state-word\">disconnected</span>",
+      "connection#connect-btn": "Connect",
       "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>Có Lỗi!</strong> Vui lòng điều chỉnh các con số sai trước khi tiếp tục.",
-      "settings#reset-button": "Thiết lập lại mặc định",
-      "settings#apply-button": "Áp dụng các thay đổi",
-      "settings#unapplied-changes-prompt#title": "Thiết đặt đã đổi",
-      "settings#unapplied-changes-prompt#body": "Bạn có điều chỉnh các thiết đặt nhưng chưa áp dụng các thay đổi này.<br><br>Bạn có muốn áp dụng các thay đổi này ngay hay bỏ đi?",
-      "settings#unapplied-changes-prompt#apply-button": "Áp dụng",
-      "settings#unapplied-changes-prompt#discard-button": "Hủy bỏ",
-      "settings#vpn-incompatible-msg": "(Không chạy với chế độ L2TP/IPSec)",
+      "settings#error-alert": "<strong>Error!</strong> Please fix incorrect values before proceeding.",
+      "settings#reset-button": "Reset to Default",
+      "settings#apply-button": "Apply Changes",
+      "settings#unapplied-changes-prompt#title": "Settings Changed",
+      "settings#unapplied-changes-prompt#body": "You have made changes to your settings, but you have not applied the changes.<br><br>Do you wish to apply your changes now or discard them?",
+      "settings#unapplied-changes-prompt#apply-button": "Apply",
+      "settings#unapplied-changes-prompt#discard-button": "Discard",
+      "settings#vpn-incompatible-msg": "(Doesn't work with L2TP/IPSec mode.)",
       "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "Đường Hầm Tách",
+      "settings#split-tunnel#heading": "Split Tunnel",
       "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
       "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "Đừng proxy các trang web bên trong quốc gia bạn",
-      "settings#disable-timeouts#heading": "Tắt Hạn Chờ cho Mạng Chậm",
-      "settings#disable-timeouts#help-text": "Nếu kích hoạt, việc thông tin liên lạc với máy chủ Psiphon sẽ không bị hết hạn chờ",
+      "settings#split-tunnel#enable-label": "Don't proxy websites within your country",
+      "settings#disable-timeouts#heading": "Disable Timeouts for Slow Networks",
+      "settings#disable-timeouts#help-text": "If enabled, communication with the Psiphon server will not time out.",
       "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "Tắt hạn chờ cho mạng chậm",
-      "settings#egress-region#heading": "Vùng máy chủ Psiphon",
-      "settings#egress-region#select-best-performance": "Hiệu Năng Tốt Nhất",
-      "settings#egress-region#select-us": "Hoa Kỳ",
+      "settings#disable-timeouts#enable-label": "Disable timeouts for slow networks",
+      "settings#egress-region#heading": "Psiphon Server Region",
+      "settings#egress-region#select-best-performance": "Best Performance",
+      "settings#egress-region#select-us": "United States",
       "settings#egress-region#select-ca": "Canada",
-      "settings#egress-region#select-gb": "Anh Quốc",
-      "settings#egress-region#select-jp": "Nhật Bản",
+      "settings#egress-region#select-gb": "United Kingdom",
+      "settings#egress-region#select-jp": "Japan",
       "settings#egress-region#select-sg": "Singapore",
       "settings#egress-region#select-sk": "Slovakia",
-      "settings#egress-region#select-nl": "Hà Lan",
-      "settings#egress-region#select-de": "Đức",
-      "settings#egress-region#select-in": "Ấn Độ",
-      "settings#egress-region#select-es": "Tây Ban Nha",
-      "settings#egress-region#select-hk": "Hồng Kông",
-      "settings#egress-region#select-at": "Áo",
-      "settings#egress-region#select-be": "Bỉ",
+      "settings#egress-region#select-nl": "Netherlands",
+      "settings#egress-region#select-de": "Germany",
+      "settings#egress-region#select-in": "India",
+      "settings#egress-region#select-es": "Spain",
+      "settings#egress-region#select-hk": "Hong Kong",
+      "settings#egress-region#select-at": "Austria",
+      "settings#egress-region#select-be": "Belgium",
       "settings#egress-region#select-bg": "Bulgaria",
-      "settings#egress-region#select-ch": "Thụy Sĩ",
-      "settings#egress-region#select-cz": "Tiệp",
-      "settings#egress-region#select-dk": "Đan Mạch",
-      "settings#egress-region#select-fr": "Pháp",
+      "settings#egress-region#select-ch": "Switzerland",
+      "settings#egress-region#select-cz": "Czech Republic",
+      "settings#egress-region#select-dk": "Denmark",
+      "settings#egress-region#select-fr": "France",
       "settings#egress-region#select-hu": "Hungary",
-      "settings#egress-region#select-it": "Ý",
-      "settings#egress-region#select-no": "Na Uy",
+      "settings#egress-region#select-it": "Italy",
+      "settings#egress-region#select-no": "Norway",
       "settings#egress-region#select-ro": "Romania",
-      "settings#egress-region#select-se": "Thụy Điển",
-      "settings#egress-region#select-pl": "Ba Lan",
+      "settings#egress-region#select-se": "Sweden",
+      "settings#egress-region#select-pl": "Poland",
       "settings#egress-region#select-rs": "Serbia",
-      "settings#egress-region#select-au": "Úc",
+      "settings#egress-region#select-au": "Australia",
       "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
       "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "Chọn một khu vực máy chủ Psiphon hợp lệ.",
-      "settings#egress-region#error-modal-title": "Khu Vực Máy Chủ Không Có Sẵn",
+      "settings#egress-region#invalid-error-msg": "Choose a valid Psiphon server region.",
+      "settings#egress-region#error-modal-title": "Server Region Unavailable",
       "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "Các cổng Proxy địa phương",
-      "settings#local-proxy-ports#leave-blank": "Để <strong>trống </strong> để tự động chọn cổng (đề nghị).",
-      "settings#local-proxy-ports#reason": "Nếu bạn dùng các công cụ nào trong máy tính mà cần có cấu hình đặc biệt để chạy được với Psiphon, thì bạn nên để Psiphon thường xuyên dùng cùng một cổng địa phương. Nếu bạn không có lý do gì để chọn một cổng nào đó thì nên để cho Psiphon tự động chọn cổng để tránh bị xung khắc. ",
+      "settings#local-proxy-ports#heading": "Local Proxy Ports",
+      "settings#local-proxy-ports#leave-blank": "Leave <strong>blank</strong> for automatic port selection (recommended).",
+      "settings#local-proxy-ports#reason": "If you use tools on your computer that require manual configuration to work with Psiphon, you will want Psiphon to consistently use the same local port numbers. If you don’t have a reason to specify port numbers, you should allow Psiphon to choose them automatically to help avoid conflicts.",
       "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "Phải ở giữa 1 và 65535.",
+      "settings#port-value-error-msg": "Must be between 1 and 65535.",
       "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "Các cổng địa phương phải khác biệt với nhau",
-      "settings#local-proxy-ports#error-modal-title": "Xung đột cổng Proxy địa phương",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\nBạn cấu hình Psiphon dùng một cổng địa phương đặc trung cho proxy HTTP.<br>\nTuy nhiên, cổng đó hình như đã được dùng rồi và Psiphon không thể dùng nó.\n</p>\n<p>\nXin đổi qua cổng khác và thử lại. Chúng tôi đề nghị bạn xóa số cổng để Psiphon tự động chọn một cổng đang còn trống .\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nBạn cấu hình Psiphon dùng một cổng địa phương đặc trung cho proxy SOCKS.<br>\nTuy nhiên, cổng đó hình như đã được dùng rồi và Psiphon không thể dùng nó.\n</p>\n<p>\nXin đổi qua cổng khác và thử lại. Chúng tôi đề nghị bạn xóa số cổng để Psiphon tự động chọn một cổng đang còn trống.\n</p>",
-      "settings#upstream-proxy#heading": "Proxy luồng trên",
-      "settings#upstream-proxy#by-default": "Nếu máy đã có sẵn cấu hình proxy, theo mặc định Psiphon sẽ dùng proxy đó khi mở đường hầm kết nối an toàn. Bạn có thể lờ cách đó đi bằng cách nêu rõ cần dùng proxy nào, hoặc cho biết là không dùng \"proxy luồng trên\".",
-      "settings#upstream-proxy#reason": "Proxy luồng trên đôi khi cần có cho trường học, đại học, hoặc công ty. Nếu nhà mạng có cung cấp các thiết đặt proxy luồng trên cho bạn, thì cần thiết đặt nơi đây để có thể kết nối.",
-      "settings#upstream-proxy#proxy-reqs": "Chỉ cho phép các proxy HTTP nào hỗ trợ HTTPS",
-      "settings#upstream-proxy#hostname-label": "Tên máy chủ",
-      "settings#upstream-proxy#port-label": "Cổng",
-      "settings#upstream-proxy#username-label": "Tên người dùng",
-      "settings#upstream-proxy#password-label": "Mật khẩu",
-      "settings#upstream-proxy#domain-label": "Tên miền",
-      "settings#upstream-proxy#skip-label": "Đừng dùng proxy luồng trên",
+      "settings#local-proxy-ports#unique-error-msg": "Local ports must be distinct from each other.",
+      "settings#local-proxy-ports#error-modal-title": "Local Proxy Port Conflict",
+      "settings#local-proxy-ports#error-modal-body-http": "<p>\nYou have configured Psiphon to use a specific local port for its HTTP proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured HTTP proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+      "settings#local-proxy-ports#error-modal-body-socks": "<p>\nYou have configured Psiphon to use a specific local port for its SOCKS proxy.<br>\nHowever, that port appears to be already in use and so Psiphon cannot use it.\n</p>\n<p>\nPlease change the configured SOCKS proxy port value and try again. We recommended that you clear the value so that Psiphon can automatically pick an available port.\n</p>",
+      "settings#upstream-proxy#heading": "Upstream Proxy",
+      "settings#upstream-proxy#by-default": "If your computer already has a proxy configured, by default Psiphon will use that proxy when establishing a tunnel. You can override that behavior by specifying a proxy to use, or by specifying that no such “upstream proxy” should be used.",
+      "settings#upstream-proxy#reason": "Upstream proxies are sometimes required by schools, universities, or businesses. If your network provider has given you upstream proxy settings, then manually setting them here may be required to connect.",
+      "settings#upstream-proxy#proxy-reqs": "Only HTTP proxies that support HTTPS are allowed.",
+      "settings#upstream-proxy#hostname-label": "Hostname",
+      "settings#upstream-proxy#port-label": "Port",
+      "settings#upstream-proxy#username-label": "Username",
+      "settings#upstream-proxy#password-label": "Password",
+      "settings#upstream-proxy#domain-label": "Domain",
+      "settings#upstream-proxy#skip-label": "Don't use upstream proxy",
       "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
       "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "Lỗi Proxy Luồng Trên",
-      "settings#upstream-proxy#error-modal-body-default": "Psiphon hiện được cấu hình để dùng proxy của hệ thống làm “proxy luồng trên”.<br>\nTuy nhiên, chúng tôi dường như không thể kết nối với máy chủ Psiphon qua proxy đó.<br>\nXin kích hoạt tùy chọn “Đừng dùng proxy luồng trên” và thử lại.",
-      "settings#upstream-proxy#error-modal-body-configured": "Psiphon hiện được cấu hình để dùng proxy của hệ thống làm “proxy luồng trên”.<br>\nTuy nhiên, chúng tôi dường như không thể kết nối với máy chủ Psiphon qua proxy đó.<br>\nXin điều chỉnh lại các thiết đặt và thử lại.",
-      "settings#transport-mode#heading": "Chế Độ Chuyển Giao",
-      "settings#transport-mode#check-label": "Dùng chế độ L2TP/IPSec",
-      "settings#transport-mode#help-text": "Dùng mạng ảo L2TP/IPSec của Windows. Chế độ này sẽ đưa tất cả ứng dụng xuyên qua Psiphon, nhưng không cung cấp việc rối mã và vì thế không có khả năng mạnh mẽ để vượt kiểm duyệt.  <strong>Đề nghị không dùng</strong> để vượt hầu hết tường lửa.",
-      "settings#systray-minimize#heading": "Thu nhỏ vào Vùng Thông Báo (Khay Hệ Thống)",
-      "settings#systray-minimize#help-text": "Nếu bật lên, khi thu nhỏ lại cửa sổ phần mềm Psiphon sẽ ẩn trong vùng thông báo (còn được gọi là \"khay hệ thống\" hay \"systray\", nằm gần đồng hồ trên thanh tác vụ của Windows).",
-      "settings#systray-minimize#reason": "Thu nhỏ Psiphon vào vùng thông báo (\"khay hệ thống\") làm trống chỗ trên thanh tác vụ. Việc này hữu ích nếu bạn thường chạy Psiphon cho một thời gian dài.",
-      "settings#systray-minimize#enable-label": "Thu nhỏ vào vùng thông báo (khay hệ thống)",
-      "settings#applying-message": "Kết nối lại để áp dụng các thiết đặt của bạn.",
-      "settings#saved-message": "Các thiết đặt đã được lưu.",
-      "settings#error-modal#title": "Lỗi thiết đặt",
-      "settings#error-modal#body": "Có lỗi trong các con số thiết đặt. Xin điều chỉnh lại trước khi tiếp tục.",
-      "feedback#top_content_title": "Gửi Phản Hồi của Bạn cho Chúng Tôi",
-      "feedback#top_para_2": "Nhiều vấn đề có thể được khắc phục bằng cách tải phiên bản mới nhất. Bạn có thể <a class=\"NewVersionURL\" href=\"#\">tải phiên bản mới nhất bằng cách nhấp vào đây</a>, hoặc bạn có thể gửi email tới <a class=\"NewVersionEmail\" href=\"#\"></a>.",
-      "feedback#top_para_3": "Bạn cũng có thể tìm thấy các giải pháp cho nhiều vấn đề thông thường trong phần <a class=\"FaqURL\" href=\"#\">Các câu hỏi thường gặp</a>.",
-      "feedback#smiley_happy": "Psiphon kết nối và làm việc đúng theo cách tôi muốn.",
-      "feedback#smiley_sad": "Psiphon thường không kết nối được hay không thực hiện đủ tốt.",
-      "feedback#text_feedback_prompt": "Vui lòng điền góp ý vào đây:",
-      "feedback#text_feedback_email_prompt": "Nếu bạn muốn chúng tôi hồi đáp cho bạn, xin vui lòng cho địa chỉ email của bạn:",
-      "feedback#diagnostic_check": "Tải dữ liệu chẩn đoán lên. Xin lưu ý là dữ liệu chẩn đoán này không nhận diện bạn và nó sẽ giúp chúng tôi làm Psiphon chạy tốt hơn <a class=\"DataCollectionInfoURL\" href=\"#\">Nhấp vào đây để thấy những dữ liệu mà chúng tôi thu thập</a>",
-      "feedback#submit_button": "Gửi",
-      "feedback#text_feedback_bottom_para": "Nếu mẫu đơn trên không dùng được, hoặc bạn muốn gửi các ảnh chụp màn hình, hãy email cho chúng tôi tại  <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
-      "feedback#success-message": "<strong>Cám ơn!</strong> Phản hồi của bạn đã được gửi đi.",
-      "logs#show-debug-label": "Xem ký sự gỡ lỗi",
-      "logs#placeholder": "Chưa có ký sự",
-      "language#success-message": "<strong>Xin chào!</strong> Chào mừng bạn đến với Psiphon.",
-      "about#wordart-tag": "Bên Kia Biên Giới",
-      "about#description": "Psiphon là một <strong>công cụ vượt thoát kiểm duyệt </strong> — Được thiết kế để giúp vào mạng Internet mở rộng, vượt qua kiểm duyệt và tường lửa. Psiphon là phần mềm <strong>nguồn mở </strong> và được phát triển tại Toronto, Canada.",
-      "about#visit-download-site": "Xin vào trang web để <strong><a class=\"NewVersionURL\" href=\"#\">tải xuống phiên bản mới</a></strong> hoặc <strong><a class=\"InfoURL\" href=\"#\">được giúp đỡ và có thông tin</a></strong>. Psiphon có các phiên bản cho hệ Android và Windows.",
-      "about#get-by-email": "Nếu trang web không truy cập được, bạn có thể nhận phiên bản mới của Psiphon bằng cách gửi email đến:",
-      "about#client-version": "Phiên bản trình Psiphon cho Windows:",
-      "general#modal-close-button": "Đóng",
-      "general#notice-modal-tech-preamble": "Đây là thông tin kỹ thuật về lỗi:",
-      "notice#systemproxysettings-setproxy-error-title": "Lỗi Proxy Hệ Thống",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon thất bại khi lập các thiết đặt proxy hệ thống.</p>\n<p>Đây có thể vì xung khắc với phần mềm chống vi-rút. Bạn cần cấu hình lại các thiết đặt của ứng dụng hoặc của proxy hệ thống để dùng proxy Psiphon địa phương.</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon thất bại khi lập các thiết đặt proxy hệ thống cho đường kết nối internet mang tên “<%- data %>”. Đây có thể vì xung khắc với phần mềm chống vi-rút. Bạn cần cấu hình lại các thiết đặt của ứng dụng hoặc của proxy hệ thống để dùng proxy Psiphon địa phương.",
-      "appbackend#state-stopped-title": "Psiphon đã ngắt kết nối",
-      "appbackend#state-starting-title": "Psiphon đang kết nối",
-      "appbackend#state-starting-body": "Xin chờ...",
-      "appbackend#state-connected-title": "Psiphon đã kết nối",
-      "appbackend#state-connected-body": "Tìm tòi bên kia biên giới!",
-      "appbackend#state-connected-reminder-title": "Psiphon giúp bạn được kết nối",
-      "appbackend#state-connected-reminder-body": "Giữ Pisphon miễn phí. Bấm vào đây để thăm trang của các nhà bảo trợ!",
-      "appbackend#state-connected-reminder-body-2": "Giữ Pisphon miễn phí bằng cách vào thăm trang của các nhà bảo trợ!",
-      "appbackend#minimized-to-systray-title": "Psiphon đã được thu nhỏ vào vùng thông báo",
-      "appbackend#minimized-to-systray-body": "Bấm vào biểu tượng để phục hồi ứng dụng",
+      "settings#upstream-proxy#error-modal-title": "Upstream Proxy Error",
+      "settings#upstream-proxy#error-modal-body-default": "Psiphon is currently configured to use your system proxy as its “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease enable “Don't use upstream proxy” and try again.",
+      "settings#upstream-proxy#error-modal-body-configured": "You have configured Psiphon to use an “upstream proxy”.<br>\nHowever, we seem to be unable to connect to a Psiphon server through that proxy.<br>\nPlease fix the settings and try again.",
+      "settings#transport-mode#heading": "Transport Mode",
+      "settings#transport-mode#check-label": "Use L2TP/IPSec mode",
+      "settings#transport-mode#help-text": "Uses Windows L2TP/IPSec virtual networking. This mode will tunnel all of your apps, but it doesn’t provide obfuscation and so does not have strong censorship circumvention capabilities. It is <strong>not recommended</strong> for bypassing most firewalls.",
+      "settings#systray-minimize#heading": "Minimize to Notification Area (System Tray)",
+      "settings#systray-minimize#help-text": "If enabled, when minimized the Psiphon application window will hide in the notification area (also known as the “system tray” or “systray”, located near the clock on your Windows task bar).",
+      "settings#systray-minimize#reason": "Minimizing Psiphon to the notification area (“system tray”) frees up space on your task bar. This is especially helpful if you often run Psiphon for long periods of time.",
+      "settings#systray-minimize#enable-label": "Minimize to the notification area (system tray)",
+      "settings#applying-message": "Reconnecting to apply your settings.",
+      "settings#saved-message": "Settings saved.",
+      "settings#error-modal#title": "Settings Error",
+      "settings#error-modal#body": "There are errors in your settings values. Please correct them before proceeding.",
+      "feedback#top_content_title": "Give Us Your Feedback",
+      "feedback#top_para_2": "Many problems can be fixed by downloading the latest version. You can <a class=\"NewVersionURL\" href=\"#\">download the latest version by clicking here</a>, or you can send an email to <a class=\"NewVersionEmail\" href=\"#\"></a>.",
+      "feedback#top_para_3": "You can also find solutions to many common problems in our <a class=\"FaqURL\" href=\"#\">Frequently Asked Questions</a>.",
+      "feedback#smiley_happy": "Psiphon connects and performs the way I want it to.",
+      "feedback#smiley_sad": "Psiphon often fails to connect or doesn't perform well enough.",
+      "feedback#text_feedback_prompt": "Please enter your comments here:",
+      "feedback#text_feedback_email_prompt": "If you would like us to respond to you, please enter your email address:",
+      "feedback#diagnostic_check": "Upload diagnostic data. Please note that this diagnostic data does not identify you, and it will help us to keep Psiphon running smoothly. <a class=\"DataCollectionInfoURL\" href=\"#\">Click here to see what data we collect.</a>",
+      "feedback#submit_button": "Submit",
+      "feedback#text_feedback_bottom_para": "If the above form is not working, or you would like to send screenshots, please email us at <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>.",
+      "feedback#success-message": "<strong>Thank you!</strong> Your feedback has been sent.",
+      "logs#show-debug-label": "Show debug logs",
+      "logs#placeholder": "No logs yet",
+      "language#success-message": "<strong>Hello!</strong> Welcome to Psiphon.",
+      "about#wordart-tag": "Beyond Borders",
+      "about#description": "Psiphon is a <strong>censorship circumvention tool</strong> — it is designed to give access to the open Internet, past censors and firewalls. It is <strong>open source</strong> and developed in Toronto, Canada.",
+      "about#visit-download-site": "Please visit the website to <strong><a class=\"NewVersionURL\" href=\"#\">download a new version</a></strong> or to <strong><a class=\"InfoURL\" href=\"#\">get help and information</a></strong>. Psiphon is available for Android and Windows.",
+      "about#get-by-email": "<strong>If the website is inaccessible</strong>, you can get a new version of Psiphon by sending an email to:",
+      "about#client-version": "Psiphon for Windows client version:",
+      "general#modal-close-button": "Close",
+      "general#notice-modal-tech-preamble": "Here is the technical error info:",
+      "notice#systemproxysettings-setproxy-error-title": "System Proxy Error",
+      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon failed to set the system’s proxy settings.</p>\n<p>This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.</p>",
+      "notice#systemproxysettings-setproxy-warning-template": "Psiphon failed to set the system’s proxy settings for the Internet connection named “<%- data %>”. This might be due to a conflict with your antivirus software. You might need to manually configure your application or system proxy settings to use the local Psiphon proxies.",
+      "appbackend#state-stopped-title": "Psiphon is disconnected",
+      "appbackend#state-starting-title": "Psiphon is connecting",
+      "appbackend#state-starting-body": "Please wait…",
+      "appbackend#state-connected-title": "Psiphon is connected",
+      "appbackend#state-connected-body": "Explore beyond your borders!",
+      "appbackend#state-connected-reminder-title": "Psiphon is keeping you connected",
+      "appbackend#state-connected-reminder-body": "Keep Psiphon free. Click here to visit our sponsor pages!",
+      "appbackend#state-connected-reminder-body-2": "Keep Psiphon free by visiting our sponsor pages!",
+      "appbackend#minimized-to-systray-title": "Psiphon has been minimized to the notification area",
+      "appbackend#minimized-to-systray-body": "Click the icon to restore the application",
       "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
       "psicash#transaction-error-title": "PsiCash transaction error",
       "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
@@ -7457,372 +208,103 @@
       "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
       "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
       "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "Được tài trợ bởi"
+      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts"
     }
   },
+  "es": {
+    "name": "Español"
+  },
+  "fa": {
+    "name": "فارسی"
+  },
+  "fa_AF": {
+    "name": "فارسی دری"
+  },
+  "fi": {
+    "name": "Suomi"
+  },
+  "fr": {
+    "name": "Français"
+  },
+  "hi": {
+    "name": "हिन्दी"
+  },
+  "hr": {
+    "name": "Hrvatski"
+  },
+  "id": {
+    "name": "Bahasa Indonesia"
+  },
+  "it": {
+    "name": "Italiano"
+  },
+  "kk": {
+    "name": "қазақ тілі"
+  },
+  "km": {
+    "name": "ភាសាខ្មែរ"
+  },
+  "ko": {
+    "name": "한국어"
+  },
+  "ky": {
+    "name": "Кыргызча"
+  },
+  "my": {
+    "name": "မြန်မာဘာသာ"
+  },
+  "nb": {
+    "name": "Norsk bokmål"
+  },
+  "nl": {
+    "name": "Nederlands"
+  },
+  "om": {
+    "name": "Afaan Oromo"
+  },
+  "pt_BR": {
+    "name": "Português (Brasil)"
+  },
+  "pt_PT": {
+    "name": "Português (Portugal)"
+  },
+  "ru": {
+    "name": "Русский"
+  },
+  "sw": {
+    "name": "Kiswahili"
+  },
+  "tg": {
+    "name": "Тоҷикӣ"
+  },
+  "th": {
+    "name": "ภาษาไทย"
+  },
+  "ti": {
+    "name": "ትግርኛ"
+  },
+  "tk": {
+    "name": "Türkmençe"
+  },
+  "tr": {
+    "name": "Türkçe"
+  },
+  "uk": {
+    "name": "Українська"
+  },
+  "ur": {
+    "name": "اُردُو"
+  },
+  "uz@Latn": {
+    "name": "O'zbekcha"
+  },
+  "vi": {
+    "name": "Tiếng Việt"
+  },
   "zh": {
-    "name": "简体中文",
-    "translation": {
-      "banner#long-connecting": "<strong>真遗憾！</strong>您似乎在连接时遇到了麻烦。<br>\n从<a class=\"NewVersionURL\" href=\"#\">下载网站</a>下载赛风的最新版本，或者向我们发邮件至 <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "正在连接",
-      "nav#connection#connected": "已连接",
-      "nav#connection#stopping": "正在中断连接",
-      "nav#connection#stopped": "已中断连接",
-      "nav#settings": "设置",
-      "nav#feedback": "反馈",
-      "nav#logs": "日志",
-      "nav#about": "关于",
-      "connection#starting-msg": "赛风<span class=\"state-word\">连接中</span>…",
-      "connection#stop-btn": "停止",
-      "connection#connected-msg": "赛风<span class=\"state-word\">已连接</span>",
-      "connection#disconnect-btn": "中断连接",
-      "connection#stopping-msg": "赛风<span class=\"state-word\">断开连接中</span>…",
-      "connection#wait-btn": "请稍候...",
-      "connection#stopped-msg": "赛风<span class=\"state-word\">连接已中断</span>",
-      "connection#connect-btn": "连接",
-      "connection#egress-region-combo-label": "选择服务器地区",
-      "settings#error-alert": "<strong>出错了！</strong>请在继续前修正错误设置值。",
-      "settings#reset-button": "重置为默认值",
-      "settings#apply-button": "应用更改",
-      "settings#unapplied-changes-prompt#title": "设置已更改",
-      "settings#unapplied-changes-prompt#body": "您更改了设置，但尚未应用之。<br><br>请问是要应用更改还是放弃？",
-      "settings#unapplied-changes-prompt#apply-button": "应用",
-      "settings#unapplied-changes-prompt#discard-button": "放弃",
-      "settings#vpn-incompatible-msg": "（不能用于 L2TP/IPSec 模式）",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "拆分隧道",
-      "settings#split-tunnel#help-text": "如果启用，发往你所在国家服务器的请求将不会经过赛风隧道。",
-      "settings#split-tunnel#reason": "您所在国家的网站通常不会被屏蔽，所以启用此选项会让您有更快速的访问这些网站，并且有可能降低ISP数据流量的费用。",
-      "settings#split-tunnel#enable-label": "不代理您所在国家内的网站",
-      "settings#disable-timeouts#heading": "网速过慢的网络禁用超时",
-      "settings#disable-timeouts#help-text": "如果启用，和赛风服务器间的连接将不会超时。",
-      "settings#disable-timeouts#reason": "当您在网速较慢时启用此选项，您网络意外断开的次数将会减少。",
-      "settings#disable-timeouts#enable-label": "慢速网络中禁用超时",
-      "settings#egress-region#heading": "赛风服务器区域",
-      "settings#egress-region#select-best-performance": "最佳性能",
-      "settings#egress-region#select-us": "美国",
-      "settings#egress-region#select-ca": "加拿大",
-      "settings#egress-region#select-gb": "英国",
-      "settings#egress-region#select-jp": "日本",
-      "settings#egress-region#select-sg": "新加坡",
-      "settings#egress-region#select-sk": "斯洛伐克",
-      "settings#egress-region#select-nl": "荷兰",
-      "settings#egress-region#select-de": "德国",
-      "settings#egress-region#select-in": "印度",
-      "settings#egress-region#select-es": "西班牙",
-      "settings#egress-region#select-hk": "香港",
-      "settings#egress-region#select-at": "奧地利",
-      "settings#egress-region#select-be": "比利时",
-      "settings#egress-region#select-bg": "保加利亚",
-      "settings#egress-region#select-ch": "瑞士",
-      "settings#egress-region#select-cz": "捷克共和国",
-      "settings#egress-region#select-dk": "丹麦",
-      "settings#egress-region#select-fr": "法国",
-      "settings#egress-region#select-hu": "匈牙利",
-      "settings#egress-region#select-it": "意大利",
-      "settings#egress-region#select-no": "挪威",
-      "settings#egress-region#select-ro": "罗马尼亚",
-      "settings#egress-region#select-se": "瑞典",
-      "settings#egress-region#select-pl": "波兰",
-      "settings#egress-region#select-rs": "塞尔维亚",
-      "settings#egress-region#select-au": "澳大利亚",
-      "settings#egress-region#description": "赛风在很多不同的国家和地区都有服务器。使用一个距离您近的赛风服务器一般来说可以提供更好的网络连接，但是您也可能想要像真的在某一个国家或地区一样使用网站和服务。",
-      "settings#egress-region#default": "选择默认<strong>“最好性能”</strong>选择可以使赛风自动选择一个最好网络连接的服务器。",
-      "settings#egress-region#invalid-error-msg": "请选择一个有效的赛风服务器区域。",
-      "settings#egress-region#error-modal-title": "服务器区域不可用",
-      "settings#egress-region#error-modal-body-http": "您设置了赛风使用在某一个地区的服务器。<br>\n但是，这个地区已经不再可用。<br>\n您现在必须选择一个新地区或者设置为默认“最好性能”选项。",
-      "settings#local-proxy-ports#heading": "本地代理端口",
-      "settings#local-proxy-ports#leave-blank": "<strong>留空</strong>以自动选择端口（推荐）。",
-      "settings#local-proxy-ports#reason": "如果您在电脑上使用了需要手动配置才能利用赛风的工具，您可能希望赛风始终使用同一个本地端口号。如果您没有特定的理由来指定端口号，您应该允许赛风自动选择端口号，这样可以避免端口冲突。",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "必须在 1 到 65535 之间。",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "本地端口必须互异。",
-      "settings#local-proxy-ports#error-modal-title": "本地代理端口冲突",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\n您已配置赛风使用指定的本地端口开启 HTTP 代理。<br>\n然而，此端口似乎已被占用，赛风无法使用之。\n</p>\n<p>\n请更改配置的 HTTP 代理端口值然后再试。我们建议您清除该值，使赛风自动挑选可用端口。\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\n您已配置赛风使用指定的本地端口开启 SOCKS 代理。<br>\n然而，此端口似乎已被占用，赛风无法使用之。\n</p>\n<p>\n请更改配置的 SOCKS 代理端口值然后再试。我们建议您清除该值，使赛风自动挑选可用端口。\n</p>",
-      "settings#upstream-proxy#heading": "上游代理",
-      "settings#upstream-proxy#by-default": "如果您的电脑已经配置了代理，默认情况下赛风将在建立隧道时使用该代理。您可以变更此行为，指定要使用的代理，或者要求不使用此类“上游代理”。",
-      "settings#upstream-proxy#reason": "有些地方如学校和企业等需要使用上游代理。如果您的网络提供者给过您上层代理的参数，请在此手动设置之以便成功连接。",
-      "settings#upstream-proxy#proxy-reqs": "只允许支持 HTTPS 的 HTTP 代理。",
-      "settings#upstream-proxy#hostname-label": "主机名称",
-      "settings#upstream-proxy#port-label": "端口",
-      "settings#upstream-proxy#username-label": "用户名",
-      "settings#upstream-proxy#password-label": "密码",
-      "settings#upstream-proxy#domain-label": "域名",
-      "settings#upstream-proxy#skip-label": "不使用上游代理",
-      "settings#upstream-proxy#set-hostname-error-msg": "您必须提供一个IP地址，或者为了让系统自动选择将所有的上游代理区域留空。",
-      "settings#upstream-proxy#set-username-error-msg": "您必须提供一个用户名如果您在设置密码或域名；或者为了没有认证将所有的认证方式区域留空。",
-      "settings#upstream-proxy#error-modal-title": "上游代理错误",
-      "settings#upstream-proxy#error-modal-body-default": "赛风当前使用您的系统代理作为其“上层代理”。<br>\n然而，我们似乎无法通过该代理连接到赛风服务器。<br>\n请启用“不使用上游代理”后再试。",
-      "settings#upstream-proxy#error-modal-body-configured": "您已配置赛风使用一个“上游代理”。<br>\n然而，我们似乎无法通过该代理连接到赛风服务器。<br>\n请修正设置后再试。",
-      "settings#transport-mode#heading": "传输模式",
-      "settings#transport-mode#check-label": "使用 L2TP/IPSec 模式",
-      "settings#transport-mode#help-text": "使用 Windows L2TP/IPSec 虚拟网络。此模式将转接您的所有应用程序，但并不提供混淆效果，因此不具有很强的规避审查能力。<strong>不推荐</strong>用它来绕过大多数防火墙。",
-      "settings#systray-minimize#heading": "最小化到通知区域（系统托盘）",
-      "settings#systray-minimize#help-text": "如果启用，在最小化赛风应用程序窗口时，其将会隐藏到通知区域（也称“系统托盘”，位于 Windows 任务栏的时钟区域旁）。",
-      "settings#systray-minimize#reason": "最小化赛风到通知区域（系统托盘）可以释放您的任务栏上的空间。这在您需要长时间运行赛风时非常有益。",
-      "settings#systray-minimize#enable-label": "最小化到通知区域（系统托盘）",
-      "settings#applying-message": "重新连接以应用您的设置。",
-      "settings#saved-message": "设置已保存。",
-      "settings#error-modal#title": "设定错误",
-      "settings#error-modal#body": "设定中有错误，请先更正再继续。",
-      "feedback#top_content_title": "向我们提供您的反馈",
-      "feedback#top_para_2": "许多问题可以通过下载赛风的最新版本解决。您可以<a class=\"NewVersionURL\" href=\"#\">点击这里下载最新版本</a>，或发送电子邮件至<a class=\"NewVersionEmail\" href=\"#\"></a>。",
-      "feedback#top_para_3": "有关许多常见问题的解决方案，请参阅<a class=\"FaqURL\" href=\"#\">常见问题与解答</a>。",
-      "feedback#smiley_happy": "赛风的连接和表现如我所愿。",
-      "feedback#smiley_sad": "赛风经常连接失败或表现不尽如人意。",
-      "feedback#text_feedback_prompt": "请在此输入您的评论：",
-      "feedback#text_feedback_email_prompt": "如果您期望我们回复，请输入您的电子邮件地址：",
-      "feedback#diagnostic_check": "上传诊断数据。请注意，这些诊断数据将帮助我们保持赛风顺畅运行，并无法识别用户。<a class=\"DataCollectionInfoURL\" href=\"#\">点击这里查看我们收集的数据。</a>",
-      "feedback#submit_button": "提交",
-      "feedback#text_feedback_bottom_para": "如果以上表格无法使用，或需发送截图，请发电子邮件至 <a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>。",
-      "feedback#success-message": "<strong>谢谢！</strong>您的反馈已经发出。",
-      "logs#show-debug-label": "显示调试日志",
-      "logs#placeholder": "尚无日志",
-      "language#success-message": "<strong>你好！</strong>欢迎使用赛风。",
-      "about#wordart-tag": "超越国界",
-      "about#description": "赛风是一个<strong>规避审查的工具</strong>——旨在提供开放的互联网访问，绕过审核与防火墙。其为<strong>开源软件</strong>，开发于加拿大多伦多。",
-      "about#visit-download-site": "请访问网站以<strong><a class=\"NewVersionURL\" href=\"#\">下载最新版本</a></strong>或者<strong><a class=\"InfoURL\" href=\"#\">获取帮助与相关信息</a></strong>。赛风在 Android 和 Windows 平台上可用。",
-      "about#get-by-email": "<strong>若网站无法访问</strong>，您可以发送邮件至如下地址以获取新版本的赛风：",
-      "about#client-version": "赛风 Windows 客户端版本：",
-      "general#modal-close-button": "关闭",
-      "general#notice-modal-tech-preamble": "这里是技术性的错误信息：",
-      "notice#systemproxysettings-setproxy-error-title": "系统代理错误",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon 更改系统的代理设置失败了。</p>\n<p>这可能是由于和您的防病毒软件冲突所致。您可能需要手动修改应用或系统的代理配置以便使用本地的 Psiphon 代理。</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon 更改名为“<%- data %>”的网络连接的系统代理设置失败了。这可能是由于和您的防病毒软件冲突所致。您可能需要手动修改应用或系统的代理配置以便使用本地的 Psiphon 代理。",
-      "appbackend#state-stopped-title": "Psiphon 已中断连接",
-      "appbackend#state-starting-title": "Psiphon 正在连接",
-      "appbackend#state-starting-body": "请稍候...",
-      "appbackend#state-connected-title": "Psiphon 已连接",
-      "appbackend#state-connected-body": "超越国界开启探索！",
-      "appbackend#state-connected-reminder-title": "赛风正保持已连接状态",
-      "appbackend#state-connected-reminder-body": "维持赛风免费。点击这里访问我们的赞助商页面！",
-      "appbackend#state-connected-reminder-body-2": "通过访问我们的赞助商页面来维持赛风免费！",
-      "appbackend#minimized-to-systray-title": "Psiphon 已最小化到通知区域",
-      "appbackend#minimized-to-systray-body": "点击图标恢复应用程序",
-      "appbackend#os-unsupported": "赛风不再支持Windows XP或者Vista。\n详情请访问赛风的网站。",
-      "psicash#transaction-error-title": "PsiCash交易错误",
-      "psicash#transaction-error-body": "您的PsiCash交易尝试意外失败",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash购买已经存在",
-      "psicash#transaction-ExistingTransaction-body": "您有一个同类型的PsiCash购买记录。当您之前的购买过期之前，同类型的购买将不会被允许。您的PsiCash状态已被刷新。",
-      "psicash#transaction-InsufficientBalance-title": "PsiCash余额不足",
-      "psicash#transaction-InsufficientBalance-body": "您没有足够的PsiCash余额可被用于这次购买。",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash购买价格不匹配",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash购买价格过期。您的PsiCash状态将会被刷新。",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash购买种类没有找到",
-      "psicash#transaction-TransactionTypeNotFound-body": "您正在尝试购买的产品已经不存在。您肯能需要更新或者重新下载软件。",
-      "psicash#transaction-InvalidTokens-title": "PsiCash代币无效",
-      "psicash#transaction-InvalidTokens-body": "您的PsiCash代币无效。您可以尝试重启软件。如果还是无效，您需要<a href=\"https://psiphon3.com/faq.html#clear-windows-data\">清理您的本地存储</a>。",
-      "psicash#transaction-ServerError-title": "PsiCash服务器错误",
-      "psicash#transaction-ServerError-body": "PsiCash服务器在尝试购买时响应错误。请稍后重新尝试购买。",
-      "psicash#ui-speedboost-active": "提&nbsp;速有效 %s",
-      "psicash#ui-zerobalance-title": "需要提&nbsp;速？",
-      "psicash#ui-buypsi": "购买PsiCash",
-      "psicash#ui-buymorepsi": "购买更多的PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "需要提&nbsp;速",
-      "psicash#ui-enoughbalance-buttontext": "开始提&nbsp;速",
-      "psicash#1-hour": "1 小时",
-      "psicash#1-day": "1 天",
-      "psicash#ui-buyingboost-buttontext": "正在提&nbsp;速中！",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "需要连接至赛风",
-      "psicash#mustconnect-modal#body": "您必须连接至赛风服务器，才能使用PsiCash",
-      "psicash#init-error-title": "PsiCash初始化错误",
-      "psicash#init-error-body-unrecovered": "PsiCash初始化失败。这有可能是文件系统的问题，例如没有足够的磁盘空间。您的余额和其他相关信息丢失。PsiCash将会不稳定。您可以通过重启软件从而修复这个问题。",
-      "psicash#init-error-body-recovered": "PsiCash初始化失败。这有可能是文件系统的问题，例如没有足够的磁盘空间。您的余额以及其他相关信息已经被重置。",
-      "psicash#psiphon-speed": "赛风<br>速度",
-      "notice#disallowed-traffic-alert-title": "升级您的赛风链接",
-      "notice#disallowed-traffic-alert-body": "<p>程序不能正常工作?</p>\n<p>有些网络流量需要加速的支持。通过PsiCash购买加速从而解锁赛风体验的全部潜能。</p>",
-      "appbackend#disallowed-traffic-notification-title": "程序不能正常工作?",
-      "appbackend#disallowed-traffic-notification-body": "激活加速从而解锁赛风体验的全部潜能。",
-      "settings#disallowed-traffic-alert#heading": "禁止流量警报",
-      "settings#disallowed-traffic-alert#help-text": "有些网络流量必须有加速服务的支持。当这样的流量被禁止时，一个警告将会弹出。（重新启用这样的流量需要重新连接。）",
-      "settings#disallowed-traffic-alert#disable-label": "禁止禁用流量警告",
-      "banner#sponsored-by": "赞助者："
-    }
+    "name": "简体中文"
   },
   "zh_TW": {
-    "name": "繁体中文",
-    "translation": {
-      "banner#long-connecting": "<strong>真遺憾！</strong>您似乎在連接時遇到了麻煩。<br>\n從<a class=\"NewVersionURL\" href=\"#\">下載網站</a>下載賽風的最新版本，或者向我們發郵件至 <a class=\"NewVersionEmail\" href=\"#\"></a>",
-      "nav#connection#starting": "正在連接",
-      "nav#connection#connected": "已連接",
-      "nav#connection#stopping": "正在中斷連接",
-      "nav#connection#stopped": "已中斷連接",
-      "nav#settings": "設定",
-      "nav#feedback": "回饋",
-      "nav#logs": "日誌",
-      "nav#about": "關於",
-      "connection#starting-msg": "賽風<span class=\"state-word\">連接中</span>…",
-      "connection#stop-btn": "停止",
-      "connection#connected-msg": "賽風<span class=\"state-word\">已連接</span>",
-      "connection#disconnect-btn": "中斷連接",
-      "connection#stopping-msg": "賽風<span class=\"state-word\">斷開連接中</span>…",
-      "connection#wait-btn": "請稍候...",
-      "connection#stopped-msg": "賽風<span class=\"state-word\">連接已中斷</span>",
-      "connection#connect-btn": "連接",
-      "connection#egress-region-combo-label": "Select server region",
-      "settings#error-alert": "<strong>出錯了！</strong>請在繼續前修正錯誤設定值。",
-      "settings#reset-button": "重置為默認值",
-      "settings#apply-button": "應用更改",
-      "settings#unapplied-changes-prompt#title": "設置已更改",
-      "settings#unapplied-changes-prompt#body": "您更改了設置，但尚未啟用之。<br><br>請問是要啟用更改還是放棄？",
-      "settings#unapplied-changes-prompt#apply-button": "應用",
-      "settings#unapplied-changes-prompt#discard-button": "放棄",
-      "settings#vpn-incompatible-msg": "（不能用於 L2TP/IPSec 模式）",
-      "settings#vpn-incompatible-label": "L2TP/IPSec",
-      "settings#split-tunnel#heading": "拆分通道",
-      "settings#split-tunnel#help-text": "If enabled, requests made to servers within your home country will not be tunneled through Psiphon.",
-      "settings#split-tunnel#reason": "Websites within your home country are generally not blocked, so enabling this option will give you faster access to those sites and can sometimes reduce ISP data usage costs.",
-      "settings#split-tunnel#enable-label": "不代理您所在國家內的網站",
-      "settings#disable-timeouts#heading": "慢速網路請取消暫停功能",
-      "settings#disable-timeouts#help-text": "如果啟動，與Psiphon 伺服器之間的通訊將不會逾時。",
-      "settings#disable-timeouts#reason": "When enabling this for a very slow network connection, you are less likely to experience unexpected disconnections.",
-      "settings#disable-timeouts#enable-label": "慢速網路請取消暫停功能",
-      "settings#egress-region#heading": "賽風伺服器區域",
-      "settings#egress-region#select-best-performance": "最佳性能",
-      "settings#egress-region#select-us": "美國",
-      "settings#egress-region#select-ca": "加拿大",
-      "settings#egress-region#select-gb": "英國",
-      "settings#egress-region#select-jp": "日本",
-      "settings#egress-region#select-sg": "新加坡",
-      "settings#egress-region#select-sk": "斯洛伐克",
-      "settings#egress-region#select-nl": "荷蘭",
-      "settings#egress-region#select-de": "德國",
-      "settings#egress-region#select-in": "印度",
-      "settings#egress-region#select-es": "西班牙",
-      "settings#egress-region#select-hk": "香港",
-      "settings#egress-region#select-at": "奧地利",
-      "settings#egress-region#select-be": "比利時",
-      "settings#egress-region#select-bg": "保加利亞",
-      "settings#egress-region#select-ch": "瑞士",
-      "settings#egress-region#select-cz": "捷克共和國",
-      "settings#egress-region#select-dk": "丹麥",
-      "settings#egress-region#select-fr": "法國",
-      "settings#egress-region#select-hu": "匈牙利",
-      "settings#egress-region#select-it": "義大利",
-      "settings#egress-region#select-no": "挪威",
-      "settings#egress-region#select-ro": "羅馬尼亞",
-      "settings#egress-region#select-se": "瑞典",
-      "settings#egress-region#select-pl": "波蘭",
-      "settings#egress-region#select-rs": "塞爾維亞",
-      "settings#egress-region#select-au": "澳洲",
-      "settings#egress-region#description": "Psiphon has servers in many different countries and regions. Using a Psiphon server in a region close to your home country will generally provide a better network connection, but you may wish to access websites and services like you are virtually in a specific country or region.",
-      "settings#egress-region#default": "Choosing the default <strong>“Best Performance”</strong> option allows Psiphon to automatically choose a server, which will generally result in the best network connection.",
-      "settings#egress-region#invalid-error-msg": "請選擇一個有效的賽風伺服器區域。",
-      "settings#egress-region#error-modal-title": "伺服器區域不可用",
-      "settings#egress-region#error-modal-body-http": "You have configured Psiphon to use a server in a specific region.<br>\nHowever, that region is no longer available.<br>\nYou must choose a new region or change to the default “Best Performance” choice.",
-      "settings#local-proxy-ports#heading": "本地代理端口",
-      "settings#local-proxy-ports#leave-blank": "<strong>留空</strong>以自動選擇端口（推薦）。",
-      "settings#local-proxy-ports#reason": "如果您在電腦上使用了需要手動配置才能利用賽風的工具，您可能希望賽風始終使用同一個本地端口號。如果您沒有特定的理由來指定端口號，您應該允許賽風自動選擇端口號，這樣可以避免端口衝突。",
-      "settings#local-proxy-ports#http-label": "HTTP/HTTPS",
-      "settings#port-value-error-msg": "必須在 1 到 65535 之間。",
-      "settings#local-proxy-ports#socks-label": "SOCKS",
-      "settings#local-proxy-ports#unique-error-msg": "本地端口必須不同。",
-      "settings#local-proxy-ports#error-modal-title": "本地代理端口衝突",
-      "settings#local-proxy-ports#error-modal-body-http": "<p>\n您已配置賽風使用指定的本地端口開啟 HTTP 代理。<br>\n然而，此端口似乎已被占用，賽風無法使用之。\n</p>\n<p>\n請更改配置的 HTTP 代理端口值然後再試。我們建議您清除該值，使賽風自動挑選可用端口。\n</p>",
-      "settings#local-proxy-ports#error-modal-body-socks": "<p>\n您已配置賽風使用指定的本地端口開啟 SOCKS 代理。<br>\n然而，此端口似乎已被占用，賽風無法使用之。\n</p>\n<p>\n請更改配置的 SOCKS 代理端口值後再再試。我們建議您清除該值，使賽風自動挑選可用端口。\n</p>",
-      "settings#upstream-proxy#heading": "上層代理",
-      "settings#upstream-proxy#by-default": "如果您的電腦已經配置了代理，默認情況下賽風將在建立通道時使用該代理。您可以變更此行為，指定要使用的代理，或者要求不使用此類“上層代理”。",
-      "settings#upstream-proxy#reason": "有些地方如學校和企業等需要使用上層代理。如果您的網路提供者給過您上層代理的參數，請在此手動設置之以便成功連接。",
-      "settings#upstream-proxy#proxy-reqs": "只允許支持 HTTPS 的 HTTP 代理。",
-      "settings#upstream-proxy#hostname-label": "主機名稱",
-      "settings#upstream-proxy#port-label": "端口",
-      "settings#upstream-proxy#username-label": "用戶名",
-      "settings#upstream-proxy#password-label": "密碼",
-      "settings#upstream-proxy#domain-label": "域名",
-      "settings#upstream-proxy#skip-label": "不使用上層代理",
-      "settings#upstream-proxy#set-hostname-error-msg": "You must provide a Hostname, or leave all Upstream Proxy fields blank for automatic selection.",
-      "settings#upstream-proxy#set-username-error-msg": "You must provide a Username if you are setting Password or Domain; or leave all authentication fields blank for no authentication.",
-      "settings#upstream-proxy#error-modal-title": "上層代理錯誤",
-      "settings#upstream-proxy#error-modal-body-default": "賽風當前使用您的系統代理作為其“上層代理”。<br>\n然而，我們似乎無法通過該代理連接到賽風伺服器。<br>\n請啟用“不使用上層代理”后再試。",
-      "settings#upstream-proxy#error-modal-body-configured": "您已配置賽風使用一個“上層代理”。<br>\n然而，我們似乎無法通過該代理連接到賽風伺服器。<br>\n請修正設置後再試。",
-      "settings#transport-mode#heading": "傳輸模式",
-      "settings#transport-mode#check-label": "使用 L2TP/IPSec 模式",
-      "settings#transport-mode#help-text": "使用 Windows L2TP/IPSec 虛擬網路。此模式將轉接您的所有應用程式，但並不提供混淆效果，因此不具有很強的規避審查能力。<strong>不推薦</strong>用它來繞過大多數防火牆。",
-      "settings#systray-minimize#heading": "最小化到通知區域（系統工作列）",
-      "settings#systray-minimize#help-text": "若啟用時最小化賽風應用程式視窗，其將會隱藏到通知區域（也稱“系統工具列”，位於 Windows 任務欄的時鐘區域旁）。",
-      "settings#systray-minimize#reason": "最小化賽風到通知區域（系統工作列）可以釋放您的任務欄上的空間。這在您需要長時間運行賽風時非常有益。",
-      "settings#systray-minimize#enable-label": "最小化到通知區域（系統工作列）",
-      "settings#applying-message": "重新連接以應用您的設置。",
-      "settings#saved-message": "設置已保存。",
-      "settings#error-modal#title": "設定錯誤",
-      "settings#error-modal#body": "設定中有錯誤，請先更正再繼續。",
-      "feedback#top_content_title": "向我們提供您的回饋意見",
-      "feedback#top_para_2": "許多問題可以通過下載賽風的最新版本解決。您可以<a class=\"NewVersionURL\" href=\"#\">點擊這裏下載最新版本</a>，或發送電子郵件至<a class=\"NewVersionEmail\" href=\"#\"></a>。",
-      "feedback#top_para_3": "您也可以在我們的<a class=\"FaqURL\" href=\"#\">常見問題</a>中找到許多常見問題的解決方案。",
-      "feedback#smiley_happy": "賽風的連接和表現如我所願。",
-      "feedback#smiley_sad": "賽風經常連接失敗或表現不盡人意。",
-      "feedback#text_feedback_prompt": "請在此輸入您的評論：",
-      "feedback#text_feedback_email_prompt": "如果您期望我們回覆，請輸入您的電子郵件地址：",
-      "feedback#diagnostic_check": "上傳診斷資料。請注意此診斷資料不會泄露您的身份，它將幫助我們保持賽風平穩運行。<a class=\"DataCollectionInfoURL\" href=\"#\">點擊這裏查看我們收集的資料。</a>",
-      "feedback#submit_button": "提交",
-      "feedback#text_feedback_bottom_para": "如果以上表單無法使用，或者你想發送截圖，請電郵至<a id=\"FeedbackEmailAddress\" href=\"mailto:feedback@psiphon.ca\">feedback@psiphon.ca</a>。",
-      "feedback#success-message": "<strong>謝謝！</strong>您的回饋已經送出。",
-      "logs#show-debug-label": "顯示調試日誌",
-      "logs#placeholder": "尚無日誌",
-      "language#success-message": "<strong>你好！</strong>歡迎使用賽風。",
-      "about#wordart-tag": "超越國界",
-      "about#description": "賽風是一個<strong>規避審查的工具</strong>——旨在提供開放的網路訪問，繞過審查與防火牆。其為<strong>開源軟件</strong>，開發於加拿大多倫多。",
-      "about#visit-download-site": "請訪問網站以<strong><a class=\"NewVersionURL\" href=\"#\">下載最新版本</a></strong>或者<strong><a class=\"InfoURL\" href=\"#\">獲取幫助與相關資訊</a></strong>。賽風在 Android 和 Windows 平台上可用。",
-      "about#get-by-email": "<strong>若網站無法訪問</strong>，您可以發送郵件至如下地址以獲取新版本的賽風：",
-      "about#client-version": "賽風 Windows 客戶端版本：",
-      "general#modal-close-button": "關閉",
-      "general#notice-modal-tech-preamble": "這里是技術性的錯誤信息：",
-      "notice#systemproxysettings-setproxy-error-title": "系統代理錯誤",
-      "notice#systemproxysettings-setproxy-error-body": "<p>Psiphon 更改系統的代理設置失敗了。</p>\n<p>這可能是由於和您的防病毒軟件衝突所致。您可能需要手動修改應用或系統的代理配置以便使用本地的 Psiphon 代理。</p>",
-      "notice#systemproxysettings-setproxy-warning-template": "Psiphon 更改名為“<%- data %>”的網路連接的系統代理設置失敗了。這可能是由於和您的防病毒軟件衝突所致。您可能需要手動修改應用或系統的代理配置以便使用本地的 Psiphon 代理。",
-      "appbackend#state-stopped-title": "Psiphon 已中斷連接",
-      "appbackend#state-starting-title": "Psiphon 正在連接",
-      "appbackend#state-starting-body": "請稍候...",
-      "appbackend#state-connected-title": "Psiphon 已連接",
-      "appbackend#state-connected-body": "探索邊界外面的世界！",
-      "appbackend#state-connected-reminder-title": "賽風可保持連線",
-      "appbackend#state-connected-reminder-body": "維持免費賽風，請點閱此處來訪問贊助者頁面！",
-      "appbackend#state-connected-reminder-body-2": "透過訪問點擊贊助者頁面來維持免費的賽風。",
-      "appbackend#minimized-to-systray-title": "Psiphon 已最小化到通知區域",
-      "appbackend#minimized-to-systray-body": "點擊圖標恢復應用程式",
-      "appbackend#os-unsupported": "Psiphon no longer supports Windows XP or Vista.\nPlease visit our website for more information.",
-      "psicash#transaction-error-title": "PsiCash transaction error",
-      "psicash#transaction-error-body": "Your PsiCash transaction attempt failed unexpectedly.",
-      "psicash#transaction-ExistingTransaction-title": "PsiCash purchase already exists",
-      "psicash#transaction-ExistingTransaction-body": "You have an existing PsiCash purchase of this type. Another purchase of this type is not allowed until the previous one expires. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-InsufficientBalance-title": "PsiCash餘額不足",
-      "psicash#transaction-InsufficientBalance-body": "You do not have sufficient PsiCash balance for this purchase.",
-      "psicash#transaction-TransactionAmountMismatch-title": "PsiCash purchase price mismatch",
-      "psicash#transaction-TransactionAmountMismatch-body": "PsiCash purchase prices are out-of-date. Your PsiCash state will be refreshed now.",
-      "psicash#transaction-TransactionTypeNotFound-title": "PsiCash purchase type not found",
-      "psicash#transaction-TransactionTypeNotFound-body": "The product you are trying to buy no longer exists. You may need to update or reinstall the application.",
-      "psicash#transaction-InvalidTokens-title": "Invalid PsiCash tokens",
-      "psicash#transaction-InvalidTokens-body": "Your PsiCash tokens are invalid. Try restarting the application. If that doesn't work, you will need to <a href=\"https://psiphon3.com/faq.html#clear-windows-data\">clear your local storage</a>.",
-      "psicash#transaction-ServerError-title": "PsiCash 服務器錯誤",
-      "psicash#transaction-ServerError-body": "The PsiCash server responded with an error while trying to make the purchase. Please retry your purchase later.",
-      "psicash#ui-speedboost-active": "Speed&nbsp;Boost active for %s",
-      "psicash#ui-zerobalance-title": "Need a Speed&nbsp;Boost?",
-      "psicash#ui-buypsi": "Buy PsiCash",
-      "psicash#ui-buymorepsi": "Buy more PsiCash",
-      "psicash#ui-nsfbalance-buttontext": "Needed for Speed&nbsp;Boost",
-      "psicash#ui-enoughbalance-buttontext": "Start Speed&nbsp;Boost",
-      "psicash#1-hour": "1 小時",
-      "psicash#1-day": "1 天",
-      "psicash#ui-buyingboost-buttontext": "Starting Speed&nbsp;Boost!",
-      "positive-value-indicator": "+%d",
-      "psicash#mustconnect-modal#title": "Psiphon Connection Required",
-      "psicash#mustconnect-modal#body": "In order to use PsiCash, you must be connected to the Psiphon network.",
-      "psicash#init-error-title": "PsiCash initialization error",
-      "psicash#init-error-body-unrecovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been lost. PsiCash will not be usable. You can try restarting the application to recover from the problem.",
-      "psicash#init-error-body-recovered": "PsiCash failed to initialize. This is probably due to a file system problem, such as being out of disk space. Your balance and other state have been reset.",
-      "psicash#psiphon-speed": "Psiphon<br>Speed",
-      "notice#disallowed-traffic-alert-title": "Upgrade your Psiphon connection",
-      "notice#disallowed-traffic-alert-body": "<p>Apps not working?</p>\n<p>Some internet traffic is not supported without an active Speed Boost. Activate Speed Boost with PsiCash to unlock the full potential of your Psiphon experience.</p>",
-      "appbackend#disallowed-traffic-notification-title": "Apps not working?",
-      "appbackend#disallowed-traffic-notification-body": "Activate Speed Boost to unlock the full potential of your Psiphon experience.",
-      "settings#disallowed-traffic-alert#heading": "Disallowed Traffic Alert",
-      "settings#disallowed-traffic-alert#help-text": "Some types of internet traffic are not supported without an active Speed Boost. When such traffic is disallowed, an alert is shown. (Re-enabling will require a reconnection.)",
-      "settings#disallowed-traffic-alert#disable-label": "Disable disallowed traffic alerts",
-      "banner#sponsored-by": "贊助者："
-    }
+    "name": "繁体中文"
   }
 };
\ No newline at end of file
@@ -34,6 +34,10 @@
   // Fired on the window when the connected state changes
   var CONNECTED_STATE_CHANGE_EVENT = 'connected-state-change';
 
+  // Fired on the window when there are new tunnel metrics (transfer rates,
+  // tunnel count, errors), with the metrics object as the event argument.
+  var TUNNEL_METRICS_EVENT = 'tunnel-metrics';
+
   // We often test in-browser and need to behave a bit differently
   var IS_BROWSER = true;
 
@@ -521,6 +525,10 @@
   var SETTING_CHANGED_EVENT = 'setting-changed';
 
   var BEST_REGION_VALUE = 'BEST';
+  // Unlike "best performance", which leaves the choice to the server, this
+  // is resolved by the client to the available region that has measured
+  // fastest (and is saved as it is).
+  var FASTEST_REGION_VALUE = 'FASTEST';
 
   $(function settingsInit() {
     // This is merely to help with testing
@@ -1058,7 +1066,7 @@
         return;
       }
 
-      if (_.includes(regions, elemRegion) || elemRegion === BEST_REGION_VALUE) {
+      if (_.includes(regions, elemRegion) || elemRegion === BEST_REGION_VALUE || elemRegion === FASTEST_REGION_VALUE) {
         $(this).removeClass('hidden');
       }
       else {
@@ -1073,6 +1081,35 @@
     $('#EgressRegion').trigger('change');
   }
 
+  // Show how each region has performed next to its name in the region lists.
+  // `stats` is keyed by region, as in the EgressRegionStats notice; regions
+  // with no known latency show nothing.
+  function updateEgressRegionStats(stats) {
+    $('#EgressRegion li, #EgressRegionCombo li').each(function() {
+      var region = $(this).data('region');
+
+      // If no region, this is a divider
+      if (!region) {
+        return;
+      }
+
+      var regionStats = stats[region];
+      var $stats = $(this).find('.egress-region-stats');
+
+      if (!regionStats || _.isUndefined(regionStats.latency)) {
+        $stats.remove();
+        return;
+      }
+
+      if ($stats.length === 0) {
+        $stats = $('<small class="egress-region-stats muted"></small>').appendTo($(this).find('a'));
+      }
+
+      $stats.text(' ' + regionStats.latency + ' ms')
+            .attr('title', Math.round(regionStats.successRate * 100) + '%');
+    });
+  }
+
   //
   // Local Proxy Ports
   //
@@ -1497,6 +1534,26 @@
 
   /* LOGS **********************************************************************/
 
+  // In the app, the log entries are kept by the application, and only the ones
+  // being shown -- a window of LOG_WINDOW_SIZE, newest first, starting `offset`
+  // entries back from the newest -- are in the DOM. A DOM that grew over the
+  // session would slow the page down more and more.
+  // In-browser there's no store, so entries are added to the DOM directly.
+  var LOG_WINDOW_SIZE = 100;
+  // How far the window moves when it's scrolled to one of its ends
+  var LOG_WINDOW_STEP = 50;
+  // How close to an end of the window counts as at it, in pixels
+  var LOG_WINDOW_SCROLL_MARGIN = 50;
+  var g_logWindow = {
+    offset: 0,
+    // Entries in the store, not counting debug ones unless they're shown
+    total: 0,
+    // A request is outstanding
+    pending: false,
+    // There are newer entries than the window has
+    stale: false
+  };
+
   $(function() {
     $('#show-debug-logs').click(showDebugLogsClicked);
 
@@ -1505,6 +1562,13 @@
     $('.log-messages')
       .toggleClass('showing-priority-0', show)
       .toggleClass('hiding-priority-0', !show);
+
+    $('#logs-pane').on('scroll', _.throttle(logsScrolled, 100));
+    $('a[href="#logs-pane"][data-toggle="tab"]').on('shown', function() {
+      if (g_logWindow.stale) {
+        requestLogWindow(g_logWindow.offset);
+      }
+    });
   });
 
   function showDebugLogsClicked() {
@@ -1514,10 +1578,118 @@
     $('.log-messages')
       .toggleClass('showing-priority-0', show)
       .toggleClass('hiding-priority-0', !show);
+
+    // The store does the filtering, so the window starts over.
+    if (!IS_BROWSER) {
+      requestLogWindow(0);
+    }
+  }
+
+  function requestLogWindow(offset) {
+    g_logWindow.pending = true;
+    g_logWindow.stale = false;
+    HtmlCtrlInterface_GetLogs({
+      offset: offset,
+      count: LOG_WINDOW_SIZE,
+      debug: $('#show-debug-logs').prop('checked')
+    });
+  }
+
+  function logsScrolled() {
+    if (g_logWindow.pending) {
+      return;
+    }
+
+    var $pane = $('#logs-pane');
+    var scrollTop = $pane.scrollTop();
+    if (scrollTop + $pane.innerHeight() >= $pane.prop('scrollHeight') - LOG_WINDOW_SCROLL_MARGIN &&
+        g_logWindow.offset + LOG_WINDOW_SIZE < g_logWindow.total) {
+      requestLogWindow(g_logWindow.offset + LOG_WINDOW_STEP);
+    }
+    else if (scrollTop < LOG_WINDOW_SCROLL_MARGIN && g_logWindow.offset > 0) {
+      requestLogWindow(Math.max(0, g_logWindow.offset - LOG_WINDOW_STEP));
+    }
+  }
+
+  function rowsHeight($rows) {
+    var height = 0;
+    $rows.each(function() {
+      height += $(this).outerHeight();
+    });
+    return height;
+  }
+
+  // Replaces the rows shown with logWindow.entries, keeping what was being
+  // looked at in place as the window moves.
+  function showLogWindow(logWindow) {
+    // The "Show Debug Logs" checkbox is hidden until there's a debug message.
+    if (logWindow.debugTotal > 0) {
+      $('#logs-pane .invisible').removeClass('invisible');
+    }
+
+    var $pane = $('#logs-pane');
+    var delta = logWindow.offset - g_logWindow.offset;
+    var removedHeight = 0;
+    if (delta > 0) {
+      removedHeight = rowsHeight($('.log-messages tr').not('.placeholder').slice(0, delta));
+    }
+
+    $('.log-messages tr').not('.placeholder').remove();
+    $('.log-messages .placeholder').toggleClass('hidden', logWindow.entries.length > 0);
+
+    var rows = _.map(logWindow.entries, function(entry) {
+      return {
+        timestamp: new Date(entry.timestamp).toLocaleTimeString(),
+        message: entry.message,
+        priority: 'priority-' + entry.priority
+      };
+    });
+    $('.log-messages').loadTemplate($('#log-template'), rows, {append: true});
+
+    var addedHeight = 0;
+    if (delta < 0) {
+      addedHeight = rowsHeight($('.log-messages tr').not('.placeholder').slice(0, -delta));
+    }
+    if (delta !== 0) {
+      $pane.scrollTop($pane.scrollTop() - removedHeight + addedHeight);
+    }
+
+    g_logWindow.offset = logWindow.offset;
+    g_logWindow.total = logWindow.total;
+  }
+
+  // The store has new entries; counts are as for HtmlCtrlInterface_LogsChanged.
+  function logsChanged(counts) {
+    if (counts.debugTotal > 0) {
+      $('#logs-pane .invisible').removeClass('invisible');
+    }
+
+    var total = $('#show-debug-logs').prop('checked') ? counts.total : counts.total - counts.debugTotal;
+
+    if (g_logWindow.offset > 0) {
+      // Looking further back: the new entries go in front, and what's being
+      // looked at stays where it is.
+      g_logWindow.offset += Math.max(0, total - g_logWindow.total);
+      g_logWindow.total = total;
+      return;
+    }
+
+    g_logWindow.total = total;
+    if (g_logWindow.pending || !$('#logs-pane').hasClass('active')) {
+      g_logWindow.stale = true;
+      return;
+    }
+    requestLogWindow(0);
   }
 
   // Expects obj to be of the form {priority: 0|1|2, message: string}
   function addLog(obj) {
+    if (!IS_BROWSER) {
+      // It comes back with the next window.
+      HtmlCtrlInterface_StoreLog(obj);
+      return;
+    }
+
     $('.log-messages .placeholder').remove();
 
     $('.log-messages').loadTemplate(
@@ -1625,7 +1797,43 @@
   // Other functions may need to know if we're currently using a RTL locale or not
   var g_isRTL = false;
 
+  // Only the fallback locale's translation is in the page; the others are
+  // separate files (resources, in the app), loaded when first used.
+  // `callback` is called once the locale is ready, or has failed to load (in
+  // which case the fallback will be used).
+  function loadLocale(locale, callback) {
+    var localeObj = window.PSIPHON.LOCALES[locale];
+    if (!localeObj || localeObj.translation) {
+      callback();
+      return;
+    }
+
+    var script = document.createElement('script');
+    var done = false;
+    // Old IE only has onreadystatechange.
+    script.onload = script.onerror = script.onreadystatechange = function() {
+      if (done || (script.readyState && !/loaded|complete/.test(script.readyState))) {
+        return;
+      }
+      done = true;
+      script.onload = script.onerror = script.onreadystatechange = null;
+
+      if (localeObj.translation) {
+        i18n.addResourceBundle(locale, 'translation', localeObj.translation);
+      }
+      callback();
+    };
+    script.src = (IS_BROWSER ? 'dist/' : '') + 'locale-' + locale + '.js';
+    document.getElementsByTagName('head')[0].appendChild(script);
+  }
+
   function switchLocale(locale, initial) {
+    loadLocale(locale, function() {
+      applyLocale(locale, initial);
+    });
+  }
+
+  function applyLocale(locale, initial) {
     i18n.setLng(locale, function() {
       // This callback does not seem to called asynchronously (probably because
       // we're loading from an object and not a remote resource). But we want this
@@ -3569,6 +3777,43 @@
     });
   }
 
+  // Add a batch of new status messages, as an array of what
+  // HtmlCtrlInterface_AddLog takes.
+  function HtmlCtrlInterface_AddLogs(jsonArgs) {
+    nextTick(function() {
+      // Allow object as input to assist with debugging
+      const logs = _.isObject(jsonArgs) ? jsonArgs : JSON.parse(jsonArgs);
+      for (let i = 0; i < logs.length; i++) {
+        addLog(logs[i]);
+      }
+    });
+  }
+
+  // The application's log store has new entries. Of the form
+  // {total: number, debugTotal: number}.
+  function HtmlCtrlInterface_LogsChanged(jsonArgs) {
+    nextTick(function() {
+      // Allow object as input to assist with debugging
+      logsChanged(_.isObject(jsonArgs) ? jsonArgs : JSON.parse(jsonArgs));
+    });
+  }
+
+  // The log entries asked for with HtmlCtrlInterface_GetLogs. Of the form
+  // {offset: number, total: number, debugTotal: number,
+  //  entries: [{priority: 0|1|2, message: string, timestamp: ms}, ...]},
+  // newest first.
+  function HtmlCtrlInterface_SetLogs(jsonArgs) {
+    nextTick(function() {
+      // Allow object as input to assist with debugging
+      const logWindow = _.isObject(jsonArgs) ? jsonArgs : JSON.parse(jsonArgs);
+      g_logWindow.pending = false;
+      showLogWindow(logWindow);
+      if (g_logWindow.stale && $('#logs-pane').hasClass('active')) {
+        requestLogWindow(g_logWindow.offset);
+      }
+    });
+  }
+
   // Add new notice. This may be interpreted and acted upon.
   function HtmlCtrlInterface_AddNotice(jsonArgs) {
     nextTick(function() {
@@ -3587,6 +3832,9 @@
         // Update the UI.
         updateAvailableEgressRegions(true);
       }
+      else if (args.noticeType === 'EgressRegionStats') {
+        updateEgressRegionStats(args.data.regions);
+      }
       else if (args.noticeType === 'ServerAlert') {
         if (args.data.reason === 'disallowed-traffic') {
           handleDisallowedTrafficNotice();
@@ -3617,6 +3865,19 @@
     });
   }
 
+  // The latest tunnel metrics; see TunnelMetrics::Sample for the fields.
+  var g_lastTunnelMetrics = null;
+
+  // Update the live tunnel metrics. Called about once a second while they're
+  // changing.
+  function HtmlCtrlInterface_UpdateMetrics(jsonArgs) {
+    nextTick(function() {
+      // Allow object as input to assist with debugging
+      g_lastTunnelMetrics = _.isObject(jsonArgs) ? jsonArgs : JSON.parse(jsonArgs);
+      $window.trigger(TUNNEL_METRICS_EVENT, [g_lastTunnelMetrics]);
+    });
+  }
+
   // Set the connected state.
   // We will de-bounce the state change messages.
   let g_timeoutSetState = null;
@@ -3830,6 +4091,34 @@
     });
   }
 
+  // Ask for a window of log entries: {offset, count, debug}. The result comes
+  // back through HtmlCtrlInterface_SetLogs.
+  function HtmlCtrlInterface_GetLogs(request) {
+    nextTick(function() {
+      var appURL = PSIPHON_LINK_PREFIX + 'getlogs?' + encodeURIComponent(JSON.stringify(request));
+      if (IS_BROWSER) {
+        console.log(decodeURIComponent(appURL));
+      }
+      else {
+        window.location = appURL;
+      }
+    });
+  }
+
+  // Add a log entry made by the page to the application's log store. Of the
+  // form {priority: 0|1|2, message: string}.
+  function HtmlCtrlInterface_StoreLog(obj) {
+    nextTick(function() {
+      var appURL = PSIPHON_LINK_PREFIX + 'addlog?' + encodeURIComponent(JSON.stringify(obj));
+      if (IS_BROWSER) {
+        console.log(decodeURIComponent(appURL));
+      }
+      else {
+        window.location = appURL;
+      }
+    });
+  }
+
   // Settings should be saved.
   function HtmlCtrlInterface_SaveSettings(settingsJSON) {
     nextTick(function() {
@@ -3957,8 +4246,12 @@
   // so we'll need to directly expose our exports.
 
   window.HtmlCtrlInterface_AddLog = HtmlCtrlInterface_AddLog; // @ts-ignore
+  window.HtmlCtrlInterface_AddLogs = HtmlCtrlInterface_AddLogs;
+  window.HtmlCtrlInterface_LogsChanged = HtmlCtrlInterface_LogsChanged;
+  window.HtmlCtrlInterface_SetLogs = HtmlCtrlInterface_SetLogs;
   window.HtmlCtrlInterface_SetState = HtmlCtrlInterface_SetState;
   window.HtmlCtrlInterface_AddNotice = HtmlCtrlInterface_AddNotice;
+  window.HtmlCtrlInterface_UpdateMetrics = HtmlCtrlInterface_UpdateMetrics;
   window.HtmlCtrlInterface_RefreshSettings = HtmlCtrlInterface_RefreshSettings;
   window.HtmlCtrlInterface_UpdateDpiScaling = HtmlCtrlInterface_UpdateDpiScaling;
   window.HtmlCtrlInterface_PsiCashMessage = HtmlCtrlInterface_PsiCashMessage;
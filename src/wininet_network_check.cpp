@@ -27,12 +27,26 @@ file that does not use the precompiled header in order to make Wininet calls.
 #include "wininet_network_check.h"
 
 
+// The flags, or -1 if not known. The flags are all the info there is, so
+// no lock is needed.
+static volatile LONG g_connectedFlags = -1;
+
+void InvalidateWininetNetworkInfo()
+{
+    InterlockedExchange(&g_connectedFlags, -1);
+}
+
 bool WininetGetNetworkInfo(WininetNetworkInfo& netInfo)
 {
-    DWORD dwInternetConnectedFlags = 0;
-    if (!InternetGetConnectedState(&dwInternetConnectedFlags, 0))
+    DWORD dwInternetConnectedFlags = (DWORD)InterlockedCompareExchange(&g_connectedFlags, -1, -1);
+    if (dwInternetConnectedFlags == (DWORD)-1)
     {
-        return false;
+        dwInternetConnectedFlags = 0;
+        if (!InternetGetConnectedState(&dwInternetConnectedFlags, 0))
+        {
+            return false;
+        }
+        InterlockedExchange(&g_connectedFlags, (LONG)dwInternetConnectedFlags);
     }
 
     netInfo.internetConnectionConfigured = !!(dwInternetConnectedFlags & INTERNET_CONNECTION_CONFIGURED);
@@ -28,4 +28,8 @@ struct WininetNetworkInfo {
     bool internetRASInstalled;
 };
 
+// The answer is cached until InvalidateWininetNetworkInfo is called (via
+// InvalidateHostEnvironment), as it only changes with the network.
 bool WininetGetNetworkInfo(WininetNetworkInfo& netInfo);
+
+void InvalidateWininetNetworkInfo();
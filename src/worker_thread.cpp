@@ -24,6 +24,10 @@
 #include "psiclient.h"
 #include "stopsignal.h"
 
+
+// How long without activity before IdleAwareInterval stretches the interval
+#define WORKER_THREAD_IDLE_AFTER_MS     30000
+
 /*****************
  * WorkerThreadStopSignal
  *****************/
@@ -50,7 +54,8 @@ private:
 WorkerThreadStopSignal::WorkerThreadStopSignal(
                             StopSignal* parentStopSignal, 
                             const bool& additionalStopFlag)
-    : m_parentStopSignal(parentStopSignal),
+    : StopSignal(parentStopSignal, STOP_REASON_ALL),
+      m_parentStopSignal(parentStopSignal),
       m_additionalStopFlag(additionalStopFlag)
 {
 }
@@ -100,7 +105,13 @@ IWorkerThread::IWorkerThread()
                         TRUE,  // initial state should be SET
                         0);
 
-    if (m_startedEvent == NULL || m_stoppedEvent == NULL)
+    m_internalStopEvent = CreateEvent(
+                            NULL,
+                            TRUE,  // manual reset
+                            FALSE, // initial state
+                            0);
+
+    if (m_startedEvent == NULL || m_stoppedEvent == NULL || m_internalStopEvent == NULL)
     {
         throw std::exception(__FUNCTION__ ":" STRINGIZE(__LINE__) " CreateEvent failed");
     }
@@ -119,6 +130,7 @@ IWorkerThread::~IWorkerThread()
 
     CloseHandle(m_startedEvent);
     CloseHandle(m_stoppedEvent);
+    CloseHandle(m_internalStopEvent);
 }
 
 HANDLE IWorkerThread::GetStoppedEvent() const
@@ -134,6 +146,7 @@ bool IWorkerThread::Start(
 
     ResetEvent(m_startedEvent);
     ResetEvent(m_stoppedEvent);
+    ResetEvent(m_internalStopEvent);
     
     m_internalSignalStopFlag = false;
     m_workerThreadSynch = workerThreadSynch;
@@ -192,6 +205,7 @@ bool IWorkerThread::Start(
 void IWorkerThread::Stop()
 {
     m_internalSignalStopFlag = true;
+    SetEvent(m_internalStopEvent);
 
     if (m_thread != INVALID_HANDLE_VALUE && m_thread != 0)
     {
@@ -214,6 +228,55 @@ bool IWorkerThread::IsRunning() const
     return started && !stopped;
 }
 
+void IWorkerThread::WaitForEvents(const vector<HANDLE>& handles, DWORD timeoutMilliseconds)
+{
+    vector<HANDLE> waitHandles(handles);
+
+    waitHandles.push_back(m_internalStopEvent);
+
+    // Only set for the stop reasons this thread cares about, so a wake is a
+    // real stop. (The internal stop flag has its own event, above.) An event
+    // that's already set is left out all the same, so that a stop the caller
+    // doesn't act on can't turn the loop into a busy-wait.
+    HANDLE stopEvent = m_stopInfo.stopSignal ? m_stopInfo.stopSignal->GetStopEvent(m_stopInfo.stopReasons) : NULL;
+    if (stopEvent && WaitForSingleObject(stopEvent, 0) == WAIT_TIMEOUT)
+    {
+        waitHandles.push_back(stopEvent);
+    }
+
+    HANDLE synchEvent = m_workerThreadSynch ? m_workerThreadSynch->GetThreadStoppingEvent() : NULL;
+    if (synchEvent && WaitForSingleObject(synchEvent, 0) == WAIT_TIMEOUT)
+    {
+        waitHandles.push_back(synchEvent);
+    }
+
+    DWORD waitReturn = WaitForMultipleObjects(
+                            waitHandles.size(),
+                            &waitHandles[0],
+                            FALSE, // wait for any event
+                            timeoutMilliseconds);
+
+    if (waitReturn == WAIT_FAILED)
+    {
+        // Not fatal: the caller re-checks its state. Don't let a bad handle
+        // turn the loop into a busy-wait.
+        my_print(NOT_SENSITIVE, true, _T("%S::%s: WaitForMultipleObjects failed (%d)"), typeid(*this).name(), __TFUNCTION__, GetLastError());
+        Sleep(timeoutMilliseconds);
+    }
+}
+
+// static
+DWORD IWorkerThread::IdleAwareInterval(
+                        DWORD lastActivityTime,
+                        DWORD activeIntervalMilliseconds,
+                        DWORD idleIntervalMilliseconds)
+{
+    // Unsigned subtraction, so GetTickCount wrapping doesn't matter
+    return (GetTickCount() - lastActivityTime >= WORKER_THREAD_IDLE_AFTER_MS)
+            ? idleIntervalMilliseconds
+            : activeIntervalMilliseconds;
+}
+
 // static
 DWORD WINAPI IWorkerThread::Thread(void* object)
 {
@@ -222,6 +285,8 @@ DWORD WINAPI IWorkerThread::Thread(void* object)
     unsigned int tid = GetCurrentThreadId();
     srand((unsigned)time(0) + tid);
 
+    ThreadQoSScope qos(_this->GetThreadQoS());
+
     // See the comments in the WorkerThreadSynch code below for info about the
     // thread synchronization.
 
@@ -248,9 +313,15 @@ DWORD WINAPI IWorkerThread::Thread(void* object)
             SetEvent(_this->m_startedEvent);
         }    
     
+        vector<HANDLE> waitHandles;
+
         while (success)
         {
-            Sleep(100);
+            // Wakes immediately for a stop or for any of the implementation's
+            // handles (child process exit, pipe I/O, etc.)
+            waitHandles.clear();
+            _this->GetWaitHandles(waitHandles);
+            _this->WaitForEvents(waitHandles, _this->GetPeriodicCheckInterval());
 
             if (_this->m_stopInfo.stopSignal->CheckSignal(_this->m_stopInfo.stopReasons, false)
                 || (_this->m_workerThreadSynch && _this->m_workerThreadSynch->IsThreadStopping()))
@@ -326,33 +397,59 @@ With respect to synchronization between worker threads, this is the flow:
 
 WorkerThreadSynch::WorkerThreadSynch()
 {
-    m_mutex = CreateMutex(NULL, FALSE, 0);
+    // All manual reset, initially unset. Changes to the counters and to these
+    // events are made together under m_lock.
+    m_threadStoppingEvent = CreateEvent(NULL, TRUE, FALSE, 0);
+    m_allThreadsStoppingEvent = CreateEvent(NULL, TRUE, FALSE, 0);
+    m_allThreadsReadyToStopEvent = CreateEvent(NULL, TRUE, FALSE, 0);
+
+    if (m_threadStoppingEvent == NULL
+        || m_allThreadsStoppingEvent == NULL
+        || m_allThreadsReadyToStopEvent == NULL)
+    {
+        throw std::exception(__FUNCTION__ ":" STRINGIZE(__LINE__) " CreateEvent failed");
+    }
+
     Reset();
 }
 
 WorkerThreadSynch::~WorkerThreadSynch()
 {
-    CloseHandle(m_mutex);
+    CloseHandle(m_allThreadsReadyToStopEvent);
+    CloseHandle(m_allThreadsStoppingEvent);
+    CloseHandle(m_threadStoppingEvent);
 }
 
 void WorkerThreadSynch::Reset()
 {
+    AutoLock lock(m_lock);
     m_threadsStartedCounter = 0;
     m_threadsReadyToStopCounter = 0;
     m_threadCleanStops.clear();
+    ResetEvent(m_threadStoppingEvent);
+    ResetEvent(m_allThreadsStoppingEvent);
+    ResetEvent(m_allThreadsReadyToStopEvent);
 }
 
 void WorkerThreadSynch::ThreadStarting()
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
     m_threadsStartedCounter++;
 }
 
 void WorkerThreadSynch::ThreadStoppingCleanly(bool clean)
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
     assert(m_threadCleanStops.size() < m_threadsStartedCounter);
     m_threadCleanStops.push_back(clean);
+
+    SetEvent(m_threadStoppingEvent);
+
+    // An unclean stop releases the waiters early; see BlockUntil_AllThreadsStoppingCleanly
+    if (!clean || m_threadCleanStops.size() == m_threadsStartedCounter)
+    {
+        SetEvent(m_allThreadsStoppingEvent);
+    }
 }
 
 bool WorkerThreadSynch::IsThreadStopping() const
@@ -360,15 +457,20 @@ bool WorkerThreadSynch::IsThreadStopping() const
     return m_threadCleanStops.size() > 0;
 }
 
+HANDLE WorkerThreadSynch::GetThreadStoppingEvent() const
+{
+    return m_threadStoppingEvent;
+}
+
 // Does an early return if there's a single unclean stop indicated.
 bool WorkerThreadSynch::BlockUntil_AllThreadsStoppingCleanly()
 {
     bool allThreadsReporting = false;
     while (!allThreadsReporting)
     {
-        // Keep the mutex lock in a different scope than the sleep.
+        // Keep the lock in a different scope than the wait.
         {
-            AutoMUTEX lock(m_mutex);
+            AutoLock lock(m_lock);
             allThreadsReporting = 
                 (m_threadCleanStops.size() == m_threadsStartedCounter);
 
@@ -380,9 +482,12 @@ bool WorkerThreadSynch::BlockUntil_AllThreadsStoppingCleanly()
                     return false;
                 }
             }
+
+            // Another thread may have started since the event was set
+            if (!allThreadsReporting) ResetEvent(m_allThreadsStoppingEvent);
         }
 
-        if (!allThreadsReporting) Sleep(100);
+        if (!allThreadsReporting) (void)WaitForSingleObject(m_allThreadsStoppingEvent, INFINITE);
     }
 
     return true;
@@ -390,9 +495,14 @@ bool WorkerThreadSynch::BlockUntil_AllThreadsStoppingCleanly()
 
 void WorkerThreadSynch::ThreadReadyForStop()
 {
-    AutoMUTEX lock(m_mutex);
+    AutoLock lock(m_lock);
     assert(m_threadsReadyToStopCounter < m_threadsStartedCounter);
     m_threadsReadyToStopCounter++;
+
+    if (m_threadsReadyToStopCounter == m_threadsStartedCounter)
+    {
+        SetEvent(m_allThreadsReadyToStopEvent);
+    }
 }
 
 void WorkerThreadSynch::BlockUntil_AllThreadsReadyToStop()
@@ -400,16 +510,19 @@ void WorkerThreadSynch::BlockUntil_AllThreadsReadyToStop()
     bool allThreadsReporting = false;
     while (!allThreadsReporting)
     {
-        // Keep the mutex lock in a different scope than the sleep.
+        // Keep the lock in a different scope than the wait.
         {
-            AutoMUTEX lock(m_mutex);
+            AutoLock lock(m_lock);
             allThreadsReporting = 
                 (m_threadsReadyToStopCounter == m_threadsStartedCounter);
+
+            // Another thread may have started since the event was set
+            if (!allThreadsReporting) ResetEvent(m_allThreadsReadyToStopEvent);
         }
 
         if (!allThreadsReporting)
         {
-            Sleep(100);
+            (void)WaitForSingleObject(m_allThreadsReadyToStopEvent, INFINITE);
         }
     }
 
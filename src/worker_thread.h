@@ -20,6 +20,7 @@
 #pragma once
 
 #include "stopsignal.h"
+#include "thread_pool.h"
 
 
 class WorkerThreadSynch
@@ -37,13 +38,18 @@ protected:
     
     void ThreadStoppingCleanly(bool clean);
     bool IsThreadStopping() const;
+    // Set once any thread has indicated that it's stopping.
+    HANDLE GetThreadStoppingEvent() const;
     bool BlockUntil_AllThreadsStoppingCleanly();
 
     void ThreadReadyForStop();
     void BlockUntil_AllThreadsReadyToStop();
 
 private:
-    HANDLE m_mutex;
+    Lock m_lock;
+    HANDLE m_threadStoppingEvent;
+    HANDLE m_allThreadsStoppingEvent;
+    HANDLE m_allThreadsReadyToStopEvent;
     unsigned int m_threadsStartedCounter;
     unsigned int m_threadsReadyToStopCounter;
     vector<bool> m_threadCleanStops;
@@ -96,9 +102,38 @@ protected:
     // Called to do worker set-up before going into busy-wait loop
     virtual bool DoStart() = 0;
 
-    // Called from the busy-wait loop every so often.
+    // Called from the event loop whenever one of the wait handles is
+    // signalled, and at least every GetPeriodicCheckInterval() milliseconds.
     virtual bool DoPeriodicCheck() = 0;
 
+    // Adds the handles the event loop should wake up for, in addition to the
+    // stop signals; e.g., a child process handle or an overlapped I/O event.
+    // Called before every wait. A handle that remains signalled must either be
+    // reset by DoPeriodicCheck or cause it to return false, otherwise the loop
+    // will spin.
+    virtual void GetWaitHandles(vector<HANDLE>& o_handles) { }
+
+    // The longest the event loop will wait before calling DoPeriodicCheck.
+    virtual DWORD GetPeriodicCheckInterval() const { return DEFAULT_PERIODIC_CHECK_INTERVAL_MS; }
+
+    // Applied to the worker thread for its lifetime.
+    virtual ThreadQoS GetThreadQoS() const { return THREAD_QOS_DEFAULT; }
+
+    // Blocks until one of `handles` is signalled, a stop is signalled, or the
+    // timeout elapses. Callers must check for stop themselves on return.
+    void WaitForEvents(const vector<HANDLE>& handles, DWORD timeoutMilliseconds);
+
+    static const DWORD DEFAULT_PERIODIC_CHECK_INTERVAL_MS = 100;
+
+    // For GetPeriodicCheckInterval implementations: idleIntervalMilliseconds
+    // once there's been no activity for a while since lastActivityTime (a
+    // GetTickCount value), otherwise activeIntervalMilliseconds. An idle
+    // client shouldn't keep waking the CPU for checks that find nothing.
+    static DWORD IdleAwareInterval(
+                    DWORD lastActivityTime,
+                    DWORD activeIntervalMilliseconds,
+                    DWORD idleIntervalMilliseconds);
+
     // Called before stop is full processed. Must not take any destructive
     // actions.
     virtual void StopImminent() = 0;
@@ -115,6 +150,8 @@ protected:
     HANDLE m_thread;
     HANDLE m_startedEvent;
     HANDLE m_stoppedEvent;
+    // Set by Stop() alongside m_internalSignalStopFlag, to wake the event loop
+    HANDLE m_internalStopEvent;
 
     bool m_internalSignalStopFlag;
     StopInfo m_stopInfo;